@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Assertions.h>
+#include <AK/Diagnostics.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/StdLibExtras.h>
+#include <coroutine>
+
+namespace AK {
+
+template<typename T>
+class Coroutine;
+
+namespace Detail {
+
+struct CoroutinePromiseBase {
+    // Coroutines start running as soon as they are called, up to their first suspension point.
+    std::suspend_never initial_suspend() noexcept { return {}; }
+
+    struct FinalAwaiter {
+        bool await_ready() const noexcept { return false; }
+
+        template<typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+        {
+            auto& promise = handle.promise();
+            if (promise.awaiter)
+                return promise.awaiter;
+            if (promise.is_detached)
+                handle.destroy();
+            return std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept { }
+    };
+    FinalAwaiter final_suspend() noexcept { return {}; }
+
+    void unhandled_exception() { VERIFY_NOT_REACHED(); }
+
+    std::coroutine_handle<> awaiter;
+    bool is_detached { false };
+};
+
+template<typename T>
+struct CoroutinePromise : public CoroutinePromiseBase {
+    Coroutine<T> get_return_object();
+
+    void return_value(T&& value) { result.emplace(move(value)); }
+    void return_value(T const& value) { result.emplace(value); }
+
+    Optional<T> result;
+};
+
+template<>
+struct CoroutinePromise<void> : public CoroutinePromiseBase {
+    Coroutine<void> get_return_object();
+
+    void return_void() { }
+};
+
+}
+
+// The return type of a coroutine producing a T. Awaiting a Coroutine suspends the awaiting coroutine until it has
+// completed, and then resumes it directly, without going through the event loop.
+//
+// The coroutine frame is the only allocation made per call. Destroying a Coroutine that has not yet completed
+// detaches it: it keeps running, and its frame is freed once it completes.
+template<typename T>
+class [[nodiscard]] Coroutine {
+    AK_MAKE_NONCOPYABLE(Coroutine);
+
+public:
+    using promise_type = Detail::CoroutinePromise<T>;
+
+    Coroutine(Coroutine&& other)
+        : m_handle(exchange(other.m_handle, {}))
+    {
+    }
+
+    Coroutine& operator=(Coroutine&& other)
+    {
+        if (this != &other) {
+            release();
+            m_handle = exchange(other.m_handle, {});
+        }
+        return *this;
+    }
+
+    ~Coroutine() { release(); }
+
+    bool is_ready() const { return m_handle && m_handle.done(); }
+
+    bool await_ready() const { return is_ready(); }
+
+    void await_suspend(std::coroutine_handle<> awaiter)
+    {
+        VERIFY(!m_handle.promise().awaiter);
+        m_handle.promise().awaiter = awaiter;
+    }
+
+    T await_resume() { return take_result(); }
+
+    // Returns the result of a completed coroutine.
+    T take_result()
+    {
+        VERIFY(is_ready());
+        if constexpr (!IsVoid<T>)
+            return m_handle.promise().result.release_value();
+    }
+
+private:
+    friend promise_type;
+
+    explicit Coroutine(std::coroutine_handle<promise_type> handle)
+        : m_handle(handle)
+    {
+    }
+
+    void release()
+    {
+        if (!m_handle)
+            return;
+
+        if (m_handle.done())
+            m_handle.destroy();
+        else
+            m_handle.promise().is_detached = true;
+
+        m_handle = {};
+    }
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+namespace Detail {
+
+template<typename T>
+Coroutine<T> CoroutinePromise<T>::get_return_object()
+{
+    return Coroutine<T> { std::coroutine_handle<CoroutinePromise<T>>::from_promise(*this) };
+}
+
+inline Coroutine<void> CoroutinePromise<void>::get_return_object()
+{
+    return Coroutine<void> { std::coroutine_handle<CoroutinePromise<void>>::from_promise(*this) };
+}
+
+}
+
+}
+
+// The equivalent of TRY() for use in coroutines returning an ErrorOr. GCC can't compile a co_await inside the statement
+// expression, so await into a local variable first.
+#define CO_TRY(...)                                                                                  \
+    ({                                                                                               \
+        /* Ignore -Wshadow to allow nesting the macro. */                                            \
+        AK_IGNORE_DIAGNOSTIC("-Wshadow",                                                             \
+            auto&& _temporary_result = (__VA_ARGS__));                                               \
+        static_assert(!::AK::Detail::IsLvalueReference<decltype(_temporary_result.release_value())>, \
+            "Do not return a reference from a fallible expression");                                 \
+        if (_temporary_result.is_error()) [[unlikely]]                                               \
+            co_return _temporary_result.release_error();                                             \
+        _temporary_result.release_value();                                                           \
+    })
+
+#if USING_AK_GLOBALLY
+using AK::Coroutine;
+#endif
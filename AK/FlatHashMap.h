@@ -0,0 +1,665 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/BitCast.h>
+#include <AK/BuiltinWrappers.h>
+#include <AK/Concepts.h>
+#include <AK/Error.h>
+#include <AK/HashTable.h>
+#include <AK/IntegralMath.h>
+#include <AK/Optional.h>
+#include <AK/SIMD.h>
+#include <AK/StdLibExtras.h>
+#include <AK/Traits.h>
+#include <AK/TypedTransfer.h>
+#include <AK/Vector.h>
+#include <AK/kmalloc.h>
+#include <initializer_list>
+
+// See the note in SIMDExtras.h; none of the vector-typed functions here are visible outside of this header.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+namespace AK {
+
+namespace Detail {
+
+// Every slot has a control byte. Full slots store the low seven bits of their entry's hash, which lets a lookup skip
+// nearly all mismatching entries without touching them.
+enum class FlatHashControl : i8 {
+    Empty = -128,
+    Deleted = -2,
+};
+
+// A set of slots within a control group.
+class FlatHashGroupMask {
+public:
+#if ARCH(X86_64)
+    static constexpr size_t bits_per_slot = 1;
+    static constexpr u64 slot_bits = 0xffff;
+#else
+    static constexpr size_t bits_per_slot = 4;
+    static constexpr u64 slot_bits = 0x8888'8888'8888'8888;
+#endif
+
+    explicit FlatHashGroupMask(u64 bits)
+        : m_bits(bits & slot_bits)
+    {
+    }
+
+    explicit operator bool() const { return m_bits != 0; }
+
+    size_t lowest_slot() const { return count_trailing_zeroes(m_bits) / bits_per_slot; }
+    void clear_lowest_slot() { m_bits &= m_bits - 1; }
+
+private:
+    u64 m_bits { 0 };
+};
+
+// Sixteen control bytes that are compared against a value all at once.
+class FlatHashControlGroup {
+public:
+    static constexpr size_t width = 16;
+
+    ALWAYS_INLINE static FlatHashControlGroup load(i8 const* control)
+    {
+        SIMD::i8x16 bytes;
+        __builtin_memcpy(&bytes, control, sizeof(bytes));
+        return FlatHashControlGroup { bytes };
+    }
+
+    ALWAYS_INLINE FlatHashGroupMask match(i8 value) const { return mask_for(m_bytes == splat(value)); }
+    ALWAYS_INLINE FlatHashGroupMask match_empty() const { return match(to_underlying(FlatHashControl::Empty)); }
+    ALWAYS_INLINE FlatHashGroupMask match_empty_or_deleted() const { return mask_for(m_bytes < splat(0)); }
+
+private:
+    explicit FlatHashControlGroup(SIMD::i8x16 bytes)
+        : m_bytes(bytes)
+    {
+    }
+
+    ALWAYS_INLINE static SIMD::i8x16 splat(i8 value) { return SIMD::i8x16 {} + value; }
+
+    ALWAYS_INLINE static FlatHashGroupMask mask_for(SIMD::i8x16 comparison)
+    {
+#if ARCH(X86_64)
+        // SSE2's pmovmskb gathers the top bit of every byte.
+        return FlatHashGroupMask { static_cast<u32>(__builtin_ia32_pmovmskb128(bit_cast<SIMD::c8x16>(comparison))) };
+#elif __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        // There is no movemask on NEON, but a narrowing shift leaves four bits of every byte, which is just as good.
+        auto narrowed = __builtin_convertvector(bit_cast<SIMD::u16x8>(comparison) >> 4, SIMD::u8x8);
+        return FlatHashGroupMask { bit_cast<u64>(narrowed) };
+#else
+        u64 bits = 0;
+        for (size_t i = 0; i < width; ++i) {
+            if (comparison[i])
+                bits |= 0x8ull << (i * FlatHashGroupMask::bits_per_slot);
+        }
+        return FlatHashGroupMask { bits };
+#endif
+    }
+
+    SIMD::i8x16 m_bytes;
+};
+
+}
+
+template<typename FlatHashMapType, typename T>
+class FlatHashMapIterator {
+    friend FlatHashMapType;
+
+public:
+    bool operator==(FlatHashMapIterator const& other) const { return m_control == other.m_control; }
+    bool operator!=(FlatHashMapIterator const& other) const { return m_control != other.m_control; }
+    T& operator*() { return *m_slot; }
+    T* operator->() { return m_slot; }
+    void operator++()
+    {
+        ++m_control;
+        ++m_slot;
+        skip_to_full_slot();
+    }
+
+private:
+    FlatHashMapIterator(i8 const* control, i8 const* end_control, T* slot)
+        : m_control(control)
+        , m_end_control(end_control)
+        , m_slot(slot)
+    {
+        skip_to_full_slot();
+    }
+
+    void skip_to_full_slot()
+    {
+        while (m_control != m_end_control && *m_control < 0) {
+            ++m_control;
+            ++m_slot;
+        }
+    }
+
+    i8 const* m_control { nullptr };
+    i8 const* m_end_control { nullptr };
+    T* m_slot { nullptr };
+};
+
+// A map datastructure with the same interface as an unordered HashMap, based on a SwissTable-style hash table. Entries
+// are stored flat in one array, with a separate array of one-byte control words that are probed sixteen at a time
+// with SIMD. Lookups thereby touch at most a cache line of metadata before they reach a matching entry, which makes
+// this a better fit than HashMap for large maps with small keys that are looked up far more often than iterated.
+//
+// Unlike HashMap, there is no ordered variant, and the iteration order has no relation to the insertion order.
+template<typename K, typename V, typename KeyTraits, typename ValueTraits>
+class FlatHashMap {
+    using ControlGroup = Detail::FlatHashControlGroup;
+    using Control = Detail::FlatHashControl;
+
+    static constexpr size_t group_width = ControlGroup::width;
+
+public:
+    struct Entry {
+        K key;
+        V value;
+    };
+
+    using KeyType = K;
+    using ValueType = V;
+    using IteratorType = FlatHashMapIterator<FlatHashMap, Entry>;
+    using ConstIteratorType = FlatHashMapIterator<FlatHashMap const, Entry const>;
+
+    FlatHashMap() = default;
+
+    FlatHashMap(std::initializer_list<Entry> list)
+    {
+        MUST(try_ensure_capacity(list.size()));
+        for (auto& [key, value] : list)
+            set(key, value);
+    }
+
+    FlatHashMap(FlatHashMap const& other) // FIXME: Not OOM-safe! Use clone() instead.
+    {
+        ensure_capacity(other.size());
+        for (auto const& [key, value] : other)
+            set(key, value);
+    }
+
+    FlatHashMap(FlatHashMap&& other) noexcept
+        : m_control(exchange(other.m_control, nullptr))
+        , m_slots(exchange(other.m_slots, nullptr))
+        , m_capacity(exchange(other.m_capacity, 0))
+        , m_size(exchange(other.m_size, 0))
+        , m_growth_left(exchange(other.m_growth_left, 0))
+    {
+    }
+
+    FlatHashMap& operator=(FlatHashMap const& other) // FIXME: Not OOM-safe! Use clone() instead.
+    {
+        FlatHashMap temporary(other);
+        swap(*this, temporary);
+        return *this;
+    }
+
+    FlatHashMap& operator=(FlatHashMap&& other) noexcept
+    {
+        FlatHashMap temporary { move(other) };
+        swap(*this, temporary);
+        return *this;
+    }
+
+    ~FlatHashMap()
+    {
+        destroy_entries();
+        kfree(m_control);
+    }
+
+    friend void swap(FlatHashMap& a, FlatHashMap& b) noexcept
+    {
+        swap(a.m_control, b.m_control);
+        swap(a.m_slots, b.m_slots);
+        swap(a.m_capacity, b.m_capacity);
+        swap(a.m_size, b.m_size);
+        swap(a.m_growth_left, b.m_growth_left);
+    }
+
+    [[nodiscard]] bool is_empty() const { return m_size == 0; }
+    [[nodiscard]] size_t size() const { return m_size; }
+    [[nodiscard]] size_t capacity() const { return m_capacity; }
+
+    void clear()
+    {
+        *this = FlatHashMap();
+    }
+
+    void clear_with_capacity()
+    {
+        destroy_entries();
+        reset_control();
+    }
+
+    HashSetResult set(K const& key, V const& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace) { return MUST(try_set_entry(key, value, existing_entry_behavior)); }
+    HashSetResult set(K const& key, V&& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace) { return MUST(try_set_entry(key, move(value), existing_entry_behavior)); }
+    HashSetResult set(K&& key, V&& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace) { return MUST(try_set_entry(move(key), move(value), existing_entry_behavior)); }
+    ErrorOr<HashSetResult> try_set(K const& key, V const& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace) { return try_set_entry(key, value, existing_entry_behavior); }
+    ErrorOr<HashSetResult> try_set(K const& key, V&& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace) { return try_set_entry(key, move(value), existing_entry_behavior); }
+    ErrorOr<HashSetResult> try_set(K&& key, V&& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace) { return try_set_entry(move(key), move(value), existing_entry_behavior); }
+
+    void update(FlatHashMap const& other)
+    {
+        for (auto const& [key, value] : other)
+            set(key, value);
+    }
+
+    bool remove(K const& key)
+    {
+        auto it = find(key);
+        if (it == end())
+            return false;
+        remove(it);
+        return true;
+    }
+
+    template<Concepts::HashCompatible<K> Key>
+    requires(IsSame<KeyTraits, Traits<K>>) bool remove(Key const& key)
+    {
+        auto it = find(key);
+        if (it == end())
+            return false;
+        remove(it);
+        return true;
+    }
+
+    void remove(IteratorType it)
+    {
+        VERIFY(it != end());
+        erase_slot(it.m_slot - m_slots);
+    }
+
+    template<typename TUnaryPredicate>
+    bool remove_all_matching(TUnaryPredicate const& predicate)
+    {
+        bool removed_something = false;
+        for (size_t index = 0; index < m_capacity; ++index) {
+            if (m_control[index] >= 0 && predicate(m_slots[index].key, m_slots[index].value)) {
+                erase_slot(index);
+                removed_something = true;
+            }
+        }
+        return removed_something;
+    }
+
+    [[nodiscard]] IteratorType begin() { return IteratorType(m_control, m_control + m_capacity, m_slots); }
+    [[nodiscard]] IteratorType end() { return IteratorType(m_control + m_capacity, m_control + m_capacity, m_slots + m_capacity); }
+    [[nodiscard]] ConstIteratorType begin() const { return ConstIteratorType(m_control, m_control + m_capacity, m_slots); }
+    [[nodiscard]] ConstIteratorType end() const { return ConstIteratorType(m_control + m_capacity, m_control + m_capacity, m_slots + m_capacity); }
+
+    [[nodiscard]] IteratorType find(K const& key)
+    {
+        return iterator_for(lookup(KeyTraits::hash(key), [&](auto const& candidate) { return KeyTraits::equals(candidate.key, key); }));
+    }
+
+    [[nodiscard]] ConstIteratorType find(K const& key) const
+    {
+        return iterator_for(lookup(KeyTraits::hash(key), [&](auto const& candidate) { return KeyTraits::equals(candidate.key, key); }));
+    }
+
+    template<typename TUnaryPredicate>
+    [[nodiscard]] IteratorType find(unsigned hash, TUnaryPredicate predicate)
+    {
+        return iterator_for(lookup(hash, predicate));
+    }
+
+    template<typename TUnaryPredicate>
+    [[nodiscard]] ConstIteratorType find(unsigned hash, TUnaryPredicate predicate) const
+    {
+        return iterator_for(lookup(hash, predicate));
+    }
+
+    template<Concepts::HashCompatible<K> Key>
+    requires(IsSame<KeyTraits, Traits<K>>) [[nodiscard]] IteratorType find(Key const& key)
+    {
+        return iterator_for(lookup(Traits<Key>::hash(key), [&](auto const& candidate) { return Traits<K>::equals(candidate.key, key); }));
+    }
+
+    template<Concepts::HashCompatible<K> Key>
+    requires(IsSame<KeyTraits, Traits<K>>) [[nodiscard]] ConstIteratorType find(Key const& key) const
+    {
+        return iterator_for(lookup(Traits<Key>::hash(key), [&](auto const& candidate) { return Traits<K>::equals(candidate.key, key); }));
+    }
+
+    ErrorOr<void> try_ensure_capacity(size_t capacity)
+    {
+        auto required_capacity = capacity_for_size(capacity);
+        if (required_capacity <= m_capacity)
+            return {};
+        return try_rehash(required_capacity);
+    }
+
+    void ensure_capacity(size_t capacity) { MUST(try_ensure_capacity(capacity)); }
+
+    Optional<typename ValueTraits::ConstPeekType> get(K const& key) const
+    {
+        auto it = find(key);
+        if (it == end())
+            return {};
+        return (*it).value;
+    }
+
+    Optional<typename ValueTraits::PeekType> get(K const& key)
+    requires(!IsConst<typename ValueTraits::PeekType>)
+    {
+        auto it = find(key);
+        if (it == end())
+            return {};
+        return (*it).value;
+    }
+
+    template<Concepts::HashCompatible<K> Key>
+    requires(IsSame<KeyTraits, Traits<K>>) Optional<typename ValueTraits::ConstPeekType> get(Key const& key) const
+    {
+        auto it = find(key);
+        if (it == end())
+            return {};
+        return (*it).value;
+    }
+
+    template<Concepts::HashCompatible<K> Key>
+    requires(IsSame<KeyTraits, Traits<K>>) Optional<typename ValueTraits::PeekType> get(Key const& key)
+    requires(!IsConst<typename ValueTraits::PeekType>)
+    {
+        auto it = find(key);
+        if (it == end())
+            return {};
+        return (*it).value;
+    }
+
+    [[nodiscard]] bool contains(K const& key) const
+    {
+        return find(key) != end();
+    }
+
+    template<Concepts::HashCompatible<K> Key>
+    requires(IsSame<KeyTraits, Traits<K>>) [[nodiscard]] bool contains(Key const& key) const
+    {
+        return find(key) != end();
+    }
+
+    Optional<V> take(K const& key)
+    {
+        auto it = find(key);
+        if (it == end())
+            return {};
+
+        auto value = move(it->value);
+        remove(it);
+        return value;
+    }
+
+    template<Concepts::HashCompatible<K> Key>
+    requires(IsSame<KeyTraits, Traits<K>>) Optional<V> take(Key const& key)
+    {
+        auto it = find(key);
+        if (it == end())
+            return {};
+
+        auto value = move(it->value);
+        remove(it);
+        return value;
+    }
+
+    template<typename Callback>
+    V& ensure(K const& key, Callback initialization_callback, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Keep)
+    {
+        auto hash = KeyTraits::hash(key);
+        if (auto* entry = lookup(hash, [&](auto const& candidate) { return KeyTraits::equals(candidate.key, key); })) {
+            if (existing_entry_behavior == HashSetExistingEntryBehavior::Replace)
+                entry->value = initialization_callback();
+            return entry->value;
+        }
+
+        auto* slot = MUST(prepare_insert(hash));
+        new (slot) Entry { key, initialization_callback() };
+        return slot->value;
+    }
+
+    V& ensure(K const& key)
+    {
+        return ensure(key, [] { return V(); });
+    }
+
+    [[nodiscard]] Vector<K> keys() const
+    {
+        Vector<K> list;
+        list.ensure_capacity(size());
+        for (auto const& [key, _] : *this)
+            list.unchecked_append(key);
+        return list;
+    }
+
+    ErrorOr<FlatHashMap> clone() const
+    {
+        FlatHashMap map_clone;
+        TRY(map_clone.try_ensure_capacity(size()));
+        for (auto const& [key, value] : *this)
+            TRY(map_clone.try_set(key, value));
+        return map_clone;
+    }
+
+    bool operator==(FlatHashMap const& other) const
+    {
+        if (size() != other.size())
+            return false;
+        for (auto const& [key, value] : *this) {
+            auto it = other.find(key);
+            if (it == other.end())
+                return false;
+            if (!ValueTraits::equals(value, it->value))
+                return false;
+        }
+        return true;
+    }
+
+private:
+    static constexpr size_t minimum_capacity = group_width;
+
+    // The table grows once seven eighths of its slots are full or deleted, which leaves every probe sequence with an
+    // empty slot to stop at.
+    static constexpr size_t max_size_for_capacity(size_t capacity) { return capacity - capacity / 8; }
+
+    static constexpr size_t capacity_for_size(size_t size)
+    {
+        auto capacity = max(minimum_capacity, size + size / 7 + 1);
+        return AK::exp2<size_t>(AK::ceil_log2(capacity));
+    }
+
+    static constexpr size_t slots_offset(size_t capacity) { return round_up_to_power_of_two(capacity, alignof(Entry)); }
+
+    static i8 control_for_hash(unsigned hash) { return static_cast<i8>(hash & 0x7f); }
+    static size_t group_for_hash(unsigned hash) { return hash >> 7; }
+
+    size_t group_mask() const { return m_capacity / group_width - 1; }
+
+    IteratorType iterator_for(Entry* entry)
+    {
+        if (!entry)
+            return end();
+        auto index = entry - m_slots;
+        return IteratorType(m_control + index, m_control + m_capacity, entry);
+    }
+
+    ConstIteratorType iterator_for(Entry const* entry) const
+    {
+        if (!entry)
+            return end();
+        auto index = entry - m_slots;
+        return ConstIteratorType(m_control + index, m_control + m_capacity, entry);
+    }
+
+    template<typename TUnaryPredicate>
+    [[nodiscard]] Entry* lookup(unsigned hash, TUnaryPredicate const& predicate) const
+    {
+        if (m_size == 0)
+            return nullptr;
+
+        auto control = control_for_hash(hash);
+        auto group = group_for_hash(hash) & group_mask();
+
+        // Triangular probing visits every group once if the number of groups is a power of two.
+        for (size_t step = 1;; ++step) {
+            auto control_group = ControlGroup::load(m_control + group * group_width);
+
+            for (auto matches = control_group.match(control); matches; matches.clear_lowest_slot()) {
+                auto* slot = &m_slots[group * group_width + matches.lowest_slot()];
+                if (predicate(*slot))
+                    return slot;
+            }
+
+            if (control_group.match_empty())
+                return nullptr;
+
+            group = (group + step) & group_mask();
+        }
+    }
+
+    size_t find_insert_index(unsigned hash) const
+    {
+        auto group = group_for_hash(hash) & group_mask();
+
+        for (size_t step = 1;; ++step) {
+            auto control_group = ControlGroup::load(m_control + group * group_width);
+            if (auto available = control_group.match_empty_or_deleted())
+                return group * group_width + available.lowest_slot();
+
+            group = (group + step) & group_mask();
+        }
+    }
+
+    ErrorOr<Entry*> prepare_insert(unsigned hash)
+    {
+        if (m_capacity == 0)
+            TRY(try_rehash(minimum_capacity));
+
+        auto index = find_insert_index(hash);
+
+        if (m_growth_left == 0 && m_control[index] == to_underlying(Control::Empty)) {
+            // Rehashing at the same capacity is enough if most of the used slots are merely deleted.
+            auto new_capacity = m_size * 32 <= m_capacity * 25 ? m_capacity : m_capacity * 2;
+            TRY(try_rehash(new_capacity));
+            index = find_insert_index(hash);
+        }
+
+        if (m_control[index] == to_underlying(Control::Empty))
+            --m_growth_left;
+
+        m_control[index] = control_for_hash(hash);
+        ++m_size;
+        return &m_slots[index];
+    }
+
+    template<typename KeyArgument, typename ValueArgument>
+    ErrorOr<HashSetResult> try_set_entry(KeyArgument&& key, ValueArgument&& value, HashSetExistingEntryBehavior existing_entry_behavior)
+    {
+        auto hash = KeyTraits::hash(key);
+
+        if (auto* entry = lookup(hash, [&](auto const& candidate) { return KeyTraits::equals(candidate.key, key); })) {
+            if (existing_entry_behavior == HashSetExistingEntryBehavior::Keep)
+                return HashSetResult::KeptExistingEntry;
+
+            entry->~Entry();
+            new (entry) Entry { forward<KeyArgument>(key), forward<ValueArgument>(value) };
+            return HashSetResult::ReplacedExistingEntry;
+        }
+
+        auto* slot = TRY(prepare_insert(hash));
+        new (slot) Entry { forward<KeyArgument>(key), forward<ValueArgument>(value) };
+        return HashSetResult::InsertedNewEntry;
+    }
+
+    void erase_slot(size_t index)
+    {
+        VERIFY(m_control[index] >= 0);
+        m_slots[index].~Entry();
+        --m_size;
+
+        // A lookup only moves on from a group that has no empty slots. If this group has one, no lookup can ever have
+        // needed to probe past it, so the slot may become empty rather than a tombstone.
+        auto group_start = index & ~(group_width - 1);
+        if (ControlGroup::load(m_control + group_start).match_empty()) {
+            m_control[index] = to_underlying(Control::Empty);
+            ++m_growth_left;
+        } else {
+            m_control[index] = to_underlying(Control::Deleted);
+        }
+    }
+
+    void destroy_entries()
+    {
+        if constexpr (!IsTriviallyDestructible<Entry>) {
+            for (size_t index = 0; index < m_capacity; ++index) {
+                if (m_control[index] >= 0)
+                    m_slots[index].~Entry();
+            }
+        }
+        m_size = 0;
+    }
+
+    void reset_control()
+    {
+        if (m_capacity != 0)
+            __builtin_memset(m_control, static_cast<u8>(Control::Empty), m_capacity);
+        m_growth_left = max_size_for_capacity(m_capacity);
+    }
+
+    ErrorOr<void> try_rehash(size_t new_capacity)
+    {
+        VERIFY(new_capacity >= minimum_capacity && is_power_of_two(new_capacity));
+        VERIFY(max_size_for_capacity(new_capacity) > m_size);
+
+        auto* allocation = static_cast<u8*>(kmalloc(slots_offset(new_capacity) + new_capacity * sizeof(Entry)));
+        if (!allocation)
+            return Error::from_errno(ENOMEM);
+
+        auto* old_control = m_control;
+        auto* old_slots = m_slots;
+        auto old_capacity = m_capacity;
+
+        m_control = reinterpret_cast<i8*>(allocation);
+        m_slots = reinterpret_cast<Entry*>(allocation + slots_offset(new_capacity));
+        m_capacity = new_capacity;
+        reset_control();
+
+        for (size_t old_index = 0; old_index < old_capacity; ++old_index) {
+            if (old_control[old_index] < 0)
+                continue;
+
+            auto hash = KeyTraits::hash(old_slots[old_index].key);
+            auto index = find_insert_index(hash);
+
+            m_control[index] = control_for_hash(hash);
+            TypedTransfer<Entry>::relocate(&m_slots[index], &old_slots[old_index], 1);
+        }
+
+        m_growth_left -= m_size;
+        kfree(old_control);
+        return {};
+    }
+
+    static_assert(alignof(Entry) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+
+    i8* m_control { nullptr };
+    Entry* m_slots { nullptr };
+    size_t m_capacity { 0 };
+    size_t m_size { 0 };
+    size_t m_growth_left { 0 };
+};
+
+}
+
+#pragma GCC diagnostic pop
+
+#if USING_AK_GLOBALLY
+using AK::FlatHashMap;
+#endif
@@ -23,10 +23,52 @@ namespace AK {
 // a value between 5 and 15 should work well in most situations:
 // https://algs4.cs.princeton.edu/23quicksort/
 
+//
+// Both quick sorts are introsorts: a partition that is still being split after
+// about 2 * log2(n) levels is heap sorted instead, which bounds the worst case
+// to O(n log n) for inputs that defeat the pivot choice.
+
 static constexpr int INSERTION_SORT_CUTOFF = 7;
 
+namespace Detail {
+
+constexpr int introsort_depth_limit(ssize_t size)
+{
+    int depth_limit = 0;
+    for (; size > 1; size >>= 1)
+        depth_limit += 2;
+    return depth_limit;
+}
+
+// `at` maps an index in [0, size) to a reference to the element at that index.
+template<typename At, typename LessThan>
+void heap_sort(At const& at, ssize_t size, LessThan& less_than)
+{
+    auto sift_down = [&](ssize_t root, ssize_t end) {
+        for (;;) {
+            auto child = 2 * root + 1;
+            if (child >= end)
+                return;
+            if (child + 1 < end && less_than(at(child), at(child + 1)))
+                ++child;
+            if (!less_than(at(root), at(child)))
+                return;
+            swap(at(root), at(child));
+            root = child;
+        }
+    };
+
+    for (auto root = size / 2; root-- > 0;)
+        sift_down(root, size);
+
+    for (auto end = size - 1; end > 0; --end) {
+        swap(at(0), at(end));
+        sift_down(0, end);
+    }
+}
+
 template<typename Collection, typename LessThan>
-void dual_pivot_quick_sort(Collection& col, int start, int end, LessThan less_than)
+void dual_pivot_quick_sort(Collection& col, int start, int end, LessThan less_than, int depth_limit)
 {
     if ((end + 1) - start <= INSERTION_SORT_CUTOFF) {
         AK::insertion_sort(col, start, end, less_than);
@@ -34,6 +76,11 @@ void dual_pivot_quick_sort(Collection& col, int start, int end, LessThan less_th
     }
 
     while (start < end) {
+        if (depth_limit-- == 0) {
+            heap_sort([&](ssize_t index) -> decltype(auto) { return col[start + index]; }, (end + 1) - start, less_than);
+            return;
+        }
+
         int size = end - start + 1;
         if (size > 3) {
             int third = size / 3;
@@ -88,30 +135,35 @@ void dual_pivot_quick_sort(Collection& col, int start, int end, LessThan less_th
         int right_size = (end + 1) - (right_pointer + 1);
 
         if (left_size >= middle_size && left_size >= right_size) {
-            dual_pivot_quick_sort(col, left_pointer + 1, right_pointer - 1, less_than);
-            dual_pivot_quick_sort(col, right_pointer + 1, end, less_than);
+            dual_pivot_quick_sort(col, left_pointer + 1, right_pointer - 1, less_than, depth_limit);
+            dual_pivot_quick_sort(col, right_pointer + 1, end, less_than, depth_limit);
             end = left_pointer - 1;
         } else if (middle_size >= right_size) {
-            dual_pivot_quick_sort(col, start, left_pointer - 1, less_than);
-            dual_pivot_quick_sort(col, right_pointer + 1, end, less_than);
+            dual_pivot_quick_sort(col, start, left_pointer - 1, less_than, depth_limit);
+            dual_pivot_quick_sort(col, right_pointer + 1, end, less_than, depth_limit);
             start = left_pointer + 1;
             end = right_pointer - 1;
         } else {
-            dual_pivot_quick_sort(col, start, left_pointer - 1, less_than);
-            dual_pivot_quick_sort(col, left_pointer + 1, right_pointer - 1, less_than);
+            dual_pivot_quick_sort(col, start, left_pointer - 1, less_than, depth_limit);
+            dual_pivot_quick_sort(col, left_pointer + 1, right_pointer - 1, less_than, depth_limit);
             start = right_pointer + 1;
         }
     }
 }
 
 template<typename Iterator, typename LessThan>
-void single_pivot_quick_sort(Iterator start, Iterator end, LessThan less_than)
+void single_pivot_quick_sort(Iterator start, Iterator end, LessThan less_than, int depth_limit)
 {
     for (;;) {
         int size = end - start;
         if (size <= 1)
             return;
 
+        if (depth_limit-- == 0) {
+            heap_sort([&](ssize_t index) -> decltype(auto) { return *(start + index); }, size, less_than);
+            return;
+        }
+
         int pivot_point = size / 2;
         swap(*(start + pivot_point), *start);
 
@@ -129,15 +181,29 @@ void single_pivot_quick_sort(Iterator start, Iterator end, LessThan less_than)
         // Recur into the shorter part of the remaining data
         // to ensure a stack depth of at most log(n).
         if (i > size / 2) {
-            single_pivot_quick_sort(start + i, end, less_than);
+            single_pivot_quick_sort(start + i, end, less_than, depth_limit);
             end = start + i - 1;
         } else {
-            single_pivot_quick_sort(start, start + i - 1, less_than);
+            single_pivot_quick_sort(start, start + i - 1, less_than, depth_limit);
             start = start + i;
         }
     }
 }
 
+}
+
+template<typename Collection, typename LessThan>
+void dual_pivot_quick_sort(Collection& col, int start, int end, LessThan less_than)
+{
+    Detail::dual_pivot_quick_sort(col, start, end, move(less_than), Detail::introsort_depth_limit((end + 1) - start));
+}
+
+template<typename Iterator, typename LessThan>
+void single_pivot_quick_sort(Iterator start, Iterator end, LessThan less_than)
+{
+    Detail::single_pivot_quick_sort(start, end, move(less_than), Detail::introsort_depth_limit(end - start));
+}
+
 template<typename Iterator>
 void quick_sort(Iterator start, Iterator end)
 {
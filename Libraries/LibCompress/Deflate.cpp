@@ -165,6 +165,8 @@ ErrorOr<NonnullOwnPtr<DeflateCompressor>> DeflateCompressor::create(MaybeOwned<S
 
 ErrorOr<ByteBuffer> DeflateCompressor::compress_all(ReadonlyBytes bytes, GenericZlibCompressionLevel compression_level)
 {
+    if (bytes.size() >= minimum_size_for_parallel_compression)
+        return compress_all_in_parallel(bytes, GenericZlibContainer::Deflate, compression_level);
     return ::Compress::compress_all<DeflateCompressor>(bytes, compression_level);
 }
 
@@ -4,7 +4,10 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Endian.h>
+#include <AK/ScopeGuard.h>
 #include <LibCompress/GenericZlib.h>
+#include <LibThreading/ThreadPool.h>
 
 #include <zlib.h>
 
@@ -35,6 +38,20 @@ static Error handle_zlib_error(int ret)
     }
 }
 
+static int zlib_compression_level(GenericZlibCompressionLevel compression_level)
+{
+    switch (compression_level) {
+    case GenericZlibCompressionLevel::Fastest:
+        return Z_BEST_SPEED;
+    case GenericZlibCompressionLevel::Default:
+        return Z_DEFAULT_COMPRESSION;
+    case GenericZlibCompressionLevel::Best:
+        return Z_BEST_COMPRESSION;
+    default:
+        VERIFY_NOT_REACHED();
+    }
+}
+
 GenericZlibDecompressor::GenericZlibDecompressor(AK::FixedArray<u8> buffer, MaybeOwned<Stream> stream, z_stream* zstream)
     : m_stream(move(stream))
     , m_zstream(zstream)
@@ -134,20 +151,7 @@ ErrorOr<z_stream*> GenericZlibCompressor::new_z_stream(int window_bits, GenericZ
     zstream->zfree = nullptr;
     zstream->opaque = nullptr;
 
-    int level = [&] {
-        switch (compression_level) {
-        case GenericZlibCompressionLevel::Fastest:
-            return Z_BEST_SPEED;
-        case GenericZlibCompressionLevel::Default:
-            return Z_DEFAULT_COMPRESSION;
-        case GenericZlibCompressionLevel::Best:
-            return Z_BEST_COMPRESSION;
-        default:
-            VERIFY_NOT_REACHED();
-        }
-    }();
-
-    if (auto ret = deflateInit2(zstream, level, Z_DEFLATED, window_bits, MAX_MEM_LEVEL, Z_DEFAULT_STRATEGY); ret != Z_OK)
+    if (auto ret = deflateInit2(zstream, zlib_compression_level(compression_level), Z_DEFLATED, window_bits, MAX_MEM_LEVEL, Z_DEFAULT_STRATEGY); ret != Z_OK)
         return handle_zlib_error(ret);
 
     return zstream;
@@ -225,4 +229,139 @@ ErrorOr<void> GenericZlibCompressor::finish()
     }
 }
 
+
+// pigz uses the same block size, which keeps the cost of the flush markers and of priming each block negligible while
+// still giving every thread plenty of blocks to work on.
+static constexpr size_t parallel_compression_block_size = 128 * KiB;
+static constexpr size_t maximum_dictionary_size = 32 * KiB;
+
+static ErrorOr<ByteBuffer> compress_raw_deflate_block(ReadonlyBytes dictionary, ReadonlyBytes block, bool is_last_block, int level)
+{
+    z_stream zstream {};
+    if (auto ret = deflateInit2(&zstream, level, Z_DEFLATED, -MAX_WBITS, MAX_MEM_LEVEL, Z_DEFAULT_STRATEGY); ret != Z_OK)
+        return handle_zlib_error(ret);
+    ScopeGuard end_stream = [&] { deflateEnd(&zstream); };
+
+    if (!dictionary.is_empty()) {
+        if (auto ret = deflateSetDictionary(&zstream, dictionary.data(), dictionary.size()); ret != Z_OK)
+            return handle_zlib_error(ret);
+    }
+
+    zstream.next_in = const_cast<u8*>(block.data());
+    zstream.avail_in = block.size();
+
+    // Every block but the last ends in a sync flush, which byte-aligns the output and leaves the final block bit unset,
+    // so the compressed blocks can simply be concatenated.
+    auto flush = is_last_block ? Z_FINISH : Z_SYNC_FLUSH;
+
+    auto output = TRY(ByteBuffer::create_uninitialized(deflateBound(&zstream, block.size()) + 16));
+    size_t output_size = 0;
+
+    while (true) {
+        zstream.next_out = output.data() + output_size;
+        zstream.avail_out = output.size() - output_size;
+
+        auto ret = deflate(&zstream, flush);
+        if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR)
+            return handle_zlib_error(ret);
+
+        output_size = output.size() - zstream.avail_out;
+
+        // A sync flush is complete once deflate leaves some of the output space unused.
+        if (ret == Z_STREAM_END || (flush == Z_SYNC_FLUSH && zstream.avail_out != 0))
+            break;
+
+        TRY(output.try_resize(output.size() * 2));
+    }
+
+    output.resize(output_size);
+    return output;
+}
+
+ErrorOr<ByteBuffer> compress_all_in_parallel(ReadonlyBytes bytes, GenericZlibContainer container, GenericZlibCompressionLevel compression_level)
+{
+    auto block_count = max(ceil_div(bytes.size(), parallel_compression_block_size), 1uz);
+    auto level = zlib_compression_level(compression_level);
+
+    Vector<ErrorOr<ByteBuffer>> compressed_blocks;
+    TRY(compressed_blocks.try_ensure_capacity(block_count));
+    for (size_t i = 0; i < block_count; ++i)
+        compressed_blocks.unchecked_append(ByteBuffer {});
+
+    Vector<uLong> block_checksums;
+    TRY(block_checksums.try_resize(block_count));
+
+    Threading::ThreadPool::the().parallel_for(block_count, [&](size_t index) {
+        auto start = index * parallel_compression_block_size;
+        auto block = bytes.slice(start, min(parallel_compression_block_size, bytes.size() - start));
+
+        // The dictionary is the uncompressed data preceding the block, which is all known up front. This lets matches
+        // reach back across block boundaries exactly as they would in a single stream.
+        auto dictionary_size = min(start, maximum_dictionary_size);
+        auto dictionary = bytes.slice(start - dictionary_size, dictionary_size);
+
+        compressed_blocks[index] = compress_raw_deflate_block(dictionary, block, index == block_count - 1, level);
+
+        if (container == GenericZlibContainer::Gzip)
+            block_checksums[index] = crc32(0, block.data(), block.size());
+        else if (container == GenericZlibContainer::Zlib)
+            block_checksums[index] = adler32(1, block.data(), block.size());
+    });
+
+    ByteBuffer output;
+
+    if (container == GenericZlibContainer::Gzip) {
+        // ID1, ID2, CM (deflate), FLG, MTIME, XFL and OS (unknown).
+        u8 extra_flags = 0;
+        if (compression_level == GenericZlibCompressionLevel::Best)
+            extra_flags = 2;
+        else if (compression_level == GenericZlibCompressionLevel::Fastest)
+            extra_flags = 4;
+        u8 const header[] = { 0x1f, 0x8b, 8, 0, 0, 0, 0, 0, extra_flags, 0xff };
+        TRY(output.try_append(header, sizeof(header)));
+    } else if (container == GenericZlibContainer::Zlib) {
+        // CMF is deflate with a 32 KiB window. FLG holds the compression level and a check value that makes the header a
+        // multiple of 31.
+        u8 compression_method_and_flags = 0x78;
+        u8 flags = [&] -> u8 {
+            switch (compression_level) {
+            case GenericZlibCompressionLevel::Fastest:
+                return 0;
+            case GenericZlibCompressionLevel::Default:
+                return 2 << 6;
+            case GenericZlibCompressionLevel::Best:
+                return 3 << 6;
+            default:
+                VERIFY_NOT_REACHED();
+            }
+        }();
+        flags += (31 - ((compression_method_and_flags << 8) | flags) % 31) % 31;
+        u8 const header[] = { compression_method_and_flags, flags };
+        TRY(output.try_append(header, sizeof(header)));
+    }
+
+    uLong checksum = container == GenericZlibContainer::Zlib ? 1 : 0;
+
+    for (size_t i = 0; i < block_count; ++i) {
+        auto compressed_block = TRY(move(compressed_blocks[i]));
+        TRY(output.try_append(compressed_block.bytes()));
+
+        auto block_size = min(parallel_compression_block_size, bytes.size() - i * parallel_compression_block_size);
+        if (container == GenericZlibContainer::Gzip)
+            checksum = crc32_combine(checksum, block_checksums[i], block_size);
+        else if (container == GenericZlibContainer::Zlib)
+            checksum = adler32_combine(checksum, block_checksums[i], block_size);
+    }
+
+    if (container == GenericZlibContainer::Gzip) {
+        LittleEndian<u32> const trailer[] = { static_cast<u32>(checksum), static_cast<u32>(bytes.size()) };
+        TRY(output.try_append(trailer, sizeof(trailer)));
+    } else if (container == GenericZlibContainer::Zlib) {
+        BigEndian<u32> const trailer = static_cast<u32>(checksum);
+        TRY(output.try_append(&trailer, sizeof(trailer)));
+    }
+
+    return output;
+}
+
 }
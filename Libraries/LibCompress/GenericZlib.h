@@ -24,6 +24,15 @@ enum class GenericZlibCompressionLevel : u8 {
     Best,
 };
 
+enum class GenericZlibContainer : u8 {
+    Deflate,
+    Zlib,
+    Gzip,
+};
+
+// Inputs of at least this size are compressed in parallel by compress_all().
+constexpr size_t minimum_size_for_parallel_compression = 1 * MiB;
+
 class GenericZlibDecompressor : public Stream {
     AK_MAKE_NONCOPYABLE(GenericZlibDecompressor);
 
@@ -98,4 +107,9 @@ ErrorOr<ByteBuffer> compress_all(ReadonlyBytes bytes, CompressionLevel compressi
     return buffer;
 }
 
+// Compresses the input as independent blocks on the thread pool and stitches them into a single stream in the given
+// container. Each block is primed with the end of the previous one as its dictionary, so the result is only slightly
+// larger than what a single stream would produce.
+ErrorOr<ByteBuffer> compress_all_in_parallel(ReadonlyBytes, GenericZlibContainer, GenericZlibCompressionLevel);
+
 }
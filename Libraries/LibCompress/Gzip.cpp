@@ -33,6 +33,8 @@ ErrorOr<NonnullOwnPtr<GzipCompressor>> GzipCompressor::create(MaybeOwned<Stream>
 
 ErrorOr<ByteBuffer> GzipCompressor::compress_all(ReadonlyBytes bytes, GenericZlibCompressionLevel compression_level)
 {
+    if (bytes.size() >= minimum_size_for_parallel_compression)
+        return compress_all_in_parallel(bytes, GenericZlibContainer::Gzip, compression_level);
     return ::Compress::compress_all<GzipCompressor>(bytes, compression_level);
 }
 
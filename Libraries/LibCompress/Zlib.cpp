@@ -32,6 +32,8 @@ ErrorOr<NonnullOwnPtr<ZlibCompressor>> ZlibCompressor::create(MaybeOwned<Stream>
 
 ErrorOr<ByteBuffer> ZlibCompressor::compress_all(ReadonlyBytes bytes, GenericZlibCompressionLevel compression_level)
 {
+    if (bytes.size() >= minimum_size_for_parallel_compression)
+        return compress_all_in_parallel(bytes, GenericZlibContainer::Zlib, compression_level);
     return ::Compress::compress_all<ZlibCompressor>(bytes, compression_level);
 }
 
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Coroutine.h>
+#include <AK/Time.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/Notifier.h>
+#include <LibCore/Promise.h>
+#include <LibCore/ThreadedPromise.h>
+#include <LibCore/Timer.h>
+
+// Awaiters for using coroutines with the event loop. An awaiter lives in the frame of the coroutine awaiting it, so the
+// callbacks below only capture a pointer to it or the coroutine handle, and fit in a Function's inline storage.
+
+namespace Core {
+
+namespace Detail {
+
+class YieldAwaiter {
+public:
+    bool await_ready() const { return false; }
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        deferred_invoke([handle] { handle.resume(); });
+    }
+    void await_resume() const { }
+};
+
+class SleepAwaiter {
+public:
+    explicit SleepAwaiter(AK::Duration duration)
+        : m_duration(duration)
+    {
+    }
+
+    bool await_ready() const { return m_duration <= AK::Duration::zero(); }
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        m_timer = Timer::create_single_shot(static_cast<int>(m_duration.to_milliseconds()), [handle] { handle.resume(); });
+        m_timer->start();
+    }
+    void await_resume() const { }
+
+private:
+    AK::Duration m_duration;
+    RefPtr<Timer> m_timer;
+};
+
+class NotifierAwaiter {
+public:
+    NotifierAwaiter(int fd, Notifier::Type type)
+        : m_fd(fd)
+        , m_type(type)
+    {
+    }
+
+    bool await_ready() const { return false; }
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        m_notifier = Notifier::construct(m_fd, m_type);
+        m_notifier->on_activation = [this, handle] {
+            m_notifier->set_enabled(false);
+            handle.resume();
+        };
+    }
+    void await_resume() const { }
+
+private:
+    int m_fd { -1 };
+    Notifier::Type m_type { Notifier::Type::None };
+    RefPtr<Notifier> m_notifier;
+};
+
+template<typename Result, typename TError>
+class PromiseAwaiter {
+public:
+    explicit PromiseAwaiter(NonnullRefPtr<Promise<Result, TError>> promise)
+        : m_promise(move(promise))
+    {
+    }
+
+    bool await_ready() const { return false; }
+
+    // The promise's handlers are replaced, and may be invoked right away if it has already settled.
+    bool await_suspend(std::coroutine_handle<> handle)
+    {
+        m_promise->when_resolved([this](Result& result) { settle(move(result)); });
+        m_promise->when_rejected([this](TError& error) { settle(move(error)); });
+
+        if (m_result.has_value())
+            return false;
+
+        m_handle = handle;
+        return true;
+    }
+
+    ErrorOr<Result, TError> await_resume() { return m_result.release_value(); }
+
+private:
+    void settle(ErrorOr<Result, TError> result)
+    {
+        m_result = move(result);
+
+        if (auto handle = exchange(m_handle, {})) {
+            // Resuming the coroutine destroys this awaiter, which may hold the last reference to the promise that is
+            // still invoking our handler.
+            auto protect = m_promise;
+            handle.resume();
+        }
+    }
+
+    NonnullRefPtr<Promise<Result, TError>> m_promise;
+    Optional<ErrorOr<Result, TError>> m_result;
+    std::coroutine_handle<> m_handle;
+};
+
+template<typename TResult, typename TError>
+class ThreadedPromiseAwaiter {
+public:
+    using ResultType = typename ThreadedPromise<TResult, TError>::ResultType;
+
+    explicit ThreadedPromiseAwaiter(NonnullRefPtr<ThreadedPromise<TResult, TError>> promise)
+        : m_promise(move(promise))
+    {
+    }
+
+    bool await_ready() const { return false; }
+
+    // The promise may be settled from any thread. The coroutine is always resumed on the event loop it was suspended on.
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        m_handle = handle;
+        m_event_loop = EventLoop::current_weak();
+
+        m_promise->when_resolved([this](ResultType&& result) { settle(move(result)); })
+            .when_rejected([this](TError&& error) { settle(move(error)); });
+    }
+
+    ErrorOr<ResultType, TError> await_resume() { return m_result.release_value(); }
+
+private:
+    void settle(ErrorOr<ResultType, TError> result)
+    {
+        m_result = move(result);
+
+        if (auto event_loop = m_event_loop->take(); event_loop.is_alive())
+            event_loop->deferred_invoke([handle = m_handle] { handle.resume(); });
+    }
+
+    NonnullRefPtr<ThreadedPromise<TResult, TError>> m_promise;
+    RefPtr<WeakEventLoopReference> m_event_loop;
+    Optional<ErrorOr<ResultType, TError>> m_result;
+    std::coroutine_handle<> m_handle;
+};
+
+}
+
+// Suspends the current coroutine until the event loop has processed the events that are already pending.
+inline Detail::YieldAwaiter yield_to_event_loop() { return {}; }
+
+// Suspends the current coroutine for at least the given duration.
+inline Detail::SleepAwaiter sleep_for(AK::Duration duration) { return Detail::SleepAwaiter { duration }; }
+
+// Suspends the current coroutine until the file descriptor is ready for the given type of operation.
+inline Detail::NotifierAwaiter wait_for_notification(int fd, Notifier::Type type) { return { fd, type }; }
+
+template<typename Result, typename TError>
+Detail::PromiseAwaiter<Result, TError> operator co_await(NonnullRefPtr<Promise<Result, TError>> promise)
+{
+    return Detail::PromiseAwaiter<Result, TError> { move(promise) };
+}
+
+template<typename TResult, typename TError>
+Detail::ThreadedPromiseAwaiter<TResult, TError> operator co_await(NonnullRefPtr<ThreadedPromise<TResult, TError>> promise)
+{
+    return Detail::ThreadedPromiseAwaiter<TResult, TError> { move(promise) };
+}
+
+// Runs the event loop until the coroutine has completed, and returns its result. This is the bridge from synchronous
+// code, such as a main function or a test.
+template<typename T>
+T await_coroutine(Coroutine<T>&& coroutine)
+{
+    while (!coroutine.is_ready())
+        EventLoop::current().pump();
+    return coroutine.take_result();
+}
+
+}
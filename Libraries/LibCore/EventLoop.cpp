@@ -105,9 +105,9 @@ void EventLoop::unregister_signal(int handler_id)
     EventLoopManager::the().unregister_signal(handler_id);
 }
 
-intptr_t EventLoop::register_timer(EventReceiver& object, int milliseconds, bool should_reload)
+intptr_t EventLoop::register_timer(EventReceiver& object, int milliseconds, int tolerance_milliseconds, bool should_reload)
 {
-    return EventLoopManager::the().register_timer(object, milliseconds, should_reload);
+    return EventLoopManager::the().register_timer(object, milliseconds, tolerance_milliseconds, should_reload);
 }
 
 void EventLoop::unregister_timer(intptr_t timer_id)
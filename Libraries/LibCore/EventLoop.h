@@ -76,7 +76,7 @@ public:
     bool was_exit_requested();
 
     // The registration functions act upon the current loop of the current thread.
-    static intptr_t register_timer(EventReceiver&, int milliseconds, bool should_reload);
+    static intptr_t register_timer(EventReceiver&, int milliseconds, int tolerance_milliseconds, bool should_reload);
     static void unregister_timer(intptr_t timer_id);
 
     static void register_notifier(Badge<Notifier>, Notifier&);
@@ -24,8 +24,7 @@ EventLoopImplementation::~EventLoopImplementation() = default;
 
 void EventLoopImplementation::deferred_invoke(Function<void()>&& invokee)
 {
-    m_thread_event_queue.deferred_invoke(move(invokee));
-    if (&m_thread_event_queue != ThreadEventQueue::current_or_null())
+    if (m_thread_event_queue.deferred_invoke(move(invokee)) == ThreadEventQueue::ShouldWake::Yes)
         wake();
 }
 
@@ -24,7 +24,9 @@ public:
 
     virtual NonnullOwnPtr<EventLoopImplementation> make_implementation() = 0;
 
-    virtual intptr_t register_timer(EventReceiver&, int milliseconds, bool should_reload) = 0;
+    // A timer with a tolerance may fire up to that much later, so that the event loop can handle timers firing at around
+    // the same time in a single wakeup.
+    virtual intptr_t register_timer(EventReceiver&, int milliseconds, int tolerance_milliseconds, bool should_reload) = 0;
     virtual void unregister_timer(intptr_t timer_id) = 0;
 
     virtual void register_notifier(Notifier&) = 0;
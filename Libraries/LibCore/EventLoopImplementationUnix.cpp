@@ -25,6 +25,10 @@
 #include <sys/select.h>
 #include <unistd.h>
 
+#if defined(AK_OS_LINUX)
+#    include <sys/epoll.h>
+#endif
+
 namespace Core {
 
 namespace {
@@ -76,6 +80,42 @@ bool has_flag(int value, int flag)
     return (value & flag) == flag;
 }
 
+static void post_notifier_activation(Notifier& notifier, NotificationType type)
+{
+#ifdef AK_OS_ANDROID
+    // FIXME: Make the check work under Android, perhaps use ALooper.
+    (void)type;
+    ThreadEventQueue::current().post_event(notifier, Core::Event::Type::NotifierActivation);
+#else
+    type &= notifier.type();
+
+    if (type != NotificationType::None)
+        ThreadEventQueue::current().post_event(&notifier, Core::Event::Type::NotifierActivation);
+#endif
+}
+
+#if defined(AK_OS_LINUX)
+// Setting LIBCORE_EVENT_LOOP_BACKEND=poll makes event loops use poll() instead of epoll, for comparison.
+static bool should_use_epoll()
+{
+    static bool const use_epoll = [] {
+        auto const* backend = getenv("LIBCORE_EVENT_LOOP_BACKEND");
+        return !backend || StringView { backend, strlen(backend) } != "poll"sv;
+    }();
+    return use_epoll;
+}
+
+static u32 notification_type_to_epoll_events(NotificationType type)
+{
+    u32 events = 0;
+    if (has_flag(type, NotificationType::Read))
+        events |= EPOLLIN;
+    if (has_flag(type, NotificationType::Write))
+        events |= EPOLLOUT;
+    return events;
+}
+#endif
+
 class EventLoopTimer final : public EventLoopTimeout {
 public:
     EventLoopTimer() = default;
@@ -157,12 +197,28 @@ struct ThreadData {
         // The wake pipe informs us of POSIX signals as well as manual calls to wake()
         poll_fds.append({ .fd = wake_pipe_fds[0], .events = POLLIN, .revents = 0 });
         notifiers.append(nullptr);
+
+#if defined(AK_OS_LINUX)
+        if (should_use_epoll()) {
+            epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+            if (epoll_fd < 0) {
+                dbgln("Failed to create epoll instance, falling back to poll(): {}", Error::from_errno(errno));
+            } else {
+                epoll_event event { .events = EPOLLIN, .data = { .fd = wake_pipe_fds[0] } };
+                VERIFY(epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wake_pipe_fds[0], &event) == 0);
+            }
+        }
+#endif
     }
 
     ~ThreadData()
     {
         close(wake_pipe_fds[0]);
         close(wake_pipe_fds[1]);
+#if defined(AK_OS_LINUX)
+        if (epoll_fd >= 0)
+            close(epoll_fd);
+#endif
 
         Sync::RWLockLocker<Sync::LockMode::Write> locker(thread_data_lock());
         thread_data().remove(thread_id);
@@ -177,6 +233,38 @@ struct ThreadData {
     Vector<Notifier*, 32> notifiers;
     Vector<pollfd, 32> poll_fds;
 
+#if defined(AK_OS_LINUX)
+    // With epoll, notifiers stay registered with the kernel, so waiting does not scale with the number of notifiers.
+    // epoll only allows registering an fd once, so we register the union of the interests of all notifiers on an fd.
+    int epoll_fd { -1 };
+    HashMap<int, Vector<Notifier*, 1>> epoll_notifiers_by_fd;
+
+    bool uses_epoll() const { return epoll_fd >= 0; }
+
+    void update_epoll_registration(int fd)
+    {
+        auto notifiers = epoll_notifiers_by_fd.get(fd);
+        if (!notifiers.has_value()) {
+            // The fd may already have been closed, in which case the kernel has dropped it for us.
+            (void)epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+            return;
+        }
+
+        u32 events = 0;
+        for (auto* notifier : *notifiers)
+            events |= notification_type_to_epoll_events(notifier->type());
+
+        epoll_event event { .events = events, .data = { .fd = fd } };
+        if (epoll_ctl(epoll_fd, EPOLL_CTL_MOD, fd, &event) == 0)
+            return;
+        if (errno == ENOENT && epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) == 0)
+            return;
+
+        dbgln("EventLoopImplementationUnix: Failed to update epoll registration for fd {}: {}", fd, Error::from_errno(errno));
+        VERIFY_NOT_REACHED();
+    }
+#endif
+
     // The wake pipe is used to notify another event loop that someone has called wake(), or a signal has been received.
     // wake() writes 0i32 into the pipe, signals write the signal number (guaranteed non-zero).
     Array<int, 2> wake_pipe_fds { -1, -1 };
@@ -263,21 +351,49 @@ retry:
         }
     }
 
-try_select_again:
-    // select() and wait for file system events, calls to wake(), POSIX signals, or timer expirations.
-    auto error_or_marked_fd_count = System::poll(thread_data.poll_fds, should_wait_forever ? -1 : timeout);
-    auto time_after_poll = MonotonicTime::now_coarse();
-    // Because POSIX, we might spuriously return from select() with EINTR; just select again.
-    if (error_or_marked_fd_count.is_error()) {
-        if (error_or_marked_fd_count.error().code() == EINTR)
-            goto try_select_again;
-        dbgln("EventLoopImplementationUnix::wait_for_events: {}", error_or_marked_fd_count.error());
-        VERIFY_NOT_REACHED();
+    bool wake_pipe_is_readable = false;
+    size_t marked_fd_count = 0;
+
+#if defined(AK_OS_LINUX)
+    epoll_event epoll_events[64];
+    if (thread_data.uses_epoll()) {
+    try_epoll_wait_again:
+        // Wait for file system events, calls to wake(), POSIX signals, or timer expirations.
+        auto event_count = epoll_wait(thread_data.epoll_fd, epoll_events, array_size(epoll_events), should_wait_forever ? -1 : timeout);
+        if (event_count < 0) {
+            if (errno == EINTR)
+                goto try_epoll_wait_again;
+            dbgln("EventLoopImplementationUnix::wait_for_events: {}", Error::from_errno(errno));
+            VERIFY_NOT_REACHED();
+        }
+
+        marked_fd_count = static_cast<size_t>(event_count);
+        for (size_t i = 0; i < marked_fd_count; ++i) {
+            if (epoll_events[i].data.fd == thread_data.wake_pipe_fds[0])
+                wake_pipe_is_readable = has_flag(epoll_events[i].events, EPOLLIN);
+        }
+    } else
+#endif
+    {
+    try_select_again:
+        // select() and wait for file system events, calls to wake(), POSIX signals, or timer expirations.
+        auto error_or_marked_fd_count = System::poll(thread_data.poll_fds, should_wait_forever ? -1 : timeout);
+        // Because POSIX, we might spuriously return from select() with EINTR; just select again.
+        if (error_or_marked_fd_count.is_error()) {
+            if (error_or_marked_fd_count.error().code() == EINTR)
+                goto try_select_again;
+            dbgln("EventLoopImplementationUnix::wait_for_events: {}", error_or_marked_fd_count.error());
+            VERIFY_NOT_REACHED();
+        }
+
+        marked_fd_count = static_cast<size_t>(error_or_marked_fd_count.value());
+        wake_pipe_is_readable = has_flag(thread_data.poll_fds[0].revents, POLLIN);
     }
+    auto time_after_poll = MonotonicTime::now_coarse();
 
     // We woke up due to a call to wake() or a POSIX signal.
     // Handle signals and see whether we need to handle events as well.
-    if (has_flag(thread_data.poll_fds[0].revents, POLLIN)) {
+    if (wake_pipe_is_readable) {
         int wake_events[8];
         ssize_t nread;
         // We might receive another signal while read()ing here. The signal will go to the handle_signal properly,
@@ -306,15 +422,37 @@ try_select_again:
             goto retry;
     }
 
-    if (error_or_marked_fd_count.value() != 0) {
+#if defined(AK_OS_LINUX)
+    if (thread_data.uses_epoll()) {
         // Handle file system notifiers by making them normal events.
-        for (size_t i = 1; i < thread_data.poll_fds.size(); ++i) {
-            auto& notifier = *thread_data.notifiers[i];
+        for (size_t i = 0; i < marked_fd_count; ++i) {
+            auto& event = epoll_events[i];
+            auto notifiers = thread_data.epoll_notifiers_by_fd.get(event.data.fd);
+            if (!notifiers.has_value())
+                continue;
 
-#ifdef AK_OS_ANDROID
-            // FIXME: Make the check work under Android, perhaps use ALooper.
-            ThreadEventQueue::current().post_event(notifier, Core::Event::Type::NotifierActivation);
-#else
+            NotificationType type = NotificationType::None;
+            if (has_flag(event.events, EPOLLIN))
+                type |= NotificationType::Read;
+            if (has_flag(event.events, EPOLLOUT))
+                type |= NotificationType::Write;
+            if (has_flag(event.events, EPOLLHUP))
+                type |= NotificationType::Read | NotificationType::Write | NotificationType::HangUp;
+            if (has_flag(event.events, EPOLLERR))
+                type |= NotificationType::Error;
+
+            for (auto* notifier : *notifiers)
+                post_notifier_activation(*notifier, type);
+        }
+
+        thread_data.timeouts.fire_expired(time_after_poll);
+        return;
+    }
+#endif
+
+    if (marked_fd_count != 0) {
+        // Handle file system notifiers by making them normal events.
+        for (size_t i = 1; i < thread_data.poll_fds.size(); ++i) {
             auto revents = thread_data.poll_fds[i].revents;
 
             NotificationType type = NotificationType::None;
@@ -327,11 +465,7 @@ try_select_again:
             if (has_flag(revents, POLLERR))
                 type |= NotificationType::Error;
 
-            type &= notifier.type();
-
-            if (type != NotificationType::None)
-                ThreadEventQueue::current().post_event(&notifier, Core::Event::Type::NotifierActivation);
-#endif
+            post_notifier_activation(*thread_data.notifiers[i], type);
         }
     }
 
@@ -526,15 +660,17 @@ void EventLoopManagerUnix::unregister_signal(int handler_id)
         info.signal_handlers.remove(remove_signal_number);
 }
 
-intptr_t EventLoopManagerUnix::register_timer(EventReceiver& object, int milliseconds, bool should_reload)
+intptr_t EventLoopManagerUnix::register_timer(EventReceiver& object, int milliseconds, int tolerance_milliseconds, bool should_reload)
 {
     VERIFY(milliseconds >= 0);
+    VERIFY(tolerance_milliseconds >= 0);
     auto& thread_data = ThreadData::the();
     Sync::MutexLocker locker(thread_data.mutex);
     auto timer = new EventLoopTimer;
     timer->owner_thread = thread_data.thread_id;
     timer->owner = object;
     timer->interval = AK::Duration::from_milliseconds(milliseconds);
+    timer->set_tolerance(AK::Duration::from_milliseconds(tolerance_milliseconds));
     timer->reload(MonotonicTime::now_coarse());
     timer->should_reload = should_reload;
     thread_data.timeouts.schedule_absolute(timer);
@@ -563,13 +699,21 @@ void EventLoopManagerUnix::register_notifier(Notifier& notifier)
     auto& thread_data = ThreadData::the();
     Sync::MutexLocker locker(thread_data.mutex);
 
+    notifier.set_owner_thread(thread_data.thread_id);
+
+#if defined(AK_OS_LINUX)
+    if (thread_data.uses_epoll()) {
+        thread_data.epoll_notifiers_by_fd.ensure(notifier.fd()).append(&notifier);
+        thread_data.update_epoll_registration(notifier.fd());
+        return;
+    }
+#endif
+
     thread_data.notifier_to_index.set(&notifier, thread_data.poll_fds.size());
     thread_data.notifiers.append(&notifier);
 
     auto events = notification_type_to_poll_events(notifier.type());
     thread_data.poll_fds.append({ .fd = notifier.fd(), .events = events, .revents = 0 });
-
-    notifier.set_owner_thread(thread_data.thread_id);
 }
 
 void EventLoopManagerUnix::unregister_notifier(Notifier& notifier)
@@ -580,6 +724,18 @@ void EventLoopManagerUnix::unregister_notifier(Notifier& notifier)
         return;
     Sync::MutexLocker thread_data_content_locker(thread_data->mutex);
 
+#if defined(AK_OS_LINUX)
+    if (thread_data->uses_epoll()) {
+        auto notifiers = thread_data->epoll_notifiers_by_fd.find(notifier.fd());
+        VERIFY(notifiers != thread_data->epoll_notifiers_by_fd.end());
+        notifiers->value.remove_first_matching([&](auto* registered_notifier) { return registered_notifier == &notifier; });
+        if (notifiers->value.is_empty())
+            thread_data->epoll_notifiers_by_fd.remove(notifiers);
+        thread_data->update_epoll_registration(notifier.fd());
+        return;
+    }
+#endif
+
     auto notifier_index = thread_data->notifier_to_index.take(&notifier).release_value();
 
     if (notifier_index + 1 < thread_data->poll_fds.size()) {
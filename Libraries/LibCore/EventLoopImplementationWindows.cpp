@@ -436,15 +436,17 @@ void EventLoopManagerWindows::unregister_notifier(Notifier& notifier)
     // TODO: Reuse the data structure
 }
 
-intptr_t EventLoopManagerWindows::register_timer(EventReceiver& object, int milliseconds, bool should_reload)
+intptr_t EventLoopManagerWindows::register_timer(EventReceiver& object, int milliseconds, int tolerance_milliseconds, bool should_reload)
 {
     VERIFY(milliseconds >= 0);
+    VERIFY(tolerance_milliseconds >= 0);
     auto* thread_data = ThreadData::the();
     VERIFY(thread_data);
 
     auto timer = make<EventLoopTimer>();
     timer->owner = object.make_weak_ptr();
     timer->interval = AK::Duration::from_milliseconds(milliseconds);
+    timer->set_tolerance(AK::Duration::from_milliseconds(tolerance_milliseconds));
     timer->should_reload = should_reload;
     timer->reload(MonotonicTime::now());
     thread_data->timeouts.schedule_absolute(timer.ptr());
@@ -38,14 +38,14 @@ void EventReceiver::timer_event(Core::TimerEvent&)
 {
 }
 
-void EventReceiver::start_timer(int ms)
+void EventReceiver::start_timer(int ms, int tolerance_ms)
 {
     if (m_timer_id) {
         dbgln("{} {:p} already has a timer!", class_name(), this);
         VERIFY_NOT_REACHED();
     }
 
-    m_timer_id = Core::EventLoop::register_timer(*this, ms, true);
+    m_timer_id = Core::EventLoop::register_timer(*this, ms, tolerance_ms, true);
 }
 
 void EventReceiver::stop_timer()
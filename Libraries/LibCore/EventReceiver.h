@@ -52,7 +52,7 @@ public:
     template<typename T>
     bool fast_is() const = delete;
 
-    void start_timer(int ms);
+    void start_timer(int ms, int tolerance_ms = 0);
     void stop_timer();
     bool has_timer() const { return m_timer_id; }
 
@@ -25,6 +25,10 @@ struct ProcessStatistics {
 
     u64 total_time_scheduled { 0 };
     Vector<NonnullOwnPtr<ProcessInfo>> processes;
+
+    // Zero where the platform doesn't report them.
+    u64 total_physical_memory_bytes { 0 };
+    u64 available_physical_memory_bytes { 0 };
 };
 
 CORE_API ErrorOr<void> update_process_statistics(ProcessStatistics&);
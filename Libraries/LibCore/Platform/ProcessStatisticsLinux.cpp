@@ -39,6 +39,21 @@ ErrorOr<void> update_process_statistics(ProcessStatistics& statistics)
     if (res != 5)
         return Error::from_string_literal("Failed to parse /proc/stat");
 
+    // MemAvailable estimates how much memory can be allocated without swapping, counting caches the kernel would drop.
+    static NeverDestroyed<NonnullOwnPtr<Core::File>> proc_meminfo { TRY(Core::File::open("/proc/meminfo"sv, Core::File::OpenMode::Read)) };
+    TRY((*proc_meminfo)->seek(0, SeekMode::SetPosition));
+
+    char meminfo_buf[1024] = {};
+    auto meminfo = TRY((*proc_meminfo)->read_some(Bytes { meminfo_buf, sizeof(meminfo_buf) - 1 }));
+
+    unsigned long total_memory_kib = 0;
+    unsigned long available_memory_kib = 0;
+    res = sscanf(reinterpret_cast<char const*>(meminfo.data()), "MemTotal: %lu kB MemFree: %*u kB MemAvailable: %lu kB", &total_memory_kib, &available_memory_kib);
+    if (res == 2) {
+        statistics.total_physical_memory_bytes = static_cast<u64>(total_memory_kib) * KiB;
+        statistics.available_physical_memory_bytes = static_cast<u64>(available_memory_kib) * KiB;
+    }
+
     u64 const total_time_scheduled = user_time + system_time + idle_time + irq_time + softirq_time;
     float const total_time_scheduled_diff = total_time_scheduled - statistics.total_time_scheduled;
     statistics.total_time_scheduled = total_time_scheduled;
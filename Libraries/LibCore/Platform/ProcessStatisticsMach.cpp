@@ -12,6 +12,7 @@
 
 #include <AK/Time.h>
 #include <LibCore/Platform/ProcessStatisticsMach.h>
+#include <sys/sysctl.h>
 
 namespace Core::Platform {
 
@@ -33,6 +34,18 @@ ErrorOr<void> update_process_statistics(ProcessStatistics& statistics)
     total_cpu_ticks += cpu_info.cpu_ticks[CPU_STATE_NICE];
     total_cpu_ticks += cpu_info.cpu_ticks[CPU_STATE_IDLE];
 
+    u64 total_memory_bytes = 0;
+    size_t total_memory_bytes_size = sizeof(total_memory_bytes);
+    if (sysctlbyname("hw.memsize", &total_memory_bytes, &total_memory_bytes_size, nullptr, 0) == 0)
+        statistics.total_physical_memory_bytes = total_memory_bytes;
+
+    // Inactive and purgeable pages can be reclaimed without paging anything out.
+    vm_statistics64_data_t vm_info {};
+    count = HOST_VM_INFO64_COUNT;
+    res = host_statistics64(mach_host_self(), HOST_VM_INFO64, reinterpret_cast<host_info64_t>(&vm_info), &count);
+    if (res == KERN_SUCCESS)
+        statistics.available_physical_memory_bytes = (static_cast<u64>(vm_info.free_count) + vm_info.inactive_count + vm_info.purgeable_count) * vm_kernel_page_size;
+
     auto const total_cpu_ticks_diff = total_cpu_ticks - statistics.total_time_scheduled;
     auto const total_cpu_seconds_diff = total_cpu_ticks_diff / (static_cast<float>(user_hz));
     auto const total_cpu_micro_diff = total_cpu_seconds_diff * 1'000'000;
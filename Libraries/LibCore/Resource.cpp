@@ -35,6 +35,14 @@ Resource::Resource(String path, Scheme scheme, DirectoryTag, time_t modified_tim
 {
 }
 
+Resource::Resource(String path, Scheme scheme, ArchivedData data, time_t modified_time)
+    : m_path(move(path))
+    , m_scheme(scheme)
+    , m_data(move(data))
+    , m_modified_time(modified_time)
+{
+}
+
 ErrorOr<NonnullRefPtr<Resource>> Resource::load_from_filesystem(StringView path)
 {
     auto filepath = LexicalPath(path);
@@ -89,6 +97,7 @@ ByteBuffer Resource::clone_data() const
     return m_data.visit(
         [](NonnullOwnPtr<Core::MappedFile> const& file) { return MUST(ByteBuffer::copy(file->bytes())); },
         [](ByteBuffer const& buffer) { return buffer; },
+        [](ArchivedData const& data) { return MUST(ByteBuffer::copy(data.bytes)); },
         [](DirectoryTag) -> ByteBuffer { VERIFY_NOT_REACHED(); });
 }
 
@@ -98,6 +107,8 @@ ByteBuffer Resource::release_data() &&
 
     if (m_data.has<NonnullOwnPtr<Core::MappedFile>>())
         return MUST(ByteBuffer::copy(m_data.get<NonnullOwnPtr<Core::MappedFile>>()->bytes()));
+    if (m_data.has<ArchivedData>())
+        return MUST(ByteBuffer::copy(m_data.get<ArchivedData>().bytes));
     return move(m_data).get<ByteBuffer>();
 }
 
@@ -106,6 +117,7 @@ ReadonlyBytes Resource::data() const
     return m_data.visit(
         [](NonnullOwnPtr<Core::MappedFile> const& file) { return file->bytes(); },
         [](ByteBuffer const& buffer) { return buffer.bytes(); },
+        [](ArchivedData const& data) { return data.bytes; },
         [](DirectoryTag) -> ReadonlyBytes { VERIFY_NOT_REACHED(); });
 }
 
@@ -48,6 +48,12 @@ public:
 
     struct DirectoryTag { };
 
+    // The contents of a file inside a memory-mapped archive, which is kept alive for as long as the resource is.
+    struct ArchivedData {
+        NonnullRefPtr<SharedMappedFile> archive;
+        ReadonlyBytes bytes;
+    };
+
 private:
     friend class ResourceImplementation;
 
@@ -59,11 +65,12 @@ private:
     Resource(String path, Scheme, NonnullOwnPtr<Core::MappedFile>, time_t modified_time);
     Resource(String path, Scheme, ByteBuffer, time_t modified_time);
     Resource(String path, Scheme, DirectoryTag, time_t modified_time);
+    Resource(String path, Scheme, ArchivedData, time_t modified_time);
 
     String m_path; // Relative to scheme root. File: abspath, Resource: resource root
     Scheme m_scheme;
 
-    Variant<DirectoryTag, NonnullOwnPtr<Core::MappedFile>, ByteBuffer> m_data;
+    Variant<DirectoryTag, NonnullOwnPtr<Core::MappedFile>, ByteBuffer, ArchivedData> m_data;
     time_t m_modified_time {};
 };
 
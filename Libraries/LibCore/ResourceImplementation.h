@@ -31,6 +31,7 @@ protected:
 
     static NonnullRefPtr<Resource> make_resource(String full_path, NonnullOwnPtr<Core::MappedFile>, time_t modified_time);
     static NonnullRefPtr<Resource> make_resource(String full_path, ByteBuffer, time_t modified_time);
+    static NonnullRefPtr<Resource> make_resource(String full_path, NonnullRefPtr<SharedMappedFile> archive, ReadonlyBytes, time_t modified_time);
     static NonnullRefPtr<Resource> make_directory_resource(String full_path, time_t modified_time);
 };
 
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Endian.h>
+#include <AK/MemoryStream.h>
+#include <LibCore/File.h>
+#include <LibCore/Resource.h>
+#include <LibCore/ResourceImplementationArchive.h>
+
+namespace Core {
+
+static constexpr auto archive_magic = "LRA1"sv;
+static constexpr auto resource_scheme = "resource://"sv;
+
+ErrorOr<NonnullOwnPtr<ResourceImplementationArchive>> ResourceImplementationArchive::create(String base_directory, StringView archive_path)
+{
+    auto st = TRY(File::stat(archive_path));
+    auto file = TRY(MappedFile::map(archive_path));
+
+    // The mapping stays where it is when the file is moved into the shared wrapper.
+    auto bytes = file->bytes();
+    auto archive = adopt_ref(*new SharedMappedFile(move(file)));
+
+    auto implementation = adopt_own(*new ResourceImplementationArchive(move(base_directory), move(archive), st.st_mtime));
+    TRY(implementation->parse(bytes));
+    return implementation;
+}
+
+ResourceImplementationArchive::ResourceImplementationArchive(String base_directory, NonnullRefPtr<SharedMappedFile> archive, time_t modified_time)
+    : ResourceImplementationFile(move(base_directory))
+    , m_archive(move(archive))
+    , m_modified_time(modified_time)
+{
+}
+
+ErrorOr<void> ResourceImplementationArchive::parse(ReadonlyBytes archive)
+{
+    if (archive.size() < archive_magic.length() || StringView { archive.trim(archive_magic.length()) } != archive_magic)
+        return Error::from_string_literal("Invalid resource archive magic");
+
+    FixedMemoryStream stream { archive.slice(archive_magic.length()) };
+    auto entry_count = TRY(stream.read_value<LittleEndian<u32>>());
+    TRY(m_files.try_ensure_capacity(entry_count));
+
+    for (u32 i = 0; i < entry_count; ++i) {
+        u32 path_offset = TRY(stream.read_value<LittleEndian<u32>>());
+        u32 path_length = TRY(stream.read_value<LittleEndian<u32>>());
+        u32 data_offset = TRY(stream.read_value<LittleEndian<u32>>());
+        u32 data_size = TRY(stream.read_value<LittleEndian<u32>>());
+
+        if (static_cast<u64>(path_offset) + path_length > archive.size() || static_cast<u64>(data_offset) + data_size > archive.size())
+            return Error::from_string_literal("Resource archive entry is out of bounds");
+
+        StringView path { archive.slice(path_offset, path_length) };
+        m_files.set(path, archive.slice(data_offset, data_size));
+
+        // Entries are sorted by path, so all files below a directory are adjacent, and a child that is already listed
+        // is always the last one that was added.
+        for (auto child_path = path;;) {
+            auto separator = child_path.find_last('/');
+            auto directory = separator.has_value() ? child_path.substring_view(0, *separator) : ""sv;
+            auto name = separator.has_value() ? child_path.substring_view(*separator + 1) : child_path;
+
+            auto& children = m_directories.ensure(directory);
+            if (!children.is_empty() && children.last() == name)
+                break;
+            TRY(children.try_append(TRY(String::from_utf8(name))));
+
+            if (!separator.has_value())
+                break;
+            child_path = directory;
+        }
+    }
+
+    return {};
+}
+
+static StringView path_for_resource_scheme_uri(StringView uri)
+{
+    VERIFY(uri.starts_with(resource_scheme));
+    return uri.substring_view(resource_scheme.length()).trim("/"sv);
+}
+
+ErrorOr<NonnullRefPtr<Resource>> ResourceImplementationArchive::load_from_resource_scheme_uri(StringView uri)
+{
+    auto path = path_for_resource_scheme_uri(uri);
+
+    if (auto data = m_files.get(path); data.has_value())
+        return make_resource(TRY(String::from_utf8(path)), m_archive, *data, m_modified_time);
+    if (m_directories.contains(path))
+        return make_directory_resource(TRY(String::from_utf8(path)), m_modified_time);
+
+    return ResourceImplementationFile::load_from_resource_scheme_uri(uri);
+}
+
+Vector<String> ResourceImplementationArchive::child_names_for_resource_scheme(Resource const& resource)
+{
+    auto uri = resource.uri();
+
+    if (auto children = m_directories.get(path_for_resource_scheme_uri(uri)); children.has_value())
+        return *children;
+
+    return ResourceImplementationFile::child_names_for_resource_scheme(resource);
+}
+
+}
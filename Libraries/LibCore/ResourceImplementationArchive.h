@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/StringView.h>
+#include <LibCore/Export.h>
+#include <LibCore/MappedFile.h>
+#include <LibCore/ResourceImplementationFile.h>
+
+namespace Core {
+
+// Serves resources out of a single archive generated at build time by Meta/Generators/generate_resource_archive.py.
+// The archive is mapped once, read-only, so every process that loads it shares the same pages, and a lookup is a single
+// hash table probe instead of a stat(), open() and mmap() per resource. Resources that are not in the archive are still
+// loaded from the base directory.
+class CORE_API ResourceImplementationArchive : public ResourceImplementationFile {
+public:
+    static ErrorOr<NonnullOwnPtr<ResourceImplementationArchive>> create(String base_directory, StringView archive_path);
+
+    virtual ErrorOr<NonnullRefPtr<Resource>> load_from_resource_scheme_uri(StringView) override;
+    virtual Vector<String> child_names_for_resource_scheme(Resource const&) override;
+
+private:
+    ResourceImplementationArchive(String base_directory, NonnullRefPtr<SharedMappedFile> archive, time_t modified_time);
+
+    ErrorOr<void> parse(ReadonlyBytes);
+
+    NonnullRefPtr<SharedMappedFile> m_archive;
+    time_t m_modified_time { 0 };
+
+    // The keys point into the archive.
+    HashMap<StringView, ReadonlyBytes> m_files;
+    HashMap<StringView, Vector<String>> m_directories;
+};
+
+}
@@ -454,6 +454,39 @@ ErrorOr<size_t> LocalSocket::send_message(ReadonlyBytes data, int flags, Vector<
     return Core::System::sendmsg(m_helper.fd(), &msg, default_flags() | flags);
 }
 
+ErrorOr<size_t> LocalSocket::send_message(ReadonlySpan<ReadonlyBytes> buffers, int flags, Vector<int, 1> fds)
+{
+    size_t const num_fds = fds.size();
+    if (num_fds > MAX_TRANSFER_FDS)
+        return Error::from_string_literal("Too many file descriptors to send");
+
+    Vector<struct iovec, 32> iovs;
+    TRY(iovs.try_ensure_capacity(buffers.size()));
+    for (auto buffer : buffers)
+        iovs.unchecked_append({ .iov_base = const_cast<u8*>(buffer.data()), .iov_len = buffer.size() });
+
+    struct msghdr msg = {};
+    msg.msg_iov = iovs.data();
+    msg.msg_iovlen = iovs.size();
+
+    alignas(struct cmsghdr) char control_buf[CMSG_SPACE(sizeof(int) * MAX_TRANSFER_FDS)] {};
+    if (num_fds > 0) {
+        auto const fd_payload_size = num_fds * sizeof(int);
+
+        // Note: We don't use designated initializers here due to weirdness with glibc's flexible array members.
+        auto* header = new (control_buf) cmsghdr {};
+        header->cmsg_len = static_cast<socklen_t>(CMSG_LEN(fd_payload_size));
+        header->cmsg_level = SOL_SOCKET;
+        header->cmsg_type = SCM_RIGHTS;
+        memcpy(CMSG_DATA(header), fds.data(), fd_payload_size);
+
+        msg.msg_control = header;
+        msg.msg_controllen = CMSG_LEN(fd_payload_size);
+    }
+
+    return Core::System::sendmsg(m_helper.fd(), &msg, default_flags() | flags);
+}
+
 ErrorOr<Bytes> LocalSocket::receive_message(AK::Bytes buffer, int flags, Vector<int>& fds)
 {
     struct iovec iov {
@@ -332,6 +332,7 @@ public:
 
     ErrorOr<Bytes> receive_message(Bytes buffer, int flags, Vector<int>& fds);
     ErrorOr<size_t> send_message(ReadonlyBytes msg, int flags, Vector<int, 1> fds = {});
+    ErrorOr<size_t> send_message(ReadonlySpan<ReadonlyBytes> buffers, int flags, Vector<int, 1> fds = {});
 
     ErrorOr<pid_t> peer_pid() const;
     ErrorOr<Bytes> read_without_waiting(Bytes buffer);
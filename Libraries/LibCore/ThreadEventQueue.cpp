@@ -4,19 +4,106 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
+#include <AK/AtomicRefCounted.h>
 #include <AK/NeverDestroyed.h>
 #include <AK/Vector.h>
 #include <LibCore/EventLoopImplementation.h>
 #include <LibCore/EventReceiver.h>
 #include <LibCore/Promise.h>
 #include <LibCore/ThreadEventQueue.h>
-#include <LibSync/Mutex.h>
 #include <LibSync/Once.h>
 #include <errno.h>
 #include <pthread.h>
 
 namespace Core {
 
+class RemoteEventPool;
+
+// An event posted from a thread other than the queue's own. These are linked into an intrusive multi-producer,
+// single-consumer queue, so posting one takes no lock.
+struct RemoteEvent {
+    Atomic<RemoteEvent*> next { nullptr };
+    WeakPtr<EventReceiver> receiver;
+    Function<void()> invokee;
+    u8 event_type { Event::Type::Invalid };
+
+    // Set while the event is in use. Its pool is where it is returned to once it has been processed.
+    RefPtr<RemoteEventPool> pool;
+    RemoteEvent* next_free { nullptr };
+};
+
+// Each posting thread allocates events from its own pool, and the consuming threads return them there once they have
+// been processed. This keeps steady cross-thread posting, such as from media or IPC threads, off the allocator.
+class RemoteEventPool : public AtomicRefCounted<RemoteEventPool> {
+public:
+    static constexpr u32 MAX_CACHED_EVENTS = 256;
+
+    static RemoteEventPool& for_current_thread()
+    {
+        static thread_local NonnullRefPtr<RemoteEventPool> pool = adopt_ref(*new RemoteEventPool);
+        return *pool;
+    }
+
+    ~RemoteEventPool()
+    {
+        delete_events(m_free_events);
+        delete_events(m_returned_events.exchange(nullptr, AK::memory_order_acquire));
+    }
+
+    // Must only be called on the thread that owns the pool.
+    RemoteEvent* allocate()
+    {
+        if (!m_free_events)
+            m_free_events = m_returned_events.exchange(nullptr, AK::memory_order_acquire);
+
+        RemoteEvent* event = m_free_events;
+        if (event) {
+            m_free_events = event->next_free;
+            m_cached_event_count.fetch_sub(1, AK::memory_order_relaxed);
+        } else {
+            event = new RemoteEvent;
+        }
+
+        event->next.store(nullptr, AK::memory_order_relaxed);
+        event->pool = *this;
+        return event;
+    }
+
+    // May be called from any thread.
+    static void recycle(RemoteEvent* event)
+    {
+        event->receiver = nullptr;
+        event->invokee = nullptr;
+
+        auto pool = move(event->pool);
+        if (pool->m_cached_event_count.fetch_add(1, AK::memory_order_relaxed) >= MAX_CACHED_EVENTS) {
+            pool->m_cached_event_count.fetch_sub(1, AK::memory_order_relaxed);
+            delete event;
+            return;
+        }
+
+        auto* head = pool->m_returned_events.load(AK::memory_order_relaxed);
+        do {
+            event->next_free = head;
+        } while (!pool->m_returned_events.compare_exchange_strong(head, event, AK::memory_order_release));
+    }
+
+private:
+    RemoteEventPool() = default;
+
+    static void delete_events(RemoteEvent* event)
+    {
+        while (event) {
+            delete exchange(event, event->next_free);
+        }
+    }
+
+    RemoteEvent* m_free_events { nullptr };
+    Atomic<RemoteEvent*> m_returned_events { nullptr };
+    Atomic<u32> m_cached_event_count { 0 };
+};
+
 struct ThreadEventQueue::Private {
     struct QueuedEvent {
         AK_MAKE_NONCOPYABLE(QueuedEvent);
@@ -42,8 +129,71 @@ struct ThreadEventQueue::Private {
         u8 event_type { Event::Type::Invalid };
     };
 
-    Sync::Mutex mutex;
+    ~Private()
+    {
+        while (auto* event = pop_remote_event())
+            RemoteEventPool::recycle(event);
+    }
+
+    // Events posted from the queue's own thread. These are only accessed from that thread.
     Vector<QueuedEvent> queued_events;
+
+    // A Vyukov-style intrusive MPSC queue of events posted from other threads. Producers only exchange the head, and the
+    // owning thread consumes from the tail.
+    static constexpr size_t MAX_REMOTE_EVENTS_PER_PROCESS = 1024;
+    RemoteEvent remote_stub;
+    Atomic<RemoteEvent*> remote_head { &remote_stub };
+    RemoteEvent* remote_tail { &remote_stub };
+
+    // Set by the first producer to post after the owning thread has started processing, so that only the transition
+    // from an empty to a non-empty queue wakes the owning thread.
+    Atomic<bool> remote_wake_pending { false };
+
+    void push_remote_event(RemoteEvent* event)
+    {
+        event->next.store(nullptr, AK::memory_order_relaxed);
+        auto* previous = remote_head.exchange(event, AK::memory_order_acq_rel);
+        previous->next.store(event, AK::memory_order_release);
+    }
+
+    // Returns null if the queue is empty, or if a producer has exchanged the head but not linked its event yet. The
+    // latter remains visible through has_remote_events(), so the event loop will come back for it without waiting.
+    RemoteEvent* pop_remote_event()
+    {
+        auto* tail = remote_tail;
+        auto* next = tail->next.load(AK::memory_order_acquire);
+
+        if (tail == &remote_stub) {
+            if (!next)
+                return nullptr;
+            remote_tail = next;
+            tail = next;
+            next = next->next.load(AK::memory_order_acquire);
+        }
+
+        if (next) {
+            remote_tail = next;
+            return tail;
+        }
+
+        if (tail != remote_head.load(AK::memory_order_acquire))
+            return nullptr;
+
+        push_remote_event(&remote_stub);
+
+        next = tail->next.load(AK::memory_order_acquire);
+        if (next) {
+            remote_tail = next;
+            return tail;
+        }
+
+        return nullptr;
+    }
+
+    bool has_remote_events() const
+    {
+        return remote_tail != &remote_stub || remote_head.load(AK::memory_order_acquire) != &remote_stub;
+    }
 };
 
 static pthread_key_t s_current_thread_event_queue_key;
@@ -83,64 +233,101 @@ ThreadEventQueue::ThreadEventQueue()
 
 ThreadEventQueue::~ThreadEventQueue() = default;
 
-void ThreadEventQueue::post_event(Core::EventReceiver* receiver, Core::Event::Type event_type)
+bool ThreadEventQueue::is_current_thread_queue() const
 {
-    {
-        Sync::MutexLocker lock(m_private->mutex);
+    return current_or_null() == this;
+}
+
+ThreadEventQueue::ShouldWake ThreadEventQueue::post_remote_event(RefPtr<EventReceiver> const& receiver, Core::Event::Type event_type, Function<void()>&& invokee)
+{
+    auto* event = RemoteEventPool::for_current_thread().allocate();
+    event->receiver = WeakPtr<EventReceiver> { receiver };
+    event->invokee = move(invokee);
+    event->event_type = event_type;
+    m_private->push_remote_event(event);
+
+    if (m_private->remote_wake_pending.exchange(true))
+        return ShouldWake::No;
+    return ShouldWake::Yes;
+}
+
+ThreadEventQueue::ShouldWake ThreadEventQueue::post_event(Core::EventReceiver* receiver, Core::Event::Type event_type)
+{
+    auto should_wake = ShouldWake::No;
+
+    if (is_current_thread_queue())
         m_private->queued_events.empend(receiver, event_type);
-    }
+    else
+        should_wake = post_remote_event(receiver, event_type, {});
+
     Core::EventLoopManager::the().did_post_event();
+    return should_wake;
 }
 
-void ThreadEventQueue::deferred_invoke(Function<void()>&& invokee)
+ThreadEventQueue::ShouldWake ThreadEventQueue::deferred_invoke(Function<void()>&& invokee)
 {
-    {
-        Sync::MutexLocker lock(m_private->mutex);
+    auto should_wake = ShouldWake::No;
+
+    if (is_current_thread_queue())
         m_private->queued_events.empend(move(invokee));
-    }
+    else
+        should_wake = post_remote_event({}, Event::Type::DeferredInvoke, move(invokee));
+
     Core::EventLoopManager::the().did_post_event();
+    return should_wake;
 }
 
-size_t ThreadEventQueue::process()
+static void dispatch_event(WeakPtr<EventReceiver> const& weak_receiver, u8 event_type, Function<void()>& invokee)
 {
-    decltype(m_private->queued_events) events;
-    {
-        Sync::MutexLocker locker(m_private->mutex);
-        events = move(m_private->queued_events);
-    }
-
-    for (auto& queued_event : events) {
-        if (auto receiver = queued_event.receiver.strong_ref()) {
-            switch (queued_event.event_type) {
-            case Event::Type::Timer: {
-                TimerEvent timer_event;
-                receiver->dispatch_event(timer_event);
-                break;
-            }
-            case Event::Type::NotifierActivation: {
-                NotifierActivationEvent notifier_activation_event;
-                receiver->dispatch_event(notifier_activation_event);
-                break;
-            }
-            default:
-                VERIFY_NOT_REACHED();
-            }
+    if (auto receiver = weak_receiver.strong_ref()) {
+        switch (event_type) {
+        case Event::Type::Timer: {
+            TimerEvent timer_event;
+            receiver->dispatch_event(timer_event);
+            break;
+        }
+        case Event::Type::NotifierActivation: {
+            NotifierActivationEvent notifier_activation_event;
+            receiver->dispatch_event(notifier_activation_event);
+            break;
+        }
+        default:
+            VERIFY_NOT_REACHED();
+        }
+    } else {
+        if (event_type == Event::Type::DeferredInvoke) {
+            invokee();
         } else {
-            if (queued_event.event_type == Event::Type::DeferredInvoke) {
-                queued_event.m_invokee();
-            } else {
-                // Receiver gone, drop the event.
-            }
+            // Receiver gone, drop the event.
         }
     }
+}
+
+size_t ThreadEventQueue::process()
+{
+    // Any event posted from another thread from now on has to wake us up again.
+    m_private->remote_wake_pending.store(false);
+
+    auto events = move(m_private->queued_events);
+    for (auto& queued_event : events)
+        dispatch_event(queued_event.receiver, queued_event.event_type, queued_event.m_invokee);
+
+    size_t remote_event_count = 0;
+    for (; remote_event_count < Private::MAX_REMOTE_EVENTS_PER_PROCESS; ++remote_event_count) {
+        auto* event = m_private->pop_remote_event();
+        if (!event)
+            break;
+
+        dispatch_event(event->receiver, event->event_type, event->invokee);
+        RemoteEventPool::recycle(event);
+    }
 
-    return events.size();
+    return events.size() + remote_event_count;
 }
 
 bool ThreadEventQueue::has_pending_events() const
 {
-    Sync::MutexLocker locker(m_private->mutex);
-    return !m_private->queued_events.is_empty();
+    return !m_private->queued_events.is_empty() || m_private->has_remote_events();
 }
 
 }
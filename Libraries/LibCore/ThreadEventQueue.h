@@ -6,8 +6,10 @@
 
 #pragma once
 
+#include <AK/Function.h>
 #include <AK/NonnullRefPtr.h>
 #include <AK/OwnPtr.h>
+#include <AK/RefPtr.h>
 #include <LibCore/Event.h>
 #include <LibCore/Export.h>
 #include <LibCore/Forward.h>
@@ -28,11 +30,19 @@ public:
     // Process all queued events. Returns the number of events that were processed.
     size_t process();
 
+    // Events may be posted from any thread. When posting from another thread, ShouldWake::Yes is returned if the queue's
+    // thread has to be woken up to process the event. That is only the case for the first event posted since the queue
+    // was last processed.
+    enum class ShouldWake {
+        No,
+        Yes,
+    };
+
     // Posts an event to the event queue.
-    void post_event(EventReceiver*, Core::Event::Type);
+    ShouldWake post_event(EventReceiver*, Core::Event::Type);
 
     // Post a deferred invocation to the event queue.
-    void deferred_invoke(Function<void()>&&);
+    ShouldWake deferred_invoke(Function<void()>&&);
 
     // Returns true if there are events waiting to be flushed.
     bool has_pending_events() const;
@@ -41,6 +51,9 @@ private:
     ThreadEventQueue();
     ~ThreadEventQueue();
 
+    bool is_current_thread_queue() const;
+    ShouldWake post_remote_event(RefPtr<EventReceiver> const&, Core::Event::Type, Function<void()>&&);
+
     struct Private;
     OwnPtr<Private> m_private;
 };
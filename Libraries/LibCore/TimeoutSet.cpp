@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/BuiltinWrappers.h>
+#include <LibCore/TimeoutSet.h>
+
+namespace Core {
+
+static constexpr i64 NANOSECONDS_PER_TICK = 1'000'000;
+
+static i64 deadline_for(EventLoopTimeout const& timeout)
+{
+    auto fire_time = timeout.fire_time().nanoseconds();
+    auto tolerance = timeout.tolerance().to_nanoseconds();
+    if (tolerance <= 0)
+        return fire_time;
+
+    auto remainder = fire_time % tolerance;
+    if (remainder == 0)
+        return fire_time;
+    return fire_time - remainder + tolerance;
+}
+
+static MonotonicTime time_at(EventLoopTimeout const& reference, i64 nanoseconds)
+{
+    return reference.fire_time() + AK::Duration::from_nanoseconds(nanoseconds - reference.fire_time().nanoseconds());
+}
+
+static bool fires_before(EventLoopTimeout const& a, i64 a_deadline, EventLoopTimeout const& b, i64 b_deadline)
+{
+    if (a_deadline == b_deadline)
+        return a.sequence_id() < b.sequence_id();
+    return a_deadline < b_deadline;
+}
+
+// Returns how many slots after the given one the next occupied slot is, wrapping around to the given slot last.
+static u64 slots_until_next_occupied(u64 occupied_slots, u64 index)
+{
+    auto rotation = (index + 1) % 64;
+    auto rotated = rotation == 0 ? occupied_slots : (occupied_slots >> rotation) | (occupied_slots << (64 - rotation));
+    return count_trailing_zeroes(rotated) + 1;
+}
+
+u64 TimeoutSet::tick_for_deadline(i64 deadline_ns)
+{
+    if (deadline_ns <= 0)
+        return 0;
+    return static_cast<u64>(deadline_ns / NANOSECONDS_PER_TICK);
+}
+
+Optional<MonotonicTime> TimeoutSet::next_timer_expiration()
+{
+    if (m_timeout_count == 0)
+        return {};
+
+    Optional<MonotonicTime> next_expiration;
+
+    // The first occupied slot of the lowest level holds the timeouts that expire soonest within it, in order.
+    if (auto occupied_slots = m_occupied_slots[0]; occupied_slots != 0) {
+        auto index = m_current_tick & SLOT_MASK;
+        auto distance = (occupied_slots & (1ull << index)) ? 0 : slots_until_next_occupied(occupied_slots, index);
+        auto& timeout = *m_slots[(index + distance) & SLOT_MASK].first;
+        next_expiration = time_at(timeout, timeout.m_deadline_ns);
+    }
+
+    // Timeouts in the higher levels expire no earlier than the start of their slot. That's when they have to be
+    // redistributed, after which we know when exactly they expire.
+    for (size_t level = 1; level < LEVEL_COUNT; ++level) {
+        auto occupied_slots = m_occupied_slots[level];
+        if (occupied_slots == 0)
+            continue;
+
+        auto shift = level * SLOT_BITS;
+        auto position = m_current_tick >> shift;
+        auto distance = slots_until_next_occupied(occupied_slots, position & SLOT_MASK);
+        auto tick = (position + distance) << shift;
+
+        auto& reference = *m_slots[level * SLOTS_PER_LEVEL + ((position + distance) & SLOT_MASK)].first;
+        auto slot_start = time_at(reference, static_cast<i64>(tick) * NANOSECONDS_PER_TICK);
+        if (!next_expiration.has_value() || slot_start < *next_expiration)
+            next_expiration = slot_start;
+    }
+
+    return next_expiration;
+}
+
+void TimeoutSet::absolutize_relative_timeouts(MonotonicTime current_time)
+{
+    if (m_scheduled_timeouts.is_empty())
+        return;
+
+    if (m_timeout_count == 0)
+        m_current_tick = max(m_current_tick, tick_for_deadline(current_time.nanoseconds()));
+
+    for (auto timeout : m_scheduled_timeouts) {
+        timeout->absolutize({}, current_time);
+        timeout->m_deadline_ns = deadline_for(*timeout);
+        place(timeout);
+    }
+    m_scheduled_timeouts.clear();
+}
+
+size_t TimeoutSet::fire_expired(MonotonicTime current_time)
+{
+    auto target_tick = tick_for_deadline(current_time.nanoseconds());
+    size_t fired_count = fire_current_slot(current_time);
+
+    while (m_current_tick < target_tick) {
+        // Skip ahead to the next tick that has timeouts to either fire or redistribute.
+        auto next_tick = next_tick_to_process();
+        if (!next_tick.has_value() || *next_tick > target_tick) {
+            m_current_tick = target_tick;
+            break;
+        }
+
+        m_current_tick = *next_tick;
+        for (size_t level = LEVEL_COUNT - 1; level > 0; --level) {
+            if ((m_current_tick & ((1ull << (level * SLOT_BITS)) - 1)) == 0)
+                cascade(level);
+        }
+
+        fired_count += fire_current_slot(current_time);
+    }
+
+    return fired_count;
+}
+
+void TimeoutSet::schedule_relative(EventLoopTimeout* timeout)
+{
+    timeout->set_sequence_id(m_next_sequence_id++);
+    timeout->m_index = -1 - static_cast<ssize_t>(m_scheduled_timeouts.size());
+    m_scheduled_timeouts.append(timeout);
+}
+
+void TimeoutSet::schedule_absolute(EventLoopTimeout* timeout)
+{
+    timeout->set_sequence_id(m_next_sequence_id++);
+    timeout->m_deadline_ns = deadline_for(*timeout);
+
+    // While the wheel is empty, the current tick may have fallen far behind. Catch up, so that the timeout doesn't
+    // have to be redistributed needlessly.
+    if (m_timeout_count == 0)
+        m_current_tick = max(m_current_tick, tick_for_deadline(MonotonicTime::now_coarse().nanoseconds()));
+
+    place(timeout);
+}
+
+void TimeoutSet::unschedule(EventLoopTimeout* timeout)
+{
+    if (timeout->m_index < 0) {
+        size_t i = -1 - timeout->m_index;
+        size_t j = m_scheduled_timeouts.size() - 1;
+        VERIFY(m_scheduled_timeouts[i] == timeout);
+        swap(m_scheduled_timeouts[i], m_scheduled_timeouts[j]);
+        swap(m_scheduled_timeouts[i]->m_index, m_scheduled_timeouts[j]->m_index);
+        (void)m_scheduled_timeouts.take_last();
+        timeout->m_index = EventLoopTimeout::INVALID_INDEX;
+    } else {
+        unlink(timeout);
+    }
+}
+
+void TimeoutSet::clear()
+{
+    for (auto& slot : m_slots) {
+        for (auto* timeout = slot.first; timeout;) {
+            auto* next = timeout->m_next_in_slot;
+            timeout->m_previous_in_slot = nullptr;
+            timeout->m_next_in_slot = nullptr;
+            timeout->m_index = EventLoopTimeout::INVALID_INDEX;
+            timeout = next;
+        }
+        slot = {};
+    }
+    m_occupied_slots.fill(0);
+    m_timeout_count = 0;
+
+    for (auto* timeout : m_scheduled_timeouts)
+        timeout->m_index = EventLoopTimeout::INVALID_INDEX;
+    m_scheduled_timeouts.clear();
+}
+
+void TimeoutSet::place(EventLoopTimeout* timeout)
+{
+    auto tick = tick_for_deadline(timeout->m_deadline_ns);
+    if (tick <= m_current_tick) {
+        link(timeout, 0, m_current_tick & SLOT_MASK);
+        return;
+    }
+
+    // Timeouts further out than the wheel spans are placed in its last slot, and placed again once they get there.
+    auto delta = min(tick - m_current_tick, MAX_TICK_DELTA);
+    size_t level = 0;
+    while (delta >= (1ull << ((level + 1) * SLOT_BITS)))
+        ++level;
+
+    link(timeout, level, ((m_current_tick + delta) >> (level * SLOT_BITS)) & SLOT_MASK);
+}
+
+void TimeoutSet::link(EventLoopTimeout* timeout, size_t level, size_t slot_index)
+{
+    auto index = level * SLOTS_PER_LEVEL + slot_index;
+    auto& slot = m_slots[index];
+
+    // The timeouts in the lowest level are kept in the order they fire in. They are usually scheduled in that order,
+    // so finding their place rarely has to look further than the end of the slot.
+    EventLoopTimeout* previous = slot.last;
+    if (level == 0) {
+        while (previous && fires_before(*timeout, timeout->m_deadline_ns, *previous, previous->m_deadline_ns))
+            previous = previous->m_previous_in_slot;
+    }
+
+    auto* next = previous ? previous->m_next_in_slot : slot.first;
+    timeout->m_previous_in_slot = previous;
+    timeout->m_next_in_slot = next;
+    if (previous)
+        previous->m_next_in_slot = timeout;
+    else
+        slot.first = timeout;
+    if (next)
+        next->m_previous_in_slot = timeout;
+    else
+        slot.last = timeout;
+
+    timeout->m_index = static_cast<ssize_t>(index);
+    m_occupied_slots[level] |= 1ull << slot_index;
+    ++m_timeout_count;
+}
+
+void TimeoutSet::unlink(EventLoopTimeout* timeout)
+{
+    auto index = static_cast<size_t>(timeout->m_index);
+    auto& slot = m_slots[index];
+
+    if (timeout->m_previous_in_slot)
+        timeout->m_previous_in_slot->m_next_in_slot = timeout->m_next_in_slot;
+    else
+        slot.first = timeout->m_next_in_slot;
+    if (timeout->m_next_in_slot)
+        timeout->m_next_in_slot->m_previous_in_slot = timeout->m_previous_in_slot;
+    else
+        slot.last = timeout->m_previous_in_slot;
+
+    if (!slot.first)
+        m_occupied_slots[index / SLOTS_PER_LEVEL] &= ~(1ull << (index % SLOTS_PER_LEVEL));
+
+    timeout->m_previous_in_slot = nullptr;
+    timeout->m_next_in_slot = nullptr;
+    timeout->m_index = EventLoopTimeout::INVALID_INDEX;
+    --m_timeout_count;
+}
+
+void TimeoutSet::cascade(size_t level)
+{
+    auto slot_index = (m_current_tick >> (level * SLOT_BITS)) & SLOT_MASK;
+    auto& slot = m_slots[level * SLOTS_PER_LEVEL + slot_index];
+
+    auto* timeout = exchange(slot.first, nullptr);
+    slot.last = nullptr;
+    m_occupied_slots[level] &= ~(1ull << slot_index);
+
+    while (timeout) {
+        auto* next = timeout->m_next_in_slot;
+        timeout->m_previous_in_slot = nullptr;
+        timeout->m_next_in_slot = nullptr;
+        --m_timeout_count;
+        place(timeout);
+        timeout = next;
+    }
+}
+
+size_t TimeoutSet::fire_current_slot(MonotonicTime current_time)
+{
+    auto current_time_ns = current_time.nanoseconds();
+    size_t fired_count = 0;
+
+    // Timeouts fire one at a time, since firing one may schedule or unschedule others.
+    for (;;) {
+        auto* timeout = m_slots[m_current_tick & SLOT_MASK].first;
+        if (!timeout || timeout->m_deadline_ns > current_time_ns)
+            break;
+
+        unlink(timeout);
+        ++fired_count;
+        timeout->fire(*this, current_time);
+    }
+
+    return fired_count;
+}
+
+Optional<u64> TimeoutSet::next_tick_to_process() const
+{
+    Optional<u64> next_tick;
+
+    for (size_t level = 0; level < LEVEL_COUNT; ++level) {
+        auto shift = level * SLOT_BITS;
+        auto position = m_current_tick >> shift;
+
+        auto occupied_slots = m_occupied_slots[level];
+        if (level == 0)
+            occupied_slots &= ~(1ull << (position & SLOT_MASK));
+        if (occupied_slots == 0)
+            continue;
+
+        auto tick = (position + slots_until_next_occupied(occupied_slots, position & SLOT_MASK)) << shift;
+        if (!next_tick.has_value() || tick < *next_tick)
+            next_tick = tick;
+    }
+
+    return next_tick;
+}
+
+}
@@ -6,12 +6,13 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/Badge.h>
-#include <AK/BinaryHeap.h>
 #include <AK/NumericLimits.h>
 #include <AK/Optional.h>
 #include <AK/Time.h>
 #include <AK/Vector.h>
+#include <LibCore/Export.h>
 
 namespace Core {
 
@@ -33,11 +34,13 @@ public:
         m_fire_time = current_time + m_duration;
     }
 
-    ssize_t& index(Badge<TimeoutSet>) { return m_index; }
-    void set_index(Badge<TimeoutSet>, ssize_t index) { m_index = index; }
-
     bool is_scheduled() const { return m_index != INVALID_INDEX; }
 
+    // A timeout with a tolerance may fire up to that much later than its fire time. Its deadline is aligned to a
+    // multiple of the tolerance, so that timeouts with similar fire times are handled in a single wakeup.
+    AK::Duration tolerance() const { return m_tolerance; }
+    void set_tolerance(AK::Duration tolerance) { m_tolerance = tolerance; }
+
     void set_sequence_id(u64 id) { m_sequence_id = id; }
     u64 sequence_id() const { return m_sequence_id; }
 
@@ -48,106 +51,66 @@ protected:
     };
 
 private:
+    friend class TimeoutSet;
+
+    // While scheduled, this is the index of the wheel slot the timeout is linked into. Timeouts scheduled relative to
+    // the next iteration of the event loop have a negative index into the list of relative timeouts instead.
     ssize_t m_index = INVALID_INDEX;
     u64 m_sequence_id { 0 };
+    AK::Duration m_tolerance;
+
+    // The fire time with the tolerance applied, as nanoseconds on the monotonic clock.
+    i64 m_deadline_ns { 0 };
+    EventLoopTimeout* m_previous_in_slot { nullptr };
+    EventLoopTimeout* m_next_in_slot { nullptr };
 };
 
-class TimeoutSet {
+// A hierarchical timer wheel. Each level has 64 slots, and each slot of a level spans 64 times as many milliseconds as
+// one of the level below. Scheduling and unscheduling a timeout only links or unlinks it from its slot. As time passes,
+// the timeouts of a slot further out are redistributed into the lower levels, until they end up in the slot of the
+// millisecond they expire in.
+class CORE_API TimeoutSet {
 public:
     TimeoutSet() = default;
 
-    Optional<MonotonicTime> next_timer_expiration()
-    {
-        if (!m_heap.is_empty()) {
-            return m_heap.peek_min()->fire_time();
-        } else {
-            return {};
-        }
-    }
+    Optional<MonotonicTime> next_timer_expiration();
 
-    void absolutize_relative_timeouts(MonotonicTime current_time)
-    {
-        for (auto timeout : m_scheduled_timeouts) {
-            timeout->absolutize({}, current_time);
-            m_heap.insert(timeout);
-        }
-        m_scheduled_timeouts.clear();
-    }
+    void absolutize_relative_timeouts(MonotonicTime current_time);
 
-    size_t fire_expired(MonotonicTime current_time)
-    {
-        size_t fired_count = 0;
-        while (!m_heap.is_empty()) {
-            auto& timeout = *m_heap.peek_min();
-
-            if (timeout.fire_time() <= current_time) {
-                ++fired_count;
-                m_heap.pop_min();
-                timeout.set_index({}, EventLoopTimeout::INVALID_INDEX);
-                timeout.fire(*this, current_time);
-            } else {
-                break;
-            }
-        }
-        return fired_count;
-    }
+    size_t fire_expired(MonotonicTime current_time);
 
-    void schedule_relative(EventLoopTimeout* timeout)
-    {
-        timeout->set_sequence_id(m_next_sequence_id++);
-        timeout->set_index({}, -1 - static_cast<ssize_t>(m_scheduled_timeouts.size()));
-        m_scheduled_timeouts.append(timeout);
-    }
+    void schedule_relative(EventLoopTimeout* timeout);
+    void schedule_absolute(EventLoopTimeout* timeout);
+    void unschedule(EventLoopTimeout* timeout);
 
-    void schedule_absolute(EventLoopTimeout* timeout)
-    {
-        timeout->set_sequence_id(m_next_sequence_id++);
-        m_heap.insert(timeout);
-    }
-
-    void unschedule(EventLoopTimeout* timeout)
-    {
-        if (timeout->index({}) < 0) {
-            size_t i = -1 - timeout->index({});
-            size_t j = m_scheduled_timeouts.size() - 1;
-            VERIFY(m_scheduled_timeouts[i] == timeout);
-            swap(m_scheduled_timeouts[i], m_scheduled_timeouts[j]);
-            swap(m_scheduled_timeouts[i]->index({}), m_scheduled_timeouts[j]->index({}));
-            (void)m_scheduled_timeouts.take_last();
-        } else {
-            m_heap.pop(timeout->index({}));
-        }
-        timeout->set_index({}, EventLoopTimeout::INVALID_INDEX);
-    }
-
-    void clear()
-    {
-        for (auto* timeout : m_heap.nodes_in_arbitrary_order())
-            timeout->set_index({}, EventLoopTimeout::INVALID_INDEX);
-        m_heap.clear();
-        for (auto* timeout : m_scheduled_timeouts)
-            timeout->set_index({}, EventLoopTimeout::INVALID_INDEX);
-        m_scheduled_timeouts.clear();
-    }
+    void clear();
 
 private:
-    struct TimeoutFiresBefore {
-        bool operator()(EventLoopTimeout* a, EventLoopTimeout* b) const
-        {
-            if (a->fire_time() == b->fire_time())
-                return a->sequence_id() < b->sequence_id();
-            return a->fire_time() < b->fire_time();
-        }
+    static constexpr size_t LEVEL_COUNT = 6;
+    static constexpr size_t SLOT_BITS = 6;
+    static constexpr size_t SLOTS_PER_LEVEL = 1 << SLOT_BITS;
+    static constexpr u64 SLOT_MASK = SLOTS_PER_LEVEL - 1;
+    static constexpr u64 MAX_TICK_DELTA = (1ull << (LEVEL_COUNT * SLOT_BITS)) - 1;
+
+    struct Slot {
+        EventLoopTimeout* first { nullptr };
+        EventLoopTimeout* last { nullptr };
     };
 
-    struct UpdateTimeoutIndex {
-        void operator()(EventLoopTimeout* timeout, size_t index) const
-        {
-            timeout->set_index({}, static_cast<ssize_t>(index));
-        }
-    };
+    static u64 tick_for_deadline(i64 deadline_ns);
+
+    void place(EventLoopTimeout*);
+    void link(EventLoopTimeout*, size_t level, size_t slot_index);
+    void unlink(EventLoopTimeout*);
+    void cascade(size_t level);
+    size_t fire_current_slot(MonotonicTime current_time);
+    Optional<u64> next_tick_to_process() const;
+
+    Array<Slot, LEVEL_COUNT * SLOTS_PER_LEVEL> m_slots;
+    Array<u64, LEVEL_COUNT> m_occupied_slots {};
+    u64 m_current_tick { 0 };
+    size_t m_timeout_count { 0 };
 
-    IntrusiveBinaryHeap<EventLoopTimeout*, TimeoutFiresBefore, UpdateTimeoutIndex, 8> m_heap;
     Vector<EventLoopTimeout*, 8> m_scheduled_timeouts;
     u64 m_next_sequence_id { 0 };
 };
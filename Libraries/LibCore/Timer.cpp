@@ -46,7 +46,7 @@ void Timer::start(int interval_ms)
     if (m_active)
         return;
     m_interval_ms = interval_ms;
-    start_timer(interval_ms);
+    start_timer(interval_ms, m_tolerance_ms);
     m_active = true;
 }
 
@@ -41,6 +41,17 @@ public:
         m_interval_dirty = true;
     }
 
+    // Allows the timer to fire up to this much later than its interval, so that it can share a wakeup with other timers.
+    // A changed tolerance takes effect the next time the timer is started or fires.
+    int tolerance() const { return m_tolerance_ms; }
+    void set_tolerance(int tolerance_ms)
+    {
+        if (m_tolerance_ms == tolerance_ms)
+            return;
+        m_tolerance_ms = tolerance_ms;
+        m_interval_dirty = true;
+    }
+
     bool is_single_shot() const { return m_single_shot; }
     void set_single_shot(bool single_shot) { m_single_shot = single_shot; }
 
@@ -56,6 +67,7 @@ private:
     bool m_single_shot { false };
     bool m_interval_dirty { false };
     int m_interval_ms { 0 };
+    int m_tolerance_ms { 0 };
 };
 
 }
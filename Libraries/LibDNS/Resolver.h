@@ -358,7 +358,8 @@ public:
                 dbgln("LibDNS wire-dns: lookup({}) path={} sync={} ms", name, lookup_path, sync_ms);
         };
 
-        flush_cache();
+        expire_cached_entry(name);
+        flush_cache_if_due();
 
         if (options.repeating_lookup && options.repeating_lookup->times_repeated >= 5) {
             dbgln_if(DNS_DEBUG, "DNS: Repeating lookup for {} timed out", name);
@@ -1405,6 +1406,33 @@ private:
         m_socket_ready_promises.clear();
     }
 
+    // Expires the entry a lookup is about to consult, so that it never observes stale records while the sweep over the
+    // rest of the cache is deferred.
+    void expire_cached_entry(StringView name)
+    {
+        m_cache.with_write_locked([&](auto& cache) {
+            auto it = cache.find(name);
+            if (it == cache.end())
+                return;
+            it->value->check_expiration();
+            if (it->value->can_be_removed())
+                cache.remove(it);
+        });
+    }
+
+    // Sweeping the whole cache is linear in the number of cached names, which adds up on pages that resolve many hosts,
+    // so it runs at most once per interval rather than on every lookup.
+    void flush_cache_if_due()
+    {
+        static constexpr auto cache_sweep_interval = AK::Duration::from_seconds(1);
+
+        auto now = MonotonicTime::now_coarse();
+        if (m_last_cache_sweep.has_value() && now - *m_last_cache_sweep < cache_sweep_interval)
+            return;
+        m_last_cache_sweep = now;
+        flush_cache();
+    }
+
     void flush_cache()
     {
         m_cache.with_write_locked([&](auto& cache) {
@@ -1425,6 +1453,7 @@ private:
     Sync::RWLockProtected<Optional<MaybeOwned<Core::Socket>>> m_socket;
     Function<ErrorOr<SocketResult>()> m_create_socket;
     bool m_attempting_restart { false };
+    Optional<MonotonicTime> m_last_cache_sweep;
     ConnectionMode m_mode { ConnectionMode::UDP };
     Vector<NonnullRefPtr<Core::Promise<Empty>>> m_socket_ready_promises;
 };
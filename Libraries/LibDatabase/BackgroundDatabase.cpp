@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibDatabase/BackgroundDatabase.h>
+#include <LibThreading/Thread.h>
+
+namespace Database {
+
+ErrorOr<NonnullOwnPtr<BackgroundDatabase>> BackgroundDatabase::create(NonnullRefPtr<Database> database, PrepareConnection const& prepare_connection, size_t read_connection_count)
+{
+    Vector<NonnullRefPtr<Database>> read_connections;
+
+    if (database->database_path().has_value()) {
+        for (size_t i = 0; i < read_connection_count; ++i) {
+            auto connection = TRY(database->create_read_only_connection());
+            TRY(prepare_connection(*connection));
+            TRY(read_connections.try_append(move(connection)));
+        }
+    }
+
+    TRY(prepare_connection(*database));
+
+    auto background_database = TRY(adopt_nonnull_own_or_enomem(new (nothrow) BackgroundDatabase));
+    TRY(start_thread(background_database->m_write_queue, "DatabaseWriter"sv, move(database)));
+
+    if (!read_connections.is_empty()) {
+        background_database->m_read_queue = TRY(adopt_nonnull_own_or_enomem(new (nothrow) TaskQueue));
+
+        for (auto& connection : read_connections)
+            TRY(start_thread(*background_database->m_read_queue, "DatabaseReader"sv, move(connection)));
+    }
+
+    return background_database;
+}
+
+BackgroundDatabase::BackgroundDatabase() = default;
+
+BackgroundDatabase::~BackgroundDatabase()
+{
+    if (m_read_queue)
+        stop(*m_read_queue);
+    stop(m_write_queue);
+}
+
+void BackgroundDatabase::enqueue(TaskQueue& queue, QueuedTask task)
+{
+    Sync::MutexLocker locker(queue.mutex);
+    VERIFY(!queue.stopping);
+
+    queue.tasks.enqueue(move(task));
+    queue.condition.signal();
+}
+
+ErrorOr<void> BackgroundDatabase::start_thread(TaskQueue& queue, StringView name, NonnullRefPtr<Database> database)
+{
+    auto thread = TRY(Threading::Thread::try_create(name, [&queue, database = move(database)]() -> intptr_t {
+        while (true) {
+            QueuedTask task;
+
+            {
+                Sync::MutexLocker locker(queue.mutex);
+                queue.condition.wait_while([&] { return !queue.stopping && queue.tasks.is_empty(); });
+
+                // Tasks that were queued before the database was destroyed still run, so that no write is lost.
+                if (queue.tasks.is_empty())
+                    return 0;
+                task = queue.tasks.dequeue();
+            }
+
+            task(*database);
+        }
+    }));
+
+    TRY(queue.threads.try_append(thread));
+    thread->start();
+    return {};
+}
+
+void BackgroundDatabase::stop(TaskQueue& queue)
+{
+    {
+        Sync::MutexLocker locker(queue.mutex);
+        queue.stopping = true;
+        queue.condition.broadcast();
+    }
+
+    for (auto& thread : queue.threads)
+        (void)thread->join();
+}
+
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/OwnPtr.h>
+#include <AK/Queue.h>
+#include <AK/Vector.h>
+#include <LibCore/EventLoop.h>
+#include <LibDatabase/Database.h>
+#include <LibDatabase/Forward.h>
+#include <LibSync/ConditionVariable.h>
+#include <LibSync/Mutex.h>
+#include <LibThreading/Forward.h>
+
+namespace Database {
+
+// Runs statements against a database away from the thread that owns it. Writes are run in order on a dedicated
+// connection and thread. Reads are spread over a pool of read-only connections, each with a thread of its own, so
+// that they run concurrently with each other and with writes. Memory-backed databases cannot be shared between
+// connections, so their reads are run on the write connection instead.
+//
+// Prepared statement IDs belong to a single connection. Every connection is therefore handed to the same preparation
+// callback, in the same order, so that the IDs it returns may be used on any of them.
+class DATABASE_API BackgroundDatabase {
+    AK_MAKE_NONCOPYABLE(BackgroundDatabase);
+    AK_MAKE_NONMOVABLE(BackgroundDatabase);
+
+public:
+    using PrepareConnection = Function<ErrorOr<void>(Database&)>;
+
+    static constexpr size_t DEFAULT_READ_CONNECTION_COUNT = 2;
+
+    // Takes ownership of the connection, which must not be used on any other thread afterwards.
+    static ErrorOr<NonnullOwnPtr<BackgroundDatabase>> create(NonnullRefPtr<Database>, PrepareConnection const&, size_t read_connection_count = DEFAULT_READ_CONNECTION_COUNT);
+
+    // Runs every task that has already been queued before returning.
+    ~BackgroundDatabase();
+
+    // The task runs on the database thread. Its result is handed to on_complete on the calling thread's event loop.
+    template<typename Task, typename OnComplete>
+    void write(Task task, OnComplete on_complete)
+    {
+        enqueue(m_write_queue, wrap_task(move(task), move(on_complete)));
+    }
+
+    template<typename Task>
+    void write(Task task)
+    {
+        enqueue(m_write_queue, [task = move(task)](Database& database) mutable { task(database); });
+    }
+
+    template<typename Task, typename OnComplete>
+    void read(Task task, OnComplete on_complete)
+    {
+        enqueue(m_read_queue ? *m_read_queue : m_write_queue, wrap_task(move(task), move(on_complete)));
+    }
+
+    size_t read_connection_count() const { return m_read_queue ? m_read_queue->threads.size() : 0; }
+
+private:
+    using QueuedTask = Function<void(Database&)>;
+
+    struct TaskQueue {
+        Sync::Mutex mutex;
+        Sync::ConditionVariable condition { mutex };
+        Queue<QueuedTask> tasks;
+        bool stopping { false };
+        Vector<NonnullRefPtr<Threading::Thread>> threads;
+    };
+
+    BackgroundDatabase();
+
+    template<typename Task, typename OnComplete>
+    static QueuedTask wrap_task(Task task, OnComplete on_complete)
+    {
+        auto& event_loop = Core::EventLoop::current();
+
+        return [task = move(task), on_complete = move(on_complete), &event_loop](Database& database) mutable {
+            using Result = decltype(task(database));
+
+            if constexpr (IsVoid<Result>) {
+                task(database);
+                event_loop.deferred_invoke(move(on_complete));
+            } else {
+                event_loop.deferred_invoke([on_complete = move(on_complete), result = task(database)]() mutable {
+                    on_complete(move(result));
+                });
+            }
+        };
+    }
+
+    static void enqueue(TaskQueue&, QueuedTask);
+    static ErrorOr<void> start_thread(TaskQueue&, StringView name, NonnullRefPtr<Database>);
+    static void stop(TaskQueue&);
+
+    TaskQueue m_write_queue;
+    OwnPtr<TaskQueue> m_read_queue;
+};
+
+}
@@ -5,6 +5,7 @@
  */
 
 #include <AK/ByteString.h>
+#include <AK/ScopeGuard.h>
 #include <AK/String.h>
 #include <AK/Time.h>
 #include <LibCore/Directory.h>
@@ -71,6 +72,21 @@ ErrorOr<NonnullRefPtr<Database>> Database::create(ByteString const& directory, S
     return create(sql_database, database_path);
 }
 
+ErrorOr<NonnullRefPtr<Database>> Database::create_read_only_connection() const
+{
+    if (!m_database_path.has_value())
+        return Error::from_string_literal("Memory-backed databases cannot be shared between connections");
+
+    sqlite3* sql_database { nullptr };
+    if (auto result = sqlite3_open_v2(m_database_path->string().characters(), &sql_database, SQLITE_OPEN_READONLY, nullptr); result != SQLITE_OK) {
+        sqlite3_close(sql_database);
+        return Error::from_string_view(sql_error(result));
+    }
+
+    // The journal mode is a property of the database file, which the writing connection has already set.
+    return TRY(adopt_nonnull_ref_or_enomem(new (nothrow) Database(sql_database, m_database_path)));
+}
+
 ErrorOr<NonnullRefPtr<Database>> Database::create(sqlite3* sql_database, Optional<LexicalPath> database_path)
 {
     auto database = TRY(adopt_nonnull_ref_or_enomem(new (nothrow) Database(sql_database, move(database_path))));
@@ -104,10 +120,42 @@ ErrorOr<StatementID> Database::prepare_statement(StringView statement)
 
     auto statement_id = m_prepared_statements.size();
     m_prepared_statements.append(prepared_statement);
+    m_statement_statistics.append({});
 
     return statement_id;
 }
 
+StringView Database::statement_sql(StatementID statement_id)
+{
+    auto const* sql = sqlite3_sql(prepared_statement(statement_id));
+    return { sql, __builtin_strlen(sql) };
+}
+
+void Database::record_statement_execution(StatementID statement_id, MonotonicTime started_at)
+{
+    auto execution_time = MonotonicTime::now() - started_at;
+
+    auto& statistics = m_statement_statistics[statement_id];
+    ++statistics.execution_count;
+    statistics.total_execution_time += execution_time;
+    statistics.longest_execution_time = max(statistics.longest_execution_time, execution_time);
+}
+
+void Database::dump_statement_statistics()
+{
+    for (StatementID statement_id = 0; statement_id < m_prepared_statements.size(); ++statement_id) {
+        auto const& statistics = m_statement_statistics[statement_id];
+        if (statistics.execution_count == 0)
+            continue;
+
+        dbgln("{} executions, {}us total, {}us longest: {}",
+            statistics.execution_count,
+            statistics.total_execution_time.to_microseconds(),
+            statistics.longest_execution_time.to_microseconds(),
+            statement_sql(statement_id).trim_whitespace());
+    }
+}
+
 void Database::execute_statement_internal(StatementID statement_id, OnResult on_result)
 {
     if (auto result = try_execute_statement_internal(statement_id, move(on_result)); result.is_error()) [[unlikely]] {
@@ -120,6 +168,9 @@ Database::StatementExecutionOutcome Database::execute_interruptible_statement_in
 {
     auto* statement = prepared_statement(statement_id);
 
+    auto started_at = MonotonicTime::now();
+    ScopeGuard record_execution = [&] { record_statement_execution(statement_id, started_at); };
+
     while (true) {
         auto result = sqlite3_step(statement);
 
@@ -156,6 +207,9 @@ ErrorOr<void> Database::try_execute_statement_internal(StatementID statement_id,
 {
     auto* statement = prepared_statement(statement_id);
 
+    auto started_at = MonotonicTime::now();
+    ScopeGuard record_execution = [&] { record_statement_execution(statement_id, started_at); };
+
     while (true) {
         auto result = sqlite3_step(statement);
 
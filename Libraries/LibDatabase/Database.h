@@ -15,6 +15,7 @@
 #include <AK/RefCounted.h>
 #include <AK/Span.h>
 #include <AK/StringView.h>
+#include <AK/Time.h>
 #include <AK/Vector.h>
 #include <LibDatabase/Forward.h>
 
@@ -23,6 +24,12 @@ struct sqlite3_stmt;
 
 namespace Database {
 
+struct StatementStatistics {
+    u64 execution_count { 0 };
+    AK::Duration total_execution_time;
+    AK::Duration longest_execution_time;
+};
+
 struct Migration {
     u32 version { 0 };
 
@@ -40,6 +47,10 @@ public:
     static ErrorOr<NonnullRefPtr<Database>> create(ByteString const& directory, StringView name);
     ~Database();
 
+    // Opens another connection to the same database file that may only read from it. Under the WAL, readers on their
+    // own connections neither block nor are blocked by this connection's writes.
+    ErrorOr<NonnullRefPtr<Database>> create_read_only_connection() const;
+
     using OnResult = Function<void(StatementID)>;
 
     enum class StatementExecutionOutcome {
@@ -51,6 +62,12 @@ public:
 
     ErrorOr<StatementID> prepare_statement(StringView statement);
 
+    StringView statement_sql(StatementID);
+
+    // Execution times include the time spent in the OnResult callback.
+    StatementStatistics const& statement_statistics(StatementID statement_id) const { return m_statement_statistics[statement_id]; }
+    void dump_statement_statistics();
+
     void execute_statement(StatementID statement_id, OnResult on_result)
     {
         VERIFY(bound_parameter_count(statement_id) == 0);
@@ -149,22 +166,7 @@ public:
     // https://www.sqlite.org/c3ref/busy_timeout.html
     ErrorOr<void> set_busy_timeout(i32 milliseconds);
 
-private:
-    static ErrorOr<NonnullRefPtr<Database>> create(sqlite3*, Optional<LexicalPath> database_path = {});
-    Database(sqlite3*, Optional<LexicalPath> database_path);
-
-    void execute_statement_internal(StatementID, OnResult);
-    StatementExecutionOutcome execute_interruptible_statement_internal(StatementID, OnResult);
-    ErrorOr<void> try_execute_statement_internal(StatementID, OnResult);
-
-    int bound_parameter_count(StatementID);
-
-    template<typename ValueType>
-    void apply_placeholder(StatementID statement_id, int index, ValueType const& value);
-
-    template<typename ValueType>
-    ErrorOr<void> try_apply_placeholder(StatementID statement_id, int index, ValueType const& value);
-
+    // Rolls back on destruction unless committed.
     class Transaction {
     public:
         explicit Transaction(Database& database)
@@ -186,6 +188,23 @@ private:
         bool m_active { false };
     };
 
+private:
+    static ErrorOr<NonnullRefPtr<Database>> create(sqlite3*, Optional<LexicalPath> database_path = {});
+    Database(sqlite3*, Optional<LexicalPath> database_path);
+
+    void execute_statement_internal(StatementID, OnResult);
+    StatementExecutionOutcome execute_interruptible_statement_internal(StatementID, OnResult);
+    ErrorOr<void> try_execute_statement_internal(StatementID, OnResult);
+
+    int bound_parameter_count(StatementID);
+    void record_statement_execution(StatementID, MonotonicTime started_at);
+
+    template<typename ValueType>
+    void apply_placeholder(StatementID statement_id, int index, ValueType const& value);
+
+    template<typename ValueType>
+    ErrorOr<void> try_apply_placeholder(StatementID statement_id, int index, ValueType const& value);
+
     ALWAYS_INLINE sqlite3_stmt* prepared_statement(StatementID statement_id)
     {
         VERIFY(statement_id < m_prepared_statements.size());
@@ -195,6 +214,7 @@ private:
     Optional<LexicalPath> m_database_path;
     sqlite3* m_database { nullptr };
     Vector<sqlite3_stmt*> m_prepared_statements;
+    Vector<StatementStatistics> m_statement_statistics;
     Optional<StatementID> m_table_exists_statement;
     Optional<StatementID> m_schema_version_statement;
 };
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <LibDevTools/Actors/PerfActor.h>
+#include <LibDevTools/DevToolsDelegate.h>
+#include <LibDevTools/DevToolsServer.h>
+
+namespace DevTools {
+
+NonnullRefPtr<PerfActor> PerfActor::create(DevToolsServer& devtools, String name)
+{
+    return adopt_ref(*new PerfActor(devtools, move(name)));
+}
+
+PerfActor::PerfActor(DevToolsServer& devtools, String name)
+    : Actor(devtools, move(name))
+{
+}
+
+PerfActor::~PerfActor() = default;
+
+void PerfActor::handle_message(Message const& message)
+{
+    JsonObject response;
+
+    if (message.type == "isActive"sv) {
+        response.set("value"sv, m_is_active);
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "isSupportedPlatform"sv) {
+        response.set("value"sv, true);
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "isLockedForPrivateBrowsing"sv) {
+        response.set("value"sv, false);
+        send_response(message, move(response));
+        return;
+    }
+
+    // FIXME: We only sample the main thread of the active tab, so none of the optional Gecko profiler features apply.
+    if (message.type == "getSupportedFeatures"sv) {
+        response.set("value"sv, JsonArray {});
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "startProfiler"sv) {
+        devtools().delegate().start_sampling_profiler();
+        m_is_active = true;
+
+        response.set("value"sv, true);
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "stopProfilerAndDiscard"sv) {
+        devtools().delegate().stop_sampling_profiler([](auto) { });
+        m_is_active = false;
+
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "getProfileAndStopProfiler"sv) {
+        m_is_active = false;
+
+        devtools().delegate().stop_sampling_profiler(
+            async_handler(message, [](auto&, auto profile, auto& response) {
+                response.set("value"sv, move(profile));
+            }));
+
+        return;
+    }
+
+    send_unrecognized_packet_type_error(message);
+}
+
+}
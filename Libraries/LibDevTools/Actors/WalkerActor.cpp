@@ -60,16 +60,48 @@ void WalkerActor::handle_message(Message const& message)
             return;
         }
 
+        auto children = ancestor_node->node.get_array("children"sv);
+        auto child_count = children.has_value() ? children->size() : 0;
+
+        // The client may page through the children of nodes with many children, rather than asking for all of them at
+        // once. A page holds up to maxNodes children, starting at the child given by "start", or centered around the
+        // child given by "center".
+        auto max_nodes = message.data.get_integer<size_t>("maxNodes"sv).value_or(0);
+        if (max_nodes == 0)
+            max_nodes = child_count;
+
+        auto index_of_child = [&](StringView key) -> Optional<size_t> {
+            auto actor = message.data.get_string(key);
+            if (!actor.has_value() || !children.has_value())
+                return {};
+
+            for (size_t i = 0; i < child_count; ++i) {
+                if (children->at(i).as_object().get_string("actor"sv) == *actor)
+                    return i;
+            }
+            return {};
+        };
+
+        size_t first_index = 0;
+        if (auto center = index_of_child("center"sv); center.has_value())
+            first_index = *center - min(*center, max_nodes / 2);
+        else if (auto start = index_of_child("start"sv); start.has_value())
+            first_index = *start;
+
+        // A page that would run past the last child is moved back, so that it is still full.
+        if (child_count - first_index < max_nodes)
+            first_index = child_count - min(child_count, max_nodes);
+
+        auto end_index = min(child_count, first_index + max_nodes);
+
         JsonArray nodes;
+        nodes.ensure_capacity(end_index - first_index);
 
-        if (auto children = ancestor_node->node.get_array("children"sv); children.has_value()) {
-            children->for_each([&](JsonValue const& child) {
-                nodes.must_append(serialize_node(child.as_object()));
-            });
-        }
+        for (auto i = first_index; i < end_index; ++i)
+            nodes.must_append(serialize_node(children->at(i).as_object()));
 
-        response.set("hasFirst"sv, !nodes.is_empty());
-        response.set("hasLast"sv, !nodes.is_empty());
+        response.set("hasFirst"sv, !nodes.is_empty() && first_index == 0);
+        response.set("hasLast"sv, !nodes.is_empty() && end_index == child_count);
         response.set("nodes"sv, move(nodes));
         send_response(message, move(response));
         return;
@@ -1007,8 +1039,14 @@ bool WalkerActor::replace_node_in_tree(JsonObject replacement)
     if (!node.has_value() || !node.value())
         return false;
 
-    const_cast<JsonObject&>(*node.value()) = move(replacement);
-    populate_dom_tree_cache();
+    auto& target = const_cast<JsonObject&>(*node.value());
+    auto const* parent = m_dom_node_to_parent_map.get(&target).value_or(nullptr);
+
+    // Only the replaced subtree is cached again, so that a mutation costs time proportional to the size of its target
+    // rather than to the size of the whole document.
+    remove_from_dom_tree_cache(target);
+    target = move(replacement);
+    populate_dom_tree_cache(target, parent);
 
     return true;
 }
@@ -1070,6 +1108,29 @@ void WalkerActor::clear_dom_tree_cache()
     m_dom_node_id_to_actor_map.clear();
 }
 
+void WalkerActor::remove_from_dom_tree_cache(JsonObject const& node)
+{
+    m_dom_node_to_parent_map.remove(&node);
+
+    // A node which was moved elsewhere in the tree may have been cached at its new position already, in which case its
+    // entries must be left alone.
+    if (auto actor = node.get_string("actor"sv); actor.has_value()) {
+        if (m_actor_to_dom_node_map.get(*actor) == &node) {
+            m_actor_to_dom_node_map.remove(*actor);
+
+            auto identifier = NodeIdentifier::for_node(node);
+            if (!identifier.pseudo_element.has_value())
+                m_dom_node_id_to_actor_map.remove(identifier.id);
+        }
+    }
+
+    if (auto children = node.get_array("children"sv); children.has_value()) {
+        children->for_each([&](JsonValue const& child) {
+            remove_from_dom_tree_cache(child.as_object());
+        });
+    }
+}
+
 void WalkerActor::populate_dom_tree_cache(JsonObject& node, JsonObject const* parent)
 {
     auto const& node_actor = actor_for_node(node);
@@ -58,6 +58,7 @@ private:
     void clear_dom_tree_state();
     void populate_dom_tree_cache();
     void populate_dom_tree_cache(JsonObject& node, JsonObject const* parent);
+    void remove_from_dom_tree_cache(JsonObject const& node);
 
     NodeActor const& actor_for_node(JsonObject const& node);
     void handle_node_picker_event(DevToolsDelegate::NodePickerEvent);
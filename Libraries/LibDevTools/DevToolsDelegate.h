@@ -214,6 +214,10 @@ public:
     virtual void listen_for_navigation_events(TabDescription const&, OnNavigationStarted, OnNavigationFinished) const { }
     virtual void stop_listening_for_navigation_events(TabDescription const&) const { }
 
+    using OnSamplingProfileReceived = Function<void(ErrorOr<JsonObject>)>;
+    virtual void start_sampling_profiler() const { }
+    virtual void stop_sampling_profiler(OnSamplingProfileReceived) const { }
+
     virtual void did_connect_devtools_client(TabDescription const&) const { }
     virtual void did_disconnect_devtools_client(TabDescription const&) const { }
 };
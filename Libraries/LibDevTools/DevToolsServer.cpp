@@ -12,6 +12,7 @@
 #include <LibCore/TCPServer.h>
 #include <LibDevTools/Actors/DeviceActor.h>
 #include <LibDevTools/Actors/ParentAccessibilityActor.h>
+#include <LibDevTools/Actors/PerfActor.h>
 #include <LibDevTools/Actors/PreferenceActor.h>
 #include <LibDevTools/Actors/ProcessActor.h>
 #include <LibDevTools/Actors/TabActor.h>
@@ -111,6 +112,7 @@ ErrorOr<void> DevToolsServer::on_new_client()
     register_actor<PreferenceActor>();
     register_actor<ProcessActor>(ProcessDescription { .is_parent = true });
     register_actor<ParentAccessibilityActor>();
+    register_actor<PerfActor>();
 
     return {};
 }
@@ -31,6 +31,7 @@ class NetworkParentActor;
 class NodeActor;
 class PageStyleActor;
 class ParentAccessibilityActor;
+class PerfActor;
 class PreferenceActor;
 class ProcessActor;
 class RootActor;
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/Format.h>
 #include <AK/Forward.h>
 #include <AK/HashMap.h>
@@ -55,6 +56,11 @@ public:
     bool is_marked() const { return m_mark; }
     void set_marked(bool b) { m_mark = b; }
 
+    // Parallel marking may race several threads to the same cell. Returns true
+    // for the one caller that actually flipped the mark bit.
+    bool is_marked_atomically() const { return AK::atomic_load(&m_mark, AK::memory_order_relaxed); }
+    bool try_set_marked_atomically() { return !AK::atomic_exchange(&m_mark, true, AK::memory_order_relaxed); }
+
     enum class State : bool {
         Live,
         Dead,
@@ -63,6 +69,11 @@ public:
     State state() const { return m_state; }
     void set_state(State state) { m_state = state; }
 
+    // Set once a cell has been marked live by a collection. Cells that die
+    // before this is set never outlived a single GC cycle.
+    bool has_survived_collection() const { return m_has_survived_collection; }
+    void set_has_survived_collection() { m_has_survived_collection = true; }
+
     virtual StringView class_name() const = 0;
 
     class GC_API Visitor {
@@ -239,6 +250,7 @@ protected:
 private:
     bool m_mark { false };
     State m_state { State::Live };
+    bool m_has_survived_collection { false };
 };
 
 template<typename T>
@@ -52,7 +52,7 @@ CellAllocator& CellAllocatorDescriptorBase::for_heap(Heap& heap)
     return allocator;
 }
 
-Cell* CellAllocator::allocate_cell(Heap& heap)
+Cell* CellAllocator::allocate_cell_slow(Heap& heap)
 {
     if (!m_list_node.is_in_list())
         heap.register_cell_allocator({}, *this);
@@ -77,12 +77,7 @@ Cell* CellAllocator::allocate_cell(Heap& heap)
         m_usable_blocks.append(*block.leak_ptr());
     }
 
-    auto& block = *m_usable_blocks.last();
-    auto* cell = block.allocate();
-    VERIFY(cell);
-    if (block.is_full())
-        m_full_blocks.append(*m_usable_blocks.last());
-    return cell;
+    return allocate_cell_from_usable_block();
 }
 
 void CellAllocator::block_did_become_empty(Badge<Heap>, HeapBlock& block, DeferDecommit defer_decommit)
@@ -94,10 +89,17 @@ void CellAllocator::block_did_become_empty(Badge<Heap>, HeapBlock& block, DeferD
     m_block_allocator.deallocate_block(&block, defer_decommit);
 }
 
-void CellAllocator::block_did_become_usable(Badge<Heap>, HeapBlock& block)
+void CellAllocator::block_did_become_usable(Badge<Heap>, HeapBlock& block, size_t live_cells)
 {
     VERIFY(!block.is_full());
-    m_usable_blocks.append(block);
+    // We allocate from the back of the usable list. Cells in type-isolated
+    // blocks can't move, so the only way to get a sparse block back is to
+    // stop allocating into it and let it drain; queue sparse blocks at the
+    // front and keep filling the dense ones.
+    if (live_cells < block.cell_count() / sparse_block_divisor)
+        m_usable_blocks.prepend(block);
+    else
+        m_usable_blocks.append(block);
 }
 
 }
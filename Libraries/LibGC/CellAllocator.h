@@ -71,7 +71,15 @@ public:
     Optional<StringView> class_name() const { return m_class_name; }
     size_t cell_size() const { return m_cell_size; }
 
-    Cell* allocate_cell(Heap&);
+    // Allocates from the most recently used block, which bump-allocates
+    // until its lazy freelist is exhausted. Only falls back to an out-of-line
+    // call when there is no usable block.
+    ALWAYS_INLINE Cell* allocate_cell(Heap& heap)
+    {
+        if (m_usable_blocks.is_empty()) [[unlikely]]
+            return allocate_cell_slow(heap);
+        return allocate_cell_from_usable_block();
+    }
 
     template<typename Callback>
     IterationDecision for_each_block(Callback callback)
@@ -88,7 +96,7 @@ public:
     }
 
     void block_did_become_empty(Badge<Heap>, HeapBlock&, DeferDecommit = DeferDecommit::Yes);
-    void block_did_become_usable(Badge<Heap>, HeapBlock&);
+    void block_did_become_usable(Badge<Heap>, HeapBlock&, size_t live_cells);
 
     bool has_blocks_pending_sweep() const { return !m_blocks_pending_sweep.is_empty(); }
 
@@ -105,6 +113,21 @@ public:
 private:
     friend class Heap;
 
+    Cell* allocate_cell_slow(Heap&);
+
+    // A block with fewer than 1/sparse_block_divisor of its cells live is considered sparse.
+    static constexpr size_t sparse_block_divisor = 4;
+
+    ALWAYS_INLINE Cell* allocate_cell_from_usable_block()
+    {
+        auto& block = *m_usable_blocks.last();
+        auto* cell = block.allocate();
+        VERIFY(cell);
+        if (block.is_full())
+            m_full_blocks.append(block);
+        return cell;
+    }
+
     Optional<StringView> m_class_name;
     size_t const m_cell_size;
 
@@ -115,6 +138,8 @@ private:
     BlockList m_full_blocks;
     BlockList m_usable_blocks;
     SweepBlockList m_blocks_pending_sweep;
+    // Estimated bytes allocated, attributed by the allocation sampler.
+    u64 m_sampled_allocation_bytes { 0 };
     FlatPtr m_min_block_address { explode_byte(0xff) };
     FlatPtr m_max_block_address { 0 };
     bool m_overrides_must_survive_garbage_collection { false };
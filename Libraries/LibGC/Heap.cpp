@@ -20,6 +20,7 @@
 #include <AK/ScopeGuard.h>
 #include <AK/StackInfo.h>
 #include <AK/StackUnwinder.h>
+#include <AK/Stream.h>
 #include <AK/TemporaryChange.h>
 #include <AK/Time.h>
 #include <LibCore/ElapsedTimer.h>
@@ -33,6 +34,9 @@
 #include <LibGC/NanBoxedValue.h>
 #include <LibGC/Root.h>
 #include <LibGC/Weak.h>
+#include <LibSync/ConditionVariable.h>
+#include <LibSync/Mutex.h>
+#include <LibThreading/Thread.h>
 #include <setjmp.h>
 
 #ifdef HAS_ADDRESS_SANITIZER
@@ -78,9 +82,43 @@ i32 libgc_log_level()
     return level;
 }
 
+// LIBGC_MARKING_THREADS sets how many helper threads join the main thread
+// during the mark phase. 0 (default) marks on the main thread only.
+size_t read_libgc_marking_threads()
+{
+    char const* env = getenv("LIBGC_MARKING_THREADS");
+    if (!env || !*env)
+        return 0;
+    return static_cast<size_t>(clamp(atoi(env), 0, 64));
+}
+
+size_t libgc_marking_threads()
+{
+    static size_t const threads = read_libgc_marking_threads();
+    return threads;
+}
+
+// LIBGC_ALLOCATION_SAMPLE_INTERVAL=N samples one cell allocation every N
+// bytes allocated, attributing the whole interval to that cell's allocator.
+// Results show up in dump_allocators(). 0 (default) disables sampling.
+size_t read_libgc_allocation_sample_interval()
+{
+    char const* env = getenv("LIBGC_ALLOCATION_SAMPLE_INTERVAL");
+    if (!env || !*env)
+        return 0;
+    return static_cast<size_t>(max(atoi(env), 0));
+}
+
+size_t libgc_allocation_sample_interval()
+{
+    static size_t const interval = read_libgc_allocation_sample_interval();
+    return interval;
+}
+
 // Per-phase timings recorded during a single collect_garbage() call. We keep
 // these at file scope (instead of threading more parameters through the GC's
 // internal helpers) since GC is single-threaded, guarded by m_collecting_garbage.
+// Parallel marking helpers never touch these; only the main thread records them.
 struct PhaseTimings {
     // Top-level phases.
     i64 gather_roots_us { 0 };
@@ -125,6 +163,8 @@ struct SweepStats {
     size_t live_cell_bytes { 0 };
     size_t live_external_bytes { 0 };
     size_t freed_block_count { 0 };
+    size_t young_collected_cells { 0 };
+    size_t young_surviving_cells { 0 };
 };
 SweepStats g_sweep_stats;
 
@@ -137,6 +177,8 @@ struct IncrementalSweepBatchStats {
 struct IncrementalSweepStats {
     bool should_report { false };
     size_t total_blocks { 0 };
+    size_t young_collected_cells { 0 };
+    size_t young_surviving_cells { 0 };
     Vector<IncrementalSweepBatchStats> batches;
     Core::ElapsedTimer timer { Core::TimerType::Precise };
 };
@@ -153,6 +195,15 @@ bool g_next_incremental_sweep_should_report { false };
 // the GC's helpers to decide whether they should record subphase timings.
 bool g_recording_phase_timings { false };
 
+// Young cells are those that had not survived a collection before this one.
+// Their survival rate is what a nursery would have to promote.
+void print_young_cell_stats(size_t young_collected_cells, size_t young_surviving_cells)
+{
+    auto young_cells = young_collected_cells + young_surviving_cells;
+    auto survival_rate = young_cells == 0 ? 0.0 : 100.0 * static_cast<double>(young_surviving_cells) / static_cast<double>(young_cells);
+    dbgln("     Young cells: {} collected, {} survived ({:.1f}%)", young_collected_cells, young_surviving_cells, survival_rate);
+}
+
 void print_gc_report(i64 total_us, size_t live_block_count)
 {
     auto const& t = g_phase_timings;
@@ -171,6 +222,8 @@ void print_gc_report(i64 total_us, size_t live_block_count)
     dbgln("       Live cells: {} ({})", s.live_cells, human_readable_size(s.live_cell_bytes));
     dbgln("    Live external: {}", human_readable_size(s.live_external_bytes));
     dbgln("  Collected cells: {} ({})", s.collected_cells, human_readable_size(s.collected_cell_bytes));
+    print_young_cell_stats(s.young_collected_cells, s.young_surviving_cells);
+    dbgln("  Marking threads: {}", libgc_marking_threads() + 1);
     dbgln("      Live blocks: {} ({})", live_block_count, human_readable_size(live_block_count * HeapBlock::BLOCK_SIZE));
     dbgln("     Freed blocks: {} ({})", s.freed_block_count, human_readable_size(s.freed_block_count * HeapBlock::BLOCK_SIZE));
     dbgln("");
@@ -241,6 +294,7 @@ void print_incremental_sweep_report(size_t live_cell_bytes, size_t live_external
     dbgln("     Live cells: {}", human_readable_size(live_cell_bytes));
     dbgln("  Live external: {}", human_readable_size(live_external_bytes));
     dbgln("  Next threshold: {}", human_readable_size(next_gc_bytes_threshold));
+    print_young_cell_stats(incremental_sweep_stats().young_collected_cells, incremental_sweep_stats().young_surviving_cells);
     dbgln("");
     dbgln("Batch timings:");
     dbgln("  Shortest batch: {} us", shortest_batch_us);
@@ -298,6 +352,8 @@ Heap::Heap(AK::Function<void(HashMap<Cell*, GC::HeapRoot>&)> gather_embedder_roo
     if (become_process_default == BecomeProcessDefault::Yes)
         s_the = this;
     m_gc_bytes_threshold = GC_MIN_BYTES_THRESHOLD;
+    if (auto interval = libgc_allocation_sample_interval(); interval > 0)
+        m_bytes_until_next_allocation_sample = interval;
     static_assert(HeapBlock::min_possible_cell_size <= 32, "Heap Cell tracking uses too much data!");
 }
 
@@ -339,6 +395,15 @@ void Heap::will_allocate(size_t size)
         start_idle_gc_timer();
 }
 
+void Heap::sample_allocation(CellAllocator& allocator, size_t size)
+{
+    auto interval = libgc_allocation_sample_interval();
+    auto bytes_past_sample_point = size - m_bytes_until_next_allocation_sample;
+    auto sample_count = 1 + bytes_past_sample_point / interval;
+    m_bytes_until_next_allocation_sample = interval - bytes_past_sample_point % interval;
+    allocator.m_sampled_allocation_bytes += sample_count * interval;
+}
+
 void Heap::did_allocate_external_memory(size_t size)
 {
     will_allocate(size);
@@ -494,69 +559,34 @@ public:
     AK::JsonObject dump()
     {
         auto graph = AK::JsonObject();
-        for (auto& it : m_graph) {
-            AK::JsonArray edges;
-            for (auto const& value : it.value.edges) {
-                edges.must_append(MUST(String::formatted("{}", value)));
-            }
+        for (auto& it : m_graph)
+            graph.set(ByteString::number(it.key), serialize_node(it.value));
+        return graph;
+    }
 
-            auto node = AK::JsonObject();
-            if (it.value.root_origin.has_value()) {
-                auto type = it.value.root_origin->type;
-                auto const* location = it.value.root_origin->location;
-                switch (type) {
-                case HeapRoot::Type::ConservativeHashMap:
-                    node.set("root"sv, "ConservativeHashMap"sv);
-                    break;
-                case HeapRoot::Type::ConservativeHashTable:
-                    node.set("root"sv, "ConservativeHashTable"sv);
-                    break;
-                case HeapRoot::Type::ConservativeVector:
-                    node.set("root"sv, "ConservativeVector"sv);
-                    break;
-                case HeapRoot::Type::CrossHeapMember:
-                    node.set("root"sv, "CrossHeapMember"sv);
-                    break;
-                case HeapRoot::Type::HeapFunctionCapturedPointer:
-                    node.set("root"sv, "HeapFunctionCapturedPointer"sv);
-                    break;
-                case HeapRoot::Type::MustSurviveGC:
-                    node.set("root"sv, "MustSurviveGC"sv);
-                    break;
-                case HeapRoot::Type::Root:
-                    node.set("root"sv, MUST(String::formatted("Root {} {}:{}", location->function_name(), location->filename(), location->line_number())));
-                    break;
-                case HeapRoot::Type::RootVector:
-                    node.set("root"sv, "RootVector"sv);
-                    break;
-                case HeapRoot::Type::RootHashMap:
-                    node.set("root"sv, "RootHashMap"sv);
-                    break;
-                case HeapRoot::Type::RootHashTable:
-                    node.set("root"sv, "RootHashTable"sv);
-                    break;
-                case HeapRoot::Type::RegisterPointer:
-                    node.set("root"sv, "RegisterPointer"sv);
-                    if (it.value.root_origin->stack_frame_index.has_value())
-                        node.set("stack_frame_index"sv, it.value.root_origin->stack_frame_index.value());
-                    break;
-                case HeapRoot::Type::StackPointer:
-                    node.set("root"sv, "StackPointer"sv);
-                    if (it.value.root_origin->stack_frame_index.has_value())
-                        node.set("stack_frame_index"sv, it.value.root_origin->stack_frame_index.value());
-                    break;
-                case HeapRoot::Type::VM:
-                    node.set("root"sv, "VM"sv);
-                    break;
-                }
-                VERIFY(node.has("root"sv));
-            }
-            node.set("class_name"sv, it.value.class_name);
-            node.set("edges"sv, edges);
-            graph.set(ByteString::number(it.key), node);
-        }
+    // Like visit_all_cells() followed by dump(), but writes each node out as
+    // soon as its edges are known and then drops them.
+    ErrorOr<void> visit_all_cells_and_write_to(Stream& stream)
+    {
+        bool is_first_node = true;
+        while (!m_work_queue.is_empty()) {
+            auto cell = m_work_queue.take_last();
+            auto address = bit_cast<FlatPtr>(cell.ptr());
+            auto& node = m_graph.ensure(address);
+            // A cell can be queued again before it is first visited.
+            if (node.has_been_written)
+                continue;
+            m_node_being_visited = &node;
+            node.class_name = cell->class_name();
+            cell->visit_edges(*this);
+            m_node_being_visited = nullptr;
 
-        return graph;
+            TRY(stream.write_formatted("{}\"{}\":{}", is_first_node ? ""sv : ","sv, address, serialize_node(node).serialized()));
+            is_first_node = false;
+            node.has_been_written = true;
+            node.edges = {};
+        }
+        return {};
     }
 
 private:
@@ -564,8 +594,72 @@ private:
         Optional<HeapRoot> root_origin;
         StringView class_name;
         HashTable<FlatPtr> edges {};
+        bool has_been_written { false };
     };
 
+    static AK::JsonObject serialize_node(GraphNode const& graph_node)
+    {
+        AK::JsonArray edges;
+        for (auto const& value : graph_node.edges) {
+            edges.must_append(MUST(String::formatted("{}", value)));
+        }
+
+        auto node = AK::JsonObject();
+        if (graph_node.root_origin.has_value()) {
+            auto type = graph_node.root_origin->type;
+            auto const* location = graph_node.root_origin->location;
+            switch (type) {
+            case HeapRoot::Type::ConservativeHashMap:
+                node.set("root"sv, "ConservativeHashMap"sv);
+                break;
+            case HeapRoot::Type::ConservativeHashTable:
+                node.set("root"sv, "ConservativeHashTable"sv);
+                break;
+            case HeapRoot::Type::ConservativeVector:
+                node.set("root"sv, "ConservativeVector"sv);
+                break;
+            case HeapRoot::Type::CrossHeapMember:
+                node.set("root"sv, "CrossHeapMember"sv);
+                break;
+            case HeapRoot::Type::HeapFunctionCapturedPointer:
+                node.set("root"sv, "HeapFunctionCapturedPointer"sv);
+                break;
+            case HeapRoot::Type::MustSurviveGC:
+                node.set("root"sv, "MustSurviveGC"sv);
+                break;
+            case HeapRoot::Type::Root:
+                node.set("root"sv, MUST(String::formatted("Root {} {}:{}", location->function_name(), location->filename(), location->line_number())));
+                break;
+            case HeapRoot::Type::RootVector:
+                node.set("root"sv, "RootVector"sv);
+                break;
+            case HeapRoot::Type::RootHashMap:
+                node.set("root"sv, "RootHashMap"sv);
+                break;
+            case HeapRoot::Type::RootHashTable:
+                node.set("root"sv, "RootHashTable"sv);
+                break;
+            case HeapRoot::Type::RegisterPointer:
+                node.set("root"sv, "RegisterPointer"sv);
+                if (graph_node.root_origin->stack_frame_index.has_value())
+                    node.set("stack_frame_index"sv, graph_node.root_origin->stack_frame_index.value());
+                break;
+            case HeapRoot::Type::StackPointer:
+                node.set("root"sv, "StackPointer"sv);
+                if (graph_node.root_origin->stack_frame_index.has_value())
+                    node.set("stack_frame_index"sv, graph_node.root_origin->stack_frame_index.value());
+                break;
+            case HeapRoot::Type::VM:
+                node.set("root"sv, "VM"sv);
+                break;
+            }
+            VERIFY(node.has("root"sv));
+        }
+        node.set("class_name"sv, graph_node.class_name);
+        node.set("edges"sv, edges);
+        return node;
+    }
+
     GraphNode* m_node_being_visited { nullptr };
     Vector<Ref<Cell>> m_work_queue;
     HashMap<FlatPtr, GraphNode> m_graph;
@@ -575,6 +669,36 @@ private:
     FlatPtr m_max_block_address;
 };
 
+static AK::JsonArray stack_frames_to_json(Vector<StackFrameInfo> const& stack_frames)
+{
+    AK::JsonArray stack_frames_array;
+    for (auto const& frame : stack_frames) {
+        AK::JsonObject frame_object;
+        frame_object.set("label"sv, frame.label);
+        frame_object.set("size"sv, frame.size_bytes);
+        stack_frames_array.must_append(move(frame_object));
+    }
+    return stack_frames_array;
+}
+
+ErrorOr<void> Heap::dump_graph_to(Stream& stream)
+{
+    // See dump_graph() for why the sweep has to be drained first.
+    finish_pending_incremental_sweep();
+
+    HashMap<Cell*, HeapRoot> roots;
+    Vector<StackFrameInfo> stack_frames;
+    gather_roots(roots, &stack_frames);
+    GraphConstructorVisitor visitor(*this, roots);
+
+    TRY(stream.write_until_depleted("{"sv));
+    TRY(visitor.visit_all_cells_and_write_to(stream));
+    if (!stack_frames.is_empty())
+        TRY(stream.write_formatted(",\"stack_frames\":{}", stack_frames_to_json(stack_frames).serialized()));
+    TRY(stream.write_until_depleted("}"sv));
+    return {};
+}
+
 AK::JsonObject Heap::dump_graph()
 {
     // An in-progress incremental sweep would leave parts of the heap as freelist
@@ -590,16 +714,8 @@ AK::JsonObject Heap::dump_graph()
     visitor.visit_all_cells();
     auto graph = visitor.dump();
 
-    if (!stack_frames.is_empty()) {
-        AK::JsonArray stack_frames_array;
-        for (auto const& frame : stack_frames) {
-            AK::JsonObject frame_object;
-            frame_object.set("label"sv, frame.label);
-            frame_object.set("size"sv, frame.size_bytes);
-            stack_frames_array.must_append(move(frame_object));
-        }
-        graph.set("stack_frames"sv, move(stack_frames_array));
-    }
+    if (!stack_frames.is_empty())
+        graph.set("stack_frames"sv, stack_frames_to_json(stack_frames));
 
     return graph;
 }
@@ -728,6 +844,7 @@ void Heap::dump_allocators()
 {
     size_t total_in_committed_blocks = 0;
     size_t total_waste = 0;
+    size_t total_compactable = 0;
     for (auto& allocator : m_all_cell_allocators) {
         struct BlockStats {
             HeapBlock& block;
@@ -776,12 +893,23 @@ void Heap::dump_allocators()
         size_t reserved = allocator.block_allocator().block_count() * HeapBlock::BLOCK_SIZE / KiB;
         builder.appendff(", cost: {} KiB, reserved: {} KiB", cost, reserved);
 
+        if (allocator.m_sampled_allocation_bytes)
+            builder.appendff(", sampled allocations: ~{} KiB", allocator.m_sampled_allocation_bytes / KiB);
+
         size_t total_dead_bytes = ((blocks.size() * cell_count) - total_live_cells) * allocator.cell_size();
         if (total_dead_bytes) {
             builder.appendff(", waste: {} KiB", total_dead_bytes / KiB);
             total_waste += total_dead_bytes;
         }
 
+        // Blocks that would be freed if the live cells were packed densely.
+        size_t dense_block_count = ceil_div(total_live_cells, cell_count);
+        size_t compactable_bytes = (blocks.size() - dense_block_count) * HeapBlock::BLOCK_SIZE;
+        if (compactable_bytes) {
+            builder.appendff(", compactable: {} KiB", compactable_bytes / KiB);
+            total_compactable += compactable_bytes;
+        }
+
         dbgln("{}", builder.string_view());
 
         for (auto& block : blocks) {
@@ -790,6 +918,7 @@ void Heap::dump_allocators()
     }
     dbgln("Total allocated: {} KiB", total_in_committed_blocks / KiB);
     dbgln("Total wasted on fragmentation: {} KiB", total_waste / KiB);
+    dbgln("Total reclaimable by compaction: {} KiB", total_compactable / KiB);
 }
 
 void Heap::enqueue_post_gc_task(AK::Function<void()> task)
@@ -1052,6 +1181,22 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
     }
 }
 
+// Shared between the markers of a parallel mark phase. Markers drain their own
+// stacks and only go through the shared stack to hand work to idle markers.
+struct ParallelMarkingState {
+    explicit ParallelMarkingState(size_t marker_count)
+        : marker_count(marker_count)
+    {
+    }
+
+    Sync::Mutex mutex;
+    Sync::ConditionVariable work_available { mutex };
+    Vector<Ref<Cell>> shared_work;
+    size_t const marker_count;
+    Atomic<size_t> idle_markers { 0 };
+    bool done { false };
+};
+
 class MarkingVisitor final : public Cell::Visitor {
 public:
     // The domain is a set of heaps whose cells this mark phase is responsible for; cells outside the domain are not visited.
@@ -1071,6 +1216,15 @@ public:
         }
     }
 
+    // Creates a helper marker for a parallel mark phase led by `main`.
+    MarkingVisitor(MarkingVisitor const& main, ParallelMarkingState& parallel_state)
+        : m_domain(main.m_domain)
+        , m_parallel_state(&parallel_state)
+        , m_min_block_address(main.m_min_block_address)
+        , m_max_block_address(main.m_max_block_address)
+    {
+    }
+
     bool cell_is_in_domain(Cell const& cell) const
     {
         auto& heap = HeapBlockBase::from_cell(&cell)->heap();
@@ -1085,13 +1239,13 @@ public:
 
     virtual void visit_impl(Cell& cell) override
     {
-        if (cell.is_marked())
+        if (is_marked(cell))
             return;
         if (!cell_is_in_domain(cell))
             return;
+        if (!try_mark(cell))
+            return;
         dbgln_if(HEAP_DEBUG, "  ! {}", &cell);
-
-        cell.set_marked(true);
         m_work_queue.append(cell);
     }
 
@@ -1103,13 +1257,13 @@ public:
             if (!value.is_cell())
                 continue;
             auto& cell = value.as_cell();
-            if (cell.is_marked())
+            if (is_marked(cell))
                 continue;
             if (!cell_is_in_domain(cell))
                 continue;
+            if (!try_mark(cell))
+                continue;
             dbgln_if(HEAP_DEBUG, "  ! {}", &cell);
-
-            cell.set_marked(true);
             m_work_queue.unchecked_append(cell);
         }
     }
@@ -1124,11 +1278,12 @@ public:
 
         for (auto* heap : m_domain) {
             for_each_cell_among_possible_pointers(heap->m_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
-                if (cell->is_marked())
+                if (is_marked(*cell))
                     return;
                 if (cell->state() != Cell::State::Live)
                     return;
-                cell->set_marked(true);
+                if (!try_mark(*cell))
+                    return;
                 m_work_queue.append(*cell);
             });
         }
@@ -1141,13 +1296,115 @@ public:
         }
     }
 
+    // Drains this marker's stack, sharing work with idle markers and taking
+    // work from the shared stack when it runs dry. Returns once every marker
+    // is idle and no work is left anywhere.
+    void mark_all_live_cells_in_parallel()
+    {
+        VERIFY(m_parallel_state);
+        do {
+            while (!m_work_queue.is_empty()) {
+                m_work_queue.take_last()->visit_edges(*this);
+                if (m_work_queue.size() >= min_work_to_share && m_parallel_state->idle_markers.load(AK::memory_order_relaxed) > 0)
+                    share_work();
+            }
+        } while (take_shared_work());
+    }
+
+    void set_parallel_state(ParallelMarkingState* parallel_state) { m_parallel_state = parallel_state; }
+
 private:
+    static constexpr size_t min_work_to_share = 64;
+    static constexpr size_t max_work_to_take = 256;
+
+    ALWAYS_INLINE bool is_marked(Cell const& cell) const
+    {
+        if (m_parallel_state)
+            return cell.is_marked_atomically();
+        return cell.is_marked();
+    }
+
+    ALWAYS_INLINE bool try_mark(Cell& cell)
+    {
+        if (m_parallel_state)
+            return cell.try_set_marked_atomically();
+        cell.set_marked(true);
+        return true;
+    }
+
+    // Hands the older half of our stack to the shared stack. Older entries
+    // tend to be closer to the roots and lead to larger subgraphs.
+    void share_work()
+    {
+        auto& state = *m_parallel_state;
+        auto count = m_work_queue.size() / 2;
+        {
+            Sync::MutexLocker locker(state.mutex);
+            state.shared_work.ensure_capacity(state.shared_work.size() + count);
+            for (size_t i = 0; i < count; ++i)
+                state.shared_work.unchecked_append(m_work_queue[i]);
+        }
+        m_work_queue.remove(0, count);
+        state.work_available.broadcast();
+    }
+
+    bool take_shared_work()
+    {
+        auto& state = *m_parallel_state;
+        Sync::MutexLocker locker(state.mutex);
+        ++state.idle_markers;
+        while (state.shared_work.is_empty() && !state.done) {
+            if (state.idle_markers.load() == state.marker_count) {
+                state.done = true;
+                state.work_available.broadcast();
+                break;
+            }
+            state.work_available.wait();
+        }
+        if (state.done)
+            return false;
+        --state.idle_markers;
+        auto count = min(state.shared_work.size(), max_work_to_take);
+        for (size_t i = 0; i < count; ++i)
+            m_work_queue.append(state.shared_work.take_last());
+        return true;
+    }
+
     ReadonlySpan<Heap* const> m_domain;
     Vector<Ref<Cell>> m_work_queue;
+    ParallelMarkingState* m_parallel_state { nullptr };
     FlatPtr m_min_block_address;
     FlatPtr m_max_block_address;
 };
 
+// Runs the transitive marking on the main thread plus `helper_count` helper
+// threads. All markers start with no local work except the main one, which
+// shares its root set as soon as helpers go idle.
+static void mark_all_live_cells_in_parallel(MarkingVisitor& main_visitor, size_t helper_count)
+{
+    ParallelMarkingState state { helper_count + 1 };
+    main_visitor.set_parallel_state(&state);
+
+    Vector<NonnullRefPtr<Threading::Thread>> helpers;
+    helpers.ensure_capacity(helper_count);
+    for (size_t i = 0; i < helper_count; ++i) {
+        auto helper = Threading::Thread::construct("GCMarker"sv, [&main_visitor, &state] {
+            MarkingVisitor visitor { main_visitor, state };
+            visitor.mark_all_live_cells_in_parallel();
+            return static_cast<intptr_t>(0);
+        });
+        helper->start();
+        helpers.unchecked_append(move(helper));
+    }
+
+    main_visitor.mark_all_live_cells_in_parallel();
+
+    for (auto& helper : helpers)
+        (void)helper->join();
+
+    main_visitor.set_parallel_state(nullptr);
+}
+
 void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots)
 {
     Heap* domain[] = { this };
@@ -1166,7 +1423,11 @@ void Heap::mark_live_cells_across(ReadonlySpan<Heap* const> heaps, HashMap<Cell*
 
     {
         ScopedPhaseTimer timer { g_recording_phase_timings, g_phase_timings.mark_bfs_us };
-        visitor->mark_all_live_cells();
+        // Finalization and weak processing after this stay on the main thread.
+        if (auto helper_count = libgc_marking_threads(); helper_count > 0)
+            mark_all_live_cells_in_parallel(*visitor, helper_count);
+        else
+            visitor->mark_all_live_cells();
     }
 
     {
@@ -1213,29 +1474,43 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
 {
     dbgln_if(HEAP_DEBUG, "sweep_dead_cells:");
     Vector<HeapBlock*, 32> empty_blocks;
-    Vector<HeapBlock*, 32> full_blocks_that_became_usable;
+    struct UsableBlock {
+        HeapBlock* block;
+        size_t live_cells;
+    };
+    Vector<UsableBlock, 32> full_blocks_that_became_usable;
 
     size_t collected_cells = 0;
     size_t live_cells = 0;
     size_t collected_cell_bytes = 0;
     size_t live_cell_bytes = 0;
     size_t live_external_bytes = 0;
+    size_t young_collected_cells = 0;
+    size_t young_surviving_cells = 0;
 
     {
         ScopedPhaseTimer timer { g_recording_phase_timings, g_phase_timings.sweep_block_iteration_us };
         for_each_block([&](auto& block) {
             bool block_has_live_cells = false;
             bool block_was_full = block.is_full();
+            size_t block_live_cells = 0;
             block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
                 if (!cell->is_marked()) {
                     dbgln_if(HEAP_DEBUG, "  ~ {}", cell);
+                    if (!cell->has_survived_collection())
+                        ++young_collected_cells;
                     block.deallocate(cell);
                     ++collected_cells;
                     collected_cell_bytes += block.cell_size();
                 } else {
                     cell->set_marked(false);
+                    if (!cell->has_survived_collection()) {
+                        cell->set_has_survived_collection();
+                        ++young_surviving_cells;
+                    }
                     block_has_live_cells = true;
                     ++live_cells;
+                    ++block_live_cells;
                     live_cell_bytes += block.cell_size();
                     auto cell_external_memory_size = cell->external_memory_size();
                     live_external_bytes = cell_external_memory_size > NumericLimits<size_t>::max() - live_external_bytes
@@ -1246,7 +1521,7 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
             if (!block_has_live_cells)
                 empty_blocks.append(&block);
             else if (block_was_full != block.is_full())
-                full_blocks_that_became_usable.append(&block);
+                full_blocks_that_became_usable.append({ &block, block_live_cells });
             return IterationDecision::Continue;
         });
     }
@@ -1258,9 +1533,9 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
             block->cell_allocator().block_did_become_empty({}, *block, DeferDecommit::No);
         }
 
-        for (auto* block : full_blocks_that_became_usable) {
+        for (auto [block, block_live_cells] : full_blocks_that_became_usable) {
             dbgln_if(HEAP_DEBUG, " - HeapBlock usable again @ {}: cell_size={}", block, block->cell_size());
-            block->cell_allocator().block_did_become_usable({}, *block);
+            block->cell_allocator().block_did_become_usable({}, *block, block_live_cells);
         }
     }
 
@@ -1284,6 +1559,8 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
             .live_cell_bytes = live_cell_bytes,
             .live_external_bytes = live_external_bytes,
             .freed_block_count = empty_blocks.size(),
+            .young_collected_cells = young_collected_cells,
+            .young_surviving_cells = young_surviving_cells,
         };
     }
     (void)measurement_timer;
@@ -1306,10 +1583,16 @@ void Heap::sweep_block(HeapBlock& block)
     block.for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
         if (!cell->is_marked()) {
             dbgln_if(HEAP_DEBUG, "  ~ {}", cell);
+            if (!cell->has_survived_collection())
+                ++incremental_sweep_stats().young_collected_cells;
             block.deallocate(cell);
             ++collected_cells;
         } else {
             cell->set_marked(false);
+            if (!cell->has_survived_collection()) {
+                cell->set_has_survived_collection();
+                ++incremental_sweep_stats().young_surviving_cells;
+            }
             block_has_live_cells = true;
             m_sweep_live_cell_bytes += block.cell_size();
             auto cell_external_memory_size = cell->external_memory_size();
@@ -1329,7 +1612,7 @@ void Heap::sweep_block(HeapBlock& block)
         dbgln_if(HEAP_DEBUG, " - HeapBlock usable again @ {}: cell_size={}", &block, block.cell_size());
         dbgln_if(INCREMENTAL_SWEEP_DEBUG, "[sweep] Block @ {} now usable (live: {}, collected: {})",
             &block, live_cells, collected_cells);
-        block.cell_allocator().block_did_become_usable({}, block);
+        block.cell_allocator().block_did_become_usable({}, block, live_cells);
     } else if constexpr (INCREMENTAL_SWEEP_DEBUG) {
         dbgln("[sweep] Block @ {} swept (live: {}, collected: {})",
             &block, live_cells, collected_cells);
@@ -1368,6 +1651,8 @@ void Heap::start_incremental_sweep()
     m_sweep_live_external_bytes = 0;
     incremental_sweep_stats().should_report = false;
     incremental_sweep_stats().total_blocks = 0;
+    incremental_sweep_stats().young_collected_cells = 0;
+    incremental_sweep_stats().young_surviving_cells = 0;
     incremental_sweep_stats().batches.clear();
     incremental_sweep_stats().should_report = g_next_incremental_sweep_should_report;
     g_next_incremental_sweep_should_report = false;
@@ -1454,6 +1739,19 @@ void Heap::stop_incremental_sweep_timer()
 }
 
 void Heap::sweep_on_timer()
+{
+    sweep_incrementally_for(AK::Duration::from_milliseconds(GC_INCREMENTAL_SWEEP_SLICE_MS));
+}
+
+void Heap::perform_idle_gc_work(AK::Duration budget)
+{
+    // Keep idle slices no longer than timer slices, so a task that arrives
+    // mid-slice is not held up, and requestIdleCallback keeps most of the
+    // idle period.
+    sweep_incrementally_for(min(budget, AK::Duration::from_milliseconds(GC_INCREMENTAL_SWEEP_SLICE_MS)));
+}
+
+void Heap::sweep_incrementally_for(AK::Duration slice)
 {
     if (!m_incremental_sweep_active)
         return;
@@ -1464,7 +1762,7 @@ void Heap::sweep_on_timer()
     size_t blocks_swept = 0;
     bool finished_sweep = false;
     auto start_time = MonotonicTime::now();
-    auto deadline = start_time + AK::Duration::from_milliseconds(GC_INCREMENTAL_SWEEP_SLICE_MS);
+    auto deadline = start_time + slice;
     while (MonotonicTime::now() < deadline) {
         if (sweep_next_block()) {
             auto elapsed = MonotonicTime::now() - start_time;
@@ -1479,7 +1777,7 @@ void Heap::sweep_on_timer()
     if (blocks_swept > 0 && !finished_sweep) {
         auto elapsed = MonotonicTime::now() - start_time;
         record_incremental_sweep_batch(blocks_swept, elapsed.to_microseconds(), false);
-        dbgln_if(INCREMENTAL_SWEEP_DEBUG, "[sweep] Timer slice: {} blocks in {}ms",
+        dbgln_if(INCREMENTAL_SWEEP_DEBUG, "[sweep] Slice: {} blocks in {}ms",
             blocks_swept, elapsed.to_milliseconds());
     }
 }
@@ -14,6 +14,7 @@
 #include <AK/RefPtr.h>
 #include <AK/StackInfo.h>
 #include <AK/String.h>
+#include <AK/Time.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
 #include <LibCore/Forward.h>
@@ -84,6 +85,9 @@ public:
 
     void collect_garbage(CollectionType = CollectionType::CollectGarbage, bool print_report = false);
     AK::JsonObject dump_graph();
+    // Writes the same graph as dump_graph(), one node at a time, without
+    // keeping the edges of already-written nodes in memory.
+    ErrorOr<void> dump_graph_to(Stream&);
 
     bool should_collect_on_every_allocation() const { return m_should_collect_on_every_allocation; }
 
@@ -123,8 +127,13 @@ public:
     void uproot_cell(Cell* cell);
 
     bool is_gc_deferred() const { return m_gc_deferrals > 0; }
+    bool is_collecting_garbage() const { return m_collecting_garbage; }
     bool is_incremental_sweep_active() const { return m_incremental_sweep_active; }
 
+    // Called by the embedder when it is idle. Spends up to `budget` making
+    // progress on an in-flight incremental sweep.
+    void perform_idle_gc_work(AK::Duration budget);
+
     void sweep_block(HeapBlock&);
 
     bool is_live_heap_block(HeapBlock* block) const { return m_live_heap_blocks.contains(block); }
@@ -156,10 +165,16 @@ private:
             "GC cell allocator type mismatch");
 
         will_allocate(sizeof(T));
-        return T::cell_allocator.for_heap(*this).allocate_cell(*this);
+        auto& allocator = T::cell_allocator.for_heap(*this);
+        if (m_bytes_until_next_allocation_sample <= sizeof(T)) [[unlikely]]
+            sample_allocation(allocator, sizeof(T));
+        else
+            m_bytes_until_next_allocation_sample -= sizeof(T);
+        return allocator.allocate_cell(*this);
     }
 
     void will_allocate(size_t);
+    void sample_allocation(CellAllocator&, size_t size);
     void update_gc_bytes_threshold(size_t live_cell_bytes, size_t live_external_bytes);
 
     void find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_address);
@@ -185,6 +200,7 @@ private:
     void start_incremental_sweep_timer();
     void stop_incremental_sweep_timer();
     void sweep_on_timer();
+    void sweep_incrementally_for(AK::Duration slice);
 
     void start_idle_gc_timer();
     void idle_gc_on_timer();
@@ -200,6 +216,7 @@ private:
 
     size_t m_gc_bytes_threshold { 0 };
     size_t m_allocated_bytes_since_last_gc { 0 };
+    size_t m_bytes_until_next_allocation_sample { NumericLimits<size_t>::max() };
 
     bool m_should_collect_on_every_allocation { false };
 
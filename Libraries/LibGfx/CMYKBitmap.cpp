@@ -5,10 +5,36 @@
  */
 
 #include <AK/Checked.h>
+#include <AK/SIMDExtras.h>
 #include <LibGfx/CMYKBitmap.h>
 
 namespace Gfx {
 
+using AK::SIMD::i32x4;
+using AK::SIMD::load_unaligned;
+using AK::SIMD::store_unaligned;
+using AK::SIMD::to_f32x4;
+using AK::SIMD::to_i32x4;
+using AK::SIMD::to_u32x4;
+using AK::SIMD::u32x4;
+using AK::SIMD::u8x16;
+
+// The vectorized loops below hold one pixel per 32-bit lane, with its channels in bytes 0 to 3.
+static constexpr size_t pixels_per_vector = 4;
+
+// Exact for every product of two 8-bit values, which lets us avoid vector integer division.
+ALWAYS_INLINE static u32x4 divide_by_255(u32x4 value)
+{
+    return (value + (value >> 8) + 1) >> 8;
+}
+
+ALWAYS_INLINE static i32x4 clamp_to_u8(i32x4 value)
+{
+    value &= ~(value < 0);
+    auto is_too_large = value > 255;
+    return (value & ~is_too_large) | (255 & is_too_large);
+}
+
 ErrorOr<NonnullRefPtr<CMYKBitmap>> CMYKBitmap::create_with_size(IntSize const& size)
 {
     VERIFY(size.width() >= 0 && size.height() >= 0);
@@ -21,21 +47,87 @@ ErrorOr<NonnullRefPtr<CMYKBitmap>> CMYKBitmap::create_with_size(IntSize const& s
     return adopt_ref(*new CMYKBitmap(size, move(data)));
 }
 
+static RawPixel cmyk_to_low_quality_rgb(CMYK const& cmyk)
+{
+    u8 k = 255 - cmyk.k;
+    return Color((255 - cmyk.c) * k / 255, (255 - cmyk.m) * k / 255, (255 - cmyk.y) * k / 255).value();
+}
+
 ErrorOr<NonnullRefPtr<Bitmap>> CMYKBitmap::to_low_quality_rgb() const
 {
     if (!m_rgb_bitmap) {
         m_rgb_bitmap = TRY(Bitmap::create(BitmapFormat::BGRx8888, m_size));
 
+        auto width = static_cast<size_t>(m_size.width());
         for (int y = 0; y < m_size.height(); ++y) {
-            for (int x = 0; x < m_size.width(); ++x) {
-                auto const& cmyk = scanline(y)[x];
-                u8 k = 255 - cmyk.k;
-                m_rgb_bitmap->scanline(y)[x] = Color((255 - cmyk.c) * k / 255, (255 - cmyk.m) * k / 255, (255 - cmyk.y) * k / 255).value();
+            auto const* source = scanline(y);
+            auto* destination = m_rgb_bitmap->scanline(y);
+
+            size_t x = 0;
+            for (; x + pixels_per_vector <= width; x += pixels_per_vector) {
+                auto pixels = load_unaligned<u32x4>(&source[x]);
+                auto k = 255 - (pixels >> 24);
+                auto red = divide_by_255((255 - (pixels & 0xff)) * k);
+                auto green = divide_by_255((255 - ((pixels >> 8) & 0xff)) * k);
+                auto blue = divide_by_255((255 - ((pixels >> 16) & 0xff)) * k);
+                store_unaligned(&destination[x], 0xff000000 | (red << 16) | (green << 8) | blue);
             }
+            for (; x < width; ++x)
+                destination[x] = cmyk_to_low_quality_rgb(source[x]);
         }
     }
 
     return *m_rgb_bitmap;
 }
 
+void CMYKBitmap::invert()
+{
+    auto* data = m_data.data();
+    size_t i = 0;
+    for (; i + sizeof(u8x16) <= m_data.size(); i += sizeof(u8x16))
+        store_unaligned(data + i, ~load_unaligned<u8x16>(data + i));
+    for (; i < m_data.size(); ++i)
+        data[i] = ~data[i];
+}
+
+static CMYK ycck_to_cmyk(CMYK const& ycck)
+{
+    auto y = ycck.c;
+    auto cb = ycck.m;
+    auto cr = ycck.y;
+
+    int r = y + 1.402f * (cr - 128);
+    int g = y - 0.3441f * (cb - 128) - 0.7141f * (cr - 128);
+    int b = y + 1.772f * (cb - 128);
+
+    return {
+        static_cast<u8>(clamp(r, 0, 255)),
+        static_cast<u8>(clamp(g, 0, 255)),
+        static_cast<u8>(clamp(b, 0, 255)),
+        static_cast<u8>(255 - ycck.k),
+    };
+}
+
+void CMYKBitmap::convert_from_ycck()
+{
+    auto* pixels = begin();
+    auto pixel_count = static_cast<size_t>(end() - begin());
+
+    size_t i = 0;
+    for (; i + pixels_per_vector <= pixel_count; i += pixels_per_vector) {
+        auto ycck = load_unaligned<u32x4>(&pixels[i]);
+        auto y = to_f32x4(ycck & 0xff);
+        auto cb = to_f32x4(to_i32x4((ycck >> 8) & 0xff) - 128);
+        auto cr = to_f32x4(to_i32x4((ycck >> 16) & 0xff) - 128);
+        auto k = 255 - (ycck >> 24);
+
+        auto r = to_u32x4(clamp_to_u8(to_i32x4(y + 1.402f * cr)));
+        auto g = to_u32x4(clamp_to_u8(to_i32x4(y - 0.3441f * cb - 0.7141f * cr)));
+        auto b = to_u32x4(clamp_to_u8(to_i32x4(y + 1.772f * cb)));
+        store_unaligned(&pixels[i], r | (g << 8) | (b << 16) | (k << 24));
+    }
+    for (; i < pixel_count; ++i)
+        pixels[i] = ycck_to_cmyk(pixels[i]);
+}
+
 }
@@ -38,6 +38,12 @@ public:
 
     ErrorOr<NonnullRefPtr<Bitmap>> to_low_quality_rgb() const;
 
+    // Replaces every channel value v with 255 - v, for files that store inverted CMYK data.
+    void invert();
+
+    // Converts pixels that hold Adobe YCCK data (Y, Cb, Cr and an inverted K) into CMYK.
+    void convert_from_ycck();
+
 private:
     CMYKBitmap(IntSize const& size, ByteBuffer data)
         : m_size(size)
@@ -56,6 +56,94 @@ CanvasPaintStyle to_canvas_paint_style(PaintStyle const& paint_style)
     VERIFY_NOT_REACHED();
 }
 
+// Returns the area a draw command can touch in the canvas's current user space, if the command touches nothing
+// outside it. Any command that changes the drawing state (transform, clip, save stack) returns nothing, as do draws
+// whose effect can reach beyond their geometry (filters, blurred shadows, non-source-over compositing).
+static Optional<FloatRect> bounds_of_cullable_draw(CanvasCommand const& command)
+{
+    auto is_plain_draw = [](auto const& command) {
+        return !command.filter.has_value()
+            && command.compositing_and_blending_operator == CompositingAndBlendingOperator::SourceOver;
+    };
+
+    return command.visit(
+        [](CanvasCommands::ClearRect const& command) -> Optional<FloatRect> {
+            return command.rect;
+        },
+        [](CanvasCommands::FillRect const& command) -> Optional<FloatRect> {
+            return command.rect;
+        },
+        [&](CanvasCommands::DrawBitmap const& command) -> Optional<FloatRect> {
+            if (!is_plain_draw(command))
+                return {};
+            return command.dst_rect;
+        },
+        [&](CanvasCommands::DrawCanvas const& command) -> Optional<FloatRect> {
+            if (!is_plain_draw(command))
+                return {};
+            return command.dst_rect;
+        },
+        [&](CanvasCommands::FillPath const& command) -> Optional<FloatRect> {
+            if (!is_plain_draw(command) || command.blur_radius > 0)
+                return {};
+            return command.path.bounding_box();
+        },
+        [&](CanvasCommands::StrokePath const& command) -> Optional<FloatRect> {
+            if (!is_plain_draw(command) || command.blur_radius > 0)
+                return {};
+            // Miter joins can reach miter_limit * thickness / 2 away from the path.
+            auto extent = command.thickness * max(command.miter_limit, 1.0f);
+            return command.path.bounding_box().inflated(extent, extent);
+        },
+        [](auto const&) -> Optional<FloatRect> {
+            return {};
+        });
+}
+
+void CanvasCommandList::append(CanvasCommand&& command)
+{
+    if (command.has<CanvasCommands::SetTransform>() && !m_commands.is_empty() && m_commands.last().has<CanvasCommands::SetTransform>()) {
+        m_commands.last() = move(command);
+        return;
+    }
+
+    if (command.has<CanvasCommands::Restore>() && !m_commands.is_empty() && m_commands.last().has<CanvasCommands::Save>()) {
+        m_commands.take_last();
+        return;
+    }
+
+    if (auto const* clear_rect = command.get_pointer<CanvasCommands::ClearRect>()) {
+        // A ClearRect overwrites every pixel inside its rect, subject to the same transform and clip as the draws
+        // recorded since the last state change, so draws that stay inside it are invisible. Anti-aliased draws can
+        // touch pixels whose centers lie just outside their bounds, which the (aliased) clear would not reach, so
+        // their bounds must fit with a pixel of margin. Only a bounded tail is inspected to keep appends cheap.
+        static constexpr size_t max_commands_to_inspect = 256;
+        size_t first_index_to_inspect = m_commands.size() - min(m_commands.size(), max_commands_to_inspect);
+        size_t cull_start = m_commands.size();
+        while (cull_start > first_index_to_inspect) {
+            auto bounds = bounds_of_cullable_draw(m_commands[cull_start - 1]);
+            if (!bounds.has_value())
+                break;
+            --cull_start;
+        }
+
+        size_t kept_count = cull_start;
+        for (size_t i = cull_start; i < m_commands.size(); ++i) {
+            auto bounds = bounds_of_cullable_draw(m_commands[i]).value();
+            if (!m_commands[i].has<CanvasCommands::ClearRect>())
+                bounds.inflate(2, 2);
+            if (clear_rect->rect.contains(bounds))
+                continue;
+            if (kept_count != i)
+                m_commands[kept_count] = move(m_commands[i]);
+            ++kept_count;
+        }
+        m_commands.shrink(kept_count);
+    }
+
+    m_commands.append(move(command));
+}
+
 }
 
 namespace IPC {
@@ -155,7 +155,10 @@ public:
     {
     }
 
-    void append(CanvasCommand&& command) { m_commands.append(move(command)); }
+    // Appends a command, coalescing it with the commands recorded right before it where the result is
+    // indistinguishable on the canvas: consecutive SetTransforms collapse into the last one, a Save directly
+    // followed by its Restore is dropped, and recent draws that a ClearRect fully overwrites are culled.
+    void append(CanvasCommand&&);
 
     bool is_empty() const { return m_commands.is_empty(); }
     size_t size() const { return m_commands.size(); }
@@ -26,6 +26,8 @@ struct CornerRadius {
     {
         return horizontal_radius > 0 && vertical_radius > 0;
     }
+
+    bool operator==(CornerRadius const&) const = default;
 };
 
 struct CornerRadii {
@@ -41,6 +43,8 @@ struct CornerRadii {
 
     void adjust_corners_for_spread_distance(int spread_distance);
 
+    bool operator==(CornerRadii const&) const = default;
+
     bool contains(IntPoint point, IntRect const& rect) const
     {
         if (!rect.contains(point))
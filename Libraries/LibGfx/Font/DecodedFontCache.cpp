@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/Hex.h>
+#include <AK/LexicalPath.h>
+#include <AK/QuickSort.h>
+#include <LibCore/Directory.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <LibCrypto/Hash/SHA2.h>
+#include <LibFileSystem/FileSystem.h>
+#include <LibGfx/Font/DecodedFontCache.h>
+#include <LibGfx/Font/Typeface.h>
+
+namespace Gfx {
+
+// Bump this whenever the decoders start producing different output for the same input.
+static constexpr u32 decoded_font_cache_version = 1;
+
+// Decoded fonts are evicted oldest first once they take up more than this.
+static constexpr u64 decoded_font_cache_size_limit = 64 * MiB;
+
+static Optional<ByteString> s_directory;
+static Atomic<u64> s_next_temporary_file_id { 0 };
+
+ByteString DecodedFontCache::directory_for_cache_path(StringView cache_path)
+{
+    return LexicalPath::join(cache_path, "decoded-fonts"sv).string();
+}
+
+void DecodedFontCache::initialize(ByteString directory)
+{
+    if (auto result = Core::Directory::create(directory, Core::Directory::CreateDirectories::Yes); result.is_error()) {
+        dbgln("Unable to create the decoded font cache at {}: {}", directory, result.error());
+        return;
+    }
+    s_directory = move(directory);
+}
+
+static void evict_old_entries(StringView directory, StringView path_to_keep)
+{
+    struct Entry {
+        ByteString path;
+        time_t modified_time { 0 };
+        u64 size { 0 };
+    };
+    Vector<Entry> entries;
+    u64 total_size = 0;
+
+    (void)Core::Directory::for_each_entry(directory, Core::DirIterator::SkipDots, [&](auto const& entry, auto const&) -> ErrorOr<IterationDecision> {
+        if (entry.type != Core::DirectoryEntry::Type::File || !entry.name.ends_with(".ttf"sv))
+            return IterationDecision::Continue;
+
+        auto path = LexicalPath::join(directory, entry.name).string();
+        auto stat = TRY(Core::File::stat(path));
+        total_size += stat.st_size;
+        TRY(entries.try_append({ move(path), stat.st_mtime, static_cast<u64>(stat.st_size) }));
+        return IterationDecision::Continue;
+    });
+
+    if (total_size <= decoded_font_cache_size_limit)
+        return;
+
+    quick_sort(entries, [](auto const& a, auto const& b) { return a.modified_time < b.modified_time; });
+
+    // Processes that still have an evicted font mapped keep using their mapping; only new lookups will miss.
+    for (auto const& entry : entries) {
+        if (total_size <= decoded_font_cache_size_limit)
+            break;
+        if (entry.path == path_to_keep)
+            continue;
+        if (!FileSystem::remove(entry.path, FileSystem::RecursionMode::Disallowed).is_error())
+            total_size -= entry.size;
+    }
+}
+
+static ErrorOr<NonnullRefPtr<Core::Resource const>> store(StringView directory, StringView path, ReadonlyBytes decoded_data)
+{
+    // Other threads and processes may be storing the same font at the same time, so each of them writes a file of its
+    // own and then atomically moves it into place. Readers will only ever see complete files.
+    auto temporary_path = ByteString::formatted("{}.{}.{}.tmp", path, Core::System::getpid(), s_next_temporary_file_id++);
+
+    auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+    if (auto result = file->write_until_depleted(decoded_data); result.is_error()) {
+        (void)FileSystem::remove(temporary_path, FileSystem::RecursionMode::Disallowed);
+        return result.release_error();
+    }
+    file->close();
+
+    if (auto result = FileSystem::move_file(path, temporary_path); result.is_error()) {
+        (void)FileSystem::remove(temporary_path, FileSystem::RecursionMode::Disallowed);
+        return result.release_error();
+    }
+
+    evict_old_entries(directory, path);
+    return TRY(Core::Resource::load_from_filesystem(path));
+}
+
+ErrorOr<DecodedFontData> DecodedFontCache::find_or_decode(ReadonlyBytes compressed_data, Decoder const& decode)
+{
+    if (!s_directory.has_value())
+        return DecodedFontData { TRY(decode(compressed_data)) };
+
+    auto digest = Crypto::Hash::SHA256::hash(compressed_data.data(), compressed_data.size());
+    auto file_name = ByteString::formatted("{}-{}.ttf", decoded_font_cache_version, encode_hex(digest.bytes()));
+    auto path = LexicalPath::join(*s_directory, file_name).string();
+
+    if (auto resource = Core::Resource::load_from_filesystem(path); !resource.is_error())
+        return DecodedFontData { NonnullRefPtr<Core::Resource const> { resource.release_value() } };
+
+    auto decoded_data = TRY(decode(compressed_data));
+    if (auto resource = store(*s_directory, path, decoded_data.bytes()); !resource.is_error())
+        return DecodedFontData { resource.release_value() };
+    return DecodedFontData { move(decoded_data) };
+}
+
+ErrorOr<NonnullRefPtr<Typeface>> DecodedFontCache::load_typeface(DecodedFontData const& data)
+{
+    return data.visit(
+        [](Core::AnonymousBuffer const& buffer) { return Typeface::try_load_from_anonymous_buffer(buffer); },
+        [](NonnullRefPtr<Core::Resource const> const& resource) { return Typeface::try_load_from_resource(*resource); });
+}
+
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/Function.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Variant.h>
+#include <LibCore/AnonymousBuffer.h>
+#include <LibCore/Resource.h>
+#include <LibGfx/Forward.h>
+
+namespace Gfx {
+
+// Font data decoded from a compressed web font. It is either mapped from the decoded font cache, and thereby shared
+// with every other process that loads the same font, or private to this process.
+using DecodedFontData = Variant<Core::AnonymousBuffer, NonnullRefPtr<Core::Resource const>>;
+
+// Keeps the decoded data of compressed web fonts on disk, named after a hash of the compressed data, so that processes
+// loading the same font map one read-only copy of it instead of each decoding a copy of their own.
+class DecodedFontCache {
+public:
+    static ByteString directory_for_cache_path(StringView cache_path);
+
+    // Must be called before any font is decoded. Until then, every process decodes fonts into memory of its own.
+    static void initialize(ByteString directory);
+
+    using Decoder = Function<ErrorOr<Core::AnonymousBuffer>(ReadonlyBytes)>;
+
+    // Returns the stored decoded data for these compressed bytes, or decodes and stores them if no process has done so
+    // yet. May be called from any thread.
+    static ErrorOr<DecodedFontData> find_or_decode(ReadonlyBytes compressed_data, Decoder const&);
+
+    static ErrorOr<NonnullRefPtr<Typeface>> load_typeface(DecodedFontData const&);
+};
+
+}
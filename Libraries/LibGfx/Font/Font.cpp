@@ -7,6 +7,7 @@
  */
 
 #include <AK/Atomic.h>
+#include <AK/HashFunctions.h>
 #include <AK/NumericLimits.h>
 #include <AK/TypeCasts.h>
 #include <AK/Utf16String.h>
@@ -188,15 +189,106 @@ SkFont Font::skia_font(float scale) const
     return sk_font;
 }
 
-Font::ShapingCache::~ShapingCache() = default;
+Font::ShapingCache::Statistics Font::ShapingCache::s_statistics;
+Atomic<u64> Font::ShapingCache::s_purge_generation { 0 };
+
+static constexpr size_t max_shaping_cache_generation_size_in_bytes = 256 * KiB;
+
+// NB: This is an estimate; it ignores hash table overhead and allocator slack.
+static size_t shaping_cache_entry_size_in_bytes(ShapingCacheKey const& key, ShapedGlyphs const& shape)
+{
+    return sizeof(ShapingCacheKey) + key.text.length_in_code_units() * sizeof(char16_t)
+        + sizeof(ShapedGlyphs) + shape.glyphs.size() * sizeof(DrawGlyph);
+}
+
+Font::ShapingCache::~ShapingCache()
+{
+    release_bytes(size_in_bytes + previous_generation_size_in_bytes);
+}
+
+void Font::ShapingCache::release_bytes(size_t bytes)
+{
+    VERIFY(s_statistics.size_in_bytes >= bytes);
+    s_statistics.size_in_bytes -= bytes;
+}
 
 void Font::ShapingCache::clear()
 {
+    release_bytes(size_in_bytes + previous_generation_size_in_bytes);
     map.clear();
+    previous_generation_map.clear();
+    size_in_bytes = 0;
+    previous_generation_size_in_bytes = 0;
     for (auto& slot : single_ascii_character_map)
         slot = nullptr;
 }
 
+void Font::ShapingCache::purge_all()
+{
+    s_purge_generation.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+}
+
+void Font::ShapingCache::clear_if_purged()
+{
+    auto current_purge_generation = s_purge_generation.load(AK::MemoryOrder::memory_order_relaxed);
+    if (purge_generation == current_purge_generation)
+        return;
+    clear();
+    purge_generation = current_purge_generation;
+}
+
+ShapedGlyphs const* Font::ShapingCache::find(Utf16View const& text, u8 text_type, u32 letter_spacing_bit_pattern)
+{
+    auto key_hash = pair_int_hash(text.hash(), pair_int_hash(text_type, letter_spacing_bit_pattern));
+    auto matches = [&](auto const& candidate) {
+        return candidate.key.text_type == text_type
+            && candidate.key.letter_spacing_bit_pattern == letter_spacing_bit_pattern
+            && candidate.key.text == text;
+    };
+
+    if (auto it = map.find(key_hash, matches); it != map.end()) {
+        ++s_statistics.hits;
+        return it->value.ptr();
+    }
+
+    if (auto it = previous_generation_map.find(key_hash, matches); it != previous_generation_map.end()) {
+        ++s_statistics.hits;
+        auto key = it->key;
+        auto shape = it->value.release_nonnull();
+        previous_generation_map.remove(it);
+        auto entry_size = shaping_cache_entry_size_in_bytes(key, *shape);
+        previous_generation_size_in_bytes -= entry_size;
+        release_bytes(entry_size);
+        return &insert(move(key), move(shape));
+    }
+
+    ++s_statistics.misses;
+    return nullptr;
+}
+
+ShapedGlyphs const& Font::ShapingCache::insert(ShapingCacheKey key, NonnullOwnPtr<ShapedGlyphs> shape)
+{
+    auto entry_size = shaping_cache_entry_size_in_bytes(key, *shape);
+    if (!map.is_empty() && size_in_bytes + entry_size > max_shaping_cache_generation_size_in_bytes) {
+        release_bytes(previous_generation_size_in_bytes);
+        previous_generation_map = move(map);
+        previous_generation_size_in_bytes = exchange(size_in_bytes, 0);
+        map.clear();
+    }
+
+    size_in_bytes += entry_size;
+    s_statistics.size_in_bytes += entry_size;
+    auto const& stored_shape = *shape;
+    map.set(move(key), move(shape));
+    return stored_shape;
+}
+
+Font::ShapingCache& Font::shaping_cache() const
+{
+    m_shaping_cache.clear_if_purged();
+    return m_shaping_cache;
+}
+
 static bool hb_face_has_table(hb_face_t* face, hb_tag_t tag)
 {
     hb_blob_t* blob = hb_face_reference_table(face, tag);
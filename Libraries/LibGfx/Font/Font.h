@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/AtomicRefCounted.h>
 #include <AK/FlyString.h>
 #include <AK/HashMap.h>
@@ -105,14 +106,43 @@ public:
     FontVariationSettings const& variation_settings() const { return m_font_variation_settings; }
     ShapeFeatures const& features() const { return m_shape_features; }
 
+    // Shapes are kept in two generations to bound the cache. A lookup that hits the previous generation promotes
+    // the shape, and once the current generation outgrows its budget it replaces the previous one, dropping every
+    // shape that went unused for a whole generation.
     struct ShapingCache {
         HashMap<ShapingCacheKey, OwnPtr<ShapedGlyphs>> map;
+        HashMap<ShapingCacheKey, OwnPtr<ShapedGlyphs>> previous_generation_map;
+        size_t size_in_bytes { 0 };
+        size_t previous_generation_size_in_bytes { 0 };
         OwnPtr<ShapedGlyphs> single_ascii_character_map[128];
+        u64 purge_generation { s_purge_generation.load(AK::MemoryOrder::memory_order_relaxed) };
 
         ~ShapingCache();
         void clear();
+
+        // Makes the shaping caches of all fonts drop their shapes. Fonts may be in use on other threads, so each
+        // cache is cleared the next time its font is used, by the thread using it.
+        static void purge_all();
+        void clear_if_purged();
+
+        ShapedGlyphs const* find(Utf16View const& text, u8 text_type, u32 letter_spacing_bit_pattern);
+        ShapedGlyphs const& insert(ShapingCacheKey, NonnullOwnPtr<ShapedGlyphs>);
+
+        // Process-wide totals over the shaping caches of all fonts.
+        struct Statistics {
+            u64 hits { 0 };
+            u64 misses { 0 };
+            u64 size_in_bytes { 0 };
+        };
+        static Statistics const& statistics() { return s_statistics; }
+
+    private:
+        void release_bytes(size_t);
+
+        static Statistics s_statistics;
+        static Atomic<u64> s_purge_generation;
     };
-    ShapingCache& shaping_cache() const { return m_shaping_cache; }
+    ShapingCache& shaping_cache() const;
 
     bool is_emoji_font() const;
 
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/LexicalPath.h>
+#include <AK/MemoryStream.h>
+#include <LibCore/Directory.h>
+#include <LibCore/File.h>
+#include <LibCore/MappedFile.h>
+#include <LibCore/StandardPaths.h>
+#include <LibCore/System.h>
+#include <LibFileSystem/FileSystem.h>
+#include <LibGfx/Font/FontIndex.h>
+
+namespace Gfx {
+
+static constexpr u32 font_index_magic = 0x4958444c; // "LDXI"
+static constexpr u32 font_index_version = 1;
+
+// Guards against reading absurd lengths out of a truncated or corrupted index.
+static constexpr u32 maximum_string_length = 64 * KiB;
+
+ByteString FontIndex::default_path()
+{
+    return LexicalPath::join(Core::StandardPaths::cache_directory(), "Ladybird"sv, "font-index"sv).string();
+}
+
+static ErrorOr<String> read_string(Stream& stream)
+{
+    auto length = TRY(stream.read_value<u32>());
+    if (length > maximum_string_length)
+        return Error::from_string_literal("Font index contains an invalid string length");
+    auto bytes = TRY(ByteBuffer::create_uninitialized(length));
+    TRY(stream.read_until_filled(bytes));
+    return String::from_utf8(bytes);
+}
+
+static ErrorOr<void> write_string(Stream& stream, StringView string)
+{
+    TRY(stream.write_value(static_cast<u32>(string.length())));
+    TRY(stream.write_until_depleted(string.bytes()));
+    return {};
+}
+
+ErrorOr<FontIndex> FontIndex::load_from_file(StringView path)
+{
+    auto file = TRY(Core::MappedFile::map(path));
+    FixedMemoryStream stream { file->bytes() };
+
+    if (TRY(stream.read_value<u32>()) != font_index_magic)
+        return Error::from_string_literal("Font index has an invalid magic number");
+    if (TRY(stream.read_value<u32>()) != font_index_version)
+        return Error::from_string_literal("Font index has an unsupported version");
+
+    FontIndex index;
+    auto file_count = TRY(stream.read_value<u32>());
+    for (u32 i = 0; i < file_count; ++i) {
+        auto file_path = TRY(read_string(stream));
+
+        FontIndexFile entry;
+        entry.modified_time = TRY(stream.read_value<i64>());
+        entry.size = TRY(stream.read_value<u64>());
+
+        auto face_count = TRY(stream.read_value<u32>());
+        for (u32 j = 0; j < face_count; ++j) {
+            FontIndexFace face;
+            face.ttc_index = TRY(stream.read_value<u32>());
+            face.family = TRY(read_string(stream));
+            face.weight = TRY(stream.read_value<u16>());
+            face.width = TRY(stream.read_value<u16>());
+            face.slope = TRY(stream.read_value<u8>());
+            TRY(entry.faces.try_append(move(face)));
+        }
+
+        TRY(index.m_files.try_set(move(file_path), move(entry)));
+    }
+
+    return index;
+}
+
+ErrorOr<void> FontIndex::save_to_file(StringView path) const
+{
+    AllocatingMemoryStream stream;
+    TRY(stream.write_value(font_index_magic));
+    TRY(stream.write_value(font_index_version));
+
+    TRY(stream.write_value(static_cast<u32>(m_files.size())));
+    for (auto const& [file_path, entry] : m_files) {
+        TRY(write_string(stream, file_path));
+        TRY(stream.write_value(entry.modified_time));
+        TRY(stream.write_value(entry.size));
+
+        TRY(stream.write_value(static_cast<u32>(entry.faces.size())));
+        for (auto const& face : entry.faces) {
+            TRY(stream.write_value(face.ttc_index));
+            TRY(write_string(stream, face.family));
+            TRY(stream.write_value(face.weight));
+            TRY(stream.write_value(face.width));
+            TRY(stream.write_value(face.slope));
+        }
+    }
+    auto bytes = TRY(stream.read_until_eof());
+
+    // Several processes may update the index at once, so each of them writes its own file and then atomically moves
+    // it into place. Readers will always see a complete index.
+    auto lexical_path = LexicalPath { path };
+    TRY(Core::Directory::create(lexical_path.parent(), Core::Directory::CreateDirectories::Yes));
+    auto temporary_path = ByteString::formatted("{}.{}.tmp", path, Core::System::getpid());
+
+    auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+    if (auto result = file->write_until_depleted(bytes); result.is_error()) {
+        (void)FileSystem::remove(temporary_path, FileSystem::RecursionMode::Disallowed);
+        return result.release_error();
+    }
+    file->close();
+
+    TRY(FileSystem::move_file(path, temporary_path));
+    return {};
+}
+
+FontIndexFile const* FontIndex::find(String const& path, i64 modified_time, u64 size) const
+{
+    auto it = m_files.find(path);
+    if (it == m_files.end())
+        return nullptr;
+    if (it->value.modified_time != modified_time || it->value.size != size)
+        return nullptr;
+    return &it->value;
+}
+
+void FontIndex::set(String path, FontIndexFile entry)
+{
+    m_files.set(move(path), move(entry));
+    m_has_unsaved_changes = true;
+}
+
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/FlyString.h>
+#include <AK/HashMap.h>
+#include <AK/String.h>
+#include <AK/Vector.h>
+
+namespace Gfx {
+
+struct FontIndexFace {
+    u32 ttc_index { 0 };
+    FlyString family;
+    u16 weight { 0 };
+    u16 width { 0 };
+    u8 slope { 0 };
+};
+
+struct FontIndexFile {
+    i64 modified_time { 0 };
+    u64 size { 0 };
+
+    // Empty for files that turned out not to contain any usable font, so that they aren't parsed again either.
+    Vector<FontIndexFace> faces;
+};
+
+// Remembers which typefaces each font file on disk contains, so that processes starting up can skip parsing the font
+// files that haven't changed since they were indexed, and only load a typeface once its family is actually used.
+class FontIndex {
+public:
+    static ByteString default_path();
+
+    FontIndex() = default;
+
+    static ErrorOr<FontIndex> load_from_file(StringView path);
+    ErrorOr<void> save_to_file(StringView path) const;
+
+    // Returns the entry for the file at this path, provided the file has not changed since it was indexed.
+    FontIndexFile const* find(String const& path, i64 modified_time, u64 size) const;
+    void set(String path, FontIndexFile);
+
+    bool has_unsaved_changes() const { return m_has_unsaved_changes; }
+    void did_save() { m_has_unsaved_changes = false; }
+
+private:
+    HashMap<String, FontIndexFile> m_files;
+    bool m_has_unsaved_changes { false };
+};
+
+}
@@ -51,6 +51,13 @@ void PathFontProvider::load_all_fonts_from_uri(StringView uri)
     }
     auto root = root_or_error.release_value();
 
+    if (!m_font_index.has_value()) {
+        auto font_index_or_error = FontIndex::load_from_file(FontIndex::default_path());
+        if (font_index_or_error.is_error() && !(font_index_or_error.error().is_errno() && font_index_or_error.error().code() == ENOENT))
+            dbgln("PathFontProvider: Unable to load the font index: {}", font_index_or_error.error());
+        m_font_index = font_index_or_error.is_error() ? FontIndex {} : font_index_or_error.release_value();
+    }
+
     root->for_each_descendant_file([this](Core::Resource const& resource) -> IterationDecision {
         auto uri = resource.uri();
         auto path = LexicalPath(uri.bytes_as_string_view());
@@ -59,31 +66,92 @@ void PathFontProvider::load_all_fonts_from_uri(StringView uri)
         if (!is_truetype && !is_woff)
             return IterationDecision::Continue;
 
-        if (m_loaded_paths.set(resource.filesystem_path(), AK::HashSetExistingEntryBehavior::Keep) != AK::HashSetResult::InsertedNewEntry)
+        auto filesystem_path = resource.filesystem_path();
+        if (m_loaded_paths.set(filesystem_path, AK::HashSetExistingEntryBehavior::Keep) != AK::HashSetResult::InsertedNewEntry)
             return IterationDecision::Continue;
 
-        if (is_truetype) {
-            auto font_count = number_of_fonts_in_ttc(resource.data());
-            for (u32 ttc_index = 0; ttc_index < font_count; ++ttc_index) {
-                if (auto font_or_error = Typeface::try_load_from_resource(resource, ttc_index); !font_or_error.is_error()) {
-                    auto font = font_or_error.release_value();
-                    auto& family = m_typeface_by_family.ensure(font->family(), [] {
-                        return Vector<NonnullRefPtr<Typeface>> {};
-                    });
-                    family.append(font);
-                }
-            }
-        } else {
-            if (auto font_or_error = WOFF::try_load_from_resource(resource); !font_or_error.is_error()) {
-                auto font = font_or_error.release_value();
-                auto& family = m_typeface_by_family.ensure(font->family(), [] {
-                    return Vector<NonnullRefPtr<Typeface>> {};
-                });
-                family.append(font);
-            }
+        auto modified_time = resource.modified_time();
+        if (filesystem_path.is_empty() || !modified_time.has_value()) {
+            (void)load_typefaces_from_resource(resource, is_woff);
+            return IterationDecision::Continue;
         }
+
+        if (auto const* indexed_file = m_font_index->find(filesystem_path, *modified_time, resource.data().size())) {
+            add_unloaded_typefaces(resource, *indexed_file);
+            return IterationDecision::Continue;
+        }
+
+        auto faces = load_typefaces_from_resource(resource, is_woff);
+        FontIndexFile indexed_file { .modified_time = *modified_time, .size = resource.data().size(), .faces = move(faces) };
+        m_font_index->set(move(filesystem_path), move(indexed_file));
         return IterationDecision::Continue;
     });
+
+    save_font_index_if_needed();
+}
+
+Vector<FontIndexFace> PathFontProvider::load_typefaces_from_resource(Core::Resource const& resource, bool is_woff)
+{
+    Vector<FontIndexFace> faces;
+    auto add_typeface = [&](NonnullRefPtr<Typeface> typeface, u32 ttc_index) {
+        faces.append({ ttc_index, typeface->family(), typeface->weight(), typeface->width(), typeface->slope() });
+        m_typeface_by_family.ensure(typeface->family()).append(move(typeface));
+    };
+
+    if (is_woff) {
+        if (auto font_or_error = WOFF::try_load_from_resource(resource); !font_or_error.is_error())
+            add_typeface(font_or_error.release_value(), 0);
+        return faces;
+    }
+
+    auto font_count = number_of_fonts_in_ttc(resource.data());
+    for (u32 ttc_index = 0; ttc_index < font_count; ++ttc_index) {
+        if (auto font_or_error = Typeface::try_load_from_resource(resource, ttc_index); !font_or_error.is_error())
+            add_typeface(font_or_error.release_value(), ttc_index);
+    }
+    return faces;
+}
+
+void PathFontProvider::add_unloaded_typefaces(Core::Resource const& resource, FontIndexFile const& indexed_file)
+{
+    for (auto const& face : indexed_file.faces) {
+        // Keep the family known even before it is loaded, so that lookups know to load it.
+        m_typeface_by_family.ensure(face.family);
+        m_unloaded_typefaces_by_family.ensure(face.family).append({ resource, face.ttc_index });
+    }
+}
+
+void PathFontProvider::load_family_if_needed(FlyString const& family)
+{
+    auto it = m_unloaded_typefaces_by_family.find(family);
+    if (it == m_unloaded_typefaces_by_family.end())
+        return;
+    auto unloaded_typefaces = move(it->value);
+    m_unloaded_typefaces_by_family.remove(it);
+
+    for (auto const& unloaded_typeface : unloaded_typefaces) {
+        auto is_woff = LexicalPath { unloaded_typeface.resource->uri().bytes_as_string_view() }.has_extension(".woff"sv);
+        auto typeface_or_error = is_woff
+            ? WOFF::try_load_from_resource(*unloaded_typeface.resource, unloaded_typeface.ttc_index)
+            : Typeface::try_load_from_resource(*unloaded_typeface.resource, unloaded_typeface.ttc_index);
+        if (typeface_or_error.is_error()) {
+            dbgln("PathFontProvider: Unable to load indexed typeface from '{}': {}", unloaded_typeface.resource->filesystem_path(), typeface_or_error.error());
+            continue;
+        }
+        auto typeface = typeface_or_error.release_value();
+        m_typeface_by_family.ensure(typeface->family()).append(move(typeface));
+    }
+}
+
+void PathFontProvider::save_font_index_if_needed()
+{
+    if (!m_font_index.has_value() || !m_font_index->has_unsaved_changes())
+        return;
+
+    // Sandboxed processes may not be allowed to write the index, in which case they leave that to another process.
+    if (m_font_index->save_to_file(FontIndex::default_path()).is_error())
+        return;
+    m_font_index->did_save();
 }
 
 RefPtr<Gfx::Font> PathFontProvider::get_font(FlyString const& family, float point_size, unsigned weight, unsigned width, unsigned slope, Optional<FontVariationSettings> const& font_variation_settings, Optional<Gfx::ShapeFeatures> const& shape_features)
@@ -138,6 +206,8 @@ RefPtr<Gfx::Font> PathFontProvider::get_font(FlyString const& family, float poin
         return shape_features;
     };
 
+    load_family_if_needed(family);
+
     auto it = m_typeface_by_family.find(family);
     if (it == m_typeface_by_family.end())
         return nullptr;
@@ -151,6 +221,8 @@ RefPtr<Gfx::Font> PathFontProvider::get_font(FlyString const& family, float poin
 
 void PathFontProvider::for_each_typeface_with_family_name(FlyString const& family_name, Function<void(Typeface const&)> callback)
 {
+    load_family_if_needed(family_name);
+
     auto it = m_typeface_by_family.find(family_name);
     if (it == m_typeface_by_family.end())
         return;
@@ -10,7 +10,9 @@
 #include <AK/Function.h>
 #include <AK/HashMap.h>
 #include <AK/HashTable.h>
+#include <LibCore/Resource.h>
 #include <LibGfx/Font/FontDatabase.h>
+#include <LibGfx/Font/FontIndex.h>
 #include <LibGfx/Font/Typeface.h>
 
 namespace Gfx {
@@ -32,8 +34,24 @@ public:
     virtual StringView name() const LIFETIME_BOUND override { return m_name.bytes_as_string_view(); }
 
 private:
+    struct UnloadedTypeface {
+        NonnullRefPtr<Core::Resource const> resource;
+        u32 ttc_index { 0 };
+    };
+
+    Vector<FontIndexFace> load_typefaces_from_resource(Core::Resource const&, bool is_woff);
+    void add_unloaded_typefaces(Core::Resource const&, FontIndexFile const&);
+    void load_family_if_needed(FlyString const& family);
+    void save_font_index_if_needed();
+
     HashMap<FlyString, Vector<NonnullRefPtr<Typeface>>, AK::ASCIICaseInsensitiveFlyStringTraits> m_typeface_by_family;
 
+    // Typefaces that are known from the font index to belong to a family, but which haven't been parsed yet because
+    // nothing has asked for that family.
+    HashMap<FlyString, Vector<UnloadedTypeface>, AK::ASCIICaseInsensitiveFlyStringTraits> m_unloaded_typefaces_by_family;
+
+    Optional<FontIndex> m_font_index;
+
     // Tracks files we've already loaded, to avoid mmap'ing the same .ttf/.otf/.ttc
     // multiple times when overlapping font directories are walked (fontconfig commonly
     // returns nested entries like /usr/share/fonts and /usr/share/fonts/truetype).
@@ -101,14 +101,19 @@ Gfx::Font const& FontCascadeList::font_for_code_point(u32 code_point, TriggerPen
     }
 
     auto use_ascii_cache = code_point < m_ascii_cache.size() && emoji_presentation.presentation == EmojiPresentation::Text && emoji_presentation.forced == ForcedPresentation::No;
+    auto code_point_cache_key = (static_cast<u64>(code_point) << 2) | (to_underlying(emoji_presentation.presentation) << 1) | to_underlying(emoji_presentation.forced);
     if (use_ascii_cache) {
         if (auto const* cached = m_ascii_cache[code_point])
             return *cached;
+    } else if (auto cached = m_code_point_cache.get(code_point_cache_key); cached.has_value()) {
+        return **cached;
     }
 
     auto cache_and_return = [&](Font const& font) -> Font const& {
         if (use_ascii_cache)
             m_ascii_cache[code_point] = &font;
+        else
+            m_code_point_cache.set(code_point_cache_key, &font);
         return font;
     };
 
@@ -8,7 +8,9 @@
 
 #include <AK/Array.h>
 #include <AK/Function.h>
+#include <AK/HashMap.h>
 #include <AK/RefCounted.h>
+#include <AK/Utf16View.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/UnicodeRange.h>
 
@@ -71,6 +73,41 @@ public:
     };
     Gfx::Font const& font_for_code_point(u32 code_point, TriggerPendingLoads = TriggerPendingLoads::No, EmojiPresentationResult = {}) const;
 
+    // Splits the text into runs of consecutive code points that resolve to the same font, and invokes the callback
+    // with each run and its font in order.
+    template<typename Callback>
+    void for_each_font_run(Utf16View const& text, TriggerPendingLoads trigger_pending_loads, Callback callback) const
+    {
+        if (text.is_empty())
+            return;
+
+        auto it = text.begin();
+        auto run_start_offset = text.iterator_offset(it);
+        u32 previous_code_point = *it;
+        Font const* run_font = &font_for_code_point(previous_code_point, trigger_pending_loads);
+
+        for (++it; it != text.end(); ++it) {
+            auto code_point = *it;
+
+            // Runs of the same code point are common (e.g. spaces and punctuation), and resolve the same way.
+            if (code_point == previous_code_point)
+                continue;
+            previous_code_point = code_point;
+
+            auto const* font = &font_for_code_point(code_point, trigger_pending_loads);
+            if (font == run_font)
+                continue;
+
+            auto offset = text.iterator_offset(it);
+            callback(text.substring_view(run_start_offset, offset - run_start_offset), *run_font);
+            run_start_offset = offset;
+            run_font = font;
+        }
+
+        auto end_offset = text.iterator_offset(it);
+        callback(text.substring_view(run_start_offset, end_offset - run_start_offset), *run_font);
+    }
+
     bool equals(FontCascadeList const& other) const;
 
     struct Entry {
@@ -125,6 +162,12 @@ private:
     // OPTIMIZATION: Cache of resolved fonts for ASCII code points. Since m_fonts only grows and the cascade returns
     //               the first matching font, a cached hit can never become stale.
     mutable Array<Font const*, 128> m_ascii_cache {};
+
+    // OPTIMIZATION: Cache of resolved fonts for all other code points, keyed by the code point and the requested
+    //               presentation. CJK and emoji-heavy text would otherwise walk the cascade and ask the system for a
+    //               fallback font for every character. Code points that no font supports are cached as well, as
+    //               resolving to the last-resort font.
+    mutable HashMap<u64, Font const*> m_code_point_cache;
 };
 
 }
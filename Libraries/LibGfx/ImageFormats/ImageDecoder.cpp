@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Math.h>
+#include <LibGfx/Bitmap.h>
 #include <LibGfx/ImageFormats/AVIFLoader.h>
 #include <LibGfx/ImageFormats/BMPLoader.h>
 #include <LibGfx/ImageFormats/GIFLoader.h>
@@ -43,6 +45,38 @@ static ErrorOr<OwnPtr<ImageDecoderPlugin>> probe_and_sniff_for_appropriate_plugi
     return OwnPtr<ImageDecoderPlugin> {};
 }
 
+IntSize size_covering_ideal_size(IntSize natural_size, IntSize ideal_size)
+{
+    if (natural_size.is_empty() || ideal_size.is_empty())
+        return natural_size;
+
+    auto scale = max(static_cast<double>(ideal_size.width()) / natural_size.width(), static_cast<double>(ideal_size.height()) / natural_size.height());
+    if (scale >= 1)
+        return natural_size;
+
+    return {
+        clamp(static_cast<int>(AK::ceil(natural_size.width() * scale)), 1, natural_size.width()),
+        clamp(static_cast<int>(AK::ceil(natural_size.height() * scale)), 1, natural_size.height()),
+    };
+}
+
+ErrorOr<ImageFrameDescriptor> ImageDecoder::frame(size_t index, Optional<IntSize> ideal_size) const
+{
+    auto frame = TRY(m_plugin->frame(index, ideal_size));
+    if (!ideal_size.has_value())
+        return frame;
+
+    // Scaling only pays for itself if it saves a good chunk of memory, so leave frames that are already close to the
+    // ideal size alone. This also covers plugins that have done the scaling themselves.
+    auto bitmap_size = frame.image->size();
+    auto scaled_size = size_covering_ideal_size(bitmap_size, *ideal_size);
+    if (scaled_size.width() * 2 > bitmap_size.width() || scaled_size.height() * 2 > bitmap_size.height())
+        return frame;
+
+    frame.image = TRY(frame.image->scaled(scaled_size.width(), scaled_size.height(), ScalingMode::BilinearMipmap));
+    return frame;
+}
+
 ErrorOr<ColorSpace> ImageDecoder::color_space()
 {
     auto maybe_cicp = TRY(m_plugin->cicp());
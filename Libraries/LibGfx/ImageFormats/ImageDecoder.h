@@ -81,6 +81,8 @@ public:
     virtual size_t frame_count() { return 1; }
     virtual size_t first_animated_frame_index() { return 0; }
 
+    // If an ideal size is given, the plugin may return a smaller bitmap than the image's natural size, as long as it
+    // is at least as large as the ideal size in both dimensions. Plugins never scale a frame up.
     virtual ErrorOr<ImageFrameDescriptor> frame(size_t index, Optional<IntSize> ideal_size = {}) = 0;
 
     // Returns the duration of a frame in milliseconds without decoding pixel data.
@@ -104,6 +106,10 @@ protected:
     ImageDecoderPlugin() = default;
 };
 
+// Returns the smallest size that keeps the aspect ratio of natural_size and covers ideal_size in both dimensions, or
+// natural_size itself if that is smaller.
+IntSize size_covering_ideal_size(IntSize natural_size, IntSize ideal_size);
+
 class ImageDecoder : public RefCounted<ImageDecoder> {
 public:
     static ErrorOr<RefPtr<ImageDecoder>> try_create_for_raw_bytes(ReadonlyBytes, Optional<ByteString> mime_type = {});
@@ -117,7 +123,8 @@ public:
     size_t frame_count() const { return m_plugin->frame_count(); }
     size_t first_animated_frame_index() const { return m_plugin->first_animated_frame_index(); }
 
-    ErrorOr<ImageFrameDescriptor> frame(size_t index, Optional<IntSize> ideal_size = {}) const { return m_plugin->frame(index, ideal_size); }
+    // Frames from plugins that cannot decode to a smaller size themselves are scaled down to about the ideal size.
+    ErrorOr<ImageFrameDescriptor> frame(size_t index, Optional<IntSize> ideal_size = {}) const;
     int frame_duration(size_t index) const { return m_plugin->frame_duration(index); }
 
     Optional<Metadata const&> metadata() const { return m_plugin->metadata(); }
@@ -15,6 +15,7 @@ struct JPEGLoadingContext {
     enum class State {
         NotDecoded,
         Error,
+        HeaderDecoded,
         Decoded,
     };
 
@@ -24,33 +25,30 @@ struct JPEGLoadingContext {
     RefPtr<Gfx::CMYKBitmap> cmyk_bitmap;
 
     ReadonlyBytes data;
+    IntSize size;
+    bool is_cmyk { false };
     Vector<u8> icc_data;
 
+    // The denominator the bitmaps above were scaled down by while decoding.
+    unsigned scale_denominator { 1 };
+
     JPEGLoadingContext(ReadonlyBytes data)
         : data(data)
     {
     }
 
-    ErrorOr<void> decode();
+    ErrorOr<void> decode_header();
+    ErrorOr<void> decode(unsigned scale_denominator);
 };
 
 struct JPEGErrorManager : jpeg_error_mgr {
     jmp_buf setjmp_buffer {};
 };
 
-ErrorOr<void> JPEGLoadingContext::decode()
+// The caller must have set up jerr.setjmp_buffer before calling this, as libjpeg reports errors by calling error_exit.
+static void create_decompress_for_data(jpeg_decompress_struct& cinfo, JPEGErrorManager& jerr, jpeg_source_mgr& source_manager, ReadonlyBytes data)
 {
-    struct jpeg_decompress_struct cinfo;
-    ScopeGuard guard { [&]() { jpeg_destroy_decompress(&cinfo); } };
-
-    struct JPEGErrorManager jerr;
     cinfo.err = jpeg_std_error(&jerr);
-
-    jpeg_source_mgr source_manager {};
-
-    if (setjmp(jerr.setjmp_buffer))
-        return Error::from_string_literal("Failed to decode JPEG");
-
     jerr.error_exit = [](j_common_ptr cinfo) {
         char buffer[JMSG_LENGTH_MAX];
         (*cinfo->err->format_message)(cinfo, buffer);
@@ -76,11 +74,66 @@ ErrorOr<void> JPEGLoadingContext::decode()
     source_manager.term_source = [](j_decompress_ptr) { };
 
     cinfo.src = &source_manager;
+}
+
+// Reads only the markers in front of the first scan, so that the size and color profile are known without decoding
+// any pixels.
+ErrorOr<void> JPEGLoadingContext::decode_header()
+{
+    struct jpeg_decompress_struct cinfo;
+    ScopeGuard guard { [&]() { jpeg_destroy_decompress(&cinfo); } };
+
+    struct JPEGErrorManager jerr;
+    jpeg_source_mgr source_manager {};
+
+    if (setjmp(jerr.setjmp_buffer))
+        return Error::from_string_literal("Failed to decode JPEG header");
+
+    create_decompress_for_data(cinfo, jerr, source_manager, data);
 
     jpeg_save_markers(&cinfo, JPEG_APP0 + 2, 0xFFFF);
     if (jpeg_read_header(&cinfo, TRUE) != JPEG_HEADER_OK)
         return Error::from_string_literal("Failed to read JPEG header");
 
+    size = { static_cast<int>(cinfo.image_width), static_cast<int>(cinfo.image_height) };
+    is_cmyk = cinfo.jpeg_color_space == JCS_CMYK || cinfo.jpeg_color_space == JCS_YCCK;
+
+    JOCTET* icc_data_ptr = nullptr;
+    unsigned int icc_data_length = 0;
+    if (jpeg_read_icc_profile(&cinfo, &icc_data_ptr, &icc_data_length)) {
+        icc_data.resize(icc_data_length);
+        memcpy(icc_data.data(), icc_data_ptr, icc_data_length);
+        free(icc_data_ptr);
+    }
+
+    return {};
+}
+
+ErrorOr<void> JPEGLoadingContext::decode(unsigned requested_scale_denominator)
+{
+    struct jpeg_decompress_struct cinfo;
+    ScopeGuard guard { [&]() { jpeg_destroy_decompress(&cinfo); } };
+
+    struct JPEGErrorManager jerr;
+    jpeg_source_mgr source_manager {};
+
+    rgb_bitmap = nullptr;
+    cmyk_bitmap = nullptr;
+
+    if (setjmp(jerr.setjmp_buffer))
+        return Error::from_string_literal("Failed to decode JPEG");
+
+    create_decompress_for_data(cinfo, jerr, source_manager, data);
+
+    if (jpeg_read_header(&cinfo, TRUE) != JPEG_HEADER_OK)
+        return Error::from_string_literal("Failed to read JPEG header");
+
+    // libjpeg can scale the image down by 1/2, 1/4 or 1/8 as part of the inverse DCT, which is considerably cheaper
+    // than decoding at full size, both in time and memory.
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = requested_scale_denominator;
+    scale_denominator = requested_scale_denominator;
+
     if (cinfo.jpeg_color_space == JCS_CMYK) {
         cinfo.out_color_space = JCS_CMYK;
     } else if (cinfo.jpeg_color_space == JCS_YCCK) {
@@ -89,7 +142,31 @@ ErrorOr<void> JPEGLoadingContext::decode()
         cinfo.out_color_space = JCS_EXT_BGRX;
     }
 
-    jpeg_start_decompress(&cinfo);
+    // Progressive images are decoded in buffered-image mode, which lets us show the scans that have arrived so far
+    // when the data is incomplete, e.g. while the image is still being downloaded.
+    bool const is_progressive = jpeg_has_multiple_scans(&cinfo);
+    if (is_progressive)
+        cinfo.buffered_image = TRUE;
+
+    if (!jpeg_start_decompress(&cinfo))
+        return Error::from_string_literal("Not enough data to start decoding JPEG");
+
+    bool reached_end_of_image = true;
+    if (is_progressive) {
+        int status = JPEG_SUSPENDED;
+        do {
+            status = jpeg_consume_input(&cinfo);
+        } while (status != JPEG_SUSPENDED && status != JPEG_REACHED_EOI);
+        reached_end_of_image = status == JPEG_REACHED_EOI;
+
+        // Output the last scan that arrived in full. Asking for the scan that is still incomplete would make the
+        // decoder wait for its remaining data, and leave the rows it has not reached yet empty.
+        auto scan_to_output = cinfo.input_scan_number;
+        if (!reached_end_of_image && scan_to_output > 1)
+            --scan_to_output;
+        jpeg_start_output(&cinfo, scan_to_output);
+    }
+
     bool could_read_all_scanlines = true;
 
     if (cinfo.out_color_space == JCS_EXT_BGRX) {
@@ -117,69 +194,25 @@ ErrorOr<void> JPEGLoadingContext::decode()
 
         // If image is in YCCK color space, we convert it to CMYK
         // and then CMYK code path will handle the rest
-        if (cinfo.out_color_space == JCS_YCCK) {
-            for (int i = 0; i < cmyk_bitmap->size().height(); ++i) {
-                for (int j = 0; j < cmyk_bitmap->size().width(); ++j) {
-                    auto const& cmyk = cmyk_bitmap->scanline(i)[j];
-
-                    auto y = cmyk.c;
-                    auto cb = cmyk.m;
-                    auto cr = cmyk.y;
-                    auto k = cmyk.k;
-
-                    int r = y + 1.402f * (cr - 128);
-                    int g = y - 0.3441f * (cb - 128) - 0.7141f * (cr - 128);
-                    int b = y + 1.772f * (cb - 128);
-
-                    y = clamp(r, 0, 255);
-                    cb = clamp(g, 0, 255);
-                    cr = clamp(b, 0, 255);
-                    k = 255 - k;
-
-                    cmyk_bitmap->scanline(i)[j] = {
-                        y,
-                        cb,
-                        cr,
-                        k,
-                    };
-                }
-            }
-        }
+        if (cinfo.out_color_space == JCS_YCCK)
+            cmyk_bitmap->convert_from_ycck();
 
         // Photoshop writes inverted CMYK data (i.e. Photoshop's 0 should be 255). We convert this
         // to expected values.
         bool should_invert_cmyk = cinfo.jpeg_color_space == JCS_CMYK
             && (!cinfo.saw_Adobe_marker || cinfo.Adobe_transform == 0);
 
-        if (should_invert_cmyk) {
-            for (int i = 0; i < cmyk_bitmap->size().height(); ++i) {
-                auto* line = cmyk_bitmap->scanline(i);
-
-                for (int j = 0; j < cmyk_bitmap->size().width(); ++j) {
-                    auto const& cmyk = line[j];
-                    line[j] = {
-                        static_cast<u8>(255 - cmyk.c),
-                        static_cast<u8>(255 - cmyk.m),
-                        static_cast<u8>(255 - cmyk.y),
-                        static_cast<u8>(255 - cmyk.k),
-                    };
-                }
-            }
-        }
+        if (should_invert_cmyk)
+            cmyk_bitmap->invert();
     }
 
-    JOCTET* icc_data_ptr = nullptr;
-    unsigned int icc_data_length = 0;
-    if (jpeg_read_icc_profile(&cinfo, &icc_data_ptr, &icc_data_length)) {
-        icc_data.resize(icc_data_length);
-        memcpy(icc_data.data(), icc_data_ptr, icc_data_length);
-        free(icc_data_ptr);
-    }
-
-    if (could_read_all_scanlines)
+    if (could_read_all_scanlines && reached_end_of_image) {
+        if (is_progressive)
+            jpeg_finish_output(&cinfo);
         jpeg_finish_decompress(&cinfo);
-    else
+    } else {
         jpeg_abort_decompress(&cinfo);
+    }
 
     if (cmyk_bitmap && !rgb_bitmap)
         rgb_bitmap = TRY(cmyk_bitmap->to_low_quality_rgb());
@@ -196,16 +229,7 @@ JPEGImageDecoderPlugin::~JPEGImageDecoderPlugin() = default;
 
 IntSize JPEGImageDecoderPlugin::size()
 {
-    if (m_context->state == JPEGLoadingContext::State::NotDecoded)
-        (void)frame(0);
-
-    if (m_context->state == JPEGLoadingContext::State::Error)
-        return {};
-    if (m_context->rgb_bitmap)
-        return m_context->rgb_bitmap->size();
-    if (m_context->cmyk_bitmap)
-        return m_context->cmyk_bitmap->size();
-    return {};
+    return m_context->size;
 }
 
 bool JPEGImageDecoderPlugin::sniff(ReadonlyBytes data)
@@ -218,10 +242,30 @@ bool JPEGImageDecoderPlugin::sniff(ReadonlyBytes data)
 
 ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> JPEGImageDecoderPlugin::create(ReadonlyBytes data)
 {
-    return adopt_own(*new JPEGImageDecoderPlugin(make<JPEGLoadingContext>(data)));
+    auto context = make<JPEGLoadingContext>(data);
+    if (context->decode_header().is_error())
+        context->state = JPEGLoadingContext::State::Error;
+    else
+        context->state = JPEGLoadingContext::State::HeaderDecoded;
+    return adopt_own(*new JPEGImageDecoderPlugin(move(context)));
 }
 
-ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Optional<IntSize>)
+// Picks the largest scale-down factor that libjpeg supports and that still yields at least the ideal size.
+static unsigned scale_denominator_for_ideal_size(IntSize natural_size, Optional<IntSize> ideal_size)
+{
+    if (!ideal_size.has_value() || ideal_size->is_empty())
+        return 1;
+
+    for (unsigned denominator : { 8u, 4u, 2u }) {
+        auto scaled_width = ceil_div(static_cast<unsigned>(natural_size.width()), denominator);
+        auto scaled_height = ceil_div(static_cast<unsigned>(natural_size.height()), denominator);
+        if (scaled_width >= static_cast<unsigned>(ideal_size->width()) && scaled_height >= static_cast<unsigned>(ideal_size->height()))
+            return denominator;
+    }
+    return 1;
+}
+
+ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Optional<IntSize> ideal_size)
 {
     if (index > 0)
         return Error::from_string_literal("JPEGImageDecoderPlugin: Invalid frame index");
@@ -229,8 +273,9 @@ ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Option
     if (m_context->state == JPEGLoadingContext::State::Error)
         return Error::from_string_literal("JPEGImageDecoderPlugin: Decoding failed");
 
-    if (m_context->state < JPEGLoadingContext::State::Decoded) {
-        if (auto result = m_context->decode(); result.is_error()) {
+    auto scale_denominator = scale_denominator_for_ideal_size(m_context->size, ideal_size);
+    if (m_context->state < JPEGLoadingContext::State::Decoded || m_context->scale_denominator != scale_denominator) {
+        if (auto result = m_context->decode(scale_denominator); result.is_error()) {
             m_context->state = JPEGLoadingContext::State::Error;
             return result.release_error();
         }
@@ -248,9 +293,6 @@ Optional<Metadata const&> JPEGImageDecoderPlugin::metadata()
 
 ErrorOr<Optional<ReadonlyBytes>> JPEGImageDecoderPlugin::icc_data()
 {
-    if (m_context->state == JPEGLoadingContext::State::NotDecoded)
-        (void)frame(0);
-
     if (!m_context->icc_data.is_empty())
         return m_context->icc_data;
     return OptionalNone {};
@@ -258,17 +300,14 @@ ErrorOr<Optional<ReadonlyBytes>> JPEGImageDecoderPlugin::icc_data()
 
 NaturalFrameFormat JPEGImageDecoderPlugin::natural_frame_format() const
 {
-    if (m_context->state == JPEGLoadingContext::State::NotDecoded)
-        (void)const_cast<JPEGImageDecoderPlugin&>(*this).frame(0);
-
-    if (m_context->cmyk_bitmap)
+    if (m_context->is_cmyk)
         return NaturalFrameFormat::CMYK;
     return NaturalFrameFormat::RGB;
 }
 
 ErrorOr<NonnullRefPtr<CMYKBitmap>> JPEGImageDecoderPlugin::cmyk_frame()
 {
-    if (m_context->state == JPEGLoadingContext::State::NotDecoded)
+    if (m_context->state < JPEGLoadingContext::State::Decoded)
         (void)frame(0);
 
     if (m_context->state == JPEGLoadingContext::State::Error)
@@ -51,15 +51,23 @@ struct PNGLoadingContext {
     }
 
     ErrorOr<size_t> read_frames(png_structp, png_infop);
+    ErrorOr<void> keep_partially_decoded_frame(NonnullRefPtr<Bitmap>);
     ErrorOr<void> apply_exif_orientation();
 
     ErrorOr<void> read_all_frames()
     {
         // NOTE: We need to setjmp() here because libpng uses longjmp() for error handling.
         if (auto error_value = setjmp(png_jmpbuf(png_ptr)); error_value) {
+            // A single-frame image that runs out of data, e.g. because it is still being downloaded, keeps the rows
+            // that were decoded so far.
+            auto partially_decoded_bitmap = frame_count == 0 ? move(in_flight_bitmap) : nullptr;
+
             // longjmp() bypassed the C++ destructors for any stack-locals in read_frames(); release the working-state
             // members explicitly here — so their heap storage doesn't sit around until ~PNGLoadingContext().
             clear_read_frames_working_state();
+
+            if (partially_decoded_bitmap)
+                return keep_partially_decoded_frame(partially_decoded_bitmap.release_nonnull());
             return Error::from_errno(error_value);
         }
 
@@ -247,6 +255,34 @@ ErrorOr<void> PNGImageDecoderPlugin::initialize()
     return {};
 }
 
+// The size of the block that each known pixel stands in for after a number of completed Adam7 passes.
+// https://www.w3.org/TR/png-3/#8Interlace
+static constexpr IntSize adam7_block_size_after_pass[] = { { 8, 8 }, { 4, 8 }, { 4, 4 }, { 2, 4 }, { 2, 2 }, { 1, 2 }, { 1, 1 } };
+
+ErrorOr<void> PNGLoadingContext::keep_partially_decoded_frame(NonnullRefPtr<Bitmap> bitmap)
+{
+    // An interlaced image that stopped partway through has its pixels spread over a sparse grid, so replicate each
+    // of them over the block it stands in for until a later pass fills in the rest.
+    if (png_get_interlace_type(png_ptr, info_ptr) == PNG_INTERLACE_ADAM7) {
+        auto completed_passes = clamp<int>(png_get_current_pass_number(png_ptr), 1, 7);
+        auto block_size = adam7_block_size_after_pass[completed_passes - 1];
+        for (int y = 0; y < bitmap->height(); ++y) {
+            auto const* source_row = bitmap->scanline(y - (y % block_size.height()));
+            auto* row = bitmap->scanline(y);
+            for (int x = 0; x < bitmap->width(); ++x)
+                row[x] = source_row[x - (x % block_size.width())];
+        }
+    }
+
+    frame_descriptors.append({ move(bitmap), 0 });
+    frame_count = 1;
+    loop_count = 0;
+
+    if (exif_metadata)
+        TRY(apply_exif_orientation());
+    return {};
+}
+
 ErrorOr<void> PNGLoadingContext::apply_exif_orientation()
 {
     auto orientation = exif_metadata->orientation().value_or(TIFF::Orientation::Default);
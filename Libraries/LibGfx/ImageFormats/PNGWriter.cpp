@@ -44,6 +44,15 @@ ErrorOr<ByteBuffer> PNGWriter::encode(Gfx::Bitmap const& bitmap, Options options
         png_set_iCCP(png_ptr, info_ptr, "embedded profile", 0, options.icc_data->data(), options.icc_data->size());
     }
 
+    if (options.compression_level.has_value()) {
+        VERIFY(*options.compression_level <= 9);
+        png_set_compression_level(png_ptr, *options.compression_level);
+
+        // Choosing a row filter per row is a large part of the encoding time, and a fast level is asking to skip that.
+        if (*options.compression_level <= 3)
+            png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, PNG_FILTER_SUB);
+    }
+
     if (bitmap.format() == BitmapFormat::BGRA8888 || bitmap.format() == BitmapFormat::BGRx8888) {
         png_set_bgr(png_ptr);
     }
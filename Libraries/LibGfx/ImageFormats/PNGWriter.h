@@ -18,6 +18,9 @@ struct PNGWriterOptions {
     // Data for the iCCP chunk.
     // FIXME: Allow writing cICP, sRGB, or gAMA instead too.
     Optional<ReadonlyBytes> icc_data;
+
+    // The zlib compression level, from 0 (fastest) to 9 (smallest).
+    Optional<u8> compression_level;
 };
 
 class PNGWriter {
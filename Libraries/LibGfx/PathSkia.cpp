@@ -46,6 +46,9 @@ PathImplSkia::PathImplSkia(PathImplSkia const& other)
     , m_has_current_point(other.m_has_current_point)
     , m_path_builder(adopt_own(*new SkPathBuilder(*other.m_path_builder)))
 {
+    // SkPath shares its points with copies of itself, so keeping the snapshot spares the copy from taking another.
+    if (other.m_cached_path)
+        m_cached_path = adopt_own(*new SkPath(*other.m_cached_path));
 }
 
 PathImplSkia::~PathImplSkia() = default;
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+use std::cell::RefCell;
 use yuv::YuvPlanarImage;
 use yuv::YuvRange;
 use yuv::YuvStandardMatrix;
@@ -94,6 +95,10 @@ pub unsafe extern "C" fn yuv_u8_to_rgba(
     result.is_ok()
 }
 
+thread_local! {
+    static SCRATCH_10_BIT_PLANES: RefCell<Vec<u16>> = const { RefCell::new(Vec::new()) };
+}
+
 /// # Safety
 /// All plane pointers must be valid for the specified dimensions and strides.
 /// `dst` must point to a buffer of at least `dst_stride * height` bytes.
@@ -144,29 +149,27 @@ pub unsafe extern "C" fn yuv_u16_to_rgba(
     } else {
         // 12-bit 4:4:4 has no 8-bit RGBA output; shift to 10-bit and use I410.
         if !subsampling_x && !subsampling_y {
-            let y_10: Vec<u16> = unsafe { core::slice::from_raw_parts(y_plane, y_len) }
-                .iter()
-                .map(|&v| v >> 2)
-                .collect();
-            let u_10: Vec<u16> = unsafe { core::slice::from_raw_parts(u_plane, uv_len) }
-                .iter()
-                .map(|&v| v >> 2)
-                .collect();
-            let v_10: Vec<u16> = unsafe { core::slice::from_raw_parts(v_plane, uv_len) }
-                .iter()
-                .map(|&v| v >> 2)
-                .collect();
-            let planar_10 = YuvPlanarImage {
-                y_plane: &y_10,
-                y_stride,
-                u_plane: &u_10,
-                u_stride,
-                v_plane: &v_10,
-                v_stride,
-                width,
-                height,
-            };
-            return yuv::i410_to_rgba(&planar_10, dst_slice, dst_stride, range.into(), matrix.into()).is_ok();
+            return SCRATCH_10_BIT_PLANES.with_borrow_mut(|scratch| {
+                // Reuse the same scratch buffer for every frame so that steady-state playback doesn't allocate.
+                scratch.clear();
+                for (plane, len) in [(y_plane, y_len), (u_plane, uv_len), (v_plane, uv_len)] {
+                    let samples = unsafe { core::slice::from_raw_parts(plane, len) };
+                    scratch.extend(samples.iter().map(|&v| v >> 2));
+                }
+                let (y_10, uv_10) = scratch.split_at(y_len);
+                let (u_10, v_10) = uv_10.split_at(uv_len);
+                let planar_10 = YuvPlanarImage {
+                    y_plane: y_10,
+                    y_stride,
+                    u_plane: u_10,
+                    u_stride,
+                    v_plane: v_10,
+                    v_stride,
+                    width,
+                    height,
+                };
+                yuv::i410_to_rgba(&planar_10, dst_slice, dst_stride, range.into(), matrix.into()).is_ok()
+            });
         }
         match (subsampling_x, subsampling_y) {
             (true, true) => yuv::i012_to_rgba(&planar_image, dst_slice, dst_stride, range.into(), matrix.into()),
@@ -8,7 +8,6 @@
  */
 
 #include <AK/BitCast.h>
-#include <AK/HashFunctions.h>
 #include <AK/Utf16String.h>
 #include <AK/Utf16View.h>
 #include <LibGfx/Font/Font.h>
@@ -129,35 +128,13 @@ Vector<NonnullRefPtr<GlyphRun>> shape_text(FloatPoint baseline_start, Utf16View
         return {};
 
     Vector<NonnullRefPtr<GlyphRun>> runs;
-
-    auto it = string.begin();
-    auto substring_begin_offset = string.iterator_offset(it);
-    Font const* last_font = &font_cascade_list.font_for_code_point(*it, FontCascadeList::TriggerPendingLoads::Yes);
     FloatPoint last_position = baseline_start;
 
-    auto add_run = [&runs, &last_position, letter_spacing](Utf16View const& string, Font const& font) {
-        auto run = shape_text(last_position, letter_spacing, string, font, GlyphRun::TextType::Common);
+    font_cascade_list.for_each_font_run(string, FontCascadeList::TriggerPendingLoads::Yes, [&](Utf16View const& substring, Font const& font) {
+        auto run = shape_text(last_position, letter_spacing, substring, font, GlyphRun::TextType::Common);
         last_position.translate_by(run->width(), 0);
         runs.append(*run);
-    };
-
-    while (it != string.end()) {
-        auto code_point = *it;
-        auto const* font = &font_cascade_list.font_for_code_point(code_point, FontCascadeList::TriggerPendingLoads::Yes);
-        if (font != last_font) {
-            auto substring = string.substring_view(substring_begin_offset, string.iterator_offset(it) - substring_begin_offset);
-            add_run(substring, *last_font);
-            last_font = font;
-            substring_begin_offset = string.iterator_offset(it);
-        }
-        ++it;
-    }
-
-    auto end_offset = string.iterator_offset(it);
-    if (substring_begin_offset < end_offset) {
-        auto substring = string.substring_view(substring_begin_offset, end_offset - substring_begin_offset);
-        add_run(substring, *last_font);
-    }
+    });
 
     return runs;
 }
@@ -285,7 +262,6 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
         return adopt_ref(*new GlyphRun(move(glyphs), font, text_type, shape.width));
     };
 
-    // FIXME: The cache currently grows unbounded. We should have some limit and LRU mechanism.
     if (string.length_in_code_units() == 1 && letter_spacing == 0.f && text_type == GlyphRun::TextType::Common) {
         auto code_unit = string.code_unit_at(0);
         if (code_unit < 128) {
@@ -298,21 +274,12 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
 
     auto text_type_bits = static_cast<u8>(to_underlying(text_type));
     auto letter_spacing_bit_pattern = bit_cast<u32>(letter_spacing);
-    auto key_hash = pair_int_hash(string.hash(), pair_int_hash(text_type_bits, letter_spacing_bit_pattern));
-
-    if (auto it = shaping_cache.map.find(key_hash, [&](auto const& candidate) {
-            return candidate.key.text_type == text_type_bits
-                && candidate.key.letter_spacing_bit_pattern == letter_spacing_bit_pattern
-                && candidate.key.text == string;
-        });
-        it != shaping_cache.map.end()) {
-        return build_glyph_run(*it->value);
-    }
+    if (auto const* shape = shaping_cache.find(string, text_type_bits, letter_spacing_bit_pattern))
+        return build_glyph_run(*shape);
 
-    auto shape = build_origin_relative_shape(string, font, text_type, letter_spacing);
-    auto run = build_glyph_run(*shape);
-    shaping_cache.map.set({ Utf16String::from_utf16(string), text_type_bits, letter_spacing_bit_pattern }, move(shape));
-    return run;
+    auto const& shape = shaping_cache.insert({ Utf16String::from_utf16(string), text_type_bits, letter_spacing_bit_pattern },
+        build_origin_relative_shape(string, font, text_type, letter_spacing));
+    return build_glyph_run(shape);
 }
 
 float measure_text_width(Utf16View const& string, Font const& font, float letter_spacing)
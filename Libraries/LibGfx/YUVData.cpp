@@ -29,9 +29,10 @@ struct YUVDataImpl {
     Media::Subsampling subsampling;
     Media::CodingIndependentCodePoints cicp;
 
-    FixedArray<u8> y_buffer;
-    FixedArray<u8> u_buffer;
-    FixedArray<u8> v_buffer;
+    Core::AnonymousBuffer buffer;
+    Bytes y_buffer;
+    Bytes u_buffer;
+    Bytes v_buffer;
 };
 
 }
@@ -75,19 +76,26 @@ ErrorOr<YUVData::PlaneSizes> YUVData::plane_sizes(IntSize size, u8 bit_depth, Me
 ErrorOr<NonnullOwnPtr<YUVData>> YUVData::create(IntSize size, u8 bit_depth, Media::Subsampling subsampling, Media::CodingIndependentCodePoints cicp)
 {
     auto sizes = TRY(plane_sizes(size, bit_depth, subsampling));
+    auto buffer = TRY(Core::AnonymousBuffer::create_with_size(sizes.total));
+    return create_from_shared_buffer(size, bit_depth, subsampling, cicp, move(buffer));
+}
 
-    auto y_buffer = TRY(FixedArray<u8>::create(sizes.y));
-    auto u_buffer = TRY(FixedArray<u8>::create(sizes.u));
-    auto v_buffer = TRY(FixedArray<u8>::create(sizes.v));
+ErrorOr<NonnullOwnPtr<YUVData>> YUVData::create_from_shared_buffer(IntSize size, u8 bit_depth, Media::Subsampling subsampling, Media::CodingIndependentCodePoints cicp, Core::AnonymousBuffer buffer)
+{
+    auto sizes = TRY(plane_sizes(size, bit_depth, subsampling));
+    if (!buffer.is_valid() || buffer.size() != sizes.total)
+        return Error::from_string_literal("YUVData shared buffer size mismatch");
 
+    auto bytes = Bytes { buffer.data<u8>(), buffer.size() };
     auto impl = TRY(try_make<Details::YUVDataImpl>(Details::YUVDataImpl {
         .size = size,
         .bit_depth = bit_depth,
         .subsampling = subsampling,
         .cicp = cicp,
-        .y_buffer = move(y_buffer),
-        .u_buffer = move(u_buffer),
-        .v_buffer = move(v_buffer),
+        .buffer = move(buffer),
+        .y_buffer = bytes.slice(0, sizes.y),
+        .u_buffer = bytes.slice(sizes.y, sizes.u),
+        .v_buffer = bytes.slice(sizes.y + sizes.u, sizes.v),
     }));
 
     return adopt_nonnull_own_or_enomem(new (nothrow) YUVData(move(impl)));
@@ -135,32 +143,37 @@ Media::CodingIndependentCodePoints const& YUVData::cicp() const
 
 Bytes YUVData::y_data()
 {
-    return m_impl->y_buffer.span();
+    return m_impl->y_buffer;
 }
 
 Bytes YUVData::u_data()
 {
-    return m_impl->u_buffer.span();
+    return m_impl->u_buffer;
 }
 
 Bytes YUVData::v_data()
 {
-    return m_impl->v_buffer.span();
+    return m_impl->v_buffer;
 }
 
 ReadonlyBytes YUVData::y_data() const
 {
-    return m_impl->y_buffer.span();
+    return m_impl->y_buffer;
 }
 
 ReadonlyBytes YUVData::u_data() const
 {
-    return m_impl->u_buffer.span();
+    return m_impl->u_buffer;
 }
 
 ReadonlyBytes YUVData::v_data() const
 {
-    return m_impl->v_buffer.span();
+    return m_impl->v_buffer;
+}
+
+Core::AnonymousBuffer const& YUVData::shared_buffer() const
+{
+    return m_impl->buffer;
 }
 
 static FFI::YUVMatrix yuv_matrix_for_cicp(Media::CodingIndependentCodePoints const& cicp)
@@ -187,13 +200,22 @@ static FFI::YUVMatrix yuv_matrix_for_cicp(Media::CodingIndependentCodePoints con
 }
 
 ErrorOr<NonnullRefPtr<Bitmap>> YUVData::to_bitmap() const
+{
+    auto bitmap = TRY(Bitmap::create(BitmapFormat::RGBA8888, AlphaType::Premultiplied, m_impl->size));
+    TRY(convert_to_bitmap(*bitmap));
+    return bitmap;
+}
+
+ErrorOr<void> YUVData::convert_to_bitmap(Bitmap& bitmap) const
 {
     auto const& impl = *m_impl;
     VERIFY(impl.bit_depth <= 12);
 
-    auto bitmap = TRY(Bitmap::create(BitmapFormat::RGBA8888, AlphaType::Premultiplied, impl.size));
-    auto* dst = reinterpret_cast<u8*>(bitmap->scanline(0));
-    auto dst_stride = static_cast<u32>(bitmap->pitch());
+    if (bitmap.format() != BitmapFormat::RGBA8888 || bitmap.size() != impl.size)
+        return Error::from_string_literal("YUVData conversion target has the wrong format or size");
+
+    auto* dst = reinterpret_cast<u8*>(bitmap.scanline(0));
+    auto dst_stride = static_cast<u32>(bitmap.pitch());
 
     auto width = static_cast<u32>(impl.size.width());
     auto height = static_cast<u32>(impl.size.height());
@@ -243,7 +265,7 @@ ErrorOr<NonnullRefPtr<Bitmap>> YUVData::to_bitmap() const
             }
         }
 
-        return bitmap;
+        return {};
     }
 
     auto uv_size = impl.subsampling.subsampled_size(impl.size).to_type<u32>();
@@ -280,7 +302,7 @@ ErrorOr<NonnullRefPtr<Bitmap>> YUVData::to_bitmap() const
     if (!success)
         return Error::from_string_literal("YUV-to-RGB conversion failed");
 
-    return bitmap;
+    return {};
 }
 
 static SkYUVColorSpace skia_yuv_color_space(Media::CodingIndependentCodePoints cicp)
@@ -333,7 +355,7 @@ static u16 expand_sample_to_full_16_bit_range(u16 sample, u8 bit_depth)
     return static_cast<u16>((sample << shift) | (sample >> inverse_shift));
 }
 
-static void copy_plane_expanded_to_full_16_bit_range(FixedArray<u8> const& source_buffer, SkPixmap const& destination, IntSize plane_size, u8 bit_depth)
+static void copy_plane_expanded_to_full_16_bit_range(ReadonlyBytes source_buffer, SkPixmap const& destination, IntSize plane_size, u8 bit_depth)
 {
     VERIFY(bit_depth > 8);
 
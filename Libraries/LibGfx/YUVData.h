@@ -7,9 +7,9 @@
 #pragma once
 
 #include <AK/Error.h>
-#include <AK/FixedArray.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/NonnullRefPtr.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibGfx/Forward.h>
 #include <LibGfx/Size.h>
 #include <LibMedia/Color/CodingIndependentCodePoints.h>
@@ -26,7 +26,8 @@ struct YUVDataImpl;
 }
 
 // Holds planar YUV data with metadata needed for GPU conversion.
-// Uses FixedArray for deterministic buffer sizing.
+// The Y, U and V planes are stored back to back in one shared memory buffer, so they can be handed to another process
+// without copying.
 // Not ref-counted - owned directly by decoded video frame objects via NonnullOwnPtr.
 class YUVData final {
 public:
@@ -40,6 +41,8 @@ public:
     static ErrorOr<PlaneSizes> plane_sizes(IntSize size, u8 bit_depth, Media::Subsampling);
     static ErrorOr<NonnullOwnPtr<YUVData>> create(IntSize size, u8 bit_depth, Media::Subsampling, Media::CodingIndependentCodePoints);
     static ErrorOr<NonnullOwnPtr<YUVData>> create_from_data(IntSize size, u8 bit_depth, Media::Subsampling, Media::CodingIndependentCodePoints, ReadonlyBytes y_data, ReadonlyBytes u_data, ReadonlyBytes v_data);
+    // Adopts a buffer laid out like shared_buffer() without copying it.
+    static ErrorOr<NonnullOwnPtr<YUVData>> create_from_shared_buffer(IntSize size, u8 bit_depth, Media::Subsampling, Media::CodingIndependentCodePoints, Core::AnonymousBuffer);
 
     ~YUVData();
 
@@ -56,7 +59,11 @@ public:
     ReadonlyBytes u_data() const;
     ReadonlyBytes v_data() const;
 
+    Core::AnonymousBuffer const& shared_buffer() const;
+
     ErrorOr<NonnullRefPtr<Bitmap>> to_bitmap() const;
+    // Converts into an existing RGBA8888 bitmap of the same size, so callers can reuse bitmaps across frames.
+    ErrorOr<void> convert_to_bitmap(Bitmap&) const;
 
     SkYUVAPixmaps make_pixmaps() const;
 
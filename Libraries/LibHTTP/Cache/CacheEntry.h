@@ -132,6 +132,10 @@ public:
     RevalidationType revalidation_type() const { return m_revalidation_type; }
     void set_revalidation_type(RevalidationType revalidation_type) { m_revalidation_type = revalidation_type; }
 
+    // Whether this entry may still be served if revalidating it fails due to a network or server error.
+    bool may_serve_stale_on_error() const { return m_may_serve_stale_on_error; }
+    void set_may_serve_stale_on_error(bool may_serve_stale_on_error) { m_may_serve_stale_on_error = may_serve_stale_on_error; }
+
     void revalidation_succeeded(HeaderList const&);
     void revalidation_failed();
 
@@ -169,6 +173,7 @@ private:
     NonnullRefPtr<HeaderList> m_response_headers;
 
     RevalidationType m_revalidation_type { RevalidationType::None };
+    bool m_may_serve_stale_on_error { false };
 
     u64 const m_data_offset { 0 };
     u64 const m_data_size { 0 };
@@ -17,6 +17,7 @@
 namespace HTTP {
 
 static constexpr u32 INDEX_SCHEMA_BASELINE_VERSION = 1u;
+static constexpr auto LAST_ACCESS_TIME_FLUSH_INTERVAL = AK::Duration::from_seconds(5);
 
 static ByteString serialize_headers(HeaderList const& headers)
 {
@@ -207,6 +208,11 @@ CacheIndex::CacheIndex(Database::Database& database, Statements statements, Limi
 {
 }
 
+CacheIndex::~CacheIndex()
+{
+    flush_dirty_last_access_times();
+}
+
 ErrorOr<void> CacheIndex::create_entry(u64 cache_key, u64 vary_key, String url, NonnullRefPtr<HeaderList> request_headers, NonnullRefPtr<HeaderList> response_headers, u64 data_size, UnixDateTime request_time, UnixDateTime response_time)
 {
     auto now = UnixDateTime::now();
@@ -286,6 +292,8 @@ void CacheIndex::remove_entries_exceeding_cache_limit(Function<void(u64 cache_ke
     if (m_total_estimated_size <= m_limits.maximum_disk_cache_size)
         return;
 
+    flush_dirty_last_access_times();
+
     m_database->execute_statement(
         m_statements.remove_entries_exceeding_cache_limit,
         [&](auto statement_id) {
@@ -303,6 +311,8 @@ void CacheIndex::remove_entries_exceeding_cache_limit(Function<void(u64 cache_ke
 
 void CacheIndex::remove_entries_accessed_since(UnixDateTime since, Function<void(u64 cache_key, u64 vary_key)> on_entry_removed)
 {
+    flush_dirty_last_access_times();
+
     m_database->execute_statement(
         m_statements.remove_entries_accessed_since,
         [&](auto statement_id) {
@@ -354,10 +364,42 @@ void CacheIndex::update_last_access_time(u64 cache_key, u64 vary_key)
     if (!entry.has_value())
         return;
 
-    auto now = UnixDateTime::now();
+    entry->last_access_time = UnixDateTime::now();
 
-    m_database->execute_statement(m_statements.update_last_access_time, {}, now, cache_key, vary_key);
-    entry->last_access_time = now;
+    if (!entry->last_access_time_is_dirty) {
+        entry->last_access_time_is_dirty = true;
+        m_dirty_last_access_times.append({ cache_key, vary_key });
+    }
+
+    if (MonotonicTime::now_coarse() - m_last_access_times_flushed_at >= LAST_ACCESS_TIME_FLUSH_INTERVAL)
+        flush_dirty_last_access_times();
+}
+
+void CacheIndex::flush_dirty_last_access_times()
+{
+    m_last_access_times_flushed_at = MonotonicTime::now_coarse();
+
+    if (m_dirty_last_access_times.is_empty())
+        return;
+
+    auto dirty_last_access_times = move(m_dirty_last_access_times);
+
+    // Without a transaction, SQLite would commit (and sync) each update on its own.
+    auto began_transaction = !m_database->execute_raw("BEGIN;").is_error();
+
+    for (auto [cache_key, vary_key] : dirty_last_access_times) {
+        auto entry = get_entry(cache_key, vary_key);
+        if (!entry.has_value() || !entry->last_access_time_is_dirty)
+            continue;
+
+        m_database->execute_statement(m_statements.update_last_access_time, {}, entry->last_access_time, cache_key, vary_key);
+        entry->last_access_time_is_dirty = false;
+    }
+
+    if (began_transaction) {
+        if (auto result = m_database->execute_raw("COMMIT;"); result.is_error())
+            dbgln("CacheIndex: Unable to commit last access times: {}", result.error());
+    }
 }
 
 Optional<CacheIndex::Entry const&> CacheIndex::find_entry(u64 cache_key, HeaderList const& request_headers)
@@ -420,6 +462,8 @@ void CacheIndex::delete_entry(u64 cache_key, u64 vary_key)
 
 Requests::CacheSizes CacheIndex::estimate_cache_size_accessed_since(UnixDateTime since)
 {
+    flush_dirty_last_access_times();
+
     Requests::CacheSizes sizes;
 
     m_database->execute_statement(
@@ -34,6 +34,7 @@ class CacheIndex {
         UnixDateTime request_time;
         UnixDateTime response_time;
         UnixDateTime last_access_time;
+        bool last_access_time_is_dirty { false };
 
         u64 estimated_size() const
         {
@@ -46,6 +47,10 @@ public:
 
     static ErrorOr<CacheIndex> create(Database::Database&, LexicalPath const& cache_directory);
 
+    CacheIndex(CacheIndex&&) = default;
+    CacheIndex& operator=(CacheIndex&&) = default;
+    ~CacheIndex();
+
     ErrorOr<void> create_entry(u64 cache_key, u64 vary_key, String url, NonnullRefPtr<HeaderList> request_headers, NonnullRefPtr<HeaderList> response_headers, u64 data_size, UnixDateTime request_time, UnixDateTime response_time);
     void remove_entry(u64 cache_key, u64 vary_key);
     void remove_entries_exceeding_cache_limit(Function<void(u64 cache_key, u64 vary_key)> on_entry_removed);
@@ -87,11 +92,23 @@ private:
     Optional<Entry&> get_entry(u64 cache_key, u64 vary_key);
     void delete_entry(u64 cache_key, u64 vary_key);
 
+    void flush_dirty_last_access_times();
+
+    struct EntryKey {
+        u64 cache_key { 0 };
+        u64 vary_key { 0 };
+    };
+
     NonnullRawPtr<Database::Database> m_database;
     Statements m_statements;
 
     HashMap<u64, Vector<Entry>, IdentityHashTraits<u64>> m_entries;
 
+    // Every cache hit bumps an entry's last access time. Those writes are only consumed by eviction and by cache size
+    // estimates, so they are kept in memory and written back in a single transaction, rather than one statement per hit.
+    Vector<EntryKey> m_dirty_last_access_times;
+    MonotonicTime m_last_access_times_flushed_at { MonotonicTime::now_coarse() };
+
     Limits m_limits;
     u64 m_total_estimated_size { 0 };
 };
@@ -197,6 +197,11 @@ Variant<Optional<CacheEntryReader&>, DiskCache::CacheHasOpenEntry> DiskCache::op
             dbgln_if(HTTP_DISK_CACHE_DEBUG, "\033[36m[disk]\033[0m \033[32;1mOpened expired cache entry for\033[0m {} (lifetime={}s age={}s) ({} bytes)", url, freshness_lifetime.to_seconds(), current_age.to_seconds(), index_entry->data_size);
         } else if (open_mode == OpenMode::Read) {
             TRY(revalidate_cache_entry());
+
+            // A request that asked for validation does not get a stale response in its place.
+            auto request_cache_control = request_headers.get("Cache-Control"sv);
+            if (cache_mode != CacheMode::NoCache && (!request_cache_control.has_value() || !contains_cache_control_directive(*request_cache_control, "no-cache"sv)))
+                cache_entry.value()->set_may_serve_stale_on_error(calculate_stale_if_error_lifetime(response_headers, freshness_lifetime) > current_age);
         } else {
             dbgln_if(HTTP_DISK_CACHE_DEBUG, "\033[36m[disk]\033[0m \033[32;1mOpened cache entry for revalidation\033[0m {} (lifetime={}s age={}s) ({} bytes)", url, freshness_lifetime.to_seconds(), current_age.to_seconds(), index_entry->data_size);
         }
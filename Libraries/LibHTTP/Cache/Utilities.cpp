@@ -477,6 +477,25 @@ AK::Duration calculate_stale_while_revalidate_lifetime(HeaderList const& headers
     return {};
 }
 
+// https://httpwg.org/specs/rfc5861.html#n-the-stale-if-error-cache-control-extension
+AK::Duration calculate_stale_if_error_lifetime(HeaderList const& headers, AK::Duration freshness_lifetime)
+{
+    auto cache_control = headers.get("Cache-Control"sv);
+    if (!cache_control.has_value())
+        return {};
+
+    // https://httpwg.org/specs/rfc9111.html#cache-response-directive.must-revalidate
+    // https://httpwg.org/specs/rfc9111.html#cache-response-directive.no-cache
+    // Responses carrying either directive may not be reused without successful validation, even when the origin is
+    // unreachable.
+    if (contains_cache_control_directive(*cache_control, "must-revalidate"sv) || contains_cache_control_directive(*cache_control, "no-cache"sv))
+        return {};
+
+    if (auto sie = extract_cache_control_duration_directive(*cache_control, "stale-if-error"sv); sie.has_value())
+        return freshness_lifetime + *sie;
+    return {};
+}
+
 CacheLifetimeStatus cache_lifetime_status(HeaderList const& request_headers, HeaderList const& response_headers, AK::Duration freshness_lifetime, AK::Duration current_age)
 {
     auto revalidation_status = [&](auto revalidation_type) {
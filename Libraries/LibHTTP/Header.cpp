@@ -9,6 +9,8 @@
 #include <AK/AllOf.h>
 #include <AK/AnyOf.h>
 #include <AK/GenericLexer.h>
+#include <AK/HashMap.h>
+#include <AK/NeverDestroyed.h>
 #include <AK/QuickSort.h>
 #include <AK/Utf16View.h>
 #include <LibHTTP/HTTP.h>
@@ -21,14 +23,96 @@
 
 namespace HTTP {
 
+// Well-known names are all ASCII, so their isomorphic encoding is the name itself.
+static ByteString isomorphic_encode_header_name(StringView name)
+{
+    if (auto interned_name = intern_header_name(name); !interned_name.is_empty())
+        return interned_name;
+    return TextCodec::isomorphic_encode(name);
+}
+
 Header Header::isomorphic_encode(StringView name, StringView value)
 {
-    return { TextCodec::isomorphic_encode(name), TextCodec::isomorphic_encode(value) };
+    return { isomorphic_encode_header_name(name), TextCodec::isomorphic_encode(value) };
 }
 
 Header Header::isomorphic_encode(StringView name, Utf16View value)
 {
-    return { TextCodec::isomorphic_encode(name), TextCodec::isomorphic_encode(value) };
+    return { isomorphic_encode_header_name(name), TextCodec::isomorphic_encode(value) };
+}
+
+static constexpr auto well_known_header_names = to_array<StringView>({
+    "Accept"sv,
+    "Accept-Encoding"sv,
+    "Accept-Language"sv,
+    "Accept-Ranges"sv,
+    "Access-Control-Allow-Credentials"sv,
+    "Access-Control-Allow-Headers"sv,
+    "Access-Control-Allow-Methods"sv,
+    "Access-Control-Allow-Origin"sv,
+    "Access-Control-Expose-Headers"sv,
+    "Access-Control-Max-Age"sv,
+    "Age"sv,
+    "Alt-Svc"sv,
+    "Cache-Control"sv,
+    "Connection"sv,
+    "Content-Disposition"sv,
+    "Content-Encoding"sv,
+    "Content-Language"sv,
+    "Content-Length"sv,
+    "Content-Location"sv,
+    "Content-Range"sv,
+    "Content-Security-Policy"sv,
+    "Content-Type"sv,
+    "Cookie"sv,
+    "Cross-Origin-Embedder-Policy"sv,
+    "Cross-Origin-Opener-Policy"sv,
+    "Cross-Origin-Resource-Policy"sv,
+    "Date"sv,
+    "ETag"sv,
+    "Expires"sv,
+    "Host"sv,
+    "If-Modified-Since"sv,
+    "If-None-Match"sv,
+    "Keep-Alive"sv,
+    "Last-Modified"sv,
+    "Link"sv,
+    "Location"sv,
+    "Origin"sv,
+    "Permissions-Policy"sv,
+    "Pragma"sv,
+    "Range"sv,
+    "Referer"sv,
+    "Referrer-Policy"sv,
+    "Refresh"sv,
+    "Server"sv,
+    "Server-Timing"sv,
+    "Set-Cookie"sv,
+    "Strict-Transport-Security"sv,
+    "Timing-Allow-Origin"sv,
+    "Transfer-Encoding"sv,
+    "User-Agent"sv,
+    "Vary"sv,
+    "Via"sv,
+    "X-Content-Type-Options"sv,
+    "X-Frame-Options"sv,
+    "X-XSS-Protection"sv,
+});
+
+ByteString intern_header_name(StringView name)
+{
+    static NeverDestroyed<HashMap<StringView, ByteString>> interned_names = [] {
+        HashMap<StringView, ByteString> names;
+        for (auto name : well_known_header_names) {
+            ByteString interned_name = name;
+            auto lowercase_name = interned_name.to_lowercase();
+            names.set(interned_name.view(), interned_name);
+            names.set(lowercase_name.view(), lowercase_name);
+        }
+        return names;
+    }();
+
+    return interned_names->get(name).value_or({});
 }
 
 // https://www.rfc-editor.org/rfc/rfc9110.html#name-recipient-requirements
@@ -366,7 +450,27 @@ ErrorOr<void> encode(Encoder& encoder, HTTP::Header const& header)
 template<>
 ErrorOr<HTTP::Header> decode(Decoder& decoder)
 {
-    auto name = TRY(decoder.decode<ByteString>());
+    auto name = TRY([&] -> ErrorOr<ByteString> {
+        // No well-known name is longer than this, so longer names are decoded as usual.
+        static constexpr size_t maximum_interned_name_length = 64;
+
+        auto length = TRY(decoder.decode_size());
+        if (length > maximum_interned_name_length) {
+            return ByteString::create_and_overwrite(length, [&](Bytes bytes) -> ErrorOr<void> {
+                TRY(decoder.decode_bulk_data_into(bytes));
+                return {};
+            });
+        }
+
+        Array<u8, maximum_interned_name_length> buffer;
+        auto bytes = buffer.span().trim(length);
+        TRY(decoder.decode_bulk_data_into(bytes));
+
+        StringView name_view { bytes };
+        if (auto interned_name = HTTP::intern_header_name(name_view); !interned_name.is_empty())
+            return interned_name;
+        return ByteString { name_view };
+    }());
     auto value = TRY(decoder.decode<ByteString>());
     return HTTP::Header { move(name), move(value) };
 }
@@ -24,6 +24,10 @@ struct Header {
     ByteString value;
 };
 
+// Returns a shared copy of the name if it is a well-known header name, spelled either in its usual casing or all in
+// lowercase, so that the many headers using those names do not each allocate their own.
+[[nodiscard]] ByteString intern_header_name(StringView);
+
 [[nodiscard]] bool is_header_name(StringView);
 [[nodiscard]] bool is_header_value(StringView);
 [[nodiscard]] StringView normalize_header_value(StringView);
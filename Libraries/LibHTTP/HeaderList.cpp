@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Find.h>
 #include <AK/GenericLexer.h>
 #include <AK/HashTable.h>
 #include <AK/StringUtils.h>
@@ -36,24 +37,29 @@ bool HeaderList::contains(StringView name) const
 // https://fetch.spec.whatwg.org/#concept-header-list-get
 Optional<ByteString> HeaderList::get(StringView name) const
 {
+    auto is_match = [&](Header const& header) { return header.name.equals_ignoring_ascii_case(name); };
+
     // 1. If list does not contain name, then return null.
-    if (!contains(name))
+    auto first_match = m_headers.find_if(is_match);
+    if (first_match == m_headers.end())
         return {};
 
+    // OPTIMIZATION: Most headers appear once, in which case their value can be shared rather than copied.
+    auto second_match = AK::find_if(first_match + 1, m_headers.end(), is_match);
+    if (second_match == m_headers.end())
+        return first_match->value;
+
     // 2. Return the values of all headers in list whose name is a byte-case-insensitive match for name, separated from
     //    each other by 0x2C 0x20, in order.
     StringBuilder builder;
-    bool first = true;
+    builder.append(first_match->value);
 
-    for (auto const& header : *this) {
-        if (!header.name.equals_ignoring_ascii_case(name))
+    for (auto it = second_match; it != m_headers.end(); ++it) {
+        if (!is_match(*it))
             continue;
 
-        if (!first)
-            builder.append(", "sv);
-
-        builder.append(header.value);
-        first = false;
+        builder.append(", "sv);
+        builder.append(it->value);
     }
 
     return builder.to_byte_string();
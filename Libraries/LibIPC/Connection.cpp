@@ -6,13 +6,25 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/NeverDestroyed.h>
+#include <AK/QuickSort.h>
 #include <AK/Vector.h>
 #include <LibIPC/Connection.h>
 #include <LibIPC/Message.h>
 #include <LibIPC/Stub.h>
+#include <LibIPC/Tracing.h>
+#include <LibSync/Mutex.h>
 
 namespace IPC {
 
+static Sync::Mutex s_synchronous_call_statistics_mutex;
+static NeverDestroyed<HashMap<StringView, ConnectionBase::SynchronousCallStatistics>> s_synchronous_call_statistics;
+
+static u64 response_handler_key(u32 endpoint_magic, int message_id)
+{
+    return (static_cast<u64>(endpoint_magic) << 32) | static_cast<u32>(message_id);
+}
+
 ConnectionBase::ConnectionBase(IPC::Stub& local_stub, NonnullOwnPtr<Transport> transport, u32 local_endpoint_magic)
     : m_local_stub(local_stub)
     , m_transport(move(transport))
@@ -53,9 +65,62 @@ ErrorOr<void> ConnectionBase::post_message(MessageBuffer& buffer)
 void ConnectionBase::shutdown()
 {
     m_transport->close();
+    fail_pending_responses();
     die();
 }
 
+void ConnectionBase::add_response_handler(u32 endpoint_magic, int message_id, ResponseHandler handler)
+{
+    m_response_handlers.ensure(response_handler_key(endpoint_magic, message_id)).enqueue(move(handler));
+}
+
+void ConnectionBase::deliver_responses()
+{
+    auto handlers = move(m_claimed_response_handlers);
+    auto responses = move(m_claimed_responses);
+
+    for (size_t i = 0; i < handlers.size(); ++i)
+        handlers[i](move(responses[i]));
+}
+
+void ConnectionBase::fail_pending_responses()
+{
+    deliver_responses();
+
+    auto handlers = move(m_response_handlers);
+    for (auto& it : handlers) {
+        while (!it.value.is_empty())
+            it.value.dequeue()(nullptr);
+    }
+}
+
+void ConnectionBase::record_synchronous_call(StringView message_name, AK::Duration duration)
+{
+    dbgln_if(SYNC_IPC_DEBUG, "Synchronous IPC call {} took {}us", message_name, duration.to_microseconds());
+
+    Sync::MutexLocker locker(s_synchronous_call_statistics_mutex);
+    auto& statistics = s_synchronous_call_statistics->ensure(message_name, [&] {
+        return SynchronousCallStatistics { .message_name = message_name };
+    });
+
+    ++statistics.call_count;
+    statistics.total_time += duration;
+    statistics.longest_time = max(statistics.longest_time, duration);
+}
+
+Vector<ConnectionBase::SynchronousCallStatistics> ConnectionBase::synchronous_call_statistics()
+{
+    Vector<SynchronousCallStatistics> statistics;
+    {
+        Sync::MutexLocker locker(s_synchronous_call_statistics_mutex);
+        for (auto const& it : *s_synchronous_call_statistics)
+            statistics.append(it.value);
+    }
+
+    quick_sort(statistics, [](auto const& a, auto const& b) { return a.total_time > b.total_time; });
+    return statistics;
+}
+
 void ConnectionBase::shutdown_with_error(Error const& error)
 {
     dbgln("IPC::ConnectionBase ({:p}) had an error ({}), disconnecting.", this, error);
@@ -64,6 +129,8 @@ void ConnectionBase::shutdown_with_error(Error const& error)
 
 void ConnectionBase::handle_messages()
 {
+    deliver_responses();
+
     auto messages = move(m_unprocessed_messages);
     for (auto& message : messages) {
         if (message->endpoint_magic() != m_local_endpoint_magic)
@@ -72,7 +139,32 @@ void ConnectionBase::handle_messages()
         if (!is_open())
             dbgln("Handling message while connection closed: {}", message->message_name());
 
+        struct TracedMessage {
+            u32 endpoint_magic { 0 };
+            int message_id { 0 };
+            StringView message_name;
+            MonotonicTime received_time;
+            MonotonicTime handler_start_time;
+        };
+        Optional<TracedMessage> traced_message;
+        if (MessageTracing::is_enabled()) {
+            auto now = MonotonicTime::now();
+            traced_message = TracedMessage {
+                .endpoint_magic = message->endpoint_magic(),
+                .message_id = message->message_id(),
+                .message_name = message->message_name(),
+                .received_time = message->received_time().value_or(now),
+                .handler_start_time = now,
+            };
+        }
+
         auto handler_result = m_local_stub.handle(move(message));
+
+        if (traced_message.has_value()) {
+            MessageTracing::record_handled_message(traced_message->endpoint_magic, traced_message->message_id, traced_message->message_name,
+                traced_message->handler_start_time - traced_message->received_time, MonotonicTime::now() - traced_message->handler_start_time);
+        }
+
         if (handler_result.is_error()) {
             dbgln("IPC::ConnectionBase::handle_messages: {}", handler_result.error());
             continue;
@@ -99,6 +191,20 @@ ConnectionBase::PeerEOF ConnectionBase::drain_messages_from_peer()
     auto schedule_shutdown = m_transport->read_as_many_messages_as_possible_without_blocking([&](auto&& raw_message) {
         auto bytes = raw_message.bytes.bytes();
         if (auto message = try_parse_message(bytes, raw_message.attachments)) {
+            if (MessageTracing::is_enabled()) {
+                message->set_received_time(MonotonicTime::now());
+                MessageTracing::record_received_message(*message, bytes.size());
+            }
+            if (message->endpoint_magic() != m_local_endpoint_magic) {
+                auto handlers = m_response_handlers.find(response_handler_key(message->endpoint_magic(), message->message_id()));
+                if (handlers != m_response_handlers.end()) {
+                    m_claimed_response_handlers.append(handlers->value.dequeue());
+                    m_claimed_responses.append(message.release_nonnull());
+                    if (handlers->value.is_empty())
+                        m_response_handlers.remove(handlers);
+                    return;
+                }
+            }
             m_unprocessed_messages.append(message.release_nonnull());
         } else {
             dbgln("Failed to parse IPC message {:hex-dump}", bytes);
@@ -111,7 +217,7 @@ ConnectionBase::PeerEOF ConnectionBase::drain_messages_from_peer()
         schedule_shutdown = Transport::ShouldShutdown::Yes;
     }
 
-    if (!m_unprocessed_messages.is_empty()) {
+    if (!m_unprocessed_messages.is_empty() || !m_claimed_responses.is_empty()) {
         deferred_invoke([this] {
             handle_messages();
         });
@@ -8,8 +8,11 @@
 
 #pragma once
 
+#include <AK/Debug.h>
 #include <AK/Forward.h>
+#include <AK/HashMap.h>
 #include <AK/Queue.h>
+#include <AK/Time.h>
 #include <LibCore/EventReceiver.h>
 #include <LibIPC/Attachment.h>
 #include <LibIPC/Forward.h>
@@ -33,6 +36,16 @@ public:
 
     Transport& transport() const { return *m_transport; }
 
+    struct SynchronousCallStatistics {
+        StringView message_name;
+        u64 call_count { 0 };
+        AK::Duration total_time;
+        AK::Duration longest_time;
+    };
+    // Synchronous calls block the caller until the peer has responded. These statistics exist to find the ones that
+    // are worth migrating to their async_*_with_response() counterparts.
+    static Vector<SynchronousCallStatistics> synchronous_call_statistics();
+
 protected:
     explicit ConnectionBase(IPC::Stub&, NonnullOwnPtr<Transport>, u32 local_endpoint_magic);
 
@@ -40,6 +53,14 @@ protected:
     virtual OwnPtr<Message> try_parse_message(ReadonlyBytes, Queue<Attachment>&) = 0;
 
     OwnPtr<IPC::Message> wait_for_specific_endpoint_message_impl(u32 endpoint_magic, int message_id);
+
+    using ResponseHandler = Function<void(OwnPtr<Message>)>;
+    void add_response_handler(u32 endpoint_magic, int message_id, ResponseHandler);
+    void deliver_responses();
+    void fail_pending_responses();
+
+    static void record_synchronous_call(StringView message_name, AK::Duration);
+
     void wait_for_transport_to_become_readable();
     enum class PeerEOF {
         No,
@@ -55,6 +76,12 @@ protected:
 
     Vector<NonnullOwnPtr<Message>> m_unprocessed_messages;
 
+    // Responses are matched to requests in the order they were sent, per message type. Responses that have a handler
+    // waiting are claimed as soon as they are read, so they can't be mistaken for the response to a later sync call.
+    HashMap<u64, Queue<ResponseHandler>> m_response_handlers;
+    Vector<ResponseHandler> m_claimed_response_handlers;
+    Vector<NonnullOwnPtr<Message>> m_claimed_responses;
+
     u32 m_local_endpoint_magic { 0 };
 };
 
@@ -69,18 +96,44 @@ public:
     template<typename RequestType, typename... Args>
     NonnullOwnPtr<typename RequestType::ResponseType> send_sync(Args&&... args)
     {
+        auto start_time = MonotonicTime::now();
         MUST(post_message(RequestType(forward<Args>(args)...)));
         auto response = wait_for_specific_endpoint_message<typename RequestType::ResponseType, PeerEndpoint>();
         VERIFY(response);
+        record_synchronous_call(RequestType::static_message_name(), MonotonicTime::now() - start_time);
         return response.release_nonnull();
     }
 
     template<typename RequestType, typename... Args>
     OwnPtr<typename RequestType::ResponseType> send_sync_but_allow_failure(Args&&... args)
     {
+        auto start_time = MonotonicTime::now();
         if (post_message(RequestType(forward<Args>(args)...)).is_error())
             return nullptr;
-        return wait_for_specific_endpoint_message<typename RequestType::ResponseType, PeerEndpoint>();
+        auto response = wait_for_specific_endpoint_message<typename RequestType::ResponseType, PeerEndpoint>();
+        record_synchronous_call(RequestType::static_message_name(), MonotonicTime::now() - start_time);
+        return response;
+    }
+
+    // Sends a synchronous message without waiting for its response. The handler is invoked from the event loop once the
+    // response arrives, or with a null response if the peer disconnects first.
+    template<typename RequestType, typename... Args>
+    void send_with_response_handler(Function<void(OwnPtr<typename RequestType::ResponseType>)> on_response, Args&&... args)
+    {
+        using ResponseType = typename RequestType::ResponseType;
+
+        if (post_message(RequestType(forward<Args>(args)...)).is_error()) {
+            on_response(nullptr);
+            return;
+        }
+
+        add_response_handler(PeerEndpoint::static_magic(), ResponseType::static_message_id(), [on_response = move(on_response)](OwnPtr<Message> response) {
+            if (!response) {
+                on_response(nullptr);
+                return;
+            }
+            on_response(response.template release_nonnull<ResponseType>());
+        });
     }
 
 protected:
@@ -8,13 +8,16 @@
 #include <AK/IPv4Address.h>
 #include <AK/IPv6Address.h>
 #include <AK/JsonValue.h>
+#include <AK/MemoryStream.h>
 #include <AK/Types.h>
 #include <AK/Utf16FlyString.h>
 #include <AK/Utf16String.h>
 #include <LibCore/AnonymousBuffer.h>
 #include <LibCore/Proxy.h>
+#include <LibCore/System.h>
 #include <LibIPC/Decoder.h>
 #include <LibIPC/File.h>
+#include <LibIPC/Limits.h>
 #include <LibURL/Parser.h>
 #include <LibURL/URL.h>
 
@@ -32,10 +35,44 @@ ErrorOr<size_t> Decoder::decode_size()
     return size;
 }
 
+// Maps the shared memory that a bulk payload of the given size was promoted to, if the encoder promoted it.
+static ErrorOr<Optional<Core::AnonymousBuffer>> decode_shared_memory_payload(Decoder& decoder, size_t size)
+{
+    if (size < MIN_SHARED_MEMORY_PAYLOAD_SIZE)
+        return OptionalNone {};
+    if (!TRY(decoder.decode<bool>()))
+        return OptionalNone {};
+
+    auto file = TRY(decoder.decode<IPC::File>());
+
+    // Mapping past the end of the file would fault on access, so don't trust the peer about its size.
+    auto stat = TRY(Core::System::fstat(file.fd()));
+    if (stat.st_size < 0 || static_cast<size_t>(stat.st_size) < size)
+        return Error::from_string_literal("IPC decode: Shared memory payload is smaller than its declared size");
+
+    return TRY(Core::AnonymousBuffer::create_from_anon_fd(file.take_fd(), size));
+}
+
+ErrorOr<void> Decoder::decode_bulk_data_into(Bytes bytes)
+{
+    auto shared_memory = TRY(decode_shared_memory_payload(*this, bytes.size()));
+    if (!shared_memory.has_value())
+        return decode_into(bytes);
+
+    shared_memory->bytes().copy_to(bytes);
+    return {};
+}
+
 template<>
 ErrorOr<String> decode(Decoder& decoder)
 {
     auto length = TRY(decoder.decode_size());
+
+    if (auto shared_memory = TRY(decode_shared_memory_payload(decoder, length)); shared_memory.has_value()) {
+        FixedMemoryStream stream { shared_memory->bytes() };
+        return String::from_stream(stream, length);
+    }
+
     return String::from_stream(decoder.stream(), length);
 }
 
@@ -63,7 +100,7 @@ ErrorOr<ByteString> decode(Decoder& decoder)
         return ByteString::empty();
 
     return ByteString::create_and_overwrite(length, [&](Bytes bytes) -> ErrorOr<void> {
-        TRY(decoder.decode_into(bytes));
+        TRY(decoder.decode_bulk_data_into(bytes));
         return {};
     });
 }
@@ -78,7 +115,7 @@ ErrorOr<ByteBuffer> decode(Decoder& decoder)
     auto buffer = TRY(ByteBuffer::create_uninitialized(length));
     auto bytes = buffer.bytes();
 
-    TRY(decoder.decode_into(bytes));
+    TRY(decoder.decode_bulk_data_into(bytes));
     return buffer;
 }
 
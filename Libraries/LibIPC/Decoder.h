@@ -60,6 +60,9 @@ public:
         return {};
     }
 
+    // Reads a payload that was encoded with Encoder::append_bulk_data().
+    ErrorOr<void> decode_bulk_data_into(Bytes);
+
     ErrorOr<size_t> decode_size();
 
     Stream& stream() { return m_stream; }
@@ -158,6 +161,13 @@ ErrorOr<T> decode(Decoder& decoder)
     auto size = TRY(decoder.decode_size());
     if (size != array.size())
         return Error::from_string_literal("Array size mismatch");
+
+    // Arrays of numbers are encoded as a single span, which may have been promoted to shared memory.
+    if constexpr (IsArithmetic<typename T::ValueType>) {
+        TRY(decoder.decode_bulk_data_into({ reinterpret_cast<u8*>(array.data()), array.size() * sizeof(typename T::ValueType) }));
+        return array;
+    }
+
     for (size_t i = 0; i < array.size(); ++i)
         array[i] = TRY(decoder.decode<typename T::ValueType>());
     return array;
@@ -189,7 +199,7 @@ ErrorOr<T> decode(Decoder& decoder)
     if (Checked<size_t>::multiplication_would_overflow(size, sizeof(typename T::ValueType)))
         return Error::from_string_literal("IPC decode: Vector size would overflow");
     TRY(vector.try_resize(size));
-    TRY(decoder.decode_into({ reinterpret_cast<u8*>(vector.data()), size * sizeof(typename T::ValueType) }));
+    TRY(decoder.decode_bulk_data_into({ reinterpret_cast<u8*>(vector.data()), size * sizeof(typename T::ValueType) }));
     return vector;
 }
 
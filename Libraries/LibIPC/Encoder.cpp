@@ -22,6 +22,7 @@
 #include <LibIPC/Attachment.h>
 #include <LibIPC/Encoder.h>
 #include <LibIPC/File.h>
+#include <LibIPC/Limits.h>
 #include <LibURL/Origin.h>
 #include <LibURL/URL.h>
 
@@ -33,6 +34,24 @@ ErrorOr<void> Encoder::encode_size(size_t size)
     return encode(static_cast<u32>(size));
 }
 
+ErrorOr<void> Encoder::append_bulk_data(ReadonlyBytes bytes)
+{
+    if (bytes.size() < MIN_SHARED_MEMORY_PAYLOAD_SIZE)
+        return append(bytes.data(), bytes.size());
+
+    // Past the threshold, a flag tells the decoder whether the payload follows inline or in a shared memory attachment.
+    auto use_shared_memory = m_buffer.attachments().size() < MAX_SHARED_MEMORY_PAYLOADS_PER_MESSAGE;
+    TRY(encode(use_shared_memory));
+
+    if (!use_shared_memory)
+        return append(bytes.data(), bytes.size());
+
+    auto buffer = TRY(Core::AnonymousBuffer::create_with_size(bytes.size()));
+    bytes.copy_to({ buffer.data<u8>(), buffer.size() });
+
+    return encode(TRY(IPC::File::clone_fd(buffer.fd())));
+}
+
 template<>
 ErrorOr<void> encode(Encoder& encoder, float const& value)
 {
@@ -55,7 +74,7 @@ template<>
 ErrorOr<void> encode(Encoder& encoder, StringView const& value)
 {
     TRY(encoder.encode_size(value.length()));
-    TRY(encoder.append(reinterpret_cast<u8 const*>(value.characters_without_null_termination()), value.length()));
+    TRY(encoder.append_bulk_data(value.bytes()));
     return {};
 }
 
@@ -97,7 +116,7 @@ template<>
 ErrorOr<void> encode(Encoder& encoder, ByteBuffer const& value)
 {
     TRY(encoder.encode_size(value.size()));
-    TRY(encoder.append(value.data(), value.size()));
+    TRY(encoder.append_bulk_data(value.bytes()));
     return {};
 }
 
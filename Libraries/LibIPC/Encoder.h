@@ -52,6 +52,10 @@ public:
         return {};
     }
 
+    // Appends the contents of a string, buffer or vector. Large payloads are transparently promoted to shared memory.
+    // This must be paired with Decoder::decode_bulk_data_into().
+    ErrorOr<void> append_bulk_data(ReadonlyBytes);
+
     ErrorOr<void> append_attachment(Attachment attachment)
     {
         TRY(m_buffer.append_attachment(move(attachment)));
@@ -174,7 +178,7 @@ ErrorOr<void> encode(Encoder& encoder, T const& span)
     TRY(encoder.encode_size(span.size()));
 
     VERIFY(!Checked<size_t>::multiplication_would_overflow(span.size(), sizeof(typename T::ElementType)));
-    TRY(encoder.append(reinterpret_cast<u8 const*>(span.data()), span.size() * sizeof(typename T::ElementType)));
+    TRY(encoder.append_bulk_data({ reinterpret_cast<u8 const*>(span.data()), span.size() * sizeof(typename T::ElementType) }));
 
     return {};
 }
@@ -16,4 +16,12 @@ static constexpr size_t MAX_MESSAGE_PAYLOAD_SIZE = 64 * MiB;
 // Maximum number of file descriptors per message
 static constexpr size_t MAX_MESSAGE_FD_COUNT = 128;
 
+// Bulk payloads (strings, byte buffers and vectors of numbers) of at least this size are sent through shared memory
+// rather than being copied through the socket
+static constexpr size_t MIN_SHARED_MEMORY_PAYLOAD_SIZE = 256 * KiB;
+
+// Maximum number of attachments a message may carry before bulk payloads are sent inline again, leaving room for
+// attachments that are not payloads
+static constexpr size_t MAX_SHARED_MEMORY_PAYLOADS_PER_MESSAGE = MAX_MESSAGE_FD_COUNT / 2;
+
 }
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/BuiltinWrappers.h>
+#include <AK/HashMap.h>
+#include <AK/NeverDestroyed.h>
+#include <AK/QuickSort.h>
+#include <LibCore/Environment.h>
+#include <LibIPC/Message.h>
+#include <LibIPC/Tracing.h>
+#include <LibSync/Mutex.h>
+#include <math.h>
+
+namespace IPC {
+
+size_t Histogram::bucket_index_for_value(u64 value)
+{
+    if (value < exact_value_count)
+        return value;
+
+    auto bit_width = 64 - count_leading_zeroes(value);
+    auto shift = bit_width - 5;
+    return exact_value_count + (shift - 1) * sub_bucket_count + ((value >> shift) - sub_bucket_count);
+}
+
+u64 Histogram::highest_equivalent_value(size_t bucket_index)
+{
+    if (bucket_index < exact_value_count)
+        return bucket_index;
+
+    auto index_in_range = bucket_index - exact_value_count;
+    auto shift = index_in_range / sub_bucket_count + 1;
+    auto sub_bucket = index_in_range % sub_bucket_count + sub_bucket_count;
+    return ((sub_bucket + 1) << shift) - 1;
+}
+
+void Histogram::record(u64 value)
+{
+    value = AK::min(value, max_trackable_value);
+
+    ++m_counts[bucket_index_for_value(value)];
+    m_min = m_count ? AK::min(m_min, value) : value;
+    m_max = AK::max(m_max, value);
+    m_total += value;
+    ++m_count;
+}
+
+u64 Histogram::value_at_percentile(double percentile) const
+{
+    if (m_count == 0)
+        return 0;
+
+    percentile = clamp(percentile, 0.0, 100.0);
+    auto target = AK::max<u64>(static_cast<u64>(ceil(percentile / 100.0 * static_cast<double>(m_count))), 1);
+
+    u64 seen = 0;
+    for (size_t i = 0; i < bucket_count; ++i) {
+        seen += m_counts[i];
+        if (seen >= target)
+            return AK::min(highest_equivalent_value(i), m_max);
+    }
+
+    return m_max;
+}
+
+static Sync::Mutex s_message_traces_mutex;
+static NeverDestroyed<HashMap<u64, NonnullOwnPtr<MessageTrace>>> s_message_traces;
+
+static MessageTrace& ensure_message_trace(u32 endpoint_magic, int message_id, StringView message_name)
+{
+    auto key = (static_cast<u64>(endpoint_magic) << 32) | static_cast<u32>(message_id);
+
+    return *s_message_traces->ensure(key, [&] {
+        auto trace = make<MessageTrace>();
+        trace->endpoint_magic = endpoint_magic;
+        trace->message_id = message_id;
+        trace->message_name = message_name;
+        return trace;
+    });
+}
+
+bool MessageTracing::is_enabled()
+{
+    static bool const enabled = Core::Environment::has("LIBIPC_TRACING"sv);
+    return enabled;
+}
+
+void MessageTracing::record_received_message(Message const& message, size_t encoded_size)
+{
+    Sync::MutexLocker locker(s_message_traces_mutex);
+    ensure_message_trace(message.endpoint_magic(), message.message_id(), message.message_name()).encoded_size.record(encoded_size);
+}
+
+void MessageTracing::record_handled_message(u32 endpoint_magic, int message_id, StringView message_name, AK::Duration queueing_delay, AK::Duration handler_time)
+{
+    Sync::MutexLocker locker(s_message_traces_mutex);
+    auto& trace = ensure_message_trace(endpoint_magic, message_id, message_name);
+    trace.queueing_delay.record(AK::max<i64>(queueing_delay.to_microseconds(), 0));
+    trace.handler_time.record(AK::max<i64>(handler_time.to_microseconds(), 0));
+}
+
+Vector<MessageTrace> MessageTracing::traces()
+{
+    Vector<MessageTrace> traces;
+    {
+        Sync::MutexLocker locker(s_message_traces_mutex);
+        traces.ensure_capacity(s_message_traces->size());
+        for (auto const& it : *s_message_traces)
+            traces.unchecked_append(*it.value);
+    }
+
+    quick_sort(traces, [](auto const& a, auto const& b) { return a.handler_time.total() > b.handler_time.total(); });
+    return traces;
+}
+
+void MessageTracing::dump()
+{
+    if (!is_enabled()) {
+        dbgln("IPC message tracing is disabled, set LIBIPC_TRACING to enable it");
+        return;
+    }
+
+    dbgln("IPC message traces (sizes in bytes, times in microseconds):");
+    for (auto const& trace : traces()) {
+        dbgln("  {}: count={} size(p50={} max={}) queued(p50={} p99={} max={}) handler(p50={} p99={} max={} total={})",
+            trace.message_name,
+            trace.encoded_size.count(),
+            trace.encoded_size.value_at_percentile(50),
+            trace.encoded_size.max(),
+            trace.queueing_delay.value_at_percentile(50),
+            trace.queueing_delay.value_at_percentile(99),
+            trace.queueing_delay.max(),
+            trace.handler_time.value_at_percentile(50),
+            trace.handler_time.value_at_percentile(99),
+            trace.handler_time.max(),
+            trace.handler_time.total());
+    }
+}
+
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/StringView.h>
+#include <AK/Time.h>
+#include <AK/Types.h>
+#include <AK/Vector.h>
+#include <LibIPC/Forward.h>
+
+namespace IPC {
+
+// A log-linear histogram in the style of HdrHistogram. Values below 32 are counted exactly, and every power-of-two range
+// above that is divided into 16 linear sub-buckets, so a reported value is within 1/16 of a recorded one.
+class Histogram {
+public:
+    static constexpr u64 max_trackable_value = (1ull << 40) - 1;
+
+    void record(u64 value);
+
+    u64 count() const { return m_count; }
+    u64 min() const { return m_count ? m_min : 0; }
+    u64 max() const { return m_max; }
+    u64 total() const { return m_total; }
+    u64 mean() const { return m_count ? m_total / m_count : 0; }
+
+    // Returns the highest value equivalent to the one below which the given percentage (0-100) of the recorded values fall.
+    u64 value_at_percentile(double percentile) const;
+
+private:
+    static constexpr size_t exact_value_count = 32;
+    static constexpr size_t sub_bucket_count = 16;
+    static constexpr size_t bucket_count = exact_value_count + (40 - 6 + 1) * sub_bucket_count;
+
+    static size_t bucket_index_for_value(u64);
+    static u64 highest_equivalent_value(size_t bucket_index);
+
+    Array<u32, bucket_count> m_counts {};
+    u64 m_count { 0 };
+    u64 m_total { 0 };
+    u64 m_min { 0 };
+    u64 m_max { 0 };
+};
+
+struct MessageTrace {
+    u32 endpoint_magic { 0 };
+    int message_id { 0 };
+    StringView message_name;
+
+    // Encoded message sizes, in bytes.
+    Histogram encoded_size;
+    // Time between a message being read from the transport and its handler being invoked, in microseconds.
+    Histogram queueing_delay;
+    // Time spent in the message's handler, in microseconds.
+    Histogram handler_time;
+};
+
+// Process-wide tracing of received IPC messages, keyed by endpoint magic and message ID. Tracing is enabled by setting
+// the LIBIPC_TRACING environment variable, and costs no more than a single check per message otherwise.
+class MessageTracing {
+public:
+    static bool is_enabled();
+
+    static void record_received_message(Message const&, size_t encoded_size);
+    static void record_handled_message(u32 endpoint_magic, int message_id, StringView message_name, AK::Duration queueing_delay, AK::Duration handler_time);
+
+    // Returns the traces of all messages received so far, sorted by the total time spent in their handlers.
+    static Vector<MessageTrace> traces();
+    static void dump();
+};
+
+}
@@ -66,50 +66,47 @@ void SendQueue::enqueue_message(SocketMessageHeader header, MessageDataType payl
 {
     VERIFY(fds.size() <= Core::LocalSocket::MAX_TRANSFER_FDS);
     Sync::MutexLocker locker(m_mutex);
+    ++m_queued_message_count;
     m_queued_byte_count += sizeof(SocketMessageHeader) + payload.size();
     m_queued_messages.append(QueuedMessage { header, move(payload), fds.size() });
     m_fds.append(fds.data(), fds.size());
 }
 
-SendQueue::BytesAndFds SendQueue::peek(size_t max_bytes)
+SendQueue::BuffersAndFds SendQueue::peek(size_t max_bytes)
 {
     Sync::MutexLocker locker(m_mutex);
-    BytesAndFds result;
+    BuffersAndFds result;
 
     static_assert(Core::LocalSocket::MAX_TRANSFER_FDS == MAX_MESSAGE_FD_COUNT, "IPC message attachments must fit in one sendmsg()");
-    size_t bytes_to_send = 0;
     size_t fds_to_send = 0;
+
+    auto append_buffer = [&](ReadonlyBytes buffer) {
+        buffer = buffer.trim(max_bytes - result.byte_count);
+        if (buffer.is_empty())
+            return;
+        result.buffers.unchecked_append(buffer);
+        result.byte_count += buffer.size();
+    };
+
+    // Messages are appended by other threads while the consumer sends these buffers, which is fine as appending never
+    // moves a queued message. Only the consumer removes messages, and it only does so once they have been sent.
     for (auto const& queued_message : m_queued_messages) {
+        if (result.byte_count >= max_bytes || result.buffers.size() + 2 > MAX_BUFFERS_PER_PEEK)
+            break;
         if (fds_to_send + queued_message.unsent_fd_count > Core::LocalSocket::MAX_TRANSFER_FDS)
             break;
         fds_to_send += queued_message.unsent_fd_count;
-        bytes_to_send += queued_message.size() - queued_message.start_offset;
-        if (bytes_to_send >= max_bytes) {
-            bytes_to_send = max_bytes;
-            break;
-        }
-    }
-
-    result.bytes.resize(bytes_to_send);
-    size_t copied_bytes = 0;
-    for (auto const& queued_message : m_queued_messages) {
-        if (copied_bytes == bytes_to_send)
-            break;
 
         auto start_offset = queued_message.start_offset;
         if (start_offset < sizeof(SocketMessageHeader)) {
             ReadonlyBytes header { reinterpret_cast<u8 const*>(&queued_message.header), sizeof(SocketMessageHeader) };
-            copied_bytes += header.slice(start_offset).copy_trimmed_to(result.bytes.span().slice(copied_bytes));
-            if (copied_bytes == bytes_to_send)
-                break;
+            append_buffer(header.slice(start_offset));
             start_offset = sizeof(SocketMessageHeader);
         }
 
         auto payload_offset = start_offset - sizeof(SocketMessageHeader);
-        if (payload_offset < queued_message.payload.size()) {
-            ReadonlyBytes payload { queued_message.payload.data() + payload_offset, queued_message.payload.size() - payload_offset };
-            copied_bytes += payload.copy_trimmed_to(result.bytes.span().slice(copied_bytes));
-        }
+        if (payload_offset < queued_message.payload.size())
+            append_buffer(queued_message.payload.span().slice(payload_offset));
     }
 
     if (fds_to_send > 0) {
@@ -144,10 +141,23 @@ void SendQueue::discard(size_t bytes_count, size_t fds_count)
         if (queued_message.start_offset == queued_message.size()) {
             VERIFY(queued_message.unsent_fd_count == 0);
             (void)m_queued_messages.remove(m_queued_messages.begin());
+            --m_queued_message_count;
         }
     }
 }
 
+bool SendQueue::has_pending_data()
+{
+    Sync::MutexLocker locker(m_mutex);
+    return m_queued_byte_count > 0 || !m_fds.is_empty();
+}
+
+SendQueue::Depth SendQueue::depth()
+{
+    Sync::MutexLocker locker(m_mutex);
+    return { .message_count = m_queued_message_count, .byte_count = m_queued_byte_count };
+}
+
 TransportSocket::TransportSocket(NonnullOwnPtr<Core::LocalSocket> socket)
     : m_socket(move(socket))
 {
@@ -180,10 +190,7 @@ intptr_t TransportSocket::io_thread_loop()
 {
     Array<struct pollfd, 2> pollfds;
     for (;;) {
-        auto want_to_write = [&] {
-            auto [bytes, fds] = m_send_queue->peek(1);
-            return !bytes.is_empty() || !fds.is_empty();
-        }();
+        auto want_to_write = m_send_queue->has_pending_data();
 
         auto state = m_io_thread_state.load();
         if (state == IOThreadState::Stopped)
@@ -230,13 +237,8 @@ intptr_t TransportSocket::io_thread_loop()
         }
 
         if (pollfds[0].revents & POLLOUT) {
-            auto [bytes, fds] = m_send_queue->peek(4096);
-            if (!bytes.is_empty() || !fds.is_empty()) {
-                ReadonlyBytes remaining = bytes;
-                if (transfer_data(remaining, fds) == TransferState::SocketClosed) {
-                    m_io_thread_state = IOThreadState::Stopped;
-                }
-            }
+            if (transfer_data() == TransferState::SocketClosed)
+                m_io_thread_state = IOThreadState::Stopped;
         }
     }
 
@@ -361,66 +363,56 @@ ErrorOr<void> TransportSocket::post_message(MessageDataType bytes_to_write, Vect
     }
 
     m_send_queue->enqueue_message(header, move(bytes_to_write), move(raw_fds));
+    m_posted_message_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
     wake_io_thread();
     return {};
 }
 
-ErrorOr<void> TransportSocket::send_message(Core::LocalSocket& socket, ReadonlyBytes& bytes_to_write, Vector<int>& unowned_fds)
+TransportSocket::TransferState TransportSocket::transfer_data()
 {
-    auto num_fds_to_transfer = unowned_fds.size();
-    while (!bytes_to_write.is_empty()) {
-        ErrorOr<ssize_t> maybe_nwritten = 0;
-        if (num_fds_to_transfer > 0) {
-            maybe_nwritten = socket.send_message(bytes_to_write, 0, unowned_fds);
-        } else {
-            maybe_nwritten = socket.write_some(bytes_to_write);
-        }
+    // Everything that was posted since we last got to send goes out in as few sendmsg() calls as possible, gathered
+    // straight from the queued messages.
+    for (;;) {
+        auto [buffers, byte_count, fds] = m_send_queue->peek(SOCKET_BUFFER_SIZE);
+        if (byte_count == 0 && fds.is_empty())
+            return TransferState::Continue;
 
+        m_send_syscall_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+        auto maybe_nwritten = m_socket->send_message(buffers.span(), 0, fds);
         if (maybe_nwritten.is_error()) {
-            if (auto error = maybe_nwritten.release_error(); error.is_errno() && (error.code() == EAGAIN || error.code() == EWOULDBLOCK || error.code() == EINTR)) {
-                return {};
-            } else {
-                return error;
-            }
-        }
-
-        bytes_to_write = bytes_to_write.slice(maybe_nwritten.value());
-        num_fds_to_transfer = 0;
-        unowned_fds.clear();
-    }
-    return {};
-}
-
-TransportSocket::TransferState TransportSocket::transfer_data(ReadonlyBytes& bytes, Vector<int>& fds)
-{
-    auto byte_count = bytes.size();
-    auto fd_count = fds.size();
+            auto error = maybe_nwritten.release_error();
+            if (error.is_errno() && (error.code() == EAGAIN || error.code() == EWOULDBLOCK || error.code() == EINTR))
+                return TransferState::Continue;
 
-    if (auto result = send_message(*m_socket, bytes, fds); result.is_error()) {
-        if (result.error().is_errno() && result.error().code() == EPIPE) {
-            // The socket is closed from the other end, we can stop sending.
+            // EPIPE means the socket is closed from the other end, we can stop sending.
+            if (!error.is_errno() || error.code() != EPIPE)
+                dbgln("TransportSocket::send_thread: {}", error);
             return TransferState::SocketClosed;
         }
 
-        dbgln("TransportSocket::send_thread: {}", result.error());
-        return TransferState::SocketClosed;
-    }
-
-    auto written_byte_count = byte_count - bytes.size();
-    auto written_fd_count = fd_count - fds.size();
-    if (written_byte_count > 0 || written_fd_count > 0)
-        m_send_queue->discard(written_byte_count, written_fd_count);
+        // Any fds are sent along with the first byte, so they are gone as soon as anything has been written.
+        auto written_byte_count = maybe_nwritten.value();
+        auto written_fd_count = written_byte_count > 0 ? fds.size() : 0;
+        if (written_byte_count > 0 || written_fd_count > 0)
+            m_send_queue->discard(written_byte_count, written_fd_count);
+        m_sent_byte_count.fetch_add(written_byte_count, AK::MemoryOrder::memory_order_relaxed);
 
-    return TransferState::Continue;
+        // A short write means the socket buffer is full, so wait for POLLOUT before trying again.
+        if (written_byte_count < byte_count)
+            return TransferState::Continue;
+    }
 }
 
 void TransportSocket::read_incoming_messages()
 {
     Vector<NonnullOwnPtr<Message>> batch;
+    if (m_receive_buffer.is_empty())
+        m_receive_buffer.resize(64 * KiB);
+
     while (m_socket->is_open()) {
-        u8 buffer[4096];
         auto received_fds = Vector<int> {};
-        auto maybe_bytes_read = m_socket->receive_message({ buffer, 4096 }, MSG_DONTWAIT, received_fds);
+        m_receive_syscall_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+        auto maybe_bytes_read = m_socket->receive_message(m_receive_buffer, MSG_DONTWAIT, received_fds);
         if (maybe_bytes_read.is_error()) {
             auto error = maybe_bytes_read.release_error();
 
@@ -443,6 +435,7 @@ void TransportSocket::read_incoming_messages()
             m_peer_eof = true;
             break;
         }
+        m_received_byte_count.fetch_add(bytes_read.size(), AK::MemoryOrder::memory_order_relaxed);
 
         if (m_unprocessed_bytes.size() + bytes_read.size() > MAX_UNPROCESSED_BUFFER_SIZE) {
             dbgln("TransportSocket: Unprocessed buffer would exceed {} bytes, disconnecting peer", MAX_UNPROCESSED_BUFFER_SIZE);
@@ -570,6 +563,8 @@ void TransportSocket::read_incoming_messages()
         m_unprocessed_bytes.clear();
     }
 
+    m_received_message_count.fetch_add(batch.size(), AK::MemoryOrder::memory_order_relaxed);
+
     bool const peer_eof = m_peer_eof;
     if (!batch.is_empty() || peer_eof) {
         Sync::MutexLocker locker(m_incoming_mutex);
@@ -598,6 +593,21 @@ TransportSocket::ShouldShutdown TransportSocket::read_as_many_messages_as_possib
     return eof ? ShouldShutdown::Yes : ShouldShutdown::No;
 }
 
+TransportSocket::Statistics TransportSocket::statistics() const
+{
+    auto depth = m_send_queue->depth();
+    return {
+        .posted_message_count = m_posted_message_count.load(AK::MemoryOrder::memory_order_relaxed),
+        .sent_byte_count = m_sent_byte_count.load(AK::MemoryOrder::memory_order_relaxed),
+        .send_syscall_count = m_send_syscall_count.load(AK::MemoryOrder::memory_order_relaxed),
+        .received_message_count = m_received_message_count.load(AK::MemoryOrder::memory_order_relaxed),
+        .received_byte_count = m_received_byte_count.load(AK::MemoryOrder::memory_order_relaxed),
+        .receive_syscall_count = m_receive_syscall_count.load(AK::MemoryOrder::memory_order_relaxed),
+        .queued_message_count = depth.message_count,
+        .queued_byte_count = depth.byte_count,
+    };
+}
+
 ErrorOr<TransportHandle> TransportSocket::release_for_transfer()
 {
     m_is_being_transferred.store(true, AK::MemoryOrder::memory_order_release);
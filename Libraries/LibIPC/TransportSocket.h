@@ -34,14 +34,28 @@ struct SocketMessageHeader {
 
 class SendQueue : public AtomicRefCounted<SendQueue> {
 public:
+    static constexpr size_t MAX_BUFFERS_PER_PEEK = 64;
+
     void enqueue_message(SocketMessageHeader, MessageDataType payload, Vector<int>&& fds);
-    struct BytesAndFds {
-        Vector<u8> bytes;
+
+    // The buffers point into the queued messages, so they remain valid until the consumed bytes are discarded.
+    // NOTE: There must only be a single consumer, which is the only one allowed to call peek() and discard().
+    struct BuffersAndFds {
+        Vector<ReadonlyBytes, MAX_BUFFERS_PER_PEEK> buffers;
+        size_t byte_count { 0 };
         Vector<int> fds;
     };
-    BytesAndFds peek(size_t max_bytes);
+    BuffersAndFds peek(size_t max_bytes);
     void discard(size_t bytes_count, size_t fds_count);
 
+    bool has_pending_data();
+
+    struct Depth {
+        size_t message_count { 0 };
+        size_t byte_count { 0 };
+    };
+    Depth depth();
+
 private:
     struct QueuedMessage {
         SocketMessageHeader header;
@@ -53,6 +67,7 @@ private:
     };
 
     SinglyLinkedList<QueuedMessage, AK::DefaultSizeCalculationPolicy> m_queued_messages;
+    size_t m_queued_message_count { 0 };
     size_t m_queued_byte_count { 0 };
     Vector<int> m_fds;
     Sync::Mutex m_mutex;
@@ -95,6 +110,19 @@ public:
     };
     ShouldShutdown read_as_many_messages_as_possible_without_blocking(Function<void(Message&&)>&&);
 
+    // Cumulative counters for this transport. Rates can be derived by sampling them periodically.
+    struct Statistics {
+        u64 posted_message_count { 0 };
+        u64 sent_byte_count { 0 };
+        u64 send_syscall_count { 0 };
+        u64 received_message_count { 0 };
+        u64 received_byte_count { 0 };
+        u64 receive_syscall_count { 0 };
+        size_t queued_message_count { 0 };
+        size_t queued_byte_count { 0 };
+    };
+    Statistics statistics() const;
+
     ErrorOr<TransportHandle> release_for_transfer();
 
     // Test seam: When set to a non-zero value, the IO thread wakes the consumer and then pauses for the given duration
@@ -113,9 +141,7 @@ private:
         Continue,
         SocketClosed,
     };
-    [[nodiscard]] TransferState transfer_data(ReadonlyBytes& bytes, Vector<int>& fds);
-
-    static ErrorOr<void> send_message(Core::LocalSocket&, ReadonlyBytes& bytes, Vector<int>& unowned_fds);
+    [[nodiscard]] TransferState transfer_data();
 
     enum class IOThreadState {
         Running,
@@ -141,6 +167,7 @@ private:
     Atomic<IOThreadState> m_io_thread_state { IOThreadState::Running };
     Atomic<bool> m_is_being_transferred { false };
     Atomic<bool> m_peer_eof { false };
+    ByteBuffer m_receive_buffer;
     ByteBuffer m_unprocessed_bytes;
     Queue<Attachment> m_unprocessed_attachments;
     Sync::Mutex m_incoming_mutex;
@@ -150,6 +177,13 @@ private:
     // batch of messages have been parsed and appended to m_incoming_messages under the same lock.
     bool m_incoming_eof { false };
 
+    Atomic<u64> m_posted_message_count { 0 };
+    Atomic<u64> m_sent_byte_count { 0 };
+    Atomic<u64> m_send_syscall_count { 0 };
+    Atomic<u64> m_received_message_count { 0 };
+    Atomic<u64> m_received_byte_count { 0 };
+    Atomic<u64> m_receive_syscall_count { 0 };
+
     static Atomic<u32> s_eof_drain_window_for_test_ms;
     static Atomic<bool> s_skip_inloop_read_for_test;
 
@@ -17,6 +17,7 @@ Client::Client(NonnullOwnPtr<IPC::Transport> transport)
 void Client::die()
 {
     verify_event_loop();
+    m_partial_image_callbacks.clear();
     auto pending_promises = move(m_token_promises);
 
     for (auto& promise : pending_promises)
@@ -55,6 +56,69 @@ NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes en
     return promise;
 }
 
+i64 Client::begin_incremental_decode(Function<void(PartialImage&)> on_partial_image, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
+{
+    verify_event_loop();
+    auto promise = Core::Promise<DecodedImage>::construct();
+    if (on_resolved)
+        promise->on_resolution = move(on_resolved);
+    if (on_rejected)
+        promise->on_rejection = move(on_rejected);
+
+    i64 request_id = m_next_request_id++;
+    m_token_promises.set(request_id, move(promise));
+    if (on_partial_image)
+        m_partial_image_callbacks.set(request_id, move(on_partial_image));
+
+    async_begin_incremental_decode(ideal_size, mime_type, request_id);
+
+    return request_id;
+}
+
+void Client::append_incremental_decode_data(i64 request_id, ReadonlyBytes encoded_data)
+{
+    verify_event_loop();
+    if (encoded_data.is_empty() || !m_token_promises.contains(request_id))
+        return;
+
+    auto encoded_buffer_or_error = Core::AnonymousBuffer::create_with_size(encoded_data.size());
+    if (encoded_buffer_or_error.is_error()) {
+        dbgln("Could not allocate encoded buffer: {}", encoded_buffer_or_error.error());
+        auto promise = m_token_promises.take(request_id).release_value();
+        cancel_decoding(request_id);
+        promise->reject(encoded_buffer_or_error.release_error());
+        return;
+    }
+    auto encoded_buffer = encoded_buffer_or_error.release_value();
+
+    memcpy(encoded_buffer.data<void>(), encoded_data.data(), encoded_data.size());
+
+    async_append_incremental_decode_data(encoded_buffer, request_id);
+}
+
+void Client::finish_incremental_decode(i64 request_id)
+{
+    verify_event_loop();
+    m_partial_image_callbacks.remove(request_id);
+    if (m_token_promises.contains(request_id))
+        async_finish_incremental_decode(request_id);
+}
+
+void Client::cancel_decoding(i64 request_id)
+{
+    verify_event_loop();
+    m_partial_image_callbacks.remove(request_id);
+    m_token_promises.remove(request_id);
+    async_cancel_decoding(request_id);
+}
+
+void Client::set_decode_priority(i64 request_id, bool is_visible)
+{
+    verify_event_loop();
+    if (m_token_promises.contains(request_id))
+        async_set_decode_priority(request_id, is_visible);
+}
+
 void Client::did_decode_image(i64 request_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space, i64 session_id)
 {
     verify_event_loop();
@@ -114,6 +178,23 @@ void Client::did_fail_to_decode_image(i64 request_id, String error_message)
     promise->reject(Error::from_string_literal("Image decoding failed or aborted"));
 }
 
+void Client::did_decode_partial_image(i64 request_id, Gfx::BitmapSequence bitmap_sequence, Gfx::ColorSpace color_space)
+{
+    verify_event_loop();
+    auto callback = m_partial_image_callbacks.get(request_id);
+    if (!callback.has_value())
+        return;
+
+    auto& bitmaps = bitmap_sequence.bitmaps;
+    if (bitmaps.is_empty() || !bitmaps.first()) {
+        dbgln("ImageDecoderClient: Invalid partial bitmap for request {}", request_id);
+        return;
+    }
+
+    PartialImage image { bitmaps.first().release_nonnull(), move(color_space) };
+    callback.value()(image);
+}
+
 void Client::did_decode_animation_frames(i64 session_id, Gfx::BitmapSequence bitmap_sequence)
 {
     verify_event_loop();
@@ -32,6 +32,11 @@ struct DecodedImage {
     i64 session_id { 0 };
 };
 
+struct PartialImage {
+    NonnullRefPtr<Gfx::Bitmap> bitmap;
+    Gfx::ColorSpace color_space;
+};
+
 class Client final
     : public IPC::ConnectionToServer<ImageDecoderClientEndpoint, ImageDecoderServerEndpoint>
     , public ImageDecoderClientEndpoint {
@@ -44,6 +49,17 @@ public:
 
     NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}, Optional<ByteString> mime_type = {});
 
+    // Starts decoding an image whose encoded data arrives in chunks, and returns the request id to pass along with
+    // them. While data is still arriving, on_partial_image is called with the first frame decoded from what has
+    // arrived so far, where the format allows it. The final image is delivered once the decode is finished.
+    i64 begin_incremental_decode(Function<void(PartialImage&)> on_partial_image, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}, Optional<ByteString> mime_type = {});
+    void append_incremental_decode_data(i64 request_id, ReadonlyBytes);
+    void finish_incremental_decode(i64 request_id);
+    void cancel_decoding(i64 request_id);
+
+    // Decodes of images that are out of view are only worked on once all visible ones have been started.
+    void set_decode_priority(i64 request_id, bool is_visible);
+
     void request_animation_frames(i64 session_id, u32 start_frame_index, u32 count);
     void stop_animation_decode(i64 session_id);
 
@@ -57,6 +73,7 @@ private:
 
     virtual void did_decode_image(i64 request_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space, i64 session_id) override;
     virtual void did_fail_to_decode_image(i64 request_id, String error_message) override;
+    virtual void did_decode_partial_image(i64 request_id, Gfx::BitmapSequence bitmap_sequence, Gfx::ColorSpace color_space) override;
 
     virtual void did_decode_animation_frames(i64 session_id, Gfx::BitmapSequence bitmaps) override;
     virtual void did_fail_animation_decode(i64 session_id, String error_message) override;
@@ -64,6 +81,7 @@ private:
     Core::EventLoop* m_creation_event_loop { &Core::EventLoop::current() };
     i64 m_next_request_id { 0 };
     HashMap<i64, NonnullRefPtr<Core::Promise<DecodedImage>>> m_token_promises;
+    HashMap<i64, Function<void(PartialImage&)>> m_partial_image_callbacks;
 };
 
 }
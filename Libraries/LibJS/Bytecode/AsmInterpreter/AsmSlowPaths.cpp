@@ -8,12 +8,14 @@
 #include <AK/ScopeGuard.h>
 #include <AK/Types.h>
 #include <LibJS/Bytecode/Builtins.h>
+#include <LibJS/Bytecode/Debug.h>
 #include <LibJS/Bytecode/Instruction.h>
 #include <LibJS/Bytecode/Op.h>
 #include <LibJS/Bytecode/PropertyAccess.h>
 #include <LibJS/Bytecode/PropertyNameIterator.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/ArrayIterator.h>
 #include <LibJS/Runtime/AsyncFromSyncIteratorPrototype.h>
 #include <LibJS/Runtime/AsyncGenerator.h>
 #include <LibJS/Runtime/ClassConstruction.h>
@@ -24,6 +26,8 @@
 #include <LibJS/Runtime/GeneratorObject.h>
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/Iterator.h>
+#include <LibJS/Runtime/KeyedCollections.h>
+#include <LibJS/Runtime/Map.h>
 #include <LibJS/Runtime/MathObject.h>
 #include <LibJS/Runtime/ModuleEnvironment.h>
 #include <LibJS/Runtime/Object.h>
@@ -67,6 +71,21 @@ static i64 handle_asm_exception(VM& vm, u32 pc, Value exception)
         asm_try_result.release_value();                                                                  \
     })
 
+static ALWAYS_INLINE void record_type_feedback(VM& vm, u32 pc, Value lhs, Value rhs)
+{
+    if (!g_collect_type_feedback) [[likely]]
+        return;
+    Value operands[] = { lhs, rhs };
+    vm.current_executable().record_type_feedback(pc, operands);
+}
+
+static ALWAYS_INLINE void record_call_feedback(VM& vm, u32 pc, Value callee)
+{
+    if (!g_collect_type_feedback) [[likely]]
+        return;
+    vm.current_executable().record_call_feedback(pc, callee);
+}
+
 template<typename Op>
 static i64 advance_or_continue(u32 pc, i64 next_pc)
 {
@@ -726,48 +745,56 @@ i64 asm_fallback_handler(VM*, u32, u8 const*)
 
 i64 asm_slow_path_add(VM* vm, u32 pc, Op::Add const* instruction)
 {
+    record_type_feedback(*vm, pc, vm->get(instruction->lhs()), vm->get(instruction->rhs()));
     vm->set(instruction->dst(), ASM_TRY(*vm, pc, add(*vm, vm->get(instruction->lhs()), vm->get(instruction->rhs()))));
     return static_cast<i64>(pc + sizeof(Op::Add));
 }
 
 i64 asm_slow_path_sub(VM* vm, u32 pc, Op::Sub const* instruction)
 {
+    record_type_feedback(*vm, pc, vm->get(instruction->lhs()), vm->get(instruction->rhs()));
     vm->set(instruction->dst(), ASM_TRY(*vm, pc, sub(*vm, vm->get(instruction->lhs()), vm->get(instruction->rhs()))));
     return static_cast<i64>(pc + sizeof(Op::Sub));
 }
 
 i64 asm_slow_path_mul(VM* vm, u32 pc, Op::Mul const* instruction)
 {
+    record_type_feedback(*vm, pc, vm->get(instruction->lhs()), vm->get(instruction->rhs()));
     vm->set(instruction->dst(), ASM_TRY(*vm, pc, mul(*vm, vm->get(instruction->lhs()), vm->get(instruction->rhs()))));
     return static_cast<i64>(pc + sizeof(Op::Mul));
 }
 
 i64 asm_slow_path_div(VM* vm, u32 pc, Op::Div const* instruction)
 {
+    record_type_feedback(*vm, pc, vm->get(instruction->lhs()), vm->get(instruction->rhs()));
     vm->set(instruction->dst(), ASM_TRY(*vm, pc, div(*vm, vm->get(instruction->lhs()), vm->get(instruction->rhs()))));
     return static_cast<i64>(pc + sizeof(Op::Div));
 }
 
 i64 asm_slow_path_less_than(VM* vm, u32 pc, Op::LessThan const* instruction)
 {
+    record_type_feedback(*vm, pc, vm->get(instruction->lhs()), vm->get(instruction->rhs()));
     vm->set(instruction->dst(), Value { ASM_TRY(*vm, pc, less_than(*vm, vm->get(instruction->lhs()), vm->get(instruction->rhs()))) });
     return static_cast<i64>(pc + sizeof(Op::LessThan));
 }
 
 i64 asm_slow_path_less_than_equals(VM* vm, u32 pc, Op::LessThanEquals const* instruction)
 {
+    record_type_feedback(*vm, pc, vm->get(instruction->lhs()), vm->get(instruction->rhs()));
     vm->set(instruction->dst(), Value { ASM_TRY(*vm, pc, less_than_equals(*vm, vm->get(instruction->lhs()), vm->get(instruction->rhs()))) });
     return static_cast<i64>(pc + sizeof(Op::LessThanEquals));
 }
 
 i64 asm_slow_path_greater_than(VM* vm, u32 pc, Op::GreaterThan const* instruction)
 {
+    record_type_feedback(*vm, pc, vm->get(instruction->lhs()), vm->get(instruction->rhs()));
     vm->set(instruction->dst(), Value { ASM_TRY(*vm, pc, greater_than(*vm, vm->get(instruction->lhs()), vm->get(instruction->rhs()))) });
     return static_cast<i64>(pc + sizeof(Op::GreaterThan));
 }
 
 i64 asm_slow_path_greater_than_equals(VM* vm, u32 pc, Op::GreaterThanEquals const* instruction)
 {
+    record_type_feedback(*vm, pc, vm->get(instruction->lhs()), vm->get(instruction->rhs()));
     vm->set(instruction->dst(), Value { ASM_TRY(*vm, pc, greater_than_equals(*vm, vm->get(instruction->lhs()), vm->get(instruction->rhs()))) });
     return static_cast<i64>(pc + sizeof(Op::GreaterThanEquals));
 }
@@ -798,6 +825,7 @@ i64 asm_slow_path_decrement(VM* vm, u32 pc, Op::Decrement const* instruction)
     {                                                                                         \
         auto lhs = vm->get(instruction->lhs());                                               \
         auto rhs = vm->get(instruction->rhs());                                               \
+        record_type_feedback(*vm, pc, lhs, rhs);                                              \
         if (ASM_TRY(*vm, pc, compare_call))                                                   \
             return static_cast<i64>(instruction->true_target().address());                    \
         return static_cast<i64>(instruction->false_target().address());                       \
@@ -1381,6 +1409,7 @@ NEVER_INLINE static ThrowCompletionOr<void> execute_asm_call(
 
 i64 asm_slow_path_call(VM* vm, u32 pc, Op::Call const* instruction)
 {
+    record_call_feedback(*vm, pc, vm->get(instruction->callee()));
     ASM_TRY(*vm, pc, execute_asm_call(Op::CallType::Call, *vm, vm->get(instruction->callee()), vm->get(instruction->this_value()), instruction->arguments(), instruction->dst(), instruction->expression_string(), instruction->strict()));
     return static_cast<i64>(pc + instruction->length());
 }
@@ -1581,6 +1610,16 @@ i64 asm_slow_path_iterator_to_array(VM* vm, u32 pc, Op::IteratorToArray const* i
         .next_method = vm->get(instruction->iterator_next_method())
     };
 
+    // OPTIMIZATION: The rest of a simple packed array iterated by the built-in next() is copied straight out of its storage.
+    if (auto* array_iterator = as_if<ArrayIterator>(*iterator_record.iterator); array_iterator && !iterator_record.done
+        && array_iterator->as_builtin_iterator_if_next_is_not_redefined(iterator_record.next_method)) {
+        if (auto array = array_iterator->take_remaining_values_if_simple_packed_array(*vm->current_realm())) {
+            vm->set(instruction->iterator_done_property(), Value(true));
+            vm->set(instruction->dst(), array);
+            return static_cast<i64>(pc + sizeof(Op::IteratorToArray));
+        }
+    }
+
     auto array = MUST(JS::Array::create(*vm->current_realm(), 0));
     size_t index = 0;
     while (true) {
@@ -1684,6 +1723,62 @@ JS_DEFINE_UNARY_BUILTIN_CALL_SLOW_PATH(StringFromCharCode, string_from_char_code
 JS_DEFINE_UNARY_GENERIC_BUILTIN_CALL_SLOW_PATH(StringPrototypeCharCodeAt, string_prototype_char_code_at)
 JS_DEFINE_UNARY_GENERIC_BUILTIN_CALL_SLOW_PATH(StringPrototypeCharAt, string_prototype_char_at)
 
+// Appending a single value to a packed array is common enough to skip the ExecutionContext setup of a native call.
+// This mirrors the fast path at the top of ArrayPrototype::push.
+i64 asm_slow_path_call_builtin_array_prototype_push(VM* vm, u32 pc, Op::CallBuiltinArrayPrototypePush const* instruction)
+{
+    auto callee = vm->get(instruction->callee());
+    auto this_value = vm->get(instruction->this_value());
+    if (callee.is_function() && callee.as_function().builtin() == Builtin::ArrayPrototypePush && this_value.is_object()) {
+        if (auto* array = as_if<Array>(this_value.as_object()); array && array->is_simple_packed_array()
+            && array->default_prototype_chain_intact()
+            && array->extensible()
+            && array->length_is_writable()) {
+            array->indexed_append(vm->get(instruction->argument()));
+            vm->set(instruction->dst(), Value(array->indexed_array_like_size()));
+            return static_cast<i64>(pc + sizeof(Op::CallBuiltinArrayPrototypePush));
+        }
+    }
+    Operand arguments[] { instruction->argument() };
+    ASM_TRY(*vm, pc, execute_asm_call(Op::CallType::Call, *vm, callee, this_value, arguments, instruction->dst(), instruction->expression_string(), instruction->strict()));
+    return static_cast<i64>(pc + sizeof(Op::CallBuiltinArrayPrototypePush));
+}
+
+// Map lookups and updates in hot loops are common enough to skip the ExecutionContext setup of a native call too.
+// These mirror MapPrototype::get and MapPrototype::set.
+i64 asm_slow_path_call_builtin_map_prototype_get(VM* vm, u32 pc, Op::CallBuiltinMapPrototypeGet const* instruction)
+{
+    auto callee = vm->get(instruction->callee());
+    auto this_value = vm->get(instruction->this_value());
+    if (callee.is_function() && callee.as_function().builtin() == Builtin::MapPrototypeGet && this_value.is_object()) {
+        if (auto* map = as_if<Map>(this_value.as_object())) {
+            auto key = canonicalize_keyed_collection_key(vm->get(instruction->argument()));
+            vm->set(instruction->dst(), map->map_get(key).value_or(js_undefined()));
+            return static_cast<i64>(pc + sizeof(Op::CallBuiltinMapPrototypeGet));
+        }
+    }
+    Operand arguments[] { instruction->argument() };
+    ASM_TRY(*vm, pc, execute_asm_call(Op::CallType::Call, *vm, callee, this_value, arguments, instruction->dst(), instruction->expression_string(), instruction->strict()));
+    return static_cast<i64>(pc + sizeof(Op::CallBuiltinMapPrototypeGet));
+}
+
+i64 asm_slow_path_call_builtin_map_prototype_set(VM* vm, u32 pc, Op::CallBuiltinMapPrototypeSet const* instruction)
+{
+    auto callee = vm->get(instruction->callee());
+    auto this_value = vm->get(instruction->this_value());
+    if (callee.is_function() && callee.as_function().builtin() == Builtin::MapPrototypeSet && this_value.is_object()) {
+        if (auto* map = as_if<Map>(this_value.as_object())) {
+            auto key = canonicalize_keyed_collection_key(vm->get(instruction->argument0()));
+            map->map_set(key, vm->get(instruction->argument1()));
+            vm->set(instruction->dst(), map);
+            return static_cast<i64>(pc + sizeof(Op::CallBuiltinMapPrototypeSet));
+        }
+    }
+    Operand arguments[] { instruction->argument0(), instruction->argument1() };
+    ASM_TRY(*vm, pc, execute_asm_call(Op::CallType::Call, *vm, callee, this_value, arguments, instruction->dst(), instruction->expression_string(), instruction->strict()));
+    return static_cast<i64>(pc + sizeof(Op::CallBuiltinMapPrototypeSet));
+}
+
 #undef JS_DEFINE_BINARY_GENERIC_BUILTIN_CALL_SLOW_PATH
 #undef JS_DEFINE_UNARY_GENERIC_BUILTIN_CALL_SLOW_PATH
 #undef JS_DEFINE_GENERIC_BUILTIN_CALL_SLOW_PATH
@@ -1921,6 +2016,7 @@ i64 asm_slow_path_unsigned_right_shift(VM* vm, u32 pc, Op::UnsignedRightShift co
 
 i64 asm_slow_path_mod(VM* vm, u32 pc, Op::Mod const* instruction)
 {
+    record_type_feedback(*vm, pc, vm->get(instruction->lhs()), vm->get(instruction->rhs()));
     vm->set(instruction->dst(), ASM_TRY(*vm, pc, mod(*vm, vm->get(instruction->lhs()), vm->get(instruction->rhs()))));
     return static_cast<i64>(pc + sizeof(Op::Mod));
 }
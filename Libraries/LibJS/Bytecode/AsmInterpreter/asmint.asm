@@ -791,9 +791,16 @@ end
 # Control flow
 # ============================================================================
 
+# Backward jumps are loop back edges; count them for tier-up decisions.
 handler Jump
-    temp target
+    temp target, exe
     load_label target, m_target
+    branch_ge_unsigned pc, target, .back_edge
+    goto_handler target
+.back_edge:
+    load64 exe, [exec_ctx, EXECUTION_CONTEXT_EXECUTABLE]
+    assert_nonzero exe
+    inc32_mem [exe, EXECUTABLE_BACK_EDGE_COUNT]
     goto_handler target
 end
 
@@ -1789,6 +1796,14 @@ handler PutByValue
     assert_nonzero elements
     load_operand src, m_src
     store64 [elements, index, 8], src
+    extract_tag kind_byte, src
+    branch_ne kind_byte, INT32_TAG, .packed_non_int32_store
+    dispatch_next
+.packed_non_int32_store:
+    # Keep the elements kind conservative. A double only needs Number, but
+    # Generic is always correct and keeps this path short.
+    mov kind_byte, INDEXED_ELEMENTS_KIND_GENERIC
+    store8 [obj, OBJECT_INDEXED_ELEMENTS_KIND], kind_byte
     dispatch_next
 .not_packed:
     branch_ne storage_kind, INDEXED_STORAGE_KIND_HOLEY, .slow
@@ -2425,6 +2440,7 @@ handler Call
     store_pair64 [frame_base, EXECUTION_CONTEXT_LEXICAL_ENVIRONMENT], [frame_base, EXECUTION_CONTEXT_VARIABLE_ENVIRONMENT], lex_env, lex_env
     store64 [frame_base, EXECUTION_CONTEXT_PRIVATE_ENVIRONMENT], priv_env
     store_pair64 [frame_base, EXECUTION_CONTEXT_THIS_VALUE], [frame_base, EXECUTION_CONTEXT_EXECUTABLE], this_value, exec_ptr
+    inc32_mem [exec_ptr, EXECUTABLE_CALL_COUNT]
 
     mov empty_tag, EMPTY_TAG_SHIFTED
     store_pair64 [value_tail, ACCUMULATOR_REG_OFFSET], [value_tail, EXCEPTION_REG_OFFSET], empty_tag, empty_tag
@@ -2994,6 +3010,18 @@ handler CallBuiltinStringPrototypeCharAt
     call_slow_path asm_slow_path_call_builtin_string_prototype_char_at
 end
 
+handler CallBuiltinArrayPrototypePush @cold
+    call_slow_path asm_slow_path_call_builtin_array_prototype_push
+end
+
+handler CallBuiltinMapPrototypeGet @cold
+    call_slow_path asm_slow_path_call_builtin_map_prototype_get
+end
+
+handler CallBuiltinMapPrototypeSet @cold
+    call_slow_path asm_slow_path_call_builtin_map_prototype_set
+end
+
 # ============================================================================
 # Slow-path-only handlers
 # ============================================================================
@@ -55,6 +55,7 @@ int main()
     EMIT_OFFSET(OBJECT_NAMED_PROPERTIES, Object, m_named_properties);
     EMIT_OFFSET(OBJECT_INDEXED_ELEMENTS, Object, m_indexed_elements);
     EMIT_OFFSET(OBJECT_INDEXED_STORAGE_KIND, Object, m_indexed_storage_kind);
+    EMIT_OFFSET(OBJECT_INDEXED_ELEMENTS_KIND, Object, m_indexed_elements_kind);
     EMIT_OFFSET(OBJECT_INDEXED_ARRAY_LIKE_SIZE, Object, m_indexed_array_like_size);
     EMIT_SIZEOF(OBJECT_SIZE, Object);
 
@@ -130,6 +131,8 @@ int main()
     EMIT_OFFSET(EXECUTABLE_REGISTERS_AND_LOCALS_AND_CONSTANTS_COUNT, Executable, registers_and_locals_and_constants_count);
     EMIT_OFFSET(EXECUTABLE_ASM_CONSTANTS_SIZE, Executable, asm_constants_size);
     EMIT_OFFSET(EXECUTABLE_ASM_CONSTANTS_DATA, Executable, asm_constants_data);
+    EMIT_OFFSET(EXECUTABLE_CALL_COUNT, Executable, call_count);
+    EMIT_OFFSET(EXECUTABLE_BACK_EDGE_COUNT, Executable, back_edge_count);
 
     // ExecutionContext layout
     outln("\n# ExecutionContext layout");
@@ -194,6 +197,7 @@ int main()
     outln("const INDEXED_STORAGE_KIND_PACKED = {}", static_cast<u8>(IndexedStorageKind::Packed));
     outln("const INDEXED_STORAGE_KIND_HOLEY = {}", static_cast<u8>(IndexedStorageKind::Holey));
     outln("const INDEXED_STORAGE_KIND_DICTIONARY = {}", static_cast<u8>(IndexedStorageKind::Dictionary));
+    outln("const INDEXED_ELEMENTS_KIND_GENERIC = {}", static_cast<u8>(IndexedElementsKind::Generic));
 
     // ObjectPropertyIteratorFastPath enum values
     outln("\n# ObjectPropertyIteratorFastPath enum values");
@@ -11,5 +11,8 @@
 namespace JS::Bytecode {
 
 JS_API extern bool g_dump_bytecode;
+JS_API extern bool g_collect_type_feedback;
+
+JS_API void dump_type_feedback();
 
 }
@@ -7,14 +7,18 @@
 #include <AK/BinarySearch.h>
 #include <AK/NeverDestroyed.h>
 #include <AK/NumericLimits.h>
+#include <AK/QuickSort.h>
 #include <AK/StdLibExtras.h>
 #include <LibGC/Heap.h>
 #include <LibGC/HeapBlock.h>
+#include <LibGC/WeakInlines.h>
+#include <LibJS/Bytecode/Debug.h>
 #include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/Instruction.h>
 #include <LibJS/Bytecode/Op.h>
 #include <LibJS/Bytecode/RegexTable.h>
 #include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/FunctionObject.h>
 #include <LibJS/Runtime/ExternalMemory.h>
 #include <LibJS/Runtime/SharedFunctionInstanceData.h>
 #include <LibJS/Runtime/Value.h>
@@ -170,6 +174,12 @@ ReadonlySpan<PropertyLookupCache::Entry> PropertyLookupCache::entries() const
     return {};
 }
 
+bool PropertyLookupCache::is_full() const
+{
+    auto* data = polymorphic_data();
+    return data && data->entries.last().type != Entry::Type::Empty;
+}
+
 size_t PropertyLookupCache::external_memory_size() const
 {
     if (monomorphic_data())
@@ -386,6 +396,8 @@ static void dump_metadata(StringBuilder& output, Executable const& executable)
 
     output.appendff("  {}Registers{}: {}\n", green, reset, executable.number_of_registers);
     output.appendff("  {}Blocks{}:    {}\n", green, reset, RustIntegration::count_bytecode_basic_blocks(executable));
+    if (executable.call_count || executable.back_edge_count)
+        output.appendff("  {}Hotness{}:   {} calls, {} back edges{}\n", green, reset, executable.call_count, executable.back_edge_count, executable.is_hot() ? " (hot)"sv : ""sv);
 
     if (!executable.local_variable_names.is_empty()) {
         output.appendff("  {}Locals{}:    ", green, reset);
@@ -441,6 +453,91 @@ void Executable::dump() const
     warnln("{}", output.string_view());
 }
 
+static Vector<GC::Weak<Executable>>& executables_with_type_feedback()
+{
+    static NeverDestroyed<Vector<GC::Weak<Executable>>> executables;
+    return *executables;
+}
+
+TypeFeedback::ObservedType TypeFeedback::observed_type_of(Value value)
+{
+    if (value.is_int32())
+        return ObservedType::Int32;
+    if (value.is_number())
+        return ObservedType::Double;
+    if (value.is_string())
+        return ObservedType::String;
+    if (value.is_bigint())
+        return ObservedType::BigInt;
+    if (value.is_object())
+        return ObservedType::Object;
+    return ObservedType::Other;
+}
+
+void Executable::record_type_feedback(u32 program_counter, ReadonlySpan<Value> operands)
+{
+    if (type_feedback.is_empty())
+        executables_with_type_feedback().append(*this);
+
+    auto& feedback = type_feedback.ensure(program_counter);
+    ++feedback.slow_path_count;
+    for (auto operand : operands)
+        feedback.observed_types |= to_underlying(TypeFeedback::observed_type_of(operand));
+}
+
+void Executable::record_call_feedback(u32 program_counter, Value callee)
+{
+    record_type_feedback(program_counter, { &callee, 1 });
+
+    auto& feedback = type_feedback.ensure(program_counter);
+    auto* callee_object = callee.is_object() ? &callee.as_object() : nullptr;
+    if (feedback.callee && feedback.callee != callee_object)
+        feedback.callee_is_polymorphic = true;
+    feedback.callee = callee_object;
+}
+
+void Executable::dump_type_feedback() const
+{
+    if (type_feedback.is_empty())
+        return;
+
+    auto sorted_offsets = type_feedback.keys();
+    quick_sort(sorted_offsets);
+
+    StringBuilder output;
+    output.appendff("Type feedback for {} ({} instructions left the fast path):\n", name.is_empty() ? "(script)"_utf16_fly_string : name, sorted_offsets.size());
+    for (auto offset : sorted_offsets) {
+        auto const& feedback = type_feedback.find(offset)->value;
+        output.appendff("  [{:4x}] {} slow path hits, observed:", offset, feedback.slow_path_count);
+        auto append_type_if_observed = [&](TypeFeedback::ObservedType type, StringView type_name) {
+            if (feedback.observed_types & to_underlying(type))
+                output.appendff(" {}", type_name);
+        };
+        append_type_if_observed(TypeFeedback::ObservedType::Int32, "int32"sv);
+        append_type_if_observed(TypeFeedback::ObservedType::Double, "double"sv);
+        append_type_if_observed(TypeFeedback::ObservedType::String, "string"sv);
+        append_type_if_observed(TypeFeedback::ObservedType::BigInt, "bigint"sv);
+        append_type_if_observed(TypeFeedback::ObservedType::Object, "object"sv);
+        append_type_if_observed(TypeFeedback::ObservedType::Other, "other"sv);
+        if (feedback.callee_is_polymorphic)
+            output.append(", polymorphic callee"sv);
+        else if (feedback.callee && feedback.callee->is_function())
+            output.appendff(", callee {}", static_cast<FunctionObject const&>(*feedback.callee).name_for_call_stack());
+        if (auto source_range = source_range_at(offset); source_range.has_value())
+            output.appendff(" ({}:{})", source_range->start.line, source_range->start.column);
+        output.append('\n');
+    }
+    warnln("{}", output.string_view());
+}
+
+void dump_type_feedback()
+{
+    for (auto const& executable : executables_with_type_feedback()) {
+        if (executable)
+            executable->dump_type_feedback();
+    }
+}
+
 void Executable::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
@@ -570,6 +667,11 @@ void Executable::remove_dead_cells(Badge<GC::Heap>)
         if (shape && cell_is_dead(shape))
             cache.shape = nullptr;
     }
+    for (auto& it : type_feedback) {
+        auto* callee = it.value.callee.ptr();
+        if (callee && cell_is_dead(callee))
+            it.value.callee = nullptr;
+    }
 }
 
 Optional<Executable::ExceptionHandlers const&> Executable::exception_handlers_for_offset(size_t offset) const
@@ -99,6 +99,9 @@ struct PropertyLookupCache {
     [[nodiscard]] size_t external_memory_size() const;
     void copy_from(PropertyLookupCache const&);
 
+    // True once every polymorphic entry is in use, i.e. further shapes will evict older ones.
+    [[nodiscard]] bool is_full() const;
+
     void update(Entry::Type type, auto callback)
     {
         Entry new_entry;
@@ -266,6 +269,30 @@ struct SourceMapEntry {
     u32 column {};
 };
 
+// Operand types observed by an instruction's slow path, keyed by bytecode offset.
+// The asm fast paths handle int32 and double operands inline, so feedback only
+// accumulates for instructions that leave them. Only collected while
+// g_collect_type_feedback is set.
+struct TypeFeedback {
+    enum class ObservedType : u8 {
+        Int32 = 1 << 0,
+        Double = 1 << 1,
+        String = 1 << 2,
+        BigInt = 1 << 3,
+        Object = 1 << 4,
+        Other = 1 << 5,
+    };
+
+    static ObservedType observed_type_of(Value);
+
+    u32 slow_path_count { 0 };
+    u8 observed_types { 0 };
+
+    // Call sites only: the last callee seen, and whether more than one was seen.
+    GC::RawPtr<Object> callee;
+    bool callee_is_polymorphic { false };
+};
+
 class JS_API Executable final
     : public Cell
     , public GC::WeakContainer {
@@ -319,6 +346,22 @@ public:
     size_t asm_constants_size { 0 };
     Value const* asm_constants_data { nullptr };
 
+    // Hotness counters for tier-up decisions. Calls are counted whenever a frame
+    // for this executable is entered, back edges whenever a Jump transfers control
+    // to an earlier (or the same) instruction. Both wrap around on overflow.
+    static constexpr u32 hot_call_count_threshold = 1000;
+    static constexpr u32 hot_back_edge_count_threshold = 10000;
+    u32 call_count { 0 };
+    u32 back_edge_count { 0 };
+
+    [[nodiscard]] bool is_hot() const { return call_count >= hot_call_count_threshold || back_edge_count >= hot_back_edge_count_threshold; }
+
+    HashMap<u32, TypeFeedback> type_feedback;
+
+    void record_type_feedback(u32 program_counter, ReadonlySpan<Value> operands);
+    void record_call_feedback(u32 program_counter, Value callee);
+    void dump_type_feedback() const;
+
     struct ExceptionHandlers {
         size_t start_offset;
         size_t end_offset;
@@ -32,6 +32,7 @@ using namespace Bytecode;
 extern "C" void asm_interpreter_entry(u8 const* bytecode, u32 entry_point, Value* values, VM* vm);
 
 bool Bytecode::g_dump_bytecode = false;
+bool Bytecode::g_collect_type_feedback = false;
 
 // 16.1.6 ScriptEvaluation ( scriptRecord ), https://tc39.es/ecma262/#sec-runtime-semantics-scriptevaluation
 ThrowCompletionOr<Value> VM::run(Script& script_record, GC::Ptr<Environment> lexical_environment_override)
@@ -237,6 +238,7 @@ ExecutionContext* VM::push_inline_frame(
     //     and global_declarative_environment, since the caller's realm may differ
     //     in cross-realm calls (e.g. iframe <-> parent).
     callee_context->executable = callee_executable;
+    ++callee_executable.call_count;
 
     // Set this value register.
     auto* values = callee_context->registers_and_constants_and_locals_and_arguments();
@@ -281,6 +283,7 @@ ThrowCompletionOr<Value> VM::run_executable(ExecutionContext& context, Executabl
     TemporaryChange restore_running_execution_context { m_running_execution_context, &context };
 
     context.executable = executable;
+    ++executable.call_count;
 
     VERIFY(executable.registers_and_locals_count + executable.constants.size() == executable.registers_and_locals_and_constants_count);
     VERIFY(executable.registers_and_locals_and_constants_count <= context.registers_and_constants_and_locals_and_arguments_span().size());
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashFunctions.h>
+#include <LibGC/Heap.h>
+#include <LibGC/HeapBlock.h>
+#include <LibJS/Bytecode/MegamorphicPropertyCache.h>
+#include <LibJS/Runtime/Shape.h>
+
+namespace JS::Bytecode {
+
+static_assert(is_power_of_two(MegamorphicPropertyCache::capacity));
+
+MegamorphicPropertyCache::MegamorphicPropertyCache()
+{
+    m_entries.resize(capacity);
+}
+
+size_t MegamorphicPropertyCache::index_for(AccessKind access_kind, Shape const& shape, PropertyKey const& property_key)
+{
+    auto hash = pair_int_hash(ptr_hash(&shape), Traits<PropertyKey>::hash(property_key));
+    if (access_kind == AccessKind::Put)
+        hash = u32_hash(hash);
+    return hash & (capacity - 1);
+}
+
+Optional<u32> MegamorphicPropertyCache::lookup(AccessKind access_kind, Shape const& shape, PropertyKey const& property_key)
+{
+    VERIFY(!shape.is_dictionary());
+
+    auto const& entry = m_entries[index_for(access_kind, shape, property_key)];
+    if (entry.shape == &shape && entry.access_kind == access_kind && *entry.property_key == property_key) {
+        ++m_statistics.hits;
+        return entry.property_offset;
+    }
+    ++m_statistics.misses;
+    return {};
+}
+
+void MegamorphicPropertyCache::insert(AccessKind access_kind, Shape const& shape, PropertyKey const& property_key, u32 property_offset)
+{
+    // Dictionary shapes mutate in place, so their offsets can't be cached by shape identity alone.
+    if (shape.is_dictionary())
+        return;
+
+    auto& entry = m_entries[index_for(access_kind, shape, property_key)];
+    entry.shape = &shape;
+    entry.property_key = property_key;
+    entry.property_offset = property_offset;
+    entry.access_kind = access_kind;
+    ++m_statistics.insertions;
+}
+
+static bool shape_is_dead(Shape const* shape)
+{
+    auto* block = GC::HeapBlock::from_cell(shape);
+    if (!GC::Heap::the().is_live_heap_block(block))
+        return true;
+    return shape->state() != Cell::State::Live || !shape->is_marked();
+}
+
+void MegamorphicPropertyCache::remove_dead_shapes()
+{
+    for (auto& entry : m_entries) {
+        if (entry.shape && shape_is_dead(entry.shape))
+            entry = {};
+    }
+}
+
+void MegamorphicPropertyCache::clear()
+{
+    for (auto& entry : m_entries)
+        entry = {};
+}
+
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/Types.h>
+#include <AK/Vector.h>
+#include <LibGC/Ptr.h>
+#include <LibJS/Forward.h>
+#include <LibJS/Runtime/PropertyKey.h>
+
+namespace JS::Bytecode {
+
+// A VM-wide, direct-mapped (Shape, PropertyKey) -> property offset table.
+// It backs up per-instruction PropertyLookupCaches once they have run out of
+// polymorphic entries, so megamorphic access sites still avoid a full lookup
+// for own properties of objects with non-dictionary shapes.
+//
+// Non-dictionary shapes never change once created (adding or reconfiguring a
+// property transitions to a new shape), so an entry stays valid for as long
+// as its shape is alive. Entries for dead shapes are dropped after each GC.
+class MegamorphicPropertyCache {
+    AK_MAKE_NONCOPYABLE(MegamorphicPropertyCache);
+    AK_MAKE_NONMOVABLE(MegamorphicPropertyCache);
+
+public:
+    enum class AccessKind : u8 {
+        // Own data or accessor property that can be read with get_direct().
+        Get,
+        // Own property that can be written with put_direct() (or whose setter can be called).
+        Put,
+    };
+
+    struct Statistics {
+        u64 hits { 0 };
+        u64 misses { 0 };
+        u64 insertions { 0 };
+    };
+
+    static constexpr size_t capacity = 4096;
+
+    MegamorphicPropertyCache();
+
+    [[nodiscard]] Optional<u32> lookup(AccessKind, Shape const&, PropertyKey const&);
+    void insert(AccessKind, Shape const&, PropertyKey const&, u32 property_offset);
+
+    void remove_dead_shapes();
+    void clear();
+
+    [[nodiscard]] Statistics const& statistics() const { return m_statistics; }
+
+private:
+    struct Entry {
+        GC::RawPtr<Shape const> shape;
+        Optional<PropertyKey> property_key;
+        u32 property_offset { 0 };
+        AccessKind access_kind { AccessKind::Get };
+    };
+
+    [[nodiscard]] static size_t index_for(AccessKind, Shape const&, PropertyKey const&);
+
+    Vector<Entry> m_entries;
+    Statistics m_statistics;
+};
+
+}
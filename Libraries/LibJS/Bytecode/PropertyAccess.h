@@ -157,6 +157,16 @@ ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_b
             }
         }
     }
+
+    // OPTIMIZATION: Once this site has seen more shapes than its cache can hold, fall back to the VM-wide megamorphic cache.
+    auto const use_megamorphic_cache = cache.is_full() && !shape.is_dictionary();
+    if (use_megamorphic_cache) {
+        if (auto property_offset = vm.megamorphic_property_cache().lookup(MegamorphicPropertyCache::AccessKind::Get, shape, property_name); property_offset.has_value()) {
+            auto value = base_obj->get_direct(*property_offset);
+            return TRY(get_cached_property_value(vm, value, this_value));
+        }
+    }
+
     GC::Ptr<PrototypeChainValidity> prototype_chain_validity;
     if (shape.prototype())
         prototype_chain_validity = shape.prototype()->shape().prototype_chain_validity();
@@ -169,6 +179,8 @@ ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_b
     // property with the same name into the object itself.
     if (&shape == &base_obj->shape()) {
         if (cacheable_metadata.type == CacheableGetPropertyMetadata::Type::GetOwnProperty) {
+            if (use_megamorphic_cache)
+                vm.megamorphic_property_cache().insert(MegamorphicPropertyCache::AccessKind::Get, shape, property_name, cacheable_metadata.property_offset.value());
             cache.update(PropertyLookupCache::Entry::Type::GetOwnProperty, [&](auto& entry) {
                 entry.shape = shape;
                 entry.property_offset = cacheable_metadata.property_offset.value();
@@ -343,6 +355,22 @@ inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value thi
             }
         }
 
+        // OPTIMIZATION: Once this site has seen more shapes than its cache can hold, fall back to the VM-wide megamorphic cache.
+        auto const use_megamorphic_cache = caches && caches->is_full() && !object->shape().is_dictionary();
+        if (use_megamorphic_cache) {
+            if (auto property_offset = vm.megamorphic_property_cache().lookup(MegamorphicPropertyCache::AccessKind::Put, object->shape(), name); property_offset.has_value()) {
+                auto value_in_object = object->get_direct(*property_offset);
+                if (!value_in_object.is_accessor()) [[likely]] {
+                    object->put_direct(*property_offset, value);
+                    return {};
+                }
+                if (auto* setter = value_in_object.as_accessor().setter()) {
+                    (void)TRY(call(vm, *setter, this_value, value));
+                    return {};
+                }
+            }
+        }
+
         CacheableSetPropertyMetadata cacheable_metadata;
         bool succeeded = TRY(object->internal_set(name, value, this_value, &cacheable_metadata));
 
@@ -370,6 +398,8 @@ inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value thi
                 VERIFY_NOT_REACHED();
                 break;
             case CacheableSetPropertyMetadata::Type::ChangeOwnProperty:
+                if (use_megamorphic_cache)
+                    vm.megamorphic_property_cache().insert(MegamorphicPropertyCache::AccessKind::Put, object->shape(), name, cacheable_metadata.property_offset.value());
                 caches->update(PropertyLookupCache::Entry::Type::ChangeOwnProperty, [&](auto& cache) {
                     cache.shape = &object->shape();
                     cache.property_offset = cacheable_metadata.property_offset.value();
@@ -272,6 +272,7 @@ namespace Intl {
 JS_ENUMERATE_INTL_OBJECTS
 #undef __JS_ENUMERATE
 
+class FormatterCache;
 class Intl;
 class IntlObject;
 class MathematicalValue;
@@ -9,6 +9,7 @@
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayPrototype.h>
+#include <LibJS/Runtime/ArraySort.h>
 #include <LibJS/Runtime/Completion.h>
 #include <LibJS/Runtime/Error.h>
 #include <LibJS/Runtime/GlobalObject.h>
@@ -169,7 +170,7 @@ ThrowCompletionOr<bool> Array::set_length(PropertyDescriptor const& property_des
 }
 
 // 23.1.3.30.1 SortIndexedProperties ( obj, len, SortCompare, holes ), https://tc39.es/ecma262/#sec-sortindexedproperties
-ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM& vm, Object const& object, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes)
+ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM& vm, Object const& object, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes, SortCompareIsDefault sort_compare_is_default)
 {
     // 1. Let items be a new empty List.
     GC::RootVector<Value> items;
@@ -210,12 +211,13 @@ ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM& vm, Object
 
     // 4. Sort items using an implementation-defined sequence of calls to SortCompare. If any such call returns an abrupt completion, stop before performing any further calls to SortCompare or steps in this algorithm and return that Completion Record.
 
-    // Perform sorting by merge sort. This isn't as efficient compared to quick sort, but
-    // quicksort can't be used in all cases because the spec requires Array.prototype.sort()
-    // to be stable. FIXME: when initially scanning through the array, maintain a flag
-    // for if an unstable sort would be indistinguishable from a stable sort (such as just
-    // just strings or numbers), and in that case use quick sort instead for better performance.
-    TRY(array_merge_sort(vm, sort_compare, items));
+    // NOTE: The spec requires Array.prototype.sort() to be stable, so this is a TimSort.
+    // OPTIMIZATION: The default order only depends on the items themselves, which lets most arrays be sorted without
+    //               calling SortCompare at all.
+    if (sort_compare_is_default == SortCompareIsDefault::Yes)
+        TRY(sort_values_in_default_order(vm, items.span()));
+    else
+        TRY(sort_values(items.span(), sort_compare));
 
     // 5. Return items.
     return items;
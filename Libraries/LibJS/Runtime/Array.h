@@ -94,7 +94,14 @@ enum class Holes {
     ReadThroughHoles,
 };
 
-ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM&, Object const&, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes);
+// Whether SortCompare is known to be CompareArrayElements without a comparefn, in which case SortIndexedProperties may
+// order the items without calling it.
+enum class SortCompareIsDefault {
+    No,
+    Yes,
+};
+
+ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM&, Object const&, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes, SortCompareIsDefault = SortCompareIsDefault::No);
 ThrowCompletionOr<double> compare_array_elements(VM&, Value x, Value y, FunctionObject* comparefn);
 
 }
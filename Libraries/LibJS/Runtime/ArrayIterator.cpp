@@ -154,4 +154,29 @@ ThrowCompletionOr<void> ArrayIterator::next(VM& vm, bool& done, Value& value)
     return {};
 }
 
+GC::Ptr<Array> ArrayIterator::take_remaining_values_if_simple_packed_array(Realm& realm)
+{
+    if (m_iteration_kind != PropertyKind::Value || !m_array.is_object())
+        return nullptr;
+
+    auto* array = as_if<Array>(m_array.as_object());
+    if (!array || !array->is_simple_packed_array())
+        return nullptr;
+
+    auto elements = array->indexed_packed_elements_span();
+    size_t length = array->indexed_array_like_size();
+    if (elements.size() < length)
+        return nullptr;
+
+    // Every remaining next() call would read an own data property, so this is the list those calls would produce.
+    auto remaining_elements = m_index < length ? elements.slice(m_index, length - m_index) : ReadonlySpan<Value> {};
+    auto result = Array::create_from(realm, remaining_elements);
+
+    // The final next() call sets [[IteratedArrayLike]] to undefined.
+    m_index = max(m_index, length);
+    m_array = js_undefined();
+
+    return result;
+}
+
 }
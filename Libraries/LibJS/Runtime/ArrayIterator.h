@@ -24,6 +24,10 @@ public:
     BuiltinIterator* as_builtin_iterator_if_next_is_not_redefined(Value next_method) override;
     ThrowCompletionOr<void> next(VM&, bool& done, Value& value) override;
 
+    // If this iterates the values of a simple packed array, exhausts it and returns the values it had yet to produce
+    // in a new Array. Otherwise, returns nullptr and leaves the iterator untouched.
+    GC::Ptr<Array> take_remaining_values_if_simple_packed_array(Realm&);
+
 private:
     ArrayIterator(Value array, Object::PropertyKind iteration_kind, Object& prototype);
 
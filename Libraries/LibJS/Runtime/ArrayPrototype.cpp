@@ -68,7 +68,7 @@ void ArrayPrototype::initialize(Realm& realm)
     define_native_function(realm, vm.names.lastIndexOf, last_index_of, 1, attr);
     define_native_function(realm, vm.names.map, map, 1, attr);
     define_native_function(realm, vm.names.pop, pop, 0, attr);
-    define_native_function(realm, vm.names.push, push, 1, attr);
+    define_native_function(realm, vm.names.push, push, 1, attr, Bytecode::Builtin::ArrayPrototypePush);
     define_native_function(realm, vm.names.reduce, reduce, 1, attr);
     define_native_function(realm, vm.names.reduceRight, reduce_right, 1, attr);
     define_native_function(realm, vm.names.reverse, reverse, 0, attr);
@@ -823,6 +823,21 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
             from_index = from_argument;
     }
     auto value_to_find = vm.argument(0);
+
+    // OPTIMIZATION: Simple packed arrays have an own data property for every index below their length,
+    //               so Get cannot produce side effects. A packed array known to only hold numbers can't
+    //               contain a non-number at all.
+    if (auto* array = as_if<Array>(*this_object); array && array->is_simple_packed_array() && array->indexed_array_like_size() == length) {
+        if (array->indexed_elements_kind() != IndexedElementsKind::Generic && !value_to_find.is_number())
+            return Value(false);
+        auto elements = array->indexed_packed_elements_span();
+        for (u64 i = from_index; i < elements.size(); ++i) {
+            if (same_value_zero(elements[i], value_to_find))
+                return Value(true);
+        }
+        return Value(false);
+    }
+
     for (u64 i = from_index; i < length; ++i) {
         auto element = TRY(this_object->get(i));
         if (same_value_zero(element, value_to_find))
@@ -883,6 +898,9 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::index_of)
     // OPTIMIZATION: Simple packed arrays have an own data property for every index below their length,
     // so HasProperty and Get cannot produce side effects or observe prototype indexed properties.
     if (auto* array = as_if<Array>(*object); array && array->is_simple_packed_array() && array->indexed_array_like_size() == length) {
+        // A packed array known to only hold numbers can't contain a non-number at all.
+        if (array->indexed_elements_kind() != IndexedElementsKind::Generic && !search_element.is_number())
+            return Value(-1);
         auto elements = array->indexed_packed_elements_span();
         for (; k < elements.size(); ++k) {
             if (is_strictly_equal(search_element, elements[k]))
@@ -1488,62 +1506,6 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::some)
     return Value(false);
 }
 
-ThrowCompletionOr<void> array_merge_sort(VM& vm, Function<ThrowCompletionOr<double>(Value, Value)> const& compare_func, GC::RootVector<Value>& arr_to_sort)
-{
-    // FIXME: it would probably be better to switch to insertion sort for small arrays for
-    // better performance
-    if (arr_to_sort.size() <= 1)
-        return {};
-
-    GC::RootVector<Value> left;
-    GC::RootVector<Value> right;
-
-    left.ensure_capacity(arr_to_sort.size() / 2);
-    right.ensure_capacity(arr_to_sort.size() / 2 + (arr_to_sort.size() & 1));
-
-    for (size_t i = 0; i < arr_to_sort.size(); ++i) {
-        if (i < arr_to_sort.size() / 2) {
-            left.append(arr_to_sort[i]);
-        } else {
-            right.append(arr_to_sort[i]);
-        }
-    }
-
-    TRY(array_merge_sort(vm, compare_func, left));
-    TRY(array_merge_sort(vm, compare_func, right));
-
-    arr_to_sort.clear();
-
-    size_t left_index = 0, right_index = 0;
-
-    while (left_index < left.size() && right_index < right.size()) {
-        auto x = left[left_index];
-        auto y = right[right_index];
-
-        double comparison_result = TRY(compare_func(x, y));
-
-        if (comparison_result <= 0) {
-            arr_to_sort.append(x);
-            left_index++;
-        } else {
-            arr_to_sort.append(y);
-            right_index++;
-        }
-    }
-
-    while (left_index < left.size()) {
-        arr_to_sort.append(left[left_index]);
-        left_index++;
-    }
-
-    while (right_index < right.size()) {
-        arr_to_sort.append(right[right_index]);
-        right_index++;
-    }
-
-    return {};
-}
-
 // 23.1.3.30 Array.prototype.sort ( comparefn ), https://tc39.es/ecma262/#sec-array.prototype.sort
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::sort)
 {
@@ -1565,7 +1527,7 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::sort)
     };
 
     // 5. Let sortedList be ? SortIndexedProperties(obj, len, SortCompare, skip-holes).
-    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::SkipHoles));
+    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::SkipHoles, comparefn.is_undefined() ? SortCompareIsDefault::Yes : SortCompareIsDefault::No));
 
     // 6. Let itemCount be the number of elements in sortedList.
     auto item_count = sorted_list.size();
@@ -1923,7 +1885,7 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::to_sorted)
     };
 
     // 6. Let sortedList be ? SortIndexedProperties(obj, len, SortCompare, read-through-holes).
-    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::ReadThroughHoles));
+    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::ReadThroughHoles, comparefn.is_undefined() ? SortCompareIsDefault::Yes : SortCompareIsDefault::No));
 
     // 7. Let j be 0.
     // 8. Repeat, while j < len,
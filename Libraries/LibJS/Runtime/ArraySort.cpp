@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/BitCast.h>
+#include <AK/InsertionSort.h>
+#include <LibGC/RootVector.h>
+#include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/ArraySort.h>
+#include <LibJS/Runtime/PrimitiveString.h>
+#include <LibJS/Runtime/TypedArray.h>
+#include <LibJS/Runtime/ValueInlines.h>
+
+namespace JS {
+
+ThrowCompletionOr<void> sort_values(Span<Value> values, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare)
+{
+    GC::RootVector<Value> scratch;
+    scratch.resize(values.size() / 2);
+
+    return tim_sort(values, scratch.span(), [&](Value x, Value y) -> ThrowCompletionOr<bool> {
+        return TRY(sort_compare(x, y)) < 0;
+    });
+}
+
+static size_t count_decimal_digits(u64 value)
+{
+    size_t digits = 1;
+    for (; value >= 10; value /= 10)
+        ++digits;
+    return digits;
+}
+
+// Orders two integers the way their decimal strings would be ordered, without producing the strings.
+static int compare_int32s_as_strings(i32 x, i32 y)
+{
+    if (x == y)
+        return 0;
+
+    // A minus sign sorts before every digit.
+    if ((x < 0) != (y < 0))
+        return x < 0 ? -1 : 1;
+
+    // Otherwise both strings start the same way, and it is the digits of the magnitudes that decide. Padding the shorter
+    // one with zeros lines the digits up, and if that makes them equal, the shorter one is a prefix of the longer one.
+    u64 a = x < 0 ? -static_cast<i64>(x) : x;
+    u64 b = y < 0 ? -static_cast<i64>(y) : y;
+
+    auto a_digits = count_decimal_digits(a);
+    auto b_digits = count_decimal_digits(b);
+    for (auto i = a_digits; i < b_digits; ++i)
+        a *= 10;
+    for (auto i = b_digits; i < a_digits; ++i)
+        b *= 10;
+
+    if (a != b)
+        return a < b ? -1 : 1;
+    return a_digits < b_digits ? -1 : 1;
+}
+
+ThrowCompletionOr<void> sort_values_in_default_order(VM& vm, Span<Value> values)
+{
+    // Undefined sorts after everything else without CompareArrayElements ever calling into user code, so undefined
+    // values can be moved to the end up front. They are all alike, which keeps this stable.
+    size_t defined_count = 0;
+    bool all_strings = true;
+    bool all_int32s = true;
+    bool all_primitives = true;
+
+    for (auto value : values) {
+        if (value.is_undefined())
+            continue;
+        values[defined_count++] = value;
+
+        if (value.is_string()) {
+            all_int32s = false;
+        } else if (value.is_int32()) {
+            all_strings = false;
+        } else {
+            all_strings = false;
+            all_int32s = false;
+            // ToString may call into user code for objects, and throws for symbols. Doing that up front instead of
+            // during comparisons would be observable.
+            if (value.is_object() || value.is_symbol())
+                all_primitives = false;
+        }
+    }
+    for (auto i = defined_count; i < values.size(); ++i)
+        values[i] = js_undefined();
+
+    auto defined_values = values.slice(0, defined_count);
+    if (defined_values.size() < 2)
+        return {};
+
+    if (!all_primitives) {
+        return sort_values(defined_values, [&](Value x, Value y) {
+            return compare_array_elements(vm, x, y, nullptr);
+        });
+    }
+
+    GC::RootVector<Value> scratch;
+    scratch.resize(defined_values.size() / 2);
+
+    if (all_strings) {
+        return tim_sort(defined_values, scratch.span(), [](Value x, Value y) -> ThrowCompletionOr<bool> {
+            return x.as_string().utf16_string_view() < y.as_string().utf16_string_view();
+        });
+    }
+
+    if (all_int32s) {
+        return tim_sort(defined_values, scratch.span(), [](Value x, Value y) -> ThrowCompletionOr<bool> {
+            return compare_int32s_as_strings(x.as_i32(), y.as_i32()) < 0;
+        });
+    }
+
+    // Any other mix of primitives is ordered by their strings. Computing each string once, rather than once for every
+    // comparison an element takes part in, saves allocating O(n log n) temporary strings.
+    Vector<Utf16String> keys;
+    keys.ensure_capacity(defined_values.size());
+    for (auto value : defined_values)
+        keys.unchecked_append(value.is_string() ? value.as_string().utf16_string() : MUST(value.to_utf16_string(vm)));
+
+    Vector<size_t> order;
+    order.ensure_capacity(defined_values.size());
+    for (size_t i = 0; i < defined_values.size(); ++i)
+        order.unchecked_append(i);
+
+    Vector<size_t> order_scratch;
+    order_scratch.resize(order.size() / 2);
+    MUST(tim_sort(order.span(), order_scratch.span(), [&](size_t a, size_t b) -> ThrowCompletionOr<bool> {
+        return keys[a].utf16_view() < keys[b].utf16_view();
+    }));
+
+    GC::RootVector<Value> unsorted_values { defined_values };
+    for (size_t i = 0; i < order.size(); ++i)
+        defined_values[i] = unsorted_values[order[i]];
+
+    return {};
+}
+
+// Maps elements to unsigned integers of the same width that order the same way, so that they can be radix sorted.
+template<typename T>
+struct RadixSortKey;
+
+template<Unsigned T>
+struct RadixSortKey<T> {
+    using Key = T;
+    static Key from_element(T element) { return element; }
+    static T to_element(Key key) { return key; }
+};
+
+template<Signed T>
+requires(IsIntegral<T>)
+struct RadixSortKey<T> {
+    using Key = MakeUnsigned<T>;
+    static constexpr Key sign_bit = static_cast<Key>(1) << (sizeof(Key) * 8 - 1);
+    static Key from_element(T element) { return bit_cast<Key>(element) ^ sign_bit; }
+    static T to_element(Key key) { return bit_cast<T>(static_cast<Key>(key ^ sign_bit)); }
+};
+
+template<FloatingPoint T>
+struct RadixSortKey<T> {
+    using Key = Conditional<sizeof(T) == 2, u16, Conditional<sizeof(T) == 4, u32, u64>>;
+    static constexpr Key sign_bit = static_cast<Key>(1) << (sizeof(Key) * 8 - 1);
+
+    // Negative numbers have all their bits flipped so that larger magnitudes come first, while positive numbers only
+    // have their sign flipped, which puts them after every negative number. This orders -0 before +0, as
+    // CompareTypedArrayElements does. NaN sorts last, provided that its sign is cleared first.
+    static Key from_element(T element)
+    {
+        auto bits = bit_cast<Key>(element);
+        if (element != element)
+            bits &= ~sign_bit;
+        return (bits & sign_bit) ? static_cast<Key>(~bits) : static_cast<Key>(bits ^ sign_bit);
+    }
+
+    static T to_element(Key key)
+    {
+        return bit_cast<T>((key & sign_bit) ? static_cast<Key>(key ^ sign_bit) : static_cast<Key>(~key));
+    }
+};
+
+// A least significant digit first radix sort, one byte per pass.
+template<typename Key>
+static void radix_sort(Span<Key> keys)
+{
+    // Below this, counting passes cost more than they save.
+    static constexpr size_t minimum_size_for_radix_sort = 64;
+    if (keys.size() < minimum_size_for_radix_sort) {
+        insertion_sort(keys, [](Key a, Key b) { return a < b; });
+        return;
+    }
+
+    Vector<Key> buffer;
+    buffer.resize(keys.size());
+
+    auto from = keys;
+    auto to = buffer.span();
+
+    for (size_t shift = 0; shift < sizeof(Key) * 8; shift += 8) {
+        AK::Array<size_t, 256> offsets {};
+        for (auto key : from)
+            ++offsets[(key >> shift) & 0xff];
+
+        // If every key has the same digit, this pass would not move anything.
+        if (offsets[(from[0] >> shift) & 0xff] == from.size())
+            continue;
+
+        size_t total = 0;
+        for (auto& offset : offsets)
+            total += exchange(offset, total);
+
+        for (auto key : from)
+            to[offsets[(key >> shift) & 0xff]++] = key;
+        swap(from, to);
+    }
+
+    if (from.data() != keys.data())
+        from.copy_to(keys);
+}
+
+template<typename T>
+static void sort_typed_array_elements(TypedArrayBase const& source, TypedArrayBase& destination, u32 length)
+{
+    using Key = typename RadixSortKey<T>::Key;
+
+    Vector<T> elements;
+    elements.resize(length);
+    source.viewed_array_buffer()->copy_to(source.byte_offset(), elements.span().template reinterpret<u8>());
+
+    Vector<Key> keys;
+    keys.ensure_capacity(length);
+    for (auto element : elements)
+        keys.unchecked_append(RadixSortKey<T>::from_element(element));
+
+    radix_sort(keys.span());
+
+    for (size_t i = 0; i < length; ++i)
+        elements[i] = RadixSortKey<T>::to_element(keys[i]);
+    destination.viewed_array_buffer()->overwrite(destination.byte_offset(), elements.data(), length * sizeof(T));
+}
+
+void sort_typed_array_elements_in_default_order(TypedArrayBase const& source, TypedArrayBase& destination, u32 length)
+{
+    VERIFY(source.kind() == destination.kind());
+
+    switch (source.kind()) {
+    case TypedArrayBase::Kind::Uint8Array:
+    case TypedArrayBase::Kind::Uint8ClampedArray:
+        sort_typed_array_elements<u8>(source, destination, length);
+        break;
+    case TypedArrayBase::Kind::Uint16Array:
+        sort_typed_array_elements<u16>(source, destination, length);
+        break;
+    case TypedArrayBase::Kind::Uint32Array:
+        sort_typed_array_elements<u32>(source, destination, length);
+        break;
+    case TypedArrayBase::Kind::BigUint64Array:
+        sort_typed_array_elements<u64>(source, destination, length);
+        break;
+    case TypedArrayBase::Kind::Int8Array:
+        sort_typed_array_elements<i8>(source, destination, length);
+        break;
+    case TypedArrayBase::Kind::Int16Array:
+        sort_typed_array_elements<i16>(source, destination, length);
+        break;
+    case TypedArrayBase::Kind::Int32Array:
+        sort_typed_array_elements<i32>(source, destination, length);
+        break;
+    case TypedArrayBase::Kind::BigInt64Array:
+        sort_typed_array_elements<i64>(source, destination, length);
+        break;
+    case TypedArrayBase::Kind::Float16Array:
+        sort_typed_array_elements<f16>(source, destination, length);
+        break;
+    case TypedArrayBase::Kind::Float32Array:
+        sort_typed_array_elements<float>(source, destination, length);
+        break;
+    case TypedArrayBase::Kind::Float64Array:
+        sort_typed_array_elements<double>(source, destination, length);
+        break;
+    }
+}
+
+}
@@ -0,0 +1,498 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/ScopeGuard.h>
+#include <AK/Span.h>
+#include <AK/Vector.h>
+#include <LibJS/Forward.h>
+#include <LibJS/Runtime/Completion.h>
+#include <LibJS/Runtime/Value.h>
+
+namespace JS {
+
+namespace Detail {
+
+// A port of the TimSort used by CPython's list.sort(), see Objects/listsort.txt there for the full story. Natural runs
+// are extended to a minimum length by binary insertion and then merged pairwise, keeping the runs awaiting a merge
+// roughly balanced. Merges copy only the shorter run out of the way, and switch to galloping once one run keeps
+// winning, which makes partially ordered input close to linear.
+template<typename T, typename LessThan>
+class TimSort {
+public:
+    TimSort(Span<T> items, Span<T> scratch, LessThan const& less_than)
+        : m_items(items)
+        , m_scratch(scratch)
+        , m_less_than(less_than)
+    {
+        VERIFY(m_scratch.size() >= m_items.size() / 2);
+    }
+
+    ThrowCompletionOr<void> sort()
+    {
+        auto remaining = m_items.size();
+        if (remaining < 2)
+            return {};
+
+        auto minimum_run_length = minimum_run_length_for(remaining);
+        size_t low = 0;
+
+        while (remaining > 0) {
+            auto run_length = TRY(count_run(low, low + remaining));
+
+            if (run_length < minimum_run_length) {
+                auto forced_length = min(minimum_run_length, remaining);
+                TRY(binary_insertion_sort(low, low + forced_length, low + run_length));
+                run_length = forced_length;
+            }
+
+            m_runs.append({ low, run_length });
+            TRY(merge_collapse());
+
+            low += run_length;
+            remaining -= run_length;
+        }
+
+        return merge_force_collapse();
+    }
+
+private:
+    static constexpr size_t initial_minimum_gallop = 7;
+
+    struct Run {
+        size_t base { 0 };
+        size_t length { 0 };
+    };
+
+    static size_t minimum_run_length_for(size_t length)
+    {
+        size_t low_bits = 0;
+        while (length >= 64) {
+            low_bits |= length & 1;
+            length >>= 1;
+        }
+        return length + low_bits;
+    }
+
+    ThrowCompletionOr<bool> less_than(T const& a, T const& b) const
+    {
+        return m_less_than(a, b);
+    }
+
+    // Returns the length of the run starting at low, reversing it in place if it is strictly descending. Only strictly
+    // descending runs may be reversed, or equal elements would trade places.
+    ThrowCompletionOr<size_t> count_run(size_t low, size_t high)
+    {
+        if (low + 1 == high)
+            return 1;
+
+        size_t end = low + 2;
+        if (TRY(less_than(m_items[low + 1], m_items[low]))) {
+            while (end < high && TRY(less_than(m_items[end], m_items[end - 1])))
+                ++end;
+            for (size_t i = low, j = end - 1; i < j; ++i, --j)
+                swap(m_items[i], m_items[j]);
+        } else {
+            while (end < high && !TRY(less_than(m_items[end], m_items[end - 1])))
+                ++end;
+        }
+        return end - low;
+    }
+
+    // Sorts items[low..high), of which items[low..start) are already sorted.
+    ThrowCompletionOr<void> binary_insertion_sort(size_t low, size_t high, size_t start)
+    {
+        if (start == low)
+            ++start;
+
+        for (; start < high; ++start) {
+            auto pivot = m_items[start];
+
+            size_t left = low;
+            size_t right = start;
+            while (left < right) {
+                auto middle = left + (right - left) / 2;
+                if (TRY(less_than(pivot, m_items[middle])))
+                    right = middle;
+                else
+                    left = middle + 1;
+            }
+
+            for (auto i = start; i > left; --i)
+                m_items[i] = m_items[i - 1];
+            m_items[left] = pivot;
+        }
+        return {};
+    }
+
+    // Locates the position at which key belongs in the sorted range, before any elements equal to it. The search starts
+    // at hint and widens exponentially, so that it is cheap when key belongs close to hint.
+    ThrowCompletionOr<size_t> gallop_left(T const& key, ReadonlySpan<T> range, size_t hint) const
+    {
+        ssize_t size = range.size();
+        ssize_t last_offset = 0;
+        ssize_t offset = 1;
+
+        if (TRY(less_than(range[hint], key))) {
+            // range[hint + last_offset] < key <= range[hint + offset]
+            auto max_offset = size - static_cast<ssize_t>(hint);
+            while (offset < max_offset && TRY(less_than(range[hint + offset], key))) {
+                last_offset = offset;
+                offset = (offset << 1) + 1;
+            }
+            offset = min(offset, max_offset);
+            last_offset += hint;
+            offset += hint;
+        } else {
+            // range[hint - offset] < key <= range[hint - last_offset]
+            auto max_offset = static_cast<ssize_t>(hint) + 1;
+            while (offset < max_offset && !TRY(less_than(range[hint - offset], key))) {
+                last_offset = offset;
+                offset = (offset << 1) + 1;
+            }
+            offset = min(offset, max_offset);
+            auto previous_last_offset = last_offset;
+            last_offset = hint - offset;
+            offset = hint - previous_last_offset;
+        }
+
+        ++last_offset;
+        while (last_offset < offset) {
+            auto middle = last_offset + ((offset - last_offset) >> 1);
+            if (TRY(less_than(range[middle], key)))
+                last_offset = middle + 1;
+            else
+                offset = middle;
+        }
+        return offset;
+    }
+
+    // Like gallop_left(), but locates the position after any elements equal to key.
+    ThrowCompletionOr<size_t> gallop_right(T const& key, ReadonlySpan<T> range, size_t hint) const
+    {
+        ssize_t size = range.size();
+        ssize_t last_offset = 0;
+        ssize_t offset = 1;
+
+        if (TRY(less_than(key, range[hint]))) {
+            // range[hint - offset] <= key < range[hint - last_offset]
+            auto max_offset = static_cast<ssize_t>(hint) + 1;
+            while (offset < max_offset && TRY(less_than(key, range[hint - offset]))) {
+                last_offset = offset;
+                offset = (offset << 1) + 1;
+            }
+            offset = min(offset, max_offset);
+            auto previous_last_offset = last_offset;
+            last_offset = hint - offset;
+            offset = hint - previous_last_offset;
+        } else {
+            // range[hint + last_offset] <= key < range[hint + offset]
+            auto max_offset = size - static_cast<ssize_t>(hint);
+            while (offset < max_offset && !TRY(less_than(key, range[hint + offset]))) {
+                last_offset = offset;
+                offset = (offset << 1) + 1;
+            }
+            offset = min(offset, max_offset);
+            last_offset += hint;
+            offset += hint;
+        }
+
+        ++last_offset;
+        while (last_offset < offset) {
+            auto middle = last_offset + ((offset - last_offset) >> 1);
+            if (TRY(less_than(key, range[middle])))
+                offset = middle;
+            else
+                last_offset = middle + 1;
+        }
+        return offset;
+    }
+
+    ThrowCompletionOr<void> merge_collapse()
+    {
+        while (m_runs.size() > 1) {
+            auto n = m_runs.size() - 2;
+            if ((n > 0 && m_runs[n - 1].length <= m_runs[n].length + m_runs[n + 1].length)
+                || (n > 1 && m_runs[n - 2].length <= m_runs[n - 1].length + m_runs[n].length)) {
+                if (m_runs[n - 1].length < m_runs[n + 1].length)
+                    --n;
+                TRY(merge_at(n));
+            } else if (m_runs[n].length <= m_runs[n + 1].length) {
+                TRY(merge_at(n));
+            } else {
+                break;
+            }
+        }
+        return {};
+    }
+
+    ThrowCompletionOr<void> merge_force_collapse()
+    {
+        while (m_runs.size() > 1) {
+            auto n = m_runs.size() - 2;
+            if (n > 0 && m_runs[n - 1].length < m_runs[n + 1].length)
+                --n;
+            TRY(merge_at(n));
+        }
+        return {};
+    }
+
+    // Merges the runs at index and index + 1, which are adjacent in items.
+    ThrowCompletionOr<void> merge_at(size_t index)
+    {
+        auto base_a = m_runs[index].base;
+        auto length_a = m_runs[index].length;
+        auto base_b = m_runs[index + 1].base;
+        auto length_b = m_runs[index + 1].length;
+
+        m_runs[index].length = length_a + length_b;
+        m_runs.remove(index + 1);
+
+        // Elements of A that are not greater than the first element of B are already in place, as are elements of B
+        // that are not less than the last element of A.
+        auto skipped = TRY(gallop_right(m_items[base_b], m_items.slice(base_a, length_a), 0));
+        base_a += skipped;
+        length_a -= skipped;
+        if (length_a == 0)
+            return {};
+
+        length_b = TRY(gallop_left(m_items[base_a + length_a - 1], m_items.slice(base_b, length_b), length_b - 1));
+        if (length_b == 0)
+            return {};
+
+        if (length_a <= length_b)
+            return merge_low(base_a, length_a, base_b, length_b);
+        return merge_high(base_a, length_a, base_b, length_b);
+    }
+
+    // Merges from the left, with A copied to the scratch buffer. Requires that A is not longer than B, that the first
+    // element of B is less than the first element of A, and that the last element of A is greater than every element
+    // of B. The comparator is held to none of this, so every step still checks that both runs have elements left.
+    ThrowCompletionOr<void> merge_low(size_t base_a, size_t length_a, size_t base_b, size_t length_b)
+    {
+        for (size_t i = 0; i < length_a; ++i)
+            m_scratch[i] = m_items[base_a + i];
+
+        size_t a = 0;
+        size_t b = base_b;
+        size_t destination = base_a;
+
+        // Whatever is left of A when the merge stops, including when the comparator throws, belongs at the end.
+        ScopeGuard copy_remaining_a = [&] {
+            for (size_t i = 0; i < length_a; ++i)
+                m_items[destination + i] = m_scratch[a + i];
+        };
+
+        auto finish_with_last_of_a = [&] {
+            // Only the greatest element of A is left, and it goes after everything that remains of B.
+            for (size_t i = 0; i < length_b; ++i)
+                m_items[destination + i] = m_items[b + i];
+            m_items[destination + length_b] = m_scratch[a];
+            length_a = 0;
+        };
+
+        m_items[destination++] = m_items[b++];
+        if (--length_b == 0)
+            return {};
+        if (length_a == 1) {
+            finish_with_last_of_a();
+            return {};
+        }
+
+        for (;;) {
+            size_t wins_a = 0;
+            size_t wins_b = 0;
+
+            // Compare one pair at a time until one run wins consistently.
+            do {
+                if (TRY(less_than(m_items[b], m_scratch[a]))) {
+                    m_items[destination++] = m_items[b++];
+                    ++wins_b;
+                    wins_a = 0;
+                    if (--length_b == 0)
+                        return {};
+                } else {
+                    m_items[destination++] = m_scratch[a++];
+                    ++wins_a;
+                    wins_b = 0;
+                    if (--length_a == 1) {
+                        finish_with_last_of_a();
+                        return {};
+                    }
+                }
+            } while ((wins_a | wins_b) < m_minimum_gallop);
+
+            // Gallop until neither run wins by much anymore.
+            ++m_minimum_gallop;
+            do {
+                m_minimum_gallop -= m_minimum_gallop > 1;
+
+                wins_a = TRY(gallop_right(m_items[b], m_scratch.slice(a, length_a), 0));
+                if (wins_a > 0) {
+                    for (size_t i = 0; i < wins_a; ++i)
+                        m_items[destination + i] = m_scratch[a + i];
+                    destination += wins_a;
+                    a += wins_a;
+                    length_a -= wins_a;
+                    if (length_a == 1) {
+                        finish_with_last_of_a();
+                        return {};
+                    }
+                    if (length_a == 0)
+                        return {};
+                }
+                m_items[destination++] = m_items[b++];
+                if (--length_b == 0)
+                    return {};
+
+                wins_b = TRY(gallop_left(m_scratch[a], m_items.slice(b, length_b), 0));
+                if (wins_b > 0) {
+                    for (size_t i = 0; i < wins_b; ++i)
+                        m_items[destination + i] = m_items[b + i];
+                    destination += wins_b;
+                    b += wins_b;
+                    length_b -= wins_b;
+                    if (length_b == 0)
+                        return {};
+                }
+                m_items[destination++] = m_scratch[a++];
+                if (--length_a == 1) {
+                    finish_with_last_of_a();
+                    return {};
+                }
+            } while (wins_a >= initial_minimum_gallop || wins_b >= initial_minimum_gallop);
+            ++m_minimum_gallop;
+        }
+    }
+
+    // Merges from the right, with B copied to the scratch buffer. The mirror image of merge_low().
+    ThrowCompletionOr<void> merge_high(size_t base_a, size_t length_a, size_t base_b, size_t length_b)
+    {
+        for (size_t i = 0; i < length_b; ++i)
+            m_scratch[i] = m_items[base_b + i];
+
+        // These index the last element of each run that is yet to be merged, and the slot to be filled next.
+        ssize_t a = base_a + length_a - 1;
+        ssize_t b = length_b - 1;
+        ssize_t destination = base_b + length_b - 1;
+
+        // Whatever is left of B when the merge stops, including when the comparator throws, belongs at the start.
+        ScopeGuard copy_remaining_b = [&] {
+            for (size_t i = 0; i < length_b; ++i)
+                m_items[destination - length_b + 1 + i] = m_scratch[i];
+        };
+
+        auto finish_with_first_of_b = [&] {
+            // Only the least element of B is left, and it goes before everything that remains of A.
+            for (size_t i = 0; i < length_a; ++i)
+                m_items[destination - i] = m_items[a - i];
+            m_items[destination - length_a] = m_scratch[b];
+            length_b = 0;
+        };
+
+        m_items[destination--] = m_items[a--];
+        if (--length_a == 0)
+            return {};
+        if (length_b == 1) {
+            finish_with_first_of_b();
+            return {};
+        }
+
+        for (;;) {
+            size_t wins_a = 0;
+            size_t wins_b = 0;
+
+            do {
+                if (TRY(less_than(m_scratch[b], m_items[a]))) {
+                    m_items[destination--] = m_items[a--];
+                    ++wins_a;
+                    wins_b = 0;
+                    if (--length_a == 0)
+                        return {};
+                } else {
+                    m_items[destination--] = m_scratch[b--];
+                    ++wins_b;
+                    wins_a = 0;
+                    if (--length_b == 1) {
+                        finish_with_first_of_b();
+                        return {};
+                    }
+                }
+            } while ((wins_a | wins_b) < m_minimum_gallop);
+
+            ++m_minimum_gallop;
+            do {
+                m_minimum_gallop -= m_minimum_gallop > 1;
+
+                wins_a = length_a - TRY(gallop_right(m_scratch[b], m_items.slice(base_a, length_a), length_a - 1));
+                if (wins_a > 0) {
+                    for (size_t i = 0; i < wins_a; ++i)
+                        m_items[destination - i] = m_items[a - i];
+                    destination -= wins_a;
+                    a -= wins_a;
+                    length_a -= wins_a;
+                    if (length_a == 0)
+                        return {};
+                }
+                m_items[destination--] = m_scratch[b--];
+                if (--length_b == 1) {
+                    finish_with_first_of_b();
+                    return {};
+                }
+
+                wins_b = length_b - TRY(gallop_left(m_items[a], m_scratch.slice(0, length_b), length_b - 1));
+                if (wins_b > 0) {
+                    for (size_t i = 0; i < wins_b; ++i)
+                        m_items[destination - i] = m_scratch[b - i];
+                    destination -= wins_b;
+                    b -= wins_b;
+                    length_b -= wins_b;
+                    if (length_b == 1) {
+                        finish_with_first_of_b();
+                        return {};
+                    }
+                    if (length_b == 0)
+                        return {};
+                }
+                m_items[destination--] = m_items[a--];
+                if (--length_a == 0)
+                    return {};
+            } while (wins_a >= initial_minimum_gallop || wins_b >= initial_minimum_gallop);
+            ++m_minimum_gallop;
+        }
+    }
+
+    Span<T> m_items;
+    Span<T> m_scratch;
+    LessThan const& m_less_than;
+    size_t m_minimum_gallop { initial_minimum_gallop };
+    Vector<Run, 85> m_runs;
+};
+
+}
+
+// Sorts items stably in place. The scratch buffer must hold at least half as many elements as items. less_than is
+// called with two elements and returns ThrowCompletionOr<bool>; if it throws, sorting stops and items is left in some
+// permutation of its original order.
+template<typename T, typename LessThan>
+ThrowCompletionOr<void> tim_sort(Span<T> items, Span<T> scratch, LessThan const& less_than)
+{
+    return Detail::TimSort<T, LessThan> { items, scratch, less_than }.sort();
+}
+
+// Sorts values stably in place, ordered by sort_compare as SortIndexedProperties describes.
+ThrowCompletionOr<void> sort_values(Span<Value>, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare);
+
+// Sorts values stably in place, ordered as CompareArrayElements orders them without a comparefn.
+ThrowCompletionOr<void> sort_values_in_default_order(VM&, Span<Value>);
+
+// Sorts the first length elements of source numerically, as CompareTypedArrayElements orders them without a
+// comparefn, and writes them to destination, which may be source and must be of the same kind.
+void sort_typed_array_elements_in_default_order(TypedArrayBase const& source, TypedArrayBase& destination, u32 length);
+
+}
@@ -5,11 +5,12 @@
  */
 
 #include <AK/TypeCasts.h>
+#include <LibGC/Function.h>
 #include <LibJS/Runtime/AsyncFunctionDriverWrapper.h>
 #include <LibJS/Runtime/GlobalObject.h>
-#include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/PromiseCapability.h>
 #include <LibJS/Runtime/PromiseConstructor.h>
+#include <LibJS/Runtime/PromiseReaction.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Runtime/ValueInlines.h>
 
@@ -82,49 +83,22 @@ ThrowCompletionOr<void> AsyncFunctionDriverWrapper::await(JS::Value value)
 
     // 3. Let fulfilledClosure be a new Abstract Closure with parameters (v) that captures asyncContext and performs the
     //    following steps when called:
+    // 4. Let onFulfilled be CreateBuiltinFunction(fulfilledClosure, 1, "", « »).
     // 5. Let rejectedClosure be a new Abstract Closure with parameters (reason) that captures asyncContext and performs the
     //    following steps when called:
-    // OPTIMIZATION: onRejected and onFulfilled are identical other than the resumption value passed to continue_async_execution.
-    //               To avoid allocated two GC functions down this path, we combine both callbacks into one function.
-    auto settled_closure = [this](VM& vm) -> ThrowCompletionOr<Value> {
-        auto reason = vm.argument(0);
-
-        // The currently awaited promise is settled when this reaction runs, so we can use
-        // its state to decide whether to resume with a normal or throw completion.
-        VERIFY(m_current_promise);
-        auto is_successful = m_current_promise->state() == Promise::State::Fulfilled;
-        VERIFY(is_successful || m_current_promise->state() == Promise::State::Rejected);
-
-        // a. Let prevContext be the running execution context.
-        auto& prev_context = vm.running_execution_context();
-
-        // b. Suspend prevContext.
-        // c. Push asyncContext onto the execution context stack; asyncContext is now the running execution context.
-        TRY(vm.push_execution_context(*m_suspended_execution_context, {}));
-
-        // 3.d. Resume the suspended evaluation of asyncContext using NormalCompletion(v) as the result of the operation that
-        //      suspended it.
-        // 5.d. Resume the suspended evaluation of asyncContext using ThrowCompletion(reason) as the result of the operation that
-        //      suspended it.
-        continue_async_execution(vm, reason, is_successful);
-        vm.pop_execution_context();
-
-        // e. Assert: When we reach this step, asyncContext has already been removed from the execution context stack and
-        //    prevContext is the currently running execution context.
-        VERIFY(&vm.running_execution_context() == &prev_context);
-
-        // f. Return undefined.
-        return js_undefined();
-    };
-
-    // 4. Let onFulfilled be CreateBuiltinFunction(fulfilledClosure, 1, "", « »).
     // 6. Let onRejected be CreateBuiltinFunction(rejectedClosure, 1, "", « »).
-    if (!m_on_settled)
-        m_on_settled = NativeFunction::create(realm, move(settled_closure), 1);
+    // OPTIMIZATION: Instead of creating onFulfilled and onRejected and wrapping each of them in a new reaction on every
+    //               await, the promise is handed a pair of reactions that were created once. Their job resumes this
+    //               function straight from the job queue, with the result of the settled promise that onFulfilled or
+    //               onRejected would have been called with. See resume_job() for the steps of the closures.
+    if (!m_fulfill_reaction) {
+        m_fulfill_reaction = PromiseReaction::create_with_job(vm, PromiseReaction::Type::Fulfill, resume_job(), realm);
+        m_reject_reaction = PromiseReaction::create_with_job(vm, PromiseReaction::Type::Reject, resume_job(), realm);
+    }
 
     // 7. Perform PerformPromiseThen(promise, onFulfilled, onRejected).
     m_current_promise = as<Promise>(promise_object);
-    m_current_promise->perform_then(m_on_settled, m_on_settled, {});
+    m_current_promise->perform_then(*m_fulfill_reaction, *m_reject_reaction);
 
     // NOTE: None of these are necessary. 8-12 are handled by step d of the above lambdas.
     // 8. Remove asyncContext from the execution context stack and restore the execution context that is at the top of the
@@ -139,14 +113,50 @@ ThrowCompletionOr<void> AsyncFunctionDriverWrapper::await(JS::Value value)
 void AsyncFunctionDriverWrapper::schedule_resume(Value value, bool is_fulfilled)
 {
     auto& vm = this->vm();
-    vm.host_enqueue_promise_job(
-        GC::create_function(vm.heap(), [this, value, is_fulfilled, &vm]() -> ThrowCompletionOr<Value> {
-            TRY(vm.push_execution_context(*m_suspended_execution_context, {}));
-            continue_async_execution(vm, value, is_fulfilled);
-            vm.pop_execution_context();
-            return js_undefined();
-        }),
-        vm.current_realm());
+
+    m_current_promise = nullptr;
+    m_resume_value = value;
+    m_resume_is_fulfilled = is_fulfilled;
+    vm.host_enqueue_promise_job(resume_job(), vm.current_realm());
+}
+
+GC::Ref<AsyncFunctionDriverWrapper::ResumeJob> AsyncFunctionDriverWrapper::resume_job()
+{
+    if (m_resume_job)
+        return *m_resume_job;
+
+    m_resume_job = GC::create_function(heap(), [this]() -> ThrowCompletionOr<Value> {
+        auto& vm = this->vm();
+
+        // The awaited promise is settled by the time its reaction runs this, so its state decides whether we resume
+        // with a normal or a throw completion. Without one, we resume with what schedule_resume() was given.
+        auto value = exchange(m_resume_value, js_undefined());
+        auto is_successful = m_resume_is_fulfilled;
+        if (auto promise = exchange(m_current_promise, nullptr)) {
+            VERIFY(promise->state() != Promise::State::Pending);
+            value = promise->result();
+            is_successful = promise->state() == Promise::State::Fulfilled;
+        }
+
+        // a. Let prevContext be the running execution context.
+        // b. Suspend prevContext.
+        // c. Push asyncContext onto the execution context stack; asyncContext is now the running execution context.
+        TRY(vm.push_execution_context(*m_suspended_execution_context, {}));
+
+        // 3.d. Resume the suspended evaluation of asyncContext using NormalCompletion(v) as the result of the operation that
+        //      suspended it.
+        // 5.d. Resume the suspended evaluation of asyncContext using ThrowCompletion(reason) as the result of the operation that
+        //      suspended it.
+        continue_async_execution(vm, value, is_successful);
+
+        // e. Assert: When we reach this step, asyncContext has already been removed from the execution context stack and
+        //    prevContext is the currently running execution context.
+        vm.pop_execution_context();
+
+        // f. Return undefined.
+        return js_undefined();
+    });
+    return *m_resume_job;
 }
 
 void AsyncFunctionDriverWrapper::continue_async_execution(VM& vm, Value value, bool is_successful)
@@ -226,7 +236,10 @@ void AsyncFunctionDriverWrapper::visit_edges(Cell::Visitor& visitor)
         visitor.visit(m_current_promise);
     if (m_suspended_execution_context)
         m_suspended_execution_context->visit_edges(visitor);
-    visitor.visit(m_on_settled);
+    visitor.visit(m_resume_job);
+    visitor.visit(m_fulfill_reaction);
+    visitor.visit(m_reject_reaction);
+    visitor.visit(m_resume_value);
 }
 
 }
@@ -28,15 +28,27 @@ public:
     void schedule_resume(Value, bool is_fulfilled);
 
 private:
+    using ResumeJob = GC::Function<ThrowCompletionOr<Value>()>;
+
     AsyncFunctionDriverWrapper(Realm&, GC::Ref<GeneratorObject>, GC::Ref<Promise> top_level_promise);
     ThrowCompletionOr<void> await(Value);
+    GC::Ref<ResumeJob> resume_job();
 
     GC::Ref<GeneratorObject> m_generator_object;
     GC::Ref<Promise> m_top_level_promise;
     GC::Ptr<Promise> m_current_promise { nullptr };
     OwnPtr<ExecutionContext> m_suspended_execution_context;
 
-    GC::Ptr<NativeFunction> m_on_settled;
+    // Every await resumes this function through the same job and, when it has to wait for a promise, the same
+    // reactions. At most one of them is in use at a time, since the function is suspended until the job has run.
+    GC::Ptr<ResumeJob> m_resume_job;
+    GC::Ptr<PromiseReaction> m_fulfill_reaction;
+    GC::Ptr<PromiseReaction> m_reject_reaction;
+
+    // What the resume job resumes with when there is no promise to take the result from.
+    Value m_resume_value;
+    bool m_resume_is_fulfilled { true };
+
     bool m_is_initial_execution { true };
 };
 
@@ -19,6 +19,7 @@
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Intl/DateTimeFormat.h>
 #include <LibJS/Runtime/Intl/DateTimeFormatConstructor.h>
+#include <LibJS/Runtime/Intl/FormatterCache.h>
 #include <LibJS/Runtime/Temporal/AbstractOperations.h>
 #include <LibJS/Runtime/Temporal/Instant.h>
 #include <LibJS/Runtime/Temporal/TimeZone.h>
@@ -1004,10 +1005,15 @@ JS_DEFINE_NATIVE_FUNCTION(DatePrototype::to_locale_date_string)
         return PrimitiveString::create(vm, "Invalid Date"_utf16_fly_string);
 
     // 3. Let dateFormat be ? CreateDateTimeFormat(%DateTimeFormat%, locales, options, "date", "date").
-    auto date_format = TRY(Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Date, Intl::OptionDefaults::Date));
+    // OPTIMIZATION: Without options, the date-time format for these locales is taken from the realm's formatter cache.
+    GC::Ptr<Intl::DateTimeFormat> date_format;
+    if (Intl::FormatterCache::can_cache(locales, options))
+        date_format = TRY(realm.intrinsics().intl_formatter_cache()->date_time_format(vm, locales, Intl::OptionRequired::Date, Intl::OptionDefaults::Date));
+    else
+        date_format = TRY(Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Date, Intl::OptionDefaults::Date));
 
     // 4. Return ? FormatDateTime(dateFormat, x).
-    auto formatted = TRY(Intl::format_date_time(vm, date_format, time));
+    auto formatted = TRY(Intl::format_date_time(vm, *date_format, time));
     return PrimitiveString::create(vm, move(formatted));
 }
 
@@ -1028,10 +1034,15 @@ JS_DEFINE_NATIVE_FUNCTION(DatePrototype::to_locale_string)
         return PrimitiveString::create(vm, "Invalid Date"_utf16_fly_string);
 
     // 3. Let dateFormat be ? CreateDateTimeFormat(%DateTimeFormat%, locales, options, "any", "all").
-    auto date_format = TRY(Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Any, Intl::OptionDefaults::All));
+    // OPTIMIZATION: Without options, the date-time format for these locales is taken from the realm's formatter cache.
+    GC::Ptr<Intl::DateTimeFormat> date_format;
+    if (Intl::FormatterCache::can_cache(locales, options))
+        date_format = TRY(realm.intrinsics().intl_formatter_cache()->date_time_format(vm, locales, Intl::OptionRequired::Any, Intl::OptionDefaults::All));
+    else
+        date_format = TRY(Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Any, Intl::OptionDefaults::All));
 
     // 4. Return ? FormatDateTime(dateFormat, x).
-    auto formatted = TRY(Intl::format_date_time(vm, date_format, time));
+    auto formatted = TRY(Intl::format_date_time(vm, *date_format, time));
     return PrimitiveString::create(vm, move(formatted));
 }
 
@@ -1052,10 +1063,15 @@ JS_DEFINE_NATIVE_FUNCTION(DatePrototype::to_locale_time_string)
         return PrimitiveString::create(vm, "Invalid Date"_utf16_fly_string);
 
     // 3. Let timeFormat be ? CreateDateTimeFormat(%DateTimeFormat%, locales, options, "time", "time").
-    auto time_format = TRY(Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Time, Intl::OptionDefaults::Time));
+    // OPTIMIZATION: Without options, the date-time format for these locales is taken from the realm's formatter cache.
+    GC::Ptr<Intl::DateTimeFormat> time_format;
+    if (Intl::FormatterCache::can_cache(locales, options))
+        time_format = TRY(realm.intrinsics().intl_formatter_cache()->date_time_format(vm, locales, Intl::OptionRequired::Time, Intl::OptionDefaults::Time));
+    else
+        time_format = TRY(Intl::create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, options, Intl::OptionRequired::Time, Intl::OptionDefaults::Time));
 
     // 4. Return ? FormatDateTime(timeFormat, x).
-    auto formatted = TRY(Intl::format_date_time(vm, time_format, time));
+    auto formatted = TRY(Intl::format_date_time(vm, *time_format, time));
     return PrimitiveString::create(vm, move(formatted));
 }
 
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/AbstractOperations.h>
+#include <LibJS/Runtime/Date.h>
+#include <LibJS/Runtime/Intl/Collator.h>
+#include <LibJS/Runtime/Intl/DateTimeFormat.h>
+#include <LibJS/Runtime/Intl/FormatterCache.h>
+#include <LibJS/Runtime/Intl/NumberFormat.h>
+#include <LibJS/Runtime/Intrinsics.h>
+#include <LibJS/Runtime/Realm.h>
+#include <LibJS/Runtime/VM.h>
+
+namespace JS::Intl {
+
+GC_DEFINE_ALLOCATOR(FormatterCache);
+
+bool FormatterCache::can_cache(Value locales, Value options)
+{
+    // A string locale is canonicalized without calling into script. Anything else, such as an array of locales or an
+    // options object, may have getters that would have to be called for every formatter.
+    return (locales.is_undefined() || locales.is_string()) && options.is_undefined();
+}
+
+static Optional<Utf16String> locale_key(Value locales)
+{
+    if (locales.is_undefined())
+        return {};
+    return locales.as_string().utf16_string();
+}
+
+ThrowCompletionOr<GC::Ref<NumberFormat>> FormatterCache::number_format(VM& vm, Value locales)
+{
+    Key key { .kind = Kind::NumberFormat, .locale = locale_key(locales) };
+
+    return find_or_create<NumberFormat>(move(key), [&]() {
+        auto& realm = *vm.current_realm();
+        return construct(vm, realm.intrinsics().intl_number_format_constructor(), locales, js_undefined());
+    });
+}
+
+ThrowCompletionOr<GC::Ref<Collator>> FormatterCache::collator(VM& vm, Value locales)
+{
+    Key key { .kind = Kind::Collator, .locale = locale_key(locales) };
+
+    return find_or_create<Collator>(move(key), [&]() {
+        auto& realm = *vm.current_realm();
+        return construct(vm, realm.intrinsics().intl_collator_constructor(), locales, js_undefined());
+    });
+}
+
+ThrowCompletionOr<GC::Ref<DateTimeFormat>> FormatterCache::date_time_format(VM& vm, Value locales, OptionRequired required, OptionDefaults defaults)
+{
+    Key key {
+        .kind = Kind::DateTimeFormat,
+        .locale = locale_key(locales),
+        .required = required,
+        .defaults = defaults,
+        .time_zone = system_time_zone_identifier(),
+    };
+
+    return find_or_create<DateTimeFormat>(move(key), [&]() -> ThrowCompletionOr<GC::Ref<Object>> {
+        auto& realm = *vm.current_realm();
+        return TRY(create_date_time_format(vm, realm.intrinsics().intl_date_time_format_constructor(), locales, js_undefined(), required, defaults));
+    });
+}
+
+template<typename T, typename Callback>
+ThrowCompletionOr<GC::Ref<T>> FormatterCache::find_or_create(Key key, Callback&& create)
+{
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        if (m_entries[i].key != key)
+            continue;
+
+        auto formatter = m_entries[i].formatter;
+        if (i != m_entries.size() - 1)
+            m_entries.append(m_entries.take(i));
+        return as<T>(*formatter);
+    }
+
+    // Formatters that fail to be created, e.g. due to an invalid locale, are not cached, so that the error is thrown again.
+    auto formatter = TRY(create());
+
+    if (m_entries.size() == MAX_ENTRY_COUNT)
+        m_entries.remove(0);
+    m_entries.append({ move(key), formatter });
+
+    return as<T>(*formatter);
+}
+
+void FormatterCache::visit_edges(Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    for (auto const& entry : m_entries)
+        visitor.visit(entry.formatter);
+}
+
+}
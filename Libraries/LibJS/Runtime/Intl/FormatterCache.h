@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/Utf16String.h>
+#include <AK/Vector.h>
+#include <LibGC/CellAllocator.h>
+#include <LibJS/Forward.h>
+#include <LibJS/Heap/Cell.h>
+#include <LibJS/Runtime/Completion.h>
+#include <LibJS/Runtime/Intl/DateTimeFormatConstructor.h>
+
+namespace JS::Intl {
+
+// The toLocaleString() family of methods construct a new formatter, and with it a new ICU formatter, on every call.
+// Most callers pass no options, and either no locales or the same locale string each time, which can be told apart
+// without any observable side effects. The formatters created for those calls are kept here, per realm, so that they
+// can be reused. They are never exposed to script, so sharing them is not observable either.
+class FormatterCache final : public Cell {
+    GC_CELL(FormatterCache, Cell);
+    GC_DECLARE_ALLOCATOR(FormatterCache);
+
+public:
+    static constexpr size_t MAX_ENTRY_COUNT = 16;
+
+    static bool can_cache(Value locales, Value options);
+
+    virtual ~FormatterCache() override = default;
+
+    // These may only be called with locales and options for which can_cache() is true.
+    ThrowCompletionOr<GC::Ref<NumberFormat>> number_format(VM&, Value locales);
+    ThrowCompletionOr<GC::Ref<Collator>> collator(VM&, Value locales);
+    ThrowCompletionOr<GC::Ref<DateTimeFormat>> date_time_format(VM&, Value locales, OptionRequired, OptionDefaults);
+
+private:
+    enum class Kind : u8 {
+        NumberFormat,
+        Collator,
+        DateTimeFormat,
+    };
+
+    struct Key {
+        bool operator==(Key const&) const = default;
+
+        Kind kind { Kind::NumberFormat };
+        Optional<Utf16String> locale;
+
+        // Only used by date-time formats, which resolve the system time zone when they are created.
+        OptionRequired required { OptionRequired::Any };
+        OptionDefaults defaults { OptionDefaults::All };
+        Utf16String time_zone;
+    };
+
+    struct Entry {
+        Key key;
+        GC::Ref<Object> formatter;
+    };
+
+    FormatterCache() = default;
+
+    virtual void visit_edges(Visitor&) override;
+
+    template<typename T, typename Callback>
+    ThrowCompletionOr<GC::Ref<T>> find_or_create(Key, Callback&& create);
+
+    // Ordered from least to most recently used.
+    Vector<Entry> m_entries;
+};
+
+}
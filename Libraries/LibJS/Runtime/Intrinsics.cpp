@@ -54,6 +54,7 @@
 #include <LibJS/Runtime/Intl/DisplayNamesPrototype.h>
 #include <LibJS/Runtime/Intl/DurationFormatConstructor.h>
 #include <LibJS/Runtime/Intl/DurationFormatPrototype.h>
+#include <LibJS/Runtime/Intl/FormatterCache.h>
 #include <LibJS/Runtime/Intl/Intl.h>
 #include <LibJS/Runtime/Intl/ListFormatConstructor.h>
 #include <LibJS/Runtime/Intl/ListFormatPrototype.h>
@@ -239,11 +240,20 @@ GC::Ref<Intrinsics> Intrinsics::create(Realm& realm)
     return *intrinsics;
 }
 
-static Vector<GC::Root<SharedFunctionInstanceData>> parse_builtin_file(Utf16View script_text, VM& vm)
+static SharedFunctionInstanceData& find_builtin_function(Vector<GC::Ref<SharedFunctionInstanceData>>& shared_data_cache, Utf16View script_text, VM& vm, StringView name)
 {
-    auto rust_compilation = RustIntegration::compile_builtin_file(script_text, vm);
-    VERIFY(rust_compilation.has_value());
-    return move(rust_compilation.value());
+    if (shared_data_cache.is_empty()) {
+        auto rust_compilation = RustIntegration::compile_builtin_file(script_text, vm);
+        VERIFY(rust_compilation.has_value());
+        for (auto& shared_data : rust_compilation.value())
+            shared_data_cache.append(*shared_data);
+    }
+
+    auto it = shared_data_cache.find_if([&](auto const& shared_data) {
+        return shared_data->m_name == name;
+    });
+    VERIFY(!it.is_end());
+    return **it;
 }
 
 void Intrinsics::initialize_intrinsics(Realm& realm)
@@ -561,6 +571,7 @@ void Intrinsics::visit_edges(Visitor& visitor)
 #undef __JS_ENUMERATE
 
     visitor.visit(m_default_collator);
+    visitor.visit(m_intl_formatter_cache);
 
 #define __JS_ENUMERATE(snake_name, functionName, length) \
     visitor.visit(m_##snake_name##_abstract_operation_function);
@@ -581,34 +592,33 @@ GC::Ref<Intl::Collator> Intrinsics::default_collator()
     return *m_default_collator;
 }
 
-#define __JS_ENUMERATE(snake_name, functionName, length)                                                                                                                                                        \
-    GC::Ref<NativeJavaScriptBackedFunction> Intrinsics::snake_name##_abstract_operation_function()                                                                                                              \
-    {                                                                                                                                                                                                           \
-        if (!m_##snake_name##_abstract_operation_function) {                                                                                                                                                    \
-            auto shared_data_list = parse_builtin_file(abstract_operations_source(), m_realm->vm());                                                                                                            \
-            auto it = shared_data_list.find_if([](auto const& shared_data) {                                                                                                                                    \
-                return shared_data->m_name == #functionName##sv;                                                                                                                                                \
-            });                                                                                                                                                                                                 \
-            VERIFY(!it.is_end());                                                                                                                                                                               \
-            m_##snake_name##_abstract_operation_function = NativeJavaScriptBackedFunction::create(m_realm, **it, PropertyKey { #functionName##_utf16_fly_string, PropertyKey::StringMayBeNumber::No }, length); \
-        }                                                                                                                                                                                                       \
-        return *m_##snake_name##_abstract_operation_function;                                                                                                                                                   \
+GC::Ref<Intl::FormatterCache> Intrinsics::intl_formatter_cache()
+{
+    if (!m_intl_formatter_cache)
+        m_intl_formatter_cache = heap().allocate<Intl::FormatterCache>();
+    return *m_intl_formatter_cache;
+}
+
+#define __JS_ENUMERATE(snake_name, functionName, length)                                                                                                                                                               \
+    GC::Ref<NativeJavaScriptBackedFunction> Intrinsics::snake_name##_abstract_operation_function()                                                                                                                     \
+    {                                                                                                                                                                                                                  \
+        if (!m_##snake_name##_abstract_operation_function) {                                                                                                                                                           \
+            auto& shared_data = find_builtin_function(m_realm->vm().builtin_abstract_operations_shared_data({}), abstract_operations_source(), m_realm->vm(), #functionName##sv);                                      \
+            m_##snake_name##_abstract_operation_function = NativeJavaScriptBackedFunction::create(m_realm, shared_data, PropertyKey { #functionName##_utf16_fly_string, PropertyKey::StringMayBeNumber::No }, length); \
+        }                                                                                                                                                                                                              \
+        return *m_##snake_name##_abstract_operation_function;                                                                                                                                                          \
     }
 JS_ENUMERATE_NATIVE_JAVASCRIPT_BACKED_ABSTRACT_OPERATIONS
 #undef __JS_ENUMERATE
 
-#define __JS_ENUMERATE(snake_name, functionName, length)                                                                                                                                                       \
-    GC::Ref<NativeJavaScriptBackedFunction> Intrinsics::snake_name##_array_constructor_function()                                                                                                              \
-    {                                                                                                                                                                                                          \
-        if (!m_##snake_name##_array_constructor_function) {                                                                                                                                                    \
-            auto shared_data_list = parse_builtin_file(array_constructor_source(), m_realm->vm());                                                                                                             \
-            auto it = shared_data_list.find_if([](auto const& shared_data) {                                                                                                                                   \
-                return shared_data->m_name == #functionName##sv;                                                                                                                                               \
-            });                                                                                                                                                                                                \
-            VERIFY(!it.is_end());                                                                                                                                                                              \
-            m_##snake_name##_array_constructor_function = NativeJavaScriptBackedFunction::create(m_realm, **it, PropertyKey { #functionName##_utf16_fly_string, PropertyKey::StringMayBeNumber::No }, length); \
-        }                                                                                                                                                                                                      \
-        return *m_##snake_name##_array_constructor_function;                                                                                                                                                   \
+#define __JS_ENUMERATE(snake_name, functionName, length)                                                                                                                                                              \
+    GC::Ref<NativeJavaScriptBackedFunction> Intrinsics::snake_name##_array_constructor_function()                                                                                                                     \
+    {                                                                                                                                                                                                                 \
+        if (!m_##snake_name##_array_constructor_function) {                                                                                                                                                           \
+            auto& shared_data = find_builtin_function(m_realm->vm().builtin_array_constructor_shared_data({}), array_constructor_source(), m_realm->vm(), #functionName##sv);                                         \
+            m_##snake_name##_array_constructor_function = NativeJavaScriptBackedFunction::create(m_realm, shared_data, PropertyKey { #functionName##_utf16_fly_string, PropertyKey::StringMayBeNumber::No }, length); \
+        }                                                                                                                                                                                                             \
+        return *m_##snake_name##_array_constructor_function;                                                                                                                                                          \
     }
 JS_ENUMERATE_NATIVE_JAVASCRIPT_BACKED_ARRAY_CONSTRUCTOR_FUNCTIONS
 #undef __JS_ENUMERATE
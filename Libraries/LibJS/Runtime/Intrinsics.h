@@ -142,6 +142,7 @@ public:
 #undef __JS_ENUMERATE
 
     [[nodiscard]] GC::Ref<Intl::Collator> default_collator();
+    [[nodiscard]] GC::Ref<Intl::FormatterCache> intl_formatter_cache();
 
 #define __JS_ENUMERATE(snake_name, functionName, length) \
     GC::Ref<NativeJavaScriptBackedFunction> snake_name##_abstract_operation_function();
@@ -290,6 +291,7 @@ private:
 #undef __JS_ENUMERATE
 
     GC::Ptr<Intl::Collator> m_default_collator;
+    GC::Ptr<Intl::FormatterCache> m_intl_formatter_cache;
 };
 
 void add_restricted_function_properties(FunctionObject&, Realm&);
@@ -7,9 +7,11 @@
  */
 
 #include <LibJS/Runtime/AbstractOperations.h>
+#include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/AsyncFromSyncIteratorPrototype.h>
 #include <LibJS/Runtime/Error.h>
 #include <LibJS/Runtime/FunctionObject.h>
+#include <LibJS/Runtime/Intrinsics.h>
 #include <LibJS/Runtime/Iterator.h>
 #include <LibJS/Runtime/VM.h>
 
@@ -456,11 +458,8 @@ ThrowCompletionOr<void> setter_that_ignores_prototype_properties(VM& vm, Value t
     return {};
 }
 
-// Non-standard
-Completion get_iterator_values(VM& vm, Value iterable, IteratorValueCallback callback)
+static Completion iterate_values(VM& vm, IteratorRecordImpl& iterator_record, IteratorValueCallback& callback)
 {
-    auto iterator_record = TRY(get_iterator_impl(vm, iterable, IteratorHint::Sync));
-
     while (true) {
         auto next = TRY(iterator_step_value(vm, iterator_record));
         if (!next.has_value())
@@ -471,4 +470,46 @@ Completion get_iterator_values(VM& vm, Value iterable, IteratorValueCallback cal
     }
 }
 
+// Non-standard
+Completion get_iterator_values(VM& vm, Value iterable, IteratorValueCallback callback)
+{
+    // OPTIMIZATION: When an Array would be iterated by %Array.prototype.values% and the built-in %ArrayIteratorPrototype%.next,
+    //               we do the work of each next() call directly instead of creating an iterator. The iterator would never
+    //               be visible to user code, and neither has a "return" method, so this is not observable.
+    if (auto* array = iterable.is_object() ? as_if<Array>(iterable.as_object()) : nullptr) {
+        auto& realm = *vm.current_realm();
+
+        static auto& cache = *new Bytecode::StaticPropertyLookupCache;
+        auto method = TRY(iterable.get_method(vm, vm.well_known_symbol_iterator(), cache));
+        if (!method)
+            return vm.throw_completion<TypeError>(ErrorType::NotIterable, iterable);
+
+        auto next_method = realm.intrinsics().array_iterator_prototype()->get_without_side_effects(vm.names.next);
+        if (method.ptr() == realm.intrinsics().array_prototype_values_function().ptr() && next_method.is_function() && next_method.as_function().is_array_prototype_next_builtin()) {
+            for (size_t index = 0;; ++index) {
+                if (index >= TRY(length_of_array_like(vm, *array)))
+                    return {};
+
+                auto value = TRY([&]() -> ThrowCompletionOr<Value> {
+                    if (!array->may_interfere_with_indexed_property_access() && array->indexed_has(index)) {
+                        if (auto value = array->indexed_get(index)->value; !value.is_accessor())
+                            return value;
+                    }
+
+                    return array->get(index);
+                }());
+
+                if (auto completion = callback(value); completion.has_value())
+                    return completion.release_value();
+            }
+        }
+
+        auto iterator_record = TRY(get_iterator_from_method_impl(vm, iterable, *method));
+        return iterate_values(vm, iterator_record, callback);
+    }
+
+    auto iterator_record = TRY(get_iterator_impl(vm, iterable, IteratorHint::Sync));
+    return iterate_values(vm, iterator_record, callback);
+}
+
 }
@@ -4,9 +4,11 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/ByteBuffer.h>
 #include <AK/Function.h>
 #include <AK/GenericLexer.h>
+#include <AK/HashMap.h>
 #include <AK/StringConversions.h>
 #include <AK/TypeCasts.h>
 #include <AK/UnicodeUtils.h>
@@ -23,6 +25,7 @@
 #include <LibJS/Runtime/NumberObject.h>
 #include <LibJS/Runtime/Object.h>
 #include <LibJS/Runtime/RawJSONObject.h>
+#include <LibJS/Runtime/Shape.h>
 #include <LibJS/Runtime/StringObject.h>
 #include <LibJS/Runtime/ValueInlines.h>
 
@@ -685,7 +688,28 @@ static ErrorOr<JSONTextBytes> json_text_bytes(Utf16View text)
     return text_bytes;
 }
 
-static ThrowCompletionOr<Value> parse_simdjson_value(VM&, JSONTextBytes const&, simdjson::ondemand::value, JSONParseRecord* record = nullptr);
+// State shared by every value produced by a single ParseJSON() call.
+struct JSONParseState {
+    explicit JSONParseState(JSONTextBytes const& text)
+        : text(text)
+    {
+    }
+
+    JSONTextBytes const& text;
+
+    // Documents tend to repeat the same handful of keys over and over, so we unescape and intern each raw key only once.
+    // NB: The raw keys point into simdjson's padded copy of the text, which outlives the parse.
+    HashMap<StringView, PropertyKey> interned_keys;
+};
+
+// Arrays of objects usually hold records that all have the same keys in the same order. Each object in an array
+// is built on the shape of its previous sibling object, so the shape transitions are only walked once per array.
+struct JSONObjectShapeHint {
+    GC::Ptr<Shape> shape;
+    Vector<PropertyKey> keys;
+};
+
+static ThrowCompletionOr<Value> parse_simdjson_value(VM&, JSONParseState&, simdjson::ondemand::value, JSONParseRecord* record = nullptr, JSONObjectShapeHint* shape_hint = nullptr);
 
 // The source text matched by a primitive parse node, used by JSON.parse revivers.
 static Utf16String json_token_source(JSONTextBytes const& json_text, std::string_view raw)
@@ -773,7 +797,7 @@ static ThrowCompletionOr<Value> parse_simdjson_string(VM& vm, T& value)
 }
 
 template<typename T>
-static ThrowCompletionOr<Value> parse_simdjson_array(VM& vm, JSONTextBytes const& json_text, T& value, JSONParseRecord* record = nullptr)
+static ThrowCompletionOr<Value> parse_simdjson_array(VM& vm, JSONParseState& state, T& value, JSONParseRecord* record = nullptr)
 {
     auto& realm = *vm.current_realm();
 
@@ -783,13 +807,14 @@ static ThrowCompletionOr<Value> parse_simdjson_array(VM& vm, JSONTextBytes const
 
     auto array = MUST(Array::create(realm, 0));
     size_t index = 0;
+    JSONObjectShapeHint shape_hint;
 
     for (auto element : simdjson_array) {
         simdjson::ondemand::value element_value;
         if (element.get(element_value))
             return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
         JSONParseRecord element_record;
-        auto parsed = TRY(parse_simdjson_value(vm, json_text, element_value, record ? &element_record : nullptr));
+        auto parsed = TRY(parse_simdjson_value(vm, state, element_value, record ? &element_record : nullptr, &shape_hint));
         array->define_direct_property(index++, parsed, default_attributes);
         if (record)
             record->elements.append(move(element_record));
@@ -801,8 +826,31 @@ static ThrowCompletionOr<Value> parse_simdjson_array(VM& vm, JSONTextBytes const
     return array;
 }
 
+static ThrowCompletionOr<PropertyKey> parse_simdjson_key(VM& vm, JSONParseState& state, std::string_view raw_key)
+{
+    StringView raw { raw_key.data(), raw_key.size() };
+    if (auto it = state.interned_keys.find(raw); it != state.interned_keys.end())
+        return it->value;
+
+    auto unescaped_key = unescape_json_string(raw);
+    if (!unescaped_key.has_value())
+        return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+    PropertyKey key { unescaped_key.release_value() };
+    state.interned_keys.set(raw, key);
+    return key;
+}
+
+// Rebuilds an object that was speculatively created with a shape hint's shape, keeping only its first property_count properties.
+static GC::Ref<Object> abandon_shape_hint(Realm& realm, Object const& speculative_object, JSONObjectShapeHint const& shape_hint, size_t property_count)
+{
+    auto object = Object::create(realm, realm.intrinsics().object_prototype());
+    for (size_t i = 0; i < property_count; ++i)
+        object->define_direct_property(shape_hint.keys[i], speculative_object.get_direct(i), default_attributes);
+    return object;
+}
+
 template<typename T>
-static ThrowCompletionOr<Value> parse_simdjson_object(VM& vm, JSONTextBytes const& json_text, T& value, JSONParseRecord* record = nullptr)
+static ThrowCompletionOr<Value> parse_simdjson_object(VM& vm, JSONParseState& state, T& value, JSONParseRecord* record = nullptr, JSONObjectShapeHint* shape_hint = nullptr)
 {
     auto& realm = *vm.current_realm();
 
@@ -810,40 +858,73 @@ static ThrowCompletionOr<Value> parse_simdjson_object(VM& vm, JSONTextBytes cons
     if (value.get_object().get(simdjson_object))
         return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
 
-    auto object = Object::create(realm, realm.intrinsics().object_prototype());
+    // NB: While the keys match the hint, values are stored straight into the slots of the hinted shape.
+    bool is_following_shape_hint = shape_hint && shape_hint->shape;
+    GC::Ref<Object> object = is_following_shape_hint
+        ? Object::create_with_premade_shape(*shape_hint->shape)
+        : Object::create(realm, realm.intrinsics().object_prototype());
+    Vector<PropertyKey> keys;
+    size_t property_index = 0;
 
     for (auto field : simdjson_object) {
         // Use escaped_key() to get the raw JSON key (with escapes), then unescape ourselves
         std::string_view raw_key;
         if (field.escaped_key().get(raw_key))
             return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
-        auto unescaped_key = unescape_json_string({ raw_key.data(), raw_key.size() });
-        if (!unescaped_key.has_value())
-            return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+        auto key = TRY(parse_simdjson_key(vm, state, raw_key));
         simdjson::ondemand::value field_value;
         if (field.value().get(field_value))
             return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
-        auto key = unescaped_key.release_value();
         JSONParseRecord entry_record;
-        auto parsed = TRY(parse_simdjson_value(vm, json_text, field_value, record ? &entry_record : nullptr));
-        object->define_direct_property(key, parsed, default_attributes);
+        auto parsed = TRY(parse_simdjson_value(vm, state, field_value, record ? &entry_record : nullptr));
+
+        if (is_following_shape_hint && (property_index >= shape_hint->keys.size() || shape_hint->keys[property_index] != key)) {
+            object = abandon_shape_hint(realm, *object, *shape_hint, property_index);
+            is_following_shape_hint = false;
+        }
+        if (is_following_shape_hint)
+            object->put_direct(property_index, parsed);
+        else
+            object->define_direct_property(key, parsed, default_attributes);
+        if (shape_hint && !is_following_shape_hint)
+            keys.append(key);
+        ++property_index;
+
         if (record) {
-            entry_record.key = key;
+            entry_record.key = key.to_utf16_string();
             // Duplicate keys keep the last value, matching object property semantics.
-            if (auto existing = record->entries.find_if([&](auto& entry) { return entry.key == key; }); existing != record->entries.end())
+            if (auto existing = record->entries.find_if([&](auto& entry) { return entry.key == entry_record.key; }); existing != record->entries.end())
                 *existing = move(entry_record);
             else
                 record->entries.append(move(entry_record));
         }
     }
 
+    if (is_following_shape_hint && property_index != shape_hint->keys.size()) {
+        object = abandon_shape_hint(realm, *object, *shape_hint, property_index);
+        is_following_shape_hint = false;
+    }
+
+    if (shape_hint && !is_following_shape_hint) {
+        // Only plain shapes whose properties line up one-to-one with the keys can be reused. Duplicate keys and array
+        // indices (which live in indexed storage) break that correspondence.
+        auto& shape = object->shape();
+        if (!keys.is_empty() && !shape.is_dictionary() && shape.property_count() == keys.size() && !any_of(keys, [](auto& key) { return key.is_number(); })) {
+            shape_hint->shape = shape;
+            shape_hint->keys = move(keys);
+        } else {
+            shape_hint->shape = nullptr;
+            shape_hint->keys.clear();
+        }
+    }
+
     TRY(ensure_simdjson_fully_parsed(vm, value));
     if (record)
         record->value = object;
     return object;
 }
 
-static ThrowCompletionOr<Value> parse_simdjson_value(VM& vm, JSONTextBytes const& json_text, simdjson::ondemand::value value, JSONParseRecord* record)
+static ThrowCompletionOr<Value> parse_simdjson_value(VM& vm, JSONParseState& state, simdjson::ondemand::value value, JSONParseRecord* record, JSONObjectShapeHint* shape_hint)
 {
     simdjson::ondemand::json_type type;
     if (value.type().get(type))
@@ -854,7 +935,7 @@ static ThrowCompletionOr<Value> parse_simdjson_value(VM& vm, JSONTextBytes const
     case simdjson::ondemand::json_type::null:
         if (record) {
             record->value = js_null();
-            record->source = json_token_source(json_text, value.raw_json_token());
+            record->source = json_token_source(state.text, value.raw_json_token());
         }
         return js_null();
     case simdjson::ondemand::json_type::boolean: {
@@ -864,7 +945,7 @@ static ThrowCompletionOr<Value> parse_simdjson_value(VM& vm, JSONTextBytes const
             return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
         if (record) {
             record->value = Value(boolean_value);
-            record->source = json_token_source(json_text, token);
+            record->source = json_token_source(state.text, token);
         }
         return Value(boolean_value);
     }
@@ -874,7 +955,7 @@ static ThrowCompletionOr<Value> parse_simdjson_value(VM& vm, JSONTextBytes const
         auto parsed = TRY(parse_simdjson_number(vm, value, raw_sv));
         if (record) {
             record->value = parsed;
-            record->source = json_token_source(json_text, raw);
+            record->source = json_token_source(state.text, raw);
         }
         return parsed;
     }
@@ -883,14 +964,14 @@ static ThrowCompletionOr<Value> parse_simdjson_value(VM& vm, JSONTextBytes const
         auto parsed = TRY(parse_simdjson_string(vm, value));
         if (record) {
             record->value = parsed;
-            record->source = json_token_source(json_text, token);
+            record->source = json_token_source(state.text, token);
         }
         return parsed;
     }
     case simdjson::ondemand::json_type::array:
-        return parse_simdjson_array(vm, json_text, value, record);
+        return parse_simdjson_array(vm, state, value, record);
     case simdjson::ondemand::json_type::object:
-        return parse_simdjson_object(vm, json_text, value, record);
+        return parse_simdjson_object(vm, state, value, record, shape_hint);
     case simdjson::ondemand::json_type::unknown:
         return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
     }
@@ -898,7 +979,7 @@ static ThrowCompletionOr<Value> parse_simdjson_value(VM& vm, JSONTextBytes const
     VERIFY_NOT_REACHED();
 }
 
-static ThrowCompletionOr<Value> parse_simdjson_document(VM& vm, JSONTextBytes const& json_text, simdjson::ondemand::document& document, JSONParseRecord* record = nullptr)
+static ThrowCompletionOr<Value> parse_simdjson_document(VM& vm, JSONParseState& state, simdjson::ondemand::document& document, JSONParseRecord* record = nullptr)
 {
     simdjson::ondemand::json_type type;
     if (document.type().get(type))
@@ -921,7 +1002,7 @@ static ThrowCompletionOr<Value> parse_simdjson_document(VM& vm, JSONTextBytes co
             if (document.raw_json_token().get(null_token))
                 return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
             record->value = js_null();
-            record->source = json_token_source(json_text, null_token);
+            record->source = json_token_source(state.text, null_token);
         }
         return js_null();
     }
@@ -933,7 +1014,7 @@ static ThrowCompletionOr<Value> parse_simdjson_document(VM& vm, JSONTextBytes co
             return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
         if (record) {
             record->value = Value(boolean_value);
-            record->source = json_token_source(json_text, raw_token);
+            record->source = json_token_source(state.text, raw_token);
         }
         return Value(boolean_value);
     }
@@ -943,7 +1024,7 @@ static ThrowCompletionOr<Value> parse_simdjson_document(VM& vm, JSONTextBytes co
         auto parsed = TRY(parse_simdjson_number(vm, document, trimmed));
         if (record) {
             record->value = parsed;
-            record->source = json_token_source(json_text, raw_token);
+            record->source = json_token_source(state.text, raw_token);
         }
         return parsed;
     }
@@ -954,14 +1035,14 @@ static ThrowCompletionOr<Value> parse_simdjson_document(VM& vm, JSONTextBytes co
         auto parsed = TRY(parse_simdjson_string(vm, document));
         if (record) {
             record->value = parsed;
-            record->source = json_token_source(json_text, string_token);
+            record->source = json_token_source(state.text, string_token);
         }
         return parsed;
     }
     case simdjson::ondemand::json_type::array:
-        return parse_simdjson_array(vm, json_text, document, record);
+        return parse_simdjson_array(vm, state, document, record);
     case simdjson::ondemand::json_type::object:
-        return parse_simdjson_object(vm, json_text, document, record);
+        return parse_simdjson_object(vm, state, document, record);
     case simdjson::ondemand::json_type::unknown:
         return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
     }
@@ -993,7 +1074,8 @@ ThrowCompletionOr<Value> JSONObject::parse_json(VM& vm, Utf16View text, JSONPars
     // 4. NOTE: The early error rules defined in 13.2.5.1 have special handling for the above invocation of ParseText.
     // 5. Assert: script is a Parse Node.
     // 6. Let result be ! Evaluation of script.
-    auto result = TRY(parse_simdjson_document(vm, json_text, document, root_record));
+    JSONParseState state { json_text };
+    auto result = TRY(parse_simdjson_document(vm, state, document, root_record));
 
     // 7. NOTE: The PropertyDefinitionEvaluation semantics defined in 13.2.5.5 have special handling for the above evaluation.
     // 8. Assert: result is either a String, a Number, a Boolean, an Object that is defined by either an ArrayLiteral or an ObjectLiteral, or null.
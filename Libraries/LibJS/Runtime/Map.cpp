@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/StdLibExtras.h>
 #include <LibJS/Runtime/ExternalMemory.h>
 #include <LibJS/Runtime/Map.h>
 
@@ -25,80 +26,181 @@ Map::Map(Object& prototype)
 void Map::map_clear()
 {
     auto old_external_memory_size = external_memory_size();
-    m_keys.clear();
     m_entries.clear();
+    m_buckets.clear();
+    m_size = 0;
     account_external_memory_change(old_external_memory_size);
 }
 
 // 24.1.3.3 Map.prototype.delete ( key ), https://tc39.es/ecma262/#sec-map.prototype.delete
 bool Map::map_remove(Value const& key)
 {
-    Optional<size_t> index;
-
-    for (auto it = m_keys.begin(); !it.is_end(); ++it) {
-        if (ValueTraits::equals(*it, key)) {
-            index = it.key();
-            break;
-        }
-    }
-
-    if (!index.has_value())
+    auto position = find_entry(key, hash_key(key));
+    if (!position.has_value())
         return false;
 
-    auto old_external_memory_size = external_memory_size();
-    m_keys.remove(*index);
-    m_entries.remove(key);
-    account_external_memory_change(old_external_memory_size);
+    // NOTE: The entry stays in the list, and in its bucket's chain, until the map is next compacted. That keeps the
+    //       positions of later entries stable for iterators that are walking the list.
+    auto& entry = m_entries[*position];
+    entry.key = js_special_empty_value();
+    entry.value = js_special_empty_value();
+    --m_size;
+
+    // Give memory back once most of the table is unused.
+    if (m_buckets.size() > MINIMUM_BUCKET_COUNT && m_size < m_buckets.size() / 8) {
+        auto old_external_memory_size = external_memory_size();
+        rehash(m_buckets.size() / 2);
+        account_external_memory_change(old_external_memory_size);
+    }
     return true;
 }
 
 // 24.1.3.6 Map.prototype.get ( key ), https://tc39.es/ecma262/#sec-map.prototype.get
 Optional<Value> Map::map_get(Value const& key) const
 {
-    if (auto it = m_entries.find(key); it != m_entries.end())
-        return it->value;
+    if (auto position = find_entry(key, hash_key(key)); position.has_value())
+        return m_entries[*position].value;
     return {};
 }
 
 // 24.1.3.7 Map.prototype.has ( key ), https://tc39.es/ecma262/#sec-map.prototype.has
 bool Map::map_has(Value const& key) const
 {
-    return m_entries.contains(key);
+    return find_entry(key, hash_key(key)).has_value();
 }
 
 // 24.1.3.9 Map.prototype.set ( key, value ), https://tc39.es/ecma262/#sec-map.prototype.set
 void Map::map_set(Value const& key, Value value)
 {
-    auto it = m_entries.find(key);
-    if (it != m_entries.end()) {
-        it->value = value;
-    } else {
-        auto old_external_memory_size = external_memory_size();
-        auto index = m_next_insertion_id++;
-        m_keys.insert(index, key);
-        m_entries.set(key, value);
-        account_external_memory_change(old_external_memory_size);
+    auto hash = hash_key(key);
+    if (auto position = find_entry(key, hash); position.has_value()) {
+        m_entries[*position].value = value;
+        return;
+    }
+
+    auto old_external_memory_size = external_memory_size();
+
+    // The entry list holds as many entries as there are buckets. Once it is full, it is compacted, and the table is
+    // doubled in size unless that frees up at least a quarter of it.
+    if (m_entries.size() >= m_buckets.size()) {
+        auto bucket_count = max(m_buckets.size(), MINIMUM_BUCKET_COUNT);
+        if (m_size > m_entries.size() - m_entries.size() / 4)
+            bucket_count *= 2;
+        rehash(bucket_count);
     }
+
+    auto& bucket = m_buckets[hash & (m_buckets.size() - 1)];
+    auto position = static_cast<u32>(m_entries.size());
+    m_entries.unchecked_append(StoredEntry {
+        .key = key,
+        .value = value,
+        .insertion_id = m_next_insertion_id++,
+        .hash = hash,
+        .next_in_bucket = bucket,
+    });
+    bucket = position;
+    ++m_size;
+
+    account_external_memory_change(old_external_memory_size);
 }
 
 size_t Map::map_size() const
 {
-    return m_keys.size();
+    return m_size;
 }
 
-static size_t map_key_tree_external_memory_size(RedBlackTree<size_t, Value> const& keys)
+u32 Map::hash_key(Value key)
 {
-    constexpr auto approximate_node_size = sizeof(AK::BaseRedBlackTree<size_t>::Node) + sizeof(Value);
-    if (keys.size() > NumericLimits<size_t>::max() / approximate_node_size)
-        return NumericLimits<size_t>::max();
-    return keys.size() * approximate_node_size;
+    // OPTIMIZATION: Int32s and objects, the most common keys, are hashed by their encoding right away. ValueTraits does
+    //               the same for them, but only after checking for the types that need more work.
+    if (key.is_int32() || key.is_object())
+        return u64_hash(key.encoded());
+    return ValueTraits::hash(key);
+}
+
+Optional<u32> Map::find_entry(Value const& key, u32 hash) const
+{
+    if (m_buckets.is_empty())
+        return {};
+
+    for (auto position = m_buckets[hash & (m_buckets.size() - 1)]; position != NO_ENTRY;) {
+        auto const& entry = m_entries[position];
+        if (entry.hash == hash && !entry.key.is_special_empty_value()) {
+            // OPTIMIZATION: Identical encodings are the same value, which settles int32s, objects and repeated lookups
+            //               with the same string without calling SameValue.
+            if (entry.key.encoded() == key.encoded() || ValueTraits::equals(entry.key, key))
+                return position;
+        }
+        position = entry.next_in_bucket;
+    }
+    return {};
+}
+
+size_t Map::first_live_entry_not_below(size_t insertion_id, size_t position) const
+{
+    // Entries are ordered by insertion ID, so the hint is right if the entries on either side of it agree. It is
+    // usually right, since it only goes stale when the map is compacted.
+    auto hint_is_correct = position <= m_entries.size()
+        && (position == 0 || m_entries[position - 1].insertion_id < insertion_id)
+        && (position == m_entries.size() || m_entries[position].insertion_id >= insertion_id);
+
+    if (!hint_is_correct) {
+        size_t low = 0;
+        size_t high = m_entries.size();
+        while (low < high) {
+            auto middle = low + (high - low) / 2;
+            if (m_entries[middle].insertion_id < insertion_id)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        position = low;
+    }
+
+    while (position < m_entries.size() && m_entries[position].key.is_special_empty_value())
+        ++position;
+    return position;
+}
+
+void Map::rehash(size_t bucket_count)
+{
+    VERIFY(is_power_of_two(bucket_count));
+    VERIFY(bucket_count < NO_ENTRY);
+
+    auto is_removed = [](StoredEntry const& entry) { return entry.key.is_special_empty_value(); };
+
+    // The entry list is given room for as many entries as there are buckets, so that it never has to grow between
+    // rehashes. Moving the remaining entries into a list of that size also drops the removed ones.
+    if (m_entries.capacity() != bucket_count) {
+        Vector<StoredEntry> entries;
+        entries.ensure_capacity(bucket_count);
+        for (auto const& entry : m_entries) {
+            if (!is_removed(entry))
+                entries.unchecked_append(entry);
+        }
+        m_entries = move(entries);
+    } else {
+        m_entries.remove_all_matching(is_removed);
+    }
+    VERIFY(m_entries.size() == m_size);
+
+    m_buckets.clear();
+    m_buckets.resize(bucket_count);
+    m_buckets.fill(NO_ENTRY);
+
+    for (u32 position = 0; position < m_entries.size(); ++position) {
+        auto& entry = m_entries[position];
+        auto& bucket = m_buckets[entry.hash & (bucket_count - 1)];
+        entry.next_in_bucket = bucket;
+        bucket = position;
+    }
 }
 
 size_t Map::external_memory_size() const
 {
     auto size = Object::external_memory_size();
-    size = saturating_add_external_memory_size(size, map_key_tree_external_memory_size(m_keys));
-    size = saturating_add_external_memory_size(size, hash_map_external_memory_size(m_entries));
+    size = saturating_add_external_memory_size(size, vector_external_memory_size(m_entries));
+    size = saturating_add_external_memory_size(size, vector_external_memory_size(m_buckets));
     return size;
 }
 
@@ -114,12 +216,10 @@ void Map::account_external_memory_change(size_t old_external_memory_size)
 void Map::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
-    for (auto& value : m_entries) {
-        visitor.visit(value.key);
-        visitor.visit(value.value);
+    for (auto& entry : m_entries) {
+        visitor.visit(entry.key);
+        visitor.visit(entry.value);
     }
-    // NOTE: The entries in m_keys are already visited by the walk over m_entries above.
-    visitor.ignore(m_keys);
 }
 
 }
@@ -6,8 +6,9 @@
 
 #pragma once
 
-#include <AK/HashMap.h>
-#include <AK/RedBlackTree.h>
+#include <AK/NumericLimits.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
 #include <LibJS/Export.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Object.h>
@@ -44,24 +45,27 @@ public:
         Value value;
     };
 
+    // Iterators refer to the insertion ID of the next entry to visit, rather than to its position in the entry list,
+    // so that they survive entries being removed and the list being compacted.
     template<bool IsConst>
     struct IteratorImpl {
         bool is_end() const
         {
-            return m_map->m_keys.begin_from(m_index).is_end()
-                && m_map->m_keys.find_smallest_not_below_iterator(m_index).is_end();
+            ensure_next_element();
+            return m_position >= m_map->m_entries.size();
         }
 
         IteratorImpl& operator++()
         {
             ++m_index;
+            ++m_position;
             return *this;
         }
 
         Entry operator*() const
         {
             ensure_next_element();
-            auto const& entry = *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            auto const& entry = m_map->m_entries[m_position];
             return { entry.key, entry.value };
         }
 
@@ -79,34 +83,28 @@ public:
         requires(IsConst)
             : m_map(map)
         {
-            ensure_index();
         }
 
         IteratorImpl(Map& map)
         requires(!IsConst)
             : m_map(map)
         {
-            ensure_index();
-        }
-
-        void ensure_index() const
-        {
-            if (m_map->m_keys.is_empty())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = m_map->m_keys.begin().key();
         }
 
         void ensure_next_element() const
         {
-            if (auto it = m_map->m_keys.find_smallest_not_below_iterator(m_index); it.is_end())
-                m_index = m_map->m_next_insertion_id;
+            m_position = m_map->first_live_entry_not_below(m_index, m_position);
+            if (m_position < m_map->m_entries.size())
+                m_index = m_map->m_entries[m_position].insertion_id;
             else
-                m_index = it.key();
+                m_index = m_map->m_next_insertion_id;
         }
 
         Conditional<IsConst, GC::Ref<Map const>, GC::Ref<Map>> m_map;
         mutable size_t m_index { 0 };
+
+        // Where the entry with m_index was last found. This is only a hint, as entries move when the map is compacted.
+        mutable size_t m_position { 0 };
     };
 
     using Iterator = IteratorImpl<false>;
@@ -117,14 +115,34 @@ public:
     EndIterator end() const { return {}; }
 
 private:
+    // Entries are stored in insertion order in a dense list, which is what iteration walks. Each bucket of the hash
+    // table holds the position of the most recently inserted entry with that bucket's hash, and each entry holds the
+    // position of the next one. Removed entries are left in place with an empty key until the map is compacted.
+    struct StoredEntry {
+        Value key;
+        Value value;
+        size_t insertion_id { 0 };
+        u32 hash { 0 };
+        u32 next_in_bucket { 0 };
+    };
+
+    static constexpr u32 NO_ENTRY = NumericLimits<u32>::max();
+    static constexpr size_t MINIMUM_BUCKET_COUNT = 8;
+
     explicit Map(Object& prototype);
     virtual void visit_edges(Visitor& visitor) override;
 
+    static u32 hash_key(Value);
+    Optional<u32> find_entry(Value const&, u32 hash) const;
+    size_t first_live_entry_not_below(size_t insertion_id, size_t position_hint) const;
+    void rehash(size_t bucket_count);
+
     void account_external_memory_change(size_t old_external_memory_size);
 
     size_t m_next_insertion_id { 0 };
-    RedBlackTree<size_t, Value> m_keys;
-    HashMap<Value, Value, ValueTraits> m_entries;
+    size_t m_size { 0 };
+    Vector<StoredEntry> m_entries;
+    Vector<u32> m_buckets;
 };
 
 template<>
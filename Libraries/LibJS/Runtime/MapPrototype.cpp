@@ -29,12 +29,12 @@ void MapPrototype::initialize(Realm& realm)
     define_native_function(realm, vm.names.delete_, delete_, 1, attr);
     define_native_function(realm, vm.names.entries, entries, 0, attr);
     define_native_function(realm, vm.names.forEach, for_each, 1, attr);
-    define_native_function(realm, vm.names.get, get, 1, attr);
+    define_native_function(realm, vm.names.get, get, 1, attr, Bytecode::Builtin::MapPrototypeGet);
     define_native_function(realm, vm.names.getOrInsert, get_or_insert, 2, attr);
     define_native_function(realm, vm.names.getOrInsertComputed, get_or_insert_computed, 2, attr);
     define_native_function(realm, vm.names.has, has, 1, attr);
     define_native_function(realm, vm.names.keys, keys, 0, attr);
-    define_native_function(realm, vm.names.set, set, 2, attr);
+    define_native_function(realm, vm.names.set, set, 2, attr, Bytecode::Builtin::MapPrototypeSet);
     define_native_function(realm, vm.names.values, values, 0, attr);
 
     define_native_accessor(realm, vm.names.size, size_getter, {}, Attribute::Configurable);
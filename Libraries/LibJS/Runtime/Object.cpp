@@ -1935,6 +1935,8 @@ void Object::indexed_put(u32 index, Value value, PropertyAttributes attributes)
 
     if (m_indexed_storage_kind == IndexedStorageKind::None) {
         m_indexed_storage_kind = storing_hole || index > 0 ? IndexedStorageKind::Holey : IndexedStorageKind::Packed;
+        m_indexed_elements_kind = IndexedElementsKind::Int32;
+        widen_indexed_elements_kind_for(value);
         u32 needed = index + 1;
         ensure_indexed_elements(needed);
         m_indexed_elements[index] = value;
@@ -1963,16 +1965,21 @@ void Object::indexed_put(u32 index, Value value, PropertyAttributes attributes)
         m_indexed_storage_kind = IndexedStorageKind::Holey;
 
     m_indexed_elements[index] = value;
+    if (m_indexed_storage_kind == IndexedStorageKind::Packed)
+        widen_indexed_elements_kind_for(value);
 
     // Promote Holey -> Packed when filling the last hole.
     // Only check when writing to the last index to avoid O(N^2) scanning.
     if (m_indexed_storage_kind == IndexedStorageKind::Holey && index == m_indexed_array_like_size - 1) {
         bool has_holes = false;
+        // Holey stores don't track the elements kind, so recompute it while scanning.
+        m_indexed_elements_kind = IndexedElementsKind::Int32;
         for (u32 i = 0, available_elements = min(m_indexed_array_like_size, indexed_elements_capacity()); i < available_elements; ++i) {
             if (m_indexed_elements[i].is_special_empty_value()) {
                 has_holes = true;
                 break;
             }
+            widen_indexed_elements_kind_for(m_indexed_elements[i]);
         }
         if (!has_holes && indexed_elements_capacity() >= m_indexed_array_like_size)
             m_indexed_storage_kind = IndexedStorageKind::Packed;
@@ -2176,10 +2183,13 @@ void Object::set_indexed_property_elements(Vector<Value>&& values)
 
     u32 size = values.size();
     m_indexed_storage_kind = IndexedStorageKind::Packed;
+    m_indexed_elements_kind = IndexedElementsKind::Int32;
     m_indexed_array_like_size = size;
     m_indexed_elements = allocate_indexed_elements(size);
-    for (u32 i = 0; i < size; ++i)
+    for (u32 i = 0; i < size; ++i) {
         m_indexed_elements[i] = values[i];
+        widen_indexed_elements_kind_for(values[i]);
+    }
 }
 
 ReadonlySpan<Value> Object::indexed_packed_elements_span() const
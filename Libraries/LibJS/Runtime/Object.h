@@ -77,6 +77,15 @@ enum class IndexedStorageKind : u8 {
     Dictionary = 3,
 };
 
+// Refines Packed indexed storage with the type of values it holds. The kind only ever widens
+// while the storage stays Packed, so Int32 means every element is an Int32 Value and Number
+// means every element is a Number. Non-Packed storage always reports Generic.
+enum class IndexedElementsKind : u8 {
+    Int32 = 0,
+    Number = 1,
+    Generic = 2,
+};
+
 class JS_API Object : public Cell {
     GC_CELL(Object, Cell);
     GC_DECLARE_ALLOCATOR(Object);
@@ -312,6 +321,7 @@ public:
     Vector<u32> indexed_indices() const;
     void set_indexed_property_elements(Vector<Value>&& values);
     IndexedStorageKind indexed_storage_kind() const { return m_indexed_storage_kind; }
+    IndexedElementsKind indexed_elements_kind() const { return m_indexed_storage_kind == IndexedStorageKind::Packed ? m_indexed_elements_kind : IndexedElementsKind::Generic; }
 
     template<typename Callback>
     void indexed_for_each_value(Callback callback)
@@ -386,7 +396,8 @@ private:
 
     u8 m_flags { Flag::IsExtensible };
     IndexedStorageKind m_indexed_storage_kind { IndexedStorageKind::None };
-    // 2 bytes padding
+    IndexedElementsKind m_indexed_elements_kind { IndexedElementsKind::Int32 };
+    // 1 byte padding
     u32 m_indexed_array_like_size { 0 };
     void set_shape(Shape& shape) { m_shape = &shape; }
 
@@ -398,6 +409,12 @@ private:
     void ensure_indexed_elements(u32 needed_capacity);
     void grow_indexed_elements(u32 needed_capacity);
     void transition_to_dictionary();
+    void widen_indexed_elements_kind_for(Value value)
+    {
+        if (m_indexed_elements_kind == IndexedElementsKind::Generic || value.is_int32())
+            return;
+        m_indexed_elements_kind = value.is_number() ? IndexedElementsKind::Number : IndexedElementsKind::Generic;
+    }
     void free_indexed_elements();
     void ensure_named_storage_capacity(u32 needed);
     bool named_storage_is_inline() const { return m_named_properties == const_cast<Object*>(this)->m_inline_named_storage; }
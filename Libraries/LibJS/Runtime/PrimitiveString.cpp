@@ -7,10 +7,12 @@
 
 #include <AK/CharacterTypes.h>
 #include <AK/FlyString.h>
+#include <AK/HashTable.h>
 #include <AK/StringBuilder.h>
 #include <AK/Utf16FlyString.h>
 #include <AK/Utf16StringBuilder.h>
 #include <AK/Utf16View.h>
+#include <LibGC/HeapBlock.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/ExternalMemory.h>
 #include <LibJS/Runtime/GlobalObject.h>
@@ -182,6 +184,53 @@ void PrimitiveString::finalize()
     }
 }
 
+void PrimitiveString::deduplicate_long_lived_strings(VM& vm)
+{
+    HashTable<Utf16String> canonical_strings;
+
+    auto deduplicate = [&](PrimitiveString& string) {
+        // NB: Strings that have survived a collection are likely to stick around, so they are worth hashing. Each one
+        //     is only considered once, so a string's contents are hashed at most once over its lifetime.
+        if (!string.is_marked() || !string.has_survived_collection() || string.m_was_considered_for_deduplication)
+            return;
+
+        // Ropes and substrings become candidates once they have been resolved.
+        if (string.m_deferred_kind != DeferredKind::None || !string.m_utf16_string.has_value())
+            return;
+        string.m_was_considered_for_deduplication = true;
+
+        // Short strings are stored inline and the string cache already has unique contents, so there's nothing to share.
+        auto& utf16_string = *string.m_utf16_string;
+        if (string.m_utf16_string_is_in_cache || utf16_string.has_short_ascii_storage())
+            return;
+
+        if (utf16_string.length_in_code_units() <= MAX_LENGTH_FOR_STRING_CACHE) {
+            if (auto it = vm.utf16_string_cache().find(utf16_string); it != vm.utf16_string_cache().end()) {
+                utf16_string = it->key;
+                return;
+            }
+        }
+
+        if (auto it = canonical_strings.find(utf16_string); it != canonical_strings.end())
+            utf16_string = *it;
+        else
+            canonical_strings.set(utf16_string);
+    };
+
+    auto deduplicate_strings_in = [&](auto& cell_allocator) {
+        cell_allocator.for_heap(vm.heap()).for_each_block([&](GC::HeapBlock& block) {
+            block.for_each_cell_in_state<GC::Cell::State::Live>([&](GC::Cell* cell) {
+                deduplicate(static_cast<PrimitiveString&>(*cell));
+            });
+            return IterationDecision::Continue;
+        });
+    };
+
+    deduplicate_strings_in(PrimitiveString::cell_allocator);
+    deduplicate_strings_in(RopeString::cell_allocator);
+    deduplicate_strings_in(Substring::cell_allocator);
+}
+
 bool PrimitiveString::is_empty() const
 {
     if (m_deferred_kind == DeferredKind::Rope) {
@@ -218,6 +267,8 @@ Utf16View PrimitiveString::utf16_string_view() const
 
 size_t PrimitiveString::length_in_utf16_code_units() const
 {
+    if (m_deferred_kind == DeferredKind::Rope)
+        return static_cast<RopeString const&>(*this).m_length_in_utf16_code_units;
     if (m_deferred_kind == DeferredKind::Substring)
         return static_cast<Substring const&>(*this).m_code_unit_length;
     return utf16_string_view().length_in_code_units();
@@ -278,7 +329,6 @@ void RopeString::resolve() const
     // This vector will hold all the pieces of the rope that need to be assembled
     // into the resolved string.
     Vector<PrimitiveString const*, 2> pieces;
-    size_t length_in_utf16_code_units = 0;
 
     // NOTE: We traverse the rope tree without using recursion, since we'd run out of
     //       stack space quickly when handling a long sequence of unresolved concatenations.
@@ -294,11 +344,10 @@ void RopeString::resolve() const
             continue;
         }
 
-        length_in_utf16_code_units += current->length_in_utf16_code_units();
         pieces.append(current);
     }
 
-    Utf16StringBuilder builder(length_in_utf16_code_units);
+    Utf16StringBuilder builder(m_length_in_utf16_code_units);
     for (auto const* current : pieces) {
         builder.append(current->utf16_string_view());
     }
@@ -313,6 +362,7 @@ RopeString::RopeString(GC::Ref<PrimitiveString> lhs, GC::Ref<PrimitiveString> rh
     : PrimitiveString(DeferredKind::Rope)
     , m_lhs(lhs)
     , m_rhs(rhs)
+    , m_length_in_utf16_code_units(lhs->length_in_utf16_code_units() + rhs->length_in_utf16_code_units())
 {
 }
 
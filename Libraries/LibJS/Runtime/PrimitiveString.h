@@ -53,6 +53,10 @@ public:
 
     [[nodiscard]] bool operator==(PrimitiveString const&) const;
 
+    // Makes flat strings that have survived a collection and have equal contents share one backing buffer. Must be
+    // called right after marking, while nothing can hold a view into the buffer of a string.
+    static void deduplicate_long_lived_strings(VM&);
+
 protected:
     enum class DeferredKind : u8 {
         None,
@@ -70,6 +74,7 @@ protected:
     mutable Optional<Utf16String> m_utf16_string;
 
     bool m_utf16_string_is_in_cache { false };
+    bool m_was_considered_for_deduplication { false };
 
 private:
     friend class RopeString;
@@ -103,6 +108,9 @@ private:
 
     mutable GC::Ptr<PrimitiveString> m_lhs;
     mutable GC::Ptr<PrimitiveString> m_rhs;
+
+    // NB: Cached so that asking a rope for its length doesn't force it to be resolved.
+    size_t m_length_in_utf16_code_units { 0 };
 };
 
 class Substring final : public PrimitiveString {
@@ -49,6 +49,9 @@ public:
     void reject(Value reason);
     Value perform_then(Value on_fulfilled, Value on_rejected, GC::Ptr<PromiseCapability> result_capability);
 
+    // PerformPromiseThen without a result capability, for reactions that were created up front.
+    void perform_then(PromiseReaction& fulfill_reaction, PromiseReaction& reject_reaction);
+
     bool is_handled() const { return m_is_handled; }
     void set_is_handled() { m_is_handled = true; }
 
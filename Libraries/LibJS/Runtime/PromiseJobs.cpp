@@ -86,6 +86,12 @@ static ThrowCompletionOr<Value> run_reaction_job(VM& vm, PromiseReaction& reacti
 // 27.2.2.1 NewPromiseReactionJob ( reaction, argument ), https://tc39.es/ecma262/#sec-newpromisereactionjob
 PromiseJob create_promise_reaction_job(VM& vm, PromiseReaction& reaction, Value argument)
 {
+    // OPTIMIZATION: Reactions that come with a job of their own stand in for a built-in handler function, which would be
+    //               called with the argument the job reads from the settled promise instead. The job realm is the
+    //               realm that function would have been created in.
+    if (auto job = reaction.job())
+        return { *job, reaction.job_realm() };
+
     // 1. Let job be a new Job Abstract Closure with no parameters that captures reaction and argument and performs the following steps when called:
     //    See run_reaction_job for "the following steps".
     auto job = GC::create_function(vm.heap(), [&vm, &reaction, argument] {
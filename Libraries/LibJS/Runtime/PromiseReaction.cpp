@@ -17,6 +17,14 @@ GC::Ref<PromiseReaction> PromiseReaction::create(VM& vm, Type type, GC::Ptr<Prom
     return vm.heap().allocate<PromiseReaction>(type, capability, move(handler));
 }
 
+GC::Ref<PromiseReaction> PromiseReaction::create_with_job(VM& vm, Type type, GC::Ref<Job> job, GC::Ref<Realm> job_realm)
+{
+    auto reaction = vm.heap().allocate<PromiseReaction>(type, nullptr, nullptr);
+    reaction->m_job = job;
+    reaction->m_job_realm = job_realm;
+    return reaction;
+}
+
 PromiseReaction::PromiseReaction(Type type, GC::Ptr<PromiseCapability> capability, GC::Ptr<JobCallback> handler)
     : m_type(type)
     , m_capability(capability)
@@ -29,6 +37,8 @@ void PromiseReaction::visit_edges(Cell::Visitor& visitor)
     Base::visit_edges(visitor);
     visitor.visit(m_capability);
     visitor.visit(m_handler);
+    visitor.visit(m_job);
+    visitor.visit(m_job_realm);
 }
 
 }
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/Forward.h>
+#include <LibGC/Function.h>
 #include <LibJS/Forward.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibJS/Runtime/JobCallback.h>
@@ -24,8 +25,15 @@ public:
         Reject,
     };
 
+    using Job = GC::Function<ThrowCompletionOr<Value>()>;
+
     static GC::Ref<PromiseReaction> create(VM& vm, Type type, GC::Ptr<PromiseCapability> capability, GC::Ptr<JobCallback> handler);
 
+    // A reaction without a handler function, whose job is enqueued as-is whenever the reaction is triggered. The job is
+    // not bound to the promise's result and has to read it from the promise, so the same reaction can be attached to
+    // one promise after another without allocating anything. Await uses this to resume async functions.
+    static GC::Ref<PromiseReaction> create_with_job(VM& vm, Type type, GC::Ref<Job> job, GC::Ref<Realm> job_realm);
+
     virtual ~PromiseReaction() = default;
 
     Type type() const { return m_type; }
@@ -34,6 +42,9 @@ public:
     GC::Ptr<JobCallback> handler() { return m_handler; }
     GC::Ptr<JobCallback const> handler() const { return m_handler; }
 
+    GC::Ptr<Job> job() const { return m_job; }
+    GC::Ptr<Realm> job_realm() const { return m_job_realm; }
+
 private:
     PromiseReaction(Type type, GC::Ptr<PromiseCapability> capability, GC::Ptr<JobCallback> handler);
 
@@ -42,6 +53,8 @@ private:
     Type m_type;
     GC::Ptr<PromiseCapability> m_capability;
     GC::Ptr<JobCallback> m_handler;
+    GC::Ptr<Job> m_job;
+    GC::Ptr<Realm> m_job_realm;
 };
 
 }
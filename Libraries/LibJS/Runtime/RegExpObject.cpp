@@ -7,6 +7,8 @@
 
 #include <AK/CharacterTypes.h>
 #include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/NeverDestroyed.h>
 #include <AK/UnicodeUtils.h>
 #include <AK/Utf16StringBuilder.h>
 #include <LibJS/Runtime/AbstractOperations.h>
@@ -320,6 +322,133 @@ ThrowCompletionOr<Utf16String> parse_regex_pattern(VM& vm, Utf16View const& patt
     return result.release_value();
 }
 
+namespace {
+
+struct RegexCacheKey {
+    Utf16String pattern;
+    RegExpObject::Flags flags;
+
+    bool operator==(RegexCacheKey const&) const = default;
+};
+
+struct RegexCacheKeyTraits : public Traits<RegexCacheKey> {
+    static unsigned hash(RegexCacheKey const& key)
+    {
+        return pair_int_hash(key.pattern.hash(), to_underlying(key.flags));
+    }
+};
+
+// Compiled patterns shared by every realm in the process, so code that keeps constructing the same RegExp from a
+// string only compiles it once. Bounded by evicting the least recently used pattern.
+class RegexCache {
+public:
+    static constexpr size_t capacity = 256;
+
+    static RegexCache& the()
+    {
+        static NeverDestroyed<RegexCache> cache;
+        return *cache;
+    }
+
+    RefPtr<CachedRegex const> find(RegexCacheKey const& key)
+    {
+        auto it = m_entries.find(key);
+        if (it == m_entries.end()) {
+            ++m_misses;
+            return {};
+        }
+        ++m_hits;
+        it->value.last_use = ++m_use_counter;
+        return it->value.regex;
+    }
+
+    void insert(RegexCacheKey key, NonnullRefPtr<CachedRegex const> regex)
+    {
+        if (m_entries.size() >= capacity)
+            evict_least_recently_used();
+        m_entries.set(move(key), { move(regex), ++m_use_counter });
+    }
+
+    RegexCacheStatistics statistics() const
+    {
+        return {
+            .hits = m_hits,
+            .misses = m_misses,
+            .evictions = m_evictions,
+            .size = m_entries.size(),
+            .capacity = capacity,
+        };
+    }
+
+private:
+    struct Entry {
+        NonnullRefPtr<CachedRegex const> regex;
+        u64 last_use { 0 };
+    };
+
+    // NB: This only runs after a miss, which is dominated by compiling the new pattern anyway.
+    void evict_least_recently_used()
+    {
+        auto oldest = m_entries.begin();
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+            if (it->value.last_use < oldest->value.last_use)
+                oldest = it;
+        }
+        m_entries.remove(oldest);
+        ++m_evictions;
+    }
+
+    HashMap<RegexCacheKey, Entry, RegexCacheKeyTraits> m_entries;
+    u64 m_use_counter { 0 };
+    size_t m_hits { 0 };
+    size_t m_misses { 0 };
+    size_t m_evictions { 0 };
+};
+
+}
+
+static ErrorOr<NonnullRefPtr<CachedRegex const>, Utf16String> compile_regex(Utf16String const& pattern, RegExpObject::Flags flag_bits)
+{
+    RegexCacheKey cache_key { pattern, flag_bits };
+    if (auto cached = RegexCache::the().find(cache_key))
+        return cached.release_nonnull();
+
+    bool unicode = has_flag(flag_bits, RegExpObject::Flags::Unicode);
+    bool unicode_sets = has_flag(flag_bits, RegExpObject::Flags::UnicodeSets);
+
+    // Normalize non-ASCII code units to ASCII escapes before compiling the pattern.
+    auto parsed_pattern = Utf16String {};
+    if (!pattern.is_empty()) {
+        auto result = parse_regex_pattern(pattern, unicode, unicode_sets);
+        if (result.is_error())
+            return result.release_error().error;
+        parsed_pattern = result.release_value();
+    }
+
+    regex::ECMAScriptCompileFlags compile_flags {};
+    compile_flags.global = has_flag(flag_bits, RegExpObject::Flags::Global);
+    compile_flags.ignore_case = has_flag(flag_bits, RegExpObject::Flags::IgnoreCase);
+    compile_flags.multiline = has_flag(flag_bits, RegExpObject::Flags::Multiline);
+    compile_flags.dot_all = has_flag(flag_bits, RegExpObject::Flags::DotAll);
+    compile_flags.unicode = unicode;
+    compile_flags.unicode_sets = unicode_sets;
+    compile_flags.sticky = has_flag(flag_bits, RegExpObject::Flags::Sticky);
+    compile_flags.has_indices = has_flag(flag_bits, RegExpObject::Flags::HasIndices);
+
+    auto compiled = regex::ECMAScriptRegex::compile(parsed_pattern.utf16_view(), compile_flags);
+    if (compiled.is_error())
+        return Utf16String::from_utf8(compiled.release_error());
+
+    auto cached = make_ref_counted<CachedRegex>(compiled.release_value());
+    RegexCache::the().insert(move(cache_key), cached);
+    return cached;
+}
+
+RegexCacheStatistics regex_cache_statistics()
+{
+    return RegexCache::the().statistics();
+}
+
 GC::Ref<RegExpObject> RegExpObject::create(Realm& realm)
 {
     return realm.create<RegExpObject>(realm.intrinsics().regexp_prototype());
@@ -399,33 +528,15 @@ ThrowCompletionOr<GC::Ref<RegExpObject>> RegExpObject::regexp_initialize(VM& vm,
     if (validated_flags_or_error.is_error())
         return vm.throw_completion<SyntaxError>(validated_flags_or_error.release_error());
     auto flag_bits = validated_flags_or_error.release_value();
-    bool unicode = has_flag(flag_bits, Flags::Unicode);
-    bool unicode_sets = has_flag(flag_bits, Flags::UnicodeSets);
-
-    auto parsed_pattern = Utf16String {};
-
-    // Normalize non-ASCII code units to ASCII escapes before compiling the pattern.
-    if (!pattern.is_empty()) {
-        auto result = parse_regex_pattern(pattern, unicode, unicode_sets);
-        if (result.is_error())
-            return vm.throw_completion<SyntaxError>(ErrorType::RegExpCompileError, result.release_error().error);
-        parsed_pattern = result.release_value();
-    }
 
     // 11. If u is true and v is true, throw a SyntaxError exception.
     // NB: Already handled by validate_flags above.
 
-    // Validate by trial-compiling the pattern.
-    regex::ECMAScriptCompileFlags compile_flags {};
-    compile_flags.global = has_flag(flag_bits, Flags::Global);
-    compile_flags.ignore_case = has_flag(flag_bits, Flags::IgnoreCase);
-    compile_flags.multiline = has_flag(flag_bits, Flags::Multiline);
-    compile_flags.dot_all = has_flag(flag_bits, Flags::DotAll);
-    compile_flags.unicode = unicode;
-    compile_flags.unicode_sets = unicode_sets;
-    compile_flags.sticky = has_flag(flag_bits, Flags::Sticky);
-
-    auto compiled = regex::ECMAScriptRegex::compile(parsed_pattern.utf16_view(), compile_flags);
+    // 12. Let patternText be StringToCodePoints(P).
+    // 13. Let parseResult be ParsePattern(patternText, u, v).
+    // 14. If parseResult is a non-empty List of SyntaxError objects, throw a SyntaxError exception.
+    // NB: Patterns are parsed and compiled up front, or taken from the regex cache if they were compiled before.
+    auto compiled = compile_regex(pattern, flag_bits);
     if (compiled.is_error())
         return vm.throw_completion<SyntaxError>(ErrorType::RegExpCompileError, compiled.release_error());
 
@@ -435,6 +546,7 @@ ThrowCompletionOr<GC::Ref<RegExpObject>> RegExpObject::regexp_initialize(VM& vm,
     // 17. Set obj.[[OriginalFlags]] to F.
     m_flag_bits = to_flag_bits(flags);
     m_flags = move(flags);
+    m_cached_regex = compiled.release_value();
 
     // 18. Let capturingGroupsCount be CountLeftCapturingParensWithin(parseResult).
     // 19. Let rer be the RegExp Record { [[IgnoreCase]]: i, [[Multiline]]: m, [[DotAll]]: s, [[Unicode]]: u, [[CapturingGroupsCount]]: capturingGroupsCount }.
@@ -536,6 +648,17 @@ Utf16String RegExpObject::escape_regexp_pattern() const
     return builder.to_string();
 }
 
+regex::ECMAScriptRegex const* RegExpObject::compiled_regex() const
+{
+    if (!m_cached_regex) {
+        auto compiled = compile_regex(m_pattern, m_flag_bits);
+        if (compiled.is_error())
+            return nullptr;
+        m_cached_regex = compiled.release_value();
+    }
+    return &m_cached_regex->regex();
+}
+
 void RegExpObject::visit_edges(JS::Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
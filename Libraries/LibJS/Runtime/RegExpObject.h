@@ -9,6 +9,8 @@
 
 #include <AK/EnumBits.h>
 #include <AK/Optional.h>
+#include <AK/RefCounted.h>
+#include <AK/RefPtr.h>
 #include <AK/Result.h>
 #include <AK/String.h>
 #include <LibJS/Export.h>
@@ -26,6 +28,31 @@ struct ParseRegexPatternError {
 ErrorOr<Utf16String, ParseRegexPatternError> parse_regex_pattern(Utf16View const& pattern, bool unicode, bool unicode_sets);
 ThrowCompletionOr<Utf16String> parse_regex_pattern(VM& vm, Utf16View const& pattern, bool unicode, bool unicode_sets);
 
+// A compiled pattern from the process-wide regex cache. Every RegExpObject using it holds a reference, so the cache
+// can evict it at any time.
+class CachedRegex : public RefCounted<CachedRegex> {
+public:
+    explicit CachedRegex(regex::ECMAScriptRegex regex)
+        : m_regex(move(regex))
+    {
+    }
+
+    regex::ECMAScriptRegex const& regex() const { return m_regex; }
+
+private:
+    regex::ECMAScriptRegex m_regex;
+};
+
+struct RegexCacheStatistics {
+    size_t hits { 0 };
+    size_t misses { 0 };
+    size_t evictions { 0 };
+    size_t size { 0 };
+    size_t capacity { 0 };
+};
+
+JS_API RegexCacheStatistics regex_cache_statistics();
+
 class JS_API RegExpObject : public Object {
     JS_OBJECT(RegExpObject, Object);
     GC_DECLARE_ALLOCATOR(RegExpObject);
@@ -60,8 +87,8 @@ public:
     void set_legacy_features_enabled(bool legacy_features_enabled) { m_legacy_features_enabled = legacy_features_enabled; }
     void set_realm(Realm& realm) { m_realm = &realm; }
 
-    regex::ECMAScriptRegex const* cached_regex() const { return m_cached_regex; }
-    void set_cached_regex(regex::ECMAScriptRegex const* ptr) const { m_cached_regex = ptr; }
+    // The compiled pattern, fetched from the regex cache (or compiled) on first use. Null if it fails to compile.
+    regex::ECMAScriptRegex const* compiled_regex() const;
 
 private:
     RegExpObject(Object& prototype);
@@ -74,7 +101,7 @@ private:
     Utf16String m_flags;
     Flags m_flag_bits { 0 };
     bool m_legacy_features_enabled { false }; // [[LegacyFeaturesEnabled]]
-    mutable regex::ECMAScriptRegex const* m_cached_regex { nullptr };
+    mutable RefPtr<CachedRegex const> m_cached_regex;
     // Note: This is initialized in RegExpAlloc, but will be non-null afterwards
     GC::Ptr<Realm> m_realm; // [[Realm]]
 };
@@ -9,7 +9,6 @@
 #include <AK/CharacterTypes.h>
 #include <AK/Function.h>
 #include <AK/HashMap.h>
-#include <AK/NeverDestroyed.h>
 #include <AK/Utf16String.h>
 #include <AK/Utf16StringBuilder.h>
 #include <AK/Utf16View.h>
@@ -77,74 +76,6 @@ static ThrowCompletionOr<void> increment_last_index(VM& vm, Object& regexp_objec
     return {};
 }
 
-// FIXME: Add an eviction policy to bound the size of this cache.
-struct RegexCacheKey {
-    Utf16String pattern;
-    RegExpObject::Flags flags;
-
-    bool operator==(RegexCacheKey const&) const = default;
-};
-
-struct RegexCacheKeyTraits : public Traits<RegexCacheKey> {
-    static unsigned hash(RegexCacheKey const& key)
-    {
-        return pair_int_hash(key.pattern.hash(), to_underlying(key.flags));
-    }
-};
-
-static auto& regex_cache()
-{
-    static NeverDestroyed<HashMap<RegexCacheKey, NonnullOwnPtr<regex::ECMAScriptRegex>, RegexCacheKeyTraits>> cache;
-    return *cache;
-}
-
-static regex::ECMAScriptRegex const* get_or_compile_regex(RegExpObject& regexp_object)
-{
-    // Fast path: check the inline cache on the RegExpObject.
-    if (auto* cached = regexp_object.cached_regex())
-        return cached;
-
-    auto const& pattern = regexp_object.pattern();
-    auto flag_bits = regexp_object.flag_bits();
-
-    RegexCacheKey cache_key { pattern, flag_bits };
-
-    if (auto it = regex_cache().find(cache_key); it != regex_cache().end()) {
-        auto* ptr = it->value.ptr();
-        regexp_object.set_cached_regex(ptr);
-        return ptr;
-    }
-
-    bool unicode = has_flag(flag_bits, RegExpObject::Flags::Unicode);
-    bool unicode_sets = has_flag(flag_bits, RegExpObject::Flags::UnicodeSets);
-
-    // Normalize non-ASCII code units to ASCII escapes before compiling the pattern.
-    auto parsed_pattern = parse_regex_pattern(pattern.utf16_view(), unicode, unicode_sets);
-    if (parsed_pattern.is_error())
-        return nullptr;
-
-    regex::ECMAScriptCompileFlags flags {};
-    flags.global = has_flag(flag_bits, RegExpObject::Flags::Global);
-    flags.ignore_case = has_flag(flag_bits, RegExpObject::Flags::IgnoreCase);
-    flags.multiline = has_flag(flag_bits, RegExpObject::Flags::Multiline);
-    flags.dot_all = has_flag(flag_bits, RegExpObject::Flags::DotAll);
-    flags.unicode = unicode;
-    flags.unicode_sets = unicode_sets;
-    flags.sticky = has_flag(flag_bits, RegExpObject::Flags::Sticky);
-    flags.has_indices = has_flag(flag_bits, RegExpObject::Flags::HasIndices);
-
-    auto normalized_pattern = parsed_pattern.release_value();
-    auto compiled = regex::ECMAScriptRegex::compile(normalized_pattern.utf16_view(), flags);
-    if (compiled.is_error())
-        return nullptr;
-
-    auto owned = make<regex::ECMAScriptRegex>(compiled.release_value());
-    auto* ptr = owned.ptr();
-    regex_cache().set(move(cache_key), move(owned));
-    regexp_object.set_cached_regex(ptr);
-    return ptr;
-}
-
 struct ExecWithLastIndexResult {
     regex::MatchResult result;
     size_t effective_last_index;
@@ -226,7 +157,7 @@ static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp
         return js_null();
     }
 
-    auto* compiled_regex = get_or_compile_regex(regexp_object);
+    auto* compiled_regex = regexp_object.compiled_regex();
     if (!compiled_regex)
         return js_null();
 
@@ -741,7 +672,7 @@ ThrowCompletionOr<Value> RegExpPrototype::symbol_replace_impl(VM& vm, Object& re
                         fast_path_valid = false;
                 }
 
-                auto* compiled_regex = fast_path_valid ? get_or_compile_regex(*typed_regexp) : nullptr;
+                auto* compiled_regex = fast_path_valid ? typed_regexp->compiled_regex() : nullptr;
                 if (compiled_regex) {
                     auto utf16_view = string->utf16_string_view();
                     auto length_s = utf16_view.length_in_code_units();
@@ -1193,7 +1124,7 @@ ThrowCompletionOr<Value> RegExpPrototype::symbol_split_impl(VM& vm, Object& rege
             && realm.intrinsics().regexp_prototype()->storage_has(vm.names.flags)
             && (limit_value.is_undefined() || limit_value.is_number())) {
 
-            auto* compiled_regex = get_or_compile_regex(*typed_regexp);
+            auto* compiled_regex = typed_regexp->compiled_regex();
             if (compiled_regex) {
                 auto flag_bits = typed_regexp->flag_bits();
                 bool is_unicode = has_flag(flag_bits, RegExpObject::Flags::Unicode);
@@ -1486,7 +1417,7 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::test)
 
             // Only use fast path when we don't need to update lastIndex.
             if (!global && !sticky) {
-                auto* compiled_regex = get_or_compile_regex(*typed_regexp);
+                auto* compiled_regex = typed_regexp->compiled_regex();
                 if (compiled_regex) {
                     auto utf16_view = string->utf16_string_view();
 
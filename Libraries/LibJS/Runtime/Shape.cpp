@@ -25,8 +25,11 @@ void Shape::finalize()
 {
     Base::finalize();
     clear_forward_transitions();
-    if (m_dictionary)
+    if (m_dictionary) {
         m_property_storage.property_table.~PropertyTablePtr();
+        vm().did_destroy_dictionary_shape({});
+    }
+    vm().did_destroy_shape({});
 }
 
 GC::Ptr<DescriptorArray> Shape::descriptors() const
@@ -61,6 +64,7 @@ void Shape::become_dictionary_shape()
     new (&m_property_storage.property_table) PropertyTablePtr();
     m_property_storage.property_table = make<PropertyTable>();
     m_dictionary = true;
+    vm().did_create_dictionary_shape({});
 }
 
 size_t Shape::external_memory_size() const
@@ -277,6 +281,7 @@ GC::Ref<Shape> Shape::create_prototype_transition(Object* new_prototype)
 Shape::Shape(Realm& realm)
     : m_realm(realm)
 {
+    vm().did_create_shape({});
 }
 
 Shape::Shape(Shape& previous_shape, PropertyCountChange property_count_change)
@@ -285,6 +290,7 @@ Shape::Shape(Shape& previous_shape, PropertyCountChange property_count_change)
     , m_prototype(previous_shape.m_prototype)
     , m_property_count(previous_shape.m_property_count)
 {
+    vm().did_create_shape({});
     switch (property_count_change) {
     case PropertyCountChange::Preserve:
         break;
@@ -305,6 +311,7 @@ Shape::Shape(Shape& previous_shape, Object* new_prototype)
     , m_prototype(new_prototype)
     , m_property_count(previous_shape.m_property_count)
 {
+    vm().did_create_shape({});
 }
 
 void Shape::visit_edges(Cell::Visitor& visitor)
@@ -20,6 +20,7 @@
 #include <LibJS/Runtime/Intl/Collator.h>
 #include <LibJS/Runtime/Intl/CollatorCompareFunction.h>
 #include <LibJS/Runtime/Intl/CollatorConstructor.h>
+#include <LibJS/Runtime/Intl/FormatterCache.h>
 #include <LibJS/Runtime/PrimitiveString.h>
 #include <LibJS/Runtime/RegExpObject.h>
 #include <LibJS/Runtime/RegExpPrototype.h>
@@ -607,9 +608,13 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::locale_compare)
                 return Value(*maybe_result);
         }
         collator = realm.intrinsics().default_collator();
+    } else if (Intl::FormatterCache::can_cache(locales, options)) {
+        // OPTIMIZATION: Without options, the collator for these locales is taken from the realm's formatter cache.
+        collator = TRY(realm.intrinsics().intl_formatter_cache()->collator(vm, locales));
     } else {
         collator = TRY(construct(vm, realm.intrinsics().intl_collator_constructor(), locales, options));
     }
+    }
 
     // 5. Return CompareStrings(collator, S, thatValue).
     return Intl::compare_strings(static_cast<Intl::Collator const&>(*collator), string, that_value);
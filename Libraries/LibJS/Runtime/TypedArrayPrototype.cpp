@@ -12,6 +12,7 @@
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayIterator.h>
+#include <LibJS/Runtime/ArraySort.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/TypedArrayPrototype.h>
@@ -1887,6 +1888,13 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::sort)
     // 4. Let len be TypedArrayLength(taRecord).
     auto length = typed_array_length(typed_array_record);
 
+    // OPTIMIZATION: Without a comparefn, elements are ordered numerically, and elements that compare as equal are
+    //               indistinguishable. The elements can hence be sorted right in the buffer, with no user code to observe it.
+    if (compare_function.is_undefined()) {
+        sort_typed_array_elements_in_default_order(*typed_array, *typed_array, length);
+        return typed_array;
+    }
+
     // 5. NOTE: The following closure performs a numeric comparison rather than the string comparison used in 23.1.3.30.
     // 6. Let SortCompare be a new Abstract Closure with parameters (x, y) that captures comparefn and performs the following steps when called:
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
@@ -2134,6 +2142,13 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::to_sorted)
     arguments.empend(length);
     auto* array = TRY(typed_array_create_same_type(vm, *typed_array, move(arguments)));
 
+    // OPTIMIZATION: See TypedArrayPrototype::sort. A has the same element type as O, so the sorted elements can be
+    //               written to it directly.
+    if (compare_function.is_undefined()) {
+        sort_typed_array_elements_in_default_order(*typed_array, *array, length);
+        return array;
+    }
+
     // 6. NOTE: The following closure performs a numeric comparison rather than the string comparison used in 23.1.3.34.
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
         // a. Return ? CompareTypedArrayElements(x, y, comparefn).
@@ -88,8 +88,14 @@ VM::VM(ErrorMessages error_messages)
     m_primitive_storage_cage_base = js_primitive_storage_cage_base;
     VERIFY(m_primitive_storage_cage_base != 0);
 
-    m_heap.register_sweep_callback([] {
+    m_heap.register_sweep_callback([this] {
         Bytecode::StaticPropertyLookupCache::sweep_all();
+        m_megamorphic_property_cache.remove_dead_shapes();
+
+        // NB: Native functions may hold views into the buffer of a string across an allocation, so buffers are only
+        //     swapped out from under strings while no JavaScript is running.
+        if (m_execution_context_stack.is_empty())
+            PrimitiveString::deduplicate_long_lived_strings(*this);
     });
 
     m_empty_string = m_heap.allocate<PrimitiveString>(Utf16String {});
@@ -326,6 +332,11 @@ void VM::gather_roots(HashMap<GC::Cell*, GC::HeapRoot>& roots)
     for (auto finalization_registry : m_finalization_registry_cleanup_jobs)
         roots.set(finalization_registry, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
 
+    for (auto shared_data : m_builtin_abstract_operations_shared_data)
+        roots.set(shared_data, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+    for (auto shared_data : m_builtin_array_constructor_shared_data)
+        roots.set(shared_data, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+
     auto gather_roots_from_execution_context_stack = [&roots](Vector<ExecutionContext*> const& stack, Vector<ExecutionContext*> const& previous_running_contexts, ExecutionContext* running_execution_context) {
         for_each_execution_context_top_to_bottom(stack, previous_running_contexts, running_execution_context, [&](ExecutionContext& execution_context) {
             ExecutionContextRootsCollector visitor;
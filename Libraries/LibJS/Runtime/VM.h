@@ -21,6 +21,7 @@
 #include <LibGC/RootVector.h>
 #include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/Label.h>
+#include <LibJS/Bytecode/MegamorphicPropertyCache.h>
 #include <LibJS/Bytecode/Operand.h>
 #include <LibJS/Bytecode/Register.h>
 #include <LibJS/CyclicModule.h>
@@ -263,6 +264,11 @@ public:
     // running execution context.
     Vector<ExecutionContext*> const& execution_context_stack() const { return m_execution_context_stack; }
 
+    // For walking the stack without the consistency checks of for_each_execution_context_top_to_bottom(), which a
+    // sampling profiler interrupting a push or pop must be able to do.
+    Vector<ExecutionContext*> const& execution_context_stack_previous_running_contexts() const { return m_execution_context_stack_previous_running_contexts; }
+    ExecutionContext const* running_execution_context_if_any() const { return m_running_execution_context; }
+
     template<typename Callback>
     void for_each_execution_context_top_to_bottom(Callback callback)
     {
@@ -341,6 +347,22 @@ public:
 
     InterpreterStack& interpreter_stack() { return m_interpreter_stack; }
 
+    Bytecode::MegamorphicPropertyCache& megamorphic_property_cache() { return m_megamorphic_property_cache; }
+    Bytecode::MegamorphicPropertyCache const& megamorphic_property_cache() const { return m_megamorphic_property_cache; }
+
+    // The builtin JavaScript files don't depend on the realm they are used in, so every realm in this VM shares a single
+    // compilation of each of them. Populated lazily by Intrinsics.
+    Vector<GC::Ref<SharedFunctionInstanceData>>& builtin_abstract_operations_shared_data(Badge<Intrinsics>) { return m_builtin_abstract_operations_shared_data; }
+    Vector<GC::Ref<SharedFunctionInstanceData>>& builtin_array_constructor_shared_data(Badge<Intrinsics>) { return m_builtin_array_constructor_shared_data; }
+
+    // Number of Shapes currently allocated on this VM's heap, and how many of those are dictionary shapes.
+    size_t live_shape_count() const { return m_live_shape_count; }
+    size_t live_dictionary_shape_count() const { return m_live_dictionary_shape_count; }
+    void did_create_shape(Badge<Shape>) { ++m_live_shape_count; }
+    void did_destroy_shape(Badge<Shape>) { --m_live_shape_count; }
+    void did_create_dictionary_shape(Badge<Shape>) { ++m_live_dictionary_shape_count; }
+    void did_destroy_dictionary_shape(Badge<Shape>) { --m_live_dictionary_shape_count; }
+
     HashMap<Utf16String, GC::Ref<Symbol>> const& global_symbol_registry() const { return m_global_symbol_registry; }
     HashMap<Utf16String, GC::Ref<Symbol>>& global_symbol_registry() { return m_global_symbol_registry; }
 
@@ -523,6 +545,8 @@ private:
 
     GC::Heap m_heap;
 
+    Bytecode::MegamorphicPropertyCache m_megamorphic_property_cache;
+
     Vector<ExecutionContext*> m_execution_context_stack;
     // Base pushes may happen while an inline JS-to-JS frame is running, and
     // TemporaryExecutionContext can push the same context multiple times. Keep
@@ -544,6 +568,12 @@ private:
 
     Vector<GC::Ref<FinalizationRegistry>> m_finalization_registry_cleanup_jobs;
 
+    size_t m_live_shape_count { 0 };
+    size_t m_live_dictionary_shape_count { 0 };
+
+    Vector<GC::Ref<SharedFunctionInstanceData>> m_builtin_abstract_operations_shared_data;
+    Vector<GC::Ref<SharedFunctionInstanceData>> m_builtin_array_constructor_shared_data;
+
     GC::Ptr<PrimitiveString> m_empty_string;
     GC::Ptr<PrimitiveString> m_single_ascii_character_strings[128] {};
     ErrorMessages m_error_messages;
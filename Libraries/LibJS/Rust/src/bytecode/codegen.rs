@@ -8999,6 +8999,9 @@ const BUILTIN_STRING_ITERATOR_PROTOTYPE_NEXT: u8 = 20;
 const BUILTIN_STRING_FROM_CHAR_CODE: u8 = 21;
 const BUILTIN_STRING_PROTOTYPE_CHAR_CODE_AT: u8 = 22;
 const BUILTIN_STRING_PROTOTYPE_CHAR_AT: u8 = 23;
+const BUILTIN_ARRAY_PROTOTYPE_PUSH: u8 = 24;
+const BUILTIN_MAP_PROTOTYPE_GET: u8 = 25;
+const BUILTIN_MAP_PROTOTYPE_SET: u8 = 26;
 
 /// Detect known builtin methods from a callee expression (e.g. Math.abs).
 /// Returns the Builtin enum value as u8, matching Builtins.h ordering.
@@ -9019,6 +9022,15 @@ fn get_builtin(callee: &Expression, arena: &crate::ast::AstArena) -> Option<u8>
     if property_name == utf16!("charCodeAt") {
         return Some(BUILTIN_STRING_PROTOTYPE_CHAR_CODE_AT);
     }
+    if property_name == utf16!("push") {
+        return Some(BUILTIN_ARRAY_PROTOTYPE_PUSH);
+    }
+    if property_name == utf16!("get") {
+        return Some(BUILTIN_MAP_PROTOTYPE_GET);
+    }
+    if property_name == utf16!("set") {
+        return Some(BUILTIN_MAP_PROTOTYPE_SET);
+    }
     let ExpressionKind::Identifier(base_ident) = &member_data.object.inner else {
         return None;
     };
@@ -9111,6 +9123,9 @@ fn builtin_argument_count(builtin: u8) -> usize {
         BUILTIN_STRING_FROM_CHAR_CODE => 1,
         BUILTIN_STRING_PROTOTYPE_CHAR_CODE_AT => 1,
         BUILTIN_STRING_PROTOTYPE_CHAR_AT => 1,
+        BUILTIN_ARRAY_PROTOTYPE_PUSH => 1,
+        BUILTIN_MAP_PROTOTYPE_GET => 1,
+        BUILTIN_MAP_PROTOTYPE_SET => 2,
         _ => usize::MAX,
     }
 }
@@ -9207,6 +9222,15 @@ fn emit_builtin_call(
         BUILTIN_STRING_PROTOTYPE_CHAR_AT => {
             emit_unary_builtin_instruction!(CallBuiltinStringPrototypeCharAt);
         }
+        BUILTIN_ARRAY_PROTOTYPE_PUSH => {
+            emit_unary_builtin_instruction!(CallBuiltinArrayPrototypePush);
+        }
+        BUILTIN_MAP_PROTOTYPE_GET => {
+            emit_unary_builtin_instruction!(CallBuiltinMapPrototypeGet);
+        }
+        BUILTIN_MAP_PROTOTYPE_SET => {
+            emit_binary_builtin_instruction!(CallBuiltinMapPrototypeSet);
+        }
         _ => unreachable!(),
     }
 }
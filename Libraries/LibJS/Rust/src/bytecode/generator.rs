@@ -20,6 +20,7 @@ use super::ffi::AbstractOperationKind;
 use super::ffi::WellKnownSymbolKind;
 use super::instruction::Instruction;
 use super::operand::*;
+use super::optimizer::OptimizationPasses;
 use crate::ast::AstArena;
 use crate::ast::FunctionData;
 use crate::ast::FunctionId;
@@ -218,6 +219,7 @@ pub struct Generator {
     // --- Basic block management ---
     pub basic_blocks: Vec<BasicBlock>,
     current_block_index: Label,
+    pub optimization_passes: OptimizationPasses,
 
     // --- Register allocation ---
     next_register: u32,
@@ -407,6 +409,7 @@ impl Generator {
         Self {
             basic_blocks: Vec::new(),
             current_block_index: Label(0),
+            optimization_passes: OptimizationPasses::default(),
             next_register: Register::RESERVED_COUNT,
             constants: Vec::new(),
             true_constant: None,
@@ -1704,6 +1707,9 @@ impl Generator {
             }
         }
 
+        // Phase 0: Block-level optimization passes (operands and labels are not yet rewritten).
+        super::optimizer::optimize(&mut self.basic_blocks, self.optimization_passes);
+
         // If any block is unterminated, ensure the undefined constant exists
         // for the assembly-time End(undefined) fallthrough. This must happen
         // before computing number_of_constants so operand rewriting accounts
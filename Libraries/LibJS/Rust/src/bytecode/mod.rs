@@ -16,6 +16,7 @@
 //! - `instruction` -- Instruction enum (generated from Bytecode.def by build.rs)
 //! - `basic_block` -- BasicBlock: list of instructions with control flow metadata
 //! - `generator` -- Generator: manages registers, constants, tables, and assembly
+//! - `optimizer` -- Optimization passes run over basic blocks before assembly
 //! - `codegen` -- AST-walking code that emits instructions via the Generator
 //! - `ffi` -- FFI bridge to create C++ Executable and SharedFunctionInstanceData
 
@@ -26,4 +27,5 @@ pub mod ffi;
 pub mod generator;
 pub mod instruction;
 pub mod operand;
+pub mod optimizer;
 pub mod validator;
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+//! Post-codegen bytecode optimization passes.
+//!
+//! These passes run over the generator's basic blocks before assembly, i.e.
+//! before operand rewriting, label patching and encoding. All block
+//! references are still block indices at this point, and instructions are
+//! still typed `Instruction` values.
+//!
+//! Every pass must preserve observable behavior, including which exception
+//! handler covers each instruction that can throw.
+
+use super::basic_block::BasicBlock;
+use super::instruction::Instruction;
+use super::operand::Label;
+use crate::u32_from_usize;
+
+/// Selects which optimization passes run during assembly.
+#[derive(Debug, Clone, Copy)]
+pub struct OptimizationPasses {
+    /// Remove `Mov` instructions whose source and destination are the same.
+    pub redundant_mov_elimination: bool,
+    /// Retarget jumps to blocks that consist of a single unconditional `Jump`.
+    pub jump_threading: bool,
+}
+
+impl OptimizationPasses {
+    pub const ALL: Self = Self {
+        redundant_mov_elimination: true,
+        jump_threading: true,
+    };
+
+    pub const NONE: Self = Self {
+        redundant_mov_elimination: false,
+        jump_threading: false,
+    };
+}
+
+impl Default for OptimizationPasses {
+    /// Jump threading is opt-in for now: retargeting a jump away from the
+    /// block that immediately follows it defeats the assembler's
+    /// jump-to-next-block elision, which can make the emitted code larger.
+    fn default() -> Self {
+        Self {
+            jump_threading: false,
+            ..Self::ALL
+        }
+    }
+}
+
+/// Run the enabled optimization passes over `blocks`.
+pub fn optimize(blocks: &mut [BasicBlock], passes: OptimizationPasses) {
+    if passes.redundant_mov_elimination {
+        eliminate_redundant_movs(blocks);
+    }
+    if passes.jump_threading {
+        thread_jumps(blocks);
+    }
+}
+
+fn eliminate_redundant_movs(blocks: &mut [BasicBlock]) {
+    for block in blocks {
+        block
+            .instructions
+            .retain(|(instruction, _, _)| !matches!(instruction, Instruction::Mov { dst, src } if dst == src));
+    }
+}
+
+/// If `block` consists of nothing but `Jump { target }`, returns that target.
+fn trivial_jump_target(block: &BasicBlock) -> Option<Label> {
+    match block.instructions.as_slice() {
+        [(Instruction::Jump { target }, _, _)] => Some(*target),
+        _ => None,
+    }
+}
+
+/// Follows chains of trivial jump blocks starting at `label` and returns the
+/// first block that does real work. Cycles made entirely of trivial jumps
+/// (e.g. `while (true) {}`) resolve to a block on the cycle.
+fn resolve_jump_chain(blocks: &[BasicBlock], label: Label) -> Label {
+    let mut current = label;
+    // A chain can't be longer than the number of blocks without revisiting one.
+    for _ in 0..blocks.len() {
+        match trivial_jump_target(&blocks[current.0 as usize]) {
+            Some(next) if next.0 != current.0 => current = next,
+            _ => break,
+        }
+    }
+    current
+}
+
+/// Jumping to a block whose only instruction is an unconditional `Jump` is
+/// the same as jumping straight to that jump's target. The intermediate
+/// `Jump` cannot throw, so exception handler coverage is unaffected.
+fn thread_jumps(blocks: &mut [BasicBlock]) {
+    let resolved: Vec<Label> = (0..blocks.len())
+        .map(|index| resolve_jump_chain(blocks, Label(u32_from_usize(index))))
+        .collect();
+
+    for block in &mut *blocks {
+        for (instruction, _, _) in &mut block.instructions {
+            instruction.visit_labels(&mut |label: &mut Label| {
+                *label = resolved[label.0 as usize];
+            });
+        }
+    }
+}
@@ -32,22 +32,16 @@ size_t search_interval(u32 sample_rate)
 
 void zero_block(Media::AudioBlock& block)
 {
-    for (size_t channel = 0; channel < block.channel_count(); channel++) {
-        auto channel_data = block.channel_data(channel);
-        for (auto& sample : channel_data)
-            sample = 0.0f;
-    }
+    for (size_t channel = 0; channel < block.channel_count(); channel++)
+        block.channel_data(channel).fill(0.0f);
 }
 
 void zero_frames(Media::AudioBlock& block, size_t starting_frame, size_t frame_count)
 {
     VERIFY(starting_frame <= block.frame_count());
     VERIFY(frame_count <= block.frame_count() - starting_frame);
-    for (size_t channel = 0; channel < block.channel_count(); channel++) {
-        auto channel_data = block.channel_data(channel);
-        for (size_t frame = 0; frame < frame_count; frame++)
-            channel_data[starting_frame + frame] = 0.0f;
-    }
+    for (size_t channel = 0; channel < block.channel_count(); channel++)
+        block.channel_data(channel).slice(starting_frame, frame_count).fill(0.0f);
 }
 
 void copy_partial_frames(Media::AudioBlock const& source, size_t source_offset, size_t frame_count, size_t destination_offset, Media::AudioBlock& destination)
@@ -89,6 +83,9 @@ WSOLAAlgorithm::WSOLAAlgorithm(SampleSpecification sample_specification)
     m_optimal_block = create_block(m_ola_window_size);
     m_search_block = create_block(m_num_candidate_blocks + (m_ola_window_size - 1));
     m_target_block = create_block(m_ola_window_size);
+
+    if (WSOLAInternals::FFTCrossCorrelator::is_cheaper_than_direct_search(m_target_block.frame_count(), m_search_block.frame_count()))
+        m_correlator = make<WSOLAInternals::FFTCrossCorrelator>(m_target_block.frame_count(), m_search_block.frame_count());
 }
 
 WSOLAAlgorithm::~WSOLAAlgorithm() = default;
@@ -196,18 +193,14 @@ void WSOLAAlgorithm::get_optimal_block()
             exclude_interval_high <= 0 ? 0 : static_cast<size_t>(exclude_interval_high),
         };
 
-        optimal_index = static_cast<i64>(WSOLAInternals::optimal_index(m_search_block, m_target_block, exclude_interval));
+        optimal_index = static_cast<i64>(WSOLAInternals::optimal_index(m_search_block, m_target_block, exclude_interval, m_correlator.ptr()));
 
         optimal_index += m_search_block_index;
         peek_audio_with_zero_prepend(optimal_index, m_optimal_block);
 
         for (size_t channel_index = 0; channel_index < m_sample_specification.channel_count(); channel_index++) {
-            auto optimal_channel = m_optimal_block.channel_data(channel_index);
-            auto target_channel = m_target_block.channel_data(channel_index);
-            for (size_t n = 0; n < m_ola_window_size; n++) {
-                optimal_channel[n] = (optimal_channel[n] * m_transition_window[n])
-                    + (target_channel[n] * m_transition_window[m_ola_window_size + n]);
-            }
+            WSOLAInternals::overlap_add(m_optimal_block.channel_data(channel_index).trim(m_ola_window_size), m_transition_window.span(),
+                m_target_block.channel_data(channel_index), m_transition_window.span().slice(m_ola_window_size));
         }
     }
 
@@ -225,13 +218,9 @@ bool WSOLAAlgorithm::run_one_wsola_iteration(float playback_rate)
         auto optimal_channel = m_optimal_block.channel_data(channel_index);
         auto output_channel = m_wsola_output.channel_data(channel_index).slice(m_num_complete_frames);
 
-        for (size_t n = 0; n < m_ola_hop_size; n++) {
-            output_channel[n] = output_channel[n] * m_ola_window[m_ola_hop_size + n];
-            output_channel[n] += optimal_channel[n] * m_ola_window[n];
-        }
-
-        for (size_t n = 0; n < m_ola_hop_size; n++)
-            output_channel[m_ola_hop_size + n] = optimal_channel[m_ola_hop_size + n];
+        WSOLAInternals::overlap_add(output_channel.trim(m_ola_hop_size), m_ola_window.span().slice(m_ola_hop_size),
+            optimal_channel, m_ola_window.span());
+        AK::TypedTransfer<float>::copy(&output_channel[m_ola_hop_size], &optimal_channel[m_ola_hop_size], m_ola_hop_size);
     }
 
     m_num_complete_frames += m_ola_hop_size;
@@ -267,8 +256,7 @@ size_t WSOLAAlgorithm::write_completed_frames_to(size_t requested_frames, size_t
     auto const frames_to_move = m_wsola_output.frame_count() - rendered_frames;
     for (size_t channel_index = 0; channel_index < m_sample_specification.channel_count(); channel_index++) {
         auto channel_data = m_wsola_output.channel_data(channel_index);
-        for (size_t i = 0; i < frames_to_move; i++)
-            channel_data[i] = channel_data[i + rendered_frames];
+        AK::TypedTransfer<float>::move(channel_data.data(), channel_data.offset_pointer(rendered_frames), frames_to_move);
     }
     m_num_complete_frames -= rendered_frames;
     return rendered_frames;
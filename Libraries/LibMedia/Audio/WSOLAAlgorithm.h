@@ -8,9 +8,11 @@
 
 #pragma once
 
+#include <AK/OwnPtr.h>
 #include <AK/Vector.h>
 #include <LibMedia/Audio/AudioBuffer.h>
 #include <LibMedia/Audio/SampleSpecification.h>
+#include <LibMedia/Audio/WSOLAInternals.h>
 #include <LibMedia/AudioBlock.h>
 
 namespace Audio {
@@ -80,6 +82,9 @@ private:
     Media::AudioBlock m_optimal_block;
     Media::AudioBlock m_search_block;
     Media::AudioBlock m_target_block;
+
+    // Only set if the search is large enough that correlating through FFTs is the cheaper option.
+    OwnPtr<WSOLAInternals::FFTCrossCorrelator> m_correlator;
 };
 
 }
@@ -6,15 +6,57 @@
  */
 // Source: chromium/media/filters/wsola_internals.{h,cc}.
 
+#include <AK/IntegralMath.h>
 #include <AK/Math.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/Vector.h>
 #include <LibMedia/Audio/WSOLAInternals.h>
 #include <LibMedia/AudioBlock.h>
 
 namespace Audio::WSOLAInternals {
 
+using AK::SIMD::expand4;
+using AK::SIMD::f32x4;
+using AK::SIMD::load_unaligned;
+using AK::SIMD::store_unaligned;
+
 namespace {
 
+constexpr size_t lanes = 4;
+
+float sum_of_products(ReadonlySpan<float> a, ReadonlySpan<float> b)
+{
+    VERIFY(a.size() == b.size());
+
+    // Two accumulators hide the latency of the additions.
+    auto sum0 = expand4(0.0f);
+    auto sum1 = expand4(0.0f);
+    size_t i = 0;
+    for (; i + (2 * lanes) <= a.size(); i += 2 * lanes) {
+        sum0 += load_unaligned<f32x4>(&a[i]) * load_unaligned<f32x4>(&b[i]);
+        sum1 += load_unaligned<f32x4>(&a[i + lanes]) * load_unaligned<f32x4>(&b[i + lanes]);
+    }
+    for (; i + lanes <= a.size(); i += lanes)
+        sum0 += load_unaligned<f32x4>(&a[i]) * load_unaligned<f32x4>(&b[i]);
+
+    auto sum = sum0 + sum1;
+    auto result = (sum[0] + sum[1]) + (sum[2] + sum[3]);
+    for (; i < a.size(); i++)
+        result += a[i] * b[i];
+    return result;
+}
+
+void candidate_dot_product(Media::AudioBlock const& target_block, Media::AudioBlock const& search_block, size_t candidate,
+    ReadonlySpan<float> candidate_dot_products, Span<float> dot_product)
+{
+    if (!candidate_dot_products.is_empty()) {
+        candidate_dot_products.slice(candidate * dot_product.size(), dot_product.size()).copy_to(dot_product);
+        return;
+    }
+    multi_channel_dot_product(target_block, 0, search_block, candidate, target_block.frame_count(), dot_product);
+}
+
 bool in_interval(size_t n, Interval interval)
 {
     return n >= interval.low && n <= interval.high;
@@ -48,10 +90,7 @@ void multi_channel_dot_product(Media::AudioBlock const& a, size_t frame_offset_a
     for (size_t channel_index = 0; channel_index < a.channel_count(); channel_index++) {
         auto channel_a = a.channel_data(channel_index).slice(frame_offset_a, num_frames);
         auto channel_b = b.channel_data(channel_index).slice(frame_offset_b, num_frames);
-        auto sum = 0.0f;
-        for (size_t i = 0; i < num_frames; i++)
-            sum += channel_a[i] * channel_b[i];
-        dot_product[channel_index] = sum;
+        dot_product[channel_index] = sum_of_products(channel_a, channel_b);
     }
 }
 
@@ -100,7 +139,8 @@ void quadratic_interpolation(ReadonlySpan<float> y_values, float& extremum, floa
 size_t decimated_search(size_t decimation, Interval exclude_interval,
     Media::AudioBlock const& target_block, Media::AudioBlock const& search_segment,
     ReadonlySpan<float> energy_target_block,
-    ReadonlySpan<float> energy_candidate_blocks)
+    ReadonlySpan<float> energy_candidate_blocks,
+    ReadonlySpan<float> candidate_dot_products)
 {
     auto channel_count = static_cast<size_t>(search_segment.channel_count());
     auto block_size = target_block.frame_count();
@@ -110,7 +150,7 @@ size_t decimated_search(size_t decimation, Interval exclude_interval,
     float similarity[3];
 
     size_t n = 0;
-    multi_channel_dot_product(target_block, 0, search_segment, n, block_size, dot_product.span());
+    candidate_dot_product(target_block, search_segment, n, candidate_dot_products, dot_product.span());
     similarity[0] = multi_channel_similarity_measure(
         dot_product.span(), energy_target_block,
         energy_candidate_blocks.slice(n * channel_count, channel_count));
@@ -122,7 +162,7 @@ size_t decimated_search(size_t decimation, Interval exclude_interval,
     if (n >= num_candidate_blocks)
         return 0;
 
-    multi_channel_dot_product(target_block, 0, search_segment, n, block_size, dot_product.span());
+    candidate_dot_product(target_block, search_segment, n, candidate_dot_products, dot_product.span());
     similarity[1] = multi_channel_similarity_measure(
         dot_product.span(), energy_target_block,
         energy_candidate_blocks.slice(n * channel_count, channel_count));
@@ -132,7 +172,7 @@ size_t decimated_search(size_t decimation, Interval exclude_interval,
         return similarity[1] > similarity[0] ? decimation : 0;
 
     for (; n < num_candidate_blocks; n += decimation) {
-        multi_channel_dot_product(target_block, 0, search_segment, n, block_size, dot_product.span());
+        candidate_dot_product(target_block, search_segment, n, candidate_dot_products, dot_product.span());
         similarity[2] = multi_channel_similarity_measure(
             dot_product.span(), energy_target_block,
             energy_candidate_blocks.slice(n * channel_count, channel_count));
@@ -169,7 +209,8 @@ size_t decimated_search(size_t decimation, Interval exclude_interval,
 size_t full_search(size_t low_limit, size_t high_limit, Interval exclude_interval,
     Media::AudioBlock const& target_block, Media::AudioBlock const& search_block,
     ReadonlySpan<float> energy_target_block,
-    ReadonlySpan<float> energy_candidate_blocks)
+    ReadonlySpan<float> energy_candidate_blocks,
+    ReadonlySpan<float> candidate_dot_products)
 {
     auto channel_count = static_cast<size_t>(search_block.channel_count());
     auto block_size = target_block.frame_count();
@@ -182,7 +223,7 @@ size_t full_search(size_t low_limit, size_t high_limit, Interval exclude_interva
     for (size_t n = low_limit; n <= high_limit; n++) {
         if (in_interval(n, exclude_interval))
             continue;
-        multi_channel_dot_product(target_block, 0, search_block, n, block_size, dot_product.span());
+        candidate_dot_product(target_block, search_block, n, candidate_dot_products, dot_product.span());
         auto similarity = multi_channel_similarity_measure(
             dot_product.span(), energy_target_block,
             energy_candidate_blocks.slice(n * channel_count, channel_count));
@@ -195,7 +236,7 @@ size_t full_search(size_t low_limit, size_t high_limit, Interval exclude_interva
 }
 
 size_t optimal_index(Media::AudioBlock const& search_block, Media::AudioBlock const& target_block,
-    Interval exclude_interval)
+    Interval exclude_interval, FFTCrossCorrelator* correlator)
 {
     VERIFY(search_block.channel_count() == target_block.channel_count());
     auto channel_count = static_cast<size_t>(search_block.channel_count());
@@ -212,14 +253,171 @@ size_t optimal_index(Media::AudioBlock const& search_block, Media::AudioBlock co
     multi_channel_moving_block_energies(search_block, target_size, energy_candidate_blocks.span());
     multi_channel_dot_product(target_block, 0, target_block, 0, target_size, energy_target_block.span());
 
+    Vector<float> candidate_dot_products;
+    if (correlator) {
+        candidate_dot_products.resize(channel_count * num_candidate_blocks);
+        correlator->correlate(target_block, search_block, candidate_dot_products.span());
+    }
+
     auto coarse_index = decimated_search(
         search_decimation, exclude_interval, target_block, search_block,
-        energy_target_block.span(), energy_candidate_blocks.span());
+        energy_target_block.span(), energy_candidate_blocks.span(), candidate_dot_products.span());
 
     size_t low_limit = coarse_index < search_decimation ? 0 : coarse_index - search_decimation;
     auto high_limit = min(num_candidate_blocks - 1, coarse_index + search_decimation);
     return full_search(low_limit, high_limit, exclude_interval, target_block, search_block,
-        energy_target_block.span(), energy_candidate_blocks.span());
+        energy_target_block.span(), energy_candidate_blocks.span(), candidate_dot_products.span());
+}
+
+FFTCrossCorrelator::FFTCrossCorrelator(size_t target_frame_count, size_t search_frame_count)
+    : m_target_frame_count(target_frame_count)
+    , m_search_frame_count(search_frame_count)
+{
+    VERIFY(target_frame_count > 0);
+    VERIFY(target_frame_count <= search_frame_count);
+
+    // The transform must be at least as long as the search block, so that the circular correlation it computes never
+    // wraps around for any of the candidate blocks.
+    auto bits = max<size_t>(1, AK::ceil_log2(search_frame_count));
+    m_size = AK::exp2(bits);
+
+    m_bit_reversed_indices.resize(m_size);
+    for (size_t i = 0; i < m_size; i++) {
+        size_t reversed = 0;
+        for (size_t bit = 0; bit < bits; bit++)
+            reversed |= ((i >> bit) & 1) << (bits - 1 - bit);
+        m_bit_reversed_indices[i] = static_cast<u32>(reversed);
+    }
+
+    m_twiddle_real.resize(m_size - 1);
+    m_twiddle_imaginary.resize(m_size - 1);
+    for (size_t half = 1; half < m_size; half *= 2) {
+        for (size_t k = 0; k < half; k++) {
+            auto angle = AK::Pi<double> * static_cast<double>(k) / static_cast<double>(half);
+            m_twiddle_real[half - 1 + k] = static_cast<float>(AK::cos(angle));
+            m_twiddle_imaginary[half - 1 + k] = static_cast<float>(-AK::sin(angle));
+        }
+    }
+
+    m_real.resize(m_size);
+    m_imaginary.resize(m_size);
+    m_product_real.resize(m_size);
+    m_product_imaginary.resize(m_size);
+}
+
+bool FFTCrossCorrelator::is_cheaper_than_direct_search(size_t target_frame_count, size_t search_frame_count)
+{
+    // The direct search computes a dot product for every fifth candidate, and then for the ten candidates around the
+    // best one. The FFTs take two transforms of N / 2 butterflies per stage, and a butterfly is weighted as eight
+    // multiply-adds since it vectorizes far worse than a dot product does.
+    auto candidate_count = search_frame_count - target_frame_count + 1;
+    auto direct_cost = ((candidate_count / 5) + 11) * target_frame_count;
+    auto bits = max<size_t>(1, AK::ceil_log2(search_frame_count));
+    auto fft_cost = AK::exp2(bits) * bits * 8;
+    return fft_cost < direct_cost;
+}
+
+// An in-place, iterative radix-2 forward transform.
+void FFTCrossCorrelator::transform(Span<float> real, Span<float> imaginary) const
+{
+    for (size_t i = 0; i < m_size; i++) {
+        auto j = m_bit_reversed_indices[i];
+        if (i < j) {
+            swap(real[i], real[j]);
+            swap(imaginary[i], imaginary[j]);
+        }
+    }
+
+    for (size_t half = 1; half < m_size; half *= 2) {
+        auto twiddle_real = m_twiddle_real.span().slice(half - 1, half);
+        auto twiddle_imaginary = m_twiddle_imaginary.span().slice(half - 1, half);
+        for (size_t start = 0; start < m_size; start += 2 * half) {
+            size_t k = 0;
+            if (half >= lanes) {
+                for (; k < half; k += lanes) {
+                    auto even = start + k;
+                    auto odd = even + half;
+                    auto w_real = load_unaligned<f32x4>(&twiddle_real[k]);
+                    auto w_imaginary = load_unaligned<f32x4>(&twiddle_imaginary[k]);
+                    auto odd_real = load_unaligned<f32x4>(&real[odd]);
+                    auto odd_imaginary = load_unaligned<f32x4>(&imaginary[odd]);
+                    auto t_real = (odd_real * w_real) - (odd_imaginary * w_imaginary);
+                    auto t_imaginary = (odd_real * w_imaginary) + (odd_imaginary * w_real);
+                    auto even_real = load_unaligned<f32x4>(&real[even]);
+                    auto even_imaginary = load_unaligned<f32x4>(&imaginary[even]);
+                    store_unaligned(&real[odd], even_real - t_real);
+                    store_unaligned(&imaginary[odd], even_imaginary - t_imaginary);
+                    store_unaligned(&real[even], even_real + t_real);
+                    store_unaligned(&imaginary[even], even_imaginary + t_imaginary);
+                }
+                continue;
+            }
+            for (; k < half; k++) {
+                auto even = start + k;
+                auto odd = even + half;
+                auto t_real = (real[odd] * twiddle_real[k]) - (imaginary[odd] * twiddle_imaginary[k]);
+                auto t_imaginary = (real[odd] * twiddle_imaginary[k]) + (imaginary[odd] * twiddle_real[k]);
+                real[odd] = real[even] - t_real;
+                imaginary[odd] = imaginary[even] - t_imaginary;
+                real[even] += t_real;
+                imaginary[even] += t_imaginary;
+            }
+        }
+    }
+}
+
+void FFTCrossCorrelator::correlate(Media::AudioBlock const& target_block, Media::AudioBlock const& search_block, Span<float> dot_products)
+{
+    VERIFY(target_block.channel_count() == search_block.channel_count());
+    VERIFY(target_block.frame_count() == m_target_frame_count);
+    VERIFY(search_block.frame_count() == m_search_frame_count);
+    auto channel_count = static_cast<size_t>(search_block.channel_count());
+    auto candidate_count = m_search_frame_count - m_target_frame_count + 1;
+    VERIFY(dot_products.size() == candidate_count * channel_count);
+
+    auto scale = 1.0f / static_cast<float>(m_size);
+    for (size_t channel_index = 0; channel_index < channel_count; channel_index++) {
+        // Both blocks are real, so they go through a single complex transform, with the search block as the real part
+        // and the target block as the imaginary part.
+        search_block.channel_data(channel_index).copy_to(m_real);
+        m_real.span().slice(m_search_frame_count).fill(0.0f);
+        target_block.channel_data(channel_index).copy_to(m_imaginary);
+        m_imaginary.span().slice(m_target_frame_count).fill(0.0f);
+        transform(m_real, m_imaginary);
+
+        // Separate the two spectra using their conjugate symmetry, and multiply the search spectrum by the conjugate of
+        // the target spectrum. The result is conjugated as well, so that the forward transform below computes the
+        // inverse transform.
+        for (size_t k = 0; k < m_size; k++) {
+            auto mirror = (m_size - k) & (m_size - 1);
+            auto search_real = 0.5f * (m_real[k] + m_real[mirror]);
+            auto search_imaginary = 0.5f * (m_imaginary[k] - m_imaginary[mirror]);
+            auto target_real = 0.5f * (m_imaginary[k] + m_imaginary[mirror]);
+            auto target_imaginary = 0.5f * (m_real[mirror] - m_real[k]);
+            m_product_real[k] = (search_real * target_real) + (search_imaginary * target_imaginary);
+            m_product_imaginary[k] = -((search_imaginary * target_real) - (search_real * target_imaginary));
+        }
+        transform(m_product_real, m_product_imaginary);
+
+        for (size_t n = 0; n < candidate_count; n++)
+            dot_products[(n * channel_count) + channel_index] = m_product_real[n] * scale;
+    }
+}
+
+void overlap_add(Span<float> a, ReadonlySpan<float> a_window, ReadonlySpan<float> b, ReadonlySpan<float> b_window)
+{
+    VERIFY(a_window.size() >= a.size());
+    VERIFY(b.size() >= a.size());
+    VERIFY(b_window.size() >= a.size());
+
+    size_t i = 0;
+    for (; i + lanes <= a.size(); i += lanes) {
+        auto result = (load_unaligned<f32x4>(&a[i]) * load_unaligned<f32x4>(&a_window[i]))
+            + (load_unaligned<f32x4>(&b[i]) * load_unaligned<f32x4>(&b_window[i]));
+        store_unaligned(&a[i], result);
+    }
+    for (; i < a.size(); i++)
+        a[i] = (a[i] * a_window[i]) + (b[i] * b_window[i]);
 }
 
 void get_periodic_hanning_window(Span<float> window)
@@ -10,6 +10,8 @@
 
 #include <AK/Span.h>
 #include <AK/Types.h>
+#include <AK/Vector.h>
+#include <LibMedia/Export.h>
 
 namespace Media {
 
@@ -24,7 +26,7 @@ struct Interval {
     size_t high;
 };
 
-void multi_channel_dot_product(Media::AudioBlock const& a, size_t frame_offset_a,
+MEDIA_API void multi_channel_dot_product(Media::AudioBlock const& a, size_t frame_offset_a,
     Media::AudioBlock const& b, size_t frame_offset_b,
     size_t num_frames, Span<float> dot_product);
 
@@ -34,18 +36,56 @@ void multi_channel_moving_block_energies(Media::AudioBlock const& input,
 void quadratic_interpolation(ReadonlySpan<float> y_values,
     float& extremum, float& extremum_value);
 
+// Computes the dot products of a target block with every candidate block of a search block at once, by multiplying
+// their spectra. For large blocks, this is much cheaper than computing each dot product separately.
+class MEDIA_API FFTCrossCorrelator {
+public:
+    FFTCrossCorrelator(size_t target_frame_count, size_t search_frame_count);
+
+    // A rough estimate of whether correlating blocks of these sizes through FFTs is cheaper than the direct search.
+    static bool is_cheaper_than_direct_search(size_t target_frame_count, size_t search_frame_count);
+
+    // Fills dot_products[(n * channel_count) + channel] with the dot product of the target block and the candidate
+    // block starting at frame n of the search block, which is the same layout as the candidate block energies.
+    void correlate(Media::AudioBlock const& target_block, Media::AudioBlock const& search_block, Span<float> dot_products);
+
+private:
+    void transform(Span<float> real, Span<float> imaginary) const;
+
+    size_t m_target_frame_count { 0 };
+    size_t m_search_frame_count { 0 };
+    size_t m_size { 0 };
+
+    Vector<u32> m_bit_reversed_indices;
+    // The twiddle factors of each stage in turn, with the stage that combines pairs of size n starting at n - 1.
+    Vector<float> m_twiddle_real;
+    Vector<float> m_twiddle_imaginary;
+
+    Vector<float> m_real;
+    Vector<float> m_imaginary;
+    Vector<float> m_product_real;
+    Vector<float> m_product_imaginary;
+};
+
+// Candidate dot products computed up front, as FFTCrossCorrelator does, can be passed in to avoid computing each of
+// them while searching.
 size_t decimated_search(size_t decimation, Interval exclude_interval,
     Media::AudioBlock const& target_block, Media::AudioBlock const& search_segment,
     ReadonlySpan<float> energy_target_block,
-    ReadonlySpan<float> energy_candidate_blocks);
+    ReadonlySpan<float> energy_candidate_blocks,
+    ReadonlySpan<float> candidate_dot_products = {});
 
 size_t full_search(size_t low_limit, size_t high_limit, Interval exclude_interval,
     Media::AudioBlock const& target_block, Media::AudioBlock const& search_block,
     ReadonlySpan<float> energy_target_block,
-    ReadonlySpan<float> energy_candidate_blocks);
+    ReadonlySpan<float> energy_candidate_blocks,
+    ReadonlySpan<float> candidate_dot_products = {});
+
+MEDIA_API size_t optimal_index(Media::AudioBlock const& search_block, Media::AudioBlock const& target_block,
+    Interval exclude_interval, FFTCrossCorrelator* = nullptr);
 
-size_t optimal_index(Media::AudioBlock const& search_block, Media::AudioBlock const& target_block,
-    Interval exclude_interval);
+// Fills a with (a[n] * a_window[n]) + (b[n] * b_window[n]).
+void overlap_add(Span<float> a, ReadonlySpan<float> a_window, ReadonlySpan<float> b, ReadonlySpan<float> b_window);
 
 void get_periodic_hanning_window(Span<float> window);
 
@@ -9,10 +9,11 @@
 #include <AK/Error.h>
 #include <AK/NonnullOwnPtr.h>
 #include <LibMedia/Audio/TimeStretcher.h>
+#include <LibMedia/Export.h>
 
 namespace Audio {
 
-class WSOLATimeStretcher final : public TimeStretcher {
+class MEDIA_API WSOLATimeStretcher final : public TimeStretcher {
 public:
     static ErrorOr<NonnullOwnPtr<TimeStretcher>> create(SampleSpecification);
     virtual ~WSOLATimeStretcher() override;
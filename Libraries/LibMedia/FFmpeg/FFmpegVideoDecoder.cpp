@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Platform.h>
 #include <LibCore/System.h>
 #include <LibGfx/ColorSpace.h>
 #include <LibGfx/YUVData.h>
@@ -12,64 +13,146 @@
 #include "FFmpegHelpers.h"
 #include "FFmpegVideoDecoder.h"
 
+extern "C" {
+#include <libavutil/hwcontext.h>
+}
+
 namespace Media::FFmpeg {
 
-static AVPixelFormat negotiate_output_format(AVCodecContext*, AVPixelFormat const* formats)
+// The hardware decoding APIs to try, in order of preference.
+static constexpr AVHWDeviceType preferred_hardware_device_types[] = {
+#if defined(AK_OS_MACOS)
+    AV_HWDEVICE_TYPE_VIDEOTOOLBOX,
+#elif defined(AK_OS_WINDOWS)
+    AV_HWDEVICE_TYPE_D3D11VA,
+#elif defined(AK_OS_LINUX)
+    AV_HWDEVICE_TYPE_VAAPI,
+    AV_HWDEVICE_TYPE_VULKAN,
+#endif
+    AV_HWDEVICE_TYPE_NONE,
+};
+
+// Decoded frames stay alive in the playback queue, so the decoder's surface pool must be large enough to cover them.
+static constexpr int extra_hardware_frames = 16;
+
+struct FrameLayout {
+    u8 bit_depth;
+    Subsampling subsampling;
+    // Whether U and V share one plane, as in NV12.
+    bool chroma_is_interleaved { false };
+    // How far the samples are shifted up within each 16-bit component, as in P010.
+    u8 sample_shift { 0 };
+};
+
+static Optional<FrameLayout> frame_layout_for_format(int format)
 {
-    while (*formats >= 0) {
-        switch (*formats) {
-        case AV_PIX_FMT_YUV420P:
-        case AV_PIX_FMT_YUV420P10:
-        case AV_PIX_FMT_YUV420P12:
-        case AV_PIX_FMT_YUV422P:
-        case AV_PIX_FMT_YUV422P10:
-        case AV_PIX_FMT_YUV422P12:
-        case AV_PIX_FMT_YUV444P:
-        case AV_PIX_FMT_YUV444P10:
-        case AV_PIX_FMT_YUV444P12:
-        case AV_PIX_FMT_YUVJ420P:
-        case AV_PIX_FMT_YUVJ422P:
-        case AV_PIX_FMT_YUVJ444P:
-            return *formats;
-        default:
-            break;
-        }
-        formats++;
+    switch (format) {
+    case AV_PIX_FMT_YUV420P:
+    case AV_PIX_FMT_YUVJ420P:
+        return FrameLayout { 8, { true, true } };
+    case AV_PIX_FMT_YUV422P:
+    case AV_PIX_FMT_YUVJ422P:
+        return FrameLayout { 8, { true, false } };
+    case AV_PIX_FMT_YUV444P:
+    case AV_PIX_FMT_YUVJ444P:
+        return FrameLayout { 8, { false, false } };
+    case AV_PIX_FMT_YUV420P10:
+        return FrameLayout { 10, { true, true } };
+    case AV_PIX_FMT_YUV422P10:
+        return FrameLayout { 10, { true, false } };
+    case AV_PIX_FMT_YUV444P10:
+        return FrameLayout { 10, { false, false } };
+    case AV_PIX_FMT_YUV420P12:
+        return FrameLayout { 12, { true, true } };
+    case AV_PIX_FMT_YUV422P12:
+        return FrameLayout { 12, { true, false } };
+    case AV_PIX_FMT_YUV444P12:
+        return FrameLayout { 12, { false, false } };
+    case AV_PIX_FMT_NV12:
+        return FrameLayout { 8, { true, true }, true };
+    case AV_PIX_FMT_P010:
+        return FrameLayout { 10, { true, true }, true, 6 };
+    default:
+        return {};
+    }
+}
+
+static AVPixelFormat hardware_format_for_device(AVCodec const* codec, AVHWDeviceType device_type)
+{
+    for (int i = 0;; i++) {
+        auto const* config = avcodec_get_hw_config(codec, i);
+        if (!config)
+            return AV_PIX_FMT_NONE;
+        if ((config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) != 0 && config->device_type == device_type)
+            return config->pix_fmt;
+    }
+}
+
+static AVPixelFormat negotiate_output_format(AVCodecContext* codec_context, AVPixelFormat const* formats)
+{
+    auto hardware_format = AV_PIX_FMT_NONE;
+    if (codec_context->hw_device_ctx) {
+        auto const* device_context = reinterpret_cast<AVHWDeviceContext const*>(codec_context->hw_device_ctx->data);
+        hardware_format = hardware_format_for_device(codec_context->codec, device_context->type);
+    }
+
+    // NB: If setting up the hardware decoder fails, FFmpeg calls this again without the hardware format in the list,
+    //     so falling through to the software formats is enough to fall back to software decoding.
+    for (auto const* format = formats; *format >= 0; format++) {
+        // Only keep frames on the GPU if we know how to read them back once they are downloaded.
+        if (*format == hardware_format && frame_layout_for_format(codec_context->sw_pix_fmt).has_value())
+            return *format;
+    }
+    for (auto const* format = formats; *format >= 0; format++) {
+        if (*format != hardware_format && frame_layout_for_format(*format).has_value())
+            return *format;
     }
     return AV_PIX_FMT_NONE;
 }
 
-DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create(CodecID codec_id, ReadonlyBytes codec_initialization_data)
+static AVBufferRef* create_hardware_device(AVCodec const* codec)
 {
-    AVCodecContext* codec_context = nullptr;
-    AVPacket* packet = nullptr;
-    AVFrame* frame = nullptr;
-    ArmedScopeGuard memory_guard {
-        [&] {
-            avcodec_free_context(&codec_context);
-            av_packet_free(&packet);
-            av_frame_free(&frame);
-        }
-    };
+    for (auto device_type : preferred_hardware_device_types) {
+        if (device_type == AV_HWDEVICE_TYPE_NONE)
+            break;
+        if (hardware_format_for_device(codec, device_type) == AV_PIX_FMT_NONE)
+            continue;
 
+        AVBufferRef* device = nullptr;
+        if (av_hwdevice_ctx_create(&device, device_type, nullptr, nullptr, 0) == 0)
+            return device;
+    }
+    return nullptr;
+}
+
+static DecoderErrorOr<AVCodecContext*> open_codec_context(CodecID codec_id, ReadonlyBytes codec_initialization_data, bool use_hardware_acceleration)
+{
     auto ff_codec_id = ffmpeg_codec_id_from_media_codec_id(codec_id);
     auto const* codec = avcodec_find_decoder(ff_codec_id);
     if (!codec)
         return DecoderError::format(DecoderErrorCategory::NotImplemented, "Could not find FFmpeg decoder for codec {}", codec_id);
 
-    codec_context = avcodec_alloc_context3(codec);
+    AVCodecContext* codec_context = avcodec_alloc_context3(codec);
     if (!codec_context)
         return DecoderError::format(DecoderErrorCategory::Memory, "Failed to allocate FFmpeg codec context for codec {}", codec_id);
+    ArmedScopeGuard codec_context_guard { [&] { avcodec_free_context(&codec_context); } };
 
     codec_context->get_format = negotiate_output_format;
     codec_context->time_base = { 1, 1'000'000 };
     codec_context->thread_count = static_cast<int>(min(Core::System::hardware_concurrency(), 4));
 
+    if (use_hardware_acceleration) {
+        // The codec context takes ownership of the device reference.
+        codec_context->hw_device_ctx = create_hardware_device(codec);
+        if (codec_context->hw_device_ctx)
+            codec_context->extra_hw_frames = extra_hardware_frames;
+    }
+
     if (!codec_initialization_data.is_empty()) {
         if (codec_initialization_data.size() > NumericLimits<int>::max())
             return DecoderError::corrupted("Codec initialization data is too large"sv);
 
-        codec_context->extradata = static_cast<u8*>(av_malloc(codec_initialization_data.size() + AV_INPUT_BUFFER_PADDING_SIZE));
+        codec_context->extradata = static_cast<u8*>(av_mallocz(codec_initialization_data.size() + AV_INPUT_BUFFER_PADDING_SIZE));
         if (!codec_context->extradata)
             return DecoderError::with_description(DecoderErrorCategory::Memory, "Failed to allocate codec initialization data buffer for FFmpeg codec"sv);
 
@@ -77,8 +160,156 @@ DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create
         codec_context->extradata_size = static_cast<int>(codec_initialization_data.size());
     }
 
-    if (avcodec_open2(codec_context, codec, nullptr) < 0)
+    if (avcodec_open2(codec_context, codec, nullptr) < 0) {
+        if (codec_context->hw_device_ctx) {
+            avcodec_free_context(&codec_context);
+            codec_context_guard.disarm();
+            return open_codec_context(codec_id, codec_initialization_data, false);
+        }
         return DecoderError::format(DecoderErrorCategory::Unknown, "Unknown error occurred when opening FFmpeg codec {}", codec_id);
+    }
+
+    codec_context_guard.disarm();
+    return codec_context;
+}
+
+static DecoderErrorOr<NonnullOwnPtr<Gfx::YUVData>> copy_frame_to_yuv_data(AVFrame const& frame, FrameLayout const& layout, CodingIndependentCodePoints const& cicp)
+{
+    auto size = Gfx::Size<u32> { frame.width, frame.height };
+    auto gfx_size = Gfx::IntSize { frame.width, frame.height };
+
+    auto yuv_data = DECODER_TRY_ALLOC(Gfx::YUVData::create(gfx_size, layout.bit_depth, layout.subsampling, cicp));
+
+    auto y_plane_size = size.to_type<size_t>();
+    auto uv_plane_size = layout.subsampling.subsampled_size(size).to_type<size_t>();
+
+    auto component_size = layout.bit_depth <= 8 ? 1 : 2;
+    auto source_plane_count = layout.chroma_is_interleaved ? 2 : 3;
+
+    for (int plane = 0; plane < source_plane_count; plane++) {
+        VERIFY(frame.linesize[plane] != 0);
+        if (frame.linesize[plane] < 0)
+            return DecoderError::with_description(DecoderErrorCategory::NotImplemented, "Reversed scanlines are not supported"sv);
+        VERIFY(frame.data[plane] != nullptr);
+    }
+
+    auto copy_plane = [&](u8 const* source, int source_stride, Bytes destination, Gfx::Size<size_t> plane_size) {
+        auto output_line_size = plane_size.width() * component_size;
+        VERIFY(output_line_size <= static_cast<size_t>(source_stride));
+
+        auto* dest_ptr = destination.data();
+        for (size_t row = 0; row < plane_size.height(); row++) {
+            if (layout.sample_shift == 0) {
+                memcpy(dest_ptr, source, output_line_size);
+            } else {
+                for (size_t column = 0; column < plane_size.width(); column++) {
+                    u16 sample;
+                    memcpy(&sample, source + (column * 2), 2);
+                    sample >>= layout.sample_shift;
+                    memcpy(dest_ptr + (column * 2), &sample, 2);
+                }
+            }
+            source += source_stride;
+            dest_ptr += output_line_size;
+        }
+    };
+
+    copy_plane(frame.data[0], frame.linesize[0], yuv_data->y_data(), y_plane_size);
+
+    if (!layout.chroma_is_interleaved) {
+        copy_plane(frame.data[1], frame.linesize[1], yuv_data->u_data(), uv_plane_size);
+        copy_plane(frame.data[2], frame.linesize[2], yuv_data->v_data(), uv_plane_size);
+        return yuv_data;
+    }
+
+    VERIFY(uv_plane_size.width() * component_size * 2 <= static_cast<size_t>(frame.linesize[1]));
+    auto const* source = frame.data[1];
+    auto* u_ptr = yuv_data->u_data().data();
+    auto* v_ptr = yuv_data->v_data().data();
+    for (size_t row = 0; row < uv_plane_size.height(); row++) {
+        for (size_t column = 0; column < uv_plane_size.width(); column++) {
+            if (component_size == 1) {
+                u_ptr[column] = source[column * 2];
+                v_ptr[column] = source[(column * 2) + 1];
+                continue;
+            }
+            u16 samples[2];
+            memcpy(samples, source + (column * 4), 4);
+            samples[0] >>= layout.sample_shift;
+            samples[1] >>= layout.sample_shift;
+            memcpy(u_ptr + (column * 2), &samples[0], 2);
+            memcpy(v_ptr + (column * 2), &samples[1], 2);
+        }
+        source += frame.linesize[1];
+        u_ptr += uv_plane_size.width() * component_size;
+        v_ptr += uv_plane_size.width() * component_size;
+    }
+    return yuv_data;
+}
+
+class FFmpegGPUVideoFrameData final : public GPUVideoFrameData {
+public:
+    FFmpegGPUVideoFrameData(AVFrame* frame, CodingIndependentCodePoints cicp)
+        : m_frame(frame)
+        , m_cicp(cicp)
+    {
+    }
+
+    virtual ~FFmpegGPUVideoFrameData() override
+    {
+        av_frame_free(&m_frame);
+    }
+
+    virtual StringView device_type_name() const override
+    {
+        auto const* frames_context = reinterpret_cast<AVHWFramesContext const*>(m_frame->hw_frames_ctx->data);
+        auto const* name = av_hwdevice_get_type_name(frames_context->device_ctx->type);
+        return name ? StringView { name, strlen(name) } : "unknown"sv;
+    }
+
+    virtual ErrorOr<NonnullOwnPtr<Gfx::YUVData>> download() const override
+    {
+        auto* software_frame = av_frame_alloc();
+        if (!software_frame)
+            return Error::from_errno(ENOMEM);
+        ScopeGuard software_frame_guard { [&] { av_frame_free(&software_frame); } };
+
+        if (av_hwframe_transfer_data(software_frame, m_frame, 0) < 0)
+            return Error::from_string_literal("Failed to download video frame from the GPU");
+        software_frame->width = m_frame->width;
+        software_frame->height = m_frame->height;
+
+        auto layout = frame_layout_for_format(software_frame->format);
+        if (!layout.has_value())
+            return Error::from_string_literal("Downloaded video frame has an unsupported pixel format");
+
+        auto yuv_data_or_error = copy_frame_to_yuv_data(*software_frame, *layout, m_cicp);
+        if (yuv_data_or_error.is_error())
+            return Error::from_string_literal("Failed to copy downloaded video frame");
+        return yuv_data_or_error.release_value();
+    }
+
+private:
+    AVFrame* m_frame;
+    CodingIndependentCodePoints m_cicp;
+};
+
+DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create(CodecID codec_id, ReadonlyBytes codec_initialization_data)
+{
+    AVCodecContext* codec_context = nullptr;
+    AVPacket* packet = nullptr;
+    AVFrame* frame = nullptr;
+    ArmedScopeGuard memory_guard {
+        [&] {
+            avcodec_free_context(&codec_context);
+            av_packet_free(&packet);
+            av_frame_free(&frame);
+        }
+    };
+
+    auto initialization_data_copy = DECODER_TRY_ALLOC(ByteBuffer::copy(codec_initialization_data));
+
+    codec_context = TRY(open_codec_context(codec_id, codec_initialization_data, true));
 
     packet = av_packet_alloc();
     if (!packet)
@@ -89,11 +320,13 @@ DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create
         return DecoderError::with_description(DecoderErrorCategory::Memory, "Failed to allocate FFmpeg frame"sv);
 
     memory_guard.disarm();
-    return DECODER_TRY_ALLOC(try_make<FFmpegVideoDecoder>(codec_context, packet, frame));
+    return DECODER_TRY_ALLOC(try_make<FFmpegVideoDecoder>(codec_id, move(initialization_data_copy), codec_context, packet, frame));
 }
 
-FFmpegVideoDecoder::FFmpegVideoDecoder(AVCodecContext* codec_context, AVPacket* packet, AVFrame* frame)
-    : m_codec_context(codec_context)
+FFmpegVideoDecoder::FFmpegVideoDecoder(CodecID codec_id, ByteBuffer codec_initialization_data, AVCodecContext* codec_context, AVPacket* packet, AVFrame* frame)
+    : m_codec_id(codec_id)
+    , m_codec_initialization_data(move(codec_initialization_data))
+    , m_codec_context(codec_context)
     , m_packet(packet)
     , m_frame(frame)
 {
@@ -106,6 +339,23 @@ FFmpegVideoDecoder::~FFmpegVideoDecoder()
     avcodec_free_context(&m_codec_context);
 }
 
+bool FFmpegVideoDecoder::is_hardware_accelerated() const
+{
+    return m_codec_context->hw_device_ctx != nullptr;
+}
+
+DecoderErrorOr<void> FFmpegVideoDecoder::fall_back_to_software_decoding()
+{
+    VERIFY(is_hardware_accelerated());
+    dbgln("FFmpegVideoDecoder: Hardware decoding failed, falling back to software decoding");
+
+    auto* codec_context = TRY(open_codec_context(m_codec_id, m_codec_initialization_data, false));
+    avcodec_free_context(&m_codec_context);
+    m_codec_context = codec_context;
+    m_frame_durations.clear();
+    return {};
+}
+
 DecoderErrorOr<void> FFmpegVideoDecoder::receive_coded_data(AK::Duration timestamp, AK::Duration duration, ReadonlyBytes coded_data, Optional<AK::Duration> decode_timestamp)
 {
     VERIFY(coded_data.size() < NumericLimits<int>::max());
@@ -118,6 +368,11 @@ DecoderErrorOr<void> FFmpegVideoDecoder::receive_coded_data(AK::Duration timesta
     auto packet_pts = m_packet->pts;
 
     auto result = avcodec_send_packet(m_codec_context, m_packet);
+    if (result < 0 && result != AVERROR(EAGAIN) && result != AVERROR_EOF && is_hardware_accelerated()) {
+        TRY(fall_back_to_software_decoding());
+        result = avcodec_send_packet(m_codec_context, m_packet);
+    }
+
     switch (result) {
     case 0:
         // Some FFmpeg decoders do not propagate packet duration to decoded frames, so
@@ -171,53 +426,6 @@ DecoderErrorOr<NonnullRefPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
         auto cicp = CodingIndependentCodePoints { color_primaries, transfer_characteristics, matrix_coefficients, color_range };
         cicp.adopt_specified_values(container_cicp);
 
-        size_t bit_depth = [&] {
-            switch (m_frame->format) {
-            case AV_PIX_FMT_YUV420P:
-            case AV_PIX_FMT_YUV422P:
-            case AV_PIX_FMT_YUV444P:
-            case AV_PIX_FMT_YUVJ420P:
-            case AV_PIX_FMT_YUVJ422P:
-            case AV_PIX_FMT_YUVJ444P:
-                return 8;
-            case AV_PIX_FMT_YUV420P10:
-            case AV_PIX_FMT_YUV422P10:
-            case AV_PIX_FMT_YUV444P10:
-                return 10;
-            case AV_PIX_FMT_YUV420P12:
-            case AV_PIX_FMT_YUV422P12:
-            case AV_PIX_FMT_YUV444P12:
-                return 12;
-            default:
-                VERIFY_NOT_REACHED();
-            }
-        }();
-
-        auto subsampling = [&]() -> Subsampling {
-            switch (m_frame->format) {
-            case AV_PIX_FMT_YUV420P:
-            case AV_PIX_FMT_YUV420P10:
-            case AV_PIX_FMT_YUV420P12:
-            case AV_PIX_FMT_YUVJ420P:
-                return { true, true };
-            case AV_PIX_FMT_YUV422P:
-            case AV_PIX_FMT_YUV422P10:
-            case AV_PIX_FMT_YUV422P12:
-            case AV_PIX_FMT_YUVJ422P:
-                return { true, false };
-            case AV_PIX_FMT_YUV444P:
-            case AV_PIX_FMT_YUV444P10:
-            case AV_PIX_FMT_YUV444P12:
-            case AV_PIX_FMT_YUVJ444P:
-                return { false, false };
-            default:
-                VERIFY_NOT_REACHED();
-            }
-        }();
-
-        auto size = Gfx::Size<u32> { m_frame->width, m_frame->height };
-        auto gfx_size = Gfx::IntSize { m_frame->width, m_frame->height };
-
         auto timestamp = AK::Duration::from_microseconds(m_frame->pts);
         auto duration = AK::Duration::from_microseconds(m_frame->duration);
         if (duration.is_zero()) {
@@ -227,40 +435,28 @@ DecoderErrorOr<NonnullRefPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
             m_frame_durations.remove(m_frame->pts);
         }
 
-        auto yuv_data = DECODER_TRY_ALLOC(Gfx::YUVData::create(gfx_size, bit_depth, subsampling, cicp));
-
-        auto y_plane_size = size.to_type<size_t>();
-        auto uv_plane_size = subsampling.subsampled_size(size).to_type<size_t>();
-
-        Bytes buffers[] = { yuv_data->y_data(), yuv_data->u_data(), yuv_data->v_data() };
-        Gfx::Size<size_t> plane_sizes[] = { y_plane_size, uv_plane_size, uv_plane_size };
-
-        auto component_size = bit_depth <= 8 ? 1 : 2;
-
-        for (u32 plane = 0; plane < 3; plane++) {
-            VERIFY(m_frame->linesize[plane] != 0);
-            if (m_frame->linesize[plane] < 0)
-                return DecoderError::with_description(DecoderErrorCategory::NotImplemented, "Reversed scanlines are not supported"sv);
-
-            auto plane_size = plane_sizes[plane];
-            auto const* source = m_frame->data[plane];
-            VERIFY(source != nullptr);
-            auto destination = buffers[plane];
-
-            auto output_line_size = plane_size.width() * component_size;
-            VERIFY(output_line_size <= static_cast<size_t>(m_frame->linesize[plane]));
+        auto size = Gfx::Size<u32> { m_frame->width, m_frame->height };
+        auto color_space = DECODER_TRY_ALLOC(Gfx::ColorSpace::from_cicp(cicp));
 
-            auto* dest_ptr = destination.data();
-            for (size_t row = 0; row < plane_size.height(); row++) {
-                memcpy(dest_ptr, source, output_line_size);
-                source += m_frame->linesize[plane];
-                dest_ptr += output_line_size;
-            }
+        if (m_frame->hw_frames_ctx) {
+            // Leave the frame on the GPU until something needs its pixels.
+            auto software_format = reinterpret_cast<AVHWFramesContext const*>(m_frame->hw_frames_ctx->data)->sw_format;
+            auto layout = frame_layout_for_format(software_format);
+            if (!layout.has_value())
+                return DecoderError::with_description(DecoderErrorCategory::NotImplemented, "Hardware frame has an unsupported pixel format"sv);
+
+            auto* gpu_frame = av_frame_clone(m_frame);
+            if (!gpu_frame)
+                return DecoderError::with_description(DecoderErrorCategory::Memory, "Failed to reference FFmpeg hardware frame"sv);
+            auto gpu_data = DECODER_TRY_ALLOC(adopt_nonnull_own_or_enomem(new (nothrow) FFmpegGPUVideoFrameData(gpu_frame, cicp)));
+            return DECODER_TRY_ALLOC(try_make_ref_counted<VideoFrame>(timestamp, duration, size, layout->bit_depth, move(color_space), move(gpu_data)));
         }
 
-        auto color_space = DECODER_TRY_ALLOC(Gfx::ColorSpace::from_cicp(cicp));
+        auto layout = frame_layout_for_format(m_frame->format);
+        VERIFY(layout.has_value());
+        auto yuv_data = TRY(copy_frame_to_yuv_data(*m_frame, *layout, cicp));
 
-        return DECODER_TRY_ALLOC(try_make_ref_counted<VideoFrame>(timestamp, duration, size, bit_depth, move(color_space), move(yuv_data)));
+        return DECODER_TRY_ALLOC(try_make_ref_counted<VideoFrame>(timestamp, duration, size, layout->bit_depth, move(color_space), move(yuv_data)));
     }
     case AVERROR(EAGAIN):
         return DecoderError::with_description(DecoderErrorCategory::NeedsMoreInput, "FFmpeg decoder has no frames available, send more input"sv);
@@ -269,6 +465,12 @@ DecoderErrorOr<NonnullRefPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
     case AVERROR(EINVAL):
         return DecoderError::with_description(DecoderErrorCategory::Invalid, "FFmpeg codec has not been opened"sv);
     default:
+        if (is_hardware_accelerated()) {
+            // NB: Any frames still inside the hardware decoder are lost, so the output may be corrupted until the next
+            //     keyframe, but that beats stopping playback altogether.
+            TRY(fall_back_to_software_decoding());
+            return DecoderError::with_description(DecoderErrorCategory::NeedsMoreInput, "FFmpeg decoder fell back to software decoding, send more input"sv);
+        }
         return DecoderError::format(DecoderErrorCategory::Unknown, "FFmpeg codec encountered an unexpected error retrieving frames with code {:x}", result);
     }
 }
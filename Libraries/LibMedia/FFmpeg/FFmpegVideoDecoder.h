@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
 #include <AK/HashMap.h>
 #include <LibMedia/CodecID.h>
 #include <LibMedia/Export.h>
@@ -18,7 +19,7 @@ namespace Media::FFmpeg {
 class MEDIA_API FFmpegVideoDecoder final : public VideoDecoder {
 public:
     static DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> try_create(CodecID, ReadonlyBytes codec_initialization_data);
-    FFmpegVideoDecoder(AVCodecContext* codec_context, AVPacket* packet, AVFrame* frame);
+    FFmpegVideoDecoder(CodecID, ByteBuffer codec_initialization_data, AVCodecContext* codec_context, AVPacket* packet, AVFrame* frame);
     virtual ~FFmpegVideoDecoder() override;
 
     virtual DecoderErrorOr<void> receive_coded_data(AK::Duration timestamp, AK::Duration duration, ReadonlyBytes coded_data, Optional<AK::Duration> decode_timestamp = {}) override;
@@ -27,7 +28,13 @@ public:
 
     virtual void flush() override;
 
+    bool is_hardware_accelerated() const;
+
 private:
+    DecoderErrorOr<void> fall_back_to_software_decoding();
+
+    CodecID m_codec_id;
+    ByteBuffer m_codec_initialization_data;
     AVCodecContext* m_codec_context;
     AVPacket* m_packet;
     AVFrame* m_frame;
@@ -5,6 +5,8 @@
  */
 
 #include <LibCore/EventLoop.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/YUVData.h>
 #include <LibMedia/Demuxer.h>
 #include <LibMedia/MediaTimeProvider.h>
 #include <LibMedia/PipelineStatus.h>
@@ -196,4 +198,39 @@ RefPtr<VideoFrame> DisplayingVideoSink::current_frame()
     return m_current_frame;
 }
 
+ErrorOr<NonnullRefPtr<Gfx::Bitmap>> DisplayingVideoSink::take_pooled_bitmap(Gfx::IntSize size)
+{
+    m_bitmap_pool.remove_all_matching([&](auto const& bitmap) { return bitmap->size() != size; });
+
+    // A bitmap referenced only by the pool is no longer visible to anyone, so it can be overwritten.
+    for (auto const& bitmap : m_bitmap_pool) {
+        if (bitmap->ref_count() == 1)
+            return bitmap;
+    }
+
+    auto bitmap = TRY(Gfx::Bitmap::create(Gfx::BitmapFormat::RGBA8888, Gfx::AlphaType::Premultiplied, size));
+    if (m_bitmap_pool.size() < MAX_POOLED_BITMAPS)
+        m_bitmap_pool.append(bitmap);
+    return bitmap;
+}
+
+ErrorOr<NonnullRefPtr<Gfx::Bitmap>> DisplayingVideoSink::current_frame_bitmap()
+{
+    if (m_current_frame == nullptr)
+        return Error::from_string_literal("No video frame is being displayed");
+    if (m_converted_frame == m_current_frame)
+        return *m_converted_bitmap;
+
+    m_converted_frame = nullptr;
+    m_converted_bitmap = nullptr;
+
+    auto const& yuv_data = *TRY(m_current_frame->yuv_data());
+    auto bitmap = TRY(take_pooled_bitmap(yuv_data.size()));
+    TRY(yuv_data.convert_to_bitmap(*bitmap));
+
+    m_converted_frame = m_current_frame;
+    m_converted_bitmap = bitmap;
+    return bitmap;
+}
+
 }
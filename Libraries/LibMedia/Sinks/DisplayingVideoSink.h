@@ -10,6 +10,8 @@
 #include <AK/NonnullRefPtr.h>
 #include <AK/RefPtr.h>
 #include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibGfx/Forward.h>
 #include <LibMedia/Export.h>
 #include <LibMedia/Forward.h>
 #include <LibMedia/PipelineStatus.h>
@@ -39,7 +41,15 @@ public:
     [[nodiscard]] DisplayingVideoSinkUpdateResult update();
     RefPtr<VideoFrame> current_frame();
 
+    // Converts the current frame to RGBA on the CPU. Bitmaps from earlier frames are reused once nothing else holds
+    // them, so this doesn't allocate during steady-state playback.
+    ErrorOr<NonnullRefPtr<Gfx::Bitmap>> current_frame_bitmap();
+
 private:
+    static constexpr size_t MAX_POOLED_BITMAPS = 3;
+
+    ErrorOr<NonnullRefPtr<Gfx::Bitmap>> take_pooled_bitmap(Gfx::IntSize);
+
     void consume_moved_position_signals(PipelineStatus&);
 
     void dispatch_state_if_changed(PipelineStatus);
@@ -51,6 +61,10 @@ private:
     RefPtr<VideoFrame> m_current_frame;
     bool m_cached_frames_are_discontinuous { false };
 
+    RefPtr<VideoFrame> m_converted_frame;
+    RefPtr<Gfx::Bitmap> m_converted_bitmap;
+    Vector<NonnullRefPtr<Gfx::Bitmap>, MAX_POOLED_BITMAPS> m_bitmap_pool;
+
     enum class SeekStatus : u8 {
         None,
         InProgress,
@@ -31,8 +31,42 @@ VideoFrame::VideoFrame(
 {
 }
 
+VideoFrame::VideoFrame(
+    AK::Duration timestamp,
+    AK::Duration duration,
+    Gfx::Size<u32> size,
+    u8 bit_depth,
+    Gfx::ColorSpace color_space,
+    NonnullOwnPtr<GPUVideoFrameData> gpu_data)
+    : m_timestamp(timestamp)
+    , m_duration(duration)
+    , m_size(size)
+    , m_bit_depth(bit_depth)
+    , m_color_space(move(color_space))
+    , m_gpu_data(move(gpu_data))
+{
+}
+
 VideoFrame::~VideoFrame() = default;
 
+bool VideoFrame::is_gpu_resident() const
+{
+    Sync::MutexLocker locker { m_data_mutex };
+    return !m_yuv_data;
+}
+
+ErrorOr<Gfx::YUVData const*> VideoFrame::yuv_data() const
+{
+    Sync::MutexLocker locker { m_data_mutex };
+    if (!m_yuv_data) {
+        VERIFY(m_gpu_data);
+        m_yuv_data = TRY(m_gpu_data->download());
+        // NB: Hardware decoders draw from a fixed pool of surfaces, so give this one back as soon as possible.
+        m_gpu_data = nullptr;
+    }
+    return m_yuv_data.ptr();
+}
+
 }
 
 namespace IPC {
@@ -61,24 +95,12 @@ static bool video_full_range_flag_ipc_value_valid(Media::VideoFullRangeFlag vide
         || Media::video_full_range_flag_valid(video_full_range_flag);
 }
 
-static ErrorOr<Core::AnonymousBuffer> encode_yuv_data(Gfx::YUVData const& yuv_data)
-{
-    auto sizes = TRY(Gfx::YUVData::plane_sizes(yuv_data.size(), yuv_data.bit_depth(), yuv_data.subsampling()));
-    auto buffer = TRY(Core::AnonymousBuffer::create_with_size(sizes.total));
-
-    auto bytes = Bytes { buffer.data<u8>(), buffer.size() };
-    yuv_data.y_data().copy_to(bytes.slice(0, sizes.y));
-    yuv_data.u_data().copy_to(bytes.slice(sizes.y, sizes.u));
-    yuv_data.v_data().copy_to(bytes.slice(sizes.y + sizes.u, sizes.v));
-    return buffer;
-}
-
 template<>
 ErrorOr<void> encode(Encoder& encoder, Media::VideoFrame const& frame)
 {
-    auto const& yuv_data = frame.yuv_data();
-    auto yuv_data_buffer = TRY(encode_yuv_data(yuv_data));
-    TRY(encoder.encode(yuv_data_buffer));
+    auto const& yuv_data = *TRY(frame.yuv_data());
+    // NB: The planes already live in shared memory, so only the buffer's file descriptor is sent.
+    TRY(encoder.encode(yuv_data.shared_buffer()));
     TRY(encoder.encode(frame.color_space()));
     TRY(encoder.encode(frame.timestamp()));
     TRY(encoder.encode(frame.duration()));
@@ -132,12 +154,7 @@ ErrorOr<NonnullRefPtr<Media::VideoFrame const>> decode(Decoder& decoder)
     if (yuv_data_buffer.size() != sizes.total)
         return Error::from_string_literal("IPC: VideoFrame contained invalid YUV data size");
 
-    auto bytes = yuv_data_buffer.bytes();
-    auto y_data = bytes.slice(0, sizes.y);
-    auto u_data = bytes.slice(sizes.y, sizes.u);
-    auto v_data = bytes.slice(sizes.y + sizes.u, sizes.v);
-
-    auto yuv_data = TRY(Gfx::YUVData::create_from_data(size, bit_depth, subsampling, cicp, y_data, u_data, v_data));
+    auto yuv_data = TRY(Gfx::YUVData::create_from_shared_buffer(size, bit_depth, subsampling, cicp, move(yuv_data_buffer)));
     auto frame = TRY(try_make_ref_counted<Media::VideoFrame>(timestamp, duration, size.to_type<u32>(), bit_depth, move(color_space), move(yuv_data)));
     return NonnullRefPtr<Media::VideoFrame const> { *frame };
 }
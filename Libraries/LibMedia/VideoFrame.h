@@ -10,15 +10,29 @@
 #include <AK/Error.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/NonnullRefPtr.h>
+#include <AK/OwnPtr.h>
 #include <AK/Time.h>
 #include <LibGfx/ColorSpace.h>
 #include <LibGfx/Forward.h>
 #include <LibGfx/Size.h>
 #include <LibIPC/Forward.h>
 #include <LibMedia/Export.h>
+#include <LibSync/Mutex.h>
 
 namespace Media {
 
+// The pixels of a frame that a hardware decoder left in GPU memory, such as a VAAPI surface.
+class MEDIA_API GPUVideoFrameData {
+public:
+    virtual ~GPUVideoFrameData() = default;
+
+    // The kind of hardware device that holds the frame, e.g. "vaapi".
+    virtual StringView device_type_name() const = 0;
+
+    // Copies the frame into system memory.
+    virtual ErrorOr<NonnullOwnPtr<Gfx::YUVData>> download() const = 0;
+};
+
 class MEDIA_API VideoFrame final : public AtomicRefCounted<VideoFrame> {
 
 public:
@@ -29,6 +43,13 @@ public:
         u8 bit_depth,
         Gfx::ColorSpace color_space,
         NonnullOwnPtr<Gfx::YUVData> yuv_data);
+    VideoFrame(
+        AK::Duration timestamp,
+        AK::Duration duration,
+        Gfx::Size<u32> size,
+        u8 bit_depth,
+        Gfx::ColorSpace color_space,
+        NonnullOwnPtr<GPUVideoFrameData> gpu_data);
     ~VideoFrame();
 
     AK::Duration timestamp() const { return m_timestamp; }
@@ -41,7 +62,12 @@ public:
     u8 bit_depth() const { return m_bit_depth; }
 
     Gfx::ColorSpace const& color_space() const { return m_color_space; }
-    Gfx::YUVData const& yuv_data() const { return *m_yuv_data; }
+    // Whether the pixels are still only in GPU memory.
+    bool is_gpu_resident() const;
+
+    // The pixels in system memory. GPU-resident frames are downloaded the first time this is called, which releases
+    // their GPU memory.
+    ErrorOr<Gfx::YUVData const*> yuv_data() const;
 
 private:
     AK::Duration m_timestamp;
@@ -49,7 +75,10 @@ private:
     Gfx::Size<u32> m_size;
     u8 m_bit_depth;
     Gfx::ColorSpace m_color_space;
-    NonnullOwnPtr<Gfx::YUVData> m_yuv_data;
+
+    mutable Sync::Mutex m_data_mutex;
+    mutable OwnPtr<Gfx::YUVData> m_yuv_data;
+    mutable OwnPtr<GPUVideoFrameData> m_gpu_data;
 };
 
 }
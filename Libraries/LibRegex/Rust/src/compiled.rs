@@ -0,0 +1,627 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+//! Second execution tier for hot regex programs.
+//!
+//! Once a program has run often enough, its bytecode is lowered into a
+//! pre-decoded form that the VM hands each match attempt to:
+//! - Single code unit matchers carry a precomputed ASCII membership bitmap.
+//! - Runs of case-sensitive characters become one literal comparison.
+//! - Modifier flags are folded into the instructions, as they never change.
+//! - Choice points record the length of an undo log of register writes
+//!   instead of a snapshot of every register.
+//!
+//! Only non-Unicode programs without backreferences, lookarounds or modifier
+//! groups are supported; everything else keeps running on the VM.
+
+use crate::bytecode::*;
+use crate::vm::ActiveModifiers;
+use crate::vm::Input;
+use crate::vm::MATCH_LIMIT;
+use crate::vm::VmResult;
+use crate::vm::is_line_terminator;
+use crate::vm::is_word_char;
+use crate::vm::match_simple_with_modifiers;
+
+/// Number of executions after which a program is compiled.
+pub(crate) const TIER_UP_THRESHOLD: u32 = 100;
+
+/// A matcher for a single code unit.
+struct CodeUnitSet {
+    /// Membership of every ASCII code unit.
+    ascii: [u64; 2],
+    /// The original matcher, for everything outside ASCII.
+    matcher: SimpleMatch,
+}
+
+impl CodeUnitSet {
+    fn new(matcher: SimpleMatch, modifiers: &ActiveModifiers) -> Self {
+        let mut ascii = [0u64; 2];
+        for cp in 0..128u32 {
+            if match_simple_with_modifiers(&matcher, cp, modifiers) {
+                ascii[(cp >> 6) as usize] |= 1 << (cp & 63);
+            }
+        }
+        Self { ascii, matcher }
+    }
+
+    #[inline(always)]
+    fn contains(&self, code_unit: u16, modifiers: &ActiveModifiers) -> bool {
+        if code_unit < 128 {
+            return (self.ascii[(code_unit >> 6) as usize] >> (code_unit & 63)) & 1 != 0;
+        }
+        match_simple_with_modifiers(&self.matcher, code_unit as u32, modifiers)
+    }
+}
+
+enum Op {
+    CodeUnit(CodeUnitSet),
+    Literal(Box<[u16]>),
+    Jump(usize),
+    Split {
+        prefer: usize,
+        other: usize,
+    },
+    Save(usize),
+    ClearRegister(usize),
+    AssertStart {
+        multiline: bool,
+    },
+    AssertEnd {
+        multiline: bool,
+    },
+    AssertWordBoundary {
+        negated: bool,
+    },
+    Match,
+    Fail,
+    RepeatStart(usize),
+    RepeatCheck {
+        counter_reg: usize,
+        min: u32,
+        max: Option<u32>,
+        body: usize,
+        greedy: bool,
+    },
+    ProgressCheck(usize),
+    GreedyLoop {
+        set: CodeUnitSet,
+        min: u32,
+        max: Option<u32>,
+    },
+    LazyLoop {
+        set: CodeUnitSet,
+        min: u32,
+        max: Option<u32>,
+    },
+}
+
+/// A program lowered for the second tier.
+pub struct CompiledProgram {
+    ops: Vec<Op>,
+    modifiers: ActiveModifiers,
+}
+
+enum ChoicePoint {
+    /// Resume at `pc`.
+    Resume { pc: usize, pos: usize, trail_len: usize },
+    /// Resume a lazy RepeatCheck's body with its counter bumped to `count`.
+    RepeatBody {
+        pc: usize,
+        pos: usize,
+        counter_reg: usize,
+        count: i32,
+        trail_len: usize,
+    },
+    /// Give back one more code unit from the greedy loop at `pc`, which may go down to `min_pos`.
+    Greedy {
+        pc: usize,
+        min_pos: usize,
+        pos: usize,
+        trail_len: usize,
+    },
+    /// Consume one more code unit with the lazy loop at `pc`, which has consumed `count` so far.
+    Lazy {
+        pc: usize,
+        pos: usize,
+        count: u32,
+        trail_len: usize,
+    },
+}
+
+impl ChoicePoint {
+    fn trail_len(&self) -> usize {
+        match self {
+            Self::Resume { trail_len, .. }
+            | Self::RepeatBody { trail_len, .. }
+            | Self::Greedy { trail_len, .. }
+            | Self::Lazy { trail_len, .. } => *trail_len,
+        }
+    }
+}
+
+/// A register write that backtracking may have to undo.
+struct TrailEntry {
+    reg: usize,
+    previous_value: i32,
+}
+
+/// Reusable scratch space for the compiled tier, kept in the VM's scratch.
+#[derive(Default)]
+pub struct CompiledScratch {
+    choice_points: Vec<ChoicePoint>,
+    trail: Vec<TrailEntry>,
+}
+
+fn simple_match_for(instruction: &Instruction) -> Option<SimpleMatch> {
+    Some(match instruction {
+        Instruction::Char(c) if *c <= 0xFFFF => SimpleMatch::Char(*c),
+        Instruction::CharNoCase(lo, hi) => SimpleMatch::CharNoCase(*lo, *hi),
+        Instruction::AnyChar { dot_all } => SimpleMatch::AnyChar { dot_all: *dot_all },
+        Instruction::CharClass { ranges, negated } => SimpleMatch::CharClass {
+            ranges: ranges.clone(),
+            negated: *negated,
+        },
+        Instruction::BuiltinClass(class) => SimpleMatch::BuiltinClass(*class),
+        Instruction::UnicodeProperty(data) => SimpleMatch::UnicodeProperty(data.clone()),
+        _ => return None,
+    })
+}
+
+fn literal_code_unit(instruction: &Instruction, modifiers: &ActiveModifiers) -> Option<u16> {
+    match instruction {
+        Instruction::Char(c) if *c <= 0xFFFF && !modifiers.ignore_case => Some(*c as u16),
+        _ => None,
+    }
+}
+
+impl CompiledProgram {
+    /// Lower `program`, or return None if it uses anything the tier doesn't support.
+    pub(crate) fn compile(program: &Program) -> Option<Self> {
+        if program.unicode || program.unicode_sets {
+            return None;
+        }
+        let instructions = &program.instructions;
+        let register_count = program.register_count as usize;
+        let modifiers = ActiveModifiers::for_program(program);
+
+        // Instructions that are jumped to can't be merged into the literal before them.
+        let mut is_target = vec![false; instructions.len() + 1];
+        let mut mark_target = |target: u32| {
+            if let Some(entry) = is_target.get_mut(target as usize) {
+                *entry = true;
+            }
+        };
+        for (pc, instruction) in instructions.iter().enumerate() {
+            match instruction {
+                Instruction::Jump(target) => mark_target(*target),
+                Instruction::Split { prefer, other } => {
+                    mark_target(*prefer);
+                    mark_target(*other);
+                }
+                Instruction::RepeatCheck { body, .. } => {
+                    mark_target(*body);
+                    mark_target(pc as u32 + 1);
+                }
+                Instruction::GreedyLoop { .. } | Instruction::LazyLoop { .. } => mark_target(pc as u32 + 1),
+                _ => {}
+            }
+        }
+
+        // First assign every instruction its op index, then lower them with the targets remapped.
+        let mut op_index = vec![0usize; instructions.len() + 1];
+        let mut op_count = 0;
+        let mut pc = 0;
+        while pc < instructions.len() {
+            op_index[pc] = op_count;
+            let mut next = pc + 1;
+            if literal_code_unit(&instructions[pc], &modifiers).is_some() {
+                while next < instructions.len()
+                    && !is_target[next]
+                    && literal_code_unit(&instructions[next], &modifiers).is_some()
+                {
+                    op_index[next] = op_count;
+                    next += 1;
+                }
+            }
+            op_count += 1;
+            pc = next;
+        }
+        op_index[instructions.len()] = op_count;
+
+        let remap = |target: u32| op_index.get(target as usize).copied().unwrap_or(op_count);
+        let register = |reg: u32| ((reg as usize) < register_count).then_some(reg as usize);
+
+        let mut ops = Vec::with_capacity(op_count);
+        let mut pc = 0;
+        while pc < instructions.len() {
+            let instruction = &instructions[pc];
+            let mut next = pc + 1;
+            let op = match instruction {
+                _ if literal_code_unit(instruction, &modifiers).is_some() => {
+                    let mut units = Vec::new();
+                    while next <= instructions.len() && op_index.get(next) == Some(&op_index[pc]) {
+                        next += 1;
+                    }
+                    for instruction in &instructions[pc..next] {
+                        units.push(literal_code_unit(instruction, &modifiers)?);
+                    }
+                    if units.len() == 1 {
+                        Op::CodeUnit(CodeUnitSet::new(SimpleMatch::Char(units[0] as u32), &modifiers))
+                    } else {
+                        Op::Literal(units.into_boxed_slice())
+                    }
+                }
+                Instruction::Jump(t) => Op::Jump(remap(*t)),
+                Instruction::Split { prefer, other } => Op::Split {
+                    prefer: remap(*prefer),
+                    other: remap(*other),
+                },
+                Instruction::Save(reg) => Op::Save(register(*reg)?),
+                Instruction::ClearRegister(reg) => Op::ClearRegister(register(*reg)?),
+                Instruction::AssertStart { multiline } => Op::AssertStart {
+                    multiline: *multiline || modifiers.multiline,
+                },
+                Instruction::AssertEnd { multiline } => Op::AssertEnd {
+                    multiline: *multiline || modifiers.multiline,
+                },
+                Instruction::AssertWordBoundary => Op::AssertWordBoundary { negated: false },
+                Instruction::AssertNonWordBoundary => Op::AssertWordBoundary { negated: true },
+                Instruction::Match => Op::Match,
+                Instruction::Fail => Op::Fail,
+                Instruction::Nop => Op::Jump(remap(pc as u32 + 1)),
+                Instruction::RepeatStart { counter_reg } => Op::RepeatStart(register(*counter_reg)?),
+                Instruction::RepeatCheck {
+                    counter_reg,
+                    min,
+                    max,
+                    body,
+                    greedy,
+                } => Op::RepeatCheck {
+                    counter_reg: register(*counter_reg)?,
+                    min: *min,
+                    max: *max,
+                    body: remap(*body),
+                    greedy: *greedy,
+                },
+                // The VM also clears the body's captures before failing, but backtracking restores them anyway.
+                Instruction::ProgressCheck { reg, .. } => Op::ProgressCheck(register(*reg)?),
+                Instruction::GreedyLoop { matcher, min, max } => Op::GreedyLoop {
+                    set: CodeUnitSet::new(matcher.clone(), &modifiers),
+                    min: *min,
+                    max: *max,
+                },
+                Instruction::LazyLoop { matcher, min, max } => Op::LazyLoop {
+                    set: CodeUnitSet::new(matcher.clone(), &modifiers),
+                    min: *min,
+                    max: *max,
+                },
+                Instruction::Backref(_)
+                | Instruction::BackrefNamed(_)
+                | Instruction::LookStart { .. }
+                | Instruction::LookEnd
+                | Instruction::PushModifiers { .. }
+                | Instruction::PopModifiers
+                | Instruction::StringPropertyMatch { .. } => return None,
+                _ => Op::CodeUnit(CodeUnitSet::new(simple_match_for(instruction)?, &modifiers)),
+            };
+            ops.push(op);
+            pc = next;
+        }
+
+        Some(Self { ops, modifiers })
+    }
+
+    /// Attempt a match at exactly `start_pos`. `registers` must be reset to -1 by the caller.
+    pub(crate) fn run<I: Input>(
+        &self,
+        input: I,
+        start_pos: usize,
+        registers: &mut [i32],
+        scratch: &mut CompiledScratch,
+    ) -> VmResult {
+        scratch.choice_points.clear();
+        scratch.trail.clear();
+        let mut machine = Machine {
+            program: self,
+            input,
+            registers,
+            choice_points: &mut scratch.choice_points,
+            trail: &mut scratch.trail,
+        };
+        machine.run(start_pos)
+    }
+}
+
+struct Machine<'a, I: Input> {
+    program: &'a CompiledProgram,
+    input: I,
+    registers: &'a mut [i32],
+    choice_points: &'a mut Vec<ChoicePoint>,
+    trail: &'a mut Vec<TrailEntry>,
+}
+
+impl<I: Input> Machine<'_, I> {
+    fn run(&mut self, start_pos: usize) -> VmResult {
+        let ops = &self.program.ops;
+        let modifiers = &self.program.modifiers;
+        let input = self.input;
+        let input_len = input.len();
+        let mut pc = 0;
+        let mut pos = start_pos;
+        let mut steps: u64 = 0;
+
+        macro_rules! fail {
+            () => {{
+                match self.backtrack() {
+                    Some((resume_pc, resume_pos)) => {
+                        pc = resume_pc;
+                        pos = resume_pos;
+                        continue;
+                    }
+                    None => return VmResult::NoMatch,
+                }
+            }};
+        }
+
+        loop {
+            steps += 1;
+            if steps >= MATCH_LIMIT {
+                return VmResult::LimitExceeded;
+            }
+
+            let Some(op) = ops.get(pc) else {
+                fail!();
+            };
+            match op {
+                Op::CodeUnit(set) => {
+                    if pos < input_len && set.contains(input.code_unit(pos), modifiers) {
+                        pos += 1;
+                        pc += 1;
+                    } else {
+                        fail!();
+                    }
+                }
+                Op::Literal(units) => {
+                    if input.matches_u16_at(pos, units) {
+                        pos += units.len();
+                        pc += 1;
+                    } else {
+                        fail!();
+                    }
+                }
+                Op::Jump(target) => pc = *target,
+                Op::Split { prefer, other } => {
+                    self.push(ChoicePoint::Resume {
+                        pc: *other,
+                        pos,
+                        trail_len: self.trail.len(),
+                    });
+                    pc = *prefer;
+                }
+                Op::Save(reg) => {
+                    self.write(*reg, pos as i32);
+                    pc += 1;
+                }
+                Op::ClearRegister(reg) => {
+                    self.write(*reg, -1);
+                    pc += 1;
+                }
+                Op::AssertStart { multiline } => {
+                    if pos == 0 || (*multiline && is_line_terminator(input.code_unit(pos - 1) as u32)) {
+                        pc += 1;
+                    } else {
+                        fail!();
+                    }
+                }
+                Op::AssertEnd { multiline } => {
+                    if pos >= input_len || (*multiline && is_line_terminator(input.code_unit(pos) as u32)) {
+                        pc += 1;
+                    } else {
+                        fail!();
+                    }
+                }
+                Op::AssertWordBoundary { negated } => {
+                    let before = pos > 0 && is_word_char(input.code_unit(pos - 1) as u32);
+                    let after = pos < input_len && is_word_char(input.code_unit(pos) as u32);
+                    if (before != after) != *negated {
+                        pc += 1;
+                    } else {
+                        fail!();
+                    }
+                }
+                Op::Match => return VmResult::Match,
+                Op::Fail => fail!(),
+                Op::RepeatStart(counter_reg) => {
+                    self.write(*counter_reg, 0);
+                    pc += 1;
+                }
+                Op::RepeatCheck {
+                    counter_reg,
+                    min,
+                    max,
+                    body,
+                    greedy,
+                } => {
+                    let count = self.registers[*counter_reg];
+                    if (count as u32) < *min {
+                        self.write(*counter_reg, count + 1);
+                        pc = *body;
+                    } else if max.is_some_and(|max| count as u32 >= max) {
+                        pc += 1;
+                    } else if *greedy {
+                        self.push(ChoicePoint::Resume {
+                            pc: pc + 1,
+                            pos,
+                            trail_len: self.trail.len(),
+                        });
+                        self.write(*counter_reg, count + 1);
+                        pc = *body;
+                    } else {
+                        self.push(ChoicePoint::RepeatBody {
+                            pc: *body,
+                            pos,
+                            counter_reg: *counter_reg,
+                            count: count + 1,
+                            trail_len: self.trail.len(),
+                        });
+                        pc += 1;
+                    }
+                }
+                Op::ProgressCheck(reg) => {
+                    if self.registers[*reg] == pos as i32 {
+                        fail!();
+                    }
+                    self.write(*reg, pos as i32);
+                    pc += 1;
+                }
+                Op::GreedyLoop { set, min, max } => {
+                    let start = pos;
+                    let limit = max.map_or(input_len, |max| input_len.min(start.saturating_add(max as usize)));
+                    while pos < limit && set.contains(input.code_unit(pos), modifiers) {
+                        pos += 1;
+                    }
+                    let min_pos = start + *min as usize;
+                    if pos < min_pos {
+                        fail!();
+                    }
+                    if pos > min_pos {
+                        self.push(ChoicePoint::Greedy {
+                            pc,
+                            min_pos,
+                            pos,
+                            trail_len: self.trail.len(),
+                        });
+                    }
+                    pc += 1;
+                }
+                Op::LazyLoop { set, min, .. } => {
+                    let min_pos = pos + *min as usize;
+                    if min_pos > input_len {
+                        fail!();
+                    }
+                    while pos < min_pos && set.contains(input.code_unit(pos), modifiers) {
+                        pos += 1;
+                    }
+                    if pos < min_pos {
+                        fail!();
+                    }
+                    self.push(ChoicePoint::Lazy {
+                        pc,
+                        pos,
+                        count: *min,
+                        trail_len: self.trail.len(),
+                    });
+                    pc += 1;
+                }
+            }
+        }
+    }
+
+    #[inline(always)]
+    fn push(&mut self, choice_point: ChoicePoint) {
+        self.choice_points.push(choice_point);
+    }
+
+    #[inline(always)]
+    fn write(&mut self, reg: usize, value: i32) {
+        // Without choice points, nothing will ever need the old value again.
+        if !self.choice_points.is_empty() {
+            self.trail.push(TrailEntry {
+                reg,
+                previous_value: self.registers[reg],
+            });
+        }
+        self.registers[reg] = value;
+    }
+
+    fn undo_to(&mut self, trail_len: usize) {
+        while self.trail.len() > trail_len {
+            let entry = self.trail.pop().expect("trail is longer than trail_len");
+            self.registers[entry.reg] = entry.previous_value;
+        }
+    }
+
+    /// Whether the op at `pc` could possibly match at `pos`; used to skip hopeless greedy loop give-backs.
+    #[inline(always)]
+    fn could_start_at(&self, pc: usize, pos: usize) -> bool {
+        match self.program.ops.get(pc) {
+            Some(Op::CodeUnit(set)) => {
+                pos < self.input.len() && set.contains(self.input.code_unit(pos), &self.program.modifiers)
+            }
+            Some(Op::Literal(units)) => pos < self.input.len() && self.input.code_unit(pos) == units[0],
+            _ => true,
+        }
+    }
+
+    /// Pop choice points until one can be resumed, returning where to resume.
+    fn backtrack(&mut self) -> Option<(usize, usize)> {
+        loop {
+            let choice_point = self.choice_points.pop()?;
+            self.undo_to(choice_point.trail_len());
+            match choice_point {
+                ChoicePoint::Resume { pc, pos, .. } => return Some((pc, pos)),
+                ChoicePoint::RepeatBody {
+                    pc,
+                    pos,
+                    counter_reg,
+                    count,
+                    ..
+                } => {
+                    self.write(counter_reg, count);
+                    return Some((pc, pos));
+                }
+                ChoicePoint::Greedy {
+                    pc,
+                    min_pos,
+                    mut pos,
+                    trail_len,
+                } => {
+                    // Give back code units until the loop's continuation can start.
+                    loop {
+                        pos -= 1;
+                        if self.could_start_at(pc + 1, pos) {
+                            break;
+                        }
+                        if pos == min_pos {
+                            break;
+                        }
+                    }
+                    if !self.could_start_at(pc + 1, pos) {
+                        continue;
+                    }
+                    if pos > min_pos {
+                        self.push(ChoicePoint::Greedy {
+                            pc,
+                            min_pos,
+                            pos,
+                            trail_len,
+                        });
+                    }
+                    return Some((pc + 1, pos));
+                }
+                ChoicePoint::Lazy { pc, pos, count, .. } => {
+                    let Some(Op::LazyLoop { set, max, .. }) = self.program.ops.get(pc) else {
+                        unreachable!();
+                    };
+                    if max.is_some_and(|max| count >= max) {
+                        continue;
+                    }
+                    if pos >= self.input.len() || !set.contains(self.input.code_unit(pos), &self.program.modifiers) {
+                        continue;
+                    }
+                    self.push(ChoicePoint::Lazy {
+                        pc,
+                        pos: pos + 1,
+                        count: count + 1,
+                        trail_len: self.trail.len(),
+                    });
+                    return Some((pc + 1, pos + 1));
+                }
+            }
+        }
+    }
+}
@@ -45,6 +45,49 @@ pub fn compile(pattern: &Pattern) -> Program {
     compiler.program
 }
 
+/// Upper bound on the size of a program for the linear-time engine, which has to unroll every counted loop.
+const MAX_LINEAR_INSTRUCTIONS: usize = 20_000;
+
+/// Compile a pattern into a program for the linear-time engine, or `None` if the pattern needs backtracking.
+///
+/// The program only uses instructions whose behavior depends on the current instruction and position:
+/// repetition counters are unrolled into chains of splits, and patterns with backreferences, lookarounds,
+/// modifier groups or string properties are rejected.
+pub fn compile_linear(pattern: &Pattern) -> Option<Program> {
+    let mut compiler = Compiler::new(pattern);
+    compiler.linear = true;
+    compiler.compile_pattern(pattern);
+    if compiler.exceeds_linear_budget() {
+        return None;
+    }
+
+    let mut progress_registers = BTreeSet::new();
+    for inst in &compiler.program.instructions {
+        match inst {
+            Instruction::ProgressCheck { reg, .. } => {
+                progress_registers.insert(*reg);
+            }
+            Instruction::Backref(_)
+            | Instruction::BackrefNamed(_)
+            | Instruction::LookStart { .. }
+            | Instruction::LookEnd
+            | Instruction::PushModifiers { .. }
+            | Instruction::PopModifiers
+            | Instruction::StringPropertyMatch { .. }
+            | Instruction::RepeatStart { .. }
+            | Instruction::RepeatCheck { .. }
+            | Instruction::GreedyLoop { .. }
+            | Instruction::LazyLoop { .. } => return None,
+            _ => {}
+        }
+    }
+    // The engine tracks progress registers in a bitmask.
+    if progress_registers.len() > 64 {
+        return None;
+    }
+    Some(compiler.program)
+}
+
 struct Compiler {
     program: Program,
     /// Effective flags (affected by modifier groups).
@@ -55,6 +98,8 @@ struct Compiler {
     next_internal_reg: u32,
     /// True when compiling a lookbehind body (terms are reversed).
     backward: bool,
+    /// True when compiling for the linear-time engine, which can't use repetition counters.
+    linear: bool,
 }
 
 impl Compiler {
@@ -106,6 +151,7 @@ impl Compiler {
             effective_dot_all: pattern.flags.dot_all,
             next_internal_reg: register_count,
             backward: false,
+            linear: false,
         }
     }
 
@@ -340,6 +386,10 @@ impl Compiler {
         reg
     }
 
+    fn exceeds_linear_budget(&self) -> bool {
+        self.linear && self.program.instructions.len() > MAX_LINEAR_INSTRUCTIONS
+    }
+
     fn emit(&mut self, inst: Instruction) -> u32 {
         self.program.emit(inst)
     }
@@ -559,7 +609,9 @@ impl Compiler {
     /// - <https://tc39.es/ecma262/#sec-runtime-semantics-repeatmatcher-abstract-operation>
     fn compile_quantified(&mut self, atom: &Atom, q: &Quantifier) {
         // Try to use optimized GreedyLoop/LazyLoop for simple character matchers.
-        if let Some(matcher) = self.try_simple_match(atom) {
+        if !self.linear
+            && let Some(matcher) = self.try_simple_match(atom)
+        {
             match q.max {
                 Some(max) if max == q.min && q.min <= 100_000 => {
                     for _ in 0..q.min {
@@ -589,7 +641,7 @@ impl Compiler {
         // For large repetition counts, use a counted loop (RepeatStart/RepeatCheck)
         // instead of unrolling, to avoid generating millions of instructions.
         let max_for_limit = q.max.unwrap_or(q.min);
-        if max_for_limit > 100_000 {
+        if max_for_limit > 100_000 && !self.linear {
             let counter_reg = self.alloc_register();
             let progress_reg = if self.atom_can_be_zero_width(atom) {
                 Some(self.alloc_register())
@@ -624,6 +676,9 @@ impl Compiler {
         // Per ECMA-262, captures inside must be cleared at the start of each iteration.
         let can_be_zero_width = self.atom_can_be_zero_width(atom);
         for i in 0..q.min {
+            if self.exceeds_linear_budget() {
+                return;
+            }
             if i > 0 {
                 self.emit_clear_captures(atom);
             }
@@ -641,58 +696,48 @@ impl Compiler {
                 // times. The check must happen AFTER the body so it can explore non-empty
                 // alternatives through backtracking before being rejected.
                 let optional_count = max - q.min;
-                if !can_be_zero_width {
+                if !can_be_zero_width && !self.linear {
                     self.compile_counted_optional_repetitions(atom, optional_count, q.greedy);
                     return;
                 }
+                // Skipping a copy skips all of the remaining ones too, so that choosing to stop repeating is
+                // final, as in RepeatMatcher.
+                let mut skips = Vec::with_capacity(optional_count as usize);
                 for _ in 0..optional_count {
-                    let progress_reg = Some(self.alloc_register());
-                    if q.greedy {
+                    if self.exceeds_linear_budget() {
+                        return;
+                    }
+                    let progress_reg = can_be_zero_width.then(|| self.alloc_register());
+                    let split = if q.greedy {
                         // Split: prefer body, other skip.
-                        let split = self.emit(Instruction::Split {
+                        self.emit(Instruction::Split {
                             prefer: self.current_offset() + 1,
                             other: u32::MAX,
-                        });
-                        if let Some(reg) = progress_reg {
-                            self.emit(Instruction::Save(reg));
-                        }
-                        self.emit_clear_captures(atom);
-                        self.compile_atom(atom);
-                        if let Some(reg) = progress_reg {
-                            self.emit(Instruction::ProgressCheck {
-                                reg,
-                                clear_captures: Self::capture_registers(atom),
-                            });
-                        }
-                        let after = self.current_offset();
-                        self.program.instructions[split as usize] = Instruction::Split {
-                            prefer: split + 1,
-                            other: after,
-                        };
+                        })
                     } else {
                         // Lazy: prefer skip, other body.
-                        let split = self.emit(Instruction::Split {
+                        self.emit(Instruction::Split {
                             prefer: u32::MAX,
                             other: self.current_offset() + 1,
+                        })
+                    };
+                    skips.push(split);
+                    if let Some(reg) = progress_reg {
+                        self.emit(Instruction::Save(reg));
+                    }
+                    self.emit_clear_captures(atom);
+                    self.compile_atom(atom);
+                    if let Some(reg) = progress_reg {
+                        self.emit(Instruction::ProgressCheck {
+                            reg,
+                            clear_captures: Self::capture_registers(atom),
                         });
-                        if let Some(reg) = progress_reg {
-                            self.emit(Instruction::Save(reg));
-                        }
-                        self.emit_clear_captures(atom);
-                        self.compile_atom(atom);
-                        if let Some(reg) = progress_reg {
-                            self.emit(Instruction::ProgressCheck {
-                                reg,
-                                clear_captures: Self::capture_registers(atom),
-                            });
-                        }
-                        let after = self.current_offset();
-                        self.program.instructions[split as usize] = Instruction::Split {
-                            prefer: after,
-                            other: split + 1,
-                        };
                     }
                 }
+                let after = self.current_offset();
+                for split in skips {
+                    self.program.patch_jump(split, after);
+                }
             }
             None => {
                 // Unbounded: {min,} — emit a loop.
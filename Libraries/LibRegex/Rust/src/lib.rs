@@ -10,8 +10,11 @@ mod rust_allocator;
 
 pub mod ast;
 pub mod bytecode;
+pub mod compiled;
 pub mod compiler;
 pub mod ffi;
 pub mod parser;
+pub mod pikevm;
 pub mod regex;
+pub mod scan;
 pub mod vm;
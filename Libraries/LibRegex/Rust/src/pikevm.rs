@@ -0,0 +1,396 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+//! Linear-time matcher for programs built by `compiler::compile_linear`.
+//!
+//! This is a Pike VM: every path through the program advances through the
+//! input in lockstep, and at most one thread is kept per instruction and
+//! position, so a search takes O(input length × program size) time no matter
+//! how much the backtracking VM would have to backtrack. Threads are kept in
+//! the order the backtracking VM would try them, which makes the first thread
+//! to reach `Match` the same leftmost-first match the VM would find.
+//!
+//! Matching runs in two passes: the first one only tracks group 0 to find the
+//! match boundaries, and the second one runs anchored at the match start
+//! with all capture registers.
+
+use crate::bytecode::Instruction;
+use crate::bytecode::Program;
+use crate::vm::ActiveModifiers;
+use crate::vm::Input;
+use crate::vm::VmResult;
+use crate::vm::is_at_word_boundary;
+use crate::vm::is_high_surrogate;
+use crate::vm::is_line_terminator;
+use crate::vm::is_low_surrogate;
+use crate::vm::match_code_point_instruction;
+
+/// Execute the program, writing captures into `out` like `vm::execute_into_with_scratch`.
+/// If `anchored` is set, only a match starting at `start_pos` is accepted.
+pub fn execute_into<I: Input>(
+    program: &Program,
+    input: I,
+    start_pos: usize,
+    anchored: bool,
+    out: &mut [i32],
+) -> VmResult {
+    let mut vm = PikeVm::new(program, input, 2);
+    if !vm.search(start_pos, anchored, false) {
+        return VmResult::NoMatch;
+    }
+    let match_start = vm.best[0] as usize;
+    let capture_slots = (program.capture_count as usize + 1) * 2;
+    if capture_slots > 2 && out.len() > 2 {
+        let mut vm = PikeVm::new(program, input, capture_slots);
+        let found = vm.search(match_start, true, false);
+        debug_assert!(found);
+        copy_slots(&vm.best, out);
+    } else {
+        copy_slots(&vm.best, out);
+    }
+    VmResult::Match
+}
+
+/// Test whether the program matches anywhere at or after `start_pos`.
+pub fn test<I: Input>(program: &Program, input: I, start_pos: usize, anchored: bool) -> VmResult {
+    let mut vm = PikeVm::new(program, input, 2);
+    if vm.search(start_pos, anchored, true) {
+        VmResult::Match
+    } else {
+        VmResult::NoMatch
+    }
+}
+
+/// Find all non-overlapping matches like `vm::find_all_with_scratch`.
+pub fn find_all_into<I: Input>(program: &Program, input: I, start_pos: usize, result_buf: &mut [i32]) -> i32 {
+    let mut vm = PikeVm::new(program, input, 2);
+    let mut count = 0i32;
+    let mut pos = start_pos;
+    while pos <= input.len() && vm.search(pos, false, false) {
+        let idx = count as usize * 2;
+        if idx + 1 >= result_buf.len() {
+            return -1;
+        }
+        let (match_start, match_end) = (vm.best[0], vm.best[1]);
+        result_buf[idx] = match_start;
+        result_buf[idx + 1] = match_end;
+        count += 1;
+        pos = if match_end == match_start {
+            match_end as usize + 1
+        } else {
+            match_end as usize
+        };
+    }
+    count
+}
+
+fn copy_slots(slots: &[i32], out: &mut [i32]) {
+    let count = slots.len().min(out.len());
+    out[..count].copy_from_slice(&slots[..count]);
+    out[count..].fill(-1);
+}
+
+/// Threads in priority order, each with its own copy of the tracked registers.
+#[derive(Default)]
+struct Threads {
+    pcs: Vec<u32>,
+    slots: Vec<i32>,
+}
+
+impl Threads {
+    fn clear(&mut self) {
+        self.pcs.clear();
+        self.slots.clear();
+    }
+
+    fn slots(&self, index: usize, slot_count: usize) -> &[i32] {
+        &self.slots[index * slot_count..(index + 1) * slot_count]
+    }
+}
+
+enum Frame {
+    Explore { pc: u32, progress: u64 },
+    RestoreSlot { slot: usize, value: i32 },
+}
+
+struct PikeVm<'a, I: Input> {
+    program: &'a Program,
+    input: I,
+    modifiers: ActiveModifiers,
+    /// The bit tracking each progress register, or zero for other registers.
+    /// A set bit means that the register holds the current position.
+    progress_bits: Vec<u64>,
+    /// How many registers (starting with group 0) the threads carry.
+    slot_count: usize,
+    current: Threads,
+    next: Threads,
+    /// Threads seeded in the middle of a surrogate pair, which can only produce empty matches.
+    between_surrogates: Threads,
+    /// Instructions visited at the position being explored, stamped with `generation`.
+    /// Threads that are inside a zero-width loop iteration are keyed by their progress bits too.
+    visited: Vec<u32>,
+    visited_with_progress: Vec<(u32, u64)>,
+    generation: u32,
+    stack: Vec<Frame>,
+    slots: Vec<i32>,
+    best: Vec<i32>,
+}
+
+impl<'a, I: Input> PikeVm<'a, I> {
+    fn new(program: &'a Program, input: I, slot_count: usize) -> Self {
+        let mut progress_bits = vec![0u64; program.register_count as usize];
+        let mut next_bit = 0;
+        for inst in &program.instructions {
+            if let Instruction::ProgressCheck { reg, .. } = inst
+                && progress_bits[*reg as usize] == 0
+            {
+                progress_bits[*reg as usize] = 1 << next_bit;
+                next_bit += 1;
+            }
+        }
+        Self {
+            program,
+            input,
+            modifiers: ActiveModifiers::for_program(program),
+            progress_bits,
+            slot_count,
+            current: Threads::default(),
+            next: Threads::default(),
+            between_surrogates: Threads::default(),
+            visited: vec![0; program.instructions.len()],
+            visited_with_progress: Vec::new(),
+            generation: 0,
+            stack: Vec::new(),
+            slots: vec![-1; slot_count],
+            best: vec![-1; slot_count],
+        }
+    }
+
+    /// Find the leftmost-first match at or after `start_pos`, leaving its registers in `best`.
+    /// With `earliest`, stop at the first match found, even if a higher-priority thread could still match.
+    fn search(&mut self, start_pos: usize, anchored: bool, earliest: bool) -> bool {
+        if start_pos > self.input.len() {
+            return false;
+        }
+        let instructions = &self.program.instructions;
+        let mut current = std::mem::take(&mut self.current);
+        let mut next = std::mem::take(&mut self.next);
+        current.clear();
+        self.start_generation();
+        let mut found = false;
+        let mut pos = start_pos;
+        loop {
+            if !found && (!anchored || pos == start_pos) {
+                self.seed(&mut current, pos);
+            }
+            if current.pcs.is_empty() && (found || anchored || pos >= self.input.len()) {
+                break;
+            }
+
+            let code_point = self.code_point_at(pos);
+
+            // A thread seeded between the halves of the surrogate pair at `pos` has lower priority than
+            // every thread that is already running, so it only wins if none of them match.
+            let mut between_surrogates_match = false;
+            if self.program.unicode && !anchored && !found && matches!(code_point, Some((_, 2))) {
+                let mut threads = std::mem::take(&mut self.between_surrogates);
+                threads.clear();
+                self.start_generation();
+                self.seed(&mut threads, pos + 1);
+                if let Some(index) = threads
+                    .pcs
+                    .iter()
+                    .position(|&pc| matches!(instructions[pc as usize], Instruction::Match))
+                {
+                    self.best.copy_from_slice(threads.slots(index, self.slot_count));
+                    between_surrogates_match = true;
+                }
+                self.between_surrogates = threads;
+            }
+
+            next.clear();
+            self.start_generation();
+            for index in 0..current.pcs.len() {
+                let pc = current.pcs[index];
+                let inst = &instructions[pc as usize];
+                if matches!(inst, Instruction::Match) {
+                    self.best.copy_from_slice(current.slots(index, self.slot_count));
+                    found = true;
+                    between_surrogates_match = false;
+                    // Lower-priority threads can't produce a better match.
+                    break;
+                }
+                let Some((cp, width)) = code_point else {
+                    continue;
+                };
+                if match_code_point_instruction(inst, cp, self.program, &self.modifiers) == Some(true) {
+                    self.slots.copy_from_slice(current.slots(index, self.slot_count));
+                    self.add_thread(&mut next, pc + 1, 0, pos + width);
+                }
+            }
+            if between_surrogates_match {
+                found = true;
+            }
+            if found && earliest {
+                break;
+            }
+
+            if pos >= self.input.len() {
+                break;
+            }
+            pos += code_point.map_or(1, |(_, width)| width);
+            std::mem::swap(&mut current, &mut next);
+        }
+        self.current = current;
+        self.next = next;
+        found
+    }
+
+    fn start_generation(&mut self) {
+        self.generation = self.generation.wrapping_add(1);
+        if self.generation == 0 {
+            self.visited.fill(0);
+            self.generation = 1;
+        }
+        self.visited_with_progress.clear();
+    }
+
+    fn seed(&mut self, threads: &mut Threads, pos: usize) {
+        self.slots.fill(-1);
+        self.add_thread(threads, 0, 0, pos);
+    }
+
+    /// Follow every non-consuming instruction from `pc` in priority order, adding a thread for each
+    /// consuming instruction or `Match` that is reached. Uses `slots` as the registers of the new threads.
+    fn add_thread(&mut self, threads: &mut Threads, pc: u32, progress: u64, pos: usize) {
+        let instructions = &self.program.instructions;
+        self.stack.push(Frame::Explore { pc, progress });
+        while let Some(frame) = self.stack.pop() {
+            let (mut pc, mut progress) = match frame {
+                Frame::Explore { pc, progress } => (pc, progress),
+                Frame::RestoreSlot { slot, value } => {
+                    self.slots[slot] = value;
+                    continue;
+                }
+            };
+            loop {
+                let Some(inst) = instructions.get(pc as usize) else {
+                    break;
+                };
+                if !self.visit(pc, progress) {
+                    break;
+                }
+                match inst {
+                    Instruction::Jump(target) => pc = *target,
+                    Instruction::Split { prefer, other } => {
+                        self.stack.push(Frame::Explore { pc: *other, progress });
+                        pc = *prefer;
+                    }
+                    Instruction::Save(reg) | Instruction::ClearRegister(reg) => {
+                        let reg = *reg as usize;
+                        let value = if matches!(inst, Instruction::Save(_)) {
+                            pos as i32
+                        } else {
+                            -1
+                        };
+                        let bit = self.progress_bits.get(reg).copied().unwrap_or(0);
+                        if bit != 0 {
+                            if value >= 0 {
+                                progress |= bit;
+                            } else {
+                                progress &= !bit;
+                            }
+                        } else if reg < self.slot_count {
+                            self.stack.push(Frame::RestoreSlot {
+                                slot: reg,
+                                value: self.slots[reg],
+                            });
+                            self.slots[reg] = value;
+                        }
+                        pc += 1;
+                    }
+                    Instruction::ProgressCheck { reg, .. } => {
+                        // Fail if the loop body didn't consume anything; otherwise the register now holds the
+                        // current position.
+                        let bit = self.progress_bits[*reg as usize];
+                        if progress & bit != 0 {
+                            break;
+                        }
+                        progress |= bit;
+                        pc += 1;
+                    }
+                    Instruction::AssertStart { multiline } => {
+                        let multiline = *multiline || self.modifiers.multiline;
+                        if pos != 0 && !(multiline && is_line_terminator(self.input.code_unit(pos - 1) as u32)) {
+                            break;
+                        }
+                        pc += 1;
+                    }
+                    Instruction::AssertEnd { multiline } => {
+                        let multiline = *multiline || self.modifiers.multiline;
+                        if pos < self.input.len()
+                            && !(multiline && is_line_terminator(self.input.code_unit(pos) as u32))
+                        {
+                            break;
+                        }
+                        pc += 1;
+                    }
+                    Instruction::AssertWordBoundary | Instruction::AssertNonWordBoundary => {
+                        let at_boundary =
+                            is_at_word_boundary(self.input, pos, self.modifiers.ignore_case && self.program.unicode);
+                        if at_boundary != matches!(inst, Instruction::AssertWordBoundary) {
+                            break;
+                        }
+                        pc += 1;
+                    }
+                    Instruction::Nop => pc += 1,
+                    Instruction::Fail => break,
+                    _ => {
+                        threads.pcs.push(pc);
+                        threads.slots.extend_from_slice(&self.slots);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    fn visit(&mut self, pc: u32, progress: u64) -> bool {
+        if progress == 0 {
+            let stamp = &mut self.visited[pc as usize];
+            if *stamp == self.generation {
+                return false;
+            }
+            *stamp = self.generation;
+            return true;
+        }
+        if self.visited_with_progress.contains(&(pc, progress)) {
+            return false;
+        }
+        self.visited_with_progress.push((pc, progress));
+        true
+    }
+
+    /// The code point at `pos` and its length in code units, the way the VM reads it going forward.
+    fn code_point_at(&self, pos: usize) -> Option<(u32, usize)> {
+        if pos >= self.input.len() {
+            return None;
+        }
+        let cu = self.input.code_unit(pos);
+        if !self.program.unicode {
+            return Some((cu as u32, 1));
+        }
+        if is_high_surrogate(cu) && pos + 1 < self.input.len() && is_low_surrogate(self.input.code_unit(pos + 1)) {
+            let lo = self.input.code_unit(pos + 1) as u32;
+            return Some((0x10000 + ((cu as u32 - 0xD800) << 10) + (lo - 0xDC00), 2));
+        }
+        // NB: The VM never starts reading in the middle of a surrogate pair.
+        if is_low_surrogate(cu) && pos > 0 && is_high_surrogate(self.input.code_unit(pos - 1)) {
+            return None;
+        }
+        Some((cu as u32, 1))
+    }
+}
@@ -18,10 +18,20 @@ use crate::bytecode::NamedGroupEntry;
 use crate::bytecode::append_code_point_wtf16;
 use crate::compiler;
 use crate::parser;
+use crate::pikevm;
+use crate::scan;
 use crate::vm;
 use std::cell::RefCell;
 use std::collections::HashSet;
 
+/// The alternatives of a pattern made only of literal alternatives.
+struct LiteralAlternatives {
+    /// Alternatives stay in source order to preserve leftmost-first semantics.
+    literals: Vec<Vec<u16>>,
+    /// Finds the positions where one of the alternatives may start.
+    prefilter: scan::LiteralSetPrefilter,
+}
+
 /// A compiled regular expression.
 pub struct Regex {
     /// Program for the backtracking VM (with fused loop optimizations).
@@ -33,8 +43,10 @@ pub struct Regex {
     /// Pre-computed u16 literal for whole-pattern `\bliteral\b` matching.
     word_boundary_literal_u16: Option<Vec<u16>>,
     /// Pre-computed u16 alternatives for fast literal alternation matching.
-    /// Alternatives stay in source order to preserve leftmost-first semantics.
-    literal_alt_u16: Option<Vec<Vec<u16>>>,
+    literal_alt_u16: Option<LiteralAlternatives>,
+    /// Program for the linear-time engine, if the pattern doesn't need backtracking.
+    /// Searches that exceed the VM's step limit are rerun with it.
+    linear_program: Option<crate::bytecode::Program>,
     /// Cached VM scratch space for reuse across exec calls.
     scratch: RefCell<vm::VmScratch>,
 }
@@ -55,11 +67,20 @@ impl Regex {
         let mut program = compiler::compile(&parsed);
         Self::resolve_properties(&mut program);
         let required_literal_hint = extract_required_literal_hint(&parsed, flags);
-        let hints = vm::analyze_pattern(&program, pattern_can_match_empty(&parsed), required_literal_hint);
+        let mut hints = vm::analyze_pattern(&program, pattern_can_match_empty(&parsed), required_literal_hint);
+
+        let linear_program = compiler::compile_linear(&parsed).map(|mut linear_program| {
+            Self::resolve_properties(&mut linear_program);
+            linear_program
+        });
+        hints.has_linear_fallback = linear_program.is_some();
 
         let literal_u16 = extract_literal_u16(&parsed, flags);
         let word_boundary_literal_u16 = extract_word_boundary_literal_u16(&parsed, flags);
-        let literal_alt_u16 = extract_literal_alternatives_u16(&parsed, flags);
+        let literal_alt_u16 = extract_literal_alternatives_u16(&parsed, flags).and_then(|literals| {
+            let prefilter = scan::LiteralSetPrefilter::new(&literals, flags.ignore_case)?;
+            Some(LiteralAlternatives { literals, prefilter })
+        });
 
         Ok(Self {
             program,
@@ -68,6 +89,7 @@ impl Regex {
             literal_u16,
             word_boundary_literal_u16,
             literal_alt_u16,
+            linear_program,
             scratch: RefCell::new(vm::VmScratch::new()),
         })
     }
@@ -87,7 +109,13 @@ impl Regex {
     pub(crate) fn exec_into_input<I: vm::Input>(&self, input: I, start: usize, out: &mut [i32]) -> vm::VmResult {
         if self.flags.sticky {
             let scratch = &mut *self.scratch.borrow_mut();
-            return vm::execute_anchored_into_with_scratch(&self.program, input, start, &self.hints, out, scratch);
+            let result = vm::execute_anchored_into_with_scratch(&self.program, input, start, &self.hints, out, scratch);
+            if result == vm::VmResult::LimitExceeded
+                && let Some(ref linear_program) = self.linear_program
+            {
+                return pikevm::execute_into(linear_program, input, start, true, out);
+            }
+            return result;
         }
 
         // Fast path for literal patterns: use fast substring search.
@@ -115,7 +143,13 @@ impl Regex {
             };
         }
         let scratch = &mut *self.scratch.borrow_mut();
-        vm::execute_into_with_scratch(&self.program, input, start, &self.hints, out, scratch)
+        let result = vm::execute_into_with_scratch(&self.program, input, start, &self.hints, out, scratch);
+        if result == vm::VmResult::LimitExceeded
+            && let Some(ref linear_program) = self.linear_program
+        {
+            return pikevm::execute_into(linear_program, input, start, false, out);
+        }
+        result
     }
 
     /// Test whether the regex matches anywhere in the input.
@@ -131,7 +165,14 @@ impl Regex {
         if self.flags.sticky {
             let mut out = [-1i32; 2];
             let scratch = &mut *self.scratch.borrow_mut();
-            return vm::execute_anchored_into_with_scratch(&self.program, input, start, &self.hints, &mut out, scratch);
+            let result =
+                vm::execute_anchored_into_with_scratch(&self.program, input, start, &self.hints, &mut out, scratch);
+            if result == vm::VmResult::LimitExceeded
+                && let Some(ref linear_program) = self.linear_program
+            {
+                return pikevm::test(linear_program, input, start, true);
+            }
+            return result;
         }
 
         if let Some(ref needle) = self.literal_u16 {
@@ -159,7 +200,13 @@ impl Regex {
         // Reuse cached scratch space for the VM. Only need group 0 for test().
         let mut out = [-1i32; 2];
         let scratch = &mut *self.scratch.borrow_mut();
-        vm::execute_into_with_scratch(&self.program, input, start, &self.hints, &mut out, scratch)
+        let result = vm::execute_into_with_scratch(&self.program, input, start, &self.hints, &mut out, scratch);
+        if result == vm::VmResult::LimitExceeded
+            && let Some(ref linear_program) = self.linear_program
+        {
+            return pikevm::test(linear_program, input, start, false);
+        }
+        result
     }
 
     /// Fast literal substring search for whole-pattern literal fast paths.
@@ -298,78 +345,27 @@ impl Regex {
     fn literal_alt_search<I: vm::Input>(
         input: I,
         start: usize,
-        alts: &[Vec<u16>],
+        alts: &LiteralAlternatives,
         flags: &Flags,
         out: &mut [i32],
     ) -> bool {
-        if flags.ignore_case {
-            return Self::literal_alt_search_ascii_ignore_case(input, start, alts, out);
-        }
-
-        for pos in start..input.len() {
-            let first_ch = input.code_unit(pos);
-            for alt in alts {
-                if alt[0] != first_ch {
-                    continue;
-                }
-                let alt_len = alt.len();
-                if pos + alt_len > input.len() {
-                    continue;
-                }
-                if input.matches_u16_at(pos, alt) {
-                    if out.len() >= 2 {
-                        out[0] = pos as i32;
-                        out[1] = (pos + alt_len) as i32;
-                    }
-                    return true;
-                }
-            }
-        }
-        false
-    }
-
-    fn literal_alt_search_ascii_ignore_case<I: vm::Input>(
-        input: I,
-        start: usize,
-        alts: &[Vec<u16>],
-        out: &mut [i32],
-    ) -> bool {
-        let min_alt_len = alts.iter().map(|alt| alt.len()).min().unwrap_or(0);
-        if min_alt_len == 0 || start + min_alt_len > input.len() {
-            return false;
-        }
-
-        let mut first_code_units = [false; 128];
-        for alt in alts {
-            first_code_units[fold_ascii_for_compare(alt[0]) as usize] = true;
-        }
-
         let mut pos = start;
-        let end = input.len() - min_alt_len + 1;
-        while pos < end {
-            match find_ascii_case_insensitive_code_unit_in_set(input, pos, end, &first_code_units) {
-                Some(candidate_pos) => pos = candidate_pos,
-                None => return false,
-            }
-
-            let folded_first_code_unit = fold_ascii_for_compare(input.code_unit(pos));
-            for alt in alts {
-                if fold_ascii_for_compare(alt[0]) != folded_first_code_unit {
-                    continue;
-                }
-                let alt_len = alt.len();
-                if pos + alt_len > input.len() {
-                    continue;
-                }
-                if matches_ascii_case_insensitive_u16_at(input, pos, alt) {
+        while let Some(candidate_pos) = input.find_literal_set_candidate(pos, &alts.prefilter) {
+            for alt in &alts.literals {
+                let matched = if flags.ignore_case {
+                    matches_ascii_case_insensitive_u16_at(input, candidate_pos, alt)
+                } else {
+                    input.matches_u16_at(candidate_pos, alt)
+                };
+                if matched {
                     if out.len() >= 2 {
-                        out[0] = pos as i32;
-                        out[1] = (pos + alt_len) as i32;
+                        out[0] = candidate_pos as i32;
+                        out[1] = (candidate_pos + alt.len()) as i32;
                     }
                     return true;
                 }
             }
-            pos += 1;
+            pos = candidate_pos + 1;
         }
         false
     }
@@ -447,7 +443,7 @@ impl Regex {
     fn literal_alt_find_all<I: vm::Input>(
         input: I,
         start: usize,
-        alts: &[Vec<u16>],
+        alts: &LiteralAlternatives,
         flags: &Flags,
         result_buf: &mut [i32],
     ) -> i32 {
@@ -558,7 +554,13 @@ impl Regex {
         }
         // Use the VM-internal find_all loop which reuses a single VM across matches.
         let scratch = &mut *self.scratch.borrow_mut();
-        vm::find_all_with_scratch(&self.program, input, start, &self.hints, result_buf, scratch)
+        let count = vm::find_all_with_scratch(&self.program, input, start, &self.hints, result_buf, scratch);
+        if count == -2
+            && let Some(ref linear_program) = self.linear_program
+        {
+            return pikevm::find_all_into(linear_program, input, start, result_buf);
+        }
+        count
     }
 }
 
@@ -587,34 +589,7 @@ fn find_ascii_case_insensitive_code_unit<I: vm::Input>(
     end: usize,
     needle: u16,
 ) -> Option<usize> {
-    let folded_needle = fold_ascii_for_compare(needle);
-    let mut pos = start;
-    while pos < end {
-        let code_unit = input.code_unit(pos);
-        if code_unit <= 0x7F && fold_ascii_for_compare(code_unit) == folded_needle {
-            return Some(pos);
-        }
-        pos += 1;
-    }
-    None
-}
-
-#[inline(always)]
-fn find_ascii_case_insensitive_code_unit_in_set<I: vm::Input>(
-    input: I,
-    start: usize,
-    end: usize,
-    needles: &[bool; 128],
-) -> Option<usize> {
-    let mut pos = start;
-    while pos < end {
-        let code_unit = input.code_unit(pos);
-        if code_unit <= 0x7F && needles[fold_ascii_for_compare(code_unit) as usize] {
-            return Some(pos);
-        }
-        pos += 1;
-    }
-    None
+    input.find_code_unit_in_set(start, end, &vm::ascii_case_variants(needle)?)
 }
 
 #[inline(always)]
@@ -0,0 +1,395 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+//! Vectorized scanning for the search prefilters.
+//!
+//! On x86-64 the single code unit, small set and pair searches use SSE2, which
+//! every x86-64 CPU has, and the literal set prefilter uses SSSE3 when the CPU
+//! supports it. Other targets use chunked loops without early exits that the
+//! compiler can vectorize for them.
+
+/// The largest set of code units that `find_any_*` scans for in one pass.
+pub(crate) const MAX_CODE_UNIT_SET_LEN: usize = 4;
+
+/// Find the first occurrence of any of `needles` (at most `MAX_CODE_UNIT_SET_LEN`).
+#[inline(always)]
+pub(crate) fn find_any_u16(haystack: &[u16], needles: &[u16]) -> Option<usize> {
+    debug_assert!((1..=MAX_CODE_UNIT_SET_LEN).contains(&needles.len()));
+    #[cfg(target_arch = "x86_64")]
+    return sse2::find_any(haystack, needles);
+    #[cfg(not(target_arch = "x86_64"))]
+    return portable::find_any(haystack, needles);
+}
+
+/// Find the first occurrence of any of `needles` (at most `MAX_CODE_UNIT_SET_LEN`).
+#[inline(always)]
+pub(crate) fn find_any_u8(haystack: &[u8], needles: &[u8]) -> Option<usize> {
+    debug_assert!((1..=MAX_CODE_UNIT_SET_LEN).contains(&needles.len()));
+    #[cfg(target_arch = "x86_64")]
+    return sse2::find_any(haystack, needles);
+    #[cfg(not(target_arch = "x86_64"))]
+    return portable::find_any(haystack, needles);
+}
+
+/// Find the first position `pos` with `haystack[pos] == first` and
+/// `haystack[pos + distance] == second`. Checking two code units of a literal
+/// at once skips far more false candidates than checking only the first one.
+#[inline(always)]
+pub(crate) fn find_pair_u16(haystack: &[u16], first: u16, second: u16, distance: usize) -> Option<usize> {
+    #[cfg(target_arch = "x86_64")]
+    return sse2::find_pair(haystack, first, second, distance);
+    #[cfg(not(target_arch = "x86_64"))]
+    return portable::find_pair(haystack, first, second, distance);
+}
+
+#[inline(always)]
+pub(crate) fn find_pair_u8(haystack: &[u8], first: u8, second: u8, distance: usize) -> Option<usize> {
+    #[cfg(target_arch = "x86_64")]
+    return sse2::find_pair(haystack, first, second, distance);
+    #[cfg(not(target_arch = "x86_64"))]
+    return portable::find_pair(haystack, first, second, distance);
+}
+
+#[inline(always)]
+fn find_pair_scalar<T: Copy + Eq>(
+    haystack: &[T],
+    mut pos: usize,
+    first: T,
+    second: T,
+    distance: usize,
+) -> Option<usize> {
+    while pos + distance < haystack.len() {
+        if haystack[pos] == first && haystack[pos + distance] == second {
+            return Some(pos);
+        }
+        pos += 1;
+    }
+    None
+}
+
+/// Maps a code unit to the byte the literal set prefilter classifies it by.
+/// This matches the unsigned saturation of `_mm_packus_epi16`, so that the
+/// vectorized and scalar paths agree.
+#[inline(always)]
+fn fingerprint(code_unit: u16) -> u8 {
+    if code_unit >= 0x8000 {
+        0
+    } else {
+        code_unit.min(0xFF) as u8
+    }
+}
+
+/// Finds the positions where one of a set of literals may start, by looking up
+/// their first one or two code units in nibble tables (the "Teddy" algorithm
+/// from Hyperscan). Literals are spread over eight buckets, and a position is a
+/// candidate when some bucket accepts every fingerprinted code unit. Candidates
+/// may be false positives, so callers must still verify the literals there.
+pub struct LiteralSetPrefilter {
+    /// Bucket bits per fingerprinted offset, indexed by the low nibble.
+    low_nibbles: [[u8; 16]; 2],
+    /// Bucket bits per fingerprinted offset, indexed by the high nibble.
+    high_nibbles: [[u8; 16]; 2],
+    /// How many leading code units are fingerprinted (1 or 2).
+    fingerprint_len: usize,
+}
+
+impl LiteralSetPrefilter {
+    /// Build a prefilter for `literals`. With `ascii_case_insensitive`, both
+    /// cases of ASCII letters are accepted. Returns None if a literal is empty.
+    pub(crate) fn new(literals: &[Vec<u16>], ascii_case_insensitive: bool) -> Option<Self> {
+        let min_len = literals.iter().map(Vec::len).min()?;
+        if min_len == 0 {
+            return None;
+        }
+
+        let mut prefilter = Self {
+            low_nibbles: [[0; 16]; 2],
+            high_nibbles: [[0; 16]; 2],
+            fingerprint_len: min_len.min(2),
+        };
+        for (index, literal) in literals.iter().enumerate() {
+            let bucket = 1u8 << (index % 8);
+            for (offset, code_unit) in literal[..prefilter.fingerprint_len].iter().enumerate() {
+                let mut variants = [*code_unit; 2];
+                if ascii_case_insensitive && matches!(code_unit, 0x41..=0x5A | 0x61..=0x7A) {
+                    variants[1] = *code_unit ^ 0x20;
+                }
+                for variant in variants {
+                    let byte = fingerprint(variant);
+                    prefilter.low_nibbles[offset][(byte & 0x0F) as usize] |= bucket;
+                    prefilter.high_nibbles[offset][(byte >> 4) as usize] |= bucket;
+                }
+            }
+        }
+        Some(prefilter)
+    }
+
+    #[inline(always)]
+    pub(crate) fn fingerprint_len(&self) -> usize {
+        self.fingerprint_len
+    }
+
+    /// Whether a literal may start at a position whose code units are given by
+    /// `code_unit_at(offset)`. Only offsets below `fingerprint_len()` are read.
+    #[inline(always)]
+    pub(crate) fn is_candidate(&self, mut code_unit_at: impl FnMut(usize) -> u16) -> bool {
+        let mut buckets = 0xFF;
+        for offset in 0..self.fingerprint_len {
+            let byte = fingerprint(code_unit_at(offset));
+            buckets &=
+                self.low_nibbles[offset][(byte & 0x0F) as usize] & self.high_nibbles[offset][(byte >> 4) as usize];
+        }
+        buckets != 0
+    }
+
+    /// Find the first candidate position at or after `start`.
+    #[inline(always)]
+    pub(crate) fn find_u16(&self, haystack: &[u16], start: usize) -> Option<usize> {
+        #[cfg(target_arch = "x86_64")]
+        if std::is_x86_feature_detected!("ssse3") {
+            // SAFETY: We just checked that the CPU supports SSSE3.
+            return unsafe { self.find_ssse3(haystack, start) };
+        }
+        self.find_scalar(haystack, start)
+    }
+
+    /// Find the first candidate position at or after `start`.
+    #[inline(always)]
+    pub(crate) fn find_u8(&self, haystack: &[u8], start: usize) -> Option<usize> {
+        #[cfg(target_arch = "x86_64")]
+        if std::is_x86_feature_detected!("ssse3") {
+            // SAFETY: We just checked that the CPU supports SSSE3.
+            return unsafe { self.find_ssse3(haystack, start) };
+        }
+        self.find_scalar(haystack, start)
+    }
+
+    fn find_scalar<T: Copy + Into<u16>>(&self, haystack: &[T], mut pos: usize) -> Option<usize> {
+        while pos + self.fingerprint_len <= haystack.len() {
+            if self.is_candidate(|offset| haystack[pos + offset].into()) {
+                return Some(pos);
+            }
+            pos += 1;
+        }
+        None
+    }
+
+    #[cfg(target_arch = "x86_64")]
+    #[target_feature(enable = "ssse3")]
+    unsafe fn find_ssse3<T: sse2::Lane + Into<u16>>(&self, haystack: &[T], mut pos: usize) -> Option<usize> {
+        use std::arch::x86_64::*;
+
+        let last_offset = self.fingerprint_len - 1;
+        // SAFETY: The tables are 16 bytes each, and every fingerprint load reads
+        // 16 code units that are in bounds.
+        unsafe {
+            let nibble_mask = _mm_set1_epi8(0x0F);
+            let load_table = |table: &[u8; 16]| _mm_loadu_si128(table.as_ptr().cast());
+            let low_tables = [load_table(&self.low_nibbles[0]), load_table(&self.low_nibbles[1])];
+            let high_tables = [load_table(&self.high_nibbles[0]), load_table(&self.high_nibbles[1])];
+            let buckets_at = |pos: usize, offset: usize| {
+                let bytes = T::load_fingerprints(haystack, pos + offset);
+                let low = _mm_shuffle_epi8(low_tables[offset], _mm_and_si128(bytes, nibble_mask));
+                let high = _mm_shuffle_epi8(
+                    high_tables[offset],
+                    _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble_mask),
+                );
+                _mm_and_si128(low, high)
+            };
+
+            while pos + last_offset + 16 <= haystack.len() {
+                let mut buckets = buckets_at(pos, 0);
+                if last_offset == 1 {
+                    buckets = _mm_and_si128(buckets, buckets_at(pos, 1));
+                }
+                let misses = _mm_movemask_epi8(_mm_cmpeq_epi8(buckets, _mm_setzero_si128())) as u32;
+                let candidates = !misses & 0xFFFF;
+                if candidates != 0 {
+                    return Some(pos + candidates.trailing_zeros() as usize);
+                }
+                pos += 16;
+            }
+        }
+        self.find_scalar(haystack, pos)
+    }
+}
+
+#[cfg(target_arch = "x86_64")]
+mod sse2 {
+    use super::MAX_CODE_UNIT_SET_LEN;
+    use super::find_pair_scalar;
+    use std::arch::x86_64::*;
+
+    /// A code unit type that SSE2 compares a 16-byte vector of at a time.
+    pub(super) trait Lane: Copy + Eq {
+        const LANES: usize;
+        const MASK_BITS_PER_LANE: u32;
+
+        /// # Safety
+        /// The CPU must support SSE2.
+        unsafe fn splat(self) -> __m128i;
+
+        /// # Safety
+        /// The CPU must support SSE2.
+        unsafe fn compare(lhs: __m128i, rhs: __m128i) -> __m128i;
+
+        /// Load the fingerprint bytes of 16 code units, saturating as `super::fingerprint()` does.
+        ///
+        /// # Safety
+        /// The CPU must support SSE2, and `pos + 16` must not exceed the length of `haystack`.
+        unsafe fn load_fingerprints(haystack: &[Self], pos: usize) -> __m128i;
+    }
+
+    impl Lane for u8 {
+        const LANES: usize = 16;
+        const MASK_BITS_PER_LANE: u32 = 1;
+
+        #[inline(always)]
+        unsafe fn splat(self) -> __m128i {
+            unsafe { _mm_set1_epi8(self as i8) }
+        }
+
+        #[inline(always)]
+        unsafe fn compare(lhs: __m128i, rhs: __m128i) -> __m128i {
+            unsafe { _mm_cmpeq_epi8(lhs, rhs) }
+        }
+
+        #[inline(always)]
+        unsafe fn load_fingerprints(haystack: &[Self], pos: usize) -> __m128i {
+            unsafe { load(haystack, pos) }
+        }
+    }
+
+    impl Lane for u16 {
+        const LANES: usize = 8;
+        const MASK_BITS_PER_LANE: u32 = 2;
+
+        #[inline(always)]
+        unsafe fn splat(self) -> __m128i {
+            unsafe { _mm_set1_epi16(self as i16) }
+        }
+
+        #[inline(always)]
+        unsafe fn compare(lhs: __m128i, rhs: __m128i) -> __m128i {
+            unsafe { _mm_cmpeq_epi16(lhs, rhs) }
+        }
+
+        #[inline(always)]
+        unsafe fn load_fingerprints(haystack: &[Self], pos: usize) -> __m128i {
+            unsafe { _mm_packus_epi16(load(haystack, pos), load(haystack, pos + 8)) }
+        }
+    }
+
+    /// # Safety
+    /// `pos` plus one vector's worth of lanes must not exceed the length of `haystack`.
+    #[inline(always)]
+    unsafe fn load<T: Lane>(haystack: &[T], pos: usize) -> __m128i {
+        unsafe { _mm_loadu_si128(haystack.as_ptr().add(pos).cast()) }
+    }
+
+    #[inline(always)]
+    fn first_set_lane<T: Lane>(mask: i32) -> usize {
+        (mask as u32).trailing_zeros() as usize / T::MASK_BITS_PER_LANE as usize
+    }
+
+    #[inline(always)]
+    pub(super) fn find_any<T: Lane>(haystack: &[T], needles: &[T]) -> Option<usize> {
+        let mut pos = 0;
+        // SAFETY: SSE2 is part of the x86-64 baseline, and every load reads a
+        // vector that is in bounds.
+        unsafe {
+            let mut splats = [_mm_setzero_si128(); MAX_CODE_UNIT_SET_LEN];
+            for (splat, needle) in splats.iter_mut().zip(needles) {
+                *splat = needle.splat();
+            }
+            let splats = &splats[..needles.len()];
+            while pos + T::LANES <= haystack.len() {
+                let chunk = load(haystack, pos);
+                let mut matches = T::compare(chunk, splats[0]);
+                for splat in &splats[1..] {
+                    matches = _mm_or_si128(matches, T::compare(chunk, *splat));
+                }
+                let mask = _mm_movemask_epi8(matches);
+                if mask != 0 {
+                    return Some(pos + first_set_lane::<T>(mask));
+                }
+                pos += T::LANES;
+            }
+        }
+        let offset = haystack[pos..]
+            .iter()
+            .position(|code_unit| needles.contains(code_unit))?;
+        Some(pos + offset)
+    }
+
+    #[inline(always)]
+    pub(super) fn find_pair<T: Lane>(haystack: &[T], first: T, second: T, distance: usize) -> Option<usize> {
+        let mut pos = 0;
+        // SAFETY: SSE2 is part of the x86-64 baseline, and every load reads a
+        // vector that is in bounds.
+        unsafe {
+            let first_splat = first.splat();
+            let second_splat = second.splat();
+            while pos + distance + T::LANES <= haystack.len() {
+                let first_matches = T::compare(load(haystack, pos), first_splat);
+                let second_matches = T::compare(load(haystack, pos + distance), second_splat);
+                let mask = _mm_movemask_epi8(_mm_and_si128(first_matches, second_matches));
+                if mask != 0 {
+                    return Some(pos + first_set_lane::<T>(mask));
+                }
+                pos += T::LANES;
+            }
+        }
+        find_pair_scalar(haystack, pos, first, second, distance)
+    }
+}
+
+#[cfg(not(target_arch = "x86_64"))]
+mod portable {
+    use super::find_pair_scalar;
+
+    const CHUNK_LEN: usize = 16;
+
+    // Each chunk is tested without early exits so the compiler can vectorize
+    // the test (e.g. with NEON), and only a chunk that hits is searched again.
+
+    #[inline(always)]
+    pub(super) fn find_any<T: Copy + Eq>(haystack: &[T], needles: &[T]) -> Option<usize> {
+        let mut pos = 0;
+        while pos + CHUNK_LEN <= haystack.len() {
+            let chunk = &haystack[pos..pos + CHUNK_LEN];
+            let hit = chunk.iter().fold(false, |hit, code_unit| {
+                needles.iter().fold(hit, |hit, needle| hit | (code_unit == needle))
+            });
+            if hit {
+                break;
+            }
+            pos += CHUNK_LEN;
+        }
+        let offset = haystack[pos..]
+            .iter()
+            .position(|code_unit| needles.contains(code_unit))?;
+        Some(pos + offset)
+    }
+
+    #[inline(always)]
+    pub(super) fn find_pair<T: Copy + Eq>(haystack: &[T], first: T, second: T, distance: usize) -> Option<usize> {
+        let mut pos = 0;
+        while pos + distance + CHUNK_LEN <= haystack.len() {
+            let firsts = &haystack[pos..pos + CHUNK_LEN];
+            let seconds = &haystack[pos + distance..pos + distance + CHUNK_LEN];
+            let hit = firsts
+                .iter()
+                .zip(seconds)
+                .fold(false, |hit, (lhs, rhs)| hit | ((*lhs == first) & (*rhs == second)));
+            if hit {
+                break;
+            }
+            pos += CHUNK_LEN;
+        }
+        find_pair_scalar(haystack, pos, first, second, distance)
+    }
+}
@@ -13,9 +13,14 @@
 //! - <https://tc39.es/ecma262/#sec-pattern-semantics>
 //! - <https://tc39.es/ecma262/#sec-regexpbuiltinexec>
 use crate::bytecode::*;
+use crate::compiled::CompiledProgram;
+use crate::compiled::CompiledScratch;
+use crate::compiled::TIER_UP_THRESHOLD;
+use crate::scan;
+use crate::scan::LiteralSetPrefilter;
 
 /// Maximum number of steps before aborting (prevents ReDoS).
-const MATCH_LIMIT: u64 = 10_000_000;
+pub(crate) const MATCH_LIMIT: u64 = 10_000_000;
 
 /// Tri-state result from a single VM execution.
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
@@ -46,6 +51,48 @@ pub trait Input: Copy {
         None
     }
 
+    /// Find the first position in `start..end` holding one of `set`, which has
+    /// at most `scan::MAX_CODE_UNIT_SET_LEN` entries.
+    #[inline(always)]
+    fn find_code_unit_in_set(self, start: usize, end: usize, set: &[u16]) -> Option<usize> {
+        let mut pos = start;
+        while pos < end {
+            if set.contains(&self.code_unit(pos)) {
+                return Some(pos);
+            }
+            pos += 1;
+        }
+        None
+    }
+
+    /// Find the first position `pos` in `start..end` holding `first`, with
+    /// `second` at `pos + distance`. `end + distance` must not exceed `len()`.
+    #[inline(always)]
+    fn find_code_unit_pair(self, start: usize, end: usize, first: u16, second: u16, distance: usize) -> Option<usize> {
+        let mut pos = start;
+        while pos < end {
+            if self.code_unit(pos) == first && self.code_unit(pos + distance) == second {
+                return Some(pos);
+            }
+            pos += 1;
+        }
+        None
+    }
+
+    /// Find the first position at or after `start` where `prefilter` says one
+    /// of its literals may start.
+    #[inline(always)]
+    fn find_literal_set_candidate(self, start: usize, prefilter: &LiteralSetPrefilter) -> Option<usize> {
+        let mut pos = start;
+        while pos + prefilter.fingerprint_len() <= self.len() {
+            if prefilter.is_candidate(|offset| self.code_unit(pos + offset)) {
+                return Some(pos);
+            }
+            pos += 1;
+        }
+        None
+    }
+
     #[inline(always)]
     fn next_literal_start(self, start_pos: usize, ch16: u16) -> Option<usize> {
         self.find_code_unit(start_pos, self.len(), ch16)
@@ -99,10 +146,27 @@ impl Input for &[u16] {
 
     #[inline(always)]
     fn find_code_unit(self, start: usize, end: usize, ch16: u16) -> Option<usize> {
-        let offset = self.get(start..end)?.iter().position(|&c| c == ch16)?;
+        let offset = scan::find_any_u16(self.get(start..end)?, &[ch16])?;
+        Some(start + offset)
+    }
+
+    #[inline(always)]
+    fn find_code_unit_in_set(self, start: usize, end: usize, set: &[u16]) -> Option<usize> {
+        let offset = scan::find_any_u16(self.get(start..end)?, set)?;
+        Some(start + offset)
+    }
+
+    #[inline(always)]
+    fn find_code_unit_pair(self, start: usize, end: usize, first: u16, second: u16, distance: usize) -> Option<usize> {
+        let offset = scan::find_pair_u16(self.get(start..end + distance)?, first, second, distance)?;
         Some(start + offset)
     }
 
+    #[inline(always)]
+    fn find_literal_set_candidate(self, start: usize, prefilter: &LiteralSetPrefilter) -> Option<usize> {
+        prefilter.find_u16(self, start)
+    }
+
     #[inline(always)]
     fn matches_u16_at(self, pos: usize, needle: &[u16]) -> bool {
         self.get(pos..pos + needle.len()) == Some(needle)
@@ -136,10 +200,42 @@ impl Input for &[u8] {
         if byte > 0x7F {
             return None;
         }
-        let offset = self.get(start..end)?.iter().position(|&c| c == byte)?;
+        let offset = scan::find_any_u8(self.get(start..end)?, &[byte])?;
+        Some(start + offset)
+    }
+
+    #[inline(always)]
+    fn find_code_unit_in_set(self, start: usize, end: usize, set: &[u16]) -> Option<usize> {
+        let mut bytes = [0u8; scan::MAX_CODE_UNIT_SET_LEN];
+        let mut byte_count = 0;
+        for code_unit in set {
+            if *code_unit <= 0x7F {
+                bytes[byte_count] = *code_unit as u8;
+                byte_count += 1;
+            }
+        }
+        if byte_count == 0 {
+            return None;
+        }
+        let offset = scan::find_any_u8(self.get(start..end)?, &bytes[..byte_count])?;
+        Some(start + offset)
+    }
+
+    #[inline(always)]
+    fn find_code_unit_pair(self, start: usize, end: usize, first: u16, second: u16, distance: usize) -> Option<usize> {
+        if first > 0x7F || second > 0x7F {
+            return None;
+        }
+        let haystack = self.get(start..end + distance)?;
+        let offset = scan::find_pair_u8(haystack, first as u8, second as u8, distance)?;
         Some(start + offset)
     }
 
+    #[inline(always)]
+    fn find_literal_set_candidate(self, start: usize, prefilter: &LiteralSetPrefilter) -> Option<usize> {
+        prefilter.find_u8(self, start)
+    }
+
     #[inline(always)]
     fn matches_u16_at(self, pos: usize, needle: &[u16]) -> bool {
         let Some(slice) = self.get(pos..pos + needle.len()) else {
@@ -299,8 +395,9 @@ fn contains_u16_from<I: Input>(input: I, start: usize, needle: &[u16]) -> bool {
 
     let mut pos = start;
     let end = input.len() - needle.len() + 1;
+    let last_offset = needle.len() - 1;
     while pos < end {
-        match input.find_code_unit(pos, end, needle[0]) {
+        match input.find_code_unit_pair(pos, end, needle[0], needle[last_offset], last_offset) {
             Some(candidate_pos) => pos = candidate_pos,
             None => return false,
         }
@@ -320,6 +417,17 @@ fn fold_ascii_for_compare(ch: u16) -> u16 {
     }
 }
 
+/// The ASCII code units that compare equal to `ch` ignoring ASCII case, or None
+/// if `ch` isn't ASCII.
+#[inline(always)]
+pub(crate) fn ascii_case_variants(ch: u16) -> Option<[u16; 2]> {
+    match ch {
+        0x41..=0x5A | 0x61..=0x7A => Some([ch | 0x20, ch & !0x20]),
+        0x00..=0x7F => Some([ch, ch]),
+        _ => None,
+    }
+}
+
 #[inline(always)]
 fn contains_ascii_case_insensitive_u16_from<I: Input>(input: I, start: usize, needle: &[u16]) -> bool {
     if needle.is_empty() {
@@ -331,19 +439,15 @@ fn contains_ascii_case_insensitive_u16_from<I: Input>(input: I, start: usize, ne
         return false;
     }
 
-    let folded_first = fold_ascii_for_compare(needle[0]);
+    let Some(first_code_units) = ascii_case_variants(needle[0]) else {
+        return false;
+    };
     let mut pos = start;
     let end = input.len() - needle_len + 1;
     while pos < end {
-        while pos < end {
-            let code_unit = input.code_unit(pos);
-            if code_unit <= 0x7F && fold_ascii_for_compare(code_unit) == folded_first {
-                break;
-            }
-            pos += 1;
-        }
-        if pos >= end {
-            return false;
+        match input.find_code_unit_in_set(pos, end, &first_code_units) {
+            Some(candidate_pos) => pos = candidate_pos,
+            None => return false,
         }
         if matches_ascii_case_insensitive_u16_at(input, pos, needle) {
             return true;
@@ -444,6 +548,10 @@ fn first_filter_matches<I: Input>(program: &Program, input: I, pos: usize, filte
 #[inline(always)]
 fn next_candidate_start<I: Input>(program: &Program, input: I, hints: &PatternHints, mut pos: usize) -> Option<usize> {
     while pos <= input.len() {
+        if let Some(ref code_units) = hints.first_code_units {
+            pos = input.find_code_unit_in_set(pos, input.len(), code_units)?;
+        }
+
         if program.unicode
             && !hints.can_match_empty
             && pos > 0
@@ -738,6 +846,7 @@ fn execute_into_impl<I: Input>(
                     copy_captures_to_out(vm.registers, program.capture_count, out);
                     return VmResult::Match;
                 }
+                VmResult::LimitExceeded if hints.has_linear_fallback => return VmResult::LimitExceeded,
                 VmResult::LimitExceeded => hit_limit = true,
                 VmResult::NoMatch => {}
             }
@@ -765,6 +874,7 @@ fn execute_into_impl<I: Input>(
                     copy_captures_to_out(vm.registers, program.capture_count, out);
                     return VmResult::Match;
                 }
+                VmResult::LimitExceeded if hints.has_linear_fallback => return VmResult::LimitExceeded,
                 VmResult::LimitExceeded => hit_limit = true,
                 VmResult::NoMatch => {}
             }
@@ -787,6 +897,7 @@ fn execute_into_impl<I: Input>(
                 copy_captures_to_out(vm.registers, program.capture_count, out);
                 return VmResult::Match;
             }
+            VmResult::LimitExceeded if hints.has_linear_fallback => return VmResult::LimitExceeded,
             VmResult::LimitExceeded => hit_limit = true,
             VmResult::NoMatch => {}
         }
@@ -843,7 +954,7 @@ fn match_simple_scan(scan: &SimpleScan, cp: u32) -> bool {
 
 /// Match a single code point against a SimpleMatch, respecting active modifiers.
 #[inline(always)]
-fn match_simple_with_modifiers(matcher: &SimpleMatch, cp: u32, modifiers: &ActiveModifiers) -> bool {
+pub(crate) fn match_simple_with_modifiers(matcher: &SimpleMatch, cp: u32, modifiers: &ActiveModifiers) -> bool {
     match matcher {
         SimpleMatch::AnyChar { dot_all } => {
             let dot_all = *dot_all || modifiers.dot_all;
@@ -873,6 +984,46 @@ fn match_simple_with_modifiers(matcher: &SimpleMatch, cp: u32, modifiers: &Activ
     }
 }
 
+/// Match a single code point against a character-consuming instruction, the same way the VM does.
+/// Returns `None` for instructions that don't consume a character.
+pub(crate) fn match_code_point_instruction(
+    inst: &Instruction,
+    cp: u32,
+    program: &Program,
+    modifiers: &ActiveModifiers,
+) -> Option<bool> {
+    let unicode_ignore_case = modifiers.ignore_case && program.unicode;
+    let matched = match inst {
+        Instruction::Char(c) => {
+            if modifiers.ignore_case {
+                case_fold_eq(cp, *c, program.unicode)
+            } else {
+                cp == *c
+            }
+        }
+        Instruction::CharNoCase(lo, _hi) => case_fold_eq(cp, *lo, program.unicode),
+        Instruction::AnyChar { dot_all } => *dot_all || modifiers.dot_all || !is_line_terminator(cp),
+        Instruction::CharClass { ranges, negated } => {
+            match_char_class(cp, ranges, modifiers.ignore_case, program.unicode, program.unicode_sets) != *negated
+        }
+        Instruction::BuiltinClass(class) => match_builtin_class(cp, *class, unicode_ignore_case),
+        Instruction::UnicodeProperty(data) => {
+            if unicode_ignore_case {
+                if data.negated && !program.unicode_sets {
+                    !match_unicode_property_all_case_equivalents(cp, &data.name, data.value.as_deref())
+                } else {
+                    match_unicode_property_case_insensitive(cp, &data.name, data.value.as_deref()) != data.negated
+                }
+            } else {
+                match_unicode_property_resolved(cp, &data.name, data.value.as_deref(), data.resolved.as_ref())
+                    != data.negated
+            }
+        }
+        _ => return None,
+    };
+    Some(matched)
+}
+
 /// Match a single code point against a SimpleMatch.
 #[inline(always)]
 fn match_simple_match(matcher: &SimpleMatch, cp: u32) -> bool {
@@ -974,6 +1125,9 @@ pub struct PatternHints {
     /// Leading alternatives that can only begin at position 0 or at one of a
     /// small set of literal code units.
     start_position_hint: Option<StartPositionHint>,
+    /// The code units every match starts with, when `first_char` or
+    /// `first_filter` allow few enough to scan for all of them in one pass.
+    first_code_units: Option<Vec<u16>>,
     /// Pattern starts with ^ (AssertStart) — only try at line starts (or input start).
     starts_with_anchor: bool,
     /// Whether the anchor is multiline (^ matches at line starts, not just input start).
@@ -987,6 +1141,9 @@ pub struct PatternHints {
     simple_scan: Option<SimpleScan>,
     /// Whether the full pattern can match without consuming input.
     can_match_empty: bool,
+    /// Give up as soon as one start position exceeds the step limit, since the caller can rerun the
+    /// search with the linear-time engine.
+    pub(crate) has_linear_fallback: bool,
 }
 
 pub(crate) struct RequiredLiteralHint {
@@ -1112,10 +1269,8 @@ fn analyze_start_position_hint(instructions: &[Instruction], start: usize) -> Op
         }
     }
 
-    // Keep this hint narrowly scoped to `(^|literal)` prefixes. Wider literal
-    // sets require a single-pass scanner; repeated `find_code_unit()` probes
-    // per literal turn miss-heavy inputs quadratic.
-    if hint.includes_input_start && hint.literal_code_units.len() == 1 {
+    // Larger literal sets can't be scanned for in a single pass.
+    if !hint.literal_code_units.is_empty() && hint.literal_code_units.len() <= scan::MAX_CODE_UNIT_SET_LEN {
         Some(hint)
     } else {
         None
@@ -1124,15 +1279,65 @@ fn analyze_start_position_hint(instructions: &[Instruction], start: usize) -> Op
 
 #[inline(always)]
 fn next_literal_start_from_hint<I: Input>(input: I, start: usize, hint: &StartPositionHint) -> Option<usize> {
-    let [literal] = hint.literal_code_units.as_slice() else {
-        return None;
-    };
-
     if hint.includes_input_start && start == 0 {
         return Some(0);
     }
 
-    input.next_literal_start(start, *literal)
+    input.find_code_unit_in_set(start, input.len(), &hint.literal_code_units)
+}
+
+/// Collect the code units a match must start with, if `first_char` or
+/// `first_filter` narrow them down to at most `scan::MAX_CODE_UNIT_SET_LEN`.
+fn first_code_unit_set(
+    program: &Program,
+    first_char: Option<(u32, bool)>,
+    first_filter: Option<&SimpleMatch>,
+) -> Option<Vec<u16>> {
+    // Unicode mode matches whole code points, which a code unit set can't describe.
+    if program.unicode {
+        return None;
+    }
+
+    let mut code_units = Vec::new();
+    match (first_char, first_filter) {
+        (Some((ch, false)), _) => code_units.push(u16::try_from(ch).ok()?),
+        // Outside Unicode mode, Canonicalize() never maps a non-ASCII character
+        // to an ASCII one, so an ASCII character only matches its ASCII cases.
+        (Some((ch, true)), _) => {
+            for variant in ascii_case_variants(u16::try_from(ch).ok()?)? {
+                if !code_units.contains(&variant) {
+                    code_units.push(variant);
+                }
+            }
+        }
+        (None, Some(filter)) => collect_filter_code_units(filter, &mut code_units)?,
+        (None, None) => return None,
+    }
+    Some(code_units)
+}
+
+fn collect_filter_code_units(filter: &SimpleMatch, code_units: &mut Vec<u16>) -> Option<()> {
+    match filter {
+        SimpleMatch::Char(c) => code_units.push(u16::try_from(*c).ok()?),
+        SimpleMatch::CharClass { ranges, negated: false } => {
+            for range in ranges {
+                if range.end - range.start >= scan::MAX_CODE_UNIT_SET_LEN as u32 {
+                    return None;
+                }
+                for cp in range.start..=range.end {
+                    code_units.push(u16::try_from(cp).ok()?);
+                }
+            }
+        }
+        SimpleMatch::Union(lhs, rhs) => {
+            collect_filter_code_units(lhs, code_units)?;
+            collect_filter_code_units(rhs, code_units)?;
+        }
+        _ => return None,
+    }
+    code_units.sort_unstable();
+    code_units.dedup();
+    (code_units.len() <= scan::MAX_CODE_UNIT_SET_LEN).then_some(())
 }
 
 /// Analyze the program to extract optimization hints.
@@ -1190,6 +1395,8 @@ pub(crate) fn analyze_pattern(
         None
     };
 
+    let first_code_units = first_code_unit_set(program, first_char, first_filter.as_ref());
+
     let (starts_with_anchor, anchor_multiline) = match leading_start_anchor_at(&program.instructions, skip) {
         Some(multiline) => (true, multiline || program.multiline),
         _ => (false, false),
@@ -1266,12 +1473,14 @@ pub(crate) fn analyze_pattern(
         first_char,
         first_filter,
         start_position_hint,
+        first_code_units,
         starts_with_anchor,
         anchor_multiline,
         trailing_literal,
         required_literal,
         simple_scan,
         can_match_empty,
+        has_linear_fallback: false,
     }
 }
 
@@ -1341,10 +1550,21 @@ enum SavedState {
 
 /// Active modifier flags during execution.
 #[derive(Clone, Copy)]
-struct ActiveModifiers {
-    ignore_case: bool,
-    multiline: bool,
-    dot_all: bool,
+pub(crate) struct ActiveModifiers {
+    pub(crate) ignore_case: bool,
+    pub(crate) multiline: bool,
+    pub(crate) dot_all: bool,
+}
+
+impl ActiveModifiers {
+    /// The flags in effect outside of any modifier group.
+    pub(crate) fn for_program(program: &Program) -> Self {
+        Self {
+            ignore_case: program.ignore_case,
+            multiline: program.multiline,
+            dot_all: program.dot_all,
+        }
+    }
 }
 
 /// Reusable scratch space for the VM. Cached in the Regex struct to avoid
@@ -1355,6 +1575,11 @@ pub struct VmScratch {
     backtrack_stack: Vec<SavedState>,
     register_pool: Vec<i32>,
     modifier_stack: Vec<ActiveModifiers>,
+    /// How often the program has been executed, to decide when to compile it.
+    executions: u32,
+    /// The program lowered for the second tier, once it's hot (and if it's supported).
+    compiled: Option<Box<CompiledProgram>>,
+    compiled_scratch: CompiledScratch,
 }
 
 impl VmScratch {
@@ -1380,6 +1605,8 @@ struct Vm<'a, I: Input> {
     backward: bool,
     /// Backtrack floor: prevents backtracking past this depth during lookaround bodies.
     bt_floor: usize,
+    compiled: Option<&'a CompiledProgram>,
+    compiled_scratch: &'a mut CompiledScratch,
 }
 
 impl<'a, I: Input> Vm<'a, I> {
@@ -1391,6 +1618,10 @@ impl<'a, I: Input> Vm<'a, I> {
         scratch.backtrack_stack.clear();
         scratch.register_pool.clear();
         scratch.modifier_stack.clear();
+        scratch.executions = scratch.executions.saturating_add(1);
+        if scratch.executions == TIER_UP_THRESHOLD {
+            scratch.compiled = CompiledProgram::compile(program).map(Box::new);
+        }
         Self {
             program,
             input,
@@ -1400,14 +1631,12 @@ impl<'a, I: Input> Vm<'a, I> {
             backtrack_stack: &mut scratch.backtrack_stack,
             register_pool: &mut scratch.register_pool,
             steps: 0,
-            modifiers: ActiveModifiers {
-                ignore_case: program.ignore_case,
-                multiline: program.multiline,
-                dot_all: program.dot_all,
-            },
+            modifiers: ActiveModifiers::for_program(program),
             modifier_stack: &mut scratch.modifier_stack,
             backward: false,
             bt_floor: 0,
+            compiled: scratch.compiled.as_deref(),
+            compiled_scratch: &mut scratch.compiled_scratch,
         }
     }
 
@@ -1431,17 +1660,21 @@ impl<'a, I: Input> Vm<'a, I> {
         self.backtrack_stack.clear();
         self.register_pool.clear();
         self.steps = 0;
-        self.modifiers = ActiveModifiers {
-            ignore_case: self.program.ignore_case,
-            multiline: self.program.multiline,
-            dot_all: self.program.dot_all,
-        };
+        self.modifiers = ActiveModifiers::for_program(self.program);
         self.modifier_stack.clear();
         self.backward = false;
         self.bt_floor = 0;
     }
 
     fn run(&mut self) -> VmResult {
+        if let Some(compiled) = self.compiled {
+            let result = compiled.run(self.input, self.pos, self.registers, self.compiled_scratch);
+            if result != VmResult::LimitExceeded {
+                return result;
+            }
+            // The tiers prune backtracking differently, so only the VM gets to decide that the limit was hit.
+            self.reset(self.pos);
+        }
         // Use the fast path for non-Unicode, forward-only patterns.
         if !self.program.unicode && !self.backward {
             return self.run_fast();
@@ -3218,18 +3451,7 @@ impl<'a, I: Input> Vm<'a, I> {
     /// - <https://tc39.es/ecma262/#sec-compileassertion>
     /// - <https://tc39.es/ecma262/#sec-wordcharacters>
     fn at_word_boundary(&self) -> bool {
-        let uic = self.modifiers.ignore_case && self.program.unicode;
-        let before = if self.pos > 0 {
-            is_word_char_unicode(self.input_code_unit(self.pos - 1) as u32, uic)
-        } else {
-            false
-        };
-        let after = if self.pos < self.input_len() {
-            is_word_char_unicode(self.input_code_unit(self.pos) as u32, uic)
-        } else {
-            false
-        };
-        before != after
+        is_at_word_boundary(self.input, self.pos, self.modifiers.ignore_case && self.program.unicode)
     }
 
     /// Implement `BackreferenceMatcher` for a numbered capture.
@@ -3449,7 +3671,7 @@ pub(crate) fn case_fold_eq(a: u32, b: u32, unicode_mode: bool) -> bool {
 }
 
 #[inline(always)]
-fn is_word_char(cp: u32) -> bool {
+pub(crate) fn is_word_char(cp: u32) -> bool {
     matches!(cp, 0x30..=0x39 | 0x41..=0x5A | 0x61..=0x7A | 0x5F)
 }
 
@@ -3467,6 +3689,15 @@ fn is_word_char_unicode(cp: u32, unicode_ignore_case: bool) -> bool {
     false
 }
 
+/// Check for a word boundary between `pos - 1` and `pos`.
+/// <https://tc39.es/ecma262/#sec-runtime-semantics-iswordchar-abstract-operation>
+#[inline(always)]
+pub(crate) fn is_at_word_boundary<I: Input>(input: I, pos: usize, unicode_ignore_case: bool) -> bool {
+    let before = pos > 0 && is_word_char_unicode(input.code_unit(pos - 1) as u32, unicode_ignore_case);
+    let after = pos < input.len() && is_word_char_unicode(input.code_unit(pos) as u32, unicode_ignore_case);
+    before != after
+}
+
 #[inline(always)]
 fn is_digit(cp: u32) -> bool {
     (0x30..=0x39).contains(&cp)
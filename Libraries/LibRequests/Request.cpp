@@ -261,6 +261,12 @@ void Request::did_receive_headers(Badge<RequestClient>, NonnullRefPtr<HTTP::Head
         on_headers_received(move(response_headers), response_code, reason_phrase, move(javascript_bytecode), javascript_bytecode_cache_vary_key, came_from_cache);
 }
 
+void Request::did_receive_early_hints(Badge<RequestClient>, NonnullRefPtr<HTTP::HeaderList> hints)
+{
+    if (on_early_hints)
+        on_early_hints(move(hints));
+}
+
 void Request::did_request_certificates(Badge<RequestClient>)
 {
     if (on_certificate_requested) {
@@ -290,6 +296,7 @@ void Request::defer_teardown()
         self->on_headers_received = nullptr;
         self->on_finish = nullptr;
         self->on_certificate_requested = nullptr;
+        self->on_early_hints = nullptr;
         self->m_internal_buffered_data = nullptr;
         self->m_internal_stream_data = nullptr;
     });
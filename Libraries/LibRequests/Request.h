@@ -117,8 +117,12 @@ public:
 
     Function<CertificateAndKey()> on_certificate_requested;
 
+    // Invoked with the headers of each 103 (Early Hints) response that precedes the final response.
+    Function<void(NonnullRefPtr<HTTP::HeaderList> hints)> on_early_hints;
+
     void did_finish(Badge<RequestClient>, u64 total_size, RequestTimingInfo const& timing_info, Optional<NetworkError> const& network_error);
     void did_receive_headers(Badge<RequestClient>, NonnullRefPtr<HTTP::HeaderList> response_headers, Optional<u32> response_code, Optional<String> const& reason_phrase, Optional<Core::ImmutableBytes> javascript_bytecode, Optional<u64> javascript_bytecode_cache_vary_key, CameFromCache came_from_cache);
+    void did_receive_early_hints(Badge<RequestClient>, NonnullRefPtr<HTTP::HeaderList> hints);
     void did_request_certificates(Badge<RequestClient>);
     void did_transfer(Badge<RequestClient>);
 
@@ -77,12 +77,12 @@ void RequestClient::die()
     }
 }
 
-RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL const& url, Optional<HTTP::HeaderList const&> request_headers, ReadonlyBytes request_body, HTTP::CacheMode cache_mode, HTTP::Cookie::IncludeCredentials include_credentials, Core::ProxyData const& proxy_data, KeepAliveForTransfer keep_alive_for_transfer)
+RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL const& url, Optional<HTTP::HeaderList const&> request_headers, ReadonlyBytes request_body, HTTP::CacheMode cache_mode, HTTP::Cookie::IncludeCredentials include_credentials, Core::ProxyData const& proxy_data, KeepAliveForTransfer keep_alive_for_transfer, RequestServer::RequestPriority priority)
 {
     auto request_id = m_next_request_id++;
     auto headers = request_headers.map([](auto const& headers) { return headers.headers().span(); }).value_or({});
 
-    IPCProxy::async_start_request(request_id, method, url, headers, request_body, cache_mode, include_credentials, proxy_data, keep_alive_for_transfer == KeepAliveForTransfer::Yes);
+    IPCProxy::async_start_request(request_id, method, url, headers, request_body, cache_mode, include_credentials, proxy_data, keep_alive_for_transfer == KeepAliveForTransfer::Yes, priority);
     auto request = Request::create_from_id({}, *this, request_id);
     m_requests.set(request_id, request);
     return request;
@@ -231,6 +231,12 @@ void RequestClient::request_transferred(u64 request_id)
     (*request)->did_transfer({});
 }
 
+void RequestClient::early_hints_received(u64 request_id, Vector<HTTP::Header> hints)
+{
+    if (auto request = m_requests.get(request_id); request.has_value())
+        (*request)->did_receive_early_hints({}, HTTP::HeaderList::create(move(hints)));
+}
+
 void RequestClient::retrieve_http_cookie(int client_id, u64 request_id, RequestServer::RequestType request_type, URL::URL url, RequestServer::IsPrivate is_private)
 {
     String cookie;
@@ -262,10 +268,30 @@ void RequestClient::websocket_connected(u64 websocket_id)
         (*connection)->did_open({});
 }
 
-void RequestClient::websocket_received(u64 websocket_id, bool is_text, ByteBuffer data)
+void RequestClient::websocket_received(u64 websocket_id, Vector<WebSocket::Message> messages)
 {
-    if (auto connection = m_websockets.get(websocket_id); connection.has_value())
-        (*connection)->did_receive({}, move(data), is_text);
+    auto connection = m_websockets.get(websocket_id);
+    if (!connection.has_value())
+        return;
+
+    // Keep the connection alive while delivering the batch, in case a message handler closes it.
+    NonnullRefPtr websocket = *connection;
+    for (auto& message : messages)
+        websocket->did_receive({}, move(message.data), message.is_text);
+}
+
+void RequestClient::websocket_received_shared(u64 websocket_id, bool is_text, Core::AnonymousBuffer data)
+{
+    auto connection = m_websockets.get(websocket_id);
+    if (!connection.has_value())
+        return;
+
+    auto byte_buffer_or_error = ByteBuffer::copy(data.bytes());
+    if (byte_buffer_or_error.is_error()) {
+        dbgln("websocket_received_shared: failed to copy {} bytes from shared buffer: {}", data.size(), byte_buffer_or_error.error());
+        return;
+    }
+    (*connection)->did_receive({}, byte_buffer_or_error.release_value(), is_text);
 }
 
 void RequestClient::websocket_errored(u64 websocket_id, i32 message)
@@ -19,6 +19,7 @@
 #include <LibRequests/WebSocket.h>
 #include <LibWebSocket/WebSocket.h>
 #include <RequestServer/IsPrivate.h>
+#include <RequestServer/RequestPriority.h>
 #include <RequestServer/RequestClientEndpoint.h>
 #include <RequestServer/RequestServerEndpoint.h>
 
@@ -42,7 +43,7 @@ public:
     explicit RequestClient(NonnullOwnPtr<IPC::Transport>);
     virtual ~RequestClient() override;
 
-    RefPtr<Request> start_request(ByteString const& method, URL::URL const&, Optional<HTTP::HeaderList const&> request_headers = {}, ReadonlyBytes request_body = {}, HTTP::CacheMode = HTTP::CacheMode::Default, HTTP::Cookie::IncludeCredentials = HTTP::Cookie::IncludeCredentials::Yes, Core::ProxyData const& = {}, KeepAliveForTransfer = KeepAliveForTransfer::No);
+    RefPtr<Request> start_request(ByteString const& method, URL::URL const&, Optional<HTTP::HeaderList const&> request_headers = {}, ReadonlyBytes request_body = {}, HTTP::CacheMode = HTTP::CacheMode::Default, HTTP::Cookie::IncludeCredentials = HTTP::Cookie::IncludeCredentials::Yes, Core::ProxyData const& = {}, KeepAliveForTransfer = KeepAliveForTransfer::No, RequestServer::RequestPriority = RequestServer::RequestPriority::Normal);
     RefPtr<Request> adopt_request(int source_client_id, u64 source_request_id);
     bool stop_request(Badge<Request>, Request&);
     void release_request_for_transfer(Badge<Request>, Request&);
@@ -70,13 +71,15 @@ private:
     virtual void request_finished(u64 request_id, u64, RequestTimingInfo, Optional<NetworkError>) override;
     virtual void headers_became_available(u64 request_id, Vector<HTTP::Header>, Optional<u32>, Optional<String>, Optional<IPC::File>, u64 javascript_bytecode_size, Optional<u64>, CameFromCache) override;
     virtual void request_transferred(u64 request_id) override;
+    virtual void early_hints_received(u64 request_id, Vector<HTTP::Header>) override;
 
     virtual void retrieve_http_cookie(int client_id, u64 request_id, RequestServer::RequestType request_type, URL::URL url, RequestServer::IsPrivate) override;
 
     virtual void certificate_requested(u64 request_id) override;
 
     virtual void websocket_connected(u64 websocket_id) override;
-    virtual void websocket_received(u64 websocket_id, bool, ByteBuffer) override;
+    virtual void websocket_received(u64 websocket_id, Vector<WebSocket::Message>) override;
+    virtual void websocket_received_shared(u64 websocket_id, bool, Core::AnonymousBuffer) override;
     virtual void websocket_errored(u64 websocket_id, i32) override;
     virtual void websocket_closed(u64 websocket_id, u16, ByteString, bool) override;
     virtual void websocket_ready_state_changed(u64 websocket_id, u32 ready_state) override;
@@ -5,13 +5,13 @@
  */
 
 #include <LibCore/AnonymousBuffer.h>
+#include <LibIPC/Decoder.h>
+#include <LibIPC/Encoder.h>
 #include <LibRequests/RequestClient.h>
 #include <LibRequests/WebSocket.h>
 
 namespace Requests {
 
-static constexpr size_t WEBSOCKET_SHARED_MEMORY_THRESHOLD = 16 * MiB;
-
 WebSocket::WebSocket(RequestClient& client, u64 websocket_id)
     : m_client(client)
     , m_websocket_id(websocket_id)
@@ -42,7 +42,7 @@ void WebSocket::send(ReadonlyBytes binary_or_text_message, bool is_text)
 {
     if (!m_client)
         return;
-    if (binary_or_text_message.size() >= WEBSOCKET_SHARED_MEMORY_THRESHOLD) {
+    if (binary_or_text_message.size() >= SHARED_MEMORY_THRESHOLD) {
         auto buffer_or_error = Core::AnonymousBuffer::create_with_size(binary_or_text_message.size());
         if (!buffer_or_error.is_error()) {
             auto buffer = buffer_or_error.release_value();
@@ -106,3 +106,23 @@ void WebSocket::detach_from_client(Badge<RequestClient>)
 }
 
 }
+
+namespace IPC {
+
+template<>
+ErrorOr<void> encode(Encoder& encoder, Requests::WebSocket::Message const& message)
+{
+    TRY(encoder.encode(message.data));
+    TRY(encoder.encode(message.is_text));
+    return {};
+}
+
+template<>
+ErrorOr<Requests::WebSocket::Message> decode(Decoder& decoder)
+{
+    auto data = TRY(decoder.decode<ByteBuffer>());
+    auto is_text = TRY(decoder.decode<bool>());
+    return Requests::WebSocket::Message { move(data), is_text };
+}
+
+}
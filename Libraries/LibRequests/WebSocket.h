@@ -12,6 +12,7 @@
 #include <AK/Function.h>
 #include <AK/RefCounted.h>
 #include <AK/WeakPtr.h>
+#include <LibIPC/Forward.h>
 
 namespace Requests {
 
@@ -42,6 +43,9 @@ public:
         Closed = 3,
     };
 
+    // Messages at least this large are passed between processes through shared memory rather than over the socket.
+    static constexpr size_t SHARED_MEMORY_THRESHOLD = 16 * MiB;
+
     static NonnullRefPtr<WebSocket> create_from_id(Badge<RequestClient>, RequestClient& client, u64 websocket_id)
     {
         return adopt_ref(*new WebSocket(client, websocket_id));
@@ -82,3 +86,13 @@ private:
 };
 
 }
+
+namespace IPC {
+
+template<>
+ErrorOr<void> encode(Encoder&, Requests::WebSocket::Message const&);
+
+template<>
+ErrorOr<Requests::WebSocket::Message> decode(Decoder&);
+
+}
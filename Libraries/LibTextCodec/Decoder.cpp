@@ -7,6 +7,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
 #include <AK/Utf16StringBuilder.h>
 #include <AK/Utf8View.h>
@@ -21,28 +22,35 @@ class RustDecoder final : public Decoder {
 public:
     explicit RustDecoder(StringView encoding)
         : m_encoding(encoding)
+        , m_is_ascii_compatible(!encoding.is_one_of("ISO-2022-JP"sv, "replacement"sv))
     {
     }
 
     virtual ErrorOr<String> to_utf8(StringView input, IgnoreBOM, ErrorMode) override;
+    virtual ErrorOr<Utf16String> to_utf16(StringView input) override;
     virtual ErrorOr<size_t> length_in_utf16_code_units(StringView input) override;
 
 private:
     virtual ErrorOr<void> process(StringView input, Function<ErrorOr<void>(u32)> on_code_point) override;
 
     StringView m_encoding;
+
+    // Whether ASCII bytes always decode to the same ASCII characters, which lets pure ASCII input skip decoding.
+    bool m_is_ascii_compatible { true };
 };
 
 class UTF8Decoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
     virtual ErrorOr<String> to_utf8(StringView, IgnoreBOM, ErrorMode) override;
+    virtual ErrorOr<Utf16String> to_utf16(StringView) override;
     virtual ErrorOr<size_t> length_in_utf16_code_units(StringView) override;
 };
 
 class UTF16BEDecoder final : public Decoder {
 public:
     virtual ErrorOr<String> to_utf8(StringView, IgnoreBOM, ErrorMode) override;
+    virtual ErrorOr<Utf16String> to_utf16(StringView) override;
     virtual ErrorOr<size_t> length_in_utf16_code_units(StringView) override;
 
 private:
@@ -52,6 +60,7 @@ private:
 class UTF16LEDecoder final : public Decoder {
 public:
     virtual ErrorOr<String> to_utf8(StringView, IgnoreBOM, ErrorMode) override;
+    virtual ErrorOr<Utf16String> to_utf16(StringView) override;
     virtual ErrorOr<size_t> length_in_utf16_code_units(StringView) override;
 
 private:
@@ -61,6 +70,7 @@ private:
 class Latin1Decoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
+    virtual ErrorOr<Utf16String> to_utf16(StringView) override;
     virtual ErrorOr<size_t> length_in_utf16_code_units(StringView) override;
 };
 
@@ -162,6 +172,19 @@ ErrorOr<Utf16String> rust_streaming_decode_to_utf16(FFI::TextCodecRustStreamingD
     return context.builder.to_string();
 }
 
+// Decodes the whole input in one go, straight into UTF-16, rather than going through UTF-8 first.
+ErrorOr<Utf16String> rust_decode_to_utf16(StringView encoding, StringView input, IgnoreBOM ignore_bom, ErrorMode error_mode)
+{
+    auto* decoder = FFI::textcodec_rust_streaming_decoder_new(
+        reinterpret_cast<u8 const*>(encoding.characters_without_null_termination()),
+        encoding.length(),
+        ignore_bom == IgnoreBOM::No);
+    VERIFY(decoder);
+    ScopeGuard free_decoder = [&] { FFI::textcodec_rust_streaming_decoder_free(decoder); };
+
+    return rust_streaming_decode_to_utf16(decoder, input.bytes(), true, error_mode);
+}
+
 ErrorOr<void> rust_process(StringView encoding, StringView input, IgnoreBOM ignore_bom, Function<ErrorOr<void>(u32)> on_code_point)
 {
     auto utf8 = TRY(rust_decode_to_utf8(encoding, input, ignore_bom, ErrorMode::Replacement));
@@ -478,8 +501,17 @@ ErrorOr<String> RustDecoder::to_utf8(StringView input, IgnoreBOM ignore_bom, Err
     return rust_decode_to_utf8(m_encoding, input, ignore_bom, error_mode);
 }
 
+ErrorOr<Utf16String> RustDecoder::to_utf16(StringView input)
+{
+    if (m_is_ascii_compatible && input.is_ascii())
+        return Utf16String::from_ascii_without_validation(input.bytes());
+    return rust_decode_to_utf16(m_encoding, input, IgnoreBOM::Yes, ErrorMode::Replacement);
+}
+
 ErrorOr<size_t> RustDecoder::length_in_utf16_code_units(StringView input)
 {
+    if (m_is_ascii_compatible && input.is_ascii())
+        return input.length();
     return rust_length_in_utf16_code_units(m_encoding, input, IgnoreBOM::Yes);
 }
 
@@ -495,6 +527,11 @@ ErrorOr<void> Latin1Decoder::process(StringView input, Function<ErrorOr<void>(u3
     return {};
 }
 
+ErrorOr<Utf16String> Latin1Decoder::to_utf16(StringView input)
+{
+    return isomorphic_decode_to_utf16(input);
+}
+
 ErrorOr<size_t> Latin1Decoder::length_in_utf16_code_units(StringView input)
 {
     return input.length();
@@ -545,8 +582,27 @@ ErrorOr<String> UTF8Decoder::to_utf8(StringView input, IgnoreBOM ignore_bom, Err
     return rust_decode_to_utf8("UTF-8"sv, input, ignore_bom, error_mode);
 }
 
+ErrorOr<Utf16String> UTF8Decoder::to_utf16(StringView input)
+{
+    // Well-formed input is converted directly, only malformed input needs the decoder to insert replacement characters.
+    if (Utf8View { input }.validate(AllowLonelySurrogates::No))
+        return Utf16String::from_utf8_without_validation(input);
+    return rust_decode_to_utf16("UTF-8"sv, input, IgnoreBOM::Yes, ErrorMode::Replacement);
+}
+
 ErrorOr<size_t> UTF8Decoder::length_in_utf16_code_units(StringView input)
 {
+    if (input.bytes().starts_with({ { 0xEF, 0xBB, 0xBF } }))
+        input = input.substring_view(3);
+
+    if (Utf8View { input }.validate(AllowLonelySurrogates::No)) {
+        // Every code point starts with a byte that is not a continuation byte, and those of four bytes need a
+        // surrogate pair.
+        size_t length = 0;
+        for (auto byte : input.bytes())
+            length += static_cast<size_t>((byte & 0xc0) != 0x80) + static_cast<size_t>(byte >= 0xf0);
+        return length;
+    }
     return rust_length_in_utf16_code_units("UTF-8"sv, input, IgnoreBOM::No);
 }
 
@@ -560,6 +616,11 @@ ErrorOr<String> UTF16BEDecoder::to_utf8(StringView input, IgnoreBOM ignore_bom,
     return rust_decode_to_utf8("UTF-16BE"sv, input, ignore_bom, error_mode);
 }
 
+ErrorOr<Utf16String> UTF16BEDecoder::to_utf16(StringView input)
+{
+    return rust_decode_to_utf16("UTF-16BE"sv, input, IgnoreBOM::No, ErrorMode::Replacement);
+}
+
 ErrorOr<size_t> UTF16BEDecoder::length_in_utf16_code_units(StringView input)
 {
     return rust_length_in_utf16_code_units("UTF-16BE"sv, input, IgnoreBOM::No);
@@ -575,6 +636,11 @@ ErrorOr<String> UTF16LEDecoder::to_utf8(StringView input, IgnoreBOM ignore_bom,
     return rust_decode_to_utf8("UTF-16LE"sv, input, ignore_bom, error_mode);
 }
 
+ErrorOr<Utf16String> UTF16LEDecoder::to_utf16(StringView input)
+{
+    return rust_decode_to_utf16("UTF-16LE"sv, input, IgnoreBOM::No, ErrorMode::Replacement);
+}
+
 ErrorOr<size_t> UTF16LEDecoder::length_in_utf16_code_units(StringView input)
 {
     return rust_length_in_utf16_code_units("UTF-16LE"sv, input, IgnoreBOM::No);
@@ -600,10 +666,13 @@ Utf16String isomorphic_decode_to_utf16(StringView input)
     // To isomorphic decode a byte sequence input, return a string whose code point length is equal to input’s length
     // and whose code points have the same values as the values of input’s bytes, in the same order.
     // NB: This is essentially spec-speak for "Decode as ISO-8859-1 / Latin-1".
+    if (input.is_ascii())
+        return Utf16String::from_ascii_without_validation(input.bytes());
+
     Utf16StringBuilder builder(input.length());
 
     for (auto byte : input.bytes())
-        builder.append_code_point(byte);
+        builder.append_code_unit(byte);
 
     return builder.to_string();
 }
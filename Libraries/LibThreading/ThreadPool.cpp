@@ -4,9 +4,17 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
+#include <AK/Atomic.h>
+#include <AK/CharacterTypes.h>
+#include <AK/GenericLexer.h>
+#include <AK/RefCounted.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
 #include <LibThreading/ThreadPool.h>
 
-static constexpr size_t THREAD_COUNT = 4;
+static constexpr size_t MINIMUM_THREAD_COUNT = 2;
+static constexpr size_t MAXIMUM_THREAD_COUNT = 16;
 static constexpr size_t THREAD_STACK_SIZE = 8 * MiB;
 
 namespace Threading {
@@ -17,9 +25,48 @@ ThreadPool& ThreadPool::the()
     return *instance;
 }
 
+#if defined(AK_OS_LINUX)
+// Containers commonly limit our CPU time through the cgroup v2 CPU controller, in which case the online CPU count
+// overstates how many threads can actually run at once.
+static Optional<size_t> cgroup_cpu_limit()
+{
+    auto file = Core::File::open("/sys/fs/cgroup/cpu.max"sv, Core::File::OpenMode::Read);
+    if (file.is_error())
+        return {};
+
+    auto contents = file.value()->read_until_eof();
+    if (contents.is_error())
+        return {};
+
+    // The file contains "<quota> <period>", where the quota is "max" if there is no limit.
+    GenericLexer lexer { StringView { contents.value() } };
+    auto quota = lexer.consume_until(' ').to_number<u64>();
+    lexer.ignore_while(is_ascii_space);
+    auto period = lexer.consume_until(is_ascii_space).to_number<u64>();
+
+    if (!quota.has_value() || !period.has_value() || *period == 0)
+        return {};
+    return max(ceil_div(*quota, *period), 1u);
+}
+#endif
+
+size_t ThreadPool::available_parallelism()
+{
+    size_t parallelism = max(Core::System::hardware_concurrency(), 1u);
+
+#if defined(AK_OS_LINUX)
+    if (auto limit = cgroup_cpu_limit(); limit.has_value())
+        parallelism = min(parallelism, *limit);
+#endif
+
+    return parallelism;
+}
+
 ThreadPool::ThreadPool()
 {
-    for (size_t i = 0; i < THREAD_COUNT; ++i) {
+    auto thread_count = clamp(available_parallelism(), MINIMUM_THREAD_COUNT, MAXIMUM_THREAD_COUNT);
+
+    for (size_t i = 0; i < thread_count; ++i) {
         auto name = ByteString::formatted("Pool/{}", i);
         auto thread = Thread::construct(name, [this]() -> intptr_t {
             return worker_thread_func();
@@ -32,24 +79,98 @@ ThreadPool::ThreadPool()
 
 intptr_t ThreadPool::worker_thread_func()
 {
+    auto has_work = [this] {
+        return any_of(m_work_queues, [](auto const& queue) { return !queue.is_empty(); });
+    };
+
     while (true) {
         Function<void()> work;
 
         {
             Sync::MutexLocker locker(m_mutex);
-            m_condition.wait_while([this] { return m_work_queue.is_empty(); });
-            work = m_work_queue.dequeue();
+            m_condition.wait_while([&] { return !has_work(); });
+
+            // Lanes are strictly ordered: lower priority work only runs once all higher priority work has started.
+            for (auto& queue : m_work_queues) {
+                if (!queue.is_empty()) {
+                    work = queue.dequeue();
+                    break;
+                }
+            }
         }
 
         work();
     }
 }
 
-void ThreadPool::submit(Function<void()> work)
+void ThreadPool::submit(Function<void()> work, TaskPriority priority)
 {
     Sync::MutexLocker locker(m_mutex);
-    m_work_queue.enqueue(move(work));
+    m_work_queues[to_underlying(priority)].enqueue(move(work));
     m_condition.signal();
 }
 
+void ThreadPool::parallel_for(size_t count, Function<void(size_t)> const& body, TaskPriority priority)
+{
+    if (count == 0)
+        return;
+    if (count == 1) {
+        body(0);
+        return;
+    }
+
+    // Helpers that are only dequeued after the loop has finished must still find valid state, so it is refcounted
+    // rather than living on our stack.
+    struct LoopState : public RefCounted<LoopState> {
+        LoopState(size_t count, Function<void(size_t)> const& body)
+            : count(count)
+            , body(body)
+        {
+        }
+
+        void run_iterations()
+        {
+            size_t completed = 0;
+            for (auto index = next_index.fetch_add(1); index < count; index = next_index.fetch_add(1)) {
+                body(index);
+                ++completed;
+            }
+            if (completed == 0)
+                return;
+
+            Sync::MutexLocker locker(mutex);
+            completed_count += completed;
+            if (completed_count == count)
+                condition.broadcast();
+        }
+
+        size_t const count;
+        Function<void(size_t)> const& body;
+        Atomic<size_t> next_index { 0 };
+
+        Sync::Mutex mutex;
+        Sync::ConditionVariable condition { mutex };
+        size_t completed_count { 0 };
+    };
+
+    auto state = adopt_ref(*new LoopState(count, body));
+
+    // The calling thread runs iterations too, so we only need enough helpers to occupy the rest of the pool.
+    auto helper_count = min(count - 1, thread_count());
+    for (size_t i = 0; i < helper_count; ++i)
+        submit([state] { state->run_iterations(); }, priority);
+
+    state->run_iterations();
+
+    // Any iterations we did not run ourselves have already been claimed by a running helper, so this cannot wait on
+    // work that is still queued.
+    Sync::MutexLocker locker(state->mutex);
+    state->condition.wait_while([&] { return state->completed_count < count; });
+}
+
+void ThreadPool::submit_and_wait(Vector<Function<void()>>& work, TaskPriority priority)
+{
+    parallel_for(work.size(), [&](size_t index) { work[index](); }, priority);
+}
+
 }
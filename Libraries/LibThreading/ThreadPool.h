@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/Function.h>
 #include <AK/Queue.h>
 #include <AK/Vector.h>
@@ -15,20 +16,42 @@
 
 namespace Threading {
 
+enum class TaskPriority : u8 {
+    // Work that the user is actively waiting on, e.g. a parallel loop blocking the main thread.
+    UserBlocking,
+    // Work whose result will become visible to the user, e.g. decoding an image on the page.
+    UserVisible,
+    // Work that nobody is waiting on, e.g. populating caches.
+    Background,
+};
+
 class ThreadPool {
 public:
     static ThreadPool& the();
 
-    void submit(Function<void()>);
+    void submit(Function<void()>, TaskPriority = TaskPriority::UserVisible);
+
+    // Runs body(0) through body(count - 1) across the pool and returns once all of them have completed. The calling
+    // thread takes part in running the loop, so this is safe to call from a pool worker as well.
+    void parallel_for(size_t count, Function<void(size_t)> const& body, TaskPriority = TaskPriority::UserBlocking);
+
+    // Runs all of the given work concurrently and returns once every item has completed.
+    void submit_and_wait(Vector<Function<void()>>&, TaskPriority = TaskPriority::UserBlocking);
+
+    size_t thread_count() const { return m_threads.size(); }
+
+    static size_t available_parallelism();
 
 private:
     ThreadPool();
 
     intptr_t worker_thread_func();
 
+    static constexpr size_t priority_count = to_underlying(TaskPriority::Background) + 1;
+
     Sync::Mutex m_mutex;
     Sync::ConditionVariable m_condition { m_mutex };
-    Queue<Function<void()>> m_work_queue;
+    Array<Queue<Function<void()>>, priority_count> m_work_queues;
     Vector<NonnullRefPtr<Thread>> m_threads;
 };
 
@@ -27,6 +27,11 @@ pub(crate) fn get_output_encoding(encoding: &str) -> &str {
     encoding
 }
 
+// Whether encoding ASCII input with the given encoding gives back the same bytes.
+pub(crate) fn is_ascii_compatible(encoding: &str) -> bool {
+    Encoding::for_label(encoding.as_bytes()).is_some_and(|encoding| encoding.output_encoding().is_ascii_compatible())
+}
+
 pub(crate) fn encode_into(encoding: &str, input: &str, mut on_item: impl FnMut(EncodeItem)) -> bool {
     let Some(encoding) = Encoding::for_label(encoding.as_bytes()) else {
         return false;
@@ -596,7 +596,12 @@ pub(crate) fn parse_host(input: &str, is_opaque: bool) -> Option<Host> {
     assert!(!input.is_empty());
 
     // 4. Let domain be the result of running UTF-8 decode without BOM on the percent-decoding of input.
-    let domain = String::from_utf8_lossy(&percent_decode(input)).into_owned();
+    // OPTIMIZATION: Input without any percent signs decodes to itself.
+    let domain = if input.contains('%') {
+        String::from_utf8_lossy(&percent_decode(input)).into_owned()
+    } else {
+        input.to_string()
+    };
 
     // 5. Let asciiDomain be the result of running domain to ASCII with domain and false.
     // 6. If asciiDomain is failure, then return failure.
@@ -6,6 +6,7 @@
 
 use crate::textcodec::EncodeItem;
 use crate::textcodec::encode_into as textcodec_encode_into;
+use crate::textcodec::is_ascii_compatible;
 
 #[allow(dead_code)]
 #[repr(u8)]
@@ -151,26 +152,37 @@ pub(super) fn percent_encode_after_encoding(
     // 1. Let encoder be the result of getting an encoder from encoding.
     // 2. Let inputQueue be input converted to an I/O queue.
     // 3. Let output be the empty string.
-    let mut result = String::new();
+    let mut result = String::with_capacity(input.len());
 
-    let did_succeed = textcodec_encode_into(encoding, input, |item| match item {
-        EncodeItem::Byte(byte) => {
-            // 1. If spaceAsPlus is true and byte is 0x20 (SP), then append U+002B (+) to output and continue.
-            if space_as_plus && byte == b' ' {
-                result.push('+');
-                return;
-            }
-
-            // 2. Let isomorph be a code point whose value is byte’s value.
-            let code_point = char::from(byte);
-
-            // 4. If isomorphic is not in percentEncodeSet, then append isomorph to output.
-            if !code_point_is_in_percent_encode_set(code_point, set) {
-                result.push(code_point);
-            } else {
-                append_percent_encoded_byte(&mut result, byte);
-            }
+    let append_byte = |result: &mut String, byte: u8| {
+        // 1. If spaceAsPlus is true and byte is 0x20 (SP), then append U+002B (+) to output and continue.
+        if space_as_plus && byte == b' ' {
+            result.push('+');
+            return;
+        }
+
+        // 2. Let isomorph be a code point whose value is byte’s value.
+        let code_point = char::from(byte);
+
+        // 4. If isomorphic is not in percentEncodeSet, then append isomorph to output.
+        if !code_point_is_in_percent_encode_set(code_point, set) {
+            result.push(code_point);
+        } else {
+            append_percent_encoded_byte(result, byte);
         }
+    };
+
+    // OPTIMIZATION: Almost every URL is ASCII already, and encoding ASCII with an ASCII-compatible encoding cannot fail
+    //               or change any bytes. Skip setting up an encoder in that case.
+    if input.is_ascii() && is_ascii_compatible(encoding) {
+        for byte in input.bytes() {
+            append_byte(&mut result, byte);
+        }
+        return result;
+    }
+
+    let did_succeed = textcodec_encode_into(encoding, input, |item| match item {
+        EncodeItem::Byte(byte) => append_byte(&mut result, byte),
         EncodeItem::Error(error) => {
             result.push_str("%26%23");
             result.push_str(&error.to_string());
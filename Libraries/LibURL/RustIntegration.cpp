@@ -418,8 +418,12 @@ static void on_parse_host_complete(void* ctx_ptr, FFI::FfiUrlHost const* ffi_res
 Optional<Host> parse_host(StringView input, bool is_opaque)
 {
     // URL parsing expects a scalar-value UTF-8 string, but WTF-8 can be provided.
-    auto processed_input = String::from_utf8_with_replacement_character(input, String::WithBOMHandling::No);
-    auto processed_input_view = processed_input.bytes_as_string_view();
+    Optional<String> processed_input_storage;
+    auto processed_input_view = input;
+    if (!input.is_ascii()) {
+        processed_input_storage = String::from_utf8_with_replacement_character(input, String::WithBOMHandling::No);
+        processed_input_view = processed_input_storage->bytes_as_string_view();
+    }
 
     Optional<Host> result;
     HostParseCallbackCtx ctx { .result = &result };
@@ -441,7 +445,13 @@ Optional<URL> parse_basic_url(StringView input, Optional<URL const&> base_url, U
     };
 
     // URL parsing expects a scalar-value UTF-8 string, but WTF-8 can be provided.
-    auto processed_input = String::from_utf8_with_replacement_character(input, String::WithBOMHandling::No);
+    // OPTIMIZATION: ASCII input is valid UTF-8 already, and is by far the most common case.
+    Optional<String> processed_input_storage;
+    auto processed_input_view = input;
+    if (!input.is_ascii()) {
+        processed_input_storage = String::from_utf8_with_replacement_character(input, String::WithBOMHandling::No);
+        processed_input_view = processed_input_storage->bytes_as_string_view();
+    }
 
     Optional<UrlFfiStorage> base_storage;
     if (base_url.has_value())
@@ -466,7 +476,6 @@ Optional<URL> parse_basic_url(StringView input, Optional<URL const&> base_url, U
 
     Optional<URL> result;
     ParseCallbackCtx ctx { .result = &result, .url_inout = url };
-    auto processed_input_view = processed_input.bytes_as_string_view();
     bool const did_succeed = rust_url_basic_parse(
         reinterpret_cast<u8 const*>(processed_input_view.characters_without_null_termination()),
         processed_input_view.length(),
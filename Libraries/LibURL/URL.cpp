@@ -42,40 +42,40 @@ ByteString URL::basename() const
 
 void URL::set_scheme(String scheme)
 {
-    m_data->scheme = move(scheme);
+    mutable_data().scheme = move(scheme);
 }
 
 // https://url.spec.whatwg.org/#set-the-username
 void URL::set_username(StringView username)
 {
     // To set the username given a url and username, set url’s username to the result of running UTF-8 percent-encode on username using the userinfo percent-encode set.
-    m_data->username = percent_encode(username, PercentEncodeSet::Userinfo);
+    mutable_data().username = percent_encode(username, PercentEncodeSet::Userinfo);
 }
 
 // https://url.spec.whatwg.org/#set-the-username
 void URL::set_username(Utf16View username)
 {
     // To set the username given a url and username, set url’s username to the result of running UTF-8 percent-encode on username using the userinfo percent-encode set.
-    m_data->username = percent_encode(username, PercentEncodeSet::Userinfo);
+    mutable_data().username = percent_encode(username, PercentEncodeSet::Userinfo);
 }
 
 // https://url.spec.whatwg.org/#set-the-password
 void URL::set_password(StringView password)
 {
     // To set the password given a url and password, set url’s password to the result of running UTF-8 percent-encode on password using the userinfo percent-encode set.
-    m_data->password = percent_encode(password, PercentEncodeSet::Userinfo);
+    mutable_data().password = percent_encode(password, PercentEncodeSet::Userinfo);
 }
 
 // https://url.spec.whatwg.org/#set-the-password
 void URL::set_password(Utf16View password)
 {
     // To set the password given a url and password, set url’s password to the result of running UTF-8 percent-encode on password using the userinfo percent-encode set.
-    m_data->password = percent_encode(password, PercentEncodeSet::Userinfo);
+    mutable_data().password = percent_encode(password, PercentEncodeSet::Userinfo);
 }
 
 void URL::set_host(Host host)
 {
-    m_data->host = move(host);
+    mutable_data().host = move(host);
 }
 
 // https://url.spec.whatwg.org/#concept-host-serializer
@@ -86,29 +86,30 @@ String URL::serialized_host() const
 
 void URL::set_port(Optional<u16> port)
 {
-    if (port == default_port_for_scheme(m_data->scheme)) {
-        m_data->port = {};
+    if (port == default_port_for_scheme(scheme())) {
+        mutable_data().port = {};
         return;
     }
-    m_data->port = move(port);
+    mutable_data().port = move(port);
 }
 
 void URL::set_paths(Vector<ByteString> const& paths)
 {
-    m_data->paths.clear_with_capacity();
-    m_data->paths.ensure_capacity(paths.size());
+    auto& data = mutable_data();
+    data.paths.clear_with_capacity();
+    data.paths.ensure_capacity(paths.size());
     for (auto const& segment : paths)
-        m_data->paths.unchecked_append(percent_encode(segment, PercentEncodeSet::Path));
+        data.paths.unchecked_append(percent_encode(segment, PercentEncodeSet::Path));
 }
 
 void URL::set_raw_paths(Vector<String> paths)
 {
-    m_data->paths = move(paths);
+    mutable_data().paths = move(paths);
 }
 
 void URL::append_path(StringView path)
 {
-    m_data->paths.append(percent_encode(path, PercentEncodeSet::Path));
+    mutable_data().paths.append(percent_encode(path, PercentEncodeSet::Path));
 }
 
 // https://url.spec.whatwg.org/#cannot-have-a-username-password-port
@@ -232,8 +233,19 @@ ByteString URL::file_path() const
     return path;
 }
 
-// https://url.spec.whatwg.org/#concept-url-serializer
 String URL::serialize(ExcludeFragment exclude_fragment) const
+{
+    // Without a fragment, excluding it makes no difference.
+    if (exclude_fragment == ExcludeFragment::Yes && m_data->fragment.has_value())
+        return serialize_uncached(ExcludeFragment::Yes);
+
+    if (!m_data->serialization.has_value())
+        m_data->serialization = serialize_uncached(ExcludeFragment::No);
+    return *m_data->serialization;
+}
+
+// https://url.spec.whatwg.org/#concept-url-serializer
+String URL::serialize_uncached(ExcludeFragment exclude_fragment) const
 {
     // 1. Let output be url’s scheme and U+003A (:) concatenated.
     StringBuilder output;
@@ -120,14 +120,14 @@ public:
     void set_paths(Vector<ByteString> const&);
     void set_raw_paths(Vector<String>);
     Vector<String> const& paths() const { return m_data->paths; }
-    void set_query(Optional<String> query) { m_data->query = move(query); }
-    void set_fragment(Optional<String> fragment) { m_data->fragment = move(fragment); }
-    void set_has_an_opaque_path(bool value) { m_data->has_an_opaque_path = value; }
+    void set_query(Optional<String> query) { mutable_data().query = move(query); }
+    void set_fragment(Optional<String> fragment) { mutable_data().fragment = move(fragment); }
+    void set_has_an_opaque_path(bool value) { mutable_data().has_an_opaque_path = value; }
     void append_path(StringView);
     void append_slash()
     {
         // NOTE: To indicate that we want to end the path with a slash, we have to append an empty path segment.
-        m_data->paths.append(String {});
+        mutable_data().paths.append(String {});
     }
 
     String serialize_path() const;
@@ -156,6 +156,18 @@ public:
     static URL about(String path);
 
 private:
+    struct Data;
+
+    // Every modification must go through here, so that the cached serialization is never stale.
+    Data& mutable_data()
+    {
+        auto& data = m_data.mutable_value();
+        data.serialization.clear();
+        return data;
+    }
+
+    String serialize_uncached(ExcludeFragment) const;
+
     struct Data : public RefCounted<Data> {
         NonnullRefPtr<Data> clone() const
         {
@@ -203,6 +215,10 @@ private:
         // https://url.spec.whatwg.org/#concept-url-blob-entry
         // A URL also has an associated blob URL entry that is either null or a blob URL entry. It is initially null.
         Optional<BlobURLEntry> blob_url_entry;
+
+        // OPTIMIZATION: URLs are serialized far more often than they are modified, for hashing, comparisons, IPC and
+        //               getters like href. The serialization is kept here, so that copies of a URL share it too.
+        mutable Optional<String> serialization;
     };
     AK::CopyOnWrite<Data> m_data;
 };
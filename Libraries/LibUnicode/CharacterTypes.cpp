@@ -10,11 +10,13 @@
 #include <AK/HashMap.h>
 #include <AK/NeverDestroyed.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/StringHash.h>
 #include <AK/Traits.h>
 #include <LibUnicode/CharacterTypes.h>
 #include <LibUnicode/ICU.h>
 
 #include <unicode/uchar.h>
+#include <unicode/ucpmap.h>
 #include <unicode/uniset.h>
 #include <unicode/uscript.h>
 #include <unicode/uset.h>
@@ -253,9 +255,193 @@ bool code_point_has_property(u32 code_point, Property property, CaseSensitivity
     return set->contains(icu_code_point);
 }
 
+static constexpr BidiClass char_direction_to_bidi_class(UCharDirection direction)
+{
+    switch (direction) {
+    case U_ARABIC_NUMBER:
+        return BidiClass::ArabicNumber;
+    case U_BLOCK_SEPARATOR:
+        return BidiClass::BlockSeparator;
+    case U_BOUNDARY_NEUTRAL:
+        return BidiClass::BoundaryNeutral;
+    case U_COMMON_NUMBER_SEPARATOR:
+        return BidiClass::CommonNumberSeparator;
+    case U_DIR_NON_SPACING_MARK:
+        return BidiClass::DirNonSpacingMark;
+    case U_EUROPEAN_NUMBER:
+        return BidiClass::EuropeanNumber;
+    case U_EUROPEAN_NUMBER_SEPARATOR:
+        return BidiClass::EuropeanNumberSeparator;
+    case U_EUROPEAN_NUMBER_TERMINATOR:
+        return BidiClass::EuropeanNumberTerminator;
+    case U_FIRST_STRONG_ISOLATE:
+        return BidiClass::FirstStrongIsolate;
+    case U_LEFT_TO_RIGHT:
+        return BidiClass::LeftToRight;
+    case U_LEFT_TO_RIGHT_EMBEDDING:
+        return BidiClass::LeftToRightEmbedding;
+    case U_LEFT_TO_RIGHT_ISOLATE:
+        return BidiClass::LeftToRightIsolate;
+    case U_LEFT_TO_RIGHT_OVERRIDE:
+        return BidiClass::LeftToRightOverride;
+    case U_OTHER_NEUTRAL:
+        return BidiClass::OtherNeutral;
+    case U_POP_DIRECTIONAL_FORMAT:
+        return BidiClass::PopDirectionalFormat;
+    case U_POP_DIRECTIONAL_ISOLATE:
+        return BidiClass::PopDirectionalIsolate;
+    case U_RIGHT_TO_LEFT:
+        return BidiClass::RightToLeft;
+    case U_RIGHT_TO_LEFT_ARABIC:
+        return BidiClass::RightToLeftArabic;
+    case U_RIGHT_TO_LEFT_EMBEDDING:
+        return BidiClass::RightToLeftEmbedding;
+    case U_RIGHT_TO_LEFT_ISOLATE:
+        return BidiClass::RightToLeftIsolate;
+    case U_RIGHT_TO_LEFT_OVERRIDE:
+        return BidiClass::RightToLeftOverride;
+    case U_SEGMENT_SEPARATOR:
+        return BidiClass::SegmentSeparator;
+    case U_WHITE_SPACE_NEUTRAL:
+        return BidiClass::WhiteSpaceNeutral;
+    case U_CHAR_DIRECTION_COUNT:
+        break;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+static constexpr LineBreakClass icu_line_break_to_line_break_class(ULineBreak icu_line_break)
+{
+    switch (icu_line_break) {
+    case U_LB_ALPHABETIC:
+    case U_LB_HEBREW_LETTER:
+        return LineBreakClass::Alphabetic;
+    case U_LB_NUMERIC:
+        return LineBreakClass::Numeric;
+    case U_LB_IDEOGRAPHIC:
+    case U_LB_H2:
+    case U_LB_H3:
+        return LineBreakClass::Ideographic;
+    case U_LB_AMBIGUOUS:
+        return LineBreakClass::Ambiguous;
+    case U_LB_COMPLEX_CONTEXT:
+        return LineBreakClass::ComplexContext;
+    case U_LB_COMBINING_MARK:
+        return LineBreakClass::CombiningMark;
+    default:
+        return LineBreakClass::Other;
+    }
+}
+
+// The properties that text shaping and line breaking look up for every code point, packed into a two-stage table so
+// that each lookup is a couple of array loads rather than a call into ICU.
+class CodePointPropertyTable {
+public:
+    struct Properties {
+        u16 bidi_class : 5;
+        u16 line_break_class : 3;
+        u16 emoji : 1;
+        u16 emoji_presentation : 1;
+        u16 default_ignorable : 1;
+    };
+    static_assert(sizeof(Properties) == sizeof(u16));
+
+    static CodePointPropertyTable const& the()
+    {
+        static NeverDestroyed<CodePointPropertyTable> table;
+        return *table;
+    }
+
+    ALWAYS_INLINE Properties lookup(u32 code_point) const
+    {
+        if (code_point < m_latin1.size())
+            return m_latin1[code_point];
+        if (code_point >= code_point_count)
+            return m_out_of_range;
+
+        auto block = m_block_indices[code_point >> block_shift];
+        return m_blocks[(block << block_shift) + (code_point & block_mask)];
+    }
+
+    CodePointPropertyTable()
+    {
+        Vector<Properties> properties;
+        properties.resize(code_point_count);
+
+        auto fill_from_map = [&](UProperty property, auto&& assign) {
+            UErrorCode status = U_ZERO_ERROR;
+            auto const* map = u_getIntPropertyMap(property, &status);
+            verify_icu_success(status);
+
+            for (UChar32 start = 0; start < static_cast<UChar32>(code_point_count);) {
+                u32 value = 0;
+                auto end = ucpmap_getRange(map, start, UCPMAP_RANGE_NORMAL, 0, nullptr, nullptr, &value);
+                for (auto code_point = start; code_point <= end; ++code_point)
+                    assign(properties[code_point], value);
+                start = end + 1;
+            }
+        };
+        auto fill_from_set = [&](UProperty property, auto&& assign) {
+            UErrorCode status = U_ZERO_ERROR;
+            auto const* set = icu::UnicodeSet::fromUSet(u_getBinaryPropertySet(property, &status));
+            verify_icu_success(status);
+
+            for (i32 range = 0; range < set->getRangeCount(); ++range) {
+                for (auto code_point = set->getRangeStart(range); code_point <= set->getRangeEnd(range); ++code_point)
+                    assign(properties[code_point]);
+            }
+        };
+
+        fill_from_map(UCHAR_BIDI_CLASS, [](auto& entry, u32 value) { entry.bidi_class = to_underlying(char_direction_to_bidi_class(static_cast<UCharDirection>(value))); });
+        fill_from_map(UCHAR_LINE_BREAK, [](auto& entry, u32 value) { entry.line_break_class = to_underlying(icu_line_break_to_line_break_class(static_cast<ULineBreak>(value))); });
+        fill_from_set(UCHAR_EMOJI, [](auto& entry) { entry.emoji = 1; });
+        fill_from_set(UCHAR_EMOJI_PRESENTATION, [](auto& entry) { entry.emoji_presentation = 1; });
+        fill_from_set(UCHAR_DEFAULT_IGNORABLE_CODE_POINT, [](auto& entry) { entry.default_ignorable = 1; });
+
+        for (size_t code_point = 0; code_point < m_latin1.size(); ++code_point)
+            m_latin1[code_point] = properties[code_point];
+
+        // Most blocks of code points share their properties with some other block (unassigned planes, runs of CJK
+        // ideographs, ...), so identical blocks are only stored once.
+        HashMap<ReadonlySpan<Properties>, u16, BlockTraits> unique_blocks;
+
+        for (size_t block_start = 0; block_start < code_point_count; block_start += block_size) {
+            auto block = properties.span().slice(block_start, block_size);
+
+            auto index = unique_blocks.ensure(block, [&] {
+                auto new_index = static_cast<u16>(m_blocks.size() >> block_shift);
+                m_blocks.append(block.data(), block.size());
+                return new_index;
+            });
+            m_block_indices[block_start >> block_shift] = index;
+        }
+
+        // ICU still answers for values beyond the last code point, so keep giving the same answers for those.
+        auto out_of_range = static_cast<UChar32>(code_point_count);
+        m_out_of_range.bidi_class = to_underlying(char_direction_to_bidi_class(u_charDirection(out_of_range)));
+        m_out_of_range.line_break_class = to_underlying(icu_line_break_to_line_break_class(static_cast<ULineBreak>(u_getIntPropertyValue(out_of_range, UCHAR_LINE_BREAK))));
+    }
+
+private:
+    static constexpr size_t code_point_count = 0x110000;
+    static constexpr size_t block_shift = 6;
+    static constexpr size_t block_size = 1 << block_shift;
+    static constexpr size_t block_mask = block_size - 1;
+
+    struct BlockTraits : public DefaultTraits<ReadonlySpan<Properties>> {
+        static unsigned hash(ReadonlySpan<Properties> block) { return string_hash(reinterpret_cast<char const*>(block.data()), block.size() * sizeof(Properties)); }
+        static bool equals(ReadonlySpan<Properties> a, ReadonlySpan<Properties> b) { return __builtin_memcmp(a.data(), b.data(), a.size() * sizeof(Properties)) == 0; }
+    };
+
+    Array<Properties, 256> m_latin1 {};
+    Array<u16, code_point_count / block_size> m_block_indices {};
+    Vector<Properties> m_blocks;
+    Properties m_out_of_range {};
+};
+
 bool code_point_has_emoji_property(u32 code_point)
 {
-    return code_point_has_property(code_point, UCHAR_EMOJI);
+    return CodePointPropertyTable::the().lookup(code_point).emoji != 0;
 }
 
 bool code_point_has_emoji_modifier_base_property(u32 code_point)
@@ -265,12 +451,12 @@ bool code_point_has_emoji_modifier_base_property(u32 code_point)
 
 bool code_point_has_emoji_presentation_property(u32 code_point)
 {
-    return code_point_has_property(code_point, UCHAR_EMOJI_PRESENTATION);
+    return CodePointPropertyTable::the().lookup(code_point).emoji_presentation != 0;
 }
 
 bool code_point_has_default_ignorable_code_point_property(u32 code_point)
 {
-    return code_point_has_property(code_point, UCHAR_DEFAULT_IGNORABLE_CODE_POINT);
+    return CodePointPropertyTable::the().lookup(code_point).default_ignorable != 0;
 }
 
 bool code_point_has_identifier_start_property(u32 code_point)
@@ -455,93 +641,14 @@ bool code_point_has_script_extension(u32 code_point, Script script)
     return static_cast<bool>(uscript_hasScript(icu_code_point, icu_script));
 }
 
-static constexpr BidiClass char_direction_to_bidi_class(UCharDirection direction)
-{
-    switch (direction) {
-    case U_ARABIC_NUMBER:
-        return BidiClass::ArabicNumber;
-    case U_BLOCK_SEPARATOR:
-        return BidiClass::BlockSeparator;
-    case U_BOUNDARY_NEUTRAL:
-        return BidiClass::BoundaryNeutral;
-    case U_COMMON_NUMBER_SEPARATOR:
-        return BidiClass::CommonNumberSeparator;
-    case U_DIR_NON_SPACING_MARK:
-        return BidiClass::DirNonSpacingMark;
-    case U_EUROPEAN_NUMBER:
-        return BidiClass::EuropeanNumber;
-    case U_EUROPEAN_NUMBER_SEPARATOR:
-        return BidiClass::EuropeanNumberSeparator;
-    case U_EUROPEAN_NUMBER_TERMINATOR:
-        return BidiClass::EuropeanNumberTerminator;
-    case U_FIRST_STRONG_ISOLATE:
-        return BidiClass::FirstStrongIsolate;
-    case U_LEFT_TO_RIGHT:
-        return BidiClass::LeftToRight;
-    case U_LEFT_TO_RIGHT_EMBEDDING:
-        return BidiClass::LeftToRightEmbedding;
-    case U_LEFT_TO_RIGHT_ISOLATE:
-        return BidiClass::LeftToRightIsolate;
-    case U_LEFT_TO_RIGHT_OVERRIDE:
-        return BidiClass::LeftToRightOverride;
-    case U_OTHER_NEUTRAL:
-        return BidiClass::OtherNeutral;
-    case U_POP_DIRECTIONAL_FORMAT:
-        return BidiClass::PopDirectionalFormat;
-    case U_POP_DIRECTIONAL_ISOLATE:
-        return BidiClass::PopDirectionalIsolate;
-    case U_RIGHT_TO_LEFT:
-        return BidiClass::RightToLeft;
-    case U_RIGHT_TO_LEFT_ARABIC:
-        return BidiClass::RightToLeftArabic;
-    case U_RIGHT_TO_LEFT_EMBEDDING:
-        return BidiClass::RightToLeftEmbedding;
-    case U_RIGHT_TO_LEFT_ISOLATE:
-        return BidiClass::RightToLeftIsolate;
-    case U_RIGHT_TO_LEFT_OVERRIDE:
-        return BidiClass::RightToLeftOverride;
-    case U_SEGMENT_SEPARATOR:
-        return BidiClass::SegmentSeparator;
-    case U_WHITE_SPACE_NEUTRAL:
-        return BidiClass::WhiteSpaceNeutral;
-    case U_CHAR_DIRECTION_COUNT:
-        break;
-    }
-    VERIFY_NOT_REACHED();
-}
-
 BidiClass bidirectional_class(u32 code_point)
 {
-    auto icu_code_point = static_cast<UChar32>(code_point);
-
-    auto direction = u_charDirection(icu_code_point);
-    return char_direction_to_bidi_class(direction);
+    return static_cast<BidiClass>(CodePointPropertyTable::the().lookup(code_point).bidi_class);
 }
 
 LineBreakClass line_break_class(u32 code_point)
 {
-    auto icu_code_point = static_cast<UChar32>(code_point);
-    auto icu_line_break = static_cast<ULineBreak>(u_getIntPropertyValue(icu_code_point, UCHAR_LINE_BREAK));
-
-    switch (icu_line_break) {
-    case U_LB_ALPHABETIC:
-    case U_LB_HEBREW_LETTER:
-        return LineBreakClass::Alphabetic;
-    case U_LB_NUMERIC:
-        return LineBreakClass::Numeric;
-    case U_LB_IDEOGRAPHIC:
-    case U_LB_H2:
-    case U_LB_H3:
-        return LineBreakClass::Ideographic;
-    case U_LB_AMBIGUOUS:
-        return LineBreakClass::Ambiguous;
-    case U_LB_COMPLEX_CONTEXT:
-        return LineBreakClass::ComplexContext;
-    case U_LB_COMBINING_MARK:
-        return LineBreakClass::CombiningMark;
-    default:
-        return LineBreakClass::Other;
-    }
+    return static_cast<LineBreakClass>(CodePointPropertyTable::the().lookup(code_point).line_break_class);
 }
 
 // 22.2.2.7.3 Canonicalize ( rer, ch ), https://tc39.es/ecma262/#sec-runtime-semantics-canonicalize-ch
@@ -4,9 +4,11 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/CharacterTypes.h>
 #include <AK/GenericShorthands.h>
 #include <AK/OwnPtr.h>
+#include <AK/SIMDExtras.h>
 #include <AK/Utf16View.h>
 #include <LibUnicode/CharacterTypes.h>
 #include <LibUnicode/ICU.h>
@@ -142,7 +144,30 @@ private:
 
 static bool can_use_ascii_line_breaking_fast_path(ReadonlyBytes bytes)
 {
-    return all_of(bytes, [](u8 byte) { return is_ascii_printable(byte) || is_ascii_space(byte); });
+    // Printable ASCII is 0x20-0x7E, and ASCII whitespace other than the space is 0x09-0x0D.
+    size_t i = 0;
+    for (; i + sizeof(u8x16) <= bytes.size(); i += sizeof(u8x16)) {
+        auto chunk = AK::SIMD::load_unaligned<u8x16>(bytes.offset_pointer(i));
+        auto is_allowed = ((chunk >= 0x20) & (chunk <= 0x7e)) | ((chunk >= 0x09) & (chunk <= 0x0d));
+        if (!AK::SIMD::all(bit_cast<i32x4>(is_allowed) == -1))
+            return false;
+    }
+    return all_of(bytes.slice(i), [](u8 byte) { return is_ascii_printable(byte) || is_ascii_space(byte); });
+}
+
+// Returns the number of ASCII letters at the start of `bytes`.
+static size_t count_leading_ascii_letters(ReadonlyBytes bytes)
+{
+    size_t i = 0;
+    for (; i + sizeof(u8x16) <= bytes.size(); i += sizeof(u8x16)) {
+        auto lowercased = AK::SIMD::load_unaligned<u8x16>(bytes.offset_pointer(i)) | 0x20;
+        auto is_letter = (lowercased >= 'a') & (lowercased <= 'z');
+        if (!AK::SIMD::all(bit_cast<i32x4>(is_letter) == -1))
+            break;
+    }
+    while (i < bytes.size() && is_ascii_alpha(bytes[i]))
+        ++i;
+    return i;
 }
 
 // UAX#14 line-break classes that occur in printable ASCII plus ASCII whitespace.
@@ -167,7 +192,7 @@ enum class AsciiLineBreakClass : u8 {
     SY, // Symbols Allowing Break After ('/')
 };
 
-static constexpr AsciiLineBreakClass classify_ascii_byte(u8 byte)
+static constexpr AsciiLineBreakClass compute_ascii_line_break_class(u8 byte)
 {
     using enum AsciiLineBreakClass;
     switch (byte) {
@@ -218,6 +243,18 @@ static constexpr AsciiLineBreakClass classify_ascii_byte(u8 byte)
     }
 }
 
+static constexpr auto ascii_line_break_classes = [] {
+    Array<AsciiLineBreakClass, 128> classes {};
+    for (u8 byte = 0; byte < classes.size(); ++byte)
+        classes[byte] = compute_ascii_line_break_class(byte);
+    return classes;
+}();
+
+static constexpr AsciiLineBreakClass classify_ascii_byte(u8 byte)
+{
+    return ascii_line_break_classes[byte];
+}
+
 static void mark_ascii_numeric_expression_interiors(ReadonlyBytes text, Vector<bool>& interior_of_numeric_expression)
 {
     // Identify spans matching UAX#14 LB25's numeric-expression grammar:
@@ -285,6 +322,15 @@ static void compute_ascii_line_boundaries(ReadonlyBytes text, Vector<bool>& is_b
     bool in_op_sp_run = false;
 
     for (size_t i = 1; i < text.size(); ++i) {
+        // LB28 fast path: every rule that can apply between two letters forbids a break there, and a letter always
+        // ends an OP SP* run, so a whole run of letters is skipped at once.
+        if (is_ascii_alpha(text[i - 1])) {
+            if (auto letters = count_leading_ascii_letters(text.slice(i)); letters > 0) {
+                i += letters - 1;
+                continue;
+            }
+        }
+
         auto previous_class = classify_ascii_byte(text[i - 1]);
         auto current_class = classify_ascii_byte(text[i]);
 
@@ -4,11 +4,13 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
 #include <AK/Checked.h>
 #include <AK/Enumerate.h>
 #include <AK/NeverDestroyed.h>
 #include <AK/SaturatingMath.h>
 #include <LibGC/Heap.h>
+#include <LibSync/ConditionVariable.h>
 #include <LibSync/MutexProtected.h>
 #include <LibWasm/AbstractMachine/AbstractMachine.h>
 #include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
@@ -476,11 +478,89 @@ bool MemoryInstance::grow(size_t size_to_grow, GrowType grow_type, InhibitGrowCa
         successful_grow_hook();
 
     if (grow_type == GrowType::Yes)
-        m_type = MemoryType { Limits(m_type.limits().address_type(), m_type.limits().min() + size_to_grow / Constants::page_size, m_type.limits().max()) };
+        m_type = MemoryType { Limits(m_type.limits().address_type(), m_type.limits().min() + size_to_grow / Constants::page_size, m_type.limits().max(), m_type.limits().shared()) };
 
     return true;
 }
 
+namespace {
+
+struct AtomicWaiter {
+    u8 const* location { nullptr };
+    bool notified { false };
+};
+
+// The waiters of all shared memories in the process. Waiting and notifying are rare enough for a single lock to do.
+struct AtomicWaiterList {
+    Sync::Mutex mutex;
+    Sync::ConditionVariable condition { mutex };
+    Vector<AtomicWaiter*> waiters;
+};
+
+}
+
+static AtomicWaiterList& atomic_waiters()
+{
+    static NeverDestroyed<AtomicWaiterList> waiters;
+    return *waiters;
+}
+
+MemoryInstance::WaitResult MemoryInstance::wait(u64 address, u64 expected_value, size_t value_size, Optional<AK::Duration> timeout)
+{
+    auto* location = m_data.offset_pointer(address);
+    auto& list = atomic_waiters();
+    Sync::MutexLocker locker(list.mutex);
+
+    // The value is compared while holding the lock, so a notify that follows the store it waits for can't be missed.
+    u64 value = value_size == sizeof(u32)
+        ? AK::atomic_load(bit_cast<u32 volatile*>(location))
+        : AK::atomic_load(bit_cast<u64 volatile*>(location));
+    if (value != expected_value)
+        return WaitResult::NotEqual;
+
+    AtomicWaiter waiter { location };
+    list.waiters.append(&waiter);
+
+    auto deadline = timeout.map([](auto duration) { return MonotonicTime::now() + duration; });
+    while (!waiter.notified) {
+        if (!deadline.has_value()) {
+            list.condition.wait();
+            continue;
+        }
+        auto now = MonotonicTime::now();
+        if (now >= *deadline)
+            break;
+        (void)list.condition.wait_for(*deadline - now);
+    }
+
+    if (waiter.notified)
+        return WaitResult::Woken;
+
+    list.waiters.remove_first_matching([&](auto* entry) { return entry == &waiter; });
+    return WaitResult::TimedOut;
+}
+
+u32 MemoryInstance::notify(u64 address, u32 count)
+{
+    auto* location = m_data.offset_pointer(address);
+    auto& list = atomic_waiters();
+    Sync::MutexLocker locker(list.mutex);
+
+    // Waiters are woken in the order they started waiting.
+    u32 woken_count = 0;
+    list.waiters.remove_all_matching([&](auto* waiter) {
+        if (woken_count == count || waiter->location != location)
+            return false;
+        waiter->notified = true;
+        ++woken_count;
+        return true;
+    });
+
+    if (woken_count > 0)
+        list.condition.broadcast();
+    return woken_count;
+}
+
 Vector<CompiledFunctionEntry> const& ModuleInstance::compiled_fn_table(Store& store) const
 {
     if (m_compiled_fn_table_built)
@@ -695,23 +775,28 @@ ExceptionInstance* Store::get(ExceptionAddress address)
     return &m_exceptions[value];
 }
 
-ErrorOr<void, ValidationError> AbstractMachine::validate(Module& module, Optional<CompileCacheConfig> cache_config, CompileToNative compile_to_native)
+ErrorOr<void, ValidationError> AbstractMachine::validate(Module& module, Optional<CompileCacheConfig> cache_config, CompileToNative compile_to_native, ValidationMode mode)
 {
     if (module.validation_status() != Module::ValidationStatus::Unchecked) {
-        if (module.validation_status() == Module::ValidationStatus::Valid)
-            return {};
+        if (module.validation_status() == Module::ValidationStatus::Invalid)
+            return ValidationError { module.validation_error() };
 
-        return ValidationError { module.validation_error() };
+        if (auto* lazy_function_validation = module.lazy_function_validation()) {
+            if (auto error = lazy_function_validation->error(); error.has_value())
+                return error.release_value();
+        }
+        return {};
     }
 
     Validator validator;
-    auto result = validator.validate(module);
+    auto result = validator.validate(module, mode);
     if (result.is_error()) {
         module.set_validation_error(result.error().error_string);
         return result.release_error();
     }
 
-    if (compile_to_native == CompileToNative::Yes && module.try_begin_cranelift_compilation()) {
+    // Compiling to native code needs every body validated, which a lazily validated module leaves to start_cranelift_compilation().
+    if (mode == ValidationMode::Eager && compile_to_native == CompileToNative::Yes && module.try_begin_cranelift_compilation()) {
         if (cache_config.has_value())
             module.set_cranelift_cache_config(cache_config.release_value());
         compile_module_to_native(module);
@@ -1141,21 +1226,22 @@ Optional<InstantiationError> AbstractMachine::allocate_all_final_phase(Module co
     return {};
 }
 
-Result AbstractMachine::invoke(FunctionAddress address, Vector<Value> arguments)
+Result AbstractMachine::invoke(FunctionAddress address, Vector<Value, ArgumentsStaticSize> arguments)
 {
     BytecodeInterpreter interpreter(m_stack_info);
     auto handle = register_scoped(interpreter);
     return invoke(interpreter, address, move(arguments));
 }
 
-Result AbstractMachine::invoke(Interpreter& interpreter, FunctionAddress address, Vector<Value> arguments)
+Result AbstractMachine::invoke(Interpreter& interpreter, FunctionAddress address, Vector<Value, ArgumentsStaticSize> arguments)
 {
     Configuration configuration { m_store };
     if (m_should_limit_instruction_count)
         configuration.enable_instruction_count_limit();
+    if (!m_can_suspend)
+        configuration.disallow_suspension();
 
-    Vector<Value, ArgumentsStaticSize> args = move(arguments);
-    return configuration.call(interpreter, address, args);
+    return configuration.call(interpreter, address, arguments);
 }
 
 void Linker::link(ModuleInstance const& instance)
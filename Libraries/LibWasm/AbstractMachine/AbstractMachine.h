@@ -668,6 +668,19 @@ public:
 
     Function<void()> successful_grow_hook;
 
+    // https://webassembly.github.io/threads/core/exec/instructions.html#atomic-memory-instructions
+    // The result values are the ones memory.atomic.wait returns.
+    enum class WaitResult : u8 {
+        Woken = 0,
+        NotEqual = 1,
+        TimedOut = 2,
+    };
+
+    // Both expect an in-bounds, naturally aligned address. Waiters are keyed by the host address they wait on, so that
+    // every agent of the process sharing this memory sees the same waiters.
+    WaitResult wait(u64 address, u64 expected_value, size_t value_size, Optional<AK::Duration> timeout);
+    u32 notify(u64 address, u32 count);
+
     static constexpr size_t data_offset() { return __builtin_offsetof(MemoryInstance, m_data); }
 
 private:
@@ -968,16 +981,18 @@ public:
     void adopt_heap(GC::Heap&);
 
     // Validate a module; permanently sets the module's validity status.
-    ErrorOr<void, ValidationError> validate(Module&, Optional<CompileCacheConfig> cache_config = {}, CompileToNative = CompileToNative::Yes);
+    ErrorOr<void, ValidationError> validate(Module&, Optional<CompileCacheConfig> cache_config = {}, CompileToNative = CompileToNative::Yes, ValidationMode = ValidationMode::Eager);
     // Load and instantiate a module, and link it into this interpreter.
     InstantiationResult instantiate(Module const&, Vector<ExternValue>);
-    Result invoke(FunctionAddress, Vector<Value>);
-    Result invoke(Interpreter&, FunctionAddress, Vector<Value>);
+    // The arguments become the callee's locals as-is, so pass them in a vector of that type to avoid copying them.
+    Result invoke(FunctionAddress, Vector<Value, ArgumentsStaticSize>);
+    Result invoke(Interpreter&, FunctionAddress, Vector<Value, ArgumentsStaticSize>);
 
     auto& store() const { return m_store; }
     auto& store() { return m_store; }
 
     void enable_instruction_count_limit() { m_should_limit_instruction_count = true; }
+    void disallow_suspension() { m_can_suspend = false; }
 
     void visit_external_resources(HostVisitOps const&);
 
@@ -1032,6 +1047,7 @@ private:
     StackInfo m_stack_info;
     HashTable<Interpreter*> m_active_interpreters;
     bool m_should_limit_instruction_count { false };
+    bool m_can_suspend { true };
 };
 
 class WASM_API Linker {
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
 #include <AK/Bitmap.h>
 #include <AK/ByteReader.h>
 #include <AK/Debug.h>
@@ -407,6 +408,48 @@ static constexpr u64 trace_missing = NumericLimits<u64>::max();
 #define LOAD_ADDRESSES() auto addresses = addresses_ptr[short_ip.current_ip_value]
 
 void BytecodeInterpreter::interpret(Configuration& configuration)
+{
+    interpret_frame(configuration);
+    if (configuration.has_pending_tail_call()) [[unlikely]]
+        make_pending_tail_calls(configuration);
+}
+
+// Compiled code can't replace its own native frame, so it leaves tail calls to other functions pending. Make them here,
+// in place of the frame that left them, so that chains of tail calls run in constant native stack space.
+void BytecodeInterpreter::make_pending_tail_calls(Configuration& configuration)
+{
+    while (configuration.has_pending_tail_call()) {
+        auto tail_call = configuration.take_pending_tail_call();
+        if (did_trap())
+            return;
+
+        configuration.label_stack().shrink(configuration.frame().label_index(), true);
+        auto prepare_result = configuration.prepare_call(tail_call.address, tail_call.arguments, true);
+        if (prepare_result.is_error()) {
+            m_trap = prepare_result.release_error();
+            return;
+        }
+
+        // A host function doesn't get a frame of its own; its results are the calling frame's results.
+        if (auto host_function = prepare_result.release_value(); host_function.has_value()) {
+            auto result = host_function->function()(configuration, tail_call.arguments);
+            configuration.release_arguments_allocation(tail_call.arguments);
+            if (result.is_trap()) {
+                m_trap = move(result.trap());
+                return;
+            }
+            configuration.value_stack().ensure_capacity(configuration.value_stack().size() + result.values().size());
+            for (auto& value : result.values().in_reverse())
+                configuration.value_stack().unchecked_append(value);
+            return;
+        }
+
+        configuration.ip() = 0;
+        interpret_frame(configuration);
+    }
+}
+
+void BytecodeInterpreter::interpret_frame(Configuration& configuration)
 {
     m_trap = Empty {};
     auto& expression = configuration.frame().expression();
@@ -432,6 +475,8 @@ void BytecodeInterpreter::interpret(Configuration& configuration)
         }
     }
     if (native_entry != 0) {
+        if (auto* profiling_stack = configuration.profiling_stack()) [[unlikely]]
+            profiling_stack->set_top_tier(ExecutionTier::Cranelift);
         (void)run_native_entry(configuration);
         goto done;
     }
@@ -2000,6 +2045,8 @@ HANDLE_INSTRUCTION(synthetic_tier_up)
     auto const native_entry = cranelift_entry_acquire(ci);
     if (native_entry != 0) {
         // If we have native code for this block, jump into it.
+        if (auto* profiling_stack = configuration.profiling_stack()) [[unlikely]]
+            profiling_stack->set_top_tier(ExecutionTier::Cranelift);
         // The code is set up such that the target checkpoint is recovered from short_ip and nothing else needs to be passed as the stack is empty and all live state is in the shared locals.
         auto const handler = bit_cast<Outcome (*)(HANDLER_PARAMS(DECOMPOSE_PARAMS_TYPE_ONLY))>(native_entry);
         return handler(interpreter, configuration, cc[short_ip.current_ip_value].instruction, short_ip, cc, addresses_ptr);
@@ -2373,6 +2420,59 @@ HANDLE_INSTRUCTION(synthetic_br_if_nostack)
     TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
+// `i32 compare; br_if` fused into a single instruction. Just like synthetic:br_if.nostack, whether the branch has to
+// adjust the stack is only checked once it's taken.
+template<typename T, typename Operator>
+struct CompareAndBranchIfHandler {
+    template<bool HasDynamicInsnLimit, typename Continue, SourceAddressMix source_address_mix>
+    FLATTEN static Outcome operator()(HANDLER_PARAMS(DECOMPOSE_PARAMS))
+    {
+        LOG_INSN;
+        LOAD_ADDRESSES();
+        bool condition;
+        if constexpr (IsSame<Operator, Operators::EqualsZero>) {
+            condition = Operator {}(configuration.take_source<source_address_mix>(0, addresses.sources).template to<T>());
+        } else {
+            auto rhs = configuration.take_source<source_address_mix>(0, addresses.sources).template to<T>();
+            auto lhs = configuration.take_source<source_address_mix>(1, addresses.sources).template to<T>();
+            condition = Operator {}(lhs, rhs);
+        }
+        if (!condition) {
+            TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+        }
+        auto& branch_args = instruction->arguments().unsafe_get<Instruction::BranchArgs>();
+        auto label_idx = branch_args.label.value();
+        auto& label_stack = configuration.label_stack();
+        auto label_pos = label_stack.size() - 1 - label_idx;
+        auto& label = label_stack.data()[label_pos];
+        auto expected = label.stack_height() + label.arity();
+        auto current = configuration.value_stack().size();
+        if (current != expected) [[unlikely]]
+            return synthetic_br_if_nostack_not_taken(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+        label_stack.unsafe_shrink(label_pos + 1);
+        short_ip.current_ip_value = label.continuation().value() - 1;
+        TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+    }
+};
+
+#define COMPARE_AND_BRANCH_IF_INSTRUCTION(name, type, operator) \
+    template<>                                                  \
+    struct InstructionHandler<Instructions::name.value()> : CompareAndBranchIfHandler<type, operator> { };
+
+COMPARE_AND_BRANCH_IF_INSTRUCTION(synthetic_i32_eqz_br_if, i32, Operators::EqualsZero)
+COMPARE_AND_BRANCH_IF_INSTRUCTION(synthetic_i32_eq_br_if, i32, Operators::Equals)
+COMPARE_AND_BRANCH_IF_INSTRUCTION(synthetic_i32_ne_br_if, i32, Operators::NotEquals)
+COMPARE_AND_BRANCH_IF_INSTRUCTION(synthetic_i32_lts_br_if, i32, Operators::LessThan)
+COMPARE_AND_BRANCH_IF_INSTRUCTION(synthetic_i32_ltu_br_if, u32, Operators::LessThan)
+COMPARE_AND_BRANCH_IF_INSTRUCTION(synthetic_i32_gts_br_if, i32, Operators::GreaterThan)
+COMPARE_AND_BRANCH_IF_INSTRUCTION(synthetic_i32_gtu_br_if, u32, Operators::GreaterThan)
+COMPARE_AND_BRANCH_IF_INSTRUCTION(synthetic_i32_les_br_if, i32, Operators::LessThanOrEquals)
+COMPARE_AND_BRANCH_IF_INSTRUCTION(synthetic_i32_leu_br_if, u32, Operators::LessThanOrEquals)
+COMPARE_AND_BRANCH_IF_INSTRUCTION(synthetic_i32_ges_br_if, i32, Operators::GreaterThanOrEquals)
+COMPARE_AND_BRANCH_IF_INSTRUCTION(synthetic_i32_geu_br_if, u32, Operators::GreaterThanOrEquals)
+
+#undef COMPARE_AND_BRANCH_IF_INSTRUCTION
+
 HANDLE_INSTRUCTION(br_table)
 {
     LOG_INSN;
@@ -6337,188 +6437,789 @@ HANDLE_INSTRUCTION(i31_get_u)
 
 #undef GC_TRAP_IF
 
-bool BytecodeInterpreter::trap_if_insufficient_native_stack_space(size_t minimum_native_stack_space_to_keep_free)
+HANDLE_INSTRUCTION(memory_atomic_notify)
 {
-    return trap_if_not(m_stack_info.size_free() >= minimum_native_stack_space_to_keep_free, Constants::stack_exhaustion_message);
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_notify<source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
-template<u64 opcode, bool HasDynamicInsnLimit, typename Continue, SourceAddressMix mix, typename... Args>
-constexpr static auto handle_instruction(Args&&... a)
+HANDLE_INSTRUCTION(memory_atomic_wait32)
 {
-    return InstructionHandler<opcode>::template operator()<HasDynamicInsnLimit, Continue, mix>(forward<Args>(a)...);
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_wait<u32, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
-template<bool HasCompiledList, bool HasDynamicInsnLimit, bool HaveDirectThreadingInfo>
-FLATTEN void BytecodeInterpreter::interpret_impl(Configuration& configuration, Expression const& expression)
+HANDLE_INSTRUCTION(memory_atomic_wait64)
 {
-    auto& instructions = expression.instructions();
-    u64 executed_instructions = 0;
-    ShortenedIP short_ip { .current_ip_value = static_cast<u32>(configuration.ip()) };
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_wait<u64, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
 
-    auto cc = expression.compiled_instructions.dispatches.data();
-    auto addresses_ptr = expression.compiled_instructions.src_dst_mappings.data();
+HANDLE_INSTRUCTION(atomic_fence)
+{
+    LOG_INSN;
+    AK::atomic_thread_fence(AK::memory_order_seq_cst);
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
 
-    if constexpr (HaveDirectThreadingInfo) {
-        static_assert(HasCompiledList, "Direct threading requires a compiled instruction list");
-        auto const instruction = cc[short_ip.current_ip_value].instruction;
-        auto const handler = bit_cast<Outcome (*)(HANDLER_PARAMS(DECOMPOSE_PARAMS_TYPE_ONLY))>(cc[short_ip.current_ip_value].handler_ptr);
-        handler(*this, configuration, instruction, short_ip, cc, addresses_ptr);
-        return;
-    }
+HANDLE_INSTRUCTION(i32_atomic_load)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_load_and_push<u32, i32, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
 
-    while (true) {
-        if constexpr (HasDynamicInsnLimit) {
-            if (executed_instructions++ >= Constants::max_allowed_executed_instructions_per_call) [[unlikely]] {
-                m_trap = Trap::from_string("Exceeded maximum allowed number of instructions");
-                return;
-            }
-        }
-        // bounds checked by loop condition.
-        auto const instruction = HasCompiledList
-            ? cc[short_ip.current_ip_value].instruction
-            : &instructions.data()[short_ip.current_ip_value];
-        auto const opcode = (HasCompiledList && !HaveDirectThreadingInfo
-                ? cc[short_ip.current_ip_value].instruction_opcode
-                : instruction->opcode())
-                                .value();
+HANDLE_INSTRUCTION(i64_atomic_load)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_load_and_push<u64, i64, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
 
-#define RUN_NEXT_INSTRUCTION()       \
-    {                                \
-        ++short_ip.current_ip_value; \
-        break;                       \
-    }
+HANDLE_INSTRUCTION(i32_atomic_load8_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_load_and_push<u8, i32, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
 
-#define HANDLE_INSTRUCTION_NEW(name, ...)                                                                                                                                                \
-    case Instructions::name.value(): {                                                                                                                                                   \
-        auto outcome = handle_instruction<Instructions::name.value(), HasDynamicInsnLimit, Skip, SourceAddressMix::Any>(*this, configuration, instruction, short_ip, cc, addresses_ptr); \
-        if (outcome == Outcome::Return)                                                                                                                                                  \
-            return;                                                                                                                                                                      \
-        short_ip.current_ip_value = to_underlying(outcome);                                                                                                                              \
-        if constexpr (first_is_one_of(Instructions::name, Instructions::return_call, Instructions::return_call_indirect, Instructions::return_call_ref)) {                               \
-            cc = configuration.frame().expression().compiled_instructions.dispatches.data();                                                                                             \
-            addresses_ptr = configuration.frame().expression().compiled_instructions.src_dst_mappings.data();                                                                            \
-        }                                                                                                                                                                                \
-        RUN_NEXT_INSTRUCTION();                                                                                                                                                          \
-    }
+HANDLE_INSTRUCTION(i32_atomic_load16_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_load_and_push<u16, i32, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
 
-        dbgln_if(WASM_TRACE_DEBUG, "Executing instruction {} at current_ip_value {}", instruction_name(instruction->opcode()), short_ip.current_ip_value);
-        if ((opcode & Instructions::SyntheticInstructionBase.value()) != Instructions::SyntheticInstructionBase.value())
-            __builtin_prefetch(&instruction->arguments(), /* read */ 0, /* low temporal locality */ 1);
+HANDLE_INSTRUCTION(i64_atomic_load8_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_load_and_push<u8, i64, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
 
-        switch (opcode) {
-            ENUMERATE_WASM_OPCODES(HANDLE_INSTRUCTION_NEW)
-        default:
-            dbgln("Bad opcode {} in insn {} (ip {})", opcode, instruction_name(instruction->opcode()), short_ip.current_ip_value);
-            VERIFY_NOT_REACHED();
-        }
-    }
+HANDLE_INSTRUCTION(i64_atomic_load16_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_load_and_push<u16, i64, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
-template<bool NeedsStackAdjustment>
-InstructionPointer BytecodeInterpreter::branch_to_label(Configuration& configuration, LabelIndex index, InstructionPointer current_ip, bool actually_branching)
+HANDLE_INSTRUCTION(i64_atomic_load32_u)
 {
-    dbgln_if(WASM_TRACE_DEBUG, "Branch to label with index {}...", index.value());
-    auto& label_stack = configuration.label_stack();
-    label_stack.unsafe_shrink(actually_branching ? label_stack.size() - index.value() : label_stack.size());
-    auto const& label = configuration.label_stack().unsafe_last();
-    dbgln_if(WASM_TRACE_DEBUG, "...which is actually IP {}, and has {} result(s)", label.continuation().value(), label.arity());
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_load_and_push<u32, i64, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
 
-    if constexpr (NeedsStackAdjustment) {
-        if (actually_branching)
-            configuration.value_stack().remove(label.stack_height(), configuration.value_stack().size() - label.stack_height() - label.arity());
-    }
-    return actually_branching ? label.continuation().value() - 1 : current_ip;
+HANDLE_INSTRUCTION(i32_atomic_store)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_pop_and_store<i32, u32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
-// https://webassembly.github.io/spec/core/exec/instructions.html#xref-syntax-instructions-syntax-instr-control-mathsf-throw-ref
-Optional<InstructionPointer> BytecodeInterpreter::unwind_to_throw_handler(Configuration& configuration, ExceptionAddress exception_address)
+HANDLE_INSTRUCTION(i64_atomic_store)
 {
-    auto& exception = *configuration.store().get(exception_address);
-    auto& label_stack = configuration.label_stack();
-    auto& frame = configuration.frame();
-    auto const frame_label_index = frame.label_index();
-    for (size_t label_index = label_stack.size(); label_index > frame_label_index + 1;) {
-        --label_index;
-        auto const& label = label_stack.data()[label_index];
-        auto const* try_table_instruction = label.try_table_instruction();
-        if (!try_table_instruction)
-            continue;
-        auto& args = try_table_instruction->arguments().unsafe_get<Instruction::TryTableArgs>();
-        for (auto& catch_ : args.catches()) {
-            // catch x l / catch_ref x l match if exns[a].tag = z.module.tags[x];
-            // catch_all l / catch_all_ref l match any exception.
-            if (auto tag_index = catch_.matching_tag_index(); tag_index.has_value()) {
-                if (frame.module().tags()[tag_index->value()] != exception.tag())
-                    continue;
-            }
-            // Matched: the handler and its label should be removed, and the exception's fields (plus the exnref for the _ref forms) replace them...
-            auto& value_stack = configuration.value_stack();
-            value_stack.shrink(label.stack_height(), true);
-            if (catch_.matching_tag_index().has_value()) {
-                value_stack.ensure_capacity(value_stack.size() + exception.params().size());
-                for (auto& field : exception.params())
-                    value_stack.unchecked_append(field);
-            }
-            if (catch_.is_ref())
-                value_stack.append(Value(Reference { Reference::Exception { exception_address } }));
-            label_stack.unsafe_shrink(label_index);
-            // ...followed by (br l), with l relative to the context outside the try_table.
-            label_stack.unsafe_shrink(label_stack.size() - catch_.target_label().value());
-            auto const& target = label_stack.unsafe_last();
-            value_stack.remove(target.stack_height(), value_stack.size() - target.stack_height() - target.arity());
-            return target.continuation();
-        }
-    }
-    // No handler in this frame matched; drop its labels (the frame is being unwound) so that a re-dispatch in the calling frame only ever sees that frame's own (still active) handlers.
-    label_stack.shrink(frame_label_index, true);
-    return {};
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_pop_and_store<i64, u64>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
-template<typename ReadType, typename PushType, SourceAddressMix mix>
-bool BytecodeInterpreter::load_and_push(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+HANDLE_INSTRUCTION(i32_atomic_store8)
 {
-    auto& arg = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
-    auto& address = configuration.frame().module().memories().data()[arg.memory_index.value()];
-    auto memory = configuration.store().unsafe_get(address);
-    auto& entry = configuration.source_value<mix>(0, addresses.sources); // bounds checked by verifier.
-    auto base = memory_base_address(*memory, entry);
-    Checked<u64> end_address { base };
-    end_address += arg.offset;
-    end_address += sizeof(ReadType);
-    u64 instance_address = base + arg.offset;
-    dbgln_if(WASM_TRACE_DEBUG, "load({} : {}) -> stack", instance_address, sizeof(ReadType));
-    if (end_address.has_overflow() || end_address.value() > memory->size()) {
-        m_trap = Trap::from_string("Memory access out of bounds");
-        dbgln_if(WASM_TRACE_DEBUG, "LibWasm: load_and_push - Memory access out of bounds (expected {} to be less than or equal to {})", instance_address + sizeof(ReadType), memory->size());
-        return true;
-    }
-    entry = Value(static_cast<PushType>(read_value<ReadType>({ memory->data().offset_pointer(instance_address), sizeof(ReadType) })));
-    dbgln_if(WASM_TRACE_DEBUG, "  loaded value: {}", entry.value());
-    return false;
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_pop_and_store<i32, u8>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
-template<typename TDst, typename TSrc>
-ALWAYS_INLINE static TDst convert_vector(TSrc v)
+HANDLE_INSTRUCTION(i32_atomic_store16)
 {
-    return __builtin_convertvector(v, TDst);
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_pop_and_store<i32, u16>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
-template<size_t M, size_t N, template<typename> typename SetSign>
-bool BytecodeInterpreter::load_and_push_mxn(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+HANDLE_INSTRUCTION(i64_atomic_store8)
 {
-    auto& arg = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
-    auto& address = configuration.frame().module().memories().data()[arg.memory_index.value()];
-    auto memory = configuration.store().unsafe_get(address);
-    auto& entry = configuration.source_value<SourceAddressMix::Any>(0, addresses.sources); // bounds checked by verifier.
-    auto base = memory_base_address(*memory, entry);
-    Checked<u64> end_address { base };
-    end_address += arg.offset;
-    end_address += M * N / 8;
-    u64 instance_address = base + arg.offset;
-    dbgln_if(WASM_TRACE_DEBUG, "vec-load({} : {}) -> stack", instance_address, M * N / 8);
-    if (end_address.has_overflow() || end_address.value() > memory->size()) {
-        m_trap = Trap::from_string("Memory access out of bounds");
-        return true;
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_pop_and_store<i64, u8>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_store16)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_pop_and_store<i64, u16>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_store32)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_pop_and_store<i64, u32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_add)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u32, i32, BytecodeInterpreter::AtomicOperation::Add, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_add)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u64, i64, BytecodeInterpreter::AtomicOperation::Add, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_add_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u8, i32, BytecodeInterpreter::AtomicOperation::Add, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_add_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u16, i32, BytecodeInterpreter::AtomicOperation::Add, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_add_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u8, i64, BytecodeInterpreter::AtomicOperation::Add, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_add_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u16, i64, BytecodeInterpreter::AtomicOperation::Add, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_add_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u32, i64, BytecodeInterpreter::AtomicOperation::Add, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_sub)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u32, i32, BytecodeInterpreter::AtomicOperation::Subtract, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_sub)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u64, i64, BytecodeInterpreter::AtomicOperation::Subtract, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_sub_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u8, i32, BytecodeInterpreter::AtomicOperation::Subtract, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_sub_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u16, i32, BytecodeInterpreter::AtomicOperation::Subtract, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_sub_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u8, i64, BytecodeInterpreter::AtomicOperation::Subtract, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_sub_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u16, i64, BytecodeInterpreter::AtomicOperation::Subtract, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_sub_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u32, i64, BytecodeInterpreter::AtomicOperation::Subtract, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_and)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u32, i32, BytecodeInterpreter::AtomicOperation::And, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_and)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u64, i64, BytecodeInterpreter::AtomicOperation::And, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_and_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u8, i32, BytecodeInterpreter::AtomicOperation::And, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_and_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u16, i32, BytecodeInterpreter::AtomicOperation::And, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_and_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u8, i64, BytecodeInterpreter::AtomicOperation::And, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_and_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u16, i64, BytecodeInterpreter::AtomicOperation::And, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_and_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u32, i64, BytecodeInterpreter::AtomicOperation::And, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_or)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u32, i32, BytecodeInterpreter::AtomicOperation::Or, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_or)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u64, i64, BytecodeInterpreter::AtomicOperation::Or, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_or_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u8, i32, BytecodeInterpreter::AtomicOperation::Or, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_or_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u16, i32, BytecodeInterpreter::AtomicOperation::Or, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_or_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u8, i64, BytecodeInterpreter::AtomicOperation::Or, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_or_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u16, i64, BytecodeInterpreter::AtomicOperation::Or, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_or_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u32, i64, BytecodeInterpreter::AtomicOperation::Or, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_xor)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u32, i32, BytecodeInterpreter::AtomicOperation::Xor, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_xor)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u64, i64, BytecodeInterpreter::AtomicOperation::Xor, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_xor_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u8, i32, BytecodeInterpreter::AtomicOperation::Xor, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_xor_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u16, i32, BytecodeInterpreter::AtomicOperation::Xor, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_xor_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u8, i64, BytecodeInterpreter::AtomicOperation::Xor, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_xor_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u16, i64, BytecodeInterpreter::AtomicOperation::Xor, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_xor_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u32, i64, BytecodeInterpreter::AtomicOperation::Xor, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_xchg)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u32, i32, BytecodeInterpreter::AtomicOperation::Exchange, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_xchg)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u64, i64, BytecodeInterpreter::AtomicOperation::Exchange, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_xchg_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u8, i32, BytecodeInterpreter::AtomicOperation::Exchange, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_xchg_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u16, i32, BytecodeInterpreter::AtomicOperation::Exchange, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_xchg_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u8, i64, BytecodeInterpreter::AtomicOperation::Exchange, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_xchg_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u16, i64, BytecodeInterpreter::AtomicOperation::Exchange, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_xchg_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_read_modify_write<u32, i64, BytecodeInterpreter::AtomicOperation::Exchange, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_cmpxchg)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_compare_exchange<u32, i32, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_cmpxchg)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_compare_exchange<u64, i64, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_cmpxchg_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_compare_exchange<u8, i32, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_cmpxchg_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_compare_exchange<u16, i32, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_cmpxchg_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_compare_exchange<u8, i64, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_cmpxchg_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_compare_exchange<u16, i64, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_cmpxchg_u)
+{
+    LOG_INSN;
+    LOAD_ADDRESSES();
+    if (interpreter.atomic_compare_exchange<u32, i64, source_address_mix>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+bool BytecodeInterpreter::trap_if_insufficient_native_stack_space(size_t minimum_native_stack_space_to_keep_free)
+{
+    return trap_if_not(m_stack_info.size_free() >= minimum_native_stack_space_to_keep_free, Constants::stack_exhaustion_message);
+}
+
+template<u64 opcode, bool HasDynamicInsnLimit, typename Continue, SourceAddressMix mix, typename... Args>
+constexpr static auto handle_instruction(Args&&... a)
+{
+    return InstructionHandler<opcode>::template operator()<HasDynamicInsnLimit, Continue, mix>(forward<Args>(a)...);
+}
+
+template<bool HasCompiledList, bool HasDynamicInsnLimit, bool HaveDirectThreadingInfo>
+FLATTEN void BytecodeInterpreter::interpret_impl(Configuration& configuration, Expression const& expression)
+{
+    auto& instructions = expression.instructions();
+    u64 executed_instructions = 0;
+    ShortenedIP short_ip { .current_ip_value = static_cast<u32>(configuration.ip()) };
+
+    auto cc = expression.compiled_instructions.dispatches.data();
+    auto addresses_ptr = expression.compiled_instructions.src_dst_mappings.data();
+
+    if constexpr (HaveDirectThreadingInfo) {
+        static_assert(HasCompiledList, "Direct threading requires a compiled instruction list");
+        auto const instruction = cc[short_ip.current_ip_value].instruction;
+        auto const handler = bit_cast<Outcome (*)(HANDLER_PARAMS(DECOMPOSE_PARAMS_TYPE_ONLY))>(cc[short_ip.current_ip_value].handler_ptr);
+        handler(*this, configuration, instruction, short_ip, cc, addresses_ptr);
+        return;
+    }
+
+    while (true) {
+        if constexpr (HasDynamicInsnLimit) {
+            if (executed_instructions++ >= Constants::max_allowed_executed_instructions_per_call) [[unlikely]] {
+                m_trap = Trap::from_string("Exceeded maximum allowed number of instructions");
+                return;
+            }
+        }
+        // bounds checked by loop condition.
+        auto const instruction = HasCompiledList
+            ? cc[short_ip.current_ip_value].instruction
+            : &instructions.data()[short_ip.current_ip_value];
+        auto const opcode = (HasCompiledList && !HaveDirectThreadingInfo
+                ? cc[short_ip.current_ip_value].instruction_opcode
+                : instruction->opcode())
+                                .value();
+
+#define RUN_NEXT_INSTRUCTION()       \
+    {                                \
+        ++short_ip.current_ip_value; \
+        break;                       \
+    }
+
+#define HANDLE_INSTRUCTION_NEW(name, ...)                                                                                                                                                \
+    case Instructions::name.value(): {                                                                                                                                                   \
+        auto outcome = handle_instruction<Instructions::name.value(), HasDynamicInsnLimit, Skip, SourceAddressMix::Any>(*this, configuration, instruction, short_ip, cc, addresses_ptr); \
+        if (outcome == Outcome::Return)                                                                                                                                                  \
+            return;                                                                                                                                                                      \
+        short_ip.current_ip_value = to_underlying(outcome);                                                                                                                              \
+        if constexpr (first_is_one_of(Instructions::name, Instructions::return_call, Instructions::return_call_indirect, Instructions::return_call_ref)) {                               \
+            cc = configuration.frame().expression().compiled_instructions.dispatches.data();                                                                                             \
+            addresses_ptr = configuration.frame().expression().compiled_instructions.src_dst_mappings.data();                                                                            \
+        }                                                                                                                                                                                \
+        RUN_NEXT_INSTRUCTION();                                                                                                                                                          \
+    }
+
+        dbgln_if(WASM_TRACE_DEBUG, "Executing instruction {} at current_ip_value {}", instruction_name(instruction->opcode()), short_ip.current_ip_value);
+        if ((opcode & Instructions::SyntheticInstructionBase.value()) != Instructions::SyntheticInstructionBase.value())
+            __builtin_prefetch(&instruction->arguments(), /* read */ 0, /* low temporal locality */ 1);
+
+        switch (opcode) {
+            ENUMERATE_WASM_OPCODES(HANDLE_INSTRUCTION_NEW)
+        default:
+            dbgln("Bad opcode {} in insn {} (ip {})", opcode, instruction_name(instruction->opcode()), short_ip.current_ip_value);
+            VERIFY_NOT_REACHED();
+        }
+    }
+}
+
+template<bool NeedsStackAdjustment>
+InstructionPointer BytecodeInterpreter::branch_to_label(Configuration& configuration, LabelIndex index, InstructionPointer current_ip, bool actually_branching)
+{
+    dbgln_if(WASM_TRACE_DEBUG, "Branch to label with index {}...", index.value());
+    auto& label_stack = configuration.label_stack();
+    label_stack.unsafe_shrink(actually_branching ? label_stack.size() - index.value() : label_stack.size());
+    auto const& label = configuration.label_stack().unsafe_last();
+    dbgln_if(WASM_TRACE_DEBUG, "...which is actually IP {}, and has {} result(s)", label.continuation().value(), label.arity());
+
+    if constexpr (NeedsStackAdjustment) {
+        if (actually_branching)
+            configuration.value_stack().remove(label.stack_height(), configuration.value_stack().size() - label.stack_height() - label.arity());
+    }
+    return actually_branching ? label.continuation().value() - 1 : current_ip;
+}
+
+// https://webassembly.github.io/spec/core/exec/instructions.html#xref-syntax-instructions-syntax-instr-control-mathsf-throw-ref
+Optional<InstructionPointer> BytecodeInterpreter::unwind_to_throw_handler(Configuration& configuration, ExceptionAddress exception_address)
+{
+    auto& exception = *configuration.store().get(exception_address);
+    auto& label_stack = configuration.label_stack();
+    auto& frame = configuration.frame();
+    auto const frame_label_index = frame.label_index();
+    for (size_t label_index = label_stack.size(); label_index > frame_label_index + 1;) {
+        --label_index;
+        auto const& label = label_stack.data()[label_index];
+        auto const* try_table_instruction = label.try_table_instruction();
+        if (!try_table_instruction)
+            continue;
+        auto& args = try_table_instruction->arguments().unsafe_get<Instruction::TryTableArgs>();
+        for (auto& catch_ : args.catches()) {
+            // catch x l / catch_ref x l match if exns[a].tag = z.module.tags[x];
+            // catch_all l / catch_all_ref l match any exception.
+            if (auto tag_index = catch_.matching_tag_index(); tag_index.has_value()) {
+                if (frame.module().tags()[tag_index->value()] != exception.tag())
+                    continue;
+            }
+            // Matched: the handler and its label should be removed, and the exception's fields (plus the exnref for the _ref forms) replace them...
+            auto& value_stack = configuration.value_stack();
+            value_stack.shrink(label.stack_height(), true);
+            if (catch_.matching_tag_index().has_value()) {
+                value_stack.ensure_capacity(value_stack.size() + exception.params().size());
+                for (auto& field : exception.params())
+                    value_stack.unchecked_append(field);
+            }
+            if (catch_.is_ref())
+                value_stack.append(Value(Reference { Reference::Exception { exception_address } }));
+            label_stack.unsafe_shrink(label_index);
+            // ...followed by (br l), with l relative to the context outside the try_table.
+            label_stack.unsafe_shrink(label_stack.size() - catch_.target_label().value());
+            auto const& target = label_stack.unsafe_last();
+            value_stack.remove(target.stack_height(), value_stack.size() - target.stack_height() - target.arity());
+            return target.continuation();
+        }
+    }
+    // No handler in this frame matched; drop its labels (the frame is being unwound) so that a re-dispatch in the calling frame only ever sees that frame's own (still active) handlers.
+    label_stack.shrink(frame_label_index, true);
+    return {};
+}
+
+template<typename ReadType, typename PushType, SourceAddressMix mix>
+bool BytecodeInterpreter::load_and_push(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
+    auto& address = configuration.frame().module().memories().data()[arg.memory_index.value()];
+    auto memory = configuration.store().unsafe_get(address);
+    auto& entry = configuration.source_value<mix>(0, addresses.sources); // bounds checked by verifier.
+    auto base = memory_base_address(*memory, entry);
+    Checked<u64> end_address { base };
+    end_address += arg.offset;
+    end_address += sizeof(ReadType);
+    u64 instance_address = base + arg.offset;
+    dbgln_if(WASM_TRACE_DEBUG, "load({} : {}) -> stack", instance_address, sizeof(ReadType));
+    if (end_address.has_overflow() || end_address.value() > memory->size()) {
+        m_trap = Trap::from_string("Memory access out of bounds");
+        dbgln_if(WASM_TRACE_DEBUG, "LibWasm: load_and_push - Memory access out of bounds (expected {} to be less than or equal to {})", instance_address + sizeof(ReadType), memory->size());
+        return true;
+    }
+    entry = Value(static_cast<PushType>(read_value<ReadType>({ memory->data().offset_pointer(instance_address), sizeof(ReadType) })));
+    dbgln_if(WASM_TRACE_DEBUG, "  loaded value: {}", entry.value());
+    return false;
+}
+
+template<typename TDst, typename TSrc>
+ALWAYS_INLINE static TDst convert_vector(TSrc v)
+{
+    return __builtin_convertvector(v, TDst);
+}
+
+template<size_t M, size_t N, template<typename> typename SetSign>
+bool BytecodeInterpreter::load_and_push_mxn(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
+    auto& address = configuration.frame().module().memories().data()[arg.memory_index.value()];
+    auto memory = configuration.store().unsafe_get(address);
+    auto& entry = configuration.source_value<SourceAddressMix::Any>(0, addresses.sources); // bounds checked by verifier.
+    auto base = memory_base_address(*memory, entry);
+    Checked<u64> end_address { base };
+    end_address += arg.offset;
+    end_address += M * N / 8;
+    u64 instance_address = base + arg.offset;
+    dbgln_if(WASM_TRACE_DEBUG, "vec-load({} : {}) -> stack", instance_address, M * N / 8);
+    if (end_address.has_overflow() || end_address.value() > memory->size()) {
+        m_trap = Trap::from_string("Memory access out of bounds");
+        return true;
     }
     auto const* data = memory->data().offset_pointer(instance_address);
     using V64 = NativeVectorType<M, N, SetSign>;
@@ -6858,6 +7559,158 @@ bool BytecodeInterpreter::store_to_memory(MemoryInstance& memory, u64 address, T
     return false;
 }
 
+template<typename T>
+Optional<u64> BytecodeInterpreter::atomic_effective_address(MemoryInstance const& memory, Instruction::MemoryArgument const& arg, Value const& base_value)
+{
+    Checked<u64> effective_address { memory_base_address(memory, base_value) };
+    effective_address += arg.offset;
+    Checked<u64> end_address { effective_address };
+    end_address += sizeof(T);
+    if (end_address.has_overflow() || end_address.value() > memory.size()) [[unlikely]] {
+        m_trap = Trap::from_string("Memory access out of bounds");
+        return {};
+    }
+    // https://webassembly.github.io/threads/core/exec/instructions.html#atomic-memory-instructions
+    if (effective_address.value() % sizeof(T) != 0) [[unlikely]] {
+        m_trap = Trap::from_string("Unaligned atomic memory access");
+        return {};
+    }
+    return effective_address.value();
+}
+
+// Wasm memory is little-endian like every host we run on, so atomic accesses can operate on the memory in place.
+template<typename T>
+static ALWAYS_INLINE T* atomic_location(MemoryInstance& memory, u64 address)
+{
+    return bit_cast<T*>(memory.data().offset_pointer(address));
+}
+
+template<typename ReadT, typename PushT, SourceAddressMix mix>
+bool BytecodeInterpreter::atomic_load_and_push(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
+    auto memory = configuration.store().unsafe_get(configuration.frame().module().memories().data()[arg.memory_index.value()]);
+    auto& entry = configuration.source_value<mix>(0, addresses.sources); // bounds checked by verifier.
+    auto address = atomic_effective_address<ReadT>(*memory, arg, entry);
+    if (!address.has_value())
+        return true;
+    entry = Value(static_cast<PushT>(AK::atomic_load(atomic_location<ReadT>(*memory, *address))));
+    return false;
+}
+
+template<typename PopT, typename StoreT>
+bool BytecodeInterpreter::atomic_pop_and_store(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
+    auto memory = configuration.store().unsafe_get(configuration.frame().module().memories().data()[arg.memory_index.value()]);
+    // bounds checked by verifier.
+    auto value = static_cast<StoreT>(configuration.take_source<SourceAddressMix::Any>(0, addresses.sources).template to<PopT>());
+    auto base = configuration.take_source<SourceAddressMix::Any>(1, addresses.sources);
+    auto address = atomic_effective_address<StoreT>(*memory, arg, base);
+    if (!address.has_value())
+        return true;
+    AK::atomic_store(atomic_location<StoreT>(*memory, *address), value);
+    return false;
+}
+
+template<typename AccessT, typename PushT, BytecodeInterpreter::AtomicOperation operation, SourceAddressMix mix>
+bool BytecodeInterpreter::atomic_read_modify_write(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
+    auto memory = configuration.store().unsafe_get(configuration.frame().module().memories().data()[arg.memory_index.value()]);
+    // bounds checked by verifier.
+    auto operand = static_cast<AccessT>(configuration.take_source<mix>(0, addresses.sources).template to<PushT>());
+    auto& entry = configuration.source_value<mix>(1, addresses.sources);
+    auto address = atomic_effective_address<AccessT>(*memory, arg, entry);
+    if (!address.has_value())
+        return true;
+
+    auto* location = atomic_location<AccessT>(*memory, *address);
+    AccessT old_value;
+    if constexpr (operation == AtomicOperation::Add)
+        old_value = AK::atomic_fetch_add(location, operand);
+    else if constexpr (operation == AtomicOperation::Subtract)
+        old_value = AK::atomic_fetch_sub(location, operand);
+    else if constexpr (operation == AtomicOperation::And)
+        old_value = AK::atomic_fetch_and(location, operand);
+    else if constexpr (operation == AtomicOperation::Or)
+        old_value = AK::atomic_fetch_or(location, operand);
+    else if constexpr (operation == AtomicOperation::Xor)
+        old_value = AK::atomic_fetch_xor(location, operand);
+    else
+        old_value = AK::atomic_exchange(location, operand);
+
+    // The narrow variants zero-extend the value they read.
+    entry = Value(static_cast<PushT>(old_value));
+    return false;
+}
+
+template<typename AccessT, typename PushT, SourceAddressMix mix>
+bool BytecodeInterpreter::atomic_compare_exchange(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
+    auto memory = configuration.store().unsafe_get(configuration.frame().module().memories().data()[arg.memory_index.value()]);
+    // bounds checked by verifier.
+    auto replacement = static_cast<AccessT>(configuration.take_source<mix>(0, addresses.sources).template to<PushT>());
+    // The narrow variants compare against the expected value wrapped to their width.
+    auto expected = static_cast<AccessT>(configuration.take_source<mix>(1, addresses.sources).template to<PushT>());
+    auto& entry = configuration.source_value<mix>(2, addresses.sources);
+    auto address = atomic_effective_address<AccessT>(*memory, arg, entry);
+    if (!address.has_value())
+        return true;
+
+    // On failure, expected is updated to the value that was read; on success it already is that value.
+    (void)AK::atomic_compare_exchange_strong(atomic_location<AccessT>(*memory, *address), expected, replacement);
+    entry = Value(static_cast<PushT>(expected));
+    return false;
+}
+
+template<typename ExpectedT, SourceAddressMix mix>
+bool BytecodeInterpreter::atomic_wait(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
+    auto memory = configuration.store().unsafe_get(configuration.frame().module().memories().data()[arg.memory_index.value()]);
+    // bounds checked by verifier.
+    auto timeout = configuration.take_source<mix>(0, addresses.sources).template to<i64>();
+    auto expected = static_cast<ExpectedT>(configuration.take_source<mix>(1, addresses.sources).template to<Conditional<IsSame<ExpectedT, u32>, i32, i64>>());
+    auto& entry = configuration.source_value<mix>(2, addresses.sources);
+    auto address = atomic_effective_address<ExpectedT>(*memory, arg, entry);
+    if (!address.has_value())
+        return true;
+
+    if (!memory->type().limits().is_shared())
+        return set_trap("Atomic wait on a non-shared memory"sv);
+    if (!configuration.can_suspend())
+        return set_trap("Atomic wait in an agent that cannot suspend"sv);
+
+    // A negative timeout waits forever.
+    Optional<AK::Duration> duration;
+    if (timeout >= 0)
+        duration = AK::Duration::from_nanoseconds(timeout);
+
+    auto result = memory->wait(*address, expected, sizeof(ExpectedT), duration);
+    entry = Value(static_cast<i32>(to_underlying(result)));
+    return false;
+}
+
+template<SourceAddressMix mix>
+bool BytecodeInterpreter::atomic_notify(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
+    auto memory = configuration.store().unsafe_get(configuration.frame().module().memories().data()[arg.memory_index.value()]);
+    // bounds checked by verifier.
+    auto count = static_cast<u32>(configuration.take_source<mix>(0, addresses.sources).template to<i32>());
+    auto& entry = configuration.source_value<mix>(1, addresses.sources);
+    auto address = atomic_effective_address<u32>(*memory, arg, entry);
+    if (!address.has_value())
+        return true;
+
+    // There can be no waiters on a memory that isn't shared.
+    auto woken_count = memory->type().limits().is_shared() ? memory->notify(*address, count) : 0;
+    entry = Value(static_cast<i32>(woken_count));
+    return false;
+}
+
 template<typename T>
 T BytecodeInterpreter::read_value(ReadonlyBytes data)
 {
@@ -6903,6 +7756,36 @@ Instruction& InstructionStorage::append(Instruction instruction)
     return slot.value();
 }
 
+static Optional<OpCode> fused_compare_and_branch_if_opcode(OpCode compare_opcode)
+{
+    switch (compare_opcode.value()) {
+    case Instructions::i32_eqz.value():
+        return Instructions::synthetic_i32_eqz_br_if;
+    case Instructions::i32_eq.value():
+        return Instructions::synthetic_i32_eq_br_if;
+    case Instructions::i32_ne.value():
+        return Instructions::synthetic_i32_ne_br_if;
+    case Instructions::i32_lts.value():
+        return Instructions::synthetic_i32_lts_br_if;
+    case Instructions::i32_ltu.value():
+        return Instructions::synthetic_i32_ltu_br_if;
+    case Instructions::i32_gts.value():
+        return Instructions::synthetic_i32_gts_br_if;
+    case Instructions::i32_gtu.value():
+        return Instructions::synthetic_i32_gtu_br_if;
+    case Instructions::i32_les.value():
+        return Instructions::synthetic_i32_les_br_if;
+    case Instructions::i32_leu.value():
+        return Instructions::synthetic_i32_leu_br_if;
+    case Instructions::i32_ges.value():
+        return Instructions::synthetic_i32_ges_br_if;
+    case Instructions::i32_geu.value():
+        return Instructions::synthetic_i32_geu_br_if;
+    default:
+        return {};
+    }
+}
+
 CompiledInstructions try_compile_instructions(Expression const& expression, Span<FunctionType const> functions, Span<CodeSection::Func const* const> callee_bodies, size_t current_function_index, size_t caller_local_count, size_t imported_function_count)
 {
     CompiledInstructions result;
@@ -6967,6 +7850,13 @@ CompiledInstructions try_compile_instructions(Expression const& expression, Span
             // we can't zero reference-typed locals without potentially dropping a live reference, so reject those callees.
             if (local.type().is_reference())
                 return nullptr;
+            // The inlined locals aren't part of the caller's local types, so Cranelift would treat a v128 one as i64.
+            if (local.type().kind() == ValueType::V128)
+                return nullptr;
+        }
+        for (auto const& parameter : functions[func_index].parameters()) {
+            if (parameter.kind() == ValueType::V128)
+                return nullptr;
         }
         for (auto& gi : callee->body().instructions()) {
             if (first_is_one_of(gi.opcode(),
@@ -7146,6 +8036,17 @@ CompiledInstructions try_compile_instructions(Expression const& expression, Span
             calls_in_expression++;
         }
 
+        if (instruction.opcode() == Instructions::br_if && !result.dispatches.is_empty()) {
+            // `i32.lt_s; br_if l` -> `i32.lt_s_br_if l`, and likewise for the other i32 comparisons.
+            if (auto fused_opcode = fused_compare_and_branch_if_opcode(result.dispatches.last().instruction->opcode()); fused_opcode.has_value()) {
+                set_default_dispatch(nop, result.dispatches.size() - 1);
+                auto& extra_instruction = append_extra_instruction(*fused_opcode, instruction.arguments());
+                set_default_dispatch(extra_instruction);
+                pattern_state = InsnPatternState::Nothing;
+                continue;
+            }
+        }
+
         switch (pattern_state) {
         case InsnPatternState::Nothing:
             if (instruction.opcode() == Instructions::local_get) {
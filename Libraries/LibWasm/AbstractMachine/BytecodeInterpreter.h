@@ -71,6 +71,7 @@ struct WASM_API BytecodeInterpreter final : public Interpreter {
         UsingStack,
     };
 
+    void interpret_frame(Configuration&);
     template<bool HasCompiledList, bool HasDynamicInsnLimit, bool HaveDirectThreadingInfo>
     void interpret_impl(Configuration&, Expression const&);
 
@@ -100,9 +101,34 @@ struct WASM_API BytecodeInterpreter final : public Interpreter {
     template<typename M, template<typename> typename SetSign, typename VectorType = Native128ByteVectorOf<M, SetSign>>
     VectorType pop_vector(Configuration&, size_t source, SourcesAndDestination const&);
     bool store_to_memory(Configuration&, Instruction::MemoryArgument const&, ReadonlyBytes data, Value const& base);
+
+    enum class AtomicOperation {
+        Add,
+        Subtract,
+        And,
+        Or,
+        Xor,
+        Exchange,
+    };
+
+    template<typename T>
+    Optional<u64> atomic_effective_address(MemoryInstance const&, Instruction::MemoryArgument const&, Value const& base);
+    template<typename ReadT, typename PushT, SourceAddressMix>
+    bool atomic_load_and_push(Configuration&, Instruction const&, SourcesAndDestination const&);
+    template<typename PopT, typename StoreT>
+    bool atomic_pop_and_store(Configuration&, Instruction const&, SourcesAndDestination const&);
+    template<typename AccessT, typename PushT, AtomicOperation, SourceAddressMix>
+    bool atomic_read_modify_write(Configuration&, Instruction const&, SourcesAndDestination const&);
+    template<typename AccessT, typename PushT, SourceAddressMix>
+    bool atomic_compare_exchange(Configuration&, Instruction const&, SourcesAndDestination const&);
+    template<typename ExpectedT, SourceAddressMix>
+    bool atomic_wait(Configuration&, Instruction const&, SourcesAndDestination const&);
+    template<SourceAddressMix>
+    bool atomic_notify(Configuration&, Instruction const&, SourcesAndDestination const&);
     Outcome call_address(Configuration&, FunctionAddress, SourcesAndDestination const&, CallAddressSource = CallAddressSource::DirectCall, CallType = CallType::UsingStack);
     Outcome run_compiled_function_direct(Configuration&);
     Outcome run_native_entry(Configuration&);
+    void make_pending_tail_calls(Configuration&);
     bool trap_if_insufficient_native_stack_space(size_t minimum_native_stack_space_to_keep_free = 2 * MiB);
 
     template<typename T>
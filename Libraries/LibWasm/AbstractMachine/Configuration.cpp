@@ -7,6 +7,7 @@
 #include <AK/MemoryStream.h>
 #include <LibWasm/AbstractMachine/Configuration.h>
 #include <LibWasm/AbstractMachine/Interpreter.h>
+#include <LibWasm/AbstractMachine/Validator.h>
 #include <LibWasm/Printer/Printer.h>
 
 namespace Wasm {
@@ -20,6 +21,8 @@ void Configuration::unwind_impl()
     if (m_frame_stack.last().owns_locals())
         released_locals = m_owned_locals_stack.take_last();
     m_frame_stack.remove(m_frame_stack.size() - 1);
+    if (m_profiling_stack) [[unlikely]]
+        m_profiling_stack->pop();
 
     if (m_frame_stack.is_empty()) {
         m_locals_base = nullptr;
@@ -59,12 +62,28 @@ ErrorOr<Optional<HostFunction&>, Trap> Configuration::prepare_call(FunctionAddre
     return function->get<HostFunction>();
 }
 
+ErrorOr<void, Trap> Configuration::validate_lazily(WasmFunction const& wasm_function)
+{
+    // The module was validated lazily, so this body gets validated (and compiled) on its first call.
+    auto module = wasm_function.module_ref();
+    if (!module || !module->lazy_function_validation())
+        return Trap::from_string("Attempt to call a function that has not been validated");
+
+    auto code_index = static_cast<size_t>(&wasm_function.code() - module->code_section().functions().data());
+    if (auto result = module->lazy_function_validation()->validate_function(*module, code_index); result.is_error())
+        return Trap::from_string(ByteString::formatted("Validation failed: {}", result.error()));
+    return {};
+}
+
 ErrorOr<void, Trap> Configuration::prepare_wasm_call(WasmFunction const& wasm_function, Vector<Value, ArgumentsStaticSize>& arguments, bool is_tailcall)
 {
     // Tier-0 by default: don't block the call waiting for native compilation. Non-Web embedders
     // compile synchronously at instantiate time (so the JIT is already live here); the Web path
     // compiles in the background and the interpreter picks up the native entry on a later call
     // once it's published. Either way, execution falls back to the interpreter until then.
+    if (wasm_function.code().func().body().needs_validation())
+        TRY(validate_lazily(wasm_function));
+
     if (is_tailcall)
         unwind_impl();
 
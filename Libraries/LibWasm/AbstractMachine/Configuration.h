@@ -8,6 +8,7 @@
 
 #include <AK/DoublyLinkedList.h>
 #include <LibWasm/AbstractMachine/AbstractMachine.h>
+#include <LibWasm/AbstractMachine/Profiler.h>
 #include <LibWasm/AbstractMachine/ValueStack.h>
 #include <LibWasm/Types.h>
 
@@ -32,12 +33,18 @@ class Configuration {
 public:
     explicit Configuration(Store& store)
         : m_store(store)
+        , m_profiling_stack(Profiler::stack_for_current_thread())
     {
         m_store.register_configuration({}, *this);
+        if (m_profiling_stack) [[unlikely]]
+            m_profiling_base_depth = m_profiling_stack->depth();
     }
 
     ~Configuration()
     {
+        // Frames abandoned by a trap are never unwound, so drop whatever this configuration left on the profiling stack.
+        if (m_profiling_stack) [[unlikely]]
+            m_profiling_stack->restore_depth(m_profiling_base_depth);
         m_store.unregister_configuration({}, *this);
     }
 
@@ -46,6 +53,8 @@ public:
         m_owned_locals_stack.append(move(locals));
         auto* locals_ptr = m_owned_locals_stack.last().data();
         m_frame_stack.empend(module, locals_ptr, expression, arity, /* owns_locals = */ true);
+        if (m_profiling_stack) [[unlikely]]
+            m_profiling_stack->push(m_store, module, expression, ExecutionTier::Interpreter);
 
         auto& frame = m_frame_stack.last();
         m_locals_base = locals_ptr;
@@ -87,6 +96,10 @@ public:
         auto const* table = same_module ? m_frame_stack.last().compiled_fn_table() : &module.compiled_fn_table(m_store);
         m_frame_stack.empend(module, locals_ptr, expression, arity);
         m_frame_stack.last().set_compiled_fn_table(table);
+        // No label of its own, but exception unwinding and tail calls must not reach into the caller's labels.
+        m_frame_stack.last().label_index() = m_label_stack.size();
+        if (m_profiling_stack) [[unlikely]]
+            m_profiling_stack->push(m_store, module, expression, ExecutionTier::Cranelift);
         m_locals_base = locals_ptr;
         if (!same_module) {
             auto const& memories = module.memories();
@@ -108,6 +121,7 @@ public:
     ALWAYS_INLINE auto& value_stack() const { return m_value_stack; }
     ALWAYS_INLINE auto& value_stack() { return m_value_stack; }
     ALWAYS_INLINE auto& label_stack() const { return m_label_stack; }
+    ALWAYS_INLINE ProfilingStack* profiling_stack() { return m_profiling_stack; }
     ALWAYS_INLINE auto& label_stack() { return m_label_stack; }
     ALWAYS_INLINE auto& store() const { return m_store; }
     ALWAYS_INLINE auto& store() { return m_store; }
@@ -115,6 +129,16 @@ public:
     ALWAYS_INLINE Value& compiled_call_result_scratch() { return m_compiled_call_result_scratch; }
     ALWAYS_INLINE Value const& compiled_call_result_scratch() const { return m_compiled_call_result_scratch; }
 
+    // Native code can't replace its own frame, so compiled functions leave their tail calls to other functions here
+    // for whoever entered them to make (see BytecodeInterpreter::make_pending_tail_calls()).
+    struct PendingTailCall {
+        FunctionAddress address;
+        Vector<Value, ArgumentsStaticSize> arguments;
+    };
+    void set_pending_tail_call(PendingTailCall tail_call) { m_pending_tail_call = move(tail_call); }
+    bool has_pending_tail_call() const { return m_pending_tail_call.has_value(); }
+    PendingTailCall take_pending_tail_call() { return m_pending_tail_call.release_value(); }
+
     ALWAYS_INLINE Value const& local(LocalIndex index) const { return m_locals_base[index.value()]; }
     ALWAYS_INLINE Value& local(LocalIndex index) { return m_locals_base[index.value()]; }
     ALWAYS_INLINE Value* locals_base() const { return m_locals_base; }
@@ -167,6 +191,10 @@ public:
     void enable_instruction_count_limit() { m_should_limit_instruction_count = true; }
     bool should_limit_instruction_count() const { return m_should_limit_instruction_count; }
 
+    // Whether memory.atomic.wait may block the calling thread; agents that can't suspend trap instead.
+    void disallow_suspension() { m_can_suspend = false; }
+    bool can_suspend() const { return m_can_suspend; }
+
     void dump_stack();
 
     void get_arguments_allocation_if_possible(Vector<Value, ArgumentsStaticSize>& arguments, size_t max_size)
@@ -295,6 +323,8 @@ public:
         Value(0),
     };
 
+    ErrorOr<void, Trap> validate_lazily(WasmFunction const&);
+
     // Public for CraneliftBridge direct call pop_frame.
     void unwind_impl();
 
@@ -308,10 +338,14 @@ public:
     size_t m_depth { 0 };
     u64 m_ip { 0 };
     bool m_should_limit_instruction_count { false };
+    bool m_can_suspend { true };
     Value* m_locals_base { nullptr };
     Value* m_call_record_base { nullptr };
     MemoryInstance* m_default_memory { nullptr };
     Value m_compiled_call_result_scratch;
+    Optional<PendingTailCall> m_pending_tail_call;
+    ProfilingStack* m_profiling_stack { nullptr };
+    size_t m_profiling_base_depth { 0 };
 };
 
 }
@@ -0,0 +1,551 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashTable.h>
+#include <AK/JsonArray.h>
+#include <AK/LEB128.h>
+#include <AK/MemoryStream.h>
+#include <AK/NeverDestroyed.h>
+#include <AK/QuickSort.h>
+#include <LibCore/System.h>
+#include <LibThreading/Thread.h>
+#include <LibWasm/AbstractMachine/AbstractMachine.h>
+#include <LibWasm/AbstractMachine/Profiler.h>
+#include <LibWasm/Types.h>
+
+namespace Wasm {
+
+static constexpr u32 invalid_function_id = 0xffffffff;
+
+namespace {
+
+// Everything the current thread remembers about the running profile, so that pushing a frame doesn't have to take
+// the profiler's lock once the function has been seen.
+struct ThreadProfilingState {
+    ~ThreadProfilingState()
+    {
+        if (stack)
+            Profiler::the().unregister_stack(*stack);
+    }
+
+    OwnPtr<ProfilingStack> stack;
+    u32 generation { 0 };
+    HashMap<Expression const*, u64> entries;
+    HashTable<u32> functions_seen_in_native_code;
+};
+
+}
+
+static thread_local ThreadProfilingState s_thread_state;
+static Atomic<u32> s_next_thread_index { 0 };
+
+static ThreadProfilingState& thread_state_for(u32 generation)
+{
+    auto& state = s_thread_state;
+    if (state.generation != generation) {
+        state.entries.clear();
+        state.functions_seen_in_native_code.clear();
+        state.generation = generation;
+    }
+    return state;
+}
+
+static u32 generation_of(u64 entry)
+{
+    return static_cast<u32>((entry >> ProfilingStack::generation_shift) & ProfilingStack::generation_mask);
+}
+
+static u32 function_id_of(u64 entry)
+{
+    return static_cast<u32>(entry & ProfilingStack::function_id_mask);
+}
+
+static ExecutionTier tier_of(u64 entry)
+{
+    return (entry & ProfilingStack::tier_bit) ? ExecutionTier::Cranelift : ExecutionTier::Interpreter;
+}
+
+void ProfilingStack::push(Store& store, ModuleInstance const& module, Expression const& expression, ExecutionTier tier)
+{
+    auto& profiler = Profiler::the();
+    auto& state = thread_state_for(profiler.generation());
+    auto entry = state.entries.ensure(&expression, [&] { return profiler.entry_for(module, expression, store); });
+
+    auto depth = m_depth.load(AK::MemoryOrder::memory_order_relaxed);
+    if (depth < capacity)
+        m_entries[depth].store(entry, AK::MemoryOrder::memory_order_relaxed);
+    // Publish the entry before the depth that makes it visible to the sampler.
+    m_depth.store(depth + 1, AK::MemoryOrder::memory_order_release);
+
+    if (tier == ExecutionTier::Cranelift)
+        set_top_tier(tier);
+}
+
+void ProfilingStack::pop()
+{
+    auto depth = m_depth.load(AK::MemoryOrder::memory_order_relaxed);
+    if (depth > 0)
+        m_depth.store(depth - 1, AK::MemoryOrder::memory_order_release);
+}
+
+void ProfilingStack::set_top_tier(ExecutionTier tier)
+{
+    auto depth = m_depth.load(AK::MemoryOrder::memory_order_relaxed);
+    if (depth == 0 || depth > capacity)
+        return;
+
+    auto& slot = m_entries[depth - 1];
+    auto entry = slot.load(AK::MemoryOrder::memory_order_relaxed);
+    if (tier_of(entry) == tier)
+        return;
+
+    auto tiered_entry = tier == ExecutionTier::Cranelift ? (entry | tier_bit) : (entry & ~tier_bit);
+    slot.store(tiered_entry, AK::MemoryOrder::memory_order_relaxed);
+
+    if (tier == ExecutionTier::Cranelift) {
+        auto& profiler = Profiler::the();
+        auto& state = thread_state_for(profiler.generation());
+        if (generation_of(entry) == state.generation && state.functions_seen_in_native_code.set(function_id_of(entry)) == HashSetResult::InsertedNewEntry)
+            profiler.note_native_execution(entry);
+    }
+}
+
+void ProfilingStack::read_frames(Vector<u64>& frames) const
+{
+    auto depth = min(m_depth.load(AK::MemoryOrder::memory_order_acquire), capacity);
+    for (size_t i = 0; i < depth; ++i)
+        frames.append(m_entries[i].load(AK::MemoryOrder::memory_order_relaxed));
+}
+
+Profiler& Profiler::the()
+{
+    static NeverDestroyed<Profiler> profiler;
+    return *profiler;
+}
+
+ProfilingStack* Profiler::stack_for_current_thread()
+{
+    auto& profiler = the();
+    if (!profiler.is_running()) [[likely]]
+        return nullptr;
+
+    auto& state = s_thread_state;
+    if (!state.stack) {
+        auto index = s_next_thread_index.fetch_add(1);
+        state.stack = make<ProfilingStack>(index);
+        profiler.register_stack(*state.stack, ByteString::formatted("Wasm thread {}", index));
+    }
+    return state.stack.ptr();
+}
+
+// https://webassembly.github.io/spec/core/appendix/custom.html#name-section
+static HashMap<u32, ByteString> parse_function_names(Module const& module)
+{
+    HashMap<u32, ByteString> names;
+    for (auto const& section : module.custom_sections()) {
+        if (section.name() != "name"sv)
+            continue;
+
+        FixedMemoryStream stream { section.contents().bytes() };
+        auto parse = [&]() -> ErrorOr<void> {
+            while (!stream.is_eof()) {
+                auto id = TRY(stream.read_value<u8>());
+                auto size = TRY(stream.read_value<LEB128<u32>>());
+                // Subsection 1 holds the function names; the module and local names aren't interesting here.
+                if (id != 1) {
+                    TRY(stream.discard(size));
+                    continue;
+                }
+
+                auto count = TRY(stream.read_value<LEB128<u32>>());
+                for (u32 i = 0; i < count; ++i) {
+                    auto index = TRY(stream.read_value<LEB128<u32>>());
+                    auto length = TRY(stream.read_value<LEB128<u32>>());
+                    auto buffer = TRY(ByteBuffer::create_uninitialized(length));
+                    TRY(stream.read_until_filled(buffer));
+                    names.set(index, ByteString { buffer.bytes() });
+                }
+            }
+            return {};
+        };
+        // A malformed name section must not break execution, so just keep whatever names could be read.
+        (void)parse();
+    }
+    return names;
+}
+
+ErrorOr<void> Profiler::start(AK::Duration interval)
+{
+    if (is_running())
+        return Error::from_string_literal("The Wasm profiler is already running");
+
+    {
+        Sync::MutexLocker locker(m_mutex);
+        m_interval = interval;
+        m_function_ids.clear();
+        m_function_names.clear();
+        m_functions.clear();
+        m_samples.clear();
+        m_sample_frames.clear();
+        m_threads.clear();
+        for (auto const& it : m_stacks)
+            m_threads.append(it.value);
+
+        // Frames pushed during an earlier profile carry an older generation, so they are ignored from now on.
+        m_generation.store((m_generation.load() + 1) & ProfilingStack::generation_mask);
+        m_start_time = MonotonicTime::now();
+        m_should_stop.store(false);
+        m_running.store(true);
+    }
+
+    m_sampler = Threading::Thread::construct("WasmProfiler"sv, [this] {
+        while (!m_should_stop.load()) {
+            (void)Core::System::sleep_ms(static_cast<u32>(max<i64>(1, m_interval.to_milliseconds())));
+            take_samples();
+        }
+        return static_cast<intptr_t>(0);
+    });
+    m_sampler->start();
+    return {};
+}
+
+void Profiler::stop()
+{
+    if (!is_running())
+        return;
+
+    m_should_stop.store(true);
+    (void)m_sampler->join();
+    m_sampler = nullptr;
+
+    Sync::MutexLocker locker(m_mutex);
+    m_running.store(false);
+
+    // The function names were copied out already, so the modules don't have to stay alive any longer.
+    m_function_ids.clear();
+    m_function_names.clear();
+    for (auto& function : m_functions)
+        function.module = nullptr;
+}
+
+u64 Profiler::entry_for(ModuleInstance const& module, Expression const& expression, Store& store)
+{
+    Sync::MutexLocker locker(m_mutex);
+    u64 entry = static_cast<u64>(m_generation.load()) << ProfilingStack::generation_shift;
+    if (!is_running())
+        return entry | invalid_function_id;
+
+    if (auto id = m_function_ids.get(&expression); id.has_value())
+        return entry | *id;
+
+    // Constant expressions, like global initializers, run in frames of their own too.
+    FunctionRecord record { .name = "(constant expression)", .function_index = invalid_function_id, .first_seen = elapsed() };
+    for (size_t i = 0; i < module.functions().size(); ++i) {
+        auto* function = store.unsafe_get(module.functions()[i])->get_pointer<WasmFunction>();
+        if (!function || &function->code().func().body() != &expression)
+            continue;
+
+        record.function_index = static_cast<u32>(i);
+        record.module = function->module_ref();
+        Optional<ByteString> name;
+        if (record.module) {
+            auto& names = m_function_names.ensure(record.module.ptr(), [&] { return parse_function_names(*record.module); });
+            name = names.get(record.function_index).copy();
+        }
+        record.name = name.value_or_lazy_evaluated([&] { return ByteString::formatted("wasm-function[{}]", i); });
+        break;
+    }
+
+    auto id = static_cast<u32>(m_functions.size());
+    m_functions.append(move(record));
+    m_function_ids.set(&expression, id);
+    return entry | id;
+}
+
+void Profiler::note_native_execution(u64 entry)
+{
+    Sync::MutexLocker locker(m_mutex);
+    auto id = function_id_of(entry);
+    if (!is_running() || generation_of(entry) != m_generation.load() || id >= m_functions.size())
+        return;
+
+    auto& function = m_functions[id];
+    if (!function.first_native.has_value())
+        function.first_native = elapsed();
+}
+
+void Profiler::register_stack(ProfilingStack& stack, ByteString thread_name)
+{
+    Sync::MutexLocker locker(m_mutex);
+    ThreadRecord record { move(thread_name), stack.thread_index() };
+    m_threads.append(record);
+    m_stacks.set(&stack, move(record));
+}
+
+void Profiler::unregister_stack(ProfilingStack& stack)
+{
+    Sync::MutexLocker locker(m_mutex);
+    m_stacks.remove(&stack);
+}
+
+void Profiler::take_samples()
+{
+    Sync::MutexLocker locker(m_mutex);
+    auto time = elapsed();
+    auto generation = m_generation.load();
+
+    Vector<u64> frames;
+    for (auto const& it : m_stacks) {
+        frames.clear_with_capacity();
+        it.key->read_frames(frames);
+        frames.remove_all_matching([&](u64 entry) {
+            return generation_of(entry) != generation || function_id_of(entry) >= m_functions.size();
+        });
+        // Idle threads aren't interesting, and recording them would only make the profile bigger.
+        if (frames.is_empty())
+            continue;
+
+        m_samples.append({ it.value.index, time, m_sample_frames.size(), frames.size() });
+        m_sample_frames.extend(frames);
+    }
+}
+
+Vector<FunctionProfile> Profiler::function_profiles() const
+{
+    Sync::MutexLocker locker(m_mutex);
+
+    Vector<FunctionProfile> profiles;
+    profiles.ensure_capacity(m_functions.size());
+    for (auto const& function : m_functions) {
+        FunctionProfile profile;
+        profile.name = function.name;
+        profile.function_index = function.function_index;
+        if (function.first_native.has_value())
+            profile.time_to_tier_up = *function.first_native - function.first_seen;
+        profiles.append(move(profile));
+    }
+
+    HashTable<u32> functions_in_sample;
+    for (auto const& sample : m_samples) {
+        auto frames = m_sample_frames.span().slice(sample.first_frame, sample.frame_count);
+
+        auto& innermost = profiles[function_id_of(frames.last())];
+        ++innermost.self_samples;
+        if (tier_of(frames.last()) == ExecutionTier::Cranelift)
+            ++innermost.cranelift_samples;
+        else
+            ++innermost.interpreter_samples;
+
+        // Recursive functions only count once per sample towards their total time.
+        functions_in_sample.clear_with_capacity();
+        for (auto entry : frames) {
+            if (functions_in_sample.set(function_id_of(entry)) == HashSetResult::InsertedNewEntry)
+                ++profiles[function_id_of(entry)].total_samples;
+        }
+    }
+
+    profiles.remove_all_matching([](auto const& profile) { return profile.total_samples == 0; });
+    quick_sort(profiles, [](auto const& a, auto const& b) {
+        if (a.self_samples != b.self_samples)
+            return a.self_samples > b.self_samples;
+        return a.total_samples > b.total_samples;
+    });
+    return profiles;
+}
+
+enum class ProfileCategory : u8 {
+    Other,
+    Interpreter,
+    Cranelift,
+};
+
+static double to_milliseconds(AK::Duration duration)
+{
+    return static_cast<double>(duration.to_nanoseconds()) / 1'000'000.0;
+}
+
+static JsonObject make_schema(std::initializer_list<StringView> fields)
+{
+    JsonObject schema;
+    int index = 0;
+    for (auto field : fields)
+        schema.set(field, index++);
+    return schema;
+}
+
+static JsonObject make_table(std::initializer_list<StringView> fields, JsonArray data)
+{
+    JsonObject table;
+    table.set("schema"sv, make_schema(fields));
+    table.set("data"sv, move(data));
+    return table;
+}
+
+// https://github.com/firefox-devtools/profiler/blob/main/docs-developer/gecko-profile-format.md
+JsonObject Profiler::to_gecko_profile() const
+{
+    Sync::MutexLocker locker(m_mutex);
+
+    auto start_time = UnixDateTime::now() - (MonotonicTime::now() - m_start_time);
+
+    JsonArray categories;
+    auto add_category = [&](StringView name, StringView color) {
+        JsonObject category;
+        category.set("name"sv, name);
+        category.set("color"sv, color);
+        JsonArray subcategories;
+        subcategories.must_append("Other"sv);
+        category.set("subcategories"sv, move(subcategories));
+        categories.must_append(move(category));
+    };
+    add_category("Other"sv, "grey"sv);
+    add_category("Wasm Interpreter"sv, "yellow"sv);
+    add_category("Wasm Cranelift"sv, "green"sv);
+
+    JsonObject tier_up_field;
+    tier_up_field.set("key"sv, "function"sv);
+    tier_up_field.set("label"sv, "Function"sv);
+    tier_up_field.set("format"sv, "string"sv);
+    JsonArray tier_up_fields;
+    tier_up_fields.must_append(move(tier_up_field));
+    JsonArray tier_up_display;
+    tier_up_display.must_append("marker-chart"sv);
+    tier_up_display.must_append("marker-table"sv);
+    JsonObject tier_up_schema;
+    tier_up_schema.set("name"sv, "WasmTierUp"sv);
+    tier_up_schema.set("tableLabel"sv, "{marker.data.function}"sv);
+    tier_up_schema.set("display"sv, move(tier_up_display));
+    tier_up_schema.set("data"sv, move(tier_up_fields));
+    JsonArray marker_schema;
+    marker_schema.must_append(move(tier_up_schema));
+
+    JsonObject meta;
+    meta.set("version"sv, 27);
+    meta.set("interval"sv, to_milliseconds(m_interval));
+    meta.set("startTime"sv, static_cast<double>(start_time.milliseconds_since_epoch()));
+    meta.set("shutdownTime"sv, JsonValue {});
+    meta.set("processType"sv, 0);
+    meta.set("product"sv, "Ladybird Wasm"sv);
+    meta.set("stackwalk"sv, 0);
+    meta.set("debug"sv, 0);
+    meta.set("gcpoison"sv, 0);
+    meta.set("asyncstack"sv, 0);
+    meta.set("presymbolicated"sv, true);
+    meta.set("categories"sv, move(categories));
+    meta.set("markerSchema"sv, move(marker_schema));
+
+    auto pid = Core::System::getpid();
+
+    JsonArray threads;
+    for (auto const& thread : m_threads) {
+        JsonArray strings;
+        HashMap<u32, u32> string_indices;
+        auto string_for = [&](u32 function_id) {
+            return string_indices.ensure(function_id, [&] {
+                strings.must_append(m_functions[function_id].name.view());
+                return static_cast<u32>(strings.size() - 1);
+            });
+        };
+
+        // Each function gets a frame per tier, so the tiers show up as separate categories.
+        JsonArray frames;
+        HashMap<u64, u32> frame_indices;
+        auto frame_for = [&](u64 entry) {
+            auto key = entry & (ProfilingStack::tier_bit | ProfilingStack::function_id_mask);
+            return frame_indices.ensure(key, [&] {
+                auto category = tier_of(entry) == ExecutionTier::Cranelift ? ProfileCategory::Cranelift : ProfileCategory::Interpreter;
+                JsonArray frame;
+                frame.must_append(string_for(function_id_of(entry)));
+                frame.must_append(false);
+                frame.must_append(0);
+                frame.must_append(JsonValue {});
+                frame.must_append(JsonValue {});
+                frame.must_append(JsonValue {});
+                frame.must_append(to_underlying(category));
+                frame.must_append(0);
+                frames.must_append(move(frame));
+                return static_cast<u32>(frames.size() - 1);
+            });
+        };
+
+        JsonArray stacks;
+        HashMap<u64, u32> stack_indices;
+        auto stack_for = [&](Optional<u32> prefix, u32 frame) {
+            auto key = (static_cast<u64>(prefix.value_or(0xffffffff)) << 32) | frame;
+            return stack_indices.ensure(key, [&] {
+                JsonArray stack;
+                stack.must_append(prefix.has_value() ? JsonValue { *prefix } : JsonValue {});
+                stack.must_append(frame);
+                stacks.must_append(move(stack));
+                return static_cast<u32>(stacks.size() - 1);
+            });
+        };
+
+        JsonArray samples;
+        HashTable<u32> functions_in_thread;
+        for (auto const& sample : m_samples) {
+            if (sample.thread_index != thread.index)
+                continue;
+
+            Optional<u32> stack;
+            for (auto entry : m_sample_frames.span().slice(sample.first_frame, sample.frame_count)) {
+                stack = stack_for(stack, frame_for(entry));
+                functions_in_thread.set(function_id_of(entry));
+            }
+
+            JsonArray row;
+            row.must_append(*stack);
+            row.must_append(to_milliseconds(sample.time));
+            row.must_append(0);
+            samples.must_append(move(row));
+        }
+
+        // Functions that tiered up while they were being sampled get a marker spanning the time until then.
+        JsonArray markers;
+        for (auto id : functions_in_thread) {
+            auto const& function = m_functions[id];
+            if (!function.first_native.has_value())
+                continue;
+
+            JsonObject data;
+            data.set("type"sv, "WasmTierUp"sv);
+            data.set("function"sv, function.name.view());
+
+            JsonArray marker;
+            marker.must_append(string_for(id));
+            marker.must_append(to_milliseconds(function.first_seen));
+            marker.must_append(to_milliseconds(*function.first_native));
+            marker.must_append(1);
+            marker.must_append(to_underlying(ProfileCategory::Cranelift));
+            marker.must_append(move(data));
+            markers.must_append(move(marker));
+        }
+
+        JsonObject thread_object;
+        thread_object.set("name"sv, thread.name.view());
+        thread_object.set("processType"sv, "default"sv);
+        thread_object.set("pid"sv, pid);
+        thread_object.set("tid"sv, thread.index);
+        thread_object.set("registerTime"sv, 0);
+        thread_object.set("unregisterTime"sv, JsonValue {});
+        thread_object.set("samples"sv, make_table({ "stack"sv, "time"sv, "eventDelay"sv }, move(samples)));
+        thread_object.set("markers"sv, make_table({ "name"sv, "startTime"sv, "endTime"sv, "phase"sv, "category"sv, "data"sv }, move(markers)));
+        thread_object.set("stackTable"sv, make_table({ "prefix"sv, "frame"sv }, move(stacks)));
+        thread_object.set("frameTable"sv, make_table({ "location"sv, "relevantForJS"sv, "innerWindowID"sv, "implementation"sv, "line"sv, "column"sv, "category"sv, "subcategory"sv }, move(frames)));
+        thread_object.set("stringTable"sv, move(strings));
+        threads.must_append(move(thread_object));
+    }
+
+    JsonObject profile;
+    profile.set("meta"sv, move(meta));
+    profile.set("libs"sv, JsonArray {});
+    profile.set("threads"sv, move(threads));
+    profile.set("processes"sv, JsonArray {});
+    profile.set("pausedRanges"sv, JsonArray {});
+    return profile;
+}
+
+}
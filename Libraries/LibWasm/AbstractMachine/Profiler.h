@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Atomic.h>
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/JsonObject.h>
+#include <AK/RefPtr.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibSync/Mutex.h>
+#include <LibWasm/Export.h>
+
+namespace Threading {
+class Thread;
+}
+
+namespace Wasm {
+
+class Expression;
+class Module;
+class ModuleInstance;
+class Store;
+
+enum class ExecutionTier : u8 {
+    Interpreter,
+    Cranelift,
+};
+
+// The Wasm frames a thread is currently executing, kept up to date by Configuration so the profiler's sampler thread
+// can read them at any time. Entries are only written by the owning thread.
+class ProfilingStack {
+    AK_MAKE_NONCOPYABLE(ProfilingStack);
+    AK_MAKE_NONMOVABLE(ProfilingStack);
+
+public:
+    static constexpr size_t capacity = 1024;
+
+    ProfilingStack(u32 thread_index)
+        : m_thread_index(thread_index)
+    {
+    }
+
+    void push(Store&, ModuleInstance const&, Expression const&, ExecutionTier);
+    void pop();
+
+    // Marks the innermost frame as having entered native code.
+    void set_top_tier(ExecutionTier);
+
+    size_t depth() const { return m_depth.load(AK::MemoryOrder::memory_order_relaxed); }
+    void restore_depth(size_t depth) { m_depth.store(depth, AK::MemoryOrder::memory_order_release); }
+
+    u32 thread_index() const { return m_thread_index; }
+
+    // Copies the stored frames, outermost first, into the given vector. Called from the sampler thread.
+    void read_frames(Vector<u64>&) const;
+
+    static constexpr u64 tier_bit = 1ull << 63;
+    static constexpr u64 function_id_mask = 0xffffffffull;
+    static constexpr u32 generation_shift = 32;
+    static constexpr u64 generation_mask = 0x7fffffffull;
+
+private:
+    Array<Atomic<u64>, capacity> m_entries;
+    Atomic<size_t> m_depth { 0 };
+    u32 m_thread_index { 0 };
+};
+
+struct FunctionProfile {
+    ByteString name;
+    u32 function_index { 0 };
+    size_t self_samples { 0 };
+    size_t total_samples { 0 };
+    size_t interpreter_samples { 0 };
+    size_t cranelift_samples { 0 };
+    // How long the function ran before first entering native code, if it did while the profiler was running.
+    Optional<AK::Duration> time_to_tier_up;
+};
+
+class WASM_API Profiler {
+public:
+    static Profiler& the();
+
+    // The current thread's profiling stack, or null if the profiler isn't running.
+    static ProfilingStack* stack_for_current_thread();
+
+    ErrorOr<void> start(AK::Duration interval = AK::Duration::from_milliseconds(1));
+    void stop();
+    bool is_running() const { return m_running.load(AK::MemoryOrder::memory_order_relaxed); }
+
+    // Exports the last profile in the Gecko profile format, which the Firefox Profiler can open.
+    JsonObject to_gecko_profile() const;
+
+    // The functions that were sampled during the last profile, hottest (by self time) first.
+    Vector<FunctionProfile> function_profiles() const;
+
+    AK::Duration interval() const { return m_interval; }
+
+    // Internal to ProfilingStack.
+    u32 generation() const { return m_generation.load(AK::MemoryOrder::memory_order_relaxed); }
+    u64 entry_for(ModuleInstance const&, Expression const&, Store&);
+    void note_native_execution(u64 entry);
+    void register_stack(ProfilingStack&, ByteString thread_name);
+    void unregister_stack(ProfilingStack&);
+
+private:
+    Profiler() = default;
+
+    struct FunctionRecord {
+        ByteString name;
+        u32 function_index { 0 };
+        RefPtr<Module const> module;
+        AK::Duration first_seen;
+        Optional<AK::Duration> first_native;
+    };
+
+    struct ThreadRecord {
+        ByteString name;
+        u32 index { 0 };
+    };
+
+    struct Sample {
+        u32 thread_index { 0 };
+        AK::Duration time;
+        size_t first_frame { 0 };
+        size_t frame_count { 0 };
+    };
+
+    void take_samples();
+    AK::Duration elapsed() const { return MonotonicTime::now() - m_start_time; }
+
+    mutable Sync::Mutex m_mutex;
+    Atomic<bool> m_running { false };
+    Atomic<bool> m_should_stop { false };
+    Atomic<u32> m_generation { 0 };
+    AK::Duration m_interval;
+    MonotonicTime m_start_time { MonotonicTime::now() };
+    RefPtr<Threading::Thread> m_sampler;
+
+    HashMap<ProfilingStack*, ThreadRecord> m_stacks;
+    Vector<ThreadRecord> m_threads;
+    HashMap<Expression const*, u32> m_function_ids;
+    HashMap<Module const*, HashMap<u32, ByteString>> m_function_names;
+    Vector<FunctionRecord> m_functions;
+    Vector<Sample> m_samples;
+    Vector<u64> m_sample_frames;
+};
+
+}
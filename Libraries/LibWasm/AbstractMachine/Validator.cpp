@@ -14,7 +14,7 @@
 
 namespace Wasm {
 
-ErrorOr<void, ValidationError> Validator::validate(Module& module)
+ErrorOr<void, ValidationError> Validator::validate(Module& module, ValidationMode mode)
 {
     // Pre-emptively make invalid. The module will be set to `Valid` at the end
     // of validation.
@@ -158,9 +158,17 @@ ErrorOr<void, ValidationError> Validator::validate(Module& module)
     TRY(validate(module.global_section()));
     TRY(validate(module.memory_section()));
     TRY(validate(module.table_section()));
-    TRY(validate(module.code_section()));
+    if (mode == ValidationMode::Eager)
+        TRY(validate(module.code_section()));
     TRY(validate(module.tag_section()));
 
+    if (mode == ValidationMode::Lazy) {
+        // Nothing but calling a function depends on its body, so leave validating the bodies until then.
+        for (auto& entry : module.code_section().functions())
+            entry.func().body().set_needs_validation(true);
+        module.set_lazy_function_validation(make<LazyFunctionValidation>(m_context, m_context.imported_function_count + module.code_section().functions().size()), {});
+    }
+
     for (auto& entry : module.code_section().functions())
         module.set_minimum_call_record_allocation_size(max(entry.func().body().compiled_instructions.max_call_rec_size, module.minimum_call_record_allocation_size()));
 
@@ -266,6 +274,15 @@ ErrorOr<void, ValidationError> ensure_cranelift_compiled(Module& module)
         return ValidationError { module.validation_error() };
     }
 
+    // Native code is only generated for the whole module at once, so any bodies left over by lazy validation have to
+    // be validated first. This is what validates lazily validated modules in the background.
+    if (auto* lazy_function_validation = module.lazy_function_validation()) {
+        if (auto result = lazy_function_validation->validate_all_functions(module); result.is_error()) {
+            module.finish_cranelift_compilation();
+            return result.release_error();
+        }
+    }
+
     compile_module_to_native(module);
     module.finish_cranelift_compilation();
     return {};
@@ -414,63 +431,123 @@ ErrorOr<void, ValidationError> Validator::validate(CodeSection const& section)
     Vector<CodeSection::Func const*> callee_bodies;
     callee_bodies.resize(m_context.imported_function_count + section.functions().size());
 
-    size_t index = m_context.imported_function_count;
-    for (auto& entry : section.functions()) {
-        auto function_index = index++;
-        VERIFY(function_index <= NumericLimits<u32>::max());
-        TRY(validate(FunctionIndex { static_cast<u32>(function_index) }));
-        auto& function_type = m_context.functions[function_index];
-        auto& function = entry.func();
-
-        auto function_validator = fork();
-        function_validator.m_context.locals = {};
-        function_validator.m_context.locals.extend(function_type.parameters());
-        function_validator.m_context.current_function_parameter_count = function_type.parameters().size();
-        for (auto& local : function.locals()) {
-            // https://webassembly.github.io/spec/core/valid/modules.html#functions
-            // The locals' value types must be valid (in particular, type uses must exist).
-            TRY(function_validator.validate(local.type()));
-            for (size_t i = 0; i < local.n(); ++i)
-                function_validator.m_context.locals.append(local.type());
-        }
+    for (size_t code_index = 0; code_index < section.functions().size(); ++code_index)
+        TRY(validate_function(section, code_index, callee_bodies.span()));
+
+    return {};
+}
+
+ErrorOr<void, ValidationError> Validator::validate_function(CodeSection const& section, size_t code_index, Span<CodeSection::Func const*> callee_bodies)
+{
+    auto& entry = section.functions()[code_index];
+    auto function_index = m_context.imported_function_count + code_index;
+    VERIFY(function_index <= NumericLimits<u32>::max());
+    TRY(validate(FunctionIndex { static_cast<u32>(function_index) }));
+    auto& function_type = m_context.functions[function_index];
+    auto& function = entry.func();
 
+    auto function_validator = fork();
+    function_validator.m_context.locals = {};
+    function_validator.m_context.locals.extend(function_type.parameters());
+    function_validator.m_context.current_function_parameter_count = function_type.parameters().size();
+    for (auto& local : function.locals()) {
         // https://webassembly.github.io/spec/core/valid/modules.html#functions
-        function_validator.m_local_initialized.clear_with_capacity();
-        function_validator.m_local_init_log.clear_with_capacity();
-        for (auto& parameter : function_type.parameters()) {
-            (void)parameter;
-            function_validator.m_local_initialized.append(true);
-        }
-        for (auto& local : function.locals()) {
-            for (size_t i = 0; i < local.n(); ++i)
-                function_validator.m_local_initialized.append(local.type().is_defaultable());
-        }
+        // The locals' value types must be valid (in particular, type uses must exist).
+        TRY(function_validator.validate(local.type()));
+        for (size_t i = 0; i < local.n(); ++i)
+            function_validator.m_context.locals.append(local.type());
+    }
 
-        function_validator.push_frame(Frame { function_type, FrameKind::Function, (size_t)0 });
+    // https://webassembly.github.io/spec/core/valid/modules.html#functions
+    function_validator.m_local_initialized.clear_with_capacity();
+    function_validator.m_local_init_log.clear_with_capacity();
+    for (auto& parameter : function_type.parameters()) {
+        (void)parameter;
+        function_validator.m_local_initialized.append(true);
+    }
+    for (auto& local : function.locals()) {
+        for (size_t i = 0; i < local.n(); ++i)
+            function_validator.m_local_initialized.append(local.type().is_defaultable());
+    }
 
-        auto results = TRY(function_validator.validate(function.body(), function_type.results(), callee_bodies.span(), function_index));
-        if (results.result_types.size() != function_type.results().size())
-            return Errors::invalid("function result"sv, function_type.results(), results.result_types);
+    function_validator.push_frame(Frame { function_type, FrameKind::Function, (size_t)0 });
 
-        callee_bodies[function_index] = &function;
+    auto results = TRY(function_validator.validate(function.body(), function_type.results(), callee_bodies, function_index));
+    if (results.result_types.size() != function_type.results().size())
+        return Errors::invalid("function result"sv, function_type.results(), results.result_types);
 
-        if (function.body().compiled_instructions.max_call_rec_size != 0) {
-            size_t max_callee_locals = 0;
-            for (auto& insn : function.body().instructions()) {
-                if (!first_is_one_of(insn.opcode(), Instructions::call, Instructions::synthetic_call_with_record_0, Instructions::synthetic_call_with_record_1))
-                    continue;
-                auto callee_index = insn.arguments().template get<FunctionIndex>();
-                if (callee_index.value() - m_context.imported_function_count < section.functions().size())
-                    max_callee_locals = max(max_callee_locals, section.functions()[callee_index.value() - m_context.imported_function_count].func().total_local_count());
-            }
+    callee_bodies[function_index] = &function;
 
-            function.body().compiled_instructions.max_call_rec_size += max_callee_locals;
+    if (function.body().compiled_instructions.max_call_rec_size != 0) {
+        size_t max_callee_locals = 0;
+        for (auto& insn : function.body().instructions()) {
+            if (!first_is_one_of(insn.opcode(), Instructions::call, Instructions::synthetic_call_with_record_0, Instructions::synthetic_call_with_record_1))
+                continue;
+            auto callee_index = insn.arguments().template get<FunctionIndex>();
+            if (callee_index.value() - m_context.imported_function_count < section.functions().size())
+                max_callee_locals = max(max_callee_locals, section.functions()[callee_index.value() - m_context.imported_function_count].func().total_local_count());
         }
+
+        function.body().compiled_instructions.max_call_rec_size += max_callee_locals;
     }
 
     return {};
 }
 
+LazyFunctionValidation::LazyFunctionValidation(Context context, size_t function_count)
+    : m_validator(move(context))
+{
+    m_callee_bodies.resize(function_count);
+}
+
+ErrorOr<void, ValidationError> LazyFunctionValidation::validate_function(Module const& module, size_t code_index)
+{
+    Sync::MutexLocker locker(m_mutex);
+    return validate_function_while_locked(module, code_index);
+}
+
+ErrorOr<void, ValidationError> LazyFunctionValidation::validate_all_functions(Module const& module)
+{
+    auto function_count = module.code_section().functions().size();
+    for (size_t code_index = 0; code_index < function_count; ++code_index) {
+        // Let calls on other threads get in between, so they don't have to wait for the whole module.
+        Sync::MutexLocker locker(m_mutex);
+        TRY(validate_function_while_locked(module, code_index));
+    }
+    return {};
+}
+
+ErrorOr<void, ValidationError> LazyFunctionValidation::validate_function_while_locked(Module const& module, size_t code_index)
+{
+    if (m_error.has_value())
+        return *m_error;
+
+    auto const& body = module.code_section().functions()[code_index].func().body();
+    if (!body.needs_validation())
+        return {};
+
+    if (auto result = m_validator.validate_function(module.code_section(), code_index, m_callee_bodies.span()); result.is_error()) {
+        m_error = result.release_error();
+        return *m_error;
+    }
+    body.set_needs_validation(false);
+    return {};
+}
+
+Optional<ValidationError> LazyFunctionValidation::error() const
+{
+    Sync::MutexLocker locker(m_mutex);
+    return m_error;
+}
+
+Module::~Module() = default;
+
+void Module::set_lazy_function_validation(NonnullOwnPtr<LazyFunctionValidation> validation, Badge<Validator>)
+{
+    VERIFY(!m_lazy_function_validation);
+    m_lazy_function_validation = move(validation);
+}
+
 ErrorOr<void, ValidationError> Validator::validate(TagSection const& section)
 {
     for (auto& entry : section.tags())
@@ -497,6 +574,11 @@ ErrorOr<void, ValidationError> Validator::validate(TableType const& type)
 ErrorOr<void, ValidationError> Validator::validate(MemoryType const& type)
 {
     u64 bound = type.limits().address_type() == AddressType::I64 ? 1ull << 48 : Constants::wasm32_max_pages;
+
+    // https://webassembly.github.io/threads/core/valid/types.html#memory-types
+    if (type.limits().is_shared() && !type.limits().max().has_value())
+        return Errors::invalid("shared memory without a maximum size"sv);
+
     return validate(type.limits(), bound);
 }
 
@@ -5066,6 +5148,417 @@ VALIDATE_INSTRUCTION(i31_get_u)
     return {};
 }
 
+// https://webassembly.github.io/threads/core/valid/instructions.html#atomic-memory-instructions
+ErrorOr<MemoryType, ValidationError> Validator::validate_atomic_memory_argument(Instruction::MemoryArgument const& arg, size_t access_size)
+{
+    auto memory = TRY(validate(arg.memory_index));
+
+    // Unlike other memory accesses, atomic ones must state their natural alignment.
+    if (arg.align > 64 || (1ull << arg.align) != access_size)
+        return Errors::invalid("atomic memory op alignment"sv, access_size, arg.align > 64 ? 0 : 1ull << arg.align);
+
+    return memory;
+}
+
+ErrorOr<void, ValidationError> Validator::validate_atomic_load(Stack& stack, Instruction const& instruction, ValueType type, size_t access_size)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, access_size));
+
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(type);
+    return {};
+}
+
+ErrorOr<void, ValidationError> Validator::validate_atomic_store(Stack& stack, Instruction const& instruction, ValueType type, size_t access_size)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, access_size));
+
+    TRY(stack.take(type));
+    TRY((take_memory_address(stack, memory, arg)));
+    return {};
+}
+
+ErrorOr<void, ValidationError> Validator::validate_atomic_rmw(Stack& stack, Instruction const& instruction, ValueType type, size_t access_size)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, access_size));
+
+    TRY(stack.take(type));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(type);
+    return {};
+}
+
+ErrorOr<void, ValidationError> Validator::validate_atomic_cmpxchg(Stack& stack, Instruction const& instruction, ValueType type, size_t access_size)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, access_size));
+
+    // [at t t] -> [t], with the replacement value on top of the expected one.
+    TRY(stack.take(type));
+    TRY(stack.take(type));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(type);
+    return {};
+}
+
+VALIDATE_INSTRUCTION(memory_atomic_notify)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i32)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(memory_atomic_wait32)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i32)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(memory_atomic_wait64)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i64)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(atomic_fence)
+{
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_load)
+{
+    return validate_atomic_load(stack, instruction, ValueType(ValueType::I32), 4);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_load)
+{
+    return validate_atomic_load(stack, instruction, ValueType(ValueType::I64), 8);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_load8_u)
+{
+    return validate_atomic_load(stack, instruction, ValueType(ValueType::I32), 1);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_load16_u)
+{
+    return validate_atomic_load(stack, instruction, ValueType(ValueType::I32), 2);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_load8_u)
+{
+    return validate_atomic_load(stack, instruction, ValueType(ValueType::I64), 1);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_load16_u)
+{
+    return validate_atomic_load(stack, instruction, ValueType(ValueType::I64), 2);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_load32_u)
+{
+    return validate_atomic_load(stack, instruction, ValueType(ValueType::I64), 4);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_store)
+{
+    return validate_atomic_store(stack, instruction, ValueType(ValueType::I32), 4);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_store)
+{
+    return validate_atomic_store(stack, instruction, ValueType(ValueType::I64), 8);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_store8)
+{
+    return validate_atomic_store(stack, instruction, ValueType(ValueType::I32), 1);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_store16)
+{
+    return validate_atomic_store(stack, instruction, ValueType(ValueType::I32), 2);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_store8)
+{
+    return validate_atomic_store(stack, instruction, ValueType(ValueType::I64), 1);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_store16)
+{
+    return validate_atomic_store(stack, instruction, ValueType(ValueType::I64), 2);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_store32)
+{
+    return validate_atomic_store(stack, instruction, ValueType(ValueType::I64), 4);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_add)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I32), 4);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_add)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 8);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_add_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I32), 1);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_add_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I32), 2);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_add_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 1);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_add_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 2);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_add_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 4);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_sub)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I32), 4);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_sub)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 8);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_sub_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I32), 1);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_sub_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I32), 2);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_sub_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 1);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_sub_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 2);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_sub_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 4);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_and)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I32), 4);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_and)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 8);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_and_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I32), 1);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_and_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I32), 2);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_and_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 1);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_and_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 2);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_and_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 4);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_or)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I32), 4);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_or)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 8);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_or_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I32), 1);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_or_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I32), 2);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_or_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 1);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_or_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 2);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_or_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 4);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_xor)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I32), 4);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_xor)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 8);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_xor_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I32), 1);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_xor_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I32), 2);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_xor_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 1);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_xor_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 2);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_xor_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 4);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_xchg)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I32), 4);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_xchg)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 8);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_xchg_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I32), 1);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_xchg_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I32), 2);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_xchg_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 1);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_xchg_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 2);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_xchg_u)
+{
+    return validate_atomic_rmw(stack, instruction, ValueType(ValueType::I64), 4);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_cmpxchg)
+{
+    return validate_atomic_cmpxchg(stack, instruction, ValueType(ValueType::I32), 4);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_cmpxchg)
+{
+    return validate_atomic_cmpxchg(stack, instruction, ValueType(ValueType::I64), 8);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_cmpxchg_u)
+{
+    return validate_atomic_cmpxchg(stack, instruction, ValueType(ValueType::I32), 1);
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_cmpxchg_u)
+{
+    return validate_atomic_cmpxchg(stack, instruction, ValueType(ValueType::I32), 2);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_cmpxchg_u)
+{
+    return validate_atomic_cmpxchg(stack, instruction, ValueType(ValueType::I64), 1);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_cmpxchg_u)
+{
+    return validate_atomic_cmpxchg(stack, instruction, ValueType(ValueType::I64), 2);
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_cmpxchg_u)
+{
+    return validate_atomic_cmpxchg(stack, instruction, ValueType(ValueType::I64), 4);
+}
+
 VALIDATE_INSTRUCTION(synthetic_end_expression)
 {
     is_constant = true;
@@ -5123,7 +5616,7 @@ ErrorOr<Validator::ExpressionTypeResult, ValidationError> Validator::validate(Ex
     if (expression.compiled_instructions.direct && !is_constant_expression) {
         bool has_unsupported_types = false;
         for (auto& type : m_context.locals) {
-            if (type.is_reference() || type.kind() == ValueType::V128) {
+            if (type.is_reference()) {
                 has_unsupported_types = true;
                 break;
             }
@@ -5136,6 +5629,18 @@ ErrorOr<Validator::ExpressionTypeResult, ValidationError> Validator::validate(Ex
                 }
             }
         }
+        // v128 globals are accessed through the 64-bit global helpers, which would drop the high half.
+        if (!has_unsupported_types) {
+            for (auto& insn : expression.instructions()) {
+                if (insn.opcode() != Instructions::global_get && insn.opcode() != Instructions::global_set)
+                    continue;
+                auto global_idx = insn.arguments().get<GlobalIndex>().value();
+                if (global_idx < m_context.globals.size() && m_context.globals[global_idx].type().kind() == ValueType::V128) {
+                    has_unsupported_types = true;
+                    break;
+                }
+            }
+        }
         // Also skip 64-bit addressing (cranelift truncates base to u32).
         if (!has_unsupported_types) {
             for (auto& mem : m_context.memories) {
@@ -12,6 +12,7 @@
 #include <AK/SourceLocation.h>
 #include <AK/Tuple.h>
 #include <AK/Vector.h>
+#include <LibSync/Mutex.h>
 #include <LibWasm/Forward.h>
 #include <LibWasm/TypeSystem.h>
 #include <LibWasm/Types.h>
@@ -67,7 +68,7 @@ public:
     }
 
     // Module
-    ErrorOr<void, ValidationError> validate(Module&);
+    ErrorOr<void, ValidationError> validate(Module&, ValidationMode = ValidationMode::Eager);
     ErrorOr<void, ValidationError> validate(ImportSection const&);
     ErrorOr<void, ValidationError> validate(ExportSection const&);
     ErrorOr<void, ValidationError> validate(StartSection const&);
@@ -77,6 +78,9 @@ public:
     ErrorOr<void, ValidationError> validate(MemorySection const&);
     ErrorOr<void, ValidationError> validate(TableSection const&);
     ErrorOr<void, ValidationError> validate(CodeSection const&);
+    // Validates and compiles a single function body. callee_bodies holds the bodies that have been validated so far,
+    // by function index, and gets this one added.
+    ErrorOr<void, ValidationError> validate_function(CodeSection const&, size_t code_index, Span<CodeSection::Func const*> callee_bodies);
     ErrorOr<void, ValidationError> validate(TagSection const&);
     ErrorOr<void, ValidationError> validate(FunctionSection const&) { return {}; }
     ErrorOr<void, ValidationError> validate(DataCountSection const&) { return {}; }
@@ -355,6 +359,8 @@ public:
     }
 
 private:
+    friend class LazyFunctionValidation;
+
     explicit Validator(Context context)
         : m_context(move(context))
     {
@@ -365,6 +371,11 @@ private:
     ErrorOr<void, ValidationError> validate_array_get(Stack&, Instruction const&, bool requires_packed);
     ErrorOr<void, ValidationError> validate_ref_test_or_cast(Stack&, Instruction const&);
     ErrorOr<void, ValidationError> validate_br_on_cast(Stack&, Instruction const&, bool branch_on_failure);
+    ErrorOr<MemoryType, ValidationError> validate_atomic_memory_argument(Instruction::MemoryArgument const&, size_t access_size);
+    ErrorOr<void, ValidationError> validate_atomic_load(Stack&, Instruction const&, ValueType, size_t access_size);
+    ErrorOr<void, ValidationError> validate_atomic_store(Stack&, Instruction const&, ValueType, size_t access_size);
+    ErrorOr<void, ValidationError> validate_atomic_rmw(Stack&, Instruction const&, ValueType, size_t access_size);
+    ErrorOr<void, ValidationError> validate_atomic_cmpxchg(Stack&, Instruction const&, ValueType, size_t access_size);
 
     struct Errors {
         static ValidationError invalid(StringView name, SourceLocation location = SourceLocation::current())
@@ -461,6 +472,30 @@ private:
     COWVector<GlobalType> m_globals_without_internal_globals;
 };
 
+// The function bodies of a lazily validated module that haven't been validated yet, along with everything needed to
+// validate them later on. A body that fails validation makes the whole module invalid.
+class LazyFunctionValidation {
+    AK_MAKE_NONCOPYABLE(LazyFunctionValidation);
+    AK_MAKE_NONMOVABLE(LazyFunctionValidation);
+
+public:
+    LazyFunctionValidation(Context context, size_t function_count);
+
+    // Both may be called from any thread; validating a body that has been validated already does nothing.
+    ErrorOr<void, ValidationError> validate_function(Module const&, size_t code_index);
+    ErrorOr<void, ValidationError> validate_all_functions(Module const&);
+
+    Optional<ValidationError> error() const;
+
+private:
+    ErrorOr<void, ValidationError> validate_function_while_locked(Module const&, size_t code_index);
+
+    mutable Sync::Mutex m_mutex;
+    Validator m_validator;
+    Vector<CodeSection::Func const*> m_callee_bodies;
+    Optional<ValidationError> m_error;
+};
+
 }
 
 template<>
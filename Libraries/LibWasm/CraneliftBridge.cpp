@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AllOf.h>
 #include <AK/ByteString.h>
 #include <AK/Checked.h>
 #include <AK/LexicalPath.h>
@@ -99,11 +100,11 @@ struct BatchInput {
     u32 num_params;
 };
 
-// Disk-cache blob format. Stable: cached files name format_version + layout_hash so
-// any rebuild that changes those will simply miss the cache rather than try to
-// execute incompatible bytes.
+// Disk-cache blob format. Stable: cached files name format_version + layout_hash +
+// compiler_version so any rebuild that changes those will simply miss the cache
+// rather than try to execute incompatible bytes.
 constexpr u64 cache_blob_magic = 0x4354494A4D534157ULL; // "WASMJITC" little-endian
-constexpr u32 cache_blob_format_version = 9;
+constexpr u32 cache_blob_format_version = 10;
 
 struct CacheBlobHeader {
     u64 magic;
@@ -113,8 +114,9 @@ struct CacheBlobHeader {
     u8 wasm_hash[32];
     u32 function_count;
     u32 _pad;
+    u64 compiler_version;
 };
-static_assert(sizeof(CacheBlobHeader) == 64);
+static_assert(sizeof(CacheBlobHeader) == 72);
 
 struct CacheBlobFunctionEntry {
     u32 function_index;
@@ -185,7 +187,8 @@ static u64 compute_layout_hash(RuntimeHelpers const& h)
 static_assert(offsetof(RuntimeHelpers, call_function) == 0);
 static_assert(offsetof(RuntimeHelpers, memory_fill) == sizeof(size_t) * 30);
 static_assert(offsetof(RuntimeHelpers, primitive_storage_cage_base) == sizeof(size_t) * 31);
-static_assert(HELPER_COUNT == 32);
+static_assert(offsetof(RuntimeHelpers, catch_exception) == sizeof(size_t) * 35);
+static_assert(HELPER_COUNT == 36);
 
 static bool apply_helper_relocs(u8* code_bytes, size_t code_size, HelperReloc const* relocs, size_t reloc_count, RuntimeHelpers const& helpers)
 {
@@ -298,6 +301,11 @@ static ALWAYS_INLINE i32 wasm_cl_run_compiled(BytecodeInterpreter& interpreter,
         interpreter.set_trap("Compiled function returned unexpectedly"sv);
         return 1;
     }
+    if (config.has_pending_tail_call()) [[unlikely]] {
+        interpreter.make_pending_tail_calls(config);
+        if (config.label_stack().size() > config.frame().label_index())
+            config.label_stack().shrink(config.frame().label_index(), true);
+    }
     if (interpreter.did_trap())
         return 1;
     if (entry.arity == 1)
@@ -377,6 +385,9 @@ static ALWAYS_INLINE i32 wasm_cl_finish_call(BytecodeInterpreter& interpreter, C
             interpreter.set_trap("Compiled function returned unexpectedly"sv);
             return 1;
         }
+        // The function may have tiered up into native code that left a tail call.
+        if (config.has_pending_tail_call()) [[unlikely]]
+            interpreter.make_pending_tail_calls(config);
         if (interpreter.did_trap())
             return 1;
         if (config.frame().arity() == 1)
@@ -657,32 +668,49 @@ void wasm_cl_write_global(void* config_ptr, i32 index, i64 value)
     global->set_value(Value(value));
 }
 
-i32 wasm_cl_call_indirect(void* interp_ptr, void* config_ptr, i32 table_idx, i32 type_idx, i32 element_index);
-i32 wasm_cl_call_indirect(void* interp_ptr, void* config_ptr, i32 table_idx, i32 type_idx, i32 element_index)
+// Sets the trap and returns nothing if the element isn't a function of the expected type.
+static Optional<FunctionAddress> wasm_cl_resolve_indirect_callee(BytecodeInterpreter& interpreter, Configuration& config, i32 table_idx, i32 type_idx, i32 element_index)
 {
-    auto& interpreter = *static_cast<BytecodeInterpreter*>(interp_ptr);
-    auto& config = *static_cast<Configuration*>(config_ptr);
-
     auto const& module = config.frame().module();
     auto table_address = module.tables()[table_idx];
     auto* table_instance = config.store().get(table_address);
-    if (!table_instance || element_index < 0 || static_cast<size_t>(element_index) >= table_instance->elements().size())
-        return interpreter.set_trap(Trap::from_string("Table index out of bounds"));
+    if (!table_instance || element_index < 0 || static_cast<size_t>(element_index) >= table_instance->elements().size()) {
+        interpreter.set_trap(Trap::from_string("Table index out of bounds"));
+        return {};
+    }
 
     auto& element = table_instance->elements()[element_index];
-    if (!element.ref().has<Reference::Func>())
-        return interpreter.set_trap(Trap::from_string("Table element is not a function reference"));
+    if (!element.ref().has<Reference::Func>()) {
+        interpreter.set_trap(Trap::from_string("Table element is not a function reference"));
+        return {};
+    }
 
     auto address = element.ref().get<Reference::Func>().address;
     auto* function = config.store().get(address);
-    if (!function)
-        return interpreter.set_trap(Trap::from_string("Indirect call to freed function"));
+    if (!function) {
+        interpreter.set_trap(Trap::from_string("Indirect call to freed function"));
+        return {};
+    }
     // https://webassembly.github.io/spec/core/exec/instructions.html#xref-syntax-instructions-syntax-instr-control-mathsf-call-indirect-x-y
     // call_indirect's runtime check is a defined-type match (a downcast), not structural equality.
     auto const* type_actual = function->visit([](auto& f) { return f.defined_type(); });
     auto const* type_expected = module.canonical_types()[type_idx];
-    if (!type_actual || !matches_defined_type(*type_actual, *type_expected))
-        return interpreter.set_trap(Trap::from_string("Indirect call type mismatch"));
+    if (!type_actual || !matches_defined_type(*type_actual, *type_expected)) {
+        interpreter.set_trap(Trap::from_string("Indirect call type mismatch"));
+        return {};
+    }
+    return address;
+}
+
+i32 wasm_cl_call_indirect(void* interp_ptr, void* config_ptr, i32 table_idx, i32 type_idx, i32 element_index);
+i32 wasm_cl_call_indirect(void* interp_ptr, void* config_ptr, i32 table_idx, i32 type_idx, i32 element_index)
+{
+    auto& interpreter = *static_cast<BytecodeInterpreter*>(interp_ptr);
+    auto& config = *static_cast<Configuration*>(config_ptr);
+
+    auto address = wasm_cl_resolve_indirect_callee(interpreter, config, table_idx, type_idx, element_index);
+    if (!address.has_value())
+        return 1;
 
     SourcesAndDestination addrs {};
     addrs.sources[0] = Dispatch::RegisterOrStack::Stack;
@@ -690,7 +718,7 @@ i32 wasm_cl_call_indirect(void* interp_ptr, void* config_ptr, i32 table_idx, i32
     addrs.sources[2] = Dispatch::RegisterOrStack::Stack;
     addrs.destination = Dispatch::RegisterOrStack::Stack;
 
-    auto outcome = interpreter.call_address(config, address, addrs, BytecodeInterpreter::CallAddressSource::IndirectCall, BytecodeInterpreter::CallType::UsingStack);
+    auto outcome = interpreter.call_address(config, *address, addrs, BytecodeInterpreter::CallAddressSource::IndirectCall, BytecodeInterpreter::CallType::UsingStack);
 
     return outcome == Outcome::Return && interpreter.did_trap() ? 1 : 0;
 }
@@ -895,6 +923,109 @@ i32 wasm_cl_direct_call_3(void* interp_ptr, void* config_ptr, i32 func_index, i6
     return wasm_cl_direct_call_impl(interpreter, config, func_index, args, 3);
 }
 
+// Takes the callee's arguments off the value stack and leaves the tail call for whoever entered the compiled function,
+// which makes it once that function has returned (see BytecodeInterpreter::make_pending_tail_calls()).
+static i32 wasm_cl_leave_tail_call(BytecodeInterpreter& interpreter, Configuration& config, FunctionAddress address)
+{
+    auto* instance = config.store().get(address);
+    if (!instance) {
+        interpreter.set_trap("Attempt to call nonexistent function by address"sv);
+        return 1;
+    }
+
+    FunctionType const* type { nullptr };
+    instance->visit([&](auto const& function) { type = &function.type(); });
+    auto param_count = type->parameters().size();
+
+    Vector<Value, ArgumentsStaticSize> arguments;
+    config.get_arguments_allocation_if_possible(arguments, param_count);
+    arguments.ensure_capacity(param_count);
+    for (auto& value : config.value_stack().span().slice_from_end(param_count))
+        arguments.unchecked_append(value);
+    config.value_stack().remove(config.value_stack().size() - param_count, param_count);
+
+    config.set_pending_tail_call({ address, move(arguments) });
+    return 0;
+}
+
+i32 wasm_cl_tail_call(void* interp_ptr, void* config_ptr, i32 func_index);
+i32 wasm_cl_tail_call(void* interp_ptr, void* config_ptr, i32 func_index)
+{
+    auto& interpreter = *static_cast<BytecodeInterpreter*>(interp_ptr);
+    auto& config = *static_cast<Configuration*>(config_ptr);
+
+    auto const& functions = config.frame().module().functions();
+    if (static_cast<size_t>(func_index) >= functions.size())
+        return 1;
+    return wasm_cl_leave_tail_call(interpreter, config, functions[func_index]);
+}
+
+i32 wasm_cl_tail_call_indirect(void* interp_ptr, void* config_ptr, i32 table_idx, i32 type_idx, i32 element_index);
+i32 wasm_cl_tail_call_indirect(void* interp_ptr, void* config_ptr, i32 table_idx, i32 type_idx, i32 element_index)
+{
+    auto& interpreter = *static_cast<BytecodeInterpreter*>(interp_ptr);
+    auto& config = *static_cast<Configuration*>(config_ptr);
+
+    auto address = wasm_cl_resolve_indirect_callee(interpreter, config, table_idx, type_idx, element_index);
+    if (!address.has_value())
+        return 1;
+    return wasm_cl_leave_tail_call(interpreter, config, *address);
+}
+
+// https://webassembly.github.io/spec/core/exec/instructions.html#xref-syntax-instructions-syntax-instr-control-mathsf-throw-x
+// Always "traps" with the new exception, which the compiled code's landing pads (or its callers) pick up again.
+i32 wasm_cl_throw_exception(void* interp_ptr, void* config_ptr, i32 tag_index);
+i32 wasm_cl_throw_exception(void* interp_ptr, void* config_ptr, i32 tag_index)
+{
+    auto& interpreter = *static_cast<BytecodeInterpreter*>(interp_ptr);
+    auto& config = *static_cast<Configuration*>(config_ptr);
+
+    auto tag_address = config.frame().module().tags()[tag_index];
+    auto& tag_instance = *config.store().get(tag_address);
+    auto param_count = tag_instance.type().parameters().size();
+    auto values = Vector<Value>(config.value_stack().span().slice_from_end(param_count));
+    config.value_stack().shrink(config.value_stack().size() - param_count);
+    auto exception_address = config.store().allocate(tag_address, move(values));
+    if (!exception_address.has_value())
+        return interpreter.set_trap("Out of memory"sv);
+    return interpreter.set_trap(Trap { UncaughtException { *exception_address } });
+}
+
+// Looks for a catch clause of the try_table at the given dispatch index that matches the exception being thrown. If
+// one does, the exception's fields are pushed (the compiled code has already trimmed the stack to the try_table's
+// entry height) and its index is returned; otherwise the trap is left in place for the enclosing handler.
+i32 wasm_cl_catch_exception(void* interp_ptr, void* config_ptr, i32 try_table_ip);
+i32 wasm_cl_catch_exception(void* interp_ptr, void* config_ptr, i32 try_table_ip)
+{
+    auto& interpreter = *static_cast<BytecodeInterpreter*>(interp_ptr);
+    auto& config = *static_cast<Configuration*>(config_ptr);
+
+    if (!interpreter.did_trap())
+        return -1;
+    auto trap = interpreter.trap();
+    auto const* uncaught_exception = trap.data.get_pointer<UncaughtException>();
+    if (!uncaught_exception)
+        return -1;
+
+    auto& exception = *config.store().get(uncaught_exception->address);
+    auto const& frame = config.frame();
+    auto const* instruction = frame.expression().compiled_instructions.dispatches[try_table_ip].instruction;
+    auto const& catches = instruction->arguments().unsafe_get<Instruction::TryTableArgs>().catches();
+    for (size_t i = 0; i < catches.size(); ++i) {
+        auto const& catch_ = catches[i];
+        if (auto tag_index = catch_.matching_tag_index(); tag_index.has_value()) {
+            if (frame.module().tags()[tag_index->value()] != exception.tag())
+                continue;
+            config.value_stack().ensure_capacity(config.value_stack().size() + exception.params().size());
+            for (auto& field : exception.params())
+                config.value_stack().unchecked_append(field);
+        }
+        interpreter.clear_trap();
+        return static_cast<i32>(i);
+    }
+    return -1;
+}
+
 // Thin frame push for direct compiled-to-compiled calls. Returns 1 on trap, 0 on success.
 i32 wasm_cl_push_frame(void* interp_ptr, void* config_ptr, Value* locals_ptr, u32, void const* module_ptr, void const* expression_ptr, u32 arity, u32 max_call_rec_size);
 i32 wasm_cl_push_frame(void* interp_ptr, void* config_ptr, Value* locals_ptr, u32 /* total_locals */, void const* module_ptr, void const* expression_ptr, u32 arity, u32 max_call_rec_size)
@@ -968,6 +1099,10 @@ static RuntimeHelpers make_runtime_helpers()
         .memory_copy = bit_cast<uintptr_t>(&wasm_cl_memory_copy),
         .memory_fill = bit_cast<uintptr_t>(&wasm_cl_memory_fill),
         .primitive_storage_cage_base = bit_cast<uintptr_t>(&js_primitive_storage_cage_base),
+        .tail_call = bit_cast<uintptr_t>(&wasm_cl_tail_call),
+        .tail_call_indirect = bit_cast<uintptr_t>(&wasm_cl_tail_call_indirect),
+        .throw_exception = bit_cast<uintptr_t>(&wasm_cl_throw_exception),
+        .catch_exception = bit_cast<uintptr_t>(&wasm_cl_catch_exception),
         .regs_offset = static_cast<u32>(offsetof(Configuration, regs)),
         .value_size = static_cast<u32>(sizeof(Value)),
         .locals_base_offset = static_cast<u32>(Configuration::locals_base_offset()),
@@ -1046,12 +1181,31 @@ static CraneliftInsn serialize_insn(Dispatch const& dispatch, SourcesAndDestinat
             else
                 out.imm2 |= static_cast<i64>(encoded);
         }
-    } else if (opc == Instructions::call.value()) {
+    } else if (opc == Instructions::call.value() || opc == Instructions::return_call.value()) {
         out.imm1 = static_cast<i64>(args.get<FunctionIndex>().value());
-    } else if (opc == Instructions::call_indirect.value()) {
+    } else if (opc == Instructions::call_indirect.value() || opc == Instructions::return_call_indirect.value()) {
         auto const& indirect_args = args.get<Instruction::IndirectCallArgs>();
         out.imm1 = static_cast<i64>(indirect_args.type.value());
         out.imm2 = static_cast<i64>(indirect_args.table.value());
+    } else if (opc == Instructions::throw_.value()) {
+        out.imm1 = static_cast<i64>(args.get<TagIndex>().value());
+    } else if (opc == Instructions::try_table.value()) {
+        // imm1 = up to four catch labels (16 bits each), imm2 = catch count << 32 (the low half gets the dispatch
+        // index), imm3 = arity | param_count << 16. The _ref forms and anything that doesn't fit are marked by a
+        // catch count of 0xff.
+        auto const& try_args = args.get<Instruction::TryTableArgs>();
+        out.imm3 = static_cast<u32>(try_args.meta.arity) | (static_cast<u32>(try_args.meta.parameter_count) << 16);
+        auto const& catches = try_args.catches();
+        bool const fits = catches.size() <= 4 && all_of(catches, [](auto const& catch_) {
+            return !catch_.is_ref() && catch_.target_label().value() <= NumericLimits<u16>::max();
+        });
+        if (!fits) {
+            out.imm2 = static_cast<i64>(0xffull << 32);
+            return out;
+        }
+        out.imm2 = static_cast<i64>(static_cast<u64>(catches.size()) << 32);
+        for (size_t i = 0; i < catches.size(); ++i)
+            out.imm1 |= static_cast<i64>(static_cast<u64>(catches[i].target_label().value()) << (i * 16));
     } else if (opc == Instructions::memory_copy.value()) {
         auto const& copy_args = args.get<Instruction::MemoryCopyArgs>();
         out.imm1 = static_cast<i64>(copy_args.dst_index.value());
@@ -1067,6 +1221,37 @@ static CraneliftInsn serialize_insn(Dispatch const& dispatch, SourcesAndDestinat
         || opc == Instructions::memory_grow.value()) {
         auto const& mem_idx_arg = args.get<Instruction::MemoryIndexArgument>();
         out.imm1 = static_cast<i64>(mem_idx_arg.memory_index.value());
+    } else if (opc == Instructions::v128_const.value()) {
+        auto value = args.get<u128>();
+        out.imm1 = static_cast<i64>(static_cast<u64>(value));
+        out.imm2 = static_cast<i64>(static_cast<u64>(value >> 64));
+    } else if ((opc >= Instructions::v128_load.value() && opc <= Instructions::v128_store.value())
+        || opc == Instructions::v128_load32_zero.value()
+        || opc == Instructions::v128_load64_zero.value()) {
+        auto const& mem_arg = args.get<Instruction::MemoryArgument>();
+        out.imm1 = static_cast<i64>(mem_arg.offset);
+        out.imm3 = static_cast<u32>(mem_arg.memory_index.value());
+    } else if (opc >= Instructions::v128_load8_lane.value() && opc <= Instructions::v128_store64_lane.value()) {
+        auto const& lane_arg = args.get<Instruction::MemoryAndLaneArgument>();
+        out.imm1 = static_cast<i64>(lane_arg.memory.offset);
+        out.imm2 = static_cast<i64>(lane_arg.lane);
+        out.imm3 = static_cast<u32>(lane_arg.memory.memory_index.value());
+    } else if (opc == Instructions::i8x16_shuffle.value()) {
+        // Lanes 0-7 in imm1 and 8-15 in imm2, one byte each, lowest lane first.
+        auto const& shuffle_args = args.get<Instruction::ShuffleArgument>();
+        for (size_t i = 0; i < 16; ++i) {
+            auto const encoded = static_cast<u64>(shuffle_args.lanes[i]) << ((i % 8) * 8);
+            if (i < 8)
+                out.imm1 |= static_cast<i64>(encoded);
+            else
+                out.imm2 |= static_cast<i64>(encoded);
+        }
+    } else if (opc >= Instructions::i8x16_extract_lane_s.value() && opc <= Instructions::f64x2_replace_lane.value()) {
+        out.imm1 = static_cast<i64>(args.get<Instruction::LaneIndex>().lane);
+    } else if (opc >= Instructions::memory_atomic_notify.value() && opc <= Instructions::i64_atomic_rmw32_cmpxchg_u.value() && opc != Instructions::atomic_fence.value()) {
+        auto const& mem_arg = args.get<Instruction::MemoryArgument>();
+        out.imm1 = static_cast<i64>(mem_arg.offset);
+        out.imm3 = static_cast<u32>(mem_arg.memory_index.value());
     }
 
     auto is_syn = [opc](OpCode op) { return opc == op.value(); };
@@ -1077,7 +1262,8 @@ static CraneliftInsn serialize_insn(Dispatch const& dispatch, SourcesAndDestinat
             out.imm1 = static_cast<i64>(args.get<FunctionIndex>().value());
         } else if (is_syn(Instructions::synthetic_call_with_record_0) || is_syn(Instructions::synthetic_call_with_record_1)) {
             out.imm1 = static_cast<i64>(args.get<FunctionIndex>().value());
-        } else if (is_syn(Instructions::synthetic_br_nostack) || is_syn(Instructions::synthetic_br_if_nostack)) {
+        } else if (is_syn(Instructions::synthetic_br_nostack) || is_syn(Instructions::synthetic_br_if_nostack)
+            || syn_between(Instructions::synthetic_i32_eqz_br_if, Instructions::synthetic_i32_geu_br_if)) {
             auto const& br_args = args.get<Instruction::BranchArgs>();
             out.imm1 = static_cast<i64>(br_args.label.value());
         } else if (is_syn(Instructions::synthetic_local_copy)) {
@@ -1475,6 +1661,14 @@ bool try_cranelift_compile(CompiledInstructions& compiled, u32 result_arity)
         if (dispatches[i].instruction->opcode().value() == Instructions::synthetic_tier_up.value())
             flat.last().imm1 = static_cast<i64>(i);
 
+        // A landing pad hands its try_table's dispatch index to the catch helper, which finds the catch clauses there.
+        if (dispatches[i].instruction->opcode().value() == Instructions::try_table.value())
+            flat.last().imm2 |= static_cast<i64>(i);
+
+        // Self tail calls are compiled as a jump back to the start of the function.
+        if (dispatches[i].instruction->opcode().value() == Instructions::return_call.value() && flat.last().imm1 == static_cast<i64>(s_active_function_index))
+            flat.last().imm2 = 1;
+
         if (dispatches[i].instruction->opcode().value() == Instructions::br_table.value()) {
             auto const& table_args = dispatches[i].instruction->arguments().get<Instruction::TableBranchArgs>();
             auto const total = table_args.labels.size();
@@ -1549,6 +1743,11 @@ void abort_cranelift_cache_install()
     cranelift_cache_state().pending_install.records.clear();
 }
 
+u64 cranelift_compiler_version()
+{
+    return Cranelift::COMPILER_VERSION;
+}
+
 Optional<ByteBuffer> serialize_cranelift_cache_blob(ReadonlyBytes wasm_hash)
 {
     ScopeGuard reset = [] {
@@ -1586,6 +1785,7 @@ Optional<ByteBuffer> serialize_cranelift_cache_blob(ReadonlyBytes wasm_hash)
     header->layout_hash = compute_layout_hash(helpers);
     __builtin_memcpy(header->wasm_hash, wasm_hash.data(), 32);
     header->function_count = static_cast<u32>(capture.records.size());
+    header->compiler_version = cranelift_compiler_version();
 
     size_t offset = sizeof(CacheBlobHeader);
     for (auto const& r : capture.records) {
@@ -1627,6 +1827,8 @@ bool try_install_cranelift_cache_blob(ReadonlyBytes expected_wasm_hash, Readonly
         return false;
     if (header->helper_count != HELPER_COUNT)
         return false;
+    if (header->compiler_version != cranelift_compiler_version())
+        return false;
     if (__builtin_memcmp(header->wasm_hash, expected_wasm_hash.data(), 32) != 0)
         return false;
 
@@ -16,6 +16,7 @@ void set_cranelift_active_function_index(u32) { }
 void begin_cranelift_cache_capture() { }
 void abort_cranelift_cache_capture() { }
 void abort_cranelift_cache_install() { }
+u64 cranelift_compiler_version() { return 0; }
 Optional<ByteBuffer> serialize_cranelift_cache_blob(ReadonlyBytes) { return {}; }
 bool try_install_cranelift_cache_blob(ReadonlyBytes, ReadonlyBytes) { return false; }
 
@@ -10,6 +10,7 @@ namespace Wasm {
 
 class AbstractMachine;
 class Validator;
+class LazyFunctionValidation;
 struct ValidationError;
 struct Interpreter;
 class MemoryBuffer;
@@ -518,73 +518,152 @@ namespace Instructions {
     M(ref_i31, 0xfb00001cu, 1, 1)                             \
     M(i31_get_s, 0xfb00001du, 1, 1)                           \
     M(i31_get_u, 0xfb00001eu, 1, 1)                           \
+    M(memory_atomic_notify, 0xfe000000u, 2, 1)                \
+    M(memory_atomic_wait32, 0xfe000001u, 3, 1)                \
+    M(memory_atomic_wait64, 0xfe000002u, 3, 1)                \
+    M(atomic_fence, 0xfe000003u, 0, 0)                        \
+    M(i32_atomic_load, 0xfe000010u, 1, 1)                     \
+    M(i64_atomic_load, 0xfe000011u, 1, 1)                     \
+    M(i32_atomic_load8_u, 0xfe000012u, 1, 1)                  \
+    M(i32_atomic_load16_u, 0xfe000013u, 1, 1)                 \
+    M(i64_atomic_load8_u, 0xfe000014u, 1, 1)                  \
+    M(i64_atomic_load16_u, 0xfe000015u, 1, 1)                 \
+    M(i64_atomic_load32_u, 0xfe000016u, 1, 1)                 \
+    M(i32_atomic_store, 0xfe000017u, 2, 0)                    \
+    M(i64_atomic_store, 0xfe000018u, 2, 0)                    \
+    M(i32_atomic_store8, 0xfe000019u, 2, 0)                   \
+    M(i32_atomic_store16, 0xfe00001au, 2, 0)                  \
+    M(i64_atomic_store8, 0xfe00001bu, 2, 0)                   \
+    M(i64_atomic_store16, 0xfe00001cu, 2, 0)                  \
+    M(i64_atomic_store32, 0xfe00001du, 2, 0)                  \
+    M(i32_atomic_rmw_add, 0xfe00001eu, 2, 1)                  \
+    M(i64_atomic_rmw_add, 0xfe00001fu, 2, 1)                  \
+    M(i32_atomic_rmw8_add_u, 0xfe000020u, 2, 1)               \
+    M(i32_atomic_rmw16_add_u, 0xfe000021u, 2, 1)              \
+    M(i64_atomic_rmw8_add_u, 0xfe000022u, 2, 1)               \
+    M(i64_atomic_rmw16_add_u, 0xfe000023u, 2, 1)              \
+    M(i64_atomic_rmw32_add_u, 0xfe000024u, 2, 1)              \
+    M(i32_atomic_rmw_sub, 0xfe000025u, 2, 1)                  \
+    M(i64_atomic_rmw_sub, 0xfe000026u, 2, 1)                  \
+    M(i32_atomic_rmw8_sub_u, 0xfe000027u, 2, 1)               \
+    M(i32_atomic_rmw16_sub_u, 0xfe000028u, 2, 1)              \
+    M(i64_atomic_rmw8_sub_u, 0xfe000029u, 2, 1)               \
+    M(i64_atomic_rmw16_sub_u, 0xfe00002au, 2, 1)              \
+    M(i64_atomic_rmw32_sub_u, 0xfe00002bu, 2, 1)              \
+    M(i32_atomic_rmw_and, 0xfe00002cu, 2, 1)                  \
+    M(i64_atomic_rmw_and, 0xfe00002du, 2, 1)                  \
+    M(i32_atomic_rmw8_and_u, 0xfe00002eu, 2, 1)               \
+    M(i32_atomic_rmw16_and_u, 0xfe00002fu, 2, 1)              \
+    M(i64_atomic_rmw8_and_u, 0xfe000030u, 2, 1)               \
+    M(i64_atomic_rmw16_and_u, 0xfe000031u, 2, 1)              \
+    M(i64_atomic_rmw32_and_u, 0xfe000032u, 2, 1)              \
+    M(i32_atomic_rmw_or, 0xfe000033u, 2, 1)                   \
+    M(i64_atomic_rmw_or, 0xfe000034u, 2, 1)                   \
+    M(i32_atomic_rmw8_or_u, 0xfe000035u, 2, 1)                \
+    M(i32_atomic_rmw16_or_u, 0xfe000036u, 2, 1)               \
+    M(i64_atomic_rmw8_or_u, 0xfe000037u, 2, 1)                \
+    M(i64_atomic_rmw16_or_u, 0xfe000038u, 2, 1)               \
+    M(i64_atomic_rmw32_or_u, 0xfe000039u, 2, 1)               \
+    M(i32_atomic_rmw_xor, 0xfe00003au, 2, 1)                  \
+    M(i64_atomic_rmw_xor, 0xfe00003bu, 2, 1)                  \
+    M(i32_atomic_rmw8_xor_u, 0xfe00003cu, 2, 1)               \
+    M(i32_atomic_rmw16_xor_u, 0xfe00003du, 2, 1)              \
+    M(i64_atomic_rmw8_xor_u, 0xfe00003eu, 2, 1)               \
+    M(i64_atomic_rmw16_xor_u, 0xfe00003fu, 2, 1)              \
+    M(i64_atomic_rmw32_xor_u, 0xfe000040u, 2, 1)              \
+    M(i32_atomic_rmw_xchg, 0xfe000041u, 2, 1)                 \
+    M(i64_atomic_rmw_xchg, 0xfe000042u, 2, 1)                 \
+    M(i32_atomic_rmw8_xchg_u, 0xfe000043u, 2, 1)              \
+    M(i32_atomic_rmw16_xchg_u, 0xfe000044u, 2, 1)             \
+    M(i64_atomic_rmw8_xchg_u, 0xfe000045u, 2, 1)              \
+    M(i64_atomic_rmw16_xchg_u, 0xfe000046u, 2, 1)             \
+    M(i64_atomic_rmw32_xchg_u, 0xfe000047u, 2, 1)             \
+    M(i32_atomic_rmw_cmpxchg, 0xfe000048u, 3, 1)              \
+    M(i64_atomic_rmw_cmpxchg, 0xfe000049u, 3, 1)              \
+    M(i32_atomic_rmw8_cmpxchg_u, 0xfe00004au, 3, 1)           \
+    M(i32_atomic_rmw16_cmpxchg_u, 0xfe00004bu, 3, 1)          \
+    M(i64_atomic_rmw8_cmpxchg_u, 0xfe00004cu, 3, 1)           \
+    M(i64_atomic_rmw16_cmpxchg_u, 0xfe00004du, 3, 1)          \
+    M(i64_atomic_rmw32_cmpxchg_u, 0xfe00004eu, 3, 1)          \
     /* Synthetic fused insns */                               \
     ENUMERATE_SYNTHETIC_INSTRUCTION_OPCODES(M)
 
 #define ENUMERATE_SYNTHETIC_INSTRUCTION_OPCODES(M)     \
-    M(synthetic_i32_add2local, 0xfe000000u, 0, 1)      \
-    M(synthetic_i32_addconstlocal, 0xfe000001u, 0, 1)  \
-    M(synthetic_i32_andconstlocal, 0xfe000002u, 0, 1)  \
-    M(synthetic_i32_storelocal, 0xfe000003u, 1, 0)     \
-    M(synthetic_local_seti32_const, 0xfe000005u, 0, 0) \
-    M(synthetic_call_00, 0xfe000006u, 0, 0)            \
-    M(synthetic_call_01, 0xfe000007u, 0, 1)            \
-    M(synthetic_call_10, 0xfe000008u, 1, 0)            \
-    M(synthetic_call_11, 0xfe000009u, 1, 1)            \
-    M(synthetic_call_20, 0xfe00000au, 2, 0)            \
-    M(synthetic_call_21, 0xfe00000bu, 2, 1)            \
-    M(synthetic_call_30, 0xfe00000cu, 3, 0)            \
-    M(synthetic_call_31, 0xfe00000du, 3, 1)            \
-    M(synthetic_end_expression, 0xfe00000eu, 0, 0)     \
-    M(synthetic_argument_get, 0xfe00000fu, 0, 1)       \
-    M(synthetic_argument_set, 0xfe000010u, 1, 0)       \
-    M(synthetic_argument_tee, 0xfe000011u, 1, 1)       \
-    M(synthetic_call_with_record_0, 0xfe000012u, 0, 0) \
-    M(synthetic_call_with_record_1, 0xfe000013u, 0, 1) \
-    M(synthetic_local_get_0, 0xfe000014u, 0, 1)        \
-    M(synthetic_local_get_1, 0xfe000015u, 0, 1)        \
-    M(synthetic_local_get_2, 0xfe000016u, 0, 1)        \
-    M(synthetic_local_get_3, 0xfe000017u, 0, 1)        \
-    M(synthetic_local_get_4, 0xfe000018u, 0, 1)        \
-    M(synthetic_local_get_5, 0xfe000019u, 0, 1)        \
-    M(synthetic_local_get_6, 0xfe00001au, 0, 1)        \
-    M(synthetic_local_get_7, 0xfe00001bu, 0, 1)        \
-    M(synthetic_br_nostack, 0xfe00001cu, 0, -1)        \
-    M(synthetic_br_if_nostack, 0xfe00001du, 1, -1)     \
-    M(synthetic_local_set_0, 0xfe00001eu, 1, 0)        \
-    M(synthetic_local_set_1, 0xfe00001fu, 1, 0)        \
-    M(synthetic_local_set_2, 0xfe000020u, 1, 0)        \
-    M(synthetic_local_set_3, 0xfe000021u, 1, 0)        \
-    M(synthetic_local_set_4, 0xfe000022u, 1, 0)        \
-    M(synthetic_local_set_5, 0xfe000023u, 1, 0)        \
-    M(synthetic_local_set_6, 0xfe000024u, 1, 0)        \
-    M(synthetic_local_set_7, 0xfe000025u, 1, 0)        \
-    M(synthetic_local_copy, 0xfe000026u, 0, 0)         \
-    M(synthetic_i32_sub2local, 0xfe000027u, 0, 1)      \
-    M(synthetic_i32_mul2local, 0xfe000028u, 0, 1)      \
-    M(synthetic_i32_and2local, 0xfe000029u, 0, 1)      \
-    M(synthetic_i32_or2local, 0xfe00002au, 0, 1)       \
-    M(synthetic_i32_xor2local, 0xfe00002bu, 0, 1)      \
-    M(synthetic_i32_shl2local, 0xfe00002cu, 0, 1)      \
-    M(synthetic_i32_shru2local, 0xfe00002du, 0, 1)     \
-    M(synthetic_i32_shrs2local, 0xfe00002eu, 0, 1)     \
-    M(synthetic_i64_add2local, 0xfe00002fu, 0, 1)      \
-    M(synthetic_i64_addconstlocal, 0xfe000030u, 0, 1)  \
-    M(synthetic_i64_andconstlocal, 0xfe000031u, 0, 1)  \
-    M(synthetic_i64_storelocal, 0xfe000032u, 1, 0)     \
-    M(synthetic_i64_sub2local, 0xfe000033u, 0, 1)      \
-    M(synthetic_i64_mul2local, 0xfe000034u, 0, 1)      \
-    M(synthetic_i64_and2local, 0xfe000035u, 0, 1)      \
-    M(synthetic_i64_or2local, 0xfe000036u, 0, 1)       \
-    M(synthetic_i64_xor2local, 0xfe000037u, 0, 1)      \
-    M(synthetic_i64_shl2local, 0xfe000038u, 0, 1)      \
-    M(synthetic_i64_shru2local, 0xfe000039u, 0, 1)     \
-    M(synthetic_i64_shrs2local, 0xfe00003au, 0, 1)     \
-    M(synthetic_local_seti64_const, 0xfe00003bu, 0, 0) \
+    M(synthetic_i32_add2local, 0xff000000u, 0, 1)      \
+    M(synthetic_i32_addconstlocal, 0xff000001u, 0, 1)  \
+    M(synthetic_i32_andconstlocal, 0xff000002u, 0, 1)  \
+    M(synthetic_i32_storelocal, 0xff000003u, 1, 0)     \
+    M(synthetic_local_seti32_const, 0xff000005u, 0, 0) \
+    M(synthetic_call_00, 0xff000006u, 0, 0)            \
+    M(synthetic_call_01, 0xff000007u, 0, 1)            \
+    M(synthetic_call_10, 0xff000008u, 1, 0)            \
+    M(synthetic_call_11, 0xff000009u, 1, 1)            \
+    M(synthetic_call_20, 0xff00000au, 2, 0)            \
+    M(synthetic_call_21, 0xff00000bu, 2, 1)            \
+    M(synthetic_call_30, 0xff00000cu, 3, 0)            \
+    M(synthetic_call_31, 0xff00000du, 3, 1)            \
+    M(synthetic_end_expression, 0xff00000eu, 0, 0)     \
+    M(synthetic_argument_get, 0xff00000fu, 0, 1)       \
+    M(synthetic_argument_set, 0xff000010u, 1, 0)       \
+    M(synthetic_argument_tee, 0xff000011u, 1, 1)       \
+    M(synthetic_call_with_record_0, 0xff000012u, 0, 0) \
+    M(synthetic_call_with_record_1, 0xff000013u, 0, 1) \
+    M(synthetic_local_get_0, 0xff000014u, 0, 1)        \
+    M(synthetic_local_get_1, 0xff000015u, 0, 1)        \
+    M(synthetic_local_get_2, 0xff000016u, 0, 1)        \
+    M(synthetic_local_get_3, 0xff000017u, 0, 1)        \
+    M(synthetic_local_get_4, 0xff000018u, 0, 1)        \
+    M(synthetic_local_get_5, 0xff000019u, 0, 1)        \
+    M(synthetic_local_get_6, 0xff00001au, 0, 1)        \
+    M(synthetic_local_get_7, 0xff00001bu, 0, 1)        \
+    M(synthetic_br_nostack, 0xff00001cu, 0, -1)        \
+    M(synthetic_br_if_nostack, 0xff00001du, 1, -1)     \
+    M(synthetic_local_set_0, 0xff00001eu, 1, 0)        \
+    M(synthetic_local_set_1, 0xff00001fu, 1, 0)        \
+    M(synthetic_local_set_2, 0xff000020u, 1, 0)        \
+    M(synthetic_local_set_3, 0xff000021u, 1, 0)        \
+    M(synthetic_local_set_4, 0xff000022u, 1, 0)        \
+    M(synthetic_local_set_5, 0xff000023u, 1, 0)        \
+    M(synthetic_local_set_6, 0xff000024u, 1, 0)        \
+    M(synthetic_local_set_7, 0xff000025u, 1, 0)        \
+    M(synthetic_local_copy, 0xff000026u, 0, 0)         \
+    M(synthetic_i32_sub2local, 0xff000027u, 0, 1)      \
+    M(synthetic_i32_mul2local, 0xff000028u, 0, 1)      \
+    M(synthetic_i32_and2local, 0xff000029u, 0, 1)      \
+    M(synthetic_i32_or2local, 0xff00002au, 0, 1)       \
+    M(synthetic_i32_xor2local, 0xff00002bu, 0, 1)      \
+    M(synthetic_i32_shl2local, 0xff00002cu, 0, 1)      \
+    M(synthetic_i32_shru2local, 0xff00002du, 0, 1)     \
+    M(synthetic_i32_shrs2local, 0xff00002eu, 0, 1)     \
+    M(synthetic_i64_add2local, 0xff00002fu, 0, 1)      \
+    M(synthetic_i64_addconstlocal, 0xff000030u, 0, 1)  \
+    M(synthetic_i64_andconstlocal, 0xff000031u, 0, 1)  \
+    M(synthetic_i64_storelocal, 0xff000032u, 1, 0)     \
+    M(synthetic_i64_sub2local, 0xff000033u, 0, 1)      \
+    M(synthetic_i64_mul2local, 0xff000034u, 0, 1)      \
+    M(synthetic_i64_and2local, 0xff000035u, 0, 1)      \
+    M(synthetic_i64_or2local, 0xff000036u, 0, 1)       \
+    M(synthetic_i64_xor2local, 0xff000037u, 0, 1)      \
+    M(synthetic_i64_shl2local, 0xff000038u, 0, 1)      \
+    M(synthetic_i64_shru2local, 0xff000039u, 0, 1)     \
+    M(synthetic_i64_shrs2local, 0xff00003au, 0, 1)     \
+    M(synthetic_local_seti64_const, 0xff00003bu, 0, 0) \
     /* Continuation data for br_table with >8 labels.  \
      * Only consumed by the Cranelift compiler; */     \
-    M(synthetic_br_table_cont, 0xfe00003cu, 0, 0)      \
-    M(synthetic_tier_up, 0xfe00003du, 0, 0)
+    M(synthetic_br_table_cont, 0xff00003cu, 0, 0)      \
+    M(synthetic_tier_up, 0xff00003du, 0, 0)            \
+    /* Fused `i32 compare; br_if` */                   \
+    M(synthetic_i32_eqz_br_if, 0xff00003eu, 1, -1)     \
+    M(synthetic_i32_eq_br_if, 0xff00003fu, 2, -1)      \
+    M(synthetic_i32_ne_br_if, 0xff000040u, 2, -1)      \
+    M(synthetic_i32_lts_br_if, 0xff000041u, 2, -1)     \
+    M(synthetic_i32_ltu_br_if, 0xff000042u, 2, -1)     \
+    M(synthetic_i32_gts_br_if, 0xff000043u, 2, -1)     \
+    M(synthetic_i32_gtu_br_if, 0xff000044u, 2, -1)     \
+    M(synthetic_i32_les_br_if, 0xff000045u, 2, -1)     \
+    M(synthetic_i32_leu_br_if, 0xff000046u, 2, -1)     \
+    M(synthetic_i32_ges_br_if, 0xff000047u, 2, -1)     \
+    M(synthetic_i32_geu_br_if, 0xff000048u, 2, -1)
 
 #define ENUMERATE_WASM_OPCODES(M)         \
     ENUMERATE_SINGLE_BYTE_WASM_OPCODES(M) \
@@ -594,7 +673,7 @@ namespace Instructions {
 ENUMERATE_WASM_OPCODES(M)
 #undef M
 
-static constexpr inline OpCode SyntheticInstructionBase = 0xfe000000u;
+static constexpr inline OpCode SyntheticInstructionBase = 0xff000000u;
 static constexpr inline size_t SyntheticInstructionCount = 61;
 
 }
@@ -290,10 +290,12 @@ ParseResult<Limits> Limits::parse(ConstrainedStream& stream)
     auto flag = TRY_READ(stream, u8, ParseError::ExpectedKindTag);
 
     // Proposal 'memory64': flags 0/1 refer to 32-bit limits, flags 4/5 refer to 64-bit limits.
-    if (flag & ~0b00000101)
+    // Proposal 'threads': flag 2 marks the limits of a shared memory.
+    if (flag & ~0b00000111)
         return with_eof_check(stream, ParseError::InvalidTag);
 
     auto address_type = (flag & 0b00000100) ? AddressType::I64 : AddressType::I32;
+    auto shared = (flag & 0b00000010) ? Limits::Shared::Yes : Limits::Shared::No;
 
     auto min_or_error = stream.read_value<LEB128<u64>>();
     if (min_or_error.is_error())
@@ -308,7 +310,7 @@ ParseResult<Limits> Limits::parse(ConstrainedStream& stream)
         max = value_or_error.release_value();
     }
 
-    return Limits { address_type, min, move(max) };
+    return Limits { address_type, min, move(max), shared };
 }
 
 ParseResult<MemoryType> MemoryType::parse(ConstrainedStream& stream)
@@ -325,6 +327,8 @@ ParseResult<TableType> TableType::parse(ConstrainedStream& stream)
     if (!type_result.is_reference())
         return ParseError::InvalidType;
     auto limits_result = TRY(Limits::parse(stream));
+    if (limits_result.is_shared())
+        return ParseError::InvalidTag;
     return TableType { type_result, limits_result };
 }
 
@@ -739,7 +743,8 @@ ParseResult<Instruction> Instruction::parse(ConstrainedStream& stream)
         return Instruction { opcode };
     case 0xfb:
     case 0xfc:
-    case 0xfd: {
+    case 0xfd:
+    case 0xfe: {
         // These are multibyte instructions.
         auto selector = TRY_READ(stream, LEB128<u32>, ParseError::InvalidInput);
         if (selector > 0xffffff)
@@ -1226,6 +1231,95 @@ ParseResult<Instruction> Instruction::parse(ConstrainedStream& stream)
         case Instructions::i32x4_relaxed_dot_i8x16_i7x16_add_s.value():
             // op
             return Instruction { full_opcode };
+        // https://webassembly.github.io/threads/core/binary/instructions.html#atomic-memory-instructions
+        case Instructions::atomic_fence.value(): {
+            // op 0x00
+            auto reserved = TRY_READ(stream, u8, ParseError::InvalidImmediate);
+            if (reserved != 0)
+                return ParseError::InvalidImmediate;
+            return Instruction { full_opcode };
+        }
+        case Instructions::memory_atomic_notify.value():
+        case Instructions::memory_atomic_wait32.value():
+        case Instructions::memory_atomic_wait64.value():
+        case Instructions::i32_atomic_load.value():
+        case Instructions::i64_atomic_load.value():
+        case Instructions::i32_atomic_load8_u.value():
+        case Instructions::i32_atomic_load16_u.value():
+        case Instructions::i64_atomic_load8_u.value():
+        case Instructions::i64_atomic_load16_u.value():
+        case Instructions::i64_atomic_load32_u.value():
+        case Instructions::i32_atomic_store.value():
+        case Instructions::i64_atomic_store.value():
+        case Instructions::i32_atomic_store8.value():
+        case Instructions::i32_atomic_store16.value():
+        case Instructions::i64_atomic_store8.value():
+        case Instructions::i64_atomic_store16.value():
+        case Instructions::i64_atomic_store32.value():
+        case Instructions::i32_atomic_rmw_add.value():
+        case Instructions::i64_atomic_rmw_add.value():
+        case Instructions::i32_atomic_rmw8_add_u.value():
+        case Instructions::i32_atomic_rmw16_add_u.value():
+        case Instructions::i64_atomic_rmw8_add_u.value():
+        case Instructions::i64_atomic_rmw16_add_u.value():
+        case Instructions::i64_atomic_rmw32_add_u.value():
+        case Instructions::i32_atomic_rmw_sub.value():
+        case Instructions::i64_atomic_rmw_sub.value():
+        case Instructions::i32_atomic_rmw8_sub_u.value():
+        case Instructions::i32_atomic_rmw16_sub_u.value():
+        case Instructions::i64_atomic_rmw8_sub_u.value():
+        case Instructions::i64_atomic_rmw16_sub_u.value():
+        case Instructions::i64_atomic_rmw32_sub_u.value():
+        case Instructions::i32_atomic_rmw_and.value():
+        case Instructions::i64_atomic_rmw_and.value():
+        case Instructions::i32_atomic_rmw8_and_u.value():
+        case Instructions::i32_atomic_rmw16_and_u.value():
+        case Instructions::i64_atomic_rmw8_and_u.value():
+        case Instructions::i64_atomic_rmw16_and_u.value():
+        case Instructions::i64_atomic_rmw32_and_u.value():
+        case Instructions::i32_atomic_rmw_or.value():
+        case Instructions::i64_atomic_rmw_or.value():
+        case Instructions::i32_atomic_rmw8_or_u.value():
+        case Instructions::i32_atomic_rmw16_or_u.value():
+        case Instructions::i64_atomic_rmw8_or_u.value():
+        case Instructions::i64_atomic_rmw16_or_u.value():
+        case Instructions::i64_atomic_rmw32_or_u.value():
+        case Instructions::i32_atomic_rmw_xor.value():
+        case Instructions::i64_atomic_rmw_xor.value():
+        case Instructions::i32_atomic_rmw8_xor_u.value():
+        case Instructions::i32_atomic_rmw16_xor_u.value():
+        case Instructions::i64_atomic_rmw8_xor_u.value():
+        case Instructions::i64_atomic_rmw16_xor_u.value():
+        case Instructions::i64_atomic_rmw32_xor_u.value():
+        case Instructions::i32_atomic_rmw_xchg.value():
+        case Instructions::i64_atomic_rmw_xchg.value():
+        case Instructions::i32_atomic_rmw8_xchg_u.value():
+        case Instructions::i32_atomic_rmw16_xchg_u.value():
+        case Instructions::i64_atomic_rmw8_xchg_u.value():
+        case Instructions::i64_atomic_rmw16_xchg_u.value():
+        case Instructions::i64_atomic_rmw32_xchg_u.value():
+        case Instructions::i32_atomic_rmw_cmpxchg.value():
+        case Instructions::i64_atomic_rmw_cmpxchg.value():
+        case Instructions::i32_atomic_rmw8_cmpxchg_u.value():
+        case Instructions::i32_atomic_rmw16_cmpxchg_u.value():
+        case Instructions::i64_atomic_rmw8_cmpxchg_u.value():
+        case Instructions::i64_atomic_rmw16_cmpxchg_u.value():
+        case Instructions::i64_atomic_rmw32_cmpxchg_u.value(): {
+            // op (align [multi-memory: memindex] offset)
+            u32 align = TRY_READ(stream, LEB128<u32>, ParseError::ExpectedIndex);
+
+            // Proposal "multi-memory", if bit 6 of alignment is set, then a memory index follows the alignment.
+            auto memory_index = 0;
+            if ((align & 0x40) != 0) {
+                align &= ~0x40;
+                memory_index = TRY_READ(stream, LEB128<u32>, ParseError::InvalidInput);
+            }
+
+            // Proposal 'memory64': memarg offsets are u64 instead of u32.
+            auto offset = TRY_READ(stream, LEB128<u64>, ParseError::ExpectedIndex);
+
+            return Instruction { full_opcode, MemoryArgument { align, offset, MemoryIndex(memory_index) } };
+        }
         default:
             return ParseError::UnknownInstruction;
         }
@@ -1752,6 +1846,80 @@ ParseResult<SectionId> SectionId::parse(Stream& stream)
     }
 }
 
+static ParseResult<void> begin_section(SectionId section_id, u32& seen_section_kinds)
+{
+    if (section_id.kind() != SectionId::SectionIdKind::Custom) {
+        auto kind_bit = 1u << to_underlying(section_id.kind());
+        if (seen_section_kinds & kind_bit)
+            return ParseError::DuplicateSection;
+        seen_section_kinds |= kind_bit;
+    }
+    return {};
+}
+
+static ParseResult<void> parse_section_contents(Module& module, SectionId section_id, ConstrainedStream& section_stream)
+{
+    switch (section_id.kind()) {
+    case SectionId::SectionIdKind::Custom:
+        module.custom_sections().append(TRY(CustomSection::parse(section_stream)));
+        break;
+    case SectionId::SectionIdKind::Type:
+        module.type_section() = TRY(TypeSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Import:
+        module.import_section() = TRY(ImportSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Function:
+        module.function_section() = TRY(FunctionSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Table:
+        module.table_section() = TRY(TableSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Memory:
+        module.memory_section() = TRY(MemorySection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Global:
+        module.global_section() = TRY(GlobalSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Export:
+        module.export_section() = TRY(ExportSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Start:
+        module.start_section() = TRY(StartSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Element:
+        module.element_section() = TRY(ElementSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Code:
+        module.code_section() = TRY(CodeSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Data:
+        module.data_section() = TRY(DataSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::DataCount:
+        module.data_count_section() = TRY(DataCountSection::parse(section_stream));
+        break;
+    case SectionId::SectionIdKind::Tag:
+        module.tag_section() = TRY(TagSection::parse(section_stream));
+        break;
+    default:
+        return ParseError::InvalidIndex;
+    }
+    return {};
+}
+
+static ParseResult<void> end_section(SectionId section_id, SectionId::SectionIdKind& last_section_id, size_t remaining_section_size)
+{
+    if (!section_id.can_appear_after(last_section_id))
+        return ParseError::SectionOutOfOrder;
+    // Custom sections don't participate in ordering.
+    if (section_id.kind() != SectionId::SectionIdKind::Custom)
+        last_section_id = section_id.kind();
+    if (remaining_section_size != 0)
+        return ParseError::SectionSizeMismatch;
+    return {};
+}
+
 ParseResult<NonnullRefPtr<Module>> Module::parse(Stream& stream)
 {
     ScopeLogger<WASM_BINPARSER_DEBUG> logger("Module"sv);
@@ -1776,71 +1944,179 @@ ParseResult<NonnullRefPtr<Module>> Module::parse(Stream& stream)
         size_t section_size = TRY_READ(stream, LEB128<u32>, ParseError::ExpectedSize);
         auto section_stream = ConstrainedStream { MaybeOwned<Stream>(stream), section_size };
 
-        if (section_id.kind() != SectionId::SectionIdKind::Custom) {
-            auto kind_bit = 1u << to_underlying(section_id.kind());
-            if (seen_section_kinds & kind_bit)
-                return ParseError::DuplicateSection;
-            seen_section_kinds |= kind_bit;
-        }
+        TRY(begin_section(section_id, seen_section_kinds));
+        TRY(parse_section_contents(module, section_id, section_stream));
+        TRY(end_section(section_id, last_section_id, section_stream.remaining()));
+    }
 
-        switch (section_id.kind()) {
-        case SectionId::SectionIdKind::Custom:
-            module.custom_sections().append(TRY(CustomSection::parse(section_stream)));
-            break;
-        case SectionId::SectionIdKind::Type:
-            module.type_section() = TRY(TypeSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Import:
-            module.import_section() = TRY(ImportSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Function:
-            module.function_section() = TRY(FunctionSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Table:
-            module.table_section() = TRY(TableSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Memory:
-            module.memory_section() = TRY(MemorySection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Global:
-            module.global_section() = TRY(GlobalSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Export:
-            module.export_section() = TRY(ExportSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Start:
-            module.start_section() = TRY(StartSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Element:
-            module.element_section() = TRY(ElementSection::parse(section_stream));
-            break;
-        case SectionId::SectionIdKind::Code:
-            module.code_section() = TRY(CodeSection::parse(section_stream));
+    module_ptr->preprocess();
+
+    return module_ptr;
+}
+
+NonnullRefPtr<StreamingModuleParser> StreamingModuleParser::create()
+{
+    return adopt_ref(*new StreamingModuleParser);
+}
+
+StreamingModuleParser::StreamingModuleParser()
+    : m_module(make_ref_counted<Module>())
+{
+}
+
+ParseResult<void> StreamingModuleParser::append(ReadonlyBytes bytes)
+{
+    if (m_error.has_value())
+        return *m_error;
+
+    if (m_buffer.try_append(bytes).is_error()) {
+        m_error = ParseError::OutOfMemory;
+        return *m_error;
+    }
+
+    auto result = parse_available_bytes();
+    if (result.is_error()) {
+        m_error = result.error();
+        return *m_error;
+    }
+
+    // Drop what has been parsed. Only the start of the unit that is still incomplete is moved, so every byte is moved
+    // at most once.
+    if (m_offset == m_buffer.size()) {
+        m_buffer.clear();
+    } else if (m_offset > 0) {
+        auto remaining = m_buffer.size() - m_offset;
+        __builtin_memmove(m_buffer.data(), m_buffer.data() + m_offset, remaining);
+        m_buffer.trim(remaining, false);
+    }
+    m_offset = 0;
+
+    return {};
+}
+
+ParseResult<NonnullRefPtr<Module>> StreamingModuleParser::finish()
+{
+    if (m_error.has_value())
+        return *m_error;
+
+    if (m_state != State::SectionHeader || m_offset != m_buffer.size())
+        return ParseError::UnexpectedEof;
+
+    m_module->preprocess();
+    return m_module;
+}
+
+ParseResult<void> StreamingModuleParser::parse_available_bytes()
+{
+    for (;;) {
+        auto available = m_buffer.bytes().slice(m_offset);
+
+        switch (m_state) {
+        case State::Header: {
+            if (available.size() >= 4 && available.slice(0, 4) != Module::wasm_magic.span())
+                return ParseError::InvalidModuleMagic;
+            if (available.size() < 8)
+                return {};
+            if (available.slice(4, 4) != Module::wasm_version.span())
+                return ParseError::InvalidModuleVersion;
+            m_offset += 8;
+            m_state = State::SectionHeader;
             break;
-        case SectionId::SectionIdKind::Data:
-            module.data_section() = TRY(DataSection::parse(section_stream));
+        }
+        case State::SectionHeader: {
+            if (available.is_empty())
+                return {};
+
+            FixedMemoryStream stream { available };
+            auto section_id = SectionId::parse(stream);
+            if (section_id.is_error())
+                return section_id.release_error();
+            auto section_size = stream.read_value<LEB128<u32>>();
+            if (section_size.is_error()) {
+                if (stream.is_eof())
+                    return {};
+                return ParseError::ExpectedSize;
+            }
+
+            m_section_id = section_id.release_value();
+            m_section_size = section_size.release_value();
+            m_offset += MUST(stream.tell());
+            TRY(begin_section(*m_section_id, m_seen_section_kinds));
+
+            m_state = m_section_id->kind() == SectionId::SectionIdKind::Code ? State::CodeSectionCount : State::SectionContents;
             break;
-        case SectionId::SectionIdKind::DataCount:
-            module.data_count_section() = TRY(DataCountSection::parse(section_stream));
+        }
+        case State::SectionContents: {
+            if (available.size() < m_section_size)
+                return {};
+
+            FixedMemoryStream stream { available.slice(0, m_section_size) };
+            auto section_stream = ConstrainedStream { MaybeOwned<Stream>(stream), m_section_size };
+            TRY(parse_section_contents(*m_module, *m_section_id, section_stream));
+            TRY(end_section(*m_section_id, m_last_section_id, section_stream.remaining()));
+
+            m_offset += m_section_size;
+            m_state = State::SectionHeader;
             break;
-        case SectionId::SectionIdKind::Tag:
-            module.tag_section() = TRY(TagSection::parse(section_stream));
+        }
+        case State::CodeSectionCount: {
+            auto section_is_complete = available.size() >= m_section_size;
+            FixedMemoryStream stream { available.trim(m_section_size) };
+            auto count = stream.read_value<LEB128<u32>>();
+            if (count.is_error()) {
+                if (stream.is_eof() && !section_is_complete)
+                    return {};
+                return with_eof_check(stream, ParseError::ExpectedSize);
+            }
+
+            auto count_size = MUST(stream.tell());
+            m_offset += count_size;
+            m_section_size -= count_size;
+            m_remaining_function_count = count.release_value();
+
+            // Every function body takes up at least one byte, which bounds the allocation for a malformed count.
+            m_functions.ensure_capacity(min<size_t>(m_remaining_function_count, m_section_size));
+            m_state = State::CodeSectionEntry;
             break;
-        default:
-            return ParseError::InvalidIndex;
         }
-        if (!section_id.can_appear_after(last_section_id))
-            return ParseError::SectionOutOfOrder;
-        // Custom sections don't participate in ordering.
-        if (section_id.kind() != SectionId::SectionIdKind::Custom)
-            last_section_id = section_id.kind();
-        if (section_stream.remaining() != 0)
-            return ParseError::SectionSizeMismatch;
-    }
+        case State::CodeSectionEntry: {
+            if (m_remaining_function_count == 0) {
+                m_module->code_section() = CodeSection { move(m_functions) };
+                m_functions = {};
+                TRY(end_section(*m_section_id, m_last_section_id, m_section_size));
+                m_state = State::SectionHeader;
+                break;
+            }
 
-    module_ptr->preprocess();
+            // Function bodies are parsed one at a time as soon as all of their bytes are available.
+            auto section_is_complete = available.size() >= m_section_size;
+            auto section_bytes = available.trim(m_section_size);
+            FixedMemoryStream size_stream { section_bytes };
+            auto body_size = size_stream.read_value<LEB128<u32>>();
+            if (body_size.is_error()) {
+                if (size_stream.is_eof() && !section_is_complete)
+                    return {};
+                return with_eof_check(size_stream, ParseError::InvalidSize);
+            }
 
-    return module_ptr;
+            auto entry_size = MUST(size_stream.tell()) + body_size.value();
+            if (entry_size > section_bytes.size()) {
+                if (!section_is_complete)
+                    return {};
+                return ParseError::UnexpectedEof;
+            }
+
+            FixedMemoryStream stream { section_bytes.slice(0, entry_size) };
+            auto entry_stream = ConstrainedStream { MaybeOwned<Stream>(stream), entry_size };
+            m_functions.append(TRY(CodeSection::Code::parse(entry_stream)));
+
+            m_offset += entry_size;
+            m_section_size -= entry_size;
+            --m_remaining_function_count;
+            break;
+        }
+        }
+    }
 }
 
 void Module::preprocess()
@@ -9,6 +9,7 @@ use std::error::Error;
 use std::fmt::Write;
 use std::path::Path;
 use std::path::PathBuf;
+use std::process::Command;
 
 fn generate_opcodes(manifest_dir: &Path, out_dir: &Path) -> Result<(), Box<dyn Error>> {
     let opcode_h = manifest_dir.join("../Opcode.h");
@@ -40,13 +41,67 @@ fn generate_opcodes(manifest_dir: &Path, out_dir: &Path) -> Result<(), Box<dyn E
     Ok(())
 }
 
+fn fnv1a(hash: u64, bytes: &[u8]) -> u64 {
+    bytes
+        .iter()
+        .fold(hash, |hash, byte| (hash ^ u64::from(*byte)).wrapping_mul(0x100000001b3))
+}
+
+fn collect_sources(directory: &Path, sources: &mut Vec<PathBuf>) -> Result<(), Box<dyn Error>> {
+    for entry in std::fs::read_dir(directory)? {
+        let path = entry?.path();
+        if path.is_dir() {
+            collect_sources(&path, sources)?;
+        } else if path.extension().is_some_and(|extension| extension == "rs") {
+            sources.push(path);
+        }
+    }
+    Ok(())
+}
+
+// Identifies the code generator, so that native code cached by one build is never installed by another. This covers
+// our own sources, the locked versions of the Cranelift crates, the Rust toolchain, and the target and profile.
+fn compute_compiler_version(manifest_dir: &Path) -> Result<u64, Box<dyn Error>> {
+    let mut hash = 0xcbf29ce484222325;
+
+    let mut sources = vec![manifest_dir.join("Cargo.toml"), manifest_dir.join("build.rs")];
+    collect_sources(&manifest_dir.join("src"), &mut sources)?;
+    sources.sort();
+    for source in &sources {
+        hash = fnv1a(hash, &std::fs::read(source)?);
+    }
+
+    let cargo_lock = manifest_dir.join("../../../Cargo.lock");
+    println!("cargo:rerun-if-changed={}", cargo_lock.display());
+    if let Ok(contents) = std::fs::read_to_string(&cargo_lock) {
+        let mut lines = contents.lines();
+        while let Some(line) = lines.next() {
+            if line.starts_with("name = \"cranelift") {
+                hash = fnv1a(hash, line.as_bytes());
+                hash = fnv1a(hash, lines.next().unwrap_or_default().as_bytes());
+            }
+        }
+    }
+
+    let rustc = env::var("RUSTC").unwrap_or_else(|_| "rustc".to_string());
+    if let Ok(output) = Command::new(rustc).arg("-vV").output() {
+        hash = fnv1a(hash, &output.stdout);
+    }
+
+    for variable in ["TARGET", "PROFILE", "OPT_LEVEL"] {
+        hash = fnv1a(hash, env::var(variable).unwrap_or_default().as_bytes());
+    }
+
+    Ok(hash)
+}
+
 fn main() -> Result<(), Box<dyn Error>> {
     let manifest_dir = PathBuf::from(env::var("CARGO_MANIFEST_DIR")?);
     let out_dir = PathBuf::from(env::var("OUT_DIR")?);
 
     println!("cargo:rerun-if-changed=build.rs");
     println!("cargo:rerun-if-changed=cbindgen.toml");
-    println!("cargo:rerun-if-changed=src/lib.rs");
+    println!("cargo:rerun-if-changed=src");
 
     generate_opcodes(&manifest_dir, &out_dir)?;
 
@@ -54,15 +109,26 @@ fn main() -> Result<(), Box<dyn Error>> {
         .map(PathBuf::from)
         .unwrap_or_else(|_| out_dir.clone());
 
-    cbindgen::generate(manifest_dir).map_or_else(
-        |error| match error {
-            cbindgen::Error::ParseSyntaxError { .. } => {}
-            e => panic!("{e:?}"),
-        },
-        |bindings| {
-            bindings.write_to_file(ffi_out_dir.join("CraneliftFFI.h"));
-        },
-    );
+    let compiler_version = compute_compiler_version(&manifest_dir)?;
+
+    let mut config = cbindgen::Config::from_file(manifest_dir.join("cbindgen.toml"))?;
+    config.trailer = Some(format!(
+        "namespace Wasm::Cranelift {{\ninline constexpr uint64_t COMPILER_VERSION = {compiler_version:#018x}ULL;\n}}"
+    ));
+
+    cbindgen::Builder::new()
+        .with_crate(manifest_dir)
+        .with_config(config)
+        .generate()
+        .map_or_else(
+            |error| match error {
+                cbindgen::Error::ParseSyntaxError { .. } => {}
+                e => panic!("{e:?}"),
+            },
+            |bindings| {
+                bindings.write_to_file(ffi_out_dir.join("CraneliftFFI.h"));
+            },
+        );
 
     Ok(())
 }
@@ -15,7 +15,9 @@ use cranelift_codegen::Context;
 use cranelift_codegen::FinalizedRelocTarget;
 use cranelift_codegen::binemit::Reloc;
 use cranelift_codegen::ir::AbiParam;
+use cranelift_codegen::ir::AtomicRmwOp;
 use cranelift_codegen::ir::Block;
+use cranelift_codegen::ir::Endianness;
 use cranelift_codegen::ir::ExtFuncData;
 use cranelift_codegen::ir::ExternalName;
 use cranelift_codegen::ir::Function;
@@ -24,6 +26,7 @@ use cranelift_codegen::ir::MemFlags;
 use cranelift_codegen::ir::Signature;
 use cranelift_codegen::ir::StackSlotData;
 use cranelift_codegen::ir::StackSlotKind;
+use cranelift_codegen::ir::Type;
 use cranelift_codegen::ir::UserExternalName;
 use cranelift_codegen::ir::UserFuncName;
 use cranelift_codegen::ir::condcodes::FloatCC;
@@ -49,13 +52,18 @@ const REG_COUNT: usize = 8;
 const STACK_MARKER: u8 = 8;
 const CALLREC_BASE: u8 = 9;
 
-/// The `Int` bank is always defined.
+/// ValueType::Kind::V128, as found in the local types.
+const V128_KIND: u8 = 4;
+
+/// The `Int` bank is always defined; for a v128 it holds the low half, and the high half lives in a parallel set of
+/// variables that only exists in functions using SIMD.
 /// The `F64` bank is trusted only until the next control-flow merge, where it may be undefined on an incoming edge.
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
 enum Bank {
     Int,
     F32,
     F64,
+    V128,
 }
 
 /// Control flow frame tracking for structured control flow.
@@ -77,6 +85,20 @@ struct ControlFrame {
     /// Only meaningful (and only set) when vstack is disabled (max_stack_depth == 0).
     entry_real_depth_var: Option<Variable>,
     bank_snapshot: Option<([Bank; REG_COUNT], Vec<Bank>)>,
+    /// Set for try_table frames.
+    landing_pad: Option<LandingPad>,
+}
+
+/// The catch clauses of a try_table. Exceptions reach it over the trap edges of the calls (and throws) inside the
+/// try_table, so the path where nothing is thrown costs nothing extra.
+struct LandingPad {
+    block: Block,
+    /// Where traps went outside the try_table, and where the exceptions that no clause catches go on to.
+    outer_trap_target: Block,
+    /// Each clause's label, relative to the frame enclosing the try_table.
+    catch_labels: Vec<usize>,
+    /// The try_table's index in the dispatch list, which the catch helper finds the clauses through.
+    dispatch_index: i64,
 }
 
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
@@ -98,16 +120,38 @@ impl CraneliftCompiler {
         num_params: u32,
         local_types: &[u8],
     ) -> Result<CompiledFunction, &'static str> {
+        let uses_simd = insns.iter().any(|insn| Self::is_simd(insn.opcode)) || local_types.contains(&V128_KIND);
         for insn in insns {
             if !Self::is_supported(insn) {
                 return Err("unsupported instruction");
             }
-            if matches!(insn.opcode, op::BLOCK | op::LOOP | op::IF) {
+            // Calls and selects move their operands as a single i64, which would drop the high half of a v128.
+            if uses_simd
+                && matches!(
+                    insn.opcode,
+                    op::CALL | op::CALL_INDIRECT | op::SELECT | op::SELECT_TYPED | op::SYNTHETIC_CALL_00
+                        ..=op::SYNTHETIC_CALL_31 | op::SYNTHETIC_CALL_WITH_RECORD_0 | op::SYNTHETIC_CALL_WITH_RECORD_1
+                )
+            {
+                return Err("calls and selects are not supported in functions using SIMD");
+            }
+            if uses_simd
+                && matches!(
+                    insn.opcode,
+                    op::RETURN_CALL | op::RETURN_CALL_INDIRECT | op::THROW | op::TRY_TABLE
+                )
+            {
+                return Err("tail calls and exceptions are not supported in functions using SIMD");
+            }
+            if matches!(insn.opcode, op::BLOCK | op::LOOP | op::IF | op::TRY_TABLE) {
                 let arity = insn.imm3 & 0xffff;
                 if arity > 1 {
                     return Err("multi-value blocks not supported");
                 }
             }
+            if insn.opcode == op::TRY_TABLE && (insn.imm2 >> 32) & 0xff == 0xff {
+                return Err("try_table catches not supported");
+            }
             // Note: op::CALL is used for multi-value returns but also for some
             // single-return calls. We handle it via flush_vstack_to_real before the call.
         }
@@ -167,6 +211,8 @@ impl CraneliftCompiler {
 
         let epilogue_block = builder.create_block();
         let trap_block = builder.create_block();
+        // Where failed helper calls branch to: the trap block, or the innermost try_table's landing pad.
+        let mut trap_target = trap_block;
 
         // Build helper call signatures. We import them as indirect calls via function pointers.
         macro_rules! sig {
@@ -259,6 +305,10 @@ impl CraneliftCompiler {
         let h_memory_copy = decl_helper!(memory_copy_sig, HelperId::memory_copy);
         let h_memory_fill = decl_helper!(memory_fill_sig, HelperId::memory_fill);
         let h_primitive_storage_cage_base = decl_helper!(cage_base_sig, HelperId::primitive_storage_cage_base);
+        let h_tail_call = decl_helper!(call_fn_sig, HelperId::tail_call);
+        let h_tail_call_indirect = decl_helper!(call_indirect_sig, HelperId::tail_call_indirect);
+        let h_throw_exception = decl_helper!(call_fn_sig, HelperId::throw_exception);
+        let h_catch_exception = decl_helper!(call_fn_sig, HelperId::catch_exception);
         let locals_base_offset = helpers.locals_base_offset as i32;
         let default_memory_offset = helpers.default_memory_offset as i32;
         let memory_instance_data_offset = helpers.memory_instance_data_offset as i32;
@@ -269,6 +319,8 @@ impl CraneliftCompiler {
         // Accesses to the default memory are unchecked and may fault; the fault handler turns
         // faults inside a memory's guarded reservation into wasm traps.
         let wasm_memory_flags = MemFlags::new();
+        // Vectors are kept as i64x2 and reinterpreted lane-wise; bitcasts between lane shapes need an explicit byte order.
+        let vector_flags = MemFlags::new().with_endianness(Endianness::Little);
         let interp_var = Variable::from_u32(8);
         builder.declare_var(interp_var, ptr_type);
         builder.def_var(interp_var, interpreter_val);
@@ -314,6 +366,9 @@ impl CraneliftCompiler {
                     | op::I64_STORE32
                     | op::SYNTHETIC_I32_STORELOCAL
                     | op::SYNTHETIC_I64_STORELOCAL
+                    | op::V128_LOAD..=op::V128_STORE
+                    | op::V128_LOAD8_LANE..=op::V128_LOAD64_ZERO
+                    | op::I32_ATOMIC_LOAD..=op::I64_ATOMIC_RMW32_CMPXCHG_U
             ) && mem_idx == 0
         });
         // The base address is stable for the whole call: memory32 storage reserves its maximum
@@ -346,9 +401,14 @@ impl CraneliftCompiler {
         let mut control_stack: Vec<ControlFrame> = Vec::new();
 
         // Virtual stack, to avoid touching the interpreter-side stack as much as possible.
-        let has_raw_call = insns
-            .iter()
-            .any(|i| i.opcode == op::CALL || i.opcode == op::CALL_INDIRECT);
+        // Tail calls and exceptions also pass their operands on the real stack, and landing pads trim it back to the
+        // try_table's entry depth, which is only tracked without the vstack.
+        let has_raw_call = insns.iter().any(|i| {
+            matches!(
+                i.opcode,
+                op::CALL | op::CALL_INDIRECT | op::RETURN_CALL | op::RETURN_CALL_INDIRECT | op::THROW | op::TRY_TABLE
+            )
+        });
         let max_stack_depth = match has_raw_call {
             true => 0,
             // We can't easily track across control flow merges, so count dests instead.
@@ -401,6 +461,47 @@ impl CraneliftCompiler {
                 v
             })
             .collect();
+        // The high halves of v128 values. Registers may hold a v128 on entry (e.g. on tier-up), so load their high
+        // halves too; everything else starts out as the zero-extension of a scalar.
+        let zero_hi = builder.ins().iconst(types::I64, 0);
+        let reg_vars_hi: Vec<Variable> = (0..if uses_simd { REG_COUNT } else { 0 })
+            .map(|i| {
+                let v = Variable::from_u32(next_var_id);
+                next_var_id += 1;
+                builder.declare_var(v, types::I64);
+                let offset = regs_offset + (i as i32) * value_size + 8;
+                let hi = builder
+                    .ins()
+                    .load(types::I64, MemFlags::trusted(), configuration_val, offset);
+                builder.def_var(v, hi);
+                v
+            })
+            .collect();
+        let stack_vars_hi: Vec<Variable> = (0..if uses_simd { max_stack_depth } else { 0 })
+            .map(|_| {
+                let v = Variable::from_u32(next_var_id);
+                next_var_id += 1;
+                builder.declare_var(v, types::I64);
+                builder.def_var(v, zero_hi);
+                v
+            })
+            .collect();
+        let reg_vars_v128: Vec<Variable> = (0..if uses_simd { REG_COUNT } else { 0 })
+            .map(|_| {
+                let v = Variable::from_u32(next_var_id);
+                next_var_id += 1;
+                builder.declare_var(v, types::I64X2);
+                v
+            })
+            .collect();
+        let stack_vars_v128: Vec<Variable> = (0..if uses_simd { max_stack_depth } else { 0 })
+            .map(|_| {
+                let v = Variable::from_u32(next_var_id);
+                next_var_id += 1;
+                builder.declare_var(v, types::I64X2);
+                v
+            })
+            .collect();
         let mut reg_ty = [Bank::Int; REG_COUNT];
         let mut stack_ty = vec![Bank::Int; max_stack_depth];
 
@@ -414,6 +515,9 @@ impl CraneliftCompiler {
         let local_is_f32: Vec<bool> = (0..num_locals)
             .map(|i| local_types.get(i).copied() == Some(F32_KIND))
             .collect();
+        let local_is_v128: Vec<bool> = (0..num_locals)
+            .map(|i| local_types.get(i).copied() == Some(V128_KIND))
+            .collect();
 
         // Promoting wasm locals to SSA variables keeps them in registers, which is a win only
         // as long as they actually fit. Functions with more locals than the machine has usable
@@ -428,7 +532,8 @@ impl CraneliftCompiler {
         } else {
             8
         };
-        let local_vars: Vec<Variable> = if num_locals <= max_promote_locals {
+        // v128 locals always stay in the frame, which keeps both of their halves in one place.
+        let local_vars: Vec<Variable> = if num_locals <= max_promote_locals && !local_is_v128.contains(&true) {
             (0..num_locals)
                 .map(|_| {
                     let v = Variable::from_u32(next_var_id);
@@ -538,11 +643,14 @@ impl CraneliftCompiler {
                     let zero_tag = $builder.ins().iconst(types::I64, 0);
                     for i in 0..sp {
                         let val = $builder.use_var(stack_vars[i]);
+                        let hi = if uses_simd {
+                            $builder.use_var(stack_vars_hi[i])
+                        } else {
+                            zero_tag
+                        };
                         let offset = (i as i32) * value_size;
                         $builder.ins().store(MemFlags::trusted(), val, top, offset);
-                        $builder
-                            .ins()
-                            .store(MemFlags::trusted(), zero_tag, top, offset + 8);
+                        $builder.ins().store(MemFlags::trusted(), hi, top, offset + 8);
                     }
                     let new_top = $builder.ins().iadd_imm(top, i64::from(sp as i32 * value_size));
                     $builder
@@ -564,11 +672,14 @@ impl CraneliftCompiler {
                     let zero_tag = $builder.ins().iconst(types::I64, 0);
                     for i in 0..n {
                         let val = $builder.use_var(stack_vars[sp - n + i]);
+                        let hi = if uses_simd {
+                            $builder.use_var(stack_vars_hi[sp - n + i])
+                        } else {
+                            zero_tag
+                        };
                         let offset = (i as i32) * value_size;
                         $builder.ins().store(MemFlags::trusted(), val, top, offset);
-                        $builder
-                            .ins()
-                            .store(MemFlags::trusted(), zero_tag, top, offset + 8);
+                        $builder.ins().store(MemFlags::trusted(), hi, top, offset + 8);
                     }
                     let new_top = $builder.ins().iadd_imm(top, i64::from(n as i32 * value_size));
                     $builder
@@ -584,11 +695,17 @@ impl CraneliftCompiler {
                 let val = $val;
                 if dst < STACK_MARKER {
                     $builder.def_var(reg_vars[dst as usize], val);
+                    if uses_simd {
+                        $builder.def_var(reg_vars_hi[dst as usize], zero_hi);
+                    }
                     reg_ty[dst as usize] = Bank::Int;
                     dirty_regs[dst as usize] = true;
                 } else if dst == STACK_MARKER {
                     if max_stack_depth > 0 {
                         $builder.def_var(stack_vars[sp], val);
+                        if uses_simd {
+                            $builder.def_var(stack_vars_hi[sp], zero_hi);
+                        }
                         stack_ty[sp] = Bank::Int;
                         sp += 1;
                     } else {
@@ -647,12 +764,18 @@ impl CraneliftCompiler {
                 if dst < STACK_MARKER {
                     $builder.def_var(reg_vars_f64[dst as usize], val);
                     $builder.def_var(reg_vars[dst as usize], bits);
+                    if uses_simd {
+                        $builder.def_var(reg_vars_hi[dst as usize], zero_hi);
+                    }
                     reg_ty[dst as usize] = Bank::F64;
                     dirty_regs[dst as usize] = true;
                 } else if dst == STACK_MARKER {
                     if max_stack_depth > 0 {
                         $builder.def_var(stack_vars_f64[sp], val);
                         $builder.def_var(stack_vars[sp], bits);
+                        if uses_simd {
+                            $builder.def_var(stack_vars_hi[sp], zero_hi);
+                        }
                         stack_ty[sp] = Bank::F64;
                         sp += 1;
                     } else {
@@ -718,12 +841,18 @@ impl CraneliftCompiler {
                 if dst < STACK_MARKER {
                     $builder.def_var(reg_vars_f32[dst as usize], val);
                     $builder.def_var(reg_vars[dst as usize], bits);
+                    if uses_simd {
+                        $builder.def_var(reg_vars_hi[dst as usize], zero_hi);
+                    }
                     reg_ty[dst as usize] = Bank::F32;
                     dirty_regs[dst as usize] = true;
                 } else if dst == STACK_MARKER {
                     if max_stack_depth > 0 {
                         $builder.def_var(stack_vars_f32[sp], val);
                         $builder.def_var(stack_vars[sp], bits);
+                        if uses_simd {
+                            $builder.def_var(stack_vars_hi[sp], zero_hi);
+                        }
                         stack_ty[sp] = Bank::F32;
                         sp += 1;
                     } else {
@@ -740,6 +869,81 @@ impl CraneliftCompiler {
             }};
         }
 
+        macro_rules! read_src_v128 {
+            ($builder:expr, $src:expr) => {{
+                let src = $src;
+                if src < STACK_MARKER {
+                    if reg_ty[src as usize] == Bank::V128 {
+                        $builder.use_var(reg_vars_v128[src as usize])
+                    } else {
+                        let lo = $builder.use_var(reg_vars[src as usize]);
+                        let hi = $builder.use_var(reg_vars_hi[src as usize]);
+                        let v = $builder.ins().scalar_to_vector(types::I64X2, lo);
+                        $builder.ins().insertlane(v, hi, 1)
+                    }
+                } else if src == STACK_MARKER && max_stack_depth > 0 && sp > 0 {
+                    sp -= 1;
+                    if stack_ty[sp] == Bank::V128 {
+                        $builder.use_var(stack_vars_v128[sp])
+                    } else {
+                        let lo = $builder.use_var(stack_vars[sp]);
+                        let hi = $builder.use_var(stack_vars_hi[sp]);
+                        let v = $builder.ins().scalar_to_vector(types::I64X2, lo);
+                        $builder.ins().insertlane(v, hi, 1)
+                    }
+                } else {
+                    return Err("v128 operand outside of the registers and the virtual stack");
+                }
+            }};
+        }
+
+        macro_rules! write_dst_v128 {
+            ($builder:expr, $dst:expr, $val:expr) => {{
+                let dst = $dst;
+                let val = $val;
+                let lo = $builder.ins().extractlane(val, 0);
+                let hi = $builder.ins().extractlane(val, 1);
+                if dst < STACK_MARKER {
+                    $builder.def_var(reg_vars_v128[dst as usize], val);
+                    $builder.def_var(reg_vars[dst as usize], lo);
+                    $builder.def_var(reg_vars_hi[dst as usize], hi);
+                    reg_ty[dst as usize] = Bank::V128;
+                    dirty_regs[dst as usize] = true;
+                } else if dst == STACK_MARKER && max_stack_depth > 0 {
+                    $builder.def_var(stack_vars_v128[sp], val);
+                    $builder.def_var(stack_vars[sp], lo);
+                    $builder.def_var(stack_vars_hi[sp], hi);
+                    stack_ty[sp] = Bank::V128;
+                    sp += 1;
+                } else {
+                    return Err("v128 result outside of the registers and the virtual stack");
+                }
+            }};
+        }
+
+        // Reinterpret a vector as the given lane shape, and back to the canonical i64x2.
+        macro_rules! v128_as {
+            ($builder:expr, $ty:expr, $val:expr) => {{
+                let ty = $ty;
+                let val = $val;
+                if ty == types::I64X2 {
+                    val
+                } else {
+                    $builder.ins().bitcast(ty, vector_flags, val)
+                }
+            }};
+        }
+        macro_rules! v128_canonical {
+            ($builder:expr, $val:expr) => {{
+                let val = $val;
+                if $builder.func.dfg.value_type(val) == types::I64X2 {
+                    val
+                } else {
+                    $builder.ins().bitcast(types::I64X2, vector_flags, val)
+                }
+            }};
+        }
+
         macro_rules! reset_banks {
             () => {{
                 for t in reg_ty.iter_mut() {
@@ -856,6 +1060,121 @@ impl CraneliftCompiler {
             }};
         }
 
+        macro_rules! v128_unop {
+            ($builder:expr, $insn:expr, $ty:expr, $op:ident) => {{
+                let src = read_src_v128!($builder, $insn.sources[0]);
+                let src = v128_as!($builder, $ty, src);
+                let result = $builder.ins().$op(src);
+                let result = v128_canonical!($builder, result);
+                write_dst_v128!($builder, $insn.destination, result);
+            }};
+        }
+        macro_rules! v128_binop {
+            ($builder:expr, $insn:expr, $ty:expr, $op:ident) => {{
+                let rhs = read_src_v128!($builder, $insn.sources[0]);
+                let lhs = read_src_v128!($builder, $insn.sources[1]);
+                let rhs = v128_as!($builder, $ty, rhs);
+                let lhs = v128_as!($builder, $ty, lhs);
+                let result = $builder.ins().$op(lhs, rhs);
+                let result = v128_canonical!($builder, result);
+                write_dst_v128!($builder, $insn.destination, result);
+            }};
+        }
+        macro_rules! v128_icmp {
+            ($builder:expr, $insn:expr, $ty:expr, $cc:expr) => {{
+                let rhs = read_src_v128!($builder, $insn.sources[0]);
+                let lhs = read_src_v128!($builder, $insn.sources[1]);
+                let rhs = v128_as!($builder, $ty, rhs);
+                let lhs = v128_as!($builder, $ty, lhs);
+                let result = $builder.ins().icmp($cc, lhs, rhs);
+                let result = v128_canonical!($builder, result);
+                write_dst_v128!($builder, $insn.destination, result);
+            }};
+        }
+        macro_rules! v128_fcmp {
+            ($builder:expr, $insn:expr, $ty:expr, $cc:expr) => {{
+                let rhs = read_src_v128!($builder, $insn.sources[0]);
+                let lhs = read_src_v128!($builder, $insn.sources[1]);
+                let rhs = v128_as!($builder, $ty, rhs);
+                let lhs = v128_as!($builder, $ty, lhs);
+                let result = $builder.ins().fcmp($cc, lhs, rhs);
+                let result = v128_canonical!($builder, result);
+                write_dst_v128!($builder, $insn.destination, result);
+            }};
+        }
+        // Cranelift takes vector shift amounts modulo the lane width, as wasm does.
+        macro_rules! v128_shift {
+            ($builder:expr, $insn:expr, $ty:expr, $op:ident) => {{
+                let amount_raw = read_src!($builder, $insn.sources[0]);
+                let src = read_src_v128!($builder, $insn.sources[1]);
+                let amount = $builder.ins().ireduce(types::I32, amount_raw);
+                let src = v128_as!($builder, $ty, src);
+                let result = $builder.ins().$op(src, amount);
+                let result = v128_canonical!($builder, result);
+                write_dst_v128!($builder, $insn.destination, result);
+            }};
+        }
+        macro_rules! v128_extmul {
+            ($builder:expr, $insn:expr, $ty:expr, $widen:ident) => {{
+                let rhs = read_src_v128!($builder, $insn.sources[0]);
+                let lhs = read_src_v128!($builder, $insn.sources[1]);
+                let rhs = v128_as!($builder, $ty, rhs);
+                let lhs = v128_as!($builder, $ty, lhs);
+                let rhs = $builder.ins().$widen(rhs);
+                let lhs = $builder.ins().$widen(lhs);
+                let result = $builder.ins().imul(lhs, rhs);
+                let result = v128_canonical!($builder, result);
+                write_dst_v128!($builder, $insn.destination, result);
+            }};
+        }
+        macro_rules! v128_extadd_pairwise {
+            ($builder:expr, $insn:expr, $ty:expr, $widen_low:ident, $widen_high:ident) => {{
+                let src = read_src_v128!($builder, $insn.sources[0]);
+                let src = v128_as!($builder, $ty, src);
+                let low = $builder.ins().$widen_low(src);
+                let high = $builder.ins().$widen_high(src);
+                let result = $builder.ins().iadd_pairwise(low, high);
+                let result = v128_canonical!($builder, result);
+                write_dst_v128!($builder, $insn.destination, result);
+            }};
+        }
+        // Sums the products of adjacent signed lanes, as in i32x4.dot_i16x8_s.
+        macro_rules! v128_dot {
+            ($builder:expr, $lhs:expr, $rhs:expr, $ty:expr) => {{
+                let lhs = v128_as!($builder, $ty, $lhs);
+                let rhs = v128_as!($builder, $ty, $rhs);
+                let lhs_low = $builder.ins().swiden_low(lhs);
+                let rhs_low = $builder.ins().swiden_low(rhs);
+                let lhs_high = $builder.ins().swiden_high(lhs);
+                let rhs_high = $builder.ins().swiden_high(rhs);
+                let low = $builder.ins().imul(lhs_low, rhs_low);
+                let high = $builder.ins().imul(lhs_high, rhs_high);
+                $builder.ins().iadd_pairwise(low, high)
+            }};
+        }
+        macro_rules! v128_splat {
+            ($builder:expr, $insn:expr, $ty:expr, $lane_ty:expr) => {{
+                let raw = read_src!($builder, $insn.sources[0]);
+                let lane = if $lane_ty == types::I64 {
+                    raw
+                } else {
+                    $builder.ins().ireduce($lane_ty, raw)
+                };
+                let result = $builder.ins().splat($ty, lane);
+                let result = v128_canonical!($builder, result);
+                write_dst_v128!($builder, $insn.destination, result);
+            }};
+        }
+        macro_rules! v128_to_i32 {
+            ($builder:expr, $insn:expr, $ty:expr, $op:ident) => {{
+                let src = read_src_v128!($builder, $insn.sources[0]);
+                let src = v128_as!($builder, $ty, src);
+                let result = $builder.ins().$op(src);
+                let result = $builder.ins().uextend(types::I64, result);
+                write_dst!($builder, $insn.destination, result);
+            }};
+        }
+
         macro_rules! read_local_inline {
             ($builder:expr, $idx_imm:expr) => {{
                 let idx = ($idx_imm) as usize;
@@ -971,7 +1290,13 @@ impl CraneliftCompiler {
         macro_rules! local_get {
             ($builder:expr, $idx_imm:expr, $dst:expr) => {{
                 let idx = ($idx_imm) as usize;
-                if idx < local_vars.len() && local_is_f64[idx] {
+                if local_is_v128.get(idx) == Some(&true) {
+                    let lb = $builder.use_var(locals_base_var);
+                    let result = $builder
+                        .ins()
+                        .load(types::I64X2, MemFlags::trusted(), lb, (idx as i32) * value_size);
+                    write_dst_v128!($builder, $dst, result);
+                } else if idx < local_vars.len() && local_is_f64[idx] {
                     let result = read_local_f64!($builder, $idx_imm);
                     write_dst_f64!($builder, $dst, result);
                 } else if idx < local_vars.len() && local_is_f32[idx] {
@@ -986,7 +1311,13 @@ impl CraneliftCompiler {
         macro_rules! local_set {
             ($builder:expr, $idx_imm:expr, $src:expr) => {{
                 let idx = ($idx_imm) as usize;
-                if idx < local_vars.len() && local_is_f64[idx] {
+                if local_is_v128.get(idx) == Some(&true) {
+                    let val = read_src_v128!($builder, $src);
+                    let lb = $builder.use_var(locals_base_var);
+                    $builder
+                        .ins()
+                        .store(MemFlags::trusted(), val, lb, (idx as i32) * value_size);
+                } else if idx < local_vars.len() && local_is_f64[idx] {
                     let val = read_src_f64!($builder, $src);
                     write_local_f64!($builder, $idx_imm, val);
                 } else if idx < local_vars.len() && local_is_f32[idx] {
@@ -1030,7 +1361,7 @@ impl CraneliftCompiler {
                 let trapped = $builder.inst_results(call)[0];
                 let is_trap = $builder.ins().icmp_imm(IntCC::NotEqual, trapped, 0);
                 let cont = $builder.create_block();
-                $builder.ins().brif(is_trap, trap_block, &[], cont, &[]);
+                $builder.ins().brif(is_trap, trap_target, &[], cont, &[]);
                 $builder.switch_to_block(cont);
                 $builder.seal_block(cont);
                 // Reload locals_base; frame_stack may have reallocated.
@@ -1075,9 +1406,50 @@ impl CraneliftCompiler {
                 $builder.ins().iadd(memory_base, addr_offset)
             }};
         }
+        // SIMD memory accesses are only compiled for the default memory.
+        macro_rules! v128_memory_address {
+            ($builder:expr, $insn:expr, $src:expr) => {{
+                if $insn.imm3 & 0x7fff_ffff != 0 {
+                    return Err("v128 memory access outside of the default memory");
+                }
+                let base_raw = read_src!($builder, $src);
+                let base_u32 = $builder.ins().ireduce(types::I32, base_raw);
+                let base_u64 = $builder.ins().uextend(types::I64, base_u32);
+                let offset = $builder.ins().iconst(types::I64, $insn.imm1);
+                let addr = $builder.ins().iadd(base_u64, offset);
+                inline_default_memory_address!($builder, addr)
+            }};
+        }
 
-        // On a fresh call only the parameters are initialized by the caller.
-        macro_rules! init_locals_fresh {
+        // Atomic memory accesses are only compiled for the default memory. They have to be naturally aligned, which
+        // is checked up front; out-of-bounds accesses fault just like other accesses do.
+        macro_rules! atomic_memory_address {
+            ($builder:expr, $insn:expr, $src:expr, $size:expr) => {{
+                if $insn.imm3 & 0x7fff_ffff != 0 {
+                    return Err("atomic memory access outside of the default memory");
+                }
+                let base_raw = read_src!($builder, $src);
+                let base_u32 = $builder.ins().ireduce(types::I32, base_raw);
+                let base_u64 = $builder.ins().uextend(types::I64, base_u32);
+                let offset = $builder.ins().iconst(types::I64, $insn.imm1);
+                let addr = $builder.ins().iadd(base_u64, offset);
+                if $size > 1 {
+                    let misalignment = $builder.ins().band_imm(addr, $size - 1);
+                    let misaligned = $builder.create_block();
+                    let aligned = $builder.create_block();
+                    $builder.ins().brif(misalignment, misaligned, &[], aligned, &[]);
+                    $builder.switch_to_block(misaligned);
+                    $builder.seal_block(misaligned);
+                    set_trap!($builder, "Unaligned atomic memory access");
+                    $builder.ins().jump(trap_block, &[]);
+                    $builder.switch_to_block(aligned);
+                    $builder.seal_block(aligned);
+                }
+                inline_default_memory_address!($builder, addr)
+            }};
+        }
+
+        macro_rules! zero_non_param_locals {
             ($builder:expr) => {{
                 if local_vars.is_empty() {
                     if num_locals > num_params {
@@ -1090,31 +1462,38 @@ impl CraneliftCompiler {
                         }
                     }
                 } else {
+                    for i in num_params..num_locals {
+                        let zero = if local_is_f64[i] {
+                            $builder.ins().f64const(0.0)
+                        } else if local_is_f32[i] {
+                            $builder.ins().f32const(0.0)
+                        } else {
+                            $builder.ins().iconst(types::I64, 0)
+                        };
+                        $builder.def_var(local_vars[i], zero);
+                    }
+                }
+            }};
+        }
+        // On a fresh call only the parameters are initialized by the caller.
+        macro_rules! init_locals_fresh {
+            ($builder:expr) => {{
+                if !local_vars.is_empty() {
                     let lb = $builder.use_var(locals_base_var);
-                    for (i, var) in local_vars.iter().enumerate() {
-                        if i < num_params {
-                            let ty = if local_is_f64[i] {
-                                types::F64
-                            } else if local_is_f32[i] {
-                                types::F32
-                            } else {
-                                types::I64
-                            };
-                            let offset = (i as i32) * value_size;
-                            let val = $builder.ins().load(ty, MemFlags::trusted(), lb, offset);
-                            $builder.def_var(*var, val);
-                        } else if local_is_f64[i] {
-                            let zero = $builder.ins().f64const(0.0);
-                            $builder.def_var(*var, zero);
+                    for i in 0..num_params {
+                        let ty = if local_is_f64[i] {
+                            types::F64
                         } else if local_is_f32[i] {
-                            let zero = $builder.ins().f32const(0.0);
-                            $builder.def_var(*var, zero);
+                            types::F32
                         } else {
-                            let zero = $builder.ins().iconst(types::I64, 0);
-                            $builder.def_var(*var, zero);
-                        }
+                            types::I64
+                        };
+                        let offset = (i as i32) * value_size;
+                        let val = $builder.ins().load(ty, MemFlags::trusted(), lb, offset);
+                        $builder.def_var(local_vars[i], val);
                     }
                 }
+                zero_non_param_locals!($builder);
             }};
         }
         macro_rules! init_locals_resume {
@@ -1168,6 +1547,24 @@ impl CraneliftCompiler {
             None
         };
 
+        // A tail call to the function itself reinitializes the locals and jumps back to the start of the body, and a
+        // tail call to any other function is left for whoever entered this one to make after it has returned.
+        let self_tail_call_target: Option<Block> = if !insns.iter().any(|i| i.opcode == op::RETURN_CALL && i.imm2 == 1)
+        {
+            None
+        } else if let Some(body_start) = tier_up_body_start {
+            Some(body_start)
+        } else {
+            let body_start = builder.create_block();
+            builder.ins().jump(body_start, &[]);
+            builder.switch_to_block(body_start);
+            Some(body_start)
+        };
+        let tail_call_block: Option<Block> = insns
+            .iter()
+            .any(|i| i.opcode == op::RETURN_CALL_INDIRECT || (i.opcode == op::RETURN_CALL && i.imm2 != 1))
+            .then(|| builder.create_block());
+
         let mut ip = 0usize;
         while ip < insns.len() {
             let insn = &insns[ip];
@@ -1180,6 +1577,7 @@ impl CraneliftCompiler {
                     Self::sync_regs_to_config(
                         &mut builder,
                         &reg_vars,
+                        &reg_vars_hi,
                         config_var,
                         regs_offset,
                         value_size,
@@ -1218,6 +1616,7 @@ impl CraneliftCompiler {
                         stack_depth_at_entry: (sp - param_count) as i32,
                         entry_real_depth_var,
                         bank_snapshot: None,
+                        landing_pad: None,
                     });
                 }
 
@@ -1248,6 +1647,7 @@ impl CraneliftCompiler {
                         stack_depth_at_entry: (sp - param_count) as i32,
                         entry_real_depth_var,
                         bank_snapshot: None,
+                        landing_pad: None,
                     });
                     // Loop header is a merge point (entry edge + back-edges + any tier-up dispatch).
                     reset_banks!();
@@ -1292,6 +1692,7 @@ impl CraneliftCompiler {
                         stack_depth_at_entry: (sp - _param_count) as i32,
                         entry_real_depth_var,
                         bank_snapshot: Some((reg_ty, stack_ty.clone())),
+                        landing_pad: None,
                     });
                 }
 
@@ -1317,6 +1718,40 @@ impl CraneliftCompiler {
                     }
                 }
 
+                op::TRY_TABLE => {
+                    let arity = insn.imm3 & 0xffff;
+                    let param_count = (insn.imm3 >> 16) as usize;
+                    let catch_count = ((insn.imm2 >> 32) & 0xff) as usize;
+                    let after = builder.create_block();
+                    // Functions with a try_table never use the vstack, so the real stack is all there is to trim.
+                    let entry_real_depth_var = Variable::from_u32(next_var_id);
+                    next_var_id += 1;
+                    builder.declare_var(entry_real_depth_var, types::I64);
+                    let cur = emit_stack_size!(builder);
+                    let entry = builder.ins().iadd_imm(cur, -(param_count as i64));
+                    builder.def_var(entry_real_depth_var, entry);
+                    let landing_pad = LandingPad {
+                        block: builder.create_block(),
+                        outer_trap_target: trap_target,
+                        catch_labels: (0..catch_count)
+                            .map(|i| ((insn.imm1 >> (i * 16)) & 0xffff) as usize)
+                            .collect(),
+                        dispatch_index: insn.imm2 & 0xffff_ffff,
+                    };
+                    trap_target = landing_pad.block;
+                    control_stack.push(ControlFrame {
+                        kind: ControlKind::Block,
+                        branch_target: after,
+                        after_block: after,
+                        arity,
+                        param_count,
+                        stack_depth_at_entry: sp as i32 - param_count as i32,
+                        entry_real_depth_var: Some(entry_real_depth_var),
+                        bank_snapshot: None,
+                        landing_pad: Some(landing_pad),
+                    });
+                }
+
                 op::END | op::SYNTHETIC_END_EXPRESSION => {
                     if let Some(frame) = control_stack.pop() {
                         let after = if frame.kind == ControlKind::If && frame.after_block != frame.branch_target {
@@ -1327,6 +1762,71 @@ impl CraneliftCompiler {
                         };
 
                         builder.ins().jump(after, &[]);
+
+                        // Every edge into the landing pad is known now, so emit it: trim the stack as the branch to a
+                        // handler would, ask the catch helper which clause (if any) matches, and take that branch.
+                        if let Some(pad) = &frame.landing_pad {
+                            trap_target = pad.outer_trap_target;
+                            builder.switch_to_block(pad.block);
+                            builder.seal_block(pad.block);
+                            let cfg = builder.use_var(config_var);
+                            let new_lb = builder
+                                .ins()
+                                .load(ptr_type, MemFlags::trusted(), cfg, locals_base_offset);
+                            builder.def_var(locals_base_var, new_lb);
+                            let entry_depth = builder.use_var(
+                                frame
+                                    .entry_real_depth_var
+                                    .expect("entry_real_depth_var must be set for a try_table"),
+                            );
+                            let no_results = builder.ins().iconst(types::I32, 0);
+                            let cleanup_fp = builder.ins().func_addr(ptr_type, h_stack_cleanup);
+                            builder
+                                .ins()
+                                .call_indirect(stack_cleanup_sig, cleanup_fp, &[cfg, entry_depth, no_results]);
+                            let iv = builder.use_var(interp_var);
+                            let try_table_ip = builder.ins().iconst(types::I32, pad.dispatch_index);
+                            let catch_fp = builder.ins().func_addr(ptr_type, h_catch_exception);
+                            let call = builder
+                                .ins()
+                                .call_indirect(call_fn_sig, catch_fp, &[iv, cfg, try_table_ip]);
+                            let caught = builder.inst_results(call)[0];
+                            for (i, &label) in pad.catch_labels.iter().enumerate() {
+                                let handler = builder.create_block();
+                                let next = builder.create_block();
+                                let matches = builder.ins().icmp_imm(IntCC::Equal, caught, i as i64);
+                                builder.ins().brif(matches, handler, &[], next, &[]);
+                                builder.switch_to_block(handler);
+                                builder.seal_block(handler);
+                                if label < control_stack.len() {
+                                    let target = &control_stack[control_stack.len() - 1 - label];
+                                    if target.kind == ControlKind::Loop {
+                                        return Err("catch clauses targeting a loop are not supported");
+                                    }
+                                    let target_size = builder.use_var(
+                                        target
+                                            .entry_real_depth_var
+                                            .expect("entry_real_depth_var must be set when vstack is disabled"),
+                                    );
+                                    let arity_val = builder.ins().iconst(types::I32, target.arity as i64);
+                                    let cfg = builder.use_var(config_var);
+                                    let cleanup_fp = builder.ins().func_addr(ptr_type, h_stack_cleanup);
+                                    builder.ins().call_indirect(
+                                        stack_cleanup_sig,
+                                        cleanup_fp,
+                                        &[cfg, target_size, arity_val],
+                                    );
+                                    builder.ins().jump(target.branch_target, &[]);
+                                } else {
+                                    // The function label; the epilogue trims the stack down to the results.
+                                    builder.ins().jump(epilogue_block, &[]);
+                                }
+                                builder.switch_to_block(next);
+                                builder.seal_block(next);
+                            }
+                            builder.ins().jump(pad.outer_trap_target, &[]);
+                        }
+
                         builder.switch_to_block(after);
                         is_unreachable = false;
                         // `after` merges the block body with any branches to it.
@@ -1369,6 +1869,10 @@ impl CraneliftCompiler {
                                     emit_stack_pop!(builder)
                                 };
                                 builder.def_var(stack_vars[entry], result);
+                                if uses_simd && sp > 0 {
+                                    let hi = builder.use_var(stack_vars_hi[sp - 1]);
+                                    builder.def_var(stack_vars_hi[entry], hi);
+                                }
                             }
                         } else {
                             // vstack disabled: trim the real value stack down to the target label's entry depth + arity, preserving the top arity values.
@@ -1396,10 +1900,38 @@ impl CraneliftCompiler {
                     builder.seal_block(dead);
                 }
 
-                op::BR_IF | op::SYNTHETIC_BR_IF_NOSTACK => {
+                op::BR_IF | op::SYNTHETIC_BR_IF_NOSTACK | op::SYNTHETIC_I32_EQZ_BR_IF..=op::SYNTHETIC_I32_GEU_BR_IF => {
                     let label_idx = insn.imm1 as usize;
-                    let cond_raw = read_src!(builder, insn.sources[0]);
-                    let cond = builder.ins().icmp_imm(IntCC::NotEqual, cond_raw, 0);
+                    let cond = match opc {
+                        op::BR_IF | op::SYNTHETIC_BR_IF_NOSTACK => {
+                            let cond_raw = read_src!(builder, insn.sources[0]);
+                            builder.ins().icmp_imm(IntCC::NotEqual, cond_raw, 0)
+                        }
+                        op::SYNTHETIC_I32_EQZ_BR_IF => {
+                            let src_raw = read_src!(builder, insn.sources[0]);
+                            let src = builder.ins().ireduce(types::I32, src_raw);
+                            builder.ins().icmp_imm(IntCC::Equal, src, 0)
+                        }
+                        _ => {
+                            let cc = match opc {
+                                op::SYNTHETIC_I32_EQ_BR_IF => IntCC::Equal,
+                                op::SYNTHETIC_I32_NE_BR_IF => IntCC::NotEqual,
+                                op::SYNTHETIC_I32_LTS_BR_IF => IntCC::SignedLessThan,
+                                op::SYNTHETIC_I32_LTU_BR_IF => IntCC::UnsignedLessThan,
+                                op::SYNTHETIC_I32_GTS_BR_IF => IntCC::SignedGreaterThan,
+                                op::SYNTHETIC_I32_GTU_BR_IF => IntCC::UnsignedGreaterThan,
+                                op::SYNTHETIC_I32_LES_BR_IF => IntCC::SignedLessThanOrEqual,
+                                op::SYNTHETIC_I32_LEU_BR_IF => IntCC::UnsignedLessThanOrEqual,
+                                op::SYNTHETIC_I32_GES_BR_IF => IntCC::SignedGreaterThanOrEqual,
+                                _ => IntCC::UnsignedGreaterThanOrEqual,
+                            };
+                            let rhs_raw = read_src!(builder, insn.sources[0]);
+                            let lhs_raw = read_src!(builder, insn.sources[1]);
+                            let lhs = builder.ins().ireduce(types::I32, lhs_raw);
+                            let rhs = builder.ins().ireduce(types::I32, rhs_raw);
+                            builder.ins().icmp(cc, lhs, rhs)
+                        }
+                    };
 
                     if label_idx < control_stack.len() {
                         let target_idx = control_stack.len() - 1 - label_idx;
@@ -1442,6 +1974,10 @@ impl CraneliftCompiler {
                             if arity > 0 {
                                 let result = builder.use_var(stack_vars[sp - 1]);
                                 builder.def_var(stack_vars[entry], result);
+                                if uses_simd {
+                                    let hi = builder.use_var(stack_vars_hi[sp - 1]);
+                                    builder.def_var(stack_vars_hi[entry], hi);
+                                }
                             }
                             // Note: we don't change sp here since fallthrough needs the original sp.
                             builder.ins().jump(target, &[]);
@@ -1504,7 +2040,14 @@ impl CraneliftCompiler {
                 }
                 op::LOCAL_TEE | op::SYNTHETIC_ARGUMENT_TEE => {
                     let idx = insn.imm1 as usize;
-                    if idx < local_vars.len() && local_is_f64[idx] {
+                    if local_is_v128.get(idx) == Some(&true) {
+                        let val = read_src_v128!(builder, insn.sources[0]);
+                        let lb = builder.use_var(locals_base_var);
+                        builder
+                            .ins()
+                            .store(MemFlags::trusted(), val, lb, (idx as i32) * value_size);
+                        write_dst_v128!(builder, insn.destination, val);
+                    } else if idx < local_vars.len() && local_is_f64[idx] {
                         let val = read_src_f64!(builder, insn.sources[0]);
                         write_local_f64!(builder, insn.imm1, val);
                         write_dst_f64!(builder, insn.destination, val);
@@ -1528,8 +2071,19 @@ impl CraneliftCompiler {
                     local_set!(builder, local_idx, insn.sources[0]);
                 }
                 op::SYNTHETIC_LOCAL_COPY => {
-                    let val = read_local_inline!(builder, insn.imm1);
-                    write_local_inline!(builder, insn.imm2, val);
+                    if local_is_v128.get(insn.imm1 as usize) == Some(&true) {
+                        let lb = builder.use_var(locals_base_var);
+                        let val =
+                            builder
+                                .ins()
+                                .load(types::I64X2, MemFlags::trusted(), lb, (insn.imm1 as i32) * value_size);
+                        builder
+                            .ins()
+                            .store(MemFlags::trusted(), val, lb, (insn.imm2 as i32) * value_size);
+                    } else {
+                        let val = read_local_inline!(builder, insn.imm1);
+                        write_local_inline!(builder, insn.imm2, val);
+                    }
                 }
 
                 op::GLOBAL_GET => {
@@ -1613,6 +2167,10 @@ impl CraneliftCompiler {
                                     emit_stack_pop!(builder)
                                 };
                                 builder.def_var(stack_vars[entry], result);
+                                if uses_simd && sp > 0 {
+                                    let hi = builder.use_var(stack_vars_hi[sp - 1]);
+                                    builder.def_var(stack_vars_hi[entry], hi);
+                                }
                             } else if max_stack_depth == 0 {
                                 let entry_depth_var = frame
                                     .entry_real_depth_var
@@ -2150,6 +2708,91 @@ impl CraneliftCompiler {
                     }
                 }
 
+                op::I32_ATOMIC_LOAD..=op::I64_ATOMIC_LOAD32_U => {
+                    let size = Self::atomic_access_size(opc);
+                    let address = atomic_memory_address!(builder, insn, insn.sources[0], size);
+                    let value = builder
+                        .ins()
+                        .atomic_load(Self::atomic_access_type(size), wasm_memory_flags, address);
+                    let value = if size == 8 {
+                        value
+                    } else {
+                        builder.ins().uextend(types::I64, value)
+                    };
+                    write_dst!(builder, insn.destination, value);
+                }
+
+                op::I32_ATOMIC_STORE..=op::I64_ATOMIC_STORE32 => {
+                    let size = Self::atomic_access_size(opc);
+                    let value = read_src!(builder, insn.sources[0]);
+                    let address = atomic_memory_address!(builder, insn, insn.sources[1], size);
+                    let value = if size == 8 {
+                        value
+                    } else {
+                        builder.ins().ireduce(Self::atomic_access_type(size), value)
+                    };
+                    builder.ins().atomic_store(wasm_memory_flags, value, address);
+                }
+
+                op::I32_ATOMIC_RMW_ADD..=op::I64_ATOMIC_RMW32_XCHG_U => {
+                    let size = Self::atomic_access_size(opc);
+                    let rmw_op = match (opc - op::I32_ATOMIC_RMW_ADD) / 7 {
+                        0 => AtomicRmwOp::Add,
+                        1 => AtomicRmwOp::Sub,
+                        2 => AtomicRmwOp::And,
+                        3 => AtomicRmwOp::Or,
+                        4 => AtomicRmwOp::Xor,
+                        _ => AtomicRmwOp::Xchg,
+                    };
+                    let access_type = Self::atomic_access_type(size);
+                    let operand = read_src!(builder, insn.sources[0]);
+                    let address = atomic_memory_address!(builder, insn, insn.sources[1], size);
+                    let operand = if size == 8 {
+                        operand
+                    } else {
+                        builder.ins().ireduce(access_type, operand)
+                    };
+                    let old_value = builder
+                        .ins()
+                        .atomic_rmw(access_type, wasm_memory_flags, rmw_op, address, operand);
+                    let old_value = if size == 8 {
+                        old_value
+                    } else {
+                        builder.ins().uextend(types::I64, old_value)
+                    };
+                    write_dst!(builder, insn.destination, old_value);
+                }
+
+                op::I32_ATOMIC_RMW_CMPXCHG..=op::I64_ATOMIC_RMW32_CMPXCHG_U => {
+                    let size = Self::atomic_access_size(opc);
+                    let access_type = Self::atomic_access_type(size);
+                    let replacement = read_src!(builder, insn.sources[0]);
+                    let expected = read_src!(builder, insn.sources[1]);
+                    let address = atomic_memory_address!(builder, insn, insn.sources[2], size);
+                    // The narrow variants compare against the expected value wrapped to their width.
+                    let (expected, replacement) = if size == 8 {
+                        (expected, replacement)
+                    } else {
+                        (
+                            builder.ins().ireduce(access_type, expected),
+                            builder.ins().ireduce(access_type, replacement),
+                        )
+                    };
+                    let old_value = builder
+                        .ins()
+                        .atomic_cas(wasm_memory_flags, address, expected, replacement);
+                    let old_value = if size == 8 {
+                        old_value
+                    } else {
+                        builder.ins().uextend(types::I64, old_value)
+                    };
+                    write_dst!(builder, insn.destination, old_value);
+                }
+
+                op::ATOMIC_FENCE => {
+                    builder.ins().fence();
+                }
+
                 op::MEMORY_SIZE => {
                     let mem_idx = builder.ins().iconst(types::I32, insn.imm1);
                     let _xv_config_var = builder.use_var(config_var);
@@ -2218,6 +2861,81 @@ impl CraneliftCompiler {
                     );
                 }
 
+                op::RETURN_CALL if insn.imm2 == 1 => {
+                    // The arguments are on the stack, the last one on top; they become the new parameters.
+                    for i in (0..num_params).rev() {
+                        local_set!(builder, i, STACK_MARKER);
+                    }
+                    zero_non_param_locals!(builder);
+                    let cleanup_fp = builder.ins().func_addr(ptr_type, h_stack_cleanup);
+                    let cfg = builder.use_var(config_var);
+                    let init_size = builder.use_var(initial_stack_size_var);
+                    let no_results = builder.ins().iconst(types::I32, 0);
+                    builder
+                        .ins()
+                        .call_indirect(stack_cleanup_sig, cleanup_fp, &[cfg, init_size, no_results]);
+                    builder.ins().jump(
+                        self_tail_call_target.expect("self_tail_call_target set when there is a self tail call"),
+                        &[],
+                    );
+                    reset_banks!();
+                    sp = 0;
+                    is_unreachable = true;
+                    let dead = builder.create_block();
+                    builder.switch_to_block(dead);
+                    builder.seal_block(dead);
+                }
+
+                op::RETURN_CALL | op::RETURN_CALL_INDIRECT => {
+                    flush_vstack_to_real!(builder);
+                    if opc == op::RETURN_CALL {
+                        let func_idx = builder.ins().iconst(types::I32, insn.imm1);
+                        let cfp = builder.ins().func_addr(ptr_type, h_tail_call);
+                        let iv = builder.use_var(interp_var);
+                        let cv = builder.use_var(config_var);
+                        do_call_and_check!(builder, call_fn_sig, cfp, &[iv, cv, func_idx]);
+                    } else {
+                        let element_index = read_src!(builder, insn.sources[0]);
+                        let element_index = builder.ins().ireduce(types::I32, element_index);
+                        let type_idx = builder.ins().iconst(types::I32, insn.imm1);
+                        let table_idx = builder.ins().iconst(types::I32, insn.imm2);
+                        let cfp = builder.ins().func_addr(ptr_type, h_tail_call_indirect);
+                        let iv = builder.use_var(interp_var);
+                        let cv = builder.use_var(config_var);
+                        do_call_and_check!(
+                            builder,
+                            call_indirect_sig,
+                            cfp,
+                            &[iv, cv, table_idx, type_idx, element_index]
+                        );
+                    }
+                    builder.ins().jump(
+                        tail_call_block.expect("tail_call_block set when there is a tail call"),
+                        &[],
+                    );
+                    sp = 0;
+                    is_unreachable = true;
+                    let dead = builder.create_block();
+                    builder.switch_to_block(dead);
+                    builder.seal_block(dead);
+                }
+
+                op::THROW => {
+                    flush_vstack_to_real!(builder);
+                    let tag_idx = builder.ins().iconst(types::I32, insn.imm1);
+                    let cfp = builder.ins().func_addr(ptr_type, h_throw_exception);
+                    let iv = builder.use_var(interp_var);
+                    let cv = builder.use_var(config_var);
+                    // The helper always leaves the exception as the trap.
+                    builder.ins().call_indirect(call_fn_sig, cfp, &[iv, cv, tag_idx]);
+                    builder.ins().jump(trap_target, &[]);
+                    sp = 0;
+                    is_unreachable = true;
+                    let dead = builder.create_block();
+                    builder.switch_to_block(dead);
+                    builder.seal_block(dead);
+                }
+
                 // For CALL and CALL_INDIRECT, we have no extra information and have to use the interpreter stack for args and returns.
                 op::CALL => {
                     // Flush virtual stack, args are already on it from previous instructions.
@@ -2447,6 +3165,511 @@ impl CraneliftCompiler {
                     }
                 }
 
+                op::V128_CONST => {
+                    let lo = builder.ins().iconst(types::I64, insn.imm1);
+                    let hi = builder.ins().iconst(types::I64, insn.imm2);
+                    let v = builder.ins().scalar_to_vector(types::I64X2, lo);
+                    let result = builder.ins().insertlane(v, hi, 1);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+
+                op::V128_LOAD..=op::V128_LOAD64_SPLAT | op::V128_LOAD32_ZERO | op::V128_LOAD64_ZERO => {
+                    let address = v128_memory_address!(builder, insn, insn.sources[0]);
+                    let result = match opc {
+                        op::V128_LOAD => builder.ins().load(types::I64X2, wasm_memory_flags, address, 0),
+                        op::V128_LOAD8X8_S => builder.ins().sload8x8(wasm_memory_flags, address, 0),
+                        op::V128_LOAD8X8_U => builder.ins().uload8x8(wasm_memory_flags, address, 0),
+                        op::V128_LOAD16X4_S => builder.ins().sload16x4(wasm_memory_flags, address, 0),
+                        op::V128_LOAD16X4_U => builder.ins().uload16x4(wasm_memory_flags, address, 0),
+                        op::V128_LOAD32X2_S => builder.ins().sload32x2(wasm_memory_flags, address, 0),
+                        op::V128_LOAD32X2_U => builder.ins().uload32x2(wasm_memory_flags, address, 0),
+                        op::V128_LOAD8_SPLAT
+                        | op::V128_LOAD16_SPLAT
+                        | op::V128_LOAD32_SPLAT
+                        | op::V128_LOAD64_SPLAT => {
+                            let (ty, lane_ty) = match opc {
+                                op::V128_LOAD8_SPLAT => (types::I8X16, types::I8),
+                                op::V128_LOAD16_SPLAT => (types::I16X8, types::I16),
+                                op::V128_LOAD32_SPLAT => (types::I32X4, types::I32),
+                                _ => (types::I64X2, types::I64),
+                            };
+                            let lane = builder.ins().load(lane_ty, wasm_memory_flags, address, 0);
+                            builder.ins().splat(ty, lane)
+                        }
+                        op::V128_LOAD32_ZERO => {
+                            let lane = builder.ins().load(types::I32, wasm_memory_flags, address, 0);
+                            builder.ins().scalar_to_vector(types::I32X4, lane)
+                        }
+                        op::V128_LOAD64_ZERO => {
+                            let lane = builder.ins().load(types::I64, wasm_memory_flags, address, 0);
+                            builder.ins().scalar_to_vector(types::I64X2, lane)
+                        }
+                        _ => unreachable!(),
+                    };
+                    let result = v128_canonical!(builder, result);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+                op::V128_STORE => {
+                    let val = read_src_v128!(builder, insn.sources[0]);
+                    let address = v128_memory_address!(builder, insn, insn.sources[1]);
+                    builder.ins().store(wasm_memory_flags, val, address, 0);
+                }
+                op::V128_LOAD8_LANE..=op::V128_STORE64_LANE => {
+                    let (ty, lane_ty) = match opc {
+                        op::V128_LOAD8_LANE | op::V128_STORE8_LANE => (types::I8X16, types::I8),
+                        op::V128_LOAD16_LANE | op::V128_STORE16_LANE => (types::I16X8, types::I16),
+                        op::V128_LOAD32_LANE | op::V128_STORE32_LANE => (types::I32X4, types::I32),
+                        _ => (types::I64X2, types::I64),
+                    };
+                    let lane_index = insn.imm2 as u8;
+                    let vector = read_src_v128!(builder, insn.sources[0]);
+                    let address = v128_memory_address!(builder, insn, insn.sources[1]);
+                    let vector = v128_as!(builder, ty, vector);
+                    if opc <= op::V128_LOAD64_LANE {
+                        let lane = builder.ins().load(lane_ty, wasm_memory_flags, address, 0);
+                        let result = builder.ins().insertlane(vector, lane, lane_index);
+                        let result = v128_canonical!(builder, result);
+                        write_dst_v128!(builder, insn.destination, result);
+                    } else {
+                        let lane = builder.ins().extractlane(vector, lane_index);
+                        builder.ins().store(wasm_memory_flags, lane, address, 0);
+                    }
+                }
+
+                op::I8X16_SHUFFLE => {
+                    let rhs = read_src_v128!(builder, insn.sources[0]);
+                    let lhs = read_src_v128!(builder, insn.sources[1]);
+                    let rhs = v128_as!(builder, types::I8X16, rhs);
+                    let lhs = v128_as!(builder, types::I8X16, lhs);
+                    let mut lanes = insn.imm1.to_le_bytes().to_vec();
+                    lanes.extend_from_slice(&insn.imm2.to_le_bytes());
+                    let mask = builder.func.dfg.immediates.push(lanes.into());
+                    let result = builder.ins().shuffle(lhs, rhs, mask);
+                    let result = v128_canonical!(builder, result);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+                op::I8X16_SWIZZLE | op::I8X16_RELAXED_SWIZZLE => v128_binop!(builder, insn, types::I8X16, swizzle),
+
+                op::I8X16_SPLAT => v128_splat!(builder, insn, types::I8X16, types::I8),
+                op::I16X8_SPLAT => v128_splat!(builder, insn, types::I16X8, types::I16),
+                op::I32X4_SPLAT => v128_splat!(builder, insn, types::I32X4, types::I32),
+                op::I64X2_SPLAT => v128_splat!(builder, insn, types::I64X2, types::I64),
+                op::F32X4_SPLAT => {
+                    let lane = read_src_f32!(builder, insn.sources[0]);
+                    let result = builder.ins().splat(types::F32X4, lane);
+                    let result = v128_canonical!(builder, result);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+                op::F64X2_SPLAT => {
+                    let lane = read_src_f64!(builder, insn.sources[0]);
+                    let result = builder.ins().splat(types::F64X2, lane);
+                    let result = v128_canonical!(builder, result);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+
+                op::I8X16_EXTRACT_LANE_S
+                | op::I8X16_EXTRACT_LANE_U
+                | op::I16X8_EXTRACT_LANE_S
+                | op::I16X8_EXTRACT_LANE_U
+                | op::I32X4_EXTRACT_LANE
+                | op::I64X2_EXTRACT_LANE => {
+                    let ty = match opc {
+                        op::I8X16_EXTRACT_LANE_S | op::I8X16_EXTRACT_LANE_U => types::I8X16,
+                        op::I16X8_EXTRACT_LANE_S | op::I16X8_EXTRACT_LANE_U => types::I16X8,
+                        op::I32X4_EXTRACT_LANE => types::I32X4,
+                        _ => types::I64X2,
+                    };
+                    let src = read_src_v128!(builder, insn.sources[0]);
+                    let src = v128_as!(builder, ty, src);
+                    let lane = builder.ins().extractlane(src, insn.imm1 as u8);
+                    let result = match opc {
+                        op::I64X2_EXTRACT_LANE => lane,
+                        op::I8X16_EXTRACT_LANE_U | op::I16X8_EXTRACT_LANE_U => builder.ins().uextend(types::I64, lane),
+                        _ => builder.ins().sextend(types::I64, lane),
+                    };
+                    write_dst!(builder, insn.destination, result);
+                }
+                op::F32X4_EXTRACT_LANE => {
+                    let src = read_src_v128!(builder, insn.sources[0]);
+                    let src = v128_as!(builder, types::F32X4, src);
+                    let result = builder.ins().extractlane(src, insn.imm1 as u8);
+                    write_dst_f32!(builder, insn.destination, result);
+                }
+                op::F64X2_EXTRACT_LANE => {
+                    let src = read_src_v128!(builder, insn.sources[0]);
+                    let src = v128_as!(builder, types::F64X2, src);
+                    let result = builder.ins().extractlane(src, insn.imm1 as u8);
+                    write_dst_f64!(builder, insn.destination, result);
+                }
+                op::I8X16_REPLACE_LANE
+                | op::I16X8_REPLACE_LANE
+                | op::I32X4_REPLACE_LANE
+                | op::I64X2_REPLACE_LANE
+                | op::F32X4_REPLACE_LANE
+                | op::F64X2_REPLACE_LANE => {
+                    let (ty, lane) = match opc {
+                        op::F32X4_REPLACE_LANE => (types::F32X4, read_src_f32!(builder, insn.sources[0])),
+                        op::F64X2_REPLACE_LANE => (types::F64X2, read_src_f64!(builder, insn.sources[0])),
+                        op::I64X2_REPLACE_LANE => (types::I64X2, read_src!(builder, insn.sources[0])),
+                        _ => {
+                            let (ty, lane_ty) = match opc {
+                                op::I8X16_REPLACE_LANE => (types::I8X16, types::I8),
+                                op::I16X8_REPLACE_LANE => (types::I16X8, types::I16),
+                                _ => (types::I32X4, types::I32),
+                            };
+                            let raw = read_src!(builder, insn.sources[0]);
+                            (ty, builder.ins().ireduce(lane_ty, raw))
+                        }
+                    };
+                    let src = read_src_v128!(builder, insn.sources[1]);
+                    let src = v128_as!(builder, ty, src);
+                    let result = builder.ins().insertlane(src, lane, insn.imm1 as u8);
+                    let result = v128_canonical!(builder, result);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+
+                op::I8X16_EQ => v128_icmp!(builder, insn, types::I8X16, IntCC::Equal),
+                op::I8X16_NE => v128_icmp!(builder, insn, types::I8X16, IntCC::NotEqual),
+                op::I8X16_LT_S => v128_icmp!(builder, insn, types::I8X16, IntCC::SignedLessThan),
+                op::I8X16_LT_U => v128_icmp!(builder, insn, types::I8X16, IntCC::UnsignedLessThan),
+                op::I8X16_GT_S => v128_icmp!(builder, insn, types::I8X16, IntCC::SignedGreaterThan),
+                op::I8X16_GT_U => v128_icmp!(builder, insn, types::I8X16, IntCC::UnsignedGreaterThan),
+                op::I8X16_LE_S => v128_icmp!(builder, insn, types::I8X16, IntCC::SignedLessThanOrEqual),
+                op::I8X16_LE_U => v128_icmp!(builder, insn, types::I8X16, IntCC::UnsignedLessThanOrEqual),
+                op::I8X16_GE_S => v128_icmp!(builder, insn, types::I8X16, IntCC::SignedGreaterThanOrEqual),
+                op::I8X16_GE_U => v128_icmp!(builder, insn, types::I8X16, IntCC::UnsignedGreaterThanOrEqual),
+                op::I16X8_EQ => v128_icmp!(builder, insn, types::I16X8, IntCC::Equal),
+                op::I16X8_NE => v128_icmp!(builder, insn, types::I16X8, IntCC::NotEqual),
+                op::I16X8_LT_S => v128_icmp!(builder, insn, types::I16X8, IntCC::SignedLessThan),
+                op::I16X8_LT_U => v128_icmp!(builder, insn, types::I16X8, IntCC::UnsignedLessThan),
+                op::I16X8_GT_S => v128_icmp!(builder, insn, types::I16X8, IntCC::SignedGreaterThan),
+                op::I16X8_GT_U => v128_icmp!(builder, insn, types::I16X8, IntCC::UnsignedGreaterThan),
+                op::I16X8_LE_S => v128_icmp!(builder, insn, types::I16X8, IntCC::SignedLessThanOrEqual),
+                op::I16X8_LE_U => v128_icmp!(builder, insn, types::I16X8, IntCC::UnsignedLessThanOrEqual),
+                op::I16X8_GE_S => v128_icmp!(builder, insn, types::I16X8, IntCC::SignedGreaterThanOrEqual),
+                op::I16X8_GE_U => v128_icmp!(builder, insn, types::I16X8, IntCC::UnsignedGreaterThanOrEqual),
+                op::I32X4_EQ => v128_icmp!(builder, insn, types::I32X4, IntCC::Equal),
+                op::I32X4_NE => v128_icmp!(builder, insn, types::I32X4, IntCC::NotEqual),
+                op::I32X4_LT_S => v128_icmp!(builder, insn, types::I32X4, IntCC::SignedLessThan),
+                op::I32X4_LT_U => v128_icmp!(builder, insn, types::I32X4, IntCC::UnsignedLessThan),
+                op::I32X4_GT_S => v128_icmp!(builder, insn, types::I32X4, IntCC::SignedGreaterThan),
+                op::I32X4_GT_U => v128_icmp!(builder, insn, types::I32X4, IntCC::UnsignedGreaterThan),
+                op::I32X4_LE_S => v128_icmp!(builder, insn, types::I32X4, IntCC::SignedLessThanOrEqual),
+                op::I32X4_LE_U => v128_icmp!(builder, insn, types::I32X4, IntCC::UnsignedLessThanOrEqual),
+                op::I32X4_GE_S => v128_icmp!(builder, insn, types::I32X4, IntCC::SignedGreaterThanOrEqual),
+                op::I32X4_GE_U => v128_icmp!(builder, insn, types::I32X4, IntCC::UnsignedGreaterThanOrEqual),
+                op::I64X2_EQ => v128_icmp!(builder, insn, types::I64X2, IntCC::Equal),
+                op::I64X2_NE => v128_icmp!(builder, insn, types::I64X2, IntCC::NotEqual),
+                op::I64X2_LT_S => v128_icmp!(builder, insn, types::I64X2, IntCC::SignedLessThan),
+                op::I64X2_GT_S => v128_icmp!(builder, insn, types::I64X2, IntCC::SignedGreaterThan),
+                op::I64X2_LE_S => v128_icmp!(builder, insn, types::I64X2, IntCC::SignedLessThanOrEqual),
+                op::I64X2_GE_S => v128_icmp!(builder, insn, types::I64X2, IntCC::SignedGreaterThanOrEqual),
+                op::F32X4_EQ => v128_fcmp!(builder, insn, types::F32X4, FloatCC::Equal),
+                op::F32X4_NE => v128_fcmp!(builder, insn, types::F32X4, FloatCC::NotEqual),
+                op::F32X4_LT => v128_fcmp!(builder, insn, types::F32X4, FloatCC::LessThan),
+                op::F32X4_GT => v128_fcmp!(builder, insn, types::F32X4, FloatCC::GreaterThan),
+                op::F32X4_LE => v128_fcmp!(builder, insn, types::F32X4, FloatCC::LessThanOrEqual),
+                op::F32X4_GE => v128_fcmp!(builder, insn, types::F32X4, FloatCC::GreaterThanOrEqual),
+                op::F64X2_EQ => v128_fcmp!(builder, insn, types::F64X2, FloatCC::Equal),
+                op::F64X2_NE => v128_fcmp!(builder, insn, types::F64X2, FloatCC::NotEqual),
+                op::F64X2_LT => v128_fcmp!(builder, insn, types::F64X2, FloatCC::LessThan),
+                op::F64X2_GT => v128_fcmp!(builder, insn, types::F64X2, FloatCC::GreaterThan),
+                op::F64X2_LE => v128_fcmp!(builder, insn, types::F64X2, FloatCC::LessThanOrEqual),
+                op::F64X2_GE => v128_fcmp!(builder, insn, types::F64X2, FloatCC::GreaterThanOrEqual),
+
+                op::V128_NOT => v128_unop!(builder, insn, types::I64X2, bnot),
+                op::V128_AND => v128_binop!(builder, insn, types::I64X2, band),
+                op::V128_ANDNOT => v128_binop!(builder, insn, types::I64X2, band_not),
+                op::V128_OR => v128_binop!(builder, insn, types::I64X2, bor),
+                op::V128_XOR => v128_binop!(builder, insn, types::I64X2, bxor),
+                op::V128_BITSELECT
+                | op::I8X16_RELAXED_LANESELECT
+                | op::I16X8_RELAXED_LANESELECT
+                | op::I32X4_RELAXED_LANESELECT
+                | op::I64X2_RELAXED_LANESELECT => {
+                    let mask = read_src_v128!(builder, insn.sources[0]);
+                    let if_false = read_src_v128!(builder, insn.sources[1]);
+                    let if_true = read_src_v128!(builder, insn.sources[2]);
+                    let result = builder.ins().bitselect(mask, if_true, if_false);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+                op::V128_ANY_TRUE => v128_to_i32!(builder, insn, types::I64X2, vany_true),
+                op::I8X16_ALL_TRUE => v128_to_i32!(builder, insn, types::I8X16, vall_true),
+                op::I16X8_ALL_TRUE => v128_to_i32!(builder, insn, types::I16X8, vall_true),
+                op::I32X4_ALL_TRUE => v128_to_i32!(builder, insn, types::I32X4, vall_true),
+                op::I64X2_ALL_TRUE => v128_to_i32!(builder, insn, types::I64X2, vall_true),
+                op::I8X16_BITMASK | op::I16X8_BITMASK | op::I32X4_BITMASK | op::I64X2_BITMASK => {
+                    let ty = match opc {
+                        op::I8X16_BITMASK => types::I8X16,
+                        op::I16X8_BITMASK => types::I16X8,
+                        op::I32X4_BITMASK => types::I32X4,
+                        _ => types::I64X2,
+                    };
+                    let src = read_src_v128!(builder, insn.sources[0]);
+                    let src = v128_as!(builder, ty, src);
+                    let result = builder.ins().vhigh_bits(types::I32, src);
+                    let result = builder.ins().uextend(types::I64, result);
+                    write_dst!(builder, insn.destination, result);
+                }
+
+                op::I8X16_ABS => v128_unop!(builder, insn, types::I8X16, iabs),
+                op::I8X16_NEG => v128_unop!(builder, insn, types::I8X16, ineg),
+                op::I8X16_POPCNT => v128_unop!(builder, insn, types::I8X16, popcnt),
+                op::I8X16_NARROW_I16X8_S => v128_binop!(builder, insn, types::I16X8, snarrow),
+                op::I8X16_NARROW_I16X8_U => v128_binop!(builder, insn, types::I16X8, unarrow),
+                op::I8X16_SHL => v128_shift!(builder, insn, types::I8X16, ishl),
+                op::I8X16_SHR_S => v128_shift!(builder, insn, types::I8X16, sshr),
+                op::I8X16_SHR_U => v128_shift!(builder, insn, types::I8X16, ushr),
+                op::I8X16_ADD => v128_binop!(builder, insn, types::I8X16, iadd),
+                op::I8X16_ADD_SAT_S => v128_binop!(builder, insn, types::I8X16, sadd_sat),
+                op::I8X16_ADD_SAT_U => v128_binop!(builder, insn, types::I8X16, uadd_sat),
+                op::I8X16_SUB => v128_binop!(builder, insn, types::I8X16, isub),
+                op::I8X16_SUB_SAT_S => v128_binop!(builder, insn, types::I8X16, ssub_sat),
+                op::I8X16_SUB_SAT_U => v128_binop!(builder, insn, types::I8X16, usub_sat),
+                op::I8X16_MIN_S => v128_binop!(builder, insn, types::I8X16, smin),
+                op::I8X16_MIN_U => v128_binop!(builder, insn, types::I8X16, umin),
+                op::I8X16_MAX_S => v128_binop!(builder, insn, types::I8X16, smax),
+                op::I8X16_MAX_U => v128_binop!(builder, insn, types::I8X16, umax),
+                op::I8X16_AVGR_U => v128_binop!(builder, insn, types::I8X16, avg_round),
+
+                op::I16X8_EXTADD_PAIRWISE_I8X16_S => {
+                    v128_extadd_pairwise!(builder, insn, types::I8X16, swiden_low, swiden_high)
+                }
+                op::I16X8_EXTADD_PAIRWISE_I8X16_U => {
+                    v128_extadd_pairwise!(builder, insn, types::I8X16, uwiden_low, uwiden_high)
+                }
+                op::I32X4_EXTADD_PAIRWISE_I16X8_S => {
+                    v128_extadd_pairwise!(builder, insn, types::I16X8, swiden_low, swiden_high)
+                }
+                op::I32X4_EXTADD_PAIRWISE_I16X8_U => {
+                    v128_extadd_pairwise!(builder, insn, types::I16X8, uwiden_low, uwiden_high)
+                }
+                op::I16X8_ABS => v128_unop!(builder, insn, types::I16X8, iabs),
+                op::I16X8_NEG => v128_unop!(builder, insn, types::I16X8, ineg),
+                op::I16X8_Q15MULR_SAT_S | op::I16X8_RELAXED_Q15MULR_S => {
+                    v128_binop!(builder, insn, types::I16X8, sqmul_round_sat)
+                }
+                op::I16X8_NARROW_I32X4_S => v128_binop!(builder, insn, types::I32X4, snarrow),
+                op::I16X8_NARROW_I32X4_U => v128_binop!(builder, insn, types::I32X4, unarrow),
+                op::I16X8_EXTEND_LOW_I8X16_S => v128_unop!(builder, insn, types::I8X16, swiden_low),
+                op::I16X8_EXTEND_HIGH_I8X16_S => v128_unop!(builder, insn, types::I8X16, swiden_high),
+                op::I16X8_EXTEND_LOW_I8X16_U => v128_unop!(builder, insn, types::I8X16, uwiden_low),
+                op::I16X8_EXTEND_HIGH_I8X16_U => v128_unop!(builder, insn, types::I8X16, uwiden_high),
+                op::I16X8_SHL => v128_shift!(builder, insn, types::I16X8, ishl),
+                op::I16X8_SHR_S => v128_shift!(builder, insn, types::I16X8, sshr),
+                op::I16X8_SHR_U => v128_shift!(builder, insn, types::I16X8, ushr),
+                op::I16X8_ADD => v128_binop!(builder, insn, types::I16X8, iadd),
+                op::I16X8_ADD_SAT_S => v128_binop!(builder, insn, types::I16X8, sadd_sat),
+                op::I16X8_ADD_SAT_U => v128_binop!(builder, insn, types::I16X8, uadd_sat),
+                op::I16X8_SUB => v128_binop!(builder, insn, types::I16X8, isub),
+                op::I16X8_SUB_SAT_S => v128_binop!(builder, insn, types::I16X8, ssub_sat),
+                op::I16X8_SUB_SAT_U => v128_binop!(builder, insn, types::I16X8, usub_sat),
+                op::I16X8_MUL => v128_binop!(builder, insn, types::I16X8, imul),
+                op::I16X8_MIN_S => v128_binop!(builder, insn, types::I16X8, smin),
+                op::I16X8_MIN_U => v128_binop!(builder, insn, types::I16X8, umin),
+                op::I16X8_MAX_S => v128_binop!(builder, insn, types::I16X8, smax),
+                op::I16X8_MAX_U => v128_binop!(builder, insn, types::I16X8, umax),
+                op::I16X8_AVGR_U => v128_binop!(builder, insn, types::I16X8, avg_round),
+                op::I16X8_EXTMUL_LOW_I8X16_S => v128_extmul!(builder, insn, types::I8X16, swiden_low),
+                op::I16X8_EXTMUL_HIGH_I8X16_S => v128_extmul!(builder, insn, types::I8X16, swiden_high),
+                op::I16X8_EXTMUL_LOW_I8X16_U => v128_extmul!(builder, insn, types::I8X16, uwiden_low),
+                op::I16X8_EXTMUL_HIGH_I8X16_U => v128_extmul!(builder, insn, types::I8X16, uwiden_high),
+
+                op::I32X4_ABS => v128_unop!(builder, insn, types::I32X4, iabs),
+                op::I32X4_NEG => v128_unop!(builder, insn, types::I32X4, ineg),
+                op::I32X4_EXTEND_LOW_I16X8_S => v128_unop!(builder, insn, types::I16X8, swiden_low),
+                op::I32X4_EXTEND_HIGH_I16X8_S => v128_unop!(builder, insn, types::I16X8, swiden_high),
+                op::I32X4_EXTEND_LOW_I16X8_U => v128_unop!(builder, insn, types::I16X8, uwiden_low),
+                op::I32X4_EXTEND_HIGH_I16X8_U => v128_unop!(builder, insn, types::I16X8, uwiden_high),
+                op::I32X4_SHL => v128_shift!(builder, insn, types::I32X4, ishl),
+                op::I32X4_SHR_S => v128_shift!(builder, insn, types::I32X4, sshr),
+                op::I32X4_SHR_U => v128_shift!(builder, insn, types::I32X4, ushr),
+                op::I32X4_ADD => v128_binop!(builder, insn, types::I32X4, iadd),
+                op::I32X4_SUB => v128_binop!(builder, insn, types::I32X4, isub),
+                op::I32X4_MUL => v128_binop!(builder, insn, types::I32X4, imul),
+                op::I32X4_MIN_S => v128_binop!(builder, insn, types::I32X4, smin),
+                op::I32X4_MIN_U => v128_binop!(builder, insn, types::I32X4, umin),
+                op::I32X4_MAX_S => v128_binop!(builder, insn, types::I32X4, smax),
+                op::I32X4_MAX_U => v128_binop!(builder, insn, types::I32X4, umax),
+                op::I32X4_DOT_I16X8_S | op::I16X8_RELAXED_DOT_I8X16_I7X16_S => {
+                    let ty = if opc == op::I32X4_DOT_I16X8_S {
+                        types::I16X8
+                    } else {
+                        types::I8X16
+                    };
+                    let rhs = read_src_v128!(builder, insn.sources[0]);
+                    let lhs = read_src_v128!(builder, insn.sources[1]);
+                    let result = v128_dot!(builder, lhs, rhs, ty);
+                    let result = v128_canonical!(builder, result);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+                op::I32X4_EXTMUL_LOW_I16X8_S => v128_extmul!(builder, insn, types::I16X8, swiden_low),
+                op::I32X4_EXTMUL_HIGH_I16X8_S => v128_extmul!(builder, insn, types::I16X8, swiden_high),
+                op::I32X4_EXTMUL_LOW_I16X8_U => v128_extmul!(builder, insn, types::I16X8, uwiden_low),
+                op::I32X4_EXTMUL_HIGH_I16X8_U => v128_extmul!(builder, insn, types::I16X8, uwiden_high),
+
+                op::I64X2_ABS => v128_unop!(builder, insn, types::I64X2, iabs),
+                op::I64X2_NEG => v128_unop!(builder, insn, types::I64X2, ineg),
+                op::I64X2_EXTEND_LOW_I32X4_S => v128_unop!(builder, insn, types::I32X4, swiden_low),
+                op::I64X2_EXTEND_HIGH_I32X4_S => v128_unop!(builder, insn, types::I32X4, swiden_high),
+                op::I64X2_EXTEND_LOW_I32X4_U => v128_unop!(builder, insn, types::I32X4, uwiden_low),
+                op::I64X2_EXTEND_HIGH_I32X4_U => v128_unop!(builder, insn, types::I32X4, uwiden_high),
+                op::I64X2_SHL => v128_shift!(builder, insn, types::I64X2, ishl),
+                op::I64X2_SHR_S => v128_shift!(builder, insn, types::I64X2, sshr),
+                op::I64X2_SHR_U => v128_shift!(builder, insn, types::I64X2, ushr),
+                op::I64X2_ADD => v128_binop!(builder, insn, types::I64X2, iadd),
+                op::I64X2_SUB => v128_binop!(builder, insn, types::I64X2, isub),
+                op::I64X2_MUL => v128_binop!(builder, insn, types::I64X2, imul),
+                op::I64X2_EXTMUL_LOW_I32X4_S => v128_extmul!(builder, insn, types::I32X4, swiden_low),
+                op::I64X2_EXTMUL_HIGH_I32X4_S => v128_extmul!(builder, insn, types::I32X4, swiden_high),
+                op::I64X2_EXTMUL_LOW_I32X4_U => v128_extmul!(builder, insn, types::I32X4, uwiden_low),
+                op::I64X2_EXTMUL_HIGH_I32X4_U => v128_extmul!(builder, insn, types::I32X4, uwiden_high),
+
+                op::F32X4_CEIL => v128_unop!(builder, insn, types::F32X4, ceil),
+                op::F32X4_FLOOR => v128_unop!(builder, insn, types::F32X4, floor),
+                op::F32X4_TRUNC => v128_unop!(builder, insn, types::F32X4, trunc),
+                op::F32X4_NEAREST => v128_unop!(builder, insn, types::F32X4, nearest),
+                op::F32X4_ABS => v128_unop!(builder, insn, types::F32X4, fabs),
+                op::F32X4_NEG => v128_unop!(builder, insn, types::F32X4, fneg),
+                op::F32X4_SQRT => v128_unop!(builder, insn, types::F32X4, sqrt),
+                op::F32X4_ADD => v128_binop!(builder, insn, types::F32X4, fadd),
+                op::F32X4_SUB => v128_binop!(builder, insn, types::F32X4, fsub),
+                op::F32X4_MUL => v128_binop!(builder, insn, types::F32X4, fmul),
+                op::F32X4_DIV => v128_binop!(builder, insn, types::F32X4, fdiv),
+                // Cranelift's fmin/fmax propagate NaNs and order -0 before +0, as wasm's min/max do.
+                op::F32X4_MIN | op::F32X4_RELAXED_MIN => v128_binop!(builder, insn, types::F32X4, fmin),
+                op::F32X4_MAX | op::F32X4_RELAXED_MAX => v128_binop!(builder, insn, types::F32X4, fmax),
+                op::F64X2_CEIL => v128_unop!(builder, insn, types::F64X2, ceil),
+                op::F64X2_FLOOR => v128_unop!(builder, insn, types::F64X2, floor),
+                op::F64X2_TRUNC => v128_unop!(builder, insn, types::F64X2, trunc),
+                op::F64X2_NEAREST => v128_unop!(builder, insn, types::F64X2, nearest),
+                op::F64X2_ABS => v128_unop!(builder, insn, types::F64X2, fabs),
+                op::F64X2_NEG => v128_unop!(builder, insn, types::F64X2, fneg),
+                op::F64X2_SQRT => v128_unop!(builder, insn, types::F64X2, sqrt),
+                op::F64X2_ADD => v128_binop!(builder, insn, types::F64X2, fadd),
+                op::F64X2_SUB => v128_binop!(builder, insn, types::F64X2, fsub),
+                op::F64X2_MUL => v128_binop!(builder, insn, types::F64X2, fmul),
+                op::F64X2_DIV => v128_binop!(builder, insn, types::F64X2, fdiv),
+                op::F64X2_MIN | op::F64X2_RELAXED_MIN => v128_binop!(builder, insn, types::F64X2, fmin),
+                op::F64X2_MAX | op::F64X2_RELAXED_MAX => v128_binop!(builder, insn, types::F64X2, fmax),
+                op::F32X4_PMIN | op::F32X4_PMAX | op::F64X2_PMIN | op::F64X2_PMAX => {
+                    let ty = if matches!(opc, op::F32X4_PMIN | op::F32X4_PMAX) {
+                        types::F32X4
+                    } else {
+                        types::F64X2
+                    };
+                    let rhs = read_src_v128!(builder, insn.sources[0]);
+                    let lhs = read_src_v128!(builder, insn.sources[1]);
+                    let rhs_lanes = v128_as!(builder, ty, rhs);
+                    let lhs_lanes = v128_as!(builder, ty, lhs);
+                    // pmin is `rhs < lhs ? rhs : lhs`, pmax is `lhs < rhs ? rhs : lhs`.
+                    let mask = if matches!(opc, op::F32X4_PMIN | op::F64X2_PMIN) {
+                        builder.ins().fcmp(FloatCC::LessThan, rhs_lanes, lhs_lanes)
+                    } else {
+                        builder.ins().fcmp(FloatCC::LessThan, lhs_lanes, rhs_lanes)
+                    };
+                    let mask = v128_canonical!(builder, mask);
+                    let result = builder.ins().bitselect(mask, rhs, lhs);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+
+                op::I32X4_TRUNC_SAT_F32X4_S | op::I32X4_RELAXED_TRUNC_F32X4_S => {
+                    let src = read_src_v128!(builder, insn.sources[0]);
+                    let src = v128_as!(builder, types::F32X4, src);
+                    let result = builder.ins().fcvt_to_sint_sat(types::I32X4, src);
+                    let result = v128_canonical!(builder, result);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+                op::I32X4_TRUNC_SAT_F32X4_U | op::I32X4_RELAXED_TRUNC_F32X4_U => {
+                    let src = read_src_v128!(builder, insn.sources[0]);
+                    let src = v128_as!(builder, types::F32X4, src);
+                    let result = builder.ins().fcvt_to_uint_sat(types::I32X4, src);
+                    let result = v128_canonical!(builder, result);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+                op::I32X4_TRUNC_SAT_F64X2_S_ZERO
+                | op::I32X4_TRUNC_SAT_F64X2_U_ZERO
+                | op::I32X4_RELAXED_TRUNC_F64X2_S_ZERO
+                | op::I32X4_RELAXED_TRUNC_F64X2_U_ZERO => {
+                    let src = read_src_v128!(builder, insn.sources[0]);
+                    let src = v128_as!(builder, types::F64X2, src);
+                    let zero = builder.ins().splat(types::I64X2, zero_hi);
+                    let result = if matches!(
+                        opc,
+                        op::I32X4_TRUNC_SAT_F64X2_S_ZERO | op::I32X4_RELAXED_TRUNC_F64X2_S_ZERO
+                    ) {
+                        let wide = builder.ins().fcvt_to_sint_sat(types::I64X2, src);
+                        builder.ins().snarrow(wide, zero)
+                    } else {
+                        let wide = builder.ins().fcvt_to_uint_sat(types::I64X2, src);
+                        builder.ins().uunarrow(wide, zero)
+                    };
+                    let result = v128_canonical!(builder, result);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+                op::F32X4_CONVERT_I32X4_S | op::F32X4_CONVERT_I32X4_U => {
+                    let src = read_src_v128!(builder, insn.sources[0]);
+                    let src = v128_as!(builder, types::I32X4, src);
+                    let result = if opc == op::F32X4_CONVERT_I32X4_S {
+                        builder.ins().fcvt_from_sint(types::F32X4, src)
+                    } else {
+                        builder.ins().fcvt_from_uint(types::F32X4, src)
+                    };
+                    let result = v128_canonical!(builder, result);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+                op::F64X2_CONVERT_LOW_I32X4_S | op::F64X2_CONVERT_LOW_I32X4_U => {
+                    let src = read_src_v128!(builder, insn.sources[0]);
+                    let src = v128_as!(builder, types::I32X4, src);
+                    let result = if opc == op::F64X2_CONVERT_LOW_I32X4_S {
+                        let wide = builder.ins().swiden_low(src);
+                        builder.ins().fcvt_from_sint(types::F64X2, wide)
+                    } else {
+                        let wide = builder.ins().uwiden_low(src);
+                        builder.ins().fcvt_from_uint(types::F64X2, wide)
+                    };
+                    let result = v128_canonical!(builder, result);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+                op::F32X4_DEMOTE_F64X2_ZERO => v128_unop!(builder, insn, types::F64X2, fvdemote),
+                op::F64X2_PROMOTE_LOW_F32X4 => v128_unop!(builder, insn, types::F32X4, fvpromote_low),
+
+                // These update their last operand in place rather than writing to a destination.
+                op::F32X4_RELAXED_MADD | op::F32X4_RELAXED_NMADD | op::F64X2_RELAXED_MADD | op::F64X2_RELAXED_NMADD => {
+                    let ty = if matches!(opc, op::F32X4_RELAXED_MADD | op::F32X4_RELAXED_NMADD) {
+                        types::F32X4
+                    } else {
+                        types::F64X2
+                    };
+                    let addend = read_src_v128!(builder, insn.sources[0]);
+                    let lhs = read_src_v128!(builder, insn.sources[1]);
+                    let rhs = read_src_v128!(builder, insn.sources[2]);
+                    let addend = v128_as!(builder, ty, addend);
+                    let lhs = v128_as!(builder, ty, lhs);
+                    let rhs = v128_as!(builder, ty, rhs);
+                    let product = builder.ins().fmul(lhs, rhs);
+                    let result = if matches!(opc, op::F32X4_RELAXED_MADD | op::F64X2_RELAXED_MADD) {
+                        builder.ins().fadd(product, addend)
+                    } else {
+                        builder.ins().fsub(addend, product)
+                    };
+                    let result = v128_canonical!(builder, result);
+                    write_dst_v128!(builder, insn.sources[2], result);
+                }
+                op::I32X4_RELAXED_DOT_I8X16_I7X16_ADD_S => {
+                    let addend = read_src_v128!(builder, insn.sources[0]);
+                    let rhs = read_src_v128!(builder, insn.sources[1]);
+                    let lhs = read_src_v128!(builder, insn.sources[2]);
+                    let dot = v128_dot!(builder, lhs, rhs, types::I8X16);
+                    let low = builder.ins().swiden_low(dot);
+                    let high = builder.ins().swiden_high(dot);
+                    let sums = builder.ins().iadd_pairwise(low, high);
+                    let addend = v128_as!(builder, types::I32X4, addend);
+                    let result = builder.ins().iadd(sums, addend);
+                    let result = v128_canonical!(builder, result);
+                    write_dst_v128!(builder, insn.sources[2], result);
+                }
+
                 op::SYNTHETIC_TIER_UP => {
                     if let Some(tail) = tier_up_dispatch_tail {
                         let header = control_stack
@@ -2486,6 +3709,8 @@ impl CraneliftCompiler {
             builder.ins().jump(body_start, &[]);
             builder.seal_block(tail);
             builder.seal_block(body_start);
+        } else if let Some(body_start) = self_tail_call_target {
+            builder.seal_block(body_start);
         }
 
         builder.switch_to_block(trap_block);
@@ -2494,6 +3719,30 @@ impl CraneliftCompiler {
         let trap_ret = builder.ins().iconst(types::I64, outcome_return_value as i64);
         builder.ins().return_(&[trap_ret]);
 
+        if let Some(tail_call_block) = tail_call_block {
+            builder.switch_to_block(tail_call_block);
+            builder.seal_block(tail_call_block);
+            // The callee replaces this frame, so only the stack needs trimming; the locals are dead.
+            let cleanup_fp = builder.ins().func_addr(ptr_type, h_stack_cleanup);
+            let cfg = builder.use_var(config_var);
+            let init_size = builder.use_var(initial_stack_size_var);
+            let no_results = builder.ins().iconst(types::I32, 0);
+            builder
+                .ins()
+                .call_indirect(stack_cleanup_sig, cleanup_fp, &[cfg, init_size, no_results]);
+            Self::sync_regs_to_config(
+                &mut builder,
+                &reg_vars,
+                &reg_vars_hi,
+                config_var,
+                regs_offset,
+                value_size,
+                &dirty_regs,
+            );
+            let ret_val = builder.ins().iconst(types::I64, outcome_return_value as i64);
+            builder.ins().return_(&[ret_val]);
+        }
+
         builder.switch_to_block(epilogue_block);
         builder.seal_block(epilogue_block);
         // Clean up excess values on the real stack (e.g. from BR out of nested blocks); nothing to touch if we have vstack info.
@@ -2509,6 +3758,7 @@ impl CraneliftCompiler {
         Self::sync_regs_to_config(
             &mut builder,
             &reg_vars,
+            &reg_vars_hi,
             config_var,
             regs_offset,
             value_size,
@@ -2588,6 +3838,10 @@ impl CraneliftCompiler {
                 | op::BR_TABLE
                 | op::RETURN
                 | op::CALL
+                | op::RETURN_CALL
+                | op::RETURN_CALL_INDIRECT
+                | op::THROW
+                | op::TRY_TABLE
                 | op::DROP
                 | op::SELECT
                 | op::SELECT_TYPED
@@ -2635,12 +3889,36 @@ impl CraneliftCompiler {
                 | op::SYNTHETIC_I64_ADD2LOCAL..=op::SYNTHETIC_LOCAL_SETI64_CONST
                 | op::SYNTHETIC_BR_TABLE_CONT
                 | op::SYNTHETIC_TIER_UP
+                | op::SYNTHETIC_I32_EQZ_BR_IF..=op::SYNTHETIC_I32_GEU_BR_IF
+                | op::V128_LOAD..=op::I32X4_RELAXED_DOT_I8X16_I7X16_ADD_S
+                | op::ATOMIC_FENCE
+                | op::I32_ATOMIC_LOAD..=op::I64_ATOMIC_RMW32_CMPXCHG_U
         )
     }
 
+    // Every group of atomic memory instructions lists the same seven access widths, in the same order.
+    fn atomic_access_size(opc: u64) -> i64 {
+        const SIZES: [i64; 7] = [4, 8, 1, 2, 1, 2, 4];
+        SIZES[((opc - op::I32_ATOMIC_LOAD) % 7) as usize]
+    }
+
+    fn atomic_access_type(size: i64) -> Type {
+        match size {
+            1 => types::I8,
+            2 => types::I16,
+            4 => types::I32,
+            _ => types::I64,
+        }
+    }
+
+    fn is_simd(opc: u64) -> bool {
+        (op::V128_LOAD..=op::I32X4_RELAXED_DOT_I8X16_I7X16_ADD_S).contains(&opc)
+    }
+
     fn sync_regs_to_config(
         builder: &mut FunctionBuilder,
         reg_vars: &[Variable; REG_COUNT],
+        reg_vars_hi: &[Variable],
         config_var: Variable,
         regs_offset: i32,
         value_size: i32,
@@ -2654,8 +3932,11 @@ impl CraneliftCompiler {
             let val = builder.use_var(reg_vars[i]);
             let offset = regs_offset + (i as i32) * value_size;
             builder.ins().store(MemFlags::trusted(), val, config, offset);
-            let zero = builder.ins().iconst(types::I64, 0);
-            builder.ins().store(MemFlags::trusted(), zero, config, offset + 8);
+            let hi = match reg_vars_hi.get(i) {
+                Some(var) => builder.use_var(*var),
+                None => builder.ins().iconst(types::I64, 0),
+            };
+            builder.ins().store(MemFlags::trusted(), hi, config, offset + 8);
         }
     }
 }
@@ -81,6 +81,14 @@ pub struct RuntimeHelpers {
     pub memory_fill: usize,
     // Address of the process-global primitive storage cage base.
     pub primitive_storage_cage_base: usize,
+    // i32 fn(interp, config, func_index); leaves a tail call for the caller of the compiled function to make
+    pub tail_call: usize,
+    // i32 fn(interp, config, table_idx, type_idx, element_index)
+    pub tail_call_indirect: usize,
+    // i32 fn(interp, config, tag_index); always returns 1
+    pub throw_exception: usize,
+    // i32 fn(interp, config, try_table_ip); returns the index of the matching catch, or -1
+    pub catch_exception: usize,
 
     pub regs_offset: u32,
     pub value_size: u32,
@@ -132,9 +140,13 @@ pub enum HelperId {
     memory_copy = 29,
     memory_fill = 30,
     primitive_storage_cage_base = 31,
+    tail_call = 32,
+    tail_call_indirect = 33,
+    throw_exception = 34,
+    catch_exception = 35,
 }
 
-pub const HELPER_COUNT: u32 = 32;
+pub const HELPER_COUNT: u32 = 36;
 
 /// One relocation slot in the generated machine code. `code_offset` is the byte offset
 /// from the start of the function where 8 contiguous bytes hold the absolute helper
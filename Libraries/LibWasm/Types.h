@@ -16,6 +16,7 @@
 #include <AK/NumericLimits.h>
 #include <AK/Optional.h>
 #include <AK/OwnPtr.h>
+#include <AK/RefCounted.h>
 #include <AK/Result.h>
 #include <AK/String.h>
 #include <AK/Time.h>
@@ -432,8 +433,15 @@ enum class AddressType : u8 {
 // https://webassembly.github.io/spec/core/bikeshed/#limits%E2%91%A5
 class Limits {
 public:
-    explicit Limits(AddressType address_type, u64 min, Optional<u64> max = {})
+    // https://webassembly.github.io/threads/core/syntax/types.html#memory-types
+    enum class Shared : u8 {
+        No,
+        Yes,
+    };
+
+    explicit Limits(AddressType address_type, u64 min, Optional<u64> max = {}, Shared shared = Shared::No)
         : m_address_type(address_type)
+        , m_shared(shared)
         , m_min(min)
         , m_max(move(max))
     {
@@ -446,17 +454,21 @@ public:
     auto address_type() const { return m_address_type; }
     auto min() const { return m_min; }
     auto& max() const { return m_max; }
+    bool is_shared() const { return m_shared == Shared::Yes; }
+    auto shared() const { return m_shared; }
     bool is_subset_of(Limits other) const
     {
         return m_min >= other.min()
             && (!other.max().has_value() || (m_max.has_value() && *m_max <= *other.max()))
-            && m_address_type == other.m_address_type;
+            && m_address_type == other.m_address_type
+            && m_shared == other.m_shared;
     }
 
     static ParseResult<Limits> parse(ConstrainedStream& stream);
 
 private:
     AddressType m_address_type { AddressType::I32 };
+    Shared m_shared { Shared::No };
     u64 m_min { 0 };
     Optional<u64> m_max;
 };
@@ -1271,12 +1283,18 @@ public:
     void set_frame_usage_hint(size_t value) const { m_frame_usage_hint = value; }
     auto frame_usage_hint() const { return m_frame_usage_hint; }
 
+    // Function bodies of lazily validated modules need to be validated before they may run, and before anything else
+    // about them (like the compiled instructions) may be used. Validation may happen on another thread.
+    bool needs_validation() const { return AK::atomic_load(&m_needs_validation, AK::MemoryOrder::memory_order_acquire); }
+    void set_needs_validation(bool value) const { AK::atomic_store(&m_needs_validation, value, AK::MemoryOrder::memory_order_release); }
+
     mutable CompiledInstructions compiled_instructions;
 
 private:
     Vector<Instruction> m_instructions;
     mutable Optional<size_t> m_stack_usage_hint;
     mutable Optional<size_t> m_frame_usage_hint;
+    mutable bool m_needs_validation { false };
 };
 
 class TableSection {
@@ -1646,6 +1664,13 @@ enum class CompileToNative : u8 {
     Yes,
 };
 
+// Lazily validated modules only have their function bodies validated (and compiled) when they are first called, or
+// when the rest of the module is validated in the background.
+enum class ValidationMode : u8 {
+    Eager,
+    Lazy,
+};
+
 // Lightweight per-module compile stats accumulator. Exposed to embedders via record_module_stats() below.
 // The cranelift_* and cache_hit fields are filled in by compile_module_to_native() once native compilation actually runs (possibly on another thread).
 struct ModuleStats {
@@ -1685,6 +1710,7 @@ public:
     static constexpr Array<u8, 4> wasm_version { 1, 0, 0, 0 };
 
     Module() = default;
+    ~Module();
 
     auto& custom_sections() { return m_custom_sections; }
     auto& custom_sections() const { return m_custom_sections; }
@@ -1719,6 +1745,9 @@ public:
     ValidationStatus validation_status() const { return m_validation_status; }
     StringView validation_error() const LIFETIME_BOUND { return *m_validation_error; }
     void set_validation_error(ByteString error) { m_validation_error = move(error); }
+    // Only set for lazily validated modules, and kept for the module's lifetime once set.
+    LazyFunctionValidation* lazy_function_validation() const { return m_lazy_function_validation.ptr(); }
+    void set_lazy_function_validation(NonnullOwnPtr<LazyFunctionValidation>, Badge<Validator>);
     bool has_attempted_cranelift_compilation() const { return m_cranelift_compilation_state.load(AK::MemoryOrder::memory_order_acquire) == 2; }
     bool try_begin_cranelift_compilation() const
     {
@@ -1761,6 +1790,8 @@ public:
     void set_canonical_types(Vector<DefinedType const*> types) { m_canonical_types = move(types); }
 
 private:
+    friend class StreamingModuleParser;
+
     void set_validation_status(ValidationStatus status) { m_validation_status = status; }
     void preprocess();
 
@@ -1781,6 +1812,7 @@ private:
 
     ValidationStatus m_validation_status { ValidationStatus::Unchecked };
     Optional<ByteString> m_validation_error;
+    OwnPtr<LazyFunctionValidation> m_lazy_function_validation;
     mutable Atomic<u8> m_cranelift_compilation_state { 0 };
     mutable Sync::Mutex m_cranelift_compilation_mutex;
     mutable Sync::ConditionVariable m_cranelift_compilation_state_changed { m_cranelift_compilation_mutex };
@@ -1792,6 +1824,46 @@ private:
     size_t m_minimum_call_record_allocation_size { 0 };
 };
 
+// Parses a module from its bytes as they arrive, e.g. over the network. Each section is parsed as soon as all of its
+// bytes are available, except for the code section, whose function bodies are parsed one at a time instead. Once an
+// error has been returned, every further call returns it again.
+class WASM_API StreamingModuleParser : public RefCounted<StreamingModuleParser> {
+public:
+    static NonnullRefPtr<StreamingModuleParser> create();
+
+    ParseResult<void> append(ReadonlyBytes);
+    ParseResult<NonnullRefPtr<Module>> finish();
+
+private:
+    enum class State : u8 {
+        Header,
+        SectionHeader,
+        SectionContents,
+        CodeSectionCount,
+        CodeSectionEntry,
+    };
+
+    StreamingModuleParser();
+
+    ParseResult<void> parse_available_bytes();
+
+    ByteBuffer m_buffer;
+    size_t m_offset { 0 };
+    State m_state { State::Header };
+    Optional<ParseError> m_error;
+
+    NonnullRefPtr<Module> m_module;
+    SectionId::SectionIdKind m_last_section_id { SectionId::SectionIdKind::Custom };
+    u32 m_seen_section_kinds { 0 };
+
+    // The section being parsed, and how many of its bytes have not been parsed yet.
+    Optional<SectionId> m_section_id;
+    size_t m_section_size { 0 };
+
+    u32 m_remaining_function_count { 0 };
+    Vector<CodeSection::Code> m_functions;
+};
+
 CompiledInstructions try_compile_instructions(Expression const&, Span<FunctionType const> functions, Span<CodeSection::Func const* const> callee_bodies = {}, size_t current_function_index = 0, size_t caller_local_count = 0, size_t imported_function_count = 0);
 ErrorOr<void, ValidationError> ensure_cranelift_compiled(Module&);
 WASM_API void start_cranelift_compilation(Module&);
@@ -1814,11 +1886,14 @@ WASM_API void dump_module_stats();
 //   4. After flush, serialize_cranelift_cache_blob() returns a blob to hand to the
 //      cache store (or {} if nothing was captured); abort_cranelift_cache_capture()
 //      throws the capture away.
+// Blobs are tagged with cranelift_compiler_version(), which identifies the build of the
+// code generator; embedders should key their cache entries by it as well.
 void set_cranelift_active_function_index(u32 function_index);
 void begin_cranelift_cache_capture();
 void abort_cranelift_cache_capture();
 void abort_cranelift_cache_install();
 Optional<ByteBuffer> serialize_cranelift_cache_blob(ReadonlyBytes wasm_hash);
 bool try_install_cranelift_cache_blob(ReadonlyBytes expected_wasm_hash, ReadonlyBytes blob);
+WASM_API u64 cranelift_compiler_version();
 
 }
@@ -869,6 +869,24 @@ AnimationUpdateContext::~AnimationUpdateContext()
         target->refresh_computed_values(element.pseudo_element(), computed_values);
 
         // Traversal of the subtree is necessary to update the animated properties inherited from the target element.
+        // NB: When only non-inherited properties changed without affecting box generation (the common transform and
+        //     opacity case), a child can only be affected by explicitly inheriting one of them, e.g. `opacity: inherit`.
+        //     Children that don't are skipped together with their subtrees, so the tick touches the animated element
+        //     alone.
+        bool const children_may_be_affected = invalidation.inherited_style_changed || invalidation.needs_layout_tree_rebuild();
+        auto child_inherits_animated_property = [&](DOM::Element const& child) {
+            auto const& child_values = *child.computed_values();
+            for (auto const* properties : { it.value.animated_properties_before_update.ptr(), animated_properties_after_update.ptr() }) {
+                if (!properties)
+                    continue;
+                for (auto const& [property_id, _] : properties->values()) {
+                    if (child_values.is_property_inherited(property_id))
+                        return true;
+                }
+            }
+            return false;
+        };
+
         bool invalidated_assigned_slottables_for_descendant_slots = false;
         if (!element.pseudo_element().has_value()) {
             CSS::Invalidation::invalidate_assigned_slottables_after_slot_style_change(target);
@@ -890,11 +908,18 @@ AnimationUpdateContext::~AnimationUpdateContext()
             //     values yet (e.g. a freshly attached shadow tree that hasn't been through a style update).
             //     Inherited style can't be recomputed against an unstyled parent, so leave the element to the
             //     regular style pass, which always styles slots before their assigned slottables.
-            if (auto inheritance_parent = DOM::AbstractElement { element }.element_to_inherit_style_from();
-                inheritance_parent.has_value() && !inheritance_parent->computed_values()) {
+            auto inheritance_parent = DOM::AbstractElement { element }.element_to_inherit_style_from();
+            if (inheritance_parent.has_value() && !inheritance_parent->computed_values()) {
                 element.set_needs_style_update(true);
                 return TraversalDecision::SkipChildrenAndContinue;
             }
+            if (!children_may_be_affected
+                && inheritance_parent.has_value()
+                && !inheritance_parent->pseudo_element().has_value()
+                && &inheritance_parent->element() == target.ptr()
+                && !child_inherits_animated_property(element)) {
+                return TraversalDecision::SkipChildrenAndContinue;
+            }
             auto element_invalidation = element.recompute_inherited_style();
             if (element_invalidation.is_none())
                 return TraversalDecision::SkipChildrenAndContinue;
@@ -122,6 +122,8 @@ static ComputedScrollAxis computed_scroll_axis(Bindings::ScrollAxis axis, CSS::W
 }
 
 struct ScrollOffsetData {
+    NonnullRefPtr<Painting::Paintable const> paintable_box;
+    bool is_vertical;
     double scroll_offset;
     double max_scroll_offset;
 };
@@ -149,6 +151,8 @@ static Optional<ScrollOffsetData> compute_scroll_offset_data(Variant<GC::Ptr<DOM
     // FIXME: Support the case where the computed scroll axis is reversed
 
     return ScrollOffsetData {
+        .paintable_box = *paintable_box,
+        .is_vertical = computed_axis.is_vertical,
         .scroll_offset = computed_axis.is_vertical
             ? paintable_box->scroll_offset().y().to_double()
             : paintable_box->scroll_offset().x().to_double(),
@@ -176,6 +180,19 @@ bool ScrollTimeline::is_stale() const
     return scroll_offset_data.map([](auto const& data) { return data.max_scroll_offset; }) != m_last_max_scroll_offset;
 }
 
+Optional<ScrollTimeline::ScrollSource> ScrollTimeline::active_scroll_source() const
+{
+    auto scroll_offset_data = compute_scroll_offset_data(get_propagated_source(), m_axis);
+    if (!scroll_offset_data.has_value() || scroll_offset_data->max_scroll_offset == 0)
+        return {};
+
+    return ScrollSource {
+        .paintable_box = scroll_offset_data->paintable_box,
+        .is_vertical = scroll_offset_data->is_vertical,
+        .max_scroll_offset = scroll_offset_data->max_scroll_offset,
+    };
+}
+
 void ScrollTimeline::update_current_time(double)
 {
     // https://drafts.csswg.org/scroll-animations-1/#ref-for-dom-animationtimeline-currenttime
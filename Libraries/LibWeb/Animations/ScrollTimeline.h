@@ -37,6 +37,15 @@ public:
 
     Source source_internal() const { return m_source; }
 
+    struct ScrollSource {
+        NonnullRefPtr<Painting::Paintable const> paintable_box;
+        bool is_vertical { true };
+        double max_scroll_offset { 0 };
+    };
+
+    // The scroll container whose scroll offset drives this timeline, or nothing while the timeline is inactive.
+    Optional<ScrollSource> active_scroll_source() const;
+
     bool is_stale() const;
     virtual void update_current_time(double timestamp) override;
 
@@ -568,6 +568,7 @@ static void ensure_pseudo_element_style_for_cssom(DOM::AbstractElement abstract_
         return;
     auto& style_computer = abstract_element.document().style_computer();
     style_computer.reset_has_result_cache();
+    style_computer.reset_custom_property_resolution_cache();
 
     auto const* first_ancestor = &abstract_element.element();
     for (auto* ancestor = first_ancestor; ancestor; ancestor = ancestor->parent_or_shadow_host_element())
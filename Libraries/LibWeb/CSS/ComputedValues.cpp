@@ -947,6 +947,35 @@ bool ComputedValues::adopt_identical_group_payloads(ComputedValues const& previo
     return all_shared;
 }
 
+void ComputedValues::adopt_default_group_payloads() const
+{
+#define LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(path) const_cast<decltype(path)&>(path).adopt_default_payload_if_identical();
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_inherited.table)
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_inherited.list)
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_inherited.ui)
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_inherited.svg)
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_inherited.text)
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_inherited.box)
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_inherited.font)
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_noninherited.animation)
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_noninherited.box)
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_noninherited.surround)
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_noninherited.sizing)
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_noninherited.misc)
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_noninherited.alignment)
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_noninherited.border)
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_noninherited.background)
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_noninherited.transform)
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_noninherited.effects)
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_noninherited.mask_data)
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_noninherited.text_reset)
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_noninherited.content_data)
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_noninherited.anchor)
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_noninherited.grid)
+    LIBWEB_ADOPT_DEFAULT_STYLE_GROUP(m_noninherited.svg_reset)
+#undef LIBWEB_ADOPT_DEFAULT_STYLE_GROUP
+}
+
 NonnullRefPtr<ComputedValues const> ComputedValues::create(ComputedProperties const& computed_style, DOM::Document const& document, StyleScope const& style_scope, ColorResolutionContext color_resolution_context, ComputedValues const* inherit_parent)
 {
     Builder builder;
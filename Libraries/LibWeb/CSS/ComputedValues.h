@@ -983,6 +983,10 @@ public:
     // group ends up sharing its payload with `previous`.
     bool adopt_identical_group_payloads(ComputedValues const& previous) const;
 
+    // Like adopt_identical_group_payloads(), but against the process-wide default payloads, for groups this
+    // ComputedValues owns exclusively. Groups already shared with another style are left alone.
+    void adopt_default_group_payloads() const;
+
     // Calls back with (name, shared_with_parent, is_default) for every style value group,
     // for introspecting how well group sharing is working (see internals.styleGroupSharingInfo()).
     template<typename Callback>
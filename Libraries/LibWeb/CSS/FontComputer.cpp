@@ -186,8 +186,7 @@ void FontLoader::start_loading_next_url()
                     return;
                 }
 
-                auto prepared = prepared_font_data.release_value();
-                auto maybe_typeface = Gfx::Typeface::try_load_from_anonymous_buffer(move(prepared));
+                auto maybe_typeface = Gfx::DecodedFontCache::load_typeface(prepared_font_data.value());
                 if (maybe_typeface.is_error()) {
                     if (loader->m_urls.is_empty()) {
                         loader->font_did_load_or_fail(nullptr);
@@ -112,8 +112,7 @@ static NonnullRefPtr<Core::Promise<NonnullRefPtr<Gfx::Typeface const>>> load_vec
             return;
         }
 
-        auto prepared = prepared_font_data.release_value();
-        auto result = Gfx::Typeface::try_load_from_anonymous_buffer(move(prepared));
+        auto result = Gfx::DecodedFontCache::load_typeface(prepared_font_data.value());
         if (result.is_error()) {
             promise->reject(result.release_error());
             return;
@@ -59,16 +59,17 @@ ErrorOr<NonnullRefPtr<Gfx::Typeface const>> try_load_vector_font(ByteBuffer cons
     return Error::from_string_literal("Automatic format detection failed");
 }
 
-void prepare_vector_font_data_off_thread(ByteBuffer data, Function<void(ErrorOr<Core::AnonymousBuffer>)>&& on_complete)
+void prepare_vector_font_data_off_thread(ByteBuffer data, Function<void(ErrorOr<Gfx::DecodedFontData>)>&& on_complete)
 {
     // Keep the callback on the origin thread so any GC roots it captures are
     // also destroyed there.
-    auto* callback = new Function<void(ErrorOr<Core::AnonymousBuffer>)>(move(on_complete));
+    auto* callback = new Function<void(ErrorOr<Gfx::DecodedFontData>)>(move(on_complete));
     auto& origin_event_loop = Core::EventLoop::current();
 
     Threading::ThreadPool::the().submit(
         [data = move(data), callback, &origin_event_loop]() mutable {
-            auto result = WOFF2::convert_to_ttf(data);
+            // Other processes may well have decoded the same font already, in which case its decoded data is shared.
+            auto result = Gfx::DecodedFontCache::find_or_decode(data, WOFF2::convert_to_ttf);
 
             origin_event_loop.deferred_invoke([callback, result = move(result)]() mutable {
                 (*callback)(move(result));
@@ -10,13 +10,13 @@
 #include <AK/ByteString.h>
 #include <AK/Function.h>
 #include <AK/Optional.h>
-#include <LibCore/AnonymousBuffer.h>
+#include <LibGfx/Font/DecodedFontCache.h>
 #include <LibGfx/Font/Typeface.h>
 
 namespace Web::CSS {
 
 bool requires_off_thread_vector_font_preparation(ByteBuffer const&, Optional<ByteString> const& mime_type_essence = {});
 ErrorOr<NonnullRefPtr<Gfx::Typeface const>> try_load_vector_font(ByteBuffer const&, Optional<ByteString> const& mime_type_essence = {});
-void prepare_vector_font_data_off_thread(ByteBuffer, Function<void(ErrorOr<Core::AnonymousBuffer>)>&&);
+void prepare_vector_font_data_off_thread(ByteBuffer, Function<void(ErrorOr<Gfx::DecodedFontData>)>&&);
 
 }
@@ -18,20 +18,19 @@
 
 namespace Web::CSS::Invalidation {
 
-[[maybe_unused]] static StringView to_string(DOM::StyleInvalidationReason reason)
+// Nested invalidations stay attributed to the outermost reason, which is what the caller triggered.
+[[nodiscard]] static TemporaryChange<Optional<DOM::StyleInvalidationReason>> attribute_style_invalidations(DOM::Node const& node, DOM::StyleInvalidationReason reason)
 {
-#define __ENUMERATE_STYLE_INVALIDATION_REASON(reason) \
-    case DOM::StyleInvalidationReason::reason:        \
-        return #reason##sv;
-    switch (reason) {
-        ENUMERATE_STYLE_INVALIDATION_REASONS(__ENUMERATE_STYLE_INVALIDATION_REASON)
-    default:
-        VERIFY_NOT_REACHED();
-    }
+    auto const& document = node.document();
+    auto active_reason = document.active_style_invalidation_reason();
+    if (!active_reason.has_value())
+        ++document.style_invalidation_counters().per_reason[to_underlying(reason)].invalidations;
+    return document.attribute_style_invalidations_to(active_reason.value_or(reason));
 }
 
 void invalidate_node_style(DOM::Node& node, DOM::StyleInvalidationReason reason)
 {
+    auto attribution = attribute_style_invalidations(node, reason);
     schedule_has_invalidation_for_node(node, reason);
 
     // Character data nodes have no style of their own, so once :has() ancestor invalidation has been scheduled there
@@ -44,7 +43,7 @@ void invalidate_node_style(DOM::Node& node, DOM::StyleInvalidationReason reason)
 
     if (node.is_document()) {
         auto& document = static_cast<DOM::Document&>(node);
-        document.record_full_style_invalidation();
+        document.record_full_style_invalidation(*document.active_style_invalidation_reason());
         document.set_needs_full_style_update(true);
         return;
     }
@@ -67,6 +66,7 @@ void invalidate_node_style(DOM::Node& node, DOM::StyleInvalidationReason reason)
     // FIXME: This is a lot of invalidation and we should implement more sophisticated invalidation to do less work!
 
     node.set_entire_subtree_needs_style_update(true);
+    node.record_style_invalidation_reason();
 
     invalidate_structurally_affected_siblings(node, reason);
     mark_ancestors_as_having_child_needing_style_update(node);
@@ -85,6 +85,8 @@ void invalidate_node_style_for_properties(DOM::Node& node, DOM::StyleInvalidatio
     if (node.is_character_data())
         return;
 
+    auto attribution = attribute_style_invalidations(node, reason);
+
     // OPTIMIZATION: A disconnected mutation cannot affect connected style. Avoid selector invalidation work and :has()
     //               metadata collection for detached mutations, but keep the detached tree root dirty so CSSOM style
     //               reads can refresh any cached computed properties.
@@ -8,6 +8,7 @@
 #include <LibWeb/CSS/Invalidation/InvalidationSetMatcher.h>
 #include <LibWeb/CSS/Invalidation/StructuralMutationInvalidator.h>
 #include <LibWeb/CSS/Invalidation/StyleInvalidator.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/DOM/Node.h>
 #include <LibWeb/DOM/ShadowRoot.h>
@@ -65,7 +66,7 @@ void StyleInvalidator::visit_edges(Cell::Visitor& visitor)
 
 void StyleInvalidator::invalidate(DOM::Node& node)
 {
-    perform_pending_style_invalidations(node, false);
+    perform_pending_style_invalidations(node, false, {});
     m_pending_invalidations.clear();
 }
 
@@ -132,6 +133,8 @@ void StyleInvalidator::apply_invalidation_plan(DOM::Element& element, DOM::Style
     if (plan_to_apply.is_empty())
         return;
 
+    auto attribution = element.document().attribute_style_invalidations_to(reason);
+
     if (plan_to_apply.invalidate_whole_subtree) {
         element.invalidate_style(reason);
         invalidate_entire_subtree = true;
@@ -183,13 +186,16 @@ void StyleInvalidator::apply_sibling_invalidation(DOM::Element& element, DOM::St
 // This function makes a full pass over the entire DOM and:
 // - converts "entire subtree needs style update" into "needs style update" for each inclusive descendant where it's found.
 // - applies descendant invalidation rules to matching elements
-void StyleInvalidator::perform_pending_style_invalidations(DOM::Node& node, bool invalidate_entire_subtree)
+void StyleInvalidator::perform_pending_style_invalidations(DOM::Node& node, bool invalidate_entire_subtree, Optional<DOM::StyleInvalidationReason> subtree_invalidation_reason)
 {
     invalidate_entire_subtree |= node.entire_subtree_needs_style_update();
     auto* element = as_if<DOM::Element>(node);
 
     if (invalidate_entire_subtree) {
+        if (!subtree_invalidation_reason.has_value())
+            subtree_invalidation_reason = node.style_invalidation_reason();
         node.set_needs_style_update_internal(true);
+        node.record_style_invalidation_reason(subtree_invalidation_reason);
         if (node.has_child_nodes())
             node.set_child_needs_style_update(true);
     }
@@ -211,13 +217,17 @@ void StyleInvalidator::perform_pending_style_invalidations(DOM::Node& node, bool
                 if (!element_matches_invalidation_rule(*element, pending_invalidation.rule.match_set, pending_invalidation.rule.match_any))
                     continue;
 
-                apply_invalidation_plan(*element, pending_invalidation.reason, *pending_invalidation.rule.payload, invalidate_entire_subtree);
-                if (invalidate_entire_subtree)
+                auto const reason = pending_invalidation.reason;
+                apply_invalidation_plan(*element, reason, *pending_invalidation.rule.payload, invalidate_entire_subtree);
+                if (invalidate_entire_subtree) {
+                    subtree_invalidation_reason = reason;
                     break;
+                }
             }
 
             if (invalidate_entire_subtree) {
                 node.set_needs_style_update_internal(true);
+                node.record_style_invalidation_reason(subtree_invalidation_reason);
                 if (node.has_child_nodes())
                     node.set_child_needs_style_update(true);
             }
@@ -228,12 +238,12 @@ void StyleInvalidator::perform_pending_style_invalidations(DOM::Node& node, bool
         element->clear_removed_attributes_for_style_invalidation();
 
     for (auto* child = node.first_child(); child; child = child->next_sibling())
-        perform_pending_style_invalidations(*child, invalidate_entire_subtree);
+        perform_pending_style_invalidations(*child, invalidate_entire_subtree, subtree_invalidation_reason);
 
     if (node.is_element()) {
         auto& element = static_cast<DOM::Element&>(node);
         if (auto shadow_root = element.shadow_root()) {
-            perform_pending_style_invalidations(*shadow_root, invalidate_entire_subtree);
+            perform_pending_style_invalidations(*shadow_root, invalidate_entire_subtree, subtree_invalidation_reason);
             if (invalidate_entire_subtree || shadow_root->needs_style_update() || shadow_root->child_needs_style_update()) {
                 for (auto* ancestor = &node; ancestor; ancestor = ancestor->parent_or_shadow_host())
                     ancestor->set_child_needs_style_update(true);
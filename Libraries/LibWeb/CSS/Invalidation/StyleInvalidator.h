@@ -35,7 +35,7 @@ private:
     void add_pending_invalidation(GC::Ref<DOM::Node>, DOM::StyleInvalidationReason, CSS::InvalidationPlan const&);
     void apply_invalidation_plan(DOM::Element&, DOM::StyleInvalidationReason, CSS::InvalidationPlan const&, bool& invalidate_entire_subtree);
     void apply_sibling_invalidation(DOM::Element&, DOM::StyleInvalidationReason, CSS::SiblingInvalidationRule const&);
-    void perform_pending_style_invalidations(DOM::Node& node, bool invalidate_entire_subtree);
+    void perform_pending_style_invalidations(DOM::Node& node, bool invalidate_entire_subtree, Optional<DOM::StyleInvalidationReason> subtree_invalidation_reason);
 
     HashMap<GC::Ref<DOM::Node>, Vector<PendingDescendantInvalidation>> m_pending_invalidations;
     Vector<PendingDescendantInvalidation> m_active_descendant_invalidations;
@@ -12,7 +12,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/ByteBuffer.h>
 #include <AK/Debug.h>
+#include <AK/NeverDestroyed.h>
 #include <LibURL/Parser.h>
 #include <LibWeb/CSS/CSSFontFeatureValuesRule.h>
 #include <LibWeb/CSS/CSSFunctionDeclarations.h>
@@ -70,16 +72,72 @@ ParsingParams::ParsingParams(DOM::Document const& document, ParsingMode mode)
 {
 }
 
+// OPTIMIZATION: The documents in a WebContent process tend to load the same large stylesheets (frameworks,
+//               site-wide bundles) again and again. Keep the tokens of the most recently tokenized large inputs, so
+//               that those are decoded and tokenized only once per process. Tokens carry no realm state, so they can
+//               be shared by every document.
+struct CachedTokens {
+    u32 hash { 0 };
+    String input_kind;
+    ByteBuffer input;
+    Vector<Token> tokens;
+};
+
+static constexpr size_t minimum_length_for_token_cache = 16 * KiB;
+static constexpr size_t token_cache_capacity = 8;
+
+static Vector<CachedTokens>& token_cache()
+{
+    static NeverDestroyed<Vector<CachedTokens>> cache;
+    return *cache;
+}
+
+// The input kind tells apart inputs whose bytes are the same but tokenize differently, like the same bytes in two
+// different encodings.
+template<typename Callback>
+static Vector<Token> tokenize_with_cache(ReadonlyBytes input, StringView input_kind, Callback tokenize)
+{
+    if (input.size() < minimum_length_for_token_cache)
+        return tokenize();
+
+    auto& cache = token_cache();
+    auto hash = StringView { input }.hash();
+    for (size_t i = 0; i < cache.size(); ++i) {
+        auto& entry = cache[i];
+        if (entry.hash != hash || entry.input_kind != input_kind || entry.input.bytes() != input)
+            continue;
+        // Keep the cache in most-recently-used order.
+        if (i != 0)
+            cache.prepend(cache.take(i));
+        return cache.first().tokens;
+    }
+
+    auto tokens = tokenize();
+    auto input_copy = ByteBuffer::copy(input);
+    auto input_kind_copy = String::from_utf8(input_kind);
+    if (input_copy.is_error() || input_kind_copy.is_error())
+        return tokens;
+
+    if (cache.size() == token_cache_capacity)
+        cache.take_last();
+    cache.prepend({ hash, input_kind_copy.release_value(), input_copy.release_value(), tokens });
+    return tokens;
+}
+
 Parser Parser::create(ParsingParams const& context, StringView input, StringView encoding)
 {
-    auto tokens = Tokenizer::tokenize(input, encoding);
+    auto tokens = tokenize_with_cache(input.bytes(), encoding, [&] { return Tokenizer::tokenize(input, encoding); });
     return Parser { context, move(tokens) };
 }
 
 Parser Parser::create(ParsingParams const& context, Utf16View input)
 {
-    auto tokens = Tokenizer::tokenize(input);
-    return Parser { context, move(tokens) };
+    auto tokenize = [&] { return Tokenizer::tokenize(input); };
+    if (input.has_ascii_storage())
+        return Parser { context, tokenize_with_cache(input.bytes(), "utf-16 (ascii storage)"sv, tokenize) };
+    auto code_units = input.utf16_span();
+    ReadonlyBytes input_bytes { reinterpret_cast<u8 const*>(code_units.data()), code_units.size() * sizeof(char16_t) };
+    return Parser { context, tokenize_with_cache(input_bytes, "utf-16"sv, tokenize) };
 }
 
 Parser::Parser(ParsingParams const& context, Vector<Token> tokens)
@@ -75,6 +75,9 @@ define_ffi_ops! {
     StyleValueShellRetainCallback => "styleValueShellRetainCallbacks",
     StyleValueShellReleaseCallback => "styleValueShellReleaseCallbacks",
     StringRetainReleaseCallback => "stringRetainReleaseCallbacks",
+    // Events: tallied by C++ during rule collection and reported in bulk.
+    AncestorFilterRejectedSelector => "ancestorFilterRejectedSelectors",
+    AncestorFilterSkippedBucket => "ancestorFilterSkippedBuckets",
 }
 
 static COUNTERS: [AtomicU64; FFI_OP_COUNT] = [const { AtomicU64::new(0) }; FFI_OP_COUNT];
@@ -116,3 +119,12 @@ pub extern "C" fn rust_style_ffi_counters_reset() {
 pub extern "C" fn rust_style_ffi_note_style_value_created() {
     bump(FfiOp::StyleValueCreateEntry);
 }
+
+/// Notes how many candidate selectors and ancestor-hash rule buckets the
+/// ancestor bloom filter rejected while collecting rules for one element. C++
+/// tallies these locally and reports them once per collection pass.
+#[unsafe(no_mangle)]
+pub extern "C" fn rust_style_ffi_note_ancestor_filter_rejections(rejected_selectors: u64, skipped_buckets: u64) {
+    COUNTERS[FfiOp::AncestorFilterRejectedSelector as usize].fetch_add(rejected_selectors, Ordering::Relaxed);
+    COUNTERS[FfiOp::AncestorFilterSkippedBucket as usize].fetch_add(skipped_buckets, Ordering::Relaxed);
+}
@@ -215,6 +215,11 @@ pub struct CompiledSelector {
     /// The greatest number of consecutive next-sibling combinators in any sibling traversal.
     /// `usize::MAX` represents the unbounded distance of a subsequent-sibling combinator.
     pub sibling_invalidation_distance: usize,
+    /// Indices into each compound's simple selectors, in the order matching evaluates them. The
+    /// orders of all compounds are stored back to back; `match_order_offsets[i]` is where the
+    /// order of compound `i` starts.
+    match_order: Box<[u16]>,
+    match_order_offsets: Box<[u32]>,
 }
 
 impl PartialEq for CompiledSelector {
@@ -265,6 +270,8 @@ impl CompiledSelector {
 
         let sibling_invalidation_distance = sibling_invalidation_distance(&compound_selectors);
 
+        let (match_order, match_order_offsets) = simple_selector_match_order(&compound_selectors);
+
         Rc::new(Self {
             id,
             cxx_selector,
@@ -272,9 +279,24 @@ impl CompiledSelector {
             target_pseudo_element,
             can_use_fast_matches,
             sibling_invalidation_distance,
+            match_order,
+            match_order_offsets,
         })
     }
 
+    /// The simple selectors of compound `component_list_index`, cheapest rejection first.
+    fn simple_selectors_in_match_order(&self, component_list_index: usize) -> impl Iterator<Item = &SimpleSelector> {
+        let start = self.match_order_offsets[component_list_index] as usize;
+        let end = self
+            .match_order_offsets
+            .get(component_list_index + 1)
+            .map_or(self.match_order.len(), |&offset| offset as usize);
+        let simple_selectors = &self.compound_selectors[component_list_index].simple_selectors;
+        self.match_order[start..end]
+            .iter()
+            .map(move |&index| &simple_selectors[usize::from(index)])
+    }
+
     pub fn id(&self) -> u64 {
         self.id
     }
@@ -523,42 +545,11 @@ fn matches_compound_selector<Dom: SelectorDom>(
     //   selector with the rightmost compound selector and rightmost combinator removed against
     //   any one of these elements returns success, then return success. Otherwise, return failure.
     let compound_selector = &selector.compound_selectors[component_list_index];
-    let is_has = |simple_selector: &SimpleSelector| {
-        matches!(
-            simple_selector,
-            SimpleSelector::PseudoClass(PseudoClassSelector {
-                pseudo_class: PseudoClassType::Has,
-                ..
-            })
-        )
-    };
 
-    // OPTIMIZATION: Evaluate :has() last. Its subtree traversal is substantially more expensive
-    //               than the other simple selectors and cannot affect their result.
-    for simple_selector in compound_selector
-        .simple_selectors
-        .iter()
-        .rev()
-        .filter(|selector| !is_has(selector))
-    {
-        if !matches_simple_selector(
-            simple_selector,
-            target,
-            shadow_host,
-            state.scope,
-            state.selector_kind,
-            TagNameMatchingMode::Normal,
-            dom,
-        ) {
-            return false;
-        }
-    }
-    for simple_selector in compound_selector
-        .simple_selectors
-        .iter()
-        .rev()
-        .filter(|selector| is_has(selector))
-    {
+    // OPTIMIZATION: Evaluate the simple selectors cheapest rejection first, and :has() last. Its
+    //               subtree traversal is substantially more expensive than the other simple
+    //               selectors and cannot affect their result.
+    for simple_selector in selector.simple_selectors_in_match_order(component_list_index) {
         if !matches_simple_selector(
             simple_selector,
             target,
@@ -1365,12 +1356,7 @@ fn fast_matches<Dom: SelectorDom>(
     //               fail, so retain the next ancestor and resume the descendant search there.
     let mut current = element_to_match;
     let mut compound_selector_index = selector.compound_selectors.len() - 1;
-    if !fast_matches_compound_selector(
-        &selector.compound_selectors[compound_selector_index],
-        current,
-        shadow_host,
-        dom,
-    ) {
+    if !fast_matches_compound_selector(selector, compound_selector_index, current, shadow_host, dom) {
         return false;
     }
 
@@ -1383,13 +1369,12 @@ fn fast_matches<Dom: SelectorDom>(
                 let parent = dom.parent_element_in_light_tree(current);
                 backtrack_state = parent.map(|parent| (parent, compound_selector_index));
                 compound_selector_index -= 1;
-                let previous_compound = &selector.compound_selectors[compound_selector_index];
                 let mut ancestor = parent;
                 loop {
                     let Some(element) = ancestor else {
                         return false;
                     };
-                    if fast_matches_compound_selector(previous_compound, element, shadow_host, dom) {
+                    if fast_matches_compound_selector(selector, compound_selector_index, element, shadow_host, dom) {
                         current = element;
                         break;
                     }
@@ -1402,12 +1387,7 @@ fn fast_matches<Dom: SelectorDom>(
                     return false;
                 };
                 current = parent;
-                if !fast_matches_compound_selector(
-                    &selector.compound_selectors[compound_selector_index],
-                    current,
-                    shadow_host,
-                    dom,
-                ) {
+                if !fast_matches_compound_selector(selector, compound_selector_index, current, shadow_host, dom) {
                     let Some((element, index)) = backtrack_state.take() else {
                         return false;
                     };
@@ -1421,12 +1401,14 @@ fn fast_matches<Dom: SelectorDom>(
 }
 
 fn fast_matches_compound_selector<Dom: SelectorDom>(
-    compound_selector: &CompoundSelector,
+    selector: &CompiledSelector,
+    compound_selector_index: usize,
     element: Dom::Element,
     shadow_host: Option<Dom::Element>,
     dom: &mut Dom,
 ) -> bool {
-    compound_selector.simple_selectors.iter().all(|simple_selector| {
+    let mut simple_selectors = selector.simple_selectors_in_match_order(compound_selector_index);
+    simple_selectors.all(|simple_selector| {
         matches_simple_selector(
             simple_selector,
             MatchTarget {
@@ -3409,6 +3391,31 @@ pub unsafe extern "C" fn rust_selector_matches_originating_element(
     })
 }
 
+/// A rough relative cost of evaluating `simple_selector`, used to order matching so that the
+/// checks most likely to reject cheaply run first.
+fn simple_selector_match_cost(simple_selector: &SimpleSelector) -> u8 {
+    match simple_selector {
+        SimpleSelector::PseudoElement(_) | SimpleSelector::Id(_) => 0,
+        SimpleSelector::Class(_) => 1,
+        SimpleSelector::TagName(_) | SimpleSelector::Universal(_) => 2,
+        SimpleSelector::Attribute(_) => 3,
+        SimpleSelector::PseudoClass(selector) => match selector.pseudo_class {
+            PseudoClassType::Has => u8::MAX,
+            _ if !selector.argument_selector_list.is_empty() => 6,
+            PseudoClassType::NthChild
+            | PseudoClassType::NthLastChild
+            | PseudoClassType::NthOfType
+            | PseudoClassType::NthLastOfType
+            | PseudoClassType::LastChild
+            | PseudoClassType::OnlyChild
+            | PseudoClassType::LastOfType
+            | PseudoClassType::OnlyOfType => 5,
+            _ => 4,
+        },
+        SimpleSelector::Nesting | SimpleSelector::Invalid => 4,
+    }
+}
+
 fn can_simple_selector_use_fast_matches(simple_selector: &SimpleSelector) -> bool {
     match simple_selector {
         SimpleSelector::Universal(_)
@@ -3443,6 +3450,25 @@ fn can_simple_selector_use_fast_matches(simple_selector: &SimpleSelector) -> boo
     }
 }
 
+fn simple_selector_match_order(compound_selectors: &[CompoundSelector]) -> (Box<[u16]>, Box<[u32]>) {
+    let mut match_order = Vec::new();
+    let mut match_order_offsets = Vec::with_capacity(compound_selectors.len());
+    for compound_selector in compound_selectors {
+        let first_index = match_order.len();
+        match_order_offsets.push(u32::try_from(first_index).expect("selector has too many simple selectors"));
+        match_order.extend(
+            (0..compound_selector.simple_selectors.len())
+                .rev()
+                .map(|index| u16::try_from(index).expect("compound has too many simple selectors")),
+        );
+        // NB: The sort is stable, so simple selectors of equal cost keep the right-to-left order
+        //     matching has always used.
+        match_order[first_index..]
+            .sort_by_key(|&index| simple_selector_match_cost(&compound_selector.simple_selectors[usize::from(index)]));
+    }
+    (match_order.into_boxed_slice(), match_order_offsets.into_boxed_slice())
+}
+
 fn sibling_invalidation_distance(compound_selectors: &[CompoundSelector]) -> usize {
     // Sibling invalidation only needs to reach as far as the longest uninterrupted chain of next
     // siblings. Child, descendant, and column combinators start a new sibling traversal, while a
@@ -3915,4 +3941,27 @@ mod tests {
             &mut dom,
         ));
     }
+
+    #[test]
+    fn evaluates_cheapest_simple_selectors_first() {
+        let id = SimpleSelector::Id(NameSelector {
+            name: Box::from([b'x' as u16]),
+            interned_name: None,
+        });
+        let has = SimpleSelector::PseudoClass(PseudoClassSelector::without_arguments(PseudoClassType::Has));
+        let hover = SimpleSelector::PseudoClass(PseudoClassSelector::without_arguments(PseudoClassType::Hover));
+        let selector = selector(vec![
+            compound(Combinator::None, vec![class("a")]),
+            compound(
+                Combinator::Descendant,
+                vec![has.clone(), hover.clone(), class("b"), id.clone(), class("c")],
+            ),
+        ]);
+
+        let first_order = selector.simple_selectors_in_match_order(0).collect::<Vec<_>>();
+        assert_eq!(first_order, vec![&class("a")]);
+
+        let second_order = selector.simple_selectors_in_match_order(1).collect::<Vec<_>>();
+        assert_eq!(second_order, vec![&id, &class("c"), &class("b"), &hover, &has]);
+    }
 }
@@ -104,6 +104,7 @@
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/Paintable.h>
 #include <LibWeb/Platform/FontPlugin.h>
+#include <LibWeb/StyleValueRustFFI.h>
 #include <math.h>
 
 namespace Web::CSS {
@@ -588,6 +589,14 @@ Vector<StyleComputer::ScopedMatchingRule> StyleComputer::collect_matching_rules_
         rules_to_run.clear_with_capacity();
     };
 
+    // Ancestor filter rejections are tallied locally and reported once, so the hot loop stays free of atomics.
+    u64 ancestor_filter_rejected_selectors = 0;
+    u64 ancestor_filter_skipped_buckets = 0;
+    ScopeGuard note_ancestor_filter_rejections = [&] {
+        if (ancestor_filter_rejected_selectors != 0 || ancestor_filter_skipped_buckets != 0)
+            StyleValueFFI::rust_style_ffi_note_ancestor_filter_rejections(ancestor_filter_rejected_selectors, ancestor_filter_skipped_buckets);
+    };
+
     // Multi-bucketed pseudo-element rules can be reached through more than one
     // originating-element key, e.g. `:is(.foo, .bar)::before` on an element with
     // both classes. Use a generation stamp instead of a per-element HashSet so
@@ -647,8 +656,10 @@ Vector<StyleComputer::ScopedMatchingRule> StyleComputer::collect_matching_rules_
             return;
 
         auto const& selector = rule_to_run.selector;
-        if (selector.can_use_ancestor_filter() && should_reject_with_ancestor_filter(selector))
+        if (selector.can_use_ancestor_filter() && should_reject_with_ancestor_filter(selector)) {
+            ++ancestor_filter_rejected_selectors;
             return;
+        }
         if (should_reject_with_parent_filter(abstract_element, selector))
             return;
 
@@ -698,7 +709,12 @@ Vector<StyleComputer::ScopedMatchingRule> StyleComputer::collect_matching_rules_
 
     auto add_rules_from_cache = [&](RuleCache const& rule_cache, GC::Ptr<DOM::ShadowRoot const> rule_root) {
         multi_bucket_rule_generation = next_multi_bucket_rule_generation();
-        Function<bool(u32)> may_contain_ancestor_hash = [&](u32 hash) { return m_ancestor_filter->may_contain(hash); };
+        Function<bool(u32)> may_contain_ancestor_hash = [&](u32 hash) {
+            if (m_ancestor_filter->may_contain(hash))
+                return true;
+            ++ancestor_filter_skipped_buckets;
+            return false;
+        };
         rule_cache.for_each_matching_rules(abstract_element, may_contain_ancestor_hash, [&](auto const& matching_rules) {
             add_rules_to_run(matching_rules, rule_root);
             return IterationDecision::Continue;
@@ -3041,6 +3057,31 @@ NonnullRefPtr<ComputedValues const> StyleComputer::build_computed_values(Compute
                 style.adopt_identical_group_payloads(*parent_values);
         }
     };
+    // NB: Runs of siblings with the same tag and classes (table rows, list items, feed entries) usually end up with
+    //     identical non-inherited groups too. Adopting those from the previous such sibling keeps one payload per
+    //     group for the whole run instead of one per element. The tag and class check only decides whether the
+    //     comparison is worth doing; a group is adopted only when its values compare equal.
+    auto adopt_group_payloads_from_previous_sibling = [&](ComputedValues const& style) {
+        if (abstract_element.pseudo_element().has_value())
+            return;
+        auto const& element = abstract_element.element();
+        auto const* sibling = element.previous_element_sibling();
+        if (!sibling
+            || sibling->local_name() != element.local_name()
+            || sibling->namespace_uri() != element.namespace_uri()
+            || sibling->class_names() != element.class_names())
+            return;
+        if (auto sibling_values = sibling->computed_values())
+            style.adopt_identical_group_payloads(*sibling_values);
+    };
+    // NB: Whatever is still exclusively owned after that is a group that differs from both. If it
+    //     merely repeats the initial values (e.g. a property set explicitly to its initial value),
+    //     fall back to the leaked default payload so the element doesn't keep a private copy.
+    auto share_payloads = [&](ComputedValues const& style) {
+        adopt_group_payloads_from_parent(style);
+        adopt_group_payloads_from_previous_sibling(style);
+        style.adopt_default_group_payloads();
+    };
 
     auto const inherit_parent = abstract_element.element_to_inherit_style_from();
     auto const* inherit_parent_values = inherit_parent.has_value() ? inherit_parent->computed_values() : nullptr;
@@ -3049,7 +3090,7 @@ NonnullRefPtr<ComputedValues const> StyleComputer::build_computed_values(Compute
     auto base_values = ComputedValues::create(*base_properties, document(), style_scope, color_resolution_context, inherit_parent_values);
     auto animated_properties = computed_properties.animated_properties_snapshot();
     if (!animated_properties || animated_properties->is_empty()) {
-        adopt_group_payloads_from_parent(*base_values);
+        share_payloads(*base_values);
         return base_values;
     }
 
@@ -3057,7 +3098,7 @@ NonnullRefPtr<ComputedValues const> StyleComputer::build_computed_values(Compute
     builder->set_base_values(move(base_values));
     builder->set_animated_properties(animated_properties.ptr());
     auto style = move(builder).build();
-    adopt_group_payloads_from_parent(*style);
+    share_payloads(*style);
     return style;
 }
 
@@ -4235,6 +4276,64 @@ void StyleComputer::compute_custom_properties(ComputedProperties& computed_style
     if (inherit_from.has_value())
         parent_data = inheritable_custom_property_data(*inherit_from);
 
+    // OPTIMIZATION: Elements with the same declared custom properties (by value identity, so matching the same
+    //               declarations) and the same inherited data resolve to the same values, unless a value reads
+    //               something from the element itself: an attr() or a registered property, whose computed value may
+    //               depend on the element's other properties. Reuse the first such element's resolution, including
+    //               any var() cycles it found, instead of resolving the chain again.
+    auto const is_cacheable = [&] {
+        for (auto const& [name, style_property] : data->own_values()) {
+            if (abstract_element.document().get_registered_custom_property(name).has_value())
+                return false;
+            if (style_property.value->is_unresolved() && style_property.value->as_unresolved().includes_attr_function())
+                return false;
+        }
+        return true;
+    }();
+    auto const cache_key = [&] {
+        u32 hash = ptr_hash(parent_data.ptr());
+        hash = pair_int_hash(hash, ptr_hash(data->parent().ptr()));
+        for (auto const& [name, style_property] : data->own_values())
+            hash = pair_int_hash(pair_int_hash(hash, name.hash()), ptr_hash(style_property.value.ptr()));
+        return hash;
+    }();
+    auto const is_same_declared_data = [&](CustomPropertyData const& other) {
+        if (other.parent() != data->parent() || other.own_values().size() != data->own_values().size())
+            return false;
+        auto other_it = other.own_values().begin();
+        for (auto const& [name, style_property] : data->own_values()) {
+            if (other_it->key != name
+                || other_it->value.value.ptr() != style_property.value.ptr()
+                || other_it->value.important != style_property.important)
+                return false;
+            ++other_it;
+        }
+        return true;
+    };
+    if (is_cacheable) {
+        if (auto cached_resolutions = m_custom_property_resolution_cache.get(cache_key); cached_resolutions.has_value()) {
+            for (auto const& cached : *cached_resolutions) {
+                if (cached.parent_data == parent_data && is_same_declared_data(*cached.declared_data)) {
+                    abstract_element.set_custom_property_data(cached.resolved_data);
+                    return;
+                }
+            }
+        }
+    }
+    auto const remember_resolution = [&] {
+        // NB: Entries keep their inputs alive so the identity comparisons above can't be fooled by reused addresses;
+        //     the cap bounds how much a single style update can pin.
+        static constexpr size_t max_cached_custom_property_resolutions = 256;
+        if (!is_cacheable || m_custom_property_resolution_cache_size >= max_cached_custom_property_resolutions)
+            return;
+        m_custom_property_resolution_cache.ensure(cache_key).append({
+            .parent_data = parent_data,
+            .declared_data = *data,
+            .resolved_data = abstract_element.custom_property_data(),
+        });
+        ++m_custom_property_resolution_cache_size;
+    };
+
     OrderedHashMap<Utf16FlyString, StyleProperty> resolved_own;
     for (auto const& [name, style_property] : data->own_values()) {
         // FIXME: Can we store the resolved value in `data` immediately to avoid recomputing it for any subsequent
@@ -4255,12 +4354,14 @@ void StyleComputer::compute_custom_properties(ComputedProperties& computed_style
 
     if (resolved_own.is_empty() && parent_data) {
         abstract_element.set_custom_property_data(parent_data);
+        remember_resolution();
         return;
     }
 
     // FIXME: We should update in place so that non-recomputed children aren't left pointing at stale data
     abstract_element.set_custom_property_data(
-        CustomPropertyData::create(move(resolved_own), parent_data ? move(parent_data) : data->parent()));
+        CustomPropertyData::create(move(resolved_own), parent_data ? parent_data : data->parent()));
+    remember_resolution();
 }
 
 // https://www.w3.org/TR/css-values-4/#snap-a-length-as-a-border-width
@@ -4650,6 +4751,12 @@ void StyleComputer::reset_ancestor_filter()
     m_ancestor_filter->clear();
 }
 
+void StyleComputer::reset_custom_property_resolution_cache()
+{
+    m_custom_property_resolution_cache.clear();
+    m_custom_property_resolution_cache_size = 0;
+}
+
 void StyleComputer::reset_has_result_cache()
 {
     if (!m_has_result_cache)
@@ -4677,6 +4784,21 @@ void StyleComputer::pop_ancestor(DOM::Element const& element)
     });
 }
 
+void StyleComputer::push_ancestor(DOM::Element const& element, AncestorFilterHashes& pushed_hashes)
+{
+    pushed_hashes.clear_with_capacity();
+    for_each_element_hash(element, [&](u32 hash) {
+        m_ancestor_filter->increment(hash);
+        pushed_hashes.append(hash);
+    });
+}
+
+void StyleComputer::pop_ancestor(AncestorFilterHashes const& pushed_hashes)
+{
+    for (auto hash : pushed_hashes)
+        m_ancestor_filter->decrement(hash);
+}
+
 template<typename RuleBuckets>
 static void add_rule_to_simplified_selector_bucket(RuleBuckets& rule_buckets, MatchingRule const& matching_rule, SimplifiedSelectorForBucketing const& bucket)
 {
@@ -100,9 +100,16 @@ public:
 
     void reset_ancestor_filter();
     void reset_has_result_cache();
+    void reset_custom_property_resolution_cache();
     void push_ancestor(DOM::Element const&);
     void pop_ancestor(DOM::Element const&);
 
+    // Tree traversals that push and pop every element they visit can remember the hashes an element contributed to the
+    // ancestor filter, so popping it doesn't have to walk its classes and attributes a second time.
+    using AncestorFilterHashes = Vector<u32, 16>;
+    void push_ancestor(DOM::Element const&, AncestorFilterHashes& pushed_hashes);
+    void pop_ancestor(AncestorFilterHashes const& pushed_hashes);
+
     [[nodiscard]] NonnullRefPtr<ComputedValues const> create_document_style() const;
 
     [[nodiscard]] NonnullRefPtr<ComputedValues const> compute_style(DOM::AbstractElement, Optional<bool&> did_change_custom_properties = {}) const;
@@ -241,6 +248,17 @@ private:
     OwnPtr<CountingBloomFilter<u8, 14>> m_ancestor_filter;
     OwnPtr<SelectorMatching::HasResultCache> m_has_result_cache;
     OwnPtr<SelectorMatching::HasFastRejectFilterCache> m_has_fast_reject_filter_cache;
+
+    // Resolved custom properties of elements whose declared custom properties and inherited data are identical,
+    // e.g. runs of siblings matching the same rules. Only holds resolutions that depend on nothing else, and is
+    // cleared at the start of every style update.
+    struct CachedCustomPropertyResolution {
+        RefPtr<CustomPropertyData const> parent_data;
+        NonnullRefPtr<CustomPropertyData const> declared_data;
+        RefPtr<CustomPropertyData const> resolved_data;
+    };
+    mutable HashMap<u32, Vector<CachedCustomPropertyResolution, 1>> m_custom_property_resolution_cache;
+    mutable size_t m_custom_property_resolution_cache_size { 0 };
 };
 
 inline bool StyleComputer::should_reject_with_ancestor_filter(Selector const& selector) const
@@ -108,6 +108,18 @@ public:
         m_payload = static_cast<T*>(payload);
     }
 
+    // Switches to the shared default payload when this ref is the sole owner of a
+    // payload whose values equal the defaults, freeing the duplicate.
+    void adopt_default_payload_if_identical()
+    {
+        if (is_default() || refcount().load(AK::memory_order_acquire) != 1)
+            return;
+        if (!(*m_payload == default_value()))
+            return;
+        deref();
+        m_payload = static_cast<T*>(const_cast<void*>(default_payload()));
+    }
+
     bool ptr_equals(StyleStructRef const& other) const { return m_payload == other.m_payload; }
     bool is_default() const { return m_payload == default_payload(); }
 
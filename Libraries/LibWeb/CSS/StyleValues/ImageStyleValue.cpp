@@ -224,6 +224,10 @@ Optional<Gfx::Color> ImageStyleValue::color_if_single_pixel_bitmap(DOM::Document
     if (!is<HTML::BitmapDecodedImageData>(*image_data) && !is<HTML::AnimatedBitmapDecodedImageData>(*image_data))
         return {};
 
+    // Asking for the frame would make a downscaled image get decoded at its natural size again, so check first.
+    if (image_data->intrinsic_width() != CSSPixels(1) || image_data->intrinsic_height() != CSSPixels(1))
+        return {};
+
     auto decoded_frame = image_data->current_frame();
     if (!decoded_frame.has_value())
         return {};
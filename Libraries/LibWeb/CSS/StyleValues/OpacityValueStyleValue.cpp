@@ -35,6 +35,15 @@ ValueComparingNonnullRefPtr<StyleValue const> OpacityValueStyleValue::absolutize
     return OpacityValueStyleValue::create(NumberStyleValue::create(clamped_number_value));
 }
 
+Optional<double> OpacityValueStyleValue::resolved_without_computation_context() const
+{
+    if (value()->is_number())
+        return clamp(value()->as_number().number(), 0, 1);
+    if (value()->is_percentage())
+        return clamp(value()->as_percentage().percentage().as_fraction(), 0, 1);
+    return {};
+}
+
 GC::Ref<CSSStyleValue> OpacityValueStyleValue::reify(JS::Realm& realm, Utf16FlyString const& associated_property) const
 {
     return value()->reify(realm, associated_property);
@@ -26,6 +26,9 @@ public:
 
     double resolved() const { return value()->as_number().number(); }
 
+    // Returns the clamped opacity if it can be known without a computation context, i.e. it isn't a calc().
+    Optional<double> resolved_without_computation_context() const;
+
     GC::Ref<CSSStyleValue> reify(JS::Realm& realm, Utf16FlyString const& associated_property) const;
 
     bool properties_equal(OpacityValueStyleValue const& other) const { return value() == other.value(); }
@@ -24,6 +24,7 @@
 #include <LibWeb/HTML/LocalNavigable.h>
 #include <LibWeb/HTML/NavigableContainer.h>
 #include <LibWeb/Layout/Box.h>
+#include <LibWeb/Profiling/SamplingProfiler.h>
 
 namespace Web::CSS {
 
@@ -135,6 +136,7 @@ struct StyleUpdateFrame {
 
     GC::Ref<DOM::Node> node;
     GC::Ptr<DOM::Node> next_child;
+    StyleComputer::AncestorFilterHashes ancestor_filter_hashes;
     RequiredInvalidationAfterStyleChange invalidation;
     RequiredInvalidationAfterStyleChange node_invalidation;
     bool needs_inherited_style_update { false };
@@ -160,7 +162,7 @@ static void enter_style_update_frame(StyleUpdateFrame& frame, StyleComputer& sty
     frame.needs_full_style_update = node.document().needs_full_style_update();
 
     if (node.is_element())
-        style_computer.push_ancestor(static_cast<DOM::Element const&>(node));
+        style_computer.push_ancestor(static_cast<DOM::Element const&>(node), frame.ancestor_filter_hashes);
 
     // NOTE: If the current node has `display:none`, we can disregard all invalidation
     //       caused by its children, as they will not be rendered anyway.
@@ -271,7 +273,7 @@ static void finish_style_update_frame(StyleUpdateFrame& frame, StyleComputer& st
         node.set_child_needs_style_update(false);
 
     if (node.is_element())
-        style_computer.pop_ancestor(static_cast<DOM::Element const&>(node));
+        style_computer.pop_ancestor(frame.ancestor_filter_hashes);
 }
 
 static void push_style_update_frame_for_child(GC::ConservativeVector<StyleUpdateFrame, 32>& stack, StyleUpdateFrame const& parent_frame, DOM::Node& child, bool child_needs_inherited_style_update)
@@ -409,6 +411,7 @@ void update_style(DOM::Document& document)
     constexpr size_t max_style_update_passes = 8;
     for (size_t style_update_pass = 0; style_update_pass < max_style_update_passes; ++style_update_pass) {
         document.style_computer().reset_has_result_cache();
+        document.style_computer().reset_custom_property_resolution_cache();
         document.style_computer().reset_ancestor_filter();
 
         invalidation |= update_style_iteratively(document, document.style_computer(), false, false, false, false);
@@ -570,6 +573,7 @@ ComputedValues const* update_style_for_element(DOM::Document& document, DOM::Abs
     }
 
     document.style_computer().reset_has_result_cache();
+    document.style_computer().reset_custom_property_resolution_cache();
 
     // Re-cascading the inheritance chain requires the style computer's ancestor filter to reflect each recomputed
     // element's DOM ancestors, so that descendant-combinator selectors match correctly. The filter is empty at this
@@ -632,6 +636,7 @@ void update_style_for_subtree_including_display_none(DOM::Document& document, DO
     VERIFY(&update_root->document() == &document);
 
     document.style_computer().reset_has_result_cache();
+    document.style_computer().reset_custom_property_resolution_cache();
 
     auto& style_computer = document.style_computer();
     ScopedStyleComputerAncestorChain scoped_ancestor_chain { style_computer, *update_root };
@@ -690,6 +695,7 @@ namespace Web::DOM {
 
 void Document::update_style()
 {
+    Profiling::PhaseScope phase_scope { Profiling::Phase::Style };
     CSS::update_style(*this);
 }
 
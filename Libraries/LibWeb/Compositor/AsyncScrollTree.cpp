@@ -15,6 +15,7 @@ void AsyncScrollTree::set_state(AsyncScrollingState&& state)
 {
     m_scroll_nodes = move(state.scroll_nodes);
     m_sticky_areas = move(state.sticky_areas);
+    m_scroll_timeline_opacity_animations = move(state.scroll_timeline_opacity_animations);
     m_wheel_hit_test_regions = move(state.wheel_hit_test_targets);
     m_main_thread_wheel_event_regions = move(state.main_thread_wheel_event_regions);
     m_blocking_wheel_event_regions = move(state.blocking_wheel_event_regions);
@@ -207,6 +208,28 @@ void AsyncScrollTree::update_sticky_offsets(Painting::ScrollStateSnapshot& scrol
     }
 }
 
+void AsyncScrollTree::apply_scroll_timeline_animations(Painting::AccumulatedVisualContextTree& visual_context_tree, Painting::ScrollStateSnapshot const& scroll_state_snapshot) const
+{
+    for (auto const& animation : m_scroll_timeline_opacity_animations) {
+        if (animation.max_scroll_offset <= 0 || animation.effects_node_index.value() >= visual_context_tree.nodes().size())
+            continue;
+        auto* effects = visual_context_tree.node_at(animation.effects_node_index).data.get_pointer<Painting::EffectsData>();
+        if (!effects)
+            continue;
+
+        auto device_offset = scroll_state_snapshot.device_offset_for_index(animation.source_node_id.scroll_node_index);
+        auto scroll_offset = animation.vertical ? -device_offset.y() : -device_offset.x();
+        auto progress = scroll_offset / animation.max_scroll_offset;
+
+        // Once scrolled to the end, the animation is past its active interval and only applies if it fills forwards.
+        // Otherwise, leave the value the main thread computed without it alone.
+        if (progress >= 1 && !animation.fills_forwards)
+            continue;
+        progress = clamp(progress, 0.0f, 1.0f);
+        effects->opacity = animation.from_opacity + (animation.to_opacity - animation.from_opacity) * progress;
+    }
+}
+
 static void set_or_append_scroll_offset(Vector<AsyncScrollOffset>& scroll_offsets, AsyncScrollNode const& node, Gfx::FloatPoint compositor_scroll_offset, Gfx::FloatPoint unadopted_scroll_delta)
 {
     for (auto& existing : scroll_offsets) {
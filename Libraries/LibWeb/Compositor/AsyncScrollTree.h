@@ -64,6 +64,10 @@ public:
     Vector<AsyncScrollOffset> apply_scroll_delta(AsyncScrollNodeID, Gfx::FloatPoint delta, Painting::ScrollStateSnapshot&);
     Optional<Gfx::FloatPoint> set_scroll_offset(AsyncScrollNodeID, Gfx::FloatPoint, Painting::ScrollStateSnapshot&);
 
+    bool has_scroll_timeline_animations() const { return !m_scroll_timeline_opacity_animations.is_empty(); }
+    // Overwrites the animated values in the visual context tree with the ones at the scroll offsets of the snapshot.
+    void apply_scroll_timeline_animations(Painting::AccumulatedVisualContextTree&, Painting::ScrollStateSnapshot const&) const;
+
 private:
     static Gfx::FloatPoint clamp_scroll_offset_to_node(AsyncScrollNode const&, Gfx::FloatPoint);
     static Gfx::FloatPoint scroll_offset_for_node(AsyncScrollNode const&, Painting::ScrollStateSnapshot const&);
@@ -81,6 +85,7 @@ private:
 
     Vector<AsyncScrollNode> m_scroll_nodes;
     Vector<AsyncStickyArea> m_sticky_areas;
+    Vector<AsyncScrollTimelineOpacityAnimation> m_scroll_timeline_opacity_animations;
     Vector<WheelHitTestTarget> m_wheel_hit_test_regions;
     Vector<MainThreadWheelEventRegion> m_main_thread_wheel_event_regions;
     Vector<CachedWheelHitTestTarget> m_cached_wheel_hit_test_targets;
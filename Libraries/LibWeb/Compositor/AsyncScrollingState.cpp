@@ -94,6 +94,19 @@ AsyncScrollingState async_scrolling_state_from_display_list(Painting::DisplayLis
             });
             break;
         }
+        case Painting::DisplayListCommandType::CompositorScrollTimelineOpacityAnimation: {
+            auto command = Painting::read_display_list_command_payload<Painting::CompositorScrollTimelineOpacityAnimation>(payload);
+            async_scrolling_state.scroll_timeline_opacity_animations.append({
+                .source_node_id = scroll_node_id_for(command.document_id, command.source_scroll_node_index),
+                .effects_node_index = command.effects_node_index,
+                .max_scroll_offset = command.max_scroll_offset,
+                .from_opacity = command.from_opacity,
+                .to_opacity = command.to_opacity,
+                .vertical = command.vertical,
+                .fills_forwards = command.fills_forwards,
+            });
+            break;
+        }
         case Painting::DisplayListCommandType::CompositorScrollNode: {
             auto command = Painting::read_display_list_command_payload<Painting::CompositorScrollNode>(payload);
             async_scrolling_state.scroll_nodes.append({
@@ -83,6 +83,18 @@ struct AsyncStickyArea {
     Optional<float> inset_left;
 };
 
+// An opacity animation on a scroll progress timeline that the main thread has reduced to a linear interpolation between
+// two opacities. Replaying it against compositor scroll offsets keeps it in step with async scrolling.
+struct AsyncScrollTimelineOpacityAnimation {
+    AsyncScrollNodeID source_node_id;
+    Painting::VisualContextIndex effects_node_index;
+    float max_scroll_offset { 0 };
+    float from_opacity { 1 };
+    float to_opacity { 1 };
+    bool vertical { true };
+    bool fills_forwards { false };
+};
+
 // A region with a non-passive wheel listener. Wheels inside it must stay on the main thread because script may cancel.
 struct BlockingWheelEventRegion {
     Painting::VisualContextIndex visual_context_index;
@@ -120,6 +132,7 @@ struct ViewportScrollbar {
 struct AsyncScrollingState {
     Vector<AsyncScrollNode> scroll_nodes;
     Vector<AsyncStickyArea> sticky_areas;
+    Vector<AsyncScrollTimelineOpacityAnimation> scroll_timeline_opacity_animations;
     Vector<WheelHitTestTarget> wheel_hit_test_targets;
     Vector<MainThreadWheelEventRegion> main_thread_wheel_event_regions;
     Vector<ViewportScrollbar> viewport_scrollbars;
@@ -122,11 +122,29 @@ WebIDL::ExceptionOr<void> DecompressionStream::decompress_and_enqueue_chunk(JS::
         auto chunk_buffer = TRY(WebIDL::get_buffer_source_copy(chunk.as_object()));
         TRY(m_input_stream->write_until_depleted(move(chunk_buffer)));
 
-        auto decompressed = TRY(ByteBuffer::create_uninitialized(4096));
-        auto size = TRY(m_decompressor.visit([&](auto const& decompressor) -> ErrorOr<size_t> {
-            return TRY(decompressor->read_some(decompressed.bytes())).size();
-        }));
-        return decompressed.slice(0, size);
+        // Keep decompressing until the decompressor has consumed all of the input. Reading just once would leave
+        // most of a large chunk buffered until the flush, at which point it all arrives as a single enqueue.
+        // NB: We must not read again once the input is depleted, as the decompressors treat a read from an empty
+        //     input stream that produces no output as truncated input.
+        ByteBuffer decompressed;
+        size_t decompressed_size = 0;
+
+        do {
+            if (decompressed_size == decompressed.size())
+                TRY(decompressed.try_resize(max(decompressed.size() * 2, 4096uz)));
+
+            auto remaining_input = m_input_stream->used_buffer_size();
+            auto output = TRY(m_decompressor.visit([&](auto const& decompressor) {
+                return decompressor->read_some(decompressed.bytes().slice(decompressed_size));
+            }));
+            decompressed_size += output.size();
+
+            if (output.is_empty() && m_input_stream->used_buffer_size() == remaining_input)
+                break;
+        } while (!m_input_stream->is_eof());
+
+        decompressed.trim(decompressed_size, false);
+        return decompressed;
     }();
     if (maybe_buffer.is_error())
         return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, Utf16String::formatted("Unable to decompress chunk: {}", maybe_buffer.error()) };
@@ -25,6 +25,14 @@ struct ContentBlockerEngine {
     generic_selector_list_rules: GenericSelectorListRules,
 }
 
+// Snapshots are only ever read back by the build that wrote them. Bump the version whenever the layout below or the
+// contents of the engine change, so that stale snapshots are rebuilt instead of misread.
+const SNAPSHOT_MAGIC: &[u8; 8] = b"LBCBSNAP";
+const SNAPSHOT_FORMAT_VERSION: u32 = 1;
+const SNAPSHOT_HEADER_SIZE: usize = SNAPSHOT_MAGIC.len() + size_of::<u32>() + size_of::<u8>() + size_of::<u64>();
+
+type SerializedGenericSelectorListRules = (HashSet<String>, HashMap<String, Vec<String>>, HashMap<String, Vec<String>>);
+
 #[derive(Default)]
 struct GenericSelectorListRules {
     always_needed: HashSet<String>,
@@ -77,14 +85,18 @@ unsafe fn engine_from_raw<'a>(engine: *const c_void) -> Option<&'a ContentBlocke
 }
 
 fn string_to_ffi(string: String) -> ContentBlockerString {
-    if string.is_empty() {
+    bytes_to_ffi(string.into_bytes())
+}
+
+fn bytes_to_ffi(bytes: Vec<u8>) -> ContentBlockerString {
+    if bytes.is_empty() {
         return ContentBlockerString {
             data: std::ptr::null_mut(),
             length: 0,
         };
     }
 
-    let bytes = Box::leak(string.into_bytes().into_boxed_slice());
+    let bytes = Box::leak(bytes.into_boxed_slice());
     let data = bytes.as_mut_ptr();
     let length = bytes.len();
 
@@ -300,6 +312,67 @@ impl GenericSelectorListRules {
     }
 }
 
+fn is_compatible_snapshot(snapshot: &[u8]) -> bool {
+    snapshot.len() >= SNAPSHOT_HEADER_SIZE
+        && snapshot.starts_with(SNAPSHOT_MAGIC)
+        && snapshot[SNAPSHOT_MAGIC.len()..SNAPSHOT_MAGIC.len() + size_of::<u32>()] == SNAPSHOT_FORMAT_VERSION.to_le_bytes()
+}
+
+// Layout: magic, format version, cosmetic rules flag, engine length, engine, generic selector list rules as JSON.
+fn serialize_snapshot(engine: &ContentBlockerEngine, has_cosmetic_rules: bool) -> Option<Vec<u8>> {
+    let serialized_engine = engine.engine.serialize();
+    let selector_list_rules = &engine.generic_selector_list_rules;
+    let serialized_selector_list_rules = serde_json::to_vec(&(
+        &selector_list_rules.always_needed,
+        &selector_list_rules.by_class,
+        &selector_list_rules.by_id,
+    ))
+    .ok()?;
+
+    let mut snapshot =
+        Vec::with_capacity(SNAPSHOT_HEADER_SIZE + serialized_engine.len() + serialized_selector_list_rules.len());
+    snapshot.extend_from_slice(SNAPSHOT_MAGIC);
+    snapshot.extend_from_slice(&SNAPSHOT_FORMAT_VERSION.to_le_bytes());
+    snapshot.push(u8::from(has_cosmetic_rules));
+    snapshot.extend_from_slice(&(serialized_engine.len() as u64).to_le_bytes());
+    snapshot.extend_from_slice(&serialized_engine);
+    snapshot.extend_from_slice(&serialized_selector_list_rules);
+    Some(snapshot)
+}
+
+fn deserialize_snapshot(snapshot: &[u8]) -> Option<(ContentBlockerEngine, bool)> {
+    if !is_compatible_snapshot(snapshot) {
+        return None;
+    }
+
+    let mut offset = SNAPSHOT_MAGIC.len() + size_of::<u32>();
+    let has_cosmetic_rules = snapshot[offset] != 0;
+    offset += size_of::<u8>();
+
+    let engine_length = u64::from_le_bytes(snapshot[offset..offset + size_of::<u64>()].try_into().ok()?);
+    offset += size_of::<u64>();
+
+    let engine_end = offset.checked_add(usize::try_from(engine_length).ok()?)?;
+    let serialized_engine = snapshot.get(offset..engine_end)?;
+    let serialized_selector_list_rules = snapshot.get(engine_end..)?;
+
+    let mut engine = adblock::engine::Engine::default();
+    engine.deserialize(serialized_engine).ok()?;
+
+    let (always_needed, by_class, by_id) =
+        serde_json::from_slice::<SerializedGenericSelectorListRules>(serialized_selector_list_rules).ok()?;
+
+    let engine = ContentBlockerEngine {
+        engine,
+        generic_selector_list_rules: GenericSelectorListRules {
+            always_needed,
+            by_class,
+            by_id,
+        },
+    };
+    Some((engine, has_cosmetic_rules))
+}
+
 fn cosmetic_css_for_url(engine: &ContentBlockerEngine, url: &str, classes: &[&str], ids: &[&str]) -> String {
     let resources = engine.engine.url_cosmetic_resources(url);
     let mut selectors = resources.hide_selectors;
@@ -390,6 +463,57 @@ pub unsafe extern "C" fn rust_content_blocker_create(rules: *const u8, rules_len
     })
 }
 
+/// # Safety
+/// - `snapshot` and `snapshot_len` must point to valid bytes
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn rust_content_blocker_is_compatible_snapshot(snapshot: *const u8, snapshot_len: usize) -> bool {
+    abort_on_panic(|| {
+        let Some(snapshot) = (unsafe { bytes_from_raw(snapshot, snapshot_len) }) else {
+            return false;
+        };
+        is_compatible_snapshot(snapshot)
+    })
+}
+
+/// # Safety
+/// - `engine` must be null or a valid pointer returned by `rust_content_blocker_create`
+/// - The returned bytes must be freed with `rust_content_blocker_free_string`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn rust_content_blocker_serialize(
+    engine: *const c_void,
+    has_cosmetic_rules: bool,
+) -> ContentBlockerString {
+    abort_on_panic(|| {
+        let Some(engine) = (unsafe { engine_from_raw(engine) }) else {
+            return bytes_to_ffi(Vec::new());
+        };
+        bytes_to_ffi(serialize_snapshot(engine, has_cosmetic_rules).unwrap_or_default())
+    })
+}
+
+/// # Safety
+/// - `snapshot` and `snapshot_len` must point to bytes returned by `rust_content_blocker_serialize`
+/// - `has_cosmetic_rules` must be a valid pointer
+/// - The returned pointer must be freed with `rust_content_blocker_free`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn rust_content_blocker_deserialize(
+    snapshot: *const u8,
+    snapshot_len: usize,
+    has_cosmetic_rules: *mut bool,
+) -> *mut c_void {
+    abort_on_panic(|| {
+        let Some(snapshot) = (unsafe { bytes_from_raw(snapshot, snapshot_len) }) else {
+            return std::ptr::null_mut();
+        };
+        let Some((engine, snapshot_has_cosmetic_rules)) = deserialize_snapshot(snapshot) else {
+            return std::ptr::null_mut();
+        };
+
+        unsafe { *has_cosmetic_rules = snapshot_has_cosmetic_rules };
+        Box::into_raw(Box::new(engine)).cast()
+    })
+}
+
 /// # Safety
 /// - `engine` must be null or a valid pointer returned by `rust_content_blocker_create`
 #[unsafe(no_mangle)]
@@ -504,7 +628,8 @@ pub unsafe extern "C" fn rust_content_blocker_has_generic_cosmetic_selectors(
 }
 
 /// # Safety
-/// - `data` and `length` must match a string returned by `rust_content_blocker_cosmetic_css`
+/// - `data` and `length` must match a string returned by `rust_content_blocker_cosmetic_css` or
+///   `rust_content_blocker_serialize`
 #[unsafe(no_mangle)]
 pub unsafe extern "C" fn rust_content_blocker_free_string(data: *mut u8, length: usize) {
     abort_on_panic(|| {
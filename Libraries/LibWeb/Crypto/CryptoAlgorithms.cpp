@@ -292,6 +292,14 @@ static WebIDL::ExceptionOr<ByteBuffer> generate_random_key(JS::VM& vm, u16 const
     return key_buffer;
 }
 
+static WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> perform_off_thread_operation_now(JS::Realm& realm, AlgorithmMethods::OffThreadOperation<ByteBuffer> const& operation, ReadonlyBytes input)
+{
+    auto result = operation(input);
+    if (result.is_error())
+        return WebIDL::OperationError::create(realm, Utf16String::formatted("{}", result.error()));
+    return JS::ArrayBuffer::create(realm, result.release_value());
+}
+
 JS::ThrowCompletionOr<GC::Ref<JS::Object>> EncapsulatedKey::to_object(JS::Realm& realm)
 {
     auto object = JS::Object::create(realm, realm.intrinsics().object_prototype());
@@ -2531,6 +2539,12 @@ WebIDL::ExceptionOr<GC::Ref<JS::Object>> RSASSAPKCS1::export_key(Bindings::KeyFo
 
 // https://w3c.github.io/webcrypto/#aes-cbc-operations-encrypt
 WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> AesCbc::encrypt(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& plaintext)
+{
+    auto operation = TRY(encrypt_off_thread(params, key, plaintext));
+    return perform_off_thread_operation_now(m_realm, operation, plaintext);
+}
+
+WebIDL::ExceptionOr<AlgorithmMethods::OffThreadOperation<ByteBuffer>> AesCbc::encrypt_off_thread(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const&)
 {
     auto const& normalized_algorithm = static_cast<AesCbcParams const&>(params);
 
@@ -2538,21 +2552,30 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> AesCbc::encrypt(AlgorithmParams co
     if (normalized_algorithm.iv.size() != 16)
         return WebIDL::OperationError::create(m_realm, "IV to AES-CBC must be exactly 16 bytes"_utf16);
 
-    // 2. Let paddedPlaintext be the result of adding padding octets to the contents of plaintext according to the procedure defined in Section 10.3 of [RFC2315], step 2, with a value of k of 16.
-    // 3. Let ciphertext be the result of performing the CBC Encryption operation described in Section 6.2 of [NIST-SP800-38A] using AES as the block cipher, the contents of the iv member of normalizedAlgorithm as the IV input parameter and paddedPlaintext as the input plaintext.
-    auto key_bytes = key->handle().get<ByteBuffer>();
+    auto key_bytes = TRY_OR_THROW_OOM(m_realm->vm(), ByteBuffer::copy(key->handle().get<ByteBuffer>()));
+    auto iv = TRY_OR_THROW_OOM(m_realm->vm(), ByteBuffer::copy(normalized_algorithm.iv));
 
-    ::Crypto::Cipher::AESCBCCipher cipher(key_bytes);
-    auto maybe_ciphertext = cipher.encrypt(plaintext, normalized_algorithm.iv);
-    if (maybe_ciphertext.is_error())
-        return WebIDL::OperationError::create(m_realm, "Failed to encrypt"_utf16);
+    return OffThreadOperation<ByteBuffer> { [key_bytes = move(key_bytes), iv = move(iv)](ReadonlyBytes plaintext) -> ErrorOr<ByteBuffer> {
+        // 2. Let paddedPlaintext be the result of adding padding octets to the contents of plaintext according to the procedure defined in Section 10.3 of [RFC2315], step 2, with a value of k of 16.
+        // 3. Let ciphertext be the result of performing the CBC Encryption operation described in Section 6.2 of [NIST-SP800-38A] using AES as the block cipher, the contents of the iv member of normalizedAlgorithm as the IV input parameter and paddedPlaintext as the input plaintext.
+        ::Crypto::Cipher::AESCBCCipher cipher(key_bytes);
+        auto maybe_ciphertext = cipher.encrypt(plaintext, iv);
+        if (maybe_ciphertext.is_error())
+            return Error::from_string_literal("Failed to encrypt");
 
-    // 4. Return the result of creating an ArrayBuffer containing ciphertext.
-    return JS::ArrayBuffer::create(m_realm, maybe_ciphertext.release_value());
+        // 4. Return the result of creating an ArrayBuffer containing ciphertext.
+        return maybe_ciphertext.release_value();
+    } };
 }
 
 // https://w3c.github.io/webcrypto/#aes-cbc-operations-decrypt
 WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> AesCbc::decrypt(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& ciphertext)
+{
+    auto operation = TRY(decrypt_off_thread(params, key, ciphertext));
+    return perform_off_thread_operation_now(m_realm, operation, ciphertext);
+}
+
+WebIDL::ExceptionOr<AlgorithmMethods::OffThreadOperation<ByteBuffer>> AesCbc::decrypt_off_thread(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& ciphertext)
 {
     auto const& normalized_algorithm = static_cast<AesCbcParams const&>(params);
 
@@ -2564,17 +2587,22 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> AesCbc::decrypt(AlgorithmParams co
     if (ciphertext.is_empty() || ciphertext.size() % 16 != 0)
         return WebIDL::OperationError::create(m_realm, "Ciphertext length must be a multiple of 16 bytes"_utf16);
 
-    // 3. Let paddedPlaintext be the result of performing the CBC Decryption operation described in Section 6.2 of [NIST-SP800-38A] using AES as the block cipher, the iv member of normalizedAlgorithm as the IV input parameter and ciphertext as the input ciphertext.
-    // 4. Let p be the value of the last octet of paddedPlaintext.
-    // 5. If p is zero or greater than 16, or if any of the last p octets of paddedPlaintext have a value which is not p, then throw an OperationError.
-    // 6. Let plaintext be the result of removing p octets from the end of paddedPlaintext.
-    ::Crypto::Cipher::AESCBCCipher cipher(key->handle().get<ByteBuffer>());
-    auto maybe_plaintext = cipher.decrypt(ciphertext, normalized_algorithm.iv);
-    if (maybe_plaintext.is_error())
-        return WebIDL::OperationError::create(m_realm, "Failed to decrypt"_utf16);
+    auto key_bytes = TRY_OR_THROW_OOM(m_realm->vm(), ByteBuffer::copy(key->handle().get<ByteBuffer>()));
+    auto iv = TRY_OR_THROW_OOM(m_realm->vm(), ByteBuffer::copy(normalized_algorithm.iv));
 
-    // 7. Return plaintext.
-    return JS::ArrayBuffer::create(m_realm, maybe_plaintext.release_value());
+    return OffThreadOperation<ByteBuffer> { [key_bytes = move(key_bytes), iv = move(iv)](ReadonlyBytes ciphertext) -> ErrorOr<ByteBuffer> {
+        // 3. Let paddedPlaintext be the result of performing the CBC Decryption operation described in Section 6.2 of [NIST-SP800-38A] using AES as the block cipher, the iv member of normalizedAlgorithm as the IV input parameter and ciphertext as the input ciphertext.
+        // 4. Let p be the value of the last octet of paddedPlaintext.
+        // 5. If p is zero or greater than 16, or if any of the last p octets of paddedPlaintext have a value which is not p, then throw an OperationError.
+        // 6. Let plaintext be the result of removing p octets from the end of paddedPlaintext.
+        ::Crypto::Cipher::AESCBCCipher cipher(key_bytes);
+        auto maybe_plaintext = cipher.decrypt(ciphertext, iv);
+        if (maybe_plaintext.is_error())
+            return Error::from_string_literal("Failed to decrypt");
+
+        // 7. Return plaintext.
+        return maybe_plaintext.release_value();
+    } };
 }
 
 // https://w3c.github.io/webcrypto/#aes-cbc-operations-import-key
@@ -3079,11 +3107,16 @@ WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> AesCtr:
 
 // https://w3c.github.io/webcrypto/#aes-ctr-operations-encrypt
 WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> AesCtr::encrypt(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& plaintext)
+{
+    auto operation = TRY(encrypt_off_thread(params, key, plaintext));
+    return perform_off_thread_operation_now(m_realm, operation, plaintext);
+}
+
+WebIDL::ExceptionOr<AlgorithmMethods::OffThreadOperation<ByteBuffer>> AesCtr::encrypt_off_thread(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const&)
 {
     // 1. If the counter member of normalizedAlgorithm does not have length 16 bytes, then throw an OperationError.
     auto const& normalized_algorithm = static_cast<AesCtrParams const&>(params);
-    auto const& counter = normalized_algorithm.counter;
-    if (counter.size() != 16)
+    if (normalized_algorithm.counter.size() != 16)
         return WebIDL::OperationError::create(m_realm, "Invalid counter length"_utf16);
 
     // 2. If the length member of normalizedAlgorithm is zero or is greater than 128, then throw an OperationError.
@@ -3091,27 +3124,37 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> AesCtr::encrypt(AlgorithmParams co
     if (length == 0 || length > 128)
         return WebIDL::OperationError::create(m_realm, "Invalid length"_utf16);
 
-    // 3. Let ciphertext be the result of performing the CTR Encryption operation described in Section 6.5 of [NIST-SP800-38A] using
-    //    AES as the block cipher,
-    //    the contents of the counter member of normalizedAlgorithm as the initial value of the counter block,
-    //    the length member of normalizedAlgorithm as the input parameter m to the standard counter block incrementing function defined in Appendix B.1 of [NIST-SP800-38A]
-    //    and the contents of plaintext as the input plaintext.
-    ::Crypto::Cipher::AESCTRCipher cipher(key->handle().get<ByteBuffer>());
-    auto maybe_ciphertext = cipher.encrypt(plaintext, counter);
-    if (maybe_ciphertext.is_error())
-        return WebIDL::OperationError::create(m_realm, "Encryption failed"_utf16);
+    auto key_bytes = TRY_OR_THROW_OOM(m_realm->vm(), ByteBuffer::copy(key->handle().get<ByteBuffer>()));
+    auto counter = TRY_OR_THROW_OOM(m_realm->vm(), ByteBuffer::copy(normalized_algorithm.counter));
 
-    // 4. Return the result of creating an ArrayBuffer containing plaintext.
-    return JS::ArrayBuffer::create(m_realm, maybe_ciphertext.release_value());
+    return OffThreadOperation<ByteBuffer> { [key_bytes = move(key_bytes), counter = move(counter)](ReadonlyBytes plaintext) -> ErrorOr<ByteBuffer> {
+        // 3. Let ciphertext be the result of performing the CTR Encryption operation described in Section 6.5 of [NIST-SP800-38A] using
+        //    AES as the block cipher,
+        //    the contents of the counter member of normalizedAlgorithm as the initial value of the counter block,
+        //    the length member of normalizedAlgorithm as the input parameter m to the standard counter block incrementing function defined in Appendix B.1 of [NIST-SP800-38A]
+        //    and the contents of plaintext as the input plaintext.
+        ::Crypto::Cipher::AESCTRCipher cipher(key_bytes);
+        auto maybe_ciphertext = cipher.encrypt(plaintext, counter);
+        if (maybe_ciphertext.is_error())
+            return Error::from_string_literal("Encryption failed");
+
+        // 4. Return the result of creating an ArrayBuffer containing plaintext.
+        return maybe_ciphertext.release_value();
+    } };
 }
 
 // https://w3c.github.io/webcrypto/#aes-ctr-operations-decrypt
 WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> AesCtr::decrypt(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& ciphertext)
+{
+    auto operation = TRY(decrypt_off_thread(params, key, ciphertext));
+    return perform_off_thread_operation_now(m_realm, operation, ciphertext);
+}
+
+WebIDL::ExceptionOr<AlgorithmMethods::OffThreadOperation<ByteBuffer>> AesCtr::decrypt_off_thread(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const&)
 {
     // 1. If the counter member of normalizedAlgorithm does not have length 16 bytes, then throw an OperationError.
     auto const& normalized_algorithm = static_cast<AesCtrParams const&>(params);
-    auto const& counter = normalized_algorithm.counter;
-    if (counter.size() != 16)
+    if (normalized_algorithm.counter.size() != 16)
         return WebIDL::OperationError::create(m_realm, "Invalid counter length"_utf16);
 
     // 2. If the length member of normalizedAlgorithm is zero or is greater than 128, then throw an OperationError.
@@ -3119,18 +3162,23 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> AesCtr::decrypt(AlgorithmParams co
     if (length == 0 || length > 128)
         return WebIDL::OperationError::create(m_realm, "Invalid length"_utf16);
 
-    // 3. Let plaintext be the result of performing the CTR Decryption operation described in Section 6.5 of [NIST-SP800-38A] using
-    //    AES as the block cipher,
-    //    the contents of the counter member of normalizedAlgorithm as the initial value of the counter block,
-    //    the length member of normalizedAlgorithm as the input parameter m to the standard counter block incrementing function defined in Appendix B.1 of [NIST-SP800-38A]
-    //    and the contents of ciphertext as the input ciphertext.
-    ::Crypto::Cipher::AESCTRCipher cipher(key->handle().get<ByteBuffer>());
-    auto maybe_plaintext = cipher.decrypt(ciphertext, counter);
-    if (maybe_plaintext.is_error())
-        return WebIDL::OperationError::create(m_realm, "Decryption failed"_utf16);
+    auto key_bytes = TRY_OR_THROW_OOM(m_realm->vm(), ByteBuffer::copy(key->handle().get<ByteBuffer>()));
+    auto counter = TRY_OR_THROW_OOM(m_realm->vm(), ByteBuffer::copy(normalized_algorithm.counter));
 
-    // 4. Return the result of creating an ArrayBuffer containing plaintext.
-    return JS::ArrayBuffer::create(m_realm, maybe_plaintext.release_value());
+    return OffThreadOperation<ByteBuffer> { [key_bytes = move(key_bytes), counter = move(counter)](ReadonlyBytes ciphertext) -> ErrorOr<ByteBuffer> {
+        // 3. Let plaintext be the result of performing the CTR Decryption operation described in Section 6.5 of [NIST-SP800-38A] using
+        //    AES as the block cipher,
+        //    the contents of the counter member of normalizedAlgorithm as the initial value of the counter block,
+        //    the length member of normalizedAlgorithm as the input parameter m to the standard counter block incrementing function defined in Appendix B.1 of [NIST-SP800-38A]
+        //    and the contents of ciphertext as the input ciphertext.
+        ::Crypto::Cipher::AESCTRCipher cipher(key_bytes);
+        auto maybe_plaintext = cipher.decrypt(ciphertext, counter);
+        if (maybe_plaintext.is_error())
+            return Error::from_string_literal("Decryption failed");
+
+        // 4. Return the result of creating an ArrayBuffer containing plaintext.
+        return maybe_plaintext.release_value();
+    } };
 }
 
 // https://w3c.github.io/webcrypto/#aes-gcm-operations-get-key-length
@@ -3833,6 +3881,12 @@ WebIDL::ExceptionOr<GC::Ref<CryptoKey>> HKDF::import_key(AlgorithmParams const&,
 
 // https://w3c.github.io/webcrypto/#sha-operations-digest
 WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> SHA::digest(AlgorithmParams const& algorithm, ByteBuffer const& data)
+{
+    auto operation = TRY(digest_off_thread(algorithm, data));
+    return perform_off_thread_operation_now(m_realm, operation, data);
+}
+
+WebIDL::ExceptionOr<AlgorithmMethods::OffThreadOperation<ByteBuffer>> SHA::digest_off_thread(AlgorithmParams const& algorithm, ByteBuffer const&)
 {
     auto& algorithm_name = algorithm.name;
 
@@ -3855,15 +3909,13 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> SHA::digest(AlgorithmParams const&
         return WebIDL::NotSupportedError::create(m_realm, Utf16String::formatted("Invalid hash function '{}'", algorithm_name));
     }
 
-    ::Crypto::Hash::Manager hash { hash_kind };
-    hash.update(data);
-
-    auto digest = hash.digest();
-    auto result_buffer = ByteBuffer::copy(digest.immutable_data(), hash.digest_size());
-    if (result_buffer.is_error())
-        return WebIDL::OperationError::create(m_realm, "Failed to create result buffer"_utf16);
+    return OffThreadOperation<ByteBuffer> { [hash_kind](ReadonlyBytes data) -> ErrorOr<ByteBuffer> {
+        ::Crypto::Hash::Manager hash { hash_kind };
+        hash.update(data);
 
-    return JS::ArrayBuffer::create(m_realm, result_buffer.release_value());
+        auto digest = hash.digest();
+        return ByteBuffer::copy(digest.immutable_data(), hash.digest_size());
+    } };
 }
 
 // https://w3c.github.io/webcrypto/#ecdsa-operations-generate-key
@@ -6975,6 +7027,12 @@ WebIDL::ExceptionOr<JS::Value> HKDF::get_key_length(AlgorithmParams const&)
 
 // https://w3c.github.io/webcrypto/#pbkdf2-operations-derive-bits
 WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> PBKDF2::derive_bits(AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length_optional)
+{
+    auto operation = TRY(derive_bits_off_thread(params, key, length_optional));
+    return perform_off_thread_operation_now(m_realm, operation, {});
+}
+
+WebIDL::ExceptionOr<AlgorithmMethods::OffThreadOperation<ByteBuffer>> PBKDF2::derive_bits_off_thread(AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length_optional)
 {
     auto& realm = *m_realm;
     auto const& normalized_algorithm = static_cast<PBKDF2Params const&>(params);
@@ -6990,14 +7048,8 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> PBKDF2::derive_bits(AlgorithmParam
     // 3. Let prf be the MAC Generation function described in Section 4 of [FIPS-198-1] using the hash function described by the hash member of normalizedAlgorithm.
     auto const& hash_algorithm = TRY(normalized_algorithm.hash.name(realm.vm()));
 
-    // 4. Let result be the result of performing the PBKDF2 operation defined in Section 5.2 of [RFC8018]
-    // using prf as the pseudo-random function, PRF,
-    // the password represented by [[handle]] internal slot of key as the password, P,
-    // the contents of the salt attribute of normalizedAlgorithm as the salt, S,
-    // the value of the iterations attribute of normalizedAlgorithm as the iteration count, c,
-    // and length divided by 8 as the intended key length, dkLen.
-    auto password = key->handle().get<ByteBuffer>();
-    auto salt = normalized_algorithm.salt;
+    auto password = TRY_OR_THROW_OOM(realm.vm(), ByteBuffer::copy(key->handle().get<ByteBuffer>()));
+    auto salt = TRY_OR_THROW_OOM(realm.vm(), ByteBuffer::copy(normalized_algorithm.salt));
     auto iterations = normalized_algorithm.iterations;
     auto derived_key_length_bytes = *length_optional / 8;
 
@@ -7013,15 +7065,23 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> PBKDF2::derive_bits(AlgorithmParam
         return WebIDL::NotSupportedError::create(m_realm, Utf16String::formatted("Invalid hash function '{}'", hash_algorithm));
     }());
 
-    ::Crypto::Hash::PBKDF2 pbkdf2(hash_kind);
-    auto maybe_result = pbkdf2.derive_key(password, salt, iterations, derived_key_length_bytes);
-
-    // 5. If the key derivation operation fails, then throw an OperationError.
-    if (maybe_result.is_error())
-        return WebIDL::OperationError::create(realm, "Failed to derive key"_utf16);
+    return OffThreadOperation<ByteBuffer> { [hash_kind, password = move(password), salt = move(salt), iterations, derived_key_length_bytes](ReadonlyBytes) -> ErrorOr<ByteBuffer> {
+        // 4. Let result be the result of performing the PBKDF2 operation defined in Section 5.2 of [RFC8018]
+        // using prf as the pseudo-random function, PRF,
+        // the password represented by [[handle]] internal slot of key as the password, P,
+        // the contents of the salt attribute of normalizedAlgorithm as the salt, S,
+        // the value of the iterations attribute of normalizedAlgorithm as the iteration count, c,
+        // and length divided by 8 as the intended key length, dkLen.
+        ::Crypto::Hash::PBKDF2 pbkdf2(hash_kind);
+        auto maybe_result = pbkdf2.derive_key(password, salt, iterations, derived_key_length_bytes);
+
+        // 5. If the key derivation operation fails, then throw an OperationError.
+        if (maybe_result.is_error())
+            return Error::from_string_literal("Failed to derive key");
 
-    // 6. Return result
-    return JS::ArrayBuffer::create(realm, maybe_result.release_value());
+        // 6. Return result
+        return maybe_result.release_value();
+    } };
 }
 
 // https://w3c.github.io/webcrypto/#pbkdf2-operations-get-key-length
@@ -8085,23 +8145,18 @@ WebIDL::ExceptionOr<GC::Ref<CryptoKey>> X448::import_key(
     return WebIDL::NotSupportedError::create(m_realm, "Invalid key format"_utf16);
 }
 
-static WebIDL::ExceptionOr<ByteBuffer> hmac_calculate_message_digest(JS::Realm& realm, GC::Ptr<KeyAlgorithm> hash, ReadonlyBytes key, ReadonlyBytes message)
+static WebIDL::ExceptionOr<::Crypto::Hash::HashKind> hmac_hash_kind(JS::Realm& realm, GC::Ptr<KeyAlgorithm> hash)
 {
     auto hash_name = hash->name();
-    auto hash_kind = TRY([&] -> WebIDL::ExceptionOr<::Crypto::Hash::HashKind> {
-        if (hash_name == "SHA-1"sv)
-            return ::Crypto::Hash::HashKind::SHA1;
-        if (hash_name == "SHA-256"sv)
-            return ::Crypto::Hash::HashKind::SHA256;
-        if (hash_name == "SHA-384"sv)
-            return ::Crypto::Hash::HashKind::SHA384;
-        if (hash_name == "SHA-512"sv)
-            return ::Crypto::Hash::HashKind::SHA512;
-        return WebIDL::NotSupportedError::create(realm, Utf16String::formatted("Invalid hash function '{}'", hash_name));
-    }());
-
-    ::Crypto::Authentication::HMAC hmac(hash_kind, key);
-    return hmac.process(message);
+    if (hash_name == "SHA-1"sv)
+        return ::Crypto::Hash::HashKind::SHA1;
+    if (hash_name == "SHA-256"sv)
+        return ::Crypto::Hash::HashKind::SHA256;
+    if (hash_name == "SHA-384"sv)
+        return ::Crypto::Hash::HashKind::SHA384;
+    if (hash_name == "SHA-512"sv)
+        return ::Crypto::Hash::HashKind::SHA512;
+    return WebIDL::NotSupportedError::create(realm, Utf16String::formatted("Invalid hash function '{}'", hash_name));
 }
 
 static WebIDL::ExceptionOr<WebIDL::UnsignedLong> hmac_hash_block_size(JS::Realm& realm, HashAlgorithmIdentifier hash)
@@ -8119,33 +8174,55 @@ static WebIDL::ExceptionOr<WebIDL::UnsignedLong> hmac_hash_block_size(JS::Realm&
 }
 
 // https://w3c.github.io/webcrypto/#hmac-operations-sign
-WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> HMAC::sign(AlgorithmParams const&, GC::Ref<CryptoKey> key, ByteBuffer const& message)
+WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> HMAC::sign(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& message)
+{
+    auto operation = TRY(sign_off_thread(params, key, message));
+    return perform_off_thread_operation_now(m_realm, operation, message);
+}
+
+WebIDL::ExceptionOr<AlgorithmMethods::OffThreadOperation<ByteBuffer>> HMAC::sign_off_thread(AlgorithmParams const&, GC::Ref<CryptoKey> key, ByteBuffer const&)
 {
-    // 1. Let mac be the result of performing the MAC Generation operation described in Section 4 of
-    //    [FIPS-198-1] using the key represented by [[handle]] internal slot of key, the hash
-    //    function identified by the hash attribute of the [[algorithm]] internal slot of key and
-    //    message as the input data text.
-    auto const& key_data = key->handle().get<ByteBuffer>();
     auto const& algorithm = as<HmacKeyAlgorithm>(*key->algorithm());
-    auto mac = TRY(hmac_calculate_message_digest(m_realm, algorithm.hash(), key_data.bytes(), message.bytes()));
+    auto hash_kind = TRY(hmac_hash_kind(m_realm, algorithm.hash()));
+    auto key_data = TRY_OR_THROW_OOM(m_realm->vm(), ByteBuffer::copy(key->handle().get<ByteBuffer>()));
 
-    // 2. Return the result of creating an ArrayBuffer containing mac.
-    return JS::ArrayBuffer::create(m_realm, move(mac));
+    return OffThreadOperation<ByteBuffer> { [hash_kind, key_data = move(key_data)](ReadonlyBytes message) -> ErrorOr<ByteBuffer> {
+        // 1. Let mac be the result of performing the MAC Generation operation described in Section 4 of
+        //    [FIPS-198-1] using the key represented by [[handle]] internal slot of key, the hash
+        //    function identified by the hash attribute of the [[algorithm]] internal slot of key and
+        //    message as the input data text.
+        ::Crypto::Authentication::HMAC hmac(hash_kind, key_data);
+
+        // 2. Return the result of creating an ArrayBuffer containing mac.
+        return hmac.process(message);
+    } };
 }
 
 // https://w3c.github.io/webcrypto/#hmac-operations-verify
-WebIDL::ExceptionOr<JS::Value> HMAC::verify(AlgorithmParams const&, GC::Ref<CryptoKey> key, ByteBuffer const& signature, ByteBuffer const& message)
+WebIDL::ExceptionOr<JS::Value> HMAC::verify(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& signature, ByteBuffer const& message)
 {
-    // 1. Let mac be the result of performing the MAC Generation operation described in Section 4 of
-    //    [FIPS-198-1] using the key represented by [[handle]] internal slot of key, the hash
-    //    function identified by the hash attribute of the [[algorithm]] internal slot of key and
-    //    message as the input data text.
-    auto const& key_data = key->handle().get<ByteBuffer>();
-    auto const& algorithm = as<HmacKeyAlgorithm>(*key->algorithm());
-    auto mac = TRY(hmac_calculate_message_digest(m_realm, algorithm.hash(), key_data.bytes(), message.bytes()));
+    auto operation = TRY(verify_off_thread(params, key, signature, message));
+    auto result = operation(message);
+    if (result.is_error())
+        return WebIDL::OperationError::create(m_realm, Utf16String::formatted("{}", result.error()));
+    return result.value();
+}
 
-    // 2. Return true if mac is equal to signature and false otherwise.
-    return mac == signature;
+WebIDL::ExceptionOr<AlgorithmMethods::OffThreadOperation<bool>> HMAC::verify_off_thread(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& signature, ByteBuffer const& message)
+{
+    auto sign_operation = TRY(sign_off_thread(params, key, message));
+    auto expected_signature = TRY_OR_THROW_OOM(m_realm->vm(), ByteBuffer::copy(signature));
+
+    return OffThreadOperation<bool> { [sign_operation = move(sign_operation), expected_signature = move(expected_signature)](ReadonlyBytes message) -> ErrorOr<bool> {
+        // 1. Let mac be the result of performing the MAC Generation operation described in Section 4 of
+        //    [FIPS-198-1] using the key represented by [[handle]] internal slot of key, the hash
+        //    function identified by the hash attribute of the [[algorithm]] internal slot of key and
+        //    message as the input data text.
+        auto mac = TRY(sign_operation(message));
+
+        // 2. Return true if mac is equal to signature and false otherwise.
+        return mac == expected_signature;
+    } };
 }
 
 // https://w3c.github.io/webcrypto/#hmac-operations-generate-key
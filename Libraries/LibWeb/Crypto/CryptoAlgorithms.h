@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AK/EnumBits.h>
+#include <AK/Function.h>
 #include <AK/String.h>
 #include <AK/Utf16String.h>
 #include <LibCrypto/BigInt/UnsignedBigInteger.h>
@@ -318,6 +319,21 @@ class AlgorithmMethods {
 public:
     virtual ~AlgorithmMethods();
 
+    // The part of an operation that does not touch the JS heap, so that it can be performed on the thread pool. It is
+    // handed the operation's input, and an error it returns becomes an OperationError.
+    template<typename T>
+    using OffThreadOperation = Function<ErrorOr<T>(ReadonlyBytes)>;
+
+    // Algorithms whose operations may take a while on large inputs split them up here. Anything the operation would
+    // throw up front is thrown right away, and the rest is returned to be performed later. Algorithms that return a null
+    // function have the whole operation performed by the methods above instead.
+    virtual WebIDL::ExceptionOr<OffThreadOperation<ByteBuffer>> encrypt_off_thread(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) { return OffThreadOperation<ByteBuffer> {}; }
+    virtual WebIDL::ExceptionOr<OffThreadOperation<ByteBuffer>> decrypt_off_thread(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) { return OffThreadOperation<ByteBuffer> {}; }
+    virtual WebIDL::ExceptionOr<OffThreadOperation<ByteBuffer>> sign_off_thread(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) { return OffThreadOperation<ByteBuffer> {}; }
+    virtual WebIDL::ExceptionOr<OffThreadOperation<bool>> verify_off_thread(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&, ByteBuffer const&) { return OffThreadOperation<bool> {}; }
+    virtual WebIDL::ExceptionOr<OffThreadOperation<ByteBuffer>> digest_off_thread(AlgorithmParams const&, ByteBuffer const&) { return OffThreadOperation<ByteBuffer> {}; }
+    virtual WebIDL::ExceptionOr<OffThreadOperation<ByteBuffer>> derive_bits_off_thread(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>) { return OffThreadOperation<ByteBuffer> {}; }
+
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> encrypt(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&)
     {
         return WebIDL::NotSupportedError::create(m_realm, "encrypt is not supported"_utf16);
@@ -460,6 +476,8 @@ class AesCbc : public AlgorithmMethods {
 public:
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> encrypt(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> decrypt(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<OffThreadOperation<ByteBuffer>> encrypt_off_thread(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<OffThreadOperation<ByteBuffer>> decrypt_off_thread(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
     virtual WebIDL::ExceptionOr<GC::Ref<CryptoKey>> import_key(AlgorithmParams const&, Bindings::KeyFormat, CryptoKey::ImportKeyData, bool, Vector<Bindings::KeyUsage> const&) override;
     virtual WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> generate_key(AlgorithmParams const&, bool, Vector<Bindings::KeyUsage> const&) override;
     virtual WebIDL::ExceptionOr<GC::Ref<JS::Object>> export_key(Bindings::KeyFormat, GC::Ref<CryptoKey>) override;
@@ -482,6 +500,8 @@ public:
     virtual WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> generate_key(AlgorithmParams const&, bool, Vector<Bindings::KeyUsage> const&) override;
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> encrypt(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> decrypt(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<OffThreadOperation<ByteBuffer>> encrypt_off_thread(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<OffThreadOperation<ByteBuffer>> decrypt_off_thread(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
 
     static NonnullOwnPtr<AlgorithmMethods> create(JS::Realm& realm) { return adopt_own(*new AesCtr(realm)); }
 
@@ -547,6 +567,7 @@ class PBKDF2 : public AlgorithmMethods {
 public:
     virtual WebIDL::ExceptionOr<GC::Ref<CryptoKey>> import_key(AlgorithmParams const&, Bindings::KeyFormat, CryptoKey::ImportKeyData, bool, Vector<Bindings::KeyUsage> const&) override;
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> derive_bits(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>) override;
+    virtual WebIDL::ExceptionOr<OffThreadOperation<ByteBuffer>> derive_bits_off_thread(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>) override;
     virtual WebIDL::ExceptionOr<JS::Value> get_key_length(AlgorithmParams const&) override;
 
     static NonnullOwnPtr<AlgorithmMethods> create(JS::Realm& realm) { return adopt_own(*new PBKDF2(realm)); }
@@ -561,6 +582,7 @@ private:
 class SHA : public AlgorithmMethods {
 public:
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> digest(AlgorithmParams const&, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<OffThreadOperation<ByteBuffer>> digest_off_thread(AlgorithmParams const&, ByteBuffer const&) override;
 
     static NonnullOwnPtr<AlgorithmMethods> create(JS::Realm& realm) { return adopt_own(*new SHA(realm)); }
 
@@ -677,6 +699,8 @@ class HMAC : public AlgorithmMethods {
 public:
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> sign(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
     virtual WebIDL::ExceptionOr<JS::Value> verify(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<OffThreadOperation<ByteBuffer>> sign_off_thread(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<OffThreadOperation<bool>> verify_off_thread(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&, ByteBuffer const&) override;
     virtual WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> generate_key(AlgorithmParams const&, bool, Vector<Bindings::KeyUsage> const&) override;
     virtual WebIDL::ExceptionOr<GC::Ref<CryptoKey>> import_key(AlgorithmParams const&, Bindings::KeyFormat, CryptoKey::ImportKeyData, bool, Vector<Bindings::KeyUsage> const&) override;
     virtual WebIDL::ExceptionOr<GC::Ref<JS::Object>> export_key(Bindings::KeyFormat, GC::Ref<CryptoKey>) override;
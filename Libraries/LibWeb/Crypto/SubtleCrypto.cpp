@@ -9,10 +9,12 @@
 #include <AK/ByteBuffer.h>
 #include <AK/NeverDestroyed.h>
 #include <AK/QuickSort.h>
+#include <LibCore/EventLoop.h>
 #include <LibCrypto/Hash/HashManager.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/JSONObject.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <LibThreading/ThreadPool.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/SubtleCrypto.h>
@@ -32,6 +34,41 @@ static void normalize_key_usages(Vector<Bindings::KeyUsage>& key_usages)
     quick_sort(key_usages);
 }
 
+// Performs the part of an operation that an algorithm split off on the thread pool, so that large inputs do not hold up
+// the event loop. Once it is done, a global task on the crypto task source settles promise with its result.
+template<typename T>
+static void perform_operation_off_thread(JS::Realm& realm, GC::Ref<WebIDL::Promise> promise, AlgorithmMethods::OffThreadOperation<T> operation, ByteBuffer input)
+{
+    // Keep the callback on the origin thread so the GC roots it captures are also destroyed there.
+    auto* callback = new Function<void(ErrorOr<T>)>([realm = GC::make_root(realm), promise = GC::make_root(promise)](ErrorOr<T> result) mutable {
+        auto& heap = realm->heap();
+        HTML::queue_global_task(HTML::Task::Source::Crypto, realm->global_object(), GC::create_function(heap, [&realm = *realm, promise = GC::Ref { *promise }, result = move(result)]() mutable {
+            HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+
+            if (result.is_error()) {
+                WebIDL::reject_promise(realm, promise, WebIDL::OperationError::create(realm, Utf16String::formatted("{}", result.error())));
+                return;
+            }
+
+            if constexpr (IsSame<T, ByteBuffer>)
+                WebIDL::resolve_promise(realm, promise, JS::ArrayBuffer::create(realm, result.release_value()));
+            else
+                WebIDL::resolve_promise(realm, promise, JS::Value(result.release_value()));
+        }));
+    });
+    auto& origin_event_loop = Core::EventLoop::current();
+
+    Threading::ThreadPool::the().submit(
+        [operation = move(operation), input = move(input), callback, &origin_event_loop]() mutable {
+            auto result = operation(input);
+
+            origin_event_loop.deferred_invoke([callback, result = move(result)]() mutable {
+                (*callback)(move(result));
+                delete callback;
+            });
+        });
+}
+
 static JsonWebKey to_internal_json_web_key(Bindings::JsonWebKey bindings_jwk)
 {
     JsonWebKey jwk;
@@ -205,7 +242,7 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::encrypt(AlgorithmIdentifier const& algori
     auto promise = WebIDL::create_promise(realm);
 
     // 7. Return promise and perform the remaining steps in parallel.
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, &global, &heap, normalized_algorithm = normalized_algorithm.release_value(), promise, key, data = move(data)]() -> void {
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, &global, &heap, normalized_algorithm = normalized_algorithm.release_value(), promise, key, data = move(data)]() mutable {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::No);
 
         // 8. If the following steps or referenced procedures say to throw an error, queue a global task on the
@@ -230,6 +267,16 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::encrypt(AlgorithmIdentifier const& algori
         }
 
         // 11. Let ciphertext be the result of performing the encrypt operation specified by normalizedAlgorithm using algorithm and key and with data as plaintext.
+        auto off_thread_operation = normalized_algorithm.methods->encrypt_off_thread(*normalized_algorithm.parameter, key, data);
+        if (off_thread_operation.is_error()) {
+            throw_in_this_context(Bindings::exception_to_throw_completion(realm.vm(), off_thread_operation.release_error()).release_value());
+            return;
+        }
+        if (auto operation = off_thread_operation.release_value()) {
+            perform_operation_off_thread(realm, promise, move(operation), move(data));
+            return;
+        }
+
         auto cipher_text = normalized_algorithm.methods->encrypt(*normalized_algorithm.parameter, key, data);
         if (cipher_text.is_error()) {
             throw_in_this_context(Bindings::exception_to_throw_completion(realm.vm(), cipher_text.release_error()).release_value());
@@ -280,7 +327,7 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::decrypt(AlgorithmIdentifier const& algori
     auto promise = WebIDL::create_promise(realm);
 
     // 7. Return promise and perform the remaining steps in parallel.
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, &global, &heap, normalized_algorithm = normalized_algorithm.release_value(), promise, key, data = move(data)]() -> void {
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, &global, &heap, normalized_algorithm = normalized_algorithm.release_value(), promise, key, data = move(data)]() mutable {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::No);
 
         // 8. If the following steps or referenced procedures say to throw an error, queue a global task on the
@@ -305,6 +352,16 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::decrypt(AlgorithmIdentifier const& algori
         }
 
         // 11. Let plaintext be the result of performing the decrypt operation specified by normalizedAlgorithm using key and algorithm and with data as ciphertext.
+        auto off_thread_operation = normalized_algorithm.methods->decrypt_off_thread(*normalized_algorithm.parameter, key, data);
+        if (off_thread_operation.is_error()) {
+            throw_in_this_context(Bindings::exception_to_throw_completion(realm.vm(), off_thread_operation.release_error()).release_value());
+            return;
+        }
+        if (auto operation = off_thread_operation.release_value()) {
+            perform_operation_off_thread(realm, promise, move(operation), move(data));
+            return;
+        }
+
         auto plain_text = normalized_algorithm.methods->decrypt(*normalized_algorithm.parameter, key, data);
         if (plain_text.is_error()) {
             throw_in_this_context(Bindings::exception_to_throw_completion(realm.vm(), plain_text.release_error()).release_value());
@@ -356,7 +413,7 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::digest(AlgorithmIdentifier const& algorit
     auto promise = WebIDL::create_promise(realm);
 
     // 7. Return promise and perform the remaining steps in parallel.
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, &global, &heap, algorithm_object = normalized_algorithm.release_value(), promise, data_buffer = move(data_buffer)]() -> void {
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, &global, &heap, algorithm_object = normalized_algorithm.release_value(), promise, data_buffer = move(data_buffer)]() mutable {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::No);
 
         // 8. If the following steps or referenced procedures say to throw an error, queue a global task on the
@@ -369,6 +426,16 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::digest(AlgorithmIdentifier const& algorit
         };
 
         // 9. Let digest be the result of performing the digest operation specified by normalizedAlgorithm using algorithm, with data as message.
+        auto off_thread_operation = algorithm_object.methods->digest_off_thread(*algorithm_object.parameter, data_buffer);
+        if (off_thread_operation.is_error()) {
+            throw_in_this_context(Bindings::exception_to_throw_completion(realm.vm(), off_thread_operation.release_error()).release_value());
+            return;
+        }
+        if (auto operation = off_thread_operation.release_value()) {
+            perform_operation_off_thread(realm, promise, move(operation), move(data_buffer));
+            return;
+        }
+
         auto digest = algorithm_object.methods->digest(*algorithm_object.parameter, data_buffer);
 
         if (digest.is_exception()) {
@@ -497,7 +564,7 @@ JS::ThrowCompletionOr<GC::Ref<WebIDL::Promise>> SubtleCrypto::import_key(Binding
     auto promise = WebIDL::create_promise(realm);
 
     // 8. Return promise and perform the remaining steps in parallel.
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(heap(), [&realm, real_key_data = move(real_key_data), normalized_algorithm = normalized_algorithm.release_value(), promise, format, extractable, key_usages = move(key_usages), algorithm = move(algorithm)]() mutable -> void {
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(heap(), [&realm, real_key_data = move(real_key_data), normalized_algorithm = normalized_algorithm.release_value(), promise, format, extractable, key_usages = move(key_usages), algorithm = move(algorithm)]() mutable {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
 
         // 9. If the following steps or referenced procedures say to throw an error, reject promise with the returned error and then terminate the algorithm.
@@ -636,6 +703,16 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::sign(AlgorithmIdentifier const& algorithm
 
         // 11. Let signature be the result of performing the sign operation specified by normalizedAlgorithm using key
         //     and algorithm and with data as message.
+        auto off_thread_operation = normalized_algorithm.methods->sign_off_thread(*normalized_algorithm.parameter, key, data);
+        if (off_thread_operation.is_error()) {
+            throw_in_this_context(Bindings::exception_to_throw_completion(realm.vm(), off_thread_operation.release_error()).release_value());
+            return;
+        }
+        if (auto operation = off_thread_operation.release_value()) {
+            perform_operation_off_thread(realm, promise, move(operation), move(data));
+            return;
+        }
+
         auto signature = normalized_algorithm.methods->sign(*normalized_algorithm.parameter, key, data);
         if (signature.is_error()) {
             throw_in_this_context(Bindings::exception_to_throw_completion(realm.vm(), signature.release_error()).release_value());
@@ -722,6 +799,16 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::verify(AlgorithmIdentifier const& algorit
 
         // 12. Let result be the result of performing the verify operation specified by normalizedAlgorithm using key,
         //     algorithm and signature and with data as message.
+        auto off_thread_operation = normalized_algorithm.methods->verify_off_thread(*normalized_algorithm.parameter, key, signature, data);
+        if (off_thread_operation.is_error()) {
+            throw_in_this_context(Bindings::exception_to_throw_completion(realm.vm(), off_thread_operation.release_error()).release_value());
+            return;
+        }
+        if (auto operation = off_thread_operation.release_value()) {
+            perform_operation_off_thread(realm, promise, move(operation), move(data));
+            return;
+        }
+
         auto result = normalized_algorithm.methods->verify(*normalized_algorithm.parameter, key, signature, data);
         if (result.is_error()) {
             throw_in_this_context(Bindings::exception_to_throw_completion(realm.vm(), result.release_error()).release_value());
@@ -774,6 +861,16 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::derive_bits(AlgorithmIdentifier algorithm
         }
 
         // 9. Let result be the result of creating an ArrayBuffer containing the result of performing the derive bits operation specified by normalizedAlgorithm using baseKey, algorithm and length.
+        auto off_thread_operation = normalized_algorithm.methods->derive_bits_off_thread(*normalized_algorithm.parameter, base_key, length_optional);
+        if (off_thread_operation.is_error()) {
+            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), off_thread_operation.release_error()).release_value());
+            return;
+        }
+        if (auto operation = off_thread_operation.release_value()) {
+            perform_operation_off_thread(realm, promise, move(operation), {});
+            return;
+        }
+
         auto result = normalized_algorithm.methods->derive_bits(*normalized_algorithm.parameter, base_key, length_optional);
         if (result.is_error()) {
             WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), result.release_error()).release_value());
@@ -819,7 +916,7 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::derive_key(AlgorithmIdentifier algorithm,
     auto promise = WebIDL::create_promise(realm);
 
     // 9. Return promise and perform the remaining steps in parallel.
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, &vm, normalized_algorithm = normalized_algorithm.release_value(), promise, normalized_derived_key_algorithm_import = normalized_derived_key_algorithm_import.release_value(), normalized_derived_key_algorithm_length = normalized_derived_key_algorithm_length.release_value(), base_key = move(base_key), extractable, key_usages = move(key_usages)]() mutable -> void {
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, &vm, normalized_algorithm = normalized_algorithm.release_value(), promise, normalized_derived_key_algorithm_import = normalized_derived_key_algorithm_import.release_value(), normalized_derived_key_algorithm_length = normalized_derived_key_algorithm_length.release_value(), base_key = move(base_key), extractable, key_usages = move(key_usages)]() mutable {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
         // 10. If the following steps or referenced procedures say to throw an error, reject promise with the returned error and then terminate the algorithm.
 
@@ -925,7 +1022,7 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::wrap_key(Bindings::KeyFormat format, GC::
     auto promise = WebIDL::create_promise(realm);
 
     // 7. Return promise and perform the remaining steps in parallel.
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, normalized_algorithm = move(normalized_algorithm), promise, wrapping_key = move(wrapping_key), key = move(key), format, operation]() mutable -> void {
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, normalized_algorithm = move(normalized_algorithm), promise, wrapping_key = move(wrapping_key), key = move(key), format, operation]() mutable {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
         // FIXME: 8. If the following steps or referenced procedures say to throw an error, queue a global task on the crypto task source, given realm's global object, to reject promise with the returned error; and then terminate the algorithm.
 
@@ -1089,7 +1186,7 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::unwrap_key(Bindings::KeyFormat format, We
     auto promise = WebIDL::create_promise(realm);
 
     // 10. Return promise and perform the remaining steps in parallel.
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, normalized_algorithm = move(normalized_algorithm), promise, unwrapping_key = unwrapping_key, real_wrapped_key = move(real_wrapped_key), operation, format, extractable, key_usages = move(key_usages), normalized_key_algorithm = move(normalized_key_algorithm)]() mutable -> void {
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, normalized_algorithm = move(normalized_algorithm), promise, unwrapping_key = unwrapping_key, real_wrapped_key = move(real_wrapped_key), operation, format, extractable, key_usages = move(key_usages), normalized_key_algorithm = move(normalized_key_algorithm)]() mutable {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
         // FIXME: 11. If the following steps or referenced procedures say to throw an error, queue a global task on the crypto task source, given realm's global object, to reject promise with the returned error; and then terminate the algorithm.
 
@@ -1232,7 +1329,7 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::encapsulate_key(AlgorithmIdentifier encap
     auto promise = WebIDL::create_promise(realm);
 
     // 8. Return promise and perform the remaining steps in parallel.
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(heap, [&realm, &global, &heap, normalized_encapsulation_algorithm = move(normalized_encapsulation_algorithm), encapsulation_key = encapsulation_key, promise, normalized_shared_key_algorithm = move(normalized_shared_key_algorithm), extractable, usages = move(key_usages)]() mutable -> void {
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(heap, [&realm, &global, &heap, normalized_encapsulation_algorithm = move(normalized_encapsulation_algorithm), encapsulation_key = encapsulation_key, promise, normalized_shared_key_algorithm = move(normalized_shared_key_algorithm), extractable, usages = move(key_usages)]() mutable {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
         // 9. If the following steps or referenced procedures say to throw an error, queue a global task on the crypto task
         //    source, given realm's global object, to reject promise with the returned error; and then terminate the algorithm.
@@ -1337,7 +1434,7 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::encapsulate_bits(AlgorithmIdentifier enca
     auto promise = WebIDL::create_promise(realm);
 
     // 6. Return promise and perform the remaining steps in parallel.
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(heap, [&realm, &global, &heap, normalized_encapsulation_algorithm = move(normalized_encapsulation_algorithm), promise, encapsulation_key = encapsulation_key]() mutable -> void {
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(heap, [&realm, &global, &heap, normalized_encapsulation_algorithm = move(normalized_encapsulation_algorithm), promise, encapsulation_key = encapsulation_key]() mutable {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
         // 7. If the following steps or referenced procedures say to throw an error, queue a global task on the crypto task
         //    source, given realm's global object, to reject promise with the returned error; and then terminate the algorithm.
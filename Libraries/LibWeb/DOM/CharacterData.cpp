@@ -152,7 +152,7 @@ WebIDL::ExceptionOr<void> CharacterData::replace_data(size_t offset, size_t coun
 
     // 12. If node’s parent is non-null, then run the children changed steps for node’s parent.
     if (auto* parent = this->parent()) {
-        ChildrenChangedMetadata metadata { ChildrenChangedMetadata::Type::Mutation, *this };
+        ChildrenChangedMetadata metadata { ChildrenChangedMetadata::Type::Mutation, *this, m_data.is_empty() != old_data.is_empty() };
         parent->children_changed(metadata);
     }
 
@@ -10,6 +10,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/Bitmap.h>
 #include <AK/CharacterTypes.h>
 #include <AK/Debug.h>
@@ -97,6 +98,7 @@
 #include <LibWeb/DOM/EditingHostManager.h>
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/DOM/ElementByIdMap.h>
+#include <LibWeb/DOM/ElementIndex.h>
 #include <LibWeb/DOM/ElementFactory.h>
 #include <LibWeb/DOM/Event.h>
 #include <LibWeb/DOM/HTMLCollection.h>
@@ -120,6 +122,7 @@
 #include <LibWeb/FileAPI/BlobURLStore.h>
 #include <LibWeb/HTML/AttributeNames.h>
 #include <LibWeb/HTML/BeforeUnloadEvent.h>
+#include <LibWeb/HTML/BitmapDecodedImageData.h>
 #include <LibWeb/HTML/BrowsingContext.h>
 #include <LibWeb/HTML/BrowsingContextGroup.h>
 #include <LibWeb/HTML/CustomElements/CustomElementDefinition.h>
@@ -188,12 +191,15 @@
 #include <LibWeb/Infra/Strings.h>
 #include <LibWeb/IntersectionObserver/IntersectionObserver.h>
 #include <LibWeb/Layout/BlockFormattingContext.h>
+#include <LibWeb/Layout/CanvasBox.h>
+#include <LibWeb/Layout/ImageBox.h>
 #include <LibWeb/Layout/SVGFormattingContext.h>
 #include <LibWeb/Layout/SVGSVGBox.h>
 #include <LibWeb/Layout/ScrollableOverflow.h>
 #include <LibWeb/Layout/TextNode.h>
 #include <LibWeb/Layout/TextOffsetMapping.h>
 #include <LibWeb/Layout/TreeBuilder.h>
+#include <LibWeb/Layout/VideoBox.h>
 #include <LibWeb/Layout/Viewport.h>
 #include <LibWeb/Loader/ContentBlocker.h>
 #include <LibWeb/Namespace.h>
@@ -206,9 +212,11 @@
 #include <LibWeb/Painting/DisplayListRecordingContext.h>
 #include <LibWeb/Painting/HitTestDisplayList.h>
 #include <LibWeb/Painting/Paintable.h>
+#include <LibWeb/Painting/PaintableWithLines.h>
 #include <LibWeb/Painting/StackingContext.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
+#include <LibWeb/Profiling/SamplingProfiler.h>
 #include <LibWeb/ResizeObserver/ResizeObserver.h>
 #include <LibWeb/ResizeObserver/ResizeObserverEntry.h>
 #include <LibWeb/SVG/SVGDecodedImageData.h>
@@ -265,6 +273,18 @@ static void dump_style_invalidation_counters(Document const& document)
         counters.has_match_invocations,
         counters.has_result_cache_hits,
         counters.has_result_cache_misses);
+
+    for (size_t index = 0; index < style_invalidation_reason_count; ++index) {
+        auto const& per_reason = counters.per_reason[index];
+        if (per_reason.invalidations == 0 && per_reason.nodes_marked == 0 && per_reason.elements_recomputed == 0)
+            continue;
+        dbgln("    {}: invalidations={}, nodesMarked={}, elementsRecomputed={}, elementsChanged={}",
+            to_string(static_cast<StyleInvalidationReason>(index)),
+            per_reason.invalidations,
+            per_reason.nodes_marked,
+            per_reason.elements_recomputed,
+            per_reason.elements_changed);
+    }
 }
 
 // https://html.spec.whatwg.org/multipage/origin.html#obtain-browsing-context-navigation
@@ -657,9 +677,11 @@ void Document::record_style_invalidation() const
     dump_style_invalidation_counters(*this);
 }
 
-void Document::record_full_style_invalidation() const
+void Document::record_full_style_invalidation(StyleInvalidationReason reason) const
 {
     ++m_style_invalidation_counters.full_style_invalidations;
+    if (!m_full_style_invalidation_reason.has_value())
+        m_full_style_invalidation_reason = reason;
 
     if (!s_style_invalidation_counter_dump_interval.has_value())
         return;
@@ -792,6 +814,8 @@ void Document::visit_edges(Cell::Visitor& visitor)
         visitor.visit(form_associated_element->form_associated_element_to_html_element());
 
     visitor.visit(m_potentially_named_elements);
+    if (m_element_index)
+        m_element_index->visit_edges(visitor);
     m_anchor_name_map.visit_edges(visitor);
     if (m_query_selector_result_cache)
         m_query_selector_result_cache->visit_edges(visitor);
@@ -1468,6 +1492,17 @@ void Document::tear_down_layout_tree_for_svg_image_document(Badge<SVG::SVGDecode
     tear_down_layout_tree();
 }
 
+void Document::tear_down_layout_tree_for_memory_pressure()
+{
+    if (!m_layout_root)
+        return;
+    dbgln_if(UPDATE_LAYOUT_DEBUG, "DROP TREE {}", to_string(InvalidateLayoutTreeReason::MemoryPressure));
+
+    // NB: DOM nodes keep pointers to their layout nodes until the tree is rebuilt, which would keep the old tree alive.
+    clear_layout_and_paintable_nodes_for_inactive_document();
+    tear_down_layout_tree();
+}
+
 void Document::clear_layout_and_paintable_nodes_for_inactive_document()
 {
     for_each_in_inclusive_subtree([&](auto& node) {
@@ -1720,8 +1755,22 @@ Optional<URL::URL> Document::encoding_parse_url(Utf16View url) const
     // 4. Let baseURL be environment's base URL, if environment is a Document object; otherwise environment's API base URL.
     auto base_url = this->base_url();
 
+    if (m_encoding_parsed_url_cache_base_url != base_url || m_encoding_parsed_url_cache_encoding != encoding || m_encoding_parsed_url_cache.size() >= MAX_ENCODING_PARSED_URL_CACHE_SIZE) {
+        m_encoding_parsed_url_cache.clear();
+        m_encoding_parsed_url_cache_base_url = base_url;
+        m_encoding_parsed_url_cache_encoding = encoding;
+    } else if (auto cached_url = m_encoding_parsed_url_cache.get(url); cached_url.has_value()) {
+        return cached_url.release_value();
+    }
+
     // 5. Return the result of applying the URL parser to url, with baseURL and encoding.
-    return DOMURL::parse(url, base_url, encoding.utf16_view());
+    auto parsed_url = DOMURL::parse(url, base_url, encoding.utf16_view());
+
+    // NB: Blob URLs are not cached, as their blob URL entry is looked up at parse time and may since have been revoked.
+    if (!parsed_url.has_value() || parsed_url->scheme() != "blob"sv)
+        m_encoding_parsed_url_cache.set(Utf16String::from_utf16(url), parsed_url);
+
+    return parsed_url;
 }
 
 // https://html.spec.whatwg.org/multipage/urls-and-fetching.html#encoding-parsing-and-serializing-a-url
@@ -1820,6 +1869,16 @@ static void relayout_subtree(Layout::Box& subtree_root, Painting::Paintable& old
         Layout::FormattingContext::layout_absolutely_positioned_element_from_saved_inputs(layout_state, subtree_root);
     else
         compute_subtree_layout(subtree_root, layout_state, old_paintable);
+
+    // An in-flow contained boundary keeps its frozen geometry, but the baselines it exports come
+    // from its contents, and ancestors may have aligned to them.
+    bool exported_baselines_changed = false;
+    if (!subtree_root.is_absolutely_positioned() && !subtree_root.is_svg_svg_box()) {
+        auto const& root_state = layout_state.get(subtree_root);
+        exported_baselines_changed = root_state.first_baseline != subtree_root.committed_first_baseline()
+            || root_state.last_baseline != subtree_root.committed_last_baseline();
+    }
+
     // The commit takes over the old paintable's position in the paint tree, whether the
     // subtree root reuses it (a surviving box) or replaces it (a rebuilt box).
     layout_state.commit(subtree_root, old_paintable);
@@ -1828,6 +1887,10 @@ static void relayout_subtree(Layout::Box& subtree_root, Painting::Paintable& old
         node.reset_needs_layout_update();
         return TraversalDecision::Continue;
     });
+
+    // The subtree itself is laid out correctly, so only the ancestors need another layout pass.
+    if (exported_baselines_changed && subtree_root.parent())
+        subtree_root.parent()->set_needs_layout_update(SetNeedsLayoutReason::PartialRelayoutBoundaryBaselineChange);
 }
 
 // The pre-order traversal visits ancestors before the descendants that mark them, so clearing
@@ -2137,6 +2200,7 @@ void Document::update_layout(UpdateLayoutReason reason)
 
     VERIFY(!m_is_running_update_layout);
     m_is_running_update_layout = true;
+    Profiling::PhaseScope phase_scope { Profiling::Phase::Layout };
     ScopeGuard guard = [&] {
         m_is_running_update_layout = false;
         page().client().flush_pending_dom_mutations();
@@ -3135,11 +3199,19 @@ void Document::set_hovered_node(GC::Ptr<Node> node, Optional<HoverEventData> hov
 // https://html.spec.whatwg.org/multipage/dom.html#dom-document-getelementsbyname
 GC::Ref<NodeList> Document::get_elements_by_name(Utf16View name)
 {
-    return LiveNodeList::create(realm(), *this, LiveNodeList::Scope::Descendants, [name = Utf16String::from_utf16(name)](auto const& node) {
+    auto list = LiveNodeList::create(realm(), *this, LiveNodeList::Scope::Descendants, [name = Utf16String::from_utf16(name)](auto const& node) {
         if (!is<HTML::HTMLElement>(node))
             return false;
         return as<HTML::HTMLElement>(node).name() == name;
     });
+    as<LiveNodeList>(*list).set_candidate_collector([name = Utf16FlyString::from_utf16(name)](ElementIndex const& index, Vector<GC::RawPtr<Element>>& candidates) {
+        if (auto const* elements = index.elements_with_name(name)) {
+            for (auto element : *elements)
+                candidates.append(element);
+        }
+        return true;
+    });
+    return list;
 }
 
 // https://html.spec.whatwg.org/multipage/obsolete.html#dom-document-applets
@@ -4642,6 +4714,10 @@ void Document::update_the_visibility_state(HTML::VisibilityState visibility_stat
     // 2. Set document's visibility state to visibilityState.
     m_visibility_state = visibility_state;
 
+    // NB: Timers of hidden documents are throttled.
+    if (m_window)
+        m_window->update_timer_throttling();
+
     // FIXME: 3. Queue a new VisibilityStateEntry whose visibility state is visibilityState and whose timestamp is the current
     //    high resolution time given document's relevant global object.
 
@@ -5795,7 +5871,9 @@ void Document::unload(GC::Ptr<Document>)
 
     // 5. Let intendToStoreInBfcache be true if the user agent intends to keep oldDocument alive in a session history
     //    entry, such that it can later be used for history traversal.
-    auto intend_to_store_in_bfcache = false;
+    // NB: That depends on the navigation that unloads oldDocument, which decides it before unloading starts.
+    //     See HTML::BackForwardCache::can_store().
+    auto intend_to_store_in_bfcache = exchange(m_intend_to_store_in_bfcache, false) && m_salvageable;
 
     // 6. Let eventLoop be oldDocument's relevant agent's event loop.
     auto& event_loop = *HTML::relevant_agent(*this).event_loop;
@@ -5846,7 +5924,9 @@ void Document::unload(GC::Ptr<Document>)
 
     // FIXME: 15. Set oldDocument's suspension time to the current high resolution time given document's relevant global object.
 
-    // FIXME: 16. Set oldDocument's suspended timer handles to the result of getting the keys for the map of active timers.
+    // 16. Set oldDocument's suspended timer handles to the result of getting the keys for the map of active timers.
+    auto& window = as<HTML::Window>(relevant_global_object(*this));
+    m_suspended_timer_handles = window.active_timer_handles();
 
     // FIXME: 17. Set oldDocument's has been scrolled by the user to false.
 
@@ -5855,8 +5935,16 @@ void Document::unload(GC::Ptr<Document>)
     run_unloading_cleanup_steps();
 
     // 19. If oldDocument's salvageable state is false, then destroy oldDocument.
-    if (!m_salvageable)
+    if (!m_salvageable) {
         destroy();
+    }
+    // AD-HOC: Otherwise, keep oldDocument alive in its traversable's back/forward cache. Our timers keep counting down
+    //         whether or not their document is fully active, so they are stopped until oldDocument is reactivated.
+    else if (auto traversable = navigable() ? navigable()->traversable_navigable() : nullptr) {
+        window.suspend_timers(m_suspended_timer_handles);
+        m_stored_in_bfcache = true;
+        traversable->back_forward_cache().store(*this);
+    }
 
     // 20. Decrease oldDocument's unload counter by 1.
     m_unload_counter -= 1;
@@ -5966,8 +6054,11 @@ bool Document::is_allowed_to_use_feature(PolicyControlledFeature feature) const
 
 void Document::did_stop_being_active_document_in_navigable()
 {
-    clear_layout_and_paintable_nodes_for_inactive_document();
-    tear_down_layout_tree();
+    // A document in the back/forward cache keeps its layout and paint state, so that it can be shown again right away.
+    if (!m_stored_in_bfcache) {
+        clear_layout_and_paintable_nodes_for_inactive_document();
+        tear_down_layout_tree();
+    }
 
     schedule_html_parser_end_check();
 
@@ -6252,7 +6343,23 @@ void Document::queue_an_intersection_observer_entry(IntersectionObserver::Inters
 }
 
 // https://www.w3.org/TR/intersection-observer/#compute-the-intersection
-static CSSPixelRect compute_intersection(GC::Ref<Element> target, CSSPixelRect target_rect, IntersectionObserver::IntersectionObserver const& observer, RefPtr<Painting::Paintable> root_paintable, CSSPixelRect const& root_bounds)
+// The viewport-relative clip rects of containers with a content clip, or nothing for containers without one. Feeds and
+// other long lists put many targets in the same containers, so these are computed once per update for all observers.
+using ContainerClipRectCache = HashMap<Painting::Paintable const*, Optional<CSSPixelRect>>;
+
+static Optional<CSSPixelRect> content_clip_rect_for_container(Painting::Paintable const& container, ContainerClipRectCache& clip_rect_cache)
+{
+    return clip_rect_cache.ensure(&container, [&] -> Optional<CSSPixelRect> {
+        auto overflow_x = container.computed_values().overflow_x();
+        auto overflow_y = container.computed_values().overflow_y();
+        bool has_content_clip = overflow_x != CSS::Overflow::Visible || overflow_y != CSS::Overflow::Visible;
+        if (!has_content_clip)
+            return {};
+        return container.transform_rect_to_viewport(container.absolute_padding_box_rect(), Painting::AccumulatedVisualContextTree::IncludeVisualViewportTransform::No);
+    });
+}
+
+static CSSPixelRect compute_intersection(GC::Ref<Element> target, CSSPixelRect target_rect, IntersectionObserver::IntersectionObserver const& observer, RefPtr<Painting::Paintable> root_paintable, CSSPixelRect const& root_bounds, ContainerClipRectCache& clip_rect_cache)
 {
     // 1. Let intersectionRect be the result of getting the bounding box for target.
     auto intersection_rect = target_rect;
@@ -6278,11 +6385,8 @@ static CSSPixelRect compute_intersection(GC::Ref<Element> target, CSSPixelRect t
             // 3.4. If container has a content clip or a css clip-path property, update intersectionRect
             //      by applying container’s clip.
             // FIXME: Handle clip-path.
-            auto overflow_x = container->computed_values().overflow_x();
-            auto overflow_y = container->computed_values().overflow_y();
-            bool has_content_clip = overflow_x != CSS::Overflow::Visible || overflow_y != CSS::Overflow::Visible;
-            if (has_content_clip) {
-                auto clip_rect = container->transform_rect_to_viewport(container->absolute_padding_box_rect(), Painting::AccumulatedVisualContextTree::IncludeVisualViewportTransform::No);
+            if (auto content_clip_rect = content_clip_rect_for_container(*container, clip_rect_cache); content_clip_rect.has_value()) {
+                auto clip_rect = *content_clip_rect;
 
                 // Apply scroll margin to expand the scrollport for scroll containers.
                 auto& scroll_margin = observer.scroll_margin_values();
@@ -6327,6 +6431,8 @@ void Document::run_the_update_intersection_observations_steps(HighResolutionTime
 
     update_paint_and_hit_testing_properties_if_needed();
 
+    ContainerClipRectCache clip_rect_cache;
+
     for (auto& observer : intersection_observers) {
         // 1. Let rootBounds be observer’s root intersection rectangle.
         auto root_bounds = observer->root_intersection_rectangle();
@@ -6370,7 +6476,11 @@ void Document::run_the_update_intersection_observations_steps(HighResolutionTime
 
                 // 5. Let intersectionRect be the result of running the compute the intersection algorithm on target and
                 //    observer’s intersection root.
-                intersection_rect = compute_intersection(target, target_rect, *observer, root_paintable, root_bounds);
+                // OPTIMIZATION: The intersection is a subset of targetRect that gets clipped to rootBounds last, so it is
+                //               empty for targets that lie entirely outside of rootBounds, which is most of them in a
+                //               long list. Those can skip walking their containing blocks.
+                if (target_rect.edge_adjacent_intersects(root_bounds))
+                    intersection_rect = compute_intersection(target, target_rect, *observer, root_paintable, root_bounds, clip_rect_cache);
 
                 // 6. Let targetArea be targetRect’s area.
                 auto target_area = target_rect.width() * target_rect.height();
@@ -6862,9 +6972,71 @@ void Document::update_for_history_step_application(NonnullRefPtr<HTML::SessionHi
 
     // 9. Otherwise, if documentsEntryChanged is false and doNotReactivate is false, then:
     // NOTE: This is for bfcache restoration
-    if (!documents_entry_changed && !do_not_reactivate) {
-        // FIXME: 1. Assert: entriesForNavigationAPI is given.
-        // FIXME: 2. Reactivate document given entry and entriesForNavigationAPI.
+    // AD-HOC: We check whether document is being restored from the bfcache instead. It may be restored to one of its
+    //         earlier same-document entries, which changes its entry, and documentsEntryChanged is also false when
+    //         this is reached for documents that are already active.
+    if (m_stored_in_bfcache && !do_not_reactivate) {
+        // 1. Assert: entriesForNavigationAPI is given.
+        VERIFY(entries_for_navigation_api.has_value());
+
+        // 2. Reactivate document given entry and entriesForNavigationAPI.
+        reactivate(entry, *entries_for_navigation_api);
+    }
+}
+
+// https://html.spec.whatwg.org/multipage/browsing-the-web.html#reactivate-a-document
+void Document::reactivate(NonnullRefPtr<HTML::SessionHistoryEntry> reactivated_entry, Vector<NonnullRefPtr<HTML::SessionHistoryEntry>> const& entries_for_navigation_api)
+{
+    m_stored_in_bfcache = false;
+
+    auto& window = as<HTML::Window>(HTML::relevant_global_object(*this));
+
+    // FIXME: 1. For each formControl of form controls in document with an autofill field name of "off", invoke the reset
+    //           algorithm for formControl.
+
+    // 2. If document's suspended timer handles is not empty:
+    if (!m_suspended_timer_handles.is_empty()) {
+        // FIXME: 1. Assert: document's suspension time is not zero.
+
+        // 2. Let suspendedTimerHandles be document's suspended timer handles.
+        auto suspended_timer_handles = move(m_suspended_timer_handles);
+
+        // FIXME: 3. Let suspendTime be document's suspension time.
+
+        // 4. Let activeTimers be document's relevant global object's map of active timers.
+        // 5. For each handle in suspendedTimerHandles, if activeTimers[handle] exists, then increase activeTimers[handle]
+        //    by the current high resolution time given document's relevant global object minus suspendTime.
+        // NB: Our timers were stopped when document was unloaded instead, so they are started again.
+        window.resume_timers(suspended_timer_handles);
+    }
+
+    // 3. Update the navigation API entries for reactivation given document's relevant global object's navigation API,
+    //    entriesForNavigationAPI, and reactivatedEntry.
+    window.navigation()->update_the_navigation_api_entries_for_reactivation(entries_for_navigation_api, reactivated_entry);
+
+    // AD-HOC: Document kept its layout tree while it was in the bfcache, but the viewport may have changed since.
+    invalidate_style_for_viewport_change();
+    set_needs_media_query_evaluation();
+    set_needs_layout_update(SetNeedsLayoutReason::DocumentReactivated);
+
+    // AD-HOC: Nothing was loaded to show document again, so let the UI know about its title and that it is loaded.
+    if (auto navigable = this->navigable(); navigable && navigable->is_top_level_traversable()) {
+        page().client().page_did_change_title(title());
+        page().client().page_did_finish_loading(m_navigation_id, url());
+    }
+
+    // 4. If document's current document readiness is "complete", and document's page showing is false:
+    if (m_readiness == HTML::DocumentReadyState::Complete && !m_page_showing) {
+        // 1. Set document's page showing to true.
+        m_page_showing = true;
+
+        // FIXME: 2. Set document's has been revealed to false.
+
+        // 3. Update the visibility state of document to "visible".
+        update_the_visibility_state(HTML::VisibilityState::Visible);
+
+        // 4. Fire a page transition event named pageshow at document's relevant global object with true.
+        window.fire_a_page_transition_event(HTML::EventNames::pageshow, true);
     }
 }
 
@@ -6998,6 +7170,128 @@ void Document::prune_image_resource_caches()
     }
 
     m_list_of_available_images->prune_to_limits(decoded_image_resource_cache_limit, decoded_image_resource_cache_count_limit);
+
+    HTML::BitmapDecodedImageData::discard_unused_decoded_bitmaps_if_needed();
+}
+
+void Document::update_image_decode_priorities()
+{
+    bool has_bitmap_decode_in_flight = any_of(m_shared_resource_requests, [](auto const& it) { return it.value->has_bitmap_decode_in_flight(); });
+    if (!has_bitmap_decode_in_flight)
+        return;
+
+    // Images within a viewport's height of the visible area are likely to be scrolled into view next.
+    auto area_of_interest = viewport_rect();
+    area_of_interest.inflate(0, area_of_interest.height() * 2);
+
+    // Requests that aren't used by any image element (e.g. CSS images) keep their default priority.
+    HashTable<HTML::SharedResourceRequest const*> requests_used_by_images;
+    HashTable<HTML::SharedResourceRequest const*> visible_requests;
+    for_each_in_subtree_of_type<HTML::HTMLImageElement>([&](HTML::HTMLImageElement const& image) {
+        auto paintable = image.paintable_box();
+        bool is_visible = paintable && paintable->absolute_border_box_rect().intersects(area_of_interest);
+        for (auto const* image_request : { &image.current_request(), image.pending_request() }) {
+            if (!image_request || !image_request->shared_resource_request())
+                continue;
+            auto const* request = image_request->shared_resource_request().ptr();
+            requests_used_by_images.set(request);
+            if (is_visible)
+                visible_requests.set(request);
+        }
+        return TraversalDecision::Continue;
+    });
+
+    for (auto& it : m_shared_resource_requests) {
+        auto& request = *it.value;
+        if (!request.has_bitmap_decode_in_flight() || !requests_used_by_images.contains(&request))
+            continue;
+        request.set_decode_is_visible(visible_requests.contains(&request));
+    }
+}
+
+static bool contains_non_whitespace(Utf16View const& text)
+{
+    for (auto code_point : text) {
+        if (!is_ascii_space(code_point))
+            return true;
+    }
+    return false;
+}
+
+// https://w3c.github.io/paint-timing/#mark-paint-timing
+void Document::mark_paint_timing()
+{
+    // NB: The largest contentful paint is no longer reported once the user has interacted with the page, after which
+    //     there is nothing left to mark once first contentful paint has been reported.
+    bool should_report_largest_contentful_paint = !m_window || !m_window->has_sticky_activation();
+    if (m_paint_timing_info.first_contentful_paint_time.has_value() && !should_report_largest_contentful_paint)
+        return;
+
+    // 1. If document's visibility state is "hidden", then return.
+    if (m_visibility_state == HTML::VisibilityState::Hidden)
+        return;
+
+    // AD-HOC: Only mark paint timing for rendering updates that will actually produce a new frame.
+    auto navigable = this->navigable();
+    if (!navigable || !navigable->needs_repaint())
+        return;
+
+    auto viewport_paintable = paintable();
+    if (!viewport_paintable)
+        return;
+
+    auto paint_timestamp = HighResolutionTime::current_high_resolution_time(relevant_global_object(*this));
+
+    if (!m_paint_timing_info.first_paint_time.has_value())
+        m_paint_timing_info.first_paint_time = paint_timestamp;
+
+    // AD-HOC: Rather than tracking which images and text nodes were painted since the previous frame, we look for
+    //         contentful content in the paintable tree. The size of a candidate for the largest contentful paint is the
+    //         area of it that is visible in the viewport, where text is measured by the fragments of its block.
+    auto viewport = viewport_rect();
+    auto visible_size_of = [&](CSSPixelRect const& rect) {
+        auto visible_rect = rect.intersected(viewport);
+        return visible_rect.width().to_double() * visible_rect.height().to_double();
+    };
+
+    bool has_contentful_content = false;
+    double largest_candidate_size = 0;
+
+    viewport_paintable->for_each_in_inclusive_subtree_of_type<Painting::Paintable>([&](Painting::Paintable const& paintable) {
+        if (!paintable.has_layout_node() || !paintable.is_visible())
+            return TraversalDecision::Continue;
+
+        auto const& layout_node = paintable.layout_node();
+        if (auto const* image_box = as_if<Layout::ImageBox>(layout_node)) {
+            if (image_box->image_provider().is_image_available()) {
+                has_contentful_content = true;
+                largest_candidate_size = max(largest_candidate_size, visible_size_of(paintable.absolute_rect()));
+            }
+        } else if (is<Layout::SVGSVGBox>(layout_node) || is<Layout::CanvasBox>(layout_node) || is<Layout::VideoBox>(layout_node)) {
+            has_contentful_content = true;
+        } else if (auto const* paintable_with_lines = as_if<Painting::PaintableWithLines>(paintable)) {
+            Optional<CSSPixelRect> text_rect;
+            for (auto const& fragment : paintable_with_lines->fragments()) {
+                if (!contains_non_whitespace(fragment.text()))
+                    continue;
+                text_rect = text_rect.has_value() ? text_rect->united(fragment.absolute_rect()) : fragment.absolute_rect();
+            }
+            if (text_rect.has_value()) {
+                has_contentful_content = true;
+                largest_candidate_size = max(largest_candidate_size, visible_size_of(*text_rect));
+            }
+        }
+        return TraversalDecision::Continue;
+    });
+
+    if (!m_paint_timing_info.first_contentful_paint_time.has_value() && has_contentful_content)
+        m_paint_timing_info.first_contentful_paint_time = paint_timestamp;
+
+    // FIXME: Queue PerformancePaintTiming and LargestContentfulPaint entries once those interfaces exist.
+    if (should_report_largest_contentful_paint && largest_candidate_size > m_paint_timing_info.largest_contentful_paint_size) {
+        m_paint_timing_info.largest_contentful_paint_size = largest_candidate_size;
+        m_paint_timing_info.largest_contentful_paint_time = paint_timestamp;
+    }
 }
 
 // https://www.w3.org/TR/web-animations-1/#dom-document-timeline
@@ -7322,6 +7616,20 @@ void Document::element_with_name_was_removed(Badge<DOM::Element>, GC::Ref<DOM::E
     }
 }
 
+void Document::node_event_listener_was_added(Utf16FlyString const& type)
+{
+    ++m_node_event_listener_counts.ensure(type, [] { return 0u; });
+}
+
+void Document::node_event_listener_was_removed(Utf16FlyString const& type)
+{
+    auto it = m_node_event_listener_counts.find(type);
+    if (it == m_node_event_listener_counts.end())
+        return;
+    if (--it->value == 0)
+        m_node_event_listener_counts.remove(it);
+}
+
 GC::Ptr<Element> Document::element_by_anchor_name(Utf16FlyString const& name, Node const& querying_node, Function<bool(Element&)> const& is_acceptable) const
 {
     // https://drafts.csswg.org/css-shadow-1/#tree-scoped-name
@@ -8858,6 +9166,7 @@ void Document::set_needs_to_record_display_list()
 
 RefPtr<Painting::DisplayList> Document::record_display_list(HTML::PaintConfig config, Painting::DisplayListResourceStorage& resource_storage, Painting::PaintCommandCacheMode cache_mode)
 {
+    Profiling::PhaseScope phase_scope { Profiling::Phase::Paint };
     update_paint_and_hit_testing_properties_if_needed();
     VERIFY(paintable());
 
@@ -9436,6 +9745,13 @@ ElementByIdMap& Document::element_by_id() const
     return *m_element_by_id;
 }
 
+ElementIndex& Document::element_index() const
+{
+    if (!m_element_index)
+        m_element_index = make<ElementIndex>();
+    return *m_element_index;
+}
+
 Utf16String Document::dump_display_list()
 {
     update_layout(UpdateLayoutReason::DumpDisplayList);
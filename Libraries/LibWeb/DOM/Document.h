@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/Function.h>
 #include <AK/HashMap.h>
 #include <AK/HashTable.h>
@@ -17,6 +18,7 @@
 #include <AK/Optional.h>
 #include <AK/OwnPtr.h>
 #include <AK/RefPtr.h>
+#include <AK/TemporaryChange.h>
 #include <AK/Utf16FlyString.h>
 #include <AK/Utf16String.h>
 #include <AK/Utf16View.h>
@@ -52,6 +54,7 @@
 #include <LibWeb/Infra/SerializedURL.h>
 #include <LibWeb/InvalidateDisplayList.h>
 #include <LibWeb/Layout/ScrollableOverflow.h>
+#include <LibWeb/LongAnimationFrames/FrameTiming.h>
 #include <LibWeb/Painting/FlexboxInspectorOverlay.h>
 #include <LibWeb/Painting/Forward.h>
 #include <LibWeb/Painting/GridInspectorOverlay.h>
@@ -77,6 +80,7 @@ enum class QuirksMode {
 };
 
 #define ENUMERATE_INVALIDATE_LAYOUT_TREE_REASONS(X) \
+    X(MemoryPressure)                               \
     X(TopLayerElementStillRenderedAfterRemoval)
 
 enum class InvalidateLayoutTreeReason {
@@ -208,6 +212,15 @@ struct DocumentLoadTimingInfo {
     HighResolutionTime::DOMHighResTimeStamp load_event_end_time { 0 };
 };
 
+// https://w3c.github.io/paint-timing/#sec-reporting-paint-timing
+// https://w3c.github.io/largest-contentful-paint/#sec-report-largest-contentful-paint
+struct DocumentPaintTimingInfo {
+    Optional<HighResolutionTime::DOMHighResTimeStamp> first_paint_time;
+    Optional<HighResolutionTime::DOMHighResTimeStamp> first_contentful_paint_time;
+    Optional<HighResolutionTime::DOMHighResTimeStamp> largest_contentful_paint_time;
+    double largest_contentful_paint_size { 0 };
+};
+
 // https://html.spec.whatwg.org/multipage/dom.html#document-unload-timing-info
 struct DocumentUnloadTimingInfo {
     // https://html.spec.whatwg.org/multipage/dom.html#unload-event-start-time
@@ -458,6 +471,10 @@ public:
 
     void tear_down_layout_tree_for_svg_image_document(Badge<SVG::SVGDecodedImageData>);
 
+    // Drops the layout and paint trees of a document that isn't being rendered, so that they can be garbage collected.
+    // They are rebuilt the next time the document is rendered.
+    void tear_down_layout_tree_for_memory_pressure();
+
     virtual bool is_child_allowed(Node const&) const override;
 
     Layout::Viewport const* layout_node() const;
@@ -734,7 +751,12 @@ public:
     }
 
     bool needs_full_style_update() const { return m_needs_full_style_update; }
-    void set_needs_full_style_update(bool b) { m_needs_full_style_update = b; }
+    void set_needs_full_style_update(bool b)
+    {
+        m_needs_full_style_update = b;
+        if (!b)
+            m_full_style_invalidation_reason = {};
+    }
     void build_registered_properties_cache_for_style_update() { build_registered_properties_cache(); }
     void set_needs_registered_properties_cache_update() { m_needs_registered_properties_cache_update = true; }
     void set_needs_container_query_evaluation_after_layout(Element const& query_container);
@@ -851,6 +873,12 @@ public:
     DocumentLoadTimingInfo const& load_timing_info() const { return m_load_timing_info; }
     void set_load_timing_info(DocumentLoadTimingInfo const& load_timing_info) { m_load_timing_info = load_timing_info; }
 
+    DocumentPaintTimingInfo const& paint_timing_info() const { return m_paint_timing_info; }
+    void mark_paint_timing();
+
+    // https://w3c.github.io/long-animation-frames/#current-frame-timing-info
+    Optional<LongAnimationFrames::FrameTimingInfo>& current_frame_timing_info() { return m_current_frame_timing_info; }
+
     // https://html.spec.whatwg.org/multipage/dom.html#previous-document-unload-timing
     DocumentUnloadTimingInfo& previous_document_unload_timing() { return m_previous_document_unload_timing; }
     DocumentUnloadTimingInfo const& previous_document_unload_timing() const { return m_previous_document_unload_timing; }
@@ -888,8 +916,13 @@ public:
     // https://html.spec.whatwg.org/multipage/interaction.html#set-the-initial-visibility-state
     void set_initial_visibility_state(HTML::VisibilityState);
 
+    bool is_salvageable() const { return m_salvageable; }
     void set_salvageable(bool value) { m_salvageable = value; }
 
+    // Set by the navigation that unloads this document if it should be kept alive in the back/forward cache.
+    void set_intend_to_store_in_bfcache(bool value) { m_intend_to_store_in_bfcache = value; }
+    bool is_stored_in_bfcache() const { return m_stored_in_bfcache; }
+
     void make_unsalvageable(Utf16View reason);
 
     HTML::ListOfAvailableImages& list_of_available_images();
@@ -934,8 +967,14 @@ public:
     void remove_css_image_resource_if_unused(URL::URL const&);
     void prune_image_resource_caches();
 
+    // Tells the image decoder which in-flight image decodes are in or near the viewport, so it can do those first.
+    void update_image_decode_priorities();
+
     void restore_the_history_object_state(NonnullRefPtr<HTML::SessionHistoryEntry> entry);
 
+    // https://html.spec.whatwg.org/multipage/browsing-the-web.html#reactivate-a-document
+    void reactivate(NonnullRefPtr<HTML::SessionHistoryEntry> reactivated_entry, Vector<NonnullRefPtr<HTML::SessionHistoryEntry>> const& entries_for_navigation_api);
+
     GC::Ref<Animations::DocumentTimeline> timeline();
     auto const& last_animation_frame_timestamp() const { return m_last_animation_frame_timestamp; }
 
@@ -973,6 +1012,16 @@ public:
     void element_with_name_was_added(Badge<DOM::Element>, GC::Ref<DOM::Element> element);
     void element_with_name_was_removed(Badge<DOM::Element>, GC::Ref<DOM::Element> element);
 
+    // Counts the event listeners registered on this document's nodes per event type, so that dispatching an event no
+    // node listens for (e.g. pointermove on most pages) doesn't have to look at every ancestor of the target.
+    void node_event_listener_was_added(Utf16FlyString const& type);
+    void node_event_listener_was_removed(Utf16FlyString const& type);
+    bool may_have_node_event_listener(Utf16FlyString const& type) const { return m_node_event_listener_counts.contains(type); }
+
+    // Set once any node of this document has a (possibly transient) registered mutation observer, and never unset.
+    bool has_ever_had_registered_mutation_observers() const { return m_has_ever_had_registered_mutation_observers; }
+    void set_has_ever_had_registered_mutation_observers() { m_has_ever_had_registered_mutation_observers = true; }
+
     // https://drafts.csswg.org/css-anchor-position-1/#determining
     AnchorNameMap& anchor_name_map() { return m_anchor_name_map; }
     GC::Ptr<Element> element_by_anchor_name(Utf16FlyString const& name, Node const& querying_node, Function<bool(Element&)> const& is_acceptable) const;
@@ -1045,11 +1094,33 @@ public:
         u64 scope_rule_cache_builds { 0 };
         u64 relayouts_performed { 0 };
         u64 scrollable_overflow_recalculations { 0 };
+        u64 intrinsic_size_cache_hits { 0 };
+        u64 intrinsic_size_measurements { 0 };
+        u64 grid_item_content_size_reuses { 0 };
+        u64 grid_item_content_size_measurements { 0 };
+
+        // Attribution of invalidation work to the reason that caused it. A node is attributed to the first reason
+        // that marked it dirty, until its style is next recomputed.
+        struct PerReason {
+            u64 invalidations { 0 };
+            u64 nodes_marked { 0 };
+            u64 elements_recomputed { 0 };
+            u64 elements_changed { 0 };
+        };
+        Array<PerReason, style_invalidation_reason_count> per_reason {};
     };
     StyleInvalidationCounters& style_invalidation_counters() const { return m_style_invalidation_counters; }
     void reset_style_invalidation_counters() const;
     void record_style_invalidation() const;
-    void record_full_style_invalidation() const;
+    void record_full_style_invalidation(StyleInvalidationReason) const;
+
+    // While set, nodes marked for a style update without an explicit reason are attributed to this one.
+    Optional<StyleInvalidationReason> active_style_invalidation_reason() const { return m_active_style_invalidation_reason; }
+    [[nodiscard]] TemporaryChange<Optional<StyleInvalidationReason>> attribute_style_invalidations_to(StyleInvalidationReason reason) const
+    {
+        return { m_active_style_invalidation_reason, reason };
+    }
+    Optional<StyleInvalidationReason> full_style_invalidation_reason() const { return m_full_style_invalidation_reason; }
     static void set_style_invalidation_counter_dump_interval(Optional<u64>);
 
     // Confinement report of the most recent layout tree build, for tests observing whether a
@@ -1265,6 +1336,7 @@ public:
     void remove_render_blocking_element(GC::Ref<Element>);
 
     ElementByIdMap& element_by_id() const;
+    ElementIndex& element_index() const;
 
     // https://fullscreen.spec.whatwg.org/#run-the-fullscreen-steps
     void run_fullscreen_steps();
@@ -1418,6 +1490,7 @@ private:
     GC::Ptr<HTML::BrowsingContext> m_browsing_context;
     URL::URL m_url;
     mutable OwnPtr<ElementByIdMap> m_element_by_id;
+    mutable OwnPtr<ElementIndex> m_element_index;
 
     GC::Ptr<HTML::Window> m_window;
 
@@ -1532,6 +1605,12 @@ private:
     // https://html.spec.whatwg.org/multipage/browsing-the-web.html#concept-document-salvageable
     bool m_salvageable { true };
 
+    bool m_intend_to_store_in_bfcache { false };
+    bool m_stored_in_bfcache { false };
+
+    // https://html.spec.whatwg.org/multipage/document-lifecycle.html#suspended-timer-handles
+    Vector<i32> m_suspended_timer_handles;
+
     // https://html.spec.whatwg.org/multipage/document-lifecycle.html#page-showing
     bool m_page_showing { false };
 
@@ -1593,6 +1672,13 @@ private:
     // https://html.spec.whatwg.org/multipage/dom.html#concept-document-about-base-url
     Optional<URL::URL> m_about_base_url;
 
+    // Pages tend to resolve the same relative URLs over and over, e.g. for every link sharing an href. Results are kept
+    // here by input, for as long as the base URL and encoding they were resolved against stay the same.
+    static constexpr size_t MAX_ENCODING_PARSED_URL_CACHE_SIZE = 1024;
+    mutable HashMap<Utf16String, Optional<URL::URL>> m_encoding_parsed_url_cache;
+    mutable Optional<URL::URL> m_encoding_parsed_url_cache_base_url;
+    mutable Utf16String m_encoding_parsed_url_cache_encoding;
+
     // https://html.spec.whatwg.org/multipage/dom.html#concept-document-coop
     HTML::OpenerPolicy m_opener_policy;
 
@@ -1636,6 +1722,10 @@ private:
 
     // https://html.spec.whatwg.org/multipage/dom.html#load-timing-info
     DocumentLoadTimingInfo m_load_timing_info;
+    DocumentPaintTimingInfo m_paint_timing_info;
+
+    // https://w3c.github.io/long-animation-frames/#current-frame-timing-info
+    Optional<LongAnimationFrames::FrameTimingInfo> m_current_frame_timing_info;
 
     // https://html.spec.whatwg.org/multipage/dom.html#previous-document-unload-timing
     DocumentUnloadTimingInfo m_previous_document_unload_timing;
@@ -1713,6 +1803,12 @@ private:
 
     Vector<GC::Ref<DOM::Element>> m_potentially_named_elements;
 
+    // NB: Nodes that are collected with their listeners still registered are never subtracted, so these counts may
+    //     overestimate. That only costs us the fast path in may_have_node_event_listener().
+    HashMap<Utf16FlyString, u32> m_node_event_listener_counts;
+
+    bool m_has_ever_had_registered_mutation_observers { false };
+
     AnchorNameMap m_anchor_name_map;
 
     bool m_design_mode_enabled { false };
@@ -1736,6 +1832,8 @@ private:
     mutable StyleInvalidationCounters m_style_invalidation_counters;
     LayoutTreeBuildStats m_layout_tree_build_stats;
     mutable u64 m_style_invalidations_since_last_counter_dump { 0 };
+    mutable Optional<StyleInvalidationReason> m_active_style_invalidation_reason;
+    mutable Optional<StyleInvalidationReason> m_full_style_invalidation_reason;
 
     mutable GC::Ptr<WebIDL::ObservableArray> m_adopted_style_sheets;
 
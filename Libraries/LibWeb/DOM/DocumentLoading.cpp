@@ -10,6 +10,7 @@
 #include <AK/Debug.h>
 #include <AK/LexicalPath.h>
 #include <AK/NeverDestroyed.h>
+#include <AK/Utf8View.h>
 #include <AK/Utf16FlyString.h>
 #include <LibCore/Promise.h>
 #include <LibCore/Resource.h>
@@ -78,13 +79,31 @@ bool build_xml_document(DOM::Document& document, ByteBuffer const& data, Optiona
         decoder = TextCodec::decoder_for(bom_encoding.value_or("UTF-8"));
     }
     VERIFY(decoder.has_value());
-    // Well-formed XML documents contain only properly encoded characters
-    auto source_or_error = decoder->to_utf8(data, TextCodec::IgnoreBOM::No, TextCodec::ErrorMode::Fatal);
-    if (source_or_error.is_error()) {
-        convert_to_xml_error_document(document, "XML Document contains improperly-encoded characters"_utf16);
-        return false;
+
+    // OPTIMIZATION: Most XML is UTF-8 already. Validating it is enough to parse the bytes in place, which saves
+    //               transcoding a copy of what may be a multi-megabyte response.
+    StringView source;
+    String transcoded_source;
+    if (&decoder.value() == &TextCodec::decoder_for("UTF-8"sv).value()) {
+        source = StringView { data.bytes() };
+        if (source.starts_with("\xEF\xBB\xBF"sv))
+            source = source.substring_view(3);
+        // Well-formed XML documents contain only properly encoded characters
+        if (!Utf8View { source }.validate(AllowLonelySurrogates::No)) {
+            convert_to_xml_error_document(document, "XML Document contains improperly-encoded characters"_utf16);
+            return false;
+        }
+    } else {
+        // Well-formed XML documents contain only properly encoded characters
+        auto source_or_error = decoder->to_utf8(data, TextCodec::IgnoreBOM::No, TextCodec::ErrorMode::Fatal);
+        if (source_or_error.is_error()) {
+            convert_to_xml_error_document(document, "XML Document contains improperly-encoded characters"_utf16);
+            return false;
+        }
+        transcoded_source = source_or_error.release_value();
+        source = transcoded_source;
     }
-    auto source = source_or_error.release_value();
+
     XML::Parser parser(source, { .resolve_named_html_entity = resolve_named_html_entity });
     XMLDocumentBuilder builder { document };
     auto result = parser.parse_with_listener(builder);
@@ -60,6 +60,7 @@
 #include <LibWeb/DOM/DocumentFragment.h>
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/DOM/ElementFactory.h>
+#include <LibWeb/DOM/ElementIndex.h>
 #include <LibWeb/DOM/HTMLCollection.h>
 #include <LibWeb/DOM/NamedNodeMap.h>
 #include <LibWeb/DOM/SelectorQuery.h>
@@ -1303,6 +1304,13 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_style(bool& did_cha
     auto& counters = document().style_invalidation_counters();
     counters.element_style_recomputations++;
 
+    auto invalidation_reason = take_style_invalidation_reason();
+    if (!invalidation_reason.has_value() && document().needs_full_style_update())
+        invalidation_reason = document().full_style_invalidation_reason();
+    auto* per_reason_counters = invalidation_reason.has_value() ? &counters.per_reason[to_underlying(*invalidation_reason)] : nullptr;
+    if (per_reason_counters)
+        per_reason_counters->elements_recomputed++;
+
     m_style_uses_attr_css_function = false;
     m_style_uses_var_css_function = false;
     m_style_uses_tree_counting_function = false;
@@ -1398,6 +1406,9 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_style(bool& did_cha
         return invalidation;
     }
 
+    if (per_reason_counters)
+        per_reason_counters->elements_changed++;
+
     apply_computed_style_to_layout_node_if_needed(invalidation);
 
     return invalidation;
@@ -2168,6 +2179,8 @@ void Element::inserted()
 {
     Base::inserted();
 
+    update_document_element_index_membership();
+
     if (is_connected()) {
         if (m_id.has_value())
             document().element_with_id_was_added({}, *this);
@@ -2192,6 +2205,11 @@ void Element::removed_from(IsSubtreeRoot is_subtree_root, Node* old_ancestor, No
     if (m_id.has_value() && is<ShadowRoot>(old_root))
         static_cast<ShadowRoot&>(old_root).element_by_id().remove(*m_id, *this);
 
+    if (m_is_in_document_element_index) {
+        document().element_index().remove(*this);
+        m_is_in_document_element_index = false;
+    }
+
     if (old_root.is_connected()) {
         if (m_id.has_value())
             document().element_with_id_was_removed({}, *this);
@@ -2225,11 +2243,34 @@ void Element::removed_from(IsSubtreeRoot is_subtree_root, Node* old_ancestor, No
 void Element::moved_from(IsSubtreeRoot is_subtree_root, GC::Ptr<Node> old_ancestor)
 {
     Base::moved_from(is_subtree_root, old_ancestor);
+
+    // NB: A move can take an element between the document tree and a shadow tree.
+    update_document_element_index_membership();
+}
+
+void Element::update_document_element_index_membership()
+{
+    bool const should_be_indexed = is_connected() && in_a_document_tree();
+    if (should_be_indexed == m_is_in_document_element_index)
+        return;
+
+    if (should_be_indexed)
+        document().element_index().add(*this);
+    else
+        document().element_index().remove(*this);
+    m_is_in_document_element_index = should_be_indexed;
 }
 
 void Element::children_changed(ChildrenChangedMetadata const& metadata)
 {
     Node::children_changed(metadata);
+
+    // OPTIMIZATION: Of all selectors, only :empty looks at the text of an element's children, and only at whether there
+    //               is any. So if a child's text changed without becoming empty or non-empty, our style can't have
+    //               changed. This keeps each keystroke in a text control or editing host from restyling its container.
+    if (metadata.type == ChildrenChangedMetadata::Type::Mutation && !metadata.changed_emptiness)
+        return;
+
     set_needs_style_update(true);
 
     if (child_style_uses_tree_counting_function()) {
@@ -4443,8 +4484,10 @@ void Element::determine_proximity_to_the_viewport()
     // viewport soon. A margin of 50% is suggested as a reasonable default.
     viewport_rect.inflate(viewport_rect.width(), viewport_rect.height());
     // FIXME: We don't have paint containment or the overflow clip edge yet, so this is just using the absolute rect for now.
-    if (paintable_box()->absolute_rect().intersects(viewport_rect))
+    if (paintable_box()->absolute_rect().intersects(viewport_rect)) {
         m_proximity_to_the_viewport = ProximityToTheViewport::CloseToTheViewport;
+        return;
+    }
 
     // FIXME: If a filter (see [FILTER-EFFECTS-1]) with non local effects includes the element as part of its input, the user
     //        agent should also treat the element as relevant to the user when the filter’s output can affect the rendering
@@ -4995,14 +5038,21 @@ void Element::attribute_changed(Utf16FlyString const& local_name, Optional<Utf16
             document().element_id_changed({}, *this, old_id);
         }
     } else if (local_name == HTML::AttributeNames::name) {
+        auto old_name = m_name;
         if (value_or_empty.is_empty())
             m_name = {};
         else
             m_name = Utf16FlyString::from_utf16(value_or_empty);
 
+        if (m_is_in_document_element_index)
+            document().element_index().element_name_changed(*this, old_name);
+
         if (is_connected())
             document().element_name_changed({}, *this);
     } else if (local_name == HTML::AttributeNames::class_) {
+        Vector<Utf16FlyString> old_classes;
+        if (m_is_in_document_element_index)
+            old_classes = move(m_classes);
         if (value_or_empty.is_empty()) {
             m_classes.clear();
         } else {
@@ -5012,6 +5062,8 @@ void Element::attribute_changed(Utf16FlyString const& local_name, Optional<Utf16
                 return IterationDecision::Continue;
             });
         }
+        if (m_is_in_document_element_index)
+            document().element_index().element_classes_changed(*this, old_classes);
         if (m_class_list)
             m_class_list->associated_attribute_changed(value_or_empty);
     } else if (local_name == HTML::AttributeNames::style) {
@@ -675,6 +675,8 @@ protected:
     virtual void removed_from(IsSubtreeRoot, Node* old_ancestor, Node& old_root) override;
     virtual void moved_from(IsSubtreeRoot, GC::Ptr<Node> old_ancestor) override;
 
+    void update_document_element_index_membership();
+
     virtual void children_changed(ChildrenChangedMetadata const&) override;
     virtual i32 default_tab_index_value() const;
 
@@ -801,6 +803,7 @@ private:
     bool m_in_subtree_of_has_pseudo_class_relative_selector_with_sibling_combinator : 1 { false };
     bool m_in_has_scope : 1 { false };
     bool m_fullscreen_flag : 1 { false };
+    bool m_is_in_document_element_index : 1 { false };
 
     size_t m_sibling_invalidation_distance { 0 };
 
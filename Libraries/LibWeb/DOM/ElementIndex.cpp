@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/QuickSort.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/Element.h>
+#include <LibWeb/DOM/ElementIndex.h>
+
+namespace Web::DOM {
+
+// Sorting candidates into tree order costs an ancestor walk per comparison, so for large candidate sets a plain
+// subtree traversal is cheaper.
+static constexpr size_t max_candidates_to_sort = 1024;
+
+void ElementIndex::add_to(Map& map, Utf16FlyString const& key, Element& element)
+{
+    map.ensure(key).set(&element);
+}
+
+void ElementIndex::remove_from(Map& map, Utf16FlyString const& key, Element& element)
+{
+    auto it = map.find(key);
+    if (it == map.end())
+        return;
+    it->value.remove(&element);
+    if (it->value.is_empty())
+        map.remove(it);
+}
+
+void ElementIndex::add(Element& element)
+{
+    for (auto const& class_name : element.class_names())
+        add_to(m_elements_by_class, class_name, element);
+    add_to(m_elements_by_qualified_name, element.qualified_name(), element);
+    if (element.prefix().has_value())
+        add_to(m_prefixed_elements_by_local_name, element.local_name(), element);
+    if (auto const& name = element.name(); name.has_value())
+        add_to(m_elements_by_name, *name, element);
+}
+
+void ElementIndex::remove(Element& element)
+{
+    for (auto const& class_name : element.class_names())
+        remove_from(m_elements_by_class, class_name, element);
+    remove_from(m_elements_by_qualified_name, element.qualified_name(), element);
+    if (element.prefix().has_value())
+        remove_from(m_prefixed_elements_by_local_name, element.local_name(), element);
+    if (auto const& name = element.name(); name.has_value())
+        remove_from(m_elements_by_name, *name, element);
+}
+
+void ElementIndex::element_classes_changed(Element& element, ReadonlySpan<Utf16FlyString> old_classes)
+{
+    for (auto const& class_name : old_classes)
+        remove_from(m_elements_by_class, class_name, element);
+    for (auto const& class_name : element.class_names())
+        add_to(m_elements_by_class, class_name, element);
+}
+
+void ElementIndex::element_name_changed(Element& element, Optional<Utf16FlyString> const& old_name)
+{
+    if (old_name.has_value())
+        remove_from(m_elements_by_name, *old_name, element);
+    if (auto const& name = element.name(); name.has_value())
+        add_to(m_elements_by_name, *name, element);
+}
+
+bool ElementIndex::collect_matching_descendants(Node const& root, CandidateCollector const& collector, Function<bool(Element const&)> const& filter, Vector<GC::RawPtr<Element>>& result)
+{
+    if (!collector)
+        return false;
+
+    // Only the document tree is indexed, so the root has to be part of it.
+    bool const root_is_document = root.is_document();
+    if (!root_is_document && !(root.is_connected() && root.in_a_document_tree()))
+        return false;
+
+    Vector<GC::RawPtr<Element>> candidates;
+    if (!collector(root.document().element_index(), candidates))
+        return false;
+    if (candidates.size() > max_candidates_to_sort)
+        return false;
+
+    for (auto candidate : candidates) {
+        if (!root_is_document && !root.is_ancestor_of(*candidate))
+            continue;
+        if (filter(*candidate))
+            result.append(candidate);
+    }
+
+    quick_sort(result, [](auto const& a, auto const& b) {
+        return (a->compare_document_position(b) & Node::DOCUMENT_POSITION_FOLLOWING) != 0;
+    });
+    return true;
+}
+
+void ElementIndex::visit_edges(GC::Cell::Visitor& visitor) const
+{
+    // NB: Indexed elements are connected and so already reachable; visiting them keeps the index from ever dangling.
+    for (auto const* map : { &m_elements_by_class, &m_elements_by_qualified_name, &m_prefixed_elements_by_local_name, &m_elements_by_name }) {
+        for (auto const& it : *map)
+            visitor.visit(it.value);
+    }
+}
+
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/HashTable.h>
+#include <AK/Utf16FlyString.h>
+#include <LibGC/Cell.h>
+#include <LibGC/Ptr.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::DOM {
+
+// Maps class names, qualified names and name attribute values to the elements of a document's document tree that
+// carry them, so that live collections can run their filter over a handful of candidates instead of the whole tree.
+// Elements in shadow trees or outside of the document are not indexed.
+class ElementIndex {
+public:
+    using ElementSet = HashTable<GC::RawPtr<Element>>;
+
+    // Collects candidate elements for a live collection from the index. Returns false if the index can't narrow down
+    // the candidates, in which case the collection traverses its subtree as usual. Candidates must be a superset of
+    // the matching elements, and may be in any order.
+    using CandidateCollector = Function<bool(ElementIndex const&, Vector<GC::RawPtr<Element>>&)>;
+
+    // Both add() and remove() (un)index an element under its current classes, qualified name and name.
+    void add(Element&);
+    void remove(Element&);
+
+    void element_classes_changed(Element&, ReadonlySpan<Utf16FlyString> old_classes);
+    void element_name_changed(Element&, Optional<Utf16FlyString> const& old_name);
+
+    ElementSet const* elements_with_class(Utf16FlyString const& class_name) const { return find(m_elements_by_class, class_name); }
+    ElementSet const* elements_with_qualified_name(Utf16FlyString const& qualified_name) const { return find(m_elements_by_qualified_name, qualified_name); }
+    // An unprefixed element's qualified name is its local name, so together with elements_with_qualified_name() this
+    // finds every element with a given local name.
+    ElementSet const* prefixed_elements_with_local_name(Utf16FlyString const& local_name) const { return find(m_prefixed_elements_by_local_name, local_name); }
+    ElementSet const* elements_with_name(Utf16FlyString const& name) const { return find(m_elements_by_name, name); }
+
+    // Runs the collector and appends the candidates that are descendants of root and match filter to result, in tree
+    // order. Returns false if the caller has to traverse the subtree instead.
+    static bool collect_matching_descendants(Node const& root, CandidateCollector const&, Function<bool(Element const&)> const& filter, Vector<GC::RawPtr<Element>>& result);
+
+    void visit_edges(GC::Cell::Visitor&) const;
+
+private:
+    using Map = HashMap<Utf16FlyString, ElementSet>;
+
+    static ElementSet const* find(Map const& map, Utf16FlyString const& key)
+    {
+        auto it = map.find(key);
+        return it == map.end() ? nullptr : &it->value;
+    }
+    static void add_to(Map&, Utf16FlyString const&, Element&);
+    static void remove_from(Map&, Utf16FlyString const&, Element&);
+
+    Map m_elements_by_class;
+    Map m_elements_by_qualified_name;
+    Map m_prefixed_elements_by_local_name;
+    Map m_elements_by_name;
+};
+
+}
@@ -27,7 +27,9 @@
 #include <LibWeb/HTML/Scripting/ExceptionReporter.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
+#include <LibWeb/LongAnimationFrames/FrameTiming.h>
 #include <LibWeb/UIEvents/MouseEvent.h>
+#include <LibWeb/UIEvents/UIEvent.h>
 #include <LibWeb/WebIDL/AbstractOperations.h>
 
 namespace Web::DOM {
@@ -205,6 +207,14 @@ bool EventDispatcher::dispatch(GC::Ref<EventTarget> target, Event& event, bool l
     // 1. Set event’s dispatch flag.
     event.set_dispatched(true);
 
+    // AD-HOC: Long animation frames report when the first UI event of the frame was dispatched.
+    if (event.is_trusted() && is<UIEvents::UIEvent>(event)) {
+        if (auto* node = as_if<Node>(*target))
+            LongAnimationFrames::record_ui_event_timestamp(node->document(), event.time_stamp());
+        else if (auto* window = as_if<HTML::Window>(*target))
+            LongAnimationFrames::record_ui_event_timestamp(window->associated_document(), event.time_stamp());
+    }
+
     // 2. Let targetOverride be target, if legacy target override flag is not given, and target’s associated Document otherwise. [HTML]
     // NOTE: legacy target override flag is only used by HTML and only when target is a Window object.
     GC::Ptr<EventTarget> target_override;
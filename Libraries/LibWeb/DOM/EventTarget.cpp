@@ -237,6 +237,18 @@ static void update_needs_beforeunload_check(EventTarget& event_target, DOMEventL
         traversable->page().update_needs_beforeunload_check();
 }
 
+static void update_document_node_event_listener_counts(EventTarget& event_target, DOMEventListener const& listener, bool was_added)
+{
+    auto* node = as_if<Node>(event_target);
+    if (!node)
+        return;
+
+    if (was_added)
+        node->document().node_event_listener_was_added(listener.type);
+    else
+        node->document().node_event_listener_was_removed(listener.type);
+}
+
 // https://dom.spec.whatwg.org/#dom-eventtarget-addeventlistener
 void EventTarget::add_event_listener(Utf16FlyString const& type, IDLEventListener* callback, Variant<Bindings::AddEventListenerOptions, bool> const& options)
 {
@@ -294,6 +306,7 @@ void EventTarget::add_an_event_listener(DOMEventListener& listener)
         event_listener_list.append(listener);
         invalidate_compositor_wheel_event_listener_state(*this, listener);
         update_needs_beforeunload_check(*this, listener);
+        update_document_node_event_listener_counts(*this, listener, true);
     }
 
     // 6. If listener’s signal is not null, then add the following abort steps to it:
@@ -350,6 +363,7 @@ void EventTarget::remove_an_event_listener(DOMEventListener& listener)
     if (did_remove) {
         invalidate_compositor_wheel_event_listener_state(*this, listener);
         update_needs_beforeunload_check(*this, listener);
+        update_document_node_event_listener_counts(*this, listener, false);
     }
 }
 
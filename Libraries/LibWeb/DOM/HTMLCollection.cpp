@@ -52,6 +52,7 @@ void HTMLCollection::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_root);
     visitor.visit_possible_values(m_filter.raw_capture_range());
     visitor.visit_possible_values(m_sort.raw_capture_range());
+    visitor.visit_possible_values(m_candidate_collector.raw_capture_range());
 }
 
 GC::Cell const& HTMLCollection::owner_cell(Badge<GC::Heap>) const
@@ -104,11 +105,13 @@ void HTMLCollection::update_cache_if_needed() const
     m_cached_elements.clear();
     m_cached_name_to_element_mappings = nullptr;
     if (m_scope == Scope::Descendants) {
-        m_root->for_each_in_subtree_of_type<Element>([&](auto& element) {
-            if (m_filter(element))
-                m_cached_elements.append(element);
-            return TraversalDecision::Continue;
-        });
+        if (!ElementIndex::collect_matching_descendants(*m_root, m_candidate_collector, m_filter, m_cached_elements)) {
+            m_root->for_each_in_subtree_of_type<Element>([&](auto& element) {
+                if (m_filter(element))
+                    m_cached_elements.append(element);
+                return TraversalDecision::Continue;
+            });
+        }
     } else {
         m_root->for_each_child_of_type<Element>([&](auto& element) {
             if (m_filter(element))
@@ -11,6 +11,7 @@
 #include <LibGC/Ptr.h>
 #include <LibGC/WeakContainer.h>
 #include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/DOM/ElementIndex.h>
 #include <LibWeb/Forward.h>
 
 namespace Web::DOM {
@@ -43,6 +44,9 @@ public:
 
     GC::RootVector<GC::Ref<Element>> collect_matching_elements() const;
 
+    // Lets the collection look up candidates in the document's element index instead of traversing its subtree.
+    void set_candidate_collector(ElementIndex::CandidateCollector collector) { m_candidate_collector = move(collector); }
+
     virtual Optional<JS::Value> item_value(size_t index) const override;
     virtual JS::Value named_item_value(Utf16FlyString const& name) const override;
     virtual Vector<Utf16FlyString> supported_property_names() const override;
@@ -71,6 +75,7 @@ private:
     GC::Ref<ParentNode> m_root;
     Function<bool(Element const&)> m_filter;
     Function<bool(Element const&, Element const&)> m_sort;
+    ElementIndex::CandidateCollector m_candidate_collector;
 
     Scope m_scope { Scope::Descendants };
 };
@@ -34,11 +34,23 @@ void LiveNodeList::visit_edges(Cell::Visitor& visitor)
     Base::visit_edges(visitor);
     visitor.visit(m_root);
     visitor.visit_possible_values(m_filter.raw_capture_range());
+    visitor.visit_possible_values(m_candidate_collector.raw_capture_range());
 }
 
 GC::RootVector<Node*> LiveNodeList::collection() const
 {
     GC::RootVector<Node*> nodes;
+    if (m_scope == Scope::Descendants && m_candidate_collector) {
+        Vector<GC::RawPtr<Element>> elements;
+        auto element_filter = [this](Element const& element) { return m_filter(element); };
+        if (ElementIndex::collect_matching_descendants(*m_root, m_candidate_collector, element_filter, elements)) {
+            nodes.ensure_capacity(elements.size());
+            for (auto element : elements)
+                nodes.unchecked_append(element.ptr());
+            return nodes;
+        }
+    }
+
     if (m_scope == Scope::Descendants) {
         m_root->for_each_in_subtree([&](auto& node) {
             if (m_filter(node))
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AK/Function.h>
+#include <LibWeb/DOM/ElementIndex.h>
 #include <LibWeb/DOM/NodeList.h>
 
 namespace Web::DOM {
@@ -30,6 +31,9 @@ public:
     virtual u32 length() const override;
     virtual Node const* item(u32 index) const override;
 
+    // Lets the list look up candidates in the document's element index instead of traversing its subtree.
+    void set_candidate_collector(ElementIndex::CandidateCollector collector) { m_candidate_collector = move(collector); }
+
 protected:
     LiveNodeList(JS::Realm&, Node const& root, Scope, ESCAPING Function<bool(Node const&)> filter);
 
@@ -42,6 +46,7 @@ private:
 
     GC::Ref<Node const> m_root;
     Function<bool(Node const&)> m_filter;
+    ElementIndex::CandidateCollector m_candidate_collector;
     Scope m_scope { Scope::Descendants };
 };
 
@@ -733,7 +733,8 @@ void Node::insert_before(GC::Ref<Node> node, GC::Ptr<Node> child, bool suppress_
 
         // 2. Queue a tree mutation record for node with « », nodes, null, and null.
         // NOTE: This step intentionally does not pay attention to suppressObservers.
-        node->queue_tree_mutation_record({}, nodes, nullptr, nullptr);
+        if (node->may_have_mutation_record_consumers())
+            node->queue_tree_mutation_record({}, nodes, nullptr, nullptr);
     }
 
     // 5. If child is non-null:
@@ -849,7 +850,7 @@ void Node::insert_before(GC::Ref<Node> node, GC::Ptr<Node> child, bool suppress_
 
     // 8. If suppressObservers is false, then queue a tree mutation record for parent with nodes, « », previousSibling,
     //    and child.
-    if (!suppress_observers) {
+    if (!suppress_observers && may_have_mutation_record_consumers()) {
         queue_tree_mutation_record(nodes, {}, previous_sibling.ptr(), child.ptr());
     }
 
@@ -1108,20 +1109,23 @@ void Node::remove(bool suppress_observers)
     //     registered observer list, if registered’s options["subtree"] is true, then append a new transient registered
     //     observer whose observer is registered’s observer, options is registered’s options, and source is registered
     //     to node’s registered observer list.
-    for (auto* inclusive_ancestor = parent; inclusive_ancestor; inclusive_ancestor = inclusive_ancestor->parent()) {
-        if (!inclusive_ancestor->m_registered_observer_list)
-            continue;
-        for (auto& registered : *inclusive_ancestor->m_registered_observer_list) {
-            if (registered->options().subtree) {
-                auto transient_observer = TransientRegisteredObserver::create(registered->observer(), registered->options(), registered);
-                add_registered_observer(move(transient_observer));
+    // OPTIMIZATION: Documents that never had an observer have no registered observers to find here.
+    if (document().has_ever_had_registered_mutation_observers()) {
+        for (auto* inclusive_ancestor = parent; inclusive_ancestor; inclusive_ancestor = inclusive_ancestor->parent()) {
+            if (!inclusive_ancestor->m_registered_observer_list)
+                continue;
+            for (auto& registered : *inclusive_ancestor->m_registered_observer_list) {
+                if (registered->options().subtree) {
+                    auto transient_observer = TransientRegisteredObserver::create(registered->observer(), registered->options(), registered);
+                    add_registered_observer(move(transient_observer));
+                }
             }
         }
     }
 
     // 16. If suppressObservers is false, then queue a tree mutation record for parent with « », « node »,
     //     oldPreviousSibling, and oldNextSibling.
-    if (!suppress_observers) {
+    if (!suppress_observers && parent->may_have_mutation_record_consumers()) {
         parent->queue_tree_mutation_record({}, { *this }, old_previous_sibling.ptr(), old_next_sibling.ptr());
     }
 
@@ -1450,10 +1454,12 @@ WebIDL::ExceptionOr<void> Node::move_node(Node& new_parent, Node* child)
     });
 
     // 25. Queue a tree mutation record for oldParent with « », « node », oldPreviousSibling, and oldNextSibling.
-    old_parent->queue_tree_mutation_record({}, { *this }, old_previous_sibling, old_next_sibling);
+    if (old_parent->may_have_mutation_record_consumers())
+        old_parent->queue_tree_mutation_record({}, { *this }, old_previous_sibling, old_next_sibling);
 
     // 26. Queue a tree mutation record for newParent with « node », « », newPreviousSibling, and child.
-    new_parent.queue_tree_mutation_record({ *this }, {}, new_previous_sibling, child);
+    if (new_parent.may_have_mutation_record_consumers())
+        new_parent.queue_tree_mutation_record({ *this }, {}, new_previous_sibling, child);
 
     document().bump_dom_tree_version();
 
@@ -1638,6 +1644,16 @@ void Node::set_document(Document& document)
     bool const descendants_need_style_update = child_needs_style_update();
     m_document = &document;
 
+    if (m_registered_observer_list && !m_registered_observer_list->is_empty())
+        document.set_has_ever_had_registered_mutation_observers();
+
+    if (has_event_listeners()) {
+        for (auto const& listener : event_listener_list()) {
+            old_document.node_event_listener_was_removed(listener->type);
+            document.node_event_listener_was_added(listener->type);
+        }
+    }
+
     if (auto* animatable = as_if<Animations::Animatable>(*this))
         animatable->on_document_changed(old_document, document);
 
@@ -1807,6 +1823,9 @@ static bool is_structural_boundary_self_rebuild_reason(SetNeedsLayoutTreeUpdateR
     // The box of an element that entered the top layer leaves the parent's subtree,
     // which is a child-list change.
     case SetNeedsLayoutTreeUpdateReason::TopLayerMembershipChange:
+    // Skipping or restoring the contents of a content-visibility: auto element only changes its
+    // children.
+    case SetNeedsLayoutTreeUpdateReason::ContentVisibilityRelevanceChange:
         return true;
     default:
         return false;
@@ -1897,6 +1916,8 @@ void Node::set_needs_layout_tree_update(bool value, SetNeedsLayoutTreeUpdateReas
 
 void Node::set_needs_style_update(bool value)
 {
+    if (!value)
+        m_style_invalidation_reason = {};
     if (m_needs_style_update == value)
         return;
     m_needs_style_update = value;
@@ -1905,6 +1926,7 @@ void Node::set_needs_style_update(bool value)
         document().set_needs_repaint(Badge<Node> {}, InvalidateDisplayList::No);
 
         document().record_style_invalidation();
+        record_style_invalidation_reason();
         for (auto* ancestor = parent_or_shadow_host(); ancestor; ancestor = ancestor->parent_or_shadow_host()) {
             if (ancestor->m_child_needs_style_update)
                 break;
@@ -1913,6 +1935,18 @@ void Node::set_needs_style_update(bool value)
     }
 }
 
+void Node::record_style_invalidation_reason(Optional<StyleInvalidationReason> reason)
+{
+    if (m_style_invalidation_reason.has_value())
+        return;
+    if (!reason.has_value())
+        reason = document().active_style_invalidation_reason();
+    if (!reason.has_value())
+        return;
+    m_style_invalidation_reason = reason;
+    ++document().style_invalidation_counters().per_reason[to_underlying(*reason)].nodes_marked;
+}
+
 void Node::post_connection()
 {
 }
@@ -2961,6 +2995,10 @@ RefPtr<Painting::Paintable> Node::unsafe_paintable_box()
 // https://dom.spec.whatwg.org/#queue-a-mutation-record
 void Node::queue_mutation_record(Utf16FlyString const& type, Optional<Utf16FlyString> const& attribute_name, Optional<Utf16FlyString> const& attribute_namespace, Optional<Utf16String> const& old_value, Vector<GC::Root<Node>> added_nodes, Vector<GC::Root<Node>> removed_nodes, Node* previous_sibling, Node* next_sibling)
 {
+    // OPTIMIZATION: Skip gathering interested observers when there can't be any.
+    if (!may_have_mutation_record_consumers())
+        return;
+
     auto& document = this->document();
     auto& page = document.page();
 
@@ -3642,6 +3680,23 @@ void Node::add_registered_observer(RegisteredObserver& registered_observer)
     if (!m_registered_observer_list)
         m_registered_observer_list = make<Vector<GC::Ref<RegisteredObserver>>>();
     m_registered_observer_list->append(registered_observer);
+    document().set_has_ever_had_registered_mutation_observers();
+}
+
+bool Node::may_have_mutation_record_consumers() const
+{
+    auto const& document = this->document();
+    if (document.page().listen_for_dom_mutations())
+        return true;
+    if (!document.has_ever_had_registered_mutation_observers())
+        return false;
+
+    // NB: Records are only delivered to observers registered on the target's inclusive ancestors.
+    for (auto const* node = this; node; node = node->parent()) {
+        if (node->m_registered_observer_list && !node->m_registered_observer_list->is_empty())
+            return true;
+    }
+    return false;
 }
 
 bool Node::has_inclusive_ancestor_with_display_none_ignoring_animations() const
@@ -3659,9 +3714,12 @@ bool Node::has_inclusive_ancestor_with_display_none_ignoring_animations() const
 
 bool Node::has_inclusive_ancestor_with_event_listener(Utf16FlyString const& type) const
 {
-    for (auto const* ancestor = this; ancestor; ancestor = ancestor->parent_or_shadow_host()) {
-        if (ancestor->has_event_listener(type))
-            return true;
+    // NB: All inclusive ancestors belong to our document, so if none of its nodes listen for type, neither do they.
+    if (document().may_have_node_event_listener(type)) {
+        for (auto const* ancestor = this; ancestor; ancestor = ancestor->parent_or_shadow_host()) {
+            if (ancestor->has_event_listener(type))
+                return true;
+        }
     }
     if (auto window = document().window())
         return window->has_event_listener(type);
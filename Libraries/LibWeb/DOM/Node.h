@@ -67,6 +67,7 @@ enum class ShouldComputeRole {
 
 #define ENUMERATE_SET_NEEDS_LAYOUT_REASONS(X)         \
     X(CharacterDataReplaceData)                       \
+    X(DocumentReactivated)                            \
     X(FinalizeACrossDocumentNavigation)               \
     X(GeneratedContentImageFinishedLoading)           \
     X(HTMLCanvasElementWidthOrHeightChange)           \
@@ -77,6 +78,7 @@ enum class ShouldComputeRole {
     X(KeyframeEffect)                                 \
     X(LayoutTreeUpdate)                               \
     X(NavigableSetViewportSize)                       \
+    X(PartialRelayoutBoundaryBaselineChange)          \
     X(SVGGraphicsElementTransformChange)              \
     X(SVGImageElementFetchTheDocument)                \
     X(SVGImageFilterFetch)                            \
@@ -93,6 +95,7 @@ enum class SetNeedsLayoutReason {
 
 #define ENUMERATE_SET_NEEDS_LAYOUT_TREE_UPDATE_REASONS(X) \
     X(CharacterDataReplaceData)                           \
+    X(ContentVisibilityRelevanceChange)                   \
     X(ElementSetInnerHTML)                                \
     X(ElementSetShadowRoot)                               \
     X(DetailsElementOpenedOrClosed)                       \
@@ -339,6 +342,8 @@ public:
         };
         Type type {};
         GC::Ref<Node> node;
+        // For mutations, whether the node's data went from empty to non-empty or the other way around.
+        bool changed_emptiness { true };
     };
     // FIXME: It would be good if we could always provide this metadata for use in optimizations.
     virtual void children_changed(ChildrenChangedMetadata const&) { }
@@ -391,6 +396,11 @@ public:
     [[nodiscard]] bool entire_subtree_needs_style_update() const { return m_entire_subtree_needs_style_update; }
     void set_entire_subtree_needs_style_update(bool b) { m_entire_subtree_needs_style_update = b; }
 
+    // The reason this node was first marked dirty since its style was last updated, for invalidation profiling.
+    Optional<StyleInvalidationReason> style_invalidation_reason() const { return m_style_invalidation_reason; }
+    Optional<StyleInvalidationReason> take_style_invalidation_reason() { return exchange(m_style_invalidation_reason, {}); }
+    void record_style_invalidation_reason(Optional<StyleInvalidationReason> = {});
+
     [[nodiscard]] bool children_may_depend_on_non_inherited_property_inheritance() const { return m_children_may_depend_on_non_inherited_property_inheritance; }
     void set_children_may_depend_on_non_inherited_property_inheritance() { m_children_may_depend_on_non_inherited_property_inheritance = true; }
 
@@ -460,6 +470,10 @@ public:
 
     void add_registered_observer(RegisteredObserver&);
 
+    // Whether a mutation record queued for this node could reach anyone. Callers use this to skip building the node
+    // lists of records that nobody would receive.
+    bool may_have_mutation_record_consumers() const;
+
     void queue_mutation_record(Utf16FlyString const& type, Optional<Utf16FlyString> const& attribute_name, Optional<Utf16FlyString> const& attribute_namespace, Optional<Utf16String> const& old_value, Vector<GC::Root<Node>> added_nodes, Vector<GC::Root<Node>> removed_nodes, Node* previous_sibling, Node* next_sibling);
 
     // https://dom.spec.whatwg.org/#concept-shadow-including-inclusive-descendant
@@ -550,6 +564,7 @@ protected:
     bool m_in_editable_subtree { false };
     bool m_is_connected { false };
     bool m_inside_blocking_wheel_event_handler { false };
+    Optional<StyleInvalidationReason> m_style_invalidation_reason;
 
     UniqueNodeID m_unique_id;
 
@@ -95,6 +95,19 @@ GC::Ref<HTMLCollection> ParentNode::children()
     return *m_children;
 }
 
+static ElementIndex::CandidateCollector elements_with_any_qualified_name_collector(Vector<Utf16FlyString> qualified_names)
+{
+    return [qualified_names = move(qualified_names)](ElementIndex const& index, Vector<GC::RawPtr<Element>>& candidates) {
+        for (auto const& qualified_name : qualified_names) {
+            if (auto const* elements = index.elements_with_qualified_name(qualified_name)) {
+                for (auto element : *elements)
+                    candidates.append(element);
+            }
+        }
+        return true;
+    };
+}
+
 // https://dom.spec.whatwg.org/#concept-getelementsbytagname
 // NOTE: This method is only exposed on Document and Element, but is in ParentNode to prevent code duplication.
 GC::Ref<HTMLCollection> ParentNode::get_elements_by_tag_name(Utf16FlyString const& qualified_name)
@@ -109,7 +122,10 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_tag_name(Utf16FlyString cons
     // 2. Otherwise, if root’s node document is an HTML document, return a HTMLCollection rooted at root, whose filter matches the following descendant elements:
     if (root().document().document_type() == Document::Type::HTML) {
         auto lowercase_qualified_name = qualified_name.to_ascii_lowercase();
-        return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [qualified_name, lowercase_qualified_name = move(lowercase_qualified_name)](Element const& element) {
+        Vector<Utf16FlyString> candidate_qualified_names { lowercase_qualified_name };
+        if (qualified_name != lowercase_qualified_name)
+            candidate_qualified_names.append(qualified_name);
+        auto collection = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [qualified_name, lowercase_qualified_name = move(lowercase_qualified_name)](Element const& element) {
             // - Whose namespace is the HTML namespace and whose qualified name is qualifiedName, in ASCII lowercase.
             if (element.namespace_uri() == Namespace::HTML)
                 return element.qualified_name() == lowercase_qualified_name;
@@ -117,12 +133,16 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_tag_name(Utf16FlyString cons
             // - Whose namespace is not the HTML namespace and whose qualified name is qualifiedName.
             return element.qualified_name().view() == qualified_name.view();
         });
+        collection->set_candidate_collector(elements_with_any_qualified_name_collector(move(candidate_qualified_names)));
+        return collection;
     }
 
     // 3. Otherwise, return a HTMLCollection rooted at root, whose filter matches descendant elements whose qualified name is qualifiedName.
-    return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [qualified_name](Element const& element) {
+    auto collection = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [qualified_name](Element const& element) {
         return element.qualified_name().view() == qualified_name.view();
     });
+    collection->set_candidate_collector(elements_with_any_qualified_name_collector({ qualified_name }));
+    return collection;
 }
 
 // https://dom.spec.whatwg.org/#concept-getelementsbytagnamens
@@ -247,13 +267,39 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_class_name(Utf16View class_n
     if (token_start.has_value())
         append_class_name(class_names.substring_view(*token_start));
 
-    return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [list_of_class_names = move(list_of_class_names), quirks_mode = document().in_quirks_mode()](Element const& element) {
+    Vector<Utf16FlyString> candidate_class_names;
+    for (auto const& class_name : list_of_class_names)
+        candidate_class_names.append(Utf16FlyString::from_utf16(class_name.utf16_view()));
+
+    auto quirks_mode = document().in_quirks_mode();
+    auto collection = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [list_of_class_names = move(list_of_class_names), quirks_mode](Element const& element) {
         for (auto& name : list_of_class_names) {
             if (!element.has_class(name.utf16_view(), quirks_mode ? CaseSensitivity::CaseInsensitive : CaseSensitivity::CaseSensitive))
                 return false;
         }
         return !list_of_class_names.is_empty();
     });
+
+    // NB: The index is keyed case-sensitively, so quirks mode documents have to traverse.
+    if (!quirks_mode) {
+        collection->set_candidate_collector([class_names = move(candidate_class_names)](ElementIndex const& index, Vector<GC::RawPtr<Element>>& candidates) {
+            // Matching elements have every one of the class names, so the elements with the rarest one are enough.
+            ElementIndex::ElementSet const* smallest_set = nullptr;
+            for (auto const& class_name : class_names) {
+                auto const* elements = index.elements_with_class(class_name);
+                if (!elements)
+                    return true;
+                if (!smallest_set || elements->size() < smallest_set->size())
+                    smallest_set = elements;
+            }
+            if (smallest_set) {
+                for (auto element : *smallest_set)
+                    candidates.append(element);
+            }
+            return true;
+        });
+    }
+    return collection;
 }
 
 GC::Ptr<Element> ParentNode::get_element_by_id(Utf16View id) const
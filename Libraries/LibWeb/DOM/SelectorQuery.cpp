@@ -8,8 +8,11 @@
 #include <LibWeb/CSS/SelectorMatching.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Element.h>
+#include <LibWeb/DOM/ElementByIdMap.h>
+#include <LibWeb/DOM/ElementIndex.h>
 #include <LibWeb/DOM/ParentNode.h>
 #include <LibWeb/DOM/SelectorQuery.h>
+#include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/DOM/StaticNodeList.h>
 
 namespace Web::DOM {
@@ -74,6 +77,168 @@ SelectorQuery::SelectorQuery(CSS::SelectorList&& selectors)
         if (!m_is_result_cacheable)
             break;
     }
+
+    if (m_selectors.size() != 1 || m_selectors.first()->contains_the_nesting_selector())
+        return;
+
+    auto const& compound_selectors = m_selectors.first()->compound_selectors();
+    auto only_simple_selector = [](CSS::Selector::CompoundSelector const& compound_selector) -> CSS::Selector::SimpleSelector const* {
+        if (compound_selector.simple_selectors.size() != 1)
+            return nullptr;
+        return &compound_selector.simple_selectors.first();
+    };
+
+    auto const* first = only_simple_selector(compound_selectors.first());
+    if (!first)
+        return;
+
+    if (compound_selectors.size() == 1) {
+        switch (first->type) {
+        case CSS::Selector::SimpleSelector::Type::Id:
+            m_plan = Plan::Id;
+            m_plan_key = first->id_name();
+            break;
+        case CSS::Selector::SimpleSelector::Type::Class:
+            m_plan = Plan::ClassName;
+            m_plan_key = first->class_name();
+            break;
+        case CSS::Selector::SimpleSelector::Type::TagName:
+            m_plan = Plan::TagName;
+            m_plan_key = first->qualified_name().name.name;
+            m_plan_lowercase_key = first->qualified_name().name.lowercase_name;
+            break;
+        default:
+            break;
+        }
+        return;
+    }
+
+    if (first->type == CSS::Selector::SimpleSelector::Type::PseudoClass
+        && first->pseudo_class().type == CSS::PseudoClass::Scope
+        && compound_selectors.size() == 2
+        && compound_selectors[1].combinator == CSS::Selector::Combinator::ImmediateChild) {
+        m_plan = Plan::ScopeChildren;
+        return;
+    }
+
+    // Descendant and child combinators keep every subject inside the subtree of the element matched by the leftmost
+    // compound selector.
+    if (first->type == CSS::Selector::SimpleSelector::Type::Id) {
+        for (size_t i = 1; i < compound_selectors.size(); ++i) {
+            auto combinator = compound_selectors[i].combinator;
+            if (combinator != CSS::Selector::Combinator::Descendant && combinator != CSS::Selector::Combinator::ImmediateChild)
+                return;
+        }
+        m_plan = Plan::DescendantsOfId;
+        m_plan_key = first->id_name();
+    }
+}
+
+bool SelectorQuery::for_each_candidate(ParentNode& root, Function<IterationDecision(Element&)> const& callback) const
+{
+    auto for_each_in_tree_order = [&](Vector<GC::RawPtr<Element>> const& elements) {
+        for (auto element : elements) {
+            if (callback(*element) == IterationDecision::Break)
+                break;
+        }
+        return true;
+    };
+
+    auto collect_from_element_index = [&](ElementIndex::CandidateCollector const& collector) {
+        Vector<GC::RawPtr<Element>> elements;
+        if (!ElementIndex::collect_matching_descendants(root, collector, [](Element const&) { return true; }, elements))
+            return false;
+        return for_each_in_tree_order(elements);
+    };
+
+    // The element-by-id maps are only maintained for connected trees.
+    auto elements_with_plan_id = [&] {
+        Vector<GC::RawPtr<Element>> elements;
+        auto& tree_root = root.root();
+        auto& element_by_id = is<ShadowRoot>(tree_root) ? static_cast<ShadowRoot&>(tree_root).element_by_id() : root.document().element_by_id();
+        element_by_id.for_each_element_with_id(m_plan_key.view(), tree_root, [&](Element& element) {
+            elements.append(element);
+        });
+        return elements;
+    };
+
+    switch (m_plan) {
+    case Plan::Traverse:
+        return false;
+
+    case Plan::Id: {
+        // NB: Quirks mode matches ids and classes ASCII case-insensitively, which the maps can't look up.
+        if (!root.is_connected() || root.document().in_quirks_mode())
+            return false;
+        Vector<GC::RawPtr<Element>> elements;
+        for (auto element : elements_with_plan_id()) {
+            if (root.is_ancestor_of(*element))
+                elements.append(element);
+        }
+        return for_each_in_tree_order(elements);
+    }
+
+    case Plan::DescendantsOfId: {
+        if (!root.is_connected() || root.document().in_quirks_mode())
+            return false;
+        auto elements = elements_with_plan_id();
+        if (elements.is_empty())
+            return true;
+        if (elements.size() > 1)
+            return false;
+
+        // An id element above the root could match for every element in the subtree, and one elsewhere for none.
+        auto& element_with_id = *elements.first();
+        if (element_with_id.is_inclusive_ancestor_of(root))
+            return false;
+        if (!root.is_ancestor_of(element_with_id))
+            return true;
+
+        element_with_id.for_each_in_subtree_of_type<Element>([&](Element& element) {
+            if (callback(element) == IterationDecision::Break)
+                return TraversalDecision::Break;
+            return TraversalDecision::Continue;
+        });
+        return true;
+    }
+
+    case Plan::ClassName:
+        if (root.document().in_quirks_mode())
+            return false;
+        return collect_from_element_index([&](ElementIndex const& index, Vector<GC::RawPtr<Element>>& candidates) {
+            if (auto const* elements = index.elements_with_class(m_plan_key)) {
+                for (auto element : *elements)
+                    candidates.append(element);
+            }
+            return true;
+        });
+
+    case Plan::TagName:
+        return collect_from_element_index([&](ElementIndex const& index, Vector<GC::RawPtr<Element>>& candidates) {
+            auto append_elements_with_local_name = [&](Utf16FlyString const& local_name) {
+                for (auto const* elements : { index.elements_with_qualified_name(local_name), index.prefixed_elements_with_local_name(local_name) }) {
+                    if (!elements)
+                        continue;
+                    for (auto element : *elements)
+                        candidates.append(element);
+                }
+            };
+            append_elements_with_local_name(m_plan_lowercase_key);
+            if (m_plan_key != m_plan_lowercase_key)
+                append_elements_with_local_name(m_plan_key);
+            return true;
+        });
+
+    case Plan::ScopeChildren:
+        // NB: For any other root, :scope matches the root element rather than the root itself.
+        if (!is<Element>(root))
+            return false;
+        root.for_each_child_of_type<Element>([&](Element& element) {
+            return callback(element);
+        });
+        return true;
+    }
+    VERIFY_NOT_REACHED();
 }
 
 // https://dom.spec.whatwg.org/#scope-match-a-selectors-string
@@ -88,16 +253,22 @@ GC::Ptr<Element> SelectorQuery::query_first(ParentNode& root) const
     }
 
     GC::Ptr<Element> result;
-    // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
-    root.for_each_in_subtree_of_type<Element>([&](auto& element) {
+    auto visit = [&](Element& element) {
         for (auto const& selector : m_selectors) {
             SelectorMatching::MatchContext context;
             if (SelectorMatching::matches(selector, element, nullptr, context, root)) {
                 result = &element;
-                return TraversalDecision::Break;
+                return IterationDecision::Break;
             }
         }
-        return TraversalDecision::Continue;
+        return IterationDecision::Continue;
+    };
+    if (for_each_candidate(root, visit))
+        return result;
+
+    // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
+    root.for_each_in_subtree_of_type<Element>([&](auto& element) {
+        return visit(element) == IterationDecision::Break ? TraversalDecision::Break : TraversalDecision::Continue;
     });
     return result;
 }
@@ -123,8 +294,7 @@ GC::Ref<NodeList> SelectorQuery::query_all(ParentNode& root) const
     }
 
     Vector<GC::RawPtr<Element>> elements;
-    // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
-    root.for_each_in_subtree_of_type<Element>([&](auto& element) {
+    auto visit = [&](Element& element) {
         for (auto const& selector : m_selectors) {
             SelectorMatching::MatchContext context;
             if (SelectorMatching::matches(selector, element, nullptr, context, root)) {
@@ -132,8 +302,15 @@ GC::Ref<NodeList> SelectorQuery::query_all(ParentNode& root) const
                 break;
             }
         }
-        return TraversalDecision::Continue;
-    });
+        return IterationDecision::Continue;
+    };
+    if (!for_each_candidate(root, visit)) {
+        // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
+        root.for_each_in_subtree_of_type<Element>([&](auto& element) {
+            visit(element);
+            return TraversalDecision::Continue;
+        });
+    }
 
     auto node_list = create_node_list(root.realm(), elements);
     if (m_is_result_cacheable)
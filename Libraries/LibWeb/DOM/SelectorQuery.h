@@ -36,8 +36,30 @@ public:
 private:
     explicit SelectorQuery(CSS::SelectorList&&);
 
+    // How to find the elements worth running the matcher on, chosen once from the shape of the selector list. Every
+    // candidate still goes through the full matcher, so a plan only has to find a superset of the matches.
+    enum class Plan : u8 {
+        Traverse,        // Anything else: walk the whole subtree.
+        Id,              // `#id`
+        ClassName,       // `.class`
+        TagName,         // `tag`
+        DescendantsOfId, // `#id a`, `#id > a > b`, ...
+        ScopeChildren,   // `:scope > a`
+    };
+
+    // Calls callback, in tree order, for each descendant of root that the plan can't rule out. Returns false if the
+    // plan can't be used for this root, in which case the caller has to walk the subtree instead.
+    bool for_each_candidate(ParentNode& root, Function<IterationDecision(Element&)> const& callback) const;
+
     CSS::SelectorList m_selectors;
 
+    Plan m_plan { Plan::Traverse };
+
+    // The id, class or tag name the plan looks up. For tag names, this is the name as written in the selector, and
+    // m_plan_lowercase_key its lowercase form that matches HTML elements.
+    Utf16FlyString m_plan_key;
+    Utf16FlyString m_plan_lowercase_key;
+
     // Whether matching can only change when the document's dom_tree_version (plus character_data_version, see below)
     // changes. Queries with selectors that depend on other state (:hover, :checked, :target, etc) are not cacheable.
     bool m_is_result_cacheable { false };
@@ -6,6 +6,10 @@
 
 #pragma once
 
+#include <AK/Assertions.h>
+#include <AK/StringView.h>
+#include <AK/Types.h>
+
 namespace Web::DOM {
 
 #define ENUMERATE_STYLE_INVALIDATION_REASONS(X)     \
@@ -58,12 +62,30 @@ namespace Web::DOM {
     X(StyleSheetListRemoveSheet)                    \
     X(StyleSheetReplace)
 
-enum class StyleInvalidationReason {
+enum class StyleInvalidationReason : u8 {
 #define __ENUMERATE_STYLE_INVALIDATION_REASON(reason) reason,
     ENUMERATE_STYLE_INVALIDATION_REASONS(__ENUMERATE_STYLE_INVALIDATION_REASON)
 #undef __ENUMERATE_STYLE_INVALIDATION_REASON
 };
 
+constexpr size_t style_invalidation_reason_count = 0
+#define __ENUMERATE_STYLE_INVALIDATION_REASON(reason) +1
+    ENUMERATE_STYLE_INVALIDATION_REASONS(__ENUMERATE_STYLE_INVALIDATION_REASON)
+#undef __ENUMERATE_STYLE_INVALIDATION_REASON
+    ;
+
+constexpr StringView to_string(StyleInvalidationReason reason)
+{
+    switch (reason) {
+#define __ENUMERATE_STYLE_INVALIDATION_REASON(reason) \
+    case StyleInvalidationReason::reason:             \
+        return #reason##sv;
+        ENUMERATE_STYLE_INVALIDATION_REASONS(__ENUMERATE_STYLE_INVALIDATION_REASON)
+#undef __ENUMERATE_STYLE_INVALIDATION_REASON
+    }
+    VERIFY_NOT_REACHED();
+}
+
 struct StyleInvalidationOptions {
     bool invalidate_self { false };
     bool invalidate_self_from_property_plan { true };
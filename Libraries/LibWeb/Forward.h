@@ -62,6 +62,7 @@ class DisplayListPlayerSkia;
 class DisplayListRecorder;
 class DisplayListResourceStorage;
 struct DisplayListResourceSet;
+class ImageTextureCache;
 enum class PaintCommandCacheMode : u8;
 struct GradientPaintStyle;
 struct PatternPaintStyle;
@@ -558,6 +559,7 @@ class DOMTokenList;
 class EditingHostManager;
 class Element;
 class ElementByIdMap;
+class ElementIndex;
 class Event;
 class EventHandler;
 class EventTarget;
@@ -708,6 +710,7 @@ class AnimationFrameCallbackDriver;
 class AudioTrack;
 class AudioTrackList;
 class AutoplaySettings;
+class BackForwardCache;
 class BarProp;
 class BeforeUnloadEvent;
 class BroadcastChannel;
@@ -1004,6 +1007,13 @@ struct LayoutState;
 
 }
 
+namespace Web::LongAnimationFrames {
+
+struct FrameTimingInfo;
+class PerformanceLongAnimationFrameTiming;
+
+}
+
 namespace Web::MathML {
 
 class MathMLAnchorElement;
@@ -1091,6 +1101,9 @@ namespace Web::Platform {
 
 class Timer;
 
+struct DecodedImage;
+struct PartialImage;
+
 }
 
 namespace Web::ReferrerPolicy {
@@ -1117,6 +1130,12 @@ class PerformanceResourceTiming;
 
 }
 
+namespace Web::Scheduling {
+
+class Scheduler;
+
+}
+
 namespace Web::Selection {
 
 class Selection;
@@ -1307,6 +1326,7 @@ class WebAssemblyModule;
 
 namespace Web::WebAudio {
 
+class AnalyserNode;
 class AudioBuffer;
 class AudioBufferSourceNode;
 class AudioContext;
@@ -1317,19 +1337,36 @@ class AudioParam;
 class AudioScheduledSourceNode;
 class BaseAudioContext;
 class BiquadFilterNode;
+class ChannelMergerNode;
+class ChannelSplitterNode;
+class ConstantSourceNode;
 class ControlMessageQueue;
+class DelayNode;
 class DynamicsCompressorNode;
 class GainNode;
+class MediaElementAudioSourceNode;
 class OfflineAudioCompletionEvent;
 class OfflineAudioContext;
 class OscillatorNode;
 class PannerNode;
 class PeriodicWave;
+class ScriptProcessorNode;
+class StereoPannerNode;
 
 enum class AudioContextState;
 
 }
 
+namespace Web::WebAudio::Render {
+
+class OfflineRenderer;
+class RealtimeRenderer;
+class RenderGraph;
+class RenderNode;
+class RenderParam;
+
+}
+
 namespace Web::WebGL {
 
 class RemoteWebGLTransport;
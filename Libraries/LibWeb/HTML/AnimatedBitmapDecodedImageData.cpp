@@ -84,6 +84,8 @@ GC::Ref<AnimatedBitmapDecodedImageData> AnimatedBitmapDecodedImageData::create(
     if (!initial_bitmaps.is_empty())
         data->m_last_displayed_frame = data->m_buffer_slots[0].frame;
 
+    realm.heap().did_allocate_external_memory(data->external_memory_size());
+
     install_frame_delivery_callback();
     session_registry().set(session_id, data.ptr());
 
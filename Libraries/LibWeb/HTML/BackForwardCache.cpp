@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/Fetch/Infrastructure/FetchController.h>
+#include <LibWeb/Fetch/Infrastructure/FetchRecord.h>
+#include <LibWeb/HTML/BackForwardCache.h>
+#include <LibWeb/HTML/EventNames.h>
+#include <LibWeb/HTML/LocalNavigable.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/SessionHistoryEntry.h>
+#include <LibWeb/HTML/Window.h>
+
+namespace Web::HTML {
+
+GC_DEFINE_ALLOCATOR(BackForwardCache);
+
+// A rough figure covering a node along with its style, layout and paint state.
+static constexpr size_t estimated_memory_usage_per_node = 2 * KiB;
+
+static size_t estimate_memory_usage(DOM::Document const& document)
+{
+    size_t node_count = 0;
+    document.for_each_in_inclusive_subtree([&](auto const&) {
+        ++node_count;
+        return TraversalDecision::Continue;
+    });
+    return node_count * estimated_memory_usage_per_node;
+}
+
+bool BackForwardCache::can_store(DOM::Document& document, SessionHistoryEntry const& target_entry, Bindings::NavigationType navigation_type)
+{
+    // Reloads and replacements drop the document's session history entry, so nothing could traverse back to it.
+    if (navigation_type != Bindings::NavigationType::Push && navigation_type != Bindings::NavigationType::Traverse)
+        return false;
+
+    auto latest_entry = document.latest_entry();
+    if (!latest_entry || latest_entry.ptr() == &target_entry)
+        return false;
+
+    // Documents in child navigables are unloaded and restored along with their parent's, which would mean freezing and
+    // reactivating a whole tree of documents at once. Only documents without child navigables are kept for now.
+    auto navigable = document.navigable();
+    if (!navigable || !navigable->is_top_level_traversable() || !navigable->child_navigables().is_empty())
+        return false;
+
+    if (!document.is_salvageable() || document.is_initial_about_blank() || document.has_been_destroyed())
+        return false;
+
+    if (!document.url().scheme().is_one_of("http"sv, "https"sv, "file"sv))
+        return false;
+
+    // Responses that arrive while the document is not fully active could not be handled until it is reactivated.
+    for (auto& fetch_record : document.relevant_settings_object().fetch_group()) {
+        auto controller = fetch_record.fetch_controller();
+        if (controller && controller->state() == Fetch::Infrastructure::FetchController::State::Ongoing)
+            return false;
+    }
+
+    // A salvageable document is not sent an unload event, and pages that listen for one usually depend on getting it.
+    if (as<Window>(relevant_global_object(document)).has_event_listener(EventNames::unload))
+        return false;
+
+    return true;
+}
+
+void BackForwardCache::store(GC::Ref<DOM::Document> document)
+{
+    if (auto index = find_entry(document->unique_id()); index.has_value())
+        take_entry(*index);
+
+    auto estimated_memory_usage = estimate_memory_usage(document);
+    m_entries.append({ document, estimated_memory_usage });
+    m_estimated_memory_usage += estimated_memory_usage;
+
+    // The newest document is evicted as well if it does not fit on its own.
+    while (!m_entries.is_empty() && (m_entries.size() > MAX_DOCUMENT_COUNT || m_estimated_memory_usage > MAX_ESTIMATED_MEMORY_USAGE))
+        evict_entry(0);
+}
+
+GC::Ptr<DOM::Document> BackForwardCache::take(UniqueNodeID document_id)
+{
+    auto index = find_entry(document_id);
+    if (!index.has_value())
+        return nullptr;
+    return take_entry(*index).document;
+}
+
+bool BackForwardCache::contains(UniqueNodeID document_id) const
+{
+    return find_entry(document_id).has_value();
+}
+
+void BackForwardCache::evict(UniqueNodeID document_id)
+{
+    if (auto index = find_entry(document_id); index.has_value())
+        evict_entry(*index);
+}
+
+void BackForwardCache::evict_all_except(HashTable<UniqueNodeID> const& document_ids)
+{
+    for (size_t i = m_entries.size(); i > 0; --i) {
+        if (!document_ids.contains(m_entries[i - 1].document->unique_id()))
+            evict_entry(i - 1);
+    }
+}
+
+void BackForwardCache::evict_all()
+{
+    while (!m_entries.is_empty())
+        evict_entry(m_entries.size() - 1);
+}
+
+void BackForwardCache::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    for (auto const& entry : m_entries)
+        visitor.visit(entry.document);
+}
+
+Optional<size_t> BackForwardCache::find_entry(UniqueNodeID document_id) const
+{
+    return m_entries.find_first_index_if([&](auto const& entry) {
+        return entry.document->unique_id() == document_id;
+    });
+}
+
+BackForwardCache::Entry BackForwardCache::take_entry(size_t index)
+{
+    auto entry = m_entries.take(index);
+    m_estimated_memory_usage -= entry.estimated_memory_usage;
+    return entry;
+}
+
+void BackForwardCache::evict_entry(size_t index)
+{
+    auto document = take_entry(index).document;
+
+    // https://html.spec.whatwg.org/multipage/document-lifecycle.html#destroy-a-document-and-its-descendants
+    // NB: Cached documents have no child navigables, so there are no descendants to wait for.
+    // 1. If document is not fully active, then make document unsalvageable given document and "masked".
+    document->make_unsalvageable("masked"_utf16);
+
+    // 6.1. Destroy document.
+    document->destroy();
+}
+
+}
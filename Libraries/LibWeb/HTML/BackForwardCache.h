@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashTable.h>
+#include <AK/Vector.h>
+#include <LibGC/CellAllocator.h>
+#include <LibGC/Ptr.h>
+#include <LibJS/Heap/Cell.h>
+#include <LibWeb/Bindings/NavigationType.h>
+#include <LibWeb/Export.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::HTML {
+
+// Documents that were kept alive when they were unloaded, so that traversing back to their session history entries can
+// reactivate them instead of fetching and building them again. Each top-level traversable has one. Cached documents
+// are not fully active, so tasks queued for them wait until they are reactivated.
+// https://html.spec.whatwg.org/multipage/document-lifecycle.html#note-bfcache
+class WEB_API BackForwardCache final : public JS::Cell {
+    GC_CELL(BackForwardCache, JS::Cell);
+    GC_DECLARE_ALLOCATOR(BackForwardCache);
+
+public:
+    static constexpr size_t MAX_DOCUMENT_COUNT = 6;
+    static constexpr size_t MAX_ESTIMATED_MEMORY_USAGE = 256 * MiB;
+
+    // Whether navigating from the document to the target entry should keep the document alive in the cache.
+    static bool can_store(DOM::Document&, SessionHistoryEntry const& target_entry, Bindings::NavigationType);
+
+    // Stores an unloaded document, evicting the least recently stored documents until the cache is within its limits.
+    void store(GC::Ref<DOM::Document>);
+
+    // Removes the document from the cache and hands it back for reactivation.
+    GC::Ptr<DOM::Document> take(UniqueNodeID document_id);
+
+    bool contains(UniqueNodeID document_id) const;
+
+    // Evicted documents are destroyed.
+    void evict(UniqueNodeID document_id);
+    void evict_all_except(HashTable<UniqueNodeID> const& document_ids);
+    void evict_all();
+
+    size_t document_count() const { return m_entries.size(); }
+
+private:
+    struct Entry {
+        GC::Ref<DOM::Document> document;
+        size_t estimated_memory_usage { 0 };
+    };
+
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    Optional<size_t> find_entry(UniqueNodeID document_id) const;
+    Entry take_entry(size_t index);
+    void evict_entry(size_t index);
+
+    // Least recently stored first.
+    Vector<Entry> m_entries;
+    size_t m_estimated_memory_usage { 0 };
+};
+
+}
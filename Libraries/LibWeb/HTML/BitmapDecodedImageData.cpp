@@ -4,66 +4,246 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashTable.h>
+#include <AK/NeverDestroyed.h>
 #include <LibGC/Heap.h>
 #include <LibGfx/Bitmap.h>
+#include <LibGfx/ImageFormats/ImageDecoder.h>
 #include <LibJS/Runtime/ExternalMemory.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibWeb/CSS/ComputedValues.h>
 #include <LibWeb/HTML/BitmapDecodedImageData.h>
 #include <LibWeb/Painting/DisplayListRecorder.h>
 #include <LibWeb/Painting/DisplayListRecordingContext.h>
+#include <LibWeb/Platform/ImageCodecPlugin.h>
 
 namespace Web::HTML {
 
 GC_DEFINE_ALLOCATOR(BitmapDecodedImageData);
 
-GC::Ref<BitmapDecodedImageData> BitmapDecodedImageData::create(JS::Realm& realm, Gfx::DecodedImageFrame&& frame)
+// How much memory the decoded bitmaps of images that nothing is using may take up before we start discarding them.
+static constexpr size_t unused_decoded_bitmap_budget = 64 * MiB;
+
+// Images that can be decoded again, i.e. those we kept the encoded data of.
+static HashTable<BitmapDecodedImageData*>& redecodable_images()
+{
+    static NeverDestroyed<HashTable<BitmapDecodedImageData*>> images;
+    return *images;
+}
+
+GC::Ref<BitmapDecodedImageData> BitmapDecodedImageData::create(JS::Realm& realm, Gfx::DecodedImageFrame&& frame, ByteBuffer encoded_data)
 {
-    return realm.create<BitmapDecodedImageData>(move(frame));
+    auto data = realm.create<BitmapDecodedImageData>(move(frame), move(encoded_data));
+    realm.heap().did_allocate_external_memory(data->external_memory_size());
+    if (data->can_be_redecoded()) {
+        redecodable_images().set(data.ptr());
+        discard_unused_decoded_bitmaps_if_needed();
+    }
+    return data;
 }
 
-BitmapDecodedImageData::BitmapDecodedImageData(Gfx::DecodedImageFrame&& frame)
+BitmapDecodedImageData::BitmapDecodedImageData(Gfx::DecodedImageFrame&& frame, ByteBuffer encoded_data)
     : m_frame(move(frame))
+    , m_natural_size(m_frame->size())
+    , m_encoded_data(move(encoded_data))
+    , m_decoded_for_size(m_natural_size)
 {
 }
 
 BitmapDecodedImageData::~BitmapDecodedImageData() = default;
 
+void BitmapDecodedImageData::finalize()
+{
+    Base::finalize();
+    redecodable_images().remove(this);
+}
+
 size_t BitmapDecodedImageData::external_memory_size() const
 {
-    return m_frame.bitmap().data_size();
+    size_t size = m_encoded_data.size();
+    if (m_frame.has_value())
+        size = JS::saturating_add_external_memory_size(size, m_frame->bitmap().data_size());
+    return size;
 }
 
-Optional<Gfx::DecodedImageFrame> BitmapDecodedImageData::current_frame(Gfx::IntSize) const
+void BitmapDecodedImageData::on_client_registered()
 {
-    return m_frame;
+    // Whoever uses the image now may need its pixels before it gets painted, so start decoding it right away.
+    if (!m_frame.has_value() && can_be_redecoded())
+        decode_at_size(m_natural_size);
+}
+
+Optional<Gfx::DecodedImageFrame> BitmapDecodedImageData::current_frame(Gfx::IntSize size) const
+{
+    return const_cast<BitmapDecodedImageData&>(*this).frame_for_size(size);
 }
 
-Optional<Gfx::DecodedImageFrame> BitmapDecodedImageData::default_frame(Gfx::IntSize) const
+Optional<Gfx::DecodedImageFrame> BitmapDecodedImageData::default_frame(Gfx::IntSize size) const
 {
+    return const_cast<BitmapDecodedImageData&>(*this).frame_for_size(size);
+}
+
+Optional<Gfx::DecodedImageFrame> BitmapDecodedImageData::frame_for_size(Gfx::IntSize size)
+{
+    m_last_use_time = MonotonicTime::now_coarse();
+
+    // Callers that don't ask for a particular size work in the image's natural pixels.
+    bool const wants_natural_size = size.is_empty() || size.width() >= m_natural_size.width() || size.height() >= m_natural_size.height();
+    if (wants_natural_size)
+        m_needs_natural_size = true;
+
+    ensure_decoded_bitmap_covers(wants_natural_size ? m_natural_size : size);
+    if (!m_frame.has_value())
+        return {};
+
+    // Until the image has been decoded at its natural size again, hand out a scaled up copy of what we have, so that
+    // callers see the geometry they expect.
+    if (wants_natural_size && m_frame->size() != m_natural_size) {
+        if (auto bitmap = m_frame->bitmap().scaled(m_natural_size.width(), m_natural_size.height(), Gfx::ScalingMode::Bilinear); !bitmap.is_error())
+            return Gfx::DecodedImageFrame { bitmap.release_value(), m_frame->color_space() };
+    }
+
     return m_frame;
 }
 
+void BitmapDecodedImageData::ensure_decoded_bitmap_covers(Gfx::IntSize size)
+{
+    if (!can_be_redecoded())
+        return;
+
+    auto needed_size = Gfx::size_covering_ideal_size(m_natural_size, size);
+    m_largest_used_size = { max(m_largest_used_size.width(), needed_size.width()), max(m_largest_used_size.height(), needed_size.height()) };
+
+    auto target_size = m_needs_natural_size ? m_natural_size : Gfx::size_covering_ideal_size(m_natural_size, m_largest_used_size);
+    if (!m_frame.has_value()) {
+        decode_at_size(target_size);
+        return;
+    }
+
+    if (target_size == m_decoded_for_size)
+        return;
+
+    auto current_size = m_frame->size();
+    bool const is_too_small = target_size.width() > current_size.width() || target_size.height() > current_size.height();
+
+    // Decoding the image again only pays for itself if it at least halves the memory its bitmap takes up.
+    bool const is_much_too_large = static_cast<u64>(target_size.width()) * target_size.height() * 2 <= static_cast<u64>(current_size.width()) * current_size.height();
+
+    if (is_too_small || is_much_too_large)
+        decode_at_size(target_size);
+}
+
+void BitmapDecodedImageData::decode_at_size(Gfx::IntSize size)
+{
+    if (m_size_being_decoded == size)
+        return;
+    m_size_being_decoded = size;
+
+    (void)Platform::ImageCodecPlugin::the().decode_image(
+        m_encoded_data,
+        [strong_this = GC::Root(*this), size](Platform::DecodedImage& result) -> ErrorOr<void> {
+            // Another decode was started after this one, so this result is already out of date.
+            if (strong_this->m_size_being_decoded != size)
+                return {};
+            strong_this->m_size_being_decoded.clear();
+
+            if (result.frames.is_empty() || !result.frames[0].bitmap)
+                return Error::from_string_literal("Decoding the image again produced no bitmap");
+
+            strong_this->m_decoded_for_size = size;
+            strong_this->set_frame(Gfx::DecodedImageFrame { *result.frames[0].bitmap, move(result.color_space) });
+            strong_this->notify_clients_did_update();
+            discard_unused_decoded_bitmaps_if_needed();
+            return {};
+        },
+        [strong_this = GC::Root(*this), size](Error&) {
+            if (strong_this->m_size_being_decoded != size)
+                return;
+            strong_this->m_size_being_decoded.clear();
+
+            // The encoded data decoded fine before, so something went badly wrong. Don't keep on trying.
+            strong_this->heap().did_free_external_memory(strong_this->m_encoded_data.size());
+            strong_this->m_encoded_data.clear();
+            redecodable_images().remove(strong_this.ptr());
+        },
+        size);
+}
+
+void BitmapDecodedImageData::set_frame(Optional<Gfx::DecodedImageFrame> frame)
+{
+    if (m_frame.has_value())
+        heap().did_free_external_memory(m_frame->bitmap().data_size());
+    m_frame = move(frame);
+    if (m_frame.has_value())
+        heap().did_allocate_external_memory(m_frame->bitmap().data_size());
+}
+
+void BitmapDecodedImageData::discard_decoded_bitmap()
+{
+    VERIFY(can_be_redecoded());
+    set_frame({});
+    m_largest_used_size = {};
+    m_decoded_for_size = {};
+}
+
+void BitmapDecodedImageData::discard_unused_decoded_bitmaps_if_needed()
+{
+    auto is_discardable = [](BitmapDecodedImageData const& image) {
+        return image.m_frame.has_value() && !image.has_clients() && !image.m_needs_natural_size && !image.m_size_being_decoded.has_value();
+    };
+
+    size_t unused_size = 0;
+    for (auto* image : redecodable_images()) {
+        if (is_discardable(*image))
+            unused_size += image->m_frame->bitmap().data_size();
+    }
+
+    while (unused_size > unused_decoded_bitmap_budget) {
+        BitmapDecodedImageData* least_recently_used = nullptr;
+        for (auto* image : redecodable_images()) {
+            if (!is_discardable(*image))
+                continue;
+            if (!least_recently_used || image->m_last_use_time < least_recently_used->m_last_use_time)
+                least_recently_used = image;
+        }
+
+        if (!least_recently_used)
+            break;
+
+        unused_size -= least_recently_used->m_frame->bitmap().data_size();
+        least_recently_used->discard_decoded_bitmap();
+    }
+}
+
 Optional<CSSPixels> BitmapDecodedImageData::intrinsic_width() const
 {
-    return m_frame.width();
+    return m_natural_size.width();
 }
 
 Optional<CSSPixels> BitmapDecodedImageData::intrinsic_height() const
 {
-    return m_frame.height();
+    return m_natural_size.height();
 }
 
 Optional<CSSPixelFraction> BitmapDecodedImageData::intrinsic_aspect_ratio() const
 {
-    return CSSPixels(m_frame.width()) / CSSPixels(m_frame.height());
+    return CSSPixels(m_natural_size.width()) / CSSPixels(m_natural_size.height());
 }
 
 void BitmapDecodedImageData::paint(DisplayListRecordingContext& context, Gfx::IntRect dst_rect, CSS::ImageRendering image_rendering) const
 {
-    auto scaling_mode = CSS::to_gfx_scaling_mode(image_rendering, m_frame.size(), dst_rect.size());
+    auto& self = const_cast<BitmapDecodedImageData&>(*this);
+    self.m_last_use_time = MonotonicTime::now_coarse();
+    if (!dst_rect.is_empty())
+        self.ensure_decoded_bitmap_covers(dst_rect.size());
+
+    // The bitmap was discarded and is being decoded again; the clients will be told to repaint once it is ready.
+    if (!m_frame.has_value())
+        return;
+
+    auto scaling_mode = CSS::to_gfx_scaling_mode(image_rendering, m_frame->size(), dst_rect.size());
 
-    context.display_list_recorder().draw_scaled_decoded_image_frame(dst_rect, m_frame, scaling_mode);
+    context.display_list_recorder().draw_scaled_decoded_image_frame(dst_rect, *m_frame, scaling_mode);
 }
 
 }
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
+#include <AK/Time.h>
 #include <LibGfx/DecodedImageFrame.h>
 #include <LibGfx/Forward.h>
 #include <LibWeb/HTML/DecodedImageData.h>
@@ -17,7 +19,11 @@ class BitmapDecodedImageData final : public DecodedImageData {
     GC_DECLARE_ALLOCATOR(BitmapDecodedImageData);
 
 public:
-    static GC::Ref<BitmapDecodedImageData> create(JS::Realm&, Gfx::DecodedImageFrame&& frame);
+    static constexpr bool OVERRIDES_FINALIZE = true;
+
+    // If the encoded data is given, the image is decoded again at the size it is displayed at, and its decoded bitmap
+    // may be discarded while nothing is using it.
+    static GC::Ref<BitmapDecodedImageData> create(JS::Realm&, Gfx::DecodedImageFrame&& frame, ByteBuffer encoded_data = {});
     virtual ~BitmapDecodedImageData() override;
 
     virtual Optional<Gfx::DecodedImageFrame> default_frame(Gfx::IntSize = {}) const override;
@@ -29,12 +35,40 @@ public:
 
     virtual void paint(DisplayListRecordingContext&, Gfx::IntRect dst_rect, CSS::ImageRendering) const override;
 
+    // Drops the decoded bitmaps of images that nothing is using, least recently used first, while those bitmaps take
+    // up more memory than we are willing to spend on them. They are decoded again once they are used.
+    static void discard_unused_decoded_bitmaps_if_needed();
+
 private:
-    BitmapDecodedImageData(Gfx::DecodedImageFrame&& frame);
+    BitmapDecodedImageData(Gfx::DecodedImageFrame&& frame, ByteBuffer encoded_data);
 
+    virtual void finalize() override;
     virtual size_t external_memory_size() const override;
+    virtual void on_client_registered() override;
+
+    bool can_be_redecoded() const { return !m_encoded_data.is_empty(); }
+    Optional<Gfx::DecodedImageFrame> frame_for_size(Gfx::IntSize);
+    void ensure_decoded_bitmap_covers(Gfx::IntSize);
+    void decode_at_size(Gfx::IntSize);
+    void set_frame(Optional<Gfx::DecodedImageFrame>);
+    void discard_decoded_bitmap();
+
+    Optional<Gfx::DecodedImageFrame> m_frame;
+    Gfx::IntSize m_natural_size;
+    ByteBuffer m_encoded_data;
+
+    // The largest size the image has been drawn at since it was last decoded from scratch. The decoded bitmap is kept
+    // at least this large, so that images drawn at several sizes do not get decoded over and over.
+    Gfx::IntSize m_largest_used_size;
+
+    // The size the current bitmap was decoded for. The decoder may have produced a somewhat larger bitmap.
+    Gfx::IntSize m_decoded_for_size;
+    Optional<Gfx::IntSize> m_size_being_decoded;
+    MonotonicTime m_last_use_time { MonotonicTime::now_coarse() };
 
-    Gfx::DecodedImageFrame m_frame;
+    // Set once something needs the image in its natural pixels, e.g. to draw it into a canvas. From then on, the image
+    // is kept decoded at its natural size.
+    bool m_needs_natural_size { false };
 };
 
 }
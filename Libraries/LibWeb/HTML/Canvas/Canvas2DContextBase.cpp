@@ -298,8 +298,7 @@ bool Canvas2DContextBase::ensure_remote_canvas_context()
     // FIXME: implement context attribute .color_space
     // FIXME: implement context attribute .color_type
     // FIXME: implement context attribute .desynchronized
-    // FIXME: implement context attribute .will_read_frequently
-    if (!transport->create_context(m_size, m_context_attributes.alpha))
+    if (!transport->create_context(m_size, m_context_attributes.alpha, m_context_attributes.will_read_frequently))
         return false;
     m_transport = move(transport);
     return true;
@@ -390,12 +389,14 @@ void Canvas2DContextBase::ensure_backing_storage()
     if (!ensure_remote_canvas_context())
         return;
 
+    heap().did_allocate_external_memory(external_memory_size() - Base::external_memory_size());
     backing_storage_created_hook();
 }
 
 void Canvas2DContextBase::discard_backing_storage()
 {
     if (m_transport) {
+        heap().did_free_external_memory(external_memory_size() - Base::external_memory_size());
         // Flush the shared stream before destroying the context: it may still
         // hold commands targeting this canvas, and DrawCanvas commands from
         // other canvases referencing it, which must replay while it is alive.
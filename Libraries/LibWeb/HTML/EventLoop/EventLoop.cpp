@@ -26,11 +26,13 @@
 #include <LibWeb/HighResolutionTime/Performance.h>
 #include <LibWeb/HighResolutionTime/TimeOrigin.h>
 #include <LibWeb/IndexedDB/Internal/Algorithms.h>
+#include <LibWeb/LongAnimationFrames/FrameTiming.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/Paintable.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/Platform/Timer.h>
+#include <LibWeb/Profiling/SamplingProfiler.h>
 
 namespace Web::HTML {
 
@@ -58,6 +60,8 @@ void EventLoop::visit_edges(Visitor& visitor)
     visitor.visit(m_backup_incumbent_realm_stack);
     visitor.visit(m_rendering_task_function);
     visitor.visit(m_system_event_loop_timer);
+    if (m_current_scheduling_state.has_value())
+        visitor.visit(m_current_scheduling_state->abort_source);
 }
 
 void EventLoop::schedule()
@@ -123,7 +127,7 @@ void EventLoop::process()
 {
     // 1. Let oldestTask and taskStartTime be null.
     GC::Ptr<Task> oldest_task;
-    [[maybe_unused]] double task_start_time = 0;
+    double task_start_time = 0;
 
     // Some algorithms request that steps or states only occur once the event loop has reached step 1.
     // Invoke a set of tasks that these algorithms request us to in order to achieve this.
@@ -142,7 +146,9 @@ void EventLoop::process()
         // 3. Set oldestTask to the first runnable task in taskQueue, and remove it from taskQueue.
         oldest_task = task_queue->take_first_runnable();
 
-        // FIXME: 4. If oldestTask's document is not null, then record task start time given taskStartTime and oldestTask's document.
+        // 4. If oldestTask's document is not null, then record task start time given taskStartTime and oldestTask's document.
+        if (auto const* document = oldest_task->document())
+            LongAnimationFrames::record_task_start_time(task_start_time, const_cast<DOM::Document&>(*document));
 
         // 5. Set the event loop's currently running task to oldestTask.
         m_currently_running_task = oldest_task.ptr();
@@ -158,7 +164,7 @@ void EventLoop::process()
     }
 
     // 3. Let taskEndTime be the unsafe shared current time. [HRT]
-    [[maybe_unused]] auto task_end_time = HighResolutionTime::unsafe_shared_current_time();
+    auto task_end_time = HighResolutionTime::unsafe_shared_current_time();
 
     // 4. If oldestTask is not null, then:
     if (oldest_task) {
@@ -170,7 +176,9 @@ void EventLoop::process()
         // FIXME: 2.4. Let tlbc be global's browsing context's top-level browsing context.
         // FIXME: 2.5. If tlbc is not null, then append it to top-level browsing contexts.
         // FIXME: 3. Report long tasks, passing in taskStartTime, taskEndTime, top-level browsing contexts, and oldestTask.
-        // FIXME: 4. If oldestTask's document is not null, then record task end time given taskEndTime and oldestTask's document.
+        // 4. If oldestTask's document is not null, then record task end time given taskEndTime and oldestTask's document.
+        if (auto const* document = oldest_task->document())
+            LongAnimationFrames::record_task_end_time(task_end_time, const_cast<DOM::Document&>(*document));
     }
 
     // 5. If this is a window event loop that has no runnable task in this event loop's task queues, then:
@@ -185,6 +193,11 @@ void EventLoop::process()
         for (auto& win : same_loop_windows()) {
             win->start_an_idle_period();
         }
+
+        // Nothing is runnable, so this is a good moment to make progress on an in-flight incremental GC sweep.
+        auto idle_time_remaining = compute_deadline() - HighResolutionTime::unsafe_shared_current_time();
+        if (idle_time_remaining > 0)
+            heap().perform_idle_gc_work(AK::Duration::from_microseconds(static_cast<i64>(idle_time_remaining * 1000)));
     }
 
     // If there are eligible tasks in the queue, schedule a new round of processing. :^)
@@ -315,6 +328,11 @@ void EventLoop::update_the_rendering()
         m_running_rendering_task = false;
     };
 
+    Profiling::MarkerScope update_the_rendering_marker { "Update the rendering"sv, Profiling::Phase::Other };
+
+    // AD-HOC: Long animation frames report when the rendering update started, which includes processing input events.
+    auto update_the_rendering_start_time = HighResolutionTime::unsafe_shared_current_time();
+
     process_input_events();
 
     // 1. Let frameTimestamp be eventLoop's last render opportunity time.
@@ -404,12 +422,19 @@ void EventLoop::update_the_rendering()
     // FIXME: 13. For each doc of docs, if the user agent detects that the backing storage associated with a CanvasRenderingContext2D or an OffscreenCanvasRenderingContext2D, context, has been lost, then it must run the context lost steps for each such context:
 
     // 14. For each doc of docs, run the animation frame callbacks for doc, passing in the relative high resolution time given frameTimestamp and doc's relevant global object as the timestamp.
-    for (auto& document : docs) {
-        auto now = HighResolutionTime::relative_high_resolution_time(frame_timestamp, relevant_global_object(*document));
-        run_animation_frame_callbacks(*document, now);
+    {
+        Profiling::MarkerScope marker { "Animation frame callbacks"sv, Profiling::Phase::Script };
+        for (auto& document : docs) {
+            auto now = HighResolutionTime::relative_high_resolution_time(frame_timestamp, relevant_global_object(*document));
+            run_animation_frame_callbacks(*document, now);
+        }
     }
 
-    // FIXME: 15. Let unsafeStyleAndLayoutStartTime be the unsafe shared current time.
+    // 15. Let unsafeStyleAndLayoutStartTime be the unsafe shared current time.
+    auto unsafe_style_and_layout_start_time = HighResolutionTime::unsafe_shared_current_time();
+
+    Optional<Profiling::MarkerScope> style_and_layout_marker;
+    style_and_layout_marker.emplace("Style and layout"sv, Profiling::Phase::Layout);
 
     // 16. For each doc of docs:
     for (auto& document : docs) {
@@ -447,8 +472,14 @@ void EventLoop::update_the_rendering()
                     bool check_for_initial_determination = element.proximity_to_the_viewport() == Web::DOM::ProximityToTheViewport::NotDetermined && !element.is_relevant_to_the_user();
 
                     // 2. Determine proximity to the viewport for element.
+                    bool skipped_its_contents = element.skips_its_contents();
                     element.determine_proximity_to_the_viewport();
 
+                    // NB: The layout tree omits the contents of an element that skips them, so a change in relevance
+                    //     must build or drop them before the next layout.
+                    if (element.skips_its_contents() != skipped_its_contents)
+                        element.set_needs_layout_tree_update(true, DOM::SetNeedsLayoutTreeUpdateReason::ContentVisibilityRelevanceChange);
+
                     // 3. If checkForInitialDetermination is true and element is now relevant to the user, then set hadInitialVisibleContentVisibilityDetermination to true.
                     if (check_for_initial_determination && element.is_relevant_to_the_user()) {
                         had_initial_visible_content_visibility_determination = true;
@@ -513,6 +544,8 @@ void EventLoop::update_the_rendering()
             document->update_layout(DOM::UpdateLayoutReason::HTMLEventLoopRenderingUpdate);
     }
 
+    style_and_layout_marker.clear();
+
     // FIXME: 17. For each doc of docs, if the focused area of doc is not a focusable area, then run the focusing steps for doc's viewport, and set doc's relevant global object's navigation API's focus changed during ongoing navigation to false.
 
     // 18. For each doc of docs, perform pending transition operations for doc. [CSSVIEWTRANSITIONS]
@@ -528,17 +561,27 @@ void EventLoop::update_the_rendering()
 
         auto now = HighResolutionTime::relative_high_resolution_time(frame_timestamp, relevant_global_object(*document));
         document->run_the_update_intersection_observations_steps(now);
+
+        // AD-HOC: With layout up to date, let the image decoder know which images to decode first.
+        document->update_image_decode_priorities();
     }
 
-    // FIXME: 20. For each doc of docs, record rendering time for doc given unsafeStyleAndLayoutStartTime.
+    // 20. For each doc of docs, record rendering time for doc given unsafeStyleAndLayoutStartTime.
+    for (auto& document : docs)
+        LongAnimationFrames::record_rendering_time(*document, update_the_rendering_start_time, unsafe_style_and_layout_start_time);
 
-    // FIXME: 21. For each doc of docs, mark paint timing for doc.
+    // 21. For each doc of docs, mark paint timing for doc.
+    for (auto& document : docs)
+        document->mark_paint_timing();
 
     // AD-HOC: Flush dirty canvas contexts in documents' pages after callbacks
     // have had a chance to update them, and before painting snapshots the frame.
     for (auto& document : docs)
         document->page().prepare_canvas_contexts_for_compositing();
 
+    Optional<Profiling::MarkerScope> paint_marker;
+    paint_marker.emplace("Paint"sv, Profiling::Phase::Paint);
+
     // 22. For each doc of docs, update the rendering or user interface of doc and its node navigable to reflect the current state.
     for (auto& doc : docs.in_reverse()) {
         auto navigable = doc->navigable();
@@ -561,6 +604,8 @@ void EventLoop::update_the_rendering()
         }
     }
 
+    paint_marker.clear();
+
     // 23. For each doc of docs, process top layer removals given doc.
     for (auto& document : docs) {
         document->process_top_layer_removals();
@@ -575,6 +620,13 @@ void EventLoop::update_the_rendering()
         TemporaryExecutionContext context(document->realm(), TemporaryExecutionContext::CallbacksEnabled::Yes);
         document->fonts()->set_is_pending_on_the_environment(document->readiness() == DocumentReadyState::Loading);
     }
+
+    // https://w3c.github.io/long-animation-frames/#flush-frame-timing
+    // AD-HOC: End the frame of each rendered document here rather than when the rendering task ends, since that task only
+    //         knows about the document of the navigable that it was queued for, and not about the documents of its iframes.
+    auto frame_end_time = HighResolutionTime::unsafe_shared_current_time();
+    for (auto& document : docs)
+        LongAnimationFrames::flush_frame_timing(*document, frame_end_time);
 }
 
 void run_when_event_loop_reaches_step_1(GC::Ref<GC::Function<void()>> steps)
@@ -97,6 +97,17 @@ public:
 
     bool running_rendering_task() const { return m_running_rendering_task; }
 
+    // https://wicg.github.io/scheduling-apis/#scheduling-state
+    // NOTE: There is no TaskSignal yet, so the priority source is always a fixed priority.
+    struct SchedulingState {
+        GC::Ptr<DOM::AbortSignal> abort_source;
+        Task::Priority priority { Task::Priority::UserVisible };
+    };
+
+    // https://wicg.github.io/scheduling-apis/#event-loop-current-scheduling-state
+    Optional<SchedulingState> const& current_scheduling_state() const { return m_current_scheduling_state; }
+    void set_current_scheduling_state(Optional<SchedulingState> state) { m_current_scheduling_state = move(state); }
+
 private:
     explicit EventLoop(Type);
 
@@ -143,6 +154,8 @@ private:
 
     bool m_running_rendering_task { false };
 
+    Optional<SchedulingState> m_current_scheduling_state;
+
     GC::Ptr<GC::Function<void()>> m_rendering_task_function;
 };
 
@@ -30,9 +30,30 @@ GC::Ref<Task> Task::create(JS::VM& vm, Source source, GC::Ptr<DOM::Document cons
     return vm.heap().allocate<Task>(source, document, move(steps));
 }
 
+static Task::Priority default_priority_for_source(Task::Source source)
+{
+    switch (source) {
+    // Input events are handled as part of updating the rendering, which only happens at a rendering opportunity, so
+    // running these first keeps both interactions and frames responsive.
+    case Task::Source::UserInteraction:
+    case Task::Source::Rendering:
+        return Task::Priority::UserBlocking;
+    // https://w3c.github.io/performance-timeline/#dfn-queue-a-performanceobserver-task
+    // The performance timeline task queue is a low priority queue that, if possible, should be processed by the user agent
+    // during idle periods to minimize impact of performance monitoring code.
+    case Task::Source::PerformanceTimeline:
+        return Task::Priority::Background;
+    case Task::Source::IdleTask:
+        return Task::Priority::Idle;
+    default:
+        return Task::Priority::UserVisible;
+    }
+}
+
 Task::Task(Source source, GC::Ptr<DOM::Document const> document, GC::Ref<GC::Function<void()>> steps)
     : m_id(allocate_task_id())
     , m_source(source)
+    , m_priority(default_priority_for_source(source))
     , m_steps(steps)
     , m_document(document)
 {
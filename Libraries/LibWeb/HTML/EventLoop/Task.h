@@ -9,6 +9,7 @@
 #include <AK/DistinctNumeric.h>
 #include <AK/IntrusiveList.h>
 #include <AK/RefCounted.h>
+#include <AK/Time.h>
 #include <LibGC/CellAllocator.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/Export.h>
@@ -98,12 +99,28 @@ public:
         // https://storage.spec.whatwg.org/#task-source
         Storage,
 
+        // https://wicg.github.io/scheduling-apis/#posted-task-task-source
+        PostedTask,
+
         // !!! IMPORTANT: Keep this field last!
         // This serves as the base value of all unique task sources.
         // Some elements, such as the HTMLMediaElement, must have a unique task source per instance.
         UniqueTaskSourceStart
     };
 
+    // The event loop runs the runnable task of the highest priority first, and tasks of the same priority in the order
+    // they were queued. Continuations are what scheduler.yield() resumes, and run before other tasks of their priority.
+    // https://wicg.github.io/scheduling-apis/#sec-task-priorities
+    enum class Priority : u8 {
+        UserBlockingContinuation,
+        UserBlocking,
+        UserVisibleContinuation,
+        UserVisible,
+        BackgroundContinuation,
+        Background,
+        Idle,
+    };
+
     static GC::Ref<Task> create(JS::VM&, Source, GC::Ptr<DOM::Document const>, GC::Ref<GC::Function<void()>> steps);
 
     virtual ~Task() override;
@@ -112,6 +129,13 @@ public:
     Source source() const { return m_source; }
     void execute();
 
+    // A task's priority follows from its source, unless it is changed before the task is queued.
+    Priority priority() const { return m_priority; }
+    void set_priority(Priority priority) { m_priority = priority; }
+
+    MonotonicTime queued_time() const { return m_queued_time; }
+    void set_queued_time(MonotonicTime queued_time) { m_queued_time = queued_time; }
+
     DOM::Document const* document() const;
 
     bool is_runnable() const;
@@ -124,6 +148,8 @@ private:
 
     TaskID m_id {};
     Source m_source { Source::Unspecified };
+    Priority m_priority { Priority::UserVisible };
+    MonotonicTime m_queued_time { MonotonicTime::now_coarse() };
     GC::Ref<GC::Function<void()>> m_steps;
     GC::Ptr<DOM::Document const> m_document;
 
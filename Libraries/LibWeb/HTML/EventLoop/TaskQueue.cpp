@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AllOf.h>
 #include <LibGC/RootVector.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/HTML/EventLoop/EventLoop.h>
@@ -24,13 +25,18 @@ void TaskQueue::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_event_loop);
-    for (auto& task : m_tasks)
-        visitor.visit(task);
-    for (auto& task : m_idle_tasks)
-        visitor.visit(task);
+    for (auto& tasks : m_tasks_by_priority) {
+        for (auto& task : tasks)
+            visitor.visit(task);
+    }
     visitor.visit(m_last_added_task);
 }
 
+bool TaskQueue::is_empty() const
+{
+    return all_of(m_tasks_by_priority, [](auto const& tasks) { return tasks.is_empty(); });
+}
+
 void TaskQueue::add(GC::Ref<Task> task)
 {
     // AD-HOC: Don't enqueue tasks for temporary (inert) documents used for fragment parsing.
@@ -39,77 +45,101 @@ void TaskQueue::add(GC::Ref<Task> task)
         return;
 
     m_last_added_task = task.ptr();
-    if (task->source() == Task::Source::IdleTask)
-        m_idle_tasks.append(*task);
-    else
-        m_tasks.append(*task);
+    task->set_queued_time(MonotonicTime::now_coarse());
+    m_tasks_by_priority[to_underlying(task->priority())].append(*task);
     m_event_loop->schedule();
 }
 
+void TaskQueue::remove(Task& task, Task::Queue& tasks)
+{
+    if (m_last_added_task == &task)
+        m_last_added_task = {};
+    tasks.remove(task);
+}
+
+bool TaskQueue::can_run_now(Task const& task) const
+{
+    if (m_event_loop->running_rendering_task() && task.source() == Task::Source::Rendering)
+        return false;
+    return task.is_runnable();
+}
+
 GC::Ptr<Task> TaskQueue::dequeue()
 {
-    auto take_task = [&](auto& tasks) -> GC::Ptr<Task> {
+    for (auto& tasks : m_tasks_by_priority) {
         if (tasks.is_empty())
-            return {};
-        auto* task = tasks.take_first();
-        if (m_last_added_task == task)
-            m_last_added_task = {};
-        return task;
-    };
-
-    if (auto task = take_task(m_tasks))
+            continue;
+        auto* task = tasks.first();
+        remove(*task, tasks);
         return task;
-    return take_task(m_idle_tasks);
+    }
+    return {};
 }
 
-GC::Ptr<Task> TaskQueue::take_first_runnable()
+// Tasks that have been waiting this long run before tasks of higher priority, so that a steady stream of those can't
+// starve them.
+static Optional<AK::Duration> starvation_threshold(Task::Priority priority)
 {
-    if (m_event_loop->execution_paused())
-        return nullptr;
+    switch (priority) {
+    case Task::Priority::UserBlockingContinuation:
+    case Task::Priority::UserBlocking:
+    case Task::Priority::Idle:
+        return {};
+    case Task::Priority::UserVisibleContinuation:
+    case Task::Priority::UserVisible:
+        return AK::Duration::from_milliseconds(100);
+    case Task::Priority::BackgroundContinuation:
+    case Task::Priority::Background:
+        return AK::Duration::from_seconds(1);
+    }
+    VERIFY_NOT_REACHED();
+}
 
-    for (auto it = m_tasks.begin(); it != m_tasks.end();) {
-        auto& task = *it;
+GC::Ptr<Task> TaskQueue::take_first_starved_task()
+{
+    auto now = MonotonicTime::now_coarse();
 
-        if (m_event_loop->running_rendering_task() && task.source() == Task::Source::Rendering) {
-            ++it;
+    for (size_t priority = 0; priority < m_tasks_by_priority.size(); ++priority) {
+        auto threshold = starvation_threshold(static_cast<Task::Priority>(priority));
+        if (!threshold.has_value())
             continue;
-        }
 
-        if (task.is_runnable()) {
-            if (m_last_added_task == &task)
-                m_last_added_task = {};
-            it.erase();
+        auto& tasks = m_tasks_by_priority[priority];
+        for (auto& task : tasks) {
+            if (!can_run_now(task))
+                continue;
+            // Tasks of the same priority are queued in order, so if the oldest runnable one hasn't been waiting for
+            // long enough yet, none of the others have.
+            if (now - task.queued_time() < *threshold)
+                break;
+            remove(task, tasks);
             return &task;
         }
+    }
+    return nullptr;
+}
 
-        if (task.is_permanently_unrunnable()) {
-            if (m_last_added_task == &task)
-                m_last_added_task = {};
-            it.erase();
-            continue;
-        }
+GC::Ptr<Task> TaskQueue::take_first_runnable()
+{
+    if (m_event_loop->execution_paused())
+        return nullptr;
 
-        ++it;
-    }
+    if (auto task = take_first_starved_task())
+        return task;
 
-    for (auto it = m_idle_tasks.begin(); it != m_idle_tasks.end();) {
-        auto& task = *it;
+    for (auto& tasks : m_tasks_by_priority) {
+        for (auto it = tasks.begin(); it != tasks.end();) {
+            auto& task = *it;
+            ++it;
 
-        if (task.is_runnable()) {
-            if (m_last_added_task == &task)
-                m_last_added_task = {};
-            it.erase();
-            return &task;
-        }
+            if (can_run_now(task)) {
+                remove(task, tasks);
+                return &task;
+            }
 
-        if (task.is_permanently_unrunnable()) {
-            if (m_last_added_task == &task)
-                m_last_added_task = {};
-            it.erase();
-            continue;
+            if (task.is_permanently_unrunnable())
+                remove(task, tasks);
         }
-
-        ++it;
     }
     return nullptr;
 }
@@ -119,80 +149,43 @@ bool TaskQueue::has_runnable_tasks() const
     if (m_event_loop->execution_paused())
         return false;
 
-    for (auto& task : m_tasks) {
-        if (m_event_loop->running_rendering_task() && task.source() == Task::Source::Rendering)
-            continue;
-        if (task.is_runnable())
-            return true;
-    }
-
-    for (auto& task : m_idle_tasks) {
-        if (task.is_runnable())
-            return true;
+    for (auto const& tasks : m_tasks_by_priority) {
+        for (auto const& task : tasks) {
+            if (can_run_now(task))
+                return true;
+        }
     }
     return false;
 }
 
 void TaskQueue::remove_tasks_matching(Function<bool(HTML::Task const&)> filter)
 {
-    auto remove_matching_tasks = [&](auto& tasks) {
+    for (auto& tasks : m_tasks_by_priority) {
         for (auto it = tasks.begin(); it != tasks.end();) {
             auto& task = *it;
-            if (!filter(task)) {
-                ++it;
-                continue;
-            }
-            if (m_last_added_task == &task)
-                m_last_added_task = {};
-            it.erase();
+            ++it;
+            if (filter(task))
+                remove(task, tasks);
         }
-    };
-    remove_matching_tasks(m_tasks);
-    remove_matching_tasks(m_idle_tasks);
+    }
 }
 
 GC::Ptr<Task> TaskQueue::take_first_runnable_matching(Function<bool(HTML::Task const&)> filter)
 {
-    for (auto it = m_tasks.begin(); it != m_tasks.end();) {
-        auto& task = *it;
-
-        if (task.is_runnable() && filter(task)) {
-            if (m_last_added_task == &task)
-                m_last_added_task = {};
-            it.erase();
-            return &task;
-        }
-
-        if (task.is_permanently_unrunnable()) {
-            if (m_last_added_task == &task)
-                m_last_added_task = {};
-            it.erase();
-            continue;
-        }
-
-        ++it;
-    }
-
-    for (auto it = m_idle_tasks.begin(); it != m_idle_tasks.end();) {
-        auto& task = *it;
+    for (auto& tasks : m_tasks_by_priority) {
+        for (auto it = tasks.begin(); it != tasks.end();) {
+            auto& task = *it;
+            ++it;
 
-        if (task.is_runnable() && filter(task)) {
-            if (m_last_added_task == &task)
-                m_last_added_task = {};
-            it.erase();
-            return &task;
-        }
+            if (task.is_runnable() && filter(task)) {
+                remove(task, tasks);
+                return &task;
+            }
 
-        if (task.is_permanently_unrunnable()) {
-            if (m_last_added_task == &task)
-                m_last_added_task = {};
-            it.erase();
-            continue;
+            if (task.is_permanently_unrunnable())
+                remove(task, tasks);
         }
-
-        ++it;
     }
-
     return nullptr;
 }
 
@@ -203,7 +196,8 @@ Task const* TaskQueue::last_added_task() const
 
 bool TaskQueue::has_rendering_tasks() const
 {
-    for (auto const& task : m_tasks) {
+    // Rendering tasks keep the priority of their source.
+    for (auto const& task : m_tasks_by_priority[to_underlying(Task::Priority::UserBlocking)]) {
         if (task.source() == Task::Source::Rendering)
             return true;
     }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/HTML/EventLoop/Task.h>
 
@@ -19,7 +20,7 @@ public:
     explicit TaskQueue(HTML::EventLoop&);
     virtual ~TaskQueue() override;
 
-    bool is_empty() const { return m_tasks.is_empty() && m_idle_tasks.is_empty(); }
+    bool is_empty() const;
 
     bool has_runnable_tasks() const;
     bool has_rendering_tasks() const;
@@ -38,10 +39,14 @@ public:
 private:
     virtual void visit_edges(Visitor&) override;
 
+    void remove(Task&, Task::Queue&);
+    bool can_run_now(Task const&) const;
+    GC::Ptr<Task> take_first_starved_task();
+
     GC::Ref<HTML::EventLoop> m_event_loop;
 
-    Task::Queue m_tasks;
-    Task::Queue m_idle_tasks;
+    // One queue per priority, highest first.
+    Array<Task::Queue, to_underlying(Task::Priority::Idle) + 1> m_tasks_by_priority;
     GC::Ptr<HTML::Task const> m_last_added_task;
 };
 
@@ -992,6 +992,10 @@ void HTMLImageElement::add_callbacks_to_image_request(GC::Ref<ImageRequest> imag
 
                 VERIFY(image_request->shared_resource_request());
                 auto image_data = image_request->shared_resource_request()->image_data();
+
+                // AD-HOC: Replace any partially decoded image data that the current request has been showing so far.
+                if (image_request == m_current_request)
+                    unregister_with_decoded_image_data_if_needed();
                 image_request->set_image_data(image_data);
 
                 ListOfAvailableImages::Key key;
@@ -1071,6 +1075,48 @@ void HTMLImageElement::add_callbacks_to_image_request(GC::Ref<ImageRequest> imag
                 dispatch_event(DOM::Event::create(realm(), HTML::EventNames::error));
 
             m_load_event_delayer.clear();
+        },
+        [this, image_request]() {
+            // The next task that is queued by the networking task source while the image is being fetched must run the
+            // following steps:
+
+            // AD-HOC: Bail out if the document became inactive, or if this request is stale (see above).
+            if (!document().is_fully_active())
+                return;
+            if (image_request->was_aborted() || (image_request != m_current_request && image_request != m_pending_request))
+                return;
+
+            VERIFY(image_request->shared_resource_request());
+            auto image_data = image_request->shared_resource_request()->partial_image_data();
+            if (!image_data)
+                return;
+
+            // 1. If image request is the pending request and at least one of response's unsafe response's image
+            //    dimensions are known (i.e., not zero), abort the image request for the current request, upgrade the
+            //    pending request to the current request, and prepare image request for presentation given the img
+            //    element.
+            bool const was_pending_request = image_request == m_pending_request;
+            unregister_with_decoded_image_data_if_needed();
+            if (was_pending_request) {
+                abort_the_image_request(realm(), m_current_request);
+                upgrade_pending_request_to_current_request();
+                image_request->prepare_for_presentation(*this);
+            }
+
+            // AD-HOC: Show what has been decoded of the image so far.
+            image_request->set_image_data(image_data);
+            register_with_decoded_image_data_if_needed();
+
+            // FIXME: 2. Otherwise, if image request is the pending request and the user agent is able to determine that
+            //           image request's image is corrupted in some fatal way such that the image dimensions cannot be
+            //           obtained, abort the image request for the current request, upgrade the pending request to the
+            //           current request, and set the current request's state to broken.
+
+            // 3. Otherwise, set image request's state to partially available.
+            if (!was_pending_request)
+                image_request->set_state(ImageRequest::State::PartiallyAvailable);
+
+            set_needs_layout_update_or_repaint_after_image_data_change(*this, DOM::SetNeedsLayoutReason::HTMLImageElementUpdateTheImageData);
         });
 }
 
@@ -100,6 +100,7 @@ public:
 
     ImageRequest& current_request() { return *m_current_request; }
     ImageRequest const& current_request() const { return *m_current_request; }
+    ImageRequest const* pending_request() const { return m_pending_request.ptr(); }
 
     // https://html.spec.whatwg.org/multipage/images.html#upgrade-the-pending-request-to-the-current-request
     void upgrade_pending_request_to_current_request();
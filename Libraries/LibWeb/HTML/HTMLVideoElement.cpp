@@ -357,7 +357,7 @@ Optional<Gfx::DecodedImageFrame> HTMLVideoElement::current_decoded_image_frame()
     auto current_frame = sink->current_frame();
     if (!current_frame)
         return {};
-    auto bitmap_or_error = current_frame->yuv_data().to_bitmap();
+    auto bitmap_or_error = sink->current_frame_bitmap();
     if (bitmap_or_error.is_error()) {
         dbgln("Could not convert video frame to bitmap: {}", bitmap_or_error.release_error());
         return {};
@@ -131,6 +131,8 @@ WebIDL::ExceptionOr<void> ImageBitmap::transfer_steps(HTML::TransferDataEncoder&
     TRY(serialize_bitmap(realm(), data_holder, m_bitmap));
 
     // 3. Unset value's bitmap data.
+    if (m_bitmap)
+        heap().did_free_external_memory(m_bitmap->data_size());
     m_bitmap = nullptr;
 
     return {};
@@ -177,11 +179,17 @@ void ImageBitmap::close()
     set_detached(true);
 
     // 2. Unset this's bitmap data.
+    if (m_bitmap)
+        heap().did_free_external_memory(m_bitmap->data_size());
     m_bitmap = nullptr;
 }
 
 void ImageBitmap::set_bitmap(RefPtr<Gfx::Bitmap> bitmap)
 {
+    if (m_bitmap)
+        heap().did_free_external_memory(m_bitmap->data_size());
+    if (bitmap)
+        heap().did_allocate_external_memory(bitmap->data_size());
     m_bitmap = move(bitmap);
     m_width = m_bitmap ? m_bitmap->width() : 0;
     m_height = m_bitmap ? m_bitmap->height() : 0;
@@ -4720,6 +4720,23 @@ void LocalNavigable::repaint_after_compositor_process_reconnect()
         child_navigable->repaint_after_compositor_process_reconnect();
 }
 
+void LocalNavigable::drop_rendering_state_for_memory_pressure()
+{
+    if (auto document = active_document())
+        document->tear_down_layout_tree_for_memory_pressure();
+
+    // NB: The resources referenced by the last display list are kept, as the compositor still has them too.
+    m_needs_repaint = true;
+    m_needs_to_record_display_list = true;
+    m_compositor_display_list_paint_config.clear();
+    m_compositor_display_list.clear();
+    m_compositor_visual_context_tree.clear();
+    m_compositor_scroll_state_snapshot.clear();
+
+    for (auto const& child_navigable : child_navigables())
+        child_navigable->drop_rendering_state_for_memory_pressure();
+}
+
 void LocalNavigable::set_should_show_line_box_borders(bool value)
 {
     m_should_show_line_box_borders = value;
@@ -293,6 +293,10 @@ public:
     void set_needs_to_record_display_list() { m_needs_to_record_display_list = true; }
     void repaint_after_compositor_process_reconnect();
 
+    // Drops the layout, paint and display list state of this navigable and its descendants, which are rebuilt the
+    // next time they are rendered. Only meant for navigables that aren't currently being rendered.
+    void drop_rendering_state_for_memory_pressure();
+
     [[nodiscard]] bool has_inclusive_ancestor_with_visibility_hidden() const;
 
     Compositor::CompositorContextHandle& compositor_context()
@@ -46,6 +46,7 @@ LocalTraversableNavigable::LocalTraversableNavigable(GC::Ref<Page> page)
           Compositor::PagePresentationRegistration::Yes)
     , m_storage_shed(StorageAPI::StorageShed::create(page->heap()))
     , m_session_history_traversal_queue(vm().heap().allocate<SessionHistoryTraversalQueue>())
+    , m_back_forward_cache(vm().heap().allocate<BackForwardCache>())
 {
 }
 
@@ -58,6 +59,7 @@ void LocalTraversableNavigable::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_emulated_position_data_observers);
     visitor.visit(m_session_history_traversal_queue);
     visitor.visit(m_storage_shed);
+    visitor.visit(m_back_forward_cache);
     visitor.visit(m_apply_history_step_state);
     visitor.visit(m_paused_apply_history_step_state);
 }
@@ -698,7 +700,7 @@ Vector<GC::Root<LocalNavigable>> LocalTraversableNavigable::get_all_local_naviga
 }
 
 // https://html.spec.whatwg.org/multipage/browsing-the-web.html#deactivate-a-document-for-a-cross-document-navigation
-static void deactivate_a_document_for_cross_document_navigation(GC::Ref<DOM::Document> displayed_document, Optional<UserNavigationInvolvement>, NonnullRefPtr<SessionHistoryEntry> target_entry, GC::Ptr<DOM::Document> populated_document, GC::Ref<GC::Function<void()>> after_potential_unloads)
+static void deactivate_a_document_for_cross_document_navigation(GC::Ref<DOM::Document> displayed_document, Optional<UserNavigationInvolvement>, NonnullRefPtr<SessionHistoryEntry> target_entry, Bindings::NavigationType navigation_type, GC::Ptr<DOM::Document> populated_document, GC::Ref<GC::Function<void()>> after_potential_unloads)
 {
     // 1. Let navigable be displayedDocument's node navigable.
     auto navigable = displayed_document->navigable();
@@ -719,8 +721,11 @@ static void deactivate_a_document_for_cross_document_navigation(GC::Ref<DOM::Doc
         // 2. Set the ongoing navigation for navigable to null.
         navigable->set_ongoing_navigation({});
 
+        // AD-HOC: Decide whether displayedDocument will be kept in the back/forward cache while the navigation that is
+        //         unloading it is still known.
+        displayed_document->set_intend_to_store_in_bfcache(BackForwardCache::can_store(displayed_document, target_entry, navigation_type));
+
         // 3. Unload a document and its descendants given displayedDocument, targetEntry's document, afterPotentialUnloads, and firePageSwapBeforeUnload.
-        (void)target_entry; // FIXME: Used by pageswap and view-transition steps above.
         displayed_document->unload_a_document_and_its_descendants(populated_document, after_potential_unloads);
     }
     // FIXME: 6. Otherwise, queue a global task on the navigation and traversal task source given navigable's active window to run the steps:
@@ -1122,7 +1127,17 @@ void ApplyHistoryStepState::start()
                 navigation->fire_a_traverse_navigate_event(*target_entry, m_user_involvement);
             }
 
-            auto after_document_populated = GC::create_function(heap(), [this, old_origin, changing_navigable_continuation, target_entry, navigable](GC::Ptr<PopulateSessionHistoryEntryDocumentOutput> output) mutable {
+            // AD-HOC: A document kept alive in the back/forward cache is still targetEntry's document, even though it is
+            //         not navigable's active document. A pending reload populates a new document instead.
+            GC::Ptr<DOM::Document> cached_document;
+            if (auto document_id = target_entry->document_state()->document_id(); document_id.has_value() && !m_pending_document && navigable->is_top_level_traversable()) {
+                if (target_entry->document_state()->reload_pending())
+                    m_traversable->back_forward_cache().evict(*document_id);
+                else
+                    cached_document = m_traversable->back_forward_cache().take(*document_id);
+            }
+
+            auto after_document_populated = GC::create_function(heap(), [this, old_origin, changing_navigable_continuation, target_entry, navigable, cached_document](GC::Ptr<PopulateSessionHistoryEntryDocumentOutput> output) mutable {
                 changing_navigable_continuation->population_output = output;
                 changing_navigable_continuation->old_origin = old_origin;
 
@@ -1133,13 +1148,15 @@ void ApplyHistoryStepState::start()
                     resolved_document = m_pending_document;
                 else if (output && output->document)
                     resolved_document = output->document;
+                else if (cached_document)
+                    resolved_document = cached_document;
                 else
                     resolved_document = navigable->active_document();
                 changing_navigable_continuation->resolved_document = resolved_document;
 
                 // 1. If targetEntry's document is null, then set changingNavigableContinuation's update-only to true.
                 bool has_fresh_document = m_pending_document || (output && output->document);
-                if (!has_fresh_document && target_entry->document_state()->document_id() != navigable->active_document_id())
+                if (!has_fresh_document && !cached_document && target_entry->document_state()->document_id() != navigable->active_document_id())
                     changing_navigable_continuation->update_only = true;
 
                 // 2. If targetEntry's document's origin is not oldOrigin, then set targetEntry's classic history API state to StructuredSerializeForStorage(null).
@@ -1155,7 +1172,7 @@ void ApplyHistoryStepState::start()
             });
 
             // 8. If targetEntry's document is null, or targetEntry's document state's reload pending is true, then:
-            bool needs_population = !m_pending_document
+            bool needs_population = !m_pending_document && !cached_document
                 && (target_entry->document_state()->document_id() != navigable->active_document_id()
                     || target_entry->document_state()->reload_pending());
             if (needs_population) {
@@ -1419,7 +1436,7 @@ void ApplyHistoryStepState::process_continuations()
             VERIFY(m_navigation_type.has_value());
 
             // 2. Deactivate displayedDocument, given userInvolvement, targetEntry, navigationType, and afterPotentialUnloads.
-            deactivate_a_document_for_cross_document_navigation(*displayed_document, m_user_involvement, *target_entry, continuation->resolved_document, after_potential_unload);
+            deactivate_a_document_for_cross_document_navigation(*displayed_document, m_user_involvement, *target_entry, *m_navigation_type, continuation->resolved_document, after_potential_unload);
         }
     }
 }
@@ -2135,6 +2152,14 @@ void LocalTraversableNavigable::clear_the_forward_session_history()
             }
         }
     }
+
+    // AD-HOC: The documents of removed entries can no longer be traversed to, so drop them from the back/forward cache.
+    HashTable<UniqueNodeID> reachable_document_ids;
+    for (auto const& entry : session_history_entries()) {
+        if (auto document_id = entry->document_state()->document_id(); document_id.has_value())
+            reachable_document_ids.set(*document_id);
+    }
+    m_back_forward_cache->evict_all_except(reachable_document_ids);
 }
 
 bool LocalTraversableNavigable::can_go_back() const
@@ -2512,7 +2537,10 @@ void LocalTraversableNavigable::destroy_top_level_traversable()
     auto browsing_context = active_browsing_context();
 
     // 2. For each historyEntry in traversable's session history entries:
-    // NOTE: Without bfcache, only the active document is alive, so we only need to destroy it.
+    //    1. Let document be historyEntry's document.
+    //    2. If document is not null, then destroy a document and its descendants given document.
+    // NOTE: Apart from the active document, only the documents in the back/forward cache are still alive.
+    m_back_forward_cache->evict_all();
     if (active_document())
         active_document()->destroy_a_document_and_its_descendants();
 
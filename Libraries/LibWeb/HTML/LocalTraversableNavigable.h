@@ -14,6 +14,7 @@
 #include <LibWeb/Bindings/NavigationType.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/Geolocation/Geolocation.h>
+#include <LibWeb/HTML/BackForwardCache.h>
 #include <LibWeb/HTML/LocalNavigable.h>
 #include <LibWeb/HTML/SessionHistoryTraversalQueue.h>
 #include <LibWeb/HTML/VisibilityState.h>
@@ -131,6 +132,9 @@ public:
     StorageAPI::StorageShed& storage_shed() { return m_storage_shed; }
     StorageAPI::StorageShed const& storage_shed() const { return m_storage_shed; }
 
+    BackForwardCache& back_forward_cache() { return m_back_forward_cache; }
+    BackForwardCache const& back_forward_cache() const { return m_back_forward_cache; }
+
     // https://w3c.github.io/geolocation/#dfn-emulated-position-data
     Geolocation::EmulatedPositionData const& emulated_position_data() const;
     void set_emulated_position_data(Geolocation::EmulatedPositionData data);
@@ -248,6 +252,8 @@ private:
 
     GC::Ref<SessionHistoryTraversalQueue> m_session_history_traversal_queue;
 
+    GC::Ref<BackForwardCache> m_back_forward_cache;
+
     Utf16String m_window_handle;
 
     // https://w3c.github.io/geolocation/#dfn-emulated-position-data
@@ -95,6 +95,21 @@ static Utf16String utf16_string_from_ffi(u16 const* ptr, size_t len)
     return Utf16String::from_utf16({ reinterpret_cast<char16_t const*>(ptr), len });
 }
 
+// Whitespace-only text between tags (a newline plus indentation) is usually too long to be stored inline in the string,
+// and the same few runs repeat throughout a document. Interning them lets all Text nodes with the same run share one
+// buffer instead of each allocating their own.
+static Utf16String text_data_from_ffi(u16 const* ptr, size_t len)
+{
+    static constexpr size_t max_interned_whitespace_length = 64;
+
+    if (ptr && len > String::MAX_SHORT_STRING_BYTE_COUNT && len <= max_interned_whitespace_length) {
+        Utf16View data { reinterpret_cast<char16_t const*>(ptr), len };
+        if (data.is_ascii_whitespace())
+            return Utf16FlyString::from_utf16(data).to_utf16_string();
+    }
+    return utf16_string_from_ffi(ptr, len);
+}
+
 static Utf16String utf16_string_from_standardized_encoding_label(StringView label)
 {
     return Utf16String::from_ascii_without_validation(label.bytes());
@@ -1061,6 +1076,30 @@ DOM::Document& HTMLParser::document()
 }
 
 // https://html.spec.whatwg.org/multipage/parsing.html#parsing-html-fragments
+// Markup without `<`, `&`, CR or NUL tokenizes to nothing but character tokens in every tokenizer state. For contexts
+// whose insertion mode is reset to "in body" (or that are parsed as text), those characters all end up in a single
+// Text node appended to the root, so we can build that directly instead of setting up a temporary document and parser.
+static bool can_parse_fragment_as_plain_text(DOM::Element const& context, Utf16View input)
+{
+    if (context.namespace_uri() != Namespace::HTML)
+        return false;
+
+    if (context.local_name().is_one_of(
+            HTML::TagNames::html, HTML::TagNames::head, HTML::TagNames::frameset, HTML::TagNames::template_,
+            HTML::TagNames::table, HTML::TagNames::caption, HTML::TagNames::colgroup, HTML::TagNames::tbody,
+            HTML::TagNames::thead, HTML::TagNames::tfoot, HTML::TagNames::tr, HTML::TagNames::td, HTML::TagNames::th,
+            HTML::TagNames::select))
+        return false;
+
+    for (auto code_unit : input.utf16_span()) {
+        if (code_unit == '<' || code_unit == '&' || code_unit == '\r' || code_unit == '\0')
+            return false;
+    }
+
+    // Lone surrogates are replaced while the tokenizer decodes its input, so leave those to the full parser.
+    return input.validate();
+}
+
 WebIDL::ExceptionOr<GC::Ref<DOM::DocumentFragment>> HTMLParser::parse_html_fragment(Variant<GC::Ref<DOM::Element>, GC::Ref<DOM::DocumentFragment>> target, Utf16View input, AllowDeclarativeShadowRoots allow_declarative_shadow_roots, ParserScriptingMode scripting_mode)
 {
     // 1. Assert: scriptingMode is either Inert or Fragment.
@@ -1074,6 +1113,16 @@ WebIDL::ExceptionOr<GC::Ref<DOM::DocumentFragment>> HTMLParser::parse_html_fragm
     // 3. Assert: context is non-null.
     VERIFY(context);
 
+    // AD-HOC: Take a shortcut for markup that is just text, e.g. `element.innerHTML = "Hello"`. This produces the
+    //         same fragment as running the steps below.
+    if (can_parse_fragment_as_plain_text(*context, input)) {
+        auto target_node = target.visit([](auto node) -> GC::Ref<DOM::Node> { return node; });
+        auto fragment = context->realm().create<DOM::DocumentFragment>(target_node->document());
+        if (!input.is_empty())
+            MUST(fragment->append_child(context->realm().create<DOM::Text>(target_node->document(), Utf16String::from_utf16(input))));
+        return fragment;
+    }
+
     // 4. Let document be a Document node whose type is "html".
     auto temp_document = DOM::Document::create(context->realm());
     temp_document->set_document_type(DOM::Document::Type::HTML);
@@ -1288,11 +1337,25 @@ enum class AttributeMode {
     Yes,
 };
 
-template<OneOf<Utf8View, Utf16View> ViewType>
-static Utf16String escape_string(ViewType const& string, AttributeMode attribute_mode)
+static bool needs_escaping(Utf16View string, AttributeMode attribute_mode)
+{
+    auto is_escaped = [&](char16_t code_unit) {
+        return code_unit == '&' || code_unit == 0xA0 || code_unit == '<' || code_unit == '>' || (code_unit == '"' && attribute_mode == AttributeMode::Yes);
+    };
+    if (string.has_ascii_storage())
+        return any_of(string.ascii_span(), is_escaped);
+    return any_of(string.utf16_span(), is_escaped);
+}
+
+static void append_escaped_string(Utf16StringBuilder& builder, Utf16View string, AttributeMode attribute_mode)
 {
+    // Most text and attribute values contain nothing to escape, so append those in one go.
+    if (!needs_escaping(string, attribute_mode)) {
+        builder.append(string);
+        return;
+    }
+
     // https://html.spec.whatwg.org/multipage/parsing.html#escapingString
-    Utf16StringBuilder builder;
     for (auto code_point : string) {
         // 1. Replace any occurrence of the "&" character by the string "&amp;".
         if (code_point == '&')
@@ -1312,19 +1375,27 @@ static Utf16String escape_string(ViewType const& string, AttributeMode attribute
         else
             builder.append_code_point(code_point);
     }
-    return builder.to_string();
 }
 
 // https://html.spec.whatwg.org/multipage/parsing.html#html-fragment-serialisation-algorithm
 Utf16String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableShadowRoots serializable_shadow_roots, ReadonlySpan<GC::Ref<DOM::ShadowRoot>> shadow_roots, DOM::FragmentSerializationMode fragment_serialization_mode)
+{
+    // 2. Let s be a string, and initialize it to the empty string.
+    Utf16StringBuilder builder;
+    serialize_html_fragment_into(builder, node, serializable_shadow_roots, shadow_roots, fragment_serialization_mode);
+
+    // 6. Return s.
+    return builder.to_string();
+}
+
+// NB: Recursive invocations of the fragment serialization algorithm append to the caller's builder rather than
+//     building and copying a string per subtree.
+void HTMLParser::serialize_html_fragment_into(Utf16StringBuilder& builder, DOM::Node const& node, SerializableShadowRoots serializable_shadow_roots, ReadonlySpan<GC::Ref<DOM::ShadowRoot>> shadow_roots, DOM::FragmentSerializationMode fragment_serialization_mode)
 {
     // NOTE: Steps in this function are jumbled a bit to accommodate the Element.outerHTML API.
     //       When called with FragmentSerializationMode::Outer, we will serialize the element itself,
     //       not just its children.
 
-    // 2. Let s be a string, and initialize it to the empty string.
-    Utf16StringBuilder builder;
-
     auto serialize_element = [&](DOM::Element const& element) {
         // If current node is an element in the HTML namespace, the MathML namespace, or the SVG namespace, then let tagname be current node's local name.
         // Otherwise, let tagname be current node's qualified name.
@@ -1345,7 +1416,7 @@ Utf16String HTMLParser::serialize_html_fragment(DOM::Node const& node, Serializa
         // followed by a U+0022 QUOTATION MARK character (").
         if (element.is_value().has_value() && !element.has_attribute(AttributeNames::is)) {
             builder.append_ascii(" is=\""sv);
-            builder.append(escape_string(element.is_value()->view(), AttributeMode::Yes));
+            append_escaped_string(builder, element.is_value()->view(), AttributeMode::Yes);
             builder.append_ascii('"');
         }
 
@@ -1395,7 +1466,7 @@ Utf16String HTMLParser::serialize_html_fragment(DOM::Node const& node, Serializa
             }
 
             builder.append_ascii("=\""sv);
-            builder.append(escape_string(attribute.value().utf16_view(), AttributeMode::Yes));
+            append_escaped_string(builder, attribute.value().utf16_view(), AttributeMode::Yes);
             builder.append_ascii('"');
         });
 
@@ -1412,7 +1483,7 @@ Utf16String HTMLParser::serialize_html_fragment(DOM::Node const& node, Serializa
         // a U+002F SOLIDUS character (/),
         // tagname again,
         // and finally a U+003E GREATER-THAN SIGN character (>).
-        builder.append(serialize_html_fragment(element, serializable_shadow_roots, shadow_roots));
+        serialize_html_fragment_into(builder, element, serializable_shadow_roots, shadow_roots, DOM::FragmentSerializationMode::Inner);
         builder.append_ascii("</"sv);
         builder.append(tag_name.view());
         builder.append_ascii('>');
@@ -1422,7 +1493,7 @@ Utf16String HTMLParser::serialize_html_fragment(DOM::Node const& node, Serializa
 
     if (fragment_serialization_mode == DOM::FragmentSerializationMode::Outer) {
         serialize_element(as<DOM::Element>(node));
-        return builder.to_string();
+        return;
     }
 
     // The algorithm takes as input a DOM Element, Document, or DocumentFragment referred to as the node.
@@ -1435,7 +1506,7 @@ Utf16String HTMLParser::serialize_html_fragment(DOM::Node const& node, Serializa
         // 1. If the node serializes as void, then return the empty string.
         //    (NOTE: serializes as void is defined only on elements in the spec)
         if (element.serializes_as_void())
-            return {};
+            return;
 
         // 3. If the node is a template element, then let the node instead be the template element's template contents (a DocumentFragment node).
         //    (NOTE: This is out of order of the spec to avoid another dynamic cast. The second step just creates a string builder, so it shouldn't matter)
@@ -1508,7 +1579,7 @@ Utf16String HTMLParser::serialize_html_fragment(DOM::Node const& node, Serializa
 
                 // 10. Append the value of running the HTML fragment serialization algorithm with shadow,
                 //    serializableShadowRoots, and shadowRoots (thus recursing into this algorithm for that element).
-                builder.append(serialize_html_fragment(*shadow, serializable_shadow_roots, shadow_roots));
+                serialize_html_fragment_into(builder, *shadow, serializable_shadow_roots, shadow_roots, DOM::FragmentSerializationMode::Inner);
 
                 // 11. Append "</template>".
                 builder.append_ascii("</template>"sv);
@@ -1547,7 +1618,7 @@ Utf16String HTMLParser::serialize_html_fragment(DOM::Node const& node, Serializa
             }
 
             // Otherwise, append the value of current node's data IDL attribute, escaped as described below.
-            builder.append(escape_string(text_node.data().utf16_view(), AttributeMode::No));
+            append_escaped_string(builder, text_node.data().utf16_view(), AttributeMode::No);
         }
 
         if (is<DOM::Comment>(current_node)) {
@@ -1591,9 +1662,6 @@ Utf16String HTMLParser::serialize_html_fragment(DOM::Node const& node, Serializa
 
         return IterationDecision::Continue;
     });
-
-    // 6. Return s.
-    return builder.to_string();
 }
 
 // https://html.spec.whatwg.org/multipage/common-microsyntaxes.html#current-dimension-value
@@ -2176,12 +2244,13 @@ extern "C" void ladybird_html_parser_insert_text(size_t parent, size_t offset, u
     // 4. If there is a Text node immediately before insertionLocation, then append data to that Text node's data.
     //    Otherwise, create a new Text node whose data is data and whose node document is the same as that of the element
     //    in which insertionLocation finds itself, and insert the newly created node at insertionLocation.
-    auto data = utf16_string_from_ffi(data_ptr, data_len);
     if (auto* previous_text = as_if<DOM::Text>(insertion_location.previous_child())) {
-        (void)previous_text->append_data(data);
+        (void)previous_text->append_data(utf16_string_from_ffi(data_ptr, data_len));
         return;
     }
 
+    auto data = text_data_from_ffi(data_ptr, data_len);
+
     if (auto* before_node = insertion_location.child_at_offset()) {
         auto text = parent_node.document().realm().create<DOM::Text>(parent_node.document(), data);
         parent_node.insert_before(*text, before_node);
@@ -113,6 +113,8 @@ private:
     HTMLParser(DOM::Document&, ParserScriptingMode, Utf16View input, Utf16View encoding);
     HTMLParser(DOM::Document&, ParserScriptingMode, ScriptCreatedParser);
 
+    static void serialize_html_fragment_into(Utf16StringBuilder&, DOM::Node const&, SerializableShadowRoots, ReadonlySpan<GC::Ref<DOM::ShadowRoot>>, DOM::FragmentSerializationMode);
+
     virtual void visit_edges(Cell::Visitor&) override;
     virtual void initialize(JS::Realm&) override;
     virtual void finalize() override;
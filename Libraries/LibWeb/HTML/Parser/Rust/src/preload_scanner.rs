@@ -17,6 +17,8 @@ use std::ffi::c_void;
 pub enum RustFfiPreloadScannerAction {
     Base = 0,
     Fetch = 1,
+    Preconnect = 2,
+    DnsPrefetch = 3,
 }
 
 #[repr(C)]
@@ -38,6 +40,14 @@ pub enum RustFfiPreloadScannerCorsSetting {
     UseCredentials = 2,
 }
 
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Eq, PartialEq)]
+pub enum RustFfiPreloadScannerPriority {
+    Auto = 0,
+    High = 1,
+    Low = 2,
+}
+
 #[repr(C)]
 pub struct RustFfiPreloadScannerEntry {
     pub action: RustFfiPreloadScannerAction,
@@ -45,6 +55,7 @@ pub struct RustFfiPreloadScannerEntry {
     pub url_len: usize,
     pub destination: RustFfiPreloadScannerDestination,
     pub cors_setting: RustFfiPreloadScannerCorsSetting,
+    pub priority: RustFfiPreloadScannerPriority,
 }
 
 /// Scan pending parser input for resources the speculative HTML parser can fetch.
@@ -184,6 +195,7 @@ fn process_base(attributes: &[Attribute], callback: &mut impl FnMut(&RustFfiPrel
         href,
         RustFfiPreloadScannerDestination::None,
         RustFfiPreloadScannerCorsSetting::NoCors,
+        RustFfiPreloadScannerPriority::Auto,
     )
 }
 
@@ -195,12 +207,22 @@ fn process_script(attributes: &[Attribute], callback: &mut impl FnMut(&RustFfiPr
         return true;
     }
 
+    // Module scripts are always fetched in CORS mode, so a speculative no-cors fetch would never be reused.
+    let is_module = attribute_value(attributes, b"type")
+        .is_some_and(|type_| type_.trim_matches(is_html_whitespace).eq_ignore_ascii_case("module"));
+    let cors_setting = if is_module {
+        module_cors_setting_from_attribute(attributes)
+    } else {
+        cors_setting_from_attribute(attributes)
+    };
+
     emit_entry(
         callback,
         RustFfiPreloadScannerAction::Fetch,
         src,
         RustFfiPreloadScannerDestination::Script,
-        cors_setting_from_attribute(attributes),
+        cors_setting,
+        priority_from_attribute(attributes),
     )
 }
 
@@ -216,6 +238,7 @@ fn process_link(attributes: &[Attribute], callback: &mut impl FnMut(&RustFfiPrel
         return true;
     };
 
+    let mut cors_setting = cors_setting_from_attribute(attributes);
     let destination = if rel_contains_keyword(rel.as_bytes(), b"stylesheet") {
         RustFfiPreloadScannerDestination::Style
     } else if rel_contains_keyword(rel.as_bytes(), b"preload") {
@@ -223,6 +246,18 @@ fn process_link(attributes: &[Attribute], callback: &mut impl FnMut(&RustFfiPrel
             return true;
         };
         destination
+    } else if rel_contains_keyword(rel.as_bytes(), b"modulepreload") {
+        // https://html.spec.whatwg.org/multipage/links.html#link-type-modulepreload
+        // Only script-like destinations are fetched, and the missing-value default of "as" is "script".
+        if attribute_value(attributes, b"as").is_some_and(|as_| !as_.eq_ignore_ascii_case("script")) {
+            return true;
+        }
+        cors_setting = module_cors_setting_from_attribute(attributes);
+        RustFfiPreloadScannerDestination::Script
+    } else if rel_contains_keyword(rel.as_bytes(), b"preconnect") {
+        return emit_connection_entry(callback, RustFfiPreloadScannerAction::Preconnect, href, cors_setting);
+    } else if rel_contains_keyword(rel.as_bytes(), b"dns-prefetch") {
+        return emit_connection_entry(callback, RustFfiPreloadScannerAction::DnsPrefetch, href, cors_setting);
     } else {
         return true;
     };
@@ -232,7 +267,8 @@ fn process_link(attributes: &[Attribute], callback: &mut impl FnMut(&RustFfiPrel
         RustFfiPreloadScannerAction::Fetch,
         href,
         destination,
-        cors_setting_from_attribute(attributes),
+        cors_setting,
+        priority_from_attribute(attributes),
     )
 }
 
@@ -250,6 +286,24 @@ fn process_img(attributes: &[Attribute], callback: &mut impl FnMut(&RustFfiPrelo
         src,
         RustFfiPreloadScannerDestination::Image,
         cors_setting_from_attribute(attributes),
+        priority_from_attribute(attributes),
+    )
+}
+
+fn emit_connection_entry(
+    callback: &mut impl FnMut(&RustFfiPreloadScannerEntry) -> bool,
+    action: RustFfiPreloadScannerAction,
+    url: &str,
+    cors_setting: RustFfiPreloadScannerCorsSetting,
+) -> bool {
+    // Connection warming does not fetch anything, so there is no destination or priority to report.
+    emit_entry(
+        callback,
+        action,
+        url,
+        RustFfiPreloadScannerDestination::None,
+        cors_setting,
+        RustFfiPreloadScannerPriority::Auto,
     )
 }
 
@@ -259,6 +313,7 @@ fn emit_entry(
     url: &str,
     destination: RustFfiPreloadScannerDestination,
     cors_setting: RustFfiPreloadScannerCorsSetting,
+    priority: RustFfiPreloadScannerPriority,
 ) -> bool {
     let entry = RustFfiPreloadScannerEntry {
         action,
@@ -266,6 +321,7 @@ fn emit_entry(
         url_len: url.len(),
         destination,
         cors_setting,
+        priority,
     };
     callback(&entry)
 }
@@ -306,6 +362,33 @@ fn cors_setting_from_attribute(attributes: &[Attribute]) -> RustFfiPreloadScanne
     }
 }
 
+/// Module requests use CORS mode, and a missing crossorigin attribute means "same-origin" credentials, which matches
+/// the anonymous state of a potential CORS request.
+fn module_cors_setting_from_attribute(attributes: &[Attribute]) -> RustFfiPreloadScannerCorsSetting {
+    match cors_setting_from_attribute(attributes) {
+        RustFfiPreloadScannerCorsSetting::NoCors => RustFfiPreloadScannerCorsSetting::Anonymous,
+        cors_setting => cors_setting,
+    }
+}
+
+fn priority_from_attribute(attributes: &[Attribute]) -> RustFfiPreloadScannerPriority {
+    let Some(fetchpriority) = attribute_value(attributes, b"fetchpriority") else {
+        return RustFfiPreloadScannerPriority::Auto;
+    };
+
+    if fetchpriority.eq_ignore_ascii_case("high") {
+        RustFfiPreloadScannerPriority::High
+    } else if fetchpriority.eq_ignore_ascii_case("low") {
+        RustFfiPreloadScannerPriority::Low
+    } else {
+        RustFfiPreloadScannerPriority::Auto
+    }
+}
+
+fn is_html_whitespace(c: char) -> bool {
+    matches!(c, '\t' | '\n' | '\x0C' | '\r' | ' ')
+}
+
 #[cfg(test)]
 mod tests {
     use super::*;
@@ -483,4 +566,98 @@ mod tests {
             ]
         );
     }
+    #[test]
+    fn scans_module_scripts_and_fetch_priority() {
+        let input = r#"
+            <script type="module" src="./module.js"></script>
+            <script type=" MODULE " crossorigin="use-credentials" src="./credentials.js"></script>
+            <link rel="modulepreload" href="./dependency.js" fetchpriority="high">
+            <link rel="modulepreload" as="style" href="./not-a-script.css">
+            <img src="./low.png" fetchpriority="LOW">
+            <img src="./invalid.png" fetchpriority="urgent">
+        "#;
+        let mut entries = Vec::new();
+        scan(input.as_bytes(), |entry| {
+            let url = unsafe { std::slice::from_raw_parts(entry.url_ptr, entry.url_len) };
+            entries.push((
+                std::str::from_utf8(url).unwrap().to_string(),
+                entry.destination,
+                entry.cors_setting,
+                entry.priority,
+            ));
+            true
+        });
+
+        assert_eq!(
+            entries,
+            vec![
+                (
+                    "./module.js".to_string(),
+                    RustFfiPreloadScannerDestination::Script,
+                    RustFfiPreloadScannerCorsSetting::Anonymous,
+                    RustFfiPreloadScannerPriority::Auto,
+                ),
+                (
+                    "./credentials.js".to_string(),
+                    RustFfiPreloadScannerDestination::Script,
+                    RustFfiPreloadScannerCorsSetting::UseCredentials,
+                    RustFfiPreloadScannerPriority::Auto,
+                ),
+                (
+                    "./dependency.js".to_string(),
+                    RustFfiPreloadScannerDestination::Script,
+                    RustFfiPreloadScannerCorsSetting::Anonymous,
+                    RustFfiPreloadScannerPriority::High,
+                ),
+                (
+                    "./low.png".to_string(),
+                    RustFfiPreloadScannerDestination::Image,
+                    RustFfiPreloadScannerCorsSetting::NoCors,
+                    RustFfiPreloadScannerPriority::Low,
+                ),
+                (
+                    "./invalid.png".to_string(),
+                    RustFfiPreloadScannerDestination::Image,
+                    RustFfiPreloadScannerCorsSetting::NoCors,
+                    RustFfiPreloadScannerPriority::Auto,
+                ),
+            ]
+        );
+    }
+
+    #[test]
+    fn scans_connection_warming_links() {
+        let entries = collect(
+            r#"
+                <link rel="preconnect" href="https://cdn.example" crossorigin>
+                <link rel="DNS-Prefetch" href="//fonts.example">
+                <link rel="preconnect" href="">
+                <link rel="preload preconnect" as="image" href="./image.png">
+            "#,
+        );
+
+        assert_eq!(
+            entries,
+            vec![
+                ScannedEntry {
+                    action: RustFfiPreloadScannerAction::Preconnect,
+                    url: "https://cdn.example".to_string(),
+                    destination: RustFfiPreloadScannerDestination::None,
+                    cors_setting: RustFfiPreloadScannerCorsSetting::Anonymous,
+                },
+                ScannedEntry {
+                    action: RustFfiPreloadScannerAction::DnsPrefetch,
+                    url: "//fonts.example".to_string(),
+                    destination: RustFfiPreloadScannerDestination::None,
+                    cors_setting: RustFfiPreloadScannerCorsSetting::NoCors,
+                },
+                ScannedEntry {
+                    action: RustFfiPreloadScannerAction::Fetch,
+                    url: "./image.png".to_string(),
+                    destination: RustFfiPreloadScannerDestination::Image,
+                    cors_setting: RustFfiPreloadScannerCorsSetting::NoCors,
+                },
+            ]
+        );
+    }
 }
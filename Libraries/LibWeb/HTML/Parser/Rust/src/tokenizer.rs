@@ -772,6 +772,52 @@ impl HtmlTokenizer {
         self.input.len()
     }
 
+    /// Find the end of a run of printable ASCII code points starting at
+    /// `start` that contains none of the `stops` code points, up to the
+    /// fast-scan limit. The input is tested 16 code points at a time with
+    /// branch-free lane checks so the compiler can vectorize the scan; only
+    /// the chunk containing the terminator is rescanned one code point at a
+    /// time.
+    #[inline(always)]
+    fn scan_printable_ascii_run(&self, start: usize, stops: &[u32]) -> usize {
+        const CHUNK: usize = 16;
+        let limit = self.fast_scan_limit();
+        let is_plain = |cp: u32| (0x20..0x80).contains(&cp) && stops.iter().all(|&stop| cp != stop);
+        let mut off = start;
+        while off + CHUNK <= limit {
+            let chunk = &self.input[off..off + CHUNK];
+            if !chunk.iter().fold(true, |all_plain, &cp| all_plain & is_plain(cp)) {
+                break;
+            }
+            off += CHUNK;
+        }
+        while off < limit && is_plain(self.input[off]) {
+            off += 1;
+        }
+        off
+    }
+
+    /// Append the printable ASCII run `current_offset..end` (as found by
+    /// `scan_printable_ascii_run`) to `current_builder` and advance past
+    /// it. The run contains no newlines, so only the column moves.
+    #[inline(always)]
+    fn consume_printable_ascii_run_into_builder(&mut self, end: usize) {
+        let start = self.current_offset;
+        if end <= start {
+            return;
+        }
+        // SAFETY: the run is printable ASCII, which is always valid UTF-8.
+        let builder = unsafe { self.current_builder.as_mut_vec() };
+        builder.extend(self.input[start..end].iter().map(|&cp| cp as u8));
+        self.current_column += (end - start) as u64;
+        self.prev_offset = end - 1;
+        self.current_offset = end;
+        if let Some(pos) = self.source_positions.last_mut() {
+            pos.line = self.current_line;
+            pos.column = self.current_column;
+        }
+    }
+
     fn should_pause_before_next_input_character(&self) -> bool {
         if self.stop_at_insertion_point
             && let Some(ip) = self.insertion_point
@@ -1281,36 +1327,17 @@ impl HtmlTokenizer {
                 // 13.2.5.36 Attribute value (double-quoted) state
                 State::AttributeValueDoubleQuoted => {
                     // Fast-path run: bulk-append printable ASCII until we
-                    // hit `"`, `&`, NUL, CR or non-ASCII. The inner loop
-                    // advances a local offset directly and only updates
-                    // tokenizer/position state once at the end.
+                    // hit `"`, `&`, NUL, CR or non-ASCII. The run is found
+                    // with a chunked scan and tokenizer/position state is
+                    // only updated once at the end.
                     if let Some(cp) = current_input_character
                         && (0x20..0x80).contains(&cp)
                         && cp != 0x22
                         && cp != 0x26
                     {
                         unsafe { self.current_builder.as_mut_vec().push(cp as u8) };
-                        let start_offset = self.current_offset;
-                        let mut off = start_offset;
-                        let input_len = self.fast_scan_limit();
-                        while off < input_len {
-                            let next = self.input[off];
-                            if !(0x20..0x80).contains(&next) || next == 0x22 || next == 0x26 {
-                                break;
-                            }
-                            unsafe { self.current_builder.as_mut_vec().push(next as u8) };
-                            off += 1;
-                        }
-                        let consumed = off - start_offset;
-                        if consumed > 0 {
-                            self.current_column += consumed as u64;
-                            self.prev_offset = off - 1;
-                            self.current_offset = off;
-                            if let Some(pos) = self.source_positions.last_mut() {
-                                pos.line = self.current_line;
-                                pos.column = self.current_column;
-                            }
-                        }
+                        let end = self.scan_printable_ascii_run(self.current_offset, &[0x22, 0x26]);
+                        self.consume_printable_ascii_run_into_builder(end);
                         continue;
                     }
                     match current_input_character {
@@ -1340,30 +1367,43 @@ impl HtmlTokenizer {
                 }
 
                 // 13.2.5.37 Attribute value (single-quoted) state
-                State::AttributeValueSingleQuoted => match current_input_character {
-                    Some(0x27) => {
-                        self.set_attribute_value();
-                        self.state = State::AfterAttributeValueQuoted;
-                        continue;
-                    }
-                    Some(0x26) => {
-                        self.return_state = State::AttributeValueSingleQuoted;
-                        self.state = State::CharacterReference;
-                        continue;
-                    }
-                    Some(0x00) => {
-                        self.current_builder.push('\u{FFFD}');
+                State::AttributeValueSingleQuoted => {
+                    // Same fast path as the double-quoted state, stopping at `'` instead.
+                    if let Some(cp) = current_input_character
+                        && (0x20..0x80).contains(&cp)
+                        && cp != 0x27
+                        && cp != 0x26
+                    {
+                        unsafe { self.current_builder.as_mut_vec().push(cp as u8) };
+                        let end = self.scan_printable_ascii_run(self.current_offset, &[0x27, 0x26]);
+                        self.consume_printable_ascii_run_into_builder(end);
                         continue;
                     }
-                    None => {
-                        self.emit_eof();
-                        return self.queued_tokens.pop_front();
-                    }
-                    Some(cp) => {
-                        push_code_point(&mut self.current_builder, cp);
-                        continue;
+                    match current_input_character {
+                        Some(0x27) => {
+                            self.set_attribute_value();
+                            self.state = State::AfterAttributeValueQuoted;
+                            continue;
+                        }
+                        Some(0x26) => {
+                            self.return_state = State::AttributeValueSingleQuoted;
+                            self.state = State::CharacterReference;
+                            continue;
+                        }
+                        Some(0x00) => {
+                            self.current_builder.push('\u{FFFD}');
+                            continue;
+                        }
+                        None => {
+                            self.emit_eof();
+                            return self.queued_tokens.pop_front();
+                        }
+                        Some(cp) => {
+                            push_code_point(&mut self.current_builder, cp);
+                            continue;
+                        }
                     }
-                },
+                }
 
                 // 13.2.5.38 Attribute value (unquoted) state
                 State::AttributeValueUnquoted => match current_input_character {
@@ -1575,33 +1615,47 @@ impl HtmlTokenizer {
                 },
 
                 // 13.2.5.45 Comment state
-                State::Comment => match current_input_character {
-                    Some(0x3C) => {
-                        self.current_builder.push('<');
-                        self.state = State::CommentLessThanSign;
-                        continue;
-                    }
-                    Some(0x2D) => {
-                        self.state = State::CommentEndDash;
-                        continue;
-                    }
-                    Some(0x00) => {
-                        self.current_builder.push('\u{FFFD}');
+                State::Comment => {
+                    // Fast-path run: comment bodies are mostly plain text, so
+                    // bulk-append printable ASCII up to the next `<` or `-`.
+                    if let Some(cp) = current_input_character
+                        && (0x20..0x80).contains(&cp)
+                        && cp != 0x3C
+                        && cp != 0x2D
+                    {
+                        unsafe { self.current_builder.as_mut_vec().push(cp as u8) };
+                        let end = self.scan_printable_ascii_run(self.current_offset, &[0x3C, 0x2D]);
+                        self.consume_printable_ascii_run_into_builder(end);
                         continue;
                     }
-                    None => {
-                        {
-                            let data = self.consume_current_builder();
-                            self.current_token.set_comment_data(data);
+                    match current_input_character {
+                        Some(0x3C) => {
+                            self.current_builder.push('<');
+                            self.state = State::CommentLessThanSign;
+                            continue;
+                        }
+                        Some(0x2D) => {
+                            self.state = State::CommentEndDash;
+                            continue;
+                        }
+                        Some(0x00) => {
+                            self.current_builder.push('\u{FFFD}');
+                            continue;
+                        }
+                        None => {
+                            {
+                                let data = self.consume_current_builder();
+                                self.current_token.set_comment_data(data);
+                            }
+                            self.emit_current_token_followed_by_eof();
+                            return self.queued_tokens.pop_front();
+                        }
+                        Some(cp) => {
+                            push_code_point(&mut self.current_builder, cp);
+                            continue;
                         }
-                        self.emit_current_token_followed_by_eof();
-                        return self.queued_tokens.pop_front();
-                    }
-                    Some(cp) => {
-                        push_code_point(&mut self.current_builder, cp);
-                        continue;
                     }
-                },
+                }
 
                 // 13.2.5.46 Comment less-than sign state
                 State::CommentLessThanSign => match current_input_character {
@@ -3292,4 +3346,24 @@ mod tests {
         assert_eq!(attributes.len(), 1);
         assert_eq!(attributes[0].value, "&tws-checkout-success=4.1.0");
     }
+    #[test]
+    fn fast_scanned_runs_stop_at_special_characters() {
+        let input =
+            "<a title='a long single-quoted value &amp; more text here'><!-- a long comment body - with a <dash> -->";
+        let mut tokenizer = HtmlTokenizer::new(code_points(input));
+
+        let token = tokenizer.next_token(false, false).expect("start tag token");
+        let TokenPayload::Tag { attributes, .. } = token.payload else {
+            panic!("expected tag token");
+        };
+        assert_eq!(attributes.len(), 1);
+        assert_eq!(attributes[0].value, "a long single-quoted value & more text here");
+
+        let token = tokenizer.next_token(false, false).expect("comment token");
+        let TokenPayload::Comment(data) = token.payload else {
+            panic!("expected comment token");
+        };
+        assert_eq!(data, " a long comment body - with a <dash> ");
+        assert_eq!(token.end_position.column, input.len() as u64);
+    }
 }
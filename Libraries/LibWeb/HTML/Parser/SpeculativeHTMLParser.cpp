@@ -5,6 +5,7 @@
  */
 
 #include <AK/Assertions.h>
+#include <AK/Debug.h>
 #include <AK/FFIHelpers.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibWeb/DOM/Document.h>
@@ -17,6 +18,7 @@
 #include <LibWeb/HTML/PotentialCORSRequest.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTMLTokenizerRustFFI.h>
+#include <LibWeb/Loader/ResourceLoader.h>
 
 namespace Web::HTML {
 
@@ -108,11 +110,25 @@ CORSSettingAttribute cors_setting_from_preload_scanner(RustFfiPreloadScannerCors
     VERIFY_NOT_REACHED();
 }
 
-void issue_speculative_fetch(JS::Realm& realm, DOM::Document& document, URL::URL url, Optional<Fetch::Infrastructure::Request::Destination> destination, CORSSettingAttribute cors_setting)
+Fetch::Infrastructure::Request::Priority priority_from_preload_scanner(RustFfiPreloadScannerPriority priority)
+{
+    switch (priority) {
+    case RustFfiPreloadScannerPriority::Auto:
+        return Fetch::Infrastructure::Request::Priority::Auto;
+    case RustFfiPreloadScannerPriority::High:
+        return Fetch::Infrastructure::Request::Priority::High;
+    case RustFfiPreloadScannerPriority::Low:
+        return Fetch::Infrastructure::Request::Priority::Low;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+void issue_speculative_fetch(JS::Realm& realm, DOM::Document& document, URL::URL url, Optional<Fetch::Infrastructure::Request::Destination> destination, CORSSettingAttribute cors_setting, Fetch::Infrastructure::Request::Priority priority)
 {
     auto& vm = realm.vm();
     auto request = create_potential_CORS_request(vm, url, destination, cors_setting);
     request->set_client(&document.relevant_settings_object());
+    request->set_priority(priority);
 
     Fetch::Infrastructure::FetchAlgorithms::Input fetch_algorithms_input {};
     auto algorithms = Fetch::Infrastructure::FetchAlgorithms::create(vm, move(fetch_algorithms_input));
@@ -142,6 +158,18 @@ void SpeculativeHTMLParser::process_preload_scanner_entry(RustFfiPreloadScannerE
 
     case RustFfiPreloadScannerAction::Fetch:
         break;
+
+    case RustFfiPreloadScannerAction::Preconnect:
+    case RustFfiPreloadScannerAction::DnsPrefetch:
+        // Connection warming does not produce a resource, so it never enters the list of speculative fetch URLs.
+        // The link element repeats this once it is inserted, which is cheap once the origin is already warm.
+        if (auto url = m_base_url.complete_url(url_string); url.has_value() && url->scheme().is_one_of("http"sv, "https"sv) && ResourceLoader::is_initialized()) {
+            if (entry.action == RustFfiPreloadScannerAction::Preconnect)
+                ResourceLoader::the().preconnect(*url, m_document->fallback_base_url());
+            else
+                ResourceLoader::the().prefetch_dns(*url, m_document->fallback_base_url());
+        }
+        return;
     }
 
     // FIXME: A meta element whose http-equiv attribute is in the Content security policy state.
@@ -158,13 +186,16 @@ void SpeculativeHTMLParser::process_preload_scanner_entry(RustFfiPreloadScannerE
         return;
 
     // 3. Otherwise, if url is already in the list of speculative fetch URLs, then do nothing.
-    if (m_document->has_speculative_fetch_url(*url))
+    if (m_document->has_speculative_fetch_url(*url)) {
+        dbgln_if(HTML_PARSER_DEBUG, "SpeculativeHTMLParser: Already fetched {}", *url);
         return;
+    }
 
     // 4. Otherwise, fetch url as if the element was processed normally, and add url to the list of
     //    speculative fetch URLs.
+    dbgln_if(HTML_PARSER_DEBUG, "SpeculativeHTMLParser: Fetching {}", *url);
     m_document->add_speculative_fetch_url(*url);
-    issue_speculative_fetch(m_document->realm(), *m_document, *url, destination_from_preload_scanner(entry.destination), cors_setting_from_preload_scanner(entry.cors_setting));
+    issue_speculative_fetch(m_document->realm(), *m_document, *url, destination_from_preload_scanner(entry.destination), cors_setting_from_preload_scanner(entry.cors_setting), priority_from_preload_scanner(entry.priority));
 }
 
 }
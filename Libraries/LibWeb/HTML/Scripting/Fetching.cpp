@@ -225,15 +225,24 @@ static void schedule_bytecode_cache_generation(NonnullRefPtr<JS::SourceCode cons
     });
 }
 
+// Speculative background compilation only covers this much function source per executable. Anything beyond it stays
+// lazily compiled on first call, so large bundles don't carry bytecode for functions that never run.
+static constexpr size_t speculative_compilation_budget_in_code_units = 256 * KiB;
+
 static void compile_remaining_functions_off_thread(JS::Bytecode::Executable& executable, NonnullRefPtr<JS::SourceCode const> source_code)
 {
     Vector<GC::Root<JS::SharedFunctionInstanceData>> shared_data_roots;
     Vector<void*> function_asts;
+    size_t remaining_budget = speculative_compilation_budget_in_code_units;
 
     for (auto& shared_data : executable.shared_function_data) {
         if (!shared_data || shared_data->m_executable || !shared_data->m_rust_function_ast)
             continue;
 
+        if (shared_data->m_source_text_length > remaining_budget)
+            continue;
+        remaining_budget -= shared_data->m_source_text_length;
+
         auto* cloned_ast = JS::RustIntegration::clone_function_ast(shared_data->m_rust_function_ast);
         if (!cloned_ast)
             continue;
@@ -864,7 +873,7 @@ WebIDL::ExceptionOr<void> fetch_classic_worker_script(URL::URL const& url, Envir
     request->set_parser_metadata(Fetch::Infrastructure::Request::ParserMetadata::NotParserInserted);
     request->set_use_url_credentials(true);
 
-    auto process_response_consume_body = [&settings_object, on_complete = move(on_complete)](auto response, auto body_bytes) {
+    auto process_response_consume_body = [request, &settings_object, on_complete = move(on_complete)](auto response, auto body_bytes) {
         // 1. Set response to response's unsafe response.
         response = response->unsafe_response();
 
@@ -894,18 +903,86 @@ WebIDL::ExceptionOr<void> fetch_classic_worker_script(URL::URL const& url, Envir
         // NOTE: Other fetch schemes are exempted from MIME type checking for historical web-compatibility reasons.
         //       We might be able to tighten this in the future; see https://github.com/whatwg/html/issues/3255.
 
-        // 4. Let sourceText be the result of UTF-8 decoding bodyBytes.
-        auto decoder = TextCodec::decoder_for("UTF-8"sv);
-        VERIFY(decoder.has_value());
-        auto source_text = decode_source_text_to_utf16(*decoder, body_bytes_view(body_bytes)).release_value_but_fixme_should_propagate_errors();
-
-        // 5. Let script be the result of creating a classic script using sourceText, settingsObject,
-        //    response's URL, and the default classic script fetch options.
         auto response_url = response->url().value_or({});
-        auto script = ClassicScript::create(response_url.to_byte_string(), source_text, settings_object, response_url);
+        auto const& bytecode = response->javascript_bytecode_cache();
+        auto bytecode_cache_context = bytecode_cache_context_for_request(*request, *response, response_url);
+        auto source_byte_storage = body_bytes.template get<Core::ImmutableBytes>();
+        Optional<BytecodeCacheSourceHash> source_hash;
+        if (bytecode.has_value() || bytecode_cache_context.has_value())
+            source_hash = bytecode_cache_source_hash(source_byte_storage.bytes(), "UTF-8"sv);
+
+        auto create_script = [response_url, source_byte_storage, bytecode_cache_context = move(bytecode_cache_context), source_hash,
+                                 settings_root = GC::make_root(settings_object), on_complete_root = GC::make_root(on_complete)]() mutable {
+            // 4. Let sourceText be the result of UTF-8 decoding bodyBytes.
+            auto decoder = TextCodec::decoder_for("UTF-8"sv);
+            VERIFY(decoder.has_value());
+            auto response_url_string = response_url.to_byte_string();
+            auto source_code = JS::SourceCode::create(
+                utf16_string_from_url_ascii(response_url_string.view()),
+                decode_source_text_to_utf16(*decoder, source_byte_storage.bytes()).release_value_but_fixme_should_propagate_errors());
+
+            // OPTIMIZATION: Parse and generate bytecode on the thread pool so large worker scripts don't block the
+            //               worker's event loop; only the GC-backed materialization happens back on this thread.
+            compile_off_thread(move(source_code), JS::RustIntegration::ProgramType::Script, 1,
+                [response_url = move(response_url), response_url_string = move(response_url_string),
+                    bytecode_cache_context = move(bytecode_cache_context),
+                    source_hash = move(source_hash),
+                    on_complete_root = move(on_complete_root),
+                    settings_root = move(settings_root)](auto result, auto source_code) mutable {
+                    auto source_code_for_cache = source_code;
+                    auto should_generate_bytecode_cache = result.compiled && bytecode_cache_context.has_value();
+
+                    // 5. Let script be the result of creating a classic script using sourceText, settingsObject,
+                    //    response's URL, and the default classic script fetch options.
+                    auto script = result.compiled
+                        ? ClassicScript::create_from_pre_compiled(move(response_url_string), move(source_code), *settings_root, move(response_url), result.compiled)
+                        : ClassicScript::create_from_pre_parsed(move(response_url_string), move(source_code), *settings_root, move(response_url), result.parsed);
+                    BytecodeCacheInstallTarget install_target;
+                    if (auto* script_record = script->script_record()) {
+                        install_target.script = *script_record;
+                        if (!should_generate_bytecode_cache) {
+                            if (auto* executable = script_record->cached_executable())
+                                compile_remaining_functions_off_thread(*executable, source_code_for_cache);
+                        }
+                    }
+
+                    // 6. Run onComplete given script.
+                    on_complete_root->function()(script);
+
+                    // OPTIMIZATION: Produce a bytecode cache sidecar so the next load of this worker can skip parsing and codegen.
+                    if (should_generate_bytecode_cache) {
+                        install_target.begin_generation();
+                        VERIFY(source_hash.has_value());
+                        schedule_bytecode_cache_generation(move(source_code_for_cache), JS::RustIntegration::ProgramType::Script, 1, bytecode_cache_context.release_value(), move(install_target), source_hash.release_value());
+                    }
+                });
+        };
+
+        // Warm-cache fast path: as in fetch_classic_script(), materialize the worker script straight from a validated
+        // bytecode cache sidecar when one arrived with the response.
+        if (bytecode.has_value()) {
+            auto decoder = TextCodec::decoder_for("UTF-8"sv);
+            VERIFY(decoder.has_value());
+            auto source_length = TextCodec::convert_input_to_utf16_length_using_given_decoder_unless_there_is_a_byte_order_mark(*decoder, StringView { source_byte_storage.bytes() }).release_value_but_fixme_should_propagate_errors();
+            prepare_bytecode_cache_off_thread(*bytecode, JS::RustIntegration::ProgramType::Script, source_length, *source_hash,
+                [response_url = move(response_url), source_byte_storage = move(source_byte_storage), source_length,
+                    settings_root = GC::make_root(settings_object), on_complete_root = GC::make_root(on_complete),
+                    create_script = move(create_script)](auto bytecode_cache) mutable {
+                    if (bytecode_cache) {
+                        auto response_url_string = response_url.to_byte_string();
+                        auto source_code = JS::SourceCode::create(utf16_string_from_url_ascii(response_url_string.view()), source_length, "UTF-8"sv, source_byte_storage);
+                        auto script = ClassicScript::create_from_bytecode_cache(move(response_url_string), move(source_code), *settings_root, move(response_url), bytecode_cache.release_nonnull());
+                        if (script->parse_error().is_null()) {
+                            on_complete_root->function()(script);
+                            return;
+                        }
+                    }
+                    create_script();
+                });
+            return;
+        }
 
-        // 6. Run onComplete given script.
-        on_complete->function()(script);
+        create_script();
     };
 
     // 2. If performFetch was given, run performFetch with request, true, and with processResponseConsumeBody as defined below.
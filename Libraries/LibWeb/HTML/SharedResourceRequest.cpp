@@ -12,6 +12,7 @@
 #include <LibWeb/Fetch/Fetching/Fetching.h>
 #include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
 #include <LibWeb/Fetch/Infrastructure/FetchController.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/MIME.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
@@ -62,6 +63,7 @@ void SharedResourceRequest::finalize()
     m_callbacks.clear();
     m_load_event_delayer.clear();
     m_image_data = nullptr;
+    m_partial_image_data = nullptr;
     m_fetch_controller = nullptr;
 
     if (m_document) {
@@ -82,8 +84,10 @@ void SharedResourceRequest::visit_edges(JS::Cell::Visitor& visitor)
     for (auto& callback : m_callbacks) {
         visitor.visit(callback.on_finish);
         visitor.visit(callback.on_fail);
+        visitor.visit(callback.on_partial_image);
     }
     visitor.visit(m_image_data);
+    visitor.visit(m_partial_image_data);
 }
 
 GC::Ptr<DecodedImageData> SharedResourceRequest::image_data() const
@@ -136,16 +140,29 @@ void SharedResourceRequest::fetch_resource(JS::Realm& realm, GC::Ref<Fetch::Infr
         //        https://github.com/whatwg/html/issues/9355
         response = response->unsafe_response();
 
-        auto process_body = GC::create_function(self->heap(), [weak_this, request, response, image_data_is_cors_cross_origin](ByteBuffer data) {
+        // Check for failed fetch response
+        if (!Fetch::Infrastructure::is_ok_status(response->status()) || !response->body()) {
+            self->handle_failed_fetch();
+            return;
+        }
+
+        auto extracted_mime_type = Fetch::Infrastructure::extract_mime_type(response->header_list());
+        auto const is_svg_image = extracted_mime_type.has_value()
+            ? extracted_mime_type.value().essence() == "image/svg+xml"sv
+            : request->url().basename().ends_with(".svg"sv);
+
+        // Bitmap images are decoded as their data arrives, so that they can be shown before they finish downloading.
+        if (!is_svg_image) {
+            self->decode_bitmap_image_incrementally(*response->body(), image_data_is_cors_cross_origin);
+            return;
+        }
+
+        auto process_body = GC::create_function(self->heap(), [weak_this, request, image_data_is_cors_cross_origin](ByteBuffer data) {
             auto self = weak_this.ptr();
             if (!self)
                 return;
 
-            auto extracted_mime_type = Fetch::Infrastructure::extract_mime_type(response->header_list());
-            auto const is_svg_image = extracted_mime_type.has_value()
-                ? extracted_mime_type.value().essence() == "image/svg+xml"sv
-                : request->url().basename().ends_with(".svg"sv);
-            self->handle_successful_fetch(request->url(), is_svg_image ? IsSVGImage::Yes : IsSVGImage::No, move(data), image_data_is_cors_cross_origin);
+            self->handle_successful_svg_fetch(request->url(), move(data), image_data_is_cors_cross_origin);
         });
         auto process_body_error = GC::create_function(self->heap(), [weak_this](JS::Value) {
             auto self = weak_this.ptr();
@@ -155,12 +172,6 @@ void SharedResourceRequest::fetch_resource(JS::Realm& realm, GC::Ref<Fetch::Infr
             self->handle_failed_fetch();
         });
 
-        // Check for failed fetch response
-        if (!Fetch::Infrastructure::is_ok_status(response->status()) || !response->body()) {
-            self->handle_failed_fetch();
-            return;
-        }
-
         response->body()->fully_read(realm, process_body, process_body_error, GC::Ref { realm.global_object() });
     };
 
@@ -175,7 +186,7 @@ void SharedResourceRequest::fetch_resource(JS::Realm& realm, GC::Ref<Fetch::Infr
     set_fetch_controller(fetch_controller);
 }
 
-void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<void()> on_fail)
+void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<void()> on_fail, Function<void()> on_partial_image)
 {
     if (m_state == State::Finished) {
         if (on_finish)
@@ -194,69 +205,131 @@ void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<v
         callbacks.on_finish = GC::create_function(vm().heap(), move(on_finish));
     if (on_fail)
         callbacks.on_fail = GC::create_function(vm().heap(), move(on_fail));
+    if (on_partial_image)
+        callbacks.on_partial_image = GC::create_function(vm().heap(), move(on_partial_image));
 
     m_callbacks.append(move(callbacks));
 }
 
-void SharedResourceRequest::handle_successful_fetch(URL::URL const& url_string, IsSVGImage is_svg_image, ByteBuffer data, bool image_data_is_cors_cross_origin)
+void SharedResourceRequest::decode_bitmap_image_incrementally(Fetch::Infrastructure::Body& body, bool image_data_is_cors_cross_origin)
 {
-    // AD-HOC: At this point, things gets very ad-hoc.
-    // FIXME: Bring this closer to spec.
+    auto& image_codec_plugin = Platform::ImageCodecPlugin::the();
+    auto decode_id = image_codec_plugin.begin_incremental_decode(
+        [strong_this = GC::Root(*this), image_data_is_cors_cross_origin](Platform::PartialImage& image) {
+            strong_this->handle_partial_bitmap_decode(image, image_data_is_cors_cross_origin);
+        },
+        [strong_this = GC::Root(*this), image_data_is_cors_cross_origin](Platform::DecodedImage& result) -> ErrorOr<void> {
+            return strong_this->handle_successful_bitmap_decode(result, image_data_is_cors_cross_origin);
+        },
+        [strong_this = GC::Root(*this)](Error&) {
+            strong_this->handle_failed_fetch();
+        });
+    m_incremental_decode_id = decode_id;
 
-    if (is_svg_image == IsSVGImage::Yes) {
-        auto result = SVG::SVGDecodedImageData::create(m_document->realm(), m_page, url_string, data);
-        if (result.is_error()) {
-            handle_failed_fetch();
-        } else {
-            m_image_data = result.release_value();
-            m_image_data->set_is_cors_cross_origin(image_data_is_cors_cross_origin);
-            handle_successful_resource_load();
-        }
+    GC::Weak weak_this { *this };
+    auto process_body_chunk = GC::create_function(heap(), [weak_this, decode_id](ByteBuffer bytes) {
+        Platform::ImageCodecPlugin::the().append_incremental_decode_data(decode_id, bytes);
+
+        if (auto self = weak_this.ptr(); self && self->m_encoded_bitmap_data.try_append(bytes).is_error())
+            self->m_encoded_bitmap_data.clear();
+    });
+    auto process_end_of_body = GC::create_function(heap(), [decode_id] {
+        Platform::ImageCodecPlugin::the().finish_incremental_decode(decode_id);
+    });
+    auto process_body_error = GC::create_function(heap(), [weak_this, decode_id](JS::Value) {
+        Platform::ImageCodecPlugin::the().cancel_incremental_decode(decode_id);
+
+        auto self = weak_this.ptr();
+        if (!self)
+            return;
+
+        self->handle_failed_fetch();
+    });
+
+    body.incrementally_read(process_body_chunk, process_end_of_body, process_body_error, GC::Ref { m_document->realm().global_object() });
+}
+
+void SharedResourceRequest::set_decode_is_visible(bool is_visible)
+{
+    if (!m_incremental_decode_id.has_value() || m_decode_is_visible == is_visible)
         return;
+    m_decode_is_visible = is_visible;
+    Platform::ImageCodecPlugin::the().set_incremental_decode_is_visible(*m_incremental_decode_id, is_visible);
+}
+
+void SharedResourceRequest::handle_successful_svg_fetch(URL::URL const& url_string, ByteBuffer data, bool image_data_is_cors_cross_origin)
+{
+    auto result = SVG::SVGDecodedImageData::create(m_document->realm(), m_page, url_string, data);
+    if (result.is_error()) {
+        handle_failed_fetch();
+    } else {
+        m_image_data = result.release_value();
+        m_image_data->set_is_cors_cross_origin(image_data_is_cors_cross_origin);
+        handle_successful_resource_load();
     }
+}
 
-    auto handle_successful_bitmap_decode = [strong_this = GC::Root(*this), image_data_is_cors_cross_origin](Web::Platform::DecodedImage& result) -> ErrorOr<void> {
-        if (result.session_id != 0) {
-            // Streaming animated decode: create AnimatedBitmapDecodedImageData.
-            Vector<NonnullRefPtr<Gfx::Bitmap>> initial_bitmaps;
-            initial_bitmaps.ensure_capacity(result.frames.size());
-            for (auto& frame : result.frames)
-                initial_bitmaps.unchecked_append(*frame.bitmap);
-
-            auto first_bitmap = result.frames.first().bitmap;
-            auto size = first_bitmap->size();
-
-            strong_this->m_image_data = AnimatedBitmapDecodedImageData::create(
-                strong_this->m_document->realm(),
-                *strong_this->m_document,
-                result.session_id,
-                result.frame_count,
-                result.loop_count,
-                size,
-                move(result.color_space),
-                move(result.all_durations),
-                move(initial_bitmaps));
-        } else {
-            // Non animated decode: create a single framed BitmapDecodedImageData.
-            VERIFY(result.frames.size() == 1);
-
-            strong_this->m_image_data = BitmapDecodedImageData::create(strong_this->m_document->realm(), { *result.frames[0].bitmap, result.color_space });
-        }
-        strong_this->m_image_data->set_is_cors_cross_origin(image_data_is_cors_cross_origin);
-        strong_this->handle_successful_resource_load();
-        return {};
-    };
+void SharedResourceRequest::handle_partial_bitmap_decode(Platform::PartialImage& image, bool image_data_is_cors_cross_origin)
+{
+    if (m_state != State::Fetching || !image.bitmap)
+        return;
 
-    auto handle_failed_decode = [strong_this = GC::Root(*this)](Error&) -> void {
-        strong_this->handle_failed_fetch();
-    };
+    m_partial_image_data = BitmapDecodedImageData::create(m_document->realm(), { *image.bitmap, move(image.color_space) });
+    m_partial_image_data->set_is_cors_cross_origin(image_data_is_cors_cross_origin);
+
+    for (auto& callback : m_callbacks) {
+        if (callback.on_partial_image)
+            callback.on_partial_image->function()();
+    }
+}
+
+ErrorOr<void> SharedResourceRequest::handle_successful_bitmap_decode(Platform::DecodedImage& result, bool image_data_is_cors_cross_origin)
+{
+    // AD-HOC: At this point, things gets very ad-hoc.
+    // FIXME: Bring this closer to spec.
 
-    (void)Web::Platform::ImageCodecPlugin::the().decode_image(data.bytes(), move(handle_successful_bitmap_decode), move(handle_failed_decode));
+    if (result.session_id != 0) {
+        // Streaming animated decode: create AnimatedBitmapDecodedImageData.
+        Vector<NonnullRefPtr<Gfx::Bitmap>> initial_bitmaps;
+        initial_bitmaps.ensure_capacity(result.frames.size());
+        for (auto& frame : result.frames)
+            initial_bitmaps.unchecked_append(*frame.bitmap);
+
+        auto first_bitmap = result.frames.first().bitmap;
+        auto size = first_bitmap->size();
+
+        m_image_data = AnimatedBitmapDecodedImageData::create(
+            m_document->realm(),
+            *m_document,
+            result.session_id,
+            result.frame_count,
+            result.loop_count,
+            size,
+            move(result.color_space),
+            move(result.all_durations),
+            move(initial_bitmaps));
+    } else {
+        // Non animated decode: create a single framed BitmapDecodedImageData.
+        VERIFY(result.frames.size() == 1);
+
+        // Decoded bitmaps of small images aren't worth the trouble of decoding them again at another size.
+        static constexpr size_t minimum_redecodable_bitmap_size = 256 * KiB;
+        auto& bitmap = *result.frames[0].bitmap;
+        auto encoded_data = bitmap.data_size() >= minimum_redecodable_bitmap_size ? move(m_encoded_bitmap_data) : ByteBuffer {};
+        m_image_data = BitmapDecodedImageData::create(m_document->realm(), { bitmap, result.color_space }, move(encoded_data));
+    }
+    m_encoded_bitmap_data.clear();
+    m_image_data->set_is_cors_cross_origin(image_data_is_cors_cross_origin);
+    handle_successful_resource_load();
+    return {};
 }
 
 void SharedResourceRequest::handle_failed_fetch()
 {
     m_state = State::Failed;
+    m_incremental_decode_id.clear();
+    m_partial_image_data = nullptr;
+    m_encoded_bitmap_data.clear();
     m_load_event_delayer.clear();
     m_fetch_controller = nullptr;
     for (auto& callback : m_callbacks) {
@@ -269,6 +342,8 @@ void SharedResourceRequest::handle_failed_fetch()
 void SharedResourceRequest::handle_successful_resource_load()
 {
     m_state = State::Finished;
+    m_incremental_decode_id.clear();
+    m_partial_image_data = nullptr;
     m_load_event_delayer.clear();
     m_fetch_controller = nullptr;
     for (auto& callback : m_callbacks) {
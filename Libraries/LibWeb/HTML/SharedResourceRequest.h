@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
 #include <LibGC/Function.h>
 #include <LibGC/Ptr.h>
 #include <LibJS/Heap/Cell.h>
@@ -29,6 +30,9 @@ public:
     URL::URL const& url() const { return m_url; }
 
     [[nodiscard]] GC::Ptr<DecodedImageData> image_data() const;
+
+    // What has been decoded of a bitmap image so far, while the rest of it is still being fetched.
+    [[nodiscard]] GC::Ptr<DecodedImageData> partial_image_data() const { return m_partial_image_data; }
     [[nodiscard]] bool can_be_pruned_from_memory_cache() const;
     [[nodiscard]] u64 cache_touch_serial() const { return m_cache_touch_serial; }
     void touch_memory_cache_entry();
@@ -38,23 +42,27 @@ public:
 
     void fetch_resource(JS::Realm&, GC::Ref<Fetch::Infrastructure::Request>);
 
-    void add_callbacks(Function<void()> on_finish, Function<void()> on_fail);
+    void add_callbacks(Function<void()> on_finish, Function<void()> on_fail, Function<void()> on_partial_image = {});
 
     bool is_fetching() const;
     bool needs_fetching() const;
 
+    // Whether the image decoder is still working on this request's bitmap as its data arrives.
+    [[nodiscard]] bool has_bitmap_decode_in_flight() const { return m_incremental_decode_id.has_value(); }
+
+    // Lets the image decoder put off decoding this image while it is far from the viewport.
+    void set_decode_is_visible(bool);
+
 private:
     explicit SharedResourceRequest(GC::Ref<Page>, URL::URL, GC::Ref<DOM::Document>);
 
     virtual void finalize() override;
     virtual void visit_edges(JS::Cell::Visitor&) override;
 
-    enum class IsSVGImage {
-        No,
-        Yes,
-    };
-
-    void handle_successful_fetch(URL::URL const&, IsSVGImage, ByteBuffer data, bool image_data_is_cors_cross_origin);
+    void decode_bitmap_image_incrementally(Fetch::Infrastructure::Body&, bool image_data_is_cors_cross_origin);
+    void handle_successful_svg_fetch(URL::URL const&, ByteBuffer data, bool image_data_is_cors_cross_origin);
+    void handle_partial_bitmap_decode(Platform::PartialImage&, bool image_data_is_cors_cross_origin);
+    ErrorOr<void> handle_successful_bitmap_decode(Platform::DecodedImage&, bool image_data_is_cors_cross_origin);
     void handle_failed_fetch();
     void handle_successful_resource_load();
 
@@ -72,11 +80,19 @@ private:
     struct Callbacks {
         GC::Ptr<GC::Function<void()>> on_finish;
         GC::Ptr<GC::Function<void()>> on_fail;
+        GC::Ptr<GC::Function<void()>> on_partial_image;
     };
     Vector<Callbacks> m_callbacks;
 
     URL::URL m_url;
     GC::Ptr<DecodedImageData> m_image_data;
+    GC::Ptr<DecodedImageData> m_partial_image_data;
+
+    // The encoded data of a bitmap image as it arrives, kept so that the image can be decoded again at another size.
+    ByteBuffer m_encoded_bitmap_data;
+
+    Optional<i64> m_incremental_decode_id;
+    bool m_decode_is_visible { true };
     GC::Ptr<Fetch::Infrastructure::FetchController> m_fetch_controller;
     u64 m_cache_touch_serial { 0 };
 
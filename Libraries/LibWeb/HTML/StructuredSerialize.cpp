@@ -17,6 +17,7 @@
 #include <AK/String.h>
 #include <AK/UnicodeUtils.h>
 #include <LibCrypto/BigInt/SignedBigInteger.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibCrypto/BigInt/UnsignedBigInteger.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/Color.h>
@@ -808,6 +809,24 @@ void StructuredSerializeWriter::append(IPCSerializationRecord&& record)
     m_encoder->append(move(record));
 }
 
+void StructuredSerializeWriter::encode_property_key(Utf16String const& key)
+{
+    if (type() == SerializationType::Storage) {
+        encode(key);
+        return;
+    }
+
+    // Zero introduces a new name, anything else refers to the name that was introduced at that position minus one.
+    if (auto id = m_property_key_ids.get(key); id.has_value()) {
+        encode(*id + 1);
+        return;
+    }
+
+    encode(0u);
+    encode(key);
+    m_property_key_ids.set(key, m_property_key_ids.size());
+}
+
 IPCSerializationRecord StructuredSerializeWriter::take_ipc_record()
 {
     return m_encoder->take_ipc_record();
@@ -1020,6 +1039,23 @@ ErrorOr<T> StructuredSerializeReader::decode()
     return value;
 }
 
+ErrorOr<Utf16String> StructuredSerializeReader::decode_property_key()
+{
+    if (type() == SerializationType::Storage)
+        return decode<Utf16String>();
+
+    auto id = TRY(decode<u32>());
+    if (id == 0) {
+        auto key = TRY(decode<Utf16String>());
+        TRY(m_property_keys.try_append(key));
+        return key;
+    }
+
+    if (id > m_property_keys.size())
+        return Error::from_string_literal("Property name refers to a name that was not introduced");
+    return m_property_keys[id - 1];
+}
+
 WebIDL::Exception data_clone_error_from_serialization_error(JS::Realm& realm, AK::Error const& error)
 {
     dbgln_if(STRUCTURED_SERIALIZE_DEBUG, "Rejecting structured serialized data: {}", error);
@@ -1463,7 +1499,7 @@ public:
                         TRY(structured_serialize_internal(m_vm, serialized, input_value, m_for_storage, m_memory));
 
                         // 3. Append { [[Key]]: key, [[Value]]: outputValue } to serialized.[[Properties]].
-                        encode(key.as_string().utf16_string());
+                        serialized.encode_property_key(key.as_string().utf16_string());
                     }
                 }
 
@@ -1887,7 +1923,7 @@ public:
                     if (raw_property_tag == to_underlying(ValueTag::EndObject))
                         break;
                     auto deserialized_value = TRY(deserialize_value(raw_property_tag));
-                    auto key = TRY(decode<Utf16String>());
+                    auto key = TRY(decode_property_key());
 
                     // 2. Let result be ! CreateDataProperty(value, entry.[[Key]], deserializedValue).
                     auto result = object.create_data_property(key, deserialized_value);
@@ -1915,6 +1951,14 @@ private:
         return decode_or_throw_data_clone_error<T>(*m_vm.current_realm(), m_serialized);
     }
 
+    WebIDL::ExceptionOr<Utf16String> decode_property_key()
+    {
+        auto key = m_serialized.decode_property_key();
+        if (key.is_error())
+            return data_clone_error_from_serialization_error(*m_vm.current_realm(), key.release_error());
+        return key.release_value();
+    }
+
     WebIDL::ExceptionOr<size_t> decode_max_byte_length()
     {
         auto value = TRY(decode<u64>());
@@ -1937,6 +1981,45 @@ private:
     DeserializationMemory& m_memory;
 };
 
+// Transferred ArrayBuffers of at least this size are copied straight into shared memory, which the receiving process
+// maps and copies into its own ArrayBuffer. Smaller ones are copied through the message like any other bytes.
+static constexpr size_t min_shared_memory_array_buffer_transfer_size = 256 * KiB;
+
+static WebIDL::ExceptionOr<void> transfer_array_buffer_data(JS::Realm& realm, TransferDataEncoder& data_holder, JS::ArrayBuffer const& array_buffer)
+{
+    auto byte_length = array_buffer.byte_length();
+    auto use_shared_memory = byte_length >= min_shared_memory_array_buffer_transfer_size;
+    TRY(encode_or_throw_data_clone_error(realm, data_holder, use_shared_memory));
+
+    if (!use_shared_memory) {
+        auto buffer_data = MUST(array_buffer.copy_to_byte_buffer());
+        return encode_or_throw_data_clone_error(realm, data_holder, buffer_data);
+    }
+
+    auto shared_memory = Core::AnonymousBuffer::create_with_size(byte_length);
+    if (shared_memory.is_error())
+        return data_clone_error_from_serialization_error(realm, shared_memory.release_error());
+    array_buffer.copy_to(0, { shared_memory.value().data<u8>(), byte_length });
+    return encode_or_throw_data_clone_error(realm, data_holder, shared_memory.value());
+}
+
+static WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> receive_transferred_array_buffer_data(JS::Realm& realm, TransferDataDecoder& decoder)
+{
+    auto use_shared_memory = TRY(decode_or_throw_data_clone_error<bool>(realm, decoder));
+    if (!use_shared_memory) {
+        auto buffer = TRY(decode_or_throw_data_clone_error<ByteBuffer>(realm, decoder));
+        return JS::ArrayBuffer::create(realm, move(buffer));
+    }
+
+    auto shared_memory = TRY(decode_or_throw_data_clone_error<Core::AnonymousBuffer>(realm, decoder));
+    if (!shared_memory.is_valid())
+        return data_clone_error_from_serialization_error(realm, AK::Error::from_string_literal("Transferred ArrayBuffer has no shared memory"));
+
+    auto array_buffer = TRY(JS::ArrayBuffer::create(realm, shared_memory.size()));
+    array_buffer->overwrite(0, shared_memory.data<void>(), shared_memory.size());
+    return array_buffer;
+}
+
 // https://html.spec.whatwg.org/multipage/structured-data.html#structuredserializewithtransfer
 WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer(JS::VM& vm, JS::Value value, ReadonlySpan<GC::Ref<JS::Object>> transfer_list)
 {
@@ -1997,15 +2080,13 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
         // 4. If transferable has an [[ArrayBufferData]] internal slot, then:
         if (array_buffer) {
             // 1. If transferable has an [[ArrayBufferMaxByteLength]] internal slot, then:
-            auto buffer_data = MUST(array_buffer->copy_to_byte_buffer());
-
             if (!array_buffer->is_fixed_length()) {
                 // 1. Set dataHolder.[[Type]] to "ResizableArrayBuffer".
                 MUST(data_holder.encode(TransferType::ResizableArrayBuffer));
 
                 // 2. Set dataHolder.[[ArrayBufferData]] to transferable.[[ArrayBufferData]].
                 // 3. Set dataHolder.[[ArrayBufferByteLength]] to transferable.[[ArrayBufferByteLength]].
-                MUST(data_holder.encode(buffer_data));
+                TRY(transfer_array_buffer_data(*vm.current_realm(), data_holder, *array_buffer));
 
                 // 4. Set dataHolder.[[ArrayBufferMaxByteLength]] to transferable.[[ArrayBufferMaxByteLength]].
                 MUST(data_holder.encode(array_buffer->max_byte_length()));
@@ -2017,7 +2098,7 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
 
                 // 2. Set dataHolder.[[ArrayBufferData]] to transferable.[[ArrayBufferData]].
                 // 3. Set dataHolder.[[ArrayBufferByteLength]] to transferable.[[ArrayBufferByteLength]].
-                MUST(data_holder.encode(buffer_data));
+                TRY(transfer_array_buffer_data(*vm.current_realm(), data_holder, *array_buffer));
             }
 
             // 3. Perform ? DetachArrayBuffer(transferable).
@@ -2161,8 +2242,7 @@ WebIDL::ExceptionOr<JS::Value> structured_deserialize_with_transfer_internal(Tra
     //       [[ArrayBufferData]] is instead just getting transferred into the new ArrayBuffer. This could be true, for example,
     //       when both the source and target realms are in the same process.
     if (type == TransferType::ArrayBuffer) {
-        auto buffer = TRY(decode_or_throw_data_clone_error<ByteBuffer>(target_realm, decoder));
-        value = JS::ArrayBuffer::create(target_realm, move(buffer));
+        value = TRY(receive_transferred_array_buffer_data(target_realm, decoder));
     }
 
     // 3. Otherwise, if transferDataHolder.[[Type]] is "ResizableArrayBuffer", then set value to a new ArrayBuffer object
@@ -2171,10 +2251,9 @@ WebIDL::ExceptionOr<JS::Value> structured_deserialize_with_transfer_internal(Tra
     //     [[ArrayBufferMaxByteLength]] internal slot value is transferDataHolder.[[ArrayBufferMaxByteLength]].
     // NOTE: For the same reason as the previous step, this step is also unlikely to throw an exception.
     else if (type == TransferType::ResizableArrayBuffer) {
-        auto buffer = TRY(decode_or_throw_data_clone_error<ByteBuffer>(target_realm, decoder));
+        auto data = TRY(receive_transferred_array_buffer_data(target_realm, decoder));
         auto max_byte_length = TRY(decode_or_throw_data_clone_error<size_t>(target_realm, decoder));
 
-        auto data = JS::ArrayBuffer::create(target_realm, move(buffer));
         data->set_max_byte_length(max_byte_length);
 
         value = data;
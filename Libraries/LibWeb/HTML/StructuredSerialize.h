@@ -10,6 +10,7 @@
 
 #include <AK/Assertions.h>
 #include <AK/Error.h>
+#include <AK/HashMap.h>
 #include <AK/MemoryStream.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/Span.h>
@@ -96,6 +97,10 @@ public:
 
     void append(IPCSerializationRecord&&);
 
+    // The name of an Object or Array property. Objects in one message tend to share their property names, so IPC
+    // records write each distinct name once and refer back to it afterwards. Storage records always spell names out.
+    void encode_property_key(Utf16String const&);
+
     IPCSerializationRecord take_ipc_record();
     StorageSerializationRecord take_storage_record();
 
@@ -103,6 +108,7 @@ private:
     explicit StructuredSerializeWriter(NonnullOwnPtr<StructuredSerializeDataEncoder>);
 
     NonnullOwnPtr<StructuredSerializeDataEncoder> m_encoder;
+    HashMap<Utf16String, u32> m_property_key_ids;
 };
 
 class WEB_API StructuredSerializeReader {
@@ -118,8 +124,11 @@ public:
     template<typename T>
     ErrorOr<T> decode();
 
+    ErrorOr<Utf16String> decode_property_key();
+
 private:
     NonnullOwnPtr<StructuredSerializeDataDecoder> m_decoder;
+    Vector<Utf16String> m_property_keys;
 };
 
 struct SerializedTransferRecord {
@@ -198,7 +207,7 @@ WebIDL::ExceptionOr<T> decode_or_throw_data_clone_error(JS::Realm& realm, Transf
 }
 
 WEB_API WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer(JS::VM&, JS::Value, ReadonlySpan<GC::Ref<JS::Object>> transfer_list);
-WebIDL::ExceptionOr<DeserializedTransferRecord> structured_deserialize_with_transfer(SerializedTransferRecord&, JS::Realm&);
+WEB_API WebIDL::ExceptionOr<DeserializedTransferRecord> structured_deserialize_with_transfer(SerializedTransferRecord&, JS::Realm&);
 WEB_API WebIDL::ExceptionOr<JS::Value> structured_deserialize_with_transfer_internal(TransferDataDecoder&, JS::Realm&);
 
 }
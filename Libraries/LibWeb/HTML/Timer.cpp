@@ -56,6 +56,11 @@ void Timer::set_callback(Function<void()> callback)
     m_timer->on_timeout = move(callback);
 }
 
+void Timer::set_tolerance(i32 milliseconds)
+{
+    m_timer->set_tolerance(milliseconds);
+}
+
 void Timer::set_interval(i32 milliseconds)
 {
     if (m_timer->interval() != milliseconds)
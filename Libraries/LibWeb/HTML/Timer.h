@@ -36,6 +36,7 @@ public:
 
     void set_callback(Function<void()>);
     void set_interval(i32 milliseconds);
+    void set_tolerance(i32 milliseconds);
 
 private:
     Timer(JS::Object& window, i32 milliseconds, Function<void()> callback, i32 id, Repeating);
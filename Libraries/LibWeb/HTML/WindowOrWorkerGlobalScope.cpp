@@ -23,6 +23,7 @@
 #include <LibWeb/Bindings/PerformanceObserver.h>
 #include <LibWeb/ContentSecurityPolicy/BlockingAlgorithms.h>
 #include <LibWeb/Crypto/Crypto.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/Fetch/FetchMethod.h>
 #include <LibWeb/HTML/CanvasRenderingContext2D.h>
 #include <LibWeb/HTML/DedicatedWorkerGlobalScope.h>
@@ -48,6 +49,7 @@
 #include <LibWeb/IndexedDB/Internal/Algorithms.h>
 #include <LibWeb/Infra/SerializedURL.h>
 #include <LibWeb/Infra/Strings.h>
+#include <LibWeb/LongAnimationFrames/PerformanceLongAnimationFrameTiming.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/PerformanceTimeline/EntryTypes.h>
 #include <LibWeb/PerformanceTimeline/EventNames.h>
@@ -57,6 +59,7 @@
 #include <LibWeb/Platform/ImageCodecPlugin.h>
 #include <LibWeb/ResourceTiming/PerformanceResourceTiming.h>
 #include <LibWeb/SVG/SVGImageElement.h>
+#include <LibWeb/Scheduling/Scheduler.h>
 #include <LibWeb/ServiceWorker/CacheStorage.h>
 #include <LibWeb/TrustedTypes/TrustedTypePolicyFactory.h>
 #include <LibWeb/UserTiming/PerformanceMark.h>
@@ -88,6 +91,7 @@ void WindowOrWorkerGlobalScopeMixin::initialize(JS::Realm&)
 void WindowOrWorkerGlobalScopeMixin::visit_edges(JS::Cell::Visitor& visitor)
 {
     visitor.visit(m_performance);
+    visitor.visit(m_scheduler);
     visitor.visit(m_supported_entry_types_array);
     visitor.visit(m_timers);
     visitor.visit(m_registered_performance_observer_objects);
@@ -557,6 +561,43 @@ void WindowOrWorkerGlobalScopeMixin::clear_interval(i32 id)
     m_timer_nesting_levels.remove(id);
 }
 
+// Timers of a hidden document are aligned to whole seconds, so that a page in a background tab only wakes up for them
+// about once per second.
+static constexpr i32 hidden_document_timer_alignment_ms = 1000;
+
+i32 WindowOrWorkerGlobalScopeMixin::timer_tolerance() const
+{
+    if (auto const* window = as_if<Window>(this_impl()); window && window->associated_document().visibility_state_value() == VisibilityState::Hidden)
+        return hidden_document_timer_alignment_ms;
+    return 0;
+}
+
+void WindowOrWorkerGlobalScopeMixin::update_timer_throttling()
+{
+    auto tolerance = timer_tolerance();
+    for (auto& it : m_timers)
+        it.value->set_tolerance(tolerance);
+}
+
+void WindowOrWorkerGlobalScopeMixin::suspend_timers(ReadonlySpan<i32> handles)
+{
+    for (auto handle : handles) {
+        if (auto timer = m_timers.get(handle); timer.has_value())
+            timer.value()->stop();
+    }
+}
+
+void WindowOrWorkerGlobalScopeMixin::resume_timers(ReadonlySpan<i32> handles)
+{
+    auto tolerance = timer_tolerance();
+    for (auto handle : handles) {
+        if (auto timer = m_timers.get(handle); timer.has_value()) {
+            timer.value()->set_tolerance(tolerance);
+            timer.value()->start();
+        }
+    }
+}
+
 void WindowOrWorkerGlobalScopeMixin::clear_map_of_active_timers()
 {
     for (auto& it : m_timers)
@@ -1170,8 +1211,10 @@ void WindowOrWorkerGlobalScopeMixin::run_steps_after_a_timeout_impl(i32 timeout,
 
     // NB: Don't restart an already-active repeating timer. It's already firing on schedule and
     // restarting it would cause drift (next fire = now + interval instead of previous fire + interval).
-    if (!existing_timer)
+    if (!existing_timer) {
+        timer->set_tolerance(timer_tolerance());
         timer->start();
+    }
 }
 
 // https://w3c.github.io/hr-time/#dom-windoworworkerglobalscope-performance
@@ -1183,6 +1226,16 @@ GC::Ref<HighResolutionTime::Performance> WindowOrWorkerGlobalScopeMixin::perform
     return GC::Ref { *m_performance };
 }
 
+// https://wicg.github.io/scheduling-apis/#dom-windoworworkerglobalscope-scheduler
+GC::Ref<Scheduling::Scheduler> WindowOrWorkerGlobalScopeMixin::scheduler()
+{
+    // The scheduler attribute's getter steps are to return this's scheduler.
+    auto& realm = this_impl().realm();
+    if (!m_scheduler)
+        m_scheduler = Scheduling::Scheduler::create(realm);
+    return GC::Ref { *m_scheduler };
+}
+
 GC::Ref<IndexedDB::IDBFactory> WindowOrWorkerGlobalScopeMixin::indexed_db()
 {
     auto& realm = this_impl().realm();
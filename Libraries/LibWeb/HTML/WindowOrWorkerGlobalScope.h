@@ -50,6 +50,16 @@ public:
     void clear_interval(i32);
     void clear_map_of_active_timers();
 
+    // Applies the throttling of timers in hidden documents to the active timers.
+    void update_timer_throttling();
+
+    // https://html.spec.whatwg.org/multipage/timers-and-user-prompts.html#map-of-active-timers
+    Vector<i32> active_timer_handles() const { return m_timers.keys(); }
+
+    // Stops and restarts the given active timers while their document is kept in the back/forward cache.
+    void suspend_timers(ReadonlySpan<i32> handles);
+    void resume_timers(ReadonlySpan<i32> handles);
+
     enum class CheckIfPerformanceBufferIsFull {
         No,
         Yes,
@@ -91,6 +101,8 @@ public:
 
     [[nodiscard]] GC::Ref<HighResolutionTime::Performance> performance();
 
+    [[nodiscard]] GC::Ref<Scheduling::Scheduler> scheduler();
+
     GC::Ref<JS::Object> supported_entry_types() const;
 
     GC::Ref<IndexedDB::IDBFactory> indexed_db();
@@ -123,6 +135,7 @@ private:
     };
     i32 run_timer_initialization_steps(TimerHandler handler, i32 timeout, GC::RootVector<JS::Value> arguments, Repeat repeat, Optional<i32> previous_id = {});
     void run_steps_after_a_timeout_impl(i32 timeout, Function<void()> completion_step, Optional<i32> timer_key, Repeat repeat = Repeat::No);
+    i32 timer_tolerance() const;
 
     GC::Ref<WebIDL::Promise> create_image_bitmap_impl(ImageBitmapSource& image, Optional<WebIDL::Long> sx, Optional<WebIDL::Long> sy, Optional<WebIDL::Long> sw, Optional<WebIDL::Long> sh, Optional<Bindings::ImageBitmapOptions>& options) const;
 
@@ -154,6 +167,8 @@ private:
 
     GC::Ptr<HighResolutionTime::Performance> m_performance;
 
+    GC::Ptr<Scheduling::Scheduler> m_scheduler;
+
     GC::Ptr<IndexedDB::IDBFactory> m_indexed_db;
 
     mutable GC::Ptr<JS::Object> m_supported_entry_types_array;
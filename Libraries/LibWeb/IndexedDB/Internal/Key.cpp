@@ -5,6 +5,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BitCast.h>
+#include <AK/Utf16StringBuilder.h>
 #include <LibWeb/IndexedDB/Internal/Key.h>
 #include <LibWeb/Infra/ByteSequences.h>
 #include <LibWeb/Infra/Strings.h>
@@ -214,6 +216,187 @@ String Key::dump() const
         });
 }
 
+// The tags of the storage encoding are ordered like compare-two-keys orders key types. The end of an array sorts before
+// every tag, so an array sorts before the longer arrays it is a prefix of.
+enum class StorageTag : u8 {
+    ArrayEnd = 0x00,
+    Number = 0x10,
+    Date = 0x20,
+    String = 0x30,
+    Binary = 0x40,
+    Array = 0x50,
+};
+
+static constexpr u64 double_sign_bit = 1ull << 63;
+
+static void append_sortable_double(ByteBuffer& buffer, double value)
+{
+    // Both zeros are the same key, so they must have the same encoding.
+    if (value == 0)
+        value = 0;
+
+    // Setting the sign bit of positive numbers and flipping every bit of negative numbers makes the big-endian bytes
+    // sort like the numbers do.
+    auto bits = bit_cast<u64>(value);
+    bits = (bits & double_sign_bit) ? ~bits : (bits | double_sign_bit);
+    for (int shift = 56; shift >= 0; shift -= 8)
+        buffer.append(static_cast<u8>(bits >> shift));
+}
+
+// A zero byte ends a string or a byte sequence, so zero bytes inside one are escaped as 00 FF. Nothing that can follow
+// the end sorts after FF, so a sequence still sorts before the longer sequences it is a prefix of.
+static constexpr u8 escaped_zero_byte = 0xff;
+
+static void append_escaped_byte(ByteBuffer& buffer, u8 byte)
+{
+    buffer.append(byte);
+    if (byte == 0)
+        buffer.append(escaped_zero_byte);
+}
+
+static void append_storage_encoding(ByteBuffer& buffer, Key const& key)
+{
+    switch (key.type()) {
+    case Key::KeyType::Invalid:
+        VERIFY_NOT_REACHED();
+    case Key::KeyType::Number:
+        buffer.append(to_underlying(StorageTag::Number));
+        append_sortable_double(buffer, key.value_as_double());
+        break;
+    case Key::KeyType::Date:
+        buffer.append(to_underlying(StorageTag::Date));
+        append_sortable_double(buffer, key.value_as_double());
+        break;
+    case Key::KeyType::String: {
+        // Code units are compared by value, which big-endian bytes preserve.
+        buffer.append(to_underlying(StorageTag::String));
+        auto string = key.value_as_string().utf16_view();
+        for (size_t i = 0; i < string.length_in_code_units(); ++i) {
+            auto code_unit = string.code_unit_at(i);
+            append_escaped_byte(buffer, static_cast<u8>(code_unit >> 8));
+            append_escaped_byte(buffer, static_cast<u8>(code_unit));
+        }
+        buffer.append(0);
+        break;
+    }
+    case Key::KeyType::Binary:
+        buffer.append(to_underlying(StorageTag::Binary));
+        for (auto byte : key.value_as_byte_buffer().bytes())
+            append_escaped_byte(buffer, byte);
+        buffer.append(0);
+        break;
+    case Key::KeyType::Array:
+        buffer.append(to_underlying(StorageTag::Array));
+        for (auto subkey : key.subkeys())
+            append_storage_encoding(buffer, *subkey);
+        buffer.append(to_underlying(StorageTag::ArrayEnd));
+        break;
+    }
+}
+
+ByteBuffer Key::encode_for_storage() const
+{
+    ByteBuffer buffer;
+    append_storage_encoding(buffer, *this);
+    return buffer;
+}
+
+class StorageKeyReader {
+public:
+    StorageKeyReader(JS::Realm& realm, ReadonlyBytes bytes)
+        : m_realm(realm)
+        , m_bytes(bytes)
+    {
+    }
+
+    bool is_at_end() const { return m_offset == m_bytes.size(); }
+
+    ErrorOr<GC::Ref<Key>> read_key()
+    {
+        switch (static_cast<StorageTag>(TRY(read_byte()))) {
+        case StorageTag::Number:
+            return Key::create_number(m_realm, TRY(read_sortable_double()));
+        case StorageTag::Date:
+            return Key::create_date(m_realm, TRY(read_sortable_double()));
+        case StorageTag::String: {
+            auto bytes = TRY(read_escaped_bytes());
+            if (bytes.size() % 2 != 0)
+                return Error::from_string_literal("Stored string key has an odd number of bytes");
+
+            Utf16StringBuilder builder;
+            for (size_t i = 0; i < bytes.size(); i += 2)
+                builder.append_code_unit(static_cast<char16_t>((bytes[i] << 8) | bytes[i + 1]));
+            return Key::create_string(m_realm, builder.to_utf16_string());
+        }
+        case StorageTag::Binary:
+            return Key::create_binary(m_realm, TRY(read_escaped_bytes()));
+        case StorageTag::Array: {
+            auto subkeys = m_realm.heap().allocate<GC::HeapVector<GC::Ref<Key>>>();
+            while (true) {
+                if (m_offset < m_bytes.size() && m_bytes[m_offset] == to_underlying(StorageTag::ArrayEnd)) {
+                    ++m_offset;
+                    break;
+                }
+                subkeys->elements().append(TRY(read_key()));
+            }
+            return Key::create_array(m_realm, GC::make_root(subkeys));
+        }
+        case StorageTag::ArrayEnd:
+            break;
+        }
+        return Error::from_string_literal("Stored key has an unknown tag");
+    }
+
+private:
+    ErrorOr<u8> read_byte()
+    {
+        if (is_at_end())
+            return Error::from_string_literal("Stored key ends unexpectedly");
+        return m_bytes[m_offset++];
+    }
+
+    ErrorOr<double> read_sortable_double()
+    {
+        u64 bits = 0;
+        for (size_t i = 0; i < sizeof(bits); ++i)
+            bits = (bits << 8) | TRY(read_byte());
+
+        bits = (bits & double_sign_bit) ? (bits & ~double_sign_bit) : ~bits;
+        return bit_cast<double>(bits);
+    }
+
+    ErrorOr<ByteBuffer> read_escaped_bytes()
+    {
+        ByteBuffer bytes;
+        while (true) {
+            auto byte = TRY(read_byte());
+            if (byte != 0) {
+                TRY(bytes.try_append(byte));
+                continue;
+            }
+            if (m_offset < m_bytes.size() && m_bytes[m_offset] == escaped_zero_byte) {
+                ++m_offset;
+                TRY(bytes.try_append(0));
+                continue;
+            }
+            return bytes;
+        }
+    }
+
+    JS::Realm& m_realm;
+    ReadonlyBytes m_bytes;
+    size_t m_offset { 0 };
+};
+
+ErrorOr<GC::Ref<Key>> Key::decode_from_storage(JS::Realm& realm, ReadonlyBytes bytes)
+{
+    StorageKeyReader reader { realm, bytes };
+    auto key = TRY(reader.read_key());
+    if (!reader.is_at_end())
+        return Error::from_string_literal("Stored key is followed by trailing data");
+    return key;
+}
+
 void Key::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
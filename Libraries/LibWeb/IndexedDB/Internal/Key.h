@@ -76,6 +76,11 @@ public:
     [[nodiscard]] static bool less_than_or_equal(GC::Ref<Key> a, GC::Ref<Key> b) { return compare_two_keys(a, b) <= 0; }
     [[nodiscard]] static bool greater_than_or_equal(GC::Ref<Key> a, GC::Ref<Key> b) { return compare_two_keys(a, b) >= 0; }
 
+    // Encodes the key into bytes that sort like the key: comparing two encodings byte by byte gives the same result as
+    // comparing the two keys. This lets a storage engine keep records ordered by key without decoding their keys.
+    [[nodiscard]] ByteBuffer encode_for_storage() const;
+    [[nodiscard]] static ErrorOr<GC::Ref<Key>> decode_from_storage(JS::Realm&, ReadonlyBytes);
+
     AK::String dump() const;
 
 private:
@@ -21,10 +21,10 @@ void RequestList::maybe_process_next_request()
     if (m_blocked)
         return;
 
-    while (!m_entries.is_empty() && !m_entries.first().request)
-        m_entries.remove(0);
+    drop_leading_removed_entries();
 
-    for (auto& [request, steps] : m_entries) {
+    for (size_t i = m_head; i < m_entries.size(); ++i) {
+        auto& [request, steps] = m_entries[i];
         if (!request)
             continue;
         if (request->processed())
@@ -49,14 +49,40 @@ void RequestList::on_request_processed()
 
 void RequestList::remove(GC::Ref<IDBRequest> request)
 {
-    m_entries.remove_first_matching([&request](auto const& entry) {
-        return entry.request.ptr() == request.ptr();
-    });
+    // Requests finish in the order they were made, so the one being removed is almost always at the front. Removed
+    // entries are only cleared here, and dropped from the front in bulk, so that transactions with many requests don't
+    // shift every remaining entry each time one finishes.
+    for (size_t i = m_head; i < m_entries.size(); ++i) {
+        auto& entry = m_entries[i];
+        if (entry.request.ptr() == request.ptr()) {
+            entry = {};
+            break;
+        }
+    }
+    drop_leading_removed_entries();
+}
+
+void RequestList::drop_leading_removed_entries()
+{
+    while (m_head < m_entries.size() && !m_entries[m_head].request)
+        m_entries[m_head++] = {};
+
+    if (m_head == m_entries.size()) {
+        m_entries.clear_with_capacity();
+        m_head = 0;
+    } else if (m_head >= 64 && m_head * 2 >= m_entries.size()) {
+        m_entries.remove(0, m_head);
+        m_head = 0;
+    }
 }
 
 bool RequestList::is_empty() const
 {
-    return m_entries.is_empty();
+    for (size_t i = m_head; i < m_entries.size(); ++i) {
+        if (m_entries[i].request)
+            return false;
+    }
+    return true;
 }
 
 void RequestList::set_on_all_processed(GC::Ref<GC::Function<void()>> callback)
@@ -75,10 +101,11 @@ void RequestList::check_all_processed()
     if (!m_on_all_processed)
         return;
 
-    m_entries.remove_all_matching([](auto const& entry) { return !entry.request; });
+    drop_leading_removed_entries();
 
-    for (auto const& entry : m_entries) {
-        if (!entry.request->processed())
+    for (size_t i = m_head; i < m_entries.size(); ++i) {
+        auto const& entry = m_entries[i];
+        if (entry.request && !entry.request->processed())
             return;
     }
 
@@ -42,7 +42,11 @@ private:
         GC::Root<GC::Function<void()>> steps;
     };
 
+    void drop_leading_removed_entries();
+
+    // Entries before m_head have been removed.
     Vector<Entry> m_entries;
+    size_t m_head { 0 };
     GC::Root<GC::Function<void()>> m_on_all_processed;
     bool m_blocked { false };
 
@@ -67,7 +71,7 @@ public:
         size_t m_index;
     };
 
-    RequestIterator begin() const { return { m_entries, 0 }; }
+    RequestIterator begin() const { return { m_entries, m_head }; }
     RequestIterator end() const { return { m_entries, m_entries.size() }; }
 };
 
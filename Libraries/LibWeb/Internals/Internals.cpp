@@ -12,6 +12,7 @@
 #include <LibCore/EventLoop.h>
 #include <LibCore/TimeZone.h>
 #include <LibGfx/Cursor.h>
+#include <LibGfx/Font/Font.h>
 #include <LibHTTP/HSTS/ParsedHSTSPolicy.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Date.h>
@@ -778,6 +779,16 @@ Utf16String Internals::dump_gc_graph()
     return dump_string_to_utf16(Bindings::main_thread_vm().heap().dump_graph().serialized());
 }
 
+WebIDL::UnsignedLongLong Internals::shape_count()
+{
+    return Bindings::main_thread_vm().live_shape_count();
+}
+
+WebIDL::UnsignedLongLong Internals::dictionary_shape_count()
+{
+    return Bindings::main_thread_vm().live_dictionary_shape_count();
+}
+
 Utf16String Internals::dump_session_history()
 {
     auto& document = window().associated_document();
@@ -955,6 +966,31 @@ JS::Object* Internals::get_style_invalidation_counters()
     object->define_direct_property("scopeRuleCacheBuilds"_utf16_fly_string, JS::Value(counters.scope_rule_cache_builds), JS::default_attributes);
     object->define_direct_property("relayoutsPerformed"_utf16_fly_string, JS::Value(counters.relayouts_performed), JS::default_attributes);
     object->define_direct_property("scrollableOverflowRecalculations"_utf16_fly_string, JS::Value(counters.scrollable_overflow_recalculations), JS::default_attributes);
+    object->define_direct_property("intrinsicSizeCacheHits"_utf16_fly_string, JS::Value(counters.intrinsic_size_cache_hits), JS::default_attributes);
+    object->define_direct_property("intrinsicSizeMeasurements"_utf16_fly_string, JS::Value(counters.intrinsic_size_measurements), JS::default_attributes);
+    object->define_direct_property("gridItemContentSizeReuses"_utf16_fly_string, JS::Value(counters.grid_item_content_size_reuses), JS::default_attributes);
+    object->define_direct_property("gridItemContentSizeMeasurements"_utf16_fly_string, JS::Value(counters.grid_item_content_size_measurements), JS::default_attributes);
+    return object;
+}
+
+JS::Object* Internals::get_style_invalidation_reason_counters()
+{
+    auto const& counters = window().associated_document().style_invalidation_counters();
+    auto object = JS::Object::create(realm(), nullptr);
+    for (size_t index = 0; index < DOM::style_invalidation_reason_count; ++index) {
+        auto const& per_reason = counters.per_reason[index];
+        if (per_reason.invalidations == 0 && per_reason.nodes_marked == 0 && per_reason.elements_recomputed == 0)
+            continue;
+        auto reason_object = JS::Object::create(realm(), nullptr);
+        reason_object->define_direct_property("invalidations"_utf16_fly_string, JS::Value(per_reason.invalidations), JS::default_attributes);
+        reason_object->define_direct_property("nodesMarked"_utf16_fly_string, JS::Value(per_reason.nodes_marked), JS::default_attributes);
+        reason_object->define_direct_property("elementsRecomputed"_utf16_fly_string, JS::Value(per_reason.elements_recomputed), JS::default_attributes);
+        reason_object->define_direct_property("elementsChanged"_utf16_fly_string, JS::Value(per_reason.elements_changed), JS::default_attributes);
+        object->define_direct_property(
+            Utf16FlyString::from_utf8(DOM::to_string(static_cast<DOM::StyleInvalidationReason>(index))),
+            reason_object,
+            JS::default_attributes);
+    }
     return object;
 }
 
@@ -1020,6 +1056,16 @@ JS::Object* Internals::computed_values_stats()
     return object;
 }
 
+JS::Object* Internals::shaping_cache_stats()
+{
+    auto const& statistics = Gfx::Font::ShapingCache::statistics();
+    auto object = JS::Object::create(realm(), nullptr);
+    object->define_direct_property("shapingCacheHits"_utf16_fly_string, JS::Value(statistics.hits), JS::default_attributes);
+    object->define_direct_property("shapingCacheMisses"_utf16_fly_string, JS::Value(statistics.misses), JS::default_attributes);
+    object->define_direct_property("shapingCacheSizeInBytes"_utf16_fly_string, JS::Value(statistics.size_in_bytes), JS::default_attributes);
+    return object;
+}
+
 void Internals::update_style()
 {
     window().associated_document().update_style();
@@ -1165,10 +1211,25 @@ JS::Object* Internals::async_scrolling_state()
         MUST(sticky_areas->create_data_property_or_throw(i, area));
     }
 
+    auto scroll_timeline_opacity_animations = MUST(JS::Array::create(realm(), state.scroll_timeline_opacity_animations.size()));
+    for (size_t i = 0; i < state.scroll_timeline_opacity_animations.size(); ++i) {
+        auto const& scroll_timeline_animation = state.scroll_timeline_opacity_animations[i];
+        auto animation = JS::Object::create(realm(), nullptr);
+        animation->define_direct_property("sourceScrollNodeIndex"_utf16_fly_string, JS::Value(scroll_timeline_animation.source_node_id.scroll_node_index.value()), JS::default_attributes);
+        animation->define_direct_property("effectsNodeIndex"_utf16_fly_string, JS::Value(scroll_timeline_animation.effects_node_index.value()), JS::default_attributes);
+        animation->define_direct_property("maxScrollOffset"_utf16_fly_string, JS::Value(scroll_timeline_animation.max_scroll_offset), JS::default_attributes);
+        animation->define_direct_property("fromOpacity"_utf16_fly_string, JS::Value(scroll_timeline_animation.from_opacity), JS::default_attributes);
+        animation->define_direct_property("toOpacity"_utf16_fly_string, JS::Value(scroll_timeline_animation.to_opacity), JS::default_attributes);
+        animation->define_direct_property("vertical"_utf16_fly_string, JS::Value(scroll_timeline_animation.vertical), JS::default_attributes);
+        animation->define_direct_property("fillsForwards"_utf16_fly_string, JS::Value(scroll_timeline_animation.fills_forwards), JS::default_attributes);
+        MUST(scroll_timeline_opacity_animations->create_data_property_or_throw(i, animation));
+    }
+
     object->define_direct_property("scrollNodeCount"_utf16_fly_string, JS::Value(state.scroll_nodes.size()), JS::default_attributes);
     object->define_direct_property("scrollNodes"_utf16_fly_string, scroll_nodes, JS::default_attributes);
     object->define_direct_property("stickyAreaCount"_utf16_fly_string, JS::Value(state.sticky_areas.size()), JS::default_attributes);
     object->define_direct_property("stickyAreas"_utf16_fly_string, sticky_areas, JS::default_attributes);
+    object->define_direct_property("scrollTimelineOpacityAnimations"_utf16_fly_string, scroll_timeline_opacity_animations, JS::default_attributes);
     object->define_direct_property("hasBlockingWheelEventListeners"_utf16_fly_string, JS::Value(state.has_blocking_wheel_event_listeners), JS::default_attributes);
     object->define_direct_property("blockingWheelEventRegionCount"_utf16_fly_string, JS::Value(state.blocking_wheel_event_regions.size()), JS::default_attributes);
     object->define_direct_property("mainThreadWheelEventRegionCount"_utf16_fly_string, JS::Value(state.main_thread_wheel_event_regions.size()), JS::default_attributes);
@@ -125,6 +125,8 @@ public:
     Utf16String dump_paintable_tree(GC::Ref<DOM::Node>);
     Utf16String dump_stacking_context_tree();
     Utf16String dump_gc_graph();
+    WebIDL::UnsignedLongLong shape_count();
+    WebIDL::UnsignedLongLong dictionary_shape_count();
     Utf16String dump_session_history();
     Utf16String dump_ui_process_session_history();
     Utf16String dump_site_isolation_process_tree();
@@ -147,9 +149,11 @@ public:
     void set_geolocation_emulated_position(double latitude, double longitude, double accuracy);
 
     JS::Object* get_style_invalidation_counters();
+    JS::Object* get_style_invalidation_reason_counters();
     void reset_style_invalidation_counters();
     JS::Object* layout_tree_build_stats();
     JS::Object* computed_values_stats();
+    JS::Object* shaping_cache_stats();
     JS::Object* style_ffi_counters();
     void reset_style_ffi_counters();
     JS::Object* style_group_sharing_info(DOM::Element&);
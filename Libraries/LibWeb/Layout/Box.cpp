@@ -58,16 +58,29 @@ bool Box::is_partial_relayout_boundary(RequireExistingPaintable require_existing
     if (is_svg_svg_box() && !is_absolutely_positioned())
         return is_outermost_svg_root;
 
-    if (!is_absolutely_positioned())
-        return false;
     if (is_anonymous())
         return false;
     if (require_existing_paintable == RequireExistingPaintable::Yes && !paintable_box())
         return false;
     if (dom_node() == document().document_element())
         return false;
-    if (!saved_abspos_layout_inputs())
+
+    // https://drafts.csswg.org/css-contain-2/#containment-size
+    // https://drafts.csswg.org/css-contain-2/#containment-layout
+    // An in-flow box with both size and layout containment is sized without regard to its
+    // contents, which are laid out in an independent formatting context that also contains
+    // their positioned descendants, so like an SVG root its size and position from the previous
+    // layout can be reused. Its exported baselines still derive from its contents; partial
+    // relayout hands the ancestors to the next layout pass when those move.
+    //
+    // So are text controls (see is_sized_independently_of_contents()), which keeps typing into
+    // one from relaying out the rest of the document.
+    if (!is_absolutely_positioned()) {
+        if (!is_sized_independently_of_contents() && (!has_size_containment() || !has_layout_containment()))
+            return false;
+    } else if (!saved_abspos_layout_inputs()) {
         return false;
+    }
 
     // Only a full layout pass resolves anchor() functions in the inset properties to plain
     // values; a replay from saved inputs cannot.
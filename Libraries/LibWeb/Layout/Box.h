@@ -67,6 +67,11 @@ public:
     CSS::SizeWithAspectRatio auto_content_box_size() const;
     virtual bool has_auto_content_box_size() const { return false; }
 
+    // Form controls whose used size comes from their attributes and style alone, never from their contents, which are
+    // laid out in the control's own formatting context. For partial relayout, these act as if they had size and
+    // layout containment.
+    virtual bool is_sized_independently_of_contents() const { return false; }
+
     // https://www.w3.org/TR/css-sizing-4/#preferred-aspect-ratio
     Optional<CSSPixelFraction> preferred_aspect_ratio() const;
     bool has_preferred_aspect_ratio() const { return preferred_aspect_ratio().has_value(); }
@@ -84,6 +89,16 @@ public:
     void set_saved_abspos_layout_inputs(AbsposLayoutInputs const&);
     void clear_saved_abspos_layout_inputs();
 
+    // The baselines this box exported the last time a committing layout pass laid it out. An
+    // in-flow partial relayout boundary keeps its size and position, but not necessarily these.
+    Optional<CSSPixels> const& committed_first_baseline() const { return m_committed_first_baseline; }
+    Optional<CSSPixels> const& committed_last_baseline() const { return m_committed_last_baseline; }
+    void set_committed_baselines(Optional<CSSPixels> first_baseline, Optional<CSSPixels> last_baseline)
+    {
+        m_committed_first_baseline = first_baseline;
+        m_committed_last_baseline = last_baseline;
+    }
+
     // Whether an absolutely or fixed positioned descendant of this box has its containing
     // block outside this box's subtree, so the descendant's layout escapes the subtree.
     // Re-derived whenever containing block pointers are recomputed.
@@ -118,6 +133,9 @@ private:
 
     OwnPtr<AbsposLayoutInputs> m_saved_abspos_layout_inputs;
 
+    Optional<CSSPixels> m_committed_first_baseline;
+    Optional<CSSPixels> m_committed_last_baseline;
+
     WeakPtr<Node> m_default_scroll_shift_anchor;
     bool m_compensates_for_horizontal_scroll { false };
     bool m_compensates_for_vertical_scroll { false };
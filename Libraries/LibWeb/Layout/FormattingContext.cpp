@@ -2851,8 +2851,12 @@ CSSPixels FormattingContext::calculate_min_content_inline_size(Layout::Box const
 
     auto cache_key = intrinsic_size_cache_key(containing_block_constraints);
     auto& cache = box.cached_intrinsic_sizes().min_content_inline_size;
-    if (auto cached_value = cache.get(cache_key); cached_value.has_value())
+    auto& counters = box.document().style_invalidation_counters();
+    if (auto cached_value = cache.get(cache_key); cached_value.has_value()) {
+        counters.intrinsic_size_cache_hits++;
         return cached_value.value();
+    }
+    counters.intrinsic_size_measurements++;
 
     LayoutState throwaway_state(box, LayoutState::Purpose::Measurement);
 
@@ -3026,8 +3030,12 @@ CSSPixels FormattingContext::calculate_max_content_inline_size(Layout::Box const
 
     auto cache_key = intrinsic_size_cache_key(containing_block_constraints);
     auto& cache = box.cached_intrinsic_sizes().max_content_inline_size;
-    if (auto cached_value = cache.get(cache_key); cached_value.has_value())
+    auto& counters = box.document().style_invalidation_counters();
+    if (auto cached_value = cache.get(cache_key); cached_value.has_value()) {
+        counters.intrinsic_size_cache_hits++;
         return cached_value.value();
+    }
+    counters.intrinsic_size_measurements++;
 
     LayoutState throwaway_state(box, LayoutState::Purpose::Measurement);
 
@@ -3070,8 +3078,12 @@ CSSPixels FormattingContext::calculate_min_content_block_size(Layout::Box const&
     auto cache_key = intrinsic_size_cache_key(containing_block_constraints);
     cache_key.measured_at_inline_size = inline_size;
     auto& cache = box.cached_intrinsic_sizes().min_content_block_size;
-    if (auto cached_value = cache.get(cache_key); cached_value.has_value())
+    auto& counters = box.document().style_invalidation_counters();
+    if (auto cached_value = cache.get(cache_key); cached_value.has_value()) {
+        counters.intrinsic_size_cache_hits++;
         return cached_value.value();
+    }
+    counters.intrinsic_size_measurements++;
 
     LayoutState throwaway_state(box, LayoutState::Purpose::Measurement);
 
@@ -3107,8 +3119,12 @@ CSSPixels FormattingContext::calculate_max_content_block_size(Layout::Box const&
     auto cache_key = intrinsic_size_cache_key(containing_block_constraints);
     cache_key.measured_at_inline_size = inline_size;
     auto& cache = box.cached_intrinsic_sizes().max_content_block_size;
-    if (auto cached_value = cache.get(cache_key); cached_value.has_value())
+    auto& counters = box.document().style_invalidation_counters();
+    if (auto cached_value = cache.get(cache_key); cached_value.has_value()) {
+        counters.intrinsic_size_cache_hits++;
         return cached_value.value();
+    }
+    counters.intrinsic_size_measurements++;
 
     LayoutState throwaway_state(box, LayoutState::Purpose::Measurement);
 
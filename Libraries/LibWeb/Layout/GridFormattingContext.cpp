@@ -7,6 +7,7 @@
 
 #include <AK/Bitmap.h>
 #include <LibWeb/CSS/StyleValues/KeywordStyleValue.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Node.h>
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/GridFormattingContext.h>
@@ -3512,20 +3513,39 @@ bool GridFormattingContext::should_treat_preferred_size_as_auto_for_intrinsic_co
     return !item.box.is_replaced_box() && item.preferred_size(dimension).contains_percentage();
 }
 
-CSSPixels GridFormattingContext::calculate_min_content_size(GridItem const& item, GridDimension dimension) const
+template<typename Callback>
+static CSSPixels reuse_or_measure_content_size(Optional<GridItem::MeasuredContentSize>& measured, GridItem const& item, GridDimension dimension, ContainingBlockConstraints const& constraints, Callback measure)
 {
-    if (dimension == GridDimension::Column) {
-        return calculate_min_content_inline_size(item.box, container_derived_constraints());
+    auto available_inline_size = dimension == GridDimension::Row ? item.available_space().inline_size.to_px_or_zero() : CSSPixels(0);
+    auto& counters = item.box.document().style_invalidation_counters();
+    if (measured.has_value() && measured->available_inline_size == available_inline_size && measured->constraints == constraints) {
+        counters.grid_item_content_size_reuses++;
+        return measured->size;
     }
-    return calculate_min_content_block_size(item.box, item.available_space().inline_size.to_px_or_zero(), container_derived_constraints());
+    counters.grid_item_content_size_measurements++;
+    auto size = measure(available_inline_size);
+    measured = GridItem::MeasuredContentSize { available_inline_size, constraints, size };
+    return size;
+}
+
+CSSPixels GridFormattingContext::calculate_min_content_size(GridItem const& item, GridDimension dimension) const
+{
+    auto constraints = container_derived_constraints();
+    return reuse_or_measure_content_size(item.measured_min_content_sizes[to_underlying(dimension)], item, dimension, constraints, [&](CSSPixels available_inline_size) {
+        if (dimension == GridDimension::Column)
+            return calculate_min_content_inline_size(item.box, constraints);
+        return calculate_min_content_block_size(item.box, available_inline_size, constraints);
+    });
 }
 
 CSSPixels GridFormattingContext::calculate_max_content_size(GridItem const& item, GridDimension dimension) const
 {
-    if (dimension == GridDimension::Column) {
-        return calculate_max_content_inline_size(item.box, container_derived_constraints());
-    }
-    return calculate_max_content_block_size(item.box, item.available_space().inline_size.to_px_or_zero(), container_derived_constraints());
+    auto constraints = container_derived_constraints();
+    return reuse_or_measure_content_size(item.measured_max_content_sizes[to_underlying(dimension)], item, dimension, constraints, [&](CSSPixels available_inline_size) {
+        if (dimension == GridDimension::Column)
+            return calculate_max_content_inline_size(item.box, constraints);
+        return calculate_max_content_block_size(item.box, available_inline_size, constraints);
+    });
 }
 
 CSSPixels GridFormattingContext::containing_block_size_for_item(GridItem const& item, GridDimension dimension) const
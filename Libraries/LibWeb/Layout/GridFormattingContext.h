@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/Function.h>
 #include <AK/Utf16View.h>
 #include <LibWeb/CSS/Length.h>
@@ -45,6 +46,16 @@ struct GridItem {
         CSSPixels left { 0 };
     } subgrid_extra_margins;
 
+    // Content sizes measured for this item during the current layout, reused across the track sizing iterations
+    // while the inputs they were measured with stay the same. Only row sizes depend on the item's inline size.
+    struct MeasuredContentSize {
+        CSSPixels available_inline_size;
+        ContainingBlockConstraints constraints;
+        CSSPixels size;
+    };
+    mutable Array<Optional<MeasuredContentSize>, 2> measured_min_content_sizes;
+    mutable Array<Optional<MeasuredContentSize>, 2> measured_max_content_sizes;
+
     [[nodiscard]] size_t span(GridDimension dimension) const
     {
         return dimension == GridDimension::Column ? column_span.value() : row_span.value();
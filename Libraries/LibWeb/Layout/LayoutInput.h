@@ -16,6 +16,8 @@ struct ContainingBlockConstraints {
     Optional<CSSPixels> percentage_basis_inline_size;
     Optional<CSSPixels> percentage_basis_block_size;
     Optional<CSSPixels> quirks_mode_percentage_basis_block_size;
+
+    bool operator==(ContainingBlockConstraints const&) const = default;
 };
 
 struct LayoutInput {
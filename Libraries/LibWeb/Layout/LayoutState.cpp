@@ -290,6 +290,7 @@ RefPtr<Painting::Paintable> LayoutState::commit_used_values_to_paintable(UsedVal
             layout_box->set_saved_abspos_layout_inputs(*abspos_layout_inputs);
         else
             layout_box->clear_saved_abspos_layout_inputs();
+        layout_box->set_committed_baselines(used_values.first_baseline, used_values.last_baseline);
     }
 
     auto paintable = reset_and_reuse_or_create_paintable(node);
@@ -366,12 +367,12 @@ RefPtr<Painting::Paintable> LayoutState::commit_used_values_to_paintable(UsedVal
     // inlines are not meaningful; their geometry is assigned from pieces once relative
     // positions are resolved.
     if (node.is_box() && !node.is_fragmented_inline() && !used_values.is_materialized_from_paintable()) {
-        if (used_values.containing_line_box_fragment.has_value()) {
+        if (used_values.containing_line_box_fragment().has_value()) {
             // We know that `node` is an atomic inline because `containing_line_box_fragment` refers to the
             // line box fragment in the parent block container that contains it. The fragment has the final
             // offset for the atomic inline, but line box post-processing may remove fragments after the
             // coordinate was recorded, in which case the content offset stands.
-            auto const& containing_line_box_fragment = used_values.containing_line_box_fragment.value();
+            auto const& containing_line_box_fragment = used_values.containing_line_box_fragment().value();
             auto const& containing_block_used_values = get(*node.containing_block());
             if (containing_line_box_fragment.line_box_index < containing_block_used_values.line_boxes.size()) {
                 auto const& line_box = containing_block_used_values.line_boxes[containing_line_box_fragment.line_box_index];
@@ -20,7 +20,7 @@
 
 namespace Web::Layout {
 
-enum class SizeConstraint {
+enum class SizeConstraint : u8 {
     None,
     MinContent,
     MaxContent,
@@ -199,7 +199,18 @@ struct LayoutState {
         CSSPixels padding_box_inline_size() const { return padding_left + content_inline_size() + padding_right; }
         CSSPixels padding_box_block_size() const { return padding_top + content_block_size() + padding_bottom; }
 
-        Optional<LineBoxFragmentCoordinate> containing_line_box_fragment;
+        // Only atomic inlines and blocks interrupting an inline flow are placed in a line box fragment.
+        void set_containing_line_box_fragment(Optional<LineBoxFragmentCoordinate> coordinate)
+        {
+            if (!coordinate.has_value() && !m_rare)
+                return;
+            ensure_rare_data().containing_line_box_fragment = coordinate;
+        }
+        Optional<LineBoxFragmentCoordinate> const& containing_line_box_fragment() const
+        {
+            static Optional<LineBoxFragmentCoordinate> const empty;
+            return m_rare ? m_rare->containing_line_box_fragment : empty;
+        }
 
         void set_lowest_floating_descendant_bottom_margin_edge(Optional<CSSPixels> bottom_margin_edge) { ensure_rare_data().lowest_floating_descendant_bottom_margin_edge = bottom_margin_edge; }
         Optional<CSSPixels> lowest_floating_descendant_bottom_margin_edge() const
@@ -308,6 +319,7 @@ struct LayoutState {
             AK_ALLOC_WITH_KMALLOC_PARTITION(HeapPartition::Layout);
 
             Optional<CSSPixels> lowest_floating_descendant_bottom_margin_edge;
+            Optional<LineBoxFragmentCoordinate> containing_line_box_fragment;
             Optional<Painting::Paintable::TableCellCoordinates> table_cell_coordinates;
             Optional<Gfx::Path> computed_svg_path;
             OwnPtr<GridLayoutData> grid_layout_data;
@@ -103,16 +103,16 @@ void LineBuilder::append_box(Box const& box, CSSPixels leading_size, CSSPixels t
         box_state.content_inline_size(), box_state.content_block_size(), box_state.border_box_top(), box_state.border_box_bottom());
     m_max_block_size_on_current_line = max(m_max_block_size_on_current_line, box_state.margin_box_block_size());
 
-    box_state.containing_line_box_fragment = {};
+    box_state.set_containing_line_box_fragment({});
 
     // https://drafts.csswg.org/css-display/#atomic-inline
     // Inline-level boxes that are not inline boxes are called atomic inline-level boxes because they
     // participate in their inline formatting context as a single opaque box.
     if (box.is_atomic_inline()) {
-        box_state.containing_line_box_fragment = LineBoxFragmentCoordinate {
+        box_state.set_containing_line_box_fragment(LineBoxFragmentCoordinate {
             .line_box_index = m_containing_block_used_values.line_boxes.size() - 1,
             .fragment_index = line_box.fragments().size() - 1,
-        };
+        });
     }
 }
 
@@ -203,10 +203,10 @@ void LineBuilder::append_block_level_box(Box const& box, CSSPixels block_end, CS
     // The interrupting block also ends the inline flow after itself; any content that follows starts on a fresh line.
     line_box.m_has_forced_break = true;
 
-    box_state.containing_line_box_fragment = LineBoxFragmentCoordinate {
+    box_state.set_containing_line_box_fragment(LineBoxFragmentCoordinate {
         .line_box_index = m_containing_block_used_values.line_boxes.size() - 1,
         .fragment_index = 0,
-    };
+    });
 
     // Static position markers recorded on this line will never go through update_last_line(), so anchor them
     // at the flow position the interrupting block starts at.
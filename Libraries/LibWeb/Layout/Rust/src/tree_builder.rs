@@ -99,7 +99,7 @@ pub struct FfiDomTreeBuilderCallbacks {
 #[repr(C)]
 pub struct FfiDisplayContentsFacts {
     pub rendered_in_top_layer: bool,
-    pub content_visibility_hidden: bool,
+    pub skips_contents: bool,
     pub should_layout_dom_children: bool,
     pub child_needs_layout_tree_update: bool,
     pub dom_children_parent: *mut c_void,
@@ -128,7 +128,7 @@ pub struct FfiFlatTreeRenderFacts {
 #[repr(C)]
 pub struct FfiPrincipalDescendantFacts {
     pub is_element: bool,
-    pub content_visibility_hidden: bool,
+    pub skips_contents: bool,
     pub should_layout_dom_children: bool,
     pub child_needs_layout_tree_update: bool,
     pub layout_node_can_have_children: bool,
@@ -723,7 +723,7 @@ unsafe fn update_layout_tree_for_display_contents(
             }
         }
 
-        if !facts.content_visibility_hidden {
+        if !facts.skips_contents {
             create_pseudo_element(
                 host,
                 state,
@@ -733,7 +733,7 @@ unsafe fn update_layout_tree_for_display_contents(
             );
         }
 
-        if !facts.content_visibility_hidden && (should_create_layout_node || facts.child_needs_layout_tree_update) {
+        if !facts.skips_contents && (should_create_layout_node || facts.child_needs_layout_tree_update) {
             let must_create_children = should_create_layout_node;
             if !facts.shadow_root.is_null() {
                 // SAFETY: The callback table, shadow root, and context remain valid.
@@ -762,7 +762,7 @@ unsafe fn update_layout_tree_for_display_contents(
         }
 
         if !facts.slot_element.is_null() {
-            if !facts.content_visibility_hidden {
+            if !facts.skips_contents {
                 // SAFETY: The callback table, slot element, and context remain valid.
                 unsafe {
                     update_layout_tree_for_assigned_slottables(
@@ -783,7 +783,7 @@ unsafe fn update_layout_tree_for_display_contents(
             }
         }
 
-        if !facts.content_visibility_hidden {
+        if !facts.skips_contents {
             create_pseudo_element(
                 host,
                 state,
@@ -902,7 +902,7 @@ unsafe fn update_principal_node_descendants(
             }
 
             // Add the ::before pseudo-element before walking normal children.
-            if facts.is_element && facts.layout_node_can_have_children && !facts.content_visibility_hidden {
+            if facts.is_element && facts.layout_node_can_have_children && !facts.skips_contents {
                 state.ancestor_stack.push(layout_node);
                 create_pseudo_element(
                     host,
@@ -915,7 +915,7 @@ unsafe fn update_principal_node_descendants(
             }
         }
 
-        if facts.content_visibility_hidden {
+        if facts.skips_contents {
             // SAFETY: The builder and DOM node remain live throughout the call.
             unsafe {
                 (host.callbacks.clear_stale_descendants)(host.callbacks.builder, dom_node);
@@ -925,7 +925,7 @@ unsafe fn update_principal_node_descendants(
         if (should_create_layout_node || facts.child_needs_layout_tree_update)
             && (!facts.shadow_root.is_null() || facts.should_layout_dom_children)
             && facts.layout_node_can_have_children
-            && !facts.content_visibility_hidden
+            && !facts.skips_contents
         {
             state.ancestor_stack.push(layout_node);
 
@@ -1019,7 +1019,7 @@ unsafe fn update_principal_node_descendants(
         }
 
         if !facts.slot_element.is_null() {
-            if !facts.content_visibility_hidden {
+            if !facts.skips_contents {
                 state.ancestor_stack.push(layout_node);
                 // SAFETY: The callback table, slot element, and context remain valid.
                 unsafe {
@@ -1082,7 +1082,7 @@ unsafe fn update_principal_node_descendants(
             }
 
             // Add ::marker and ::after once normal and SVG resource children are complete.
-            if facts.is_element && facts.layout_node_can_have_children && !facts.content_visibility_hidden {
+            if facts.is_element && facts.layout_node_can_have_children && !facts.skips_contents {
                 state.ancestor_stack.push(layout_node);
                 if facts.layout_node_is_list_item_box {
                     create_pseudo_element(
@@ -126,6 +126,20 @@ void TableFormattingContext::compute_constrainedness()
     }
 }
 
+template<>
+bool TableFormattingContext::cell_contributes_to_measures<TableFormattingContext::Row>(TableFormattingContext::Cell const&) const
+{
+    return true;
+}
+
+template<>
+bool TableFormattingContext::cell_contributes_to_measures<TableFormattingContext::Column>(TableFormattingContext::Cell const& cell) const
+{
+    // https://www.w3.org/TR/CSS22/tables.html#fixed-table-layout
+    // In the fixed table layout algorithm [...] cells in subsequent rows do not affect column widths.
+    return cell.row_index == 0 || !use_fixed_mode_layout();
+}
+
 void TableFormattingContext::compute_cell_measures(RowMeasurement row_measurement)
 {
     // Implements https://www.w3.org/TR/css-tables-3/#computing-cell-measures.
@@ -135,6 +149,11 @@ void TableFormattingContext::compute_cell_measures(RowMeasurement row_measuremen
     compute_constrainedness();
 
     for (auto& cell : m_cells) {
+        // OPTIMIZATION: Without row measurement, a cell's measures only feed the column measures, which in fixed mode
+        //               come from the first row alone. This keeps fixed-mode tables linear in their first row.
+        if (row_measurement == RowMeasurement::Skip && !cell_contributes_to_measures<Column>(cell))
+            continue;
+
         auto const& computed_values = cell.box.computed_values();
         CSSPixels padding_block_start = computed_values.padding().top().to_px_or_zero(containing_block_block_size);
         CSSPixels padding_block_end = computed_values.padding().bottom().to_px_or_zero(containing_block_block_size);
@@ -290,7 +309,7 @@ void TableFormattingContext::initialize_table_measures<TableFormattingContext::C
     // https://www.w3.org/TR/css-tables-3/#min-content-width-of-a-column-based-on-cells-of-span-up-to-1
     // https://www.w3.org/TR/css-tables-3/#max-content-width-of-a-column-based-on-cells-of-span-up-to-1
     for (auto& cell : m_cells) {
-        if (cell.column_span == 1 && (cell.row_index == 0 || !use_fixed_mode_layout())) {
+        if (cell.column_span == 1 && cell_contributes_to_measures<Column>(cell)) {
             m_columns[cell.column_index].min_size = max(m_columns[cell.column_index].min_size, cell.outer_min_inline_size);
             m_columns[cell.column_index].max_size = max(m_columns[cell.column_index].max_size, cell.outer_max_inline_size);
         }
@@ -317,7 +336,7 @@ void TableFormattingContext::compute_intrinsic_percentage(size_t max_cell_span)
         // https://www.w3.org/TR/css-tables-3/#intrinsic-percentage-width-of-a-column-based-on-cells-of-span-up-to-n-n--1
         for (auto& cell : m_cells) {
             auto cell_span_value = cell_span<RowOrColumn>(cell);
-            if (cell_span_value != current_span) {
+            if (cell_span_value != current_span || !cell_contributes_to_measures<RowOrColumn>(cell)) {
                 continue;
             }
             auto cell_start_rc_index = cell_index<RowOrColumn>(cell);
@@ -402,7 +421,7 @@ void TableFormattingContext::compute_table_measures()
         cell_max_contributions_by_rc_index.resize(rows_or_columns.size());
         for (auto& cell : m_cells) {
             auto cell_span_value = cell_span<RowOrColumn>(cell);
-            if (cell_span_value == current_span) {
+            if (cell_span_value == current_span && cell_contributes_to_measures<RowOrColumn>(cell)) {
                 // Define the baseline max-content size as the sum of the max-content sizes based on cells of span up to N-1 of all columns that the cell spans.
                 auto cell_start_rc_index = cell_index<RowOrColumn>(cell);
                 auto cell_end_rc_index = cell_start_rc_index + cell_span_value;
@@ -617,7 +636,7 @@ void TableFormattingContext::compute_table_inline_size()
         if (!m_available_space->inline_size.is_intrinsic_sizing_constraint()) {
             for (auto& cell : m_cells) {
                 auto const& cell_inline_size = cell.box.computed_values().width();
-                if (cell_inline_size.is_percentage()) {
+                if (cell_inline_size.is_percentage() && cell_contributes_to_measures<Column>(cell)) {
                     CSSPixels adjusted_used_inline_size = undistributable_space;
                     if (cell_inline_size.percentage().value() != 0)
                         adjusted_used_inline_size += CSSPixels::nearest_value_for(ceil(100 / cell_inline_size.percentage().value() * cell.outer_max_inline_size));
@@ -2017,6 +2036,8 @@ void TableFormattingContext::initialize_intrinsic_percentages_from_cells()
     auto& rows_or_columns = table_rows_or_columns<RowOrColumn>();
 
     for (auto& cell : m_cells) {
+        if (!cell_contributes_to_measures<RowOrColumn>(cell))
+            continue;
         auto cell_span_value = cell_span<RowOrColumn>(cell);
         auto cell_start_rc_index = cell_index<RowOrColumn>(cell);
         auto cell_end_rc_index = cell_start_rc_index + cell_span_value;
@@ -136,6 +136,9 @@ private:
     template<class RowOrColumn>
     static bool cell_has_intrinsic_percentage(Cell const& cell);
 
+    template<class RowOrColumn>
+    bool cell_contributes_to_measures(Cell const& cell) const;
+
     template<class RowOrColumn>
     void initialize_intrinsic_percentages_from_rows_or_columns();
 
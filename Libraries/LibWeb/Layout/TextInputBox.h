@@ -25,6 +25,7 @@ public:
 private:
     virtual CSS::SizeWithAspectRatio compute_auto_content_box_size() const override;
     virtual bool has_auto_content_box_size() const override { return true; }
+    virtual bool is_sized_independently_of_contents() const override { return true; }
 };
 
 }
@@ -151,18 +151,58 @@ ErrorOr<void> ContentBlocker::set_patterns(ReadonlySpan<String> patterns)
 
 ErrorOr<void> ContentBlocker::set_rules_from_bytes(ReadonlyBytes rules_bytes)
 {
+    if (is_compatible_snapshot(rules_bytes)) {
+        bool has_cosmetic_rules = false;
+        auto* engine = ContentBlocking::FFI::rust_content_blocker_deserialize(
+            rules_bytes.data(),
+            rules_bytes.size(),
+            &has_cosmetic_rules);
+        if (!engine)
+            return Error::from_string_literal("Failed to load content blocker snapshot");
+
+        replace_engine(engine, has_cosmetic_rules);
+        return {};
+    }
+
     auto* engine = ContentBlocking::FFI::rust_content_blocker_create(
         rules_bytes.data(),
         rules_bytes.size());
     if (!engine)
         return Error::from_string_literal("Failed to create content blocker");
 
-    auto has_cosmetic_rules = rules_contain_cosmetic_rules(rules_bytes);
+    replace_engine(engine, rules_contain_cosmetic_rules(rules_bytes));
+    return {};
+}
 
+void ContentBlocker::replace_engine(void* engine, bool has_cosmetic_rules)
+{
     ContentBlocking::FFI::rust_content_blocker_free(m_engine);
     m_engine = engine;
     m_has_cosmetic_rules = has_cosmetic_rules;
-    return {};
+    m_filtering_decision_cache.clear();
+}
+
+ErrorOr<ByteBuffer> ContentBlocker::create_snapshot(ReadonlyBytes rules_bytes)
+{
+    auto* engine = ContentBlocking::FFI::rust_content_blocker_create(
+        rules_bytes.data(),
+        rules_bytes.size());
+    if (!engine)
+        return Error::from_string_literal("Failed to create content blocker");
+
+    ScopeGuard free_engine = [&] { ContentBlocking::FFI::rust_content_blocker_free(engine); };
+
+    auto snapshot = ContentBlocking::FFI::rust_content_blocker_serialize(engine, rules_contain_cosmetic_rules(rules_bytes));
+    if (!snapshot.data)
+        return Error::from_string_literal("Failed to serialize content blocker");
+
+    ScopeGuard free_snapshot = [&] { ContentBlocking::FFI::rust_content_blocker_free_string(snapshot.data, snapshot.length); };
+    return ByteBuffer::copy({ snapshot.data, snapshot.length });
+}
+
+bool ContentBlocker::is_compatible_snapshot(ReadonlyBytes bytes)
+{
+    return ContentBlocking::FFI::rust_content_blocker_is_compatible_snapshot(bytes.data(), bytes.size());
 }
 
 bool ContentBlocker::is_filtered(URL::URL const& url) const
@@ -185,10 +225,15 @@ bool ContentBlocker::is_filtered(URL::URL const& url, URL::URL const& source_url
 
     auto url_string = serialized_url_for_matching(url);
     auto normalized_source_url = source_url_for_matching(source_url);
+
+    FilteringDecisionKey key { url_string, normalized_source_url.serialized_host(), resource_type };
+    if (auto decision = m_filtering_decision_cache.get(key); decision.has_value())
+        return *decision;
+
     auto source_url_string = serialized_url_for_matching(normalized_source_url);
     auto request_type = resource_type_to_adblock_request_type(resource_type);
 
-    return ContentBlocking::FFI::rust_content_blocker_matches(
+    auto is_filtered = ContentBlocking::FFI::rust_content_blocker_matches(
         m_engine,
         reinterpret_cast<u8 const*>(url_string.characters()),
         url_string.length(),
@@ -196,6 +241,11 @@ bool ContentBlocker::is_filtered(URL::URL const& url, URL::URL const& source_url
         source_url_string.length(),
         reinterpret_cast<u8 const*>(request_type.characters_without_null_termination()),
         request_type.length());
+
+    if (m_filtering_decision_cache.size() >= MAX_CACHED_FILTERING_DECISIONS)
+        m_filtering_decision_cache.clear();
+    m_filtering_decision_cache.set(move(key), is_filtered);
+    return is_filtered;
 }
 
 Utf16String ContentBlocker::cosmetic_style_sheet_for_url(URL::URL const& url) const
@@ -7,7 +7,10 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
+#include <AK/ByteString.h>
 #include <AK/Error.h>
+#include <AK/HashMap.h>
 #include <AK/Noncopyable.h>
 #include <AK/String.h>
 #include <AK/Utf16FlyString.h>
@@ -49,8 +52,15 @@ public:
     bool is_filtered(URL::URL const&, URL::URL const& source_url, ResourceType) const;
     bool is_filtered(URL::URL const&, URL::URL const& source_url, Optional<Fetch::Infrastructure::Request::Destination> const&, Optional<Fetch::Infrastructure::Request::InitiatorType> const&, Fetch::Infrastructure::Request::Mode) const;
     ErrorOr<void> set_patterns(ReadonlySpan<String>);
+
+    // Accepts either filter lists or a snapshot created from them by create_snapshot().
     ErrorOr<void> set_rules_from_bytes(ReadonlyBytes);
 
+    // Parsing large filter lists is slow, so a snapshot of the parsed engine may be stored and handed to
+    // set_rules_from_bytes() in its place. Snapshots are only compatible with the build that created them.
+    static ErrorOr<ByteBuffer> create_snapshot(ReadonlyBytes rules);
+    static bool is_compatible_snapshot(ReadonlyBytes);
+
     Utf16String cosmetic_style_sheet_for_url(URL::URL const&) const;
     Utf16String cosmetic_style_sheet_for_url(URL::URL const&, ReadonlySpan<Utf16FlyString> classes, ReadonlySpan<Utf16FlyString> ids) const;
     bool has_generic_cosmetic_selectors_for_url(URL::URL const&, ReadonlySpan<Utf16FlyString> classes, ReadonlySpan<Utf16FlyString> ids) const;
@@ -62,6 +72,29 @@ private:
     ContentBlocker();
     ~ContentBlocker();
 
+    void replace_engine(void* engine, bool has_cosmetic_rules);
+
+    // The engine only looks at the host of the source URL, so a decision made for one page applies to every other
+    // page on the same site.
+    struct FilteringDecisionKey {
+        ByteString url;
+        String source_host;
+        ResourceType resource_type { ResourceType::Other };
+
+        bool operator==(FilteringDecisionKey const&) const = default;
+    };
+
+    struct FilteringDecisionKeyTraits : public DefaultTraits<FilteringDecisionKey> {
+        static unsigned hash(FilteringDecisionKey const& key)
+        {
+            auto hash = pair_int_hash(Traits<ByteString>::hash(key.url), Traits<String>::hash(key.source_host));
+            return pair_int_hash(hash, to_underlying(key.resource_type));
+        }
+    };
+
+    static constexpr size_t MAX_CACHED_FILTERING_DECISIONS = 4096;
+    mutable HashMap<FilteringDecisionKey, bool, FilteringDecisionKeyTraits> m_filtering_decision_cache;
+
     bool m_filtering_enabled { true };
     bool m_has_cosmetic_rules { false };
     void* m_engine { nullptr };
@@ -500,6 +500,41 @@ RefPtr<Requests::Request> ResourceLoader::load(LoadRequest& request, GC::Root<On
     return protocol_request;
 }
 
+static RequestServer::RequestPriority network_priority_for_request(LoadRequest const& request)
+{
+    using Priority = Fetch::Infrastructure::Request::Priority;
+    using Destination = Fetch::Infrastructure::Request::Destination;
+
+    switch (request.priority()) {
+    case Priority::High:
+        return RequestServer::RequestPriority::High;
+    case Priority::Low:
+        return RequestServer::RequestPriority::Low;
+    case Priority::Auto:
+        break;
+    }
+
+    // Without an explicit fetchpriority, favor what blocks rendering over media that fills in later.
+    if (!request.destination().has_value())
+        return RequestServer::RequestPriority::Normal;
+
+    switch (*request.destination()) {
+    case Destination::Document:
+    case Destination::IFrame:
+    case Destination::Frame:
+    case Destination::Style:
+    case Destination::Font:
+        return RequestServer::RequestPriority::High;
+    case Destination::Image:
+    case Destination::Audio:
+    case Destination::Video:
+    case Destination::Track:
+        return RequestServer::RequestPriority::Low;
+    default:
+        return RequestServer::RequestPriority::Normal;
+    }
+}
+
 RefPtr<Requests::Request> ResourceLoader::start_network_request(LoadRequest const& request, Requests::RequestClient::KeepAliveForTransfer keep_alive_for_transfer)
 {
     auto proxy = ProxyMappings::the().proxy_for_url(request.url().value());
@@ -510,7 +545,7 @@ RefPtr<Requests::Request> ResourceLoader::start_network_request(LoadRequest cons
         return nullptr;
     }
 
-    auto protocol_request = m_request_client->start_request(request.method(), request.url().value(), request.headers(), request.body(), request.cache_mode(), request.include_credentials(), proxy, keep_alive_for_transfer);
+    auto protocol_request = m_request_client->start_request(request.method(), request.url().value(), request.headers(), request.body(), request.cache_mode(), request.include_credentials(), proxy, keep_alive_for_transfer, network_priority_for_request(request));
     if (!protocol_request) {
         log_failure(request, "Failed to initiate load"sv);
         return nullptr;
@@ -520,6 +555,10 @@ RefPtr<Requests::Request> ResourceLoader::start_network_request(LoadRequest cons
         return {};
     };
 
+    protocol_request->on_early_hints = [this, url = request.url().value()](auto hints) {
+        handle_early_hints(url, *hints);
+    };
+
     if (auto page = request.page()) {
         Optional<String> initiator_type_string;
         if (request.initiator_type().has_value())
@@ -536,6 +575,48 @@ RefPtr<Requests::Request> ResourceLoader::start_network_request(LoadRequest cons
     return protocol_request;
 }
 
+// https://httpwg.org/specs/rfc8297.html
+void ResourceLoader::handle_early_hints(URL::URL const& response_url, HTTP::HeaderList const& hints)
+{
+    // FIXME: Early hints may also carry rel=preload links. Acting on those needs the navigation's eventual document
+    //        to take ownership of the preloaded responses, so for now we only warm up the hinted origins.
+    hints.for_each_header_value("Link"sv, [&](ByteString const& value) {
+        for (auto link_value : value.view().split_view(',')) {
+            // Each link-value is `<URI-Reference> *( ";" link-param )`, see https://httpwg.org/specs/rfc8288.html
+            link_value = link_value.trim_whitespace();
+            if (!link_value.starts_with('<'))
+                continue;
+            auto url_end = link_value.find('>');
+            if (!url_end.has_value())
+                continue;
+
+            auto url = response_url.complete_url(link_value.substring_view(1, *url_end - 1));
+            if (!url.has_value() || !url->scheme().is_one_of("http"sv, "https"sv))
+                continue;
+
+            bool is_preconnect = false;
+            bool is_dns_prefetch = false;
+            for (auto parameter : link_value.substring_view(*url_end + 1).split_view(';')) {
+                auto equals_index = parameter.find('=');
+                if (!equals_index.has_value() || !parameter.substring_view(0, *equals_index).trim_whitespace().equals_ignoring_ascii_case("rel"sv))
+                    continue;
+
+                auto relations = parameter.substring_view(*equals_index + 1).trim_whitespace().trim("\""sv);
+                for (auto relation : relations.split_view(' ')) {
+                    is_preconnect |= relation.equals_ignoring_ascii_case("preconnect"sv);
+                    is_dns_prefetch |= relation.equals_ignoring_ascii_case("dns-prefetch"sv);
+                }
+            }
+
+            if (is_preconnect)
+                preconnect(*url, response_url);
+            else if (is_dns_prefetch)
+                prefetch_dns(*url, response_url);
+        }
+        return IterationDecision::Continue;
+    });
+}
+
 void ResourceLoader::handle_network_response_headers(LoadRequest const& request, HTTP::HeaderList const& response_headers)
 {
     if (!request.page())
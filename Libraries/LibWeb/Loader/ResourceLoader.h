@@ -90,6 +90,7 @@ private:
 
     RefPtr<Requests::Request> start_network_request(LoadRequest const&, Requests::RequestClient::KeepAliveForTransfer);
     void handle_network_response_headers(LoadRequest const&, HTTP::HeaderList const&);
+    void handle_early_hints(URL::URL const& response_url, HTTP::HeaderList const& hints);
     void finish_network_request(NonnullRefPtr<Requests::Request>);
 
     int m_pending_loads { 0 };
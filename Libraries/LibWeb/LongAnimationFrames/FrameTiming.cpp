@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/HTML/LocalNavigable.h>
+#include <LibWeb/HTML/Window.h>
+#include <LibWeb/HighResolutionTime/TimeOrigin.h>
+#include <LibWeb/LongAnimationFrames/FrameTiming.h>
+#include <LibWeb/LongAnimationFrames/PerformanceLongAnimationFrameTiming.h>
+#include <LibWeb/Profiling/SamplingProfiler.h>
+
+namespace Web::LongAnimationFrames {
+
+// https://w3c.github.io/long-animation-frames/#record-task-start-time
+void record_task_start_time(HighResolutionTime::DOMHighResTimeStamp task_start_time, DOM::Document& document)
+{
+    // 1. If document's current frame timing info is null, set document's current frame timing info to a new frame
+    //    timing info whose start time is taskStartTime.
+    auto& timing_info = document.current_frame_timing_info();
+    if (!timing_info.has_value())
+        timing_info = FrameTimingInfo { .start_time = task_start_time };
+
+    // 2. Set document's current frame timing info's current task start time to taskStartTime.
+    timing_info->current_task_start_time = task_start_time;
+}
+
+// https://w3c.github.io/long-animation-frames/#record-task-end-time
+void record_task_end_time(HighResolutionTime::DOMHighResTimeStamp task_end_time, DOM::Document& document)
+{
+    // 1. Let timingInfo be document's current frame timing info.
+    auto& timing_info = document.current_frame_timing_info();
+
+    // 2. If timingInfo is null, return.
+    if (!timing_info.has_value())
+        return;
+
+    // 3. Append taskEndTime minus timingInfo's current task start time to timingInfo's task durations.
+    timing_info->task_durations.append(task_end_time - timing_info->current_task_start_time);
+
+    // AD-HOC: If document's node navigable is going to update its rendering after this task, the frame goes on until
+    //         the end of that rendering update, which flushes it.
+    if (auto navigable = document.navigable()) {
+        if (navigable->has_a_rendering_opportunity() && navigable->needs_repaint() && !document.hidden() && !document.is_render_blocked())
+            return;
+    }
+
+    // 4. Flush frame timing given document and taskEndTime.
+    flush_frame_timing(document, task_end_time);
+}
+
+// https://w3c.github.io/long-animation-frames/#record-rendering-time
+void record_rendering_time(DOM::Document& document, HighResolutionTime::DOMHighResTimeStamp update_the_rendering_start_time, HighResolutionTime::DOMHighResTimeStamp unsafe_style_and_layout_start_time)
+{
+    // 1. If document's current frame timing info is null, set it to a new frame timing info whose start time is the
+    //    start time of this rendering update.
+    // NOTE: This happens for documents other than the one of the rendering task, such as those of iframes.
+    auto& timing_info = document.current_frame_timing_info();
+    if (!timing_info.has_value())
+        timing_info = FrameTimingInfo { .start_time = update_the_rendering_start_time };
+
+    // 2. Set timingInfo's update the rendering start time to the start time of this rendering update.
+    timing_info->update_the_rendering_start_time = update_the_rendering_start_time;
+
+    // 3. Set timingInfo's style and layout start time to unsafeStyleAndLayoutStartTime.
+    timing_info->style_and_layout_start_time = unsafe_style_and_layout_start_time;
+}
+
+// https://w3c.github.io/long-animation-frames/#dom-performancelonganimationframetiming-firstuieventtimestamp
+void record_ui_event_timestamp(DOM::Document& document, HighResolutionTime::DOMHighResTimeStamp event_timestamp)
+{
+    auto& timing_info = document.current_frame_timing_info();
+    if (!timing_info.has_value() || timing_info->first_ui_event_timestamp != 0)
+        return;
+    timing_info->first_ui_event_timestamp = event_timestamp;
+}
+
+// https://w3c.github.io/long-animation-frames/#flush-frame-timing
+void flush_frame_timing(DOM::Document& document, HighResolutionTime::DOMHighResTimeStamp frame_end_time)
+{
+    // 1. Let timingInfo be document's current frame timing info.
+    // 2. Set document's current frame timing info to null.
+    auto timing_info = exchange(document.current_frame_timing_info(), {});
+    if (!timing_info.has_value())
+        return;
+
+    // 3. If frameEndTime minus timingInfo's start time is less than the long animation frame duration threshold, return.
+    auto frame_duration = frame_end_time - timing_info->start_time;
+    if (frame_duration < long_animation_frame_duration_threshold)
+        return;
+
+    // 4. Let global be document's relevant global object.
+    auto* window = as_if<HTML::Window>(HTML::relevant_global_object(document));
+    if (!window)
+        return;
+    auto& realm = document.realm();
+
+    // 5. Let blockingDuration be the sum of each task duration of timingInfo that is longer than the long animation
+    //    frame duration threshold, minus that threshold. If this frame updated the rendering, the time spent doing so
+    //    is added to the longest task duration before summing them up.
+    auto task_durations = move(timing_info->task_durations);
+    if (timing_info->update_the_rendering_start_time != 0) {
+        auto rendering_duration = frame_end_time - timing_info->update_the_rendering_start_time;
+        if (task_durations.is_empty()) {
+            task_durations.append(rendering_duration);
+        } else {
+            size_t longest_task_index = 0;
+            for (size_t i = 1; i < task_durations.size(); ++i) {
+                if (task_durations[i] > task_durations[longest_task_index])
+                    longest_task_index = i;
+            }
+            task_durations[longest_task_index] += rendering_duration;
+        }
+    }
+
+    HighResolutionTime::DOMHighResTimeStamp blocking_duration = 0;
+    for (auto task_duration : task_durations) {
+        if (task_duration > long_animation_frame_duration_threshold)
+            blocking_duration += task_duration - long_animation_frame_duration_threshold;
+    }
+
+    auto to_relative_time = [&](HighResolutionTime::DOMHighResTimeStamp time) -> HighResolutionTime::DOMHighResTimeStamp {
+        if (time == 0)
+            return 0;
+        return HighResolutionTime::relative_high_resolution_time(time, *window);
+    };
+
+    // 6. Let entry be a new PerformanceLongAnimationFrameTiming in global's realm, whose startTime is timingInfo's start
+    //    time, duration is frameEndTime minus that, renderStart is timingInfo's update the rendering start time,
+    //    styleAndLayoutStart is timingInfo's style and layout start time, blockingDuration is blockingDuration and
+    //    firstUIEventTimestamp is timingInfo's first ui event timestamp.
+    auto start_time = to_relative_time(timing_info->start_time);
+    auto entry = realm.create<PerformanceLongAnimationFrameTiming>(
+        realm,
+        start_time,
+        to_relative_time(frame_end_time) - start_time,
+        to_relative_time(timing_info->update_the_rendering_start_time),
+        to_relative_time(timing_info->style_and_layout_start_time),
+        blocking_duration,
+        timing_info->first_ui_event_timestamp);
+
+    // 7. Queue entry.
+    window->queue_performance_entry(entry);
+
+    // 8. Add entry to global's performance entry buffer.
+    window->add_performance_entry(entry, HTML::WindowOrWorkerGlobalScopeMixin::CheckIfPerformanceBufferIsFull::Yes);
+
+    // AD-HOC: Also show the frame on the timeline of the sampling profiler, next to the markers for the phases of the
+    //         rendering update. The frame has only just ended, so it is close enough to end it now.
+    auto end = MonotonicTime::now();
+    auto start = end - AK::Duration::from_microseconds(static_cast<i64>(frame_duration * 1000));
+    Profiling::SamplingProfiler::the().add_marker("Long animation frame"sv, Profiling::Phase::Other, start, end);
+}
+
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Vector.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/HighResolutionTime/DOMHighResTimeStamp.h>
+
+namespace Web::LongAnimationFrames {
+
+// https://w3c.github.io/long-animation-frames/#frame-timing-info
+// NOTE: All of these are unsafe shared current times, except for the first UI event timestamp, which is relative to
+//       the document's relevant global object like the event's timeStamp.
+struct FrameTimingInfo {
+    HighResolutionTime::DOMHighResTimeStamp start_time { 0 };
+    HighResolutionTime::DOMHighResTimeStamp current_task_start_time { 0 };
+    HighResolutionTime::DOMHighResTimeStamp update_the_rendering_start_time { 0 };
+    HighResolutionTime::DOMHighResTimeStamp style_and_layout_start_time { 0 };
+    HighResolutionTime::DOMHighResTimeStamp first_ui_event_timestamp { 0 };
+    Vector<HighResolutionTime::DOMHighResTimeStamp> task_durations;
+};
+
+// https://w3c.github.io/long-animation-frames/#long-animation-frame-duration-threshold
+static constexpr HighResolutionTime::DOMHighResTimeStamp long_animation_frame_duration_threshold = 50;
+
+void record_task_start_time(HighResolutionTime::DOMHighResTimeStamp task_start_time, DOM::Document&);
+void record_task_end_time(HighResolutionTime::DOMHighResTimeStamp task_end_time, DOM::Document&);
+void record_rendering_time(DOM::Document&, HighResolutionTime::DOMHighResTimeStamp update_the_rendering_start_time, HighResolutionTime::DOMHighResTimeStamp unsafe_style_and_layout_start_time);
+void record_ui_event_timestamp(DOM::Document&, HighResolutionTime::DOMHighResTimeStamp event_timestamp);
+void flush_frame_timing(DOM::Document&, HighResolutionTime::DOMHighResTimeStamp frame_end_time);
+
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Bindings/PerformanceLongAnimationFrameTiming.h>
+#include <LibWeb/LongAnimationFrames/PerformanceLongAnimationFrameTiming.h>
+#include <LibWeb/PerformanceTimeline/EntryTypes.h>
+
+namespace Web::LongAnimationFrames {
+
+GC_DEFINE_ALLOCATOR(PerformanceLongAnimationFrameTiming);
+
+PerformanceLongAnimationFrameTiming::PerformanceLongAnimationFrameTiming(JS::Realm& realm, HighResolutionTime::DOMHighResTimeStamp start_time, HighResolutionTime::DOMHighResTimeStamp duration, HighResolutionTime::DOMHighResTimeStamp render_start, HighResolutionTime::DOMHighResTimeStamp style_and_layout_start, HighResolutionTime::DOMHighResTimeStamp blocking_duration, HighResolutionTime::DOMHighResTimeStamp first_ui_event_timestamp)
+    : PerformanceTimeline::PerformanceEntry(realm, PerformanceTimeline::EntryTypes::long_animation_frame.to_utf16_string(), start_time, duration)
+    , m_render_start(render_start)
+    , m_style_and_layout_start(style_and_layout_start)
+    , m_blocking_duration(blocking_duration)
+    , m_first_ui_event_timestamp(first_ui_event_timestamp)
+{
+}
+
+PerformanceLongAnimationFrameTiming::~PerformanceLongAnimationFrameTiming() = default;
+
+// https://w3c.github.io/long-animation-frames/#dom-performanceentry-entrytype
+Utf16FlyString const& PerformanceLongAnimationFrameTiming::entry_type() const
+{
+    // The entryType attribute's getter step is to return "long-animation-frame".
+    return PerformanceTimeline::EntryTypes::long_animation_frame;
+}
+
+void PerformanceLongAnimationFrameTiming::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(PerformanceLongAnimationFrameTiming);
+    Base::initialize(realm);
+}
+
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/PerformanceTimeline/PerformanceEntry.h>
+
+namespace Web::LongAnimationFrames {
+
+// https://w3c.github.io/long-animation-frames/#sec-PerformanceLongAnimationFrameTiming
+class PerformanceLongAnimationFrameTiming final : public PerformanceTimeline::PerformanceEntry {
+    WEB_PLATFORM_OBJECT(PerformanceLongAnimationFrameTiming, PerformanceTimeline::PerformanceEntry);
+    GC_DECLARE_ALLOCATOR(PerformanceLongAnimationFrameTiming);
+
+public:
+    virtual ~PerformanceLongAnimationFrameTiming();
+
+    // NOTE: These three functions are answered by the registry for the given entry type.
+    // https://w3c.github.io/timing-entrytypes-registry/#registry
+
+    // https://w3c.github.io/timing-entrytypes-registry/#dfn-availablefromtimeline
+    static PerformanceTimeline::AvailableFromTimeline available_from_timeline() { return PerformanceTimeline::AvailableFromTimeline::No; }
+
+    // https://w3c.github.io/timing-entrytypes-registry/#dfn-maxbuffersize
+    static Optional<u64> max_buffer_size() { return 200; }
+
+    // https://w3c.github.io/timing-entrytypes-registry/#dfn-should-add-entry
+    virtual PerformanceTimeline::ShouldAddEntry should_add_entry(Optional<Bindings::PerformanceObserverInit const&> = {}) const override { return PerformanceTimeline::ShouldAddEntry::Yes; }
+
+    virtual Utf16FlyString const& entry_type() const override;
+
+    // https://w3c.github.io/long-animation-frames/#dom-performancelonganimationframetiming-renderstart
+    HighResolutionTime::DOMHighResTimeStamp render_start() const { return m_render_start; }
+
+    // https://w3c.github.io/long-animation-frames/#dom-performancelonganimationframetiming-styleandlayoutstart
+    HighResolutionTime::DOMHighResTimeStamp style_and_layout_start() const { return m_style_and_layout_start; }
+
+    // https://w3c.github.io/long-animation-frames/#dom-performancelonganimationframetiming-blockingduration
+    HighResolutionTime::DOMHighResTimeStamp blocking_duration() const { return m_blocking_duration; }
+
+    // https://w3c.github.io/long-animation-frames/#dom-performancelonganimationframetiming-firstuieventtimestamp
+    HighResolutionTime::DOMHighResTimeStamp first_ui_event_timestamp() const { return m_first_ui_event_timestamp; }
+
+private:
+    PerformanceLongAnimationFrameTiming(JS::Realm&, HighResolutionTime::DOMHighResTimeStamp start_time, HighResolutionTime::DOMHighResTimeStamp duration, HighResolutionTime::DOMHighResTimeStamp render_start, HighResolutionTime::DOMHighResTimeStamp style_and_layout_start, HighResolutionTime::DOMHighResTimeStamp blocking_duration, HighResolutionTime::DOMHighResTimeStamp first_ui_event_timestamp);
+
+    virtual void initialize(JS::Realm&) override;
+
+    HighResolutionTime::DOMHighResTimeStamp m_render_start { 0 };
+    HighResolutionTime::DOMHighResTimeStamp m_style_and_layout_start { 0 };
+    HighResolutionTime::DOMHighResTimeStamp m_blocking_duration { 0 };
+    HighResolutionTime::DOMHighResTimeStamp m_first_ui_event_timestamp { 0 };
+};
+
+}
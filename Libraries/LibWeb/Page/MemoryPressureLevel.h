@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+namespace Web {
+
+enum class MemoryPressureLevel : u8 {
+    // Memory is getting scarce. Memory that isn't needed to render what is visible should be released.
+    Moderate,
+    // Memory is about to run out. Everything that can be rebuilt later should be released.
+    Critical,
+};
+
+}
@@ -11,11 +11,147 @@
 #include <LibIPC/Decoder.h>
 #include <LibIPC/Encoder.h>
 #include <LibWeb/Painting/DisplayList.h>
+#include <math.h>
 
 namespace Web::Painting {
 
 static Atomic<u64> s_next_id { 1 };
 
+static bool is_integer_translation(Gfx::FloatMatrix4x4 const& matrix)
+{
+    return matrix[0, 0] == 1 && matrix[0, 1] == 0 && matrix[1, 0] == 0 && matrix[1, 1] == 1
+        && matrix[3, 0] == 0 && matrix[3, 1] == 0 && matrix[3, 3] == 1
+        && matrix[0, 3] == floorf(matrix[0, 3]) && matrix[1, 3] == floorf(matrix[1, 3]);
+}
+
+// Finds the commands whose pixels are all overwritten by an opaque FillRect painted later in the same visual context,
+// and returns a flag per command header (empty if there are none). Within one context every command shares the same
+// transform and clip chain; contexts are only eligible if that chain maps to device space by an integer translation
+// (so an integer rect covers whole pixels) and contains no effects or masks (whose layers may be pushed separately
+// for each run of commands in the context). Clips recorded in the stream itself only shrink what an occludee paints,
+// but an occluder must not be clipped, so only FillRects outside any clipped Save block count. Commands in other
+// contexts painted in between may blend with an occluded command's pixels, but only pixel-locally, and those pixels
+// are overwritten by the occluder anyway; backdrop filters sample their neighborhood and stop the search.
+template<typename ContextAllowsOcclusion>
+static Vector<bool> find_occluded_commands(ReadonlyBytes commands, ContextAllowsOcclusion&& context_allows_occlusion)
+{
+    struct Entry {
+        u64 context_key { 0 };
+        Optional<Gfx::IntRect> occludee_bounds;
+        Optional<Gfx::IntRect> occluder_rect;
+        bool is_barrier { false };
+    };
+    Vector<Entry> entries;
+    bool has_occluder = false;
+
+    Vector<bool, 8> save_level_is_clipped;
+    size_t clipped_save_level_count = 0;
+    bool occluders_disabled = false;
+
+    DisplayList::for_each_command_header(commands, [&](DisplayListCommandHeader const& header, ReadonlyBytes payload) {
+        Entry entry;
+        entry.context_key = (static_cast<u64>(header.context_index.value()) << 1) | header.context_geometry_only;
+        bool context_is_eligible = !display_list_command_is_compositor_metadata(header.type)
+            && context_allows_occlusion(header.context_index, header.context_geometry_only);
+
+        switch (header.type) {
+        case DisplayListCommandType::Save:
+        case DisplayListCommandType::SaveLayer:
+            save_level_is_clipped.append(false);
+            break;
+        case DisplayListCommandType::Restore:
+            if (save_level_is_clipped.is_empty()) {
+                occluders_disabled = true;
+                break;
+            }
+            if (save_level_is_clipped.take_last())
+                --clipped_save_level_count;
+            break;
+        case DisplayListCommandType::ApplyBackdropFilter:
+        case DisplayListCommandType::ApplyEffects:
+            entry.is_barrier = true;
+            break;
+        case DisplayListCommandType::PaintScrollBar:
+            // Its thumb is moved by the scroll offset at replay time, so the recorded bounds are not where it ends up.
+            break;
+        default:
+            if (header.is_clip) {
+                // A clip outside of any Save applies until the context is left, which this pass doesn't track.
+                if (save_level_is_clipped.is_empty()) {
+                    occluders_disabled = true;
+                } else if (!save_level_is_clipped.last()) {
+                    save_level_is_clipped.last() = true;
+                    ++clipped_save_level_count;
+                }
+                break;
+            }
+            if (!context_is_eligible || !header.has_bounding_rect)
+                break;
+            entry.occludee_bounds = header.bounding_rect;
+            if (header.type == DisplayListCommandType::FillRect && !occluders_disabled && clipped_save_level_count == 0) {
+                auto fill_rect = read_display_list_command_payload<FillRect>(payload);
+                if (fill_rect.color.alpha() == 255 && !fill_rect.rect.is_empty()) {
+                    entry.occluder_rect = fill_rect.rect;
+                    has_occluder = true;
+                }
+            }
+            break;
+        }
+        entries.append(entry);
+    });
+
+    if (!has_occluder)
+        return {};
+
+    // Walk backwards, so each command is tested against the opaque rects painted after it. Keep a few of the largest
+    // rects per context; occlusion that matters comes from big backgrounds, not from many small fills.
+    static constexpr size_t max_occluders_per_context = 4;
+    HashMap<u64, Vector<Gfx::IntRect, max_occluders_per_context>> occluders;
+    Vector<bool> occluded;
+    bool has_occluded_command = false;
+    occluded.resize(entries.size());
+    for (size_t i = entries.size(); i-- > 0;) {
+        auto const& entry = entries[i];
+        if (entry.is_barrier) {
+            occluders.clear();
+            continue;
+        }
+        if (!entry.occludee_bounds.has_value())
+            continue;
+
+        auto context_occluders = occluders.find(entry.context_key);
+        if (context_occluders != occluders.end()) {
+            for (auto const& occluder : context_occluders->value) {
+                if (occluder.contains(*entry.occludee_bounds)) {
+                    occluded[i] = true;
+                    has_occluded_command = true;
+                    break;
+                }
+            }
+        }
+        if (occluded[i] || !entry.occluder_rect.has_value())
+            continue;
+
+        auto& rects = occluders.ensure(entry.context_key);
+        if (rects.size() < max_occluders_per_context) {
+            rects.append(*entry.occluder_rect);
+            continue;
+        }
+        auto area = [](Gfx::IntRect const& rect) { return static_cast<i64>(rect.width()) * rect.height(); };
+        size_t smallest_index = 0;
+        for (size_t j = 1; j < rects.size(); ++j) {
+            if (area(rects[j]) < area(rects[smallest_index]))
+                smallest_index = j;
+        }
+        if (area(rects[smallest_index]) < area(*entry.occluder_rect))
+            rects[smallest_index] = *entry.occluder_rect;
+    }
+
+    if (!has_occluded_command)
+        return {};
+    return occluded;
+}
+
 static void set_command_sequence_visual_context(Bytes command_bytes, VisualContextIndex context_index)
 {
     for (size_t offset = 0; offset < command_bytes.size();) {
@@ -45,6 +181,12 @@ DisplayList::DisplayList(u64 compatible_visual_context_tree_version, u64 id, Byt
 {
 }
 
+NonnullRefPtr<DisplayList> DisplayList::with_command_bytes(ByteBuffer&& command_bytes) const
+{
+    auto mask_display_lists = m_mask_display_lists;
+    return adopt_ref(*new DisplayList(m_compatible_visual_context_tree_version, m_id, move(command_bytes), m_surface_clear_color, m_async_scrolling_metadata, move(mask_display_lists)));
+}
+
 bool DisplayList::append_bytes(
     DisplayListCommandType type,
     ReadonlyBytes payload,
@@ -385,10 +527,49 @@ void DisplayListPlayer::execute_impl(
         return SwitchResult::Switched;
     };
 
+    // OPTIMIZATION: Skip commands that a later opaque FillRect in the same visual context paints over completely, such
+    //               as everything underneath an opaque full-viewport overlay.
+    Vector<Optional<bool>> context_allows_occlusion_cache;
+    context_allows_occlusion_cache.resize(nodes.size());
+    auto occluded_commands = find_occluded_commands(commands, [&](VisualContextIndex context_index, bool geometry_only) {
+        if (geometry_only)
+            return false;
+        auto& cached = context_allows_occlusion_cache[context_index.value()];
+        if (!cached.has_value()) {
+            cached = is_integer_translation(transform_palette[nearest_spatial_node[context_index.value()].value()]);
+            for (auto index = context_index; *cached; index = visual_context_tree.node_at(index).parent_index) {
+                auto const& data = visual_context_tree.node_at(index).data;
+                if (data.has<EffectsData>() || data.has<MaskData>())
+                    cached = false;
+                if (index == VISUAL_VIEWPORT_NODE_INDEX)
+                    break;
+            }
+        }
+        return *cached;
+    });
+    size_t command_index = 0;
+
+    // Consecutive glyph runs in the same visual context leave the canvas state untouched between them (switching to
+    // the same context is a no-op), so the player may batch them. Any other command ends the batch first.
+    Optional<VisualContextIndex> glyph_run_batch_context_index;
+    bool glyph_run_batch_context_geometry_only { false };
+
     DisplayList::for_each_command_header(commands, [&](DisplayListCommandHeader const& header, ReadonlyBytes payload) {
-        if (display_list_command_is_compositor_metadata(header.type))
+        auto is_occluded = !occluded_commands.is_empty() && occluded_commands[command_index];
+        ++command_index;
+        if (display_list_command_is_compositor_metadata(header.type) || is_occluded)
             return;
 
+        if (header.type == DisplayListCommandType::DrawGlyphRun) {
+            if (glyph_run_batch_context_index != header.context_index || glyph_run_batch_context_geometry_only != header.context_geometry_only)
+                flush_batched_draws();
+            glyph_run_batch_context_index = header.context_index;
+            glyph_run_batch_context_geometry_only = header.context_geometry_only;
+        } else if (glyph_run_batch_context_index.has_value()) {
+            flush_batched_draws();
+            glyph_run_batch_context_index = {};
+        }
+
         auto bounding_rect = header.has_bounding_rect
             ? Optional<Gfx::IntRect>(header.bounding_rect)
             : Optional<Gfx::IntRect> {};
@@ -435,6 +616,7 @@ void DisplayListPlayer::execute_impl(
         }
     });
 
+    flush_batched_draws();
     restore_to_length(0);
     // Node spaces were entered by setting the canvas matrix absolutely, outside any save, so the
     // matrix the replay entered with must be handed back explicitly.
@@ -73,6 +73,10 @@ private:
 
     virtual void add_clip_path(Gfx::Path const&, Gfx::WindingRule) = 0;
 
+    // Players may defer consecutive DrawGlyphRun commands and issue them as a single draw. execute_impl() calls this
+    // before anything else can touch the canvas, and at the end of every replay.
+    virtual void flush_batched_draws() { }
+
     DisplayList const* m_active_display_list { nullptr };
     AccumulatedVisualContextTree const* m_active_visual_context_tree { nullptr };
     DisplayListResourceStorage const* m_resource_storage { nullptr };
@@ -157,6 +161,9 @@ public:
     u32 append_command_range_from(DisplayList const& source_display_list, DisplayListCommandRange, AccumulatedVisualContextTree const&, VisualContextIndex recorded_context_index, VisualContextIndex current_context_index);
     size_t command_byte_size() const { return m_command_bytes.size(); }
 
+    // Returns a display list with this one's id and metadata, but with the given command bytes.
+    NonnullRefPtr<DisplayList> with_command_bytes(ByteBuffer&&) const;
+
 private:
     explicit DisplayList(u64 compatible_visual_context_tree_version);
     DisplayList(u64 compatible_visual_context_tree_version, u64 id, ByteBuffer&& command_bytes, Optional<Gfx::Color> surface_clear_color, Optional<AsyncScrollingMetadata>, HashMap<VisualContextIndex, DisplayListResourceId>&& mask_display_lists);
@@ -221,6 +221,12 @@ void CompositorStickyArea::dump(StringBuilder& builder) const
     dump_optional_float(builder, inset_left);
 }
 
+void CompositorScrollTimelineOpacityAnimation::dump(StringBuilder& builder) const
+{
+    builder.appendff(" source_scroll_node_index={} effects_node_index={} max_scroll_offset={} from_opacity={} to_opacity={} vertical={} fills_forwards={}",
+        source_scroll_node_index, effects_node_index, max_scroll_offset, from_opacity, to_opacity, vertical, fills_forwards);
+}
+
 void CompositorBlockingWheelEventRegion::dump(StringBuilder& builder) const
 {
     builder.appendff(" rect={}", rect);
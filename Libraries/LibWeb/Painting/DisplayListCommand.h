@@ -72,6 +72,8 @@ class DisplayList;
     V(CompositorMainThreadWheelEventRegion, compositor_main_thread_wheel_event_region) \
     V(CompositorViewportScrollbar, compositor_viewport_scrollbar)                      \
     V(CompositorBlockingWheelEventRegion, compositor_blocking_wheel_event_region)      \
+    V(CompositorScrollTimelineOpacityAnimation,                                        \
+        compositor_scroll_timeline_opacity_animation)                                  \
     V(PaintScrollBar, paint_scrollbar)                                                 \
     V(ApplyEffects, apply_effects)
 
@@ -91,6 +93,7 @@ constexpr bool display_list_command_is_compositor_metadata(DisplayListCommandTyp
     case DisplayListCommandType::CompositorMainThreadWheelEventRegion:
     case DisplayListCommandType::CompositorViewportScrollbar:
     case DisplayListCommandType::CompositorBlockingWheelEventRegion:
+    case DisplayListCommandType::CompositorScrollTimelineOpacityAnimation:
         return true;
     default:
         return false;
@@ -633,6 +636,22 @@ struct CompositorStickyArea {
     void dump(StringBuilder&) const;
 };
 
+struct CompositorScrollTimelineOpacityAnimation {
+    static constexpr StringView command_name = "CompositorScrollTimelineOpacityAnimation"sv;
+    static constexpr DisplayListCommandType command_type = DisplayListCommandType::CompositorScrollTimelineOpacityAnimation;
+
+    UniqueNodeID document_id;
+    VisualContextIndex source_scroll_node_index;
+    VisualContextIndex effects_node_index;
+    float max_scroll_offset { 0 };
+    float from_opacity { 1 };
+    float to_opacity { 1 };
+    bool vertical { true };
+    bool fills_forwards { false };
+
+    void dump(StringBuilder&) const;
+};
+
 struct CompositorBlockingWheelEventRegion {
     static constexpr StringView command_name = "CompositorBlockingWheelEventRegion"sv;
     static constexpr DisplayListCommandType command_type = DisplayListCommandType::CompositorBlockingWheelEventRegion;
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Checked.h>
+#include <LibIPC/Decoder.h>
+#include <LibIPC/Encoder.h>
+#include <LibWeb/Painting/DisplayListCommandBytesDelta.h>
+
+namespace Web::Painting {
+
+// Compares whole blocks first, so long identical runs are compared with memcmp() rather than byte by byte.
+static constexpr size_t comparison_block_size = 4096;
+
+static size_t common_prefix_size(ReadonlyBytes a, ReadonlyBytes b)
+{
+    auto limit = min(a.size(), b.size());
+    size_t size = 0;
+    while (size + comparison_block_size <= limit && a.slice(size, comparison_block_size) == b.slice(size, comparison_block_size))
+        size += comparison_block_size;
+    while (size < limit && a[size] == b[size])
+        ++size;
+    return size;
+}
+
+static size_t common_suffix_size(ReadonlyBytes a, ReadonlyBytes b)
+{
+    auto limit = min(a.size(), b.size());
+    size_t size = 0;
+    while (size + comparison_block_size <= limit && a.slice(a.size() - size - comparison_block_size, comparison_block_size) == b.slice(b.size() - size - comparison_block_size, comparison_block_size))
+        size += comparison_block_size;
+    while (size < limit && a[a.size() - size - 1] == b[b.size() - size - 1])
+        ++size;
+    return size;
+}
+
+DisplayListCommandBytesDelta DisplayListCommandBytesDelta::compute(u64 base_display_list_id, ReadonlyBytes base_command_bytes, ReadonlyBytes command_bytes)
+{
+    auto prefix_size = common_prefix_size(base_command_bytes, command_bytes);
+    // The suffix must not overlap the prefix in either display list.
+    auto suffix_size = common_suffix_size(base_command_bytes.slice(prefix_size), command_bytes.slice(prefix_size));
+
+    return {
+        .base_display_list_id = base_display_list_id,
+        .unchanged_prefix_size = static_cast<u32>(prefix_size),
+        .unchanged_suffix_size = static_cast<u32>(suffix_size),
+        .changed_bytes = MUST(ByteBuffer::copy(command_bytes.slice(prefix_size, command_bytes.size() - prefix_size - suffix_size))),
+    };
+}
+
+ErrorOr<ByteBuffer> DisplayListCommandBytesDelta::apply_to(u64 display_list_id, ReadonlyBytes base_command_bytes) const
+{
+    if (display_list_id != base_display_list_id)
+        return Error::from_string_literal("Display-list command delta does not apply to this base display list");
+
+    auto unchanged_size = Checked<size_t>(unchanged_prefix_size) + unchanged_suffix_size;
+    if (unchanged_size.has_overflow() || unchanged_size.value() > base_command_bytes.size())
+        return Error::from_string_literal("Display-list command delta is larger than its base display list");
+
+    auto command_bytes = TRY(ByteBuffer::create_uninitialized(unchanged_size.value() + changed_bytes.size()));
+    base_command_bytes.trim(unchanged_prefix_size).copy_to(command_bytes.span());
+    changed_bytes.span().copy_to(command_bytes.span().slice(unchanged_prefix_size));
+    base_command_bytes.slice_from_end(unchanged_suffix_size).copy_to(command_bytes.span().slice(unchanged_prefix_size + changed_bytes.size()));
+    return command_bytes;
+}
+
+}
+
+namespace IPC {
+
+template<>
+ErrorOr<void> encode(Encoder& encoder, Web::Painting::DisplayListCommandBytesDelta const& delta)
+{
+    TRY(encoder.encode(delta.base_display_list_id));
+    TRY(encoder.encode(delta.unchanged_prefix_size));
+    TRY(encoder.encode(delta.unchanged_suffix_size));
+    TRY(encoder.encode(delta.changed_bytes));
+    return {};
+}
+
+template<>
+ErrorOr<Web::Painting::DisplayListCommandBytesDelta> decode(Decoder& decoder)
+{
+    return Web::Painting::DisplayListCommandBytesDelta {
+        .base_display_list_id = TRY(decoder.decode<u64>()),
+        .unchanged_prefix_size = TRY(decoder.decode<u32>()),
+        .unchanged_suffix_size = TRY(decoder.decode<u32>()),
+        .changed_bytes = TRY(decoder.decode<ByteBuffer>()),
+    };
+}
+
+}
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/Error.h>
+#include <AK/Span.h>
+#include <AK/Types.h>
+#include <LibIPC/Forward.h>
+#include <LibWeb/Export.h>
+
+namespace Web::Painting {
+
+// The command bytes of a display list, expressed against a base display list the receiver already has: everything
+// except the bytes between an unchanged prefix and an unchanged suffix of the base's command bytes.
+struct DisplayListCommandBytesDelta {
+    u64 base_display_list_id { 0 };
+    u32 unchanged_prefix_size { 0 };
+    u32 unchanged_suffix_size { 0 };
+    ByteBuffer changed_bytes;
+
+    WEB_API static DisplayListCommandBytesDelta compute(u64 base_display_list_id, ReadonlyBytes base_command_bytes, ReadonlyBytes command_bytes);
+    WEB_API ErrorOr<ByteBuffer> apply_to(u64 display_list_id, ReadonlyBytes base_command_bytes) const;
+};
+
+}
+
+namespace IPC {
+
+template<>
+WEB_API ErrorOr<void> encode(Encoder&, Web::Painting::DisplayListCommandBytesDelta const&);
+template<>
+WEB_API ErrorOr<Web::Painting::DisplayListCommandBytesDelta> decode(Decoder&);
+
+}
@@ -190,18 +190,35 @@ void DisplayListPlayerSkia::play_command(DrawGlyphRun const& command)
     if (glyphs.is_empty())
         return;
 
+    // Article-like pages record every line (and every differently styled span) as its own glyph run, and issuing
+    // each as a separate text blob draw dominates the GPU-side cost of painting them. Consecutive horizontal runs of
+    // the same color become runs of one text blob instead, with the translation folded into the glyph positions,
+    // and are drawn together once the batch ends (see flush_batched_draws()). Glyph masks themselves live in the
+    // Skia context's glyph atlas, which already persists across frames.
+    bool is_horizontal = command.orientation == Gfx::Orientation::Horizontal;
+    if (!is_horizontal || (m_has_batched_glyph_runs && m_batched_glyph_runs_color != command.color))
+        flush_batched_draws();
+
     auto sk_font = font.skia_font(command.scale);
-    SkTextBlobBuilder builder;
-    auto const& run = builder.allocRunPos(sk_font, glyphs.size());
+    auto translation = is_horizontal ? command.translation : Gfx::FloatPoint {};
+    if (!m_batched_glyph_runs)
+        m_batched_glyph_runs = make<SkTextBlobBuilder>();
+    auto const& run = m_batched_glyph_runs->allocRunPos(sk_font, glyphs.size());
 
     auto font_ascent = font.pixel_metrics().ascent;
     for (size_t i = 0; i < glyphs.size(); ++i) {
         run.glyphs[i] = glyphs[i].glyph_id;
-        run.pos[i * 2] = glyphs[i].position.x() * command.scale;
-        run.pos[i * 2 + 1] = (glyphs[i].position.y() + font_ascent) * command.scale;
+        run.pos[i * 2] = glyphs[i].position.x() * command.scale + translation.x();
+        run.pos[i * 2 + 1] = (glyphs[i].position.y() + font_ascent) * command.scale + translation.y();
     }
 
-    auto blob = builder.make();
+    m_batched_glyph_runs_color = command.color;
+    m_has_batched_glyph_runs = true;
+    if (is_horizontal)
+        return;
+
+    auto blob = m_batched_glyph_runs->make();
+    m_has_batched_glyph_runs = false;
     if (!blob)
         return;
 
@@ -209,20 +226,26 @@ void DisplayListPlayerSkia::play_command(DrawGlyphRun const& command)
     paint.setColor(to_skia_color(command.color));
 
     auto& canvas = surface().canvas();
-    auto const& translation = command.translation;
+    canvas.save();
+    canvas.translate(command.rect.width(), 0);
+    canvas.rotate(90, command.rect.top_left().x(), command.rect.top_left().y());
+    canvas.drawTextBlob(blob.get(), command.translation.x(), command.translation.y(), paint);
+    canvas.restore();
+}
 
-    switch (command.orientation) {
-    case Gfx::Orientation::Horizontal:
-        canvas.drawTextBlob(blob.get(), translation.x(), translation.y(), paint);
-        break;
-    case Gfx::Orientation::Vertical:
-        canvas.save();
-        canvas.translate(command.rect.width(), 0);
-        canvas.rotate(90, command.rect.top_left().x(), command.rect.top_left().y());
-        canvas.drawTextBlob(blob.get(), translation.x(), translation.y(), paint);
-        canvas.restore();
-        break;
-    }
+void DisplayListPlayerSkia::flush_batched_draws()
+{
+    if (!m_has_batched_glyph_runs)
+        return;
+    m_has_batched_glyph_runs = false;
+
+    auto blob = m_batched_glyph_runs->make();
+    if (!blob)
+        return;
+
+    SkPaint paint;
+    paint.setColor(to_skia_color(m_batched_glyph_runs_color));
+    surface().canvas().drawTextBlob(blob.get(), 0, 0, paint);
 }
 
 void DisplayListPlayerSkia::play_command(FillRect const& command)
@@ -284,12 +307,19 @@ void DisplayListPlayerSkia::play_command(DrawVideoFrame const& command)
     if (!frame)
         return;
 
+    auto yuv_data_or_error = frame->yuv_data();
+    if (yuv_data_or_error.is_error()) {
+        dbgln("Could not download video frame from the GPU: {}", yuv_data_or_error.release_error());
+        return;
+    }
+    auto const& yuv_data = *yuv_data_or_error.value();
+
     sk_sp<SkImage> image;
     auto* gr_context = m_skia_backend_context ? m_skia_backend_context->sk_context() : nullptr;
     if (gr_context) {
         image = SkImages::TextureFromYUVAPixmaps(
             gr_context,
-            frame->yuv_data().make_pixmaps(),
+            yuv_data.make_pixmaps(),
             skgpu::Mipmapped::kNo,
             false,
             frame->color_space().color_space<sk_sp<SkColorSpace>>());
@@ -297,7 +327,7 @@ void DisplayListPlayerSkia::play_command(DrawVideoFrame const& command)
 
     RefPtr<Gfx::Bitmap> converted_bitmap;
     if (!image) {
-        auto bitmap_or_error = frame->yuv_data().to_bitmap();
+        auto bitmap_or_error = yuv_data.to_bitmap();
         if (bitmap_or_error.is_error()) {
             dbgln("Could not convert video frame to bitmap: {}", bitmap_or_error.release_error());
             return;
@@ -659,13 +689,55 @@ void DisplayListPlayerSkia::play_command(PaintOuterBoxShadow const& command)
     auto& canvas = surface().canvas();
     canvas.save();
     canvas.clipRRect(content_rrect, SkClipOp::kDifference, true);
+    ScopeGuard guard = [&] { canvas.restore(); };
+
     SkPaint paint;
     paint.setAntiAlias(true);
     paint.setColor(to_skia_color(command.color));
     paint.setMaskFilter(SkMaskFilter::MakeBlur(kNormal_SkBlurStyle, command.blur_radius / 2));
+
+    // Large blurred shadows are expensive to rasterize, yet the same shadow is usually painted unchanged on every
+    // frame, often at a different position (scrolling, moving elements). Rasterize the blurred shape once into an
+    // image keyed by everything but its position, and composite that image afterwards. Like nested display list
+    // rasters, the cached image is only used under an integer translation, where it is pixel-identical to drawing
+    // the shadow directly; this also keeps the scale out of the key.
+    auto total_matrix = canvas.getTotalMatrix();
+    bool is_integer_translation = total_matrix.isTranslate()
+        && total_matrix.getTranslateX() == SkScalarFloorToScalar(total_matrix.getTranslateX())
+        && total_matrix.getTranslateY() == SkScalarFloorToScalar(total_matrix.getTranslateY());
+
+    if (m_skia_backend_context && is_integer_translation && command.blur_radius > 0 && !command.shadow_rect.is_empty()) {
+        // The blur spreads the shape by about three standard deviations (which are half the blur radius).
+        auto blur_extent = command.blur_radius * 3 / 2 + 2;
+        auto raster_rect = command.shadow_rect.inflated(blur_extent * 2, blur_extent * 2);
+        DisplayListBoxShadowRasterKey key {
+            .color = command.color,
+            .blur_radius = command.blur_radius,
+            .shadow_size = command.shadow_rect.size(),
+            .shadow_corner_radii = command.shadow_corner_radii,
+        };
+
+        auto image = resource_storage().cached_box_shadow_raster(key, m_skia_backend_context);
+        constexpr size_t max_box_shadow_raster_bytes = 8 * MiB;
+        if (!image && static_cast<size_t>(raster_rect.width()) * raster_rect.height() * 4 <= max_box_shadow_raster_bytes
+            && resource_storage().should_cache_box_shadow_raster(key)) {
+            auto offscreen_surface = Gfx::PaintingSurface::create_with_size(
+                raster_rect.size(), Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, m_skia_backend_context);
+            auto& offscreen_canvas = offscreen_surface->canvas();
+            offscreen_canvas.clear(SK_ColorTRANSPARENT);
+            offscreen_canvas.drawRRect(to_skia_rrect(command.shadow_rect.translated(-raster_rect.location()), command.shadow_corner_radii), paint);
+            image = offscreen_surface->sk_surface().makeImageSnapshot();
+            if (image)
+                resource_storage().add_cached_box_shadow_raster(key, m_skia_backend_context, image);
+        }
+        if (image) {
+            canvas.drawImage(image.get(), raster_rect.x(), raster_rect.y());
+            return;
+        }
+    }
+
     auto shadow_rounded_rect = to_skia_rrect(command.shadow_rect, command.shadow_corner_radii);
     canvas.drawRRect(shadow_rounded_rect, paint);
-    canvas.restore();
 }
 
 void DisplayListPlayerSkia::play_command(PaintInnerBoxShadow const& command)
@@ -711,6 +783,7 @@ void DisplayListPlayerSkia::play_command(PaintTextShadow const& command)
         .translation = command.draw_location + command.text_rect.location().to_type<float>(),
         .scale = command.scale,
         .color = command.color.with_alpha(255) });
+    flush_batched_draws();
     canvas.restore();
 }
 
@@ -1135,6 +1208,10 @@ void DisplayListPlayerSkia::play_command(CompositorStickyArea const&)
 {
 }
 
+void DisplayListPlayerSkia::play_command(CompositorScrollTimelineOpacityAnimation const&)
+{
+}
+
 void DisplayListPlayerSkia::play_command(CompositorWheelHitTestTarget const&)
 {
 }
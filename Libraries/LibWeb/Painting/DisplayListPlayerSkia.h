@@ -8,6 +8,7 @@
 
 #include <AK/Function.h>
 #include <AK/NonnullRefPtr.h>
+#include <AK/OwnPtr.h>
 #include <AK/RefPtr.h>
 #include <LibGfx/Forward.h>
 #include <LibWeb/Painting/DisplayList.h>
@@ -16,6 +17,7 @@
 
 class GrDirectContext;
 class SkPaint;
+class SkTextBlobBuilder;
 
 namespace Web::Painting {
 
@@ -51,6 +53,7 @@ private:
     Gfx::FloatMatrix4x4 canvas_matrix() const override;
 
     void add_clip_path(Gfx::Path const&, Gfx::WindingRule) override;
+    void flush_batched_draws() override;
 
     bool would_be_fully_clipped_by_painter(Gfx::IntRect) const override;
 
@@ -61,6 +64,11 @@ private:
 
     RefPtr<Gfx::SkiaBackendContext> m_skia_backend_context;
     CompositedContextResolver const* m_composited_context_resolver { nullptr };
+
+    // Horizontal glyph runs of the current batch, all painted with m_batched_glyph_runs_color.
+    OwnPtr<SkTextBlobBuilder> m_batched_glyph_runs;
+    Color m_batched_glyph_runs_color;
+    bool m_has_batched_glyph_runs { false };
 };
 
 }
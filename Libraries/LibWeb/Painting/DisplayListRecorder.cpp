@@ -750,6 +750,11 @@ void DisplayListRecorder::compositor_sticky_area(CompositorStickyArea const& sti
     append_command(sticky_area);
 }
 
+void DisplayListRecorder::compositor_scroll_timeline_opacity_animation(CompositorScrollTimelineOpacityAnimation const& animation)
+{
+    append_command(animation);
+}
+
 void DisplayListRecorder::compositor_wheel_hit_test_target(CompositorWheelHitTestTarget const& target)
 {
     append_command(target);
@@ -134,6 +134,7 @@ public:
 
     void compositor_scroll_node(CompositorScrollNode const&);
     void compositor_sticky_area(CompositorStickyArea const&);
+    void compositor_scroll_timeline_opacity_animation(CompositorScrollTimelineOpacityAnimation const&);
     void compositor_wheel_hit_test_target(CompositorWheelHitTestTarget const&);
     void compositor_wheel_hit_test_target_with_corner_radii(CompositorWheelHitTestTargetWithCornerRadii const&);
     void set_async_scrolling_metadata(DisplayList::AsyncScrollingMetadata);
@@ -11,6 +11,7 @@
 #include <LibMedia/VideoFrame.h>
 #include <LibWeb/Painting/DisplayList.h>
 #include <LibWeb/Painting/DisplayListResourceStorage.h>
+#include <LibWeb/Painting/ImageTextureCache.h>
 
 #include <core/SkImage.h>
 #include <gpu/ganesh/GrDirectContext.h>
@@ -75,8 +76,27 @@ struct DisplayListCachedNestedRasterResource {
     Vector<Raster> rasters;
 };
 
-static sk_sp<SkImage> create_skia_image(Gfx::DecodedImageFrame const& frame, RefPtr<Gfx::SkiaBackendContext> const& skia_backend_context)
+struct DisplayListCachedBoxShadowRaster {
+    explicit DisplayListCachedBoxShadowRaster(DisplayListBoxShadowRasterKey key)
+        : key(move(key))
+    {
+    }
+
+    size_t byte_size() const { return image ? static_cast<size_t>(image->width()) * image->height() * 4 : 0; }
+
+    DisplayListBoxShadowRasterKey key;
+    // Null until the shadow has been painted a second time; see should_cache_box_shadow_raster().
+    sk_sp<SkImage> image;
+    MonotonicTime last_used { MonotonicTime::now() };
+};
+
+static sk_sp<SkImage> create_skia_image(Gfx::DecodedImageFrame const& frame, RefPtr<Gfx::SkiaBackendContext> const& skia_backend_context, ImageTextureCache* image_texture_cache)
 {
+    if (image_texture_cache && skia_backend_context) {
+        if (auto texture_image = image_texture_cache->texture_for_frame(frame, *skia_backend_context))
+            return texture_image;
+    }
+
     auto raster_image = Gfx::sk_image_from_bitmap(frame.bitmap(), frame.color_space());
     auto* gr_context = skia_backend_context ? skia_backend_context->sk_context() : nullptr;
     if (!gr_context)
@@ -88,12 +108,12 @@ static sk_sp<SkImage> create_skia_image(Gfx::DecodedImageFrame const& frame, Ref
     return raster_image;
 }
 
-static sk_sp<SkImage> skia_image_for_stored_image_frame(DisplayListStoredImageFrameResource const& resource, RefPtr<Gfx::SkiaBackendContext> const& skia_backend_context)
+static sk_sp<SkImage> skia_image_for_stored_image_frame(DisplayListStoredImageFrameResource const& resource, RefPtr<Gfx::SkiaBackendContext> const& skia_backend_context, ImageTextureCache* image_texture_cache)
 {
     if (resource.skia_image && resource.skia_backend_context.ptr() == skia_backend_context.ptr())
         return resource.skia_image;
 
-    resource.skia_image = create_skia_image(resource.frame, skia_backend_context);
+    resource.skia_image = create_skia_image(resource.frame, skia_backend_context, image_texture_cache);
     resource.skia_backend_context = skia_backend_context;
     return resource.skia_image;
 }
@@ -194,7 +214,17 @@ Gfx::DecodedImageFrame const& DisplayListResourceStorage::image_frame(ImageFrame
 
 sk_sp<SkImage> DisplayListResourceStorage::skia_image_for_image_frame(ImageFrameResourceId id, RefPtr<Gfx::SkiaBackendContext> const& skia_backend_context) const
 {
-    return skia_image_for_stored_image_frame(*m_image_frames.get(id.value()).value(), skia_backend_context);
+    return skia_image_for_stored_image_frame(*m_image_frames.get(id.value()).value(), skia_backend_context, m_image_texture_cache);
+}
+
+void DisplayListResourceStorage::upload_image_frames(ReadonlySpan<ImageFrameResourceId> ids, RefPtr<Gfx::SkiaBackendContext> const& skia_backend_context) const
+{
+    if (!skia_backend_context || !skia_backend_context->sk_context())
+        return;
+    for (auto id : ids) {
+        if (auto resource = m_image_frames.get(id.value()); resource.has_value())
+            (void)skia_image_for_stored_image_frame(*resource.value(), skia_backend_context, m_image_texture_cache);
+    }
 }
 
 sk_sp<SkImage> DisplayListResourceStorage::cached_skia_image_for_display_list(DisplayListResourceId id, Gfx::IntSize tile_size, RefPtr<Gfx::SkiaBackendContext> const& skia_backend_context) const
@@ -296,6 +326,74 @@ bool DisplayListResourceStorage::should_cache_nested_display_list_raster(Display
     return !nested_display_list_requires_direct_replay(id, visited_display_lists);
 }
 
+sk_sp<SkImage> DisplayListResourceStorage::cached_box_shadow_raster(DisplayListBoxShadowRasterKey const& key, RefPtr<Gfx::SkiaBackendContext> const& skia_backend_context) const
+{
+    if (m_cached_box_shadow_rasters_skia_backend_context.ptr() != skia_backend_context.ptr())
+        return nullptr;
+
+    for (size_t i = 0; i < m_cached_box_shadow_rasters.size(); ++i) {
+        if (m_cached_box_shadow_rasters[i]->key != key || !m_cached_box_shadow_rasters[i]->image)
+            continue;
+        if (i != 0) {
+            auto raster = m_cached_box_shadow_rasters.take(i);
+            m_cached_box_shadow_rasters.prepend(move(raster));
+        }
+        auto& raster = *m_cached_box_shadow_rasters.first();
+        raster.last_used = MonotonicTime::now();
+        return raster.image;
+    }
+    return nullptr;
+}
+
+void DisplayListResourceStorage::add_cached_box_shadow_raster(DisplayListBoxShadowRasterKey const& key, RefPtr<Gfx::SkiaBackendContext> const& skia_backend_context, sk_sp<SkImage> image) const
+{
+    VERIFY(image);
+    if (m_cached_box_shadow_rasters_skia_backend_context.ptr() != skia_backend_context.ptr()) {
+        m_cached_box_shadow_rasters.clear();
+        m_cached_box_shadow_rasters_skia_backend_context = skia_backend_context;
+    }
+
+    // Box shadow rasters are not tied to any display list, so they stay around until the budget pushes them out.
+    // Same policy as the nested display list rasters: evict entries outside the recently used working set, and
+    // skip caching if the working set alone exceeds the budget.
+    constexpr size_t max_box_shadow_raster_cache_bytes = 64 * MiB;
+    auto total_bytes = static_cast<size_t>(image->width()) * image->height() * 4;
+    for (auto const& raster : m_cached_box_shadow_rasters)
+        total_bytes += raster->byte_size();
+    if (total_bytes > max_box_shadow_raster_cache_bytes) {
+        auto now = MonotonicTime::now();
+        m_cached_box_shadow_rasters.remove_all_matching([&](auto const& raster) {
+            if (!raster->image || now - raster->last_used < AK::Duration::from_milliseconds(250))
+                return false;
+            total_bytes -= raster->byte_size();
+            return true;
+        });
+        if (total_bytes > max_box_shadow_raster_cache_bytes)
+            return;
+    }
+
+    auto index = m_cached_box_shadow_rasters.find_first_index_if([&](auto const& raster) { return raster->key == key; });
+    auto raster = index.has_value() ? m_cached_box_shadow_rasters.take(*index) : make<DisplayListCachedBoxShadowRaster>(key);
+    raster->image = move(image);
+    raster->last_used = MonotonicTime::now();
+    m_cached_box_shadow_rasters.prepend(move(raster));
+}
+
+bool DisplayListResourceStorage::should_cache_box_shadow_raster(DisplayListBoxShadowRasterKey const& key) const
+{
+    // Like nested display lists, only rasterize a shadow the second time it is painted, so shadows whose geometry
+    // changes on every frame (e.g. while an element is resized by a transition) keep painting directly instead of
+    // paying for an offscreen rasterization that is never reused.
+    if (m_cached_box_shadow_rasters.find_first_index_if([&](auto const& raster) { return raster->key == key; }).has_value())
+        return true;
+
+    static constexpr size_t max_box_shadow_rasters = 256;
+    if (m_cached_box_shadow_rasters.size() >= max_box_shadow_rasters)
+        m_cached_box_shadow_rasters.take_last();
+    m_cached_box_shadow_rasters.prepend(make<DisplayListCachedBoxShadowRaster>(key));
+    return false;
+}
+
 // Determines whether reusing a rasterization of the display list can produce different pixels than replaying it
 // in place on every frame. That is the case when a destination-reading operation (a non-normal blend mode or a
 // backdrop filter) can see canvas content painted before the display list began, or when the list draws live
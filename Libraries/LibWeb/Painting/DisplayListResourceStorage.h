@@ -16,6 +16,8 @@
 #include <AK/RefPtr.h>
 #include <AK/Span.h>
 #include <AK/Vector.h>
+#include <LibGfx/Color.h>
+#include <LibGfx/CornerRadii.h>
 #include <LibGfx/DecodedImageFrame.h>
 #include <LibGfx/Forward.h>
 #include <LibIPC/Forward.h>
@@ -59,6 +61,17 @@ struct DisplayListVideoFrameResource {
 struct DisplayListStoredImageFrameResource;
 struct DisplayListCachedSkiaImageResource;
 struct DisplayListCachedNestedRasterResource;
+struct DisplayListCachedBoxShadowRaster;
+
+// Everything that determines the pixels of a blurred outer box shadow, apart from its position.
+struct DisplayListBoxShadowRasterKey {
+    Gfx::Color color;
+    int blur_radius { 0 };
+    Gfx::IntSize shadow_size;
+    Gfx::CornerRadii shadow_corner_radii;
+
+    bool operator==(DisplayListBoxShadowRasterKey const&) const = default;
+};
 
 struct DisplayListResource {
     DisplayListResource(NonnullRefPtr<DisplayList>, AccumulatedVisualContextTree);
@@ -109,11 +122,20 @@ public:
     Gfx::Font const& font(FontResourceId id) const { return *m_fonts.get(id.value()).value(); }
     Gfx::DecodedImageFrame const& image_frame(ImageFrameResourceId) const;
     sk_sp<SkImage> skia_image_for_image_frame(ImageFrameResourceId, RefPtr<Gfx::SkiaBackendContext> const&) const;
+
+    // Image frame textures are looked up in this cache before being uploaded, so identical frames share one texture.
+    void set_image_texture_cache(ImageTextureCache* image_texture_cache) { m_image_texture_cache = image_texture_cache; }
+
+    // Uploads the given image frames ahead of the first paint that uses them.
+    void upload_image_frames(ReadonlySpan<ImageFrameResourceId>, RefPtr<Gfx::SkiaBackendContext> const&) const;
     sk_sp<SkImage> cached_skia_image_for_display_list(DisplayListResourceId, Gfx::IntSize, RefPtr<Gfx::SkiaBackendContext> const&) const;
     void set_cached_skia_image_for_display_list(DisplayListResourceId, Gfx::IntSize, RefPtr<Gfx::SkiaBackendContext> const&, sk_sp<SkImage>) const;
     sk_sp<SkImage> cached_nested_display_list_raster(DisplayListResourceId, RefPtr<Gfx::SkiaBackendContext> const&, Gfx::IntRect visible_rect_in_list_space, Gfx::IntRect& raster_rect_in_list_space) const;
     void add_cached_nested_display_list_raster(DisplayListResourceId, RefPtr<Gfx::SkiaBackendContext> const&, Gfx::IntRect rect_in_list_space, sk_sp<SkImage>) const;
     bool should_cache_nested_display_list_raster(DisplayListResourceId) const;
+    sk_sp<SkImage> cached_box_shadow_raster(DisplayListBoxShadowRasterKey const&, RefPtr<Gfx::SkiaBackendContext> const&) const;
+    void add_cached_box_shadow_raster(DisplayListBoxShadowRasterKey const&, RefPtr<Gfx::SkiaBackendContext> const&, sk_sp<SkImage>) const;
+    bool should_cache_box_shadow_raster(DisplayListBoxShadowRasterKey const&) const;
     RefPtr<Media::VideoFrame const> video_frame(VideoFrameResourceId id) const { return m_video_frames.get(id.value()).value(); }
     DisplayListResource const& display_list_resource(DisplayListResourceId id) const { return m_display_lists.get(id.value()).value(); }
     DisplayList const& display_list(DisplayListResourceId id) const { return *display_list_resource(id).display_list; }
@@ -131,6 +153,9 @@ private:
     HashMap<u64, DisplayListResource> m_display_lists;
     mutable HashMap<u64, NonnullOwnPtr<DisplayListCachedSkiaImageResource>> m_display_list_cached_skia_images;
     mutable HashMap<u64, NonnullOwnPtr<DisplayListCachedNestedRasterResource>> m_display_list_cached_nested_rasters;
+    mutable Vector<NonnullOwnPtr<DisplayListCachedBoxShadowRaster>> m_cached_box_shadow_rasters;
+    mutable RefPtr<Gfx::SkiaBackendContext> m_cached_box_shadow_rasters_skia_backend_context;
+    ImageTextureCache* m_image_texture_cache { nullptr };
 };
 
 }
@@ -17,6 +17,7 @@
 namespace Web::Painting {
 
 static constexpr double spatial_index_cell_size = 128.0;
+static constexpr double spatial_index_coarse_cell_size = 2048.0;
 static constexpr size_t max_bucketed_cells_per_item = 64;
 // Treat small block-axis gaps between caret line fragments as the same visual row.
 static constexpr CSSPixels caret_line_block_axis_range_slop = 4;
@@ -25,9 +26,9 @@ static constexpr CSSPixels caret_line_block_axis_compare_slop = 12;
 // Within the chosen line, tolerate larger block-axis differences before snapping across inline gaps.
 static constexpr CSSPixels caret_item_block_axis_compare_slop = 32;
 
-static i32 spatial_index_cell_for(CSSPixels offset)
+static i32 spatial_index_cell_for(CSSPixels offset, double cell_size = spatial_index_cell_size)
 {
-    return static_cast<i32>(floor(offset.to_double() / spatial_index_cell_size));
+    return static_cast<i32>(floor(offset.to_double() / cell_size));
 }
 
 static u64 spatial_index_cell_key(i32 x, i32 y)
@@ -400,26 +401,49 @@ void HitTestDisplayList::add_item_to_spatial_index(size_t item_index) const
         return;
     }
 
-    auto min_x = spatial_index_cell_for(item.rect.left());
-    auto max_x = spatial_index_cell_for(item.rect.right());
-    auto min_y = spatial_index_cell_for(item.rect.top());
-    auto max_y = spatial_index_cell_for(item.rect.bottom());
-    auto column_count = static_cast<i64>(max_x) - min_x + 1;
-    auto row_count = static_cast<i64>(max_y) - min_y + 1;
-    if (column_count <= 0 || row_count <= 0) {
-        spatial_index.unbucketed_items.append(item_index);
+    auto try_add_to_grid = [&](HashMap<u64, Vector<size_t>>& cells, double cell_size) {
+        auto min_x = spatial_index_cell_for(item.rect.left(), cell_size);
+        auto max_x = spatial_index_cell_for(item.rect.right(), cell_size);
+        auto min_y = spatial_index_cell_for(item.rect.top(), cell_size);
+        auto max_y = spatial_index_cell_for(item.rect.bottom(), cell_size);
+        auto column_count = static_cast<i64>(max_x) - min_x + 1;
+        auto row_count = static_cast<i64>(max_y) - min_y + 1;
+        if (column_count <= 0 || row_count <= 0)
+            return false;
+        auto cell_count = static_cast<u64>(column_count) * static_cast<u64>(row_count);
+        if (cell_count > max_bucketed_cells_per_item)
+            return false;
+
+        for (auto y = min_y; y <= max_y; ++y) {
+            for (auto x = min_x; x <= max_x; ++x)
+                cells.ensure(spatial_index_cell_key(x, y)).append(item_index);
+        }
+        return true;
+    };
+
+    if (try_add_to_grid(spatial_index.cells, spatial_index_cell_size))
         return;
-    }
-    auto cell_count = static_cast<u64>(column_count) * static_cast<u64>(row_count);
-    if (cell_count > max_bucketed_cells_per_item) {
-        spatial_index.unbucketed_items.append(item_index);
+    if (try_add_to_grid(spatial_index.coarse_cells, spatial_index_coarse_cell_size))
         return;
-    }
+    spatial_index.unbucketed_items.append(item_index);
+}
 
-    for (auto y = min_y; y <= max_y; ++y) {
-        for (auto x = min_x; x <= max_x; ++x)
-            spatial_index.cells.ensure(spatial_index_cell_key(x, y)).append(item_index);
-    }
+// Visits every list of item indices that may contain an item hit at local_point. Each list is in paint order, but
+// an item appears in at most one of them for a given point.
+template<typename Callback>
+void HitTestDisplayList::for_each_spatial_index_list_containing(SpatialIndex const& spatial_index, CSSPixelPoint local_point, Callback&& callback) const
+{
+    callback(spatial_index.unbucketed_items);
+
+    auto coarse_x = spatial_index_cell_for(local_point.x(), spatial_index_coarse_cell_size);
+    auto coarse_y = spatial_index_cell_for(local_point.y(), spatial_index_coarse_cell_size);
+    if (auto bucket = spatial_index.coarse_cells.get(spatial_index_cell_key(coarse_x, coarse_y)); bucket.has_value())
+        callback(*bucket);
+
+    auto x = spatial_index_cell_for(local_point.x());
+    auto y = spatial_index_cell_for(local_point.y());
+    if (auto bucket = spatial_index.cells.get(spatial_index_cell_key(x, y)); bucket.has_value())
+        callback(*bucket);
 }
 
 bool HitTestDisplayList::item_can_produce_caret_position(Item const& item) const
@@ -1045,15 +1069,10 @@ Optional<CaretPosition> HitTestDisplayList::caret_position_from_point(CSSPixelPo
 
         auto previous_topmost_item_index = topmost_item_index;
         auto previous_topmost_hit_item_index = topmost_hit_item_index;
-        find_topmost_item_in_list(spatial_index->unbucketed_items, *local_point, chrome_metrics, topmost_hit_item_index);
-        find_topmost_caret_item_in_list(spatial_index->unbucketed_items, *local_point, chrome_metrics, topmost_item_index);
-
-        auto x = spatial_index_cell_for(local_point->x());
-        auto y = spatial_index_cell_for(local_point->y());
-        if (auto bucket = spatial_index->cells.get(spatial_index_cell_key(x, y)); bucket.has_value()) {
-            find_topmost_item_in_list(*bucket, *local_point, chrome_metrics, topmost_hit_item_index);
-            find_topmost_caret_item_in_list(*bucket, *local_point, chrome_metrics, topmost_item_index);
-        }
+        for_each_spatial_index_list_containing(*spatial_index, *local_point, [&](Vector<size_t> const& item_indices) {
+            find_topmost_item_in_list(item_indices, *local_point, chrome_metrics, topmost_hit_item_index);
+            find_topmost_caret_item_in_list(item_indices, *local_point, chrome_metrics, topmost_item_index);
+        });
 
         if (topmost_item_index != previous_topmost_item_index)
             topmost_item_local_point = local_point;
@@ -1294,12 +1313,9 @@ Optional<HitTestResult> HitTestDisplayList::hit_test(CSSPixelPoint point, HitTes
             continue;
 
         auto previous_topmost_item_index = topmost_item_index;
-        find_topmost_item_in_list(spatial_index->unbucketed_items, *local_point, chrome_metrics, topmost_item_index);
-
-        auto x = spatial_index_cell_for(local_point->x());
-        auto y = spatial_index_cell_for(local_point->y());
-        if (auto bucket = spatial_index->cells.get(spatial_index_cell_key(x, y)); bucket.has_value())
-            find_topmost_item_in_list(*bucket, *local_point, chrome_metrics, topmost_item_index);
+        for_each_spatial_index_list_containing(*spatial_index, *local_point, [&](Vector<size_t> const& item_indices) {
+            find_topmost_item_in_list(item_indices, *local_point, chrome_metrics, topmost_item_index);
+        });
 
         if (topmost_item_index != previous_topmost_item_index)
             topmost_item_local_point = local_point;
@@ -1335,12 +1351,9 @@ TraversalDecision HitTestDisplayList::hit_test_all(CSSPixelPoint point, Viewport
         if (!local_point.has_value())
             continue;
 
-        find_items_in_list(spatial_index->unbucketed_items, *local_point, chrome_metrics, hit_item_indices);
-
-        auto x = spatial_index_cell_for(local_point->x());
-        auto y = spatial_index_cell_for(local_point->y());
-        if (auto bucket = spatial_index->cells.get(spatial_index_cell_key(x, y)); bucket.has_value())
-            find_items_in_list(*bucket, *local_point, chrome_metrics, hit_item_indices);
+        for_each_spatial_index_list_containing(*spatial_index, *local_point, [&](Vector<size_t> const& item_indices) {
+            find_items_in_list(item_indices, *local_point, chrome_metrics, hit_item_indices);
+        });
     }
 
     quick_sort(hit_item_indices, [](auto a, auto b) { return a > b; });
@@ -104,8 +104,12 @@ private:
         Gfx::WindingRule winding_rule { Gfx::WindingRule::Nonzero };
     };
 
+    // A two-level uniform grid: items are bucketed into fine cells, items spanning too many fine cells (page-wide
+    // sections, full-height columns) into coarse cells, and only items too large even for that stay unbucketed and
+    // are tested on every query.
     struct SpatialIndex {
         HashMap<u64, Vector<size_t>> cells;
+        HashMap<u64, Vector<size_t>> coarse_cells;
         Vector<size_t> unbucketed_items;
     };
 
@@ -131,6 +135,8 @@ private:
     void add_item_to_spatial_index(size_t item_index) const;
     void add_item_to_caret_items(size_t item_index) const;
     SpatialIndex& spatial_index_for(VisualContextIndex) const;
+    template<typename Callback>
+    void for_each_spatial_index_list_containing(SpatialIndex const&, CSSPixelPoint local_point, Callback&&) const;
 
     [[nodiscard]] Optional<CSSPixelPoint> local_point_for_visual_context(VisualContextIndex, CSSPixelPoint, ViewportPaintable const&, double device_pixels_per_css_pixel, AccumulatedVisualContextTree::ClipBehavior = AccumulatedVisualContextTree::ClipBehavior::Respect) const;
     [[nodiscard]] CSSPixelRect viewport_rect_for_item(Item const&, CSSPixelRect const&, ViewportPaintable const&, double device_pixels_per_css_pixel) const;
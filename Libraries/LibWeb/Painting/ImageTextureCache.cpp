@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/NumericLimits.h>
+#include <LibGfx/SkiaBackendContext.h>
+#include <LibGfx/SkiaUtils.h>
+#include <LibWeb/Painting/ImageTextureCache.h>
+
+#include <core/SkColorSpace.h>
+#include <core/SkImage.h>
+#include <gpu/ganesh/GrDirectContext.h>
+#include <gpu/ganesh/SkImageGanesh.h>
+#include <string.h>
+
+namespace Web::Painting {
+
+struct ImageTextureCacheEntry {
+    // Kept so that a frame with the same hash can be checked for identical pixels before its texture is reused.
+    NonnullRefPtr<Gfx::Bitmap const> bitmap;
+    Gfx::ColorSpace color_space;
+    RefPtr<Gfx::SkiaBackendContext> skia_backend_context;
+    sk_sp<SkImage> texture;
+    size_t byte_size { 0 };
+    u64 last_use_serial { 0 };
+};
+
+static size_t row_size_in_bytes(Gfx::Bitmap const& bitmap)
+{
+    return static_cast<size_t>(bitmap.width()) * sizeof(Gfx::RawPixel);
+}
+
+static u64 hash_pixels(Gfx::Bitmap const& bitmap)
+{
+    u64 hash = (static_cast<u64>(bitmap.width()) << 32) | static_cast<u32>(bitmap.height());
+    hash ^= static_cast<u64>(bitmap.format()) << 56 | static_cast<u64>(bitmap.alpha_type()) << 48;
+
+    auto row_size = row_size_in_bytes(bitmap);
+    for (int y = 0; y < bitmap.height(); ++y) {
+        auto const* row = reinterpret_cast<u8 const*>(bitmap.scanline(y));
+        size_t i = 0;
+        for (; i + sizeof(u64) <= row_size; i += sizeof(u64)) {
+            u64 word;
+            memcpy(&word, row + i, sizeof(word));
+            hash = (hash ^ word) * 0x9e3779b97f4a7c15ull;
+            hash ^= hash >> 29;
+        }
+        for (; i < row_size; ++i)
+            hash = (hash ^ row[i]) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+static bool is_identical_frame(ImageTextureCacheEntry const& entry, Gfx::DecodedImageFrame const& frame)
+{
+    auto const& bitmap = frame.bitmap();
+    if (!SkColorSpace::Equals(entry.color_space.color_space<sk_sp<SkColorSpace>>().get(), frame.color_space().color_space<sk_sp<SkColorSpace>>().get()))
+        return false;
+    if (entry.bitmap.ptr() == &bitmap)
+        return true;
+    if (entry.bitmap->size() != bitmap.size() || entry.bitmap->format() != bitmap.format() || entry.bitmap->alpha_type() != bitmap.alpha_type())
+        return false;
+
+    auto row_size = row_size_in_bytes(bitmap);
+    for (int y = 0; y < bitmap.height(); ++y) {
+        if (memcmp(entry.bitmap->scanline(y), bitmap.scanline(y), row_size) != 0)
+            return false;
+    }
+    return true;
+}
+
+ImageTextureCache::ImageTextureCache(size_t budget_in_bytes)
+    : m_budget_in_bytes(budget_in_bytes)
+{
+}
+
+ImageTextureCache::~ImageTextureCache() = default;
+
+sk_sp<SkImage> ImageTextureCache::texture_for_frame(Gfx::DecodedImageFrame const& frame, Gfx::SkiaBackendContext& skia_backend_context)
+{
+    auto* gr_context = skia_backend_context.sk_context();
+    if (!gr_context)
+        return nullptr;
+
+    auto hash = hash_pixels(frame.bitmap());
+    if (auto it = m_entries.find(hash); it != m_entries.end()) {
+        auto& entry = *it->value;
+        if (entry.skia_backend_context.ptr() == &skia_backend_context && is_identical_frame(entry, frame)) {
+            entry.last_use_serial = ++m_next_use_serial;
+            return entry.texture;
+        }
+
+        // Either the GPU context was replaced, or two different frames happen to have the same hash.
+        m_size_in_bytes -= entry.byte_size;
+        m_entries.remove(it);
+    }
+
+    auto raster_image = Gfx::sk_image_from_bitmap(frame.bitmap(), frame.color_space());
+    auto texture = SkImages::TextureFromImage(gr_context, raster_image.get(), skgpu::Mipmapped::kNo, skgpu::Budgeted::kYes);
+    if (!texture)
+        return nullptr;
+
+    auto byte_size = row_size_in_bytes(frame.bitmap()) * frame.height();
+    if (byte_size > m_budget_in_bytes)
+        return texture;
+
+    evict_least_recently_used_entries(byte_size);
+    auto entry = adopt_own(*new ImageTextureCacheEntry {
+        .bitmap = frame.bitmap_ref(),
+        .color_space = frame.color_space(),
+        .skia_backend_context = skia_backend_context,
+        .texture = texture,
+        .byte_size = byte_size,
+        .last_use_serial = ++m_next_use_serial,
+    });
+    m_entries.set(hash, move(entry));
+    m_size_in_bytes += byte_size;
+    return texture;
+}
+
+void ImageTextureCache::evict_least_recently_used_entries(size_t bytes_needed)
+{
+    while (m_size_in_bytes + bytes_needed > m_budget_in_bytes) {
+        // Textures that are still held by a display list resource storage would not be freed by evicting them.
+        Optional<u64> least_recently_used_hash;
+        u64 least_recent_use_serial = NumericLimits<u64>::max();
+        for (auto const& it : m_entries) {
+            if (!it.value->texture->unique() || it.value->last_use_serial >= least_recent_use_serial)
+                continue;
+            least_recently_used_hash = it.key;
+            least_recent_use_serial = it.value->last_use_serial;
+        }
+        if (!least_recently_used_hash.has_value())
+            return;
+
+        m_size_in_bytes -= m_entries.get(*least_recently_used_hash).value()->byte_size;
+        m_entries.remove(*least_recently_used_hash);
+    }
+}
+
+}
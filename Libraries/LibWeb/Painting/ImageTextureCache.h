@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <LibGfx/DecodedImageFrame.h>
+#include <LibGfx/Forward.h>
+#include <LibWeb/Export.h>
+
+class SkImage;
+
+template<typename T>
+class sk_sp;
+
+namespace Web::Painting {
+
+struct ImageTextureCacheEntry;
+
+// GPU textures of decoded image frames, shared by every display list resource storage that is handed this cache.
+// Frames are matched by their pixels rather than by their id, since ids are only unique within the process that
+// decoded the image. That way the same logo or sprite sheet shown by several pages is only uploaded once.
+class WEB_API ImageTextureCache {
+    AK_MAKE_NONCOPYABLE(ImageTextureCache);
+    AK_MAKE_NONMOVABLE(ImageTextureCache);
+
+public:
+    static constexpr size_t default_budget_in_bytes = 256 * MiB;
+
+    explicit ImageTextureCache(size_t budget_in_bytes = default_budget_in_bytes);
+    ~ImageTextureCache();
+
+    // Returns a texture holding the frame's pixels, uploading them if no identical frame has been uploaded yet.
+    // Returns null if there is no GPU context or the upload failed.
+    sk_sp<SkImage> texture_for_frame(Gfx::DecodedImageFrame const&, Gfx::SkiaBackendContext&);
+
+    size_t size_in_bytes() const { return m_size_in_bytes; }
+
+private:
+    void evict_least_recently_used_entries(size_t bytes_needed);
+
+    // Keyed by a hash of the frame's pixels.
+    HashMap<u64, NonnullOwnPtr<ImageTextureCacheEntry>> m_entries;
+    size_t m_budget_in_bytes { 0 };
+    size_t m_size_in_bytes { 0 };
+    u64 m_next_use_serial { 0 };
+};
+
+}
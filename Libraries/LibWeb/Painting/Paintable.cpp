@@ -13,6 +13,10 @@
 #include <AK/Utf16StringBuilder.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/Font/Font.h>
+#include <LibWeb/Animations/Animation.h>
+#include <LibWeb/Animations/KeyframeEffect.h>
+#include <LibWeb/Animations/ScrollTimeline.h>
+#include <LibWeb/CSS/CSSAnimation.h>
 #include <LibWeb/CSS/ComputedProperties.h>
 #include <LibWeb/CSS/ComputedValues.h>
 #include <LibWeb/CSS/StyleScope.h>
@@ -22,6 +26,7 @@
 #include <LibWeb/CSS/StyleValues/ImageStyleValue.h>
 #include <LibWeb/CSS/StyleValues/KeywordStyleValue.h>
 #include <LibWeb/CSS/StyleValues/NumberStyleValue.h>
+#include <LibWeb/CSS/StyleValues/OpacityValueStyleValue.h>
 #include <LibWeb/CSS/StyleValues/StyleValueList.h>
 #include <LibWeb/CSS/StyleValues/URLStyleValue.h>
 #include <LibWeb/CSS/SystemColor.h>
@@ -1572,6 +1577,136 @@ Optional<Paintable::ScrollbarData> Paintable::compute_scrollbar_data(ScrollDirec
     return scrollbar_data;
 }
 
+static bool is_identity_easing(CSS::EasingFunction const& easing)
+{
+    auto const* linear = easing.get_pointer<CSS::LinearEasingFunction>();
+    return linear && *linear == CSS::EasingFunction::linear().get<CSS::LinearEasingFunction>();
+}
+
+static Optional<float> keyframe_opacity(Animations::KeyframeEffect::KeyFrameSet::ResolvedKeyFrame const& keyframe)
+{
+    if (keyframe.composite != Bindings::CompositeOperationOrAuto::Auto && keyframe.composite != Bindings::CompositeOperationOrAuto::Replace)
+        return {};
+
+    auto opacity = keyframe.properties.get(CSS::PropertyID::Opacity);
+    if (!opacity.has_value() || !opacity->has<NonnullRefPtr<CSS::StyleValue const>>())
+        return {};
+
+    auto const& value = opacity->get<NonnullRefPtr<CSS::StyleValue const>>();
+    Optional<double> resolved_opacity;
+    if (value->is_opacity_value())
+        resolved_opacity = value->as_opacity_value().resolved_without_computation_context();
+    else if (value->is_number())
+        resolved_opacity = clamp(value->as_number().number(), 0, 1);
+    if (!resolved_opacity.has_value())
+        return {};
+    return static_cast<float>(*resolved_opacity);
+}
+
+static bool animates_opacity(Animations::Animation const& animation)
+{
+    auto* effect = as_if<Animations::KeyframeEffect>(animation.effect().ptr());
+    if (!effect || !effect->key_frame_set())
+        return false;
+    for (auto const& keyframe : effect->key_frame_set()->keyframes_by_key) {
+        if (keyframe.properties.contains(CSS::PropertyID::Opacity))
+            return true;
+    }
+    return false;
+}
+
+// Scroll-driven opacity animations that reduce to a straight line between two keyframes can be evaluated by the
+// compositor against its own scroll offsets, so the animation stays in sync with async scrolling instead of lagging a
+// frame behind it. Anything more involved keeps being animated by the main thread alone.
+static void record_scroll_timeline_opacity_animation(Paintable const& paintable_box, DisplayListRecordingContext& context)
+{
+    auto const* element = as_if<DOM::Element>(paintable_box.dom_node().ptr());
+    if (!element || paintable_box.layout_node().is_generated_for_pseudo_element() || !element->has_relevant_animations())
+        return;
+
+    GC::Ptr<Animations::Animation> opacity_animation;
+    for (auto const& animation : MUST(const_cast<DOM::Element&>(*element).get_animations_internal(Animations::Animatable::GetAnimationsSorted::No))) {
+        if (!animates_opacity(*animation))
+            continue;
+        // NB: Several animations of the same property have to be composited with each other, which needs the main thread.
+        if (opacity_animation)
+            return;
+        opacity_animation = animation;
+    }
+    if (!opacity_animation)
+        return;
+
+    auto const* timeline = as_if<Animations::ScrollTimeline>(opacity_animation->timeline().ptr());
+    if (!timeline || opacity_animation->play_state() != Bindings::AnimationPlayState::Running || opacity_animation->pending() || opacity_animation->playback_rate() != 1)
+        return;
+    auto start_time = opacity_animation->start_time();
+    if (!start_time.has_value() || start_time->value != 0)
+        return;
+
+    auto& effect = as<Animations::KeyframeEffect>(*opacity_animation->effect());
+    if (effect.pseudo_element_type().has_value()
+        || effect.composite() != Bindings::CompositeOperation::Replace
+        || effect.start_delay().value != 0
+        || effect.end_delay().value != 0
+        || effect.iteration_start() != 0
+        || effect.iteration_count() != 1
+        || effect.iteration_duration().type != Animations::TimeValue::Type::Percentage
+        || effect.iteration_duration().value != 100
+        || effect.playback_direction() != Bindings::PlaybackDirection::Normal
+        || !is_identity_easing(effect.timing_function()))
+        return;
+
+    auto const& keyframes = effect.key_frame_set()->keyframes_by_key;
+    if (keyframes.size() != 2)
+        return;
+    auto from_keyframe = keyframes.begin();
+    auto to_keyframe = from_keyframe;
+    ++to_keyframe;
+    if (from_keyframe.key() != 0 || to_keyframe.key() != 100 * Animations::KeyframeEffect::AnimationKeyFrameKeyScaleFactor)
+        return;
+    // NB: The easing of a keyframe applies to the interval that follows it. CSS animations fall back to animation-timing-function.
+    auto const& from_keyframe_easing = from_keyframe->easing;
+    if (from_keyframe_easing.has<NonnullRefPtr<CSS::StyleValue const>>())
+        return;
+    if (auto const* easing = from_keyframe_easing.get_pointer<CSS::EasingFunction>(); easing && !is_identity_easing(*easing))
+        return;
+    if (auto const* css_animation = as_if<CSS::CSSAnimation>(*opacity_animation); from_keyframe_easing.has<Empty>() && css_animation && !is_identity_easing(css_animation->default_easing()))
+        return;
+
+    auto from_opacity = keyframe_opacity(*from_keyframe);
+    auto to_opacity = keyframe_opacity(*to_keyframe);
+    if (!from_opacity.has_value() || !to_opacity.has_value())
+        return;
+
+    auto scroll_source = timeline->active_scroll_source();
+    if (!scroll_source.has_value() || !scroll_source->paintable_box->own_scroll_node_index().value())
+        return;
+
+    // NB: The compositor can only animate an effects node that the main thread has already created for this box.
+    Optional<VisualContextIndex> effects_node_index;
+    auto const& visual_context_tree = context.async_scrolling_visual_context_tree();
+    for (size_t i = paintable_box.visual_context_nodes_begin(); i < paintable_box.visual_context_nodes_end() && i < visual_context_tree.nodes().size(); ++i) {
+        if (visual_context_tree.nodes()[i].data.has<EffectsData>()) {
+            effects_node_index = VisualContextIndex { i };
+            break;
+        }
+    }
+    if (!effects_node_index.has_value())
+        return;
+
+    auto fill_mode = effect.fill_mode();
+    context.display_list_recorder().compositor_scroll_timeline_opacity_animation({
+        .document_id = context.async_scrolling_document_id(),
+        .source_scroll_node_index = scroll_source->paintable_box->own_scroll_node_index(),
+        .effects_node_index = *effects_node_index,
+        .max_scroll_offset = static_cast<float>(scroll_source->max_scroll_offset * context.device_pixels_per_css_pixel()),
+        .from_opacity = *from_opacity,
+        .to_opacity = *to_opacity,
+        .vertical = scroll_source->is_vertical,
+        .fills_forwards = fill_mode == Bindings::FillMode::Forwards || fill_mode == Bindings::FillMode::Both,
+    });
+}
+
 void Paintable::record_async_scrolling_metadata(DisplayListRecordingContext& context) const
 {
     if (!context.is_recording_async_scrolling_metadata())
@@ -1590,6 +1725,7 @@ void Paintable::record_async_scrolling_metadata(DisplayListRecordingContext& con
         record_scroll_node(*this, context);
     }
     record_viewport_scrollbar_state(*this, context);
+    record_scroll_timeline_opacity_animation(*this, context);
 
     auto const& scroll_state = context.async_scrolling_scroll_state();
     auto sticky_node_index = enclosing_scroll_node_index();
@@ -27,6 +27,7 @@ void SVGPathPaintable::reset_for_relayout()
 {
     SVGGraphicsPaintable::reset_for_relayout();
     m_computed_path.clear();
+    m_device_path.clear();
 }
 
 Optional<CSSPixelRect> SVGPathPaintable::clip_path_geometry_bounds(Gfx::AffineTransform const& additional_transform) const
@@ -44,6 +45,16 @@ Optional<CSSPixelRect> SVGPathPaintable::clip_path_geometry_bounds(Gfx::AffineTr
     return path.bounding_box().to_type<CSSPixels>();
 }
 
+Gfx::Path const& SVGPathPaintable::device_path(Gfx::AffineTransform const& paint_transform, Gfx::FloatPoint offset) const
+{
+    if (!m_device_path.has_value() || m_device_path->paint_transform != paint_transform || m_device_path->offset != offset) {
+        auto path = computed_path()->copy_transformed(paint_transform);
+        path.offset(offset);
+        m_device_path = DevicePath { paint_transform, offset, move(path) };
+    }
+    return m_device_path->path;
+}
+
 static Gfx::WindingRule to_gfx_winding_rule(SVG::FillRule fill_rule)
 {
     switch (fill_rule) {
@@ -82,8 +93,7 @@ void SVGPathPaintable::paint(DisplayListRecordingContext& context, PaintPhase ph
     auto maybe_view_box = svg_node->dom_node().view_box();
 
     auto paint_transform = computed_transforms().svg_to_device_pixels_transform(context);
-    auto path = computed_path()->copy_transformed(paint_transform);
-    path.offset(offset);
+    auto const& path = device_path(paint_transform, offset);
 
     auto svg_viewport = [&] {
         if (maybe_view_box.has_value())
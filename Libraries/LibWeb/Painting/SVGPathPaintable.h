@@ -28,6 +28,7 @@ public:
     void set_computed_path(Gfx::Path path)
     {
         m_computed_path = move(path);
+        m_device_path.clear();
     }
 
     Optional<Gfx::Path> const& computed_path() const { return m_computed_path; }
@@ -41,6 +42,16 @@ protected:
 
 private:
     virtual bool is_svg_path_paintable() const final { return true; }
+
+    Gfx::Path const& device_path(Gfx::AffineTransform const& paint_transform, Gfx::FloatPoint offset) const;
+
+    // The computed path in device pixels, as of the last paint. Repainting with an unchanged transform reuses it.
+    struct DevicePath {
+        Gfx::AffineTransform paint_transform;
+        Gfx::FloatPoint offset;
+        Gfx::Path path;
+    };
+    mutable Optional<DevicePath> m_device_path;
 };
 
 template<>
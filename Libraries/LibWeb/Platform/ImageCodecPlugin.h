@@ -12,6 +12,7 @@
 #include <LibCore/Promise.h>
 #include <LibGfx/ColorSpace.h>
 #include <LibGfx/Forward.h>
+#include <LibGfx/Size.h>
 #include <LibWeb/Export.h>
 
 namespace Web::Platform {
@@ -31,6 +32,11 @@ struct DecodedImage {
     i64 session_id { 0 };
 };
 
+struct PartialImage {
+    RefPtr<Gfx::Bitmap> bitmap;
+    Gfx::ColorSpace color_space;
+};
+
 class WEB_API ImageCodecPlugin {
 public:
     static ImageCodecPlugin& the();
@@ -39,7 +45,18 @@ public:
 
     virtual ~ImageCodecPlugin();
 
-    virtual NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, ESCAPING Function<ErrorOr<void>(DecodedImage&)> on_resolved, ESCAPING Function<void(Error&)> on_rejected) = 0;
+    // If an ideal size is given, a still image may be decoded to a smaller bitmap that still covers that size.
+    virtual NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, ESCAPING Function<ErrorOr<void>(DecodedImage&)> on_resolved, ESCAPING Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}) = 0;
+
+    // Decodes an image whose encoded data arrives in chunks. While data is still arriving, on_partial_image is called
+    // with what can be shown of the image so far, for formats that allow it.
+    virtual i64 begin_incremental_decode(ESCAPING Function<void(PartialImage&)> on_partial_image, ESCAPING Function<ErrorOr<void>(DecodedImage&)> on_resolved, ESCAPING Function<void(Error&)> on_rejected) = 0;
+    virtual void append_incremental_decode_data(i64 decode_id, ReadonlyBytes) = 0;
+    virtual void finish_incremental_decode(i64 decode_id) = 0;
+    virtual void cancel_incremental_decode(i64 decode_id) = 0;
+
+    // Lets the decoder work on images that are in view before those that are not.
+    virtual void set_incremental_decode_is_visible(i64 decode_id, bool is_visible) = 0;
 
     virtual void request_animation_frames(i64 session_id, u32 start_frame_index, u32 count) = 0;
     virtual void stop_animation_decode(i64 session_id) = 0;
@@ -0,0 +1,640 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashTable.h>
+#include <AK/JsonArray.h>
+#include <AK/NeverDestroyed.h>
+#include <AK/StackInfo.h>
+#include <AK/StackUnwinder.h>
+#include <LibCore/System.h>
+#include <LibCore/Timer.h>
+#include <LibGC/Heap.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Runtime/ExecutionContext.h>
+#include <LibJS/Runtime/FunctionObject.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibThreading/Thread.h>
+#include <LibWeb/Profiling/SamplingProfiler.h>
+
+#ifndef AK_OS_WINDOWS
+#    include <errno.h>
+#    include <signal.h>
+#    include <sys/ucontext.h>
+#endif
+
+#ifdef LIBWEB_HAS_CPPTRACE
+#    include <cpptrace/cpptrace.hpp>
+#endif
+
+namespace Web::Profiling {
+
+// Pending samples are turned into frames at least this often, so that the signal handler rarely finds no free slot.
+static constexpr int drain_interval_ms = 50;
+
+static Atomic<Phase> s_current_phase { Phase::Other };
+
+// Only touched by PhaseScope, which is only used on the main thread.
+static Array<AK::Duration, to_underlying(Phase::GarbageCollection) + 1> s_time_spent_in_phase;
+static MonotonicTime s_current_phase_started_at { MonotonicTime::now() };
+
+static void switch_to_phase(Phase phase)
+{
+    auto now = MonotonicTime::now();
+    auto previous_phase = s_current_phase.exchange(phase, AK::MemoryOrder::memory_order_relaxed);
+    s_time_spent_in_phase[to_underlying(previous_phase)] += now - s_current_phase_started_at;
+    s_current_phase_started_at = now;
+}
+
+PhaseScope::PhaseScope(Phase phase)
+    : m_previous_phase(s_current_phase.load(AK::MemoryOrder::memory_order_relaxed))
+{
+    switch_to_phase(phase);
+}
+
+PhaseScope::~PhaseScope()
+{
+    switch_to_phase(m_previous_phase);
+}
+
+MarkerScope::MarkerScope(StringView name, Phase phase)
+    : m_name(name)
+    , m_phase(phase)
+{
+    if (SamplingProfiler::the().is_running())
+        m_start_time = MonotonicTime::now();
+}
+
+MarkerScope::~MarkerScope()
+{
+    if (m_start_time.has_value())
+        SamplingProfiler::the().add_marker(m_name, m_phase, *m_start_time, MonotonicTime::now());
+}
+
+AK::Duration time_spent_in_phase(Phase phase)
+{
+    auto time_spent = s_time_spent_in_phase[to_underlying(phase)];
+    if (s_current_phase.load(AK::MemoryOrder::memory_order_relaxed) == phase)
+        time_spent += MonotonicTime::now() - s_current_phase_started_at;
+    return time_spent;
+}
+
+SamplingProfiler& SamplingProfiler::the()
+{
+    static NeverDestroyed<SamplingProfiler> profiler;
+    return *profiler;
+}
+
+#ifndef AK_OS_WINDOWS
+static void handle_profiling_signal(int, siginfo_t*, void* ucontext)
+{
+    auto saved_errno = errno;
+    SamplingProfiler::the().record_pending_sample(ucontext);
+    errno = saved_errno;
+}
+
+struct InterruptedRegisters {
+    FlatPtr program_counter { 0 };
+    FlatPtr frame_pointer { 0 };
+};
+
+static InterruptedRegisters interrupted_registers([[maybe_unused]] void* context)
+{
+    [[maybe_unused]] auto const* ucontext = static_cast<ucontext_t const*>(context);
+#    if defined(AK_OS_LINUX) && ARCH(X86_64)
+    return { static_cast<FlatPtr>(ucontext->uc_mcontext.gregs[REG_RIP]), static_cast<FlatPtr>(ucontext->uc_mcontext.gregs[REG_RBP]) };
+#    elif defined(AK_OS_LINUX) && ARCH(AARCH64)
+    return { static_cast<FlatPtr>(ucontext->uc_mcontext.pc), static_cast<FlatPtr>(ucontext->uc_mcontext.regs[29]) };
+#    elif defined(AK_OS_MACOS) && ARCH(X86_64)
+    return { static_cast<FlatPtr>(ucontext->uc_mcontext->__ss.__rip), static_cast<FlatPtr>(ucontext->uc_mcontext->__ss.__rbp) };
+#    elif defined(AK_OS_MACOS) && ARCH(AARCH64)
+    return { static_cast<FlatPtr>(__darwin_arm_thread_state64_get_pc(ucontext->uc_mcontext->__ss)), static_cast<FlatPtr>(__darwin_arm_thread_state64_get_fp(ucontext->uc_mcontext->__ss)) };
+#    else
+    // Without the interrupted registers, unwinding starts in the signal handler, and the frames of the signal
+    // trampoline show up in every sample.
+    return { 0, bit_cast<FlatPtr>(__builtin_frame_address(0)) };
+#    endif
+}
+#endif
+
+ErrorOr<void> SamplingProfiler::start([[maybe_unused]] JS::VM& vm, [[maybe_unused]] AK::Duration interval)
+{
+#ifdef AK_OS_WINDOWS
+    return Error::from_string_literal("The sampling profiler is not supported on this platform");
+#else
+    if (is_running())
+        return Error::from_string_literal("The sampling profiler is already running");
+
+    m_interval = interval;
+    m_javascript_frames.clear();
+    m_javascript_frame_ids.clear();
+    m_frame_ids_by_executable.clear();
+    m_frame_ids_by_native_function.clear();
+    m_samples.clear();
+    m_sample_native_frames.clear();
+    m_sample_javascript_frames.clear();
+    m_markers.clear();
+
+    m_pending_samples.resize(pending_sample_capacity);
+    m_pending_write_index.store(0);
+    m_pending_read_index.store(0);
+    m_dropped_sample_count.store(0);
+
+    StackInfo stack_info;
+    m_vm = &vm;
+    m_sampled_thread = pthread_self();
+    m_stack_base = stack_info.base();
+    m_stack_top = stack_info.top();
+
+    if (!m_registered_sweep_callback) {
+        // Sweep callbacks run after marking but before any cell is freed, which makes them the last point at which
+        // the functions and executables of pending samples can still be looked at.
+        vm.heap().register_sweep_callback([this] {
+            if (!is_running())
+                return;
+            drain_pending_samples();
+            m_frame_ids_by_executable.clear();
+            m_frame_ids_by_native_function.clear();
+        });
+
+        // The handler stays installed once the profiler has run, as a signal sent right before the sampler thread
+        // stopped may still be pending. It does nothing while the profiler isn't running.
+        struct sigaction action {};
+        action.sa_sigaction = handle_profiling_signal;
+        action.sa_flags = SA_SIGINFO | SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        TRY(Core::System::sigaction(SIGPROF, &action, nullptr));
+
+        m_registered_sweep_callback = true;
+    }
+
+    m_start_time = MonotonicTime::now();
+    m_should_stop.store(false);
+    m_running.store(true);
+
+    m_drain_timer = Core::Timer::create_repeating(drain_interval_ms, [this] {
+        drain_pending_samples();
+    });
+    m_drain_timer->start();
+
+    m_sampler = Threading::Thread::construct("JSProfiler"sv, [this] {
+        while (!m_should_stop.load()) {
+            (void)Core::System::sleep_ms(static_cast<u32>(max<i64>(1, m_interval.to_milliseconds())));
+            pthread_kill(m_sampled_thread, SIGPROF);
+        }
+        return static_cast<intptr_t>(0);
+    });
+    m_sampler->start();
+    return {};
+#endif
+}
+
+void SamplingProfiler::stop()
+{
+    if (!is_running())
+        return;
+
+    m_should_stop.store(true);
+    (void)m_sampler->join();
+    m_sampler = nullptr;
+
+    m_drain_timer->stop();
+    m_drain_timer = nullptr;
+
+    // The signal handler runs on this thread, so once it sees this, no sample is being recorded any longer.
+    m_running.store(false);
+
+    drain_pending_samples();
+    m_frame_ids_by_executable.clear();
+    m_frame_ids_by_native_function.clear();
+    m_pending_samples.clear();
+    m_vm = nullptr;
+
+    if (auto dropped_sample_count = m_dropped_sample_count.load(); dropped_sample_count > 0)
+        dbgln("SamplingProfiler: Dropped {} samples that were taken faster than they could be processed", dropped_sample_count);
+}
+
+void SamplingProfiler::add_marker(StringView name, Phase phase, MonotonicTime start_time, MonotonicTime end_time)
+{
+    if (!is_running())
+        return;
+
+    m_markers.append({
+        .name = name,
+        .phase = phase,
+        .start_time = start_time - m_start_time,
+        .end_time = end_time - m_start_time,
+    });
+}
+
+// This runs in a signal handler that interrupted the main thread at an arbitrary point, so it must not allocate, take
+// locks, or rely on any invariant that the interrupted code might be in the middle of restoring.
+void SamplingProfiler::record_pending_sample([[maybe_unused]] void* ucontext)
+{
+#ifndef AK_OS_WINDOWS
+    if (!m_running.load(AK::MemoryOrder::memory_order_relaxed) || !pthread_equal(pthread_self(), m_sampled_thread))
+        return;
+
+    auto write_index = m_pending_write_index.load(AK::MemoryOrder::memory_order_relaxed);
+    if (write_index - m_pending_read_index.load(AK::MemoryOrder::memory_order_acquire) >= pending_sample_capacity) {
+        m_dropped_sample_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+        return;
+    }
+
+    auto& sample = m_pending_samples[write_index % pending_sample_capacity];
+    sample.time = MonotonicTime::now() - m_start_time;
+
+    // The interrupted instruction is recorded like a return address, which points just past its call.
+    auto registers = interrupted_registers(ucontext);
+    size_t native_frame_count = 0;
+    if (registers.program_counter != 0)
+        sample.native_frames[native_frame_count++] = registers.program_counter + 1;
+
+    auto frame_pointer = registers.frame_pointer;
+    AK::unwind_stack_from_frame_pointer(
+        frame_pointer,
+        [&](FlatPtr address) -> Optional<FlatPtr> {
+            if (address < m_stack_base || address + sizeof(FlatPtr) > m_stack_top || address % alignof(FlatPtr) != 0)
+                return {};
+            return *reinterpret_cast<FlatPtr const*>(address);
+        },
+        [&](AK::StackFrame frame) {
+            if (native_frame_count == max_native_frames)
+                return IterationDecision::Break;
+            sample.native_frames[native_frame_count++] = frame.return_address;
+
+            // The stack grows downwards, so anything else means that the frame pointer chain is broken.
+            if (frame.previous_frame_pointer != 0 && frame.previous_frame_pointer <= frame_pointer)
+                return IterationDecision::Break;
+            frame_pointer = frame.previous_frame_pointer;
+            return IterationDecision::Continue;
+        });
+    sample.native_frame_count = native_frame_count;
+
+    // This walks the same frames as VM::for_each_execution_context_top_to_bottom(), but tolerates stacks that are
+    // halfway through a push or a pop.
+    size_t javascript_frame_count = 0;
+    auto record_frame = [&](JS::ExecutionContext const& context) {
+        if (javascript_frame_count == max_javascript_frames)
+            return false;
+        // Contexts without a function or any code are only there to provide a realm, and never run anything.
+        if (context.function || context.executable) {
+            sample.javascript_frames[javascript_frame_count++] = {
+                .function = context.function.ptr(),
+                .executable = context.executable.ptr(),
+                .program_counter = context.program_counter,
+            };
+        }
+        return true;
+    };
+
+    auto const& stack = m_vm->execution_context_stack();
+    auto const& previous_running_contexts = m_vm->execution_context_stack_previous_running_contexts();
+    auto stack_index = min(stack.size(), previous_running_contexts.size());
+    if (auto const* context = m_vm->running_execution_context_if_any()) {
+        // Each context is visited at most once, but a torn update could link them into a cycle.
+        for (size_t visited = 0; context && visited < max_javascript_frames * 2; ++visited) {
+            if (!record_frame(*context))
+                break;
+            if (stack_index > 0 && context == stack[stack_index - 1]) {
+                context = previous_running_contexts[--stack_index];
+                continue;
+            }
+            context = context->caller_frame;
+        }
+    } else {
+        while (stack_index > 0 && record_frame(*stack[--stack_index])) { }
+    }
+    sample.javascript_frame_count = javascript_frame_count;
+
+    auto phase = s_current_phase.load(AK::MemoryOrder::memory_order_relaxed);
+    if (m_vm->heap().is_collecting_garbage())
+        phase = Phase::GarbageCollection;
+    else if (phase == Phase::Other && javascript_frame_count > 0)
+        phase = Phase::Script;
+    sample.phase = phase;
+
+    // Publish the sample only once it has been written in full.
+    m_pending_write_index.store(write_index + 1, AK::MemoryOrder::memory_order_release);
+#endif
+}
+
+void SamplingProfiler::drain_pending_samples()
+{
+    auto read_index = m_pending_read_index.load(AK::MemoryOrder::memory_order_relaxed);
+    auto write_index = m_pending_write_index.load(AK::MemoryOrder::memory_order_acquire);
+
+    for (; read_index != write_index; ++read_index) {
+        auto const& pending_sample = m_pending_samples[read_index % pending_sample_capacity];
+
+        m_samples.append({
+            .time = pending_sample.time,
+            .phase = pending_sample.phase,
+            .first_native_frame = m_sample_native_frames.size(),
+            .native_frame_count = pending_sample.native_frame_count,
+            .first_javascript_frame = m_sample_javascript_frames.size(),
+            .javascript_frame_count = pending_sample.javascript_frame_count,
+        });
+
+        m_sample_native_frames.append(pending_sample.native_frames.data(), pending_sample.native_frame_count);
+        for (size_t i = 0; i < pending_sample.javascript_frame_count; ++i)
+            m_sample_javascript_frames.append(javascript_frame_id_for(pending_sample.javascript_frames[i]));
+
+        // Only hand the slot back to the signal handler once it has been copied out.
+        m_pending_read_index.store(read_index + 1, AK::MemoryOrder::memory_order_release);
+    }
+}
+
+static ByteString name_of(JS::FunctionObject const* function, JS::Bytecode::Executable const* executable)
+{
+    if (function) {
+        if (auto name = function->name_for_call_stack(); !name.is_empty())
+            return name.to_byte_string();
+        return "(anonymous)"sv;
+    }
+    if (executable && !executable->name.is_empty())
+        return MUST(executable->name.view().to_byte_string());
+    return "(script)"sv;
+}
+
+u32 SamplingProfiler::javascript_frame_id_for(PendingJavaScriptFrame const& pending_frame)
+{
+    // Native functions have no code of their own, so there is no position within them to tell apart.
+    if (!pending_frame.executable) {
+        return m_frame_ids_by_native_function.ensure(pending_frame.function, [&] {
+            return intern_javascript_frame({ .name = name_of(pending_frame.function, nullptr) });
+        });
+    }
+
+    auto& frame_ids = m_frame_ids_by_executable.ensure(pending_frame.executable);
+    return frame_ids.ensure(pending_frame.program_counter, [&] {
+        JavaScriptFrame frame { .name = name_of(pending_frame.function, pending_frame.executable) };
+        if (auto source_range = pending_frame.executable->source_range_at(pending_frame.program_counter); source_range.has_value()) {
+            frame.url = source_range->filename().to_byte_string();
+            frame.line = source_range->start.line;
+            frame.column = source_range->start.column;
+        }
+        return intern_javascript_frame(move(frame));
+    });
+}
+
+u32 SamplingProfiler::intern_javascript_frame(JavaScriptFrame frame)
+{
+    auto key = ByteString::formatted("{}\n{}\n{}\n{}", frame.name, frame.url, frame.line.value_or(0), frame.column.value_or(0));
+    return m_javascript_frame_ids.ensure(key, [&] {
+        m_javascript_frames.append(move(frame));
+        return static_cast<u32>(m_javascript_frames.size() - 1);
+    });
+}
+
+static HashMap<FlatPtr, ByteString> symbolize(Vector<FlatPtr> const& return_addresses)
+{
+    HashMap<FlatPtr, ByteString> symbols;
+
+#ifdef LIBWEB_HAS_CPPTRACE
+    std::vector<cpptrace::frame_ptr> addresses;
+    addresses.reserve(return_addresses.size());
+    for (auto return_address : return_addresses)
+        addresses.push_back(static_cast<cpptrace::frame_ptr>(return_address) - 1);
+
+    // resolve() may expand inline frames, which are followed by the frame of the function they were inlined into.
+    auto resolved = cpptrace::raw_trace { move(addresses) }.resolve();
+    size_t index = 0;
+    for (auto const& frame : resolved.frames) {
+        if (frame.is_inline)
+            continue;
+        if (index == return_addresses.size())
+            break;
+        if (!frame.symbol.empty())
+            symbols.set(return_addresses[index], ByteString { frame.symbol.c_str(), frame.symbol.length() });
+        ++index;
+    }
+#endif
+
+    for (auto return_address : return_addresses) {
+        symbols.ensure(return_address, [&] {
+            return ByteString::formatted("{:#x}", return_address - 1);
+        });
+    }
+    return symbols;
+}
+
+static double to_milliseconds(AK::Duration duration)
+{
+    return static_cast<double>(duration.to_nanoseconds()) / 1'000'000.0;
+}
+
+static JsonObject make_schema(std::initializer_list<StringView> fields)
+{
+    JsonObject schema;
+    int index = 0;
+    for (auto field : fields)
+        schema.set(field, index++);
+    return schema;
+}
+
+static JsonObject make_table(std::initializer_list<StringView> fields, JsonArray data)
+{
+    JsonObject table;
+    table.set("schema"sv, make_schema(fields));
+    table.set("data"sv, move(data));
+    return table;
+}
+
+// https://github.com/firefox-devtools/profiler/blob/main/docs-developer/gecko-profile-format.md
+JsonObject SamplingProfiler::to_gecko_profile() const
+{
+    auto start_time = UnixDateTime::now() - (MonotonicTime::now() - m_start_time);
+
+    // The categories are in the same order as the phases.
+    JsonArray categories;
+    auto add_category = [&](StringView name, StringView color) {
+        JsonObject category;
+        category.set("name"sv, name);
+        category.set("color"sv, color);
+        JsonArray subcategories;
+        subcategories.must_append("Other"sv);
+        category.set("subcategories"sv, move(subcategories));
+        categories.must_append(move(category));
+    };
+    add_category("Other"sv, "grey"sv);
+    add_category("JavaScript"sv, "yellow"sv);
+    add_category("Style"sv, "blue"sv);
+    add_category("Layout"sv, "purple"sv);
+    add_category("Paint"sv, "green"sv);
+    add_category("GC"sv, "orange"sv);
+
+    JsonObject meta;
+    meta.set("version"sv, 27);
+    meta.set("interval"sv, to_milliseconds(m_interval));
+    meta.set("startTime"sv, static_cast<double>(start_time.milliseconds_since_epoch()));
+    meta.set("shutdownTime"sv, JsonValue {});
+    meta.set("processType"sv, 0);
+    meta.set("product"sv, "Ladybird"sv);
+    meta.set("stackwalk"sv, 1);
+    meta.set("debug"sv, 0);
+    meta.set("gcpoison"sv, 0);
+    meta.set("asyncstack"sv, 0);
+    meta.set("presymbolicated"sv, true);
+    meta.set("categories"sv, move(categories));
+    meta.set("markerSchema"sv, JsonArray {});
+
+    Vector<FlatPtr> return_addresses;
+    {
+        HashTable<FlatPtr> seen_return_addresses;
+        for (auto return_address : m_sample_native_frames) {
+            if (seen_return_addresses.set(return_address) == HashSetResult::InsertedNewEntry)
+                return_addresses.append(return_address);
+        }
+    }
+    auto symbols = symbolize(return_addresses);
+
+    JsonArray strings;
+    HashMap<ByteString, u32> string_indices;
+    auto string_for = [&](ByteString const& string) {
+        return string_indices.ensure(string, [&] {
+            strings.must_append(string.view());
+            return static_cast<u32>(strings.size() - 1);
+        });
+    };
+
+    // Each frame gets an entry per phase it was sampled in, so that the phases show up as separate categories.
+    JsonArray frames;
+    HashMap<u64, u32> frame_indices;
+    auto frame_for_native = [&](FlatPtr return_address, Phase phase) {
+        auto location = string_for(symbols.get(return_address).value());
+        auto key = (static_cast<u64>(to_underlying(phase)) << 56) | location;
+        return frame_indices.ensure(key, [&] {
+            JsonArray frame;
+            frame.must_append(location);
+            frame.must_append(false);
+            frame.must_append(0);
+            frame.must_append(JsonValue {});
+            frame.must_append(JsonValue {});
+            frame.must_append(JsonValue {});
+            frame.must_append(to_underlying(phase));
+            frame.must_append(0);
+            frames.must_append(move(frame));
+            return static_cast<u32>(frames.size() - 1);
+        });
+    };
+    auto frame_for_javascript = [&](u32 id, Phase phase) {
+        auto key = (static_cast<u64>(to_underlying(phase)) << 56) | (1ull << 55) | id;
+        return frame_indices.ensure(key, [&] {
+            auto const& javascript_frame = m_javascript_frames[id];
+
+            // The Firefox Profiler recognizes JavaScript frames by their location being formatted like this.
+            auto location = javascript_frame.url.is_empty()
+                ? javascript_frame.name
+                : ByteString::formatted("{} ({}:{}:{})", javascript_frame.name, javascript_frame.url, javascript_frame.line.value_or(0), javascript_frame.column.value_or(0));
+
+            JsonArray frame;
+            frame.must_append(string_for(location));
+            frame.must_append(false);
+            frame.must_append(0);
+            frame.must_append("interpreter"sv);
+            frame.must_append(javascript_frame.line.has_value() ? JsonValue { *javascript_frame.line } : JsonValue {});
+            frame.must_append(javascript_frame.column.has_value() ? JsonValue { *javascript_frame.column } : JsonValue {});
+            frame.must_append(to_underlying(phase));
+            frame.must_append(0);
+            frames.must_append(move(frame));
+            return static_cast<u32>(frames.size() - 1);
+        });
+    };
+
+    JsonArray stacks;
+    HashMap<u64, u32> stack_indices;
+    auto stack_for = [&](Optional<u32> prefix, u32 frame) {
+        auto key = (static_cast<u64>(prefix.value_or(0xffffffff)) << 32) | frame;
+        return stack_indices.ensure(key, [&] {
+            JsonArray stack;
+            stack.must_append(prefix.has_value() ? JsonValue { *prefix } : JsonValue {});
+            stack.must_append(frame);
+            stacks.must_append(move(stack));
+            return static_cast<u32>(stacks.size() - 1);
+        });
+    };
+
+    JsonArray samples;
+    for (auto const& sample : m_samples) {
+        auto native_frames = m_sample_native_frames.span().slice(sample.first_native_frame, sample.native_frame_count);
+        auto javascript_frames = m_sample_javascript_frames.span().slice(sample.first_javascript_frame, sample.javascript_frame_count);
+
+        // Both stacks were recorded innermost first. The JavaScript frames are called from the outermost native frame
+        // of the engine, so they go right after it. If the native stack doesn't reach it, they go on top instead.
+        size_t javascript_insertion_point = 0;
+        if (!javascript_frames.is_empty()) {
+            for (size_t i = native_frames.size(); i-- > 0;) {
+                if (symbols.get(native_frames[i])->starts_with("JS::"sv)) {
+                    javascript_insertion_point = i;
+                    break;
+                }
+            }
+        }
+
+        Optional<u32> stack;
+        for (size_t i = native_frames.size(); i-- > 0;) {
+            stack = stack_for(stack, frame_for_native(native_frames[i], sample.phase));
+            if (i == javascript_insertion_point) {
+                for (size_t j = javascript_frames.size(); j-- > 0;)
+                    stack = stack_for(stack, frame_for_javascript(javascript_frames[j], sample.phase));
+                javascript_frames = {};
+            }
+        }
+        for (size_t j = javascript_frames.size(); j-- > 0;)
+            stack = stack_for(stack, frame_for_javascript(javascript_frames[j], sample.phase));
+
+        if (!stack.has_value())
+            continue;
+
+        JsonArray row;
+        row.must_append(*stack);
+        row.must_append(to_milliseconds(sample.time));
+        row.must_append(0);
+        samples.must_append(move(row));
+    }
+
+    // Markers are intervals, which is phase 1 in the marker table.
+    JsonArray markers;
+    for (auto const& marker : m_markers) {
+        JsonArray row;
+        row.must_append(string_for(marker.name));
+        row.must_append(to_milliseconds(marker.start_time));
+        row.must_append(to_milliseconds(marker.end_time));
+        row.must_append(1);
+        row.must_append(to_underlying(marker.phase));
+        row.must_append(JsonValue {});
+        markers.must_append(move(row));
+    }
+
+    auto pid = Core::System::getpid();
+
+    JsonObject thread;
+    thread.set("name"sv, "GeckoMain"sv);
+    thread.set("processName"sv, "WebContent"sv);
+    thread.set("processType"sv, "default"sv);
+    thread.set("pid"sv, pid);
+    thread.set("tid"sv, pid);
+    thread.set("registerTime"sv, 0);
+    thread.set("unregisterTime"sv, JsonValue {});
+    thread.set("samples"sv, make_table({ "stack"sv, "time"sv, "eventDelay"sv }, move(samples)));
+    thread.set("markers"sv, make_table({ "name"sv, "startTime"sv, "endTime"sv, "phase"sv, "category"sv, "data"sv }, move(markers)));
+    thread.set("stackTable"sv, make_table({ "prefix"sv, "frame"sv }, move(stacks)));
+    thread.set("frameTable"sv, make_table({ "location"sv, "relevantForJS"sv, "innerWindowID"sv, "implementation"sv, "line"sv, "column"sv, "category"sv, "subcategory"sv }, move(frames)));
+    thread.set("stringTable"sv, move(strings));
+
+    JsonArray threads;
+    threads.must_append(move(thread));
+
+    JsonObject profile;
+    profile.set("meta"sv, move(meta));
+    profile.set("libs"sv, JsonArray {});
+    profile.set("threads"sv, move(threads));
+    profile.set("processes"sv, JsonArray {});
+    profile.set("pausedRanges"sv, JsonArray {});
+    return profile;
+}
+
+}
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Atomic.h>
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/JsonObject.h>
+#include <AK/Optional.h>
+#include <AK/RefPtr.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibCore/Forward.h>
+#include <LibJS/Forward.h>
+#include <LibWeb/Export.h>
+#include <pthread.h>
+
+namespace Threading {
+class Thread;
+}
+
+namespace Web::Profiling {
+
+// What the main thread was busy with when a sample was taken.
+enum class Phase : u8 {
+    Other,
+    Script,
+    Style,
+    Layout,
+    Paint,
+    GarbageCollection,
+};
+
+// Attributes samples taken on the main thread to the given phase while it is alive. Scopes nest, and the innermost
+// one wins, so forcing a layout from script is attributed to layout.
+class WEB_API PhaseScope {
+    AK_MAKE_NONCOPYABLE(PhaseScope);
+    AK_MAKE_NONMOVABLE(PhaseScope);
+
+public:
+    explicit PhaseScope(Phase);
+    ~PhaseScope();
+
+private:
+    Phase m_previous_phase { Phase::Other };
+};
+
+// Shows the lifetime of the scope as a marker on the main thread's timeline, if the sampling profiler is running.
+class WEB_API MarkerScope {
+    AK_MAKE_NONCOPYABLE(MarkerScope);
+    AK_MAKE_NONMOVABLE(MarkerScope);
+
+public:
+    MarkerScope(StringView name, Phase);
+    ~MarkerScope();
+
+private:
+    StringView m_name;
+    Phase m_phase { Phase::Other };
+    Optional<MonotonicTime> m_start_time;
+};
+
+// Returns how long the main thread has spent inside PhaseScopes for the given phase, excluding time spent in nested
+// scopes for other phases.
+WEB_API AK::Duration time_spent_in_phase(Phase);
+
+// Samples the main thread of this process by interrupting it with a signal, recording both the native stack and the
+// JavaScript stack of the VM. The signal handler only copies raw values. They are turned into frames later on the main
+// thread, at the latest right before a garbage collection could free any of the sampled functions and executables.
+class WEB_API SamplingProfiler {
+public:
+    static SamplingProfiler& the();
+
+    // Must be called on the thread that runs the given VM.
+    ErrorOr<void> start(JS::VM&, AK::Duration interval = AK::Duration::from_milliseconds(1));
+    void stop();
+    bool is_running() const { return m_running; }
+
+    // Adds a marker spanning the given times to the main thread's timeline. Does nothing unless the profiler is running.
+    void add_marker(StringView name, Phase, MonotonicTime start_time, MonotonicTime end_time);
+
+    // Exports the last profile in the Gecko profile format, which the Firefox Profiler can open.
+    JsonObject to_gecko_profile() const;
+
+    // Internal to the signal handler.
+    void record_pending_sample(void* ucontext);
+
+private:
+    SamplingProfiler() = default;
+
+    static constexpr size_t max_native_frames = 128;
+    static constexpr size_t max_javascript_frames = 64;
+    static constexpr size_t pending_sample_capacity = 256;
+
+    struct PendingJavaScriptFrame {
+        JS::FunctionObject const* function { nullptr };
+        JS::Bytecode::Executable const* executable { nullptr };
+        u32 program_counter { 0 };
+    };
+
+    // Written by the signal handler, so this only holds raw values. Frames are stored innermost first.
+    struct PendingSample {
+        AK::Duration time;
+        Phase phase { Phase::Other };
+        u32 native_frame_count { 0 };
+        u32 javascript_frame_count { 0 };
+        Array<FlatPtr, max_native_frames> native_frames;
+        Array<PendingJavaScriptFrame, max_javascript_frames> javascript_frames;
+    };
+
+    struct JavaScriptFrame {
+        ByteString name;
+        ByteString url;
+        Optional<u32> line;
+        Optional<u32> column;
+    };
+
+    struct Sample {
+        AK::Duration time;
+        Phase phase { Phase::Other };
+        size_t first_native_frame { 0 };
+        size_t native_frame_count { 0 };
+        size_t first_javascript_frame { 0 };
+        size_t javascript_frame_count { 0 };
+    };
+
+    struct Marker {
+        ByteString name;
+        Phase phase { Phase::Other };
+        AK::Duration start_time;
+        AK::Duration end_time;
+    };
+
+    void drain_pending_samples();
+    u32 javascript_frame_id_for(PendingJavaScriptFrame const&);
+    u32 intern_javascript_frame(JavaScriptFrame);
+
+    Atomic<bool> m_running { false };
+    Atomic<bool> m_should_stop { false };
+    AK::Duration m_interval;
+    MonotonicTime m_start_time { MonotonicTime::now() };
+    RefPtr<Threading::Thread> m_sampler;
+    RefPtr<Core::Timer> m_drain_timer;
+    bool m_registered_sweep_callback { false };
+
+    // Read by the signal handler, so these only change while it can't run.
+    JS::VM* m_vm { nullptr };
+    pthread_t m_sampled_thread {};
+    FlatPtr m_stack_base { 0 };
+    FlatPtr m_stack_top { 0 };
+
+    Vector<PendingSample> m_pending_samples;
+    Atomic<size_t> m_pending_write_index { 0 };
+    Atomic<size_t> m_pending_read_index { 0 };
+    Atomic<size_t> m_dropped_sample_count { 0 };
+
+    // Keyed by raw pointers, so these are forgotten whenever a garbage collection could have freed what they point to.
+    HashMap<JS::Bytecode::Executable const*, HashMap<u32, u32>> m_frame_ids_by_executable;
+    HashMap<JS::FunctionObject const*, u32> m_frame_ids_by_native_function;
+
+    Vector<JavaScriptFrame> m_javascript_frames;
+    HashMap<ByteString, u32> m_javascript_frame_ids;
+    Vector<Sample> m_samples;
+    Vector<FlatPtr> m_sample_native_frames;
+    Vector<u32> m_sample_javascript_frames;
+    Vector<Marker> m_markers;
+};
+
+}
@@ -146,6 +146,7 @@ SVGDecodedImageData::SVGDecodedImageData(GC::Ref<Page> page, GC::Ref<SVGPageClie
     , m_page_client(page_client)
     , m_document(document)
     , m_root_element(root_element)
+    , m_color_scheme(page_client->page().preferred_color_scheme())
 {
 }
 
@@ -203,6 +204,39 @@ static void copy_referenced_resources_to(
     destination.apply_transaction(source.create_transaction(empty_resource_set, referenced_resources));
 }
 
+// Moves a cache entry to the back of the cache, so that the front always holds the least recently used entry.
+template<typename T>
+static T const& mark_as_most_recently_used(OrderedHashMap<SVGImageRenderingKey, T>& cache, SVGImageRenderingKey const& key)
+{
+    auto value = cache.take(key).release_value();
+    cache.set(key, move(value));
+    return cache.find(key)->value;
+}
+
+template<typename T>
+static void evict_least_recently_used_if_full(OrderedHashMap<SVGImageRenderingKey, T>& cache, size_t max_count)
+{
+    while (cache.size() >= max_count)
+        cache.remove(cache.begin());
+}
+
+SVGImageRenderingKey SVGDecodedImageData::rendering_key_for_size(Gfx::IntSize size) const
+{
+    return { size, m_page_client->page().preferred_color_scheme() };
+}
+
+void SVGDecodedImageData::update_color_scheme_if_needed() const
+{
+    // NB: The host page does not tell SVG image documents when its color scheme changes, so we notice that here. The
+    //     renderings for the previous color scheme stay cached, since they are keyed by their color scheme.
+    auto color_scheme = m_page_client->page().preferred_color_scheme();
+    if (m_color_scheme == color_scheme)
+        return;
+    m_color_scheme = color_scheme;
+    m_document->invalidate_style(DOM::StyleInvalidationReason::SettingsChange);
+    m_document->set_needs_media_query_evaluation();
+}
+
 void SVGDecodedImageData::prune_cached_display_list_resources() const
 {
     m_page_client->prune_cached_display_list_resources();
@@ -228,14 +262,15 @@ Optional<Painting::DisplayListResource> SVGDecodedImageData::record_display_list
     auto& navigable = *m_document->navigable();
     auto& resource_storage = navigable.display_list_resource_storage();
 
-    if (auto it = m_cached_display_lists.find(size); it != m_cached_display_lists.end()) {
-        copy_referenced_resources_to(destination_resource_storage, resource_storage, it->value.referenced_resources);
-        return Painting::DisplayListResource { *it->value.display_list, it->value.visual_context_tree };
+    auto key = rendering_key_for_size(size);
+    if (m_cached_display_lists.contains(key)) {
+        auto const& cached_display_list = mark_as_most_recently_used(m_cached_display_lists, key);
+        copy_referenced_resources_to(destination_resource_storage, resource_storage, cached_display_list.referenced_resources);
+        return Painting::DisplayListResource { *cached_display_list.display_list, cached_display_list.visual_context_tree };
     }
 
-    // FIXME: Evict least used entries.
-    if (m_cached_display_lists.size() > 10) {
-        m_cached_display_lists.remove(m_cached_display_lists.begin());
+    if (m_cached_display_lists.size() >= max_cached_rendering_count) {
+        evict_least_recently_used_if_full(m_cached_display_lists, max_cached_rendering_count);
         prune_cached_display_list_resources();
     }
 
@@ -254,6 +289,7 @@ Optional<Painting::DisplayListResource> SVGDecodedImageData::record_display_list
         navigable.set_viewport_size(previous_viewport_size);
     };
 
+    update_color_scheme_if_needed();
     navigable.set_viewport_size(size.to_type<CSSPixels>());
     m_document->update_layout(DOM::UpdateLayoutReason::SVGDecodedImageDataRender);
     auto display_list = m_document->record_display_list({}, resource_storage, Painting::PaintCommandCacheMode::ReadWrite);
@@ -267,7 +303,7 @@ Optional<Painting::DisplayListResource> SVGDecodedImageData::record_display_list
     copy_referenced_resources_to(destination_resource_storage, resource_storage, referenced_resources);
     auto visual_context_tree = document_paintable->visual_context_tree();
     auto display_list_resource = Painting::DisplayListResource { *display_list, visual_context_tree };
-    m_cached_display_lists.set(size, CachedDisplayList { NonnullRefPtr<Painting::DisplayList> { *display_list }, move(visual_context_tree), move(referenced_resources) });
+    m_cached_display_lists.set(key, CachedDisplayList { NonnullRefPtr<Painting::DisplayList> { *display_list }, move(visual_context_tree), move(referenced_resources) });
     prune_cached_display_list_resources();
     return display_list_resource;
 }
@@ -277,13 +313,11 @@ RefPtr<Gfx::PaintingSurface> SVGDecodedImageData::render_to_surface(Gfx::IntSize
     if (size.is_empty())
         return {};
 
-    if (auto it = m_cached_rendered_surfaces.find(size); it != m_cached_rendered_surfaces.end())
-        return it->value;
+    auto key = rendering_key_for_size(size);
+    if (m_cached_rendered_surfaces.contains(key))
+        return mark_as_most_recently_used(m_cached_rendered_surfaces, key);
 
-    // Prevent the cache from growing too big.
-    // FIXME: Evict least used entries.
-    if (m_cached_rendered_surfaces.size() > 10)
-        m_cached_rendered_surfaces.remove(m_cached_rendered_surfaces.begin());
+    evict_least_recently_used_if_full(m_cached_rendered_surfaces, max_cached_rendering_count);
 
     auto surface = Gfx::PaintingSurface::create_with_size(size, Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied);
     Painting::DisplayListResourceStorage resource_storage;
@@ -295,7 +329,7 @@ RefPtr<Gfx::PaintingSurface> SVGDecodedImageData::render_to_surface(Gfx::IntSize
     display_list_player.execute(*display_list->display_list, display_list->visual_context_tree, resource_storage, {}, surface);
     display_list_player.flush(*surface);
 
-    m_cached_rendered_surfaces.set(size, *surface);
+    m_cached_rendered_surfaces.set(key, *surface);
     return surface;
 }
 
@@ -304,16 +338,14 @@ Optional<Gfx::DecodedImageFrame> SVGDecodedImageData::current_frame(Gfx::IntSize
     if (size.is_empty())
         return {};
 
-    if (auto it = m_cached_rendered_frames.find(size); it != m_cached_rendered_frames.end())
-        return it->value;
+    auto key = rendering_key_for_size(size);
+    if (m_cached_rendered_frames.contains(key))
+        return mark_as_most_recently_used(m_cached_rendered_frames, key);
 
-    // Prevent the cache from growing too big.
-    // FIXME: Evict least used entries.
-    if (m_cached_rendered_frames.size() > 10)
-        m_cached_rendered_frames.remove(m_cached_rendered_frames.begin());
+    evict_least_recently_used_if_full(m_cached_rendered_frames, max_cached_rendering_count);
 
     auto decoded_frame = Gfx::DecodedImageFrame { *render_to_surface(size)->snapshot_bitmap() };
-    m_cached_rendered_frames.set(size, decoded_frame);
+    m_cached_rendered_frames.set(key, decoded_frame);
     return decoded_frame;
 }
 
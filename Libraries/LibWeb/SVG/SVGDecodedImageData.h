@@ -10,6 +10,7 @@
 #include <LibGC/Weak.h>
 #include <LibGC/WeakHashSet.h>
 #include <LibGfx/DecodedImageFrame.h>
+#include <LibWeb/CSS/PreferredColorScheme.h>
 #include <LibWeb/HTML/DecodedImageData.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/DisplayList.h>
@@ -17,6 +18,14 @@
 
 namespace Web::SVG {
 
+// What a rendering of an SVG image depends on besides the image itself.
+struct SVGImageRenderingKey {
+    Gfx::IntSize size;
+    CSS::PreferredColorScheme color_scheme { CSS::PreferredColorScheme::Light };
+
+    bool operator==(SVGImageRenderingKey const&) const = default;
+};
+
 class SVGDecodedImageData final : public HTML::DecodedImageData {
     GC_CELL(SVGDecodedImageData, HTML::DecodedImageData);
     GC_DECLARE_ALLOCATOR(SVGDecodedImageData);
@@ -55,11 +64,16 @@ private:
     void append_paint_command_cache_source_resources(Painting::DisplayListResourceSet&) const;
     void did_request_frame();
     void invalidate_cached_rendering();
+    SVGImageRenderingKey rendering_key_for_size(Gfx::IntSize) const;
+    void update_color_scheme_if_needed() const;
+
+    // Each of these caches is ordered from least to most recently used, and only keeps this many renderings.
+    static constexpr size_t max_cached_rendering_count = 10;
 
     // FIXME: Remove this once everything is using surfaces instead.
-    mutable HashMap<Gfx::IntSize, Gfx::DecodedImageFrame> m_cached_rendered_frames;
+    mutable OrderedHashMap<SVGImageRenderingKey, Gfx::DecodedImageFrame> m_cached_rendered_frames;
 
-    mutable HashMap<Gfx::IntSize, NonnullRefPtr<Gfx::PaintingSurface>> m_cached_rendered_surfaces;
+    mutable OrderedHashMap<SVGImageRenderingKey, NonnullRefPtr<Gfx::PaintingSurface>> m_cached_rendered_surfaces;
 
     struct CachedDisplayList {
         NonnullRefPtr<Painting::DisplayList> display_list;
@@ -67,7 +81,10 @@ private:
         // Precomputed by collect_referenced_resources(); the display list is immutable, so this never changes.
         Painting::DisplayListResourceSet referenced_resources;
     };
-    mutable HashMap<Gfx::IntSize, CachedDisplayList> m_cached_display_lists;
+    mutable OrderedHashMap<SVGImageRenderingKey, CachedDisplayList> m_cached_display_lists;
+
+    // The color scheme that the SVG document's style was last computed for.
+    mutable CSS::PreferredColorScheme m_color_scheme { CSS::PreferredColorScheme::Light };
 
     GC::Ref<Page> m_page;
     GC::Ref<SVGPageClient> m_page_client;
@@ -149,3 +166,12 @@ private:
 };
 
 }
+
+template<>
+struct AK::Traits<Web::SVG::SVGImageRenderingKey> : public AK::DefaultTraits<Web::SVG::SVGImageRenderingKey> {
+    static constexpr bool is_trivial() { return false; }
+    static unsigned hash(Web::SVG::SVGImageRenderingKey const& key)
+    {
+        return pair_int_hash(AK::Traits<Gfx::IntSize>::hash(key.size), to_underlying(key.color_scheme));
+    }
+};
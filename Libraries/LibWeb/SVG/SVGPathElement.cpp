@@ -4,24 +4,70 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashMap.h>
+#include <AK/NeverDestroyed.h>
 #include <AK/Optional.h>
+#include <AK/RefCounted.h>
+#include <AK/Weakable.h>
 #include <LibGfx/Path.h>
 #include <LibWeb/Bindings/SVGPathElement.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Event.h>
 #include <LibWeb/Layout/SVGGeometryBox.h>
 #include <LibWeb/SVG/AttributeNames.h>
+#include <LibWeb/SVG/AttributeParser.h>
 #include <LibWeb/SVG/SVGPathElement.h>
 
 namespace Web::SVG {
 
 GC_DEFINE_ALLOCATOR(SVGPathElement);
 
+// The geometry of a `d` attribute, parsed once and shared by every <path> element with the same attribute value. Icons
+// referenced by many <use> elements get a cloned <path> per reference, and all of those clones end up sharing this.
+class SharedPathData final
+    : public RefCounted<SharedPathData>
+    , public Weakable<SharedPathData> {
+public:
+    explicit SharedPathData(Path path)
+        : m_gfx_path(path.to_gfx_path())
+    {
+    }
+
+    Gfx::Path const& gfx_path() const { return m_gfx_path; }
+
+private:
+    Gfx::Path m_gfx_path;
+};
+
+static HashMap<Utf16String, WeakPtr<SharedPathData>>& shared_path_data()
+{
+    static NeverDestroyed<HashMap<Utf16String, WeakPtr<SharedPathData>>> s_path_data;
+    return *s_path_data;
+}
+
+static NonnullRefPtr<SharedPathData const> path_data_for(Utf16String const& source)
+{
+    auto& cache = shared_path_data();
+    if (auto entry = cache.get(source); entry.has_value()) {
+        if (auto path_data = entry->strong_ref())
+            return path_data.release_nonnull();
+    }
+
+    // Forget the geometry of paths that are no longer used by any element before adding another.
+    cache.remove_all_matching([](auto const&, auto const& path_data) { return path_data.is_null(); });
+
+    auto path_data = adopt_ref(*new SharedPathData(AttributeParser::parse_path_data(source)));
+    cache.set(source, path_data->make_weak_ptr());
+    return path_data;
+}
+
 SVGPathElement::SVGPathElement(DOM::Document& document, DOM::QualifiedName qualified_name)
     : SVGGeometryElement(document, move(qualified_name))
 {
 }
 
+SVGPathElement::~SVGPathElement() = default;
+
 void SVGPathElement::initialize(JS::Realm& realm)
 {
     WEB_SET_PROTOTYPE_FOR_INTERFACE(SVGPathElement);
@@ -33,14 +79,19 @@ void SVGPathElement::attribute_changed(Utf16FlyString const& name, Optional<Utf1
     Base::attribute_changed(name, old_value, value, namespace_);
 
     if (name == AttributeNames::d) {
-        m_path = AttributeParser::parse_path_data(value.value_or({}));
+        if (value.has_value() && !value->is_empty())
+            m_path_data = path_data_for(*value);
+        else
+            m_path_data = nullptr;
         set_needs_layout_update(DOM::SetNeedsLayoutReason::StyleChange);
     }
 }
 
 Gfx::Path SVGPathElement::get_path(CSSPixelSize)
 {
-    return m_path.to_gfx_path();
+    if (!m_path_data)
+        return {};
+    return m_path_data->gfx_path();
 }
 
 }
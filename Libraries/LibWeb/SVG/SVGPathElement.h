@@ -6,17 +6,19 @@
 
 #pragma once
 
-#include <LibWeb/SVG/Path.h>
+#include <AK/RefPtr.h>
 #include <LibWeb/SVG/SVGGeometryElement.h>
 
 namespace Web::SVG {
 
+class SharedPathData;
+
 class SVGPathElement final : public SVGGeometryElement {
     WEB_PLATFORM_OBJECT(SVGPathElement, SVGGeometryElement);
     GC_DECLARE_ALLOCATOR(SVGPathElement);
 
 public:
-    virtual ~SVGPathElement() override = default;
+    virtual ~SVGPathElement() override;
 
     virtual void attribute_changed(Utf16FlyString const& name, Optional<Utf16String> const& old_value, Optional<Utf16String> const& value, Optional<Utf16FlyString> const& namespace_) override;
 
@@ -27,7 +29,7 @@ private:
 
     virtual void initialize(JS::Realm&) override;
 
-    Path m_path {};
+    RefPtr<SharedPathData const> m_path_data;
 };
 
 }
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/Agent.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/HTML/Window.h>
+#include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
+#include <LibWeb/Scheduling/Scheduler.h>
+#include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/CallbackType.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::Scheduling {
+
+GC_DEFINE_ALLOCATOR(TaskHandle);
+GC_DEFINE_ALLOCATOR(Scheduler);
+
+GC::Ref<TaskHandle> TaskHandle::create(JS::VM& vm, GC::Ref<WebIDL::Promise> promise, GC::Ptr<DOM::AbortSignal> signal)
+{
+    return vm.heap().allocate<TaskHandle>(promise, signal);
+}
+
+TaskHandle::TaskHandle(GC::Ref<WebIDL::Promise> promise, GC::Ptr<DOM::AbortSignal> signal)
+    : m_promise(promise)
+    , m_signal(signal)
+{
+}
+
+void TaskHandle::visit_edges(Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_promise);
+    visitor.visit(m_signal);
+}
+
+GC::Ref<Scheduler> Scheduler::create(JS::Realm& realm)
+{
+    return realm.create<Scheduler>(realm);
+}
+
+Scheduler::Scheduler(JS::Realm& realm)
+    : PlatformObject(realm)
+{
+}
+
+Scheduler::~Scheduler() = default;
+
+void Scheduler::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(Scheduler);
+    Base::initialize(realm);
+}
+
+static HTML::Task::Priority to_task_priority(Bindings::TaskPriority priority)
+{
+    switch (priority) {
+    case Bindings::TaskPriority::UserBlocking:
+        return HTML::Task::Priority::UserBlocking;
+    case Bindings::TaskPriority::UserVisible:
+        return HTML::Task::Priority::UserVisible;
+    case Bindings::TaskPriority::Background:
+        return HTML::Task::Priority::Background;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// https://wicg.github.io/scheduling-apis/#select-the-next-scheduler-task-queue-from-all-schedulers
+// NOTE: Scheduler tasks are queued on the event loop's task queue with the effective priority of their scheduler task
+//       queue, which is how the event loop picks them before or after other tasks.
+static HTML::Task::Priority effective_priority(HTML::Task::Priority priority, bool is_continuation)
+{
+    if (!is_continuation)
+        return priority;
+
+    switch (priority) {
+    case HTML::Task::Priority::UserBlocking:
+        return HTML::Task::Priority::UserBlockingContinuation;
+    case HTML::Task::Priority::UserVisible:
+        return HTML::Task::Priority::UserVisibleContinuation;
+    case HTML::Task::Priority::Background:
+        return HTML::Task::Priority::BackgroundContinuation;
+    default:
+        VERIFY_NOT_REACHED();
+    }
+}
+
+// https://wicg.github.io/scheduling-apis/#dom-scheduler-posttask
+GC::Ref<WebIDL::Promise> Scheduler::post_task(GC::Ref<WebIDL::CallbackType> callback, Bindings::SchedulerPostTaskOptions const& options)
+{
+    // The postTask(callback, options) method steps are to return the result of scheduling a postTask task for this
+    // given callback and options.
+
+    // https://wicg.github.io/scheduling-apis/#schedule-a-posttask-task
+    auto& realm = this->realm();
+
+    // 1. Let result be a new promise.
+    auto result = WebIDL::create_promise(realm);
+
+    // 2. Let signal be options["signal"] if options["signal"] exists, or otherwise null.
+    GC::Ptr<DOM::AbortSignal> signal = options.signal;
+
+    // 3. If signal is not null and it is aborted, then reject result with signal's abort reason and return result.
+    if (signal && signal->aborted()) {
+        WebIDL::reject_promise(realm, result, signal->reason());
+        return result;
+    }
+
+    // 4. Let state be a new scheduling state.
+    // 5. Set state's abort source to signal.
+    // 6. If options["priority"] exists, then set state's priority source to the result of creating a fixed priority
+    //    unabortable task signal given options["priority"].
+    // FIXME: 7. Otherwise if signal is not null and implements the TaskSignal interface, then set state's priority source
+    //           to signal.
+    // 8. If state's priority source is null, then set state's priority source to the result of creating a fixed
+    //    priority unabortable task signal given "user-visible".
+    HTML::EventLoop::SchedulingState state {
+        .abort_source = signal,
+        .priority = options.priority.has_value() ? to_task_priority(*options.priority) : HTML::Task::Priority::UserVisible,
+    };
+
+    // 9. Let handle be the result of creating a task handle given result and signal.
+    // 10. If signal is not null, then add handle's abort steps to signal.
+    auto handle = create_a_task_handle(result, signal);
+
+    // 11. Let enqueueSteps be the following steps:
+    auto enqueue_steps = [this, handle, callback, state = move(state)]() {
+        // 1. Set handle's queue to the result of selecting the scheduler task queue for scheduler given state's
+        //    priority source and false.
+        // 2. Schedule a task to invoke an algorithm for scheduler given handle and the following steps:
+        schedule_a_task_to_invoke_an_algorithm(handle, effective_priority(state.priority, false), GC::create_function(heap(), [this, handle, callback, state]() {
+            auto& realm = this->realm();
+
+            // 1. Let event loop be the scheduler's relevant agent's event loop.
+            auto& event_loop = *HTML::relevant_agent(*this).event_loop;
+
+            // 2. Set event loop's current scheduling state to state.
+            event_loop.set_current_scheduling_state(state);
+
+            // 3. Let callbackResult be the result of invoking callback with « » and "rethrow". If that threw an
+            //    exception, then reject result with that. Otherwise, resolve result with callbackResult.
+            HTML::TemporaryExecutionContext context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
+            auto callback_result = WebIDL::invoke_callback(*callback, {}, WebIDL::ExceptionBehavior::Rethrow, {});
+            if (callback_result.is_abrupt())
+                WebIDL::reject_promise(realm, handle->promise(), callback_result.error_value());
+            else
+                WebIDL::resolve_promise(realm, handle->promise(), callback_result.value());
+
+            // 4. Set event loop's current scheduling state to null.
+            event_loop.set_current_scheduling_state({});
+        }));
+    };
+
+    // 12. Let delay be options["delay"].
+    auto delay = options.delay;
+
+    // 13. If delay is greater than 0, then run steps after a timeout given scheduler's relevant global object,
+    //     "scheduler-postTask", delay, and the following steps:
+    if (delay > 0) {
+        auto& global = as<HTML::WindowOrWorkerGlobalScopeMixin>(HTML::relevant_global_object(*this));
+        global.run_steps_after_a_timeout(static_cast<i32>(min(delay, static_cast<u64>(NumericLimits<i32>::max()))), [signal, enqueue_steps = move(enqueue_steps)]() {
+            // 1. If signal is null or signal is not aborted, then run enqueueSteps.
+            if (!signal || !signal->aborted())
+                enqueue_steps();
+        });
+    }
+    // 14. Otherwise, run enqueueSteps.
+    else {
+        enqueue_steps();
+    }
+
+    // 15. Return result.
+    return result;
+}
+
+// https://wicg.github.io/scheduling-apis/#dom-scheduler-yield
+GC::Ref<WebIDL::Promise> Scheduler::yield()
+{
+    // The yield() method steps are to return the result of scheduling a yield continuation for this.
+
+    // https://wicg.github.io/scheduling-apis/#schedule-a-yield-continuation
+    auto& realm = this->realm();
+
+    // 1. Let inheritedState be the scheduler's relevant agent's event loop's current scheduling state.
+    // FIXME: The scheduling state should also be propagated to promise reactions, so that it survives an await.
+    auto const& inherited_state = HTML::relevant_agent(*this).event_loop->current_scheduling_state();
+
+    // 2. Let abortSource be inheritedState's abort source if inheritedState is not null, or otherwise null.
+    GC::Ptr<DOM::AbortSignal> abort_source = inherited_state.has_value() ? inherited_state->abort_source : nullptr;
+
+    // 3. If abortSource is not null and abortSource is aborted, then return a promise rejected with abortSource's
+    //    abort reason.
+    if (abort_source && abort_source->aborted())
+        return WebIDL::create_rejected_promise(realm, abort_source->reason());
+
+    // 4. Let prioritySource be inheritedState's priority source if inheritedState is not null, or otherwise null.
+    // 5. If prioritySource is null, then set prioritySource to the result of creating a fixed priority unabortable task
+    //    signal given "user-visible".
+    auto priority = inherited_state.has_value() ? inherited_state->priority : HTML::Task::Priority::UserVisible;
+
+    // 6. Let result be a new promise.
+    auto result = WebIDL::create_promise(realm);
+
+    // 7. Let handle be the result of creating a task handle given result and abortSource.
+    // 8. If abortSource is not null, then add handle's abort steps to abortSource.
+    auto handle = create_a_task_handle(result, abort_source);
+
+    // 9. Set handle's queue to the result of selecting the scheduler task queue for the scheduler given prioritySource
+    //    and true.
+    // 10. Schedule a task to invoke an algorithm for scheduler given handle and the following steps:
+    schedule_a_task_to_invoke_an_algorithm(handle, effective_priority(priority, true), GC::create_function(heap(), [this, handle]() {
+        // 1. Resolve result.
+        HTML::TemporaryExecutionContext context { realm(), HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
+        WebIDL::resolve_promise(realm(), handle->promise());
+    }));
+
+    // 11. Return result.
+    return result;
+}
+
+// https://wicg.github.io/scheduling-apis/#create-a-task-handle
+GC::Ref<TaskHandle> Scheduler::create_a_task_handle(GC::Ref<WebIDL::Promise> promise, GC::Ptr<DOM::AbortSignal> signal)
+{
+    // 1. Let handle be a new task handle.
+    // 2. Set handle's task to null.
+    // 3. Set handle's queue to null.
+    auto handle = TaskHandle::create(vm(), promise, signal);
+
+    if (!signal)
+        return handle;
+
+    // 4. Set handle's abort steps to the following steps:
+    handle->abort_steps = signal->add_abort_algorithm([this, handle, signal]() {
+        auto& realm = this->realm();
+
+        // 1. Reject promise with signal's abort reason.
+        HTML::TemporaryExecutionContext context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
+        WebIDL::reject_promise(realm, handle->promise(), signal->reason());
+
+        // 2. If task is not null, then remove task from queue.
+        if (handle->task.has_value()) {
+            auto task_id = *handle->task;
+            HTML::relevant_agent(*this).event_loop->task_queue().remove_tasks_matching([task_id](HTML::Task const& task) {
+                return task.id() == task_id;
+            });
+        }
+    });
+
+    // 5. Return handle.
+    return handle;
+}
+
+// https://wicg.github.io/scheduling-apis/#schedule-a-task-to-invoke-an-algorithm
+void Scheduler::schedule_a_task_to_invoke_an_algorithm(GC::Ref<TaskHandle> handle, HTML::Task::Priority priority, GC::Ref<GC::Function<void()>> steps)
+{
+    // 1. Let global be the scheduler's relevant global object.
+    auto& global = HTML::relevant_global_object(*this);
+
+    // 2. Let document be global's associated Document if global is a Window object; otherwise null.
+    GC::Ptr<DOM::Document> document;
+    if (auto* window = as_if<HTML::Window>(global))
+        document = window->associated_document();
+
+    // 3. Let event loop be the scheduler's relevant agent's event loop.
+    auto& event_loop = *HTML::relevant_agent(*this).event_loop;
+
+    // 4. Set handle's task to the result of queuing a task on handle's queue given the posted task task source, event
+    //    loop, document, and the following steps:
+    auto task = HTML::Task::create(vm(), HTML::Task::Source::PostedTask, document, GC::create_function(heap(), [handle, steps]() {
+        // 1. Run steps.
+        steps->function()();
+
+        // 2. If handle's abort steps is not null, then remove handle's abort steps from handle's signal.
+        if (handle->abort_steps.has_value())
+            handle->signal()->remove_abort_algorithm(*handle->abort_steps);
+        handle->task = {};
+    }));
+    task->set_priority(priority);
+    handle->task = task->id();
+    event_loop.task_queue().add(task);
+}
+
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/Bindings/Scheduler.h>
+#include <LibWeb/DOM/AbortSignal.h>
+#include <LibWeb/HTML/EventLoop/Task.h>
+
+namespace Web::Scheduling {
+
+// https://wicg.github.io/scheduling-apis/#task-handle
+class TaskHandle final : public JS::Cell {
+    GC_CELL(TaskHandle, JS::Cell);
+    GC_DECLARE_ALLOCATOR(TaskHandle);
+
+public:
+    [[nodiscard]] static GC::Ref<TaskHandle> create(JS::VM&, GC::Ref<WebIDL::Promise>, GC::Ptr<DOM::AbortSignal>);
+
+    // A task handle has an associated task (null or a task), initially null.
+    Optional<HTML::TaskID> task;
+
+    // A task handle has an associated abort steps (null or an algorithm), initially null.
+    Optional<DOM::AbortSignal::AbortAlgorithmID> abort_steps;
+
+    GC::Ref<WebIDL::Promise> promise() const { return m_promise; }
+    GC::Ptr<DOM::AbortSignal> signal() const { return m_signal; }
+
+private:
+    TaskHandle(GC::Ref<WebIDL::Promise>, GC::Ptr<DOM::AbortSignal>);
+
+    virtual void visit_edges(Visitor&) override;
+
+    GC::Ref<WebIDL::Promise> m_promise;
+    GC::Ptr<DOM::AbortSignal> m_signal;
+};
+
+// https://wicg.github.io/scheduling-apis/#scheduler
+class Scheduler final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(Scheduler, Bindings::PlatformObject);
+    GC_DECLARE_ALLOCATOR(Scheduler);
+
+public:
+    [[nodiscard]] static GC::Ref<Scheduler> create(JS::Realm&);
+
+    virtual ~Scheduler() override;
+
+    GC::Ref<WebIDL::Promise> post_task(GC::Ref<WebIDL::CallbackType> callback, Bindings::SchedulerPostTaskOptions const& = {});
+    GC::Ref<WebIDL::Promise> yield();
+
+private:
+    explicit Scheduler(JS::Realm&);
+
+    virtual void initialize(JS::Realm&) override;
+
+    GC::Ref<TaskHandle> create_a_task_handle(GC::Ref<WebIDL::Promise>, GC::Ptr<DOM::AbortSignal>);
+    void schedule_a_task_to_invoke_an_algorithm(GC::Ref<TaskHandle>, HTML::Task::Priority, GC::Ref<GC::Function<void()>> steps);
+};
+
+}
@@ -1942,6 +1942,40 @@ WebIDL::ExceptionOr<void> readable_byte_stream_controller_enqueue_native_bytes(R
     VERIFY(bytes.size() <= NumericLimits<u32>::max());
     auto byte_length = static_cast<u32>(bytes.size());
 
+    // OPTIMIZATION: When a BYOB read is waiting and the bytes fit in its view, the enqueue algorithm would put them in
+    //               the queue only to copy them straight back out into the view. Write them into the view directly
+    //               instead, which is observably the same and does not need an ArrayBuffer for the chunk.
+    if (readable_stream_has_byob_reader(*stream) && controller.queue().is_empty() && !controller.pending_pull_intos().is_empty()) {
+        auto first_pending_pull_into = controller.pending_pull_intos().first();
+        auto bytes_filled = first_pending_pull_into->bytes_filled + byte_length;
+
+        if (first_pending_pull_into->reader_type == ReaderType::Byob
+            && !first_pending_pull_into->buffer->is_detached()
+            && bytes_filled <= first_pending_pull_into->byte_length
+            && bytes_filled % first_pending_pull_into->element_size == 0) {
+            // 8.3. Perform ! ReadableByteStreamControllerInvalidateBYOBRequest(controller).
+            readable_byte_stream_controller_invalidate_byob_request(controller);
+
+            // 8.4. Set firstPendingPullInto’s buffer to ! TransferArrayBuffer(firstPendingPullInto’s buffer).
+            first_pending_pull_into->buffer = MUST(transfer_array_buffer(realm, first_pending_pull_into->buffer));
+
+            // 10. Otherwise, if ! ReadableStreamHasBYOBReader(stream) is true, fill the pull-into descriptor as
+            //     ReadableByteStreamControllerProcessPullIntoDescriptorsUsingQueue would, then commit it if it is ready.
+            auto destination_start = first_pending_pull_into->byte_offset + first_pending_pull_into->bytes_filled;
+            first_pending_pull_into->buffer->overwrite(destination_start, bytes.data(), byte_length);
+            readable_byte_stream_controller_fill_head_pull_into_descriptor(controller, byte_length, first_pending_pull_into);
+
+            if (first_pending_pull_into->bytes_filled >= first_pending_pull_into->minimum_fill) {
+                readable_byte_stream_controller_shift_pending_pull_into(controller);
+                readable_byte_stream_controller_commit_pull_into_descriptor(*stream, first_pending_pull_into);
+            }
+
+            // 12. Perform ! ReadableByteStreamControllerCallPullIfNeeded(controller).
+            readable_byte_stream_controller_call_pull_if_needed(controller);
+            return {};
+        }
+    }
+
     // OPTIMIZATION: Native byte producers have no observable chunk object to detach, so enter the enqueue algorithm after
     // the TransferArrayBuffer step with an already-owned ArrayBuffer.
     auto transferred_buffer = JS::ArrayBuffer::create(realm, move(bytes));
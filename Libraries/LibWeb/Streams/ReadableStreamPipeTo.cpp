@@ -112,6 +112,7 @@ void ReadableStreamPipeTo::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_last_write_promise);
     visitor.visit(m_unwritten_chunks);
     visitor.visit(m_on_shutdown);
+    visitor.visit(m_read_request);
 }
 
 void ReadableStreamPipeTo::process()
@@ -220,6 +221,11 @@ void ReadableStreamPipeTo::read_chunk()
     if (check_for_error_and_close_states())
         return;
 
+    if (m_read_request) {
+        readable_stream_default_reader_read(m_reader, *m_read_request);
+        return;
+    }
+
     auto on_chunk = GC::create_function(heap(), [this](JS::Value chunk) {
         m_unwritten_chunks.append(chunk);
 
@@ -238,8 +244,8 @@ void ReadableStreamPipeTo::read_chunk()
             finish();
     });
 
-    auto read_request = heap().allocate<ReadableStreamPipeToReadRequest>(on_chunk, on_complete, *m_on_shutdown);
-    readable_stream_default_reader_read(m_reader, read_request);
+    m_read_request = heap().allocate<ReadableStreamPipeToReadRequest>(on_chunk, on_complete, *m_on_shutdown);
+    readable_stream_default_reader_read(m_reader, *m_read_request);
 }
 
 void ReadableStreamPipeTo::write_chunk()
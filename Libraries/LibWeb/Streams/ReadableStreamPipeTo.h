@@ -73,6 +73,9 @@ private:
 
     GC::Ref<WebIDL::ReactionSteps> m_on_shutdown;
 
+    // Only one read is in flight at a time, so the same read request is used for every chunk.
+    GC::Ptr<ReadRequest> m_read_request;
+
     bool m_prevent_close { false };
     bool m_prevent_abort { false };
     bool m_prevent_cancel { false };
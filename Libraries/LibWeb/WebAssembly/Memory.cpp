@@ -34,7 +34,7 @@ WebIDL::ExceptionOr<GC::Ref<Memory>> Memory::construct_impl(JS::Realm& realm, Bi
     if (shared && !descriptor.maximum.has_value())
         return vm.throw_completion<JS::TypeError>("Maximum has to be specified for shared memory."_utf16);
 
-    Wasm::Limits limits { Wasm::AddressType::I32, descriptor.initial, descriptor.maximum.map([](auto x) -> u64 { return x; }) };
+    Wasm::Limits limits { Wasm::AddressType::I32, descriptor.initial, descriptor.maximum.map([](auto x) -> u64 { return x; }), shared ? Wasm::Limits::Shared::Yes : Wasm::Limits::Shared::No };
     Wasm::MemoryType memory_type { move(limits) };
 
     auto& cache = Detail::get_cache(realm);
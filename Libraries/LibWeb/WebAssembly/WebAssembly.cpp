@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AllOf.h>
 #include <AK/ByteBuffer.h>
 #include <AK/MemoryStream.h>
 #include <AK/NeverDestroyed.h>
@@ -14,6 +15,7 @@
 #include <LibCore/EventLoop.h>
 #include <LibCrypto/Hash/SHA2.h>
 #include <LibHTTP/Cache/Utilities.h>
+#include <LibJS/Runtime/Agent.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/BigInt.h>
@@ -66,7 +68,13 @@ static GC::WeakHashMap<JS::Object, NonnullOwnPtr<WebAssemblyCache>>& caches()
 
 WebAssemblyCache& get_cache(JS::Realm& realm)
 {
-    return *caches().ensure(realm.global_object(), [] { return make<WebAssemblyCache>(); });
+    return *caches().ensure(realm.global_object(), [&realm] {
+        auto cache = make<WebAssemblyCache>();
+        // memory.atomic.wait blocks the calling thread, which only agents that can suspend may do.
+        if (!JS::agent_can_suspend(realm.vm()))
+            cache->abstract_machine().disallow_suspension();
+        return cache;
+    });
 }
 
 }
@@ -236,8 +244,60 @@ namespace Detail {
         _temporary_result.release_value();                                                                                                              \
     })
 
+// Signatures made up of only i32, f32 and f64 pass nothing but numbers across the boundary. Calls through those can
+// convert their values without the generic conversions, and never have a GC-allocated value to keep alive.
+static bool is_numeric_signature(Wasm::FunctionType const& type)
+{
+    auto is_numeric = [](Wasm::ValueType const& type) {
+        return first_is_one_of(type.kind(), Wasm::ValueType::I32, Wasm::ValueType::F32, Wasm::ValueType::F64);
+    };
+    return type.results().size() <= 1 && all_of(type.parameters(), is_numeric) && all_of(type.results(), is_numeric);
+}
+
+static ALWAYS_INLINE JS::ThrowCompletionOr<Wasm::Value> to_numeric_webassembly_value(JS::VM& vm, JS::Value value, Wasm::ValueType::Kind kind)
+{
+    if (kind == Wasm::ValueType::I32)
+        return Wasm::Value { TRY(value.to_i32(vm)) };
+    auto number = value.is_number() ? value.as_double() : TRY(value.to_double(vm));
+    if (kind == Wasm::ValueType::F32)
+        return Wasm::Value { static_cast<float>(number) };
+    return Wasm::Value { number };
+}
+
+static ALWAYS_INLINE JS::Value to_numeric_js_value(Wasm::Value const& value, Wasm::ValueType::Kind kind)
+{
+    if (kind == Wasm::ValueType::I32)
+        return JS::Value(value.to<i32>());
+    if (kind == Wasm::ValueType::F32)
+        return JS::Value(static_cast<double>(value.to<float>()));
+    return JS::Value(value.to<double>());
+}
+
+static Wasm::HostFunction create_numeric_host_function(JS::VM& vm, JS::FunctionObject& function, Wasm::FunctionType const& type, ByteString const& name)
+{
+    return Wasm::HostFunction {
+        [&](auto&, auto arguments) -> Wasm::Result {
+            // Numbers aren't cells, so the arguments don't have to be rooted.
+            Vector<JS::Value, 8> argument_values;
+            argument_values.ensure_capacity(arguments.size());
+            for (size_t i = 0; i < arguments.size(); ++i)
+                argument_values.unchecked_append(to_numeric_js_value(arguments[i], type.parameters()[i].kind()));
+
+            auto result = TRY_OR_RETURN_TRAP(JS::call(vm, function, JS::js_undefined(), argument_values.span()));
+            if (type.results().is_empty())
+                return Wasm::Result { Vector<Wasm::Value> {} };
+            return Wasm::Result { Vector<Wasm::Value> { TRY_OR_RETURN_TRAP(to_numeric_webassembly_value(vm, result, type.results().first().kind())) } };
+        },
+        type,
+        name,
+    };
+}
+
 Wasm::HostFunction create_host_function(JS::VM& vm, JS::FunctionObject& function, Wasm::FunctionType const& type, ByteString const& name)
 {
+    if (is_numeric_signature(type))
+        return create_numeric_host_function(vm, function, type, name);
+
     return Wasm::HostFunction {
         [&](auto&, auto arguments) -> Wasm::Result {
             GC::RootVector<JS::Value> argument_values;
@@ -447,33 +507,63 @@ JS::ThrowCompletionOr<NonnullRefPtr<Wasm::ModuleInstance>> instantiate_module(JS
     return instance_result.release_value();
 }
 
-// https://webassembly.github.io/spec/js-api/#compile-a-webassembly-module
-// https://webassembly.github.io/content-security-policy/js-api/#compile-a-webassembly-module
-JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_webassembly_module(JS::VM& vm, ByteBuffer data)
+static bool wasm_disk_cache_is_available()
 {
-    TRY(host_ensure_can_compile_wasm_bytes(vm));
+    return ResourceLoader::is_initialized() && ResourceLoader::the().request_client();
+}
 
-    Wasm::ModuleStats stats;
-    stats.input_size_bytes = data.size();
+static ByteString digest_to_hex(::Crypto::Hash::SHA256::DigestType const& digest)
+{
+    StringBuilder hex_builder;
+    for (auto byte : digest.bytes())
+        hex_builder.appendff("{:02x}", byte);
+    return hex_builder.to_byte_string();
+}
 
-    auto parse_start = MonotonicTime::now();
-    FixedMemoryStream stream { data.bytes() };
-    auto module_result = Wasm::Module::parse(stream);
-    stats.parse_time = MonotonicTime::now() - parse_start;
-    if (module_result.is_error()) {
-        return vm.throw_completion<CompileError>(Wasm::parse_error_to_byte_string(module_result.error()));
+// Modules compiled by any realm of this process, keyed by the digest of their bytes. Compiling the same bytes again,
+// e.g. in another frame, reuses the parsed module and its native code instead of holding another copy of both.
+static HashMap<ByteString, WeakPtr<CompiledWebAssemblyModule>>& shared_compiled_modules()
+{
+    static NeverDestroyed<HashMap<ByteString, WeakPtr<CompiledWebAssemblyModule>>> s_modules;
+    return *s_modules;
+}
+
+static RefPtr<CompiledWebAssemblyModule> reuse_shared_compiled_module(JS::VM& vm, ByteString const& digest_hex)
+{
+    auto entry = shared_compiled_modules().get(digest_hex);
+    if (!entry.has_value())
+        return {};
+
+    auto compiled_module = entry->strong_ref();
+    if (!compiled_module) {
+        shared_compiled_modules().remove(digest_hex);
+        return {};
     }
 
-    // Content-keyed disk cache: hash the wasm bytes, slot into the HTTP side-data shelf under a synthetic wasm-cache://<hex> URL
+    get_cache(*vm.current_realm()).add_compiled_module(*compiled_module);
+    return compiled_module;
+}
+
+static void share_compiled_module(ByteString digest_hex, CompiledWebAssemblyModule& compiled_module)
+{
+    auto& modules = shared_compiled_modules();
+    modules.remove_all_matching([](auto const&, auto const& module) { return module.is_null(); });
+    modules.set(move(digest_hex), compiled_module);
+}
+
+// Validates a parsed module and hands it off for native compilation. The digest of the module's bytes keys its native
+// code in the disk cache.
+static JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> finish_compiling_a_webassembly_module(JS::VM& vm, NonnullRefPtr<Wasm::Module> module, Wasm::ModuleStats stats, ::Crypto::Hash::SHA256::DigestType const& digest)
+{
+    auto digest_hex = digest_to_hex(digest);
+
+    // Content-keyed disk cache: slot the native code into the HTTP side-data shelf under a synthetic
+    // wasm-cache://<compiler version>-<hex> URL, so that a new build of the compiler never sees stale native code.
     Optional<Wasm::CompileCacheConfig> wasm_cache_config;
-    if (ResourceLoader::is_initialized() && ResourceLoader::the().request_client()) {
-        auto digest = ::Crypto::Hash::SHA256::hash(data.data(), data.size());
+    if (wasm_disk_cache_is_available()) {
         __builtin_memcpy(stats.wasm_hash.data(), digest.bytes().data(), 32);
 
-        StringBuilder hex_builder;
-        for (auto byte : digest.bytes())
-            hex_builder.appendff("{:02x}", byte);
-        auto synthetic_url = URL::Parser::basic_parse(ByteString::formatted("wasm-cache://{}", hex_builder.to_byte_string()));
+        auto synthetic_url = URL::Parser::basic_parse(ByteString::formatted("wasm-cache://{:016x}-{}", Wasm::cranelift_compiler_version(), digest_hex));
         if (synthetic_url.has_value()) {
             auto method = "GET"_string.to_byte_string();
             (void)ResourceLoader::the().request_client()->create_synthetic_cache_entry(*synthetic_url, method);
@@ -510,17 +600,25 @@ JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_webass
 
     constexpr auto compile_to_native = Wasm::CompileToNative::No;
 
+    // Validating every function body of a huge module takes long enough to be noticeable, so only the module structure
+    // is validated up front and each body on its first call. The background compilation below validates the rest, but
+    // a body that turns out to be invalid only traps when called instead of failing the compilation.
+    // NOTE: WebAssembly.validate() always validates every body, so it reports invalid modules as the spec requires.
+    static constexpr size_t lazy_validation_threshold_bytes = 16 * MiB;
+    auto validation_mode = stats.input_size_bytes >= lazy_validation_threshold_bytes ? Wasm::ValidationMode::Lazy : Wasm::ValidationMode::Eager;
+
     auto& cache = get_cache(*vm.current_realm());
     auto validate_start = MonotonicTime::now();
-    auto validation_result = cache.abstract_machine().validate(module_result.value(), {}, compile_to_native);
+    auto validation_result = cache.abstract_machine().validate(*module, {}, compile_to_native, validation_mode);
     stats.validate_time = MonotonicTime::now() - validate_start;
 
     if (validation_result.is_error()) {
         return vm.throw_completion<CompileError>(validation_result.error().error_string);
     }
 
-    auto compiled_module = make_ref_counted<CompiledWebAssemblyModule>(module_result.release_value());
+    auto compiled_module = make_ref_counted<CompiledWebAssemblyModule>(move(module));
     cache.add_compiled_module(compiled_module);
+    share_compiled_module(move(digest_hex), *compiled_module);
     if (wasm_cache_config.has_value())
         compiled_module->module->set_cranelift_cache_config(wasm_cache_config.release_value());
     compiled_module->module->set_compile_stats(move(stats));
@@ -530,6 +628,83 @@ JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_webass
     return compiled_module;
 }
 
+// https://webassembly.github.io/spec/js-api/#compile-a-webassembly-module
+// https://webassembly.github.io/content-security-policy/js-api/#compile-a-webassembly-module
+JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_webassembly_module(JS::VM& vm, ByteBuffer data)
+{
+    TRY(host_ensure_can_compile_wasm_bytes(vm));
+
+    auto digest = ::Crypto::Hash::SHA256::hash(data.data(), data.size());
+    if (auto compiled_module = reuse_shared_compiled_module(vm, digest_to_hex(digest)))
+        return compiled_module.release_nonnull();
+
+    Wasm::ModuleStats stats;
+    stats.input_size_bytes = data.size();
+
+    auto parse_start = MonotonicTime::now();
+    FixedMemoryStream stream { data.bytes() };
+    auto module_result = Wasm::Module::parse(stream);
+    stats.parse_time = MonotonicTime::now() - parse_start;
+    if (module_result.is_error()) {
+        return vm.throw_completion<CompileError>(Wasm::parse_error_to_byte_string(module_result.error()));
+    }
+
+    return finish_compiling_a_webassembly_module(vm, module_result.release_value(), move(stats), digest);
+}
+
+// Compiles a module from its bytes as they arrive. Each chunk is parsed right away, so that once the last byte has
+// landed, only validation is left to do.
+class StreamingCompilation : public RefCounted<StreamingCompilation> {
+public:
+    static NonnullRefPtr<StreamingCompilation> create() { return adopt_ref(*new StreamingCompilation); }
+
+    // Returns false once the bytes received so far are known not to form a valid module.
+    bool append(ReadonlyBytes);
+    JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> finish(JS::VM&);
+
+    bool is_settled() const { return m_is_settled; }
+    void set_settled() { m_is_settled = true; }
+
+private:
+    StreamingCompilation();
+
+    NonnullRefPtr<Wasm::StreamingModuleParser> m_parser;
+    NonnullOwnPtr<::Crypto::Hash::SHA256> m_hasher;
+    Wasm::ModuleStats m_stats;
+    bool m_is_settled { false };
+};
+
+StreamingCompilation::StreamingCompilation()
+    : m_parser(Wasm::StreamingModuleParser::create())
+    , m_hasher(::Crypto::Hash::SHA256::create())
+{
+}
+
+bool StreamingCompilation::append(ReadonlyBytes bytes)
+{
+    m_stats.input_size_bytes += bytes.size();
+    m_hasher->update(bytes);
+
+    auto parse_start = MonotonicTime::now();
+    auto result = m_parser->append(bytes);
+    m_stats.parse_time += MonotonicTime::now() - parse_start;
+    return !result.is_error();
+}
+
+JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> StreamingCompilation::finish(JS::VM& vm)
+{
+    auto module_result = m_parser->finish();
+    if (module_result.is_error())
+        return vm.throw_completion<CompileError>(Wasm::parse_error_to_byte_string(module_result.error()));
+
+    // The bytes have been parsed by now, but another realm may still have the module validated and compiled already.
+    auto digest = m_hasher->digest();
+    if (auto compiled_module = reuse_shared_compiled_module(vm, digest_to_hex(digest)))
+        return compiled_module.release_nonnull();
+
+    return finish_compiling_a_webassembly_module(vm, module_result.release_value(), move(m_stats), digest);
+}
+
 // https://webassembly.github.io/spec/js-api/#HostResizeArrayBuffer
 JS::ThrowCompletionOr<JS::HandledByHost> host_resize_array_buffer(JS::VM& vm, JS::ArrayBuffer& buffer, size_t new_length)
 {
@@ -718,6 +893,19 @@ static Utf16FlyString name_of_webassembly_function(Wasm::Store& store, Wasm::Fun
     return Utf16String::number(index);
 }
 
+static JS::Completion throw_completion_for_trap(JS::VM& vm, Wasm::Trap const& trap)
+{
+    // FIXME: Use the convoluted mapping of errors defined in the spec.
+    if (auto ptr = trap.data.get_pointer<Wasm::ExternallyManagedTrap>())
+        return ptr->unsafe_external_object_as<JS::Completion>();
+    auto message = trap.format();
+    // https://webassembly.github.io/spec/js-api/#stack-overflow
+    // 6.1. Whenever a stack overflow occurs in WebAssembly code, the same class of exception is thrown as for a stack overflow in JavaScript.
+    if (message.ends_with(Wasm::Constants::stack_exhaustion_message))
+        return vm.throw_completion<JS::InternalError>(JS::ErrorType::CallStackSizeExceeded);
+    return vm.throw_completion<RuntimeError>(Utf16String::formatted("Wasm execution trapped (WIP): {}", message));
+}
+
 JS::NativeFunction* create_native_function(JS::VM& vm, Wasm::FunctionAddress address, Instance* instance)
 {
     auto& realm = *vm.current_realm();
@@ -730,6 +918,39 @@ JS::NativeFunction* create_native_function(JS::VM& vm, Wasm::FunctionAddress add
     auto type = store.get(address)->visit([&](auto const& value) { return value.type(); });
     auto length = type.parameters().size();
 
+    if (Detail::is_numeric_signature(type)) {
+        // Reserve room for the callee's locals up front, so that the arguments become its frame without being moved.
+        size_t frame_size = type.parameters().size();
+        if (auto const* wasm_function = store.get(address)->get_pointer<Wasm::WasmFunction>()) {
+            auto const& func = wasm_function->code().func();
+            frame_size += func.total_local_count();
+            if (!func.body().needs_validation())
+                frame_size += func.body().compiled_instructions.cranelift_inlined_locals;
+        }
+
+        auto function = ExportedWasmFunction::create(
+            realm,
+            name_of_webassembly_function(store, address),
+            length,
+            [address, type = move(type), frame_size](JS::VM& vm) -> JS::ThrowCompletionOr<JS::Value> {
+                Vector<Wasm::Value, Wasm::ArgumentsStaticSize> values;
+                values.ensure_capacity(frame_size);
+                for (size_t i = 0; i < type.parameters().size(); ++i)
+                    values.unchecked_append(TRY(Detail::to_numeric_webassembly_value(vm, vm.argument(i), type.parameters()[i].kind())));
+
+                auto result = get_cache(*vm.current_realm()).abstract_machine().invoke(address, move(values));
+                if (result.is_trap())
+                    return throw_completion_for_trap(vm, result.trap());
+                if (result.values().is_empty())
+                    return JS::js_undefined();
+                return Detail::to_numeric_js_value(result.values().first(), type.results().first().kind());
+            },
+            address);
+
+        cache.add_function_instance(address, function);
+        return function;
+    }
+
     auto function = ExportedWasmFunction::create(
         realm,
         name_of_webassembly_function(store, address),
@@ -737,7 +958,7 @@ JS::NativeFunction* create_native_function(JS::VM& vm, Wasm::FunctionAddress add
         [address, type = move(type), instance](JS::VM& vm) -> JS::ThrowCompletionOr<JS::Value> {
             (void)instance;
             auto& realm = *vm.current_realm();
-            Vector<Wasm::Value> values;
+            Vector<Wasm::Value, Wasm::ArgumentsStaticSize> values;
             values.ensure_capacity(type.parameters().size());
 
             // Grab as many values as needed and convert them.
@@ -747,17 +968,8 @@ JS::NativeFunction* create_native_function(JS::VM& vm, Wasm::FunctionAddress add
 
             auto& cache = get_cache(realm);
             auto result = cache.abstract_machine().invoke(address, move(values));
-            // FIXME: Use the convoluted mapping of errors defined in the spec.
-            if (result.is_trap()) {
-                if (auto ptr = result.trap().data.get_pointer<Wasm::ExternallyManagedTrap>())
-                    return ptr->unsafe_external_object_as<JS::Completion>();
-                auto trap = result.trap().format();
-                // https://webassembly.github.io/spec/js-api/#stack-overflow
-                // 6.1. Whenever a stack overflow occurs in WebAssembly code, the same class of exception is thrown as for a stack overflow in JavaScript.
-                if (trap.ends_with(Wasm::Constants::stack_exhaustion_message))
-                    return vm.throw_completion<JS::InternalError>(JS::ErrorType::CallStackSizeExceeded);
-                return vm.throw_completion<RuntimeError>(Utf16String::formatted("Wasm execution trapped (WIP): {}", trap));
-            }
+            if (result.is_trap())
+                return throw_completion_for_trap(vm, result.trap());
 
             if (result.values().is_empty())
                 return JS::js_undefined();
@@ -1147,42 +1359,71 @@ GC::Ref<WebIDL::Promise> compile_potential_webassembly_response(JS::VM& vm, GC::
         }
 
         // 8. Consume response’s body as an ArrayBuffer, and let bodyPromise be the result.
-        auto body_promise_or_error = response_object->array_buffer();
-        if (body_promise_or_error.is_error()) {
-            auto throw_completion = Bindings::exception_to_throw_completion(realm.vm(), body_promise_or_error.release_error());
-            WebIDL::reject_promise(realm, return_value, throw_completion.value());
+        // NB: Rather than waiting for the whole body, we read it incrementally and parse the module as its bytes arrive,
+        //     which the note above allows for. The outcome is the same as for the steps below, but once the last byte
+        //     has landed, only validation is left to do.
+        if (response_object->is_unusable()) {
+            WebIDL::reject_promise(realm, return_value, vm.throw_completion<JS::TypeError>("Body is unusable"_utf16).value());
             return JS::js_undefined();
         }
-        auto body_promise = body_promise_or_error.release_value();
-
-        // 9. Upon fulfillment of bodyPromise with value bodyArrayBuffer:
-        auto body_fulfillment_steps = GC::create_function(vm.heap(), [&vm, return_value](JS::Value body_array_buffer) -> WebIDL::ExceptionOr<JS::Value> {
-            // 1. Let stableBytes be a copy of the bytes held by the buffer bodyArrayBuffer.
-            VERIFY(body_array_buffer.is_object());
-            auto stable_bytes = WebIDL::get_buffer_source_copy(body_array_buffer.as_object());
-            if (stable_bytes.is_error()) {
-                VERIFY(stable_bytes.error().code() == ENOMEM);
-                WebIDL::reject_promise(HTML::relevant_realm(*return_value->promise()), return_value, vm.throw_completion<JS::InternalError>(vm.error_message(JS::VM::ErrorMessage::OutOfMemory)).value());
-                return JS::js_undefined();
+
+        if (auto result = Detail::host_ensure_can_compile_wasm_bytes(vm); result.is_error()) {
+            WebIDL::reject_promise(realm, return_value, result.error_value());
+            return JS::js_undefined();
+        }
+
+        auto compilation = Detail::StreamingCompilation::create();
+
+        auto settle = [&realm, return_value, compilation](JS::ThrowCompletionOr<NonnullRefPtr<Detail::CompiledWebAssemblyModule>> module_or_error) {
+            compilation->set_settled();
+
+            // If module is error, reject returnValue with a CompileError exception.
+            if (module_or_error.is_error()) {
+                WebIDL::reject_promise(realm, return_value, module_or_error.error_value());
+                return;
             }
 
-            // 2. Asynchronously compile the WebAssembly module stableBytes using the networking task source and resolve returnValue with the result.
-            auto result = asynchronously_compile_webassembly_module(vm, stable_bytes.release_value(), HTML::Task::Source::Networking);
+            // Otherwise, construct a WebAssembly module object from module and resolve returnValue with it.
+            auto module_object = realm.create<Module>(realm, module_or_error.release_value());
+            WebIDL::resolve_promise(realm, return_value, module_object);
+        };
 
-            // Need to manually convert WebIDL promise to an ECMAScript value here to resolve
-            WebIDL::resolve_promise(HTML::relevant_realm(*return_value->promise()), return_value, result->promise());
+        auto process_body_chunk = GC::create_function(vm.heap(), [&vm, &realm, compilation, settle](ByteBuffer bytes) {
+            if (compilation->is_settled())
+                return;
 
-            return JS::js_undefined();
+            // A malformed module is reported right away, without waiting for the rest of the body.
+            if (!compilation->append(bytes)) {
+                HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+                settle(compilation->finish(vm));
+            }
         });
 
-        // 10. Upon rejection of bodyPromise with reason reason:
-        auto body_rejection_steps = GC::create_function(vm.heap(), [return_value](JS::Value reason) -> WebIDL::ExceptionOr<JS::Value> {
-            // 1. Reject returnValue with reason.
-            WebIDL::reject_promise(HTML::relevant_realm(*return_value->promise()), return_value, reason);
-            return JS::js_undefined();
+        auto process_end_of_body = GC::create_function(vm.heap(), [&vm, &realm, compilation, settle] {
+            if (compilation->is_settled())
+                return;
+
+            HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+            settle(compilation->finish(vm));
+        });
+
+        auto process_body_error = GC::create_function(vm.heap(), [&realm, return_value, compilation](JS::Value reason) {
+            if (compilation->is_settled())
+                return;
+            compilation->set_settled();
+
+            // Reject returnValue with reason.
+            WebIDL::reject_promise(realm, return_value, reason);
         });
 
-        WebIDL::react_to_promise(body_promise, body_fulfillment_steps, body_rejection_steps);
+        // A null body is an empty byte sequence, which is not a valid module.
+        auto body = response->body();
+        if (!body) {
+            process_end_of_body->function()();
+            return JS::js_undefined();
+        }
+
+        body->incrementally_read(process_body_chunk, process_end_of_body, process_body_error, GC::Ref { realm.global_object() });
 
         return JS::js_undefined();
     });
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AK/Optional.h>
+#include <AK/Weakable.h>
 #include <LibGC/Root.h>
 #include <LibGC/WeakHashMap.h>
 #include <LibJS/Forward.h>
@@ -39,7 +40,9 @@ namespace Detail {
 
 Wasm::HostFunction create_host_function(JS::VM& vm, JS::FunctionObject& function, Wasm::FunctionType const& type, ByteString const& name);
 
-struct CompiledWebAssemblyModule : public RefCounted<CompiledWebAssemblyModule> {
+// Never modified once compiled, so that all realms of the process that compile the same bytes can share it.
+struct CompiledWebAssemblyModule : public RefCounted<CompiledWebAssemblyModule>
+    , public Weakable<CompiledWebAssemblyModule> {
     explicit CompiledWebAssemblyModule(NonnullRefPtr<Wasm::Module> module)
         : module(move(module))
     {
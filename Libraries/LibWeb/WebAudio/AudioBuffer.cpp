@@ -166,6 +166,34 @@ WebIDL::ExceptionOr<void> AudioBuffer::copy_to_channel(GC::Ref<JS::Float32Array>
     return {};
 }
 
+// https://webaudio.github.io/web-audio-api/#acquire-the-content
+ErrorOr<Vector<FixedArray<float>>> AudioBuffer::acquire_the_content() const
+{
+    // NOTE: Rather than detaching the channel data and handing it over, the rendering thread gets its own copy. That
+    //       keeps the ArrayBuffers usable from script while the content plays, at the cost of one copy per start().
+    Vector<FixedArray<float>> channels;
+    TRY(channels.try_ensure_capacity(m_channels.size()));
+    for (auto const& channel : m_channels) {
+        auto samples = TRY(FixedArray<float>::create(m_length));
+        auto record = JS::make_typed_array_with_buffer_witness_record(*channel, JS::ArrayBuffer::Order::SeqCst);
+        auto channel_length = JS::is_typed_array_out_of_bounds(record) ? 0 : JS::typed_array_length(record);
+        auto count = min<size_t>(channel_length, m_length);
+        channel->viewed_array_buffer()->copy_to(channel->byte_offset(), to_bytes(samples.span().trim(count)));
+        channels.unchecked_append(move(samples));
+    }
+    return channels;
+}
+
+void AudioBuffer::set_content(ReadonlySpan<FixedArray<float>> content)
+{
+    VERIFY(content.size() == m_channels.size());
+    for (size_t i = 0; i < m_channels.size(); ++i) {
+        auto& channel = m_channels[i];
+        VERIFY(content[i].size() == m_length);
+        channel->viewed_array_buffer()->overwrite(channel->byte_offset(), content[i].data(), m_length * sizeof(float));
+    }
+}
+
 AudioBuffer::AudioBuffer(JS::Realm& realm, Bindings::AudioBufferOptions const& options)
     : Bindings::PlatformObject(realm)
     , m_length(options.length)
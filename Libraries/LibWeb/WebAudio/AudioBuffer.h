@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/FixedArray.h>
 #include <AK/Vector.h>
 #include <LibJS/Forward.h>
 #include <LibWeb/Bindings/PlatformObject.h>
@@ -34,6 +35,12 @@ public:
     WebIDL::ExceptionOr<void> copy_from_channel(GC::Ref<JS::Float32Array>, WebIDL::UnsignedLong channel_number, WebIDL::UnsignedLong buffer_offset = 0) const;
     WebIDL::ExceptionOr<void> copy_to_channel(GC::Ref<JS::Float32Array>, WebIDL::UnsignedLong channel_number, WebIDL::UnsignedLong buffer_offset = 0);
 
+    // https://webaudio.github.io/web-audio-api/#acquire-the-content
+    ErrorOr<Vector<FixedArray<float>>> acquire_the_content() const;
+
+    // Overwrites each channel with the given samples, which must have one entry of the buffer's length per channel.
+    void set_content(ReadonlySpan<FixedArray<float>>);
+
 private:
     explicit AudioBuffer(JS::Realm&, Bindings::AudioBufferOptions const&);
 
@@ -10,6 +10,7 @@
 #include <LibWeb/WebAudio/AudioBufferSourceNode.h>
 #include <LibWeb/WebAudio/AudioParam.h>
 #include <LibWeb/WebAudio/AudioScheduledSourceNode.h>
+#include <LibWeb/WebAudio/Render/AudioBufferSourceRenderNode.h>
 
 namespace Web::WebAudio {
 
@@ -45,7 +46,9 @@ WebIDL::ExceptionOr<void> AudioBufferSourceNode::set_buffer(GC::Ptr<AudioBuffer>
     // 4. Assign new buffer to the buffer attribute.
     m_buffer = new_buffer;
 
-    // FIXME: 5. If start() has previously been called on this node, perform the operation acquire the content on buffer.
+    // 5. If start() has previously been called on this node, perform the operation acquire the content on buffer.
+    if (new_buffer && source_started())
+        TRY(queue_buffer_content());
 
     return {};
 }
@@ -72,6 +75,7 @@ GC::Ref<AudioParam> AudioBufferSourceNode::detune() const
 WebIDL::ExceptionOr<void> AudioBufferSourceNode::set_loop(bool loop)
 {
     m_loop = loop;
+    update_render_node<Render::AudioBufferSourceRenderNode>([loop](auto& node) { node.set_loop(loop); });
     return {};
 }
 
@@ -85,6 +89,7 @@ bool AudioBufferSourceNode::loop() const
 WebIDL::ExceptionOr<void> AudioBufferSourceNode::set_loop_start(double loop_start)
 {
     m_loop_start = loop_start;
+    update_render_node<Render::AudioBufferSourceRenderNode>([loop_start](auto& node) { node.set_loop_start(loop_start); });
     return {};
 }
 
@@ -98,6 +103,7 @@ double AudioBufferSourceNode::loop_start() const
 WebIDL::ExceptionOr<void> AudioBufferSourceNode::set_loop_end(double loop_end)
 {
     m_loop_end = loop_end;
+    update_render_node<Render::AudioBufferSourceRenderNode>([loop_end](auto& node) { node.set_loop_end(loop_end); });
     return {};
 }
 
@@ -130,11 +136,30 @@ WebIDL::ExceptionOr<void> AudioBufferSourceNode::start(Optional<double> when, Op
     // 3. Set the internal slot [[source started]] on this AudioBufferSourceNode to true.
     set_source_started(true);
 
-    // FIXME: 4. Queue a control message to start the AudioBufferSourceNode, including the parameter values in the message.
-    // FIXME: 5. Acquire the contents of the buffer if the buffer has been set.
+    // 4. Queue a control message to start the AudioBufferSourceNode, including the parameter values in the message.
+    // NOTE: The offset and duration are queued ahead of the start itself, so the render node knows what to play by
+    //       the time it starts.
+    update_render_node<Render::AudioBufferSourceRenderNode>([offset = offset.value_or(0), duration](auto& node) {
+        node.set_playback_region(offset, duration);
+    });
+
+    // 5. Acquire the contents of the buffer if the buffer has been set.
+    if (m_buffer)
+        TRY(queue_buffer_content());
+
+    context()->queue_control_message(StartSource { .node_id = node_id(), .when = when.value_or(0) });
+
     // FIXME: 6. Send a control message to the associated AudioContext to start running its rendering thread only when all the following conditions are met:
 
-    dbgln("FIXME: Implement AudioBufferSourceNode::start(when, offset, duration)");
+    return {};
+}
+
+WebIDL::ExceptionOr<void> AudioBufferSourceNode::queue_buffer_content()
+{
+    auto channels = TRY_OR_THROW_OOM(vm(), m_buffer->acquire_the_content());
+    update_render_node<Render::AudioBufferSourceRenderNode>([channels = move(channels), sample_rate = m_buffer->sample_rate()](auto& node) mutable {
+        node.set_buffer(move(channels), sample_rate);
+    });
     return {};
 }
 
@@ -164,6 +189,11 @@ WebIDL::ExceptionOr<GC::Ref<AudioBufferSourceNode>> AudioBufferSourceNode::const
     return node;
 }
 
+OwnPtr<Render::RenderNode> AudioBufferSourceNode::create_render_node()
+{
+    return make<Render::AudioBufferSourceRenderNode>(*this);
+}
+
 void AudioBufferSourceNode::initialize(JS::Realm& realm)
 {
     WEB_SET_PROTOTYPE_FOR_INTERFACE(AudioBufferSourceNode);
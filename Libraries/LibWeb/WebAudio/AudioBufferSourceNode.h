@@ -44,8 +44,11 @@ protected:
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
+    virtual OwnPtr<Render::RenderNode> create_render_node() override;
 
 private:
+    WebIDL::ExceptionOr<void> queue_buffer_content();
+
     GC::Ptr<AudioBuffer> m_buffer;
     GC::Ref<AudioParam> m_playback_rate;
     GC::Ref<AudioParam> m_detune;
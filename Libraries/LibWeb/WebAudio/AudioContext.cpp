@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibGC/Weak.h>
+#include <LibMedia/Audio/PlaybackStream.h>
 #include <LibWeb/Bindings/AudioContext.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/MediaElementAudioSourceNode.h>
@@ -14,8 +16,11 @@
 #include <LibWeb/HTML/MessagePort.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HTML/Window.h>
+#include <LibWeb/HighResolutionTime/TimeOrigin.h>
+#include <LibWeb/Page/Page.h>
 #include <LibWeb/WebAudio/AudioContext.h>
 #include <LibWeb/WebAudio/AudioDestinationNode.h>
+#include <LibWeb/WebAudio/Render/RealtimeRenderer.h>
 #include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::WebAudio {
@@ -95,14 +100,14 @@ WebIDL::ExceptionOr<GC::Ref<AudioContext>> AudioContext::construct_impl(JS::Real
         }
     }
 
-    // FIXME: 11. If context is allowed to start, send a control message to start processing.
-    // FIXME: Implement control message queue to run following steps on the rendering thread
+    // 11. If context is allowed to start, send a control message to start processing.
     if (context->m_allowed_to_start) {
         // FIXME: 1. Let document be the current settings object's relevant global object's associated Document.
         // FIXME: 2. Attempt to acquire system resources to use a following audio output device based on [[sink ID]] for rendering
 
         // 2. Set this [[rendering thread state]] to running on the AudioContext.
         context->set_rendering_state(Bindings::AudioContextState::Running);
+        context->start_rendering_audio_graph();
 
         // 3. Queue a media element task to execute the following steps:
         context->queue_a_media_element_task(GC::create_function(context->heap(), [context]() {
@@ -132,17 +137,44 @@ void AudioContext::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_pending_resume_promises);
 }
 
+void AudioContext::finalize()
+{
+    Base::finalize();
+    if (m_playback_stream)
+        m_playback_stream->discard_buffer_and_suspend()->when_rejected([](Error&&) { });
+}
+
+// https://webaudio.github.io/web-audio-api/#dom-baseaudiocontext-currenttime
+double AudioContext::current_time() const
+{
+    // This is the time in seconds of the sample frame immediately following the last sample-frame in the block of
+    // audio most recently processed by the context's rendering graph.
+    if (!m_renderer)
+        return Base::current_time();
+    return static_cast<double>(m_renderer->rendered_frame_count()) / sample_rate();
+}
+
 // https://www.w3.org/TR/webaudio/#dom-audiocontext-getoutputtimestamp
 Bindings::AudioTimestamp AudioContext::get_output_timestamp()
 {
     // If the context's rendering graph has not yet processed a block of audio, then
     // getOutputTimestamp call returns an AudioTimestamp instance with both members
     // containing zero.
-    // FIXME: Once we process audio blocks, report the current output stream position
-    //        and the corresponding performance time here.
+    if (!m_playback_stream || !m_renderer || m_renderer->rendered_frame_count() == 0) {
+        return {
+            .context_time = 0.0,
+            .performance_time = 0.0,
+        };
+    }
+
+    // The context time is the position of the sample-frame currently being played by the output device, which the
+    // stream tracks including its latency to the speakers. The performance time is the moment it is being played.
+    // FIXME: After a suspend(), the device's play time no longer lines up with the context's time.
+    auto context_time = min(m_playback_stream->total_time_played().to_seconds_f64(), current_time());
+    auto performance_time = HighResolutionTime::current_high_resolution_time(HTML::relevant_global_object(*this));
     return {
-        .context_time = 0.0,
-        .performance_time = 0.0,
+        .context_time = context_time,
+        .performance_time = performance_time,
     };
 }
 
@@ -178,8 +210,8 @@ WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> AudioContext::resume()
     set_control_state(Bindings::AudioContextState::Running);
 
     // 7. Queue a control message to resume the AudioContext.
-    // FIXME: Implement control message queue to run following steps on the rendering thread
-    // FIXME: 7.1: Attempt to acquire system resources.
+    // NOTE: Resuming is done by resuming the audio output stream, whose data requests drive the rendering thread.
+    // 7.1: Attempt to acquire system resources.
 
     // 7.2: Set the [[rendering thread state]] on the AudioContext to running.
     set_rendering_state(Bindings::AudioContextState::Running);
@@ -268,11 +300,10 @@ WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> AudioContext::suspend()
     set_control_state(Bindings::AudioContextState::Suspended);
 
     // 7. Queue a control message to suspend the AudioContext.
-    // FIXME: Implement control message queue to run following steps on the rendering thread
-    // FIXME: 7.1: Attempt to release system resources.
-
+    // 7.1: Attempt to release system resources.
     // 7.2: Set the [[rendering thread state]] on the AudioContext to suspended.
     set_rendering_state(Bindings::AudioContextState::Suspended);
+    update_playback_stream_state();
 
     // 7.3: queue a media element task to execute the following steps:
     queue_a_media_element_task(GC::create_function(heap(), [promise, this]() {
@@ -321,11 +352,13 @@ WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> AudioContext::close()
     set_control_state(Bindings::AudioContextState::Closed);
 
     // 5. Queue a control message to close the AudioContext.
-    // FIXME: Implement control message queue to run following steps on the rendering thread
-    // FIXME: 5.1: Attempt to release system resources.
-
+    // 5.1: Attempt to release system resources.
     // 5.2: Set the [[rendering thread state]] to "suspended".
     set_rendering_state(Bindings::AudioContextState::Suspended);
+    if (m_playback_stream) {
+        m_playback_stream->discard_buffer_and_suspend()->when_rejected([](Error&&) { });
+        m_playback_stream = nullptr;
+    }
 
     // FIXME: 5.3: If this control message is being run in a reaction to the document being unloaded, abort this algorithm.
 
@@ -352,11 +385,57 @@ WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> AudioContext::close()
     return promise;
 }
 
-// FIXME: Actually implement the rendering thread
 bool AudioContext::start_rendering_audio_graph()
 {
-    bool render_result = true;
-    return render_result;
+    if (m_renderer) {
+        update_playback_stream_state();
+        return true;
+    }
+
+    m_renderer = Render::RealtimeRenderer::create(control_message_queue(), destination()->node_id(), sample_rate());
+
+    // Headless sessions have no audio output, so nothing ever requests audio from the graph.
+    auto const& document = as<HTML::Window>(HTML::relevant_global_object(*this)).associated_document();
+    if (document.page().client().is_headless())
+        return true;
+
+    // The rendering thread is the one the audio output calls back on to request data.
+    constexpr u32 target_latency_ms = 50;
+    auto promise = Audio::PlaybackStream::create(Audio::OutputState::Suspended, target_latency_ms, [renderer = NonnullRefPtr { *m_renderer }](Span<float> buffer) {
+        return renderer->render(buffer);
+    });
+
+    promise->when_resolved([weak_context = GC::Weak<AudioContext> { *this }, renderer = NonnullRefPtr { *m_renderer }](auto& stream) {
+        auto sample_specification = stream->sample_specification();
+        renderer->set_output_specification(sample_specification.sample_rate(), sample_specification.channel_count());
+
+        if (!weak_context || weak_context->state() == Bindings::AudioContextState::Closed)
+            return;
+        weak_context->m_playback_stream = stream;
+        weak_context->update_playback_stream_state();
+    });
+
+    promise->when_rejected([](auto& error) {
+        warnln("Unable to create an audio output for AudioContext: {}", error);
+    });
+
+    return true;
+}
+
+void AudioContext::update_playback_stream_state()
+{
+    if (!m_playback_stream)
+        return;
+
+    if (rendering_state() == Bindings::AudioContextState::Running) {
+        m_playback_stream->resume()->when_rejected([](Error&& error) {
+            warnln("Unable to resume audio output for AudioContext: {}", error);
+        });
+    } else {
+        m_playback_stream->discard_buffer_and_suspend()->when_rejected([](Error&& error) {
+            warnln("Unable to suspend audio output for AudioContext: {}", error);
+        });
+    }
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audiocontext-createmediaelementsource
@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include <AK/RefPtr.h>
 #include <AK/Variant.h>
+#include <LibMedia/Audio/Forward.h>
 #include <LibWeb/Bindings/AudioContext.h>
 #include <LibWeb/HighResolutionTime/DOMHighResTimeStamp.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
@@ -22,8 +24,13 @@ class AudioContext final : public BaseAudioContext {
 public:
     static WebIDL::ExceptionOr<GC::Ref<AudioContext>> construct_impl(JS::Realm&, Optional<Bindings::AudioContextOptions> const& context_options = {});
 
+    static constexpr bool OVERRIDES_FINALIZE = true;
+
     virtual ~AudioContext() override;
 
+    // ^BaseAudioContext
+    virtual double current_time() const override;
+
     double base_latency() const { return m_base_latency; }
     double output_latency() const { return m_output_latency; }
     Bindings::AudioTimestamp get_output_timestamp();
@@ -41,6 +48,7 @@ private:
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
+    virtual void finalize() override;
 
     double m_base_latency { 0 };
     double m_output_latency { 0 };
@@ -50,6 +58,10 @@ private:
     bool m_suspended_by_user = false;
 
     bool start_rendering_audio_graph();
+    void update_playback_stream_state();
+
+    RefPtr<Render::RealtimeRenderer> m_renderer;
+    RefPtr<Audio::PlaybackStream> m_playback_stream;
 };
 
 }
@@ -7,7 +7,9 @@
 
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/WebAudio/AudioNode.h>
+#include <LibWeb/WebAudio/AudioParam.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
+#include <LibWeb/WebAudio/Render/PassThroughRenderNode.h>
 
 namespace Web::WebAudio {
 
@@ -18,7 +20,7 @@ AudioNode::AudioNode(JS::Realm& realm, GC::Ref<BaseAudioContext> context, WebIDL
     , m_context(context)
     , m_channel_count(channel_count)
     , m_node_id(context->next_node_id({}))
-
+    , m_control_message_queue(context->control_message_queue())
 {
 }
 
@@ -83,6 +85,7 @@ WebIDL::ExceptionOr<GC::Ref<AudioNode>> AudioNode::connect(GC::Ref<AudioNode> de
     m_output_connections.append(output_connection);
     // Connect destination_node input to node's output.
     destination_node->m_input_connections.append(input_connection);
+    m_control_message_queue->enqueue(ConnectNodes { .source = m_node_id, .output = output, .destination = destination_node->m_node_id, .input = input });
 
     return destination_node;
 }
@@ -113,6 +116,7 @@ WebIDL::ExceptionOr<void> AudioNode::connect(GC::Ref<AudioParam> destination_par
 
     // Connect node's output to destination_param.
     m_param_connections.append(param_connection);
+    m_control_message_queue->enqueue(ConnectParam { .source = m_node_id, .output = output, .destination = destination_param->param_id() });
 
     return {};
 }
@@ -127,9 +131,11 @@ void AudioNode::disconnect()
         destination->m_input_connections.remove_all_matching([&](AudioNodeConnection& input_connection) {
             return input_connection.destination_node.ptr() == this;
         });
+        queue_disconnect(connection);
     }
 
-    m_param_connections.clear();
+    while (!m_param_connections.is_empty())
+        queue_disconnect(m_param_connections.take_last());
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-disconnect-output
@@ -149,12 +155,16 @@ WebIDL::ExceptionOr<void> AudioNode::disconnect(WebIDL::UnsignedLong output)
         connection.destination_node->m_input_connections.remove_all_matching([&](AudioNodeConnection& reverse_connection) {
             return reverse_connection.destination_node.ptr() == this && reverse_connection.output == output;
         });
+        queue_disconnect(connection);
 
         return true;
     });
 
     m_param_connections.remove_all_matching([&](AudioParamConnection& connection) {
-        return connection.output == output;
+        if (connection.output != output)
+            return false;
+        queue_disconnect(connection);
+        return true;
     });
 
     return {};
@@ -173,6 +183,7 @@ WebIDL::ExceptionOr<void> AudioNode::disconnect(GC::Ref<AudioNode> destination_n
         connection.destination_node->m_input_connections.remove_all_matching([&](AudioNodeConnection& reverse_connection) {
             return reverse_connection.destination_node.ptr() == this;
         });
+        queue_disconnect(connection);
 
         return true;
     });
@@ -202,6 +213,7 @@ WebIDL::ExceptionOr<void> AudioNode::disconnect(GC::Ref<AudioNode> destination_n
         connection.destination_node->m_input_connections.remove_all_matching([&](AudioNodeConnection& reverse_connection) {
             return reverse_connection.destination_node.ptr() == this && reverse_connection.output == output;
         });
+        queue_disconnect(connection);
 
         return true;
     });
@@ -238,6 +250,7 @@ WebIDL::ExceptionOr<void> AudioNode::disconnect(GC::Ref<AudioNode> destination_n
         connection.destination_node->m_input_connections.remove_all_matching([&](AudioNodeConnection& reverse_connection) {
             return reverse_connection.destination_node.ptr() == this && reverse_connection.output == output && reverse_connection.input == input;
         });
+        queue_disconnect(connection);
 
         return true;
     });
@@ -256,7 +269,10 @@ WebIDL::ExceptionOr<void> AudioNode::disconnect(GC::Ref<AudioParam> destination_
     // The destinationParam parameter is the AudioParam to disconnect.
     auto before = m_param_connections.size();
     m_param_connections.remove_all_matching([&](AudioParamConnection& connection) {
-        return connection.destination_param == destination_param;
+        if (connection.destination_param != destination_param)
+            return false;
+        queue_disconnect(connection);
+        return true;
     });
 
     // If there is no connection to the destinationParam, an InvalidAccessError exception MUST be thrown.
@@ -278,7 +294,10 @@ WebIDL::ExceptionOr<void> AudioNode::disconnect(GC::Ref<AudioParam> destination_
     // The destinationParam parameter is the AudioParam to disconnect.
     auto before = m_param_connections.size();
     m_param_connections.remove_all_matching([&](AudioParamConnection& connection) {
-        return connection.destination_param == destination_param && connection.output == output;
+        if (connection.destination_param != destination_param || connection.output != output)
+            return false;
+        queue_disconnect(connection);
+        return true;
     });
 
     // If there is no connection to the destinationParam, an InvalidAccessError exception MUST be thrown.
@@ -298,6 +317,7 @@ WebIDL::ExceptionOr<void> AudioNode::set_channel_count(WebIDL::UnsignedLong chan
         return WebIDL::NotSupportedError::create(realm(), "Invalid channel count"_utf16);
 
     m_channel_count = channel_count;
+    queue_channel_configuration();
     return {};
 }
 
@@ -305,11 +325,12 @@ WebIDL::ExceptionOr<void> AudioNode::set_channel_count(WebIDL::UnsignedLong chan
 WebIDL::ExceptionOr<void> AudioNode::set_channel_count_mode(Bindings::ChannelCountMode channel_count_mode)
 {
     m_channel_count_mode = channel_count_mode;
+    queue_channel_configuration();
     return {};
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-channelcountmode
-Bindings::ChannelCountMode AudioNode::channel_count_mode()
+Bindings::ChannelCountMode AudioNode::channel_count_mode() const
 {
     return m_channel_count_mode;
 }
@@ -318,19 +339,58 @@ Bindings::ChannelCountMode AudioNode::channel_count_mode()
 WebIDL::ExceptionOr<void> AudioNode::set_channel_interpretation(Bindings::ChannelInterpretation channel_interpretation)
 {
     m_channel_interpretation = channel_interpretation;
+    queue_channel_configuration();
     return {};
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-channelinterpretation
-Bindings::ChannelInterpretation AudioNode::channel_interpretation()
+Bindings::ChannelInterpretation AudioNode::channel_interpretation() const
 {
     return m_channel_interpretation;
 }
 
+void AudioNode::queue_channel_configuration()
+{
+    m_control_message_queue->enqueue(SetChannelConfiguration {
+        .node_id = m_node_id,
+        .configuration = {
+            .channel_count = m_channel_count,
+            .channel_count_mode = m_channel_count_mode,
+            .channel_interpretation = m_channel_interpretation,
+        },
+    });
+}
+
+void AudioNode::queue_disconnect(AudioNodeConnection const& connection)
+{
+    m_control_message_queue->enqueue(DisconnectNodes { .source = m_node_id, .output = connection.output, .destination = connection.destination_node->m_node_id, .input = connection.input });
+}
+
+void AudioNode::queue_disconnect(AudioParamConnection const& connection)
+{
+    m_control_message_queue->enqueue(DisconnectParam { .source = m_node_id, .output = connection.output, .destination = connection.destination_param->param_id() });
+}
+
+OwnPtr<Render::RenderNode> AudioNode::create_render_node()
+{
+    return make<Render::PassThroughRenderNode>(*this, number_of_inputs(), number_of_outputs());
+}
+
 void AudioNode::initialize(JS::Realm& realm)
 {
     WEB_SET_PROTOTYPE_FOR_INTERFACE(AudioNode);
     Base::initialize(realm);
+
+    if (auto render_node = create_render_node())
+        m_control_message_queue->enqueue(CreateRenderNode { .node = render_node.release_nonnull() });
+}
+
+void AudioNode::finalize()
+{
+    Base::finalize();
+
+    // The rendering thread decides when the render node can go away, since it may still be producing sound.
+    m_control_message_queue->enqueue(DestroyRenderNode { .node_id = m_node_id });
 }
 
 void AudioNode::visit_edges(Cell::Visitor& visitor)
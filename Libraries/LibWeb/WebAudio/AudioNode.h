@@ -7,11 +7,14 @@
 
 #pragma once
 
+#include <AK/Function.h>
 #include <AK/Optional.h>
+#include <AK/OwnPtr.h>
 #include <LibJS/Forward.h>
 #include <LibWeb/Bindings/AudioNode.h>
 #include <LibWeb/Bindings/PlatformObject.h>
 #include <LibWeb/DOM/EventTarget.h>
+#include <LibWeb/WebAudio/ControlMessageQueue.h>
 #include <LibWeb/WebAudio/Types.h>
 #include <LibWeb/WebIDL/Types.h>
 
@@ -44,6 +47,8 @@ class AudioNode : public DOM::EventTarget {
     GC_DECLARE_ALLOCATOR(AudioNode);
 
 public:
+    static constexpr bool OVERRIDES_FINALIZE = true;
+
     virtual ~AudioNode() override;
 
     WebIDL::ExceptionOr<GC::Ref<AudioNode>> connect(GC::Ref<AudioNode> destination_node, WebIDL::UnsignedLong output = 0, WebIDL::UnsignedLong input = 0);
@@ -74,9 +79,9 @@ public:
     virtual WebIDL::UnsignedLong channel_count() const { return m_channel_count; }
 
     virtual WebIDL::ExceptionOr<void> set_channel_count_mode(Bindings::ChannelCountMode);
-    Bindings::ChannelCountMode channel_count_mode();
+    Bindings::ChannelCountMode channel_count_mode() const;
     virtual WebIDL::ExceptionOr<void> set_channel_interpretation(Bindings::ChannelInterpretation);
-    Bindings::ChannelInterpretation channel_interpretation();
+    Bindings::ChannelInterpretation channel_interpretation() const;
 
     WebIDL::ExceptionOr<void> initialize_audio_node_options(Bindings::AudioNodeOptions const& given_options, AudioNodeDefaultOptions const& default_options);
 
@@ -87,8 +92,26 @@ protected:
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
+    virtual void finalize() override;
+
+    // Creates this node's counterpart on the rendering thread. Called once, while the node is being initialized.
+    virtual OwnPtr<Render::RenderNode> create_render_node();
+
+    // Queues a control message that applies an update to this node's render node on the rendering thread.
+    template<typename RenderNodeType>
+    void update_render_node(Function<void(RenderNodeType&)> update)
+    {
+        m_control_message_queue->enqueue(UpdateRenderNode {
+            .node_id = m_node_id,
+            .update = [update = move(update)](Render::RenderNode& node) { update(static_cast<RenderNodeType&>(node)); },
+        });
+    }
 
 private:
+    void queue_channel_configuration();
+    void queue_disconnect(AudioNodeConnection const&);
+    void queue_disconnect(AudioParamConnection const&);
+
     GC::Ref<BaseAudioContext> m_context;
     WebIDL::UnsignedLong m_channel_count { 2 };
     Bindings::ChannelCountMode m_channel_count_mode { Bindings::ChannelCountMode::Max };
@@ -100,6 +123,7 @@ private:
     // Connections from this node's outputs into AudioParams.
     Vector<AudioParamConnection> m_param_connections;
     NodeID const m_node_id;
+    NonnullRefPtr<ControlMessageQueue> m_control_message_queue;
 };
 
 }
@@ -7,11 +7,11 @@
 #pragma once
 
 #include <AK/Optional.h>
-#include <AK/Variant.h>
-#include <AK/Vector.h>
 #include <LibJS/Forward.h>
 #include <LibWeb/Bindings/AudioParam.h>
 #include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/WebAudio/AudioParamTimeline.h>
+#include <LibWeb/WebAudio/Types.h>
 
 namespace Web::WebAudio {
 
@@ -49,6 +49,9 @@ public:
     // https://webaudio.github.io/web-audio-api/#dom-audioparam-maxvalue
     float max_value() const { return m_max_value; }
 
+    ParamID param_id() const { return m_param_id; }
+    AudioParamTimeline const& timeline() const { return m_timeline; }
+
     WebIDL::ExceptionOr<GC::Ref<AudioParam>> set_value_at_time(float value, double start_time);
     WebIDL::ExceptionOr<GC::Ref<AudioParam>> linear_ramp_to_value_at_time(float value, double end_time);
     WebIDL::ExceptionOr<GC::Ref<AudioParam>> exponential_ramp_to_value_at_time(float value, double end_time);
@@ -58,75 +61,23 @@ public:
     WebIDL::ExceptionOr<GC::Ref<AudioParam>> cancel_and_hold_at_time(double cancel_time);
 
 private:
-    struct SetValue {
-        float value { 0 };
-    };
-
-    struct RampStart {
-        size_t set_target_event_id { 0 };
-        double time { 0 };
-        float value { 0 };
-    };
-
-    struct LinearRamp {
-        float value { 0 };
-        Optional<RampStart> start;
-    };
-
-    struct ExponentialRamp {
-        float value { 0 };
-        Optional<RampStart> start;
-    };
-
-    struct SetTarget {
-        float target { 0 };
-        float time_constant { 0 };
-    };
-
-    struct SetValueCurve {
-        Vector<float> values;
-        double duration { 0 };
-    };
-
-    struct Hold {
-        float value { 0 };
-    };
-
-    using Parameterization = Variant<SetValue, LinearRamp, ExponentialRamp, SetTarget, SetValueCurve, Hold>;
-
-    struct AutomationEvent {
-        double time { 0 };
-        Parameterization parameterization;
-        size_t id { 0 };
-    };
-
-    struct ParameterizationCache {
-        Optional<size_t> event_index {};
-        Optional<double> minimum_time {};
-        Optional<double> maximum_time {};
-        float starting_value { 0 };
-
-        bool contains(double time) const
-        {
-            return (!minimum_time.has_value() || time >= *minimum_time)
-                && (!maximum_time.has_value() || time < *maximum_time);
-        }
-    };
+    using AutomationEvent = AudioParamTimeline::AutomationEvent;
+    using SetValue = AudioParamTimeline::SetValue;
+    using RampStart = AudioParamTimeline::RampStart;
+    using LinearRamp = AudioParamTimeline::LinearRamp;
+    using ExponentialRamp = AudioParamTimeline::ExponentialRamp;
+    using SetTarget = AudioParamTimeline::SetTarget;
+    using SetValueCurve = AudioParamTimeline::SetValueCurve;
+    using Hold = AudioParamTimeline::Hold;
 
     AudioParam(JS::Realm&, GC::Ref<BaseAudioContext>, float default_value, float min_value, float max_value, Bindings::AutomationRate, FixedAutomationRate = FixedAutomationRate::No);
 
-    // https://webaudio.github.io/web-audio-api/#dfn-automation-event
-    size_t first_event_index_after(double) const;
-
     Optional<RampStart> ramp_start_for_insertion_index(size_t) const;
 
-    float event_value_at_time(size_t event_index, double time) const;
-
-    // https://webaudio.github.io/web-audio-api/#computedvalue
-    ParameterizationCache const& parameterization_cache_for_time(double) const;
-
     // https://webaudio.github.io/web-audio-api/#dfn-automation-event
     WebIDL::ExceptionOr<void> insert_event(AutomationEvent);
+    void replace_event(size_t event_index, AutomationEvent);
+    void remove_events_starting_at(size_t event_index);
 
     GC::Ref<BaseAudioContext> m_context;
 
@@ -143,10 +94,10 @@ private:
     FixedAutomationRate m_fixed_automation_rate { FixedAutomationRate::No };
 
     // https://webaudio.github.io/web-audio-api/#dfn-automation-event
-    Vector<AutomationEvent> m_automation_events;
+    AudioParamTimeline m_timeline;
     size_t m_next_event_id { 0 };
 
-    mutable Optional<ParameterizationCache> m_parameterization_cache;
+    ParamID const m_param_id;
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024, Shannon Booth <shannon@serenityos.org>
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/Span.h>
+#include <AK/Variant.h>
+#include <AK/Vector.h>
+
+namespace Web::WebAudio {
+
+// The automation events of an AudioParam together with the logic to evaluate them. This is kept separate from the
+// AudioParam itself so that the rendering thread can own a copy of it that is kept in sync through control messages.
+// https://webaudio.github.io/web-audio-api/#dfn-automation-event
+class AudioParamTimeline {
+public:
+    struct SetValue {
+        float value { 0 };
+    };
+
+    struct RampStart {
+        size_t set_target_event_id { 0 };
+        double time { 0 };
+        float value { 0 };
+    };
+
+    struct LinearRamp {
+        float value { 0 };
+        Optional<RampStart> start;
+    };
+
+    struct ExponentialRamp {
+        float value { 0 };
+        Optional<RampStart> start;
+    };
+
+    struct SetTarget {
+        float target { 0 };
+        float time_constant { 0 };
+    };
+
+    struct SetValueCurve {
+        Vector<float> values;
+        double duration { 0 };
+    };
+
+    struct Hold {
+        float value { 0 };
+    };
+
+    using Parameterization = Variant<SetValue, LinearRamp, ExponentialRamp, SetTarget, SetValueCurve, Hold>;
+
+    struct AutomationEvent {
+        double time { 0 };
+        Parameterization parameterization;
+        size_t id { 0 };
+    };
+
+    explicit AudioParamTimeline(float default_value)
+        : m_default_value(default_value)
+    {
+    }
+
+    float default_value() const { return m_default_value; }
+
+    Vector<AutomationEvent> const& events() const { return m_events; }
+
+    // If an event is added at a time where there are already events, it is placed after them but before later events.
+    void insert_event(AutomationEvent);
+    void replace_event(size_t event_index, AutomationEvent);
+    void remove_events_starting_at(size_t event_index);
+
+    // https://webaudio.github.io/web-audio-api/#computedvalue
+    float intrinsic_value_at_time(double) const;
+
+    // Returns the intrinsic value if it does not change within [start_time, end_time).
+    Optional<float> constant_value_between(double start_time, double end_time) const;
+
+    // Writes the intrinsic value at start_time + i * time_step into each element of the output.
+    void fill_intrinsic_values(double start_time, double time_step, Span<float> output) const;
+
+    size_t first_event_index_after(double) const;
+    float event_value_at_time(size_t event_index, double time) const;
+
+private:
+    struct ParameterizationCache {
+        Optional<size_t> event_index {};
+        Optional<double> minimum_time {};
+        Optional<double> maximum_time {};
+        float starting_value { 0 };
+
+        bool contains(double time) const
+        {
+            return (!minimum_time.has_value() || time >= *minimum_time)
+                && (!maximum_time.has_value() || time < *maximum_time);
+        }
+    };
+
+    ParameterizationCache const& parameterization_cache_for_time(double) const;
+
+    float m_default_value { 0 };
+    Vector<AutomationEvent> m_events;
+    mutable Optional<ParameterizationCache> m_parameterization_cache;
+};
+
+}
@@ -34,7 +34,7 @@ BaseAudioContext::BaseAudioContext(JS::Realm& realm, float sample_rate)
     : DOM::EventTarget(realm)
     , m_sample_rate(sample_rate)
     , m_listener(AudioListener::create(realm, *this))
-    , m_control_message_queue(make<ControlMessageQueue>())
+    , m_control_message_queue(ControlMessageQueue::create())
 {
 }
 
@@ -222,8 +222,8 @@ void BaseAudioContext::queue_a_media_element_task(GC::Ref<GC::Function<void()>>
 
 void BaseAudioContext::queue_control_message(ControlMessage message)
 {
+    // The rendering thread drains the queue at the start of every render quantum, so there is nothing to signal.
     m_control_message_queue->enqueue(move(message));
-    // FIXME: Should signal the rendering thread when implemented
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-baseaudiocontext-decodeaudiodata
@@ -19,6 +19,7 @@
 #include <LibWeb/WebAudio/ChannelSplitterNode.h>
 #include <LibWeb/WebAudio/ConstantSourceNode.h>
 #include <LibWeb/WebAudio/ControlMessage.h>
+#include <LibWeb/WebAudio/ControlMessageQueue.h>
 #include <LibWeb/WebAudio/DelayNode.h>
 #include <LibWeb/WebAudio/PeriodicWave.h>
 #include <LibWeb/WebAudio/ScriptProcessorNode.h>
@@ -29,7 +30,6 @@
 namespace Web::WebAudio {
 
 class AudioDestinationNode;
-class ControlMessageQueue;
 
 // https://webaudio.github.io/web-audio-api/#BaseAudioContext
 class BaseAudioContext : public DOM::EventTarget {
@@ -53,9 +53,10 @@ public:
 
     GC::Ref<AudioDestinationNode> destination() const { return *m_destination; }
     float sample_rate() const { return m_sample_rate; }
-    double current_time() const { return m_current_time; }
+    virtual double current_time() const { return m_current_time; }
     GC::Ref<AudioListener> listener() const { return m_listener; }
     Bindings::AudioContextState state() const { return m_control_thread_state; }
+    Bindings::AudioContextState rendering_state() const { return m_rendering_thread_state; }
 
     // https://webaudio.github.io/web-audio-api/#--nyquist-frequency
     float nyquist_frequency() const { return m_sample_rate / 2; }
@@ -92,8 +93,10 @@ public:
     GC::Ref<WebIDL::Promise> decode_audio_data(GC::Ref<JS::ArrayBuffer>, GC::Ptr<WebIDL::CallbackType>, GC::Ptr<WebIDL::CallbackType>);
 
     void queue_control_message(ControlMessage);
+    NonnullRefPtr<ControlMessageQueue> control_message_queue() const { return m_control_message_queue; }
 
     NodeID next_node_id(Badge<AudioNode>) { return ++m_next_node_id; }
+    ParamID next_param_id(Badge<AudioParam>) { return ++m_next_param_id; }
 
 protected:
     explicit BaseAudioContext(JS::Realm&, float m_sample_rate = 0);
@@ -113,6 +116,7 @@ private:
     void queue_a_decoding_operation(GC::Ref<JS::PromiseCapability>, GC::Ref<JS::ArrayBuffer>, GC::Ptr<WebIDL::CallbackType>, GC::Ptr<WebIDL::CallbackType>);
 
     u64 m_next_node_id { 0 };
+    u64 m_next_param_id { 0 };
 
     float m_sample_rate { 0 };
     double m_current_time { 0 };
@@ -124,7 +128,7 @@ private:
 
     HTML::UniqueTaskSource m_media_element_event_task_source {};
 
-    NonnullOwnPtr<ControlMessageQueue> m_control_message_queue;
+    NonnullRefPtr<ControlMessageQueue> m_control_message_queue;
 };
 
 }
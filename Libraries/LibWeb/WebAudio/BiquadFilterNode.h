@@ -39,6 +39,7 @@ protected:
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
+    virtual OwnPtr<Render::RenderNode> create_render_node() override;
 
 private:
     Bindings::BiquadFilterType m_type { Bindings::BiquadFilterType::Lowpass };
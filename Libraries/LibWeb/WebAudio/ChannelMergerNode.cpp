@@ -6,6 +6,7 @@
 
 #include <LibWeb/WebAudio/BaseAudioContext.h>
 #include <LibWeb/WebAudio/ChannelMergerNode.h>
+#include <LibWeb/WebAudio/Render/ChannelMergerRenderNode.h>
 
 namespace Web::WebAudio {
 
@@ -68,4 +69,9 @@ WebIDL::ExceptionOr<void> ChannelMergerNode::set_channel_count_mode(Bindings::Ch
     return Base::set_channel_count_mode(channel_count_mode);
 }
 
+OwnPtr<Render::RenderNode> ChannelMergerNode::create_render_node()
+{
+    return make<Render::ChannelMergerRenderNode>(*this, number_of_inputs());
+}
+
 }
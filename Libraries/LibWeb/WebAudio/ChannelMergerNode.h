@@ -32,6 +32,8 @@ public:
 private:
     ChannelMergerNode(JS::Realm&, GC::Ref<BaseAudioContext>, Bindings::ChannelMergerOptions const&);
 
+    virtual OwnPtr<Render::RenderNode> create_render_node() override;
+
     WebIDL::UnsignedLong m_number_of_inputs;
 };
 
@@ -8,6 +8,7 @@
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
 #include <LibWeb/WebAudio/ChannelSplitterNode.h>
+#include <LibWeb/WebAudio/Render/ChannelSplitterRenderNode.h>
 
 namespace Web::WebAudio {
 
@@ -48,6 +49,11 @@ WebIDL::ExceptionOr<GC::Ref<ChannelSplitterNode>> ChannelSplitterNode::construct
     return node;
 }
 
+OwnPtr<Render::RenderNode> ChannelSplitterNode::create_render_node()
+{
+    return make<Render::ChannelSplitterRenderNode>(*this, number_of_outputs());
+}
+
 void ChannelSplitterNode::initialize(JS::Realm& realm)
 {
     WEB_SET_PROTOTYPE_FOR_INTERFACE(ChannelSplitterNode);
@@ -32,6 +32,8 @@ public:
 private:
     ChannelSplitterNode(JS::Realm&, GC::Ref<BaseAudioContext>, Bindings::ChannelSplitterOptions const&);
 
+    virtual OwnPtr<Render::RenderNode> create_render_node() override;
+
     virtual void initialize(JS::Realm&) override;
 
     WebIDL::UnsignedLong m_number_of_outputs;
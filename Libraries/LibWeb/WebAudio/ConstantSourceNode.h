@@ -32,6 +32,7 @@ private:
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
+    virtual OwnPtr<Render::RenderNode> create_render_node() override;
 
     // https://webaudio.github.io/web-audio-api/#dom-constantsourcenode-offset
     GC::Ref<AudioParam> m_offset;
@@ -6,7 +6,12 @@
 
 #pragma once
 
+#include <AK/Function.h>
+#include <AK/NonnullOwnPtr.h>
 #include <AK/Variant.h>
+#include <LibWeb/Bindings/AudioParam.h>
+#include <LibWeb/WebAudio/AudioParamTimeline.h>
+#include <LibWeb/WebAudio/Render/RenderNode.h>
 #include <LibWeb/WebAudio/Types.h>
 
 namespace Web::WebAudio {
@@ -21,9 +26,90 @@ struct StopSource {
     double when { 0.0 };
 };
 
-// FIXME: add more message types
+// Hands a newly created node's rendering counterpart over to the rendering thread.
+struct CreateRenderNode {
+    NonnullOwnPtr<Render::RenderNode> node;
+};
+
+// The AudioNode has been garbage collected. The rendering thread keeps its render node until it stops contributing
+// to the output.
+struct DestroyRenderNode {
+    NodeID node_id { 0 };
+};
+
+struct ConnectNodes {
+    NodeID source { 0 };
+    u32 output { 0 };
+    NodeID destination { 0 };
+    u32 input { 0 };
+};
+
+struct DisconnectNodes {
+    NodeID source { 0 };
+    u32 output { 0 };
+    NodeID destination { 0 };
+    u32 input { 0 };
+};
+
+struct ConnectParam {
+    NodeID source { 0 };
+    u32 output { 0 };
+    ParamID destination { 0 };
+};
+
+struct DisconnectParam {
+    NodeID source { 0 };
+    u32 output { 0 };
+    ParamID destination { 0 };
+};
+
+struct SetChannelConfiguration {
+    NodeID node_id { 0 };
+    Render::ChannelConfiguration configuration;
+};
+
+// Runs on the rendering thread to apply node-specific state, such as a filter type or a buffer's contents.
+struct UpdateRenderNode {
+    NodeID node_id { 0 };
+    Function<void(Render::RenderNode&)> update;
+};
+
+struct InsertAutomationEvent {
+    ParamID param_id { 0 };
+    AudioParamTimeline::AutomationEvent event;
+};
+
+struct ReplaceAutomationEvent {
+    ParamID param_id { 0 };
+    size_t event_index { 0 };
+    AudioParamTimeline::AutomationEvent event;
+};
+
+struct RemoveAutomationEvents {
+    ParamID param_id { 0 };
+    size_t first_event_index { 0 };
+};
+
+struct SetAutomationRate {
+    ParamID param_id { 0 };
+    Bindings::AutomationRate automation_rate { Bindings::AutomationRate::ARate };
+};
 
 // https://webaudio.github.io/web-audio-api/#control-message
-using ControlMessage = Variant<StartSource, StopSource>;
+using ControlMessage = Variant<
+    StartSource,
+    StopSource,
+    CreateRenderNode,
+    DestroyRenderNode,
+    ConnectNodes,
+    DisconnectNodes,
+    ConnectParam,
+    DisconnectParam,
+    SetChannelConfiguration,
+    UpdateRenderNode,
+    InsertAutomationEvent,
+    ReplaceAutomationEvent,
+    RemoveAutomationEvents,
+    SetAutomationRate>;
 
 }
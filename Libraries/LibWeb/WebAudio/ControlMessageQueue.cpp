@@ -7,16 +7,51 @@
 #include <LibWeb/WebAudio/ControlMessageQueue.h>
 namespace Web::WebAudio {
 
+ControlMessageQueue::~ControlMessageQueue()
+{
+    drain([](ControlMessage&) { });
+}
+
 void ControlMessageQueue::enqueue(ControlMessage message)
 {
-    Sync::MutexLocker locker(m_mutex);
-    m_messages.append(move(message));
+    auto* node = new Node { move(message), m_head.load(AK::MemoryOrder::memory_order_relaxed) };
+    while (!m_head.compare_exchange_strong(node->next, node, AK::MemoryOrder::memory_order_acq_rel))
+        ;
+}
+
+ControlMessageQueue::Node* ControlMessageQueue::take_all_in_arrival_order()
+{
+    auto* node = m_head.exchange(nullptr, AK::MemoryOrder::memory_order_acq_rel);
+
+    // The stack has the newest message on top, so reverse it to get the order the messages were queued in.
+    Node* reversed = nullptr;
+    while (node) {
+        auto* next = node->next;
+        node->next = reversed;
+        reversed = node;
+        node = next;
+    }
+    return reversed;
+}
+
+void ControlMessageQueue::drain(Function<void(ControlMessage&)> const& callback)
+{
+    auto* node = take_all_in_arrival_order();
+    while (node) {
+        callback(node->message);
+        auto* next = node->next;
+        delete node;
+        node = next;
+    }
 }
 
 Vector<ControlMessage> ControlMessageQueue::drain()
 {
-    Sync::MutexLocker locker(m_mutex);
-    return move(m_messages);
+    Vector<ControlMessage> messages;
+    drain([&](ControlMessage& message) {
+        messages.append(move(message));
+    });
+    return messages;
 }
 
 }
@@ -6,23 +6,42 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
+#include <AK/AtomicRefCounted.h>
+#include <AK/Function.h>
+#include <AK/NonnullRefPtr.h>
 #include <AK/Vector.h>
-#include <LibSync/Mutex.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/WebAudio/ControlMessage.h>
 
 namespace Web::WebAudio {
 
 // https://webaudio.github.io/web-audio-api/#control-message-queue
-class WEB_API ControlMessageQueue {
+// Enqueueing and draining never take a lock, so the rendering thread cannot be blocked by the control thread. Messages
+// are pushed onto an intrusive stack, and a drain takes the whole stack at once and reverses it into arrival order.
+class WEB_API ControlMessageQueue : public AtomicRefCounted<ControlMessageQueue> {
 
 public:
-    void enqueue(ControlMessage);   // Called by the control thread.
-    Vector<ControlMessage> drain(); // Called by the rendering thread.
+    static NonnullRefPtr<ControlMessageQueue> create() { return adopt_ref(*new ControlMessageQueue); }
+    ~ControlMessageQueue();
+
+    void enqueue(ControlMessage); // Called by the control thread.
+
+    // Called by the rendering thread.
+    void drain(Function<void(ControlMessage&)> const&);
+    Vector<ControlMessage> drain();
 
 private:
-    mutable Sync::Mutex m_mutex;
-    Vector<ControlMessage> m_messages;
+    ControlMessageQueue() = default;
+
+    struct Node {
+        ControlMessage message;
+        Node* next { nullptr };
+    };
+
+    Node* take_all_in_arrival_order();
+
+    Atomic<Node*> m_head { nullptr };
 };
 
 }
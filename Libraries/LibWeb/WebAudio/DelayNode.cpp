@@ -8,6 +8,7 @@
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
 #include <LibWeb/WebAudio/DelayNode.h>
+#include <LibWeb/WebAudio/Render/DelayRenderNode.h>
 
 namespace Web::WebAudio {
 
@@ -49,6 +50,11 @@ WebIDL::ExceptionOr<GC::Ref<DelayNode>> DelayNode::construct_impl(JS::Realm& rea
     return node;
 }
 
+OwnPtr<Render::RenderNode> DelayNode::create_render_node()
+{
+    return make<Render::DelayRenderNode>(*this, context()->sample_rate());
+}
+
 void DelayNode::initialize(JS::Realm& realm)
 {
     WEB_SET_PROTOTYPE_FOR_INTERFACE(DelayNode);
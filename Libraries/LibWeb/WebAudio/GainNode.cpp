@@ -9,6 +9,7 @@
 #include <LibWeb/WebAudio/AudioParam.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
 #include <LibWeb/WebAudio/GainNode.h>
+#include <LibWeb/WebAudio/Render/GainRenderNode.h>
 
 namespace Web::WebAudio {
 
@@ -45,6 +46,11 @@ GainNode::GainNode(JS::Realm& realm, GC::Ref<BaseAudioContext> context, Bindings
 {
 }
 
+OwnPtr<Render::RenderNode> GainNode::create_render_node()
+{
+    return make<Render::GainRenderNode>(*this);
+}
+
 void GainNode::initialize(JS::Realm& realm)
 {
     WEB_SET_PROTOTYPE_FOR_INTERFACE(GainNode);
@@ -5,6 +5,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/EventLoop.h>
+#include <LibThreading/ThreadPool.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/OfflineAudioCompletionEvent.h>
 #include <LibWeb/DOM/Document.h>
@@ -17,6 +19,7 @@
 #include <LibWeb/WebAudio/AudioDestinationNode.h>
 #include <LibWeb/WebAudio/OfflineAudioCompletionEvent.h>
 #include <LibWeb/WebAudio/OfflineAudioContext.h>
+#include <LibWeb/WebAudio/Render/OfflineRenderer.h>
 
 namespace Web::WebAudio {
 
@@ -129,9 +132,53 @@ WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> OfflineAudioContext::start_renderi
 void OfflineAudioContext::begin_offline_rendering(GC::Ref<WebIDL::Promise> promise)
 {
     // To begin offline rendering, the following steps MUST happen on a rendering thread that is created for the occasion.
-    // FIXME: 1: Given the current connections and scheduled changes, start rendering length sample-frames of audio into [[rendered buffer]]
-    // FIXME: 2: For every render quantum, check and suspend rendering if necessary.
-    // FIXME: 3: If a suspended context is resumed, continue to render the buffer.
+    // NOTE: We render on a thread pool worker into storage of our own, and copy it into [[rendered buffer]] back on
+    //       the control thread. Script cannot get at [[rendered buffer]] before then, so this is not observable.
+    m_renderer = Render::OfflineRenderer::create(control_message_queue(), m_destination->node_id(), sample_rate());
+
+    // Keep the callback on the control thread, so that the GC roots it holds are also destroyed there.
+    auto* on_complete = new Function<void(ErrorOr<Vector<FixedArray<float>>>)>(
+        [context = GC::make_root(*this), promise = GC::make_root(promise)](ErrorOr<Vector<FixedArray<float>>> rendered) {
+            context->finish_offline_rendering(*promise, move(rendered));
+        });
+    auto& control_thread_event_loop = Core::EventLoop::current();
+
+    Threading::ThreadPool::the().submit([renderer = NonnullRefPtr { *m_renderer }, channel_count = m_number_of_channels, length = m_length, on_complete, &control_thread_event_loop] {
+        // 1: Given the current connections and scheduled changes, start rendering length sample-frames of audio into [[rendered buffer]]
+        auto rendered = [&] -> ErrorOr<Vector<FixedArray<float>>> {
+            Vector<FixedArray<float>> channels;
+            TRY(channels.try_ensure_capacity(channel_count));
+            for (size_t i = 0; i < channel_count; ++i)
+                channels.unchecked_append(TRY(FixedArray<float>::create(length)));
+            renderer->render(channels);
+            return channels;
+        }();
+
+        // FIXME: 2: For every render quantum, check and suspend rendering if necessary.
+        // FIXME: 3: If a suspended context is resumed, continue to render the buffer.
+
+        control_thread_event_loop.deferred_invoke([on_complete, rendered = move(rendered)]() mutable {
+            (*on_complete)(move(rendered));
+            delete on_complete;
+        });
+    });
+}
+
+void OfflineAudioContext::finish_offline_rendering(GC::Ref<WebIDL::Promise> promise, ErrorOr<Vector<FixedArray<float>>> rendered)
+{
+    if (rendered.is_error()) {
+        queue_a_media_element_task(GC::create_function(heap(), [promise, this]() {
+            HTML::TemporaryExecutionContext context(this->realm(), HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+            WebIDL::reject_promise(this->realm(), promise, WebIDL::OperationError::create(this->realm(), "Not enough memory to render audio"_utf16));
+            m_pending_promises.remove_all_matching([promise](GC::Ref<WebIDL::Promise> const& p) {
+                return p.ptr() == promise.ptr();
+            });
+        }));
+        return;
+    }
+
+    m_rendered_buffer->set_content(rendered.value());
+
     // 4: Once the rendering is complete, queue a media element task to execute the following steps:
     queue_a_media_element_task(GC::create_function(heap(), [promise, this]() {
         HTML::TemporaryExecutionContext context(this->realm(), HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
@@ -180,6 +227,14 @@ WebIDL::UnsignedLong OfflineAudioContext::length() const
     return m_length;
 }
 
+// https://webaudio.github.io/web-audio-api/#dom-baseaudiocontext-currenttime
+double OfflineAudioContext::current_time() const
+{
+    if (!m_renderer)
+        return Base::current_time();
+    return static_cast<double>(m_renderer->rendered_frame_count()) / sample_rate();
+}
+
 // https://webaudio.github.io/web-audio-api/#dom-offlineaudiocontext-oncomplete
 GC::Ptr<WebIDL::CallbackType> OfflineAudioContext::oncomplete()
 {
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <AK/FixedArray.h>
+#include <AK/RefPtr.h>
 #include <LibWeb/Bindings/OfflineAudioContext.h>
 #include <LibWeb/HighResolutionTime/DOMHighResTimeStamp.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
@@ -35,6 +37,8 @@ public:
 
     WebIDL::UnsignedLong length() const;
 
+    virtual double current_time() const override;
+
     GC::Ptr<WebIDL::CallbackType> oncomplete();
     void set_oncomplete(GC::Ptr<WebIDL::CallbackType>);
 
@@ -49,8 +53,10 @@ private:
     bool m_rendering_started { false };
 
     GC::Ptr<AudioBuffer> m_rendered_buffer;
+    RefPtr<Render::OfflineRenderer> m_renderer;
 
     void begin_offline_rendering(GC::Ref<WebIDL::Promise> promise);
+    void finish_offline_rendering(GC::Ref<WebIDL::Promise> promise, ErrorOr<Vector<FixedArray<float>>> rendered);
 };
 
 }
@@ -11,11 +11,16 @@
 #include <LibWeb/WebAudio/AudioParam.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
 #include <LibWeb/WebAudio/OscillatorNode.h>
+#include <LibWeb/WebAudio/PeriodicWave.h>
+#include <LibWeb/WebAudio/Render/OscillatorRenderNode.h>
 
 namespace Web::WebAudio {
 
 GC_DEFINE_ALLOCATOR(OscillatorNode);
 
+// The number of samples in one period of a custom waveform's wave table.
+static constexpr size_t wave_table_length = 2048;
+
 OscillatorNode::~OscillatorNode() = default;
 
 WebIDL::ExceptionOr<GC::Ref<OscillatorNode>> OscillatorNode::create(JS::Realm& realm, GC::Ref<BaseAudioContext> context, Bindings::OscillatorOptions const& options)
@@ -71,6 +76,7 @@ WebIDL::ExceptionOr<void> OscillatorNode::set_type(Bindings::OscillatorType type
     set_periodic_wave(nullptr);
 
     m_type = type;
+    update_render_node<Render::OscillatorRenderNode>([type](auto& node) { node.set_type(type); });
     return {};
 }
 
@@ -79,6 +85,20 @@ void OscillatorNode::set_periodic_wave(GC::Ptr<PeriodicWave> periodic_wave)
 {
     m_periodic_wave = periodic_wave;
     m_type = Bindings::OscillatorType::Custom;
+
+    auto wave_table = periodic_wave ? periodic_wave->generate_wave_table(wave_table_length) : Vector<float> {};
+    update_render_node<Render::OscillatorRenderNode>([wave_table = move(wave_table)](auto& node) mutable {
+        node.set_type(Bindings::OscillatorType::Custom);
+        node.set_wave_table(move(wave_table));
+    });
+}
+
+OwnPtr<Render::RenderNode> OscillatorNode::create_render_node()
+{
+    auto render_node = make<Render::OscillatorRenderNode>(*this);
+    if (m_periodic_wave)
+        render_node->set_wave_table(m_periodic_wave->generate_wave_table(wave_table_length));
+    return render_node;
 }
 
 void OscillatorNode::initialize(JS::Realm& realm)
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Math.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/PeriodicWave.h>
@@ -98,6 +99,50 @@ WebIDL::ExceptionOr<GC::Ref<PeriodicWave>> PeriodicWave::construct_impl(JS::Real
     return p;
 }
 
+static Vector<float> read_coefficients(JS::Float32Array const& array)
+{
+    auto record = JS::make_typed_array_with_buffer_witness_record(array, JS::ArrayBuffer::Order::SeqCst);
+    auto length = JS::is_typed_array_out_of_bounds(record) ? 0 : JS::typed_array_length(record);
+    Vector<float> coefficients;
+    coefficients.resize(length);
+    array.viewed_array_buffer()->copy_to(array.byte_offset(), to_bytes(coefficients.span()));
+    return coefficients;
+}
+
+// https://webaudio.github.io/web-audio-api/#waveform-generation
+Vector<float> PeriodicWave::generate_wave_table(size_t length) const
+{
+    auto real = read_coefficients(*m_real);
+    auto imag = read_coefficients(*m_imag);
+
+    // x(t) = sum(k = 1 .. L - 1) of a[k] * cos(2 * pi * k * t) + b[k] * sin(2 * pi * k * t)
+    // Harmonics above half the table length cannot be represented by it, so they are left out.
+    auto harmonic_count = min(min(real.size(), imag.size()), length / 2);
+    Vector<float> table;
+    table.resize(length);
+    for (size_t sample = 0; sample < length; ++sample) {
+        double value = 0;
+        for (size_t k = 1; k < harmonic_count; ++k) {
+            auto phase = 2 * AK::Pi<double> * k * sample / length;
+            value += real[k] * AK::cos(phase) + imag[k] * AK::sin(phase);
+        }
+        table[sample] = static_cast<float>(value);
+    }
+
+    // https://webaudio.github.io/web-audio-api/#waveform-normalization
+    // When normalizing, the waveform is scaled so that its peak absolute value is 1.
+    if (m_normalize) {
+        float peak = 0;
+        for (auto sample : table)
+            peak = max(peak, AK::fabs(sample));
+        if (peak > 0) {
+            for (auto& sample : table)
+                sample /= peak;
+        }
+    }
+    return table;
+}
+
 PeriodicWave::PeriodicWave(JS::Realm& realm)
     : Base(realm)
 {
@@ -23,6 +23,9 @@ public:
     explicit PeriodicWave(JS::Realm&);
     virtual ~PeriodicWave() override;
 
+    // Samples one period of the waveform described by the coefficients, for an OscillatorNode to play back.
+    Vector<float> generate_wave_table(size_t length) const;
+
 protected:
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
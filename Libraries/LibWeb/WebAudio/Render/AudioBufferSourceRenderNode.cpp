@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <LibWeb/WebAudio/AudioBufferSourceNode.h>
+#include <LibWeb/WebAudio/Render/AudioBufferSourceRenderNode.h>
+
+namespace Web::WebAudio::Render {
+
+AudioBufferSourceRenderNode::AudioBufferSourceRenderNode(AudioBufferSourceNode const& node)
+    : ScheduledSourceRenderNode(node, 1)
+    , m_playback_rate(*node.playback_rate())
+    , m_detune(*node.detune())
+    , m_loop(node.loop())
+    , m_loop_start(node.loop_start())
+    , m_loop_end(node.loop_end())
+{
+    register_param(m_playback_rate);
+    register_param(m_detune);
+}
+
+AudioBufferSourceRenderNode::~AudioBufferSourceRenderNode() = default;
+
+void AudioBufferSourceRenderNode::set_buffer(Vector<FixedArray<float>> channels, float sample_rate)
+{
+    m_channels = move(channels);
+    m_buffer_sample_rate = sample_rate;
+}
+
+void AudioBufferSourceRenderNode::set_playback_region(double offset, Optional<double> duration)
+{
+    m_offset = offset;
+    m_duration = duration;
+    m_position.clear();
+    m_played_duration = 0;
+}
+
+float AudioBufferSourceRenderNode::sample_at(size_t channel, double position) const
+{
+    auto const& samples = m_channels[channel];
+    auto index = static_cast<size_t>(position);
+    if (index >= samples.size())
+        return 0;
+    auto fraction = static_cast<float>(position - index);
+    auto next = index + 1 < samples.size() ? samples[index + 1] : 0.0f;
+    return samples[index] + (next - samples[index]) * fraction;
+}
+
+// https://webaudio.github.io/web-audio-api/#playback-AudioBufferSourceNode
+bool AudioBufferSourceRenderNode::render(RenderContext const& context, size_t first_frame, size_t end_frame)
+{
+    auto length = buffer_length();
+    if (length == 0)
+        return true;
+
+    // The offset is clamped to the buffer, and is where the playhead starts.
+    if (!m_position.has_value())
+        m_position = clamp(m_offset * m_buffer_sample_rate, 0.0, length);
+
+    // The loop region is the whole buffer unless loopStart and loopEnd describe a valid region inside it.
+    auto loop_start = 0.0;
+    auto loop_end = length;
+    if (m_loop_start >= 0 && m_loop_end > 0 && m_loop_start < m_loop_end) {
+        loop_start = clamp(m_loop_start * m_buffer_sample_rate, 0.0, length);
+        loop_end = clamp(m_loop_end * m_buffer_sample_rate, 0.0, length);
+    }
+
+    // playbackRate and detune are k-rate, so they combine into one rate for the whole quantum.
+    // computedPlaybackRate(t) = playbackRate(t) * pow(2, detune(t) / 1200)
+    auto computed_playback_rate = static_cast<double>(m_playback_rate.value_at(0)) * AK::pow(2.0, static_cast<double>(m_detune.value_at(0)) / 1200);
+    auto increment = computed_playback_rate * m_buffer_sample_rate / context.sample_rate;
+    auto played_duration_per_frame = AK::fabs(computed_playback_rate) / context.sample_rate;
+
+    auto& bus = output(0);
+    auto position = *m_position;
+    for (size_t frame = first_frame; frame < end_frame; ++frame) {
+        if (m_duration.has_value() && m_played_duration >= *m_duration)
+            return false;
+
+        if (m_loop && loop_end > loop_start) {
+            auto loop_length = loop_end - loop_start;
+            if (position >= loop_end)
+                position = loop_start + AK::fmod(position - loop_start, loop_length);
+            else if (position < loop_start && increment < 0)
+                position = loop_end - AK::fmod(loop_start - position, loop_length);
+        } else if (position >= length || position < 0) {
+            m_position = position;
+            return false;
+        }
+
+        for (size_t channel = 0; channel < m_channels.size(); ++channel)
+            bus.channel(channel)[frame] = sample_at(channel, position);
+
+        position += increment;
+        m_played_duration += played_duration_per_frame;
+    }
+    m_position = position;
+    return true;
+}
+
+}
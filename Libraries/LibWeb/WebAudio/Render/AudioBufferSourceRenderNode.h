@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/FixedArray.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/WebAudio/Render/RenderParam.h>
+#include <LibWeb/WebAudio/Render/ScheduledSourceRenderNode.h>
+
+namespace Web::WebAudio::Render {
+
+// https://webaudio.github.io/web-audio-api/#AudioBufferSourceNode
+class AudioBufferSourceRenderNode final : public ScheduledSourceRenderNode {
+public:
+    explicit AudioBufferSourceRenderNode(AudioBufferSourceNode const&);
+    virtual ~AudioBufferSourceRenderNode() override;
+
+    // The acquired content of the buffer. The rendering thread owns its own copy, so script can keep modifying the
+    // AudioBuffer without racing playback.
+    void set_buffer(Vector<FixedArray<float>> channels, float sample_rate);
+
+    void set_loop(bool loop) { m_loop = loop; }
+    void set_loop_start(double loop_start) { m_loop_start = loop_start; }
+    void set_loop_end(double loop_end) { m_loop_end = loop_end; }
+
+    // The offset and duration arguments of start().
+    void set_playback_region(double offset, Optional<double> duration);
+
+private:
+    virtual bool render(RenderContext const&, size_t first_frame, size_t end_frame) override;
+    virtual size_t output_channel_count() const override { return max<size_t>(m_channels.size(), 1); }
+
+    double buffer_length() const { return m_channels.is_empty() ? 0 : static_cast<double>(m_channels.first().size()); }
+    float sample_at(size_t channel, double position) const;
+
+    RenderParam m_playback_rate;
+    RenderParam m_detune;
+
+    Vector<FixedArray<float>> m_channels;
+    float m_buffer_sample_rate { 0 };
+    bool m_loop { false };
+    double m_loop_start { 0 };
+    double m_loop_end { 0 };
+
+    double m_offset { 0 };
+    Optional<double> m_duration;
+
+    // The playhead, in frames of the buffer.
+    Optional<double> m_position;
+    // How much of the buffer has been played, in seconds of buffer time, used to honor the duration argument.
+    double m_played_duration { 0 };
+};
+
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <LibWeb/WebAudio/Render/AudioBus.h>
+#include <LibWeb/WebAudio/Render/Kernels.h>
+
+namespace Web::WebAudio::Render {
+
+AudioBus::AudioBus(size_t channel_count)
+{
+    zero(channel_count);
+}
+
+void AudioBus::set_channel_count(size_t channel_count)
+{
+    while (m_channels.size() < channel_count)
+        m_channels.append({});
+    m_channel_count = channel_count;
+}
+
+void AudioBus::set_silent()
+{
+    for (size_t i = 0; i < m_channel_count; ++i)
+        m_channels[i].fill(0);
+    m_is_silent = true;
+}
+
+void AudioBus::zero(size_t channel_count)
+{
+    set_channel_count(channel_count);
+    set_silent();
+}
+
+struct MixTerm {
+    u8 source_channel;
+    u8 destination_channel;
+    float gain;
+};
+
+static constexpr float sqrt_half = AK::Sqrt1_2<float>;
+
+// https://webaudio.github.io/web-audio-api/#ChannelLayouts
+// Mono is M, stereo is L R, quad is L R SL SR, and 5.1 is L R C LFE SL SR.
+static constexpr MixTerm mono_to_stereo[] = { { 0, 0, 1 }, { 0, 1, 1 } };
+static constexpr MixTerm mono_to_quad[] = { { 0, 0, 1 }, { 0, 1, 1 } };
+static constexpr MixTerm mono_to_5_1[] = { { 0, 2, 1 } };
+static constexpr MixTerm stereo_to_quad[] = { { 0, 0, 1 }, { 1, 1, 1 } };
+static constexpr MixTerm stereo_to_5_1[] = { { 0, 0, 1 }, { 1, 1, 1 } };
+static constexpr MixTerm quad_to_5_1[] = { { 0, 0, 1 }, { 1, 1, 1 }, { 2, 4, 1 }, { 3, 5, 1 } };
+static constexpr MixTerm stereo_to_mono[] = { { 0, 0, 0.5f }, { 1, 0, 0.5f } };
+static constexpr MixTerm quad_to_mono[] = { { 0, 0, 0.25f }, { 1, 0, 0.25f }, { 2, 0, 0.25f }, { 3, 0, 0.25f } };
+static constexpr MixTerm five_one_to_mono[] = { { 0, 0, sqrt_half }, { 1, 0, sqrt_half }, { 2, 0, 1 }, { 4, 0, 0.5f }, { 5, 0, 0.5f } };
+static constexpr MixTerm quad_to_stereo[] = { { 0, 0, 0.5f }, { 2, 0, 0.5f }, { 1, 1, 0.5f }, { 3, 1, 0.5f } };
+static constexpr MixTerm five_one_to_stereo[] = { { 0, 0, 1 }, { 2, 0, sqrt_half }, { 4, 0, sqrt_half }, { 1, 1, 1 }, { 2, 1, sqrt_half }, { 5, 1, sqrt_half } };
+static constexpr MixTerm five_one_to_quad[] = { { 0, 0, 1 }, { 2, 0, sqrt_half }, { 1, 1, 1 }, { 2, 1, sqrt_half }, { 4, 2, 1 }, { 5, 3, 1 } };
+
+static ReadonlySpan<MixTerm> speaker_mix_terms(size_t source_channels, size_t destination_channels)
+{
+    auto key = (source_channels << 8) | destination_channels;
+    switch (key) {
+    case (1 << 8) | 2:
+        return mono_to_stereo;
+    case (1 << 8) | 4:
+        return mono_to_quad;
+    case (1 << 8) | 6:
+        return mono_to_5_1;
+    case (2 << 8) | 4:
+        return stereo_to_quad;
+    case (2 << 8) | 6:
+        return stereo_to_5_1;
+    case (4 << 8) | 6:
+        return quad_to_5_1;
+    case (2 << 8) | 1:
+        return stereo_to_mono;
+    case (4 << 8) | 1:
+        return quad_to_mono;
+    case (6 << 8) | 1:
+        return five_one_to_mono;
+    case (4 << 8) | 2:
+        return quad_to_stereo;
+    case (6 << 8) | 2:
+        return five_one_to_stereo;
+    case (6 << 8) | 4:
+        return five_one_to_quad;
+    default:
+        return {};
+    }
+}
+
+void AudioBus::sum_from(AudioBus const& source, Bindings::ChannelInterpretation interpretation)
+{
+    if (source.is_silent())
+        return;
+    m_is_silent = false;
+
+    auto source_channels = source.channel_count();
+    auto destination_channels = channel_count();
+
+    if (source_channels == destination_channels) {
+        for (size_t i = 0; i < destination_channels; ++i)
+            Kernels::add(source.channel(i), channel(i));
+        return;
+    }
+
+    // Speaker layouts without a defined mixing rule fall back to discrete mixing.
+    if (interpretation == Bindings::ChannelInterpretation::Speakers) {
+        if (auto terms = speaker_mix_terms(source_channels, destination_channels); !terms.is_empty()) {
+            for (auto const& term : terms)
+                Kernels::add_scaled(source.channel(term.source_channel), term.gain, channel(term.destination_channel));
+            return;
+        }
+    }
+
+    // Discrete mixing fills channels in order and drops or silences the remainder.
+    for (size_t i = 0; i < min(source_channels, destination_channels); ++i)
+        Kernels::add(source.channel(i), channel(i));
+}
+
+void AudioBus::copy_from(AudioBus const& source, Bindings::ChannelInterpretation interpretation)
+{
+    set_silent();
+    sum_from(source, interpretation);
+}
+
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Span.h>
+#include <AK/Vector.h>
+#include <LibWeb/Bindings/AudioNode.h>
+
+namespace Web::WebAudio::Render {
+
+// https://webaudio.github.io/web-audio-api/#render-quantum-size
+static constexpr size_t RENDER_QUANTUM_SIZE = 128;
+
+// One render quantum of audio for a number of channels. Channel storage is kept around when the channel count shrinks,
+// so that the rendering thread only allocates when a bus grows beyond its previous largest size.
+class AudioBus {
+public:
+    explicit AudioBus(size_t channel_count = 1);
+
+    size_t channel_count() const { return m_channel_count; }
+    void set_channel_count(size_t);
+
+    Span<float> channel(size_t index)
+    {
+        VERIFY(index < m_channel_count);
+        return m_channels[index].span();
+    }
+
+    ReadonlySpan<float> channel(size_t index) const
+    {
+        VERIFY(index < m_channel_count);
+        return m_channels[index].span();
+    }
+
+    // A silent bus is known to contain only zeros, which lets nodes skip processing entirely.
+    bool is_silent() const { return m_is_silent; }
+    void set_silent();
+    void clear_silent_flag() { m_is_silent = false; }
+
+    // Sets the channel count and fills every channel with zeros.
+    void zero(size_t channel_count);
+
+    // Mixes the source into this bus, up-mixing or down-mixing it to this bus's channel count.
+    // https://webaudio.github.io/web-audio-api/#channel-up-mixing-and-down-mixing
+    void sum_from(AudioBus const& source, Bindings::ChannelInterpretation);
+
+    // Replaces the contents of this bus with the source mixed to this bus's channel count.
+    void copy_from(AudioBus const& source, Bindings::ChannelInterpretation);
+
+private:
+    Vector<Array<float, RENDER_QUANTUM_SIZE>, 2> m_channels;
+    size_t m_channel_count { 0 };
+    bool m_is_silent { true };
+};
+
+}
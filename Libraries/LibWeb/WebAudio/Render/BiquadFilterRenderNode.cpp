@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/AllOf.h>
+#include <AK/Math.h>
+#include <LibWeb/WebAudio/BaseAudioContext.h>
+#include <LibWeb/WebAudio/BiquadFilterNode.h>
+#include <LibWeb/WebAudio/Render/BiquadFilterRenderNode.h>
+
+namespace Web::WebAudio::Render {
+
+BiquadFilterRenderNode::BiquadFilterRenderNode(BiquadFilterNode const& node)
+    : RenderNode(node, 1, 1)
+    , m_type(node.type())
+    , m_frequency(*node.frequency())
+    , m_detune(*node.detune())
+    , m_q(*node.q())
+    , m_gain(*node.gain())
+{
+    register_param(m_frequency);
+    register_param(m_detune);
+    register_param(m_q);
+    register_param(m_gain);
+}
+
+BiquadFilterRenderNode::~BiquadFilterRenderNode() = default;
+
+// https://webaudio.github.io/web-audio-api/#filters-characteristics
+Kernels::BiquadCoefficients BiquadFilterRenderNode::compute_coefficients(Bindings::BiquadFilterType type, float sample_rate, float frequency, float detune, float q, float gain)
+{
+    // The computed frequency is frequency * pow(2, detune / 1200), which must lie within [0, Nyquist].
+    auto nyquist = static_cast<double>(sample_rate) / 2;
+    auto computed_frequency = clamp(static_cast<double>(frequency) * pow(2.0, static_cast<double>(detune) / 1200), 0.0, nyquist);
+
+    auto a = pow(10.0, static_cast<double>(gain) / 40);
+    auto w0 = 2 * AK::Pi<double> * computed_frequency / sample_rate;
+    auto cos_w0 = cos(w0);
+    auto sin_w0 = sin(w0);
+    auto alpha_q = sin_w0 / (2 * static_cast<double>(q));
+    auto alpha_q_db = sin_w0 / (2 * pow(10.0, static_cast<double>(q) / 20));
+    // With a shelf slope S of 1, alpha_S simplifies to sin(w0) / sqrt(2).
+    auto alpha_s = sin_w0 / AK::Sqrt2<double>;
+    auto sqrt_a = sqrt(a);
+
+    double b0 = 1, b1 = 0, b2 = 0, a0 = 1, a1 = 0, a2 = 0;
+    switch (type) {
+    case Bindings::BiquadFilterType::Lowpass:
+        b0 = (1 - cos_w0) / 2;
+        b1 = 1 - cos_w0;
+        b2 = (1 - cos_w0) / 2;
+        a0 = 1 + alpha_q_db;
+        a1 = -2 * cos_w0;
+        a2 = 1 - alpha_q_db;
+        break;
+    case Bindings::BiquadFilterType::Highpass:
+        b0 = (1 + cos_w0) / 2;
+        b1 = -(1 + cos_w0);
+        b2 = (1 + cos_w0) / 2;
+        a0 = 1 + alpha_q_db;
+        a1 = -2 * cos_w0;
+        a2 = 1 - alpha_q_db;
+        break;
+    case Bindings::BiquadFilterType::Bandpass:
+        b0 = alpha_q;
+        b1 = 0;
+        b2 = -alpha_q;
+        a0 = 1 + alpha_q;
+        a1 = -2 * cos_w0;
+        a2 = 1 - alpha_q;
+        break;
+    case Bindings::BiquadFilterType::Notch:
+        b0 = 1;
+        b1 = -2 * cos_w0;
+        b2 = 1;
+        a0 = 1 + alpha_q;
+        a1 = -2 * cos_w0;
+        a2 = 1 - alpha_q;
+        break;
+    case Bindings::BiquadFilterType::Allpass:
+        b0 = 1 - alpha_q;
+        b1 = -2 * cos_w0;
+        b2 = 1 + alpha_q;
+        a0 = 1 + alpha_q;
+        a1 = -2 * cos_w0;
+        a2 = 1 - alpha_q;
+        break;
+    case Bindings::BiquadFilterType::Peaking:
+        b0 = 1 + alpha_q * a;
+        b1 = -2 * cos_w0;
+        b2 = 1 - alpha_q * a;
+        a0 = 1 + alpha_q / a;
+        a1 = -2 * cos_w0;
+        a2 = 1 - alpha_q / a;
+        break;
+    case Bindings::BiquadFilterType::Lowshelf:
+        b0 = a * ((a + 1) - (a - 1) * cos_w0 + 2 * alpha_s * sqrt_a);
+        b1 = 2 * a * ((a - 1) - (a + 1) * cos_w0);
+        b2 = a * ((a + 1) - (a - 1) * cos_w0 - 2 * alpha_s * sqrt_a);
+        a0 = (a + 1) + (a - 1) * cos_w0 + 2 * alpha_s * sqrt_a;
+        a1 = -2 * ((a - 1) + (a + 1) * cos_w0);
+        a2 = (a + 1) + (a - 1) * cos_w0 - 2 * alpha_s * sqrt_a;
+        break;
+    case Bindings::BiquadFilterType::Highshelf:
+        b0 = a * ((a + 1) + (a - 1) * cos_w0 + 2 * alpha_s * sqrt_a);
+        b1 = -2 * a * ((a - 1) + (a + 1) * cos_w0);
+        b2 = a * ((a + 1) + (a - 1) * cos_w0 - 2 * alpha_s * sqrt_a);
+        a0 = (a + 1) - (a - 1) * cos_w0 + 2 * alpha_s * sqrt_a;
+        a1 = 2 * ((a - 1) - (a + 1) * cos_w0);
+        a2 = (a + 1) - (a - 1) * cos_w0 - 2 * alpha_s * sqrt_a;
+        break;
+    }
+
+    // Degenerate parameters (for example a Q of zero) would produce a non-finite filter, so pass the signal through
+    // unchanged instead.
+    if (a0 == 0 || !isfinite(b0 / a0) || !isfinite(b1 / a0) || !isfinite(b2 / a0) || !isfinite(a1 / a0) || !isfinite(a2 / a0))
+        return {};
+
+    return {
+        .b0 = static_cast<float>(b0 / a0),
+        .b1 = static_cast<float>(b1 / a0),
+        .b2 = static_cast<float>(b2 / a0),
+        .a1 = static_cast<float>(a1 / a0),
+        .a2 = static_cast<float>(a2 / a0),
+    };
+}
+
+void BiquadFilterRenderNode::process(RenderContext const& context)
+{
+    auto states_are_silent = all_of(m_states.span().trim(m_active_channel_count), [](auto const& state) {
+        return fabsf(state.s1) < 1e-12f && fabsf(state.s2) < 1e-12f;
+    });
+
+    // The filter has a tail, so it keeps ringing out its previous channels after its input goes silent.
+    AudioBus const* source = &input(0);
+    auto& destination = output(0);
+    if (source->is_silent()) {
+        if (states_are_silent) {
+            destination.zero(source->channel_count());
+            return;
+        }
+        m_silent_input.zero(m_active_channel_count);
+        source = &m_silent_input;
+    }
+
+    auto channel_count = source->channel_count();
+    while (m_states.size() < channel_count)
+        m_states.append({});
+    m_active_channel_count = channel_count;
+
+    destination.set_channel_count(channel_count);
+    destination.clear_silent_flag();
+
+    if (m_frequency.is_constant() && m_detune.is_constant() && m_q.is_constant() && m_gain.is_constant()) {
+        auto coefficients = compute_coefficients(m_type, context.sample_rate, m_frequency.value_at(0), m_detune.value_at(0), m_q.value_at(0), m_gain.value_at(0));
+
+        Vector<ReadonlySpan<float>, BaseAudioContext::MAX_NUMBER_OF_CHANNELS> inputs;
+        Vector<Span<float>, BaseAudioContext::MAX_NUMBER_OF_CHANNELS> outputs;
+        for (size_t channel = 0; channel < channel_count; ++channel) {
+            inputs.unchecked_append(source->channel(channel));
+            outputs.unchecked_append(destination.channel(channel));
+        }
+        Kernels::biquad(inputs, outputs, coefficients, m_states.span().trim(channel_count));
+        return;
+    }
+
+    // With a-rate automation the coefficients change from frame to frame, so each channel is filtered serially.
+    Array<Kernels::BiquadCoefficients, RENDER_QUANTUM_SIZE> coefficients;
+    for (size_t frame = 0; frame < RENDER_QUANTUM_SIZE; ++frame)
+        coefficients[frame] = compute_coefficients(m_type, context.sample_rate, m_frequency.value_at(frame), m_detune.value_at(frame), m_q.value_at(frame), m_gain.value_at(frame));
+
+    for (size_t channel = 0; channel < channel_count; ++channel) {
+        auto samples = source->channel(channel);
+        auto filtered = destination.channel(channel);
+        auto& state = m_states[channel];
+        for (size_t frame = 0; frame < RENDER_QUANTUM_SIZE; ++frame) {
+            auto const& c = coefficients[frame];
+            auto x = samples[frame];
+            auto y = c.b0 * x + state.s1;
+            state.s1 = c.b1 * x - c.a1 * y + state.s2;
+            state.s2 = c.b2 * x - c.a2 * y;
+            filtered[frame] = y;
+        }
+    }
+}
+
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/Bindings/BiquadFilterNode.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/WebAudio/Render/Kernels.h>
+#include <LibWeb/WebAudio/Render/RenderNode.h>
+#include <LibWeb/WebAudio/Render/RenderParam.h>
+
+namespace Web::WebAudio::Render {
+
+// https://webaudio.github.io/web-audio-api/#BiquadFilterNode
+class BiquadFilterRenderNode final : public RenderNode {
+public:
+    explicit BiquadFilterRenderNode(BiquadFilterNode const&);
+    virtual ~BiquadFilterRenderNode() override;
+
+    void set_type(Bindings::BiquadFilterType type) { m_type = type; }
+
+    virtual void process(RenderContext const&) override;
+
+    // https://webaudio.github.io/web-audio-api/#filters-characteristics
+    static Kernels::BiquadCoefficients compute_coefficients(Bindings::BiquadFilterType, float sample_rate, float frequency, float detune, float q, float gain);
+
+private:
+    Bindings::BiquadFilterType m_type;
+    RenderParam m_frequency;
+    RenderParam m_detune;
+    RenderParam m_q;
+    RenderParam m_gain;
+    Vector<Kernels::BiquadState, 2> m_states;
+    size_t m_active_channel_count { 0 };
+    AudioBus m_silent_input;
+};
+
+}
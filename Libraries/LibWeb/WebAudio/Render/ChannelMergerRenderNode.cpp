@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/WebAudio/ChannelMergerNode.h>
+#include <LibWeb/WebAudio/Render/ChannelMergerRenderNode.h>
+
+namespace Web::WebAudio::Render {
+
+ChannelMergerRenderNode::ChannelMergerRenderNode(ChannelMergerNode const& node, size_t number_of_inputs)
+    : RenderNode(node, number_of_inputs, 1)
+{
+}
+
+ChannelMergerRenderNode::~ChannelMergerRenderNode() = default;
+
+void ChannelMergerRenderNode::process(RenderContext const&)
+{
+    // The channel count of every input is fixed to one, so each input has already been down-mixed to mono. The output
+    // has one channel per input, and is silent only if every input is.
+    auto& destination = output(0);
+    destination.zero(number_of_inputs());
+    for (size_t i = 0; i < number_of_inputs(); ++i) {
+        auto const& source = input(i);
+        if (source.is_silent())
+            continue;
+        source.channel(0).copy_to(destination.channel(i));
+        destination.clear_silent_flag();
+    }
+}
+
+}
@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/WebAudio/Render/RenderNode.h>
+
+namespace Web::WebAudio::Render {
+
+// https://webaudio.github.io/web-audio-api/#ChannelMergerNode
+class ChannelMergerRenderNode final : public RenderNode {
+public:
+    ChannelMergerRenderNode(ChannelMergerNode const&, size_t number_of_inputs);
+    virtual ~ChannelMergerRenderNode() override;
+
+    virtual void process(RenderContext const&) override;
+};
+
+}
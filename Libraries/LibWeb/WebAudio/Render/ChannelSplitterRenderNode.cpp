@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/WebAudio/ChannelSplitterNode.h>
+#include <LibWeb/WebAudio/Render/ChannelSplitterRenderNode.h>
+
+namespace Web::WebAudio::Render {
+
+ChannelSplitterRenderNode::ChannelSplitterRenderNode(ChannelSplitterNode const& node, size_t number_of_outputs)
+    : RenderNode(node, 1, number_of_outputs)
+{
+}
+
+ChannelSplitterRenderNode::~ChannelSplitterRenderNode() = default;
+
+void ChannelSplitterRenderNode::process(RenderContext const&)
+{
+    // The input is mixed to exactly one channel per output with discrete interpretation, and each output is a mono
+    // copy of its channel.
+    auto const& source = input(0);
+    for (size_t i = 0; i < number_of_outputs(); ++i) {
+        auto& destination = output(i);
+        if (source.is_silent() || i >= source.channel_count()) {
+            destination.zero(1);
+            continue;
+        }
+        destination.set_channel_count(1);
+        source.channel(i).copy_to(destination.channel(0));
+        destination.clear_silent_flag();
+    }
+}
+
+}
@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/WebAudio/Render/RenderNode.h>
+
+namespace Web::WebAudio::Render {
+
+// https://webaudio.github.io/web-audio-api/#ChannelSplitterNode
+class ChannelSplitterRenderNode final : public RenderNode {
+public:
+    ChannelSplitterRenderNode(ChannelSplitterNode const&, size_t number_of_outputs);
+    virtual ~ChannelSplitterRenderNode() override;
+
+    virtual void process(RenderContext const&) override;
+};
+
+}
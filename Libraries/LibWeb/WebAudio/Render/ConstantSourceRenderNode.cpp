@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/WebAudio/ConstantSourceNode.h>
+#include <LibWeb/WebAudio/Render/ConstantSourceRenderNode.h>
+
+namespace Web::WebAudio::Render {
+
+ConstantSourceRenderNode::ConstantSourceRenderNode(ConstantSourceNode const& node)
+    : ScheduledSourceRenderNode(node, 1)
+    , m_offset(*node.offset())
+{
+    register_param(m_offset);
+}
+
+ConstantSourceRenderNode::~ConstantSourceRenderNode() = default;
+
+bool ConstantSourceRenderNode::render(RenderContext const&, size_t first_frame, size_t end_frame)
+{
+    // The output is the computed value of the offset param.
+    auto samples = output(0).channel(0).slice(first_frame, end_frame - first_frame);
+    if (m_offset.is_constant())
+        samples.fill(m_offset.value_at(0));
+    else
+        m_offset.values().slice(first_frame, end_frame - first_frame).copy_to(samples);
+    return true;
+}
+
+}
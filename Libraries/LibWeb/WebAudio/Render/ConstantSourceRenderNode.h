@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/Forward.h>
+#include <LibWeb/WebAudio/Render/RenderParam.h>
+#include <LibWeb/WebAudio/Render/ScheduledSourceRenderNode.h>
+
+namespace Web::WebAudio::Render {
+
+// https://webaudio.github.io/web-audio-api/#ConstantSourceNode
+class ConstantSourceRenderNode final : public ScheduledSourceRenderNode {
+public:
+    explicit ConstantSourceRenderNode(ConstantSourceNode const&);
+    virtual ~ConstantSourceRenderNode() override;
+
+private:
+    virtual bool render(RenderContext const&, size_t first_frame, size_t end_frame) override;
+
+    RenderParam m_offset;
+};
+
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <LibWeb/WebAudio/AudioParam.h>
+#include <LibWeb/WebAudio/DelayNode.h>
+#include <LibWeb/WebAudio/Render/DelayRenderNode.h>
+#include <LibWeb/WebAudio/Render/Kernels.h>
+
+namespace Web::WebAudio::Render {
+
+DelayRenderNode::DelayRenderNode(DelayNode const& node, float sample_rate)
+    : RenderNode(node, 1, 1)
+    , m_delay_time(*node.delay_time())
+    // The line holds the maximum delay plus one render quantum, so a full quantum can be written before it is read.
+    , m_line_length(static_cast<size_t>(ceil(node.delay_time()->max_value() * sample_rate)) + RENDER_QUANTUM_SIZE + 1)
+{
+    register_param(m_delay_time);
+    ensure_channel_count(2);
+}
+
+DelayRenderNode::~DelayRenderNode() = default;
+
+void DelayRenderNode::ensure_channel_count(size_t channel_count)
+{
+    while (m_lines.size() < channel_count)
+        m_lines.append(MUST(FixedArray<float>::create(m_line_length)));
+}
+
+float DelayRenderNode::read_interpolated(ReadonlySpan<float> line, double position) const
+{
+    auto length = static_cast<double>(m_line_length);
+    position = fmod(position, length);
+    if (position < 0)
+        position += length;
+    auto index = static_cast<size_t>(position);
+    auto fraction = static_cast<float>(position - index);
+    auto next_index = index + 1 == m_line_length ? 0 : index + 1;
+    return line[index] + (line[next_index] - line[index]) * fraction;
+}
+
+void DelayRenderNode::process(RenderContext const& context)
+{
+    AudioBus const* source = &input(0);
+    auto& destination = output(0);
+
+    // Once the input has been silent for longer than the line is long, everything in the line is silence as well.
+    if (source->is_silent()) {
+        if (m_frames_since_input >= m_line_length) {
+            destination.zero(1);
+            return;
+        }
+        m_frames_since_input += RENDER_QUANTUM_SIZE;
+        m_silent_input.zero(m_active_channel_count);
+        source = &m_silent_input;
+    } else {
+        m_frames_since_input = 0;
+        m_active_channel_count = source->channel_count();
+    }
+
+    auto channel_count = source->channel_count();
+    ensure_channel_count(channel_count);
+    destination.set_channel_count(channel_count);
+    destination.clear_silent_flag();
+
+    // Write this quantum into the line first, so that a delay of zero passes the input straight through.
+    for (size_t channel = 0; channel < channel_count; ++channel) {
+        auto line = m_lines[channel].span();
+        auto samples = source->channel(channel);
+        auto first_part = min(RENDER_QUANTUM_SIZE, m_line_length - m_write_index);
+        samples.trim(first_part).copy_to(line.slice(m_write_index));
+        if (first_part < RENDER_QUANTUM_SIZE)
+            samples.slice(first_part).copy_to(line);
+    }
+
+    if (m_delay_time.is_constant()) {
+        auto delay_frames = static_cast<double>(m_delay_time.value_at(0)) * context.sample_rate;
+        auto read_position = static_cast<double>(m_write_index) - delay_frames;
+        if (read_position < 0)
+            read_position += m_line_length;
+        auto read_index = static_cast<size_t>(read_position);
+        auto fraction = static_cast<float>(read_position - read_index);
+
+        // When the interpolated read does not wrap around the end of the line, it is two contiguous slices.
+        if (read_index + RENDER_QUANTUM_SIZE + 1 <= m_line_length) {
+            for (size_t channel = 0; channel < channel_count; ++channel) {
+                auto line = m_lines[channel].span();
+                Kernels::interpolate(line.slice(read_index, RENDER_QUANTUM_SIZE), line.slice(read_index + 1, RENDER_QUANTUM_SIZE), fraction, destination.channel(channel));
+            }
+            m_write_index = (m_write_index + RENDER_QUANTUM_SIZE) % m_line_length;
+            return;
+        }
+    }
+
+    for (size_t channel = 0; channel < channel_count; ++channel) {
+        auto line = m_lines[channel].span();
+        auto delayed = destination.channel(channel);
+        for (size_t frame = 0; frame < RENDER_QUANTUM_SIZE; ++frame) {
+            auto delay_frames = static_cast<double>(m_delay_time.value_at(frame)) * context.sample_rate;
+            delayed[frame] = read_interpolated(line, static_cast<double>(m_write_index + frame) - delay_frames);
+        }
+    }
+    m_write_index = (m_write_index + RENDER_QUANTUM_SIZE) % m_line_length;
+}
+
+}
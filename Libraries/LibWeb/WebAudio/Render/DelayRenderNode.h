@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/FixedArray.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/WebAudio/Render/RenderNode.h>
+#include <LibWeb/WebAudio/Render/RenderParam.h>
+
+namespace Web::WebAudio::Render {
+
+// https://webaudio.github.io/web-audio-api/#DelayNode
+class DelayRenderNode final : public RenderNode {
+public:
+    DelayRenderNode(DelayNode const&, float sample_rate);
+    virtual ~DelayRenderNode() override;
+
+    virtual void process(RenderContext const&) override;
+
+private:
+    void ensure_channel_count(size_t);
+    float read_interpolated(ReadonlySpan<float> line, double position) const;
+
+    RenderParam m_delay_time;
+    size_t m_line_length { 0 };
+    size_t m_write_index { 0 };
+    Vector<FixedArray<float>, 2> m_lines;
+    size_t m_active_channel_count { 1 };
+    size_t m_frames_since_input { 0 };
+    AudioBus m_silent_input;
+};
+
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/WebAudio/GainNode.h>
+#include <LibWeb/WebAudio/Render/GainRenderNode.h>
+#include <LibWeb/WebAudio/Render/Kernels.h>
+
+namespace Web::WebAudio::Render {
+
+GainRenderNode::GainRenderNode(GainNode const& node)
+    : RenderNode(node, 1, 1)
+    , m_gain(*node.gain())
+{
+    register_param(m_gain);
+}
+
+GainRenderNode::~GainRenderNode() = default;
+
+void GainRenderNode::process(RenderContext const&)
+{
+    auto const& source = input(0);
+    auto& destination = output(0);
+
+    // The number of channels of the output will always equal the number of channels of the input, with each channel
+    // of the input being multiplied by the gain values and being copied into the corresponding channel of the output.
+    if (source.is_silent() || (m_gain.is_constant() && m_gain.value_at(0) == 0)) {
+        destination.zero(source.channel_count());
+        return;
+    }
+
+    destination.set_channel_count(source.channel_count());
+    for (size_t channel = 0; channel < source.channel_count(); ++channel) {
+        if (m_gain.is_constant())
+            Kernels::multiply(source.channel(channel), m_gain.value_at(0), destination.channel(channel));
+        else
+            Kernels::multiply(source.channel(channel), m_gain.values(), destination.channel(channel));
+    }
+    destination.clear_silent_flag();
+}
+
+}
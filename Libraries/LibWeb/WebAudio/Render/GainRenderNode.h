@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/Forward.h>
+#include <LibWeb/WebAudio/Render/RenderNode.h>
+#include <LibWeb/WebAudio/Render/RenderParam.h>
+
+namespace Web::WebAudio::Render {
+
+// https://webaudio.github.io/web-audio-api/#GainNode
+class GainRenderNode final : public RenderNode {
+public:
+    explicit GainRenderNode(GainNode const&);
+    virtual ~GainRenderNode() override;
+
+    virtual void process(RenderContext const&) override;
+
+private:
+    RenderParam m_gain;
+};
+
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/BitCast.h>
+#include <AK/Math.h>
+#include <AK/SIMDExtras.h>
+#include <LibWeb/WebAudio/Render/Kernels.h>
+
+namespace Web::WebAudio::Render::Kernels {
+
+using AK::SIMD::expand4;
+using AK::SIMD::f32x4;
+using AK::SIMD::i32x4;
+using AK::SIMD::load_unaligned;
+using AK::SIMD::store_unaligned;
+
+static constexpr size_t lanes = 4;
+
+ALWAYS_INLINE static f32x4 select(i32x4 mask, f32x4 if_true, f32x4 if_false)
+{
+    return bit_cast<f32x4>((bit_cast<i32x4>(if_true) & mask) | (bit_cast<i32x4>(if_false) & ~mask));
+}
+
+ALWAYS_INLINE static f32x4 absolute_value(f32x4 value)
+{
+    return bit_cast<f32x4>(bit_cast<i32x4>(value) & 0x7fffffff);
+}
+
+void multiply(ReadonlySpan<float> input, float gain, Span<float> output)
+{
+    VERIFY(output.size() >= input.size());
+    auto gain_vector = expand4(gain);
+    size_t i = 0;
+    for (; i + lanes <= input.size(); i += lanes)
+        store_unaligned(&output[i], load_unaligned<f32x4>(&input[i]) * gain_vector);
+    for (; i < input.size(); ++i)
+        output[i] = input[i] * gain;
+}
+
+void multiply(ReadonlySpan<float> input, ReadonlySpan<float> gains, Span<float> output)
+{
+    VERIFY(gains.size() >= input.size());
+    VERIFY(output.size() >= input.size());
+    size_t i = 0;
+    for (; i + lanes <= input.size(); i += lanes)
+        store_unaligned(&output[i], load_unaligned<f32x4>(&input[i]) * load_unaligned<f32x4>(&gains[i]));
+    for (; i < input.size(); ++i)
+        output[i] = input[i] * gains[i];
+}
+
+void add(ReadonlySpan<float> input, Span<float> output)
+{
+    VERIFY(output.size() >= input.size());
+    size_t i = 0;
+    for (; i + lanes <= input.size(); i += lanes)
+        store_unaligned(&output[i], load_unaligned<f32x4>(&output[i]) + load_unaligned<f32x4>(&input[i]));
+    for (; i < input.size(); ++i)
+        output[i] += input[i];
+}
+
+void add_scaled(ReadonlySpan<float> input, float gain, Span<float> output)
+{
+    VERIFY(output.size() >= input.size());
+    auto gain_vector = expand4(gain);
+    size_t i = 0;
+    for (; i + lanes <= input.size(); i += lanes)
+        store_unaligned(&output[i], load_unaligned<f32x4>(&output[i]) + load_unaligned<f32x4>(&input[i]) * gain_vector);
+    for (; i < input.size(); ++i)
+        output[i] += input[i] * gain;
+}
+
+void add_scaled(ReadonlySpan<float> input, ReadonlySpan<float> gains, Span<float> output)
+{
+    VERIFY(gains.size() >= input.size());
+    VERIFY(output.size() >= input.size());
+    size_t i = 0;
+    for (; i + lanes <= input.size(); i += lanes)
+        store_unaligned(&output[i], load_unaligned<f32x4>(&output[i]) + load_unaligned<f32x4>(&input[i]) * load_unaligned<f32x4>(&gains[i]));
+    for (; i < input.size(); ++i)
+        output[i] += input[i] * gains[i];
+}
+
+void clamp(Span<float> values, float minimum, float maximum)
+{
+    auto minimum_vector = expand4(minimum);
+    auto maximum_vector = expand4(maximum);
+    size_t i = 0;
+    for (; i + lanes <= values.size(); i += lanes) {
+        auto value = load_unaligned<f32x4>(&values[i]);
+        value = select(value < minimum_vector, minimum_vector, value);
+        value = select(value > maximum_vector, maximum_vector, value);
+        store_unaligned(&values[i], value);
+    }
+    for (; i < values.size(); ++i)
+        values[i] = AK::clamp(values[i], minimum, maximum);
+}
+
+void interpolate(ReadonlySpan<float> first, ReadonlySpan<float> second, float fraction, Span<float> output)
+{
+    VERIFY(second.size() >= first.size());
+    VERIFY(output.size() >= first.size());
+    auto fraction_vector = expand4(fraction);
+    size_t i = 0;
+    for (; i + lanes <= first.size(); i += lanes) {
+        auto a = load_unaligned<f32x4>(&first[i]);
+        auto b = load_unaligned<f32x4>(&second[i]);
+        store_unaligned(&output[i], a + (b - a) * fraction_vector);
+    }
+    for (; i < first.size(); ++i)
+        output[i] = first[i] + (second[i] - first[i]) * fraction;
+}
+
+float peak(ReadonlySpan<float> input)
+{
+    f32x4 peak_vector {};
+    size_t i = 0;
+    for (; i + lanes <= input.size(); i += lanes) {
+        auto value = absolute_value(load_unaligned<f32x4>(&input[i]));
+        peak_vector = select(value > peak_vector, value, peak_vector);
+    }
+    auto result = max(max(peak_vector[0], peak_vector[1]), max(peak_vector[2], peak_vector[3]));
+    for (; i < input.size(); ++i)
+        result = max(result, fabsf(input[i]));
+    return result;
+}
+
+void biquad(Span<ReadonlySpan<float>> inputs, Span<Span<float>> outputs, BiquadCoefficients const& coefficients, Span<BiquadState> states)
+{
+    VERIFY(inputs.size() == outputs.size());
+    VERIFY(inputs.size() == states.size());
+
+    auto b0 = expand4(coefficients.b0);
+    auto b1 = expand4(coefficients.b1);
+    auto b2 = expand4(coefficients.b2);
+    auto a1 = expand4(coefficients.a1);
+    auto a2 = expand4(coefficients.a2);
+
+    for (size_t first_channel = 0; first_channel < inputs.size(); first_channel += lanes) {
+        auto channel_count = min(lanes, inputs.size() - first_channel);
+        auto frame_count = inputs[first_channel].size();
+
+        f32x4 s1 {};
+        f32x4 s2 {};
+        for (size_t lane = 0; lane < channel_count; ++lane) {
+            s1[lane] = states[first_channel + lane].s1;
+            s2[lane] = states[first_channel + lane].s2;
+        }
+
+        for (size_t frame = 0; frame < frame_count; ++frame) {
+            f32x4 x {};
+            for (size_t lane = 0; lane < channel_count; ++lane)
+                x[lane] = inputs[first_channel + lane][frame];
+
+            auto y = b0 * x + s1;
+            s1 = b1 * x - a1 * y + s2;
+            s2 = b2 * x - a2 * y;
+
+            for (size_t lane = 0; lane < channel_count; ++lane)
+                outputs[first_channel + lane][frame] = y[lane];
+        }
+
+        for (size_t lane = 0; lane < channel_count; ++lane) {
+            states[first_channel + lane].s1 = s1[lane];
+            states[first_channel + lane].s2 = s2[lane];
+        }
+    }
+}
+
+void interleave(Span<ReadonlySpan<float>> channels, Span<float> interleaved)
+{
+    auto channel_count = channels.size();
+    if (channel_count == 0)
+        return;
+    auto frame_count = interleaved.size() / channel_count;
+    for (size_t channel = 0; channel < channel_count; ++channel) {
+        auto const& source = channels[channel];
+        VERIFY(source.size() >= frame_count);
+        for (size_t frame = 0; frame < frame_count; ++frame)
+            interleaved[frame * channel_count + channel] = source[frame];
+    }
+}
+
+}
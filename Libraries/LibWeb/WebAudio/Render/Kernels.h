@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Span.h>
+
+// Vectorized inner loops used by the rendering thread. Every function accepts spans of any length and handles the
+// tail that does not fill a whole vector with scalar code, so callers never need to care about alignment or size.
+namespace Web::WebAudio::Render::Kernels {
+
+// output[i] = input[i] * gain
+void multiply(ReadonlySpan<float> input, float gain, Span<float> output);
+
+// output[i] = input[i] * gains[i]
+void multiply(ReadonlySpan<float> input, ReadonlySpan<float> gains, Span<float> output);
+
+// output[i] += input[i]
+void add(ReadonlySpan<float> input, Span<float> output);
+
+// output[i] += input[i] * gain
+void add_scaled(ReadonlySpan<float> input, float gain, Span<float> output);
+
+// output[i] += input[i] * gains[i]
+void add_scaled(ReadonlySpan<float> input, ReadonlySpan<float> gains, Span<float> output);
+
+// values[i] = clamp(values[i], minimum, maximum)
+void clamp(Span<float> values, float minimum, float maximum);
+
+// output[i] = first[i] + (second[i] - first[i]) * fraction
+void interpolate(ReadonlySpan<float> first, ReadonlySpan<float> second, float fraction, Span<float> output);
+
+// Returns max(|input[i]|).
+float peak(ReadonlySpan<float> input);
+
+struct BiquadCoefficients {
+    float b0 { 1 };
+    float b1 { 0 };
+    float b2 { 0 };
+    float a1 { 0 };
+    float a2 { 0 };
+};
+
+// Transposed direct form II state for one channel.
+struct BiquadState {
+    float s1 { 0 };
+    float s2 { 0 };
+};
+
+// Runs the same filter over up to four channels at once, with one channel in each vector lane. The recursion of an
+// IIR filter is inherently serial in time, so the lanes are what make this vectorizable.
+void biquad(Span<ReadonlySpan<float>> inputs, Span<Span<float>> outputs, BiquadCoefficients const&, Span<BiquadState> states);
+
+// Writes planar channel data into an interleaved buffer with the given number of channels.
+void interleave(Span<ReadonlySpan<float>> channels, Span<float> interleaved);
+
+}
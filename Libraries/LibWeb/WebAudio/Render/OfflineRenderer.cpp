@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/WebAudio/Render/OfflineRenderer.h>
+
+namespace Web::WebAudio::Render {
+
+NonnullRefPtr<OfflineRenderer> OfflineRenderer::create(NonnullRefPtr<ControlMessageQueue> control_message_queue, NodeID destination_id, float sample_rate)
+{
+    return adopt_ref(*new OfflineRenderer(move(control_message_queue), destination_id, sample_rate));
+}
+
+OfflineRenderer::OfflineRenderer(NonnullRefPtr<ControlMessageQueue> control_message_queue, NodeID destination_id, float sample_rate)
+    : m_control_message_queue(move(control_message_queue))
+    , m_graph(destination_id)
+    , m_sample_rate(sample_rate)
+{
+}
+
+// https://webaudio.github.io/web-audio-api/#rendering-loop
+void OfflineRenderer::render(Span<FixedArray<float>> output)
+{
+    if (output.is_empty())
+        return;
+
+    u64 length = output.first().size();
+    auto channel_count = output.size();
+
+    u64 frame = 0;
+    while (frame < length) {
+        // NOTE: Control messages are only picked up between blocks. Changes made by script while an offline context
+        //       is rendering are racy by nature, so this only makes them land a little later.
+        m_control_message_queue->drain([&](ControlMessage& message) {
+            m_graph.apply(message);
+        });
+
+        auto block_length = min(length - frame, static_cast<u64>(quanta_per_block * RENDER_QUANTUM_SIZE));
+        RenderContext context {
+            .sample_rate = m_sample_rate,
+            .current_frame = frame,
+            .current_time = static_cast<double>(frame) / m_sample_rate,
+        };
+
+        auto quantum_frame = frame;
+        m_graph.render_block(context, ceil_div(block_length, static_cast<u64>(RENDER_QUANTUM_SIZE)), [&](AudioBus const& rendered) {
+            auto frame_count = min(length - quantum_frame, static_cast<u64>(RENDER_QUANTUM_SIZE));
+
+            // The output starts out zeroed, so silent quanta need not be written at all.
+            if (!rendered.is_silent()) {
+                auto const* bus = &rendered;
+                if (rendered.channel_count() != channel_count) {
+                    m_output_bus.zero(channel_count);
+                    m_output_bus.sum_from(rendered, Bindings::ChannelInterpretation::Speakers);
+                    bus = &m_output_bus;
+                }
+                for (size_t channel = 0; channel < channel_count; ++channel)
+                    bus->channel(channel).trim(frame_count).copy_to(output[channel].span().slice(quantum_frame, frame_count));
+            }
+            quantum_frame += frame_count;
+        });
+
+        frame += block_length;
+        m_rendered_frame_count.store(frame, AK::MemoryOrder::memory_order_release);
+    }
+}
+
+}
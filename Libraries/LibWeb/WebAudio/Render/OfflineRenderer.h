@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/AtomicRefCounted.h>
+#include <AK/FixedArray.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Span.h>
+#include <LibWeb/WebAudio/ControlMessageQueue.h>
+#include <LibWeb/WebAudio/Render/AudioBus.h>
+#include <LibWeb/WebAudio/Render/RenderGraph.h>
+
+namespace Web::WebAudio::Render {
+
+// Renders the graph of an OfflineAudioContext as fast as it can, rather than at the pace of an output device.
+class OfflineRenderer : public AtomicRefCounted<OfflineRenderer> {
+public:
+    static NonnullRefPtr<OfflineRenderer> create(NonnullRefPtr<ControlMessageQueue>, NodeID destination_id, float sample_rate);
+
+    // Renders as many sample-frames as the output channels are long. The channels must all have the same length and
+    // start out zeroed. This runs on the rendering thread.
+    void render(Span<FixedArray<float>> output);
+
+    // The number of sample-frames the graph has rendered so far. Safe to call from any thread.
+    u64 rendered_frame_count() const { return m_rendered_frame_count.load(AK::MemoryOrder::memory_order_acquire); }
+
+private:
+    OfflineRenderer(NonnullRefPtr<ControlMessageQueue>, NodeID destination_id, float sample_rate);
+
+    // Render quanta are rendered in blocks, so that independent parts of the graph can each get through a sizeable
+    // amount of work on their own thread before they have to be mixed together.
+    static constexpr size_t quanta_per_block = 64;
+
+    NonnullRefPtr<ControlMessageQueue> m_control_message_queue;
+    RenderGraph m_graph;
+    float m_sample_rate { 0 };
+    Atomic<u64> m_rendered_frame_count { 0 };
+
+    // The destination's output mixed to the output's channel count, for when the two differ.
+    AudioBus m_output_bus;
+};
+
+}
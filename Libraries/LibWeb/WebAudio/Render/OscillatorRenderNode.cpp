@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <LibWeb/WebAudio/OscillatorNode.h>
+#include <LibWeb/WebAudio/Render/OscillatorRenderNode.h>
+
+namespace Web::WebAudio::Render {
+
+OscillatorRenderNode::OscillatorRenderNode(OscillatorNode const& node)
+    : ScheduledSourceRenderNode(node, 1)
+    , m_frequency(*node.frequency())
+    , m_detune(*node.detune())
+    , m_type(node.type())
+{
+    register_param(m_frequency);
+    register_param(m_detune);
+}
+
+OscillatorRenderNode::~OscillatorRenderNode() = default;
+
+// The phase is in [0, 1). Every built-in waveform starts at zero and rises, matching the sine terms of the Fourier
+// series the specification defines them by.
+// FIXME: The built-in waveforms are not band-limited, so high frequencies alias.
+float OscillatorRenderNode::sample_at_phase(double phase) const
+{
+    auto x = static_cast<float>(phase);
+    switch (m_type) {
+    case Bindings::OscillatorType::Sine:
+        return AK::sin(2 * AK::Pi<float> * x);
+    case Bindings::OscillatorType::Square:
+        return x < 0.5f ? 1.0f : -1.0f;
+    case Bindings::OscillatorType::Sawtooth:
+        return x < 0.5f ? 2 * x : 2 * x - 2;
+    case Bindings::OscillatorType::Triangle:
+        if (x < 0.25f)
+            return 4 * x;
+        if (x < 0.75f)
+            return 2 - 4 * x;
+        return 4 * x - 4;
+    case Bindings::OscillatorType::Custom: {
+        if (m_wave_table.is_empty())
+            return 0;
+        auto position = x * m_wave_table.size();
+        auto index = static_cast<size_t>(position) % m_wave_table.size();
+        auto next_index = (index + 1) % m_wave_table.size();
+        auto fraction = position - AK::floor(position);
+        return m_wave_table[index] + (m_wave_table[next_index] - m_wave_table[index]) * fraction;
+    }
+    }
+    VERIFY_NOT_REACHED();
+}
+
+bool OscillatorRenderNode::render(RenderContext const& context, size_t first_frame, size_t end_frame)
+{
+    auto samples = output(0).channel(0);
+    bool frequency_is_constant = m_frequency.is_constant() && m_detune.is_constant();
+
+    // https://webaudio.github.io/web-audio-api/#dom-oscillatornode-frequency
+    // computedOscFrequency(t) = frequency(t) * pow(2, detune(t) / 1200)
+    auto computed_frequency = [&](size_t frame) {
+        return static_cast<double>(m_frequency.value_at(frame)) * AK::pow(2.0, static_cast<double>(m_detune.value_at(frame)) / 1200);
+    };
+
+    auto phase_increment = frequency_is_constant ? computed_frequency(0) / context.sample_rate : 0;
+    for (size_t frame = first_frame; frame < end_frame; ++frame) {
+        if (!frequency_is_constant)
+            phase_increment = computed_frequency(frame) / context.sample_rate;
+        samples[frame] = sample_at_phase(m_phase);
+        m_phase += phase_increment;
+        m_phase -= AK::floor(m_phase);
+    }
+    return true;
+}
+
+}
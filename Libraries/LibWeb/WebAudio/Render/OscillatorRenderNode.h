@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Vector.h>
+#include <LibWeb/Bindings/OscillatorNode.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/WebAudio/Render/RenderParam.h>
+#include <LibWeb/WebAudio/Render/ScheduledSourceRenderNode.h>
+
+namespace Web::WebAudio::Render {
+
+// https://webaudio.github.io/web-audio-api/#OscillatorNode
+class OscillatorRenderNode final : public ScheduledSourceRenderNode {
+public:
+    explicit OscillatorRenderNode(OscillatorNode const&);
+    virtual ~OscillatorRenderNode() override;
+
+    // The wave table is one period of a custom waveform, sampled on the control thread from a PeriodicWave.
+    void set_type(Bindings::OscillatorType type) { m_type = type; }
+    void set_wave_table(Vector<float> wave_table) { m_wave_table = move(wave_table); }
+
+private:
+    virtual bool render(RenderContext const&, size_t first_frame, size_t end_frame) override;
+
+    float sample_at_phase(double phase) const;
+
+    RenderParam m_frequency;
+    RenderParam m_detune;
+    Bindings::OscillatorType m_type;
+    Vector<float> m_wave_table;
+    double m_phase { 0 };
+};
+
+}
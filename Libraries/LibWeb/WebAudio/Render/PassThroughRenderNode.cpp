@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/WebAudio/Render/PassThroughRenderNode.h>
+
+namespace Web::WebAudio::Render {
+
+PassThroughRenderNode::PassThroughRenderNode(AudioNode const& node, size_t number_of_inputs, size_t number_of_outputs)
+    : RenderNode(node, number_of_inputs, number_of_outputs)
+{
+}
+
+PassThroughRenderNode::~PassThroughRenderNode() = default;
+
+void PassThroughRenderNode::process(RenderContext const&)
+{
+    if (number_of_outputs() == 0)
+        return;
+
+    if (number_of_inputs() > 0)
+        pass_through(0, 0);
+    else
+        output(0).zero(1);
+
+    for (size_t i = 1; i < number_of_outputs(); ++i)
+        output(i).zero(1);
+}
+
+}
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/WebAudio/Render/RenderNode.h>
+
+namespace Web::WebAudio::Render {
+
+// The render node for AudioNodes whose processing is not implemented on the rendering thread yet. The first input is
+// copied to the first output, and every other output is silent, so that the rest of the graph keeps producing sound.
+class PassThroughRenderNode final : public RenderNode {
+public:
+    PassThroughRenderNode(AudioNode const&, size_t number_of_inputs, size_t number_of_outputs);
+    virtual ~PassThroughRenderNode() override;
+
+    virtual void process(RenderContext const&) override;
+};
+
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/WebAudio/BaseAudioContext.h>
+#include <LibWeb/WebAudio/Render/Kernels.h>
+#include <LibWeb/WebAudio/Render/RealtimeRenderer.h>
+
+namespace Web::WebAudio::Render {
+
+NonnullRefPtr<RealtimeRenderer> RealtimeRenderer::create(NonnullRefPtr<ControlMessageQueue> control_message_queue, NodeID destination_id, float sample_rate)
+{
+    return adopt_ref(*new RealtimeRenderer(move(control_message_queue), destination_id, sample_rate));
+}
+
+RealtimeRenderer::RealtimeRenderer(NonnullRefPtr<ControlMessageQueue> control_message_queue, NodeID destination_id, float sample_rate)
+    : m_control_message_queue(move(control_message_queue))
+    , m_graph(destination_id)
+    , m_sample_rate(sample_rate)
+{
+}
+
+void RealtimeRenderer::set_output_specification(u32 sample_rate, u32 channel_count)
+{
+    m_output_sample_rate = sample_rate;
+    m_output_channel_count = channel_count;
+    m_output_bus.zero(channel_count);
+    m_previous_frame.resize(channel_count);
+}
+
+// https://webaudio.github.io/web-audio-api/#rendering-loop
+void RealtimeRenderer::render_next_quantum()
+{
+    // 2. Process the control message queue.
+    m_control_message_queue->drain([&](ControlMessage& message) {
+        m_graph.apply(message);
+    });
+
+    auto current_frame = m_rendered_frame_count.load(AK::MemoryOrder::memory_order_relaxed);
+    RenderContext context {
+        .sample_rate = m_sample_rate,
+        .current_frame = current_frame,
+        .current_time = static_cast<double>(current_frame) / m_sample_rate,
+    };
+
+    // 4. Process a render quantum, then mix the destination's output to the device's channel layout.
+    m_output_bus.copy_from(m_graph.render_quantum(context), Bindings::ChannelInterpretation::Speakers);
+
+    // 4.6. Atomically increment [[current frame]] by the render quantum size.
+    m_rendered_frame_count.store(current_frame + RENDER_QUANTUM_SIZE, AK::MemoryOrder::memory_order_release);
+}
+
+ReadonlySpan<float> RealtimeRenderer::render(Span<float> buffer)
+{
+    if (m_output_channel_count == 0)
+        return {};
+
+    auto frame_count = buffer.size() / m_output_channel_count;
+    Vector<ReadonlySpan<float>, BaseAudioContext::MAX_NUMBER_OF_CHANNELS> channels;
+
+    // When the device runs at the context's rate, whole runs of frames are interleaved straight out of each quantum.
+    if (static_cast<float>(m_output_sample_rate) == m_sample_rate) {
+        size_t frames_written = 0;
+        while (frames_written < frame_count) {
+            if (m_output_position >= RENDER_QUANTUM_SIZE) {
+                render_next_quantum();
+                m_output_position = 0;
+            }
+
+            auto first_frame = static_cast<size_t>(m_output_position);
+            auto run_length = min(RENDER_QUANTUM_SIZE - first_frame, frame_count - frames_written);
+            channels.clear_with_capacity();
+            for (size_t channel = 0; channel < m_output_channel_count; ++channel)
+                channels.append(m_output_bus.channel(channel).slice(first_frame, run_length));
+            Kernels::interleave(channels, buffer.slice(frames_written * m_output_channel_count, run_length * m_output_channel_count));
+
+            frames_written += run_length;
+            m_output_position += run_length;
+        }
+        return buffer.trim(frame_count * m_output_channel_count);
+    }
+
+    // Otherwise, resample linearly. Each output frame is interpolated between the two rendered frames around its
+    // position, which delays the output by a single frame but never needs to look ahead into the next quantum.
+    auto step = static_cast<double>(m_sample_rate) / m_output_sample_rate;
+    for (size_t frame = 0; frame < frame_count; ++frame) {
+        while (m_output_position >= RENDER_QUANTUM_SIZE) {
+            for (size_t channel = 0; channel < m_output_channel_count; ++channel)
+                m_previous_frame[channel] = m_output_bus.channel(channel)[RENDER_QUANTUM_SIZE - 1];
+            render_next_quantum();
+            m_output_position -= RENDER_QUANTUM_SIZE;
+        }
+
+        auto index = static_cast<size_t>(m_output_position);
+        auto fraction = static_cast<float>(m_output_position - index);
+        for (size_t channel = 0; channel < m_output_channel_count; ++channel) {
+            auto samples = m_output_bus.channel(channel);
+            auto previous = index == 0 ? m_previous_frame[channel] : samples[index - 1];
+            buffer[frame * m_output_channel_count + channel] = previous + (samples[index] - previous) * fraction;
+        }
+        m_output_position += step;
+    }
+    return buffer.trim(frame_count * m_output_channel_count);
+}
+
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/AtomicRefCounted.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Vector.h>
+#include <LibWeb/WebAudio/ControlMessageQueue.h>
+#include <LibWeb/WebAudio/Render/AudioBus.h>
+#include <LibWeb/WebAudio/Render/RenderGraph.h>
+
+namespace Web::WebAudio::Render {
+
+// Drives a RenderGraph from an audio output device's data requests. Everything except the constructor and
+// set_output_specification() runs on the thread the device requests audio on, which is the rendering thread of the
+// AudioContext.
+class RealtimeRenderer : public AtomicRefCounted<RealtimeRenderer> {
+public:
+    static NonnullRefPtr<RealtimeRenderer> create(NonnullRefPtr<ControlMessageQueue>, NodeID destination_id, float sample_rate);
+
+    // Must be called before the device first requests audio.
+    void set_output_specification(u32 sample_rate, u32 channel_count);
+
+    // Fills the interleaved device buffer, rendering as many quanta as needed, and returns the part that was filled.
+    ReadonlySpan<float> render(Span<float> buffer);
+
+    // The number of sample-frames the graph has rendered so far. Safe to call from any thread.
+    u64 rendered_frame_count() const { return m_rendered_frame_count.load(AK::MemoryOrder::memory_order_acquire); }
+
+private:
+    RealtimeRenderer(NonnullRefPtr<ControlMessageQueue>, NodeID destination_id, float sample_rate);
+
+    void render_next_quantum();
+
+    NonnullRefPtr<ControlMessageQueue> m_control_message_queue;
+    RenderGraph m_graph;
+    float m_sample_rate { 0 };
+    Atomic<u64> m_rendered_frame_count { 0 };
+
+    u32 m_output_sample_rate { 0 };
+    u32 m_output_channel_count { 0 };
+
+    // The current quantum mixed to the device's channel layout, and how far into it the device has consumed, in
+    // frames of the context's sample rate.
+    AudioBus m_output_bus;
+    double m_output_position { RENDER_QUANTUM_SIZE };
+    // The last frame of the previous quantum, which the resampler interpolates from at the start of a new quantum.
+    Vector<float> m_previous_frame;
+};
+
+}
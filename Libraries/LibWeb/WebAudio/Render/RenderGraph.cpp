@@ -0,0 +1,448 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashTable.h>
+#include <AK/TypeCasts.h>
+#include <LibThreading/ThreadPool.h>
+#include <LibWeb/WebAudio/Render/RenderGraph.h>
+#include <LibWeb/WebAudio/Render/RenderParam.h>
+#include <LibWeb/WebAudio/Render/ScheduledSourceRenderNode.h>
+
+namespace Web::WebAudio::Render {
+
+RenderGraph::RenderGraph(NodeID destination_id)
+    : m_destination_id(destination_id)
+{
+}
+
+RenderGraph::~RenderGraph() = default;
+
+RenderNode* RenderGraph::node(NodeID node_id)
+{
+    auto it = m_nodes.find(node_id);
+    if (it == m_nodes.end())
+        return nullptr;
+    return it->value.ptr();
+}
+
+RenderParam* RenderGraph::param(ParamID param_id)
+{
+    auto it = m_params.find(param_id);
+    if (it == m_params.end())
+        return nullptr;
+    return it->value.param;
+}
+
+void RenderGraph::apply(ControlMessage& message)
+{
+    // Messages can refer to nodes and params the rendering thread has never seen, such as params that do not belong
+    // to a node, so anything unknown is ignored.
+    message.visit(
+        [&](StartSource const& start) {
+            if (auto* source = node(start.node_id); source && is<ScheduledSourceRenderNode>(*source))
+                as<ScheduledSourceRenderNode>(*source).start(start.when);
+        },
+        [&](StopSource const& stop) {
+            if (auto* source = node(stop.node_id); source && is<ScheduledSourceRenderNode>(*source))
+                as<ScheduledSourceRenderNode>(*source).stop(stop.when);
+        },
+        [&](CreateRenderNode& create) {
+            add_node(move(create.node));
+        },
+        [&](DestroyRenderNode const& destroy) {
+            if (auto* released = node(destroy.node_id)) {
+                released->release_from_control_thread();
+                m_has_released_nodes = true;
+                collect_released_nodes();
+            }
+        },
+        [&](ConnectNodes const& connect) {
+            Connection connection { connect.source, connect.output, connect.destination, connect.input };
+            if (!m_connections.contains_slow(connection)) {
+                m_connections.append(connection);
+                m_schedule_is_dirty = true;
+            }
+        },
+        [&](DisconnectNodes const& disconnect) {
+            Connection connection { disconnect.source, disconnect.output, disconnect.destination, disconnect.input };
+            if (m_connections.remove_first_matching([&](auto const& existing) { return existing == connection; })) {
+                m_schedule_is_dirty = true;
+                collect_released_nodes();
+            }
+        },
+        [&](ConnectParam const& connect) {
+            ParamConnection connection { connect.source, connect.output, connect.destination };
+            if (!m_param_connections.contains_slow(connection)) {
+                m_param_connections.append(connection);
+                m_schedule_is_dirty = true;
+            }
+        },
+        [&](DisconnectParam const& disconnect) {
+            ParamConnection connection { disconnect.source, disconnect.output, disconnect.destination };
+            if (m_param_connections.remove_first_matching([&](auto const& existing) { return existing == connection; })) {
+                m_schedule_is_dirty = true;
+                collect_released_nodes();
+            }
+        },
+        [&](SetChannelConfiguration const& set) {
+            if (auto* configured = node(set.node_id))
+                configured->set_channel_configuration(set.configuration);
+        },
+        [&](UpdateRenderNode const& update) {
+            if (auto* updated = node(update.node_id))
+                update.update(*updated);
+        },
+        [&](InsertAutomationEvent const& insert) {
+            if (auto* automated = param(insert.param_id))
+                automated->timeline().insert_event(insert.event);
+        },
+        [&](ReplaceAutomationEvent const& replace) {
+            if (auto* automated = param(replace.param_id))
+                automated->timeline().replace_event(replace.event_index, replace.event);
+        },
+        [&](RemoveAutomationEvents const& remove) {
+            if (auto* automated = param(remove.param_id))
+                automated->timeline().remove_events_starting_at(remove.first_event_index);
+        },
+        [&](SetAutomationRate const& set) {
+            if (auto* automated = param(set.param_id))
+                automated->set_automation_rate(set.automation_rate);
+        });
+}
+
+void RenderGraph::add_node(NonnullOwnPtr<RenderNode> node)
+{
+    auto node_id = node->node_id();
+    for (auto* node_param : node->params())
+        m_params.set(node_param->param_id(), { node_param, node_id });
+    m_nodes.set(node_id, move(node));
+    m_schedule_is_dirty = true;
+}
+
+void RenderGraph::remove_node(NodeID node_id)
+{
+    auto removed = m_nodes.take(node_id);
+    VERIFY(removed.has_value());
+
+    for (auto* node_param : (*removed)->params())
+        m_params.remove(node_param->param_id());
+
+    m_connections.remove_all_matching([&](auto const& connection) {
+        return connection.source == node_id || connection.destination == node_id;
+    });
+    m_param_connections.remove_all_matching([&](auto const& connection) {
+        return connection.source == node_id || !m_params.contains(connection.destination);
+    });
+    m_schedule_is_dirty = true;
+}
+
+// A node whose AudioNode is gone can no longer gain connections, so once it has no outgoing connections and is not
+// playing, it can never affect the output again. Removing it can disconnect the nodes feeding it, so this repeats
+// until nothing more can be removed.
+void RenderGraph::collect_released_nodes()
+{
+    if (!m_has_released_nodes)
+        return;
+
+    Vector<NodeID> collectable;
+    while (true) {
+        collectable.clear_with_capacity();
+        bool has_released_nodes = false;
+        for (auto const& [node_id, node] : m_nodes) {
+            if (!node->is_released_by_control_thread())
+                continue;
+            has_released_nodes = true;
+            if (node->is_actively_playing())
+                continue;
+            auto has_outgoing_connection = m_connections.contains([&](auto const& connection) { return connection.source == node_id; })
+                || m_param_connections.contains([&](auto const& connection) { return connection.source == node_id; });
+            if (!has_outgoing_connection)
+                collectable.append(node_id);
+        }
+
+        m_has_released_nodes = has_released_nodes;
+        if (collectable.is_empty())
+            return;
+        for (auto node_id : collectable)
+            remove_node(node_id);
+    }
+}
+
+// https://webaudio.github.io/web-audio-api/#rendering-loop
+// Orders the nodes so that every node comes after all of the nodes feeding its inputs and params.
+// FIXME: The specification allows cycles that contain a DelayNode, by giving the delay a minimum latency of one render
+//        quantum. Every node that is part of a cycle is muted for now.
+void RenderGraph::rebuild_schedule()
+{
+    m_schedule.clear_with_capacity();
+    m_schedule_is_dirty = false;
+    m_partitions_are_dirty = true;
+
+    HashMap<NodeID, size_t> incoming_edge_count;
+    HashMap<NodeID, Vector<NodeID>> successors;
+    for (auto const& it : m_nodes)
+        incoming_edge_count.set(it.key, 0);
+
+    auto add_edge = [&](NodeID source, NodeID destination) {
+        if (!m_nodes.contains(source) || !m_nodes.contains(destination))
+            return;
+        incoming_edge_count.find(destination)->value++;
+        successors.ensure(source).append(destination);
+    };
+    for (auto const& connection : m_connections)
+        add_edge(connection.source, connection.destination);
+    for (auto const& connection : m_param_connections) {
+        if (auto it = m_params.find(connection.destination); it != m_params.end())
+            add_edge(connection.source, it->value.owner);
+    }
+
+    Vector<NodeID> ready;
+    for (auto const& [node_id, count] : incoming_edge_count) {
+        if (count == 0)
+            ready.append(node_id);
+    }
+
+    HashTable<NodeID> scheduled;
+    while (!ready.is_empty()) {
+        auto node_id = ready.take_last();
+        scheduled.set(node_id);
+        m_schedule.append({ .node = node(node_id), .input_sources = {} });
+        if (auto it = successors.find(node_id); it != successors.end()) {
+            for (auto successor : it->value) {
+                if (--incoming_edge_count.find(successor)->value == 0)
+                    ready.append(successor);
+            }
+        }
+    }
+
+    auto output_of = [&](NodeID source, size_t output) -> AudioBus const* {
+        if (!scheduled.contains(source))
+            return nullptr;
+        RenderNode const& source_node = *node(source);
+        if (output >= source_node.number_of_outputs())
+            return nullptr;
+        return &source_node.output(output);
+    };
+
+    for (auto& entry : m_schedule) {
+        entry.input_sources.resize(entry.node->number_of_inputs());
+        for (auto const& connection : m_connections) {
+            if (connection.destination != entry.node->node_id() || connection.input >= entry.input_sources.size())
+                continue;
+            if (auto const* source = output_of(connection.source, connection.output))
+                entry.input_sources[connection.input].append(source);
+        }
+
+        for (auto* node_param : entry.node->params()) {
+            Vector<AudioBus const*> param_inputs;
+            for (auto const& connection : m_param_connections) {
+                if (connection.destination != node_param->param_id())
+                    continue;
+                if (auto const* source = output_of(connection.source, connection.output))
+                    param_inputs.append(source);
+            }
+            node_param->set_inputs(move(param_inputs));
+        }
+    }
+}
+
+// https://webaudio.github.io/web-audio-api/#channel-up-mixing-and-down-mixing
+void RenderGraph::mix_inputs(ScheduledNode& entry)
+{
+    auto& node = *entry.node;
+    auto interpretation = node.channel_configuration().channel_interpretation;
+    for (size_t input = 0; input < entry.input_sources.size(); ++input) {
+        auto const& sources = entry.input_sources[input];
+
+        // An input without any connections is a single silent channel.
+        size_t maximum_channel_count = 1;
+        for (auto const* source : sources)
+            maximum_channel_count = max(maximum_channel_count, source->channel_count());
+
+        auto& bus = node.input_for_mixing(input);
+        bus.zero(node.computed_number_of_channels(maximum_channel_count));
+        for (auto const* source : sources)
+            bus.sum_from(*source, interpretation);
+    }
+}
+
+void RenderGraph::process(ScheduledNode& entry, RenderContext const& context)
+{
+    mix_inputs(entry);
+    for (auto* node_param : entry.node->params())
+        node_param->compute_values(context);
+    entry.node->process(context);
+}
+
+AudioBus const& RenderGraph::render_quantum(RenderContext const& context)
+{
+    if (m_schedule_is_dirty)
+        rebuild_schedule();
+
+    AudioBus const* destination_output = nullptr;
+    for (auto& entry : m_schedule) {
+        process(entry, context);
+
+        if (entry.node->node_id() == m_destination_id) {
+            RenderNode const& destination = *entry.node;
+            destination_output = &destination.output(0);
+        }
+    }
+
+    // Sources that have just finished playing may have been the last thing keeping a released node alive.
+    collect_released_nodes();
+    if (m_schedule_is_dirty)
+        rebuild_schedule();
+
+    if (!destination_output) {
+        m_silence.set_silent();
+        return m_silence;
+    }
+    return *destination_output;
+}
+
+// Groups the scheduled nodes other than the destination into partitions that have no connections between them. Since
+// each partition only meets the others at the destination's input, the partitions can render independently.
+void RenderGraph::rebuild_partitions()
+{
+    m_partitions.clear_with_capacity();
+    m_destination_schedule_index = {};
+    m_partitions_are_dirty = false;
+
+    HashMap<NodeID, size_t> schedule_index;
+    for (size_t i = 0; i < m_schedule.size(); ++i)
+        schedule_index.set(m_schedule[i].node->node_id(), i);
+
+    auto destination_index = schedule_index.get(m_destination_id);
+    if (!destination_index.has_value())
+        return;
+
+    // Summing the partitions separately is only equivalent to mixing all of the destination's inputs at once if the
+    // destination's channel count does not depend on what is connected to it, and if nothing reads from it.
+    RenderNode const& destination = *m_schedule[*destination_index].node;
+    if (destination.channel_configuration().channel_count_mode != Bindings::ChannelCountMode::Explicit
+        || destination.number_of_inputs() != 1 || !destination.params().is_empty())
+        return;
+    if (m_connections.contains([&](auto const& connection) { return connection.source == m_destination_id; })
+        || m_param_connections.contains([&](auto const& connection) { return connection.source == m_destination_id; }))
+        return;
+
+    Vector<size_t> parent;
+    parent.resize(m_schedule.size());
+    for (size_t i = 0; i < parent.size(); ++i)
+        parent[i] = i;
+
+    auto find_root = [&](size_t index) {
+        while (parent[index] != index) {
+            parent[index] = parent[parent[index]];
+            index = parent[index];
+        }
+        return index;
+    };
+
+    auto join = [&](NodeID from, NodeID to) {
+        if (from == m_destination_id || to == m_destination_id)
+            return;
+        auto from_index = schedule_index.get(from);
+        auto to_index = schedule_index.get(to);
+        if (from_index.has_value() && to_index.has_value())
+            parent[find_root(*from_index)] = find_root(*to_index);
+    };
+
+    for (auto const& connection : m_connections)
+        join(connection.source, connection.destination);
+    for (auto const& connection : m_param_connections) {
+        if (auto it = m_params.find(connection.destination); it != m_params.end())
+            join(connection.source, it->value.owner);
+    }
+
+    HashMap<size_t, size_t> partition_for_root;
+    for (size_t i = 0; i < m_schedule.size(); ++i) {
+        if (i == *destination_index)
+            continue;
+        auto partition_index = partition_for_root.ensure(find_root(i), [&] {
+            m_partitions.append({});
+            return m_partitions.size() - 1;
+        });
+        m_partitions[partition_index].entries.append(i);
+    }
+
+    for (auto const& connection : m_connections) {
+        if (connection.destination != m_destination_id || connection.input != 0)
+            continue;
+        auto source_index = schedule_index.get(connection.source);
+        if (!source_index.has_value())
+            continue;
+        RenderNode const& source = *m_schedule[*source_index].node;
+        if (connection.output >= source.number_of_outputs())
+            continue;
+        auto partition_index = partition_for_root.get(find_root(*source_index));
+        m_partitions[*partition_index].destination_sources.append(&source.output(connection.output));
+    }
+
+    m_destination_schedule_index = destination_index;
+}
+
+void RenderGraph::render_block(RenderContext const& context, size_t quantum_count, Function<void(AudioBus const&)> const& on_quantum_rendered)
+{
+    if (m_schedule_is_dirty)
+        rebuild_schedule();
+    if (m_partitions_are_dirty)
+        rebuild_partitions();
+
+    auto context_for_quantum = [&](size_t quantum) {
+        auto current_frame = context.current_frame + quantum * RENDER_QUANTUM_SIZE;
+        return RenderContext {
+            .sample_rate = context.sample_rate,
+            .current_frame = current_frame,
+            .current_time = static_cast<double>(current_frame) / context.sample_rate,
+        };
+    };
+
+    // Handing the work to other threads only pays off if there is more than one independent part to render.
+    if (!m_destination_schedule_index.has_value() || m_partitions.size() < 2) {
+        for (size_t quantum = 0; quantum < quantum_count; ++quantum)
+            on_quantum_rendered(render_quantum(context_for_quantum(quantum)));
+        return;
+    }
+
+    auto& destination = *m_schedule[*m_destination_schedule_index].node;
+    auto channel_count = destination.channel_configuration().channel_count;
+    auto interpretation = destination.channel_configuration().channel_interpretation;
+
+    auto render_partition = [&](size_t partition_index) {
+        auto& partition = m_partitions[partition_index];
+        if (partition.destination_input.size() < quantum_count)
+            partition.destination_input.resize(quantum_count);
+
+        for (size_t quantum = 0; quantum < quantum_count; ++quantum) {
+            auto quantum_context = context_for_quantum(quantum);
+            for (auto entry_index : partition.entries)
+                process(m_schedule[entry_index], quantum_context);
+
+            auto& bus = partition.destination_input[quantum];
+            bus.zero(channel_count);
+            for (auto const* source : partition.destination_sources)
+                bus.sum_from(*source, interpretation);
+        }
+    };
+    Threading::ThreadPool::the().parallel_for(m_partitions.size(), render_partition, Threading::TaskPriority::UserVisible);
+
+    for (size_t quantum = 0; quantum < quantum_count; ++quantum) {
+        auto& input = destination.input_for_mixing(0);
+        input.zero(channel_count);
+        for (auto const& partition : m_partitions)
+            input.sum_from(partition.destination_input[quantum], interpretation);
+        destination.process(context_for_quantum(quantum));
+
+        RenderNode const& rendered = destination;
+        on_quantum_rendered(rendered.output(0));
+    }
+
+    collect_released_nodes();
+}
+
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibWeb/WebAudio/ControlMessage.h>
+#include <LibWeb/WebAudio/Render/AudioBus.h>
+#include <LibWeb/WebAudio/Render/RenderNode.h>
+#include <LibWeb/WebAudio/Types.h>
+
+namespace Web::WebAudio::Render {
+
+// The rendering thread's view of an audio graph. It is built up entirely from control messages, and renders one
+// quantum at a time by processing its nodes in topological order.
+// https://webaudio.github.io/web-audio-api/#rendering-loop
+class RenderGraph {
+public:
+    explicit RenderGraph(NodeID destination_id);
+    ~RenderGraph();
+
+    void apply(ControlMessage&);
+
+    // Renders one render quantum and returns the output of the destination node.
+    AudioBus const& render_quantum(RenderContext const&);
+
+    // Renders quantum_count consecutive render quanta starting at the given context, and hands the destination's output
+    // for each of them to the callback in order. Parts of the graph that only meet at the destination are rendered
+    // concurrently, each working through the whole block before the destination mixes them together.
+    void render_block(RenderContext const&, size_t quantum_count, Function<void(AudioBus const&)> const& on_quantum_rendered);
+
+private:
+    struct Connection {
+        NodeID source;
+        size_t output;
+        NodeID destination;
+        size_t input;
+
+        bool operator==(Connection const&) const = default;
+    };
+
+    struct ParamConnection {
+        NodeID source;
+        size_t output;
+        ParamID destination;
+
+        bool operator==(ParamConnection const&) const = default;
+    };
+
+    struct RegisteredParam {
+        RenderParam* param;
+        NodeID owner;
+    };
+
+    struct ScheduledNode {
+        RenderNode* node;
+        // The outputs feeding each input of the node.
+        Vector<Vector<AudioBus const*, 1>, 1> input_sources;
+    };
+
+    // A set of scheduled nodes that is connected to the rest of the graph only through the destination's input.
+    struct Partition {
+        // Indices into the schedule, in schedule order.
+        Vector<size_t> entries;
+        // The outputs of this partition's nodes that are connected to the destination.
+        Vector<AudioBus const*> destination_sources;
+        // This partition's contribution to the destination's input, for each quantum of the current block.
+        Vector<AudioBus> destination_input;
+    };
+
+    void add_node(NonnullOwnPtr<RenderNode>);
+    void remove_node(NodeID);
+    void collect_released_nodes();
+    void rebuild_schedule();
+    void rebuild_partitions();
+    void mix_inputs(ScheduledNode&);
+    void process(ScheduledNode&, RenderContext const&);
+
+    RenderNode* node(NodeID);
+    RenderParam* param(ParamID);
+
+    NodeID m_destination_id;
+    HashMap<NodeID, NonnullOwnPtr<RenderNode>> m_nodes;
+    HashMap<ParamID, RegisteredParam> m_params;
+    Vector<Connection> m_connections;
+    Vector<ParamConnection> m_param_connections;
+
+    Vector<ScheduledNode> m_schedule;
+    bool m_schedule_is_dirty { false };
+
+    Vector<Partition> m_partitions;
+    Optional<size_t> m_destination_schedule_index;
+    bool m_partitions_are_dirty { true };
+    bool m_has_released_nodes { false };
+
+    AudioBus m_silence { 2 };
+};
+
+}
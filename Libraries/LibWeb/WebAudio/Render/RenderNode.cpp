@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/WebAudio/AudioNode.h>
+#include <LibWeb/WebAudio/Render/RenderNode.h>
+
+namespace Web::WebAudio::Render {
+
+RenderNode::RenderNode(AudioNode const& node, size_t number_of_inputs, size_t number_of_outputs)
+    : m_node_id(node.node_id())
+    , m_channel_configuration {
+        .channel_count = node.channel_count(),
+        .channel_count_mode = node.channel_count_mode(),
+        .channel_interpretation = node.channel_interpretation(),
+    }
+{
+    for (size_t i = 0; i < number_of_inputs; ++i)
+        m_inputs.append(AudioBus { 1 });
+    for (size_t i = 0; i < number_of_outputs; ++i)
+        m_outputs.append(AudioBus { 1 });
+}
+
+RenderNode::~RenderNode() = default;
+
+// https://webaudio.github.io/web-audio-api/#computednumberofchannels
+size_t RenderNode::computed_number_of_channels(size_t maximum_input_channel_count) const
+{
+    switch (m_channel_configuration.channel_count_mode) {
+    case Bindings::ChannelCountMode::Max:
+        // computedNumberOfChannels is the maximum of the number of channels of all connections to an input.
+        return maximum_input_channel_count;
+    case Bindings::ChannelCountMode::ClampedMax:
+        // computedNumberOfChannels is determined as for "max" and then clamped to a maximum value of the given
+        // channelCount.
+        return min(maximum_input_channel_count, m_channel_configuration.channel_count);
+    case Bindings::ChannelCountMode::Explicit:
+        // computedNumberOfChannels is the exact value as specified by the channelCount.
+        return m_channel_configuration.channel_count;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+void RenderNode::pass_through(size_t input_index, size_t output_index)
+{
+    auto const& source = m_inputs[input_index];
+    auto& destination = m_outputs[output_index];
+    if (source.is_silent()) {
+        destination.zero(source.channel_count());
+        return;
+    }
+    destination.set_channel_count(source.channel_count());
+    for (size_t channel = 0; channel < source.channel_count(); ++channel)
+        source.channel(channel).copy_to(destination.channel(channel));
+    destination.clear_silent_flag();
+}
+
+}
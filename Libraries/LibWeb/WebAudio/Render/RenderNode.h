@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Vector.h>
+#include <LibWeb/Bindings/AudioNode.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/WebAudio/Render/AudioBus.h>
+#include <LibWeb/WebAudio/Types.h>
+
+namespace Web::WebAudio::Render {
+
+struct RenderContext {
+    float sample_rate { 0 };
+    u64 current_frame { 0 };
+    double current_time { 0 };
+};
+
+// https://webaudio.github.io/web-audio-api/#channel-up-mixing-and-down-mixing
+struct ChannelConfiguration {
+    size_t channel_count { 2 };
+    Bindings::ChannelCountMode channel_count_mode { Bindings::ChannelCountMode::Max };
+    Bindings::ChannelInterpretation channel_interpretation { Bindings::ChannelInterpretation::Speakers };
+};
+
+// The rendering thread's counterpart to an AudioNode. Render nodes are created on the control thread, handed to the
+// rendering thread through a control message, and from then on only touched by the rendering thread.
+class RenderNode {
+public:
+    virtual ~RenderNode();
+
+    NodeID node_id() const { return m_node_id; }
+
+    size_t number_of_inputs() const { return m_inputs.size(); }
+    size_t number_of_outputs() const { return m_outputs.size(); }
+
+    // The mixed signal arriving at each input, prepared by the graph before process() is called.
+    AudioBus const& input(size_t index) const { return m_inputs[index]; }
+    AudioBus& input_for_mixing(size_t index) { return m_inputs[index]; }
+    AudioBus const& output(size_t index) const { return m_outputs[index]; }
+
+    ChannelConfiguration const& channel_configuration() const { return m_channel_configuration; }
+    void set_channel_configuration(ChannelConfiguration const& configuration) { m_channel_configuration = configuration; }
+
+    // https://webaudio.github.io/web-audio-api/#computednumberofchannels
+    size_t computed_number_of_channels(size_t maximum_input_channel_count) const;
+
+    Span<RenderParam* const> params() const { return m_params; }
+
+    // Produces one render quantum of output from the current inputs and computed param values.
+    virtual void process(RenderContext const&) = 0;
+
+    // Source nodes stay alive while they are playing even if nothing on the control thread refers to them.
+    virtual bool is_actively_playing() const { return false; }
+
+    virtual bool is_scheduled_source() const { return false; }
+
+    template<typename T>
+    bool fast_is() const = delete;
+
+    // Set once the AudioNode on the control thread has been garbage collected.
+    bool is_released_by_control_thread() const { return m_released_by_control_thread; }
+    void release_from_control_thread() { m_released_by_control_thread = true; }
+
+protected:
+    // Must be called on the control thread.
+    RenderNode(AudioNode const&, size_t number_of_inputs, size_t number_of_outputs);
+
+    AudioBus& output(size_t index) { return m_outputs[index]; }
+
+    void register_param(RenderParam& param) { m_params.append(&param); }
+
+    // Copies the input to the output, or silences the output if the input is silent.
+    void pass_through(size_t input_index, size_t output_index);
+
+private:
+    NodeID m_node_id;
+    ChannelConfiguration m_channel_configuration;
+    Vector<AudioBus, 1> m_inputs;
+    Vector<AudioBus, 1> m_outputs;
+    Vector<RenderParam*> m_params;
+    bool m_released_by_control_thread { false };
+};
+
+}
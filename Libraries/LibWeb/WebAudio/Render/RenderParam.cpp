@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/WebAudio/AudioParam.h>
+#include <LibWeb/WebAudio/Render/Kernels.h>
+#include <LibWeb/WebAudio/Render/RenderNode.h>
+#include <LibWeb/WebAudio/Render/RenderParam.h>
+
+namespace Web::WebAudio::Render {
+
+RenderParam::RenderParam(AudioParam const& param)
+    : m_param_id(param.param_id())
+    , m_timeline(param.timeline())
+    , m_automation_rate(param.automation_rate())
+    , m_min_value(param.min_value())
+    , m_max_value(param.max_value())
+{
+}
+
+// https://webaudio.github.io/web-audio-api/#computation-of-value
+void RenderParam::compute_values(RenderContext const& context)
+{
+    auto is_k_rate = m_automation_rate == Bindings::AutomationRate::KRate;
+    auto time_step = 1.0 / context.sample_rate;
+
+    // 1. paramIntrinsicValue will be calculated at each time, which is either the value set directly to the value
+    //    attribute, or, if there are any automation events with times before or at this time, the value as calculated
+    //    from these events.
+    if (is_k_rate) {
+        m_values.fill(m_timeline.intrinsic_value_at_time(context.current_time));
+        m_is_constant = true;
+    } else if (auto value = m_timeline.constant_value_between(context.current_time, context.current_time + time_step * RENDER_QUANTUM_SIZE); value.has_value()) {
+        m_values.fill(*value);
+        m_is_constant = true;
+    } else {
+        m_timeline.fill_intrinsic_values(context.current_time, time_step, m_values.span());
+        m_is_constant = false;
+    }
+
+    // 2. Set [[current value]] to the value of paramIntrinsicValue at the beginning of this render quantum.
+    // FIXME: Report [[current value]] back to the control thread.
+
+    // 3. paramComputedValue is the sum of the paramIntrinsicValue value and the value of the input AudioParam buffer.
+    //    If the sum is NaN, replace the sum with the defaultValue.
+    if (!m_inputs.is_empty()) {
+        m_input_mix.zero(1);
+        for (auto const* input : m_inputs)
+            m_input_mix.sum_from(*input, Bindings::ChannelInterpretation::Speakers);
+
+        if (!m_input_mix.is_silent()) {
+            if (is_k_rate) {
+                auto sum = m_values[0] + m_input_mix.channel(0)[0];
+                m_values.fill(isnan(sum) ? m_timeline.default_value() : sum);
+            } else {
+                Kernels::add(m_input_mix.channel(0), m_values.span());
+                for (auto& value : m_values) {
+                    if (isnan(value))
+                        value = m_timeline.default_value();
+                }
+                m_is_constant = false;
+            }
+        }
+    }
+
+    // 4. Clamp paramComputedValue to the simple nominal range.
+    Kernels::clamp(m_values.span(), m_min_value, m_max_value);
+}
+
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Vector.h>
+#include <LibWeb/Bindings/AudioParam.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/WebAudio/AudioParamTimeline.h>
+#include <LibWeb/WebAudio/Render/AudioBus.h>
+#include <LibWeb/WebAudio/Types.h>
+
+namespace Web::WebAudio::Render {
+
+struct RenderContext;
+
+// The rendering thread's copy of an AudioParam. Its timeline is only ever touched by the rendering thread; the
+// control thread keeps it in sync by queueing the same edits it makes to its own timeline.
+class RenderParam {
+public:
+    // Must be called on the control thread.
+    explicit RenderParam(AudioParam const&);
+
+    ParamID param_id() const { return m_param_id; }
+
+    AudioParamTimeline& timeline() { return m_timeline; }
+    void set_automation_rate(Bindings::AutomationRate automation_rate) { m_automation_rate = automation_rate; }
+
+    // Outputs of other nodes that are connected to this param.
+    void set_inputs(Vector<AudioBus const*> inputs) { m_inputs = move(inputs); }
+
+    // https://webaudio.github.io/web-audio-api/#computation-of-value
+    void compute_values(RenderContext const&);
+
+    // The computed value for each frame of the current render quantum.
+    ReadonlySpan<float> values() const { return m_values.span(); }
+    float value_at(size_t frame) const { return m_values[frame]; }
+
+    // True if every frame of the current render quantum has the same computed value.
+    bool is_constant() const { return m_is_constant; }
+
+private:
+    ParamID m_param_id;
+    AudioParamTimeline m_timeline;
+    Bindings::AutomationRate m_automation_rate;
+    float m_min_value { 0 };
+    float m_max_value { 0 };
+
+    Vector<AudioBus const*> m_inputs;
+    AudioBus m_input_mix { 1 };
+
+    Array<float, RENDER_QUANTUM_SIZE> m_values {};
+    bool m_is_constant { true };
+};
+
+}
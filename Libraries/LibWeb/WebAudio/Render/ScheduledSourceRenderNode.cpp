@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <LibWeb/WebAudio/Render/ScheduledSourceRenderNode.h>
+
+namespace Web::WebAudio::Render {
+
+ScheduledSourceRenderNode::ScheduledSourceRenderNode(AudioNode const& node, size_t number_of_outputs)
+    : RenderNode(node, 0, number_of_outputs)
+{
+}
+
+ScheduledSourceRenderNode::~ScheduledSourceRenderNode() = default;
+
+bool ScheduledSourceRenderNode::is_actively_playing() const
+{
+    return m_start_time.has_value() && !m_has_ended;
+}
+
+void ScheduledSourceRenderNode::process(RenderContext const& context)
+{
+    auto& bus = output(0);
+    if (!m_start_time.has_value() || m_has_ended) {
+        bus.zero(1);
+        return;
+    }
+
+    // Convert the scheduled times into frame offsets within this render quantum. Times in the past start or stop the
+    // source immediately.
+    auto frame_offset_for_time = [&](double time) -> i64 {
+        return static_cast<i64>(ceil(time * context.sample_rate)) - static_cast<i64>(context.current_frame);
+    };
+
+    auto first_frame = clamp<i64>(frame_offset_for_time(*m_start_time), 0, RENDER_QUANTUM_SIZE);
+    auto end_frame = static_cast<i64>(RENDER_QUANTUM_SIZE);
+    if (m_stop_time.has_value())
+        end_frame = clamp<i64>(frame_offset_for_time(max(*m_stop_time, *m_start_time)), 0, RENDER_QUANTUM_SIZE);
+
+    if (first_frame >= static_cast<i64>(RENDER_QUANTUM_SIZE)) {
+        bus.zero(1);
+        return;
+    }
+
+    bus.zero(output_channel_count());
+    if (first_frame < end_frame) {
+        if (!render(context, first_frame, end_frame))
+            m_has_ended = true;
+        bus.clear_silent_flag();
+    }
+
+    if (end_frame < static_cast<i64>(RENDER_QUANTUM_SIZE))
+        m_has_ended = true;
+}
+
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <LibWeb/WebAudio/Render/RenderNode.h>
+
+namespace Web::WebAudio::Render {
+
+// Shared start and stop handling for the render nodes of AudioScheduledSourceNodes.
+// https://webaudio.github.io/web-audio-api/#AudioScheduledSourceNode
+class ScheduledSourceRenderNode : public RenderNode {
+public:
+    virtual ~ScheduledSourceRenderNode() override;
+
+    void start(double when) { m_start_time = when; }
+    void stop(double when) { m_stop_time = when; }
+
+    virtual bool is_actively_playing() const override;
+    virtual bool is_scheduled_source() const override { return true; }
+
+    virtual void process(RenderContext const&) override final;
+
+protected:
+    ScheduledSourceRenderNode(AudioNode const&, size_t number_of_outputs);
+
+    // Renders frames [first_frame, end_frame) of the current quantum into the output. Frames outside of that range have
+    // already been zeroed. Returns false once the source has nothing left to play, which ends it early.
+    virtual bool render(RenderContext const&, size_t first_frame, size_t end_frame) = 0;
+
+    // The number of channels the source outputs while it is playing.
+    virtual size_t output_channel_count() const { return 1; }
+
+    // The context time at which playback began, used by sources that need to know how far into playback they are.
+    double start_time() const { return m_start_time.value_or(0); }
+
+private:
+    Optional<double> m_start_time;
+    Optional<double> m_stop_time;
+    bool m_has_ended { false };
+};
+
+template<>
+inline bool RenderNode::fast_is<ScheduledSourceRenderNode>() const { return is_scheduled_source(); }
+
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <LibWeb/WebAudio/Render/Kernels.h>
+#include <LibWeb/WebAudio/Render/StereoPannerRenderNode.h>
+#include <LibWeb/WebAudio/StereoPannerNode.h>
+
+namespace Web::WebAudio::Render {
+
+StereoPannerRenderNode::StereoPannerRenderNode(StereoPannerNode const& node)
+    : RenderNode(node, 1, 1)
+    , m_pan(*node.pan())
+{
+    register_param(m_pan);
+}
+
+StereoPannerRenderNode::~StereoPannerRenderNode() = default;
+
+struct PanGains {
+    float left;
+    float right;
+};
+
+// https://webaudio.github.io/web-audio-api/#stereopanner-algorithm
+static PanGains gains_for_pan(float pan, bool input_is_mono)
+{
+    // 3. For mono input, x = (pan + 1) / 2. For stereo input, x = pan + 1 if pan <= 0 and x = pan otherwise.
+    float x;
+    if (input_is_mono)
+        x = (pan + 1) / 2;
+    else
+        x = pan <= 0 ? pan + 1 : pan;
+
+    // 4. gainL = cos(x * pi / 2) and gainR = sin(x * pi / 2).
+    auto angle = x * AK::Pi<float> / 2;
+    return { AK::cos(angle), AK::sin(angle) };
+}
+
+void StereoPannerRenderNode::process(RenderContext const&)
+{
+    auto const& source = input(0);
+    auto& destination = output(0);
+    if (source.is_silent()) {
+        destination.zero(2);
+        return;
+    }
+
+    // The input has been mixed to at most two channels by the fixed channel count and clamped-max mode.
+    destination.set_channel_count(2);
+    destination.clear_silent_flag();
+    auto left = destination.channel(0);
+    auto right = destination.channel(1);
+    bool input_is_mono = source.channel_count() == 1;
+
+    if (m_pan.is_constant()) {
+        auto pan = m_pan.value_at(0);
+        auto gains = gains_for_pan(pan, input_is_mono);
+        if (input_is_mono) {
+            Kernels::multiply(source.channel(0), gains.left, left);
+            Kernels::multiply(source.channel(0), gains.right, right);
+        } else if (pan <= 0) {
+            // outputL = inputL + inputR * gainL, outputR = inputR * gainR
+            source.channel(0).copy_to(left);
+            Kernels::add_scaled(source.channel(1), gains.left, left);
+            Kernels::multiply(source.channel(1), gains.right, right);
+        } else {
+            // outputL = inputL * gainL, outputR = inputR + inputL * gainR
+            Kernels::multiply(source.channel(0), gains.left, left);
+            source.channel(1).copy_to(right);
+            Kernels::add_scaled(source.channel(0), gains.right, right);
+        }
+        return;
+    }
+
+    for (size_t frame = 0; frame < RENDER_QUANTUM_SIZE; ++frame) {
+        auto pan = m_pan.value_at(frame);
+        auto gains = gains_for_pan(pan, input_is_mono);
+        if (input_is_mono) {
+            auto sample = source.channel(0)[frame];
+            left[frame] = sample * gains.left;
+            right[frame] = sample * gains.right;
+        } else {
+            auto sample_left = source.channel(0)[frame];
+            auto sample_right = source.channel(1)[frame];
+            if (pan <= 0) {
+                left[frame] = sample_left + sample_right * gains.left;
+                right[frame] = sample_right * gains.right;
+            } else {
+                left[frame] = sample_left * gains.left;
+                right[frame] = sample_right + sample_left * gains.right;
+            }
+        }
+    }
+}
+
+}
@@ -8,6 +8,7 @@
 #include <LibWeb/WebAudio/AudioNode.h>
 #include <LibWeb/WebAudio/AudioParam.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
+#include <LibWeb/WebAudio/Render/StereoPannerRenderNode.h>
 #include <LibWeb/WebAudio/StereoPannerNode.h>
 
 namespace Web::WebAudio {
@@ -70,6 +71,11 @@ StereoPannerNode::StereoPannerNode(JS::Realm& realm, GC::Ref<BaseAudioContext> c
 {
 }
 
+OwnPtr<Render::RenderNode> StereoPannerNode::create_render_node()
+{
+    return make<Render::StereoPannerRenderNode>(*this);
+}
+
 void StereoPannerNode::initialize(JS::Realm& realm)
 {
     WEB_SET_PROTOTYPE_FOR_INTERFACE(StereoPannerNode);
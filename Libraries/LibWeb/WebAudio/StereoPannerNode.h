@@ -35,6 +35,7 @@ protected:
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
+    virtual OwnPtr<Render::RenderNode> create_render_node() override;
 
 private:
     // https://webaudio.github.io/web-audio-api/#dom-stereopannernode-pan
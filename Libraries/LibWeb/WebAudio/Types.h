@@ -13,4 +13,7 @@ namespace Web::WebAudio {
 // Stable identifier for AudioNode instances within a BaseAudioContext.
 AK_TYPEDEF_DISTINCT_NUMERIC_GENERAL(u64, NodeID, CastToUnderlying);
 
+// Stable identifier for AudioParam instances within a BaseAudioContext.
+AK_TYPEDEF_DISTINCT_NUMERIC_GENERAL(u64, ParamID, CastToUnderlying);
+
 }
@@ -47,6 +47,12 @@ static Response deserialize_as_ladybird_capability(StringView name, JsonValue va
                 MUST(String::formatted("Extension capability {} must be a boolean", name)));
     }
 
+    if (name == "ladybird:screenshotCompressionLevel"sv) {
+        if (auto level = value.get_u32(); !level.has_value() || *level > 9)
+            return Error::from_code(ErrorCode::InvalidArgument,
+                MUST(String::formatted("Extension capability {} must be an integer between 0 and 9", name)));
+    }
+
     return value;
 }
 
@@ -444,6 +450,8 @@ LadybirdOptions::LadybirdOptions(JsonObject const& capabilities)
         this->headless = *headless;
     if (auto enable_test_hooks = capabilities.get_bool("ladybird:enableTestHooks"sv); enable_test_hooks.has_value())
         this->enable_test_hooks = *enable_test_hooks;
+    if (auto screenshot_compression_level = capabilities.get_u32("ladybird:screenshotCompressionLevel"sv); screenshot_compression_level.has_value())
+        this->screenshot_compression_level = static_cast<u8>(*screenshot_compression_level);
 }
 
 }
@@ -8,6 +8,7 @@
 
 #include <AK/EnumBits.h>
 #include <AK/Forward.h>
+#include <AK/Optional.h>
 #include <AK/StringView.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/WebDriver/Response.h>
@@ -49,6 +50,9 @@ struct WEB_API LadybirdOptions {
 
     bool headless { false };
     bool enable_test_hooks { false };
+
+    // The zlib compression level of PNG screenshots, from 0 (fastest) to 9 (smallest).
+    Optional<u8> screenshot_compression_level;
 };
 
 WEB_API Response process_capabilities(JsonValue const& parameters, SessionFlags flags);
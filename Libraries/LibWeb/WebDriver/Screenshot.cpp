@@ -4,28 +4,24 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Base64.h>
+#include <LibCore/EventLoop.h>
 #include <LibGfx/Bitmap.h>
+#include <LibGfx/ImageFormats/PNGWriter.h>
 #include <LibGfx/PaintingSurface.h>
+#include <LibThreading/ThreadPool.h>
 #include <LibWeb/DOM/Document.h>
-#include <LibWeb/DOM/ElementFactory.h>
 #include <LibWeb/HTML/BrowsingContext.h>
-#include <LibWeb/HTML/CanvasRenderingContext2D.h>
-#include <LibWeb/HTML/HTMLCanvasElement.h>
-#include <LibWeb/HTML/ImageBitmap.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/LocalTraversableNavigable.h>
-#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
-#include <LibWeb/HTML/TagNames.h>
-#include <LibWeb/Namespace.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/WebDriver/Screenshot.h>
 
 namespace Web::WebDriver {
 
 // https://w3c.github.io/webdriver/#dfn-draw-a-bounding-box-from-the-framebuffer
-ErrorOr<GC::Ref<HTML::HTMLCanvasElement>, WebDriver::Error> draw_bounding_box_from_the_framebuffer(HTML::BrowsingContext& browsing_context, DOM::Element& element, Gfx::IntRect rect)
+ErrorOr<NonnullRefPtr<Gfx::Bitmap>, WebDriver::Error> draw_bounding_box_from_the_framebuffer(HTML::BrowsingContext& browsing_context, Gfx::IntRect rect)
 {
-    HTML::TemporaryExecutionContext execution_context { element.realm() };
-
     // 1. If either the initial viewport's width or height is 0 CSS pixels, return error with error code unable to capture screen.
     auto viewport_rect = browsing_context.top_level_traversable()->viewport_rect();
     if (viewport_rect.is_empty())
@@ -39,16 +35,19 @@ ErrorOr<GC::Ref<HTML::HTMLCanvasElement>, WebDriver::Error> draw_bounding_box_fr
     // 3. Let paint height be the initial viewport's height – min(rectangle y coordinate, rectangle y coordinate + rectangle height dimension).
     auto paint_height = viewport_device_rect.height() - min(rect.y(), rect.y() + rect.height());
 
-    // 4. Let canvas be a new canvas element, and set its width and height to paint width and paint height, respectively.
-    auto canvas_element = DOM::create_element(element.document(), HTML::TagNames::canvas, Namespace::HTML).release_value_but_fixme_should_propagate_errors();
-    auto& canvas = as<HTML::HTMLCanvasElement>(*canvas_element);
+    // NB: The encoding steps reject a canvas without any pixels. Without a canvas, that is checked here instead.
+    if (paint_width <= 0 || paint_height <= 0)
+        return Error::from_code(ErrorCode::UnableToCaptureScreen, "Captured screenshot is empty"sv);
 
+    // 4. Let canvas be a new canvas element, and set its width and height to paint width and paint height, respectively.
+    // 5. Let context, a canvas context mode, be the result of invoking the 2D context creation algorithm given canvas as the target.
+    // OPTIMIZATION: The canvas would only be read back again to encode it, so the framebuffer is drawn straight into a
+    //               bitmap of the same size instead.
     // FIXME: Handle DevicePixelRatio in HiDPI mode.
-    canvas.set_width(paint_width);
-    canvas.set_height(paint_height);
-
-    // FIXME: 5. Let context, a canvas context mode, be the result of invoking the 2D context creation algorithm given canvas as the target.
-    MUST(canvas.create_2d_context({}));
+    auto bitmap_or_error = Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, Gfx::IntSize { paint_width, paint_height });
+    if (bitmap_or_error.is_error())
+        return Error::from_code(ErrorCode::UnableToCaptureScreen, "Failed to allocate the screenshot"sv);
+    auto bitmap = bitmap_or_error.release_value();
 
     // 6. Complete implementation specific steps equivalent to drawing the region of the framebuffer specified by the following coordinates onto context:
     //    - X coordinate: rectangle x coordinate
@@ -57,7 +56,6 @@ ErrorOr<GC::Ref<HTML::HTMLCanvasElement>, WebDriver::Error> draw_bounding_box_fr
     //    - Height: paint height
     Gfx::IntRect paint_rect { rect.x(), rect.y(), paint_width, paint_height };
 
-    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, Gfx::IntSize { paint_width, paint_height }));
     auto painting_surface = Gfx::PaintingSurface::wrap_bitmap(bitmap);
     IGNORE_USE_IN_ESCAPING_LAMBDA bool did_paint = false;
     HTML::PaintConfig paint_config { .canvas_fill_rect = paint_rect };
@@ -68,39 +66,43 @@ ErrorOr<GC::Ref<HTML::HTMLCanvasElement>, WebDriver::Error> draw_bounding_box_fr
         return did_paint;
     }));
 
-    auto image_bitmap = HTML::ImageBitmap::create(element.realm());
-    image_bitmap->set_bitmap(bitmap);
-    if (canvas.canvas_rendering_context_2d()->draw_image(image_bitmap, 0, 0).is_exception())
-        return Error::from_code(ErrorCode::UnableToCaptureScreen, "Failed to draw the screenshot to the canvas"sv);
-
     // 7. Return success with canvas.
-    return canvas;
+    return bitmap;
 }
 
 // https://w3c.github.io/webdriver/#dfn-encoding-a-canvas-as-base64
-Response encode_canvas_element(HTML::HTMLCanvasElement& canvas)
+void encode_screenshot_as_base64(NonnullRefPtr<Gfx::Bitmap> bitmap, Optional<u8> compression_level, Function<void(Response)>&& on_complete)
 {
     // 1. If the canvas element’s bitmap’s origin-clean flag is set to false, return error with error code unable to capture screen.
-    if (!canvas.is_origin_clean())
-        return Error::from_code(ErrorCode::UnableToCaptureScreen, "Canvas is not origin-clean"sv);
-
     // 2. If the canvas element’s bitmap has no pixels (i.e. either its horizontal dimension or vertical dimension is zero) then return error with error code unable to capture screen.
-    if (!canvas.canvas_surface_content_size().has_value())
-        return Error::from_code(ErrorCode::UnableToCaptureScreen, "Captured screenshot is empty"sv);
-
-    // 3. Let file be a serialization of the canvas element’s bitmap as a file, using "image/png" as an argument.
-    // 4. Let data url be a data: URL representing file. [RFC2397]
-    auto data_url = MUST(canvas.to_data_url("image/png"sv, JS::js_undefined()));
-
-    // 5. Let index be the index of "," in data url.
-    auto index = data_url.utf16_view().find_code_unit_offset(',');
-    VERIFY(index.has_value());
-
-    // 6. Let encoded string be a substring of data url using (index + 1) as the start argument.
-    auto encoded_string = MUST(data_url.utf16_view().substring_view(*index + 1).to_utf8());
-
-    // 7. Return success with data encoded string.
-    return JsonValue { move(encoded_string) };
+    // NB: Only the framebuffer is ever drawn into the bitmap, which is clean, and empty bitmaps were rejected when drawing it.
+
+    auto& event_loop = Core::EventLoop::current();
+
+    // NB: Encoding a page sized PNG takes long enough to hold up the page, so it is done on the thread pool.
+    Threading::ThreadPool::the().submit([bitmap = move(bitmap), compression_level, on_complete = move(on_complete), &event_loop] mutable {
+        auto encode = [&]() -> Response {
+            // 3. Let file be a serialization of the canvas element’s bitmap as a file, using "image/png" as an argument.
+            auto file = Gfx::PNGWriter::encode(*bitmap, { .compression_level = compression_level });
+            if (file.is_error())
+                return Error::from_code(ErrorCode::UnableToCaptureScreen, "Failed to encode the screenshot"sv);
+
+            // 4. Let data url be a data: URL representing file. [RFC2397]
+            // 5. Let index be the index of "," in data url.
+            // 6. Let encoded string be a substring of data url using (index + 1) as the start argument.
+            // NB: That substring is the Base64 encoding of file, so this skips building the data URL.
+            auto encoded_string = encode_base64(file.value().bytes());
+            if (encoded_string.is_error())
+                return Error::from_code(ErrorCode::UnableToCaptureScreen, "Failed to encode the screenshot"sv);
+
+            // 7. Return success with data encoded string.
+            return JsonValue { encoded_string.release_value() };
+        };
+
+        event_loop.deferred_invoke([on_complete = move(on_complete), response = encode()] mutable {
+            on_complete(move(response));
+        });
+    });
 }
 
 }
@@ -6,7 +6,10 @@
 
 #pragma once
 
-#include <LibGC/Ptr.h>
+#include <AK/Function.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Optional.h>
+#include <LibGfx/Forward.h>
 #include <LibGfx/Rect.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/Forward.h>
@@ -14,7 +17,10 @@
 
 namespace Web::WebDriver {
 
-WEB_API ErrorOr<GC::Ref<HTML::HTMLCanvasElement>, WebDriver::Error> draw_bounding_box_from_the_framebuffer(HTML::BrowsingContext&, DOM::Element&, Gfx::IntRect);
-WEB_API Response encode_canvas_element(HTML::HTMLCanvasElement&);
+WEB_API ErrorOr<NonnullRefPtr<Gfx::Bitmap>, WebDriver::Error> draw_bounding_box_from_the_framebuffer(HTML::BrowsingContext&, Gfx::IntRect);
+
+// Encodes the screenshot on the thread pool, and invokes the callback with the result on the calling thread's event
+// loop. A compression level from 0 (fastest) to 9 (smallest) overrides the PNG encoder's default.
+WEB_API void encode_screenshot_as_base64(NonnullRefPtr<Gfx::Bitmap>, Optional<u8> compression_level, Function<void(Response)>&& on_complete);
 
 }
@@ -70,10 +70,18 @@ void WebGLContextProxyBase::record_bytes(WebGLCommandType type, ReadonlyBytes pa
     auto record_size = WebGLCommandList::padded_record_size(payload, inline_data);
 
     if (record_size > data_region.size()) {
+        // Commands too large for the shared buffer (typically a big bufferData() or texImage2D() upload) get a
+        // dedicated anonymous buffer that is handed over as-is, so the data is only copied once, straight out of
+        // the caller's ArrayBuffer.
         flush_commands();
-        WebGLCommandList oversized_command_list;
-        oversized_command_list.append_bytes(type, payload, inline_data);
-        m_transport->send_commands(oversized_command_list.buffer(), {});
+        auto oversized_commands_or_error = Core::AnonymousBuffer::create_with_size(record_size);
+        if (oversized_commands_or_error.is_error()) {
+            set_lost();
+            return;
+        }
+        auto oversized_commands = oversized_commands_or_error.release_value();
+        WebGLCommandList::write_record({ oversized_commands.data<u8>(), oversized_commands.size() }, type, payload, inline_data);
+        m_transport->send_commands(oversized_commands, {});
         return;
     }
 
@@ -136,7 +144,9 @@ void WebGLContextProxyBase::flush_commands()
 
     if (m_out_of_line_commands.is_empty())
         return;
-    m_transport->send_commands(m_out_of_line_commands.buffer(), m_pending_bitmaps);
+    auto commands = MUST(Core::AnonymousBuffer::create_with_size(m_out_of_line_commands.size_in_bytes()));
+    m_out_of_line_commands.buffer().bytes().copy_to({ commands.data<u8>(), commands.size() });
+    m_transport->send_commands(commands, m_pending_bitmaps);
     m_out_of_line_commands.clear_with_capacity();
     m_pending_bitmaps.clear_with_capacity();
 }
@@ -387,7 +387,7 @@ void WebSocket::on_message(ByteBuffer message, bool is_text)
         return;
 
     // When a WebSocket message has been received with type type and data data, the user agent must queue a task to follow these steps:
-    HTML::queue_a_task(HTML::Task::Source::WebSocket, nullptr, nullptr, GC::create_function(heap(), [this, message = move(message), is_text] {
+    HTML::queue_a_task(HTML::Task::Source::WebSocket, nullptr, nullptr, GC::create_function(heap(), [this, message = move(message), is_text]() mutable {
         if (is_text) {
             Bindings::MessageEventInit event_init;
             event_init.data = JS::PrimitiveString::create(vm(), Utf16String::from_utf8(StringView { ReadonlyBytes(message) }));
@@ -398,13 +398,13 @@ void WebSocket::on_message(ByteBuffer message, bool is_text)
         if (m_binary_type == "blob"sv) {
             // type indicates that the data is Binary and binaryType is "blob"
             Bindings::MessageEventInit event_init;
-            event_init.data = FileAPI::Blob::create(realm(), message, "text/plain;charset=utf-8"_utf16);
+            event_init.data = FileAPI::Blob::create(realm(), move(message), "text/plain;charset=utf-8"_utf16);
             dispatch_event(HTML::MessageEvent::create(realm(), HTML::EventNames::message, event_init, m_url.origin()));
             return;
         } else if (m_binary_type == "arraybuffer"sv) {
             // type indicates that the data is Binary and binaryType is "arraybuffer"
             Bindings::MessageEventInit event_init;
-            event_init.data = JS::ArrayBuffer::create(realm(), message);
+            event_init.data = JS::ArrayBuffer::create(realm(), move(message));
             dispatch_event(HTML::MessageEvent::create(realm(), HTML::EventNames::message, event_init, m_url.origin()));
             return;
         }
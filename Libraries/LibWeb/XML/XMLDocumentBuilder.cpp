@@ -52,9 +52,9 @@ XMLDocumentBuilder::XMLDocumentBuilder(DOM::Document& document, XMLScriptingSupp
     m_namespace_stack.append({ {}, 1 });
 }
 
-ErrorOr<void> XMLDocumentBuilder::set_source(ByteString source)
+ErrorOr<void> XMLDocumentBuilder::set_source(StringView source)
 {
-    m_document->set_source(Utf16String::from_utf8_with_replacement_character(source.view()));
+    m_document->set_source(Utf16String::from_utf8_with_replacement_character(source));
     return {};
 }
 
@@ -86,6 +86,8 @@ void XMLDocumentBuilder::set_doctype(XML::Doctype doctype)
 
 void XMLDocumentBuilder::element_start(Utf16FlyString const& name, Vector<XML::ListenerAttribute> const& attributes)
 {
+    flush_pending_text();
+
     if (m_has_error)
         return;
 
@@ -194,6 +196,8 @@ void XMLDocumentBuilder::element_start(Utf16FlyString const& name, Vector<XML::L
 
 void XMLDocumentBuilder::element_end(Utf16FlyString const& name)
 {
+    flush_pending_text();
+
     if (m_has_error)
         return;
 
@@ -254,20 +258,37 @@ void XMLDocumentBuilder::text(StringView data)
     if (m_has_error)
         return;
 
+    // OPTIMIZATION: Appending every chunk to a text node would copy its data over and over again, which is quadratic for
+    //               large runs of character data. Instead, convert the whole run once when it ends.
+    m_pending_text.append(data);
+}
+
+void XMLDocumentBuilder::flush_pending_text()
+{
+    if (m_pending_text.is_empty())
+        return;
+
+    auto data = Utf16String::from_utf8(m_pending_text.string_view());
+    m_pending_text.clear();
+    if (m_has_error || !m_current_node)
+        return;
+
     if (auto* last = m_current_node->last_child(); last && last->is_text()) {
         auto& text_node = static_cast<DOM::Text&>(*last);
-        m_text_builder.append(text_node.data());
-        m_text_builder.append(Utf16String::from_utf8(data));
-        text_node.set_data(m_text_builder.to_string());
-        m_text_builder.clear();
-    } else if (!data.is_empty()) {
-        auto node = m_document->create_text_node(Utf16String::from_utf8(data));
+        Utf16StringBuilder builder;
+        builder.append(text_node.data());
+        builder.append(data);
+        text_node.set_data(builder.to_string());
+    } else {
+        auto node = m_document->create_text_node(move(data));
         MUST(m_current_node->append_child(node));
     }
 }
 
 void XMLDocumentBuilder::comment(StringView data)
 {
+    flush_pending_text();
+
     if (m_has_error || !m_current_node)
         return;
 
@@ -276,6 +297,8 @@ void XMLDocumentBuilder::comment(StringView data)
 
 void XMLDocumentBuilder::cdata_section(StringView data)
 {
+    flush_pending_text();
+
     if (m_has_error || !m_current_node)
         return;
 
@@ -285,6 +308,8 @@ void XMLDocumentBuilder::cdata_section(StringView data)
 
 void XMLDocumentBuilder::processing_instruction(Utf16FlyString const& target, Utf16String const& data)
 {
+    flush_pending_text();
+
     if (m_has_error || !m_current_node)
         return;
 
@@ -294,6 +319,8 @@ void XMLDocumentBuilder::processing_instruction(Utf16FlyString const& target, Ut
 
 void XMLDocumentBuilder::document_end()
 {
+    flush_pending_text();
+
     auto& heap = m_document->heap();
 
     // When an XML parser reaches the end of its input, it must stop parsing.
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/StringBuilder.h>
 #include <AK/Utf16FlyString.h>
 #include <AK/Utf16StringBuilder.h>
 #include <LibWeb/DOM/Comment.h>
@@ -31,7 +32,7 @@ public:
     bool has_error() const { return m_has_error; }
 
 private:
-    virtual ErrorOr<void> set_source(ByteString) override;
+    virtual ErrorOr<void> set_source(StringView) override;
     virtual void set_doctype(XML::Doctype) override;
     virtual void element_start(Utf16FlyString const& name, Vector<XML::ListenerAttribute> const& attributes) override;
     virtual void element_end(Utf16FlyString const& name) override;
@@ -41,6 +42,8 @@ private:
     virtual void processing_instruction(Utf16FlyString const& target, Utf16String const& data) override;
     virtual void document_end() override;
 
+    void flush_pending_text();
+
     struct NamespaceAndPrefix {
         Utf16FlyString ns;
         Optional<Utf16FlyString> prefix;
@@ -53,7 +56,9 @@ private:
     GC::Ptr<DOM::Node> m_current_node;
     XMLScriptingSupport m_scripting_support { XMLScriptingSupport::Enabled };
     bool m_has_error { false };
-    Utf16StringBuilder m_text_builder;
+
+    // Character data arrives in small chunks, so it is collected here until the next node is created.
+    StringBuilder m_pending_text;
 
     struct NamespaceStackEntry {
         Vector<NamespaceAndPrefix, 2> namespaces;
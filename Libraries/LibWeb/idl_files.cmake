@@ -399,6 +399,7 @@ libweb_js_bindings(Internals/WebUI)
 libweb_js_bindings(Internals/XRTest)
 libweb_js_bindings(IntersectionObserver/IntersectionObserver)
 libweb_js_bindings(IntersectionObserver/IntersectionObserverEntry)
+libweb_js_bindings(LongAnimationFrames/PerformanceLongAnimationFrameTiming)
 libweb_js_bindings(MathML/MathMLAnchorElement)
 libweb_js_bindings(MathML/MathMLElement)
 libweb_js_bindings(MediaCapabilitiesAPI/MediaCapabilities)
@@ -430,6 +431,7 @@ libweb_js_bindings(ResizeObserver/ResizeObserver)
 libweb_js_bindings(ResizeObserver/ResizeObserverEntry)
 libweb_js_bindings(ResizeObserver/ResizeObserverSize)
 libweb_js_bindings(ResourceTiming/PerformanceResourceTiming)
+libweb_js_bindings(Scheduling/Scheduler)
 libweb_js_bindings(Selection/Selection)
 libweb_js_bindings(Serial/Serial)
 libweb_js_bindings(Serial/SerialPort)
@@ -19,14 +19,17 @@
 #include <LibCore/StandardPaths.h>
 #include <LibCore/System.h>
 #include <LibCore/TimeZoneWatcher.h>
+#include <LibCrypto/Hash/SHA2.h>
 #include <LibDatabase/Database.h>
 #include <LibDevTools/DevToolsServer.h>
 #include <LibFileSystem/FileSystem.h>
+#include <LibIPC/Tracing.h>
 #include <LibIPC/TransportHandle.h>
 #include <LibImageDecoderClient/Client.h>
 #include <LibURL/InternalURLs.h>
 #include <LibURL/Parser.h>
 #include <LibWeb/CSS/PropertyID.h>
+#include <LibWeb/Loader/ContentBlocker.h>
 #include <LibWeb/Loader/DownloadFilename.h>
 #include <LibWeb/Loader/UserAgent.h>
 #include <LibWeb/Page/InputEvent.h>
@@ -39,6 +42,7 @@
 #include <LibWebView/HelperProcess.h>
 #include <LibWebView/HistoryStore.h>
 #include <LibWebView/Menu.h>
+#include <LibWebView/PageLoadBenchmark.h>
 #include <LibWebView/ProcessType.h>
 #include <LibWebView/SiteIsolation.h>
 #include <LibWebView/URL.h>
@@ -167,7 +171,7 @@ Application::~Application()
     if (m_compositor_client)
         m_compositor_client->on_death = nullptr;
 
-    m_spare_web_content_process = nullptr;
+    m_spare_web_content_processes.clear();
     m_process_manager = nullptr;
     m_browser_process = nullptr;
 
@@ -243,6 +247,8 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     Optional<int> window_height;
     Optional<u32> screenshot_delay;
     Optional<StringView> screenshot_path;
+    Optional<u32> benchmark_iterations;
+    Optional<u64> memory_budget;
     bool new_window = false;
     bool force_new_process = false;
     Optional<StringView> profile_name;
@@ -271,6 +277,9 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     bool disable_sandbox = false;
     Vector<StringView> content_blocker_list_paths;
     Optional<StringView> resource_substitution_map_path;
+    Optional<StringView> resource_recording_path;
+    Optional<u32> replay_latency_ms;
+    Optional<u64> replay_bandwidth_kbps;
     bool enable_autoplay = false;
     bool expose_experimental_interfaces = false;
     bool expose_internals_object = false;
@@ -288,7 +297,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
 
     args_parser.add_option(Core::ArgsParser::Option {
         .argument_mode = Core::ArgsParser::OptionArgumentMode::Optional,
-        .help_string = "Run Ladybird without a browser window. Mode may be 'screenshot' (default), 'layout-tree', 'text', or 'manual'.",
+        .help_string = "Run Ladybird without a browser window. Mode may be 'screenshot' (default), 'layout-tree', 'text', 'manual', or 'benchmark'.",
         .long_name = "headless",
         .value_name = "mode",
         .accept_value = [&](StringView value) {
@@ -303,6 +312,8 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
                 headless_mode = HeadlessMode::Text;
             else if (value.equals_ignoring_ascii_case("manual"sv))
                 headless_mode = HeadlessMode::Manual;
+            else if (value.equals_ignoring_ascii_case("benchmark"sv))
+                headless_mode = HeadlessMode::Benchmark;
 
             return headless_mode.has_value();
         },
@@ -310,8 +321,10 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
 
     args_parser.add_option(screenshot_delay, "Set the number of seconds to wait before taking a screenshot (only supported for headless screenshot mode)", "screenshot-delay", 0, "seconds");
     args_parser.add_option(screenshot_path, "Save screenshots to the given location (only supported for headless screenshot mode)", "screenshot-path", 0, "path");
+    args_parser.add_option(benchmark_iterations, "Set the number of page loads to measure (default: 5) (only supported for headless benchmark mode)", "benchmark-iterations", 0, "count");
     args_parser.add_option(window_width, "Set viewport width in pixels (default: 800) (currently only supported for headless mode)", "window-width", 0, "pixels");
     args_parser.add_option(window_height, "Set viewport height in pixels (default: 600) (currently only supported for headless mode)", "window-height", 0, "pixels");
+    args_parser.add_option(memory_budget, "Release memory and discard background tabs once all processes use this much memory", "memory-budget", 0, "MiB");
     args_parser.add_option(certificates, "Path to a certificate file", "certificate", 'C', "certificate");
     args_parser.add_option(new_window, "Force opening in a new window", "new-window", 'n');
 #if !defined(AK_OS_ANDROID)
@@ -390,6 +403,9 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     args_parser.add_option(validate_dnssec_locally, "Validate DNSSEC locally", "dnssec");
     args_parser.add_option(default_time_zone, "Default time zone", "default-time-zone", 0, "time-zone-id");
     args_parser.add_option(resource_substitution_map_path, "Path to JSON file mapping URLs to local files", "resource-map", 0, "path");
+    args_parser.add_option(resource_recording_path, "Record network responses into a resource map in the given directory", "record-resources", 0, "path");
+    args_parser.add_option(replay_latency_ms, "Add latency to responses served from the resource map", "replay-latency", 0, "ms");
+    args_parser.add_option(replay_bandwidth_kbps, "Limit the bandwidth of responses served from the resource map", "replay-bandwidth", 0, "kbit/s");
     args_parser.add_option(Core::ArgsParser::Option {
         .argument_mode = Core::ArgsParser::OptionArgumentMode::Required,
         .help_string = "Dump style invalidation counters from WebContent after every N style invalidations",
@@ -569,6 +585,10 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
         m_browser_options.screenshot_delay = *screenshot_delay;
     if (screenshot_path.has_value())
         m_browser_options.screenshot_path = *screenshot_path;
+    if (benchmark_iterations.has_value())
+        m_browser_options.benchmark_iterations = *benchmark_iterations;
+    if (memory_budget.has_value())
+        m_browser_options.memory_budget_in_bytes = *memory_budget * MiB;
     if (window_width.has_value())
         m_browser_options.window_width = *window_width;
     if (window_height.has_value())
@@ -586,6 +606,9 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
         .cache_path = profile().paths().cache,
         .http_disk_cache_mode = http_disk_cache_mode,
         .resource_substitution_map_path = resource_substitution_map_path.has_value() ? Optional<ByteString> { *resource_substitution_map_path } : OptionalNone {},
+        .resource_recording_path = resource_recording_path.has_value() ? Optional<ByteString> { *resource_recording_path } : OptionalNone {},
+        .replay_latency_ms = replay_latency_ms.value_or(0),
+        .replay_bandwidth_kbps = replay_bandwidth_kbps,
     };
 
     m_web_content_options = {
@@ -652,24 +675,65 @@ ErrorOr<void> Application::load_content_blocker_lists()
     if (total_size.has_overflow())
         return Error::from_string_literal("Content blocker lists are too large");
 
-    auto blocker_list_buffer = TRY(Core::AnonymousBuffer::create_with_size(total_size.value()));
-    auto bytes = Bytes { blocker_list_buffer.data<u8>(), blocker_list_buffer.size() };
+    auto rules = TRY(ByteBuffer::create_uninitialized(total_size.value()));
     size_t offset = 0;
 
     for (auto const& path : m_browser_options.content_blocker_list_paths) {
         auto file = TRY(Core::File::open(path, Core::File::OpenMode::Read));
         auto file_size = TRY(file->size());
-        TRY(file->read_until_filled(bytes.slice(offset, file_size)));
+        TRY(file->read_until_filled(rules.bytes().slice(offset, file_size)));
         offset += file_size;
-        bytes[offset++] = '\n';
+        rules[offset++] = '\n';
     }
-    VERIFY(offset == bytes.size());
+    VERIFY(offset == rules.size());
 
+    // Every WebContent process would otherwise parse the lists from scratch, so they are handed a snapshot of the
+    // parsed engine instead. The snapshot is kept on disk alongside a digest of the lists it was created from.
+    auto snapshot = load_content_blocker_snapshot(rules);
+    auto blocker_list = snapshot.has_value() ? snapshot->bytes() : rules.bytes();
+
+    auto blocker_list_buffer = TRY(Core::AnonymousBuffer::create_with_size(blocker_list.size()));
+    blocker_list.copy_to(Bytes { blocker_list_buffer.data<u8>(), blocker_list_buffer.size() });
     m_content_blocker_list_buffer = move(blocker_list_buffer);
 
     return {};
 }
 
+Optional<ByteBuffer> Application::load_content_blocker_snapshot(ReadonlyBytes rules)
+{
+    auto snapshot_path = LexicalPath::join(profile().paths().cache, "ContentBlocker.snapshot"sv).string();
+    auto rules_digest = Crypto::Hash::SHA256::hash(rules.data(), rules.size());
+    auto digest_size = rules_digest.bytes().size();
+
+    if (auto file = Core::File::open(snapshot_path, Core::File::OpenMode::Read); !file.is_error()) {
+        if (auto contents = file.value()->read_until_eof(); !contents.is_error() && contents.value().size() > digest_size) {
+            auto cached_snapshot = contents.value().bytes().slice(digest_size);
+
+            if (contents.value().bytes().trim(digest_size) == rules_digest.bytes() && Web::ContentBlocker::is_compatible_snapshot(cached_snapshot)) {
+                if (auto snapshot = ByteBuffer::copy(cached_snapshot); !snapshot.is_error())
+                    return snapshot.release_value();
+            }
+        }
+    }
+
+    auto snapshot = Web::ContentBlocker::create_snapshot(rules);
+    if (snapshot.is_error()) {
+        warnln("Unable to create content blocker snapshot: {}", snapshot.error());
+        return {};
+    }
+
+    auto write_snapshot = [&]() -> ErrorOr<void> {
+        auto file = TRY(Core::File::open(snapshot_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+        TRY(file->write_until_depleted(rules_digest.bytes()));
+        TRY(file->write_until_depleted(snapshot.value().bytes()));
+        return {};
+    };
+    if (auto result = write_snapshot(); result.is_error())
+        warnln("Unable to write content blocker snapshot to {}: {}", snapshot_path, result.error());
+
+    return snapshot.release_value();
+}
+
 void Application::open_url_in_new_tab(URL::URL const& url, Web::HTML::ActivateTab activate_tab) const
 {
     if (auto view = open_blank_new_tab(activate_tab); view.has_value())
@@ -967,15 +1031,14 @@ ErrorOr<NonnullRefPtr<WebContentClient>> Application::launch_web_content_process
     if (view.is_private() == IsPrivate::Yes)
         return create_web_content_client(view, IsPrivate::Yes, allocate_page_id());
 
-    if (m_spare_web_content_process) {
-        auto web_content_client = m_spare_web_content_process.release_nonnull();
-        launch_spare_web_content_process();
+    auto spare_web_content_process = take_spare_web_content_process();
+    launch_spare_web_content_processes();
 
-        web_content_client->assign_view({}, view);
-        return web_content_client;
+    if (spare_web_content_process.has_value()) {
+        (*spare_web_content_process)->assign_view({}, view);
+        return spare_web_content_process.release_value();
     }
 
-    launch_spare_web_content_process();
     return create_web_content_client(view, IsPrivate::No, allocate_page_id());
 }
 
@@ -989,7 +1052,31 @@ ErrorOr<Application::ChildFrameWebContentProcess> Application::launch_child_fram
     };
 }
 
-void Application::launch_spare_web_content_process()
+Optional<NonnullRefPtr<WebContentClient>> Application::take_spare_web_content_process()
+{
+    static constexpr auto burst_interval = AK::Duration::from_seconds(5);
+
+    // Opening tabs in quick succession (e.g. restoring a session, or opening a bookmark folder) grows the pool. Once the
+    // requests slow down, the pool is only topped back up to a single spare process.
+    auto now = MonotonicTime::now_coarse();
+    if (m_last_spare_web_content_process_request_time.has_value() && now - *m_last_spare_web_content_process_request_time < burst_interval)
+        m_spare_web_content_process_target = min(m_spare_web_content_process_target + 1, MAX_SPARE_WEB_CONTENT_PROCESSES);
+    else
+        m_spare_web_content_process_target = 1;
+    m_last_spare_web_content_process_request_time = now;
+
+    while (!m_spare_web_content_processes.is_empty()) {
+        auto web_content_client = m_spare_web_content_processes.take_first();
+
+        // A spare process may have crashed or been terminated while it was waiting to be used.
+        if (web_content_client->is_open())
+            return web_content_client;
+    }
+
+    return {};
+}
+
+void Application::launch_spare_web_content_processes()
 {
     // Spare WebContent processes inherit the active WebDriver endpoint, but they are not part of the
     // session and can race browser shutdown while bootstrapping.
@@ -1003,10 +1090,15 @@ void Application::launch_spare_web_content_process()
     if (browser_options().profile_helper_process == ProcessType::WebContent)
         return;
 
+    if (m_spare_web_content_processes.size() >= m_spare_web_content_process_target)
+        return;
+
     if (m_has_queued_task_to_launch_spare_web_content_process)
         return;
     m_has_queued_task_to_launch_spare_web_content_process = true;
 
+    // Processes are launched one per event loop iteration, so that replenishing the pool does not hold up input
+    // handling or painting in the UI process.
     Core::deferred_invoke([this]() {
         m_has_queued_task_to_launch_spare_web_content_process = false;
 
@@ -1016,10 +1108,11 @@ void Application::launch_spare_web_content_process()
             return;
         }
 
-        m_spare_web_content_process = web_content_client.release_value();
-
-        if (auto process = find_process(m_spare_web_content_process->pid()); process.has_value())
+        if (auto process = find_process(web_content_client.value()->pid()); process.has_value())
             process->set_title("(spare)"_utf16);
+
+        m_spare_web_content_processes.append(web_content_client.release_value());
+        launch_spare_web_content_processes();
     });
 }
 
@@ -1033,6 +1126,14 @@ ErrorOr<void> Application::launch_services()
         process_did_exit(move(process), exit_status);
     };
 
+    // Test runs should not behave differently depending on how much memory the machine running them has left.
+    if (m_browser_options.headless_mode != HeadlessMode::Test) {
+        m_process_manager->on_memory_pressure = [this](Web::MemoryPressureLevel level) {
+            handle_memory_pressure(level);
+        };
+        m_process_manager->start_monitoring_memory_pressure(m_browser_options.memory_budget_in_bytes);
+    }
+
     Optional<ByteString> history_database_directory;
 
     if (m_browser_options.disable_sql_database == DisableSQLDatabase::No) {
@@ -1398,16 +1499,30 @@ static void load_page_and_exit_on_close(Core::EventLoop& event_loop, HeadlessWeb
     view.load(url);
 }
 
+static NonnullOwnPtr<PageLoadBenchmark> run_page_load_benchmark_and_exit(Core::EventLoop& event_loop, Core::AnonymousBuffer theme, Web::DevicePixelSize viewport_size, URL::URL const& url, u32 iterations)
+{
+    auto benchmark = PageLoadBenchmark::create(move(theme), viewport_size, url, iterations);
+
+    benchmark->on_complete = [&event_loop](JsonObject results) {
+        outln("{}", results.serialized());
+        event_loop.quit(0);
+    };
+
+    benchmark->start();
+    return benchmark;
+}
+
 ErrorOr<int> Application::execute()
 {
     OwnPtr<HeadlessWebView> view;
     RefPtr<Core::Timer> screenshot_timer;
+    OwnPtr<PageLoadBenchmark> benchmark;
 
     if (m_browser_options.headless_mode.has_value()) {
         auto theme_path = LexicalPath::join(WebView::s_ladybird_resource_root, "themes"sv, "Default.ini"sv);
         auto theme = TRY(Gfx::load_system_theme(theme_path.string()));
 
-        view = HeadlessWebView::create(move(theme), { m_browser_options.window_width, m_browser_options.window_height });
+        view = HeadlessWebView::create(theme, { m_browser_options.window_width, m_browser_options.window_height });
 
         if (!m_browser_options.webdriver_endpoint.has_value()) {
             if (m_browser_options.urls.size() != 1)
@@ -1426,6 +1541,9 @@ ErrorOr<int> Application::execute()
             case HeadlessMode::Manual:
                 load_page_and_exit_on_close(*m_event_loop, *view, m_browser_options.urls.first());
                 break;
+            case HeadlessMode::Benchmark:
+                benchmark = run_page_load_benchmark_and_exit(*m_event_loop, move(theme), { m_browser_options.window_width, m_browser_options.window_height }, m_browser_options.urls.first(), m_browser_options.benchmark_iterations);
+                break;
             case HeadlessMode::Test:
                 VERIFY_NOT_REACHED();
             }
@@ -1464,6 +1582,19 @@ Optional<Process&> Application::find_process(pid_t pid)
     return m_process_manager->find_process(pid);
 }
 
+void Application::handle_memory_pressure(Web::MemoryPressureLevel level)
+{
+    ViewImplementation::for_each_view([&](ViewImplementation& view) {
+        view.discard_if_idle_in_background(level);
+        return IterationDecision::Continue;
+    });
+
+    WebContentClient::for_each_client([&](WebContentClient& client) {
+        client.async_handle_memory_pressure(level);
+        return IterationDecision::Continue;
+    });
+}
+
 void Application::process_did_exit(Process&& process, Optional<int> exit_status)
 {
 #if defined(AK_OS_WINDOWS)
@@ -1963,6 +2094,10 @@ void Application::initialize_actions()
     m_debug_menu->add_action(Action::create("Dump Local Storage"sv, ActionID::DumpLocalStorage, debug_request("dump-local-storage"sv)));
     m_debug_menu->add_action(Action::create("Dump Session Storage"sv, ActionID::DumpSessionStorage, debug_request("dump-session-storage"sv)));
     m_debug_menu->add_action(Action::create("Dump WASM Stats"sv, ActionID::DumpWasmStats, debug_request("dump-wasm-stats"sv)));
+    m_debug_menu->add_action(Action::create("Dump IPC Traces"sv, ActionID::DumpIPCTraces, [dump_web_content_traces = debug_request("dump-ipc-traces"sv)]() {
+        IPC::MessageTracing::dump();
+        dump_web_content_traces();
+    }));
     m_debug_menu->add_action(Action::create("Dump GC graph"sv, ActionID::DumpGCGraph, [this]() {
         if (auto view = active_web_view(); view.has_value()) {
             auto gc_graph_path = view->dump_gc_graph();
@@ -1982,6 +2117,11 @@ void Application::initialize_actions()
 
     m_show_caret_hit_test_debug_overlay_action = Action::create_checkable("Show Caret Hit Test Debug Overlay"sv, ActionID::ShowCaretHitTestDebugOverlay, check(m_show_caret_hit_test_debug_overlay_action, "set-caret-hit-test-debug-overlay"sv));
     m_debug_menu->add_action(*m_show_caret_hit_test_debug_overlay_action);
+
+    m_profile_wasm_action = Action::create_checkable("Profile WASM"sv, ActionID::ProfileWasm, check(m_profile_wasm_action, "set-wasm-profiler"sv));
+    m_debug_menu->add_action(*m_profile_wasm_action);
+    m_profile_javascript_action = Action::create_checkable("Profile JavaScript"sv, ActionID::ProfileJavaScript, check(m_profile_javascript_action, "set-js-profiler"sv));
+    m_debug_menu->add_action(*m_profile_javascript_action);
     m_debug_menu->add_separator();
 
     m_debug_menu->add_action(Action::create("Collect Garbage"sv, ActionID::CollectGarbage, debug_request("collect-garbage"sv)));
@@ -2030,6 +2170,8 @@ void Application::apply_view_options(Badge<ViewImplementation>, ViewImplementati
 
     view.debug_request("set-line-box-borders"sv, m_show_line_box_borders_action->checked() ? "on"sv : "off"sv);
     view.debug_request("set-caret-hit-test-debug-overlay"sv, m_show_caret_hit_test_debug_overlay_action->checked() ? "on"sv : "off"sv);
+    view.debug_request("set-wasm-profiler"sv, m_profile_wasm_action->checked() ? "on"sv : "off"sv);
+    view.debug_request("set-js-profiler"sv, m_profile_javascript_action->checked() ? "on"sv : "off"sv);
     view.debug_request("scripting"sv, m_enable_scripting_action->checked() ? "on"sv : "off"sv);
     view.debug_request("content-blocking"sv, m_enable_content_blocking_action->checked() ? "on"sv : "off"sv);
     if (m_content_blocker_list_buffer.has_value())
@@ -2575,6 +2717,38 @@ void Application::inspect_accessibility_tree(DevTools::TabDescription const& des
     view->inspect_accessibility_tree();
 }
 
+void Application::start_sampling_profiler() const
+{
+    auto view = active_web_view();
+    if (!view.has_value())
+        return;
+
+    m_sampling_profiler_view_id = view->view_id();
+    view->start_sampling_profiler();
+}
+
+void Application::stop_sampling_profiler(OnSamplingProfileReceived on_complete) const
+{
+    auto view_id = m_sampling_profiler_view_id;
+    m_sampling_profiler_view_id.clear();
+
+    Optional<ViewImplementation&> view;
+    if (view_id.has_value())
+        view = ViewImplementation::find_view_by_id(*view_id);
+
+    if (!view.has_value()) {
+        on_complete(Error::from_string_literal("Unable to locate the profiled tab"));
+        return;
+    }
+
+    view->on_received_sampling_profile = [&view = *view, on_complete = move(on_complete)](JsonObject profile) {
+        view.on_received_sampling_profile = nullptr;
+        on_complete(move(profile));
+    };
+
+    view->stop_sampling_profiler();
+}
+
 void Application::listen_for_dom_properties(DevTools::TabDescription const& description, OnDOMNodePropertiesReceived on_dom_node_properties_received) const
 {
     auto view = ViewImplementation::find_view_by_id(description.id);
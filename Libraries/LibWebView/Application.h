@@ -11,6 +11,7 @@
 #include <AK/LexicalPath.h>
 #include <AK/NonnullRawPtr.h>
 #include <AK/Optional.h>
+#include <AK/Time.h>
 #include <LibCore/AnonymousBuffer.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/Forward.h>
@@ -310,7 +311,9 @@ private:
     ErrorOr<NonnullRefPtr<WebContentClient>> create_web_content_client(Optional<ViewImplementation&>, IsPrivate, u64 initial_page_id, Optional<Web::HTML::CrossProcessId> root_navigable_id = {});
     PrivateBrowsingSession& ensure_private_browsing_session();
     ErrorOr<void> launch_services();
-    void launch_spare_web_content_process();
+    Optional<NonnullRefPtr<WebContentClient>> take_spare_web_content_process();
+    void launch_spare_web_content_processes();
+    void handle_memory_pressure(Web::MemoryPressureLevel);
     ErrorOr<void> launch_compositor_process();
     void handle_compositor_process_death();
     void recover_compositor_process();
@@ -319,6 +322,7 @@ private:
     ErrorOr<void> launch_image_decoder_server();
     ErrorOr<void> launch_devtools_server();
     ErrorOr<void> load_content_blocker_lists();
+    static Optional<ByteBuffer> load_content_blocker_snapshot(ReadonlyBytes rules);
     ErrorOr<NonnullRawPtr<Core::GeolocationProvider>> ensure_geolocation_provider();
 
     void initialize_actions();
@@ -358,6 +362,8 @@ private:
     virtual void remove_indexed_database_change_listener(DevTools::TabDescription const&, u64) const override;
     virtual void inspect_tab(DevTools::TabDescription const&, OnTabInspectionComplete) const override;
     virtual void inspect_accessibility_tree(DevTools::TabDescription const&, OnAccessibilityTreeInspectionComplete) const override;
+    virtual void start_sampling_profiler() const override;
+    virtual void stop_sampling_profiler(OnSamplingProfileReceived) const override;
     virtual void listen_for_dom_properties(DevTools::TabDescription const&, OnDOMNodePropertiesReceived) const override;
     virtual void stop_listening_for_dom_properties(DevTools::TabDescription const&) const override;
     virtual void inspect_dom_node(DevTools::TabDescription const&, DOMNodeProperties::Type, Web::UniqueNodeID, Optional<Web::CSS::PseudoElement>, JsonObject options = {}) const override;
@@ -438,7 +444,13 @@ private:
     };
     CompositorRecoveryState m_compositor_recovery_state { CompositorRecoveryState::Idle };
 
-    RefPtr<WebContentClient> m_spare_web_content_process;
+    // Spare WebContent processes are launched ahead of time, so that opening a tab does not wait for a process to start.
+    // They are not bound to a site until their first navigation. The pool grows when tabs are opened in quick succession,
+    // and shrinks back as the spare processes are used up once that stops.
+    static constexpr size_t MAX_SPARE_WEB_CONTENT_PROCESSES = 4;
+    Vector<NonnullRefPtr<WebContentClient>> m_spare_web_content_processes;
+    size_t m_spare_web_content_process_target { 1 };
+    Optional<MonotonicTime> m_last_spare_web_content_process_request_time;
     bool m_has_queued_task_to_launch_spare_web_content_process { false };
     u64 m_next_page_or_compositor_context_id { 1 };
     u64 m_next_cross_process_id_namespace { 1 };
@@ -499,6 +511,8 @@ private:
     RefPtr<Menu> m_debug_menu;
     RefPtr<Action> m_show_line_box_borders_action;
     RefPtr<Action> m_show_caret_hit_test_debug_overlay_action;
+    RefPtr<Action> m_profile_wasm_action;
+    RefPtr<Action> m_profile_javascript_action;
     RefPtr<Action> m_enable_scripting_action;
     RefPtr<Action> m_enable_content_blocking_action;
     RefPtr<Action> m_block_pop_ups_action;
@@ -518,6 +532,7 @@ private:
     OwnPtr<DevTools::DevToolsServer> m_devtools;
 
     mutable HashMap<u64, u64> m_navigation_listener_ids;
+    mutable Optional<u64> m_sampling_profiler_view_id;
 };
 
 }
@@ -40,6 +40,7 @@ void CompositorConnection::stop_presenting_to_client(Web::Compositor::Compositor
 
 void CompositorConnection::destroy_context(Web::Compositor::CompositorContextId context_id)
 {
+    m_last_sent_display_lists.remove(context_id);
     if (!can_send_message_to_compositor())
         return;
     async_destroy_context(context_id);
@@ -66,9 +67,18 @@ void CompositorConnection::update_display_list(Web::Compositor::CompositorContex
         }
     }
 
-    auto encoded_message = MUST(Messages::CompositorWebContentServer::UpdateDisplayList::static_encode(context_id, display_list, visual_context_tree, resource_transaction, scroll_state_snapshot));
-    if (post_message(encoded_message).is_error())
+    auto encoded_message = [&] {
+        auto base_display_list = m_last_sent_display_lists.get(context_id);
+        if (!base_display_list.has_value())
+            return MUST(Messages::CompositorWebContentServer::UpdateDisplayList::static_encode(context_id, display_list, visual_context_tree, resource_transaction, scroll_state_snapshot));
+        auto command_bytes_delta = Web::Painting::DisplayListCommandBytesDelta::compute((*base_display_list)->id(), (*base_display_list)->command_bytes(), display_list->command_bytes());
+        return MUST(Messages::CompositorWebContentServer::UpdateDisplayListWithCommandBytesDelta::static_encode(context_id, display_list->with_command_bytes({}), command_bytes_delta, visual_context_tree, resource_transaction, scroll_state_snapshot));
+    }();
+    if (post_message(encoded_message).is_error()) {
         did_lose_compositor();
+        return;
+    }
+    m_last_sent_display_lists.set(context_id, display_list);
 }
 
 void CompositorConnection::update_visual_context_tree(Web::Compositor::CompositorContextId context_id, Web::Painting::AccumulatedVisualContextTree const& visual_context_tree)
@@ -102,12 +112,12 @@ void CompositorConnection::clear_video_frame(Web::Compositor::CompositorContextI
     async_clear_video_frame(context_id, frame_id);
 }
 
-Optional<Web::Painting::CanvasId> CompositorConnection::create_canvas_2d_context(Gfx::IntSize size, bool alpha)
+Optional<Web::Painting::CanvasId> CompositorConnection::create_canvas_2d_context(Gfx::IntSize size, bool alpha, bool will_read_frequently)
 {
     if (!can_send_message_to_compositor())
         return {};
 
-    auto response = send_sync<Messages::CompositorWebContentServer::CreateCanvas2dContext>(size, alpha);
+    auto response = send_sync<Messages::CompositorWebContentServer::CreateCanvas2dContext>(size, alpha, will_read_frequently);
     if (!response->success())
         return {};
     return response->canvas_id();
@@ -254,15 +264,12 @@ bool CompositorConnection::drain_webgl_command_buffer(Web::Painting::CanvasId ca
     return true;
 }
 
-void CompositorConnection::send_webgl_commands(Web::Painting::CanvasId canvas_id, ByteBuffer const& commands, Vector<Gfx::DecodedImageFrame> const& bitmaps)
+void CompositorConnection::send_webgl_commands(Web::Painting::CanvasId canvas_id, Core::AnonymousBuffer const& commands, Vector<Gfx::DecodedImageFrame> const& bitmaps)
 {
     if (!can_send_message_to_compositor())
         return;
 
-    auto shared_commands = MUST(Core::AnonymousBuffer::create_with_size(commands.size()));
-    commands.bytes().copy_to({ shared_commands.data<u8>(), shared_commands.size() });
-
-    auto encoded_message = MUST(Messages::CompositorWebContentServer::WebglCommands::static_encode(canvas_id, shared_commands, bitmaps));
+    auto encoded_message = MUST(Messages::CompositorWebContentServer::WebglCommands::static_encode(canvas_id, commands, bitmaps));
     if (post_message(encoded_message).is_error())
         did_lose_compositor();
 }
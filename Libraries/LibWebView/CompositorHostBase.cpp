@@ -71,7 +71,7 @@ private:
         return m_connection->drain_webgl_command_buffer(*m_canvas_id);
     }
 
-    virtual void send_commands(ByteBuffer const& commands, Vector<Gfx::DecodedImageFrame> const& bitmaps) override
+    virtual void send_commands(Core::AnonymousBuffer const& commands, Vector<Gfx::DecodedImageFrame> const& bitmaps) override
     {
         if (!m_canvas_id.has_value())
             return;
@@ -126,10 +126,10 @@ public:
     }
 
 private:
-    virtual bool create_context(Gfx::IntSize size, bool alpha) override
+    virtual bool create_context(Gfx::IntSize size, bool alpha, bool will_read_frequently) override
     {
         VERIFY(!m_canvas_id.has_value());
-        auto canvas_id = m_connection->create_canvas_2d_context(size, alpha);
+        auto canvas_id = m_connection->create_canvas_2d_context(size, alpha, will_read_frequently);
         if (!canvas_id.has_value())
             return false;
         m_canvas_id = *canvas_id;
@@ -91,13 +91,7 @@ CookieJar::CookieJar(Optional<PersistedStorage> persisted_storage, IsPrivate is_
 
     m_persisted_storage->synchronization_timer = Core::Timer::create_repeating(
         static_cast<int>(DATABASE_SYNCHRONIZATION_TIMER.to_milliseconds()),
-        [this]() {
-            for (auto const& it : m_transient_storage.take_dirty_cookies())
-                m_persisted_storage->insert_cookie(it.value);
-
-            auto now = m_transient_storage.purge_expired_cookies();
-            m_persisted_storage->database.execute_statement(m_persisted_storage->statements.expire_cookie, {}, now);
-        });
+        [this]() { m_persisted_storage->synchronize(m_transient_storage); });
     m_persisted_storage->synchronization_timer->start();
 }
 
@@ -107,7 +101,7 @@ CookieJar::~CookieJar()
         return;
 
     m_persisted_storage->synchronization_timer->stop();
-    m_persisted_storage->synchronization_timer->on_timeout();
+    m_persisted_storage->synchronize(m_transient_storage);
 }
 
 // https://datatracker.ietf.org/doc/html/draft-ietf-httpbis-rfc6265bis-22#section-5.8.3
@@ -560,7 +554,7 @@ Vector<HTTP::Cookie::Cookie> CookieJar::get_matching_cookies(URL::URL const& url
     // 3. Let cookie-list be the set of cookies from the cookie store that meets all of the following requirements:
     Vector<HTTP::Cookie::Cookie> cookie_list;
 
-    m_transient_storage.for_each_cookie([&](HTTP::Cookie::Cookie& cookie) {
+    m_transient_storage.for_each_cookie_with_domain_on_host(*retrieval_host_canonical, [&](HTTP::Cookie::Cookie& cookie) {
         if (!HTTP::Cookie::cookie_matches_url(cookie, url, *retrieval_host_canonical, source))
             return;
 
@@ -609,9 +603,25 @@ CookieJar::TransientStorage::TransientStorage(IsPrivate is_private)
 void CookieJar::TransientStorage::set_cookies(Cookies cookies)
 {
     m_cookies = move(cookies);
+
+    m_cookie_keys_by_domain.clear();
+    for (auto const& [key, cookie] : m_cookies)
+        m_cookie_keys_by_domain.ensure(key.domain).set(key);
+
     purge_expired_cookies();
 }
 
+void CookieJar::TransientStorage::remove_from_domain_index(CookieStorageKey const& key)
+{
+    auto keys = m_cookie_keys_by_domain.find(key.domain);
+    if (keys == m_cookie_keys_by_domain.end())
+        return;
+
+    keys->value.remove(key);
+    if (keys->value.is_empty())
+        m_cookie_keys_by_domain.remove(keys);
+}
+
 void CookieJar::TransientStorage::set_cookie(CookieStorageKey key, HTTP::Cookie::Cookie cookie)
 {
     auto now = UnixDateTime::now();
@@ -629,6 +639,7 @@ void CookieJar::TransientStorage::set_cookie(CookieStorageKey key, HTTP::Cookie:
     }
 
     auto cookie_for_notification = cookie;
+    m_cookie_keys_by_domain.ensure(key.domain).set(key);
     m_cookies.set(key, cookie);
     m_dirty_cookies.set(move(key), move(cookie));
 
@@ -655,8 +666,11 @@ UnixDateTime CookieJar::TransientStorage::purge_expired_cookies(Optional<AK::Dur
 
     auto is_expired = [&](auto const&, auto const& cookie) { return cookie.expiry_time < now; };
 
-    if (auto removed_entries = m_cookies.take_all_matching(is_expired); !removed_entries.is_empty())
+    if (auto removed_entries = m_cookies.take_all_matching(is_expired); !removed_entries.is_empty()) {
+        for (auto const& entry : removed_entries)
+            remove_from_domain_index(entry.key);
         send_cookie_changed_notifications(removed_entries);
+    }
 
     return now;
 }
@@ -722,6 +736,26 @@ void CookieJar::TransientStorage::send_cookie_changed_notifications(ReadonlySpan
     });
 }
 
+void CookieJar::PersistedStorage::synchronize(TransientStorage& transient_storage)
+{
+    // Everything changed since the last synchronization is written in one transaction, rather than paying for a
+    // transaction per cookie. If the database is busy, the changes stay pending until the next synchronization.
+    Database::Database::Transaction transaction { database };
+    if (auto result = transaction.begin(); result.is_error()) {
+        dbgln("Unable to synchronize cookies: {}", result.error());
+        return;
+    }
+
+    for (auto const& it : transient_storage.take_dirty_cookies())
+        insert_cookie(it.value);
+
+    auto now = transient_storage.purge_expired_cookies();
+    database.execute_statement(statements.expire_cookie, {}, now);
+
+    if (auto result = transaction.commit(); result.is_error())
+        dbgln("Unable to synchronize cookies: {}", result.error());
+}
+
 void CookieJar::PersistedStorage::insert_cookie(HTTP::Cookie::Cookie const& cookie)
 {
     database.execute_statement(
@@ -8,6 +8,7 @@
 
 #include <AK/Function.h>
 #include <AK/HashMap.h>
+#include <AK/HashTable.h>
 #include <AK/Optional.h>
 #include <AK/String.h>
 #include <AK/StringView.h>
@@ -97,16 +98,38 @@ private:
             }
         }
 
+        // Only cookies whose domain is the host itself or one of its parent domains can match a host, so this visits
+        // those instead of every cookie in the store.
+        template<typename Callback>
+        void for_each_cookie_with_domain_on_host(StringView host, Callback callback)
+        {
+            for (auto domain = host;;) {
+                if (auto keys = m_cookie_keys_by_domain.find(domain); keys != m_cookie_keys_by_domain.end()) {
+                    for (auto const& key : keys->value)
+                        callback(m_cookies.find(key)->value);
+                }
+
+                auto dot = domain.find('.');
+                if (!dot.has_value())
+                    break;
+                domain = domain.substring_view(*dot + 1);
+            }
+        }
+
     private:
         using CookieEntry = decltype(declval<Cookies>().take_all_matching(nullptr))::ValueType;
         void send_cookie_changed_notifications(ReadonlySpan<CookieEntry>, bool inform_web_view_about_changed_domains = true);
 
+        void remove_from_domain_index(CookieStorageKey const&);
+
         IsPrivate m_is_private { IsPrivate::No };
         Cookies m_cookies;
         Cookies m_dirty_cookies;
+        HashMap<String, HashTable<CookieStorageKey>> m_cookie_keys_by_domain;
     };
 
     struct WEBVIEW_API PersistedStorage {
+        void synchronize(TransientStorage&);
         void insert_cookie(HTTP::Cookie::Cookie const& cookie);
         TransientStorage::Cookies select_all_cookies();
 
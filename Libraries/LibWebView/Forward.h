@@ -27,6 +27,7 @@ class HistoryStore;
 class HSTSStore;
 class Menu;
 class OutOfProcessWebView;
+class PageLoadBenchmark;
 class ProcessManager;
 class Settings;
 class SiteIsolationManager;
@@ -278,6 +278,12 @@ ErrorOr<NonnullRefPtr<Requests::RequestClient>> launch_request_server_process()
 
     if (request_server_options.resource_substitution_map_path.has_value())
         arguments.append(ByteString::formatted("--resource-map={}", *request_server_options.resource_substitution_map_path));
+    if (request_server_options.resource_recording_path.has_value())
+        arguments.append(ByteString::formatted("--record-resources={}", *request_server_options.resource_recording_path));
+    if (request_server_options.replay_latency_ms != 0)
+        arguments.append(ByteString::formatted("--replay-latency={}", request_server_options.replay_latency_ms));
+    if (request_server_options.replay_bandwidth_kbps.has_value())
+        arguments.append(ByteString::formatted("--replay-bandwidth={}", *request_server_options.replay_bandwidth_kbps));
 
     auto client = TRY(launch_server_process<Requests::RequestClient>("RequestServer"sv, move(arguments)));
 
@@ -25,6 +25,7 @@ static constexpr i32 HISTORY_DATABASE_BUSY_TIMEOUT_MS = 250;
 static constexpr u32 HISTORY_SCHEMA_BASELINE_VERSION = 1u;
 static constexpr u32 HISTORY_SCHEMA_RANKING_SIGNALS_VERSION = 2u;
 static constexpr u32 HISTORY_SCHEMA_OMNIBOX_ENGAGEMENTS_VERSION = 3u;
+static constexpr u32 HISTORY_SCHEMA_SEARCH_INDEX_VERSION = 4u;
 
 static Optional<StringView> url_without_scheme(StringView url)
 {
@@ -141,7 +142,7 @@ static void sort_matching_entries(Vector<HistoryEntry const*>& matches, StringVi
 
 ErrorOr<Database::MigrationOutcome> HistoryStore::migrate_schema(Database::Database& database, Database::MigrationMode mode)
 {
-    Array<Database::Migration, 3> migrations { {
+    Array<Database::Migration, 4> migrations { {
         { .version = HISTORY_SCHEMA_BASELINE_VERSION, .sql = R"#(
             CREATE TABLE IF NOT EXISTS History (
                 url TEXT PRIMARY KEY,
@@ -182,6 +183,57 @@ ErrorOr<Database::MigrationOutcome> HistoryStore::migrate_schema(Database::Datab
             CREATE INDEX OmniboxEngagementsByInput
             ON OmniboxEngagements(destination_kind, normalized_input);
         )#"sv },
+        { .version = HISTORY_SCHEMA_SEARCH_INDEX_VERSION, .sql = R"#(
+            -- The URL without its scheme and "www." prefix, which is what autocomplete matches against.
+            ALTER TABLE History ADD COLUMN searchable_url TEXT GENERATED ALWAYS AS (
+                CASE
+                    WHEN LOWER(SUBSTR(CASE
+                        WHEN INSTR(url, '://') > 0 THEN SUBSTR(url, INSTR(url, '://') + 3)
+                        ELSE url
+                    END, 1, 4)) = 'www.'
+                    THEN SUBSTR(CASE
+                        WHEN INSTR(url, '://') > 0 THEN SUBSTR(url, INSTR(url, '://') + 3)
+                        ELSE url
+                    END, 5)
+                    ELSE CASE
+                        WHEN INSTR(url, '://') > 0 THEN SUBSTR(url, INSTR(url, '://') + 3)
+                        ELSE url
+                    END
+                END
+            ) VIRTUAL;
+
+            -- Serves URL prefix matches, including the one and two character ones a trigram index cannot answer.
+            CREATE INDEX HistorySearchableURLIndex
+            ON History(searchable_url COLLATE NOCASE);
+
+            -- Serves substring matches in URLs and titles.
+            CREATE VIRTUAL TABLE HistorySearch USING fts5(
+                searchable_url,
+                title,
+                content = 'History',
+                content_rowid = 'rowid',
+                tokenize = 'trigram'
+            );
+
+            CREATE TRIGGER HistorySearchAfterInsert AFTER INSERT ON History BEGIN
+                INSERT INTO HistorySearch (rowid, searchable_url, title)
+                VALUES (new.rowid, new.searchable_url, new.title);
+            END;
+
+            CREATE TRIGGER HistorySearchAfterDelete AFTER DELETE ON History BEGIN
+                INSERT INTO HistorySearch (HistorySearch, rowid, searchable_url, title)
+                VALUES ('delete', old.rowid, old.searchable_url, old.title);
+            END;
+
+            CREATE TRIGGER HistorySearchAfterUpdate AFTER UPDATE OF url, title ON History BEGIN
+                INSERT INTO HistorySearch (HistorySearch, rowid, searchable_url, title)
+                VALUES ('delete', old.rowid, old.searchable_url, old.title);
+                INSERT INTO HistorySearch (rowid, searchable_url, title)
+                VALUES (new.rowid, new.searchable_url, new.title);
+            END;
+
+            INSERT INTO HistorySearch (HistorySearch) VALUES ('rebuild');
+        )#"sv },
     } };
 
     return database.migrate("History"sv, migrations, mode);
@@ -251,6 +303,9 @@ ErrorOr<NonnullOwnPtr<HistoryStore>> HistoryStore::create(Database::Database& da
         FROM History
         WHERE url = ?;
     )#"sv));
+    // The subquery gathers candidates from the prefix and trigram indices, so that typing into the omnibox does not
+    // scan the whole history. LIKE treats '%' and '_' in the query as wildcards, so the candidates are then checked
+    // against the exact predicates.
     statements.search_entries = TRY(database.prepare_statement(R"#(
         SELECT
             url,
@@ -264,43 +319,22 @@ ErrorOr<NonnullOwnPtr<HistoryStore>> HistoryStore::create(Database::Database& da
             decayed_visit_score,
             decayed_direct_score,
             score_updated_at
-        FROM (
-            SELECT
-                url,
-                title,
-                visit_count,
-                last_visited_time,
-                COALESCE(favicon, '') AS favicon,
-                direct_visit_count,
-                last_qualifying_visit_time,
-                last_direct_visit_time,
-                decayed_visit_score,
-                decayed_direct_score,
-                score_updated_at,
-                CASE
-                    WHEN LOWER(CASE
-                        WHEN INSTR(url, '://') > 0 THEN SUBSTR(url, INSTR(url, '://') + 3)
-                        ELSE url
-                    END) LIKE 'www.%'
-                    THEN SUBSTR(CASE
-                        WHEN INSTR(url, '://') > 0 THEN SUBSTR(url, INSTR(url, '://') + 3)
-                        ELSE url
-                    END, 5)
-                    ELSE CASE
-                        WHEN INSTR(url, '://') > 0 THEN SUBSTR(url, INSTR(url, '://') + 3)
-                        ELSE url
-                    END
-                END AS searchable_url
-            FROM History
-        )
-        WHERE ((?1 != '' AND LOWER(searchable_url) LIKE LOWER(?1) || '%')
-            OR (?2 != '' AND INSTR(LOWER(searchable_url), LOWER(?2)) > 0)
-            OR (?3 != '' AND INSTR(LOWER(title), LOWER(?3)) > 0))
+        FROM History
+        WHERE rowid IN (
+                SELECT rowid FROM History WHERE ?1 != '' AND searchable_url LIKE ?5
+                UNION
+                SELECT rowid FROM HistorySearch WHERE ?2 != '' AND searchable_url LIKE '%' || ?2 || '%'
+                UNION
+                SELECT rowid FROM HistorySearch WHERE ?3 != '' AND title LIKE '%' || ?3 || '%'
+            )
+            AND ((?1 != '' AND SUBSTR(LOWER(searchable_url), 1, LENGTH(?1)) = LOWER(?1))
+                OR (?2 != '' AND INSTR(LOWER(searchable_url), LOWER(?2)) > 0)
+                OR (?3 != '' AND INSTR(LOWER(title), LOWER(?3)) > 0))
         ORDER BY
             CASE
                 WHEN ?1 != '' AND LOWER(searchable_url) = LOWER(?1) THEN 0
-                WHEN ?1 != '' AND LOWER(searchable_url) LIKE LOWER(?1) || '%' THEN 1
-                WHEN ?3 != '' AND LOWER(title) LIKE LOWER(?3) || '%' THEN 2
+                WHEN ?1 != '' AND SUBSTR(LOWER(searchable_url), 1, LENGTH(?1)) = LOWER(?1) THEN 1
+                WHEN ?3 != '' AND SUBSTR(LOWER(title), 1, LENGTH(?3)) = LOWER(?3) THEN 2
                 ELSE 3
             END,
             direct_visit_count DESC,
@@ -1056,6 +1090,7 @@ Vector<HistoryEntry> HistoryStore::PersistedStorage::autocomplete_entries(String
     auto url_query_string = MUST(String::from_utf8(url_query));
     auto title_query_string = MUST(String::from_utf8(title_query));
     auto url_contains_query_string = MUST(String::from_utf8(autocomplete_url_contains_query(url_query)));
+    auto url_prefix_pattern = MUST(String::formatted("{}%", url_query));
 
     auto outcome = m_database.execute_interruptible_statement(
         m_statements.search_entries,
@@ -1080,7 +1115,8 @@ Vector<HistoryEntry> HistoryStore::PersistedStorage::autocomplete_entries(String
         url_query_string,
         url_contains_query_string,
         title_query_string,
-        static_cast<i64>(limit));
+        static_cast<i64>(limit),
+        url_prefix_pattern);
 
     if (outcome == Database::Database::StatementExecutionOutcome::Interrupted)
         entries.clear();
@@ -116,8 +116,11 @@ enum class ActionID {
     DumpSessionStorage,
     DumpGCGraph,
     DumpWasmStats,
+    DumpIPCTraces,
     ShowLineBoxBorders,
     ShowCaretHitTestDebugOverlay,
+    ProfileWasm,
+    ProfileJavaScript,
     CollectGarbage,
     CrashCurrentPage,
     CrashCompositorProcess,
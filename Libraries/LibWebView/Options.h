@@ -21,6 +21,7 @@ enum class HeadlessMode {
     LayoutTree,
     Text,
     Manual,
+    Benchmark,
     Test,
 };
 
@@ -81,6 +82,7 @@ struct BrowserOptions {
     Optional<HeadlessMode> headless_mode;
     Optional<ByteString> screenshot_path {};
     u32 screenshot_delay { 1 };
+    u32 benchmark_iterations { 5 };
     int window_width { 800 };
     int window_height { 600 };
     NewWindow new_window { NewWindow::No };
@@ -92,6 +94,7 @@ struct BrowserOptions {
     Optional<ByteString> webdriver_endpoint {};
     Optional<DNSSettings> dns_settings {};
     Optional<u16> devtools_port;
+    Optional<u64> memory_budget_in_bytes;
     EnableContentBlocker enable_content_blocker { EnableContentBlocker::Yes };
     DisableSandbox disable_sandbox { DisableSandbox::No };
     Vector<ByteString> content_blocker_list_paths {};
@@ -108,6 +111,9 @@ struct RequestServerOptions {
     ByteString cache_path;
     HTTPDiskCacheMode http_disk_cache_mode { HTTPDiskCacheMode::Disabled };
     Optional<ByteString> resource_substitution_map_path;
+    Optional<ByteString> resource_recording_path;
+    u32 replay_latency_ms { 0 };
+    Optional<u64> replay_bandwidth_kbps;
 };
 
 enum class IsTestMode {
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonValue.h>
+#include <AK/QuickSort.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/Timer.h>
+#include <LibWebView/HeadlessWebView.h>
+#include <LibWebView/PageInfo.h>
+#include <LibWebView/PageLoadBenchmark.h>
+
+namespace WebView {
+
+// Paints that determine the largest contentful paint often land after the load event, so we give the page a moment to
+// settle before collecting its metrics.
+static constexpr int settle_time_ms = 1000;
+
+// Pages that never finish loading still have their metrics collected, without a load time.
+static constexpr int load_timeout_ms = 60'000;
+
+static constexpr Array summarized_metrics = {
+    "first_contentful_paint_ms"sv,
+    "largest_contentful_paint_ms"sv,
+    "dom_content_loaded_ms"sv,
+    "load_ms"sv,
+    "style_ms"sv,
+    "layout_ms"sv,
+    "paint_ms"sv,
+    "peak_memory_bytes"sv,
+};
+
+NonnullOwnPtr<PageLoadBenchmark> PageLoadBenchmark::create(Core::AnonymousBuffer theme, Web::DevicePixelSize viewport_size, URL::URL url, u32 iterations)
+{
+    return adopt_own(*new PageLoadBenchmark(move(theme), viewport_size, move(url), iterations));
+}
+
+PageLoadBenchmark::PageLoadBenchmark(Core::AnonymousBuffer theme, Web::DevicePixelSize viewport_size, URL::URL url, u32 iterations)
+    : m_theme(move(theme))
+    , m_viewport_size(viewport_size)
+    , m_url(move(url))
+    , m_iteration_count(iterations)
+{
+}
+
+PageLoadBenchmark::~PageLoadBenchmark() = default;
+
+void PageLoadBenchmark::start()
+{
+    start_next_iteration();
+}
+
+void PageLoadBenchmark::start_next_iteration()
+{
+    if (m_iterations.size() == m_iteration_count) {
+        if (on_complete)
+            on_complete(results());
+        return;
+    }
+
+    // Keep the previous page from using CPU time while the next one loads.
+    if (!m_views.is_empty())
+        m_views.last()->load(URL::about_blank());
+
+    m_views.append(HeadlessWebView::create(m_theme, m_viewport_size));
+    auto& view = *m_views.last();
+    m_is_collecting_metrics = false;
+
+    view.on_load_finish = [this](auto const& loaded_url) {
+        if (!m_url.equals(loaded_url, URL::ExcludeFragment::Yes))
+            return;
+
+        m_timer = Core::Timer::create_single_shot(settle_time_ms, [this] { collect_metrics(); });
+        m_timer->start();
+    };
+
+    view.on_web_content_crashed = [this] {
+        warnln("WebContent crashed while loading {}", m_url);
+        finish_iteration(JsonValue {});
+    };
+
+    m_timer = Core::Timer::create_single_shot(load_timeout_ms, [this] {
+        warnln("Timed out waiting for {} to load", m_url);
+        collect_metrics();
+    });
+    m_timer->start();
+
+    view.load(m_url);
+}
+
+void PageLoadBenchmark::collect_metrics()
+{
+    if (m_is_collecting_metrics)
+        return;
+    m_is_collecting_metrics = true;
+
+    m_views.last()->request_internal_page_info(PageInfoType::LoadMetrics)
+        ->when_resolved([this](auto const& text) {
+            auto metrics = JsonValue::from_string(text);
+            if (metrics.is_error() || !metrics.value().is_object()) {
+                warnln("Unable to parse load metrics: {}", text);
+                finish_iteration(JsonValue {});
+                return;
+            }
+            finish_iteration(metrics.release_value());
+        })
+        .when_rejected([this](auto const& error) {
+            warnln("Unable to collect load metrics: {}", error);
+            finish_iteration(JsonValue {});
+        });
+}
+
+void PageLoadBenchmark::finish_iteration(JsonValue metrics)
+{
+    if (m_timer)
+        m_timer->stop();
+
+    auto& view = *m_views.last();
+    view.on_load_finish = nullptr;
+    view.on_web_content_crashed = nullptr;
+
+    m_iterations.append(move(metrics));
+
+    // Let the current IPC message unwind before tearing the page down and starting over.
+    Core::deferred_invoke([this] { start_next_iteration(); });
+}
+
+JsonObject PageLoadBenchmark::results() const
+{
+    JsonArray iterations;
+    for (auto const& metrics : m_iterations)
+        iterations.must_append(metrics);
+
+    JsonObject summary;
+
+    for (auto name : summarized_metrics) {
+        Vector<double> values;
+        for (auto const& metrics : m_iterations) {
+            if (!metrics.is_object())
+                continue;
+            if (auto value = metrics.as_object().get_double_with_precision_loss(name); value.has_value())
+                values.append(*value);
+        }
+
+        if (values.is_empty()) {
+            summary.set(name, JsonValue {});
+            continue;
+        }
+
+        quick_sort(values);
+
+        double total = 0;
+        for (auto value : values)
+            total += value;
+
+        auto middle = values.size() / 2;
+        auto median = values.size() % 2 == 0 ? (values[middle - 1] + values[middle]) / 2 : values[middle];
+
+        JsonObject statistics;
+        statistics.set("min"sv, values.first());
+        statistics.set("max"sv, values.last());
+        statistics.set("mean"sv, total / static_cast<double>(values.size()));
+        statistics.set("median"sv, median);
+        statistics.set("samples"sv, values.size());
+        summary.set(name, move(statistics));
+    }
+
+    JsonObject results;
+    results.set("url"sv, m_url.serialize());
+    results.set("iterations"sv, move(iterations));
+    results.set("summary"sv, move(summary));
+    return results;
+}
+
+}
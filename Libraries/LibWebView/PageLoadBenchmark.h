@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/JsonObject.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Vector.h>
+#include <LibCore/AnonymousBuffer.h>
+#include <LibCore/Forward.h>
+#include <LibURL/URL.h>
+#include <LibWeb/PixelUnits.h>
+#include <LibWebView/Forward.h>
+
+namespace WebView {
+
+class HeadlessWebView;
+
+// Loads a page a number of times, each in a fresh WebContent process, and reports the load metrics of every load along
+// with a summary of them. Combined with a recorded resource map, this gives repeatable numbers for comparing engine
+// changes.
+class WEBVIEW_API PageLoadBenchmark {
+public:
+    static NonnullOwnPtr<PageLoadBenchmark> create(Core::AnonymousBuffer theme, Web::DevicePixelSize viewport_size, URL::URL, u32 iterations);
+    ~PageLoadBenchmark();
+
+    void start();
+
+    Function<void(JsonObject)> on_complete;
+
+private:
+    PageLoadBenchmark(Core::AnonymousBuffer theme, Web::DevicePixelSize viewport_size, URL::URL, u32 iterations);
+
+    void start_next_iteration();
+    void collect_metrics();
+    void finish_iteration(JsonValue metrics);
+
+    JsonObject results() const;
+
+    Core::AnonymousBuffer m_theme;
+    Web::DevicePixelSize m_viewport_size;
+    URL::URL m_url;
+    u32 m_iteration_count { 0 };
+
+    // Views are kept alive until the benchmark ends, as WebContent may still have messages for them in flight.
+    Vector<NonnullOwnPtr<HeadlessWebView>> m_views;
+    Vector<JsonValue> m_iterations;
+    RefPtr<Core::Timer> m_timer;
+    bool m_is_collecting_metrics { false };
+};
+
+}
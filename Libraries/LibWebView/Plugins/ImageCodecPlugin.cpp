@@ -41,7 +41,23 @@ void ImageCodecPlugin::setup_client_callbacks()
 
 ImageCodecPlugin::~ImageCodecPlugin() = default;
 
-NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::decode_image(ReadonlyBytes bytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected)
+// FIXME: Remove this codec plugin and just use the ImageDecoderClient directly to avoid these copies
+static Web::Platform::DecodedImage to_platform_decoded_image(ImageDecoderClient::DecodedImage& result)
+{
+    Web::Platform::DecodedImage decoded_image;
+    decoded_image.is_animated = result.is_animated;
+    decoded_image.loop_count = result.loop_count;
+    decoded_image.frame_count = result.frame_count;
+    decoded_image.session_id = result.session_id;
+    decoded_image.all_durations = move(result.all_durations);
+    for (auto& frame : result.frames) {
+        decoded_image.frames.empend(move(frame.bitmap), frame.duration);
+    }
+    decoded_image.color_space = move(result.color_space);
+    return decoded_image;
+}
+
+NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::decode_image(ReadonlyBytes bytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size)
 {
     auto promise = Core::Promise<Web::Platform::DecodedImage>::construct();
     if (on_resolved)
@@ -57,27 +73,76 @@ NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::deco
     auto image_decoder_promise = m_client->decode_image(
         bytes,
         [promise](ImageDecoderClient::DecodedImage& result) -> ErrorOr<void> {
-            // FIXME: Remove this codec plugin and just use the ImageDecoderClient directly to avoid these copies
-            Web::Platform::DecodedImage decoded_image;
-            decoded_image.is_animated = result.is_animated;
-            decoded_image.loop_count = result.loop_count;
-            decoded_image.frame_count = result.frame_count;
-            decoded_image.session_id = result.session_id;
-            decoded_image.all_durations = move(result.all_durations);
-            for (auto& frame : result.frames) {
-                decoded_image.frames.empend(move(frame.bitmap), frame.duration);
-            }
-            decoded_image.color_space = move(result.color_space);
-            promise->resolve(move(decoded_image));
+            promise->resolve(to_platform_decoded_image(result));
             return {};
         },
         [promise](auto& error) {
             promise->reject(Error::copy(error));
-        });
+        },
+        ideal_size);
 
     return promise;
 }
 
+i64 ImageCodecPlugin::begin_incremental_decode(Function<void(Web::Platform::PartialImage&)> on_partial_image, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected)
+{
+    auto decode_id = m_next_incremental_decode_id++;
+
+    if (!m_client) {
+        auto error = Error::from_string_literal("ImageDecoderClient is disconnected");
+        if (on_rejected)
+            on_rejected(error);
+        return decode_id;
+    }
+
+    auto request_id = m_client->begin_incremental_decode(
+        [on_partial_image = move(on_partial_image)](ImageDecoderClient::PartialImage& result) {
+            if (!on_partial_image)
+                return;
+            Web::Platform::PartialImage partial_image { move(result.bitmap), move(result.color_space) };
+            on_partial_image(partial_image);
+        },
+        [this, decode_id, on_resolved = move(on_resolved)](ImageDecoderClient::DecodedImage& result) -> ErrorOr<void> {
+            m_incremental_decodes.remove(decode_id);
+            if (!on_resolved)
+                return {};
+            auto decoded_image = to_platform_decoded_image(result);
+            return on_resolved(decoded_image);
+        },
+        [this, decode_id, on_rejected = move(on_rejected)](Error& error) {
+            m_incremental_decodes.remove(decode_id);
+            if (on_rejected)
+                on_rejected(error);
+        });
+
+    m_incremental_decodes.set(decode_id, { *m_client, request_id });
+    return decode_id;
+}
+
+void ImageCodecPlugin::append_incremental_decode_data(i64 decode_id, ReadonlyBytes bytes)
+{
+    if (auto decode = m_incremental_decodes.get(decode_id); decode.has_value())
+        decode->client->append_incremental_decode_data(decode->request_id, bytes);
+}
+
+void ImageCodecPlugin::finish_incremental_decode(i64 decode_id)
+{
+    if (auto decode = m_incremental_decodes.get(decode_id); decode.has_value())
+        decode->client->finish_incremental_decode(decode->request_id);
+}
+
+void ImageCodecPlugin::cancel_incremental_decode(i64 decode_id)
+{
+    if (auto decode = m_incremental_decodes.take(decode_id); decode.has_value())
+        decode->client->cancel_decoding(decode->request_id);
+}
+
+void ImageCodecPlugin::set_incremental_decode_is_visible(i64 decode_id, bool is_visible)
+{
+    if (auto decode = m_incremental_decodes.get(decode_id); decode.has_value())
+        decode->client->set_decode_priority(decode->request_id, is_visible);
+}
+
 void ImageCodecPlugin::request_animation_frames(i64 session_id, u32 start_frame_index, u32 count)
 {
     if (m_client)
@@ -18,7 +18,13 @@ public:
     explicit ImageCodecPlugin(NonnullRefPtr<ImageDecoderClient::Client>);
     virtual ~ImageCodecPlugin() override;
 
-    virtual NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected) override;
+    virtual NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size) override;
+
+    virtual i64 begin_incremental_decode(Function<void(Web::Platform::PartialImage&)> on_partial_image, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected) override;
+    virtual void append_incremental_decode_data(i64 decode_id, ReadonlyBytes) override;
+    virtual void finish_incremental_decode(i64 decode_id) override;
+    virtual void cancel_incremental_decode(i64 decode_id) override;
+    virtual void set_incremental_decode_is_visible(i64 decode_id, bool is_visible) override;
 
     virtual void request_animation_frames(i64 session_id, u32 start_frame_index, u32 count) override;
     virtual void stop_animation_decode(i64 session_id) override;
@@ -29,6 +35,15 @@ private:
     void setup_client_callbacks();
 
     RefPtr<ImageDecoderClient::Client> m_client;
+
+    // Incremental decodes remember the client they were started on, since the client may be replaced while their data
+    // is still arriving.
+    struct IncrementalDecode {
+        NonnullRefPtr<ImageDecoderClient::Client> client;
+        i64 request_id { 0 };
+    };
+    HashMap<i64, IncrementalDecode> m_incremental_decodes;
+    i64 m_next_incremental_decode_id { 1 };
 };
 
 }
@@ -52,6 +52,7 @@ StringView process_name_from_type(ProcessType type)
 ProcessManager::ProcessManager()
     : on_process_added([](Process&) {})
     , on_process_exited([](Process&&, Optional<int>) {})
+    , on_memory_pressure([](Web::MemoryPressureLevel) {})
     , m_process_monitor(ProcessMonitor([this](pid_t pid, Optional<int> exit_status) {
         if (auto process = remove_process(pid); process.has_value())
             on_process_exited(process.release_value(), exit_status);
@@ -162,6 +163,69 @@ void ProcessManager::update_all_process_statistics()
     (void)update_process_statistics(m_statistics);
 }
 
+static constexpr int memory_pressure_check_interval_ms = 5'000;
+static constexpr auto memory_pressure_repeat_interval = AK::Duration::from_seconds(30);
+
+void ProcessManager::start_monitoring_memory_pressure(Optional<u64> memory_budget_in_bytes)
+{
+    verify_event_loop();
+    m_memory_budget_in_bytes = memory_budget_in_bytes;
+
+    if (!m_memory_pressure_timer) {
+        m_memory_pressure_timer = Core::Timer::create_repeating(memory_pressure_check_interval_ms, [this] {
+            check_memory_pressure();
+        });
+        m_memory_pressure_timer->start();
+    }
+}
+
+void ProcessManager::check_memory_pressure()
+{
+    update_all_process_statistics();
+
+    u64 memory_usage_bytes = 0;
+    m_statistics.for_each_process([&](auto const& process) {
+        memory_usage_bytes += process.memory_usage_bytes;
+    });
+
+    // Pressure is moderate at 80% of the budget or with 15% of the system's memory left, and critical once the
+    // budget is exceeded or only 5% of the system's memory is left.
+    auto is_above = [](u64 value, u64 limit, u64 percent) { return value * 100 >= limit * percent; };
+    auto is_below = [](u64 value, u64 limit, u64 percent) { return value * 100 < limit * percent; };
+
+    auto const total_bytes = m_statistics.total_physical_memory_bytes;
+    auto const available_bytes = m_statistics.available_physical_memory_bytes;
+    auto const has_system_memory_info = total_bytes != 0 && available_bytes != 0;
+
+    Optional<Web::MemoryPressureLevel> level;
+    if ((m_memory_budget_in_bytes.has_value() && is_above(memory_usage_bytes, *m_memory_budget_in_bytes, 100))
+        || (has_system_memory_info && is_below(available_bytes, total_bytes, 5))) {
+        level = Web::MemoryPressureLevel::Critical;
+    } else if ((m_memory_budget_in_bytes.has_value() && is_above(memory_usage_bytes, *m_memory_budget_in_bytes, 80))
+        || (has_system_memory_info && is_below(available_bytes, total_bytes, 15))) {
+        level = Web::MemoryPressureLevel::Moderate;
+    }
+
+    if (!level.has_value()) {
+        m_last_memory_pressure_level.clear();
+        return;
+    }
+
+    // Whatever can be released was released the last time, so don't repeat that on every check unless things got worse.
+    auto now = MonotonicTime::now_coarse();
+    auto got_worse = !m_last_memory_pressure_level.has_value() || *level > *m_last_memory_pressure_level;
+    if (!got_worse && now - m_last_memory_pressure_time < memory_pressure_repeat_interval)
+        return;
+
+    dbgln("Memory pressure is {}: {} MiB used by all processes, {} MiB left on the system",
+        *level == Web::MemoryPressureLevel::Critical ? "critical"sv : "moderate"sv,
+        memory_usage_bytes / MiB, available_bytes / MiB);
+
+    m_last_memory_pressure_level = level;
+    m_last_memory_pressure_time = now;
+    on_memory_pressure(*level);
+}
+
 void ProcessManager::verify_event_loop() const
 {
     if (Core::EventLoop::is_running())
@@ -8,11 +8,14 @@
 
 #include <AK/Function.h>
 #include <AK/HashMap.h>
+#include <AK/Optional.h>
 #include <AK/RefPtr.h>
+#include <AK/Time.h>
 #include <AK/Types.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/Platform/ProcessStatistics.h>
 #include <LibCore/Timer.h>
+#include <LibWeb/Page/MemoryPressureLevel.h>
 #include <LibWebView/Forward.h>
 #include <LibWebView/Process.h>
 #include <LibWebView/ProcessMonitor.h>
@@ -43,17 +46,28 @@ public:
 
     void update_all_process_statistics();
 
+    // Periodically compares the memory used by all of our processes against the given budget, and the memory left on
+    // the system against its total, invoking on_memory_pressure while either runs low.
+    void start_monitoring_memory_pressure(Optional<u64> memory_budget_in_bytes);
+
     Function<void(Process&)> on_process_added; // test-web
     Function<void(Process&&, Optional<int> exit_status)> on_process_exited;
+    Function<void(Web::MemoryPressureLevel)> on_memory_pressure;
 
 private:
     void verify_event_loop() const;
+    void check_memory_pressure();
 
     Core::Platform::ProcessStatistics m_statistics;
     HashMap<pid_t, Process> m_processes;
     HashMap<pid_t, RefPtr<Core::Timer>> m_forced_exit_timers;
     ProcessMonitor m_process_monitor;
     Core::EventLoop* m_creation_event_loop { &Core::EventLoop::current() };
+
+    Optional<u64> m_memory_budget_in_bytes;
+    RefPtr<Core::Timer> m_memory_pressure_timer;
+    Optional<Web::MemoryPressureLevel> m_last_memory_pressure_level;
+    MonotonicTime m_last_memory_pressure_time { MonotonicTime::now_coarse() };
 };
 
 }
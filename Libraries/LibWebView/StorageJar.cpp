@@ -17,6 +17,10 @@ static constexpr size_t LOCAL_STORAGE_QUOTA = 5 * MiB;
 
 static constexpr u32 WEB_STORAGE_SCHEMA_BASELINE_VERSION = 2u;
 
+// Changes are written back this long after the first change that has not been persisted yet, so that a page setting
+// many items at once costs one transaction rather than one database write per item.
+static constexpr auto DATABASE_SYNCHRONIZATION_DELAY = AK::Duration::from_seconds(1);
+
 ErrorOr<Database::MigrationOutcome> StorageJar::migrate_schema(Database::Database& database, Database::MigrationMode mode)
 {
     Array<Database::Migration, 1> migrations { {
@@ -39,14 +43,12 @@ ErrorOr<NonnullOwnPtr<StorageJar>> StorageJar::create(Database::Database& databa
 {
     Statements statements {};
 
-    statements.get_item = TRY(database.prepare_statement("SELECT bottle_value FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key = ?;"sv));
+    statements.get_bottle = TRY(database.prepare_statement("SELECT bottle_key, bottle_value, last_access_time FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
     statements.set_item = TRY(database.prepare_statement("INSERT OR REPLACE INTO WebStorage (storage_endpoint, storage_key, bottle_key, bottle_value, last_access_time) VALUES (?, ?, ?, ?, ?);"sv));
     statements.delete_item = TRY(database.prepare_statement("DELETE FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key = ?;"sv));
     statements.delete_items_accessed_since = TRY(database.prepare_statement("DELETE FROM WebStorage WHERE last_access_time >= ?;"sv));
     statements.update_last_access_time = TRY(database.prepare_statement("UPDATE WebStorage SET last_access_time = ? WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key = ?;"sv));
     statements.clear = TRY(database.prepare_statement("DELETE FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
-    statements.get_keys = TRY(database.prepare_statement("SELECT bottle_key FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
-    statements.calculate_size_excluding_bottle_key = TRY(database.prepare_statement("SELECT SUM(OCTET_LENGTH(bottle_key) + OCTET_LENGTH(bottle_value)) FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key != ?;"sv));
     statements.calculate_size = TRY(database.prepare_statement("SELECT COALESCE(SUM(OCTET_LENGTH(bottle_key) + OCTET_LENGTH(bottle_value)), 0) FROM WebStorage WHERE storage_key = ?;"sv));
     statements.estimate_storage_size_accessed_since = TRY(database.prepare_statement("SELECT SUM(OCTET_LENGTH(storage_key)) + SUM(OCTET_LENGTH(bottle_key)) + SUM(OCTET_LENGTH(bottle_value)) FROM WebStorage WHERE last_access_time >= ?;"sv));
 
@@ -61,9 +63,22 @@ NonnullOwnPtr<StorageJar> StorageJar::create()
 StorageJar::StorageJar(Optional<PersistedStorage> persisted_storage)
     : m_persisted_storage(move(persisted_storage))
 {
+    if (!m_persisted_storage.has_value())
+        return;
+
+    m_persisted_storage->synchronization_timer = Core::Timer::create_single_shot(
+        static_cast<int>(DATABASE_SYNCHRONIZATION_DELAY.to_milliseconds()),
+        [this]() { synchronize(); });
 }
 
-StorageJar::~StorageJar() = default;
+StorageJar::~StorageJar()
+{
+    if (!m_persisted_storage.has_value())
+        return;
+
+    m_persisted_storage->synchronization_timer->stop();
+    synchronize();
+}
 
 static String storage_string_to_database_string(Utf16String const& string)
 {
@@ -81,68 +96,132 @@ static size_t storage_quota_size(Utf16String const& string)
     return utf8_string.bytes().size();
 }
 
+void StorageJar::ensure_bottle_is_loaded(StorageEndpointType storage_endpoint, String const& storage_key)
+{
+    if (!m_persisted_storage.has_value())
+        return;
+
+    StorageBottleLocation bottle_location { storage_endpoint, storage_key };
+    if (m_persisted_storage->loaded_bottles.contains(bottle_location))
+        return;
+
+    m_persisted_storage->load_bottle(bottle_location, m_transient_storage);
+}
+
+void StorageJar::did_access_item(StorageLocation const& storage_location)
+{
+    if (!m_persisted_storage.has_value() || m_persisted_storage->changed_items.contains(storage_location))
+        return;
+
+    m_persisted_storage->accessed_items.set(storage_location);
+    schedule_synchronization();
+}
+
+void StorageJar::did_change_item(StorageLocation const& storage_location)
+{
+    if (!m_persisted_storage.has_value())
+        return;
+
+    m_persisted_storage->accessed_items.remove(storage_location);
+    m_persisted_storage->changed_items.set(storage_location);
+    schedule_synchronization();
+}
+
+void StorageJar::schedule_synchronization()
+{
+    if (!m_persisted_storage->synchronization_timer->is_active())
+        m_persisted_storage->synchronization_timer->start();
+}
+
+void StorageJar::synchronize()
+{
+    if (m_persisted_storage.has_value())
+        m_persisted_storage->write_back(m_transient_storage);
+}
+
 Optional<Utf16String> StorageJar::get_item(StorageEndpointType storage_endpoint, String const& storage_key, Utf16String const& bottle_key)
 {
     StorageLocation storage_location { storage_endpoint, storage_key, bottle_key };
+    ensure_bottle_is_loaded(storage_endpoint, storage_key);
 
-    if (m_persisted_storage.has_value())
-        return m_persisted_storage->get_item(storage_location);
-    return m_transient_storage.get_item(storage_location);
+    auto value = m_transient_storage.get_item(storage_location);
+    if (value.has_value())
+        did_access_item(storage_location);
+    return value;
 }
 
 StorageSetResult StorageJar::set_item(StorageEndpointType storage_endpoint, String const& storage_key, Utf16String const& bottle_key, Utf16String const& bottle_value)
 {
     StorageLocation storage_location { storage_endpoint, storage_key, bottle_key };
+    ensure_bottle_is_loaded(storage_endpoint, storage_key);
 
-    if (m_persisted_storage.has_value())
-        return m_persisted_storage->set_item(storage_location, bottle_value);
-    return m_transient_storage.set_item(storage_location, bottle_value);
+    auto result = m_transient_storage.set_item(storage_location, bottle_value);
+    if (result.has<Optional<Utf16String>>())
+        did_change_item(storage_location);
+    return result;
 }
 
 void StorageJar::remove_item(StorageEndpointType storage_endpoint, String const& storage_key, Utf16String const& key)
 {
     StorageLocation storage_location { storage_endpoint, storage_key, key };
+    ensure_bottle_is_loaded(storage_endpoint, storage_key);
 
-    if (m_persisted_storage.has_value())
-        m_persisted_storage->delete_item(storage_location);
-    else
-        m_transient_storage.delete_item(storage_location);
+    m_transient_storage.delete_item(storage_location);
+    did_change_item(storage_location);
 }
 
 void StorageJar::remove_items_accessed_since(UnixDateTime since)
 {
-    if (m_persisted_storage.has_value())
+    if (m_persisted_storage.has_value()) {
+        synchronize();
         m_persisted_storage->delete_items_accessed_since(since);
-    else
-        m_transient_storage.delete_items_accessed_since(since);
+    }
+    m_transient_storage.delete_items_accessed_since(since);
 }
 
 void StorageJar::clear_storage_key(StorageEndpointType storage_endpoint, String const& storage_key)
 {
-    if (m_persisted_storage.has_value())
-        m_persisted_storage->clear(storage_endpoint, storage_key);
-    else
-        m_transient_storage.clear(storage_endpoint, storage_key);
+    m_transient_storage.clear(storage_endpoint, storage_key);
+
+    if (!m_persisted_storage.has_value())
+        return;
+
+    // Changes to the bottle that are still pending are superseded by clearing it. The bottle is known to be empty now,
+    // so there is no need to load it from the database anymore.
+    auto is_in_bottle = [&](StorageLocation const& location) {
+        return location.storage_endpoint == storage_endpoint && location.storage_key == storage_key;
+    };
+    m_persisted_storage->changed_items.remove_all_matching(is_in_bottle);
+    m_persisted_storage->accessed_items.remove_all_matching(is_in_bottle);
+
+    StorageBottleLocation bottle_location { storage_endpoint, storage_key };
+    m_persisted_storage->cleared_bottles.append(bottle_location);
+    m_persisted_storage->loaded_bottles.set(move(bottle_location));
+    schedule_synchronization();
 }
 
 Vector<Utf16String> StorageJar::get_all_keys(StorageEndpointType storage_endpoint, String const& storage_key)
 {
-    if (m_persisted_storage.has_value())
-        return m_persisted_storage->get_keys(storage_endpoint, storage_key);
+    ensure_bottle_is_loaded(storage_endpoint, storage_key);
     return m_transient_storage.get_keys(storage_endpoint, storage_key);
 }
 
 u64 StorageJar::usage(String const& storage_key)
 {
-    if (m_persisted_storage.has_value())
+    // Usage covers every endpoint's bottle for the storage key, including bottles that have not been loaded.
+    if (m_persisted_storage.has_value()) {
+        synchronize();
         return m_persisted_storage->usage(storage_key);
+    }
     return m_transient_storage.usage(storage_key);
 }
 
-Requests::CacheSizes StorageJar::estimate_storage_size_accessed_since(UnixDateTime since) const
+Requests::CacheSizes StorageJar::estimate_storage_size_accessed_since(UnixDateTime since)
 {
-    if (m_persisted_storage.has_value())
+    if (m_persisted_storage.has_value()) {
+        synchronize();
         return m_persisted_storage->estimate_storage_size_accessed_since(since);
+    }
     return m_transient_storage.estimate_storage_size_accessed_since(since);
 }
 
@@ -158,45 +237,72 @@ Optional<Utf16String> StorageJar::TransientStorage::get_item(StorageLocation con
 
 StorageSetResult StorageJar::TransientStorage::set_item(StorageLocation const& key, Utf16String const& value)
 {
-    auto old_value = get_item(key);
-
-    u64 current_size = 0;
-
-    for (auto const& [existing_key, existing_entry] : m_storage_items) {
-        if (existing_key.storage_endpoint == key.storage_endpoint && existing_key.storage_key == key.storage_key && existing_key.bottle_key != key.bottle_key)
-            current_size += existing_entry.quota_size;
+    auto old_entry = m_storage_items.get(key);
+    Optional<Utf16String> old_value;
+    u64 old_size = 0;
+    if (old_entry.has_value()) {
+        old_value = old_entry->value;
+        old_size = old_entry->quota_size;
     }
 
+    auto& bottle_size = m_bottle_sizes.ensure(StorageBottleLocation { key.storage_endpoint, key.storage_key });
+    auto current_size = bottle_size - old_size;
+
     auto new_size = storage_quota_size(key.bottle_key) + storage_quota_size(value);
     if (current_size + new_size > LOCAL_STORAGE_QUOTA)
         return StorageOperationError::QuotaExceededError;
 
+    bottle_size = current_size + new_size;
     m_storage_items.set(key, { value, UnixDateTime::now(), new_size });
     return old_value;
 }
 
+void StorageJar::TransientStorage::load_item(StorageLocation const& key, Utf16String value, UnixDateTime last_access_time)
+{
+    auto quota_size = storage_quota_size(key.bottle_key) + storage_quota_size(value);
+    m_bottle_sizes.ensure(StorageBottleLocation { key.storage_endpoint, key.storage_key }) += quota_size;
+    m_storage_items.set(key, { move(value), last_access_time, quota_size });
+}
+
+Optional<StorageJar::TransientStorage::Entry const&> StorageJar::TransientStorage::entry(StorageLocation const& key) const
+{
+    return m_storage_items.get(key);
+}
+
+void StorageJar::TransientStorage::remove_from_bottle_size(StorageLocation const& key, Entry const& entry)
+{
+    auto bottle_size = m_bottle_sizes.find(StorageBottleLocation { key.storage_endpoint, key.storage_key });
+    VERIFY(bottle_size != m_bottle_sizes.end());
+    VERIFY(bottle_size->value >= entry.quota_size);
+    bottle_size->value -= entry.quota_size;
+}
+
 void StorageJar::TransientStorage::delete_item(StorageLocation const& key)
 {
-    m_storage_items.remove(key);
+    auto entry = m_storage_items.find(key);
+    if (entry == m_storage_items.end())
+        return;
+
+    remove_from_bottle_size(key, entry->value);
+    m_storage_items.remove(entry);
 }
 
 void StorageJar::TransientStorage::delete_items_accessed_since(UnixDateTime since)
 {
-    m_storage_items.remove_all_matching([&](auto const&, auto const& entry) {
-        return entry.last_access_time >= since;
+    m_storage_items.remove_all_matching([&](auto const& key, auto const& entry) {
+        if (entry.last_access_time < since)
+            return false;
+        remove_from_bottle_size(key, entry);
+        return true;
     });
 }
 
 void StorageJar::TransientStorage::clear(StorageEndpointType storage_endpoint, String const& storage_key)
 {
-    Vector<StorageLocation> keys_to_remove;
-    for (auto const& [key, value] : m_storage_items) {
-        if (key.storage_endpoint == storage_endpoint && key.storage_key == storage_key)
-            keys_to_remove.append(key);
-    }
-
-    for (auto const& key : keys_to_remove)
-        m_storage_items.remove(key);
+    m_storage_items.remove_all_matching([&](auto const& key, auto const&) {
+        return key.storage_endpoint == storage_endpoint && key.storage_key == storage_key;
+    });
+    m_bottle_sizes.remove(StorageBottleLocation { storage_endpoint, storage_key });
 }
 
 Vector<Utf16String> StorageJar::TransientStorage::get_keys(StorageEndpointType storage_endpoint, String const& storage_key)
@@ -226,75 +332,93 @@ Requests::CacheSizes StorageJar::TransientStorage::estimate_storage_size_accesse
     return sizes;
 }
 
-Optional<Utf16String> StorageJar::PersistedStorage::get_item(StorageLocation const& key)
+u64 StorageJar::TransientStorage::usage(String const& storage_key)
 {
-    Optional<String> result;
-    auto bottle_key = storage_string_to_database_string(key.bottle_key);
+    u64 current_size_in_bytes = 0;
+    for (auto const& [bottle, size] : m_bottle_sizes) {
+        if (bottle.storage_key == storage_key)
+            current_size_in_bytes += size;
+    }
+    return current_size_in_bytes;
+}
 
+void StorageJar::PersistedStorage::load_bottle(StorageBottleLocation const& bottle_location, TransientStorage& transient_storage)
+{
     database.execute_statement(
-        statements.get_item,
+        statements.get_bottle,
         [&](auto statement_id) {
-            result = database.result_column<String>(statement_id, 0);
-        },
-        to_underlying(key.storage_endpoint),
-        key.storage_key,
-        bottle_key);
+            auto bottle_key = storage_string_from_database_string(database.result_column<String>(statement_id, 0));
+            auto bottle_value = storage_string_from_database_string(database.result_column<String>(statement_id, 1));
+            auto last_access_time = database.result_column<UnixDateTime>(statement_id, 2);
 
-    if (result.has_value()) {
-        database.execute_statement(
-            statements.update_last_access_time,
-            {},
-            UnixDateTime::now(),
-            to_underlying(key.storage_endpoint),
-            key.storage_key,
-            bottle_key);
-    }
+            StorageLocation storage_location { bottle_location.storage_endpoint, bottle_location.storage_key, move(bottle_key) };
+            transient_storage.load_item(storage_location, move(bottle_value), last_access_time);
+        },
+        to_underlying(bottle_location.storage_endpoint),
+        bottle_location.storage_key);
 
-    return result.map(storage_string_from_database_string);
+    loaded_bottles.set(bottle_location);
 }
 
-StorageSetResult StorageJar::PersistedStorage::set_item(StorageLocation const& key, Utf16String const& value)
+void StorageJar::PersistedStorage::write_back(TransientStorage const& transient_storage)
 {
-    auto old_value = get_item(key);
-    auto bottle_key = storage_string_to_database_string(key.bottle_key);
-    auto bottle_value = storage_string_to_database_string(value);
-
-    size_t current_size = 0;
-    database.execute_statement(
-        statements.calculate_size_excluding_bottle_key,
-        [&](auto statement_id) {
-            current_size = database.result_column<int>(statement_id, 0);
-        },
-        to_underlying(key.storage_endpoint),
-        key.storage_key,
-        bottle_key);
+    if (cleared_bottles.is_empty() && changed_items.is_empty() && accessed_items.is_empty())
+        return;
+
+    // If the database is busy, the changes stay pending and are written back by the next synchronization.
+    Database::Database::Transaction transaction { database };
+    if (auto result = transaction.begin(); result.is_error()) {
+        dbgln("Unable to write back web storage changes: {}", result.error());
+        return;
+    }
 
-    auto new_size = bottle_key.bytes().size() + bottle_value.bytes().size();
-    if (current_size + new_size > LOCAL_STORAGE_QUOTA)
-        return StorageOperationError::QuotaExceededError;
+    for (auto const& bottle_location : cleared_bottles)
+        database.execute_statement(statements.clear, {}, to_underlying(bottle_location.storage_endpoint), bottle_location.storage_key);
+
+    for (auto const& storage_location : changed_items) {
+        auto bottle_key = storage_string_to_database_string(storage_location.bottle_key);
+
+        if (auto entry = transient_storage.entry(storage_location); entry.has_value()) {
+            database.execute_statement(
+                statements.set_item,
+                {},
+                to_underlying(storage_location.storage_endpoint),
+                storage_location.storage_key,
+                bottle_key,
+                storage_string_to_database_string(entry->value),
+                entry->last_access_time);
+        } else {
+            database.execute_statement(
+                statements.delete_item,
+                {},
+                to_underlying(storage_location.storage_endpoint),
+                storage_location.storage_key,
+                bottle_key);
+        }
+    }
 
-    database.execute_statement(
-        statements.set_item,
-        {},
-        to_underlying(key.storage_endpoint),
-        key.storage_key,
-        bottle_key,
-        bottle_value,
-        UnixDateTime::now());
+    for (auto const& storage_location : accessed_items) {
+        auto entry = transient_storage.entry(storage_location);
+        if (!entry.has_value())
+            continue;
 
-    return old_value;
-}
+        database.execute_statement(
+            statements.update_last_access_time,
+            {},
+            entry->last_access_time,
+            to_underlying(storage_location.storage_endpoint),
+            storage_location.storage_key,
+            storage_string_to_database_string(storage_location.bottle_key));
+    }
 
-void StorageJar::PersistedStorage::delete_item(StorageLocation const& key)
-{
-    auto bottle_key = storage_string_to_database_string(key.bottle_key);
+    if (auto result = transaction.commit(); result.is_error()) {
+        dbgln("Unable to write back web storage changes: {}", result.error());
+        return;
+    }
 
-    database.execute_statement(
-        statements.delete_item,
-        {},
-        to_underlying(key.storage_endpoint),
-        key.storage_key,
-        bottle_key);
+    cleared_bottles.clear();
+    changed_items.clear();
+    accessed_items.clear();
 }
 
 void StorageJar::PersistedStorage::delete_items_accessed_since(UnixDateTime since)
@@ -302,30 +426,6 @@ void StorageJar::PersistedStorage::delete_items_accessed_since(UnixDateTime sinc
     database.execute_statement(statements.delete_items_accessed_since, {}, since);
 }
 
-void StorageJar::PersistedStorage::clear(StorageEndpointType storage_endpoint, String const& storage_key)
-{
-    database.execute_statement(
-        statements.clear,
-        {},
-        to_underlying(storage_endpoint),
-        storage_key);
-}
-
-Vector<Utf16String> StorageJar::PersistedStorage::get_keys(StorageEndpointType storage_endpoint, String const& storage_key)
-{
-    Vector<Utf16String> keys;
-
-    database.execute_statement(
-        statements.get_keys,
-        [&](auto statement_id) {
-            keys.append(storage_string_from_database_string(database.result_column<String>(statement_id, 0)));
-        },
-        to_underlying(storage_endpoint),
-        storage_key);
-
-    return keys;
-}
-
 u64 StorageJar::PersistedStorage::usage(String const& storage_key)
 {
     u64 current_size_in_bytes = 0;
@@ -355,14 +455,4 @@ Requests::CacheSizes StorageJar::PersistedStorage::estimate_storage_size_accesse
     return sizes;
 }
 
-u64 StorageJar::TransientStorage::usage(String const& storage_key)
-{
-    u64 current_size_in_bytes = 0;
-    for (auto const& [key, entry] : m_storage_items) {
-        if (key.storage_key == storage_key)
-            current_size_in_bytes += entry.quota_size;
-    }
-    return current_size_in_bytes;
-}
-
 }
@@ -7,10 +7,12 @@
 #pragma once
 
 #include <AK/HashMap.h>
+#include <AK/HashTable.h>
 #include <AK/String.h>
 #include <AK/Time.h>
 #include <AK/Traits.h>
 #include <AK/Utf16String.h>
+#include <LibCore/Timer.h>
 #include <LibDatabase/Forward.h>
 #include <LibRequests/CacheSizes.h>
 #include <LibWeb/StorageAPI/StorageEndpoint.h>
@@ -29,6 +31,13 @@ struct StorageLocation {
     Utf16String bottle_key;
 };
 
+struct StorageBottleLocation {
+    bool operator==(StorageBottleLocation const&) const = default;
+
+    StorageEndpointType storage_endpoint;
+    String storage_key;
+};
+
 class WEBVIEW_API StorageJar {
     AK_MAKE_NONCOPYABLE(StorageJar);
     AK_MAKE_NONMOVABLE(StorageJar);
@@ -48,26 +57,36 @@ public:
     void clear_storage_key(StorageEndpointType storage_endpoint, String const& storage_key);
     Vector<Utf16String> get_all_keys(StorageEndpointType storage_endpoint, String const& storage_key);
     u64 usage(String const& storage_key);
-    Requests::CacheSizes estimate_storage_size_accessed_since(UnixDateTime since) const;
+    Requests::CacheSizes estimate_storage_size_accessed_since(UnixDateTime since);
+
+    // Writes every change that has not been persisted yet to the database.
+    void synchronize();
 
 private:
     struct Statements {
-        Database::StatementID get_item { 0 };
+        Database::StatementID get_bottle { 0 };
         Database::StatementID set_item { 0 };
         Database::StatementID delete_item { 0 };
         Database::StatementID delete_items_accessed_since { 0 };
         Database::StatementID update_last_access_time { 0 };
         Database::StatementID clear { 0 };
-        Database::StatementID get_keys { 0 };
-        Database::StatementID calculate_size_excluding_bottle_key { 0 };
         Database::StatementID calculate_size { 0 };
         Database::StatementID estimate_storage_size_accessed_since { 0 };
     };
 
     class TransientStorage {
     public:
+        struct Entry {
+            Utf16String value;
+            UnixDateTime last_access_time;
+            // Bytes this entry contributes toward its storage key's quota: Its bottle key plus its value.
+            u64 quota_size { 0 };
+        };
+
         Optional<Utf16String> get_item(StorageLocation const& key);
         StorageSetResult set_item(StorageLocation const& key, Utf16String const& value);
+        void load_item(StorageLocation const& key, Utf16String value, UnixDateTime last_access_time);
+        Optional<Entry const&> entry(StorageLocation const& key) const;
         void delete_item(StorageLocation const& key);
         void delete_items_accessed_since(UnixDateTime);
         void clear(StorageEndpointType storage_endpoint, String const& storage_key);
@@ -76,32 +95,40 @@ private:
         Requests::CacheSizes estimate_storage_size_accessed_since(UnixDateTime since) const;
 
     private:
-        struct Entry {
-            Utf16String value;
-            UnixDateTime last_access_time;
-            // Bytes this entry contributes toward its storage key's quota: Its bottle key plus its value.
-            u64 quota_size { 0 };
-        };
+        void remove_from_bottle_size(StorageLocation const& key, Entry const&);
 
         HashMap<StorageLocation, Entry> m_storage_items;
+
+        // The quota size of each bottle's items, so that setting an item need not add them all up again.
+        HashMap<StorageBottleLocation, u64> m_bottle_sizes;
     };
 
+    // Items are read from the database one storage bottle at a time, the first time a bottle is used, and are then
+    // served from the transient storage. Changes are written back to the database in batches.
     struct PersistedStorage {
-        Optional<Utf16String> get_item(StorageLocation const& key);
-        StorageSetResult set_item(StorageLocation const& key, Utf16String const& value);
-        void delete_item(StorageLocation const& key);
+        void load_bottle(StorageBottleLocation const&, TransientStorage&);
+        void write_back(TransientStorage const&);
         void delete_items_accessed_since(UnixDateTime);
-        void clear(StorageEndpointType storage_endpoint, String const& storage_key);
-        Vector<Utf16String> get_keys(StorageEndpointType storage_endpoint, String const& storage_key);
         u64 usage(String const& storage_key);
         Requests::CacheSizes estimate_storage_size_accessed_since(UnixDateTime since) const;
 
         Database::Database& database;
         Statements statements;
+
+        HashTable<StorageBottleLocation> loaded_bottles {};
+        Vector<StorageBottleLocation> cleared_bottles {};
+        HashTable<StorageLocation> changed_items {};
+        HashTable<StorageLocation> accessed_items {};
+        RefPtr<Core::Timer> synchronization_timer {};
     };
 
     explicit StorageJar(Optional<PersistedStorage>);
 
+    void ensure_bottle_is_loaded(StorageEndpointType, String const& storage_key);
+    void did_access_item(StorageLocation const&);
+    void did_change_item(StorageLocation const&);
+    void schedule_synchronization();
+
     Optional<PersistedStorage> m_persisted_storage;
     TransientStorage m_transient_storage;
 };
@@ -119,3 +146,11 @@ struct AK::Traits<WebView::StorageLocation> : public AK::DefaultTraits<WebView::
         return hash;
     }
 };
+
+template<>
+struct AK::Traits<WebView::StorageBottleLocation> : public AK::DefaultTraits<WebView::StorageBottleLocation> {
+    static unsigned hash(WebView::StorageBottleLocation const& key)
+    {
+        return pair_int_hash(to_underlying(key.storage_endpoint), key.storage_key.hash());
+    }
+};
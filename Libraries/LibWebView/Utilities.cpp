@@ -15,6 +15,7 @@
 #include <LibCore/File.h>
 #include <LibCore/Process.h>
 #include <LibCore/Resource.h>
+#include <LibCore/ResourceImplementationArchive.h>
 #include <LibCore/ResourceImplementationFile.h>
 #include <LibCore/System.h>
 #include <LibFileSystem/FileSystem.h>
@@ -96,7 +97,19 @@ void platform_init(Optional<ByteString> ladybird_binary_path)
 #endif
     }();
 
-    Core::ResourceImplementation::install(make<Core::ResourceImplementationFile>(MUST(String::from_byte_string(s_ladybird_resource_root))));
+    auto resource_root = MUST(String::from_byte_string(s_ladybird_resource_root));
+
+    auto resource_archive_path = LexicalPath::join(s_ladybird_resource_root, "resources.archive"sv).string();
+    if (FileSystem::exists(resource_archive_path)) {
+        auto archive = Core::ResourceImplementationArchive::create(resource_root, resource_archive_path);
+        if (!archive.is_error()) {
+            Core::ResourceImplementation::install(archive.release_value());
+            return;
+        }
+        warnln("Unable to load resource archive {}: {}", resource_archive_path, archive.error());
+    }
+
+    Core::ResourceImplementation::install(make<Core::ResourceImplementationFile>(move(resource_root)));
 }
 
 ErrorOr<Vector<ByteString>> get_paths_for_helper_process(StringView process_name)
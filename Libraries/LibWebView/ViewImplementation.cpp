@@ -275,6 +275,49 @@ void ViewImplementation::set_system_visibility_state(Web::HTML::VisibilityState
 
     m_top_level_traversable.set_system_visibility_state(visibility_state);
     client().async_set_system_visibility_state(m_client_state.page_index, visibility_state);
+
+    if (visibility_state == Web::HTML::VisibilityState::Hidden) {
+        m_hidden_since = MonotonicTime::now_coarse();
+        return;
+    }
+
+    m_hidden_since.clear();
+
+    // The placeholder of a discarded page is shown the same way as a crash page, so it is reloaded the same way too.
+    if (exchange(m_is_discarded, false) && m_is_showing_crash_page)
+        reload();
+}
+
+void ViewImplementation::discard_if_idle_in_background(Web::MemoryPressureLevel level)
+{
+    static constexpr auto moderate_pressure_idle_time = AK::Duration::from_seconds(10 * 60);
+    static constexpr auto critical_pressure_idle_time = AK::Duration::from_seconds(60);
+
+    if (m_is_discarded || m_is_showing_crash_page || m_is_loading || !m_hidden_since.has_value())
+        return;
+
+    // Discarding a page that's playing audio would be noticed.
+    if (m_audio_play_state == Web::HTML::AudioPlayState::Playing)
+        return;
+
+    auto idle_time = MonotonicTime::now_coarse() - *m_hidden_since;
+    if (idle_time < (level == Web::MemoryPressureLevel::Critical ? critical_pressure_idle_time : moderate_pressure_idle_time))
+        return;
+
+    dbgln_if(WEBVIEW_PROCESS_DEBUG, "Discarding background page {} after {}s", m_url, idle_time.to_seconds());
+
+    // Keep the tab's title and icon while the page is discarded.
+    StringBuilder builder;
+    builder.append("<!doctype html><html><head><meta charset=\"UTF-8\" />"sv);
+    builder.appendff("<title>{}</title>", m_title.escape_html_entities());
+    if (m_favicon_base64_png.has_value())
+        builder.appendff("<link rel=\"icon\" href=\"data:image/png;base64,{}\" />", *m_favicon_base64_png);
+    else
+        builder.append(NO_FALLBACK_FAVICON_LINK);
+    builder.append("</head><body></body></html>"sv);
+
+    load_crash_page_html(builder.string_view(), m_url);
+    m_is_discarded = true;
 }
 
 void ViewImplementation::load(URL::URL const& url, Web::Bindings::NavigationHistoryBehavior history_handling)
@@ -837,6 +880,16 @@ void ViewImplementation::inspect_accessibility_tree()
     client().async_inspect_accessibility_tree(page_id());
 }
 
+void ViewImplementation::start_sampling_profiler()
+{
+    client().async_start_sampling_profiler(page_id());
+}
+
+void ViewImplementation::stop_sampling_profiler()
+{
+    client().async_stop_sampling_profiler(page_id());
+}
+
 void ViewImplementation::get_hovered_node_id()
 {
     client().async_get_hovered_node_id(page_id());
@@ -17,6 +17,7 @@
 #include <AK/OwnPtr.h>
 #include <AK/Queue.h>
 #include <AK/String.h>
+#include <AK/Time.h>
 #include <AK/Types.h>
 #include <AK/Utf16String.h>
 #include <AK/Weakable.h>
@@ -46,6 +47,7 @@
 #include <LibWeb/HTML/SelectItem.h>
 #include <LibWeb/Page/EventResult.h>
 #include <LibWeb/Page/InputEvent.h>
+#include <LibWeb/Page/MemoryPressureLevel.h>
 #include <LibWeb/Page/ScreenWakeLockHandle.h>
 #include <LibWeb/Page/ViewportIsFullscreen.h>
 #include <LibWeb/WebDriver/Response.h>
@@ -105,6 +107,11 @@ public:
 
     void set_system_visibility_state(Web::HTML::VisibilityState);
 
+    // Replaces the page of a tab that has been in the background for long enough with a placeholder, letting
+    // WebContent free the page. The page is restored from the session history once the tab becomes visible again.
+    void discard_if_idle_in_background(Web::MemoryPressureLevel);
+    bool is_discarded() const { return m_is_discarded; }
+
     void load(URL::URL const&, Web::Bindings::NavigationHistoryBehavior = Web::Bindings::NavigationHistoryBehavior::Auto);
     void set_next_history_visit_transition(HistoryVisitTransition transition) { m_history_visit_transition_for_next_load = transition; }
     void load_html(StringView);
@@ -187,6 +194,8 @@ public:
     Optional<Utf16String> remove_session_storage_item(Utf16String const& key);
     bool clear_session_storage();
     void inspect_accessibility_tree();
+    void start_sampling_profiler();
+    void stop_sampling_profiler();
     void get_hovered_node_id();
     void start_node_picker(DevTools::DevToolsDelegate::OnNodePickerEvent);
     void stop_node_picker();
@@ -355,6 +364,7 @@ public:
     Function<void(Optional<JsonObject>)> on_received_current_grid;
     Function<void(Optional<JsonObject>)> on_received_current_flexbox;
     Function<void(JsonObject)> on_received_accessibility_tree;
+    Function<void(JsonObject)> on_received_sampling_profile;
     Function<void(Web::UniqueNodeID)> on_received_hovered_node_id;
     Function<void(Mutation)> on_dom_mutation_received;
     Function<void(Optional<Web::UniqueNodeID> const& node_id)> on_finished_editing_dom_node;
@@ -532,6 +542,8 @@ protected:
     Utf16String m_title;
     Optional<String> m_favicon_base64_png;
     bool m_is_showing_crash_page { false };
+    bool m_is_discarded { false };
+    Optional<MonotonicTime> m_hidden_since;
 
     double m_zoom_level { 1.0 };
     double m_device_pixel_ratio { 1.0 };
@@ -1102,6 +1102,14 @@ void WebContentClient::did_inspect_accessibility_tree(u64 page_id, String access
     }
 }
 
+void WebContentClient::did_stop_sampling_profiler(u64 page_id, String profile)
+{
+    if (auto view = view_for_page_id(page_id); view.has_value()) {
+        if (view->on_received_sampling_profile)
+            view->on_received_sampling_profile(parse_json(profile, "sampling profile"sv));
+    }
+}
+
 void WebContentClient::did_get_hovered_node_id(u64 page_id, Web::UniqueNodeID node_id)
 {
     if (auto view = view_for_page_id(page_id); view.has_value()) {
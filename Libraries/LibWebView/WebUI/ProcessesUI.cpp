@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibIPC/Tracing.h>
 #include <LibWebView/Application.h>
 #include <LibWebView/ProcessManager.h>
 #include <LibWebView/SiteIsolationManager.h>
@@ -53,6 +54,30 @@ void ProcessesUI::update_process_statistics()
     };
 
     async_send_message("loadProcessStatistics"sv, serialize_process_statistics());
+
+    if (IPC::MessageTracing::is_enabled())
+        async_send_message("loadIPCTraces"sv, serialize_ipc_traces());
+}
+
+JsonArray ProcessesUI::serialize_ipc_traces()
+{
+    JsonArray serialized;
+
+    for (auto const& trace : IPC::MessageTracing::traces()) {
+        JsonObject object;
+        object.set("name"sv, trace.message_name);
+        object.set("count"sv, trace.encoded_size.count());
+        object.set("sizeP50"sv, trace.encoded_size.value_at_percentile(50));
+        object.set("queuedP50"sv, trace.queueing_delay.value_at_percentile(50));
+        object.set("queuedP99"sv, trace.queueing_delay.value_at_percentile(99));
+        object.set("handlerP50"sv, trace.handler_time.value_at_percentile(50));
+        object.set("handlerP99"sv, trace.handler_time.value_at_percentile(99));
+        object.set("handlerMax"sv, trace.handler_time.max());
+        object.set("handlerTotal"sv, trace.handler_time.total());
+        serialized.must_append(move(object));
+    }
+
+    return serialized;
 }
 
 }
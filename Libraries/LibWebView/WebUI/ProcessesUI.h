@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/JsonArray.h>
 #include <LibWebView/Forward.h>
 #include <LibWebView/WebUI.h>
 
@@ -18,6 +19,7 @@ private:
     virtual void register_interfaces() override;
 
     void update_process_statistics();
+    static JsonArray serialize_ipc_traces();
 };
 
 }
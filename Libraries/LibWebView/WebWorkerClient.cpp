@@ -23,6 +23,11 @@ WebWorkerClient::~WebWorkerClient() = default;
 
 void WebWorkerClient::die()
 {
+    if (m_agent_id == 0) {
+        WorkerProcessManager::the().spare_worker_did_die(*this);
+        return;
+    }
+
     WorkerProcessManager::the().worker_did_die(m_agent_id);
 
     // Otherwise nested workers we own would outlive us, in violation of the HTML spec.
@@ -110,18 +110,19 @@ Web::HTML::WorkerAgentId WorkerProcessManager::start_worker_agent(Owner owner, W
 
     // 11.6. Otherwise, in parallel, run a worker given worker, urlRecord, outsideSettings, outsidePort,
     //       and options.
-    // AD-HOC: For DedicatedWorker there is no shared worker manager step; we always launch a fresh
-    //         worker process here.
+    // AD-HOC: For DedicatedWorker there is no shared worker manager step; we always run the worker in a
+    //         fresh worker process here.
+    // OPTIMIZATION: Hand the worker to an already running spare process when there is one, and make sure a replacement
+    //               is started once the current task is done. A page that starts one worker usually starts more.
     auto agent_id = ++m_next_agent_id;
-    auto client = MUST(launch_web_worker_process(request.agent_type, is_private, agent_id));
-
-    auto request_server_handle = MUST(connect_new_request_server_client(is_private));
-    auto image_decoder_handle = MUST(connect_new_image_decoder_client());
-    client->async_connect_to_request_server(move(request_server_handle));
-    client->async_connect_to_image_decoder(move(image_decoder_handle));
+    RefPtr<WebWorkerClient> maybe_client = take_spare_worker_process(request.agent_type, is_private);
+    if (maybe_client)
+        maybe_client->set_agent_id(agent_id);
+    else
+        maybe_client = MUST(launch_connected_worker_process(request.agent_type, is_private, agent_id));
+    auto client = maybe_client.release_nonnull();
 
-    if (auto compositor_handle = Application::the().connect_new_compositor_canvas_client(); !compositor_handle.is_error())
-        client->async_connect_to_compositor(compositor_handle.release_value());
+    schedule_spare_worker_process(request.agent_type, is_private);
 
     Vector<Owner> owners;
     owners.append(owner);
@@ -426,4 +427,78 @@ void WorkerProcessManager::remove_owner(Web::HTML::WorkerAgentId agent_id, Owner
         remove_agent(agent_id);
 }
 
+ErrorOr<NonnullRefPtr<WebWorkerClient>> WorkerProcessManager::launch_connected_worker_process(Web::Bindings::AgentType agent_type, IsPrivate is_private, Web::HTML::WorkerAgentId agent_id)
+{
+    auto client = TRY(launch_web_worker_process(agent_type, is_private, agent_id));
+
+    auto request_server_handle = TRY(connect_new_request_server_client(is_private));
+    auto image_decoder_handle = TRY(connect_new_image_decoder_client());
+    client->async_connect_to_request_server(move(request_server_handle));
+    client->async_connect_to_image_decoder(move(image_decoder_handle));
+
+    if (auto compositor_handle = Application::the().connect_new_compositor_canvas_client(); !compositor_handle.is_error())
+        client->async_connect_to_compositor(compositor_handle.release_value());
+
+    return client;
+}
+
+RefPtr<WebWorkerClient> WorkerProcessManager::take_spare_worker_process(Web::Bindings::AgentType agent_type, IsPrivate is_private)
+{
+    // Spare processes are not bound to any site until they are handed a worker, so any spare of the right kind will do.
+    for (size_t i = 0; i < m_spare_worker_processes.size(); ++i) {
+        auto& spare = m_spare_worker_processes[i];
+        if (spare.agent_type != agent_type || spare.is_private != is_private)
+            continue;
+
+        auto client = spare.client;
+        m_spare_worker_processes.remove(i);
+
+        if (!client->is_open())
+            return nullptr;
+        return client;
+    }
+
+    return nullptr;
+}
+
+void WorkerProcessManager::schedule_spare_worker_process(Web::Bindings::AgentType agent_type, IsPrivate is_private)
+{
+    if (m_spare_worker_process_scheduled)
+        return;
+    m_spare_worker_process_scheduled = true;
+
+    Core::deferred_invoke([this, agent_type, is_private] {
+        m_spare_worker_process_scheduled = false;
+
+        auto has_spare = m_spare_worker_processes.contains([&](auto const& spare) {
+            return spare.agent_type == agent_type && spare.is_private == is_private;
+        });
+        if (has_spare)
+            return;
+
+        // A spare is only an optimization, so failing to start one is not an error for anyone.
+        auto client = launch_connected_worker_process(agent_type, is_private, 0);
+        if (client.is_error()) {
+            dbgln("Unable to launch spare WebWorker process: {}", client.error());
+            return;
+        }
+
+        m_spare_worker_processes.append({
+            .agent_type = agent_type,
+            .is_private = is_private,
+            .client = client.release_value(),
+        });
+    });
+}
+
+void WorkerProcessManager::spare_worker_did_die(WebWorkerClient& client)
+{
+    // The pool may hold the last reference to the client, so it is dropped outside of the client's own callback.
+    Core::deferred_invoke([this, client = NonnullRefPtr { client }] {
+        m_spare_worker_processes.remove_first_matching([&](auto const& spare) {
+            return spare.client.ptr() == client.ptr();
+        });
+    });
+}
+
 }
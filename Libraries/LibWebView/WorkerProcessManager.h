@@ -9,6 +9,7 @@
 #include <AK/HashMap.h>
 #include <AK/NonnullRefPtr.h>
 #include <AK/Optional.h>
+#include <AK/RefPtr.h>
 #include <AK/Utf16String.h>
 #include <AK/Variant.h>
 #include <AK/Vector.h>
@@ -80,6 +81,11 @@ private:
     void remove_agent(Web::HTML::WorkerAgentId);
     void remove_owner(Web::HTML::WorkerAgentId, Owner const& identity);
 
+    ErrorOr<NonnullRefPtr<WebWorkerClient>> launch_connected_worker_process(Web::Bindings::AgentType, IsPrivate, Web::HTML::WorkerAgentId);
+    RefPtr<WebWorkerClient> take_spare_worker_process(Web::Bindings::AgentType, IsPrivate);
+    void schedule_spare_worker_process(Web::Bindings::AgentType, IsPrivate);
+    void spare_worker_did_die(WebWorkerClient&);
+
     struct WorkerAgent {
         Web::HTML::WorkerAgentId id { 0 };
         NonnullRefPtr<WebWorkerClient> client;
@@ -94,7 +100,17 @@ private:
         Vector<Owner> owners;
     };
 
+    // A launched and fully connected WebWorker process that has not been handed a worker yet. Starting a worker on one
+    // of these skips process launch and the helper process handshakes, which otherwise dominate worker startup.
+    struct SpareWorkerProcess {
+        Web::Bindings::AgentType agent_type { Web::Bindings::AgentType::DedicatedWorker };
+        IsPrivate is_private { IsPrivate::No };
+        NonnullRefPtr<WebWorkerClient> client;
+    };
+
     Web::HTML::WorkerAgentId m_next_agent_id { 0 };
+    Vector<SpareWorkerProcess> m_spare_worker_processes;
+    bool m_spare_worker_process_scheduled { false };
     HashMap<Web::HTML::WorkerAgentId, WorkerAgent> m_agents;
     HashMap<SharedWorkerKey, Web::HTML::WorkerAgentId> m_shared_workers;
 };
@@ -503,7 +503,7 @@ static xmlSAXHandler create_sax_handler(bool preserve_comments, bool resolve_htm
 
 ErrorOr<void, ParseError> Parser::parse_with_listener(Listener& listener)
 {
-    auto source_result = listener.set_source(ByteString(m_source));
+    auto source_result = listener.set_source(m_source);
     if (source_result.is_error())
         return ParseError { {}, ByteString("Failed to set source") };
 
@@ -54,6 +54,7 @@ set(RESOURCE_DEBUG ON)
 set(SPAM_DEBUG ON)
 set(STRUCTURED_SERIALIZE_DEBUG ON)
 set(STYLE_INVALIDATION_DEBUG ON)
+set(SYNC_IPC_DEBUG ON)
 set(SYNTAX_HIGHLIGHTING_DEBUG ON)
 set(TEXTEDITOR_DEBUG ON)
 set(TIFF_DEBUG ON)
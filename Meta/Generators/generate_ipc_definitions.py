@@ -369,7 +369,8 @@ public:""")
     virtual u32 endpoint_magic() const override {{ return ENDPOINT_MAGIC; }}
     virtual i32 message_id() const override {{ return (int)MessageID::{pascal_name}; }}
     static i32 static_message_id() {{ return (int)MessageID::{pascal_name}; }}
-    virtual StringView message_name() const override {{ return "{endpoint.name}::{pascal_name}"sv; }}
+    virtual StringView message_name() const override {{ return static_message_name(); }}
+    static StringView static_message_name() {{ return "{endpoint.name}::{pascal_name}"sv; }}
 
     static ErrorOr<NonnullOwnPtr<{pascal_name}>> decode(Stream& stream, Queue<IPC::Attachment>& attachments)
     {{
@@ -436,6 +437,7 @@ def write_proxy_method(
     is_synchronous: bool,
     is_try: bool,
     is_unicode_string_overload: bool = False,
+    with_promise: bool = False,
 ) -> None:
     # FIXME: For String parameters, we want to retain the property that all tranferred String objects are strictly UTF-8.
     #        So instead of generating a single proxy method that accepts StringView parameters, we generate two overloads.
@@ -456,9 +458,14 @@ def write_proxy_method(
     inner_return_type = return_type
     if is_try:
         return_type = f"IPC::IPCErrorOr<{return_type}>"
+    elif with_promise:
+        inner_return_type = "Empty" if return_type == "void" else return_type
+        return_type = f"NonnullRefPtr<Core::Promise<{inner_return_type}>>"
 
     pascal_name = pascal_case(message.name)
     method_name = ("try_" if is_try else "") + ("" if is_synchronous else "async_") + message.name
+    if with_promise:
+        method_name = f"async_{message.name}_with_response"
 
     signature_params: List[str] = []
     for parameter in parameters:
@@ -491,7 +498,27 @@ def write_proxy_method(
             call_args_parts.append(f"move({parameter.name})")
     call_args = ", ".join(call_args_parts)
 
-    if is_synchronous and not is_try:
+    if with_promise:
+        if len(message.outputs) == 1:
+            output = message.outputs[0]
+            accessor = output.name if is_primitive_or_simple_type(output.type) else f"take_{output.name}"
+            resolution = f"response->{accessor}()"
+        elif message.outputs:
+            resolution = "move(*response)"
+        else:
+            resolution = "Empty {}"
+        trailing_args = f", {call_args}" if call_args else ""
+        out.write(f"""
+        auto promise = Core::Promise<{inner_return_type}>::construct();
+        m_connection.template send_with_response_handler<Messages::{endpoint.name}::{pascal_name}>([promise](auto response) {{
+            if (!response) {{
+                promise->reject(Error::from_string_literal("IPC peer disconnected before responding"));
+                return;
+            }}
+            promise->resolve({resolution});
+        }}{trailing_args});
+        return promise;""")
+    elif is_synchronous and not is_try:
         sync_call = f"m_connection.template send_sync<Messages::{endpoint.name}::{pascal_name}>({call_args})"
 
         if return_type == "void":
@@ -555,6 +582,7 @@ public:
         if message.is_synchronous:
             write_proxy_method(out, endpoint, message, message.inputs, is_synchronous=False, is_try=False)
             write_proxy_method(out, endpoint, message, message.inputs, is_synchronous=True, is_try=True)
+            write_proxy_method(out, endpoint, message, message.inputs, is_synchronous=True, is_try=False, with_promise=True)
 
     out.write("""
 private:
@@ -726,6 +754,7 @@ def build(out: TextIO, endpoints: List[Endpoint]) -> None:
 #include <AK/Platform.h>
 #include <AK/Result.h>
 #include <AK/Utf8View.h>
+#include <LibCore/Promise.h>
 #include <LibIPC/Attachment.h>
 #include <LibIPC/Connection.h>
 #include <LibIPC/Decoder.h>
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2026-present, the Ladybird developers.
+#
+# SPDX-License-Identifier: BSD-2-Clause
+
+r"""
+Packs resource files into a single archive that LibCore's ResourceImplementationArchive maps into memory.
+
+The archive is laid out as follows, with all integers stored as little-endian u32 values:
+
+    magic ("LRA1"), entry count
+    entries, sorted by path: path offset, path length, data offset, data size
+    paths (UTF-8, not null-terminated)
+    file contents, each one aligned to 16 bytes
+
+All offsets are relative to the start of the archive.
+"""
+
+import argparse
+import struct
+import sys
+
+from pathlib import Path
+
+MAGIC = b"LRA1"
+HEADER_FORMAT = "<4sI"
+ENTRY_FORMAT = "<IIII"
+DATA_ALIGNMENT = 16
+
+
+def align(offset: int) -> int:
+    return (offset + DATA_ALIGNMENT - 1) & ~(DATA_ALIGNMENT - 1)
+
+
+def parse_entries(arguments: list[str]) -> list[tuple[str, Path]]:
+    entries: dict[str, Path] = {}
+
+    for argument in arguments:
+        path, separator, source = argument.partition("=")
+        if not separator or not path or not source:
+            raise ValueError(f"Expected an entry of the form <path>=<source>, got '{argument}'")
+
+        path = path.strip("/")
+        if path in entries:
+            raise ValueError(f"Duplicate resource path '{path}'")
+        entries[path] = Path(source)
+
+    return sorted(entries.items())
+
+
+def write_archive(output_path: Path, entries: list[tuple[str, Path]]) -> None:
+    encoded_paths = [path.encode("utf-8") for path, _ in entries]
+    contents = [source.read_bytes() for _, source in entries]
+
+    paths_offset = struct.calcsize(HEADER_FORMAT) + len(entries) * struct.calcsize(ENTRY_FORMAT)
+    data_offset = align(paths_offset + sum(len(path) for path in encoded_paths))
+
+    header = bytearray(struct.pack(HEADER_FORMAT, MAGIC, len(entries)))
+    paths = bytearray()
+    data = bytearray()
+
+    for path, content in zip(encoded_paths, contents):
+        data_start = align(data_offset + len(data))
+        data.extend(b"\0" * (data_start - data_offset - len(data)))
+
+        header.extend(struct.pack(ENTRY_FORMAT, paths_offset + len(paths), len(path), data_start, len(content)))
+        paths.extend(path)
+        data.extend(content)
+
+    archive = header + paths
+    archive.extend(b"\0" * (data_offset - len(archive)))
+    archive.extend(data)
+
+    if len(archive) > 0xFFFFFFFF:
+        raise ValueError("Resource archive is larger than 4 GiB")
+
+    output_path.write_bytes(archive)
+
+
+def main():
+    parser = argparse.ArgumentParser(epilog=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("-o", "--output", required=True, help="output archive")
+    parser.add_argument("entries", nargs="*", help="resources to pack, as <path inside the archive>=<source file>")
+    args = parser.parse_args()
+
+    write_archive(Path(args.output), parse_entries(args.entries))
+
+
+if __name__ == "__main__":
+    sys.exit(main())
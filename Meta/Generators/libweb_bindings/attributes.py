@@ -81,6 +81,7 @@ def define_the_regular_attributes(
     out: TextIO,
     includes: GeneratedIncludes,
     interface: Interface,
+    lazy: bool = False,
 ) -> None:
     # 1. Let attributes be the list of regular attributes that are members of definition.
     attributes = [
@@ -91,7 +92,7 @@ def define_the_regular_attributes(
     attributes = [attribute for attribute in attributes if "LegacyUnforgeable" not in attribute.extended_attributes]
 
     # 3. Define the attributes attributes of definition on target given realm.
-    define_the_attributes(out, includes, attributes, interface)
+    define_the_attributes(out, includes, attributes, interface, lazy=lazy)
 
 
 def define_the_unforgeable_attributes(
@@ -112,6 +113,7 @@ def define_the_attributes(
     includes: GeneratedIncludes,
     attributes: list[Attribute],
     interface: Interface,
+    lazy: bool = False,
 ) -> None:
     if not attributes:
         return
@@ -120,6 +122,10 @@ def define_the_attributes(
 
     # 1. For each attribute attr of attributes:
     for attribute in attributes:
+        if lazy and "LegacyUnforgeable" not in attribute.extended_attributes:
+            define_the_attribute_lazily(out, includes, attribute)
+            continue
+
         getter_name = attribute_getter_callback_name(attribute)
         setter_name = attribute_setter_callback_name(attribute)
         cpp_name = attribute_callback_cpp_name(attribute)
@@ -179,6 +185,32 @@ def define_the_attributes(
         )
 
 
+# Defines the attribute with an intrinsic accessor, so that its getter and setter functions are only created once the
+# property is first looked up. Globals have hundreds of attributes, most of which a given page never touches.
+def define_the_attribute_lazily(out: TextIO, includes: GeneratedIncludes, attribute: Attribute) -> None:
+    includes.add("LibJS/Runtime/Accessor.h")
+
+    getter_name = attribute_getter_callback_name(attribute)
+    setter_name = attribute_setter_callback_name(attribute)
+
+    if attribute_has_setter(attribute):
+        native_setter = f'auto native_setter = JS::NativeFunction::create(realm, {setter_name}, 1, "{attribute.name}"_utf16_fly_string, &realm, "set"sv);'
+    else:
+        native_setter = "GC::Ptr<JS::NativeFunction> native_setter;"
+
+    definition = f"""    // 7. Perform ! DefinePropertyOrThrow(target, id, desc).
+    // NB: The getter and setter of desc are created when the property is first looked up.
+    object.define_intrinsic_accessor("{attribute.name}"_utf16_fly_string, default_attributes, [](JS::Realm& realm) -> JS::Value {{
+        auto native_getter = JS::NativeFunction::create(realm, {getter_name}, 0, "{attribute.name}"_utf16_fly_string, &realm, "get"sv);
+        {native_setter}
+        return JS::Accessor::create(realm.vm(), native_getter, native_setter);
+    }});
+
+"""
+
+    out.write(wrap_with_extended_attribute_exposure_checks(includes, attribute.extended_attributes, definition))
+
+
 def define_the_static_attributes(out: TextIO, includes: GeneratedIncludes, interface: Interface) -> None:
     for attribute in interface.static_attributes:
         if "FIXME" in attribute.extended_attributes:
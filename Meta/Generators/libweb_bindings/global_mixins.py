@@ -91,8 +91,9 @@ void {interface.name}GlobalMixin::initialize(JS::Realm& realm, [[maybe_unused]]
     object.set_prototype(&ensure_web_prototype<{interface.prototype_class}>(realm, "{interface.namespaced_name}"_utf16_fly_string));
 """
     )
-    define_the_regular_attributes(out, includes, interface)
-    define_the_regular_operations(out, includes, interface)
+    # NB: Every realm has its own global object, so its members are materialized lazily to keep realm creation cheap.
+    define_the_regular_attributes(out, includes, interface, lazy=True)
+    define_the_regular_operations(out, includes, interface, lazy=True)
     define_the_stringifier(out, includes, interface)
     define_the_constants(out, context, includes, interface)
     out.write(
@@ -79,11 +79,26 @@ def define_the_regular_operations(
     includes: GeneratedIncludes,
     interface: Interface,
     unforgeable: bool = False,
+    lazy: bool = False,
 ) -> None:
     for name, operations in overload_resolution.operation_overload_sets(interface).items():
         if any("LegacyUnforgeable" in operation.extended_attributes for operation in operations) != unforgeable:
             continue
         operation = operations[0]
+        if lazy and not unforgeable:
+            # NB: The function object is only created once the property is first looked up.
+            out.write(
+                wrap_with_extended_attribute_exposure_checks(
+                    includes,
+                    operation.extended_attributes,
+                    f"""    object.define_intrinsic_accessor("{name}"_utf16_fly_string, default_attributes, [](JS::Realm& realm) -> JS::Value {{
+        return JS::NativeFunction::create(realm, {idl_identifier_cpp_name(operation)}, {overload_resolution.operation_overload_set_length(operations)}, "{name}"_utf16_fly_string, &realm);
+    }});
+
+""",
+                )
+            )
+            continue
         out.write(
             wrap_with_extended_attribute_exposure_checks(
                 includes,
@@ -27,13 +27,22 @@ CanvasHost::~CanvasHost()
         m_canvas_surface_registry.remove_canvas_surface(canvas_id);
 }
 
-OwnPtr<Gfx::CanvasCommandPlayer> CanvasHost::create_2d_command_player(Gfx::IntSize size, bool alpha)
+OwnPtr<Gfx::CanvasCommandPlayer> CanvasHost::create_2d_command_player(Gfx::IntSize size, bool alpha, bool will_read_frequently)
 {
     if (size.is_empty() || static_cast<i64>(size.width()) * static_cast<i64>(size.height()) > Gfx::max_canvas_area)
         return nullptr;
 
+    // https://html.spec.whatwg.org/multipage/canvas.html#concept-canvas-will-read-frequently
+    // "When a CanvasRenderingContext2D object's will read frequently is true, the user agent may optimize the canvas
+    //  for readback operations."
+    // NB: Reading back a GPU surface stalls on the GPU and copies the pixels across the bus every time, so such canvases
+    //     are kept in a CPU raster surface instead, where readback is a plain memory copy.
+    RefPtr<Gfx::SkiaBackendContext> skia_backend_context;
+    if (!will_read_frequently)
+        skia_backend_context = m_skia_backend_context;
+
     auto format = alpha ? Gfx::BitmapFormat::BGRA8888 : Gfx::BitmapFormat::BGRx8888;
-    auto player = make<Gfx::CanvasCommandPlayer>(m_skia_backend_context, size, format, Gfx::AlphaType::Premultiplied, [this](u64 canvas_id) -> Gfx::PaintingSurface const* {
+    auto player = make<Gfx::CanvasCommandPlayer>(skia_backend_context, size, format, Gfx::AlphaType::Premultiplied, [this](u64 canvas_id) -> Gfx::PaintingSurface const* {
         // A 2D source resolves to its live draw surface: the shared command
         // stream replays in recording order, so at this point the surface holds
         // exactly the commands recorded before the referencing DrawCanvas.
@@ -77,9 +86,9 @@ HostWebGLContext& CanvasHost::as_webgl(Context& context)
     return **webgl_context;
 }
 
-Optional<Web::Painting::CanvasId> CanvasHost::create_2d_context(Gfx::IntSize size, bool alpha)
+Optional<Web::Painting::CanvasId> CanvasHost::create_2d_context(Gfx::IntSize size, bool alpha, bool will_read_frequently)
 {
-    auto command_player = create_2d_command_player(size, alpha);
+    auto command_player = create_2d_command_player(size, alpha, will_read_frequently);
     if (!command_player)
         return {};
 
@@ -47,7 +47,7 @@ public:
     CanvasHost(RefPtr<Gfx::SkiaBackendContext>, Web::Painting::CanvasSurfaceRegistry&);
     ~CanvasHost();
 
-    Optional<Web::Painting::CanvasId> create_2d_context(Gfx::IntSize, bool alpha);
+    Optional<Web::Painting::CanvasId> create_2d_context(Gfx::IntSize, bool alpha, bool will_read_frequently);
     CreateWebGLContextResult create_webgl_context(Web::WebGL::WebGLVersion, Gfx::IntSize, bool depth, bool stencil, bool antialias);
     void destroy_context(Web::Painting::CanvasId);
     bool has_context(Web::Painting::CanvasId) const;
@@ -73,7 +73,7 @@ private:
     using Context = Variant<Canvas2DContext, WebGLContext>;
 
     Context* context(Web::Painting::CanvasId);
-    OwnPtr<Gfx::CanvasCommandPlayer> create_2d_command_player(Gfx::IntSize, bool alpha);
+    OwnPtr<Gfx::CanvasCommandPlayer> create_2d_command_player(Gfx::IntSize, bool alpha, bool will_read_frequently);
     static HostWebGLContext& as_webgl(Context&);
     void present_canvas_2d_context(Web::Painting::CanvasId, Canvas2DContext&);
 
@@ -70,7 +70,7 @@ void CompositorState::create_context(Web::Compositor::CompositorContextId contex
         VERIFY(context_id == Web::Compositor::compositor_context_id_for_page(*page_id));
 
     auto& context = *m_contexts.ensure(context_id, [&] {
-        return make<ContextState>(page_id, web_content_client, m_canvas_surface_registry, m_async_scrolling_enabled);
+        return make<ContextState>(page_id, web_content_client, m_canvas_surface_registry, m_image_texture_cache, m_async_scrolling_enabled);
     });
     resize_backing_stores_if_needed(context_id, context);
 }
@@ -144,6 +144,7 @@ void CompositorState::update_display_list(Web::Compositor::CompositorContextId c
 
     context->apply_display_list_resource_transaction(move(resource_transaction));
     context->install_display_list_update(move(display_list), move(visual_context_tree), move(scroll_state_snapshot));
+    context->upload_new_image_frames(m_skia_backend_context);
 }
 
 void CompositorState::update_image_frame_resources(Web::Compositor::CompositorContextId context_id, Vector<Web::Painting::DisplayListImageFrameResource> image_frames)
@@ -151,6 +152,7 @@ void CompositorState::update_image_frame_resources(Web::Compositor::CompositorCo
     auto* context = context_if_present(context_id);
     VERIFY(context);
     context->update_image_frame_resources(move(image_frames));
+    context->upload_new_image_frames(m_skia_backend_context);
 }
 
 void CompositorState::update_visual_context_tree(Web::Compositor::CompositorContextId context_id, Web::Painting::AccumulatedVisualContextTree visual_context_tree)
@@ -29,6 +29,7 @@
 #include <LibWeb/Painting/DisplayList.h>
 #include <LibWeb/Painting/DisplayListPlayerSkia.h>
 #include <LibWeb/Painting/DisplayListResourceStorage.h>
+#include <LibWeb/Painting/ImageTextureCache.h>
 #include <LibWeb/Painting/ScrollState.h>
 
 namespace Web {
@@ -154,6 +155,9 @@ private:
     DoublyLinkedList<PendingAsyncPresent> m_pending_async_presents;
     RefPtr<Gfx::SkiaBackendContext> m_skia_backend_context;
     Web::Painting::CanvasSurfaceRegistry m_canvas_surface_registry;
+
+    // Shared by all contexts, so that an image shown by several pages is only uploaded to the GPU once.
+    Web::Painting::ImageTextureCache m_image_texture_cache;
     OwnPtr<Web::Painting::DisplayListPlayerSkia> m_display_list_player;
     HashMap<Optional<u64>, OwnPtr<VSyncScheduler>> m_vsync_schedulers_by_display;
     RefPtr<Core::Timer> m_gpu_completion_timer;
@@ -81,6 +81,7 @@ void ConnectionFromWebContent::stop_presenting_to_client(Web::Compositor::Compos
 
 void ConnectionFromWebContent::destroy_context(Web::Compositor::CompositorContextId context_id)
 {
+    m_last_received_display_lists.remove(context_id);
     if (!context_is_owned_by_this_connection(context_id))
         return;
     m_compositor_state->destroy_context(context_id);
@@ -88,11 +89,27 @@ void ConnectionFromWebContent::destroy_context(Web::Compositor::CompositorContex
 
 void ConnectionFromWebContent::update_display_list(Web::Compositor::CompositorContextId context_id, NonnullRefPtr<Web::Painting::DisplayList> display_list, Web::Painting::AccumulatedVisualContextTree visual_context_tree, Web::Painting::DisplayListResourceTransaction resource_transaction, Web::Painting::ScrollStateSnapshot scroll_state_snapshot)
 {
+    m_last_received_display_lists.set(context_id, display_list);
     if (!context_is_owned_by_this_connection(context_id))
         return;
     m_compositor_state->update_display_list(context_id, move(display_list), move(visual_context_tree), move(resource_transaction), move(scroll_state_snapshot));
 }
 
+void ConnectionFromWebContent::update_display_list_with_command_bytes_delta(Web::Compositor::CompositorContextId context_id, NonnullRefPtr<Web::Painting::DisplayList> display_list, Web::Painting::DisplayListCommandBytesDelta command_bytes_delta, Web::Painting::AccumulatedVisualContextTree visual_context_tree, Web::Painting::DisplayListResourceTransaction resource_transaction, Web::Painting::ScrollStateSnapshot scroll_state_snapshot)
+{
+    auto base_display_list = m_last_received_display_lists.get(context_id);
+    if (!base_display_list.has_value()) {
+        did_misbehave("WebContent sent a display list delta without a base display list");
+        return;
+    }
+    auto command_bytes = command_bytes_delta.apply_to((*base_display_list)->id(), (*base_display_list)->command_bytes());
+    if (command_bytes.is_error()) {
+        did_misbehave("WebContent sent an invalid display list delta");
+        return;
+    }
+    update_display_list(context_id, display_list->with_command_bytes(command_bytes.release_value()), move(visual_context_tree), move(resource_transaction), move(scroll_state_snapshot));
+}
+
 void ConnectionFromWebContent::update_image_frame_resources(Web::Compositor::CompositorContextId context_id, Vector<Web::Painting::DisplayListImageFrameResource> image_frames)
 {
     if (!context_is_owned_by_this_connection(context_id))
@@ -128,9 +145,9 @@ void ConnectionFromWebContent::clear_video_frame(Web::Compositor::CompositorCont
     m_compositor_state->clear_video_frame(context_id, frame_id);
 }
 
-Messages::CompositorWebContentServer::CreateCanvas2dContextResponse ConnectionFromWebContent::create_canvas_2d_context(Gfx::IntSize size, bool alpha)
+Messages::CompositorWebContentServer::CreateCanvas2dContextResponse ConnectionFromWebContent::create_canvas_2d_context(Gfx::IntSize size, bool alpha, bool will_read_frequently)
 {
-    auto canvas_id = m_canvas_host.create_2d_context(size, alpha);
+    auto canvas_id = m_canvas_host.create_2d_context(size, alpha, will_read_frequently);
     if (!canvas_id.has_value())
         return { false, Web::Painting::CanvasId { 0 } };
     return { true, *canvas_id };
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/Function.h>
+#include <AK/HashMap.h>
 #include <AK/Optional.h>
 #include <Compositor/CanvasHost.h>
 #include <Compositor/CompositorState.h>
@@ -16,6 +17,7 @@
 #include <LibGfx/Size.h>
 #include <LibIPC/ConnectionFromClient.h>
 #include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/DisplayListCommandBytesDelta.h>
 #include <LibWeb/Painting/DisplayListResourceStorage.h>
 #include <LibWeb/WebGL/Types.h>
 
@@ -41,12 +43,13 @@ private:
     virtual void stop_presenting_to_client(Web::Compositor::CompositorContextId) override;
     virtual void destroy_context(Web::Compositor::CompositorContextId) override;
     virtual void update_display_list(Web::Compositor::CompositorContextId, NonnullRefPtr<Web::Painting::DisplayList>, Web::Painting::AccumulatedVisualContextTree, Web::Painting::DisplayListResourceTransaction, Web::Painting::ScrollStateSnapshot) override;
+    virtual void update_display_list_with_command_bytes_delta(Web::Compositor::CompositorContextId, NonnullRefPtr<Web::Painting::DisplayList>, Web::Painting::DisplayListCommandBytesDelta, Web::Painting::AccumulatedVisualContextTree, Web::Painting::DisplayListResourceTransaction, Web::Painting::ScrollStateSnapshot) override;
     virtual void update_visual_context_tree(Web::Compositor::CompositorContextId, Web::Painting::AccumulatedVisualContextTree) override;
     virtual void update_scroll_state(Web::Compositor::CompositorContextId, Web::Painting::ScrollStateSnapshot) override;
     virtual void update_video_frame(Web::Compositor::CompositorContextId, Web::Painting::VideoFrameResourceId, NonnullRefPtr<Media::VideoFrame const>) override;
     virtual void update_image_frame_resources(Web::Compositor::CompositorContextId, Vector<Web::Painting::DisplayListImageFrameResource>) override;
     virtual void clear_video_frame(Web::Compositor::CompositorContextId, Web::Painting::VideoFrameResourceId) override;
-    virtual Messages::CompositorWebContentServer::CreateCanvas2dContextResponse create_canvas_2d_context(Gfx::IntSize, bool) override;
+    virtual Messages::CompositorWebContentServer::CreateCanvas2dContextResponse create_canvas_2d_context(Gfx::IntSize, bool, bool) override;
     virtual void update_canvas_2d_stream(Vector<Web::Painting::Canvas2DCommandStreamSegment>) override;
     virtual void destroy_canvas_context(Web::Painting::CanvasId) override;
     virtual Messages::CompositorWebContentServer::GetCanvasPixelsResponse get_canvas_pixels(Web::Painting::CanvasId, Gfx::IntRect) override;
@@ -76,6 +79,10 @@ private:
     NonnullRefPtr<CompositorState> m_compositor_state;
     CanvasHost m_canvas_host;
     Function<void(ConnectionFromWebContent&)> m_on_death;
+
+    // The last display list received for each context, which command byte deltas from WebContent are based on.
+    // This is tracked per connection and independently of what the context ended up installing.
+    HashMap<Web::Compositor::CompositorContextId, NonnullRefPtr<Web::Painting::DisplayList>> m_last_received_display_lists;
 };
 
 }
@@ -81,12 +81,13 @@ static void clamp_visual_viewport_transform_to_viewport(Web::Painting::Transform
     transform.matrix[1, 3] = clamp(transform.matrix[1, 3], min_y, 0.0f);
 }
 
-ContextState::ContextState(Optional<u64> page_id, CompositorStateWebContentClient& web_content_client, Web::Painting::CanvasSurfaceRegistry const& canvas_surface_registry, bool async_scrolling_enabled)
+ContextState::ContextState(Optional<u64> page_id, CompositorStateWebContentClient& web_content_client, Web::Painting::CanvasSurfaceRegistry const& canvas_surface_registry, Web::Painting::ImageTextureCache& image_texture_cache, bool async_scrolling_enabled)
     : m_web_content_client(web_content_client)
     , m_canvas_surface_registry(canvas_surface_registry)
     , m_page_id(page_id)
     , m_async_scrolling_enabled(async_scrolling_enabled)
 {
+    m_display_list_resource_storage.set_image_texture_cache(&image_texture_cache);
     if (page_id.has_value())
         m_presents_to_client = true;
 }
@@ -132,13 +133,23 @@ void ContextState::set_parent_context(Optional<Web::Compositor::CompositorContex
 
 void ContextState::apply_display_list_resource_transaction(Web::Painting::DisplayListResourceTransaction&& resource_transaction)
 {
+    for (auto const& frame : resource_transaction.image_frames)
+        m_image_frames_awaiting_upload.append(frame.id);
     m_display_list_resource_storage.apply_transaction(move(resource_transaction));
 }
 
 void ContextState::update_image_frame_resources(Vector<Web::Painting::DisplayListImageFrameResource> image_frames)
 {
-    for (auto& frame : image_frames)
+    for (auto& frame : image_frames) {
+        m_image_frames_awaiting_upload.append(frame.id);
         m_display_list_resource_storage.set_image_frame(frame.id, move(frame.frame));
+    }
+}
+
+void ContextState::upload_new_image_frames(RefPtr<Gfx::SkiaBackendContext> const& skia_backend_context)
+{
+    m_display_list_resource_storage.upload_image_frames(m_image_frames_awaiting_upload, skia_backend_context);
+    m_image_frames_awaiting_upload.clear();
 }
 
 void ContextState::install_display_list_update(
@@ -963,11 +974,16 @@ bool ContextState::can_render_frame() const
 
 Web::Painting::AccumulatedVisualContextTree const& ContextState::visual_context_tree_for_compositing() const
 {
-    if (!m_async_visual_viewport_transform.has_value())
+    auto has_scroll_timeline_animations = m_has_async_scrolling_state && m_async_scroll_tree.has_scroll_timeline_animations();
+    if (!m_async_visual_viewport_transform.has_value() && !has_scroll_timeline_animations)
         return current_visual_context_tree();
 
     m_visual_context_tree_for_compositing = current_visual_context_tree();
-    m_visual_context_tree_for_compositing->set_visual_viewport_transform(*m_async_visual_viewport_transform);
+    if (m_async_visual_viewport_transform.has_value())
+        m_visual_context_tree_for_compositing->set_visual_viewport_transform(*m_async_visual_viewport_transform);
+    // NB: Scroll-driven animations follow the compositor's scroll offsets, which may be ahead of the main thread's.
+    if (has_scroll_timeline_animations)
+        m_async_scroll_tree.apply_scroll_timeline_animations(*m_visual_context_tree_for_compositing, m_scroll_state_snapshot);
     return *m_visual_context_tree_for_compositing;
 }
 
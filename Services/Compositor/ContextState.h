@@ -80,7 +80,7 @@ public:
         Gfx::IntRect damage_rect;
     };
 
-    ContextState(Optional<u64> page_id, CompositorStateWebContentClient&, Web::Painting::CanvasSurfaceRegistry const&, bool async_scrolling_enabled);
+    ContextState(Optional<u64> page_id, CompositorStateWebContentClient&, Web::Painting::CanvasSurfaceRegistry const&, Web::Painting::ImageTextureCache&, bool async_scrolling_enabled);
     ~ContextState();
 
     bool is_owned_by(CompositorStateWebContentClient const&) const;
@@ -97,6 +97,7 @@ public:
 
     void apply_display_list_resource_transaction(Web::Painting::DisplayListResourceTransaction&&);
     void update_image_frame_resources(Vector<Web::Painting::DisplayListImageFrameResource>);
+    void upload_new_image_frames(RefPtr<Gfx::SkiaBackendContext> const&);
     void install_display_list_update(
         NonnullRefPtr<Web::Painting::DisplayList>,
         Web::Painting::AccumulatedVisualContextTree,
@@ -189,6 +190,7 @@ private:
     Optional<Web::Painting::AccumulatedVisualContextTree> m_visual_context_tree;
     mutable Optional<Web::Painting::AccumulatedVisualContextTree> m_visual_context_tree_for_compositing;
     Web::Painting::DisplayListResourceStorage m_display_list_resource_storage;
+    Vector<Web::Painting::ImageFrameResourceId> m_image_frames_awaiting_upload;
     Web::Painting::ScrollStateSnapshot m_scroll_state_snapshot;
     BackingStoreManager m_backing_store_manager;
     RefPtr<Gfx::PaintingSurface> m_latest_rendered_surface;
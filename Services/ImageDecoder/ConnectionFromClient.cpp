@@ -17,7 +17,6 @@
 #include <LibGfx/ImageFormats/TIFFMetadata.h>
 #include <LibIPC/TransportHandle.h>
 #include <LibSync/Mutex.h>
-#include <LibThreading/ThreadPool.h>
 
 namespace ImageDecoder {
 
@@ -36,6 +35,12 @@ void ConnectionFromClient::die()
         job->cancel();
     m_pending_jobs.clear();
 
+    for (auto& [_, session] : m_incremental_decode_sessions) {
+        if (session->partial_decode_job)
+            session->partial_decode_job->cancel();
+    }
+    m_incremental_decode_sessions.clear();
+
     for (auto& [_, job] : m_pending_frame_jobs)
         job->cancel();
     m_pending_frame_jobs.clear();
@@ -177,13 +182,18 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
     return result;
 }
 
-NonnullRefPtr<ConnectionFromClient::PendingJob> ConnectionFromClient::start_decode_image_job(i64 request_id, Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
+NonnullRefPtr<PendingJob> ConnectionFromClient::start_decode_image_job(i64 request_id, Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, DecodePriority priority)
 {
-    auto job = make_ref_counted<PendingJob>();
+    auto job = make_ref_counted<PendingJob>(priority);
     auto& main_thread_event_loop = Core::EventLoop::current();
-    Threading::ThreadPool::the().submit(
+    DecodeScheduler::the().submit(
+        job,
         [strong_this = NonnullRefPtr(*this), job, &main_thread_event_loop, request_id, encoded_buffer = move(encoded_buffer), ideal_size = move(ideal_size), mime_type = move(mime_type)]() mutable {
-            auto result = decode_image_to_details(move(encoded_buffer), ideal_size, mime_type);
+            auto result = [&]() -> ErrorOr<DecodeResult> {
+                if (job->is_canceled())
+                    return Error::from_errno(ECANCELED);
+                return decode_image_to_details(move(encoded_buffer), ideal_size, mime_type);
+            }();
 
             main_thread_event_loop.deferred_invoke([strong_this = move(strong_this), job = move(job), request_id, result = move(result)] mutable {
                 auto current_job = strong_this->m_pending_jobs.get(request_id);
@@ -245,6 +255,164 @@ void ConnectionFromClient::cancel_decoding(i64 request_id)
     if (auto job = m_pending_jobs.take(request_id); job.has_value()) {
         job.value()->cancel();
     }
+
+    if (auto session = m_incremental_decode_sessions.take(request_id); session.has_value() && session.value()->partial_decode_job)
+        session.value()->partial_decode_job->cancel();
+}
+
+// Each partial decode starts over from the beginning of the data, so wait until it has grown by a good fraction since
+// the last one. This keeps the total work for a slowly arriving image within a small multiple of decoding it once.
+static constexpr size_t MINIMUM_PARTIAL_DECODE_GROWTH = 16 * KiB;
+static constexpr size_t PARTIAL_DECODE_GROWTH_DIVISOR = 4;
+
+static ErrorOr<ConnectionFromClient::PartialDecodeResult> decode_partial_image(ReadonlyBytes encoded_data, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& known_mime_type)
+{
+    auto decoder = TRY(Gfx::ImageDecoder::try_create_for_raw_bytes(encoded_data, known_mime_type));
+    if (!decoder || !decoder->frame_count())
+        return Error::from_string_literal("Not enough data to decode a partial image");
+
+    auto frame = TRY(decoder->frame(0, ideal_size));
+    frame.image->set_alpha_type_destructive(Gfx::AlphaType::Premultiplied);
+
+    ConnectionFromClient::PartialDecodeResult result { .bitmap = move(frame.image), .color_profile = {} };
+    if (auto maybe_icc_data = decoder->color_space(); !maybe_icc_data.is_error())
+        result.color_profile = maybe_icc_data.release_value();
+    return result;
+}
+
+NonnullRefPtr<PendingJob> ConnectionFromClient::start_partial_decode_job(i64 request_id, ByteBuffer encoded_data, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, DecodePriority priority)
+{
+    auto job = make_ref_counted<PendingJob>(priority);
+    auto& main_thread_event_loop = Core::EventLoop::current();
+    DecodeScheduler::the().submit(
+        job,
+        [strong_this = NonnullRefPtr(*this), job, &main_thread_event_loop, request_id, encoded_data = move(encoded_data), ideal_size = move(ideal_size), mime_type = move(mime_type)]() mutable {
+            auto result = [&]() -> ErrorOr<PartialDecodeResult> {
+                if (job->is_canceled())
+                    return Error::from_errno(ECANCELED);
+                return decode_partial_image(encoded_data.bytes(), ideal_size, mime_type);
+            }();
+
+            main_thread_event_loop.deferred_invoke([strong_this = move(strong_this), job = move(job), request_id, result = move(result)] mutable {
+                if (job->is_canceled())
+                    return;
+
+                auto session = strong_this->m_incremental_decode_sessions.get(request_id);
+                if (!session.has_value() || session.value()->partial_decode_job != job.ptr())
+                    return;
+                session.value()->partial_decode_job = nullptr;
+
+                // Failing to decode is expected while too little of the image has arrived, so only successful
+                // attempts are reported. The final decode reports any real errors.
+                if (!result.is_error() && strong_this->is_open()) {
+                    auto partial_image = result.release_value();
+                    Vector<RefPtr<Gfx::Bitmap>> bitmaps;
+                    bitmaps.append(move(partial_image.bitmap));
+                    strong_this->async_did_decode_partial_image(request_id, Gfx::BitmapSequence { move(bitmaps) }, move(partial_image.color_profile));
+                }
+
+                strong_this->schedule_partial_decode(request_id, *session.value());
+            });
+        });
+
+    return job;
+}
+
+void ConnectionFromClient::schedule_partial_decode(i64 request_id, IncrementalDecodeSession& session)
+{
+    if (session.partial_decode_job || session.partial_decode_is_scheduled)
+        return;
+
+    auto required_growth = max(MINIMUM_PARTIAL_DECODE_GROWTH, session.size_at_last_partial_decode / PARTIAL_DECODE_GROWTH_DIVISOR);
+    if (session.encoded_data.size() < session.size_at_last_partial_decode + required_growth)
+        return;
+
+    // Hold off until the messages that have already arrived are handled, so that an image whose last chunk is right
+    // behind this one goes straight to the final decode.
+    session.partial_decode_is_scheduled = true;
+    deferred_invoke([this, request_id] {
+        auto session = m_incremental_decode_sessions.get(request_id);
+        if (!session.has_value())
+            return;
+        session.value()->partial_decode_is_scheduled = false;
+
+        auto encoded_data = ByteBuffer::copy(session.value()->encoded_data);
+        if (encoded_data.is_error())
+            return;
+
+        session.value()->size_at_last_partial_decode = encoded_data.value().size();
+        session.value()->partial_decode_job = start_partial_decode_job(request_id, encoded_data.release_value(), session.value()->ideal_size, session.value()->mime_type, session.value()->priority);
+    });
+}
+
+void ConnectionFromClient::begin_incremental_decode(Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, i64 request_id)
+{
+    if (m_pending_jobs.contains(request_id) || m_incremental_decode_sessions.contains(request_id)) {
+        did_misbehave("Duplicate decode request id");
+        return;
+    }
+
+    auto session = make<IncrementalDecodeSession>();
+    session->ideal_size = ideal_size;
+    session->mime_type = move(mime_type);
+    m_incremental_decode_sessions.set(request_id, move(session));
+}
+
+void ConnectionFromClient::append_incremental_decode_data(Core::AnonymousBuffer data, i64 request_id)
+{
+    // The client may still be sending data for a decode it has just canceled.
+    auto session = m_incremental_decode_sessions.get(request_id);
+    if (!session.has_value() || !data.is_valid())
+        return;
+
+    if (auto result = session.value()->encoded_data.try_append(data.data<u8>(), data.size()); result.is_error()) {
+        cancel_decoding(request_id);
+        async_did_fail_to_decode_image(request_id, MUST(String::formatted("Decoding failed: {}", result.release_error())));
+        return;
+    }
+
+    schedule_partial_decode(request_id, *session.value());
+}
+
+void ConnectionFromClient::finish_incremental_decode(i64 request_id)
+{
+    auto session = m_incremental_decode_sessions.take(request_id);
+    if (!session.has_value())
+        return;
+
+    // The final decode supersedes any partial decode that is still running.
+    if (session.value()->partial_decode_job)
+        session.value()->partial_decode_job->cancel();
+
+    auto const& encoded_data = session.value()->encoded_data;
+    if (encoded_data.is_empty()) {
+        dbgln_if(IMAGE_DECODER_DEBUG, "Encoded data is invalid");
+        async_did_fail_to_decode_image(request_id, "Encoded data is invalid"_string);
+        return;
+    }
+
+    auto encoded_buffer = Core::AnonymousBuffer::create_with_size(encoded_data.size());
+    if (encoded_buffer.is_error()) {
+        async_did_fail_to_decode_image(request_id, MUST(String::formatted("Decoding failed: {}", encoded_buffer.release_error())));
+        return;
+    }
+    memcpy(encoded_buffer.value().data<u8>(), encoded_data.data(), encoded_data.size());
+
+    m_pending_jobs.set(request_id, start_decode_image_job(request_id, encoded_buffer.release_value(), session.value()->ideal_size, move(session.value()->mime_type), session.value()->priority));
+}
+
+void ConnectionFromClient::set_decode_priority(i64 request_id, bool is_visible)
+{
+    auto priority = is_visible ? DecodePriority::Visible : DecodePriority::NotVisible;
+
+    if (auto job = m_pending_jobs.get(request_id); job.has_value())
+        job.value()->set_priority(priority);
+
+    if (auto session = m_incremental_decode_sessions.get(request_id); session.has_value()) {
+        session.value()->priority = priority;
+        if (session.value()->partial_decode_job)
+            session.value()->partial_decode_job->set_priority(priority);
+    }
 }
 
 void ConnectionFromClient::request_animation_frames(i64 session_id, u32 start_frame_index, u32 count)
@@ -267,11 +435,12 @@ void ConnectionFromClient::request_animation_frames(i64 session_id, u32 start_fr
     m_pending_frame_jobs.set(session_id, start_frame_decode_job(session_id, move(session), start_frame_index, end_index));
 }
 
-NonnullRefPtr<ConnectionFromClient::PendingJob> ConnectionFromClient::start_frame_decode_job(i64 session_id, NonnullRefPtr<AnimationSession> session, u32 start_frame_index, u32 end_index)
+NonnullRefPtr<PendingJob> ConnectionFromClient::start_frame_decode_job(i64 session_id, NonnullRefPtr<AnimationSession> session, u32 start_frame_index, u32 end_index)
 {
     auto job = make_ref_counted<PendingJob>();
     auto& main_thread_event_loop = Core::EventLoop::current();
-    Threading::ThreadPool::the().submit(
+    DecodeScheduler::the().submit(
+        job,
         [strong_this = NonnullRefPtr(*this), job, session = move(session), &main_thread_event_loop, session_id, start_frame_index, end_index]() mutable {
             auto result = [&]() -> ErrorOr<FrameDecodeResult> {
                 if (job->is_canceled())
@@ -6,9 +6,10 @@
 
 #pragma once
 
-#include <AK/Atomic.h>
 #include <AK/AtomicRefCounted.h>
+#include <AK/ByteBuffer.h>
 #include <AK/HashMap.h>
+#include <ImageDecoder/DecodeScheduler.h>
 #include <ImageDecoder/Forward.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
 #include <ImageDecoder/ImageDecoderServerEndpoint.h>
@@ -44,6 +45,11 @@ public:
         Core::AnonymousBuffer encoded_data;
     };
 
+    struct PartialDecodeResult {
+        NonnullRefPtr<Gfx::Bitmap> bitmap;
+        Gfx::ColorSpace color_profile;
+    };
+
     struct AnimationSession : public AtomicRefCounted<AnimationSession> {
         Core::AnonymousBuffer encoded_data;
         RefPtr<Gfx::ImageDecoder> decoder;
@@ -52,20 +58,28 @@ public:
     };
 
 private:
-    struct PendingJob : public AtomicRefCounted<PendingJob> {
-        void cancel() { m_canceled.store(true, AK::MemoryOrder::memory_order_relaxed); }
-        bool is_canceled() const { return m_canceled.load(AK::MemoryOrder::memory_order_relaxed); }
+    using FrameDecodeResult = Vector<Gfx::ImageFrameDescriptor>;
 
-    private:
-        Atomic<bool> m_canceled { false };
+    // An image whose encoded data arrives in chunks. Whenever enough new data has arrived, the first frame is decoded
+    // from what is there so far so that the client can show it while the rest is still downloading.
+    struct IncrementalDecodeSession {
+        Optional<Gfx::IntSize> ideal_size;
+        Optional<ByteString> mime_type;
+        ByteBuffer encoded_data;
+        size_t size_at_last_partial_decode { 0 };
+        RefPtr<PendingJob> partial_decode_job;
+        bool partial_decode_is_scheduled { false };
+        DecodePriority priority { DecodePriority::Visible };
     };
 
-    using FrameDecodeResult = Vector<Gfx::ImageFrameDescriptor>;
-
     explicit ConnectionFromClient(NonnullOwnPtr<IPC::Transport>);
 
     virtual void decode_image(Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, i64 request_id) override;
     virtual void cancel_decoding(i64 request_id) override;
+    virtual void begin_incremental_decode(Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, i64 request_id) override;
+    virtual void append_incremental_decode_data(Core::AnonymousBuffer, i64 request_id) override;
+    virtual void finish_incremental_decode(i64 request_id) override;
+    virtual void set_decode_priority(i64 request_id, bool is_visible) override;
     virtual void request_animation_frames(i64 session_id, u32 start_frame_index, u32 count) override;
     virtual void stop_animation_decode(i64 session_id) override;
     virtual Messages::ImageDecoderServer::ConnectNewClientsResponse connect_new_clients(size_t count) override;
@@ -73,11 +87,14 @@ private:
 
     ErrorOr<IPC::TransportHandle> connect_new_client();
 
-    NonnullRefPtr<PendingJob> start_decode_image_job(i64 request_id, Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type);
+    NonnullRefPtr<PendingJob> start_decode_image_job(i64 request_id, Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, DecodePriority = DecodePriority::Visible);
+    NonnullRefPtr<PendingJob> start_partial_decode_job(i64 request_id, ByteBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, DecodePriority);
+    void schedule_partial_decode(i64 request_id, IncrementalDecodeSession&);
     NonnullRefPtr<PendingJob> start_frame_decode_job(i64 session_id, NonnullRefPtr<AnimationSession>, u32 start_frame_index, u32 end_index);
 
     i64 m_next_session_id { 1 };
     HashMap<i64, NonnullRefPtr<PendingJob>> m_pending_jobs;
+    HashMap<i64, NonnullOwnPtr<IncrementalDecodeSession>> m_incremental_decode_sessions;
     HashMap<i64, NonnullRefPtr<AnimationSession>> m_animation_sessions;
     HashMap<i64, NonnullRefPtr<PendingJob>> m_pending_frame_jobs;
 };
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <ImageDecoder/DecodeScheduler.h>
+#include <LibThreading/ThreadPool.h>
+
+namespace ImageDecoder {
+
+DecodeScheduler& DecodeScheduler::the()
+{
+    static DecodeScheduler* instance = new DecodeScheduler;
+    return *instance;
+}
+
+void DecodeScheduler::submit(NonnullRefPtr<PendingJob> job, Function<void()> work)
+{
+    {
+        Sync::MutexLocker locker(m_mutex);
+        m_queued_jobs.append({ move(job), move(work) });
+    }
+
+    // Every queued job is matched by exactly one pool task, but which job that task ends up running is only decided once
+    // it starts.
+    Threading::ThreadPool::the().submit([this] { run_next_job(); }, Threading::TaskPriority::UserVisible);
+}
+
+void DecodeScheduler::run_next_job()
+{
+    Function<void()> work;
+
+    {
+        Sync::MutexLocker locker(m_mutex);
+        VERIFY(!m_queued_jobs.is_empty());
+
+        // Canceled jobs finish almost immediately and release their resources, so get them out of the way first. Then
+        // take the oldest visible job, or failing that, the oldest job of all.
+        Optional<size_t> index_to_run;
+        for (size_t i = 0; i < m_queued_jobs.size(); ++i) {
+            auto const& job = *m_queued_jobs[i].job;
+            if (job.is_canceled()) {
+                index_to_run = i;
+                break;
+            }
+            if (!index_to_run.has_value() && job.priority() == DecodePriority::Visible)
+                index_to_run = i;
+        }
+
+        work = move(m_queued_jobs.take(index_to_run.value_or(0)).work);
+    }
+
+    work();
+}
+
+}
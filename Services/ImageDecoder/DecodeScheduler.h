@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/AtomicRefCounted.h>
+#include <AK/Function.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/StdLibExtras.h>
+#include <AK/Vector.h>
+#include <LibSync/Mutex.h>
+
+namespace ImageDecoder {
+
+enum class DecodePriority : u8 {
+    // The image is in or near the viewport of the page that asked for it.
+    Visible,
+    // The image is somewhere on the page, but out of view.
+    NotVisible,
+};
+
+struct PendingJob : public AtomicRefCounted<PendingJob> {
+    explicit PendingJob(DecodePriority priority = DecodePriority::Visible)
+        : m_priority(to_underlying(priority))
+    {
+    }
+
+    void cancel() { m_canceled.store(true, AK::MemoryOrder::memory_order_relaxed); }
+    bool is_canceled() const { return m_canceled.load(AK::MemoryOrder::memory_order_relaxed); }
+
+    // The priority may change while the job is waiting to run; it is looked at again whenever a worker picks a job.
+    DecodePriority priority() const { return static_cast<DecodePriority>(m_priority.load(AK::MemoryOrder::memory_order_relaxed)); }
+    void set_priority(DecodePriority priority) { m_priority.store(to_underlying(priority), AK::MemoryOrder::memory_order_relaxed); }
+
+private:
+    Atomic<bool> m_canceled { false };
+    Atomic<u8> m_priority;
+};
+
+// Runs decode jobs on the thread pool, visible images first. Jobs are only bound to a worker once one becomes free,
+// so a change in priority takes effect for every job that has not started yet.
+class DecodeScheduler {
+public:
+    static DecodeScheduler& the();
+
+    // The work always runs, even if the job is canceled by then, so that it can hand its results (and whatever it holds
+    // on to) back to the main thread. It should check whether the job is canceled before doing anything expensive.
+    void submit(NonnullRefPtr<PendingJob>, Function<void()> work);
+
+private:
+    DecodeScheduler() = default;
+
+    void run_next_job();
+
+    struct QueuedJob {
+        NonnullRefPtr<PendingJob> job;
+        Function<void()> work;
+    };
+
+    Sync::Mutex m_mutex;
+    Vector<QueuedJob> m_queued_jobs;
+};
+
+}
@@ -9,6 +9,7 @@
 #include <LibCore/Environment.h>
 #include <LibCore/StandardPaths.h>
 #include <LibCore/System.h>
+#include <LibGfx/Font/DecodedFontCache.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibSandbox/Sandbox.h>
 #include <LibSandbox/Seccomp.h>
@@ -17,7 +18,7 @@
 
 namespace RendererSandbox {
 
-ErrorOr<void> apply_sandbox(Optional<StringView> config_path, Optional<StringView>)
+ErrorOr<void> apply_sandbox(Optional<StringView> config_path, Optional<StringView> cache_path)
 {
     TRY(Sandbox::install_no_new_privileges());
     TRY(Sandbox::configure_runtime());
@@ -35,6 +36,9 @@ ErrorOr<void> apply_sandbox(Optional<StringView> config_path, Optional<StringVie
     TRY(Sandbox::add_landlock_path_if_exists(paths, "/proc/self"sv, Sandbox::LandlockPath::Access::ReadOnly));
     for (auto const& path : TRY(Gfx::FontDatabase::font_directories()))
         TRY(Sandbox::add_landlock_path_if_exists(paths, path, Sandbox::LandlockPath::Access::ReadOnly));
+    // Decoded web fonts are shared between renderers through the profile cache.
+    if (cache_path.has_value() && !cache_path->is_empty())
+        TRY(Sandbox::add_landlock_path_if_exists(paths, Gfx::DecodedFontCache::directory_for_cache_path(*cache_path), Sandbox::LandlockPath::Access::ReadWrite));
 
     if (auto cranelift_compiler_path = Core::Environment::get("LADYBIRD_CRANELIFT_COMPILER"sv); cranelift_compiler_path.has_value()) {
         TRY(Sandbox::add_landlock_path_if_exists(paths, *cranelift_compiler_path, Sandbox::LandlockPath::Access::ReadAndExecute));
@@ -21,6 +21,24 @@ ErrorOr<void> initialize_libcurl()
     return {};
 }
 
+CURLSH* curl_share_handle()
+{
+    static CURLSH* share_handle = [] {
+        auto* handle = curl_share_init();
+        VERIFY(handle);
+
+        // NB: RequestServer drives all transfers from a single thread, so no lock callbacks are needed.
+        //     The connection cache is deliberately not shared: connections belong to the multi handle that opened them,
+        //     and handing an HTTP/2 connection to a transfer of another multi handle is not supported by libcurl.
+        for (auto data : { CURL_LOCK_DATA_DNS, CURL_LOCK_DATA_SSL_SESSION, CURL_LOCK_DATA_PSL }) {
+            if (auto result = curl_share_setopt(handle, CURLSHOPT_SHARE, data); result != CURLSHE_OK)
+                dbgln("RequestServer: Failed to share curl data {}: {}", to_underlying(data), curl_share_strerror(result));
+        }
+        return handle;
+    }();
+    return share_handle;
+}
+
 ByteString build_curl_resolve_list(DNS::LookupResult const& dns_result, StringView host, u16 port)
 {
     StringBuilder resolve_opt_builder;
@@ -27,4 +27,8 @@ ByteString build_curl_resolve_list(DNS::LookupResult const& dns_result, StringVi
 Requests::NetworkError curl_code_to_network_error(int code);
 ErrorOr<void> initialize_libcurl();
 
+// A process-wide share handle, so that DNS results and TLS sessions are reused across every client connection rather
+// than only within the multi handle an easy handle happens to be attached to.
+CURLSH* curl_share_handle();
+
 }
@@ -270,7 +270,7 @@ void ConnectionFromClient::set_use_system_dns()
     m_resolver->dns.reset_connection();
 }
 
-void ConnectionFromClient::start_request(u64 request_id, ByteString method, URL::URL url, Vector<HTTP::Header> request_headers, ByteBuffer request_body, HTTP::CacheMode cache_mode, HTTP::Cookie::IncludeCredentials include_credentials, Core::ProxyData proxy_data, bool keep_alive_for_transfer)
+void ConnectionFromClient::start_request(u64 request_id, ByteString method, URL::URL url, Vector<HTTP::Header> request_headers, ByteBuffer request_body, HTTP::CacheMode cache_mode, HTTP::Cookie::IncludeCredentials include_credentials, Core::ProxyData proxy_data, bool keep_alive_for_transfer, RequestPriority priority)
 {
     note_event_tick("ipc-start-request"sv);
     dbgln_if(REQUESTSERVER_DEBUG, "RequestServer: start_request({}, {})", request_id, url);
@@ -289,7 +289,7 @@ void ConnectionFromClient::start_request(u64 request_id, ByteString method, URL:
         }
     }
 
-    auto request = Request::fetch(request_id, m_disk_cache, cache_mode, *this, m_curl_multi, m_resolver, move(url), move(method), HTTP::HeaderList::create(move(request_headers)), move(request_body), include_credentials, m_alt_svc_cache_path, proxy_data, keep_alive_for_transfer);
+    auto request = Request::fetch(request_id, m_disk_cache, cache_mode, *this, m_curl_multi, m_resolver, move(url), move(method), HTTP::HeaderList::create(move(request_headers)), move(request_body), include_credentials, m_alt_svc_cache_path, proxy_data, keep_alive_for_transfer, priority);
     m_active_requests.set(request_id, move(request));
 }
 
@@ -614,14 +614,17 @@ void ConnectionFromClient::websocket_connect(u64 websocket_id, URL::URL url, Byt
             };
             connection->on_message = [self = weak_self, websocket_id](auto message) {
                 if (auto strong_self = self.strong_ref())
-                    strong_self->async_websocket_received(websocket_id, message.is_text(), message.data());
+                    strong_self->queue_websocket_message(websocket_id, move(message));
             };
             connection->on_error = [self = weak_self, websocket_id](auto message) {
-                if (auto strong_self = self.strong_ref())
+                if (auto strong_self = self.strong_ref()) {
+                    strong_self->flush_websocket_messages(websocket_id);
                     strong_self->async_websocket_errored(websocket_id, (i32)message);
+                }
             };
             connection->on_close = [self = weak_self, websocket_id](u16 code, ByteString reason, bool was_clean) {
                 if (auto strong_self = self.strong_ref()) {
+                    strong_self->flush_websocket_messages(websocket_id);
                     strong_self->async_websocket_closed(websocket_id, code, move(reason), was_clean);
                     Core::deferred_invoke([self, websocket_id] {
                         if (auto strong_self = self.strong_ref())
@@ -630,8 +633,10 @@ void ConnectionFromClient::websocket_connect(u64 websocket_id, URL::URL url, Byt
                 }
             };
             connection->on_ready_state_change = [self = weak_self, websocket_id](auto state) {
-                if (auto strong_self = self.strong_ref())
+                if (auto strong_self = self.strong_ref()) {
+                    strong_self->flush_websocket_messages(websocket_id);
                     strong_self->async_websocket_ready_state_changed(websocket_id, (u32)state);
+                }
             };
 
             connection->start();
@@ -639,6 +644,49 @@ void ConnectionFromClient::websocket_connect(u64 websocket_id, URL::URL url, Byt
         });
 }
 
+void ConnectionFromClient::queue_websocket_message(u64 websocket_id, WebSocket::Message message)
+{
+    // Messages are batched up to this size before being sent to the client, regardless of the event loop.
+    static constexpr size_t maximum_queued_websocket_messages_size = 1 * MiB;
+
+    if (message.data().size() >= Requests::WebSocket::SHARED_MEMORY_THRESHOLD) {
+        auto buffer_or_error = Core::AnonymousBuffer::create_with_size(message.data().size());
+        if (!buffer_or_error.is_error()) {
+            auto buffer = buffer_or_error.release_value();
+            __builtin_memcpy(buffer.data<void>(), message.data().data(), message.data().size());
+
+            flush_websocket_messages(websocket_id);
+            async_websocket_received_shared(websocket_id, message.is_text(), move(buffer));
+            return;
+        }
+        dbgln("queue_websocket_message: failed to allocate shared buffer for {} bytes: {}", message.data().size(), buffer_or_error.error());
+    }
+
+    auto& queue = m_queued_websocket_messages.ensure(websocket_id);
+    if (queue.messages.is_empty()) {
+        Core::deferred_invoke([weak_self = make_weak_ptr<ConnectionFromClient>(), websocket_id] {
+            if (auto strong_self = weak_self.strong_ref())
+                strong_self->flush_websocket_messages(websocket_id);
+        });
+    }
+
+    auto is_text = message.is_text();
+    queue.size += message.data().size();
+    queue.messages.append({ message.release_data(), is_text });
+
+    if (queue.size >= maximum_queued_websocket_messages_size)
+        flush_websocket_messages(websocket_id);
+}
+
+void ConnectionFromClient::flush_websocket_messages(u64 websocket_id)
+{
+    auto queue = m_queued_websocket_messages.take(websocket_id);
+    if (!queue.has_value() || queue->messages.is_empty())
+        return;
+
+    async_websocket_received(websocket_id, move(queue->messages));
+}
+
 void ConnectionFromClient::websocket_send(u64 websocket_id, bool is_text, ByteBuffer data)
 {
     if (auto* connection = m_websockets.get(websocket_id).value_or({}); connection && connection->ready_state() == WebSocket::ReadyState::Open)
@@ -61,7 +61,7 @@ private:
     virtual Messages::RequestServer::GetClientIdResponse get_client_id() override;
     virtual void set_dns_server(ByteString host_or_address, u16 port, bool use_tls, bool validate_dnssec_locally) override;
     virtual void set_use_system_dns() override;
-    virtual void start_request(u64 request_id, ByteString, URL::URL, Vector<HTTP::Header>, ByteBuffer, HTTP::CacheMode, HTTP::Cookie::IncludeCredentials, Core::ProxyData, bool keep_alive_for_transfer) override;
+    virtual void start_request(u64 request_id, ByteString, URL::URL, Vector<HTTP::Header>, ByteBuffer, HTTP::CacheMode, HTTP::Cookie::IncludeCredentials, Core::ProxyData, bool keep_alive_for_transfer, RequestPriority) override;
     virtual void adopt_request(int source_client_id, u64 source_request_id, u64 target_request_id) override;
     virtual void release_request_for_transfer(u64 request_id) override;
     virtual Messages::RequestServer::StopRequestResponse stop_request(u64 request_id) override;
@@ -86,6 +86,8 @@ private:
     static int on_timeout_callback(void*, long timeout_ms, void* user_data);
     void check_active_requests();
     void fail_websocket(u64 websocket_id, Requests::WebSocket::Error);
+    void queue_websocket_message(u64 websocket_id, WebSocket::Message);
+    void flush_websocket_messages(u64 websocket_id);
 
     ErrorOr<IPC::TransportHandle> create_client_socket(IsPrivate);
 
@@ -101,6 +103,13 @@ private:
     HashTable<u64> m_pending_websockets;
     HashMap<u64, RefPtr<WebSocket::WebSocket>> m_websockets;
 
+    // Messages received in the same event loop iteration are sent to the client together.
+    struct QueuedWebSocketMessages {
+        Vector<Requests::WebSocket::Message> messages;
+        size_t size { 0 };
+    };
+    HashMap<u64, QueuedWebSocketMessages> m_queued_websocket_messages;
+
     RefPtr<Core::Timer> m_timer;
     HashMap<int, NonnullRefPtr<Core::Notifier>> m_read_notifiers;
     HashMap<int, NonnullRefPtr<Core::Notifier>> m_write_notifiers;
@@ -11,6 +11,7 @@
 #include <LibCore/MimeData.h>
 #include <LibCore/Notifier.h>
 #include <LibCore/System.h>
+#include <LibCore/Timer.h>
 #include <LibHTTP/Cache/DiskCache.h>
 #include <LibHTTP/Cache/Utilities.h>
 #include <LibHTTP/Status.h>
@@ -19,6 +20,7 @@
 #include <RequestServer/ConnectionFromClient.h>
 #include <RequestServer/Request.h>
 #include <RequestServer/Resolver.h>
+#include <RequestServer/ResourceRecorder.h>
 #include <RequestServer/ResourceSubstitutionMap.h>
 
 namespace RequestServer {
@@ -377,9 +379,10 @@ NonnullOwnPtr<Request> Request::fetch(
     HTTP::Cookie::IncludeCredentials include_credentials,
     Optional<ByteString> alt_svc_cache_path,
     Core::ProxyData proxy_data,
-    bool keep_alive_for_transfer)
+    bool keep_alive_for_transfer,
+    RequestPriority priority)
 {
-    auto request = adopt_own(*new Request { request_id, RequestType::Fetch, disk_cache, cache_mode, client, curl_multi, resolver, move(url), move(method), move(request_headers), move(request_body), include_credentials, move(alt_svc_cache_path), proxy_data, keep_alive_for_transfer });
+    auto request = adopt_own(*new Request { request_id, RequestType::Fetch, disk_cache, cache_mode, client, curl_multi, resolver, move(url), move(method), move(request_headers), move(request_body), include_credentials, move(alt_svc_cache_path), proxy_data, keep_alive_for_transfer, priority });
     request->process();
 
     return request;
@@ -434,7 +437,8 @@ Request::Request(
     HTTP::Cookie::IncludeCredentials include_credentials,
     Optional<ByteString> alt_svc_cache_path,
     Core::ProxyData proxy_data,
-    bool keep_alive_for_transfer)
+    bool keep_alive_for_transfer,
+    RequestPriority priority)
     : m_request_id(request_id)
     , m_type(type)
     , m_disk_cache(disk_cache)
@@ -451,6 +455,7 @@ Request::Request(
     , m_proxy_data(proxy_data)
     , m_response_headers(HTTP::HeaderList::create())
     , m_keep_alive_for_transfer(keep_alive_for_transfer)
+    , m_priority(priority)
 {
     if constexpr (REQUESTSERVER_WIRE_DEBUG)
         wire_stats().ensure(this).created_at = MonotonicTime::now();
@@ -534,7 +539,9 @@ void Request::notify_fetch_complete(Badge<ConnectionFromClient>, int result_code
     }
 
     if (is_revalidation_request()) {
-        if (acquire_status_code() == 304) {
+        auto status_code = acquire_status_code();
+
+        if (status_code == 304) {
             if (m_type == RequestType::BackgroundRevalidation && m_disk_cache->mode() == HTTP::DiskCache::Mode::Testing)
                 m_response_headers->set({ HTTP::TEST_CACHE_REVALIDATION_STATUS_HEADER, "fresh"sv });
 
@@ -543,6 +550,11 @@ void Request::notify_fetch_complete(Badge<ConnectionFromClient>, int result_code
             return;
         }
 
+        if ((result_code != CURLE_OK || status_code >= 500) && can_serve_stale_response_after_error(status_code)) {
+            transition_to_state(State::ReadCache);
+            return;
+        }
+
         if (revalidation_failed().is_error())
             return;
 
@@ -791,26 +803,71 @@ void Request::handle_serve_substitution_state()
     else
         content_type = Core::guess_mime_type_based_on_filename(substitution->file_path);
 
-    m_response_headers->append({ "Content-Type"sv, ByteString { content_type } });
-    m_response_headers->append({ "Content-Length"sv, ByteString::number(content.value().size()) });
-    m_response_headers->append({ "Access-Control-Allow-Origin"sv, "*"sv });
+    for (auto const& header : substitution->headers)
+        m_response_headers->append(header);
+
+    m_response_headers->set({ "Content-Type"sv, ByteString { content_type } });
+    m_response_headers->set({ "Content-Length"sv, ByteString::number(content.value().size()) });
+    m_response_headers->set({ "Access-Control-Allow-Origin"sv, "*"sv });
 
+    m_substitution_body = content.release_value();
+
+    auto const& network_conditions = g_resource_substitution_map->network_conditions();
+    if (network_conditions.latency.is_zero()) {
+        serve_substitution_response();
+        return;
+    }
+
+    m_substitution_timer = Core::Timer::create_single_shot(static_cast<int>(network_conditions.latency.to_milliseconds()), weak_callback(*this, [](auto& self) {
+        self.serve_substitution_response();
+    }));
+    m_substitution_timer->start();
+}
+
+void Request::serve_substitution_response()
+{
     if (inform_client_request_started().is_error())
         return;
     transfer_headers_to_client_if_needed();
 
-    auto write_result = m_response_buffer.write_some(content.value());
-    if (write_result.is_error()) {
-        dbgln("Request::handle_serve_substitution_state: Failed to write content to response buffer: {}", write_result.error());
-        m_network_error = Requests::NetworkError::Unknown;
-        transition_to_state(State::Error);
+    auto bytes_per_second = g_resource_substitution_map->network_conditions().bytes_per_second;
+    if (!bytes_per_second.has_value()) {
+        write_next_substitution_chunk(m_substitution_body.size());
         return;
     }
 
-    m_curl_result_code = CURLE_OK;
+    // Emulate the bandwidth by delivering the body in chunks, each covering the time between two timer ticks.
+    static constexpr int bandwidth_interval_ms = 10;
+    auto chunk_size = max<size_t>(1, *bytes_per_second * bandwidth_interval_ms / 1000);
 
-    if (write_queued_bytes_without_blocking().is_error())
+    m_substitution_timer = Core::Timer::create_repeating(bandwidth_interval_ms, weak_callback(*this, [chunk_size](auto& self) {
+        self.write_next_substitution_chunk(chunk_size);
+    }));
+    m_substitution_timer->start();
+
+    write_next_substitution_chunk(chunk_size);
+}
+
+void Request::write_next_substitution_chunk(size_t chunk_size)
+{
+    auto remaining_size = m_substitution_body.size() - m_substitution_body_offset;
+    auto chunk = m_substitution_body.bytes().slice(m_substitution_body_offset, min(chunk_size, remaining_size));
+    m_substitution_body_offset += chunk.size();
+
+    // The request completes once the final chunk has been written to the client.
+    if (m_substitution_body_offset == m_substitution_body.size()) {
+        if (m_substitution_timer)
+            m_substitution_timer->stop();
+        m_curl_result_code = CURLE_OK;
+    }
+
+    if (auto write_result = write_response_bytes(chunk); write_result.is_error()) {
+        dbgln("Request::write_next_substitution_chunk: Failed to write content to the client: {}", write_result.error());
+        if (m_substitution_timer)
+            m_substitution_timer->stop();
+        m_network_error = Requests::NetworkError::Unknown;
         transition_to_state(State::Error);
+    }
 }
 
 void Request::handle_dns_lookup_state()
@@ -824,6 +881,10 @@ void Request::handle_dns_lookup_state()
         ->when_rejected(weak_callback(*this, [host](auto& self, auto const& error) {
             mark_lifecycle_event(&self, &WireStats::dns_completed_at);
             dbgln("Request::handle_dns_lookup_state: DNS lookup failed for '{}': {}", host, error);
+            if (self.can_serve_stale_response_after_error(0)) {
+                self.transition_to_state(State::ReadCache);
+                return;
+            }
             self.m_network_error = Requests::NetworkError::UnableToResolveHost;
             self.transition_to_state(State::Error);
         }))
@@ -831,8 +892,12 @@ void Request::handle_dns_lookup_state()
             mark_lifecycle_event(&self, &WireStats::dns_completed_at);
             if (dns_result->is_empty() || !dns_result->has_cached_addresses()) {
                 dbgln("Request::handle_dns_lookup_state: DNS lookup failed for '{}'", host);
-                self.m_network_error = Requests::NetworkError::UnableToResolveHost;
-                self.transition_to_state(State::Error);
+                if (self.can_serve_stale_response_after_error(0)) {
+                    self.transition_to_state(State::ReadCache);
+                } else {
+                    self.m_network_error = Requests::NetworkError::UnableToResolveHost;
+                    self.transition_to_state(State::Error);
+                }
             } else if (first_is_one_of(self.m_type, RequestType::Fetch, RequestType::BackgroundRevalidation)) {
                 self.m_dns_result = move(dns_result);
                 self.transition_to_state(State::RetrieveCookie);
@@ -877,6 +942,7 @@ void Request::handle_connect_state()
     set_option(CURLOPT_PRIVATE, this);
 
     set_option(CURLOPT_NOSIGNAL, 1L);
+    set_option(CURLOPT_SHARE, curl_share_handle());
 
     set_option(CURLOPT_URL, m_url.to_byte_string().characters());
     set_option(CURLOPT_PORT, m_url.port_or_default());
@@ -917,6 +983,8 @@ void Request::handle_fetch_state()
             return;
     }
 
+    m_is_recording_response = g_resource_recorder && m_type == RequestType::Fetch && m_method == "GET"sv && !is_revalidation_request;
+
     auto set_option = [&](auto option, auto value) {
         if (auto result = curl_easy_setopt(m_curl_easy_handle, option, value); result != CURLE_OK)
             dbgln("Request::handle_start_fetch_state: Failed to set curl option: {}", curl_easy_strerror(result));
@@ -925,6 +993,7 @@ void Request::handle_fetch_state()
     set_option(CURLOPT_PRIVATE, this);
 
     set_option(CURLOPT_NOSIGNAL, 1L);
+    set_option(CURLOPT_SHARE, curl_share_handle());
 
     if (auto const& path = default_certificate_path(); !path.is_empty())
         set_option(CURLOPT_CAINFO, path.characters());
@@ -937,6 +1006,20 @@ void Request::handle_fetch_state()
     if (m_alt_svc_cache_path.has_value())
         set_option(CURLOPT_ALTSVC, m_alt_svc_cache_path->characters());
 
+    // Prefer waiting for an existing connection that may be multiplexed over opening a new one, and let HTTP/2 servers
+    // know which streams to serve first. The weights are relative to libcurl's default of 16.
+    set_option(CURLOPT_PIPEWAIT, 1L);
+    switch (m_priority) {
+    case RequestPriority::High:
+        set_option(CURLOPT_STREAM_WEIGHT, 256L);
+        break;
+    case RequestPriority::Normal:
+        break;
+    case RequestPriority::Low:
+        set_option(CURLOPT_STREAM_WEIGHT, 4L);
+        break;
+    }
+
     set_option(CURLOPT_CUSTOMREQUEST, m_method.characters());
     set_option(CURLOPT_FOLLOWLOCATION, 0);
     if constexpr (CURL_DEBUG) {
@@ -1054,6 +1137,9 @@ void Request::handle_complete_state()
         auto timing_info = acquire_timing_info();
         transfer_headers_to_client_if_needed();
 
+        if (m_is_recording_response)
+            g_resource_recorder->record(m_url, acquire_status_code(), *m_response_headers, m_recorded_response_body);
+
         // Finalize the disk cache entry before notifying WebContent that the request is complete: WebContent may
         // immediately fire off a JavaScript bytecode cache store against this entry, and that store needs the cache
         // index row to already exist. If we notified first the store would race the index write and be rejected.
@@ -1093,6 +1179,18 @@ void Request::handle_error_state()
     m_client->request_complete({}, *this);
 }
 
+static Optional<u32> status_code_from_status_line(StringView status_line)
+{
+    auto space_index = status_line.find(' ');
+    if (!space_index.has_value())
+        return {};
+
+    auto status = status_line.substring_view(*space_index + 1);
+    if (status.length() < 3)
+        return {};
+    return status.substring_view(0, 3).to_number<u32>();
+}
+
 size_t Request::on_header_received(void* buffer, size_t size, size_t nmemb, void* user_data)
 {
     auto& request = *static_cast<Request*>(user_data);
@@ -1100,6 +1198,38 @@ size_t Request::on_header_received(void* buffer, size_t size, size_t nmemb, void
     auto total_size = size * nmemb;
     auto header_line = StringView { static_cast<char const*>(buffer), total_size };
 
+    if (header_line.starts_with("HTTP/"sv)) {
+        auto status_code = status_code_from_status_line(header_line);
+        request.m_receiving_informational_response = status_code.has_value() && *status_code >= 100 && *status_code < 200;
+        request.m_receiving_early_hints = status_code == 103u;
+
+        if (request.m_receiving_informational_response)
+            return total_size;
+    }
+
+    if (request.m_receiving_informational_response) {
+        // https://httpwg.org/specs/rfc8297.html
+        // A 103 (Early Hints) response carries Link headers for resources the final response is likely to use. Hand
+        // them to the client as soon as the response is complete, so it can start warming connections while the
+        // server is still producing the final response.
+        if (!request.m_receiving_early_hints)
+            return total_size;
+
+        if (auto colon_index = header_line.find(':'); colon_index.has_value()) {
+            auto name = HTTP::normalize_header_value(header_line.substring_view(0, *colon_index));
+            auto value = HTTP::normalize_header_value(header_line.substring_view(*colon_index + 1));
+            request.m_early_hints.append({ name, value });
+        } else if (header_line.trim_whitespace().is_empty()) {
+            request.m_receiving_early_hints = false;
+
+            if (request.m_type == RequestType::Fetch && !request.m_early_hints.is_empty())
+                request.m_client->async_early_hints_received(request.m_request_id, move(request.m_early_hints));
+            request.m_early_hints.clear();
+        }
+
+        return total_size;
+    }
+
     // We need to extract the HTTP reason phrase since it can be a custom value. Fetching infrastructure needs this
     // value for setting the status message.
     if (!request.m_reason_phrase.has_value() && header_line.starts_with("HTTP/"sv)) {
@@ -1121,7 +1251,9 @@ size_t Request::on_header_received(void* buffer, size_t size, size_t nmemb, void
     if (auto colon_index = header_line.find(':'); colon_index.has_value()) {
         auto name = HTTP::normalize_header_value(header_line.substring_view(0, *colon_index));
         auto value = HTTP::normalize_header_value(header_line.substring_view(*colon_index + 1));
-        request.m_response_headers->append({ name, value });
+
+        auto interned_name = HTTP::intern_header_name(name);
+        request.m_response_headers->append({ interned_name.is_empty() ? ByteString { name } : move(interned_name), value });
     }
 
     return total_size;
@@ -1135,6 +1267,10 @@ size_t Request::on_data_received(void* buffer, size_t size, size_t nmemb, void*
         record_chunk(&request, size * nmemb);
 
     if (request.is_revalidation_request()) {
+        // The stored response will be served in place of this error response once the transfer completes.
+        if (request.can_serve_stale_response_after_error(request.acquire_status_code()))
+            return size * nmemb;
+
         // If we arrive here, we did not receive an HTTP 304 response code. We must remove the cache entry and inform
         // the client of the new response headers and data.
         if (request.revalidation_failed().is_error())
@@ -1156,12 +1292,10 @@ size_t Request::on_data_received(void* buffer, size_t size, size_t nmemb, void*
     auto total_size = size * nmemb;
     ReadonlyBytes bytes { static_cast<u8 const*>(buffer), total_size };
 
-    auto result = [&] -> ErrorOr<void> {
-        TRY(request.m_response_buffer.write_some(bytes));
-        return request.write_queued_bytes_without_blocking();
-    }();
+    if (request.m_is_recording_response && request.m_recorded_response_body.try_append(bytes).is_error())
+        request.m_is_recording_response = false;
 
-    if (result.is_error()) {
+    if (auto result = request.write_response_bytes(bytes); result.is_error()) {
         dbgln("Request::on_data_received: Aborting request because error occurred whilst writing data to the client: {}", result.error());
         return CURL_WRITEFUNC_ERROR;
     }
@@ -1321,16 +1455,40 @@ void Request::send_headers_to_client(Optional<IPC::File> javascript_bytecode, u6
     m_client->async_headers_became_available(m_request_id, m_response_headers->headers(), m_status_code, m_reason_phrase, move(javascript_bytecode), javascript_bytecode_size, javascript_bytecode_cache_vary_key, came_from_cache);
 }
 
-ErrorOr<void> Request::write_queued_bytes_without_blocking()
+void Request::write_bytes_to_disk_cache(ReadonlyBytes bytes)
 {
-    auto write_bytes_to_disk_cache = [&](ReadonlyBytes bytes) {
-        if (!m_cache_entry_writer.has_value())
-            return;
+    if (!m_cache_entry_writer.has_value())
+        return;
 
-        if (m_cache_entry_writer->write_data(bytes).is_error())
-            m_cache_entry_writer.clear();
-    };
+    if (m_cache_entry_writer->write_data(bytes).is_error())
+        m_cache_entry_writer.clear();
+}
 
+ErrorOr<void> Request::write_response_bytes(ReadonlyBytes bytes)
+{
+    // OPTIMIZATION: While nothing is queued, send straight from the caller's buffer, so that a client which keeps up
+    //               doesn't cost us a copy of every chunk into m_response_buffer. Only what the pipe can't take right
+    //               now is queued.
+    if (m_type != RequestType::BackgroundRevalidation && m_response_buffer.is_eof() && !bytes.is_empty()) {
+        auto result = m_client_request_pipe->write(bytes);
+        if (result.is_error()) {
+            if (!first_is_one_of(result.error().code(), EAGAIN, EWOULDBLOCK))
+                return result.release_error();
+        } else {
+            auto written = result.value();
+            write_bytes_to_disk_cache(bytes.slice(0, written));
+            m_bytes_transferred_to_client += written;
+            bytes = bytes.slice(written);
+        }
+    }
+
+    if (!bytes.is_empty())
+        TRY(m_response_buffer.write_some(bytes));
+    return write_queued_bytes_without_blocking();
+}
+
+ErrorOr<void> Request::write_queued_bytes_without_blocking()
+{
     if (m_type == RequestType::BackgroundRevalidation) {
         while (!m_response_buffer.is_eof()) {
             auto bytes = m_response_buffer.peek_some_contiguous();
@@ -1437,6 +1595,17 @@ ErrorOr<void> Request::revalidation_failed()
     return {};
 }
 
+// https://httpwg.org/specs/rfc5861.html#n-the-stale-if-error-cache-control-extension
+bool Request::can_serve_stale_response_after_error(u32 status_code) const
+{
+    if (m_type != RequestType::Fetch || !is_revalidation_request() || !m_cache_entry_reader->may_serve_stale_on_error())
+        return false;
+
+    // An error is any situation that would result in a 500, 502, 503, or 504 HTTP response status code being returned.
+    // A status code of 0 means we never received a response at all.
+    return first_is_one_of(status_code, 0u, 500u, 502u, 503u, 504u);
+}
+
 bool Request::is_cache_only_request() const
 {
     if (m_cache_mode == HTTP::CacheMode::OnlyIfCached)
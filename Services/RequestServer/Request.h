@@ -25,6 +25,7 @@
 #include <RequestServer/CacheLevel.h>
 #include <RequestServer/Forward.h>
 #include <RequestServer/RequestPipe.h>
+#include <RequestServer/RequestPriority.h>
 #include <RequestServer/RequestType.h>
 
 struct curl_slist;
@@ -47,7 +48,8 @@ public:
         HTTP::Cookie::IncludeCredentials include_credentials,
         Optional<ByteString> alt_svc_cache_path,
         Core::ProxyData proxy_data,
-        bool keep_alive_for_transfer);
+        bool keep_alive_for_transfer,
+        RequestPriority priority);
 
     static NonnullOwnPtr<Request> connect(
         u64 request_id,
@@ -157,7 +159,8 @@ private:
         HTTP::Cookie::IncludeCredentials include_credentials,
         Optional<ByteString> alt_svc_cache_path,
         Core::ProxyData proxy_data,
-        bool keep_alive_for_transfer = false);
+        bool keep_alive_for_transfer = false,
+        RequestPriority priority = RequestPriority::Normal);
 
     Request(
         u64 request_id,
@@ -173,6 +176,8 @@ private:
     void handle_read_cache_state();
     void handle_failed_cache_only_state();
     void handle_serve_substitution_state();
+    void serve_substitution_response();
+    void write_next_substitution_chunk(size_t chunk_size);
     void handle_dns_lookup_state();
     void handle_retrieve_cookie_state();
     void handle_connect_state();
@@ -189,10 +194,13 @@ private:
     ErrorOr<void> send_transferred_body_file_to_client();
     void transfer_headers_to_client_if_needed();
     void send_headers_to_client(Optional<IPC::File> javascript_bytecode = {}, u64 javascript_bytecode_size = 0, Optional<u64> javascript_bytecode_cache_vary_key = {});
+    ErrorOr<void> write_response_bytes(ReadonlyBytes);
     ErrorOr<void> write_queued_bytes_without_blocking();
+    void write_bytes_to_disk_cache(ReadonlyBytes);
 
     virtual bool is_revalidation_request() const override;
     ErrorOr<void> revalidation_failed();
+    bool can_serve_stale_response_after_error(u32 status_code) const;
 
     bool is_cache_only_request() const;
 
@@ -232,6 +240,11 @@ private:
     Optional<u32> m_status_code;
     Optional<String> m_reason_phrase;
 
+    // Headers of 1xx responses arrive on the same handle ahead of the final response and must not be merged into it.
+    bool m_receiving_informational_response { false };
+    bool m_receiving_early_hints { false };
+    Vector<HTTP::Header> m_early_hints;
+
     NonnullRefPtr<HTTP::HeaderList> m_response_headers;
     bool m_sent_response_headers_to_client { false };
 
@@ -241,9 +254,19 @@ private:
     Optional<TransferredBodyFile> m_transferred_body_file;
     size_t m_bytes_transferred_to_client { 0 };
 
+    // Substituted responses are held here while they are delivered under emulated network conditions.
+    ByteBuffer m_substitution_body;
+    size_t m_substitution_body_offset { 0 };
+    RefPtr<Core::Timer> m_substitution_timer;
+
+    bool m_is_recording_response { false };
+    ByteBuffer m_recorded_response_body;
+
     Optional<Requests::NetworkError> m_network_error;
     bool m_keep_alive_for_transfer { false };
     RefPtr<ConnectionFromClient> m_network_connection_keep_alive;
+
+    RequestPriority m_priority { RequestPriority::Normal };
 };
 
 }
@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+namespace RequestServer {
+
+// How urgently the client needs a response, derived from the fetch's priority and destination.
+enum class RequestPriority : u8 {
+    Low,
+    Normal,
+    High,
+};
+
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/AnyOf.h>
+#include <AK/Array.h>
+#include <AK/JsonObject.h>
+#include <AK/LexicalPath.h>
+#include <LibCore/Directory.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <RequestServer/ResourceRecorder.h>
+#include <RequestServer/ResourceSubstitutionMap.h>
+
+namespace RequestServer {
+
+// These describe how the response was transferred, which does not apply to the decoded body we store.
+static constexpr Array excluded_response_headers = {
+    "Connection"sv,
+    "Content-Encoding"sv,
+    "Content-Length"sv,
+    "Content-Type"sv,
+    "Keep-Alive"sv,
+    "Transfer-Encoding"sv,
+};
+
+ErrorOr<NonnullOwnPtr<ResourceRecorder>> ResourceRecorder::create(StringView directory)
+{
+    auto absolute_directory = LexicalPath::absolute_path(TRY(Core::System::getcwd()), directory);
+    TRY(Core::Directory::create(LexicalPath::join(absolute_directory, "resources"sv), Core::Directory::CreateDirectories::Yes));
+
+    auto recorder = adopt_own(*new ResourceRecorder(move(absolute_directory)));
+    TRY(recorder->write_map());
+
+    return recorder;
+}
+
+ResourceRecorder::ResourceRecorder(ByteString directory)
+    : m_directory(move(directory))
+{
+}
+
+void ResourceRecorder::record(URL::URL const& url, u32 status_code, HTTP::HeaderList const& response_headers, ReadonlyBytes body)
+{
+    if (auto result = write_resource(url, status_code, response_headers, body); result.is_error())
+        warnln("Unable to record response for '{}': {}", url, result.error());
+}
+
+ErrorOr<void> ResourceRecorder::write_resource(URL::URL const& url, u32 status_code, HTTP::HeaderList const& response_headers, ReadonlyBytes body)
+{
+    // Substitutions are looked up without the query and fragment, so only the first response for such a URL can be
+    // replayed.
+    auto normalized_url = ResourceSubstitutionMap::normalize_url(url);
+    if (m_recorded_urls.contains(normalized_url))
+        return {};
+
+    auto file_path = LexicalPath::join(m_directory, "resources"sv, ByteString::number(m_next_resource_id++)).string();
+
+    auto file = TRY(Core::File::open(file_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+    TRY(file->write_until_depleted(body));
+
+    JsonArray headers;
+    Optional<ByteString> content_type;
+
+    for (auto const& header : response_headers) {
+        if (header.name.equals_ignoring_ascii_case("Content-Type"sv))
+            content_type = header.value;
+
+        if (any_of(excluded_response_headers, [&](auto name) { return header.name.equals_ignoring_ascii_case(name); }))
+            continue;
+
+        JsonObject header_object;
+        header_object.set("name"sv, header.name);
+        header_object.set("value"sv, header.value);
+        TRY(headers.append(move(header_object)));
+    }
+
+    JsonObject substitution;
+    substitution.set("url"sv, url.serialize());
+    substitution.set("file"sv, file_path);
+    substitution.set("status_code"sv, status_code);
+    if (content_type.has_value())
+        substitution.set("content_type"sv, *content_type);
+    if (!headers.is_empty())
+        substitution.set("headers"sv, move(headers));
+
+    TRY(m_substitutions.append(move(substitution)));
+    m_recorded_urls.set(move(normalized_url));
+
+    // The map is rewritten after every response, as RequestServer is usually terminated rather than shut down.
+    return write_map();
+}
+
+ErrorOr<void> ResourceRecorder::write_map() const
+{
+    JsonObject map;
+    map.set("substitutions"sv, m_substitutions);
+
+    auto file = TRY(Core::File::open(LexicalPath::join(m_directory, map_file_name).string(), Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+    TRY(file->write_until_depleted(map.serialized()));
+
+    return {};
+}
+
+}
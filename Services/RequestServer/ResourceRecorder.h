@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/HashTable.h>
+#include <AK/JsonArray.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
+#include <AK/String.h>
+#include <LibHTTP/HeaderList.h>
+#include <LibURL/URL.h>
+
+namespace RequestServer {
+
+// Records network responses into an archive directory, along with a resource substitution map that serves them back.
+// Passing the recorded map to --resource-map replays the page load without touching the network.
+class ResourceRecorder {
+public:
+    static constexpr auto map_file_name = "resource-map.json"sv;
+
+    static ErrorOr<NonnullOwnPtr<ResourceRecorder>> create(StringView directory);
+
+    ByteString const& directory() const { return m_directory; }
+
+    void record(URL::URL const&, u32 status_code, HTTP::HeaderList const& response_headers, ReadonlyBytes body);
+
+private:
+    explicit ResourceRecorder(ByteString directory);
+
+    ErrorOr<void> write_resource(URL::URL const&, u32 status_code, HTTP::HeaderList const& response_headers, ReadonlyBytes body);
+    ErrorOr<void> write_map() const;
+
+    ByteString m_directory;
+    JsonArray m_substitutions;
+    HashTable<String> m_recorded_urls;
+    size_t m_next_resource_id { 0 };
+};
+
+extern OwnPtr<ResourceRecorder> g_resource_recorder;
+
+}
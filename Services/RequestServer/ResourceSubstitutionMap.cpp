@@ -12,7 +12,7 @@
 
 namespace RequestServer {
 
-static String normalize_url(URL::URL const& url)
+String ResourceSubstitutionMap::normalize_url(URL::URL const& url)
 {
     auto normalized = url;
     normalized.set_query({});
@@ -67,6 +67,22 @@ ErrorOr<NonnullOwnPtr<ResourceSubstitutionMap>> ResourceSubstitutionMap::load_fr
         if (auto status_code_value = obj.get("status_code"sv); status_code_value.has_value() && status_code_value->is_integer<u32>())
             substitution.status_code = status_code_value->as_integer<u32>();
 
+        if (auto headers_value = obj.get("headers"sv); headers_value.has_value() && headers_value->is_array()) {
+            for (auto const& header_value : headers_value->as_array().values()) {
+                if (!header_value.is_object())
+                    continue;
+
+                auto name = header_value.as_object().get_string("name"sv);
+                auto value = header_value.as_object().get_string("value"sv);
+                if (!name.has_value() || !value.has_value()) {
+                    warnln("Skipping header without valid 'name' and 'value' strings");
+                    continue;
+                }
+
+                substitution.headers.append({ name->to_byte_string(), value->to_byte_string() });
+            }
+        }
+
         auto url = URL::Parser::basic_parse(url_value->as_string());
         if (!url.has_value()) {
             warnln("Skipping entry with invalid URL '{}'", url_value->as_string());
@@ -13,6 +13,9 @@
 #include <AK/Optional.h>
 #include <AK/OwnPtr.h>
 #include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibHTTP/Header.h>
 #include <LibURL/URL.h>
 
 namespace RequestServer {
@@ -21,6 +24,15 @@ struct ResourceSubstitution {
     ByteString file_path;
     Optional<String> content_type;
     u32 status_code { 200 };
+    Vector<HTTP::Header> headers;
+};
+
+// Network conditions to emulate while serving substitutions, so that replayed page loads resemble real ones.
+struct SubstitutionNetworkConditions {
+    AK::Duration latency;
+    Optional<u64> bytes_per_second;
+
+    bool is_unconstrained() const { return latency.is_zero() && !bytes_per_second.has_value(); }
 };
 
 class ResourceSubstitutionMap {
@@ -30,10 +42,16 @@ public:
     Optional<ResourceSubstitution const&> lookup(URL::URL const&) const;
     ErrorOr<void> for_each_substitution(Function<ErrorOr<void>(ResourceSubstitution const&)> const&) const;
 
+    SubstitutionNetworkConditions const& network_conditions() const { return m_network_conditions; }
+    void set_network_conditions(SubstitutionNetworkConditions network_conditions) { m_network_conditions = network_conditions; }
+
+    static String normalize_url(URL::URL const&);
+
 private:
     ResourceSubstitutionMap() = default;
 
     HashMap<String, ResourceSubstitution> m_substitutions;
+    SubstitutionNetworkConditions m_network_conditions;
 };
 
 extern OwnPtr<ResourceSubstitutionMap> g_resource_substitution_map;
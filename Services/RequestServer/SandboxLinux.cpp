@@ -9,6 +9,8 @@
 #include <LibCore/Directory.h>
 #include <LibSandbox/Sandbox.h>
 #include <LibSandbox/Seccomp.h>
+#include <RequestServer/ResourceRecorder.h>
+#include <RequestServer/ResourceSubstitutionMap.h>
 #include <RequestServer/Sandbox.h>
 
 namespace RequestServer {
@@ -36,6 +38,16 @@ ErrorOr<void> apply_sandbox(Vector<ByteString> const& certificates, StringView c
         TRY(Sandbox::add_landlock_path_if_exists(paths, certificate_path, Sandbox::LandlockPath::Access::ReadOnly));
     }
 
+    if (g_resource_substitution_map) {
+        TRY(g_resource_substitution_map->for_each_substitution([&](auto const& substitution) -> ErrorOr<void> {
+            TRY(Sandbox::add_landlock_path_if_exists(paths, substitution.file_path, Sandbox::LandlockPath::Access::ReadOnly));
+            return {};
+        }));
+    }
+
+    if (g_resource_recorder)
+        TRY(Sandbox::add_landlock_path_if_exists(paths, g_resource_recorder->directory(), Sandbox::LandlockPath::Access::ReadWrite));
+
     TRY(Sandbox::add_landlock_path_if_exists(paths, cache_path, Sandbox::LandlockPath::Access::ReadWrite));
 
     TRY(Sandbox::restrict_filesystem_with_landlock(paths.span()));
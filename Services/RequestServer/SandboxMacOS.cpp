@@ -9,6 +9,7 @@
 #include <LibCore/Directory.h>
 #include <LibCore/System.h>
 #include <LibSandbox/Sandbox.h>
+#include <RequestServer/ResourceRecorder.h>
 #include <RequestServer/ResourceSubstitutionMap.h>
 #include <RequestServer/Sandbox.h>
 
@@ -51,6 +52,9 @@ ErrorOr<void> apply_sandbox(Vector<ByteString> const& certificates, StringView c
         }));
     }
 
+    if (g_resource_recorder)
+        TRY(Sandbox::add_seatbelt_path_if_exists(paths, g_resource_recorder->directory(), Sandbox::SeatbeltPath::Access::ReadWrite));
+
     TRY(Sandbox::add_seatbelt_path_if_exists(paths, cache_path, Sandbox::SeatbeltPath::Access::ReadWrite));
 
     return Sandbox::apply_macos_sandbox(paths.span(), Sandbox::NetworkAccess::Allowed);
@@ -19,12 +19,14 @@
 #include <RequestServer/CURL.h>
 #include <RequestServer/ConnectionFromClient.h>
 #include <RequestServer/Resolver.h>
+#include <RequestServer/ResourceRecorder.h>
 #include <RequestServer/ResourceSubstitutionMap.h>
 #include <RequestServer/Sandbox.h>
 
 namespace RequestServer {
 
 OwnPtr<ResourceSubstitutionMap> g_resource_substitution_map;
+OwnPtr<ResourceRecorder> g_resource_recorder;
 
 }
 
@@ -44,6 +46,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     StringView mach_server_name;
     StringView http_disk_cache_mode;
     StringView resource_map_path;
+    StringView record_resources_path;
+    u32 replay_latency_ms = 0;
+    Optional<u64> replay_bandwidth_kbps;
     StringView cache_path;
     bool wait_for_debugger = false;
     bool disable_sandbox = false;
@@ -53,6 +58,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(mach_server_name, "Mach server name", "mach-server-name", 0, "mach_server_name");
     args_parser.add_option(http_disk_cache_mode, "HTTP disk cache mode", "http-disk-cache-mode", 0, "mode");
     args_parser.add_option(resource_map_path, "Path to JSON file mapping URLs to local files", "resource-map", 0, "path");
+    args_parser.add_option(record_resources_path, "Record network responses into a resource map in this directory", "record-resources", 0, "path");
+    args_parser.add_option(replay_latency_ms, "Latency to add to responses served from the resource map", "replay-latency", 0, "ms");
+    args_parser.add_option(replay_bandwidth_kbps, "Bandwidth to limit responses served from the resource map to", "replay-bandwidth", 0, "kbit/s");
     args_parser.add_option(cache_path, "Path to the profile cache", "cache-path", 0, "path");
     args_parser.add_option(wait_for_debugger, "Wait for debugger", "wait-for-debugger");
     args_parser.add_option(disable_sandbox, "Disable process sandboxing", "disable-sandbox");
@@ -73,6 +81,25 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
             RequestServer::g_resource_substitution_map = map.release_value();
     }
 
+    if (RequestServer::g_resource_substitution_map) {
+        RequestServer::g_resource_substitution_map->set_network_conditions({
+            .latency = AK::Duration::from_milliseconds(replay_latency_ms),
+            .bytes_per_second = replay_bandwidth_kbps.map([](auto kbps) { return kbps * 1000 / 8; }),
+        });
+    }
+
+    if (!record_resources_path.is_empty()) {
+        auto recorder = RequestServer::ResourceRecorder::create(record_resources_path);
+        if (recorder.is_error()) {
+            warnln("Unable to record resources into '{}': {}", record_resources_path, recorder.error());
+        } else {
+            RequestServer::g_resource_recorder = recorder.release_value();
+
+            // Every response must come from the network to be recorded.
+            http_disk_cache_mode = "disabled"sv;
+        }
+    }
+
 #if !defined(AK_OS_WINDOWS)
     MUST(Core::System::signal(SIGPIPE, SIG_IGN));
 #endif
@@ -12,22 +12,28 @@
 #include <AK/Debug.h>
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
+#include <AK/LexicalPath.h>
 #include <AK/Math.h>
 #include <AK/OwnPtr.h>
 #include <AK/QuickSort.h>
 #include <AK/Utf16FlyString.h>
 #include <AK/Utf16String.h>
+#include <LibCore/File.h>
 #include <LibCore/Process.h>
+#include <LibCore/StandardPaths.h>
 #include <LibCore/System.h>
 #include <LibDevTools/IndexedDBSerialization.h>
 #include <LibGC/Heap.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/Color.h>
+#include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/SystemTheme.h>
+#include <LibIPC/Tracing.h>
 #include <LibJS/Runtime/ConsoleObject.h>
 #include <LibJS/Runtime/Date.h>
 #include <LibUnicode/TimeZone.h>
+#include <LibWasm/AbstractMachine/Profiler.h>
 #include <LibWasm/Types.h>
 #include <LibWeb/ARIA/RoleType.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
@@ -79,6 +85,7 @@
 #include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/Platform/FontPlugin.h>
+#include <LibWeb/Profiling/SamplingProfiler.h>
 #include <LibWeb/Selection/Selection.h>
 #include <LibWebView/Attribute.h>
 #include <LibWebView/CompositorConnection.h>
@@ -90,6 +97,10 @@
 #include <WebContent/WebContentClientEndpoint.h>
 #include <WebContent/WebContentCompositorHost.h>
 
+#if !defined(AK_OS_WINDOWS)
+#    include <sys/resource.h>
+#endif
+
 namespace WebContent {
 
 ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<IPC::Transport> transport)
@@ -260,6 +271,17 @@ void ConnectionFromClient::compositor_process_reconnected()
     m_page_host->compositor_process_reconnected();
 }
 
+void ConnectionFromClient::handle_memory_pressure(Web::MemoryPressureLevel level)
+{
+    m_page_host->handle_memory_pressure(level);
+    Gfx::Font::ShapingCache::purge_all();
+
+    // NOTE: We use deferred_invoke here to ensure that GC runs with as little on the stack as possible.
+    Core::deferred_invoke([] {
+        Web::Bindings::main_thread_vm().heap().collect_garbage(GC::Heap::CollectionType::CollectGarbage, true);
+    });
+}
+
 void ConnectionFromClient::connect_to_request_server(IPC::TransportHandle handle)
 {
     if (on_request_server_connection)
@@ -621,6 +643,65 @@ void ConnectionFromClient::debug_request(u64 page_id, ByteString request, ByteSt
         return;
     }
 
+    if (request == "set-wasm-profiler") {
+        auto& profiler = Wasm::Profiler::the();
+        // Every view of this process sends the request, but there is only one profiler per process.
+        if (argument == "on") {
+            if (!profiler.is_running())
+                MUST(profiler.start());
+            return;
+        }
+        if (!profiler.is_running())
+            return;
+        profiler.stop();
+
+        auto write_profile = [&]() -> ErrorOr<LexicalPath> {
+            LexicalPath path { Core::StandardPaths::tempfile_directory() };
+            path = path.append(TRY(AK::UnixDateTime::now().to_string("wasm-profile-%Y-%m-%d-%H-%M-%S.json"sv)));
+            auto file = TRY(Core::File::open(path.string(), Core::File::OpenMode::Write));
+            TRY(file->write_until_depleted(profiler.to_gecko_profile().serialized().bytes()));
+            return path;
+        };
+        if (auto path = write_profile(); path.is_error())
+            warnln("\033[31;1mFailed to write Wasm profile: {}\033[0m", path.error());
+        else
+            warnln("\033[33;1mWrote Wasm profile into {}, open it in the Firefox Profiler\033[0m", path.value());
+        return;
+    }
+
+    if (request == "set-js-profiler") {
+        auto& profiler = Web::Profiling::SamplingProfiler::the();
+        // Every view of this process sends the request, but there is only one profiler per process.
+        if (argument == "on") {
+            if (!profiler.is_running()) {
+                if (auto result = profiler.start(Web::Bindings::main_thread_vm()); result.is_error())
+                    warnln("\033[31;1mFailed to start the JS profiler: {}\033[0m", result.error());
+            }
+            return;
+        }
+        if (!profiler.is_running())
+            return;
+        profiler.stop();
+
+        auto write_profile = [&]() -> ErrorOr<LexicalPath> {
+            LexicalPath path { Core::StandardPaths::tempfile_directory() };
+            path = path.append(TRY(AK::UnixDateTime::now().to_string("js-profile-%Y-%m-%d-%H-%M-%S.json"sv)));
+            auto file = TRY(Core::File::open(path.string(), Core::File::OpenMode::Write));
+            TRY(file->write_until_depleted(profiler.to_gecko_profile().serialized().bytes()));
+            return path;
+        };
+        if (auto path = write_profile(); path.is_error())
+            warnln("\033[31;1mFailed to write JS profile: {}\033[0m", path.error());
+        else
+            warnln("\033[33;1mWrote JS profile into {}, open it in the Firefox Profiler\033[0m", path.value());
+        return;
+    }
+
+    if (request == "dump-ipc-traces") {
+        IPC::MessageTracing::dump();
+        return;
+    }
+
     if (request == "collect-garbage") {
         // NOTE: We use deferred_invoke here to ensure that GC runs with as little on the stack as possible.
         Core::deferred_invoke([] {
@@ -1543,6 +1624,22 @@ void ConnectionFromClient::inspect_accessibility_tree(u64 page_id)
     }
 }
 
+void ConnectionFromClient::start_sampling_profiler(u64)
+{
+    auto& profiler = Web::Profiling::SamplingProfiler::the();
+    if (profiler.is_running())
+        return;
+    if (auto result = profiler.start(Web::Bindings::main_thread_vm()); result.is_error())
+        dbgln("Failed to start the sampling profiler: {}", result.error());
+}
+
+void ConnectionFromClient::stop_sampling_profiler(u64 page_id)
+{
+    auto& profiler = Web::Profiling::SamplingProfiler::the();
+    profiler.stop();
+    async_did_stop_sampling_profiler(page_id, profiler.to_gecko_profile().serialized());
+}
+
 void ConnectionFromClient::get_hovered_node_id(u64 page_id)
 {
     auto page = this->page(page_id);
@@ -2012,6 +2109,46 @@ static void append_gc_graph(StringBuilder& builder)
     gc_graph.serialize(builder);
 }
 
+static void append_load_metrics(Web::Page& page, StringBuilder& builder)
+{
+    JsonObject metrics;
+
+    auto set_time = [&](StringView name, Optional<Web::HighResolutionTime::DOMHighResTimeStamp> time) {
+        if (time.has_value() && *time > 0)
+            metrics.set(name, *time);
+        else
+            metrics.set(name, JsonValue {});
+    };
+
+    if (auto* document = page.top_level_browsing_context().active_document()) {
+        auto const& load_timing_info = document->load_timing_info();
+        auto const& paint_timing_info = document->paint_timing_info();
+
+        set_time("first_contentful_paint_ms"sv, paint_timing_info.first_contentful_paint_time);
+        set_time("largest_contentful_paint_ms"sv, paint_timing_info.largest_contentful_paint_time);
+        set_time("dom_content_loaded_ms"sv, load_timing_info.dom_content_loaded_event_start_time);
+        set_time("load_ms"sv, load_timing_info.load_event_start_time);
+    }
+
+    // These are totals for this process, which only ever hosts the page being measured in headless benchmark mode.
+    metrics.set("style_ms"sv, Web::Profiling::time_spent_in_phase(Web::Profiling::Phase::Style).to_microseconds() / 1000.0);
+    metrics.set("layout_ms"sv, Web::Profiling::time_spent_in_phase(Web::Profiling::Phase::Layout).to_microseconds() / 1000.0);
+    metrics.set("paint_ms"sv, Web::Profiling::time_spent_in_phase(Web::Profiling::Phase::Paint).to_microseconds() / 1000.0);
+
+#if !defined(AK_OS_WINDOWS)
+    if (struct rusage usage {}; getrusage(RUSAGE_SELF, &usage) == 0) {
+#    if defined(AK_OS_MACOS)
+        // On macOS, the maximum resident set size is reported in bytes rather than kilobytes.
+        metrics.set("peak_memory_bytes"sv, static_cast<u64>(usage.ru_maxrss));
+#    else
+        metrics.set("peak_memory_bytes"sv, static_cast<u64>(usage.ru_maxrss) * KiB);
+#    endif
+    }
+#endif
+
+    metrics.serialize(builder);
+}
+
 void ConnectionFromClient::request_internal_page_info(u64 page_id, WebView::PageInfoType type)
 {
     auto page = this->page(page_id);
@@ -2050,6 +2187,12 @@ void ConnectionFromClient::request_internal_page_info(u64 page_id, WebView::Page
         append_gc_graph(builder);
     }
 
+    if (has_flag(type, WebView::PageInfoType::LoadMetrics)) {
+        if (!builder.is_empty())
+            builder.append("\n"sv);
+        append_load_metrics(page->page(), builder);
+    }
+
     auto buffer = MUST(Core::AnonymousBuffer::create_with_size(builder.length()));
     if (builder.length() > 0)
         memcpy(buffer.data<void>(), builder.string_view().characters_without_null_termination(), builder.length());
@@ -85,6 +85,7 @@ private:
     virtual void connect_to_image_decoder(IPC::TransportHandle handle) override;
     virtual void connect_to_compositor_process(IPC::TransportHandle handle) override;
     virtual void compositor_process_reconnected() override;
+    virtual void handle_memory_pressure(Web::MemoryPressureLevel) override;
     virtual void update_system_theme(u64 page_id, Core::AnonymousBuffer) override;
     virtual void update_screen_rects(u64 page_id, Vector<Web::DevicePixelRect>, u32) override;
     virtual void load_url(u64 page_id, URL::URL, Web::Bindings::NavigationHistoryBehavior) override;
@@ -132,6 +133,8 @@ private:
     virtual void highlight_grid(u64 page_id, Web::UniqueNodeID node_id, JsonValue options) override;
     virtual void clear_grid_highlight(u64 page_id, Web::UniqueNodeID node_id) override;
     virtual void inspect_accessibility_tree(u64 page_id) override;
+    virtual void start_sampling_profiler(u64 page_id) override;
+    virtual void stop_sampling_profiler(u64 page_id) override;
     virtual void get_hovered_node_id(u64 page_id) override;
     virtual void get_node_id_at_position(u64 page_id, u64 request_id, Web::DevicePixelPoint position) override;
 
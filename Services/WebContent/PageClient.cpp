@@ -38,6 +38,7 @@
 #include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
 #include <LibWeb/Geolocation/GeolocationCoordinates.h>
 #include <LibWeb/Geolocation/GeolocationPositionError.h>
+#include <LibWeb/HTML/BackForwardCache.h>
 #include <LibWeb/HTML/BrowsingContext.h>
 #include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/HTMLIFrameElement.h>
@@ -389,6 +390,20 @@ void PageClient::compositor_process_lost()
     page().notify_all_webgl_contexts_lost();
 }
 
+void PageClient::handle_memory_pressure(Web::MemoryPressureLevel level)
+{
+    auto traversable = page().top_level_traversable();
+    auto is_hidden = traversable->system_visibility_state() == Web::HTML::VisibilityState::Hidden;
+
+    // Documents in the back/forward cache can be loaded again if the user navigates back to them.
+    if (is_hidden || level == Web::MemoryPressureLevel::Critical)
+        traversable->back_forward_cache().evict_all();
+
+    // Nothing is rendered for a hidden page, so its rendering state can be rebuilt once it becomes visible again.
+    if (is_hidden)
+        traversable->drop_rendering_state_for_memory_pressure();
+}
+
 void PageClient::compositor_process_reconnected()
 {
     // Drop canvas commands recorded for the previous Compositor process: the
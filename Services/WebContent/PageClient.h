@@ -20,6 +20,7 @@
 #include <LibWeb/HTML/ReplicatedNavigableState.h>
 #include <LibWeb/HTML/Scripting/ScriptRegistry.h>
 #include <LibWeb/HTML/SessionHistoryEntry.h>
+#include <LibWeb/Page/MemoryPressureLevel.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/PixelUnits.h>
 #include <LibWeb/StorageAPI/StorageEndpoint.h>
@@ -96,6 +97,7 @@ public:
     void set_window_size(Web::DevicePixelSize);
     void compositor_process_reconnected();
     void compositor_process_lost();
+    void handle_memory_pressure(Web::MemoryPressureLevel);
 
     void toggle_media_play_state();
     void toggle_media_mute_state();
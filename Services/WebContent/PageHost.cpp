@@ -83,4 +83,10 @@ void PageHost::compositor_process_lost()
         page->compositor_process_lost();
 }
 
+void PageHost::handle_memory_pressure(Web::MemoryPressureLevel level)
+{
+    for (auto& [_, page] : m_pages)
+        page->handle_memory_pressure(level);
+}
+
 }
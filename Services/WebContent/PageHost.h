@@ -14,6 +14,7 @@
 #include <AK/OwnPtr.h>
 #include <LibGC/Root.h>
 #include <LibWeb/HTML/CrossProcessId.h>
+#include <LibWeb/Page/MemoryPressureLevel.h>
 #include <WebContent/Forward.h>
 
 namespace Web {
@@ -47,6 +48,7 @@ public:
     void ensure_compositor_host();
     void compositor_process_reconnected();
     void compositor_process_lost();
+    void handle_memory_pressure(Web::MemoryPressureLevel);
     Web::Compositor::CompositorHost* compositor_host() { return m_compositor_host.ptr(); }
     Web::Compositor::CompositorHost const* compositor_host() const { return m_compositor_host.ptr(); }
 
@@ -343,6 +343,11 @@ void WebDriverConnection::set_strict_file_interactability(bool strict_file_inter
     m_strict_file_interactability = strict_file_interactability;
 }
 
+void WebDriverConnection::set_screenshot_compression_level(Optional<u8> compression_level)
+{
+    m_screenshot_compression_level = compression_level;
+}
+
 void WebDriverConnection::set_is_webdriver_active(bool is_webdriver_active)
 {
     current_browsing_context().page().set_is_webdriver_active(is_webdriver_active);
@@ -2666,14 +2671,14 @@ Messages::WebDriverClient::TakeScreenshotResponse WebDriverConnection::take_scre
 
             // b. Let screenshot result be the result of trying to call draw a bounding box from the framebuffer, given root rect as an argument.
             // c. Let canvas be a canvas element of screenshot result's data.
-            auto canvas = WEBDRIVER_TRY(Web::WebDriver::draw_bounding_box_from_the_framebuffer(*current_top_level_browsing_context(), *document->document_element(), root_rect));
+            auto canvas = WEBDRIVER_TRY(Web::WebDriver::draw_bounding_box_from_the_framebuffer(*current_top_level_browsing_context(), root_rect));
 
             // d. Let encoding result be the result of trying encoding a canvas as Base64 canvas.
             // e. Let encoded string be encoding result's data.
-            auto encoded_string = Web::WebDriver::encode_canvas_element(canvas);
-
-            // 3. Return success with data encoded string.
-            async_driver_execution_complete(move(encoded_string));
+            Web::WebDriver::encode_screenshot_as_base64(move(canvas), m_screenshot_compression_level, [protector = NonnullRefPtr { *this }](Web::WebDriver::Response encoded_string) {
+                // 3. Return success with data encoded string.
+                protector->async_driver_execution_complete(move(encoded_string));
+            });
         }));
         document->page().client().request_frame();
     });
@@ -2705,14 +2710,14 @@ Messages::WebDriverClient::TakeElementScreenshotResponse WebDriverConnection::ta
 
             // b. Let screenshot result be the result of trying to call draw a bounding box from the framebuffer, given element rect as an argument.
             // c. Let canvas be a canvas element of screenshot result's data.
-            auto canvas = WEBDRIVER_TRY(Web::WebDriver::draw_bounding_box_from_the_framebuffer(current_browsing_context(), element, element_rect));
+            auto canvas = WEBDRIVER_TRY(Web::WebDriver::draw_bounding_box_from_the_framebuffer(current_browsing_context(), element_rect));
 
             // d. Let encoding result be the result of trying encoding a canvas as Base64 canvas.
             // e. Let encoded string be encoding result's data.
-            auto encoded_string = Web::WebDriver::encode_canvas_element(canvas);
-
-            // 6. Return success with data encoded string.
-            async_driver_execution_complete(move(encoded_string));
+            Web::WebDriver::encode_screenshot_as_base64(move(canvas), m_screenshot_compression_level, [protector = NonnullRefPtr { *this }](Web::WebDriver::Response encoded_string) {
+                // 6. Return success with data encoded string.
+                protector->async_driver_execution_complete(move(encoded_string));
+            });
         }));
         document->page().client().request_frame();
     });
@@ -55,6 +55,7 @@ private:
     virtual void set_page_load_strategy(Web::WebDriver::PageLoadStrategy page_load_strategy) override;
     virtual void set_user_prompt_handler(Web::WebDriver::UserPromptHandler user_prompt_handler) override;
     virtual void set_strict_file_interactability(bool strict_file_interactability) override;
+    virtual void set_screenshot_compression_level(Optional<u8> compression_level) override;
     virtual void set_is_webdriver_active(bool) override;
     virtual Messages::WebDriverClient::GetTimeoutsResponse get_timeouts() override;
     virtual Messages::WebDriverClient::SetTimeoutsResponse set_timeouts(JsonValue payload) override;
@@ -169,6 +170,8 @@ private:
     // https://w3c.github.io/webdriver/#dfn-strict-file-interactability
     bool m_strict_file_interactability { false };
 
+    Optional<u8> m_screenshot_compression_level;
+
     // https://w3c.github.io/webdriver/#dfn-session-script-timeout
     Web::WebDriver::TimeoutsConfiguration m_timeouts_configuration;
 
@@ -13,6 +13,7 @@
 #include <LibCore/System.h>
 #include <LibCore/TimeZone.h>
 #include <LibCrypto/OpenSSLForward.h>
+#include <LibGfx/Font/DecodedFontCache.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/Font/PathFontProvider.h>
 #include <LibIPC/ConnectionFromClient.h>
@@ -243,6 +244,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
     Web::Platform::FontPlugin::install(*new Web::Platform::FontPlugin(enable_test_mode, &font_provider));
 
+    if (!cache_path.is_empty())
+        Gfx::DecodedFontCache::initialize(Gfx::DecodedFontCache::directory_for_cache_path(cache_path));
+
     Web::Bindings::initialize_main_thread_vm(Web::Bindings::AgentType::SimilarOriginWindow);
 
     if (collect_garbage_on_every_allocation)
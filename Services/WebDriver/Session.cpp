@@ -282,6 +282,7 @@ ErrorOr<void> Session::accept_web_content_transport(NonnullOwnPtr<IPC::Transport
 
         pending_connection->async_set_page_load_strategy(m_page_load_strategy);
         pending_connection->async_set_strict_file_interactability(m_strict_file_interactiblity);
+        pending_connection->async_set_screenshot_compression_level(m_options.screenshot_compression_level);
         pending_connection->async_set_user_prompt_handler(Web::WebDriver::user_prompt_handler());
         if (m_timeouts_configuration.has_value())
             pending_connection->async_set_timeouts(*m_timeouts_configuration);
@@ -10,6 +10,7 @@
 #include <LibCore/System.h>
 #include <LibCrypto/OpenSSLForward.h>
 #include <LibFileSystem/FileSystem.h>
+#include <LibGfx/Font/DecodedFontCache.h>
 #include <LibIPC/SingleServer.h>
 #include <LibIPC/Transport.h>
 #include <LibIPC/TransportHandle.h>
@@ -97,6 +98,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
     Web::Platform::FontPlugin::install(*new Web::Platform::FontPlugin(false));
 
+    if (!cache_path.is_empty())
+        Gfx::DecodedFontCache::initialize(Gfx::DecodedFontCache::directory_for_cache_path(cache_path));
+
     Web::Bindings::initialize_main_thread_vm(worker_type);
 
     if (!disable_sandbox)
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/Coroutine.h>
+#include <AK/Error.h>
+
+namespace {
+
+// A minimal awaitable that suspends until it is resumed by the test.
+struct ManualEvent {
+    bool await_ready() const { return is_set; }
+    void await_suspend(std::coroutine_handle<> handle) { waiter = handle; }
+    int await_resume() const { return value; }
+
+    void set(int new_value)
+    {
+        value = new_value;
+        is_set = true;
+        if (auto handle = exchange(waiter, {}))
+            handle.resume();
+    }
+
+    bool is_set { false };
+    int value { 0 };
+    std::coroutine_handle<> waiter;
+};
+
+}
+
+static Coroutine<int> return_immediately(int value)
+{
+    co_return value;
+}
+
+static Coroutine<int> wait_for_event(ManualEvent& event)
+{
+    auto value = co_await event;
+    co_return value * 2;
+}
+
+static Coroutine<int> await_nested(ManualEvent& event)
+{
+    auto first = co_await return_immediately(1);
+    auto second = co_await wait_for_event(event);
+    co_return first + second;
+}
+
+static Coroutine<ErrorOr<int>> fail_if_negative(int value)
+{
+    if (value < 0)
+        co_return Error::from_string_literal("Negative value");
+    co_return value;
+}
+
+static Coroutine<ErrorOr<int>> add_one_if_not_negative(int value)
+{
+    auto awaited = co_await fail_if_negative(value);
+    auto result = CO_TRY(move(awaited));
+    co_return result + 1;
+}
+
+TEST_CASE(coroutine_that_does_not_suspend_completes_on_call)
+{
+    auto coroutine = return_immediately(42);
+    EXPECT(coroutine.is_ready());
+    EXPECT_EQ(coroutine.take_result(), 42);
+}
+
+TEST_CASE(coroutine_resumes_when_awaited_event_is_set)
+{
+    ManualEvent event;
+
+    auto coroutine = await_nested(event);
+    EXPECT(!coroutine.is_ready());
+
+    event.set(20);
+    EXPECT(coroutine.is_ready());
+    EXPECT_EQ(coroutine.take_result(), 41);
+}
+
+TEST_CASE(co_try_propagates_errors)
+{
+    auto success = add_one_if_not_negative(1);
+    EXPECT(success.is_ready());
+    EXPECT_EQ(success.take_result().release_value(), 2);
+
+    auto failure = add_one_if_not_negative(-1);
+    EXPECT(failure.is_ready());
+    EXPECT(failure.take_result().is_error());
+}
+
+TEST_CASE(detached_coroutine_keeps_running)
+{
+    ManualEvent event;
+    int observed_value = 0;
+
+    auto observe = [](ManualEvent& event, int& observed_value) -> Coroutine<void> {
+        observed_value = co_await event;
+    };
+
+    (void)observe(event, observed_value);
+    EXPECT_EQ(observed_value, 0);
+
+    event.set(7);
+    EXPECT_EQ(observed_value, 7);
+}
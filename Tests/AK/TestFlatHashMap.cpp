@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/ByteString.h>
+#include <AK/FlatHashMap.h>
+#include <AK/HashMap.h>
+#include <AK/OwnPtr.h>
+#include <AK/String.h>
+
+TEST_CASE(construct)
+{
+    using IntIntMap = FlatHashMap<int, int>;
+    EXPECT(IntIntMap().is_empty());
+    EXPECT_EQ(IntIntMap().size(), 0u);
+    EXPECT(IntIntMap().begin() == IntIntMap().end());
+    EXPECT(!IntIntMap().contains(0));
+}
+
+TEST_CASE(construct_from_initializer_list)
+{
+    FlatHashMap<int, ByteString> number_to_string {
+        { 1, "One" },
+        { 2, "Two" },
+        { 3, "Three" },
+    };
+    EXPECT_EQ(number_to_string.size(), 3u);
+    EXPECT_EQ(number_to_string.get(2).value(), "Two");
+}
+
+TEST_CASE(set_replaces_or_keeps_existing_entries)
+{
+    FlatHashMap<int, ByteString> number_to_string;
+    EXPECT_EQ(number_to_string.set(1, "One"), HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(number_to_string.set(1, "Uno"), HashSetResult::ReplacedExistingEntry);
+    EXPECT_EQ(number_to_string.get(1).value(), "Uno");
+
+    EXPECT_EQ(number_to_string.set(1, "Ein", HashSetExistingEntryBehavior::Keep), HashSetResult::KeptExistingEntry);
+    EXPECT_EQ(number_to_string.get(1).value(), "Uno");
+    EXPECT_EQ(number_to_string.size(), 1u);
+}
+
+TEST_CASE(remove)
+{
+    FlatHashMap<int, int> map;
+    for (int i = 0; i < 100; ++i)
+        map.set(i, i * i);
+
+    for (int i = 0; i < 100; i += 2)
+        EXPECT(map.remove(i));
+    EXPECT(!map.remove(0));
+    EXPECT_EQ(map.size(), 50u);
+
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(map.contains(i), i % 2 == 1);
+}
+
+TEST_CASE(removed_slots_are_reused)
+{
+    FlatHashMap<int, int> map;
+    map.ensure_capacity(64);
+    auto capacity = map.capacity();
+
+    // Churning through far more keys than fit must not grow the table, since the slots of removed entries are reused.
+    for (int i = 0; i < 10'000; ++i) {
+        map.set(i, i);
+        if (i >= 32)
+            EXPECT(map.remove(i - 32));
+    }
+    EXPECT_EQ(map.size(), 32u);
+    EXPECT_EQ(map.capacity(), capacity);
+
+    for (int i = 10'000 - 32; i < 10'000; ++i)
+        EXPECT_EQ(map.get(i).value(), i);
+}
+
+TEST_CASE(many_entries)
+{
+    FlatHashMap<u64, u64> map;
+    for (u64 i = 0; i < 100'000; ++i)
+        map.set(i * 7919, i);
+    EXPECT_EQ(map.size(), 100'000u);
+
+    for (u64 i = 0; i < 100'000; ++i)
+        EXPECT_EQ(map.get(i * 7919).value(), i);
+    EXPECT(!map.contains(1));
+}
+
+TEST_CASE(iteration)
+{
+    FlatHashMap<int, int> map;
+    for (int i = 0; i < 1000; ++i)
+        map.set(i, -i);
+
+    size_t count = 0;
+    int sum = 0;
+    for (auto const& [key, value] : map) {
+        EXPECT_EQ(value, -key);
+        sum += key;
+        ++count;
+    }
+    EXPECT_EQ(count, 1000u);
+    EXPECT_EQ(sum, 999 * 1000 / 2);
+
+    auto keys = map.keys();
+    EXPECT_EQ(keys.size(), 1000u);
+}
+
+TEST_CASE(remove_all_matching)
+{
+    FlatHashMap<int, int> map;
+    for (int i = 0; i < 100; ++i)
+        map.set(i, i);
+
+    EXPECT(map.remove_all_matching([](int key, int) { return key % 3 == 0; }));
+    EXPECT_EQ(map.size(), 66u);
+    EXPECT(!map.remove_all_matching([](int key, int) { return key % 3 == 0; }));
+
+    for (auto const& it : map)
+        EXPECT_NE(it.key % 3, 0);
+
+    EXPECT(map.remove_all_matching([](int, int) { return true; }));
+    EXPECT(map.is_empty());
+}
+
+TEST_CASE(take_and_ensure)
+{
+    FlatHashMap<String, int> map;
+    map.set("one"_string, 1);
+
+    EXPECT_EQ(map.ensure("two"_string, [] { return 2; }), 2);
+    map.ensure("two"_string, [] { return 3; }) += 10;
+    EXPECT_EQ(map.get("two"_string).value(), 12);
+
+    EXPECT_EQ(map.take("one"_string), 1);
+    EXPECT(!map.take("one"_string).has_value());
+    EXPECT_EQ(map.size(), 1u);
+}
+
+TEST_CASE(string_keys_are_found_by_string_view)
+{
+    FlatHashMap<String, int> map;
+    map.set("apple"_string, 1);
+    map.set("banana"_string, 2);
+
+    EXPECT(map.contains("apple"sv));
+    EXPECT_EQ(map.get("banana"sv).value(), 2);
+    EXPECT(map.remove("apple"sv));
+    EXPECT(!map.contains("apple"sv));
+}
+
+TEST_CASE(non_trivial_values)
+{
+    FlatHashMap<int, OwnPtr<int>> map;
+    for (int i = 0; i < 500; ++i)
+        map.set(i, make<int>(i));
+    for (int i = 0; i < 500; i += 5)
+        map.remove(i);
+
+    auto moved = move(map);
+    EXPECT(map.is_empty());
+    EXPECT_EQ(moved.size(), 400u);
+    for (int i = 1; i < 500; i += 5)
+        EXPECT_EQ(*moved.get(i).value(), i);
+
+    moved.clear();
+    EXPECT(moved.is_empty());
+}
+
+TEST_CASE(clone_and_compare)
+{
+    FlatHashMap<int, ByteString> map;
+    for (int i = 0; i < 50; ++i)
+        map.set(i, ByteString::number(i));
+
+    auto copy = MUST(map.clone());
+    EXPECT(copy == map);
+
+    copy.set(50, "50");
+    EXPECT(copy != map);
+}
+
+static constexpr int ITERATION_COUNT = 10;
+static constexpr int ENTRY_COUNT = 100'000;
+
+template<typename Map>
+static void insert_entries()
+{
+    for (int iter = 0; iter < ITERATION_COUNT; ++iter) {
+        Map map;
+        for (int i = 0; i < ENTRY_COUNT; ++i)
+            map.set(i, i);
+    }
+}
+
+template<typename Map>
+static void look_up_entries()
+{
+    Map map;
+    for (int i = 0; i < ENTRY_COUNT; ++i)
+        map.set(i * 2, i);
+
+    size_t found = 0;
+    for (int iter = 0; iter < ITERATION_COUNT; ++iter) {
+        for (int i = 0; i < ENTRY_COUNT * 2; ++i)
+            found += map.contains(i);
+    }
+    EXPECT_EQ(found, static_cast<size_t>(ENTRY_COUNT * ITERATION_COUNT));
+}
+
+template<typename Map>
+static void iterate_entries()
+{
+    Map map;
+    for (int i = 0; i < ENTRY_COUNT; ++i)
+        map.set(i, i);
+
+    i64 sum = 0;
+    for (int iter = 0; iter < ITERATION_COUNT * 10; ++iter) {
+        for (auto const& [key, value] : map)
+            sum += value;
+    }
+    EXPECT(sum > 0);
+}
+
+BENCHMARK_CASE(insert_hash_map)
+{
+    insert_entries<HashMap<int, int>>();
+}
+
+BENCHMARK_CASE(insert_flat_hash_map)
+{
+    insert_entries<FlatHashMap<int, int>>();
+}
+
+BENCHMARK_CASE(look_up_hash_map)
+{
+    look_up_entries<HashMap<int, int>>();
+}
+
+BENCHMARK_CASE(look_up_flat_hash_map)
+{
+    look_up_entries<FlatHashMap<int, int>>();
+}
+
+BENCHMARK_CASE(iterate_hash_map)
+{
+    iterate_entries<HashMap<int, int>>();
+}
+
+BENCHMARK_CASE(iterate_flat_hash_map)
+{
+    iterate_entries<FlatHashMap<int, int>>();
+}
@@ -9,6 +9,7 @@
 #include <AK/Noncopyable.h>
 #include <AK/QuickSort.h>
 #include <AK/StdLibExtras.h>
+#include <AK/Vector.h>
 
 TEST_CASE(sorts_without_copy)
 {
@@ -95,3 +96,27 @@ TEST_CASE(maximum_stack_depth)
 
     delete[] data;
 }
+
+TEST_CASE(worst_case_input_falls_back_to_heap_sort)
+{
+    int const size = 1 << 14;
+    Vector<int> data;
+    for (int i = 0; i < size; i++)
+        data.append(i);
+
+    // The same construction as above, which makes every partition as lopsided as it can be.
+    for (int i = 0; i < size / 2; i++)
+        swap(data[i], data[i + (size - i) / 2]);
+
+    size_t comparisons = 0;
+    AK::single_pivot_quick_sort(data.begin(), data.end(), [&](int a, int b) {
+        ++comparisons;
+        return a < b;
+    });
+
+    for (int i = 0; i < size; i++)
+        EXPECT_EQ(data[i], i);
+
+    // Quadratic behavior would take tens of millions of comparisons here.
+    EXPECT(comparisons < 100 * size);
+}
@@ -58,7 +58,8 @@ TEST_CASE(rasterization_clears_damaged_pixels_to_the_canvas_color_in_presentatio
 {
     TestWebContentClient client;
     Web::Painting::CanvasSurfaceRegistry canvas_surface_registry;
-    Compositor::ContextState context { 0, client, canvas_surface_registry, false };
+    Web::Painting::ImageTextureCache image_texture_cache;
+    Compositor::ContextState context { 0, client, canvas_surface_registry, image_texture_cache, false };
     Web::Painting::DisplayListPlayerSkia display_list_player { RefPtr<Gfx::SkiaBackendContext> {} };
     auto visual_context_tree = Web::Painting::AccumulatedVisualContextTree::create();
     auto viewport_rect = Gfx::IntRect { 0, 0, 4, 4 };
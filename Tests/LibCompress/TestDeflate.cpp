@@ -149,6 +149,16 @@ TEST_CASE(deflate_round_trip_compress_large)
     EXPECT(uncompressed == original);
 }
 
+TEST_CASE(deflate_round_trip_compress_parallel)
+{
+    auto original = TRY_OR_FAIL(ByteBuffer::create_uninitialized(Compress::minimum_size_for_parallel_compression + 100));
+    fill_with_random(original);
+
+    auto compressed = TRY_OR_FAIL(Compress::DeflateCompressor::compress_all(original, Compress::GenericZlibCompressionLevel::Fastest));
+    auto uncompressed = TRY_OR_FAIL(Compress::DeflateDecompressor::decompress_all(compressed));
+    EXPECT(uncompressed == original);
+}
+
 TEST_CASE(deflate_compress_literals)
 {
     // This byte array is known to not produce any back references with our lz77 implementation even at the highest compression settings
@@ -91,6 +91,24 @@ TEST_CASE(gzip_round_trip)
     EXPECT(uncompressed == original);
 }
 
+TEST_CASE(gzip_round_trip_parallel)
+{
+    // Repeat a random pattern that is shorter than the window, so that only back references across block boundaries
+    // can make the start of each block compress well.
+    auto pattern = TRY_OR_FAIL(ByteBuffer::create_uninitialized(16 * KiB));
+    fill_with_random(pattern);
+
+    ByteBuffer original;
+    while (original.size() < 3 * MiB)
+        original.append(pattern);
+
+    auto compressed = TRY_OR_FAIL(Compress::GzipCompressor::compress_all(original, Compress::GenericZlibCompressionLevel::Fastest));
+    EXPECT(compressed.size() < original.size() / 16);
+
+    auto uncompressed = TRY_OR_FAIL(Compress::GzipDecompressor::decompress_all(compressed));
+    EXPECT(uncompressed == original);
+}
+
 TEST_CASE(gzip_truncated_uncompressed_block)
 {
     Array<u8, 38> const compressed {
@@ -77,6 +77,18 @@ TEST_CASE(zlib_round_trip_simple_fastest)
     EXPECT(decompressed.bytes() == (ReadonlyBytes { uncompressed, sizeof(uncompressed) - 1 }));
 }
 
+TEST_CASE(zlib_round_trip_parallel)
+{
+    auto original = TRY_OR_FAIL(ByteBuffer::create_zeroed(2 * MiB + 1));
+    fill_with_random(original.bytes().trim(1 * MiB));
+
+    auto const freshly_pressed = TRY_OR_FAIL(Compress::ZlibCompressor::compress_all(original, Compress::GenericZlibCompressionLevel::Default));
+    EXPECT(freshly_pressed.span().slice(0, 2) == ReadonlyBytes { { 0x78, 0x9C } });
+
+    auto const decompressed = TRY_OR_FAIL(Compress::ZlibDecompressor::decompress_all(freshly_pressed));
+    EXPECT(decompressed == original);
+}
+
 TEST_CASE(zlib_decompress_with_missing_end_bits)
 {
     // This test case has been extracted from compressed PNG data of `/res/icons/16x16/app-masterword.png`.
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/Coroutine.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/System.h>
+#include <LibTest/TestCase.h>
+#include <LibThreading/Thread.h>
+
+TEST_CASE(yield_resumes_from_event_loop)
+{
+    Core::EventLoop loop;
+    Vector<int> order;
+
+    auto coroutine = [](Vector<int>& order) -> Coroutine<void> {
+        order.append(1);
+        co_await Core::yield_to_event_loop();
+        order.append(3);
+    }(order);
+
+    order.append(2);
+    Core::await_coroutine(move(coroutine));
+
+    EXPECT_EQ(order, (Vector<int> { 1, 2, 3 }));
+}
+
+TEST_CASE(sleep_waits_for_at_least_the_given_duration)
+{
+    Core::EventLoop loop;
+
+    auto start = MonotonicTime::now();
+    Core::await_coroutine([]() -> Coroutine<void> {
+        co_await Core::sleep_for(AK::Duration::from_milliseconds(20));
+    }());
+
+    EXPECT(MonotonicTime::now() - start >= AK::Duration::from_milliseconds(20));
+}
+
+TEST_CASE(await_promise)
+{
+    Core::EventLoop loop;
+
+    auto resolved_promise = Core::Promise<int>::construct();
+    auto rejected_promise = Core::Promise<int>::construct();
+
+    loop.deferred_invoke([=] {
+        resolved_promise->resolve(42);
+        rejected_promise->reject(Error::from_string_literal("Rejected"));
+    });
+
+    auto result = Core::await_coroutine([](auto resolved_promise, auto rejected_promise) -> Coroutine<ErrorOr<int>> {
+        auto value = co_await resolved_promise;
+        auto error = co_await rejected_promise;
+        VERIFY(error.is_error());
+        co_return value;
+    }(resolved_promise, rejected_promise));
+
+    EXPECT_EQ(result.release_value(), 42);
+}
+
+TEST_CASE(await_already_resolved_promise)
+{
+    Core::EventLoop loop;
+
+    auto promise = Core::Promise<int>::construct();
+    promise->resolve(7);
+
+    auto coroutine = [](auto promise) -> Coroutine<int> {
+        auto result = co_await promise;
+        co_return result.release_value();
+    }(promise);
+
+    EXPECT(coroutine.is_ready());
+    EXPECT_EQ(coroutine.take_result(), 7);
+}
+
+TEST_CASE(await_threaded_promise_resumes_on_awaiting_thread)
+{
+    Core::EventLoop loop;
+
+    auto promise = Core::ThreadedPromise<int, Error>::create();
+    auto thread = Threading::Thread::construct("TestCoroutine"sv, [promise] {
+        promise->resolve(99);
+        return 0;
+    });
+
+    auto result = Core::await_coroutine([](auto promise, auto thread) -> Coroutine<ErrorOr<int>> {
+        auto* awaiting_event_loop = &Core::EventLoop::current();
+        thread->start();
+
+        auto result = co_await promise;
+        VERIFY(&Core::EventLoop::current() == awaiting_event_loop);
+        co_return result;
+    }(promise, thread));
+
+    (void)thread->join();
+    EXPECT_EQ(result.release_value(), 99);
+}
+
+TEST_CASE(wait_for_notification)
+{
+    Core::EventLoop loop;
+
+    auto fds = MUST(Core::System::pipe2(0));
+
+    auto coroutine = [](int read_fd) -> Coroutine<u8> {
+        co_await Core::wait_for_notification(read_fd, Core::Notifier::Type::Read);
+
+        u8 byte = 0;
+        MUST(Core::System::read(read_fd, { &byte, 1 }));
+        co_return byte;
+    }(fds[0]);
+
+    loop.deferred_invoke([write_fd = fds[1]] {
+        u8 byte = 0x2a;
+        MUST(Core::System::write(write_fd, { &byte, 1 }));
+    });
+
+    EXPECT_EQ(Core::await_coroutine(move(coroutine)), 0x2a);
+
+    MUST(Core::System::close(fds[0]));
+    MUST(Core::System::close(fds[1]));
+}
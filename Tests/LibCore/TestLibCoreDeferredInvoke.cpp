@@ -5,9 +5,11 @@
  */
 
 #include <AK/Format.h>
+#include <AK/Vector.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/Timer.h>
 #include <LibTest/TestCase.h>
+#include <LibThreading/Thread.h>
 
 TEST_CASE(deferred_invoke)
 {
@@ -23,3 +25,40 @@ TEST_CASE(deferred_invoke)
 
     event_loop.exec();
 }
+
+TEST_CASE(deferred_invoke_from_other_threads)
+{
+    static constexpr size_t thread_count = 4;
+    static constexpr size_t invocations_per_thread = 10'000;
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA Core::EventLoop event_loop;
+    IGNORE_USE_IN_ESCAPING_LAMBDA Vector<size_t> next_invocation;
+    IGNORE_USE_IN_ESCAPING_LAMBDA size_t total_invocations = 0;
+    IGNORE_USE_IN_ESCAPING_LAMBDA bool in_order = true;
+    next_invocation.resize(thread_count);
+
+    Vector<NonnullRefPtr<Threading::Thread>> threads;
+    for (size_t i = 0; i < thread_count; ++i) {
+        auto thread = Threading::Thread::construct("Poster"sv, [&, i] {
+            for (size_t invocation = 0; invocation < invocations_per_thread; ++invocation) {
+                event_loop.deferred_invoke([&, i, invocation] {
+                    if (next_invocation[i]++ != invocation)
+                        in_order = false;
+                    if (++total_invocations == thread_count * invocations_per_thread)
+                        event_loop.quit(0);
+                });
+            }
+            return 0;
+        });
+        thread->start();
+        threads.append(move(thread));
+    }
+
+    event_loop.exec();
+
+    for (auto& thread : threads)
+        MUST(thread->join());
+
+    EXPECT(in_order);
+    EXPECT_EQ(total_invocations, thread_count * invocations_per_thread);
+}
@@ -8,6 +8,8 @@
 #include <AK/Time.h>
 #include <AK/Vector.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/Notifier.h>
+#include <LibCore/System.h>
 #include <LibCore/Timer.h>
 #include <LibTest/TestCase.h>
 #include <LibThreading/Thread.h>
@@ -125,3 +127,39 @@ TEST_CASE(stopped_timer_does_not_fire)
     loop.exec();
     EXPECT_EQ(stopped_count, 0);
 }
+
+TEST_CASE(notifiers_sharing_an_fd_are_activated_independently)
+{
+    Core::EventLoop loop;
+    auto fds = MUST(Core::System::pipe2(O_CLOEXEC));
+
+    int read_activations = 0;
+    int write_activations = 0;
+
+    auto read_notifier = Core::Notifier::construct(fds[0], Core::Notifier::Type::Read);
+    auto other_read_notifier = Core::Notifier::construct(fds[0], Core::Notifier::Type::Read);
+    read_notifier->on_activation = [&] { ++read_activations; };
+    other_read_notifier->on_activation = [&] { ++read_activations; };
+
+    auto write_notifier = Core::Notifier::construct(fds[1], Core::Notifier::Type::Write);
+    write_notifier->on_activation = [&] {
+        ++write_activations;
+        write_notifier->set_enabled(false);
+        MUST(Core::System::write(fds[1], "x"sv.bytes()));
+    };
+
+    loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+    EXPECT_EQ(write_activations, 1);
+
+    loop.pump(Core::EventLoop::WaitMode::WaitForEvents);
+    EXPECT_EQ(read_activations, 2);
+
+    // Unregistering one of the notifiers on an fd must leave the other one registered.
+    other_read_notifier->set_enabled(false);
+    loop.pump(Core::EventLoop::WaitMode::WaitForEvents);
+    EXPECT_EQ(read_activations, 3);
+
+    read_notifier->set_enabled(false);
+    MUST(Core::System::close(fds[0]));
+    MUST(Core::System::close(fds[1]));
+}
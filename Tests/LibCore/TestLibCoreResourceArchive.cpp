@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteBuffer.h>
+#include <AK/Endian.h>
+#include <LibCore/File.h>
+#include <LibCore/Resource.h>
+#include <LibCore/ResourceImplementationArchive.h>
+#include <LibCore/StandardPaths.h>
+#include <LibTest/TestCase.h>
+
+static void append_u32(ByteBuffer& buffer, u32 value)
+{
+    LittleEndian<u32> little_endian_value = value;
+    buffer.append(&little_endian_value, sizeof(little_endian_value));
+}
+
+// The same archive that Meta/Generators/generate_resource_archive.py writes for "a/b.txt" and "c.txt".
+static ByteBuffer make_archive()
+{
+    ByteBuffer archive;
+    archive.append("LRA1"sv.bytes());
+    append_u32(archive, 2);
+
+    append_u32(archive, 40);
+    append_u32(archive, 7);
+    append_u32(archive, 64);
+    append_u32(archive, 5);
+
+    append_u32(archive, 47);
+    append_u32(archive, 5);
+    append_u32(archive, 80);
+    append_u32(archive, 5);
+
+    archive.append("a/b.txtc.txt"sv.bytes());
+    archive.resize(64);
+    archive.append("hello"sv.bytes());
+    archive.resize(80);
+    archive.append("world"sv.bytes());
+    return archive;
+}
+
+static ByteString write_archive(StringView name, ReadonlyBytes contents)
+{
+    auto path = ByteString::formatted("{}/{}", Core::StandardPaths::tempfile_directory(), name);
+    auto file = MUST(Core::File::open(path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+    MUST(file->write_until_depleted(contents));
+    return path;
+}
+
+TEST_CASE(load_files_and_directories_from_archive)
+{
+    auto path = write_archive("resource-archive-test.archive"sv, make_archive());
+    auto implementation = TRY_OR_FAIL(Core::ResourceImplementationArchive::create("/nonexistent"_string, path));
+    Core::ResourceImplementation::install(move(implementation));
+
+    auto file = TRY_OR_FAIL(Core::Resource::load_from_uri("resource://a/b.txt"sv));
+    EXPECT(file->is_file());
+    EXPECT_EQ(StringView { file->data() }, "hello"sv);
+
+    auto other_file = TRY_OR_FAIL(Core::Resource::load_from_uri("resource://c.txt"sv));
+    EXPECT_EQ(StringView { other_file->data() }, "world"sv);
+
+    auto directory = TRY_OR_FAIL(Core::Resource::load_from_uri("resource://a"sv));
+    EXPECT(directory->is_directory());
+    EXPECT_EQ(directory->children(), Vector { "b.txt"_string });
+
+    auto root = TRY_OR_FAIL(Core::Resource::load_from_uri("resource://"sv));
+    EXPECT_EQ(root->children(), (Vector { "a"_string, "c.txt"_string }));
+
+    // Resources that are not in the archive are looked up in the base directory.
+    EXPECT(Core::Resource::load_from_uri("resource://missing.txt"sv).is_error());
+
+    Core::ResourceImplementation::install(nullptr);
+}
+
+TEST_CASE(reject_malformed_archives)
+{
+    auto bad_magic = write_archive("resource-archive-bad-magic.archive"sv, "LRA0\0\0\0\0"sv.bytes());
+    EXPECT(Core::ResourceImplementationArchive::create("/"_string, bad_magic).is_error());
+
+    auto archive = make_archive();
+    archive.resize(70);
+    auto truncated = write_archive("resource-archive-truncated.archive"sv, archive);
+    EXPECT(Core::ResourceImplementationArchive::create("/"_string, truncated).is_error());
+}
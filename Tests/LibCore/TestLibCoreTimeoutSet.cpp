@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Vector.h>
+#include <LibCore/TimeoutSet.h>
+#include <LibTest/TestCase.h>
+
+namespace {
+
+class TestTimeout final : public Core::EventLoopTimeout {
+public:
+    TestTimeout(Vector<int>& fired, int id, MonotonicTime fire_time)
+        : m_fired(fired)
+        , m_id(id)
+    {
+        m_fire_time = fire_time;
+    }
+
+    virtual void fire(Core::TimeoutSet&, MonotonicTime time) override
+    {
+        EXPECT(time >= fire_time());
+        m_fired.append(m_id);
+    }
+
+private:
+    Vector<int>& m_fired;
+    int m_id { 0 };
+};
+
+// Runs the timeout set the way an event loop does, jumping straight to each expiration.
+size_t run_until_empty(Core::TimeoutSet& timeout_set)
+{
+    size_t wakeup_count = 0;
+    for (auto next_expiration = timeout_set.next_timer_expiration(); next_expiration.has_value(); next_expiration = timeout_set.next_timer_expiration()) {
+        if (timeout_set.fire_expired(*next_expiration) > 0)
+            ++wakeup_count;
+    }
+    return wakeup_count;
+}
+
+}
+
+TEST_CASE(timeouts_fire_in_order)
+{
+    auto now = MonotonicTime::now_coarse();
+    Vector<int> fired;
+
+    // Cover every level of the wheel, including timeouts that share a fire time.
+    Vector<i64> offsets_ms { 5'000, 1, 70, 3, 300'000, 70, 10'000'000, 0, 4'100, 2'000'000'000 };
+
+    Vector<OwnPtr<TestTimeout>> timeouts;
+    Core::TimeoutSet timeout_set;
+    for (size_t i = 0; i < offsets_ms.size(); ++i) {
+        timeouts.append(make<TestTimeout>(fired, static_cast<int>(i), now + AK::Duration::from_milliseconds(offsets_ms[i])));
+        timeout_set.schedule_absolute(timeouts.last().ptr());
+    }
+
+    EXPECT_EQ(run_until_empty(timeout_set), 9u);
+    EXPECT_EQ(fired, (Vector<int> { 7, 1, 3, 2, 5, 8, 0, 4, 6, 9 }));
+
+    for (auto& timeout : timeouts)
+        EXPECT(!timeout->is_scheduled());
+}
+
+TEST_CASE(timeouts_do_not_fire_early)
+{
+    auto now = MonotonicTime::now_coarse();
+    Vector<int> fired;
+
+    Core::TimeoutSet timeout_set;
+    TestTimeout timeout { fired, 1, now + AK::Duration::from_milliseconds(100'000) };
+    timeout_set.schedule_absolute(&timeout);
+
+    // Expirations before the fire time only redistribute the timeout between the levels of the wheel.
+    for (auto next_expiration = timeout_set.next_timer_expiration(); next_expiration.has_value() && *next_expiration < timeout.fire_time(); next_expiration = timeout_set.next_timer_expiration())
+        EXPECT_EQ(timeout_set.fire_expired(*next_expiration), 0u);
+
+    EXPECT(timeout_set.next_timer_expiration() == timeout.fire_time());
+    EXPECT_EQ(timeout_set.fire_expired(timeout.fire_time()), 1u);
+    EXPECT_EQ(fired, Vector<int> { 1 });
+}
+
+TEST_CASE(unscheduled_timeouts_do_not_fire)
+{
+    auto now = MonotonicTime::now_coarse();
+    Vector<int> fired;
+
+    Core::TimeoutSet timeout_set;
+    TestTimeout near_timeout { fired, 1, now + AK::Duration::from_milliseconds(10) };
+    TestTimeout far_timeout { fired, 2, now + AK::Duration::from_milliseconds(100'000) };
+    TestTimeout other_timeout { fired, 3, now + AK::Duration::from_milliseconds(20) };
+    timeout_set.schedule_absolute(&near_timeout);
+    timeout_set.schedule_absolute(&far_timeout);
+    timeout_set.schedule_absolute(&other_timeout);
+
+    timeout_set.unschedule(&near_timeout);
+    timeout_set.unschedule(&far_timeout);
+    EXPECT(!near_timeout.is_scheduled());
+    EXPECT(!far_timeout.is_scheduled());
+
+    EXPECT(timeout_set.next_timer_expiration() == other_timeout.fire_time());
+    run_until_empty(timeout_set);
+    EXPECT_EQ(fired, Vector<int> { 3 });
+}
+
+TEST_CASE(timeouts_with_a_tolerance_are_coalesced)
+{
+    auto now = MonotonicTime::now_coarse();
+    Vector<int> fired;
+
+    Vector<OwnPtr<TestTimeout>> timeouts;
+    Core::TimeoutSet timeout_set;
+    for (int i = 0; i < 10; ++i) {
+        // Starting right after a whole second, these all fall within the same second.
+        auto offset_ns = 1'000'000'000 - (now.nanoseconds() % 1'000'000'000) + 1'000'000 + i * 50'000'000;
+        timeouts.append(make<TestTimeout>(fired, i, now + AK::Duration::from_nanoseconds(offset_ns)));
+        timeouts.last()->set_tolerance(AK::Duration::from_seconds(1));
+        timeout_set.schedule_absolute(timeouts.last().ptr());
+    }
+
+    EXPECT_EQ(run_until_empty(timeout_set), 1u);
+    EXPECT_EQ(fired, (Vector<int> { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }));
+}
+
+TEST_CASE(many_timeouts)
+{
+    auto now = MonotonicTime::now_coarse();
+    Vector<int> fired;
+
+    static constexpr int timeout_count = 10'000;
+    Vector<OwnPtr<TestTimeout>> timeouts;
+    Core::TimeoutSet timeout_set;
+    for (int i = 0; i < timeout_count; ++i) {
+        timeouts.append(make<TestTimeout>(fired, i, now + AK::Duration::from_milliseconds((i * 7919) % 60'000)));
+        timeout_set.schedule_absolute(timeouts.last().ptr());
+    }
+
+    // Cancel every other timeout.
+    for (int i = 0; i < timeout_count; i += 2)
+        timeout_set.unschedule(timeouts[i].ptr());
+
+    run_until_empty(timeout_set);
+    EXPECT_EQ(fired.size(), static_cast<size_t>(timeout_count / 2));
+
+    for (size_t i = 1; i < fired.size(); ++i) {
+        EXPECT(fired[i] % 2 == 1);
+        EXPECT(timeouts[fired[i - 1]]->fire_time() <= timeouts[fired[i]]->fire_time());
+    }
+}
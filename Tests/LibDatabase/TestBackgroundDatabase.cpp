@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Random.h>
+#include <AK/ScopeGuard.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/StandardPaths.h>
+#include <LibDatabase/BackgroundDatabase.h>
+#include <LibDatabase/Database.h>
+#include <LibFileSystem/FileSystem.h>
+#include <LibTest/TestCase.h>
+
+struct Statements {
+    Database::StatementID insert_value { 0 };
+    Database::StatementID count_values { 0 };
+};
+
+static ErrorOr<void> create_numbers_table(Database::Database& database)
+{
+    return database.execute_raw("CREATE TABLE IF NOT EXISTS Numbers (value INTEGER NOT NULL);"sv);
+}
+
+static Database::BackgroundDatabase::PrepareConnection prepare_statements(Statements& statements)
+{
+    return [&](Database::Database& database) -> ErrorOr<void> {
+        statements.insert_value = TRY(database.prepare_statement("INSERT INTO Numbers (value) VALUES (?);"sv));
+        statements.count_values = TRY(database.prepare_statement("SELECT COUNT(*) FROM Numbers;"sv));
+        return {};
+    };
+}
+
+static void run_background_database_tests(NonnullRefPtr<Database::Database> database, size_t expected_read_connection_count)
+{
+    Core::EventLoop event_loop;
+
+    TRY_OR_FAIL(create_numbers_table(*database));
+
+    Statements statements;
+    auto background_database = TRY_OR_FAIL(Database::BackgroundDatabase::create(move(database), prepare_statements(statements)));
+    EXPECT_EQ(background_database->read_connection_count(), expected_read_connection_count);
+
+    for (i32 i = 0; i < 10; ++i) {
+        background_database->write([&, i](Database::Database& connection) {
+            connection.execute_statement(statements.insert_value, {}, i);
+        });
+    }
+
+    bool writes_completed = false;
+    background_database->write([](Database::Database&) {}, [&] { writes_completed = true; });
+    event_loop.spin_until([&] { return writes_completed; });
+
+    Optional<u32> count;
+    background_database->read(
+        [&](Database::Database& connection) {
+            u32 row_count = 0;
+            connection.execute_statement(statements.count_values, [&](auto statement_id) {
+                row_count = connection.result_column<u32>(statement_id, 0);
+            });
+            return row_count;
+        },
+        [&](u32 result) { count = result; });
+    event_loop.spin_until([&] { return count.has_value(); });
+
+    EXPECT_EQ(count, 10u);
+}
+
+TEST_CASE(memory_backed_database_reads_and_writes_on_one_connection)
+{
+    run_background_database_tests(TRY_OR_FAIL(Database::Database::create_memory_backed()), 0);
+}
+
+TEST_CASE(file_backed_database_reads_from_pooled_connections)
+{
+    auto database_directory = ByteString::formatted(
+        "{}/ladybird-background-database-test-{}",
+        Core::StandardPaths::tempfile_directory(),
+        generate_random_uuid());
+
+    auto cleanup = ScopeGuard([&] {
+        MUST(FileSystem::remove(database_directory, FileSystem::RecursionMode::Allowed));
+    });
+
+    run_background_database_tests(TRY_OR_FAIL(Database::Database::create(database_directory, "BackgroundDatabase"sv)), Database::BackgroundDatabase::DEFAULT_READ_CONNECTION_COUNT);
+}
+
+TEST_CASE(read_only_connections_reject_writes)
+{
+    auto database_directory = ByteString::formatted(
+        "{}/ladybird-read-only-connection-test-{}",
+        Core::StandardPaths::tempfile_directory(),
+        generate_random_uuid());
+
+    auto cleanup = ScopeGuard([&] {
+        MUST(FileSystem::remove(database_directory, FileSystem::RecursionMode::Allowed));
+    });
+
+    auto database = TRY_OR_FAIL(Database::Database::create(database_directory, "ReadOnly"sv));
+    TRY_OR_FAIL(create_numbers_table(*database));
+    database->execute_statement(TRY_OR_FAIL(database->prepare_statement("INSERT INTO Numbers (value) VALUES (1);"sv)), {});
+
+    auto read_only_connection = TRY_OR_FAIL(database->create_read_only_connection());
+
+    u32 count = 0;
+    auto count_values = TRY_OR_FAIL(read_only_connection->prepare_statement("SELECT COUNT(*) FROM Numbers;"sv));
+    read_only_connection->execute_statement(count_values, [&](auto statement_id) {
+        count = read_only_connection->result_column<u32>(statement_id, 0);
+    });
+    EXPECT_EQ(count, 1u);
+
+    auto insert_value = TRY_OR_FAIL(read_only_connection->prepare_statement("INSERT INTO Numbers (value) VALUES (2);"sv));
+    EXPECT(read_only_connection->try_execute_statement(insert_value, {}).is_error());
+
+    EXPECT(TRY_OR_FAIL(Database::Database::create_memory_backed())->create_read_only_connection().is_error());
+}
@@ -111,3 +111,22 @@ TEST_CASE(busy_timeout_can_be_configured)
     });
     EXPECT_EQ(busy_timeout, 250);
 }
+
+TEST_CASE(statement_executions_are_counted_and_timed)
+{
+    auto database = TRY_OR_FAIL(Database::Database::create_memory_backed());
+    auto statement = TRY_OR_FAIL(database->prepare_statement("SELECT ?;"sv));
+    auto unused_statement = TRY_OR_FAIL(database->prepare_statement("SELECT 1;"sv));
+
+    for (i32 i = 0; i < 3; ++i)
+        database->execute_statement(statement, {}, i);
+    (void)database->execute_interruptible_statement(statement, {}, 3);
+    TRY_OR_FAIL(database->try_execute_statement(statement, {}, 4));
+
+    auto const& statistics = database->statement_statistics(statement);
+    EXPECT_EQ(statistics.execution_count, 5u);
+    EXPECT(statistics.longest_execution_time <= statistics.total_execution_time);
+    EXPECT_EQ(database->statement_sql(statement), "SELECT ?;"sv);
+
+    EXPECT_EQ(database->statement_statistics(unused_statement).execution_count, 0u);
+}
@@ -3659,6 +3659,21 @@ TEST_CASE(inspector_walker_highlighter_layout_and_editing)
     auto span_actor = query_selector(client, walker_actor, root_node_actor, "span"sv);
     auto flex_actor = query_selector(client, walker_actor, root_node_actor, "aside"sv);
     auto first_flex_item_actor = query_selector(client, walker_actor, root_node_actor, "p"sv);
+
+    JsonObject paged_children;
+    paged_children.set("to"sv, walker_actor);
+    paged_children.set("type"sv, "children"sv);
+    paged_children.set("node"sv, query_selector(client, walker_actor, root_node_actor, "body"sv));
+    paged_children.set("maxNodes"sv, 2);
+    paged_children.set("center"sv, flex_actor);
+    auto paged_children_response = client.request(move(paged_children));
+    EXPECT(!paged_children_response.get_bool("hasFirst"sv).value());
+    EXPECT(paged_children_response.get_bool("hasLast"sv).value());
+    auto paged_nodes = paged_children_response.get_array("nodes"sv).release_value();
+    VERIFY(paged_nodes.size() == 2u);
+    EXPECT_EQ(paged_nodes.at(0).as_object().get_string("actor"sv).value(), div_actor);
+    EXPECT_EQ(paged_nodes.at(1).as_object().get_string("actor"sv).value(), flex_actor);
+
     JsonObject previous_sibling;
     previous_sibling.set("to"sv, walker_actor);
     previous_sibling.set("type"sv, "previousSibling"sv);
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2023, Lucas Chollet <lucas.chollet@serenityos.org>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/File.h>
+#include <LibGfx/CMYKBitmap.h>
+#include <LibGfx/ImageFormats/GIFLoader.h>
+#include <LibGfx/ImageFormats/JPEGLoader.h>
+#include <LibGfx/ImageFormats/PNGLoader.h>
+#include <LibGfx/ImageFormats/WebPLoader.h>
+#include <LibTest/TestCase.h>
+
+#define TEST_INPUT(x) ("test-inputs/" x)
+
+auto small_image = Core::File::open(TEST_INPUT("jpg/rgb24.jpg"sv), Core::File::OpenMode::Read).release_value()->read_until_eof().release_value();
+auto big_image = Core::File::open(TEST_INPUT("jpg/big_image.jpg"sv), Core::File::OpenMode::Read).release_value()->read_until_eof().release_value();
+auto rgb_image = Core::File::open(TEST_INPUT("jpg/rgb_components.jpg"sv), Core::File::OpenMode::Read).release_value()->read_until_eof().release_value();
+auto several_scans = Core::File::open(TEST_INPUT("jpg/several_scans.jpg"sv), Core::File::OpenMode::Read).release_value()->read_until_eof().release_value();
+auto cmyk_image = Core::File::open(TEST_INPUT("jpg/buggie-cmyk.jpg"sv), Core::File::OpenMode::Read).release_value()->read_until_eof().release_value();
+auto ycck_image = Core::File::open(TEST_INPUT("jpg/ycck-2111.jpg"sv), Core::File::OpenMode::Read).release_value()->read_until_eof().release_value();
+auto png_image = Core::File::open(TEST_INPUT("png/buggie.png"sv), Core::File::OpenMode::Read).release_value()->read_until_eof().release_value();
+auto webp_lossy_image = Core::File::open(TEST_INPUT("webp/4.webp"sv), Core::File::OpenMode::Read).release_value()->read_until_eof().release_value();
+auto webp_alpha_image = Core::File::open(TEST_INPUT("webp/extended-lossy-uncompressed-alpha.webp"sv), Core::File::OpenMode::Read).release_value()->read_until_eof().release_value();
+auto gif_image = Core::File::open(TEST_INPUT("gif/download-animation.gif"sv), Core::File::OpenMode::Read).release_value()->read_until_eof().release_value();
+
+BENCHMARK_CASE(small_image)
+{
+    auto plugin_decoder = MUST(Gfx::JPEGImageDecoderPlugin::create(small_image));
+    MUST(plugin_decoder->frame(0));
+}
+
+BENCHMARK_CASE(big_image)
+{
+    auto plugin_decoder = MUST(Gfx::JPEGImageDecoderPlugin::create(big_image));
+    MUST(plugin_decoder->frame(0));
+}
+
+BENCHMARK_CASE(rgb_image)
+{
+    auto plugin_decoder = MUST(Gfx::JPEGImageDecoderPlugin::create(rgb_image));
+    MUST(plugin_decoder->frame(0));
+}
+
+BENCHMARK_CASE(several_scans)
+{
+    auto plugin_decoder = MUST(Gfx::JPEGImageDecoderPlugin::create(several_scans));
+    MUST(plugin_decoder->frame(0));
+}
+
+BENCHMARK_CASE(cmyk_image)
+{
+    auto plugin_decoder = MUST(Gfx::JPEGImageDecoderPlugin::create(cmyk_image));
+    MUST(plugin_decoder->frame(0));
+}
+
+BENCHMARK_CASE(ycck_image)
+{
+    auto plugin_decoder = MUST(Gfx::JPEGImageDecoderPlugin::create(ycck_image));
+    MUST(plugin_decoder->frame(0));
+}
+
+BENCHMARK_CASE(cmyk_to_rgb)
+{
+    auto cmyk_bitmap = MUST(Gfx::CMYKBitmap::create_with_size({ 2048, 2048 }));
+    for (size_t i = 0; i < cmyk_bitmap->data_size(); ++i)
+        reinterpret_cast<u8*>(cmyk_bitmap->begin())[i] = i * 31;
+    cmyk_bitmap->convert_from_ycck();
+    cmyk_bitmap->invert();
+    MUST(cmyk_bitmap->to_low_quality_rgb());
+}
+
+BENCHMARK_CASE(png_image)
+{
+    auto plugin_decoder = MUST(Gfx::PNGImageDecoderPlugin::create(png_image));
+    MUST(plugin_decoder->frame(0));
+}
+
+BENCHMARK_CASE(webp_lossy_image)
+{
+    auto plugin_decoder = MUST(Gfx::WebPImageDecoderPlugin::create(webp_lossy_image));
+    MUST(plugin_decoder->frame(0));
+}
+
+BENCHMARK_CASE(webp_alpha_image)
+{
+    auto plugin_decoder = MUST(Gfx::WebPImageDecoderPlugin::create(webp_alpha_image));
+    MUST(plugin_decoder->frame(0));
+}
+
+BENCHMARK_CASE(gif_image)
+{
+    auto plugin_decoder = MUST(Gfx::GIFImageDecoderPlugin::create(gif_image));
+    for (size_t i = 0; i < plugin_decoder->frame_count(); ++i)
+        MUST(plugin_decoder->frame(i));
+}
+
+BENCHMARK_CASE(premultiply_and_unpremultiply)
+{
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Unpremultiplied, { 2048, 2048 }));
+    for (int y = 0; y < bitmap->height(); ++y) {
+        for (int x = 0; x < bitmap->width(); ++x)
+            bitmap->set_pixel(x, y, Gfx::Color(x, y, x + y, x ^ y));
+    }
+    bitmap->set_alpha_type_destructive(Gfx::AlphaType::Premultiplied);
+    bitmap->set_alpha_type_destructive(Gfx::AlphaType::Unpremultiplied);
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/YUVData.h>
+#include <LibTest/TestCase.h>
+
+static constexpr Gfx::IntSize frame_size { 1920, 1080 };
+
+static Media::CodingIndependentCodePoints const bt709_limited {
+    Media::ColorPrimaries::BT709,
+    Media::TransferCharacteristics::BT709,
+    Media::MatrixCoefficients::BT709,
+    Media::VideoFullRangeFlag::Studio,
+};
+
+static void fill_plane(Bytes plane, u8 bit_depth)
+{
+    if (bit_depth <= 8) {
+        for (size_t i = 0; i < plane.size(); i++)
+            plane[i] = static_cast<u8>(16 + (i * 7) % 220);
+        return;
+    }
+    auto* samples = reinterpret_cast<u16*>(plane.data());
+    auto max_sample = (1u << bit_depth) - 1;
+    for (size_t i = 0; i < plane.size() / 2; i++)
+        samples[i] = static_cast<u16>((i * 13) % max_sample);
+}
+
+static NonnullOwnPtr<Gfx::YUVData> create_frame(u8 bit_depth, Media::Subsampling subsampling)
+{
+    auto yuv_data = MUST(Gfx::YUVData::create(frame_size, bit_depth, subsampling, bt709_limited));
+    fill_plane(yuv_data->y_data(), bit_depth);
+    fill_plane(yuv_data->u_data(), bit_depth);
+    fill_plane(yuv_data->v_data(), bit_depth);
+    return yuv_data;
+}
+
+static void convert_frames(u8 bit_depth, Media::Subsampling subsampling)
+{
+    auto yuv_data = create_frame(bit_depth, subsampling);
+    for (size_t i = 0; i < 10; i++)
+        MUST(yuv_data->to_bitmap());
+}
+
+static void convert_frames_into_reused_bitmap(u8 bit_depth, Media::Subsampling subsampling)
+{
+    auto yuv_data = create_frame(bit_depth, subsampling);
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::RGBA8888, Gfx::AlphaType::Premultiplied, frame_size));
+    for (size_t i = 0; i < 10; i++)
+        MUST(yuv_data->convert_to_bitmap(*bitmap));
+}
+
+BENCHMARK_CASE(yuv420_8_bit)
+{
+    convert_frames(8, { true, true });
+}
+
+BENCHMARK_CASE(yuv422_8_bit)
+{
+    convert_frames(8, { true, false });
+}
+
+BENCHMARK_CASE(yuv444_8_bit)
+{
+    convert_frames(8, { false, false });
+}
+
+BENCHMARK_CASE(yuv420_10_bit)
+{
+    convert_frames(10, { true, true });
+}
+
+BENCHMARK_CASE(yuv444_12_bit)
+{
+    convert_frames(12, { false, false });
+}
+
+BENCHMARK_CASE(yuv420_8_bit_into_reused_bitmap)
+{
+    convert_frames_into_reused_bitmap(8, { true, true });
+}
+
+BENCHMARK_CASE(yuv444_12_bit_into_reused_bitmap)
+{
+    convert_frames_into_reused_bitmap(12, { false, false });
+}
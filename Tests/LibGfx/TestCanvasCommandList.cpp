@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGfx/CanvasCommandList.h>
+#include <LibTest/TestCase.h>
+
+static Gfx::Path rect_path(Gfx::FloatRect const& rect)
+{
+    Gfx::Path path;
+    path.move_to(rect.top_left());
+    path.line_to(rect.top_right());
+    path.line_to(rect.bottom_right());
+    path.line_to(rect.bottom_left());
+    path.close();
+    return path;
+}
+
+TEST_CASE(consecutive_set_transforms_collapse)
+{
+    Gfx::CanvasCommandList list;
+    list.append(Gfx::CanvasCommands::SetTransform { .transform = Gfx::AffineTransform {}.translate(1, 2) });
+    list.append(Gfx::CanvasCommands::SetTransform { .transform = Gfx::AffineTransform {}.translate(3, 4) });
+
+    EXPECT_EQ(list.size(), 1u);
+    EXPECT_EQ(list.commands()[0].get<Gfx::CanvasCommands::SetTransform>().transform.translation(), Gfx::FloatPoint(3, 4));
+}
+
+TEST_CASE(empty_save_restore_pair_is_dropped)
+{
+    Gfx::CanvasCommandList list;
+    list.append(Gfx::CanvasCommands::Save {});
+    list.append(Gfx::CanvasCommands::Save {});
+    list.append(Gfx::CanvasCommands::Restore {});
+
+    EXPECT_EQ(list.size(), 1u);
+    EXPECT(list.commands()[0].has<Gfx::CanvasCommands::Save>());
+}
+
+TEST_CASE(clear_rect_culls_covered_draws)
+{
+    Gfx::CanvasCommandList list;
+    list.append(Gfx::CanvasCommands::FillPath { .path = rect_path({ 10, 10, 20, 20 }), .style = Gfx::Color::Red });
+    list.append(Gfx::CanvasCommands::ClearRect { .rect = { 20, 20, 10, 10 }, .color = Gfx::Color::Transparent });
+    list.append(Gfx::CanvasCommands::ClearRect { .rect = { 0, 0, 100, 100 }, .color = Gfx::Color::Transparent });
+
+    EXPECT_EQ(list.size(), 1u);
+    EXPECT_EQ(list.commands()[0].get<Gfx::CanvasCommands::ClearRect>().rect, Gfx::FloatRect(0, 0, 100, 100));
+}
+
+TEST_CASE(clear_rect_keeps_draws_it_does_not_cover)
+{
+    Gfx::CanvasCommandList list;
+    list.append(Gfx::CanvasCommands::FillPath { .path = rect_path({ 0, 0, 100, 100 }), .style = Gfx::Color::Red });
+    list.append(Gfx::CanvasCommands::FillPath { .path = rect_path({ 10, 10, 20, 20 }), .style = Gfx::Color::Red, .blur_radius = 4 });
+    list.append(Gfx::CanvasCommands::ClearRect { .rect = { 0, 0, 50, 50 }, .color = Gfx::Color::Transparent });
+
+    EXPECT_EQ(list.size(), 3u);
+}
+
+TEST_CASE(clear_rect_does_not_cull_across_state_changes)
+{
+    Gfx::CanvasCommandList list;
+    list.append(Gfx::CanvasCommands::FillPath { .path = rect_path({ 10, 10, 20, 20 }), .style = Gfx::Color::Red });
+    list.append(Gfx::CanvasCommands::SetTransform { .transform = Gfx::AffineTransform {}.translate(100, 0) });
+    list.append(Gfx::CanvasCommands::ClearRect { .rect = { 0, 0, 100, 100 }, .color = Gfx::Color::Transparent });
+
+    EXPECT_EQ(list.size(), 3u);
+}
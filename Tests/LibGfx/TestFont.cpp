@@ -4,9 +4,15 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/LexicalPath.h>
 #include <LibCore/MappedFile.h>
+#include <LibCore/StandardPaths.h>
+#include <LibCore/System.h>
+#include <LibFileSystem/FileSystem.h>
+#include <LibGfx/Font/DecodedFontCache.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/FontDatabase.h>
+#include <LibGfx/Font/FontIndex.h>
 #include <LibGfx/Font/PathFontProvider.h>
 #include <LibGfx/Font/Typeface.h>
 #include <LibTest/TestCase.h>
@@ -51,3 +57,63 @@ TEST_CASE(text_font_is_not_emoji_font)
 {
     EXPECT(!font_is_emoji(TEST_INPUT("fonts/text.ttf"sv)));
 }
+
+// A saved font index is read back with the same entries, and entries for files that changed are not found.
+TEST_CASE(font_index_round_trip)
+{
+    auto path = LexicalPath::join(Core::StandardPaths::tempfile_directory(), ByteString::formatted("test-font-index-{}", Core::System::getpid())).string();
+
+    Gfx::FontIndex index;
+    index.set("/fonts/Family.ttc"_string, { .modified_time = 1234, .size = 5678, .faces = { { 0, "Family"_fly_string, 400, 5, 0 }, { 1, "Family"_fly_string, 700, 5, 1 } } });
+    index.set("/fonts/broken.ttf"_string, { .modified_time = 1, .size = 2, .faces = {} });
+    EXPECT(index.has_unsaved_changes());
+    TRY_OR_FAIL(index.save_to_file(path));
+
+    auto loaded_index = TRY_OR_FAIL(Gfx::FontIndex::load_from_file(path));
+    (void)FileSystem::remove(path, FileSystem::RecursionMode::Disallowed);
+
+    auto const* file = loaded_index.find("/fonts/Family.ttc"_string, 1234, 5678);
+    VERIFY(file);
+    EXPECT_EQ(file->faces.size(), 2u);
+    EXPECT_EQ(file->faces[1].ttc_index, 1u);
+    EXPECT_EQ(file->faces[1].family, "Family"_fly_string);
+    EXPECT_EQ(file->faces[1].weight, 700);
+    EXPECT_EQ(file->faces[1].width, 5);
+    EXPECT_EQ(file->faces[1].slope, 1);
+
+    auto const* broken_file = loaded_index.find("/fonts/broken.ttf"_string, 1, 2);
+    VERIFY(broken_file);
+    EXPECT(broken_file->faces.is_empty());
+
+    EXPECT(!loaded_index.find("/fonts/Family.ttc"_string, 1235, 5678));
+    EXPECT(!loaded_index.find("/fonts/Family.ttc"_string, 1234, 5679));
+    EXPECT(!loaded_index.find("/fonts/Other.ttf"_string, 1234, 5678));
+}
+
+// Decoding the same compressed font again finds the stored decoded data instead of running the decoder.
+TEST_CASE(decoded_font_cache_shares_decoded_data)
+{
+    auto directory = LexicalPath::join(Core::StandardPaths::tempfile_directory(), ByteString::formatted("test-decoded-fonts-{}", Core::System::getpid())).string();
+    Gfx::DecodedFontCache::initialize(directory);
+
+    size_t decode_count = 0;
+    auto decode = [&](ReadonlyBytes compressed_data) -> ErrorOr<Core::AnonymousBuffer> {
+        ++decode_count;
+        auto buffer = TRY(Core::AnonymousBuffer::create_with_size(compressed_data.size() * 2));
+        for (size_t i = 0; i < buffer.size(); ++i)
+            buffer.data<u8>()[i] = compressed_data[i % compressed_data.size()];
+        return buffer;
+    };
+
+    auto compressed_data = "compressed font"sv.bytes();
+    auto first = TRY_OR_FAIL(Gfx::DecodedFontCache::find_or_decode(compressed_data, decode));
+    auto second = TRY_OR_FAIL(Gfx::DecodedFontCache::find_or_decode(compressed_data, decode));
+    (void)FileSystem::remove(directory, FileSystem::RecursionMode::Allowed);
+
+    EXPECT_EQ(decode_count, 1u);
+    EXPECT(first.has<NonnullRefPtr<Core::Resource const>>());
+    VERIFY(second.has<NonnullRefPtr<Core::Resource const>>());
+    auto decoded_data = second.get<NonnullRefPtr<Core::Resource const>>()->data();
+    EXPECT_EQ(decoded_data.size(), compressed_data.size() * 2);
+    EXPECT(decoded_data.slice(compressed_data.size()) == compressed_data);
+}
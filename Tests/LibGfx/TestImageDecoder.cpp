@@ -389,6 +389,26 @@ TEST_CASE(test_jpeg_sof0_several_scans)
     TRY_OR_FAIL(expect_single_frame_of_size(*plugin_decoder, { 592, 800 }));
 }
 
+TEST_CASE(test_jpeg_scaled_to_ideal_size)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/several_scans.jpg"sv)));
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::JPEGImageDecoderPlugin::create(file->bytes()));
+
+    // The natural size is reported without decoding, and stays the same however the frame is scaled.
+    EXPECT_EQ(plugin_decoder->size(), Gfx::IntSize(592, 800));
+
+    auto frame = TRY_OR_FAIL(plugin_decoder->frame(0, Gfx::IntSize { 148, 200 }));
+    EXPECT_EQ(frame.image->size(), Gfx::IntSize(148, 200));
+
+    // A scale of 1/4 would be too small here, so the decoder has to settle for 1/2.
+    frame = TRY_OR_FAIL(plugin_decoder->frame(0, Gfx::IntSize { 149, 200 }));
+    EXPECT_EQ(frame.image->size(), Gfx::IntSize(296, 400));
+
+    frame = TRY_OR_FAIL(plugin_decoder->frame(0));
+    EXPECT_EQ(frame.image->size(), Gfx::IntSize(592, 800));
+    EXPECT_EQ(plugin_decoder->size(), Gfx::IntSize(592, 800));
+}
+
 TEST_CASE(test_odd_mcu_restart_interval)
 {
     auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/odd-restart.jpg"sv)));
@@ -491,6 +511,16 @@ TEST_CASE(test_jpeg_sof2_successive_approximation)
     TRY_OR_FAIL(expect_single_frame_of_size(*plugin_decoder, { 600, 800 }));
 }
 
+TEST_CASE(test_jpeg_sof2_truncated)
+{
+    // Cut the image off partway through its sixth scan, as if it were still being downloaded.
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/successive_approximation.jpg"sv)));
+    auto truncated_bytes = file->bytes().trim(8000);
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::JPEGImageDecoderPlugin::create(truncated_bytes));
+
+    TRY_OR_FAIL(expect_single_frame_of_size(*plugin_decoder, { 600, 800 }));
+}
+
 TEST_CASE(test_jpeg_empty_icc)
 {
     auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/gradient_empty_icc.jpg"sv)));
@@ -650,6 +680,17 @@ TEST_CASE(test_png_corrupt_idat_does_not_leak_on_libpng_longjmp)
         (void)plugin_or_error.release_value()->frame(0);
 }
 
+TEST_CASE(test_png_truncated)
+{
+    // Cut the image off after its first 8 KiB of image data, as if it were still being downloaded.
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("png/buggie.png"sv)));
+    auto truncated_bytes = file->bytes().trim(8300);
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::PNGImageDecoderPlugin::create(truncated_bytes));
+
+    auto frame = TRY_OR_FAIL(expect_single_frame_of_size(*plugin_decoder, { 64, 138 }));
+    EXPECT_EQ(frame.image->get_pixel(10, 8), Gfx::Color(0, 0, 0));
+}
+
 TEST_CASE(test_png_large_dimensions)
 {
     auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("png/65535x1.png"sv)));
@@ -83,3 +83,30 @@ TEST_CASE(high_bit_depth_pixmaps_expand_without_mutating_native_samples)
             EXPECT_EQ(bitmap_after->get_pixel(x, y), bitmap_before->get_pixel(x, y));
     }
 }
+
+TEST_CASE(shared_buffer_is_adopted_without_copying)
+{
+    auto const cicp = Media::CodingIndependentCodePoints {
+        Media::ColorPrimaries::BT709,
+        Media::TransferCharacteristics::BT709,
+        Media::MatrixCoefficients::BT709,
+        Media::VideoFullRangeFlag::Studio,
+    };
+    auto subsampling = Media::Subsampling { true, true };
+    auto yuv_data = TRY_OR_FAIL(Gfx::YUVData::create({ 4, 2 }, 8, subsampling, cicp));
+
+    auto const& buffer = yuv_data->shared_buffer();
+    EXPECT(buffer.is_valid());
+    EXPECT_EQ(buffer.size(), 8u + 2u + 2u);
+    EXPECT_EQ(yuv_data->y_data().data(), buffer.data<u8>());
+    EXPECT_EQ(yuv_data->u_data().data(), buffer.data<u8>() + 8);
+    EXPECT_EQ(yuv_data->v_data().data(), buffer.data<u8>() + 10);
+
+    yuv_data->u_data()[1] = 42;
+
+    auto adopted = TRY_OR_FAIL(Gfx::YUVData::create_from_shared_buffer({ 4, 2 }, 8, subsampling, cicp, buffer));
+    EXPECT_EQ(adopted->y_data().data(), yuv_data->y_data().data());
+    EXPECT_EQ(adopted->u_data()[1], 42);
+
+    EXPECT(Gfx::YUVData::create_from_shared_buffer({ 4, 4 }, 8, subsampling, cicp, buffer).is_error());
+}
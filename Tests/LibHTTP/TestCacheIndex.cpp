@@ -7,6 +7,7 @@
 #include <AK/LexicalPath.h>
 #include <LibCore/Directory.h>
 #include <LibCore/StandardPaths.h>
+#include <LibCore/System.h>
 #include <LibDatabase/Database.h>
 #include <LibHTTP/Cache/CacheIndex.h>
 #include <LibHTTP/Cache/Utilities.h>
@@ -140,6 +141,37 @@ TEST_CASE(associated_data_counts_toward_cache_size)
     EXPECT(state.index.estimate_cache_size_accessed_since(UnixDateTime::earliest()).total <= 80u);
 }
 
+TEST_CASE(deferred_last_access_times_are_visible_to_cache_queries)
+{
+    auto state = create_cache_index();
+
+    auto request_headers = HTTP::HeaderList::create();
+    auto response_headers = HTTP::HeaderList::create();
+    auto vary_key = HTTP::create_vary_key(*request_headers, *response_headers);
+    auto now = UnixDateTime::now();
+
+    for (u64 cache_key = 1; cache_key <= 3; ++cache_key)
+        TRY_OR_FAIL(state.index.create_entry(cache_key, vary_key, "https://example.com"_string, request_headers, response_headers, 10, now, now));
+
+    MUST(Core::System::sleep_ms(5));
+    auto accessed_after_creation = UnixDateTime::now();
+    MUST(Core::System::sleep_ms(5));
+
+    state.index.update_last_access_time(2, vary_key);
+    state.index.update_last_access_time(2, vary_key);
+    EXPECT_EQ(state.index.estimate_cache_size_accessed_since(accessed_after_creation).since_requested_time, 10u);
+
+    state.index.update_last_access_time(3, vary_key);
+
+    // Access times that were not yet written back must survive the index going away.
+    {
+        auto index = move(state.index);
+    }
+
+    auto reloaded_index = MUST(HTTP::CacheIndex::create(*state.database, cache_directory()));
+    EXPECT_EQ(reloaded_index.estimate_cache_size_accessed_since(accessed_after_creation).since_requested_time, 20u);
+}
+
 TEST_CASE(newer_cache_index_schema_reports_database_too_new)
 {
     auto database = TRY_OR_FAIL(Database::Database::create_memory_backed());
@@ -43,3 +43,24 @@ TEST_CASE(is_cacheable_must_understand_accepts_304_status)
     auto headers = HTTP::HeaderList::create({ { "Cache-Control", "must-understand, no-store, max-age=3600" } });
     EXPECT(HTTP::is_cacheable(304, *headers));
 }
+
+TEST_CASE(stale_if_error_extends_freshness_lifetime)
+{
+    auto headers = HTTP::HeaderList::create({ { "Cache-Control", "max-age=60, stale-if-error=300" } });
+    EXPECT_EQ(HTTP::calculate_stale_if_error_lifetime(*headers, AK::Duration::from_seconds(60)), AK::Duration::from_seconds(360));
+}
+
+TEST_CASE(stale_if_error_is_ignored_without_directive)
+{
+    auto headers = HTTP::HeaderList::create({ { "Cache-Control", "max-age=60, stale-while-revalidate=300" } });
+    EXPECT_EQ(HTTP::calculate_stale_if_error_lifetime(*headers, AK::Duration::from_seconds(60)), AK::Duration::zero());
+}
+
+TEST_CASE(stale_if_error_is_ignored_for_must_revalidate_and_no_cache)
+{
+    auto must_revalidate = HTTP::HeaderList::create({ { "Cache-Control", "max-age=60, must-revalidate, stale-if-error=300" } });
+    EXPECT_EQ(HTTP::calculate_stale_if_error_lifetime(*must_revalidate, AK::Duration::from_seconds(60)), AK::Duration::zero());
+
+    auto no_cache = HTTP::HeaderList::create({ { "Cache-Control", "no-cache, stale-if-error=300" } });
+    EXPECT_EQ(HTTP::calculate_stale_if_error_lifetime(*no_cache, AK::Duration::zero()), AK::Duration::zero());
+}
@@ -11,6 +11,7 @@
 #include <LibHTTP/Cache/Utilities.h>
 #include <LibHTTP/HTTP.h>
 #include <LibHTTP/Header.h>
+#include <LibHTTP/HeaderList.h>
 #include <LibHTTP/Method.h>
 
 TEST_CASE(collect_an_http_quoted_string)
@@ -246,3 +247,32 @@ TEST_CASE(extract_header_values)
     auto result = HTTP::Header { "Content-Type"sv, "text/html; charset=utf-8"sv }.extract_header_values();
     EXPECT_EQ(result, (Vector<ByteString> { "text/html; charset=utf-8" }));
 }
+
+TEST_CASE(intern_header_name)
+{
+    // Interned names keep their casing, and are shared between all users.
+    auto content_type = HTTP::intern_header_name("Content-Type"sv);
+    EXPECT_EQ(content_type, "Content-Type"sv);
+    EXPECT_EQ(content_type.characters(), HTTP::intern_header_name("Content-Type"sv).characters());
+
+    EXPECT_EQ(HTTP::intern_header_name("content-type"sv), "content-type"sv);
+
+    // Names in any other casing, and names that are not well-known, are not interned.
+    EXPECT(HTTP::intern_header_name("CONTENT-TYPE"sv).is_empty());
+    EXPECT(HTTP::intern_header_name("X-Custom-Header"sv).is_empty());
+
+    auto header = HTTP::Header::isomorphic_encode("ETag"sv, "\"abc\""sv);
+    EXPECT_EQ(header.name.characters(), HTTP::intern_header_name("ETag"sv).characters());
+}
+
+TEST_CASE(header_list_get)
+{
+    auto headers = HTTP::HeaderList::create();
+    headers->append({ "Content-Type", "text/html" });
+    headers->append({ "Vary", "Accept" });
+    headers->append({ "vary", "Origin" });
+
+    EXPECT_EQ(headers->get("content-type"sv).value(), "text/html"sv);
+    EXPECT_EQ(headers->get("Vary"sv).value(), "Accept, Origin"sv);
+    EXPECT(!headers->get("Accept"sv).has_value());
+}
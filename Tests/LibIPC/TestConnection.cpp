@@ -73,6 +73,11 @@ public:
         return wait_for_specific_endpoint_message_impl(endpoint_magic, message_id);
     }
 
+    void call_add_response_handler(u32 endpoint_magic, int message_id, ResponseHandler handler)
+    {
+        add_response_handler(endpoint_magic, message_id, move(handler));
+    }
+
 protected:
     OwnPtr<IPC::Message> try_parse_message(ReadonlyBytes, Queue<IPC::Attachment>&) override
     {
@@ -120,3 +125,39 @@ TEST_CASE(sync_wait_failure_does_not_dispatch_queued_messages)
     EXPECT(!response);
     EXPECT_EQ(stub.handle_count(), 0u);
 }
+
+TEST_CASE(pending_response_handlers_fail_when_peer_disconnects)
+{
+    Core::EventLoop loop;
+
+    int fds[2] = {};
+    MUST(Core::System::socketpair(AF_LOCAL, SOCK_STREAM, 0, fds));
+
+    auto local_socket = TRY_OR_FAIL(Core::LocalSocket::adopt_fd(fds[0]));
+    auto peer_socket = TRY_OR_FAIL(Core::LocalSocket::adopt_fd(fds[1]));
+
+    MUST(local_socket->set_blocking(false));
+    MUST(peer_socket->set_blocking(false));
+
+    auto transport = make<IPC::TransportSocket>(move(local_socket));
+
+    CountingStub stub;
+    auto connection = TestConnection::construct(stub, move(transport));
+
+    size_t handler_call_count = 0;
+    bool received_response = false;
+    connection->call_add_response_handler(TEST_MAGIC, TARGET_MESSAGE_ID, [&](OwnPtr<IPC::Message> response) {
+        ++handler_call_count;
+        received_response = response != nullptr;
+    });
+
+    peer_socket->close();
+
+    for (size_t i = 0; i < 400 && handler_call_count == 0; ++i) {
+        loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+        MUST(Core::System::sleep_ms(5));
+    }
+
+    EXPECT_EQ(handler_call_count, 1u);
+    EXPECT(!received_response);
+}
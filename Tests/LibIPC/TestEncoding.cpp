@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteBuffer.h>
+#include <AK/MemoryStream.h>
+#include <AK/Queue.h>
+#include <AK/String.h>
+#include <LibIPC/Decoder.h>
+#include <LibIPC/Encoder.h>
+#include <LibIPC/Limits.h>
+#include <LibIPC/Message.h>
+#include <LibTest/TestCase.h>
+
+template<typename T>
+static T round_trip(T const& value, size_t expected_attachment_count)
+{
+    IPC::MessageBuffer buffer;
+    IPC::Encoder encoder { buffer };
+    MUST(encoder.encode(value));
+
+    EXPECT_EQ(buffer.attachments().size(), expected_attachment_count);
+    if (expected_attachment_count > 0)
+        EXPECT(buffer.data().size() < IPC::MIN_SHARED_MEMORY_PAYLOAD_SIZE);
+
+    auto data = buffer.take_data();
+    FixedMemoryStream stream { data.span() };
+
+    Queue<IPC::Attachment> attachments;
+    for (auto& attachment : buffer.take_attachments())
+        attachments.enqueue(move(attachment));
+
+    IPC::Decoder decoder { stream, attachments };
+    auto result = MUST(decoder.decode<T>());
+    EXPECT(stream.is_eof());
+    EXPECT(attachments.is_empty());
+    return result;
+}
+
+static ByteBuffer make_payload(size_t size)
+{
+    auto buffer = MUST(ByteBuffer::create_uninitialized(size));
+    for (size_t i = 0; i < size; ++i)
+        buffer[i] = static_cast<u8>('a' + (i % 26));
+    return buffer;
+}
+
+TEST_CASE(small_payloads_are_sent_inline)
+{
+    auto payload = make_payload(IPC::MIN_SHARED_MEMORY_PAYLOAD_SIZE - 1);
+    EXPECT_EQ(round_trip(payload, 0), payload);
+}
+
+TEST_CASE(large_payloads_are_promoted_to_shared_memory)
+{
+    auto payload = make_payload(IPC::MIN_SHARED_MEMORY_PAYLOAD_SIZE);
+    EXPECT_EQ(round_trip(payload, 1), payload);
+
+    auto string = MUST(String::from_utf8(StringView { payload }));
+    EXPECT_EQ(round_trip(string, 1), string);
+
+    auto byte_string = ByteString { StringView { payload } };
+    EXPECT_EQ(round_trip(byte_string, 1), byte_string);
+
+    Vector<u32> numbers;
+    numbers.resize(IPC::MIN_SHARED_MEMORY_PAYLOAD_SIZE / sizeof(u32));
+    for (size_t i = 0; i < numbers.size(); ++i)
+        numbers[i] = i;
+    EXPECT_EQ(round_trip(numbers, 1), numbers);
+}
+
+TEST_CASE(promotion_falls_back_to_inline_when_attachments_run_out)
+{
+    static constexpr size_t payload_count = IPC::MAX_SHARED_MEMORY_PAYLOADS_PER_MESSAGE + 2;
+
+    Vector<ByteBuffer> payloads;
+    for (size_t i = 0; i < payload_count; ++i)
+        payloads.append(make_payload(IPC::MIN_SHARED_MEMORY_PAYLOAD_SIZE));
+
+    EXPECT_EQ(round_trip(payloads, IPC::MAX_SHARED_MEMORY_PAYLOADS_PER_MESSAGE), payloads);
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibIPC/Tracing.h>
+#include <LibTest/TestCase.h>
+
+TEST_CASE(empty_histogram)
+{
+    IPC::Histogram histogram;
+    EXPECT_EQ(histogram.count(), 0u);
+    EXPECT_EQ(histogram.min(), 0u);
+    EXPECT_EQ(histogram.max(), 0u);
+    EXPECT_EQ(histogram.value_at_percentile(50), 0u);
+}
+
+TEST_CASE(small_values_are_recorded_exactly)
+{
+    IPC::Histogram histogram;
+    for (u64 value = 1; value <= 20; ++value)
+        histogram.record(value);
+
+    EXPECT_EQ(histogram.count(), 20u);
+    EXPECT_EQ(histogram.min(), 1u);
+    EXPECT_EQ(histogram.max(), 20u);
+    EXPECT_EQ(histogram.total(), 210u);
+    EXPECT_EQ(histogram.value_at_percentile(50), 10u);
+    EXPECT_EQ(histogram.value_at_percentile(100), 20u);
+}
+
+TEST_CASE(large_values_are_within_relative_error)
+{
+    IPC::Histogram histogram;
+    for (u64 value = 1; value <= 100'000; ++value)
+        histogram.record(value * 10);
+
+    auto expect_close_to = [&](double percentile, u64 expected) {
+        auto value = histogram.value_at_percentile(percentile);
+        EXPECT(value >= expected);
+        EXPECT(value <= expected + expected / 16);
+    };
+
+    expect_close_to(50, 500'000);
+    expect_close_to(90, 900'000);
+    expect_close_to(99, 990'000);
+    EXPECT_EQ(histogram.value_at_percentile(100), 1'000'000u);
+}
+
+TEST_CASE(values_beyond_the_trackable_range_are_clamped)
+{
+    IPC::Histogram histogram;
+    histogram.record(NumericLimits<u64>::max());
+
+    EXPECT_EQ(histogram.max(), IPC::Histogram::max_trackable_value);
+    EXPECT_EQ(histogram.value_at_percentile(50), IPC::Histogram::max_trackable_value);
+}
@@ -13,6 +13,7 @@
 #include <LibCore/System.h>
 #include <LibIPC/Attachment.h>
 #include <LibIPC/Forward.h>
+#include <LibIPC/TransportHandle.h>
 #include <LibIPC/TransportSocket.h>
 #include <LibTest/TestCase.h>
 
@@ -53,18 +54,87 @@ TEST_CASE(send_queue_does_not_send_message_bytes_without_fds)
     queue->enqueue_message({}, move(second_payload), move(second_fds));
 
     auto first_batch = queue->peek(4096);
-    EXPECT_EQ(first_batch.bytes.size(), sizeof(IPC::SocketMessageHeader) + 1);
-    EXPECT_EQ(first_batch.bytes[sizeof(IPC::SocketMessageHeader)], static_cast<u8>('A'));
+    EXPECT_EQ(first_batch.byte_count, sizeof(IPC::SocketMessageHeader) + 1);
+    EXPECT_EQ(first_batch.buffers.size(), 2u);
+    EXPECT_EQ(first_batch.buffers[1][0], static_cast<u8>('A'));
     EXPECT_EQ(first_batch.fds.size(), Core::LocalSocket::MAX_TRANSFER_FDS);
 
-    queue->discard(first_batch.bytes.size(), first_batch.fds.size());
+    queue->discard(first_batch.byte_count, first_batch.fds.size());
 
     auto second_batch = queue->peek(4096);
-    EXPECT_EQ(second_batch.bytes.size(), sizeof(IPC::SocketMessageHeader) + 1);
-    EXPECT_EQ(second_batch.bytes[sizeof(IPC::SocketMessageHeader)], static_cast<u8>('B'));
+    EXPECT_EQ(second_batch.byte_count, sizeof(IPC::SocketMessageHeader) + 1);
+    EXPECT_EQ(second_batch.buffers.size(), 2u);
+    EXPECT_EQ(second_batch.buffers[1][0], static_cast<u8>('B'));
     EXPECT_EQ(second_batch.fds.size(), 1u);
 }
 
+TEST_CASE(send_queue_gathers_queued_messages_and_resumes_after_partial_send)
+{
+    auto queue = adopt_ref(*new IPC::SendQueue);
+
+    for (u8 i = 0; i < 3; ++i) {
+        IPC::MessageDataType payload;
+        payload.append(static_cast<u8>('A' + i));
+        payload.append(static_cast<u8>('a' + i));
+        queue->enqueue_message({}, move(payload), {});
+    }
+
+    static constexpr size_t message_size = sizeof(IPC::SocketMessageHeader) + 2;
+
+    auto batch = queue->peek(4096);
+    EXPECT_EQ(batch.byte_count, 3 * message_size);
+    EXPECT_EQ(batch.buffers.size(), 6u);
+    EXPECT_EQ(queue->depth().message_count, 3u);
+
+    // Pretend the socket only took the first message and one byte of the second message's payload.
+    queue->discard(message_size + sizeof(IPC::SocketMessageHeader) + 1, 0);
+    EXPECT_EQ(queue->depth().message_count, 2u);
+
+    batch = queue->peek(4096);
+    EXPECT_EQ(batch.byte_count, 1 + message_size);
+    EXPECT_EQ(batch.buffers[0].size(), 1u);
+    EXPECT_EQ(batch.buffers[0][0], static_cast<u8>('b'));
+
+    queue->discard(batch.byte_count, 0);
+    EXPECT(!queue->has_pending_data());
+    EXPECT_EQ(queue->depth().byte_count, 0u);
+}
+
+TEST_CASE(messages_are_delivered_in_order_and_counted)
+{
+    Core::EventLoop loop;
+
+    auto [sender, remote_handle] = TRY_OR_FAIL(IPC::TransportSocket::create_paired());
+    auto receiver = TRY_OR_FAIL(remote_handle.create_transport());
+
+    static constexpr size_t message_count = 100;
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA Vector<u8> received;
+    receiver->set_up_read_hook([&] {
+        (void)receiver->read_as_many_messages_as_possible_without_blocking([&](auto&& message) {
+            received.append(message.bytes.bytes()[0]);
+        });
+    });
+
+    for (size_t i = 0; i < message_count; ++i) {
+        IPC::MessageDataType payload;
+        payload.append(static_cast<u8>(i));
+        Vector<IPC::Attachment> attachments;
+        TRY_OR_FAIL(sender->post_message(move(payload), attachments));
+    }
+
+    spin_until(loop, [&] { return received.size() == message_count; });
+
+    for (size_t i = 0; i < message_count; ++i)
+        EXPECT_EQ(received[i], static_cast<u8>(i));
+
+    auto sender_statistics = sender->statistics();
+    EXPECT_EQ(sender_statistics.posted_message_count, message_count);
+    EXPECT_EQ(sender_statistics.sent_byte_count, message_count * (sizeof(IPC::SocketMessageHeader) + 1));
+    EXPECT(sender_statistics.send_syscall_count <= message_count);
+    EXPECT_EQ(receiver->statistics().received_message_count, message_count);
+}
+
 TEST_CASE(read_hook_is_notified_on_peer_hangup)
 {
     Core::EventLoop loop;
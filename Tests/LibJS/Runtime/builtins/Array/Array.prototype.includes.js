@@ -17,6 +17,25 @@ test("basic functionality", () => {
     expect(array.includes("friends", 100)).toBeFalse();
 });
 
+test("numeric arrays", () => {
+    var array = [1, 2, 3];
+    expect(array.includes("1")).toBeFalse();
+    expect(array.includes(2)).toBeTrue();
+    expect(array.includes(2.0)).toBeTrue();
+
+    array.push(0.5);
+    expect(array.includes(0.5)).toBeTrue();
+    expect(array.includes(NaN)).toBeFalse();
+
+    array.push(NaN);
+    expect(array.includes(NaN)).toBeTrue();
+
+    array[0] = "hello";
+    expect(array.includes("hello")).toBeTrue();
+    array[1] = undefined;
+    expect(array.includes(undefined)).toBeTrue();
+});
+
 test("is unscopable", () => {
     expect(Array.prototype[Symbol.unscopables].includes).toBeTrue();
     const array = [];
@@ -89,6 +89,66 @@ describe("Array.prototype.sort", () => {
         expect(arr[2].other_property == 2);
     });
 
+    test("that it is stable for long arrays", () => {
+        const length = 5000;
+        const arr = [];
+        for (let i = 0; i < length; ++i) arr.push({ key: (i * 7919) % 13, index: i });
+
+        arr.sort((a, b) => a.key - b.key);
+        for (let i = 1; i < length; ++i) {
+            expect(arr[i - 1].key <= arr[i].key).toBeTrue();
+            if (arr[i - 1].key === arr[i].key) expect(arr[i - 1].index < arr[i].index).toBeTrue();
+        }
+
+        // Mostly sorted input with a few runs out of place.
+        const values = [];
+        for (let i = 0; i < length; ++i) values.push(i % 1000 === 0 ? length - i : i);
+        const expected = [...values].sort((a, b) => a - b);
+        values.reverse();
+        expect(values.sort((a, b) => a - b)).toEqual(expected);
+    });
+
+    test("that the default order compares strings of integers", () => {
+        const arr = [];
+        for (let i = -1000; i <= 1000; i += 7) arr.push(i * 1009);
+        arr.push(2147483647, -2147483648, 0, 10, 1, 100);
+
+        const expected = arr.map(String).sort((a, b) => (a < b ? -1 : a > b ? 1 : 0));
+        expect(arr.sort().map(String)).toEqual(expected);
+    });
+
+    test("that the default order is stable for mixed primitives", () => {
+        const arr = [];
+        for (let i = 0; i < 300; ++i) arr.push(i % 3 === 0 ? String(i % 50) : i % 3 === 1 ? (i % 50) + 0.5 : i % 50);
+        arr.push(true, false, null, 12n, undefined, "null");
+
+        const expected = arr.map((value, index) => ({ string: value === undefined ? undefined : String(value), index }));
+        expected.sort((a, b) => {
+            if (a.string === undefined) return b.string === undefined ? 0 : 1;
+            if (b.string === undefined) return -1;
+            if (a.string !== b.string) return a.string < b.string ? -1 : 1;
+            return a.index - b.index;
+        });
+
+        const original = [...arr];
+        arr.sort();
+        for (let i = 0; i < arr.length; ++i) expect(arr[i]).toBe(original[expected[i].index]);
+    });
+
+    test("that objects are converted to strings while comparing", () => {
+        let calls = 0;
+        const make = value => ({
+            toString() {
+                ++calls;
+                return value;
+            },
+        });
+        const arr = [make("b"), "c", make("a"), 1];
+        arr.sort();
+        expect(arr.map(String)).toEqual(["1", "a", "b", "c"]);
+        expect(calls > 0).toBeTrue();
+    });
+
     test("that it makes no unnecessary calls to compare function", () => {
         expectNoCallCompareFunction = function (a, b) {
             expect().fail();
@@ -59,3 +59,55 @@ test("allows assignment expressions", () => {
     expect("([ ...a ??= 'hello' ])").toEval();
     expect("function* test() { return ([ ...yield a ]); }").toEval();
 });
+
+describe("iteration protocol", () => {
+    test("holes are read through the prototype chain", () => {
+        Array.prototype[1] = "from prototype";
+        try {
+            expect([...[1, , 3]]).toEqual([1, "from prototype", 3]);
+            const [first, ...rest] = [1, , 3];
+            expect(rest).toEqual(["from prototype", 3]);
+        } finally {
+            delete Array.prototype[1];
+        }
+    });
+
+    test("length is re-read after every element", () => {
+        const array = [1, 2, 3];
+        Object.defineProperty(array, 1, {
+            get() {
+                array.length = 2;
+                return 2;
+            },
+        });
+        expect([...array]).toEqual([1, 2]);
+    });
+
+    test("redefined Symbol.iterator is used", () => {
+        const array = [1, 2, 3];
+        array[Symbol.iterator] = function* () {
+            yield "a";
+        };
+        expect([...array]).toEqual(["a"]);
+        expect(new Set(array).has("a")).toBeTrue();
+    });
+
+    test("redefined ArrayIterator.prototype.next is used", () => {
+        const arrayIteratorPrototype = Object.getPrototypeOf([][Symbol.iterator]());
+        const originalNext = arrayIteratorPrototype.next;
+        let calls = 0;
+        arrayIteratorPrototype.next = function () {
+            ++calls;
+            return originalNext.call(this);
+        };
+        try {
+            expect([...[1, 2]]).toEqual([1, 2]);
+            expect(calls).toBe(3);
+            const [first, ...rest] = [1, 2, 3];
+            expect(rest).toEqual([2, 3]);
+            expect(calls).toBe(7);
+        } finally {
+            arrayIteratorPrototype.next = originalNext;
+        }
+    });
+});
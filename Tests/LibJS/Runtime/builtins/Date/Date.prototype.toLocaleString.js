@@ -54,3 +54,17 @@ describe("correct behavior", () => {
         expect(d1.toLocaleString("ar-u-nu-arab", { timeStyle: "short", timeZone: "UTC" })).toBe("٧:٠٨ ص");
     });
 });
+
+describe("repeated calls without options", () => {
+    const d = new Date(Date.UTC(2021, 11, 7, 17, 40, 50, 456));
+
+    test("date, time and date-time formats for the same locale are kept apart", () => {
+        for (let i = 0; i < 3; ++i) {
+            for (const locale of [undefined, "en", "de", "ar-u-nu-arab"]) {
+                expect(d.toLocaleString(locale)).toBe(d.toLocaleString(locale, {}));
+                expect(d.toLocaleDateString(locale)).toBe(d.toLocaleDateString(locale, {}));
+                expect(d.toLocaleTimeString(locale)).toBe(d.toLocaleTimeString(locale, {}));
+            }
+        }
+    });
+});
@@ -154,3 +154,26 @@ test("whitespace handling", () => {
     expect(JSON.parse("  {  }  ")).toEqual({});
     expect(JSON.parse("  [  ]  ")).toEqual([]);
 });
+
+test("arrays of objects with similar keys", () => {
+    const result = JSON.parse(
+        '[{"a":1,"b":2},{"a":3,"b":4},{"b":5,"a":6},{"a":7},{"a":8,"b":9,"c":10},{"a":11,"a":12},{"0":13,"a":14},{"a":15,"b":16}]'
+    );
+    expect(result).toHaveLength(8);
+    expect(Object.keys(result[0])).toEqual(["a", "b"]);
+    expect(result[1]).toEqual({ a: 3, b: 4 });
+    expect(Object.keys(result[2])).toEqual(["b", "a"]);
+    expect(result[2]).toEqual({ b: 5, a: 6 });
+    expect(Object.keys(result[3])).toEqual(["a"]);
+    expect(result[3].a).toBe(7);
+    expect(result[4]).toEqual({ a: 8, b: 9, c: 10 });
+    expect(Object.keys(result[5])).toEqual(["a"]);
+    expect(result[5].a).toBe(12);
+    expect(Object.keys(result[6])).toEqual(["0", "a"]);
+    expect(result[6][0]).toBe(13);
+    expect(result[7]).toEqual({ a: 15, b: 16 });
+
+    result[1].c = 17;
+    expect(result[0].c).toBeUndefined();
+    expect(Object.keys(result[1])).toEqual(["a", "b", "c"]);
+});
@@ -83,3 +83,55 @@ describe("modification with active iterators", () => {
         expect(iterator.next()).toBeIteratorResultDone();
     });
 });
+
+describe("churn", () => {
+    test("keeps insertion order across many deletions and insertions", () => {
+        const map = new Map();
+        for (let i = 0; i < 1000; ++i) map.set(i, i);
+        for (let i = 0; i < 1000; ++i) {
+            if (i % 3 !== 0) expect(map.delete(i)).toBeTrue();
+        }
+        for (let i = 1000; i < 1500; ++i) map.set(i, i);
+
+        const expected = [];
+        for (let i = 0; i < 1000; i += 3) expected.push(i);
+        for (let i = 1000; i < 1500; ++i) expected.push(i);
+        expect(Array.from(map.keys())).toEqual(expected);
+        expect(map).toHaveSize(expected.length);
+    });
+
+    test("active iterators survive the map being compacted and shrunk", () => {
+        const map = new Map();
+        for (let i = 0; i < 200; ++i) map.set(i, i);
+
+        const iterator = map.keys();
+        expect(iterator.next()).toBeIteratorResultWithValue(0);
+        expect(iterator.next()).toBeIteratorResultWithValue(1);
+
+        for (let i = 0; i < 190; ++i) map.delete(i);
+        for (let i = 0; i < 2000; ++i) {
+            map.set(`churn${i}`, i);
+            map.delete(`churn${i}`);
+        }
+        map.set("last", 0);
+
+        const rest = [];
+        for (let result = iterator.next(); !result.done; result = iterator.next()) rest.push(result.value);
+        expect(rest).toEqual([190, 191, 192, 193, 194, 195, 196, 197, 198, 199, "last"]);
+    });
+
+    test("re-inserting a deleted key moves it to the end", () => {
+        const map = new Map([
+            ["a", 1],
+            ["b", 2],
+            ["c", 3],
+        ]);
+        map.delete("a");
+        map.set("a", 4);
+        expect(Array.from(map)).toEqual([
+            ["b", 2],
+            ["c", 3],
+            ["a", 4],
+        ]);
+    });
+});
@@ -18,3 +18,40 @@ test("NaN differentiation", () => {
     expect(map.get(0 * Infinity)).toBe("a");
     expect(map.get(Infinity - Infinity)).toBe("a");
 });
+
+test("keys of different types", () => {
+    const object = {};
+    const symbol = Symbol();
+    const map = new Map([
+        [1, "int"],
+        [1.5, "double"],
+        ["1", "string"],
+        [1n, "bigint"],
+        [object, "object"],
+        [symbol, "symbol"],
+        [-0, "zero"],
+    ]);
+    expect(map.get(1)).toBe("int");
+    expect(map.get(3 / 2)).toBe("double");
+    expect(map.get(String(1))).toBe("string");
+    expect(map.get(BigInt(1))).toBe("bigint");
+    expect(map.get(object)).toBe("object");
+    expect(map.get({})).toBeUndefined();
+    expect(map.get(symbol)).toBe("symbol");
+    expect(map.get(0)).toBe("zero");
+    expect(map.get(-0)).toBe("zero");
+    expect(Array.from(map.keys())[6]).toBe(0);
+});
+
+test("get and set calls on other objects", () => {
+    const notAMap = { get: key => `get ${key}`, set: (key, value) => `set ${key} ${value}` };
+    expect(notAMap.get("a")).toBe("get a");
+    expect(notAMap.set("a", 1)).toBe("set a 1");
+
+    expect(() => Map.prototype.get.call({}, "a")).toThrowWithMessage(TypeError, "Not an object of type Map");
+
+    const map = new Map();
+    expect(map.set("a", 1)).toBe(map);
+    map.get = () => "own get";
+    expect(map.get("a")).toBe("own get");
+});
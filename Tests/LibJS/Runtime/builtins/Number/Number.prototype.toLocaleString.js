@@ -76,3 +76,29 @@ describe("styles", () => {
         ).toBe("\u0661\u066b\u0662\u0663 كيلومتر في الساعة");
     });
 });
+
+describe("repeated calls without options", () => {
+    test("each locale keeps formatting like a new formatter would", () => {
+        const locales = [undefined, "en", "de", "fr", "ar-u-nu-arab", "hi-u-nu-deva", "ja", "en-IN"];
+        for (let i = 0; i < 3; ++i) {
+            for (const locale of locales) {
+                expect((1234567.891).toLocaleString(locale)).toBe((1234567.891).toLocaleString(locale, {}));
+                expect((-0.5).toLocaleString(locale)).toBe((-0.5).toLocaleString(locale, {}));
+            }
+        }
+    });
+
+    test("more locales than are kept around", () => {
+        const results = [];
+        for (let i = 0; i < 2; ++i) {
+            for (let j = 0; j < 40; ++j) results.push((1234.5).toLocaleString(`en-u-nu-${j % 2 ? "arab" : "latn"}-x-t${j}`));
+        }
+        expect(results.slice(0, 40)).toEqual(results.slice(40));
+    });
+
+    test("invalid locales throw every time", () => {
+        for (let i = 0; i < 3; ++i) {
+            expect(() => (1).toLocaleString("a-b-c")).toThrowWithMessage(RangeError, "a-b-c is not a structurally valid language tag");
+        }
+    });
+});
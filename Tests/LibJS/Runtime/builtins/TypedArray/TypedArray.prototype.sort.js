@@ -73,6 +73,37 @@ test("basic functionality", () => {
     });
 });
 
+test("default order of floating-point elements", () => {
+    [Float16Array, Float32Array, Float64Array].forEach(T => {
+        const typedArray = new T([NaN, 1, -0, Infinity, 0, -Infinity, -1, NaN, 0.5, -0.5]);
+        expect(typedArray.sort()).toBe(typedArray);
+        expect(Array.from(typedArray)).toEqual([-Infinity, -1, -0.5, -0, 0, 0.5, 1, Infinity, NaN, NaN]);
+        expect(Object.is(typedArray[3], -0)).toBeTrue();
+        expect(Object.is(typedArray[4], 0)).toBeTrue();
+    });
+});
+
+test("default order of long arrays matches the numeric order", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(1000);
+        for (let i = 0; i < typedArray.length; ++i) typedArray[i] = ((i * 7919) % 2003) - 1000;
+
+        const expected = Array.from(typedArray).sort((a, b) => a - b);
+        const sorted = typedArray.toSorted();
+        expect(Array.from(sorted)).toEqual(expected);
+        expect(typedArray.sort()).toBe(typedArray);
+        expect(Array.from(typedArray)).toEqual(expected);
+    });
+
+    BIGINT_TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(1000);
+        for (let i = 0; i < typedArray.length; ++i) typedArray[i] = BigInt(((i * 7919) % 2003) - 1000);
+
+        const expected = Array.from(typedArray).sort((a, b) => (a < b ? -1 : a > b ? 1 : 0));
+        expect(Array.from(typedArray.sort())).toEqual(expected);
+    });
+});
+
 test("detached buffer", () => {
     TYPED_ARRAYS.forEach(T => {
         const typedArray = new T(3);
@@ -757,3 +757,63 @@ describe("await observably looks up constructor of Promise objects", () => {
     runQueuedPromiseJobs();
     expect(calls).toBe(4);
 });
+
+describe("await resumes in the same order when it waits on pending promises", () => {
+    test("interleaving of two functions awaiting pending promises", () => {
+        const log = [];
+        const resolvers = { a: [], b: [] };
+        const pending = name => new Promise(resolve => resolvers[name].push(resolve));
+
+        async function a() {
+            for (let i = 0; i < 3; ++i) log.push(`a${await pending("a")}`);
+        }
+        async function b() {
+            for (let i = 0; i < 3; ++i) log.push(`b${await pending("b")}`);
+        }
+        a();
+        b();
+
+        for (let i = 0; i < 3; ++i) {
+            resolvers.b.shift()(i);
+            resolvers.a.shift()(i);
+            runQueuedPromiseJobs();
+        }
+        expect(log).toEqual(["b0", "a0", "b1", "a1", "b2", "a2"]);
+    });
+
+    test("rejections of pending promises are thrown at every await", () => {
+        let rejectLater;
+        let caught = 0;
+        async function f() {
+            for (let i = 0; i < 5; ++i) {
+                try {
+                    await new Promise((_, reject) => (rejectLater = reject));
+                } catch (e) {
+                    caught += e;
+                }
+                await 0;
+            }
+        }
+        f();
+        for (let i = 1; i <= 5; ++i) {
+            rejectLater(i);
+            runQueuedPromiseJobs();
+        }
+        expect(caught).toBe(15);
+    });
+
+    test("awaiting the same pending promise from several functions", () => {
+        let resolvePromise;
+        const promise = new Promise(resolve => (resolvePromise = resolve));
+        const results = [];
+        async function f(n) {
+            results.push((await promise) + n);
+        }
+        f(1);
+        f(2);
+        f(3);
+        resolvePromise(10);
+        runQueuedPromiseJobs();
+        expect(results).toEqual([11, 12, 13]);
+    });
+});
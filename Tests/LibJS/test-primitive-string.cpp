@@ -199,3 +199,24 @@ TEST_CASE(deferred_primitive_strings_do_not_evict_cached_strings)
     test_vm.vm->heap().collect_garbage();
     EXPECT_EQ(PrimitiveString::create(*test_vm.vm, "foo"_utf16).ptr(), cached_foo.ptr());
 }
+
+TEST_CASE(long_lived_primitive_strings_with_equal_contents_share_buffers)
+{
+    TestVM test_vm;
+    auto& vm = *test_vm.vm;
+
+    // NB: Long enough to bypass the string cache.
+    auto contents = MUST(String::repeated('x', 300));
+    auto first = GC::make_root(*PrimitiveString::create(vm, Utf16String::from_utf8(contents)));
+    auto second = GC::make_root(*PrimitiveString::create(vm, Utf16String::from_utf8(contents)));
+    EXPECT_NE(first->utf16_string_view().ascii_span().data(), second->utf16_string_view().ascii_span().data());
+
+    // Strings are deduplicated once they have survived a collection, and only while no JavaScript is running.
+    vm.pop_execution_context();
+    vm.heap().collect_garbage();
+    vm.heap().collect_garbage();
+    vm.push_execution_context(*test_vm.execution_context);
+
+    EXPECT_EQ(first->utf16_string_view().ascii_span().data(), second->utf16_string_view().ascii_span().data());
+    EXPECT(first->utf16_string_view() == contents.bytes_as_string_view());
+}
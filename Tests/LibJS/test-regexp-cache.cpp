@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/PrimitiveString.h>
+#include <LibJS/Runtime/RegExpObject.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibTest/TestCase.h>
+
+static GC::Ref<JS::RegExpObject> create_regexp(JS::VM& vm, Utf16String const& pattern, Utf16String const& flags)
+{
+    return MUST(JS::regexp_create(vm, JS::PrimitiveString::create(vm, pattern), JS::PrimitiveString::create(vm, flags)));
+}
+
+TEST_CASE(regexps_with_the_same_source_and_flags_share_a_compiled_pattern)
+{
+    auto vm = JS::VM::create();
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+
+    auto before = JS::regex_cache_statistics();
+    auto first = create_regexp(*vm, "shared-[a-z]+"_utf16, "g"_utf16);
+    auto after_first = JS::regex_cache_statistics();
+    EXPECT_EQ(after_first.misses, before.misses + 1);
+
+    auto second = create_regexp(*vm, "shared-[a-z]+"_utf16, "g"_utf16);
+    auto after_second = JS::regex_cache_statistics();
+    EXPECT_EQ(after_second.hits, after_first.hits + 1);
+    EXPECT_EQ(after_second.misses, after_first.misses);
+    EXPECT_EQ(first->compiled_regex(), second->compiled_regex());
+
+    auto with_other_flags = create_regexp(*vm, "shared-[a-z]+"_utf16, "gi"_utf16);
+    EXPECT_EQ(JS::regex_cache_statistics().misses, after_second.misses + 1);
+    EXPECT_NE(first->compiled_regex(), with_other_flags->compiled_regex());
+}
+
+TEST_CASE(evicted_patterns_stay_alive_for_their_regexps)
+{
+    auto vm = JS::VM::create();
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+
+    auto survivor = create_regexp(*vm, "survivor-(\\d+)"_utf16, {});
+    auto const* compiled = survivor->compiled_regex();
+
+    auto before = JS::regex_cache_statistics();
+    for (size_t i = 0; i < before.capacity + 1; ++i)
+        create_regexp(*vm, Utf16String::formatted("filler-{}", i), {});
+
+    auto after = JS::regex_cache_statistics();
+    EXPECT(after.evictions > before.evictions);
+    EXPECT(after.size <= after.capacity);
+
+    EXPECT_EQ(survivor->compiled_regex(), compiled);
+    auto input = "survivor-42"_utf16;
+    EXPECT_EQ(compiled->exec(input.utf16_view(), 0), regex::MatchResult::Match);
+    EXPECT_EQ(compiled->capture_slot(2), 9);
+
+    // The evicted pattern compiles again the next time it's needed.
+    auto misses = JS::regex_cache_statistics().misses;
+    auto recompiled = create_regexp(*vm, "survivor-(\\d+)"_utf16, {});
+    EXPECT_EQ(JS::regex_cache_statistics().misses, misses + 1);
+    EXPECT_NE(recompiled->compiled_regex(), compiled);
+}
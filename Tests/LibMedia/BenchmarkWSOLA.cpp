@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <AK/Time.h>
+#include <LibMedia/Audio/WSOLAInternals.h>
+#include <LibMedia/Audio/WSOLATimeStretcher.h>
+#include <LibMedia/AudioBlock.h>
+#include <LibTest/TestCase.h>
+
+static constexpr u32 seconds_of_input = 10;
+
+static void fill_with_tones(Media::AudioBlock& block, u32 sample_rate)
+{
+    for (size_t channel = 0; channel < block.channel_count(); channel++) {
+        auto frequency = 220.0f * static_cast<float>(channel + 1);
+        auto first_frame = block.first_frame_index();
+        auto samples = block.channel_data(channel);
+        for (size_t frame = 0; frame < samples.size(); frame++) {
+            auto time = static_cast<float>(first_frame + static_cast<i64>(frame)) / static_cast<float>(sample_rate);
+            samples[frame] = 0.5f * AK::sin(2.0f * AK::Pi<float> * frequency * time);
+        }
+    }
+}
+
+static void stretch(u32 sample_rate, Audio::ChannelMap channel_map, float rate)
+{
+    Audio::SampleSpecification sample_specification { sample_rate, channel_map };
+    auto stretcher = MUST(Audio::WSOLATimeStretcher::create(sample_specification));
+    stretcher->set_rate(rate);
+    stretcher->flush(AK::Duration::zero(), 0);
+
+    auto const block_frame_count = sample_rate / 50;
+    Media::AudioBlock input;
+    for (i64 frame = 0; frame < static_cast<i64>(sample_rate * seconds_of_input); frame += block_frame_count) {
+        input.initialize(sample_specification, frame, block_frame_count);
+        fill_with_tones(input, sample_rate);
+        stretcher->push_block(input);
+        while (!stretcher->retrieve_block().is_error()) { }
+    }
+}
+
+BENCHMARK_CASE(mono_48000_at_2x)
+{
+    stretch(48000, Audio::ChannelMap::mono(), 2.0f);
+}
+
+BENCHMARK_CASE(stereo_44100_at_1_5x)
+{
+    stretch(44100, Audio::ChannelMap::stereo(), 1.5f);
+}
+
+BENCHMARK_CASE(stereo_44100_at_2x)
+{
+    stretch(44100, Audio::ChannelMap::stereo(), 2.0f);
+}
+
+BENCHMARK_CASE(stereo_48000_at_1_5x)
+{
+    stretch(48000, Audio::ChannelMap::stereo(), 1.5f);
+}
+
+BENCHMARK_CASE(stereo_48000_at_2x)
+{
+    stretch(48000, Audio::ChannelMap::stereo(), 2.0f);
+}
+
+BENCHMARK_CASE(stereo_96000_at_1_5x)
+{
+    stretch(96000, Audio::ChannelMap::stereo(), 1.5f);
+}
+
+BENCHMARK_CASE(surround_5_1_48000_at_1_5x)
+{
+    stretch(48000, Audio::ChannelMap::surround_5_1(), 1.5f);
+}
+
+// Compares the two ways of searching for the best matching block, with the block sizes WSOLAAlgorithm uses.
+static void search(u32 sample_rate, bool use_fft)
+{
+    Audio::SampleSpecification sample_specification { sample_rate, Audio::ChannelMap::stereo() };
+    auto const target_frame_count = sample_rate / 50;
+    auto const search_frame_count = ((sample_rate * 3) / 100) + target_frame_count - 1;
+
+    Media::AudioBlock target;
+    target.initialize(sample_specification, 0, target_frame_count);
+    fill_with_tones(target, sample_rate);
+    Media::AudioBlock search_block;
+    search_block.initialize(sample_specification, 1234, search_frame_count);
+    fill_with_tones(search_block, sample_rate);
+
+    Audio::WSOLAInternals::FFTCrossCorrelator correlator { target_frame_count, search_frame_count };
+    for (size_t i = 0; i < 1000; i++)
+        (void)Audio::WSOLAInternals::optimal_index(search_block, target, { 0, 0 }, use_fft ? &correlator : nullptr);
+}
+
+BENCHMARK_CASE(search_48000_direct)
+{
+    search(48000, false);
+}
+
+BENCHMARK_CASE(search_48000_fft)
+{
+    search(48000, true);
+}
+
+BENCHMARK_CASE(search_96000_direct)
+{
+    search(96000, false);
+}
+
+BENCHMARK_CASE(search_96000_fft)
+{
+    search(96000, true);
+}
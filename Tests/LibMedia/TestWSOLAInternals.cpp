@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Vector.h>
+#include <LibMedia/Audio/WSOLAInternals.h>
+#include <LibMedia/AudioBlock.h>
+#include <LibTest/TestCase.h>
+
+static Media::AudioBlock create_block(Audio::SampleSpecification sample_specification, size_t frame_count)
+{
+    Media::AudioBlock block;
+    block.initialize(sample_specification, 0, frame_count);
+    return block;
+}
+
+// Smoothed noise, so that the similarity between blocks falls off gradually around the best match.
+static void fill_with_smoothed_noise(Media::AudioBlock& block, u32 seed)
+{
+    for (size_t channel = 0; channel < block.channel_count(); channel++) {
+        auto state = seed + static_cast<u32>(channel);
+        auto smoothed = 0.0f;
+        for (auto& sample : block.channel_data(channel)) {
+            state = (state * 1664525u) + 1013904223u;
+            auto noise = (static_cast<float>(state >> 8) / static_cast<float>(1u << 24)) - 0.5f;
+            smoothed += (noise - smoothed) * 0.1f;
+            sample = smoothed;
+        }
+    }
+}
+
+static void copy_frames(Media::AudioBlock const& source, size_t source_offset, Media::AudioBlock& destination)
+{
+    for (size_t channel = 0; channel < source.channel_count(); channel++)
+        source.channel_data(channel).slice(source_offset, destination.frame_count()).copy_to(destination.channel_data(channel));
+}
+
+TEST_CASE(fft_correlation_matches_direct_dot_products)
+{
+    Audio::SampleSpecification sample_specification { 48000, Audio::ChannelMap::stereo() };
+    constexpr size_t target_frame_count = 960;
+    constexpr size_t search_frame_count = 2399;
+    constexpr size_t candidate_count = search_frame_count - target_frame_count + 1;
+
+    auto target = create_block(sample_specification, target_frame_count);
+    auto search = create_block(sample_specification, search_frame_count);
+    fill_with_smoothed_noise(target, 1);
+    fill_with_smoothed_noise(search, 2);
+
+    Vector<float> dot_products;
+    dot_products.resize(candidate_count * 2);
+    Audio::WSOLAInternals::FFTCrossCorrelator correlator { target_frame_count, search_frame_count };
+    correlator.correlate(target, search, dot_products.span());
+
+    float expected[2];
+    for (size_t candidate = 0; candidate < candidate_count; candidate++) {
+        Audio::WSOLAInternals::multi_channel_dot_product(target, 0, search, candidate, target_frame_count, { expected, 2 });
+        EXPECT_APPROXIMATE_WITH_ERROR(dot_products[candidate * 2], expected[0], 1e-3f);
+        EXPECT_APPROXIMATE_WITH_ERROR(dot_products[(candidate * 2) + 1], expected[1], 1e-3f);
+    }
+}
+
+TEST_CASE(fft_and_direct_search_find_the_same_block)
+{
+    Audio::SampleSpecification sample_specification { 96000, Audio::ChannelMap::stereo() };
+    constexpr size_t target_frame_count = 1920;
+    constexpr size_t search_frame_count = 4799;
+    constexpr size_t expected_index = 1537;
+
+    auto search = create_block(sample_specification, search_frame_count);
+    fill_with_smoothed_noise(search, 3);
+    auto target = create_block(sample_specification, target_frame_count);
+    copy_frames(search, expected_index, target);
+
+    Audio::WSOLAInternals::Interval exclude_interval { 0, 0 };
+    auto direct_index = Audio::WSOLAInternals::optimal_index(search, target, exclude_interval);
+    EXPECT_EQ(direct_index, expected_index);
+
+    Audio::WSOLAInternals::FFTCrossCorrelator correlator { target_frame_count, search_frame_count };
+    auto fft_index = Audio::WSOLAInternals::optimal_index(search, target, exclude_interval, &correlator);
+    EXPECT_EQ(fft_index, expected_index);
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <AK/Utf16String.h>
+#include <LibTest/TestCase.h>
+
+#include <LibRegex/ECMAScriptRegex.h>
+
+// The same few regexes run over and over, the way log parsing and templating code uses them.
+static constexpr size_t iterations = 20'000;
+
+static regex::ECMAScriptRegex compile_regex(StringView pattern, regex::ECMAScriptCompileFlags flags = {})
+{
+    auto utf16_pattern = Utf16String::from_utf8(pattern);
+    return MUST(regex::ECMAScriptRegex::compile(utf16_pattern.utf16_view(), flags));
+}
+
+static Utf16String repeated_lines(StringView line, size_t count)
+{
+    StringBuilder builder;
+    for (size_t i = 0; i < count; ++i)
+        builder.append(line);
+    return Utf16String::from_utf8(builder.string_view());
+}
+
+BENCHMARK_CASE(log_line_with_captures)
+{
+    auto regex = compile_regex("^(\\d{4})-(\\d{2})-(\\d{2}) (\\d{2}):(\\d{2}):(\\d{2}) \\[(\\w+)\\] ([\\w.]+): (.*)$"sv);
+    auto line = Utf16String::from_utf8("2026-10-14 12:34:56 [WARN] net.http.client: request to example.org took 3.2s"sv);
+    for (size_t i = 0; i < iterations; ++i)
+        EXPECT_EQ(regex.exec(line, 0), regex::MatchResult::Match);
+}
+
+BENCHMARK_CASE(log_level_search)
+{
+    auto regex = compile_regex("\\[(ERROR|WARN)\\] (\\w+):"sv);
+    auto line = Utf16String::from_utf8("2026-10-14 12:34:56 [INFO] layout: relayout took 1ms, then [ERROR] paint: lost context"sv);
+    for (size_t i = 0; i < iterations; ++i)
+        EXPECT_EQ(regex.exec(line, 0), regex::MatchResult::Match);
+}
+
+BENCHMARK_CASE(template_placeholders)
+{
+    auto regex = compile_regex("\\{\\{\\s*([a-z_][a-z0-9_]*)\\s*\\}\\}"sv, { .global = true });
+    auto text = repeated_lines("<li class=\"{{ item_class }}\">{{name}} has {{ count }} items</li>\n"sv, 10);
+    for (size_t i = 0; i < iterations / 10; ++i)
+        EXPECT_EQ(regex.find_all(text, 0), 30);
+}
+
+BENCHMARK_CASE(key_value_pairs)
+{
+    auto regex = compile_regex("(\\w+)=(\"[^\"]*\"|\\S+)"sv, { .global = true });
+    auto text = Utf16String::from_utf8("ts=1728909296 level=info msg=\"request finished\" path=/api/v1/items status=200 duration=12ms"sv);
+    for (size_t i = 0; i < iterations; ++i)
+        EXPECT_EQ(regex.find_all(text, 0), 6);
+}
+
+BENCHMARK_CASE(case_insensitive_keyword)
+{
+    auto regex = compile_regex("\\b(?:select|insert|update|delete)\\s+\\w+"sv, { .ignore_case = true });
+    auto text = Utf16String::from_utf8("-- migration 42\nBEGIN; Update users SET name = 'x' WHERE id = 1; COMMIT;"sv);
+    for (size_t i = 0; i < iterations; ++i)
+        EXPECT_EQ(regex.test(text, 0), regex::MatchResult::Match);
+}
+
+BENCHMARK_CASE(email_validation)
+{
+    auto regex = compile_regex("^[\\w.+-]+@[a-z\\d-]+(?:\\.[a-z\\d-]+)*\\.[a-z]{2,}$"sv, { .ignore_case = true });
+    auto valid = Utf16String::from_utf8("first.last+tag@mail.example.co.uk"sv);
+    auto invalid = Utf16String::from_utf8("first.last+tag@mail.example.co.u"sv);
+    for (size_t i = 0; i < iterations; ++i) {
+        EXPECT_EQ(regex.test(valid, 0), regex::MatchResult::Match);
+        EXPECT_EQ(regex.test(invalid, 0), regex::MatchResult::NoMatch);
+    }
+}
+
+BENCHMARK_CASE(ascii_input_with_alternation)
+{
+    auto regex = compile_regex("(GET|POST|PUT) (/[\\w/.-]*)(?:\\?(\\S*))? HTTP/(\\d\\.\\d)"sv);
+    for (size_t i = 0; i < iterations; ++i)
+        EXPECT_EQ(regex.exec("127.0.0.1 - - \"POST /api/v1/items?limit=10 HTTP/1.1\" 201"sv, 0), regex::MatchResult::Match);
+}
+
+// Long haystacks where almost all of the time goes to the prefilter scans.
+static Utf16String long_prose()
+{
+    return repeated_lines("The quick brown fox jumps over the lazy dog, then naps in the warm afternoon sun.\n"sv, 200);
+}
+
+BENCHMARK_CASE(literal_alternation_scan)
+{
+    auto regex = compile_regex("zebra|yak|walrus|quokka|narwhal"sv);
+    auto text = long_prose();
+    for (size_t i = 0; i < iterations / 100; ++i)
+        EXPECT_EQ(regex.test(text, 0), regex::MatchResult::NoMatch);
+}
+
+BENCHMARK_CASE(case_insensitive_literal_scan)
+{
+    auto regex = compile_regex("unicorn"sv, { .ignore_case = true });
+    auto text = long_prose();
+    for (size_t i = 0; i < iterations / 100; ++i)
+        EXPECT_EQ(regex.test(text, 0), regex::MatchResult::NoMatch);
+}
+
+BENCHMARK_CASE(small_class_first_character_scan)
+{
+    auto regex = compile_regex("[#@$](\\w+)"sv);
+    auto text = long_prose();
+    for (size_t i = 0; i < iterations / 100; ++i)
+        EXPECT_EQ(regex.exec(text, 0), regex::MatchResult::NoMatch);
+}
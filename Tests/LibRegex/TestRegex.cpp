@@ -739,3 +739,53 @@ TEST_CASE(restored_long_fork_chain_coverage)
 
     EXPECT_EQ(regex.test(utf16_subject, 0), regex::MatchResult::Match);
 }
+
+TEST_CASE(hot_regexes_preserve_results)
+{
+    struct Test {
+        StringView pattern;
+        StringView subject;
+        regex::ECMAScriptCompileFlags flags {};
+    };
+    static constexpr Test tests[] {
+        { "^(\\d{4})-(\\d{2})-(\\d{2}) \\[(\\w+)\\] (.*)$"sv, "2026-10-14 [WARN] disk almost full"sv },
+        { "(a|ab)(c|bcd)(d*)"sv, "abcd"sv },
+        { "((a)|b)+"sv, "ab"sv },
+        { "(?:(a)|(b))*?c"sv, "abac"sv },
+        { "(\\w+)\\s*=\\s*(\"[^\"]*\"|\\S+)"sv, "key = \"some value\""sv },
+        { "\\bFOO(bar)?\\b"sv, "a foobar b"sv, { .ignore_case = true } },
+        { "^b.*$"sv, "a\nbc\nd"sv, { .multiline = true } },
+        { "(x{2,3}?)(x*)"sv, "xxxxx"sv },
+        { "(?:a{1,2}b){2}"sv, "abaabab"sv },
+        { "(a*)+b"sv, "aaaaaaaaaaaaaaaaaaaaaac"sv },
+    };
+
+    for (auto const& test : tests) {
+        auto regex = compile_regex(test.pattern, test.flags);
+        auto subject = Utf16String::from_utf8(test.subject);
+        auto expected_result = regex.exec(subject, 0);
+        Vector<int> expected_slots;
+        for (unsigned slot = 0; slot < regex.total_groups() * 2; ++slot)
+            expected_slots.append(regex.capture_slot(slot));
+
+        // Keep going well past the point where the regex is compiled for the second tier.
+        for (int i = 0; i < 300; ++i) {
+            EXPECT_EQ(regex.exec(subject, 0), expected_result);
+            for (unsigned slot = 0; slot < expected_slots.size(); ++slot)
+                EXPECT_EQ(regex.capture_slot(slot), expected_slots[slot]);
+        }
+    }
+}
+
+TEST_CASE(catastrophic_backtracking_falls_back_to_linear_engine)
+{
+    // These exceed the VM's step limit, so they are rerun with the linear-time engine.
+    EXPECT(!matches("^(\\w+\\s?)*$"sv, "an apple a day keeps the doctor away!"sv));
+    EXPECT(!matches("^(\\d+)*$"sv, "1111111111111111111111111111111a"sv));
+
+    auto regex = compile_regex("^(?:(\\w+\\s?)*$|(.*)!)"sv);
+    auto subject = Utf16String::from_utf8("an apple a day keeps the doctor away!"sv);
+    EXPECT_EQ(regex.exec(subject, 0), regex::MatchResult::Match);
+    expect_capture_unmatched(regex, 1);
+    expect_capture_eq(regex, subject, 2, "an apple a day keeps the doctor away"sv);
+}
@@ -5,6 +5,7 @@
  */
 
 #include <AK/String.h>
+#include <AK/Utf16StringBuilder.h>
 #include <AK/Vector.h>
 #include <LibTest/TestCase.h>
 #include <LibTextCodec/Decoder.h>
@@ -256,3 +257,29 @@ TEST_CASE(test_utf16le_process_code_points)
     EXPECT_EQ(process_code_points(decoder, StringView(bytes({ 'A', 0x00, 0xff }))), (Vector<u32> { 0x41, 0xfffd }));
     EXPECT_EQ(MUST(decoder.to_utf8(StringView(bytes({ 'A', 0x00, 0xff })), TextCodec::IgnoreBOM::No, TextCodec::ErrorMode::Replacement)), "A\xef\xbf\xbd"sv);
 }
+
+TEST_CASE(test_to_utf16_matches_code_points)
+{
+    auto expect_to_utf16_matches_code_points = [](StringView encoding, StringView input) {
+        auto& decoder = TextCodec::decoder_for_exact_name(encoding).value();
+
+        Utf16StringBuilder builder;
+        for (auto code_point : process_code_points(decoder, input))
+            builder.append_code_point(code_point);
+        auto expected = builder.to_string();
+
+        EXPECT_EQ(MUST(decoder.to_utf16(input)), expected);
+        EXPECT_EQ(MUST(decoder.length_in_utf16_code_units(input)), expected.length_in_code_units());
+    };
+
+    expect_to_utf16_matches_code_points("UTF-8"sv, "plain ASCII text"sv);
+    expect_to_utf16_matches_code_points("UTF-8"sv, "s\xc3\xa4k\xf0\x9f\x98\x80"sv);
+    expect_to_utf16_matches_code_points("UTF-8"sv, StringView(bytes({ 'A', 0xed, 0xa0, 0x80, 'B', 0xf0, 0x9f })));
+    expect_to_utf16_matches_code_points("UTF-16LE"sv, StringView(bytes({ 0xff, 0xfe, 'A', 0x00, 0x3d, 0xd8, 0x00, 0xde })));
+    expect_to_utf16_matches_code_points("UTF-16BE"sv, StringView(bytes({ 0x00, 'A', 0xd8, 0x3d, 0xde, 0x00, 0xd8 })));
+    expect_to_utf16_matches_code_points("windows-1252"sv, "plain ASCII text"sv);
+    expect_to_utf16_matches_code_points("windows-1252"sv, StringView(bytes({ 'c', 'a', 'f', 0xe9, ' ', 0x80 })));
+    expect_to_utf16_matches_code_points("iso-8859-1"sv, StringView(bytes({ 'c', 'a', 'f', 0xe9 })));
+    expect_to_utf16_matches_code_points("Shift_JIS"sv, StringView(bytes({ 'A', 0x82, 0xa0, 0x82 })));
+    expect_to_utf16_matches_code_points("ISO-2022-JP"sv, StringView(bytes({ 0x1b, '$', 'B', 0x24, 0x22, 0x1b, '(', 'B', 'A' })));
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/Atomic.h>
+#include <LibTest/TestCase.h>
+#include <LibThreading/ThreadPool.h>
+
+TEST_CASE(parallel_for_runs_every_iteration_once)
+{
+    static constexpr size_t iteration_count = 1000;
+
+    Array<Atomic<u32>, iteration_count> runs;
+    for (auto& run_count : runs)
+        run_count.store(0);
+
+    Threading::ThreadPool::the().parallel_for(iteration_count, [&](size_t index) {
+        runs[index].fetch_add(1);
+    });
+
+    for (auto const& run_count : runs)
+        EXPECT_EQ(run_count.load(), 1u);
+}
+
+TEST_CASE(parallel_for_can_nest_inside_pool_work)
+{
+    auto& pool = Threading::ThreadPool::the();
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<size_t> total { 0 };
+
+    // Every outer iteration blocks on an inner loop, which must not deadlock even when all workers are busy.
+    pool.parallel_for(pool.thread_count() * 2, [&](size_t) {
+        pool.parallel_for(10, [&](size_t) {
+            total.fetch_add(1);
+        });
+    });
+
+    EXPECT_EQ(total.load(), pool.thread_count() * 2 * 10);
+}
+
+TEST_CASE(submit_and_wait_runs_all_work)
+{
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<u32> mask { 0 };
+
+    Vector<Function<void()>> work;
+    for (u32 i = 0; i < 8; ++i)
+        work.append([&mask, i] { mask.fetch_or(1u << i); });
+
+    Threading::ThreadPool::the().submit_and_wait(work, Threading::TaskPriority::Background);
+    EXPECT_EQ(mask.load(), 0xffu);
+}
+
+TEST_CASE(available_parallelism_is_at_least_one)
+{
+    EXPECT(Threading::ThreadPool::available_parallelism() >= 1);
+    EXPECT(Threading::ThreadPool::the().thread_count() >= 2);
+}
@@ -744,3 +744,36 @@ TEST_CASE(authority_state_lots_of_at_symbols)
     auto horror_url = MUST(String::formatted("ws::{}", many_at_symbols));
     EXPECT(!URL::Parser::basic_parse(horror_url).has_value());
 }
+
+TEST_CASE(serialization_follows_modifications)
+{
+    auto url = URL::Parser::basic_parse("https://example.com/a/b?q#f"sv).value();
+    EXPECT_EQ(url.serialize(), "https://example.com/a/b?q#f"sv);
+    EXPECT_EQ(url.serialize(URL::ExcludeFragment::Yes), "https://example.com/a/b?q"sv);
+
+    auto copy = url;
+    copy.set_query("other"_string);
+    copy.append_path("c"sv);
+    EXPECT_EQ(copy.serialize(), "https://example.com/a/b/c?other#f"sv);
+    EXPECT_EQ(url.serialize(), "https://example.com/a/b?q#f"sv);
+
+    url.set_fragment({});
+    EXPECT_EQ(url.serialize(), "https://example.com/a/b?q"sv);
+    EXPECT_EQ(url.serialize(URL::ExcludeFragment::Yes), "https://example.com/a/b?q"sv);
+
+    url.set_port(8080);
+    url.set_host(URL::Host("ladybird.org"_string));
+    EXPECT_EQ(url.serialize(), "https://ladybird.org:8080/a/b?q"sv);
+}
+
+TEST_CASE(non_ascii_input)
+{
+    auto url = URL::Parser::basic_parse("https://ex\xC3\xA4mple.com/p\xC3\xA4th?q\xC3\xA4#f\xC3\xA4"sv);
+    EXPECT(url.has_value());
+    EXPECT_EQ(url->serialize(), "https://xn--exmple-cua.com/p%C3%A4th?q%C3%A4#f%C3%A4"sv);
+
+    auto base_url = URL::Parser::basic_parse("http://example.com/a/b/c"sv).value();
+    auto relative_url = URL::Parser::basic_parse("../o\xC3\xA4?x y"sv, base_url);
+    EXPECT(relative_url.has_value());
+    EXPECT_EQ(relative_url->serialize(), "http://example.com/a/o%C3%A4?x%20y"sv);
+}
@@ -353,6 +353,58 @@ TEST_CASE(code_point_bidirectional_character_type)
     EXPECT_EQ(Unicode::bidirectional_class(0xFEB4), Unicode::BidiClass::RightToLeftArabic);
 }
 
+TEST_CASE(code_point_bidirectional_character_type_outside_latin1)
+{
+    // Hebrew right-to-left (U+05D0 HEBREW LETTER ALEF)
+    EXPECT_EQ(Unicode::bidirectional_class(0x05D0), Unicode::BidiClass::RightToLeft);
+    // Non-spacing mark (U+0301 COMBINING ACUTE ACCENT)
+    EXPECT_EQ(Unicode::bidirectional_class(0x0301), Unicode::BidiClass::DirNonSpacingMark);
+    // Latin-1 no-break space and soft hyphen
+    EXPECT_EQ(Unicode::bidirectional_class(0x00A0), Unicode::BidiClass::CommonNumberSeparator);
+    EXPECT_EQ(Unicode::bidirectional_class(0x00AD), Unicode::BidiClass::BoundaryNeutral);
+    // Explicit formatting characters
+    EXPECT_EQ(Unicode::bidirectional_class(0x2067), Unicode::BidiClass::RightToLeftIsolate);
+    EXPECT_EQ(Unicode::bidirectional_class(0x2069), Unicode::BidiClass::PopDirectionalIsolate);
+    // Supplementary planes (U+1E900 ADLAM CAPITAL LETTER ALIF, U+20000 CJK UNIFIED IDEOGRAPH-20000)
+    EXPECT_EQ(Unicode::bidirectional_class(0x1E900), Unicode::BidiClass::RightToLeft);
+    EXPECT_EQ(Unicode::bidirectional_class(0x20000), Unicode::BidiClass::LeftToRight);
+    // Noncharacters inside the Arabic presentation forms block are boundary neutral.
+    EXPECT_EQ(Unicode::bidirectional_class(0xFDD0), Unicode::BidiClass::BoundaryNeutral);
+}
+
+TEST_CASE(code_point_line_break_class)
+{
+    EXPECT_EQ(Unicode::line_break_class('a'), Unicode::LineBreakClass::Alphabetic);
+    EXPECT_EQ(Unicode::line_break_class('5'), Unicode::LineBreakClass::Numeric);
+    EXPECT_EQ(Unicode::line_break_class(' '), Unicode::LineBreakClass::Other);
+    EXPECT_EQ(Unicode::line_break_class(0x05D0), Unicode::LineBreakClass::Alphabetic);
+    EXPECT_EQ(Unicode::line_break_class(0x0301), Unicode::LineBreakClass::CombiningMark);
+    EXPECT_EQ(Unicode::line_break_class(0x0E01), Unicode::LineBreakClass::ComplexContext);
+    EXPECT_EQ(Unicode::line_break_class(0x4E00), Unicode::LineBreakClass::Ideographic);
+    EXPECT_EQ(Unicode::line_break_class(0xAC00), Unicode::LineBreakClass::Ideographic);
+    EXPECT_EQ(Unicode::line_break_class(0x00A7), Unicode::LineBreakClass::Ambiguous);
+    EXPECT_EQ(Unicode::line_break_class(0x20000), Unicode::LineBreakClass::Ideographic);
+}
+
+TEST_CASE(code_point_emoji_properties)
+{
+    EXPECT(Unicode::code_point_has_emoji_property('#'));
+    EXPECT(!Unicode::code_point_has_emoji_presentation_property('#'));
+    EXPECT(Unicode::code_point_has_emoji_property(0x00A9));
+    EXPECT(!Unicode::code_point_has_emoji_property('a'));
+    EXPECT(Unicode::code_point_has_emoji_property(0x1F600));
+    EXPECT(Unicode::code_point_has_emoji_presentation_property(0x1F600));
+    EXPECT(!Unicode::code_point_has_emoji_presentation_property(0x2764));
+
+    EXPECT(Unicode::code_point_has_default_ignorable_code_point_property(0x00AD));
+    EXPECT(Unicode::code_point_has_default_ignorable_code_point_property(0x200B));
+    EXPECT(Unicode::code_point_has_default_ignorable_code_point_property(0xE0001));
+    EXPECT(!Unicode::code_point_has_default_ignorable_code_point_property(' '));
+
+    EXPECT(!Unicode::code_point_has_emoji_property(0x110000));
+    EXPECT(!Unicode::code_point_has_default_ignorable_code_point_property(0x110000));
+}
+
 TEST_CASE(canonicalize)
 {
     constexpr u32 LATIN_CAPITAL_A_GRAVE = 0x00C0;   // À
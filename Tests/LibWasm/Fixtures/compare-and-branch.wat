@@ -0,0 +1,40 @@
+(module
+  ;; `local.get; local.get; i32.lt_s; br_if` to the loop header; a do-while loop.
+  (func (export "count_up") (param $n i32) (result i32) (local $i i32)
+    (loop
+      (local.set $i (i32.add (local.get $i) (i32.const 1)))
+      (br_if 0 (i32.lt_s (local.get $i) (local.get $n))))
+    (local.get $i))
+
+  ;; `i32.eqz; br_if` out of the loop.
+  (func (export "count_down") (param $n i32) (result i32) (local $count i32)
+    (block
+      (loop
+        (br_if 1 (i32.eqz (local.get $n)))
+        (local.set $n (i32.sub (local.get $n) (i32.const 1)))
+        (local.set $count (i32.add (local.get $count) (i32.const 1)))
+        (br 0)))
+    (local.get $count))
+
+  ;; The taken branch has to drop the value below its result.
+  (func (export "select_ge_u") (param i32 i32) (result i32)
+    (block (result i32)
+      (i32.const 1)
+      (i32.const 7)
+      (br_if 0 (i32.ge_u (local.get 0) (local.get 1)))
+      (drop)
+      (drop)
+      (i32.const 9)))
+
+  (func (export "less_signed") (param i32 i32) (result i32)
+    (block (result i32)
+      (i32.const 1)
+      (br_if 0 (i32.lt_s (local.get 0) (local.get 1)))
+      (drop)
+      (i32.const 0)))
+  (func (export "less_unsigned") (param i32 i32) (result i32)
+    (block (result i32)
+      (i32.const 1)
+      (br_if 0 (i32.lt_u (local.get 0) (local.get 1)))
+      (drop)
+      (i32.const 0))))
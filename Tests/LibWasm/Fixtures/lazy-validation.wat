@@ -0,0 +1,8 @@
+(module
+  ;; A module whose only problem is a function body, so it can be instantiated when validated lazily.
+  (func $add_one (export "add_one") (param $n i32) (result i32)
+    (i32.add (local.get $n) (i32.const 1)))
+
+  ;; Invalid: returns an i64 where an i32 is expected. wat2wasm rejects this, so the .wasm is encoded by hand.
+  (func $broken (export "broken") (result i32)
+    (i64.const 0)))
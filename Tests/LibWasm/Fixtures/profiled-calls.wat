@@ -0,0 +1,10 @@
+(module
+  ;; A busy loop, called through another function so the profile has a stack to show.
+  (func $spin (param $n i32) (result i32) (local $i i32)
+    (loop
+      (local.set $i (i32.add (local.get $i) (i32.const 1)))
+      (br_if 0 (i32.lt_s (local.get $i) (local.get $n))))
+    (local.get $i))
+
+  (func $run (export "run") (param $n i32) (result i32)
+    (call $spin (local.get $n))))
@@ -0,0 +1,28 @@
+(module
+  (tag $found (param i32))
+
+  ;; Far deeper than the call stack could go without tail calls.
+  (func $count (export "count") (param $n i32) (param $acc i32) (result i32)
+    (if (result i32) (i32.eqz (local.get $n))
+      (then (local.get $acc))
+      (else (return_call $count (i32.sub (local.get $n) (i32.const 1)) (i32.add (local.get $acc) (i32.const 1))))))
+
+  (func $is_even (export "is_even") (param $n i32) (result i32)
+    (if (result i32) (i32.eqz (local.get $n))
+      (then (i32.const 1))
+      (else (return_call $is_odd (i32.sub (local.get $n) (i32.const 1))))))
+  (func $is_odd (param $n i32) (result i32)
+    (if (result i32) (i32.eqz (local.get $n))
+      (then (i32.const 0))
+      (else (return_call $is_even (i32.sub (local.get $n) (i32.const 1))))))
+
+  (func $find (param $n i32)
+    (if (i32.gt_s (local.get $n) (i32.const 100))
+      (then (throw $found (local.get $n)))))
+
+  ;; The exception is thrown by the callee and caught with its payload.
+  (func (export "catch") (param $n i32) (result i32)
+    (block $caught (result i32)
+      (try_table (catch $found $caught)
+        (call $find (local.get $n)))
+      (i32.const -1))))
@@ -4,11 +4,15 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
+#include <AK/JsonArray.h>
 #include <AK/MemoryStream.h>
 #include <LibCore/File.h>
 #include <LibTest/TestCase.h>
 #include <LibWasm/AbstractMachine/AbstractMachine.h>
 #include <LibWasm/AbstractMachine/Configuration.h>
+#include <LibWasm/AbstractMachine/Profiler.h>
+#include <LibWasm/AbstractMachine/Validator.h>
 #include <LibWasm/Constants.h>
 
 TEST_CASE(compiled_to_interpreter_call_restores_label_stack)
@@ -100,3 +104,154 @@ TEST_CASE(compiled_memory_access_traps_out_of_bounds)
     expect_oob_trap(invoke(load_high, { Wasm::Value(static_cast<i32>(0)) }));
     expect_oob_trap(invoke(load_high, { Wasm::Value(static_cast<i32>(0xffffffff)) }));
 }
+
+static NonnullRefPtr<Wasm::Module> parse_fixture(StringView path)
+{
+    auto file = MUST(Core::File::open(path, Core::File::OpenMode::Read));
+    auto bytes = MUST(file->read_until_eof());
+    FixedMemoryStream stream { bytes.bytes() };
+    return MUST(Wasm::Module::parse(stream));
+}
+
+static Wasm::FunctionAddress find_function_export(Wasm::ModuleInstance const& instance, StringView name)
+{
+    for (auto const& export_ : instance.exports()) {
+        if (export_.name() == name)
+            return export_.value().get<Wasm::FunctionAddress>();
+    }
+    VERIFY_NOT_REACHED();
+}
+
+TEST_CASE(fused_compare_and_branch)
+{
+    auto module = parse_fixture("Fixtures/compare-and-branch.wasm"sv);
+    Wasm::AbstractMachine machine;
+    auto instance = MUST(machine.instantiate(*module, {}));
+
+    auto call = [&](StringView name, Vector<Wasm::Value> arguments) {
+        auto result = machine.invoke(find_function_export(*instance, name), move(arguments));
+        VERIFY(!result.is_trap());
+        return result.values()[0].to<i32>();
+    };
+    auto i32_value = [](i32 value) { return Wasm::Value(value); };
+
+    EXPECT_EQ(call("count_up"sv, { i32_value(10) }), 10);
+    EXPECT_EQ(call("count_up"sv, { i32_value(0) }), 1);
+    EXPECT_EQ(call("count_down"sv, { i32_value(5) }), 5);
+    EXPECT_EQ(call("count_down"sv, { i32_value(0) }), 0);
+
+    EXPECT_EQ(call("select_ge_u"sv, { i32_value(3), i32_value(2) }), 7);
+    EXPECT_EQ(call("select_ge_u"sv, { i32_value(2), i32_value(3) }), 9);
+    EXPECT_EQ(call("select_ge_u"sv, { i32_value(-1), i32_value(1) }), 7);
+
+    EXPECT_EQ(call("less_signed"sv, { i32_value(-1), i32_value(1) }), 1);
+    EXPECT_EQ(call("less_unsigned"sv, { i32_value(-1), i32_value(1) }), 0);
+}
+
+TEST_CASE(profiler_samples_wasm_frames)
+{
+    auto module = parse_fixture("Fixtures/profiled-calls.wasm"sv);
+    Wasm::AbstractMachine machine;
+    auto instance = MUST(machine.instantiate(*module, {}));
+    auto run = find_function_export(*instance, "run"sv);
+
+    auto& profiler = Wasm::Profiler::the();
+    MUST(profiler.start());
+    EXPECT(profiler.start().is_error());
+
+    // Keep running until the sampler has caught the loop a few times.
+    Vector<Wasm::FunctionProfile> profiles;
+    for (int i = 0; i < 1000; ++i) {
+        auto result = machine.invoke(run, { Wasm::Value(static_cast<i32>(1'000'000)) });
+        EXPECT(!result.is_trap());
+        profiles = profiler.function_profiles();
+        if (!profiles.is_empty() && profiles.first().self_samples >= 3)
+            break;
+    }
+    profiler.stop();
+
+    // The functions are named by the module's name section, and the loop is where the time goes.
+    VERIFY(profiles.size() >= 2);
+    EXPECT_EQ(profiles[0].name, "spin"sv);
+    EXPECT_EQ(profiles[0].function_index, 0u);
+    EXPECT_EQ(profiles[0].self_samples, profiles[0].interpreter_samples + profiles[0].cranelift_samples);
+
+    auto outer = profiles.first_matching([](auto const& profile) { return profile.name == "run"sv; });
+    VERIFY(outer.has_value());
+    EXPECT(outer->total_samples >= profiles[0].total_samples);
+
+    auto gecko_profile = profiler.to_gecko_profile();
+    auto threads = gecko_profile.get_array("threads"sv);
+    VERIFY(threads.has_value());
+    EXPECT(!threads->is_empty());
+    auto strings = threads->at(0).as_object().get_array("stringTable"sv);
+    VERIFY(strings.has_value());
+    EXPECT(any_of(strings->values(), [](auto const& string) { return string.is_string() && string.as_string() == "spin"sv; }));
+}
+
+TEST_CASE(lazily_validated_function_traps_when_called)
+{
+    auto module = parse_fixture("Fixtures/lazy-validation.wasm"sv);
+    Wasm::AbstractMachine machine;
+    MUST(machine.validate(*module, {}, Wasm::CompileToNative::No, Wasm::ValidationMode::Lazy));
+    auto instance = MUST(machine.instantiate(*module, {}));
+
+    auto result = machine.invoke(find_function_export(*instance, "add_one"sv), { Wasm::Value(static_cast<i32>(41)) });
+    VERIFY(!result.is_trap());
+    EXPECT_EQ(result.values()[0].to<i32>(), 42);
+
+    // The invalid body is only noticed once it's called, which then makes the whole module invalid.
+    EXPECT(machine.invoke(find_function_export(*instance, "broken"sv), {}).is_trap());
+    EXPECT(machine.validate(*module).is_error());
+}
+
+TEST_CASE(background_validation_finds_invalid_function)
+{
+    auto module = parse_fixture("Fixtures/lazy-validation.wasm"sv);
+    Wasm::AbstractMachine machine;
+    MUST(machine.validate(*module, {}, Wasm::CompileToNative::No, Wasm::ValidationMode::Lazy));
+
+    auto* lazy_function_validation = module->lazy_function_validation();
+    VERIFY(lazy_function_validation);
+    EXPECT(lazy_function_validation->validate_all_functions(*module).is_error());
+    EXPECT(lazy_function_validation->error().has_value());
+
+    // Eager validation rejects the module outright.
+    auto eagerly_validated_module = parse_fixture("Fixtures/lazy-validation.wasm"sv);
+    EXPECT(machine.validate(*eagerly_validated_module).is_error());
+}
+
+TEST_CASE(tail_calls_and_exceptions)
+{
+    auto module = parse_fixture("Fixtures/tail-calls-and-exceptions.wasm"sv);
+    Wasm::AbstractMachine machine;
+    auto instance = MUST(machine.instantiate(*module, {}));
+
+    auto call = [&](StringView name, Vector<Wasm::Value> arguments) {
+        auto result = machine.invoke(find_function_export(*instance, name), move(arguments));
+        VERIFY(!result.is_trap());
+        return result.values()[0].to<i32>();
+    };
+    auto i32_value = [](i32 value) { return Wasm::Value(value); };
+
+    // Run often enough for the functions to reach native code, which has to behave the same.
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(call("count"sv, { i32_value(1'000'000), i32_value(0) }), 1'000'000);
+        EXPECT_EQ(call("is_even"sv, { i32_value(100'001) }), 0);
+        EXPECT_EQ(call("is_even"sv, { i32_value(100'000) }), 1);
+        EXPECT_EQ(call("catch"sv, { i32_value(5) }), -1);
+        EXPECT_EQ(call("catch"sv, { i32_value(500) }), 500);
+    }
+}
+
+// Runs the hot loop of a freshly parsed module, before native code for it can possibly be ready.
+BENCHMARK_CASE(interpreted_loop_on_startup)
+{
+    for (int i = 0; i < 100; ++i) {
+        auto module = parse_fixture("Fixtures/compare-and-branch.wasm"sv);
+        Wasm::AbstractMachine machine;
+        auto instance = MUST(machine.instantiate(*module, {}));
+        auto result = machine.invoke(find_function_export(*instance, "count_up"sv), { Wasm::Value(static_cast<i32>(100'000)) });
+        EXPECT_EQ(result.values()[0].to<i32>(), 100'000);
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/MemoryStream.h>
+#include <LibCore/File.h>
+#include <LibTest/TestCase.h>
+#include <LibWasm/AbstractMachine/AbstractMachine.h>
+
+static ByteBuffer read_fixture(StringView path)
+{
+    auto file = MUST(Core::File::open(path, Core::File::OpenMode::Read));
+    return MUST(file->read_until_eof());
+}
+
+static Wasm::ParseResult<NonnullRefPtr<Wasm::Module>> parse_in_chunks(ReadonlyBytes bytes, size_t chunk_size)
+{
+    auto parser = Wasm::StreamingModuleParser::create();
+    for (size_t offset = 0; offset < bytes.size(); offset += chunk_size)
+        TRY(parser->append(bytes.slice(offset, min(chunk_size, bytes.size() - offset))));
+    return parser->finish();
+}
+
+TEST_CASE(streamed_module_matches_buffered_module)
+{
+    auto bytes = read_fixture("Fixtures/memory-guard-trap.wasm"sv);
+    FixedMemoryStream stream { bytes.bytes() };
+    auto expected = MUST(Wasm::Module::parse(stream));
+
+    for (size_t chunk_size : { 1uz, 3uz, 16uz, bytes.size() }) {
+        auto module = MUST(parse_in_chunks(bytes.bytes(), chunk_size));
+        EXPECT_EQ(module->type_section().types().size(), expected->type_section().types().size());
+        EXPECT_EQ(module->function_section().types().size(), expected->function_section().types().size());
+        EXPECT_EQ(module->export_section().entries().size(), expected->export_section().entries().size());
+        EXPECT_EQ(module->code_section().functions().size(), expected->code_section().functions().size());
+        for (size_t i = 0; i < module->code_section().functions().size(); ++i)
+            EXPECT_EQ(module->code_section().functions()[i].size(), expected->code_section().functions()[i].size());
+    }
+}
+
+TEST_CASE(streamed_module_can_be_instantiated)
+{
+    auto bytes = read_fixture("Fixtures/memory-guard-trap.wasm"sv);
+    auto module = MUST(parse_in_chunks(bytes.bytes(), 7));
+
+    Wasm::AbstractMachine machine;
+    auto instance = MUST(machine.instantiate(*module, {}));
+
+    Optional<Wasm::FunctionAddress> load;
+    for (auto const& export_ : instance->exports()) {
+        if (export_.name() == "load"sv)
+            load = export_.value().get<Wasm::FunctionAddress>();
+    }
+    VERIFY(load.has_value());
+
+    auto result = machine.invoke(*load, { Wasm::Value(static_cast<i32>(0)) });
+    EXPECT(!result.is_trap());
+}
+
+TEST_CASE(truncated_module_fails_to_parse)
+{
+    auto bytes = read_fixture("Fixtures/memory-guard-trap.wasm"sv);
+    for (size_t length : { 3uz, 8uz, bytes.size() / 2, bytes.size() - 1 }) {
+        auto result = parse_in_chunks(bytes.bytes().trim(length), 5);
+        EXPECT(result.is_error());
+    }
+}
+
+TEST_CASE(invalid_magic_is_reported_early)
+{
+    auto parser = Wasm::StreamingModuleParser::create();
+    Array<u8, 4> bytes { 0, 'w', 'a', 't' };
+    auto result = parser->append(bytes.span());
+    EXPECT(result.is_error());
+    EXPECT(result.error() == Wasm::ParseError::InvalidModuleMagic);
+
+    // The error sticks.
+    EXPECT(parser->append(Wasm::Module::wasm_version.span()).is_error());
+    EXPECT(parser->finish().is_error());
+}
@@ -293,4 +293,50 @@ TEST_CASE(cosmetic_rule_detection)
     EXPECT(blocker_with_cosmetics.has_cosmetic_rules());
 }
 
+TEST_CASE(snapshot_round_trip)
+{
+    auto rules = "||ads.example.com^\n##.ad-banner, .sponsored\n"sv;
+    auto snapshot = MUST(ContentBlocker::create_snapshot(rules.bytes()));
+    EXPECT(ContentBlocker::is_compatible_snapshot(snapshot));
+    EXPECT(!ContentBlocker::is_compatible_snapshot(rules.bytes()));
+
+    auto& blocker = make_blocker({});
+    MUST(blocker.set_rules_from_bytes(snapshot));
+    EXPECT(blocker.has_cosmetic_rules());
+
+    auto source_url = url("https://example.com/"sv);
+    EXPECT(blocker.is_filtered(url("https://ads.example.com/script.js"sv), source_url, ContentBlocker::ResourceType::Script));
+    EXPECT(!blocker.is_filtered(url("https://example.com/script.js"sv), source_url, ContentBlocker::ResourceType::Script));
+
+    Vector<Utf16FlyString> classes = { "sponsored"_utf16_fly_string };
+    auto style_sheet = blocker.cosmetic_style_sheet_for_url(source_url, classes, {});
+    EXPECT(style_sheet.contains(".ad-banner, .sponsored { display: none !important; }"sv));
+}
+
+TEST_CASE(truncated_snapshot_keeps_previous_rules)
+{
+    auto snapshot = MUST(ContentBlocker::create_snapshot("||tracker.example.com^\n"sv.bytes()));
+
+    auto& blocker = make_blocker({ "||ads.example.com^"_string });
+    EXPECT(blocker.set_rules_from_bytes(snapshot.bytes().trim(snapshot.size() - 1)).is_error());
+
+    auto source_url = url("https://example.com/"sv);
+    EXPECT(blocker.is_filtered(url("https://ads.example.com/script.js"sv), source_url, ContentBlocker::ResourceType::Script));
+}
+
+TEST_CASE(cached_decisions_are_dropped_with_rules)
+{
+    auto& blocker = make_blocker({ "||ads.example.com^$script"_string });
+    auto ad_url = url("https://ads.example.com/ad.js"sv);
+
+    // A cached decision for one resource type must not be reused for another, nor for another site.
+    EXPECT(blocker.is_filtered(ad_url, url("https://example.com/"sv), ContentBlocker::ResourceType::Script));
+    EXPECT(!blocker.is_filtered(ad_url, url("https://example.com/"sv), ContentBlocker::ResourceType::Image));
+    EXPECT(blocker.is_filtered(ad_url, url("https://example.com/other-page"sv), ContentBlocker::ResourceType::Script));
+
+    make_blocker({ "||ads.example.com^$script,domain=example.org"_string });
+    EXPECT(!blocker.is_filtered(ad_url, url("https://example.com/"sv), ContentBlocker::ResourceType::Script));
+    EXPECT(blocker.is_filtered(ad_url, url("https://example.org/"sv), ContentBlocker::ResourceType::Script));
+}
+
 }
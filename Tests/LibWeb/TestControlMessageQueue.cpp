@@ -10,27 +10,27 @@
 
 TEST_CASE(drain_returns_all_and_clears)
 {
-    Web::WebAudio::ControlMessageQueue queue;
+    auto queue = Web::WebAudio::ControlMessageQueue::create();
 
-    queue.enqueue(Web::WebAudio::StartSource { .node_id = Web::WebAudio::NodeID { 0 }, .when = 1.0 });
-    queue.enqueue(Web::WebAudio::StopSource { .node_id = Web::WebAudio::NodeID { 1 }, .when = 2.0 });
+    queue->enqueue(Web::WebAudio::StartSource { .node_id = Web::WebAudio::NodeID { 0 }, .when = 1.0 });
+    queue->enqueue(Web::WebAudio::StopSource { .node_id = Web::WebAudio::NodeID { 1 }, .when = 2.0 });
 
-    auto batch = queue.drain();
+    auto batch = queue->drain();
     EXPECT_EQ(batch.size(), 2u);
 
-    auto empty = queue.drain();
+    auto empty = queue->drain();
     EXPECT_EQ(empty.size(), 0u);
 }
 
 TEST_CASE(drain_preserves_first_in_first_out)
 {
-    Web::WebAudio::ControlMessageQueue queue;
+    auto queue = Web::WebAudio::ControlMessageQueue::create();
 
-    queue.enqueue(Web::WebAudio::StartSource { .node_id = Web::WebAudio::NodeID { 0 }, .when = 1.0 });
-    queue.enqueue(Web::WebAudio::StopSource { .node_id = Web::WebAudio::NodeID { 1 }, .when = 2.0 });
-    queue.enqueue(Web::WebAudio::StartSource { .node_id = Web::WebAudio::NodeID { 2 }, .when = 3.0 });
+    queue->enqueue(Web::WebAudio::StartSource { .node_id = Web::WebAudio::NodeID { 0 }, .when = 1.0 });
+    queue->enqueue(Web::WebAudio::StopSource { .node_id = Web::WebAudio::NodeID { 1 }, .when = 2.0 });
+    queue->enqueue(Web::WebAudio::StartSource { .node_id = Web::WebAudio::NodeID { 2 }, .when = 3.0 });
 
-    auto batch = queue.drain();
+    auto batch = queue->drain();
     EXPECT_EQ(batch.size(), 3u);
 
     EXPECT(batch[0].has<Web::WebAudio::StartSource>());
@@ -45,3 +45,27 @@ TEST_CASE(drain_preserves_first_in_first_out)
     EXPECT_EQ(batch[2].get<Web::WebAudio::StartSource>().when, 3.0);
     EXPECT_EQ(batch[2].get<Web::WebAudio::StartSource>().node_id, Web::WebAudio::NodeID { 2 });
 }
+
+TEST_CASE(drain_with_callback_visits_in_order)
+{
+    auto queue = Web::WebAudio::ControlMessageQueue::create();
+
+    queue->enqueue(Web::WebAudio::StartSource { .node_id = Web::WebAudio::NodeID { 0 }, .when = 1.0 });
+    queue->enqueue(Web::WebAudio::DestroyRenderNode { .node_id = Web::WebAudio::NodeID { 1 } });
+    queue->enqueue(Web::WebAudio::StopSource { .node_id = Web::WebAudio::NodeID { 2 }, .when = 3.0 });
+
+    Vector<Web::WebAudio::NodeID> visited;
+    queue->drain([&](Web::WebAudio::ControlMessage& message) {
+        message.visit([&](auto const& payload) {
+            if constexpr (requires { payload.node_id; })
+                visited.append(payload.node_id);
+        });
+    });
+
+    EXPECT_EQ(visited.size(), 3u);
+    EXPECT_EQ(visited[0], Web::WebAudio::NodeID { 0 });
+    EXPECT_EQ(visited[1], Web::WebAudio::NodeID { 1 });
+    EXPECT_EQ(visited[2], Web::WebAudio::NodeID { 2 });
+
+    EXPECT_EQ(queue->drain().size(), 0u);
+}
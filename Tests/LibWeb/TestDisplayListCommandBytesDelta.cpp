@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteBuffer.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/Painting/DisplayListCommandBytesDelta.h>
+
+using namespace Web::Painting;
+
+static ByteBuffer bytes_with_pattern(size_t size, u8 seed)
+{
+    auto bytes = MUST(ByteBuffer::create_uninitialized(size));
+    for (size_t i = 0; i < size; ++i)
+        bytes[i] = static_cast<u8>(seed + i * 7);
+    return bytes;
+}
+
+static ByteBuffer round_trip(ReadonlyBytes base, ReadonlyBytes target, DisplayListCommandBytesDelta& delta)
+{
+    delta = DisplayListCommandBytesDelta::compute(1, base, target);
+    return MUST(delta.apply_to(1, base));
+}
+
+TEST_CASE(identical_command_bytes_send_nothing)
+{
+    auto base = bytes_with_pattern(10000, 1);
+    DisplayListCommandBytesDelta delta;
+    auto result = round_trip(base, base, delta);
+    EXPECT(delta.changed_bytes.is_empty());
+    EXPECT_EQ(delta.unchanged_prefix_size, 10000u);
+    EXPECT_EQ(result.span(), base.span());
+}
+
+TEST_CASE(change_in_the_middle_sends_only_the_changed_bytes)
+{
+    auto base = bytes_with_pattern(20000, 1);
+    auto target = MUST(ByteBuffer::copy(base));
+    target[9000] ^= 0xff;
+    target[9001] ^= 0xff;
+
+    DisplayListCommandBytesDelta delta;
+    auto result = round_trip(base, target, delta);
+    EXPECT_EQ(delta.unchanged_prefix_size, 9000u);
+    EXPECT_EQ(delta.unchanged_suffix_size, 20000u - 9002u);
+    EXPECT_EQ(delta.changed_bytes.size(), 2u);
+    EXPECT_EQ(result.span(), target.span());
+}
+
+TEST_CASE(inserted_and_removed_bytes)
+{
+    auto base = bytes_with_pattern(8192, 3);
+
+    ByteBuffer inserted;
+    inserted.append(base.span().trim(5000));
+    inserted.append(bytes_with_pattern(100, 200).span());
+    inserted.append(base.span().slice(5000));
+    DisplayListCommandBytesDelta delta;
+    EXPECT_EQ(round_trip(base, inserted, delta).span(), inserted.span());
+    EXPECT(delta.changed_bytes.size() <= 100u);
+
+    auto removed = MUST(ByteBuffer::copy(base.span().trim(4096)));
+    EXPECT_EQ(round_trip(base, removed, delta).span(), removed.span());
+    EXPECT(delta.changed_bytes.is_empty());
+
+    auto empty = ByteBuffer {};
+    EXPECT_EQ(round_trip(base, empty, delta).size(), 0u);
+    EXPECT_EQ(round_trip(empty, base, delta).span(), base.span());
+}
+
+TEST_CASE(repeated_bytes_do_not_overlap_prefix_and_suffix)
+{
+    auto base = MUST(ByteBuffer::create_zeroed(5000));
+    auto target = MUST(ByteBuffer::create_zeroed(6000));
+
+    DisplayListCommandBytesDelta delta;
+    EXPECT_EQ(round_trip(base, target, delta).span(), target.span());
+    EXPECT_EQ(delta.unchanged_prefix_size + delta.unchanged_suffix_size + delta.changed_bytes.size(), 6000u);
+}
+
+TEST_CASE(delta_only_applies_to_its_base)
+{
+    auto base = bytes_with_pattern(100, 1);
+    auto delta = DisplayListCommandBytesDelta::compute(1, base, base);
+    EXPECT(delta.apply_to(2, base).is_error());
+    EXPECT(delta.apply_to(1, base.span().trim(50)).is_error());
+}
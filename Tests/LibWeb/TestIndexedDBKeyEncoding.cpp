@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <AK/Utf16String.h>
+#include <LibGC/HeapVector.h>
+#include <LibGC/Root.h>
+#include <LibJS/Runtime/Realm.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/IndexedDB/Internal/Key.h>
+
+using Web::IndexedDB::Key;
+
+namespace {
+
+struct TestVM {
+    TestVM()
+        : vm(JS::VM::create())
+        , execution_context(MUST(JS::Realm::initialize_host_defined_realm(*vm, nullptr, nullptr)))
+    {
+    }
+
+    ~TestVM()
+    {
+        vm->pop_execution_context();
+    }
+
+    JS::Realm& realm() { return *vm->current_realm(); }
+
+    NonnullRefPtr<JS::VM> vm;
+    NonnullOwnPtr<JS::ExecutionContext> execution_context;
+};
+
+GC::Ref<Key> array_key(JS::Realm& realm, Vector<GC::Ref<Key>> const& subkeys)
+{
+    auto elements = realm.heap().allocate<GC::HeapVector<GC::Ref<Key>>>();
+    elements->elements().extend(subkeys);
+    return Key::create_array(realm, GC::make_root(elements));
+}
+
+GC::Ref<Key> binary_key(JS::Realm& realm, Vector<u8> const& bytes)
+{
+    return Key::create_binary(realm, MUST(ByteBuffer::copy(bytes.span())));
+}
+
+// Keys in ascending order, as compare-two-keys orders them.
+Vector<GC::Root<Key>> ordered_keys(JS::Realm& realm)
+{
+    Vector<GC::Ref<Key>> keys;
+    keys.append(Key::create_number(realm, -AK::Infinity<double>));
+    keys.append(Key::create_number(realm, -1e300));
+    keys.append(Key::create_number(realm, -1));
+    keys.append(Key::create_number(realm, -5e-324));
+    keys.append(Key::create_number(realm, 0));
+    keys.append(Key::create_number(realm, 5e-324));
+    keys.append(Key::create_number(realm, 1));
+    keys.append(Key::create_number(realm, 1.5));
+    keys.append(Key::create_number(realm, 1e300));
+    keys.append(Key::create_number(realm, AK::Infinity<double>));
+    keys.append(Key::create_date(realm, -1));
+    keys.append(Key::create_date(realm, 0));
+    keys.append(Key::create_date(realm, 1700000000000));
+    keys.append(Key::create_string(realm, ""_utf16));
+    keys.append(Key::create_string(realm, Utf16String::from_code_point(0)));
+    keys.append(Key::create_string(realm, "\0a"_utf16));
+    keys.append(Key::create_string(realm, "a"_utf16));
+    keys.append(Key::create_string(realm, "a\0"_utf16));
+    keys.append(Key::create_string(realm, "aa"_utf16));
+    keys.append(Key::create_string(realm, "b"_utf16));
+    keys.append(Key::create_string(realm, Utf16String::from_code_point(0x100)));
+    keys.append(Key::create_string(realm, Utf16String::from_code_point(0xffff)));
+    keys.append(binary_key(realm, {}));
+    keys.append(binary_key(realm, { 0 }));
+    keys.append(binary_key(realm, { 0, 0 }));
+    keys.append(binary_key(realm, { 0, 1 }));
+    keys.append(binary_key(realm, { 1 }));
+    keys.append(binary_key(realm, { 0xff }));
+    keys.append(binary_key(realm, { 0xff, 0 }));
+    keys.append(array_key(realm, {}));
+    keys.append(array_key(realm, { Key::create_number(realm, 1) }));
+    keys.append(array_key(realm, { Key::create_number(realm, 1), Key::create_number(realm, 1) }));
+    keys.append(array_key(realm, { Key::create_number(realm, 2) }));
+    keys.append(array_key(realm, { Key::create_string(realm, ""_utf16) }));
+    keys.append(array_key(realm, { Key::create_string(realm, ""_utf16), Key::create_number(realm, 1) }));
+    keys.append(array_key(realm, { Key::create_string(realm, "a"_utf16) }));
+    keys.append(array_key(realm, { array_key(realm, {}) }));
+    keys.append(array_key(realm, { array_key(realm, {}), array_key(realm, {}) }));
+    keys.append(array_key(realm, { array_key(realm, { Key::create_number(realm, 0) }) }));
+
+    Vector<GC::Root<Key>> roots;
+    for (auto key : keys)
+        roots.append(GC::make_root(key));
+    return roots;
+}
+
+}
+
+TEST_CASE(storage_encoding_sorts_like_keys)
+{
+    TestVM test_vm;
+    auto keys = ordered_keys(test_vm.realm());
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+        auto encoding_i = keys[i]->encode_for_storage();
+        for (size_t j = 0; j < keys.size(); ++j) {
+            auto encoding_j = keys[j]->encode_for_storage();
+            auto expected = Key::compare_two_keys(*keys[i], *keys[j]);
+            EXPECT_EQ(expected, i < j ? -1 : (i > j ? 1 : 0));
+
+            auto common_length = min(encoding_i.size(), encoding_j.size());
+            auto result = __builtin_memcmp(encoding_i.data(), encoding_j.data(), common_length);
+            if (result == 0)
+                result = encoding_i.size() < encoding_j.size() ? -1 : (encoding_i.size() > encoding_j.size() ? 1 : 0);
+            EXPECT_EQ(result < 0 ? -1 : (result > 0 ? 1 : 0), expected);
+        }
+    }
+}
+
+TEST_CASE(storage_encoding_round_trips)
+{
+    TestVM test_vm;
+    auto& realm = test_vm.realm();
+
+    for (auto const& key : ordered_keys(realm)) {
+        auto encoding = key->encode_for_storage();
+        auto decoded = MUST(Key::decode_from_storage(realm, encoding));
+        EXPECT_EQ(decoded->type(), key->type());
+        EXPECT(Key::equals(decoded, *key));
+        EXPECT_EQ(decoded->encode_for_storage().bytes(), encoding.bytes());
+    }
+}
+
+TEST_CASE(storage_encoding_gives_both_zeros_the_same_encoding)
+{
+    TestVM test_vm;
+    auto& realm = test_vm.realm();
+
+    EXPECT_EQ(Key::create_number(realm, -0.0)->encode_for_storage().bytes(), Key::create_number(realm, 0.0)->encode_for_storage().bytes());
+}
+
+TEST_CASE(storage_decoding_rejects_malformed_keys)
+{
+    TestVM test_vm;
+    auto& realm = test_vm.realm();
+
+    auto decode = [&](Vector<u8> const& bytes) { return Key::decode_from_storage(realm, bytes); };
+
+    EXPECT(decode({}).is_error());
+    EXPECT(decode({ 0x99 }).is_error());
+    EXPECT(decode({ 0x00 }).is_error());
+    EXPECT(decode({ 0x10, 0x80, 0x00 }).is_error());
+    EXPECT(decode({ 0x30, 0x61 }).is_error());
+    EXPECT(decode({ 0x30, 0x00, 0x61, 0x00 }).is_error());
+    EXPECT(decode({ 0x50, 0x40, 0x00 }).is_error());
+    EXPECT(decode({ 0x40, 0x00, 0x40, 0x00 }).is_error());
+}
@@ -7,6 +7,9 @@
 #include "StructuredSerializeTestHelpers.h"
 #include <AK/NumericLimits.h>
 #include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/ArrayBuffer.h>
+#include <LibJS/Runtime/Intrinsics.h>
+#include <LibJS/Runtime/PrimitiveString.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibWeb/Bindings/Serializable.h>
 #include <LibWeb/Crypto/CryptoKeySerializationTags.h>
@@ -460,6 +463,94 @@ TEST_CASE(ipc_serializable_object_has_no_version_framing)
     EXPECT_EQ(MUST(reader.decode<double>()), 4.0);
 }
 
+TEST_CASE(ipc_writer_writes_each_property_name_once)
+{
+    auto writer = Web::HTML::StructuredSerializeWriter::create_ipc();
+    writer.encode_property_key("name"_utf16);
+    writer.encode_property_key("id"_utf16);
+    writer.encode_property_key("name"_utf16);
+
+    auto record = writer.take_ipc_record();
+    Web::HTML::StructuredSerializeReader reader { record };
+    EXPECT_EQ(MUST(reader.decode<u32>()), 0u);
+    expect_utf16_equals(MUST(reader.decode<Utf16String>()), "name"_utf16);
+    EXPECT_EQ(MUST(reader.decode<u32>()), 0u);
+    expect_utf16_equals(MUST(reader.decode<Utf16String>()), "id"_utf16);
+    EXPECT_EQ(MUST(reader.decode<u32>()), 1u);
+
+    Web::HTML::StructuredSerializeReader key_reader { record };
+    expect_utf16_equals(MUST(key_reader.decode_property_key()), "name"_utf16);
+    expect_utf16_equals(MUST(key_reader.decode_property_key()), "id"_utf16);
+    expect_utf16_equals(MUST(key_reader.decode_property_key()), "name"_utf16);
+}
+
+TEST_CASE(ipc_reader_rejects_property_names_that_were_not_introduced)
+{
+    auto writer = Web::HTML::StructuredSerializeWriter::create_ipc();
+    writer.encode(1u);
+
+    auto record = writer.take_ipc_record();
+    Web::HTML::StructuredSerializeReader reader { record };
+    EXPECT(reader.decode_property_key().is_error());
+}
+
+TEST_CASE(objects_sharing_property_names_round_trip_through_ipc)
+{
+    auto& realm = test_realm();
+
+    auto array = MUST(JS::Array::create(realm, 0));
+    for (i32 i = 0; i < 3; ++i) {
+        auto object = JS::Object::create(realm, realm.intrinsics().object_prototype());
+        MUST(object->create_data_property("id"_utf16_fly_string, JS::Value(i)));
+        MUST(object->create_data_property("label"_utf16_fly_string, JS::PrimitiveString::create(realm.vm(), "item"_utf16)));
+        MUST(array->create_data_property_or_throw(static_cast<u32>(i), object));
+    }
+
+    auto record = MUST(Web::HTML::structured_serialize(realm.vm(), array));
+    auto decoded = MUST(Web::HTML::structured_deserialize(realm.vm(), record, realm));
+    EXPECT(decoded.is_object());
+    auto& decoded_array = as<JS::Array>(decoded.as_object());
+
+    for (i32 i = 0; i < 3; ++i) {
+        auto element = MUST(decoded_array.get(static_cast<u32>(i)));
+        EXPECT(element.is_object());
+        EXPECT_EQ(MUST(element.as_object().get("id"_utf16_fly_string)).as_double(), static_cast<double>(i));
+        auto label = MUST(element.as_object().get("label"_utf16_fly_string));
+        EXPECT(label.is_string());
+        expect_utf16_equals(label.as_string().utf16_string(), "item"_utf16);
+    }
+}
+
+static void expect_array_buffer_transfer_round_trips(size_t byte_length)
+{
+    auto& realm = test_realm();
+
+    auto expected = MUST(ByteBuffer::create_uninitialized(byte_length));
+    for (size_t i = 0; i < byte_length; ++i)
+        expected[i] = static_cast<u8>(i * 7);
+    auto array_buffer = JS::ArrayBuffer::create(realm, expected);
+
+    GC::Ref<JS::Object> transferable = array_buffer;
+    auto record = MUST(Web::HTML::structured_serialize_with_transfer(realm.vm(), array_buffer, { &transferable, 1 }));
+    EXPECT(array_buffer->is_detached());
+
+    auto deserialized = MUST(Web::HTML::structured_deserialize_with_transfer(record, realm));
+    EXPECT(deserialized.deserialized.is_object());
+    auto& received = as<JS::ArrayBuffer>(deserialized.deserialized.as_object());
+    EXPECT_EQ(received.byte_length(), byte_length);
+
+    EXPECT_EQ(MUST(received.copy_to_byte_buffer()).bytes(), expected.bytes());
+}
+
+TEST_CASE(transferred_array_buffers_keep_their_contents)
+{
+    expect_array_buffer_transfer_round_trips(0);
+    expect_array_buffer_transfer_round_trips(100);
+
+    // Large enough to be handed over through shared memory.
+    expect_array_buffer_transfer_round_trips(1 * MiB + 3);
+}
+
 TEST_CASE(realm_helpers_share_vm_initialization)
 {
     auto& vm = test_realm().vm();
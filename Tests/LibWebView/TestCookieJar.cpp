@@ -94,3 +94,30 @@ TEST_CASE(newer_cookie_schema_reports_database_too_new)
     EXPECT_EQ(TRY_OR_FAIL(WebView::CookieJar::migrate_schema(*database)), Database::MigrationOutcome::DatabaseTooNew);
     EXPECT_EQ(TRY_OR_FAIL(WebView::CookieJar::migrate_schema(*database, Database::MigrationMode::CheckOnly)), Database::MigrationOutcome::DatabaseTooNew);
 }
+
+TEST_CASE(cookies_are_matched_against_the_host_and_its_parent_domains)
+{
+    auto jar = WebView::CookieJar::create();
+
+    auto set_cookie = [&](StringView url, String name, Optional<String> domain) {
+        HTTP::Cookie::ParsedCookie cookie {
+            .name = move(name),
+            .value = "value"_string,
+            .domain = move(domain),
+        };
+        jar->set_cookie(parse_url(url), cookie, HTTP::Cookie::Source::Http);
+    };
+
+    set_cookie("https://example.com/"sv, "parent"_string, "example.com"_string);
+    set_cookie("https://example.com/"sv, "host-only"_string, {});
+    set_cookie("https://www.example.com/dir/page"sv, "sibling"_string, {});
+    set_cookie("https://notexample.com/"sv, "lookalike"_string, "notexample.com"_string);
+
+    EXPECT_EQ(jar->get_cookie(parse_url("https://a.b.example.com/"sv), HTTP::Cookie::Source::Http), "parent=value"_string);
+    EXPECT_EQ(jar->get_cookie(parse_url("https://www.example.com/dir/"sv), HTTP::Cookie::Source::Http), "sibling=value; parent=value"_string);
+    EXPECT_EQ(jar->get_cookie(parse_url("https://notexample.com/"sv), HTTP::Cookie::Source::Http), "lookalike=value"_string);
+
+    EXPECT(jar->delete_cookie({ "parent"_string, "example.com"_string, "/"_string }));
+    EXPECT_EQ(jar->get_cookie(parse_url("https://www.example.com/dir/"sv), HTTP::Cookie::Source::Http), "sibling=value"_string);
+    EXPECT_EQ(jar->get_cookie(parse_url("https://example.com/"sv), HTTP::Cookie::Source::Http), "host-only=value"_string);
+}
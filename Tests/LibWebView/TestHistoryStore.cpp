@@ -843,3 +843,58 @@ TEST_CASE(history_ranking_signal_migration_preserves_existing_entries)
     EXPECT_EQ(entry->score_updated_at, UnixDateTime::from_seconds_since_epoch(123));
     EXPECT_APPROXIMATE(entry->decayed_visit_score, 8.0);
 }
+
+TEST_CASE(history_search_index_migration_indexes_existing_entries)
+{
+    auto database = TRY_OR_FAIL(Database::Database::create_memory_backed());
+    TRY_OR_FAIL(database->execute_raw(R"#(
+        CREATE TABLE SchemaVersions (store TEXT PRIMARY KEY, version INTEGER NOT NULL);
+        INSERT INTO SchemaVersions (store, version) VALUES ('History', 1);
+        CREATE TABLE History (
+            url TEXT PRIMARY KEY,
+            title TEXT NOT NULL,
+            favicon TEXT,
+            visit_count INTEGER NOT NULL,
+            last_visited_time INTEGER NOT NULL
+        );
+        INSERT INTO History (url, title, visit_count, last_visited_time)
+        VALUES ('https://www.example.com/articles/indexing', 'Trigram Search', 3, 123000);
+    )#"sv));
+
+    EXPECT_EQ(TRY_OR_FAIL(WebView::HistoryStore::migrate_schema(*database)), Database::MigrationOutcome::Success);
+    auto store = TRY_OR_FAIL(WebView::HistoryStore::create(*database));
+
+    auto prefix_entries = store->autocomplete_entries("ex"sv, 8);
+    VERIFY(prefix_entries.size() == 1);
+    EXPECT_EQ(prefix_entries[0].url, "https://www.example.com/articles/indexing"_string);
+
+    auto url_entries = store->autocomplete_entries("INDEX"sv, 8);
+    VERIFY(url_entries.size() == 1);
+    EXPECT_EQ(url_entries[0].url, "https://www.example.com/articles/indexing"_string);
+
+    auto title_entries = store->autocomplete_entries("gram sea"sv, 8);
+    VERIFY(title_entries.size() == 1);
+    EXPECT_EQ(title_entries[0].url, "https://www.example.com/articles/indexing"_string);
+}
+
+TEST_CASE(persisted_history_search_index_follows_title_changes_and_removals)
+{
+    auto database = TRY_OR_FAIL(Database::Database::create_memory_backed());
+    auto store = create_persisted_store(*database);
+    auto url = parse_url("https://news.example.com/story"sv);
+
+    store->record_visit(url, "Old headline"_string, UnixDateTime::from_seconds_since_epoch(10));
+    EXPECT_EQ(store->autocomplete_entries("old head"sv, 8).size(), 1u);
+
+    store->update_title(url, "Fresh headline"_string);
+    EXPECT(store->autocomplete_entries("old head"sv, 8).is_empty());
+    EXPECT_EQ(store->autocomplete_entries("fresh"sv, 8).size(), 1u);
+
+    store->record_visit(url, "Latest headline"_string, UnixDateTime::from_seconds_since_epoch(20));
+    EXPECT(store->autocomplete_entries("fresh"sv, 8).is_empty());
+    EXPECT_EQ(store->autocomplete_entries("latest"sv, 8).size(), 1u);
+
+    store->remove_entry_for_url(url);
+    EXPECT(store->autocomplete_entries("latest"sv, 8).is_empty());
+    EXPECT(store->autocomplete_entries("news"sv, 8).is_empty());
+}
@@ -99,3 +99,61 @@ TEST_CASE(storage_quota_is_enforced_per_storage_key)
     // A different storage key has its own quota.
     EXPECT(jar->set_item(WebView::StorageEndpointType::LocalStorage, "https://other.example"_string, "a"_utf16, large_value).has<Optional<Utf16String>>());
 }
+
+static size_t stored_row_count(Database::Database& database)
+{
+    auto statement = MUST(database.prepare_statement("SELECT COUNT(*) FROM WebStorage;"sv));
+
+    size_t count = 0;
+    database.execute_statement(statement, [&](auto statement_id) { count = database.result_column<u64>(statement_id, 0); });
+    return count;
+}
+
+TEST_CASE(storage_changes_are_written_back_in_batches)
+{
+    auto database = TRY_OR_FAIL(Database::Database::create_memory_backed());
+    EXPECT_EQ(TRY_OR_FAIL(WebView::StorageJar::migrate_schema(*database)), Database::MigrationOutcome::Success);
+
+    {
+        auto jar = TRY_OR_FAIL(WebView::StorageJar::create(*database));
+
+        for (size_t i = 0; i < 100; ++i)
+            jar->set_item(WebView::StorageEndpointType::LocalStorage, "https://example.com"_string, Utf16String::number(i), "value"_utf16);
+        jar->remove_item(WebView::StorageEndpointType::LocalStorage, "https://example.com"_string, "0"_utf16);
+
+        // Nothing reaches the database until the jar synchronizes.
+        EXPECT_EQ(stored_row_count(*database), 0u);
+        EXPECT_EQ(jar->get_all_keys(WebView::StorageEndpointType::LocalStorage, "https://example.com"_string).size(), 99u);
+
+        jar->synchronize();
+        EXPECT_EQ(stored_row_count(*database), 99u);
+
+        jar->clear_storage_key(WebView::StorageEndpointType::LocalStorage, "https://example.com"_string);
+        jar->set_item(WebView::StorageEndpointType::LocalStorage, "https://example.com"_string, "after-clear"_utf16, "value"_utf16);
+    }
+
+    // Destroying the jar writes back what was still pending, and a new jar reads it back from the database.
+    EXPECT_EQ(stored_row_count(*database), 1u);
+
+    auto jar = TRY_OR_FAIL(WebView::StorageJar::create(*database));
+    EXPECT_EQ(jar->get_all_keys(WebView::StorageEndpointType::LocalStorage, "https://example.com"_string), Vector { "after-clear"_utf16 });
+    EXPECT_EQ(jar->get_item(WebView::StorageEndpointType::LocalStorage, "https://example.com"_string, "after-clear"_utf16), Optional<Utf16String> { "value"_utf16 });
+}
+
+TEST_CASE(storage_quota_accounts_for_items_loaded_from_the_database)
+{
+    auto database = TRY_OR_FAIL(Database::Database::create_memory_backed());
+    EXPECT_EQ(TRY_OR_FAIL(WebView::StorageJar::migrate_schema(*database)), Database::MigrationOutcome::Success);
+
+    auto large_value = Utf16String::repeated('x', Web::StorageAPI::StorageEndpoint::LOCAL_STORAGE_QUOTA / 2 - 16);
+
+    {
+        auto jar = TRY_OR_FAIL(WebView::StorageJar::create(*database));
+        EXPECT(jar->set_item(WebView::StorageEndpointType::LocalStorage, "https://example.com"_string, "a"_utf16, large_value).has<Optional<Utf16String>>());
+        EXPECT(jar->set_item(WebView::StorageEndpointType::LocalStorage, "https://example.com"_string, "b"_utf16, large_value).has<Optional<Utf16String>>());
+    }
+
+    auto jar = TRY_OR_FAIL(WebView::StorageJar::create(*database));
+    EXPECT(jar->set_item(WebView::StorageEndpointType::LocalStorage, "https://example.com"_string, "c"_utf16, large_value).has<WebView::StorageOperationError>());
+    EXPECT_EQ(jar->usage("https://example.com"_string), 2 * (large_value.length_in_code_units() + 1));
+}
@@ -85,8 +85,11 @@ NonnullOwnPtr<Core::EventLoopImplementation> ALooperEventLoopManager::make_imple
     return ALooperEventLoopImplementation::create();
 }
 
-intptr_t ALooperEventLoopManager::register_timer(Core::EventReceiver& receiver, int milliseconds, bool should_reload)
+intptr_t ALooperEventLoopManager::register_timer(Core::EventReceiver& receiver, int milliseconds, int tolerance_milliseconds, bool should_reload)
 {
+    // FIXME: Let the timer service coalesce timers with a tolerance.
+    (void)tolerance_milliseconds;
+
     JavaEnvironment env(global_vm);
     auto& thread_data = EventLoopThreadData::the();
 
@@ -23,7 +23,7 @@ public:
     virtual ~ALooperEventLoopManager() override;
     virtual NonnullOwnPtr<Core::EventLoopImplementation> make_implementation() override;
 
-    virtual intptr_t register_timer(Core::EventReceiver&, int milliseconds, bool should_reload) override;
+    virtual intptr_t register_timer(Core::EventReceiver&, int milliseconds, int tolerance_milliseconds, bool should_reload) override;
     virtual void unregister_timer(intptr_t timer_id) override;
 
     virtual void register_notifier(Core::Notifier&) override;
@@ -260,7 +260,7 @@ NonnullOwnPtr<Core::EventLoopImplementation> EventLoopManagerMacOS::make_impleme
     return EventLoopImplementationMacOS::create();
 }
 
-intptr_t EventLoopManagerMacOS::register_timer(Core::EventReceiver& receiver, int interval_milliseconds, bool should_reload)
+intptr_t EventLoopManagerMacOS::register_timer(Core::EventReceiver& receiver, int interval_milliseconds, int tolerance_milliseconds, bool should_reload)
 {
     auto& thread_data = ThreadData::the();
 
@@ -282,6 +282,9 @@ intptr_t EventLoopManagerMacOS::register_timer(Core::EventReceiver& receiver, in
             receiver->dispatch_event(event);
         });
 
+    if (tolerance_milliseconds > 0)
+        CFRunLoopTimerSetTolerance(timer, static_cast<double>(tolerance_milliseconds) / 1000.0);
+
     CFRunLoopAddTimer(CFRunLoopGetCurrent(), timer, kCFRunLoopDefaultMode);
     thread_data.timers.set(timer_id, timer);
 
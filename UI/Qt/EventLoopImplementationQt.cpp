@@ -274,10 +274,10 @@ static void qt_timer_fired(Core::EventReceiver& object)
     object.dispatch_event(event);
 }
 
-intptr_t EventLoopManagerQt::register_timer(Core::EventReceiver& object, int milliseconds, bool should_reload)
+intptr_t EventLoopManagerQt::register_timer(Core::EventReceiver& object, int milliseconds, int tolerance_milliseconds, bool should_reload)
 {
     auto timer = new QTimer;
-    timer->setTimerType(Qt::PreciseTimer);
+    timer->setTimerType(tolerance_milliseconds > 0 ? Qt::CoarseTimer : Qt::PreciseTimer);
     timer->setInterval(milliseconds);
     timer->setSingleShot(!should_reload);
     auto weak_object = object.make_weak_ptr();
@@ -125,6 +125,15 @@ function(copy_resource_set subdir)
         add_custom_target(${target_name} DEPENDS ${outputs})
         add_dependencies(ladybird_codegen_accumulator ${target_name})
         add_dependencies("${COPY_TARGET}_build_resource_files" ${target_name})
+
+        # Every resource is also packed into the resource archive, see copy_resources_to_build.
+        set(archive_entries ${RESOURCE_ARCHIVE_ENTRIES})
+        foreach (input IN LISTS inputs)
+            get_filename_component(input_name "${input}" NAME)
+            list(APPEND archive_entries "${subdir}/${input_name}=${input}")
+        endforeach()
+        set(RESOURCE_ARCHIVE_ENTRIES ${archive_entries} PARENT_SCOPE)
+        set(RESOURCE_ARCHIVE_INPUTS ${RESOURCE_ARCHIVE_INPUTS} ${inputs} PARENT_SCOPE)
     endif()
 endfunction()
 
@@ -189,6 +198,27 @@ function(copy_resources_to_build base_directory bundle_target)
         )
     endif()
 
+    # Processes map this single file once instead of opening each resource on its own. Resources that are missing from
+    # it are still loaded from the copies above.
+    if (NOT APPLE)
+        set(archive "${base_directory}/resources.archive")
+        set(archive_generator "${LADYBIRD_SOURCE_DIR}/Meta/Generators/generate_resource_archive.py")
+
+        add_custom_command(
+            OUTPUT "${archive}"
+            DEPENDS ${RESOURCE_ARCHIVE_INPUTS} "${archive_generator}"
+            COMMAND "${CMAKE_COMMAND}" -E make_directory "${base_directory}"
+            COMMAND "${Python3_EXECUTABLE}" "${archive_generator}" -o "${archive}.tmp" ${RESOURCE_ARCHIVE_ENTRIES}
+            COMMAND "${CMAKE_COMMAND}" -E rename "${archive}.tmp" "${archive}"
+            VERBATIM
+        )
+        add_custom_target("${bundle_target}_resource_archive" DEPENDS "${archive}")
+        add_dependencies(ladybird_codegen_accumulator "${bundle_target}_resource_archive")
+        add_dependencies("${bundle_target}_build_resource_files" "${bundle_target}_resource_archive")
+
+        set(LADYBIRD_RESOURCE_ARCHIVE "${archive}" CACHE INTERNAL "Path to the generated resource archive")
+    endif()
+
     add_dependencies(${bundle_target} "${bundle_target}_build_resource_files")
 endfunction()
 
@@ -203,6 +233,9 @@ function(install_ladybird_resources destination component)
     install(FILES ${ABOUT_PAGES} DESTINATION "${destination}/ladybird/about-pages" COMPONENT ${component})
     install(FILES ${ABOUT_SETTINGS_RESOURCES} DESTINATION "${destination}/ladybird/about-pages/settings" COMPONENT ${component})
     install(FILES ${WEB_TEMPLATES} DESTINATION "${destination}/ladybird/templates" COMPONENT ${component})
+    if (LADYBIRD_RESOURCE_ARCHIVE)
+        install(FILES "${LADYBIRD_RESOURCE_ARCHIVE}" DESTINATION "${destination}" COMPONENT ${component})
+    endif()
     if (PDFJS_BUILD_FILES)
         install(FILES ${PDFJS_BUILD_FILES} DESTINATION "${destination}/ladybird/pdfjs/build" COMPONENT ${component})
         install(FILES ${PDFJS_WEB_BASE_FILES} ${PDFJS_VIEWER_HTML} DESTINATION "${destination}/ladybird/pdfjs/web" COMPONENT ${component})
@@ -844,6 +844,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(parse_only, "Parse only", "parse-only", 'p');
     args_parser.add_option(s_dump_ast, "Dump the AST", "dump-ast", 'A');
     args_parser.add_option(JS::Bytecode::g_dump_bytecode, "Dump the bytecode", "dump-bytecode", 'd');
+    args_parser.add_option(JS::Bytecode::g_collect_type_feedback, "Dump slow path type feedback on exit", "dump-type-feedback", {});
     args_parser.add_option(s_as_module, "Treat as module", "as-module", 'm');
     args_parser.add_option(s_print_last_result, "Print last result", "print-last-result", 'l');
     args_parser.add_option(s_strip_ansi, "Disable ANSI colors", "disable-ansi-colors", 'i');
@@ -941,7 +942,10 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
         // We resolve modules as if it is the first file
 
-        if (!TRY(parse_and_run(realm, builder.string_view(), source_name, parse_only)))
+        auto success = TRY(parse_and_run(realm, builder.string_view(), source_name, parse_only));
+        if (JS::Bytecode::g_collect_type_feedback)
+            JS::Bytecode::dump_type_feedback();
+        if (!success)
             return 1;
     }
 
@@ -29,6 +29,7 @@
 #include <LibMain/Main.h>
 #include <LibWasm/AbstractMachine/AbstractMachine.h>
 #include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
+#include <LibWasm/AbstractMachine/Profiler.h>
 #include <LibWasm/Printer/Printer.h>
 #include <LibWasm/Types.h>
 #if !defined(AK_OS_WINDOWS)
@@ -311,6 +312,39 @@ static ErrorOr<T, Wasm::Result> trap_for_js_exception(JS::VM& vm, JS::ThrowCompl
     return Wasm::Trap { ByteString("JS exception") };
 }
 
+static ErrorOr<void> write_profile(StringView path)
+{
+    auto& profiler = Wasm::Profiler::the();
+    profiler.stop();
+
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Write));
+    TRY(file->write_until_depleted(profiler.to_gecko_profile().serialized().bytes()));
+
+    auto profiles = profiler.function_profiles();
+    size_t sample_count = 0;
+    for (auto const& profile : profiles)
+        sample_count += profile.self_samples;
+
+    warnln("Wrote profile with {} samples to {}", sample_count, path);
+    if (sample_count == 0)
+        return {};
+
+    auto interval_ms = static_cast<double>(profiler.interval().to_microseconds()) / 1000.0;
+    warnln("  self %   self ms  total ms  interp  cranelift  tier-up ms  function");
+    for (auto const& profile : profiles.span().trim(10)) {
+        auto tier_up = profile.time_to_tier_up.map([](auto duration) { return ByteString::number(duration.to_milliseconds()); });
+        warnln("  {:>6.2f}  {:>8.1f}  {:>8.1f}  {:>6}  {:>9}  {:>10}  {}",
+            100.0 * static_cast<double>(profile.self_samples) / static_cast<double>(sample_count),
+            static_cast<double>(profile.self_samples) * interval_ms,
+            static_cast<double>(profile.total_samples) * interval_ms,
+            profile.interpreter_samples,
+            profile.cranelift_samples,
+            tier_up.value_or("-"),
+            profile.name);
+    }
+    return {};
+}
+
 ErrorOr<int> ladybird_main(Main::Arguments arguments)
 {
     StringView filename;
@@ -322,6 +356,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     [[maybe_unused]] bool wasi = false;
     Optional<u64> specific_function_address;
     ByteString exported_function_to_execute;
+    StringView profile_path;
     Vector<ParsedValue> values_to_push;
     Vector<ByteString> modules_to_link_in;
     Vector<StringView> args_if_wasi;
@@ -343,6 +378,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     parser.add_option(attempt_instantiate, "Attempt to instantiate the module", "instantiate", 'i');
     parser.add_option(exported_function_to_execute, "Attempt to execute the named exported function from the module (implies -i)", "execute", 'e', "name");
     parser.add_option(export_all_imports, "Export noop functions corresponding to imports", "export-noop");
+    parser.add_option(profile_path, "Sample the executed function and write a Firefox Profiler profile to the given file", "profile", 0, "file");
 #if !defined(AK_OS_WINDOWS)
     parser.add_option(wasi, "Enable WASI", "wasi", 'w');
 #endif
@@ -1142,7 +1178,11 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
                 outln();
             }
 
+            if (!profile_path.is_empty())
+                TRY(Wasm::Profiler::the().start());
             auto result = machine.invoke(g_interpreter, run_address.value(), move(values));
+            if (!profile_path.is_empty())
+                TRY(write_profile(profile_path));
             if (result.is_trap()) {
                 auto trap_reason = result.trap().format();
                 if (trap_reason.starts_with("exit:"sv))